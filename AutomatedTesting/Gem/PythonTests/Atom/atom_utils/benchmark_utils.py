@@ -80,6 +80,29 @@ class BenchmarkHelper(object):
             general.log('Failed to capture CPU frame time.')
         return self.capturedData
 
+    def capture_gpu_profiling_trace(self, frame_count):
+        """
+        Capture a GPU profiling trace of the passes over frame_count frames and block further execution until it has been
+        written to the disk. The trace loads in the CPU profiler visualizer like CPU captures.
+        """
+        self.handler = azlmbr.atom.ProfilingCaptureNotificationBusHandler()
+        self.handler.connect()
+        self.handler.add_callback('OnCaptureGpuProfilingTraceFinished', self.on_data_captured)
+
+        self.done = False
+        self.capturedData = False
+        success = azlmbr.atom.ProfilingCaptureRequestBus(
+            azlmbr.bus.Broadcast, "CaptureGpuProfilingTrace", f'{self.output_path}/gpu_profiling_trace.json', frame_count)
+        if success:
+            max_frames_to_wait = self.max_frames_to_wait
+            self.max_frames_to_wait = max_frames_to_wait + frame_count * 2
+            self.wait_until_data()
+            self.max_frames_to_wait = max_frames_to_wait
+            general.log('GPU profiling trace captured.')
+        else:
+            general.log('Failed to capture GPU profiling trace.')
+        return self.capturedData
+
     def on_data_captured(self, parameters):
         # the parameters come in as a tuple
         if parameters[0]:
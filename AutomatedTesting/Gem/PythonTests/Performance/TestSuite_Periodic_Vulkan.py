@@ -32,3 +32,9 @@ class TestAutomation(EditorTestSuite):
         use_null_renderer = False  # needs renderer to validate test
 
         from .tests import EditorLevelLoading_10kVegInstancesTest as test_module
+
+    class Time_EditorGameMode_10KEntityCpuPerfTest_FrameTimeBudget(EditorSingleTest):
+        extra_cmdline_args = ['-rhi=vulkan']
+        use_null_renderer = False  # needs renderer to measure frame times
+
+        from .tests import EditorGameMode_10KEntityCpuPerfTest_FrameTimeBudget as test_module
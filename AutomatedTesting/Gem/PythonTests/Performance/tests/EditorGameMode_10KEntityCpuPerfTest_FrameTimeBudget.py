@@ -0,0 +1,15 @@
+"""
+Copyright (c) Contributors to the Open 3D Engine Project.
+For complete copyright and license terms please see the LICENSE at the root of this distribution.
+
+SPDX-License-Identifier: Apache-2.0 OR MIT
+"""
+
+from Performance.utils.perf_timer import check_game_mode_frame_time_budget
+
+def EditorGameMode_10KEntityCpuPerfTest_FrameTimeBudget():
+    check_game_mode_frame_time_budget('Performance', '10KEntityCpuPerfTest', '10KEntityCpuPerfTest_GameMode')
+
+if __name__ == "__main__":
+    from editor_python_test_tools.utils import Report
+    Report.start_test(EditorGameMode_10KEntityCpuPerfTest_FrameTimeBudget)
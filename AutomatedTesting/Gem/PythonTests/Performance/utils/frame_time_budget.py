@@ -0,0 +1,145 @@
+"""
+Copyright (c) Contributors to the Open 3D Engine Project.
+For complete copyright and license terms please see the LICENSE at the root of this distribution.
+
+SPDX-License-Identifier: Apache-2.0 OR MIT
+
+Helpers to check the frame times captured by AZ::Debug::PerformanceCollector against stored baselines.
+
+The RPI performance collector writes the statistics of each capture batch to
+@user@/Performance_<category>_<timestamp>.json, where the category names the platform and the RHI,
+e.g. "Graphics-windows-dx12". Every metric of every batch is one trace event whose "args" hold the
+nearest-rank percentiles "p50", "p90" and "p99" in microseconds.
+
+Baselines are stored in Performance/baselines/<scenario>/<category>.json:
+    {
+        "tolerance": 0.1,
+        "metrics": {
+            "Engine Cpu Time": { "p50": 8000.0, "p90": 9500.0, "p99": 12000.0 }
+        }
+    }
+A percentile regresses when it exceeds its baseline value by more than the tolerance, a fraction of the
+baseline value. When there's no baseline for a scenario yet, the measured values are written as a candidate
+baseline next to the performance file, to be reviewed and copied into the baselines folder.
+"""
+
+import glob
+import json
+import os
+
+PERCENTILES = ('p50', 'p90', 'p99')
+DEFAULT_TOLERANCE = 0.1
+BASELINES_DIR = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), 'baselines')
+
+
+def find_performance_files(user_dir, log_category_prefix, newer_than=0.0):
+    """
+    :param user_dir: The project user folder the collector writes to.
+    :param log_category_prefix: The start of the log category, e.g. "Graphics".
+    :param newer_than: Only returns the files modified after this time, as returned by time.time().
+    :return: The paths of the matching performance files, oldest first.
+    """
+    pattern = os.path.join(user_dir, f'Performance_{log_category_prefix}*.json')
+    files = [path for path in glob.glob(pattern) if os.path.getmtime(path) >= newer_than]
+    return sorted(files, key=os.path.getmtime)
+
+
+def get_log_category(performance_file):
+    """
+    :return: The log category in the name of a performance file, which doesn't contain "_".
+    """
+    file_name = os.path.splitext(os.path.basename(performance_file))[0]
+    return file_name.split('_')[1]
+
+
+def load_percentiles(performance_file):
+    """
+    Reads the percentiles of each metric in a performance file.
+    Across capture batches the highest value of each percentile is kept, so a single slow batch is enough to
+    report a regression.
+
+    :return: A dictionary of metric name to a dictionary of percentile name to value in microseconds.
+    """
+    with open(performance_file, 'r') as file:
+        events = json.load(file)
+
+    percentiles = {}
+    for event in events:
+        args = event.get('args', {})
+        if not all(percentile in args for percentile in PERCENTILES):
+            # Samples logged with r_metricsDataLogType=all have no statistics.
+            continue
+        metric = percentiles.setdefault(event['name'], {})
+        for percentile in PERCENTILES:
+            metric[percentile] = max(metric.get(percentile, 0.0), float(args[percentile]))
+    return percentiles
+
+
+def get_baseline_path(scenario, log_category):
+    return os.path.join(BASELINES_DIR, scenario, f'{log_category}.json')
+
+
+def load_baseline(baseline_path):
+    """
+    :return: The baseline as a (tolerance, metrics) tuple, or None when the file doesn't exist.
+    """
+    if not os.path.exists(baseline_path):
+        return None
+    with open(baseline_path, 'r') as file:
+        baseline = json.load(file)
+    return baseline.get('tolerance', DEFAULT_TOLERANCE), baseline.get('metrics', {})
+
+
+def write_baseline(baseline_path, percentiles, tolerance=DEFAULT_TOLERANCE):
+    os.makedirs(os.path.dirname(baseline_path), exist_ok=True)
+    with open(baseline_path, 'w') as file:
+        json.dump({'tolerance': tolerance, 'metrics': percentiles}, file, indent=4, sort_keys=True)
+
+
+def find_regressions(measured, baseline_metrics, tolerance):
+    """
+    Compares measured percentiles with a baseline. Metrics that are in the baseline but weren't measured are
+    reported too, as the scenario must then have stopped exercising them. Metrics without a baseline are ignored.
+
+    :return: A list of messages, one per regression, empty when the budget is met.
+    """
+    regressions = []
+    for metric_name, baseline_percentiles in sorted(baseline_metrics.items()):
+        measured_percentiles = measured.get(metric_name)
+        if measured_percentiles is None:
+            regressions.append(f'"{metric_name}" was not measured')
+            continue
+        for percentile, baseline_value in sorted(baseline_percentiles.items()):
+            if percentile not in measured_percentiles:
+                continue
+            budget = baseline_value * (1.0 + tolerance)
+            value = measured_percentiles[percentile]
+            if value > budget:
+                regressions.append(
+                    f'"{metric_name}" {percentile} is {value:.0f}us, over its budget of {budget:.0f}us '
+                    f'(baseline {baseline_value:.0f}us + {tolerance:.0%})')
+    return regressions
+
+
+def check_frame_time_budget(scenario, performance_file):
+    """
+    Compares a performance file with the baseline of the scenario for the same platform and RHI.
+
+    :return: A (passed, messages) tuple. A scenario without a baseline passes, with a message pointing at the
+        candidate baseline that was written.
+    """
+    log_category = get_log_category(performance_file)
+    measured = load_percentiles(performance_file)
+    if not measured:
+        return False, [f'{performance_file} has no percentiles, the capture must use r_metricsDataLogType=statistical']
+
+    baseline_path = get_baseline_path(scenario, log_category)
+    baseline = load_baseline(baseline_path)
+    if baseline is None:
+        candidate_path = os.path.join(os.path.dirname(performance_file), 'baselines', scenario, f'{log_category}.json')
+        write_baseline(candidate_path, measured)
+        return True, [f'No baseline at {baseline_path}, wrote the measured percentiles to {candidate_path}']
+
+    tolerance, baseline_metrics = baseline
+    regressions = find_regressions(measured, baseline_metrics, tolerance)
+    return not regressions, regressions
@@ -9,6 +9,8 @@ import time
 
 ENTER_MSG = ("Entered game mode", "Failed to enter game mode")
 EXIT_MSG = ("Exited game mode",  "Couldn't exit game mode")
+CAPTURE_MSG = ("Captured the frame times", "Timed out capturing the frame times")
+BUDGET_MSG = ("Frame times are within the budget", "Frame times are over the budget")
 
 class Timer:
     unit_divisor = 60
@@ -70,3 +72,65 @@ def time_editor_level_loading(level_dir, level_name):
 
     # 4) Close the editor
     helper.close_editor()
+
+def check_game_mode_frame_time_budget(level_dir, level_name, scenario, capture_batches=3, frames_per_batch=600, wait_seconds=5):
+
+    """
+    Summary:
+    Capture the frame times of a level in game mode and compare their percentiles with the baseline of the scenario
+
+    Level Description:
+    Any level, the scenario names its baselines in Performance/baselines
+
+    Expected Behavior:
+    No percentile of the baseline metrics is over its baseline value plus the tolerance
+
+    Benchmark Steps:
+     1) Open the level
+     2) Enter game mode
+     3) Capture the frame times with the RPI performance collector
+     4) Exit game mode
+     5) Compare the capture with the baseline
+     6) Close the editor
+
+    :return: None
+    """
+    import azlmbr.legacy.general as general
+    import azlmbr.paths
+    from editor_python_test_tools.utils import Report
+    from editor_python_test_tools.utils import TestHelper as helper
+    from Performance.utils import frame_time_budget
+
+    helper.init_idle()
+
+    # 1) Open level
+    helper.open_level(level_dir, level_name)
+
+    # 2) Enter game mode
+    helper.enter_game_mode(ENTER_MSG)
+
+    # 3) Capture the frame times, setting the number of batches last as it starts the capture
+    capture_start_time = time.time()
+    general.run_console("r_metricsDataLogType=statistical")
+    general.run_console(f"r_metricsFrameCountPerCaptureBatch={frames_per_batch}")
+    general.run_console(f"r_metricsWaitTimePerCaptureBatch={wait_seconds}")
+    general.run_console(f"r_metricsNumberOfCaptureBatches={capture_batches}")
+    # Leaves room for frames of up to 100ms on top of the waits
+    timeout = capture_batches * (wait_seconds + frames_per_batch * 0.1)
+    captured = helper.wait_for_condition(lambda: general.get_cvar("r_metricsNumberOfCaptureBatches") == "0", timeout)
+    Report.critical_result(CAPTURE_MSG, captured)
+
+    # 4) Exit game mode
+    helper.exit_game_mode(EXIT_MSG)
+
+    # 5) Compare the capture with the baseline
+    performance_files = frame_time_budget.find_performance_files(
+        azlmbr.paths.resolve_path("@user@"), "Graphics", capture_start_time)
+    Report.critical_result(CAPTURE_MSG, len(performance_files) > 0)
+    passed, messages = frame_time_budget.check_frame_time_budget(scenario, performance_files[-1])
+    for message in messages:
+        Report.info(message)
+    Report.result(BUDGET_MSG, passed)
+
+    # 6) Close the editor
+    helper.close_editor()
@@ -8,8 +8,10 @@
 
 #include <AzCore/Asset/AssetContainer.h>
 #include <AzCore/Outcome/Outcome.h>
+#include <AzCore/Asset/AssetDataStream.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/std/optional.h>
 
 namespace AZ::Data
 {
@@ -214,6 +216,12 @@ namespace AZ::Data
             return false;
         };
 
+        // The dependency graph has been fully expanded from the catalog at this point, so hold back the file reads for the root
+        // asset and all of its dependencies and queue them with Streamer in one batch. This lets Streamer schedule all reads
+        // for the graph together instead of them trickling in one at a time.
+        AZStd::optional<AssetDataStream::StreamerRequestBatch> requestBatch;
+        requestBatch.emplace();
+
         // This will contain the list of dependent assets that have been created (or found) and queued to load.
         // We also keep a copy of the AssetInfo structure as a small optimization to avoid a redundant lookup in GetAssetInternal.
         AZStd::vector<AZStd::pair<AssetInfo, Asset<AssetData>>> dependencyAssets;
@@ -253,6 +261,9 @@ namespace AZ::Data
             AssetManager::Instance().QueueAssetReload(rootAsset, HasPreloads(rootAssetId));
         }
 
+        // Queue all the held back reads before checking if the assets are ready, as that may depend on them completing.
+        requestBatch.reset();
+
         if (!thisAsset)
         {
             AZ_Assert(false, "Root asset with id %s failed to load, asset container is invalid.",
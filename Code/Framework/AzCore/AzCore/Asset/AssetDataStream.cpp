@@ -10,14 +10,25 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Math/MathUtils.h>
 
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/std/parallel/condition_variable.h>
 
 namespace AZ::Data
 {
+    AZ_CVAR(bool, az_AssetDataStreamUseMappedArchives, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If enabled, assets stored uncompressed in memory mapped archives are used directly from the mapping instead of being "
+        "read into a buffer. Archives are only mapped if az_archive_memory_map is enabled.");
+    AZ_CVAR(bool, az_AssetDataStreamBatchRequests, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If enabled, file reads for assets that are started together, such as the dependencies of an asset, are queued with "
+        "Streamer as a single batch.");
+
     namespace DataStreamInternal
     {
         struct AssetDataStreamPrivate
@@ -25,6 +36,8 @@ namespace AZ::Data
             AZ_CLASS_ALLOCATOR(AssetDataStreamPrivate, SystemAllocator);
             //! Optional data buffer that's been directly passed in through Open(), instead of reading data from a file.
             AZStd::vector<AZ::u8> m_preloadedData;
+            //! View into a memory mapped archive if the data is used directly from the archive, instead of reading it from a file.
+            AZ::IO::MappedFileView m_mappedData;
             //! The current active streamer read request - tracked in case we need to cancel it prematurely
             AZ::IO::FileRequestPtr m_curReadRequest{ nullptr };
 
@@ -59,8 +72,41 @@ namespace AZ::Data
                 }
             }
         };
+
+        struct StreamerRequestBatchData
+        {
+            AZ_CLASS_ALLOCATOR(StreamerRequestBatchData, SystemAllocator);
+            AZStd::vector<AZ::IO::FileRequestPtr> m_requests;
+        };
+
+        //! The outermost active batch on this thread, if any.
+        static AZ_THREAD_LOCAL StreamerRequestBatchData* s_activeBatch = nullptr;
     } // namespace Internal
 
+    AssetDataStream::StreamerRequestBatch::StreamerRequestBatch()
+    {
+        if (az_AssetDataStreamBatchRequests && !DataStreamInternal::s_activeBatch)
+        {
+            m_data = AZStd::make_unique<DataStreamInternal::StreamerRequestBatchData>();
+            DataStreamInternal::s_activeBatch = m_data.get();
+        }
+    }
+
+    AssetDataStream::StreamerRequestBatch::~StreamerRequestBatch()
+    {
+        if (m_data)
+        {
+            AZ_Assert(DataStreamInternal::s_activeBatch == m_data.get(), "AssetDataStream request batches were destroyed out of order.");
+            DataStreamInternal::s_activeBatch = nullptr;
+            if (!m_data->m_requests.empty())
+            {
+                AZ_PROFILE_SCOPE(AzCore, "AssetDataStream: queue %zu batched requests", m_data->m_requests.size());
+                auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+                streamer->QueueRequestBatch(AZStd::move(m_data->m_requests));
+            }
+        }
+    }
+
     AssetDataStream::AssetDataStream(AZ::IO::IStreamerTypes::RequestMemoryAllocator* bufferAllocator)
         : m_privateData(AZStd::make_unique<DataStreamInternal::AssetDataStreamPrivate>())
         , m_bufferAllocator(bufferAllocator ? bufferAllocator : &m_defaultAllocator)
@@ -125,8 +171,18 @@ namespace AZ::Data
         m_filePath = filePath;
         m_fileOffset = fileOffset;
 
+        if (m_requestedAssetSize > 0 && OpenMapped())
+        {
+            // The data is directly available, so there's no need to go through the file streamer.
+            if (loadCallback)
+            {
+                loadCallback(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            }
+
+            m_privateData->m_readRequestActive.notify_one();
+        }
         // If the asset load is requesting more than 0 bytes of data, queue it up with the file streamer.
-        if (m_requestedAssetSize > 0)
+        else if (m_requestedAssetSize > 0)
         {
             // Set up the callback that will process the asset data once the raw file load is finished.
             auto streamerCallback = [this, loadCallback](AZ::IO::FileRequestHandle fileHandle)
@@ -178,7 +234,14 @@ namespace AZ::Data
             m_curPriority = priority;
             streamer->SetRequestCompleteCallback(m_privateData->m_curReadRequest, streamerCallback);
 
-            streamer->QueueRequest(m_privateData->m_curReadRequest);
+            if (DataStreamInternal::s_activeBatch)
+            {
+                DataStreamInternal::s_activeBatch->m_requests.push_back(m_privateData->m_curReadRequest);
+            }
+            else
+            {
+                streamer->QueueRequest(m_privateData->m_curReadRequest);
+            }
         }
         else
         {
@@ -192,6 +255,45 @@ namespace AZ::Data
         }
     }
 
+    bool AssetDataStream::OpenMapped()
+    {
+        // Custom allocators are used to place asset data in specific memory, which a mapping can't provide.
+        if (!az_AssetDataStreamUseMappedArchives || m_bufferAllocator != &m_defaultAllocator)
+        {
+            return false;
+        }
+
+        auto mappedFileProvider = AZ::Interface<AZ::IO::IMappedFileProvider>::Get();
+        if (!mappedFileProvider)
+        {
+            return false;
+        }
+
+        AZ::IO::MappedFileView view = mappedFileProvider->MapFile(AZ::IO::PathView(m_filePath));
+        if (!view || m_fileOffset + m_requestedAssetSize > view.m_data.size())
+        {
+            return false;
+        }
+
+        // Only use the mapping if the data has the same alignment as a buffer allocated for it would have.
+        const AZ::u8* data = view.m_data.data() + m_fileOffset;
+        if (!AZ::IsAligned<AZCORE_GLOBAL_NEW_ALIGNMENT>(data))
+        {
+            return false;
+        }
+
+        m_privateData->m_mappedData = AZStd::move(view);
+        // The buffer is only read from, so it's safe to cast away the const.
+        m_buffer = const_cast<AZ::u8*>(data);
+        m_loadedSize = m_requestedAssetSize;
+        return true;
+    }
+
+    bool AssetDataStream::IsMemoryMapped() const
+    {
+        return static_cast<bool>(m_privateData->m_mappedData);
+    }
+
     void AssetDataStream::Reschedule(AZ::IO::IStreamerTypes::Deadline newDeadline, AZ::IO::IStreamerTypes::Priority newPriority)
     {
         if (m_privateData->m_curReadRequest && (newDeadline < m_curDeadline || newPriority > m_curPriority))
@@ -215,6 +317,7 @@ namespace AZ::Data
     {
         // Clear all our internal state data.
         m_privateData->m_preloadedData.resize(0);
+        m_privateData->m_mappedData = {};
         m_buffer = nullptr;
         m_loadedSize = 0;
         m_requestedAssetSize = 0;
@@ -254,7 +357,7 @@ namespace AZ::Data
         AZ_Assert(m_privateData->m_curReadRequest == nullptr, "Attempting to close a stream with a read request in flight.");
 
         // Destroy the asset buffer and unlock the allocator, so the allocator itself knows that it is no longer needed.
-        if (m_buffer != m_privateData->m_preloadedData.data())
+        if (m_buffer != m_privateData->m_preloadedData.data() && !IsMemoryMapped())
         {
             m_bufferAllocator->Release(m_buffer);
         }
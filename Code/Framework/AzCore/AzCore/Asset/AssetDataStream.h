@@ -9,6 +9,7 @@
 
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -23,6 +24,7 @@ namespace AZ::Data
     namespace DataStreamInternal
     {
         struct AssetDataStreamPrivate;
+        struct StreamerRequestBatchData;
     }
 
     class AssetDataStream : public AZ::IO::GenericStream
@@ -37,6 +39,25 @@ namespace AZ::Data
         explicit AssetDataStream(AZ::IO::IStreamerTypes::RequestMemoryAllocator* bufferAllocator = nullptr);
         ~AssetDataStream() override;
 
+        //! While an instance of this is alive, the file reads of all AssetDataStreams opened on the calling thread are held back
+        //! and queued with Streamer as a single batch when the instance is destroyed. This avoids the overhead of queuing reads
+        //! one by one when a large number of loads is started at once, such as for the full dependency graph of an asset, and
+        //! lets Streamer schedule all the reads together. Batches can be nested, in which case the outermost batch queues the
+        //! reads. Don't block on a stream that was opened in a batch until the batch has been destroyed.
+        class StreamerRequestBatch final
+        {
+        public:
+            StreamerRequestBatch();
+            ~StreamerRequestBatch();
+
+            StreamerRequestBatch(const StreamerRequestBatch&) = delete;
+            StreamerRequestBatch& operator=(const StreamerRequestBatch&) = delete;
+
+        private:
+            //! Only set for the outermost batch on a thread.
+            AZStd::unique_ptr<DataStreamInternal::StreamerRequestBatchData> m_data;
+        };
+
         // Open the AssetDataStream and make a copy of the provided memory buffer.
         void Open(const VectorDataSource& data);
 
@@ -90,6 +111,13 @@ namespace AZ::Data
         //! Gets the size of data loaded (so far).
         size_t GetLoadedSize() const { return m_loadedSize; }
 
+        //! Gets the data loaded so far. If the asset is stored uncompressed in a memory mapped archive, this points directly
+        //! into the mapping so handlers can use the data without copying it. The data remains valid until the stream is closed.
+        AZStd::span<const AZ::u8> GetLoadedData() const { return { reinterpret_cast<const AZ::u8*>(m_buffer), m_loadedSize }; }
+
+        //! Whether or not the data is a view into a memory mapped archive rather than a buffer it was loaded into.
+        bool IsMemoryMapped() const;
+
         //! Request a cancellation of any current IO streamer requests.
         //! Note: This is asynchronous and not guaranteed to cancel if the request is already in-process.
         void RequestCancel();
@@ -98,6 +126,9 @@ namespace AZ::Data
         //! Perform any operations needed by all variants of Open()
         void OpenInternal(size_t assetSize, const char* streamName);
 
+        //! Try to use the data directly from a memory mapped archive. Returns false if the file isn't available that way.
+        bool OpenMapped();
+
         void ClearInternalStateData();
 
         AZStd::unique_ptr<DataStreamInternal::AssetDataStreamPrivate> m_privateData;
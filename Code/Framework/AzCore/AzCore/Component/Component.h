@@ -181,6 +181,14 @@ namespace AZ
          */
         virtual void Activate() = 0;
 
+        /**
+         * Specifies whether Activate() can run on a worker thread.
+         * (Optional) Override this function to return true if Activate() only touches the component's own data
+         * and thread-safe buses, and doesn't rely on other entities being active. Entity::ActivateEntities
+         * activates such components on the TaskExecutor, concurrently with the components of other entities.
+         */
+        virtual bool IsActivationThreadSafe() const { return false; }
+
         /**
          * Deactivates the component.
          * The system calls this function when the owning entity is being deactivated. You must
@@ -21,6 +21,7 @@
 #include <AzCore/Memory/AllocationRecords.h>
 
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 
 #include <AzCore/Metrics/EventLoggerFactoryImpl.h>
 #include <AzCore/Metrics/JsonTraceEventLogger.h>
@@ -76,6 +77,7 @@
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/utility/charconv.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/Time/TimeSystem.h>
 
 #include <AzCore/Outcome/Outcome.h> // for unexpect_t
@@ -98,6 +100,10 @@ namespace AZ::Metrics
 
 namespace AZ::Internal
 {
+    // Settings key of the number of classes the serialize context is sized for before reflection
+    constexpr AZStd::string_view ReservedSerializeClassCountKey = "/O3DE/SerializeContext/ReservedClassCount";
+    constexpr AZ::u64 DefaultReservedSerializeClassCount = 4096;
+
     static bool ShouldCreateCoreMetricsLogger(SettingsRegistryInterface& settingsRegistry)
     {
 #if !defined(AZ_RELEASE_BUILD)
@@ -924,6 +930,12 @@ namespace AZ
 
         CreateReflectionManager();
 
+        // An application reflects thousands of types, so the serialize context is sized for them up front.
+        // Projects that reflect many more types can raise the count with the setting.
+        AZ::u64 reservedClassCount = Internal::DefaultReservedSerializeClassCount;
+        m_settingsRegistry->Get(reservedClassCount, Internal::ReservedSerializeClassCountKey);
+        GetSerializeContext()->ReserveClassData(aznumeric_cast<size_t>(reservedClassCount));
+
         if (m_startupParameters.m_createEditContext)
         {
             GetSerializeContext()->CreateEditContext();
@@ -1183,6 +1195,11 @@ namespace AZ
         AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(registry);
     }
 
+    //! When set to true the settings merged by MergeSharedSettings are stored in a snapshot in the project user folder.
+    //! Later launches restore the settings from that snapshot instead of merging them, as long as none of the merged
+    //! settings files and folders have changed.
+    static constexpr AZStd::string_view SettingsRegistrySnapshotKey = "/O3DE/Settings/SettingsRegistry/Snapshot";
+
     void ComponentApplication::MergeSettingsToRegistry(SettingsRegistryInterface& registry)
     {
         if (m_startupParameters.m_loadSettingsRegistry)
@@ -1192,7 +1209,49 @@ namespace AZ
 
             AZStd::vector<char> scratchBuffer;
 
-            MergeSharedSettings(registry, specializations, scratchBuffer);
+            // Snapshots are only supported by the SettingsRegistryImpl, as the origin tracker needs to know about each merged file
+            auto settingsRegistryImpl = azrtti_cast<SettingsRegistryImpl*>(&registry);
+            bool useSnapshot = false;
+            AZ::IO::FixedMaxPath snapshotPath;
+            if (settingsRegistryImpl != nullptr && registry.Get(useSnapshot, SettingsRegistrySnapshotKey) && useSnapshot &&
+                registry.Get(snapshotPath.Native(), SettingsRegistryMergeUtils::FilePathKey_ProjectUserPath))
+            {
+                char executablePath[AZ::IO::MaxPathLength];
+                AZ::Utils::GetExecutablePathReturnType result = AZ::Utils::GetExecutablePath(executablePath, AZ_ARRAY_SIZE(executablePath));
+                useSnapshot = result.m_pathStored == AZ::Utils::ExecutablePathResult::Success && result.m_pathIncludesFilename;
+                snapshotPath /= "SettingsRegistry";
+                snapshotPath /= AZ::IO::PathView(executablePath).Stem();
+                snapshotPath.ReplaceExtension(".setregsnapshot");
+            }
+            else
+            {
+                useSnapshot = false;
+            }
+
+            if (useSnapshot)
+            {
+                // The settings merged before this point, such as the command line and the bootstrap settings, affect which
+                // files are merged, so they're part of the key together with the specializations
+                HashValue64 snapshotKey{ 0 };
+                for (size_t i = 0; i < specializations.GetCount(); ++i)
+                {
+                    AZStd::string_view specialization = specializations.GetSpecialization(i);
+                    snapshotKey = TypeHash64(reinterpret_cast<const uint8_t*>(specialization.data()), specialization.size(), snapshotKey);
+                }
+                snapshotKey = settingsRegistryImpl->GetContentHash(snapshotKey);
+
+                if (!settingsRegistryImpl->LoadSnapshot(snapshotPath.c_str(), snapshotKey))
+                {
+                    settingsRegistryImpl->StartSnapshotRecording();
+                    MergeSharedSettings(registry, specializations, scratchBuffer);
+                    AZ_Warning("Settings Registry", settingsRegistryImpl->StoreSnapshot(snapshotPath.c_str(), snapshotKey),
+                        R"(Unable to store the Settings Registry snapshot "%s".)", snapshotPath.c_str());
+                }
+            }
+            else
+            {
+                MergeSharedSettings(registry, specializations, scratchBuffer);
+            }
             MergeUserSettings(registry, specializations, scratchBuffer);
         }
     }
@@ -1599,12 +1658,36 @@ namespace AZ
             }
 #endif
         }
+
+        if (bool reportLoadTimes{}; m_settingsRegistry->Get(reportLoadTimes, ModuleManager::ReportLoadTimesSettingKey) && reportLoadTimes)
+        {
+            // Report the slowest modules first
+            AZStd::vector<AZStd::pair<AZStd::chrono::microseconds, AZ::OSString>> moduleLoadTimes;
+            ModuleManagerRequestBus::Broadcast(&ModuleManagerRequests::EnumerateModules,
+                [&moduleLoadTimes](const ModuleData& moduleData)
+                {
+                    moduleLoadTimes.emplace_back(moduleData.GetInitializationTime(), moduleData.GetDebugName());
+                    return true;
+                });
+            AZStd::sort(moduleLoadTimes.begin(), moduleLoadTimes.end(), AZStd::greater<>());
+
+            AZStd::chrono::microseconds totalLoadTime{};
+            for (const auto& [loadTime, moduleName] : moduleLoadTimes)
+            {
+                AZ_TracePrintf("ComponentApplication", "Module %s initialized in %.2f ms\n", moduleName.c_str(), loadTime.count() / 1000.0);
+                totalLoadTime += loadTime;
+            }
+            AZ_TracePrintf("ComponentApplication", "%zu modules initialized in %.2f ms\n", moduleLoadTimes.size(), totalLoadTime.count() / 1000.0);
+        }
     }
 
     void ComponentApplication::Tick()
     {
         AZ_PROFILE_SCOPE(System, "Component application simulation tick");
 
+        // Frame arena allocations from the previous tick are released at the frame boundary
+        static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::Get()).ResetFrame();
+
         // Only record when the record metrics on tick callback is set
         if (m_recordMetricsOnTickCallback)
         {
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utility/move.h>
+
+namespace AZ
+{
+    //! Contiguous storage for the hot data of a component type, keyed by the id of the entity owning the component.
+    //! A system that updates every instance of a component type can own one of these and iterate the data in a
+    //! single pass, instead of reaching each component through its entity or connecting each of them to the TickBus.
+    //! The components insert their data on activation and remove it on deactivation, and keep serving their EBus
+    //! interfaces by looking their data up through the storage.
+    //! Removal swaps the last element into the freed slot, so the order of the data is not stable and pointers to
+    //! the data are invalidated by any insertion or removal. The storage is not thread-safe.
+    template<typename DataType>
+    class ComponentDataStorage
+    {
+    public:
+        //! Adds the data of an entity, the entity must not have data in the storage yet.
+        //! @return The data added to the storage.
+        template<typename... Args>
+        DataType& Insert(EntityId entityId, Args&&... args)
+        {
+            AZ_Assert(m_indices.find(entityId) == m_indices.end(), "Entity %s already has data in the storage", entityId.ToString().c_str());
+            m_indices.emplace(entityId, m_data.size());
+            m_entityIds.push_back(entityId);
+            return m_data.emplace_back(AZStd::forward<Args>(args)...);
+        }
+
+        //! Removes the data of an entity.
+        //! @return True if the entity had data in the storage.
+        bool Remove(EntityId entityId)
+        {
+            auto entry = m_indices.find(entityId);
+            if (entry == m_indices.end())
+            {
+                return false;
+            }
+
+            const size_t index = entry->second;
+            m_indices.erase(entry);
+
+            const size_t lastIndex = m_data.size() - 1;
+            if (index != lastIndex)
+            {
+                m_data[index] = AZStd::move(m_data[lastIndex]);
+                m_entityIds[index] = m_entityIds[lastIndex];
+                m_indices[m_entityIds[index]] = index;
+            }
+            m_data.pop_back();
+            m_entityIds.pop_back();
+            return true;
+        }
+
+        //! Finds the data of an entity, returns nullptr if the entity has no data in the storage.
+        DataType* Find(EntityId entityId)
+        {
+            auto entry = m_indices.find(entityId);
+            return entry != m_indices.end() ? &m_data[entry->second] : nullptr;
+        }
+
+        const DataType* Find(EntityId entityId) const
+        {
+            auto entry = m_indices.find(entityId);
+            return entry != m_indices.end() ? &m_data[entry->second] : nullptr;
+        }
+
+        //! Calls the function with the id of each entity and its data, in storage order.
+        //! The function must not insert or remove data.
+        template<typename Function>
+        void ForEach(Function&& function)
+        {
+            for (size_t index = 0; index < m_data.size(); ++index)
+            {
+                function(m_entityIds[index], m_data[index]);
+            }
+        }
+
+        //! The data of all the entities, the entity owning each element is at the same index in GetEntityIds.
+        AZStd::span<DataType> GetData() { return m_data; }
+        AZStd::span<const DataType> GetData() const { return m_data; }
+        AZStd::span<const EntityId> GetEntityIds() const { return m_entityIds; }
+
+        size_t GetSize() const { return m_data.size(); }
+        bool IsEmpty() const { return m_data.empty(); }
+
+        void Reserve(size_t capacity)
+        {
+            m_data.reserve(capacity);
+            m_entityIds.reserve(capacity);
+            m_indices.reserve(capacity);
+        }
+
+        void Clear()
+        {
+            m_data.clear();
+            m_entityIds.clear();
+            m_indices.clear();
+        }
+
+    private:
+        AZStd::vector<DataType> m_data;
+        AZStd::vector<EntityId> m_entityIds;
+        AZStd::unordered_map<EntityId, size_t> m_indices;
+    };
+} // namespace AZ
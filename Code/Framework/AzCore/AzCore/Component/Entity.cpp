@@ -13,6 +13,7 @@
 #include <AzCore/Component/EntityUtils.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/EBus/Internal/ParallelDispatch.h>
 #include <AzCore/Component/NamedEntityId.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -208,9 +209,103 @@ namespace AZ
 
         SetState(State::Activating);
 
-        for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end(); ++it)
+        ActivateRemainingComponents(0);
+    }
+
+    void Entity::ActivateEntities(AZStd::span<Entity* const> entities)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        // Number of entities activated by each worker task, the thread-safe components of an entity tend to be few and cheap
+        constexpr size_t EntitiesPerTask = 16;
+
+        struct PendingActivation
+        {
+            Entity* m_entity;
+            size_t m_threadSafeComponentCount;
+        };
+
+        AZStd::vector<PendingActivation> pendingActivations;
+        pendingActivations.reserve(entities.size());
+        size_t threadSafeEntityCount = 0;
+
+        TaskExecutor* executor = Internal::GetParallelDispatchExecutor();
+        for (Entity* entity : entities)
+        {
+            size_t threadSafeComponentCount = 0;
+            if (executor && entity->m_state == State::Init && entity->RTTI_GetType() == azrtti_typeid<Entity>() &&
+                entity->EvaluateDependencies() == DependencySortResult::Success)
+            {
+                while (threadSafeComponentCount < entity->m_components.size() &&
+                       entity->m_components[threadSafeComponentCount]->IsActivationThreadSafe())
+                {
+                    ++threadSafeComponentCount;
+                }
+            }
+
+            if (threadSafeComponentCount > 0)
+            {
+                ++threadSafeEntityCount;
+            }
+            pendingActivations.push_back({ entity, threadSafeComponentCount });
+        }
+
+        if (threadSafeEntityCount > 0)
+        {
+            // The state changes signal listeners, so they stay on the calling thread
+            AZStd::vector<PendingActivation> threadSafeActivations;
+            threadSafeActivations.reserve(threadSafeEntityCount);
+            for (const PendingActivation& pending : pendingActivations)
+            {
+                if (pending.m_threadSafeComponentCount > 0)
+                {
+                    pending.m_entity->SetState(State::Activating);
+                    threadSafeActivations.push_back(pending);
+                }
+            }
+
+            const size_t groupEnd = threadSafeActivations.size();
+            Internal::ParallelDispatch(
+                executor,
+                &groupEnd,
+                1,
+                EntitiesPerTask,
+                [](void* userData, size_t begin, size_t end)
+                {
+                    const PendingActivation* activations = static_cast<const PendingActivation*>(userData);
+                    for (size_t index = begin; index < end; ++index)
+                    {
+                        AZ_PROFILE_SCOPE(AzCore, "Entity::ActivateEntities - thread-safe components");
+                        ComponentArrayType& components = activations[index].m_entity->m_components;
+                        for (size_t component = 0; component < activations[index].m_threadSafeComponentCount; ++component)
+                        {
+                            ActivateComponent(*components[component]);
+                        }
+                    }
+                },
+                threadSafeActivations.data());
+        }
+
+        for (const PendingActivation& pending : pendingActivations)
+        {
+            if (pending.m_threadSafeComponentCount > 0)
+            {
+                pending.m_entity->ActivateRemainingComponents(pending.m_threadSafeComponentCount);
+            }
+            else
+            {
+                pending.m_entity->Activate();
+            }
+        }
+    }
+
+    void Entity::ActivateRemainingComponents(size_t firstComponentIndex)
+    {
+        AZ_Assert(m_state == State::Activating, "Entity should be in Activating state to activate its components!");
+
+        for (size_t index = firstComponentIndex; index < m_components.size(); ++index)
         {
-            ActivateComponent(**it);
+            ActivateComponent(*m_components[index]);
         }
 
         SetState(State::Active);
@@ -19,6 +19,7 @@
 #include <AzCore/Debug/Budget.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/EBus/Event.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/string/string.h>
 
 namespace AZ
@@ -168,6 +169,14 @@ namespace AZ
         //! of each component.
         virtual void Activate();
 
+        //! Activates a batch of entities, as calling Activate on each of them in order would.
+        //! The components at the start of an entity's activation order that report Component::IsActivationThreadSafe
+        //! are activated first, on the TaskExecutor and across entities in parallel. The remaining components, the
+        //! state changes and the activation notifications then run on the calling thread, entity by entity.
+        //! Entities of derived types are activated through their own Activate function.
+        //! @param entities The entities to activate, which must be in the State::Init state.
+        static void ActivateEntities(AZStd::span<Entity* const> entities);
+
         //! Deactivates the entity and its components.
         //! This function can be called multiple times throughout the lifetime of an
         //! entity. This function calls the Deactivate function of each component.
@@ -395,6 +404,10 @@ namespace AZ
         //! @return True if the entity is in a state in which that components can be added or removed, otherwise false.
         bool CanAddRemoveComponents() const;
 
+        //! Activates the components from the given index in the activation order, then marks the entity as active.
+        //! The entity must be in the State::Activating state with its components sorted.
+        void ActivateRemainingComponents(size_t firstComponentIndex);
+
         // Helpers for child classes
         static void ActivateComponent(Component& component) { component.Activate(); }
         static void DeactivateComponent(Component& component) { component.Deactivate(); }
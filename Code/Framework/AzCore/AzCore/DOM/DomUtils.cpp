@@ -20,6 +20,257 @@ namespace AZ::Dom::Utils
     const AZ::Name PointerValueFieldName = AZ::Name::FromStringLiteral("value", AZ::Interface<AZ::NameDictionary>::Get());
     const AZ::Name PointerTypeFieldName = AZ::Name::FromStringLiteral("pointerType", AZ::Interface<AZ::NameDictionary>::Get());
 
+    namespace Internal
+    {
+        //! Visitor which forwards to another visitor only the value at a path, and skips every other value.
+        //! Once the value has been forwarded, the visitor fails with a stop request so the backend stops reading.
+        class PathFilterVisitor : public Visitor
+        {
+        public:
+            PathFilterVisitor(const Path& path, Visitor& targetVisitor)
+                : m_path(path)
+                , m_targetVisitor(targetVisitor)
+            {
+            }
+
+            //! Returns true if the value at the path was forwarded to the target visitor.
+            bool IsComplete() const
+            {
+                return m_complete;
+            }
+
+            VisitorFlags GetVisitorFlags() const override
+            {
+                // Raw keys are requested to compare them with the path without creating a Name for each of them,
+                // the base Visitor converts them for target visitors which don't support raw keys.
+                return m_targetVisitor.GetVisitorFlags() | VisitorFlags::SupportsRawKeys;
+            }
+
+            Result Null() override
+            {
+                return VisitScalar([](Visitor& visitor) { return visitor.Null(); });
+            }
+            Result Bool(bool value) override
+            {
+                return VisitScalar([value](Visitor& visitor) { return visitor.Bool(value); });
+            }
+            Result Int64(AZ::s64 value) override
+            {
+                return VisitScalar([value](Visitor& visitor) { return visitor.Int64(value); });
+            }
+            Result Uint64(AZ::u64 value) override
+            {
+                return VisitScalar([value](Visitor& visitor) { return visitor.Uint64(value); });
+            }
+            Result Double(double value) override
+            {
+                return VisitScalar([value](Visitor& visitor) { return visitor.Double(value); });
+            }
+            Result String(AZStd::string_view value, Lifetime lifetime) override
+            {
+                return VisitScalar([value, lifetime](Visitor& visitor) { return visitor.String(value, lifetime); });
+            }
+            Result RefCountedString(AZStd::shared_ptr<const AZStd::vector<char>> value, Lifetime lifetime) override
+            {
+                return VisitScalar([&value, lifetime](Visitor& visitor) { return visitor.RefCountedString(value, lifetime); });
+            }
+            Result OpaqueValue(OpaqueType& value) override
+            {
+                return VisitScalar([&value](Visitor& visitor) { return visitor.OpaqueValue(value); });
+            }
+            Result RawValue(AZStd::string_view value, Lifetime lifetime) override
+            {
+                return VisitScalar([value, lifetime](Visitor& visitor) { return visitor.RawValue(value, lifetime); });
+            }
+
+            Result StartObject() override
+            {
+                return StartContainer([](Visitor& visitor) { return visitor.StartObject(); });
+            }
+            Result EndObject(AZ::u64 attributeCount) override
+            {
+                return EndContainer([attributeCount](Visitor& visitor) { return visitor.EndObject(attributeCount); });
+            }
+            Result StartArray() override
+            {
+                return StartContainer([](Visitor& visitor) { return visitor.StartArray(); });
+            }
+            Result EndArray(AZ::u64 elementCount) override
+            {
+                return EndContainer([elementCount](Visitor& visitor) { return visitor.EndArray(elementCount); });
+            }
+            Result StartNode(AZ::Name name) override
+            {
+                return StartContainer([&name](Visitor& visitor) { return visitor.StartNode(name); });
+            }
+            Result RawStartNode(AZStd::string_view name, Lifetime lifetime) override
+            {
+                return StartContainer([name, lifetime](Visitor& visitor) { return visitor.RawStartNode(name, lifetime); });
+            }
+            Result EndNode(AZ::u64 attributeCount, AZ::u64 elementCount) override
+            {
+                return EndContainer(
+                    [attributeCount, elementCount](Visitor& visitor) { return visitor.EndNode(attributeCount, elementCount); });
+            }
+
+            Result Key(AZ::Name key) override
+            {
+                if (m_forwardDepth > 0)
+                {
+                    return m_targetVisitor.Key(key);
+                }
+                return VisitKey(key.GetStringView());
+            }
+            Result RawKey(AZStd::string_view key, Lifetime lifetime) override
+            {
+                if (m_forwardDepth > 0)
+                {
+                    return m_targetVisitor.RawKey(key, lifetime);
+                }
+                return VisitKey(key);
+            }
+
+        private:
+            //! A container the backend is reading, which isn't part of the value at the path
+            struct ContainerInfo
+            {
+                //! True if the container is on the path, and so are its entries that match the next path entry
+                bool m_onPath = false;
+                //! True if the key of the next entry was visited, otherwise the next entry is an element
+                bool m_hasKey = false;
+                //! True if the key of the next entry matches the next path entry
+                bool m_keyMatches = false;
+                //! Index of the next element
+                size_t m_nextIndex = 0;
+            };
+
+            //! Returns true if the value about to be read is on the path
+            bool IsValueOnPath() const
+            {
+                if (m_containers.empty())
+                {
+                    // The root value is on every path
+                    return true;
+                }
+
+                const ContainerInfo& container = m_containers.back();
+                if (!container.m_onPath || m_containers.size() > m_path.Size())
+                {
+                    return false;
+                }
+                if (container.m_hasKey)
+                {
+                    return container.m_keyMatches;
+                }
+                const PathEntry& entry = m_path[m_containers.size() - 1];
+                return entry.IsIndex() && !entry.IsEndOfArray() && entry.GetIndex() == container.m_nextIndex;
+            }
+
+            //! Returns true if the value about to be read is the value at the path
+            bool IsValueAtPath() const
+            {
+                return m_containers.size() == m_path.Size() && IsValueOnPath();
+            }
+
+            //! Moves to the next entry of the current container once a value has been read
+            void EndValue()
+            {
+                if (!m_containers.empty())
+                {
+                    ContainerInfo& container = m_containers.back();
+                    if (!container.m_hasKey)
+                    {
+                        ++container.m_nextIndex;
+                    }
+                    container.m_hasKey = false;
+                }
+            }
+
+            Result Complete(Result result)
+            {
+                if (!result.IsSuccess())
+                {
+                    return result;
+                }
+                m_complete = true;
+                return VisitorFailure(VisitorErrorCode::InternalError, "Read of the value at the path is complete");
+            }
+
+            Result VisitKey(AZStd::string_view key)
+            {
+                if (m_containers.empty())
+                {
+                    return VisitorFailure(VisitorErrorCode::InvalidData, "Key visited outside of a container");
+                }
+
+                ContainerInfo& container = m_containers.back();
+                container.m_hasKey = true;
+                container.m_keyMatches = false;
+                if (container.m_onPath && m_containers.size() <= m_path.Size())
+                {
+                    const PathEntry& entry = m_path[m_containers.size() - 1];
+                    container.m_keyMatches = entry.IsKey() && entry.GetKey().GetStringView() == key;
+                }
+                return VisitorSuccess();
+            }
+
+            template<class VisitFunction>
+            Result VisitScalar(VisitFunction&& visitFunction)
+            {
+                if (m_forwardDepth > 0)
+                {
+                    return visitFunction(m_targetVisitor);
+                }
+                if (IsValueAtPath())
+                {
+                    return Complete(visitFunction(m_targetVisitor));
+                }
+                EndValue();
+                return VisitorSuccess();
+            }
+
+            template<class VisitFunction>
+            Result StartContainer(VisitFunction&& visitFunction)
+            {
+                if (m_forwardDepth > 0 || IsValueAtPath())
+                {
+                    ++m_forwardDepth;
+                    return visitFunction(m_targetVisitor);
+                }
+                ContainerInfo container;
+                container.m_onPath = IsValueOnPath();
+                m_containers.push_back(container);
+                return VisitorSuccess();
+            }
+
+            template<class VisitFunction>
+            Result EndContainer(VisitFunction&& visitFunction)
+            {
+                if (m_forwardDepth > 0)
+                {
+                    --m_forwardDepth;
+                    Result result = visitFunction(m_targetVisitor);
+                    return m_forwardDepth == 0 ? Complete(AZStd::move(result)) : result;
+                }
+                if (m_containers.empty())
+                {
+                    return VisitorFailure(VisitorErrorCode::InvalidData, "Container ended without being started");
+                }
+                m_containers.pop_back();
+                EndValue();
+                return VisitorSuccess();
+            }
+
+            const Path& m_path;
+            Visitor& m_targetVisitor;
+            //! Containers on the way from the root value to the value being read
+            AZStd::vector<ContainerInfo> m_containers;
+            //! Depth of the container being forwarded to the target visitor within the value at the path
+            size_t m_forwardDepth = 0;
+            bool m_complete = false;
+        };
+    } // namespace Internal
+
     Visitor::Result ReadFromString(Backend& backend, AZStd::string_view string, AZ::Dom::Lifetime lifetime, Visitor& visitor)
     {
         return backend.ReadFromBuffer(string.data(), string.length(), lifetime, visitor);
@@ -40,6 +291,34 @@ namespace AZ::Dom::Utils
             });
     }
 
+    Visitor::Result ReadFromStringAtPath(
+        Backend& backend, AZStd::string_view string, const Path& path, AZ::Dom::Lifetime lifetime, Visitor& visitor)
+    {
+        Internal::PathFilterVisitor filterVisitor(path, visitor);
+        Visitor::Result result = backend.ReadFromBuffer(string.data(), string.length(), lifetime, filterVisitor);
+        if (filterVisitor.IsComplete())
+        {
+            // The backend stopped at the request of the filter, after the value was visited
+            return AZ::Success();
+        }
+        if (!result.IsSuccess())
+        {
+            return result;
+        }
+        return AZ::Failure(
+            VisitorError(VisitorErrorCode::InvalidData, AZStd::string::format("No value at path \"%s\"", path.ToString().c_str())));
+    }
+
+    AZ::Outcome<Value, AZStd::string> SerializedStringToValueAtPath(
+        Backend& backend, AZStd::string_view string, const Path& path, AZ::Dom::Lifetime lifetime)
+    {
+        return WriteToValue(
+            [&](Visitor& visitor)
+            {
+                return ReadFromStringAtPath(backend, string, path, lifetime, visitor);
+            });
+    }
+
     AZ::Outcome<void, AZStd::string> ValueToSerializedString(Backend& backend, Dom::Value value, AZStd::string& buffer)
     {
         Dom::Visitor::Result result = backend.WriteToBuffer(
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/DOM/DomBackend.h>
+#include <AzCore/DOM/DomPath.h>
 #include <AzCore/DOM/DomValue.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 
@@ -18,6 +19,17 @@ namespace AZ::Dom::Utils
     Visitor::Result ReadFromStringInPlace(Backend& backend, AZStd::string& string, Visitor& visitor);
 
     AZ::Outcome<Value, AZStd::string> SerializedStringToValue(Backend& backend, AZStd::string_view string, AZ::Dom::Lifetime lifetime);
+
+    //! Reads only the value at path from a serialized document and applies it to a visitor.
+    //! The values outside of path are parsed but not visited, and parsing stops once the value has been visited,
+    //! so reading a few fields of a large document doesn't require building a Value for all of it.
+    //! Fails if the document has no value at path.
+    Visitor::Result ReadFromStringAtPath(
+        Backend& backend, AZStd::string_view string, const Path& path, AZ::Dom::Lifetime lifetime, Visitor& visitor);
+    //! Reads only the value at path from a serialized document into a Value.
+    //! \see ReadFromStringAtPath
+    AZ::Outcome<Value, AZStd::string> SerializedStringToValueAtPath(
+        Backend& backend, AZStd::string_view string, const Path& path, AZ::Dom::Lifetime lifetime);
     AZ::Outcome<void, AZStd::string> ValueToSerializedString(Backend& backend, Dom::Value value, AZStd::string& buffer);
 
     AZ::Outcome<Value, AZStd::string> WriteToValue(const Backend::WriteCallback& writeCallback);
@@ -12,12 +12,27 @@
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/Date/DateFormat.h>
+#include <AzCore/std/sort.h>
 
 #include "PerformanceCollector.h"
 
 
 namespace AZ::Debug
 {
+    namespace
+    {
+        //! Returns the nearest-rank percentile of samples that are sorted in ascending order.
+        double GetPercentile(const AZStd::vector<double>& sortedSamples, double percentile)
+        {
+            if (sortedSamples.empty())
+            {
+                return 0.0;
+            }
+            const size_t rank = static_cast<size_t>(AZStd::ceil(percentile / 100.0 * static_cast<double>(sortedSamples.size())));
+            return sortedSamples[AZStd::clamp<size_t>(rank, 1, sortedSamples.size()) - 1];
+        }
+    } // namespace
+
     PerformanceCollector::PerformanceCollector(
         const AZStd::string_view logCategory,
         AZStd::span<const AZStd::string_view> m_metricNames,
@@ -31,6 +46,7 @@ namespace AZ::Debug
         {
             [[maybe_unused]] const auto statisticPtr = m_statisticsManager.AddStatistic(metricName, metricName, "us");
             AZ_Assert(statisticPtr, "Failed to add metric with name <%.*s>. Maybe already added?", AZ_STRING_ARG(metricName));
+            m_batchSamples[metricName];
         }
         RestartPeriodicEventStamps();
     }
@@ -85,6 +101,11 @@ namespace AZ::Debug
             //It is time to write the statistical summaries to the Log file.
             RecordStatistics();
             m_statisticsManager.ResetAllStatistics();
+            for (auto& [metricName, samples] : m_batchSamples)
+            {
+                // Keeps the capacity, the next batch records as many samples.
+                samples.clear();
+            }
         }
         RestartPeriodicEventStamps();
 
@@ -103,6 +124,10 @@ namespace AZ::Debug
         if (m_dataLogType == DataLogType::LogStatistics)
         {
             m_statisticsManager.PushSampleForStatistic(metricName, aznumeric_caster(microSeconds.count()));
+            if (auto samplesIt = m_batchSamples.find(metricName); samplesIt != m_batchSamples.end())
+            {
+                samplesIt->second.push_back(aznumeric_cast<double>(microSeconds.count()));
+            }
         }
         else
         {
@@ -138,7 +163,7 @@ namespace AZ::Debug
         AZ_Warning(LogName, !statistics.empty(), "There are no statistics to report.");
         for (const auto statistic : statistics)
         {
-            using EventObjectStorage = AZStd::fixed_vector<AZ::Metrics::EventField, 8>;
+            using EventObjectStorage = AZStd::fixed_vector<AZ::Metrics::EventField, 11>;
             EventObjectStorage statisticalParams;
             statisticalParams.emplace_back(AVG, statistic->GetAverage());
             statisticalParams.emplace_back(MIN, statistic->GetMinimum());
@@ -148,6 +173,14 @@ namespace AZ::Debug
             statisticalParams.emplace_back(VARIANCE, statistic->GetVariance());
             statisticalParams.emplace_back(STDEV, statistic->GetStdev());
             statisticalParams.emplace_back(MOST_RECENT_SAMPLE, statistic->GetMostRecentSample());
+            if (auto samplesIt = m_batchSamples.find(statistic->GetName()); samplesIt != m_batchSamples.end())
+            {
+                AZStd::vector<double>& samples = samplesIt->second;
+                AZStd::sort(samples.begin(), samples.end());
+                statisticalParams.emplace_back(P50, GetPercentile(samples, 50.0));
+                statisticalParams.emplace_back(P90, GetPercentile(samples, 90.0));
+                statisticalParams.emplace_back(P99, GetPercentile(samples, 99.0));
+            }
 
             Metrics::CompleteArgs completeArgs;
             completeArgs.m_name = statistic->GetName();
@@ -33,6 +33,11 @@ namespace AZ::Debug
         static constexpr AZStd::string_view VARIANCE = "variance";
         static constexpr AZStd::string_view STDEV = "stdev";
         static constexpr AZStd::string_view MOST_RECENT_SAMPLE = "mostRecentSampleValue";
+        //! Nearest-rank percentiles of the samples of the batch. Frame time budgets are usually checked against
+        //! these rather than the average, which hides the occasional long frame.
+        static constexpr AZStd::string_view P50 = "p50";
+        static constexpr AZStd::string_view P90 = "p90";
+        static constexpr AZStd::string_view P99 = "p99";
 
         //! Function signature for the notification callback that will be dispatched
         //! each time a batch of frames are measured.
@@ -130,6 +135,10 @@ namespace AZ::Debug
         //! Only used when @m_captureType == CaptureType::LogStatistics.
         AZ::Statistics::StatisticsManager<AZStd::string> m_statisticsManager;
 
+        //! The samples of each metric in the current batch, from which the percentiles are computed.
+        //! Only used when @m_captureType == CaptureType::LogStatistics.
+        AZStd::unordered_map<AZStd::string, AZStd::vector<double>> m_batchSamples;
+
         //! Only used to store the previous value when RecordPeriodicEvent() is called
         //! for any given metrics.
         AZStd::unordered_map<AZStd::string, AZStd::chrono::steady_clock::time_point> m_periodicEventStamps;
@@ -206,6 +206,22 @@ namespace AZ
         */
         static constexpr bool LocklessDispatch = false;
 
+        /**
+         * Allows AZ::ParallelBroadcast (see AzCore/EBus/ParallelDispatch.h) to dispatch an event to the
+         * handlers of this bus concurrently on the TaskGraph workers.
+         * Only set this on buses whose handlers can safely receive the event in parallel, without
+         * connecting, disconnecting or dispatching on the same bus from within the handler.
+         * Regular Broadcast and Event calls are not affected.
+         */
+        static constexpr bool EnableParallelDispatch = false;
+
+        /**
+         * Number of handlers a single task dispatches to during a parallel dispatch.
+         * Used only when #EnableParallelDispatch is true. Larger batches trade load balancing
+         * for less scheduling overhead.
+         */
+        static constexpr size_t ParallelDispatchBatchSize = 16;
+
         /**
          * Specifies where EBus data is stored.
          * This drives how many instances of this EBus exist at runtime.
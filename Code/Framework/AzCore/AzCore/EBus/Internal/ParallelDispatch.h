@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+
+    namespace Internal
+    {
+        //! Dispatches to the handlers [begin, end) of a handler snapshot, in order
+        using ParallelDispatchFunction = void (*)(void* userData, size_t begin, size_t end);
+
+        //! Returns the default TaskExecutor if the TaskGraph is active, nullptr otherwise
+        TaskExecutor* GetParallelDispatchExecutor();
+
+        //! Splits a handler snapshot into non-empty dispatch groups, given as ascending end indices (the last one being the
+        //! handler count). Groups are dispatched one after the other, in order; the handlers of a group are
+        //! dispatched concurrently in batches of batchSize handlers. Returns once every handler has been
+        //! dispatched to. Without an executor, or when no group is larger than a batch, the whole snapshot is
+        //! dispatched on the calling thread.
+        void ParallelDispatch(
+            TaskExecutor* executor,
+            const size_t* groupEnds,
+            size_t groupCount,
+            size_t batchSize,
+            ParallelDispatchFunction dispatch,
+            void* userData);
+    } // namespace Internal
+} // namespace AZ
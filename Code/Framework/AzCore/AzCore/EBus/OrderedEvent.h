@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/EBus/Internal/ParallelDispatch.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/function/function_fwd.h>
 
@@ -55,6 +56,16 @@ namespace AZ
         //! @param params variadic set of event parameters
         void Signal(const Params&... params) const;
 
+        //! Signal an event, invoking handlers of equal priority concurrently on the TaskGraph workers.
+        //! Priorities are still signaled one after the other from highest to lowest, so this is equivalent to Signal
+        //! as long as handlers sharing a priority are independent from each other.
+        //! Handlers must not connect or disconnect handlers of this event while it is signaled this way.
+        //! @param params variadic set of event parameters
+        void SignalParallel(const Params&... params) const;
+
+        //! Number of handlers invoked by a single task during SignalParallel
+        static constexpr size_t ParallelSignalBatchSize = 8;
+
     private:
 
         //! Used internally to rebind all handlers from an old event to the current event instance
@@ -68,6 +79,8 @@ namespace AZ
         // indexes for other handlers will need to be updated
         int32_t InsertHandler(OrderedEventHandler<Params...>& handler) const;
         void UpdateHandlerIndexes(int32_t startIndex) const;
+        // moves the handlers connected during a signal to the active handlers
+        void FlushAddList() const;
     private:
         // Note that these are mutable because we want Signal() to be const, but we do a bunch of book-keeping during Signal()
         mutable AZStd::vector<OrderedEventHandler<Params...>*> m_handlers; //!< Active handlers
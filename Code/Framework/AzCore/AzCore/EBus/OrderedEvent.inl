@@ -254,6 +254,69 @@ namespace AZ
             }
         }
 
+        FlushAddList();
+
+        m_updating = false;
+    }
+
+    template <typename... Params>
+    void OrderedEvent<Params...>::SignalParallel(const Params&... params) const
+    {
+        m_updating = true;
+
+        // m_handlers is sorted by priority; every run of equal priority handlers forms one dispatch group.
+        // Null entries (disconnected handlers) join whichever group they fall in and are skipped.
+        AZStd::vector<size_t> groupEnds;
+        const OrderedEventHandler<Params...>* groupHandler = nullptr;
+        for (size_t i = 0; i < m_handlers.size(); ++i)
+        {
+            const OrderedEventHandler<Params...>* handler = m_handlers[i];
+            if (handler)
+            {
+                if (groupHandler && groupHandler->m_priority != handler->m_priority)
+                {
+                    groupEnds.push_back(i);
+                }
+                groupHandler = handler;
+            }
+        }
+
+        if (groupHandler)
+        {
+            groupEnds.push_back(m_handlers.size());
+
+            auto dispatchRange = [this, &params...](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    if (OrderedEventHandler<Params...>* handler = m_handlers[i])
+                    {
+                        handler->m_callback(params...);
+                    }
+                }
+            };
+            using DispatchRange = decltype(dispatchRange);
+
+            Internal::ParallelDispatch(
+                Internal::GetParallelDispatchExecutor(),
+                groupEnds.data(),
+                groupEnds.size(),
+                ParallelSignalBatchSize,
+                [](void* userData, size_t begin, size_t end)
+                {
+                    (*static_cast<DispatchRange*>(userData))(begin, end);
+                },
+                &dispatchRange);
+        }
+
+        FlushAddList();
+
+        m_updating = false;
+    }
+
+    template <typename... Params>
+    void OrderedEvent<Params...>::FlushAddList() const
+    {
         // Update our handlers if we have pending adds
         if (!m_addList.empty())
         {
@@ -265,8 +328,6 @@ namespace AZ
             UpdateHandlerIndexes(0);
             m_addList.clear();
         }
-
-        m_updating = false;
     }
 
 
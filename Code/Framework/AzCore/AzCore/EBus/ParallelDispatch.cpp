@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/Internal/ParallelDispatch.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+
+namespace AZ::Internal
+{
+    TaskExecutor* GetParallelDispatchExecutor()
+    {
+        auto taskGraphActive = Interface<TaskGraphActiveInterface>::Get();
+        if (taskGraphActive && taskGraphActive->IsTaskGraphActive())
+        {
+            return &TaskExecutor::Instance();
+        }
+        return nullptr;
+    }
+
+    void ParallelDispatch(
+        TaskExecutor* executor,
+        const size_t* groupEnds,
+        size_t groupCount,
+        size_t batchSize,
+        ParallelDispatchFunction dispatch,
+        void* userData)
+    {
+        if (groupCount == 0 || groupEnds[groupCount - 1] == 0)
+        {
+            return;
+        }
+
+        batchSize = AZStd::max<size_t>(batchSize, 1);
+
+        bool needsTasks = false;
+        for (size_t group = 0, begin = 0; group < groupCount; begin = groupEnds[group++])
+        {
+            if (groupEnds[group] - begin > batchSize)
+            {
+                needsTasks = true;
+                break;
+            }
+        }
+
+        if (!executor || !needsTasks)
+        {
+            dispatch(userData, 0, groupEnds[groupCount - 1]);
+            return;
+        }
+
+        static const TaskDescriptor batchDescriptor{ "EBus Parallel Dispatch", "EBus" };
+
+        TaskGraph graph{ "EBus Parallel Dispatch" };
+
+        // An empty task joins consecutive groups, so a group only starts once every batch of the previous one is done
+        AZStd::vector<TaskToken> joins;
+        joins.reserve(groupCount - 1);
+
+        for (size_t group = 0, begin = 0; group < groupCount; begin = groupEnds[group++])
+        {
+            const size_t end = groupEnds[group];
+            AZ_Assert(end > begin, "Parallel dispatch groups must not be empty");
+            if (group + 1 < groupCount)
+            {
+                joins.push_back(graph.AddTask(batchDescriptor, []() {}));
+            }
+
+            for (size_t batchBegin = begin; batchBegin < end; batchBegin += batchSize)
+            {
+                const size_t batchEnd = AZStd::min(batchBegin + batchSize, end);
+                TaskToken batch = graph.AddTask(
+                    batchDescriptor,
+                    [dispatch, userData, batchBegin, batchEnd]()
+                    {
+                        dispatch(userData, batchBegin, batchEnd);
+                    });
+
+                if (group > 0)
+                {
+                    joins[group - 1].Precedes(batch);
+                }
+                if (group + 1 < groupCount)
+                {
+                    batch.Precedes(joins[group]);
+                }
+            }
+        }
+
+        TaskGraphEvent finished{ "EBus Parallel Dispatch Wait" };
+        graph.SubmitOnExecutor(*executor, &finished);
+        finished.Wait();
+    }
+} // namespace AZ::Internal
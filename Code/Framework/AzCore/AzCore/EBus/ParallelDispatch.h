@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/EBus/Internal/ParallelDispatch.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Parallel dispatch
+     * Broadcasts an event to the handlers of a bus concurrently, on the workers of the TaskGraph. The bus has to
+     * opt in by setting EBusTraits::EnableParallelDispatch.
+     *
+     * The handlers are snapshotted under the dispatch lock, which is held until every handler has been called,
+     * and dispatched in batches of EBusTraits::ParallelDispatchBatchSize handlers. On a bus using
+     * EBusHandlerPolicy::MultipleAndOrdered, handlers that are ordered relative to each other by the
+     * BusHandlerOrderCompare are still called in that order: only handlers that compare equal (for instance
+     * TickBus handlers sharing a tick order) run concurrently.
+     *
+     * Limitations:
+     *   - Handlers must not connect, disconnect or dispatch on the same bus, the dispatch lock is held by the
+     *     broadcasting thread while they run.
+     *   - The bus mutex, if any, must be recursive.
+     *   - Routers and the event queue are bypassed, and the event cannot return results.
+     *   - The broadcasting thread blocks until the event has been dispatched, so avoid broadcasting from a task.
+     *
+     * Usage:
+     * @code{.cpp}
+     *      AZ::ParallelBroadcast<MyBus>(&MyBus::Events::OnUpdate, deltaTime);
+     * @endcode
+     * Without an active TaskGraph the event is dispatched on the calling thread, in order.
+     */
+    template<class Bus, class Function, class... ArgsT>
+    void ParallelBroadcastOnExecutor(TaskExecutor* executor, Function&& func, const ArgsT&... args)
+    {
+        using Traits = typename Bus::Traits;
+        using Interface = typename Bus::InterfaceType;
+        static_assert(Traits::EnableParallelDispatch, "The bus must set EnableParallelDispatch to be dispatched in parallel");
+        static_assert(
+            !AZStd::is_same_v<typename Bus::Context::ContextMutexType, AZStd::mutex>,
+            "Parallel dispatch locks the bus mutex while enumerating handlers, use a recursive mutex");
+
+        auto* context = Bus::GetContext();
+        if (!context)
+        {
+            return;
+        }
+
+        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+
+        AZStd::vector<Interface*> handlers;
+        AZStd::vector<size_t> groupEnds;
+        Bus::EnumerateHandlers(
+            [&handlers, &groupEnds](Interface* handler)
+            {
+                if constexpr (Traits::HandlerPolicy == EBusHandlerPolicy::MultipleAndOrdered)
+                {
+                    typename Traits::BusHandlerOrderCompare compare;
+                    if (!handlers.empty() && (compare(handlers.back(), handler) || compare(handler, handlers.back())))
+                    {
+                        groupEnds.push_back(handlers.size());
+                    }
+                }
+                handlers.push_back(handler);
+                return true;
+            });
+
+        if (handlers.empty())
+        {
+            return;
+        }
+        groupEnds.push_back(handlers.size());
+
+        auto dispatchRange = [&handlers, &func, &args...](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                Traits::EventProcessingPolicy::Call(func, handlers[i], args...);
+            }
+        };
+        using DispatchRange = decltype(dispatchRange);
+
+        Internal::ParallelDispatch(
+            executor,
+            groupEnds.data(),
+            groupEnds.size(),
+            Traits::ParallelDispatchBatchSize,
+            [](void* userData, size_t begin, size_t end)
+            {
+                (*static_cast<DispatchRange*>(userData))(begin, end);
+            },
+            &dispatchRange);
+    }
+
+    //! Broadcasts an event to the handlers of the bus in parallel on the default TaskExecutor
+    template<class Bus, class Function, class... ArgsT>
+    void ParallelBroadcast(Function&& func, const ArgsT&... args)
+    {
+        ParallelBroadcastOnExecutor<Bus>(Internal::GetParallelDispatchExecutor(), AZStd::forward<Function>(func), args...);
+    }
+} // namespace AZ
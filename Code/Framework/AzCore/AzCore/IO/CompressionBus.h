@@ -61,6 +61,10 @@ namespace AZ
             bool m_isCompressed = false;
             //! Whether or not the pak file is used in multiple location or reads can be done exclusively.
             bool m_isSharedPak = false; 
+            //! Whether or not the compressed data is stored in the seekable multi-frame format from AzCore/IO/FramedCompression.h.
+            //! If set, m_decompressor is called for every individual frame instead of for the entire file, which allows
+            //! frames to be decompressed in parallel and partial reads to only decompress the frames they need.
+            bool m_isFramed = false;
         };
 
         class Compression
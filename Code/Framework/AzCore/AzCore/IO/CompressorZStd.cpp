@@ -9,6 +9,7 @@
 #if !defined(AZCORE_EXCLUDE_ZSTD)
 
 #include <AzCore/IO/CompressorZStd.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/CompressorStream.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Math/MathUtils.h>
@@ -483,6 +484,25 @@ namespace AZ::IO
             m_lastReadStream = nullptr; // reset the cache info in the m_dataBuffer
         }
     }
+
+    bool CompressorZStd::CompressFramed(AZStd::vector<AZ::u8>& output, const void* data, size_t dataSize, AZ::u32 frameSize,
+        int compressionLevel)
+    {
+        auto compressFrame = [compressionLevel](const void* uncompressed, size_t uncompressedSize, void* compressed,
+            size_t compressedBufferSize) -> size_t
+        {
+            size_t result = ZSTD_compress(compressed, compressedBufferSize, uncompressed, uncompressedSize, compressionLevel);
+            return ZSTD_isError(result) ? 0 : result;
+        };
+        return FramedCompression::Compress(output, data, dataSize, frameSize, ZSTD_compressBound(frameSize), compressFrame);
+    }
+
+    bool CompressorZStd::DecompressFrame([[maybe_unused]] const CompressionInfo& info, const void* compressed, size_t compressedSize,
+        void* uncompressed, size_t uncompressedSize)
+    {
+        size_t result = ZSTD_decompress(uncompressed, uncompressedSize, compressed, compressedSize);
+        return !ZSTD_isError(result) && result == uncompressedSize;
+    }
 } // namespace AZ::IO
 
 #endif // #if !defined(AZCORE_EXCLUDE_ZSTD)
@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/vector.h>
 
 #include <AzCore/IO/Compressor.h>
+#include <AzCore/IO/FramedCompression.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Compression/zstd_compression.h>
@@ -20,6 +21,8 @@ namespace AZ
 {
     namespace IO
     {
+        struct CompressionInfo;
+
         /**
          * Header stored after the standard compression header.
          * This structure is padded and aligned don't change members.
@@ -105,6 +108,15 @@ namespace AZ
             /// Called just before we close the stream. All compression data will be flushed and finalized. (You can't add data afterwards).
             bool Close(CompressorStream* stream) override;
 
+            /// Compresses a buffer into the seekable multi-frame format from FramedCompression.h, with every frame stored as an
+            /// independent zstd frame. Files stored this way can be decompressed in parallel by the streamer by setting
+            /// CompressionInfo::m_isFramed and using DecompressFrame as the decompressor.
+            static bool CompressFramed(AZStd::vector<AZ::u8>& output, const void* data, size_t dataSize,
+                AZ::u32 frameSize = FramedCompression::DefaultFrameSize, int compressionLevel = 3);
+            /// Decompresses a single frame produced by CompressFramed. Matches the signature of CompressionInfo::m_decompressor.
+            static bool DecompressFrame(const CompressionInfo& info, const void* compressed, size_t compressedSize,
+                void* uncompressed, size_t uncompressedSize);
+
         protected:
 
             /// Read as much data as possible and adjust the parameters.
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FramedCompression.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+
+namespace AZ::IO::FramedCompression
+{
+    namespace Internal
+    {
+        static TaskExecutor* GetFrameExecutor()
+        {
+            auto taskGraphActive = Interface<TaskGraphActiveInterface>::Get();
+            if (taskGraphActive && taskGraphActive->IsTaskGraphActive())
+            {
+                return &TaskExecutor::Instance();
+            }
+            return nullptr;
+        }
+    } // namespace Internal
+
+    bool FrameTable::Read(const void* compressed, size_t compressedSize, u64 expectedUncompressedSize)
+    {
+        m_compressedOffsets.clear();
+        m_uncompressedSize = 0;
+        m_frameSize = 0;
+
+        if (!IsFramed(compressed, compressedSize))
+        {
+            return false;
+        }
+
+        FrameHeader header;
+        memcpy(&header, compressed, sizeof(header));
+        if (header.m_frameSize == 0 ||
+            (expectedUncompressedSize != 0 && header.m_uncompressedSize != expectedUncompressedSize) ||
+            header.m_frameCount != (header.m_uncompressedSize + header.m_frameSize - 1) / header.m_frameSize)
+        {
+            return false;
+        }
+
+        const u64 tableSize = aznumeric_cast<u64>(header.m_frameCount) * sizeof(u32);
+        if (sizeof(FrameHeader) + tableSize > compressedSize)
+        {
+            return false;
+        }
+
+        const u8* sizes = reinterpret_cast<const u8*>(compressed) + sizeof(FrameHeader);
+        m_compressedOffsets.resize_no_construct(header.m_frameCount + 1);
+        u64 offset = sizeof(FrameHeader) + tableSize;
+        for (u32 i = 0; i < header.m_frameCount; ++i)
+        {
+            m_compressedOffsets[i] = offset;
+            u32 frameCompressedSize;
+            memcpy(&frameCompressedSize, sizes + i * sizeof(u32), sizeof(u32));
+            offset += frameCompressedSize;
+        }
+        m_compressedOffsets[header.m_frameCount] = offset;
+
+        if (offset > compressedSize)
+        {
+            m_compressedOffsets.clear();
+            return false;
+        }
+
+        m_uncompressedSize = header.m_uncompressedSize;
+        m_frameSize = header.m_frameSize;
+        return true;
+    }
+
+    u64 FrameTable::GetUncompressedSize(u32 frame) const
+    {
+        u64 offset = GetUncompressedOffset(frame);
+        return AZStd::min<u64>(m_frameSize, m_uncompressedSize - offset);
+    }
+
+    bool IsFramed(const void* compressed, size_t compressedSize)
+    {
+        if (compressedSize < sizeof(FrameHeader))
+        {
+            return false;
+        }
+        FrameHeader header;
+        memcpy(&header, compressed, sizeof(header));
+        return header.m_magic == FrameMagic && header.m_version == FrameVersion;
+    }
+
+    bool Compress(AZStd::vector<u8>& output, const void* uncompressed, size_t uncompressedSize, u32 frameSize,
+        size_t maxCompressedFrameSize, const CompressFrameFunc& compressFrame)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        AZ_Assert(frameSize > 0, "Frame size for framed compression can't be zero.");
+        AZ_Assert(maxCompressedFrameSize > 0, "Maximum compressed frame size for framed compression can't be zero.");
+
+        FrameHeader header;
+        header.m_frameSize = frameSize;
+        header.m_uncompressedSize = uncompressedSize;
+        header.m_frameCount = aznumeric_cast<u32>((aznumeric_cast<u64>(uncompressedSize) + frameSize - 1) / frameSize);
+
+        const size_t tableOffset = sizeof(FrameHeader);
+        const size_t dataOffset = tableOffset + header.m_frameCount * sizeof(u32);
+        output.resize_no_construct(dataOffset);
+        memcpy(output.data(), &header, sizeof(header));
+
+        const u8* source = reinterpret_cast<const u8*>(uncompressed);
+        size_t cursor = dataOffset;
+        for (u32 i = 0; i < header.m_frameCount; ++i)
+        {
+            size_t frameStart = aznumeric_cast<size_t>(i) * frameSize;
+            size_t frameLength = AZStd::min<size_t>(frameSize, uncompressedSize - frameStart);
+
+            output.resize_no_construct(cursor + maxCompressedFrameSize);
+            size_t compressedFrameSize = compressFrame(source + frameStart, frameLength, output.data() + cursor, maxCompressedFrameSize);
+            if (compressedFrameSize == 0 || compressedFrameSize > maxCompressedFrameSize)
+            {
+                output.clear();
+                return false;
+            }
+
+            u32 storedSize = aznumeric_cast<u32>(compressedFrameSize);
+            memcpy(output.data() + tableOffset + i * sizeof(u32), &storedSize, sizeof(u32));
+            cursor += compressedFrameSize;
+        }
+        output.resize(cursor);
+        return true;
+    }
+
+    bool Decompress(const FrameTable& table, const void* compressed, size_t compressedSize, u64 readOffset, u64 readSize,
+        void* output, const DecompressFrameFunc& decompressFrame, bool allowParallel)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        if (readSize == 0)
+        {
+            return true;
+        }
+        if (readOffset + readSize > table.GetUncompressedSize() ||
+            (table.GetFrameCount() > 0 && table.GetCompressedOffset(table.GetFrameCount() - 1) +
+                table.GetCompressedSize(table.GetFrameCount() - 1) > compressedSize))
+        {
+            return false;
+        }
+
+        const u8* source = reinterpret_cast<const u8*>(compressed);
+        u8* target = reinterpret_cast<u8*>(output);
+        const u64 readEnd = readOffset + readSize;
+        const u32 firstFrame = table.GetFrameIndex(readOffset);
+        const u32 lastFrame = table.GetFrameIndex(readEnd - 1);
+
+        AZStd::atomic_bool success{ true };
+        auto decompress = [&](u32 frame)
+        {
+            const u64 frameStart = table.GetUncompressedOffset(frame);
+            const u64 frameSize = table.GetUncompressedSize(frame);
+            const u8* frameData = source + table.GetCompressedOffset(frame);
+            const size_t frameCompressedSize = aznumeric_cast<size_t>(table.GetCompressedSize(frame));
+
+            const u64 copyStart = AZStd::max(frameStart, readOffset);
+            const u64 copyEnd = AZStd::min(frameStart + frameSize, readEnd);
+            bool result;
+            if (copyStart == frameStart && copyEnd == frameStart + frameSize)
+            {
+                result = decompressFrame(frameData, frameCompressedSize, target + (frameStart - readOffset), aznumeric_cast<size_t>(frameSize));
+            }
+            else
+            {
+                AZStd::unique_ptr<u8[]> frameBuffer = AZStd::unique_ptr<u8[]>(new u8[frameSize]);
+                result = decompressFrame(frameData, frameCompressedSize, frameBuffer.get(), aznumeric_cast<size_t>(frameSize));
+                if (result)
+                {
+                    memcpy(target + (copyStart - readOffset), frameBuffer.get() + (copyStart - frameStart), copyEnd - copyStart);
+                }
+            }
+            if (!result)
+            {
+                success = false;
+            }
+        };
+
+        TaskExecutor* executor = (allowParallel && firstFrame != lastFrame) ? Internal::GetFrameExecutor() : nullptr;
+        if (executor)
+        {
+            TaskGraph graph{ "Framed decompression" };
+            TaskDescriptor descriptor{ "Decompress frame", "IO" };
+            for (u32 frame = firstFrame; frame <= lastFrame; ++frame)
+            {
+                graph.AddTask(descriptor, [&decompress, frame]()
+                    {
+                        decompress(frame);
+                    });
+            }
+            TaskGraphEvent finished{ "Framed decompression finished" };
+            graph.SubmitOnExecutor(*executor, &finished);
+            finished.Wait();
+        }
+        else
+        {
+            for (u32 frame = firstFrame; frame <= lastFrame; ++frame)
+            {
+                decompress(frame);
+            }
+        }
+        return success;
+    }
+} // namespace AZ::IO::FramedCompression
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+//! Seekable container for compressed data. The uncompressed data is split into frames of equal size (except for the
+//! last frame) that are compressed independently, so any range of the data can be decompressed by only decompressing
+//! the frames that overlap it and frames can be decompressed in parallel. The container is codec independent; the
+//! callbacks provided to Compress and Decompress determine how the individual frames are encoded.
+//!
+//! Layout (little endian):
+//!     FrameHeader
+//!     u32 compressed size of each frame [FrameHeader::m_frameCount]
+//!     compressed frames, back to back
+namespace AZ::IO::FramedCompression
+{
+    inline static constexpr u32 FrameMagic = 0x52465a41; // "AZFR"
+    inline static constexpr u32 FrameVersion = 1;
+    inline static constexpr u32 DefaultFrameSize = 256 * 1024;
+
+    struct FrameHeader
+    {
+        u32 m_magic{ FrameMagic };
+        u32 m_version{ FrameVersion };
+        u32 m_frameCount{ 0 };
+        //! Uncompressed size of every frame except the last one, which can be smaller.
+        u32 m_frameSize{ 0 };
+        u64 m_uncompressedSize{ 0 };
+    };
+    static_assert(sizeof(FrameHeader) == 24, "FrameHeader is stored on disk and can't change in size.");
+
+    //! Compresses a single frame. Returns the number of bytes written to the compressed buffer or 0 if compression failed.
+    using CompressFrameFunc = AZStd::function<size_t(const void* uncompressed, size_t uncompressedSize,
+        void* compressed, size_t compressedBufferSize)>;
+    //! Decompresses a single frame. The uncompressed buffer is exactly the size of the uncompressed frame.
+    using DecompressFrameFunc = AZStd::function<bool(const void* compressed, size_t compressedSize,
+        void* uncompressed, size_t uncompressedSize)>;
+
+    //! Lookup table from uncompressed offsets to the frames in a framed compressed buffer.
+    class FrameTable
+    {
+    public:
+        //! Reads the frame table from the start of a framed compressed buffer. Returns false if the buffer doesn't
+        //! contain a valid frame table. If expectedUncompressedSize isn't zero, it's also checked against the header.
+        bool Read(const void* compressed, size_t compressedSize, u64 expectedUncompressedSize = 0);
+
+        u32 GetFrameCount() const { return aznumeric_cast<u32>(m_compressedOffsets.empty() ? 0 : m_compressedOffsets.size() - 1); }
+        u32 GetFrameSize() const { return m_frameSize; }
+        u64 GetUncompressedSize() const { return m_uncompressedSize; }
+
+        //! Returns the frame that contains the byte at the given uncompressed offset.
+        u32 GetFrameIndex(u64 uncompressedOffset) const { return aznumeric_cast<u32>(uncompressedOffset / m_frameSize); }
+        //! Offset of the compressed frame, relative to the start of the compressed buffer.
+        u64 GetCompressedOffset(u32 frame) const { return m_compressedOffsets[frame]; }
+        u64 GetCompressedSize(u32 frame) const { return m_compressedOffsets[frame + 1] - m_compressedOffsets[frame]; }
+        u64 GetUncompressedOffset(u32 frame) const { return aznumeric_cast<u64>(frame) * m_frameSize; }
+        u64 GetUncompressedSize(u32 frame) const;
+
+    private:
+        //! Offsets of all frames plus the end of the last frame.
+        AZStd::vector<u64> m_compressedOffsets;
+        u64 m_uncompressedSize{ 0 };
+        u32 m_frameSize{ 0 };
+    };
+
+    //! Returns true if the buffer starts with a framed compression header.
+    bool IsFramed(const void* compressed, size_t compressedSize);
+
+    //! Compresses the data into the framed format and stores it in output.
+    //! @param frameSize The uncompressed size of a frame. Smaller frames allow for more parallelism and less waste for
+    //!     partial reads, but compress worse.
+    //! @param maxCompressedFrameSize The largest size a frame of frameSize can take once compressed, as reported by
+    //!     the codec. Used to size the intermediate buffer.
+    bool Compress(AZStd::vector<u8>& output, const void* uncompressed, size_t uncompressedSize, u32 frameSize,
+        size_t maxCompressedFrameSize, const CompressFrameFunc& compressFrame);
+
+    //! Decompresses the uncompressed range [readOffset, readOffset + readSize) into output, which needs to be at least
+    //! readSize bytes. Only the frames that overlap the range are decompressed. Frames that are fully covered by the
+    //! range are decompressed directly into the output, others go through a temporary buffer.
+    //! If allowParallel is true and the task graph is active, frames are decompressed in parallel on the global
+    //! task executor and this call blocks until they've all completed. Don't call this from a task on that executor.
+    bool Decompress(const FrameTable& table, const void* compressed, size_t compressedSize, u64 readOffset, u64 readSize,
+        void* output, const DecompressFrameFunc& decompressFrame, bool allowParallel = true);
+} // namespace AZ::IO::FramedCompression
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/Path/Path_fwd.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTIMacros.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace AZ::IO
+{
+    //! Read-only memory mapping of an entire file. The operating system pages the file in on demand and can share the
+    //! pages with its file cache, so reading from the mapping doesn't require a copy of the file in memory.
+    class MappedFile final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MappedFile, SystemAllocator);
+
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        //! Maps the file at the given absolute path. Returns false if the file doesn't exist, is empty or can't be mapped.
+        bool Open(const char* filePath);
+        void Close();
+
+        bool IsOpen() const { return m_data != nullptr; }
+        const u8* GetData() const { return m_data; }
+        u64 GetSize() const { return m_size; }
+
+    private:
+        const u8* m_data{ nullptr };
+        u64 m_size{ 0 };
+    };
+
+    //! A view into part of a memory mapped file. The view keeps the mapping alive for as long as it exists.
+    struct MappedFileView
+    {
+        explicit operator bool() const { return m_file && !m_data.empty(); }
+
+        AZStd::shared_ptr<const MappedFile> m_file;
+        AZStd::span<const u8> m_data;
+    };
+
+    //! Interface for systems that store files inside other files, such as archives, and can provide views into a memory
+    //! mapping of the containing file for files that are stored uncompressed.
+    class IMappedFileProvider
+    {
+    public:
+        AZ_RTTI(AZ::IO::IMappedFileProvider, "{5C1C5D2A-0F1A-49C1-9A0B-1A8E0F3C7B21}");
+
+        virtual ~IMappedFileProvider() = default;
+
+        //! Returns a view of the data of the file, or an empty view if the file isn't stored uncompressed in a mappable file.
+        virtual MappedFileView MapFile(PathView filePath) = 0;
+    };
+} // namespace AZ::IO
@@ -9,6 +9,7 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/FramedCompression.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
@@ -650,7 +651,15 @@ namespace AZ::IO
                 info.m_alignmentOffset = aznumeric_caster(data->m_compressionInfo.m_offset -
                     AZ_SIZE_ALIGN_DOWN(data->m_compressionInfo.m_offset, aznumeric_cast<size_t>(m_alignment)));
 
-                if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
+                if (data->m_compressionInfo.m_isFramed)
+                {
+                    auto job = [this, &info]()
+                    {
+                        FramedDecompression(m_context, info);
+                    };
+                    decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
+                }
+                else if (!NeedsDecompressionBuffer(*data))
                 {
                     auto job = [this, &info]()
                     {
@@ -703,7 +712,7 @@ namespace AZ::IO
         size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
         size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
         m_memoryUsage -= bufferSize;
-        if (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize)
+        if (NeedsDecompressionBuffer(*data))
         {
             m_memoryUsage -= data->m_compressionInfo.m_uncompressedSize;
         }
@@ -768,6 +777,48 @@ namespace AZ::IO
         context->WakeUpSchedulingThread();
     }
 
+    void FullFileDecompressor::FramedDecompression(StreamerContext* context, DecompressionInformation& info)
+    {
+        info.m_jobStartTime = AZStd::chrono::steady_clock::now();
+
+        FileRequest* compressedRequest = info.m_waitRequest->GetParent();
+        AZ_Assert(compressedRequest, "A wait request attached to FullFileDecompressor was completed but didn't have a parent compressed request.");
+        auto request = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        AZ_Assert(request, "Compressed request in FullFileDecompressor that's running framed decompression didn't contain compression read data.");
+        CompressionInfo& compressionInfo = request->m_compressionInfo;
+        AZ_Assert(compressionInfo.m_decompressor, "Framed decompressor job started, but there's no decompressor callback assigned.");
+
+        const u8* compressedData = info.m_compressedData + info.m_alignmentOffset;
+        FramedCompression::FrameTable frameTable;
+        bool success = frameTable.Read(compressedData, compressionInfo.m_compressedSize, compressionInfo.m_uncompressedSize);
+        if (success)
+        {
+            auto decompressFrame = [&compressionInfo](const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedSize)
+            {
+                return compressionInfo.m_decompressor(compressionInfo, compressed, compressedSize, uncompressed, uncompressedSize);
+            };
+            // This runs on one of the dedicated decompression threads, so it's safe to wait for the task executor.
+            success = FramedCompression::Decompress(frameTable, compressedData, compressionInfo.m_compressedSize,
+                request->m_readOffset, request->m_readSize, request->m_output, decompressFrame);
+        }
+        else
+        {
+            AZ_Error("Streamer", false, "File at offset %zu in archive '%s' is marked as framed but doesn't contain a valid frame table.",
+                compressionInfo.m_offset, compressionInfo.m_archiveFilename.GetRelativePath());
+        }
+        info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+
+        context->MarkRequestAsCompleted(info.m_waitRequest);
+        context->WakeUpSchedulingThread();
+    }
+
+    bool FullFileDecompressor::NeedsDecompressionBuffer(const Requests::CompressedReadData& data)
+    {
+        // Framed files only decompress the frames that are needed, so those never need to decompress the entire file.
+        return !data.m_compressionInfo.m_isFramed &&
+            (data.m_readOffset != 0 || data.m_readSize != data.m_compressionInfo.m_uncompressedSize);
+    }
+
     void FullFileDecompressor::Report(const Requests::ReportData& data) const
     {
         switch (data.m_reportType)
@@ -24,6 +24,7 @@ namespace AZ::IO
     namespace Requests
     {
         struct ReadRequestData;
+        struct CompressedReadData;
         struct ReportData;
     }
 
@@ -107,6 +108,10 @@ namespace AZ::IO
 
         static void FullDecompression(StreamerContext* context, DecompressionInformation& info);
         static void PartialDecompression(StreamerContext* context, DecompressionInformation& info);
+        //! Decompresses only the frames of a seekable multi-frame file that overlap the requested range. Frames are
+        //! spread over the task executor so a single large file doesn't serialize on one decompression thread.
+        static void FramedDecompression(StreamerContext* context, DecompressionInformation& info);
+        static bool NeedsDecompressionBuffer(const Requests::CompressedReadData& data);
 
         void Report(const Requests::ReportData& data) const;
 
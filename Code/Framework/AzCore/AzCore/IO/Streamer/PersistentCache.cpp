@@ -0,0 +1,815 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/PersistentCache.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> PersistentCacheConfig::AddStreamStackEntry(
+        [[maybe_unused]] const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        auto stackEntry = AZStd::make_shared<PersistentCache>(
+            m_cachePath, m_cacheSizeMib * 1_mib, m_maxPendingWriteSizeMib * 1_mib, m_minFileSizeKib * 1_kib);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void PersistentCacheConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<PersistentCacheConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("CachePath", &PersistentCacheConfig::m_cachePath)
+                ->Field("CacheSizeMib", &PersistentCacheConfig::m_cacheSizeMib)
+                ->Field("MaxPendingWriteSizeMib", &PersistentCacheConfig::m_maxPendingWriteSizeMib)
+                ->Field("MinFileSizeKib", &PersistentCacheConfig::m_minFileSizeKib);
+        }
+    }
+
+    static constexpr char CacheHitRateName[] = "Cache hit rate";
+    static constexpr char CacheableName[] = "Cacheable";
+    static constexpr char IndexFileName[] = "index.bin";
+    static constexpr u32 IndexMagic = 0x43505a41; // "AZPC"
+    static constexpr u32 EntryMagic = 0x45505a41; // "AZPE"
+
+    PersistentCache::PersistentCache(AZStd::string_view cachePath, u64 cacheSize, u64 maxPendingWriteSize, u64 minFileSize)
+        : StreamStackEntry("Persistent cache")
+        , m_cachePath(AZ::IO::PathView(cachePath))
+        , m_cacheSize(cacheSize)
+        , m_maxPendingWriteSize(maxPendingWriteSize)
+        , m_minFileSize(minFileSize)
+    {
+        // A single thread is used so files are written and removed in the order they were given to the job.
+        JobManagerDesc jobDesc;
+        jobDesc.m_jobManagerName = "Persistent Cache";
+        jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+        m_fileJobManager = AZStd::make_unique<JobManager>(jobDesc);
+        m_fileJobContext = AZStd::make_unique<JobContext>(*m_fileJobManager);
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(Statistic::TimeValue(1));
+    }
+
+    PersistentCache::~PersistentCache()
+    {
+        AZ_Assert(!m_fileJobInFlight, "The persistent cache was destroyed while a file job was still running.");
+        m_fileJobContext.reset();
+        m_fileJobManager.reset();
+        // The context is destroyed before the stack, so files are removed directly from here on.
+        m_context = nullptr;
+
+        // Requests that are still in flight have already been completed or canceled at this point, but the
+        // writes may still be pending. Finish them so the work isn't lost.
+        for (const AZStd::string& path : m_pendingDeletes)
+        {
+            SystemFile::Delete(path.c_str());
+        }
+        m_pendingDeletes.clear();
+        while (!m_pendingWrites.empty())
+        {
+            PendingWrite& write = m_pendingWrites.front();
+            if (write.m_entry.m_size <= m_cacheSize && m_entries.find(write.m_key) == m_entries.end())
+            {
+                EvictEntries(write.m_entry.m_size);
+                for (const AZStd::string& path : m_pendingDeletes)
+                {
+                    SystemFile::Delete(path.c_str());
+                }
+                m_pendingDeletes.clear();
+
+                if (WriteFile(GetEntryPath(write.m_key), write))
+                {
+                    write.m_entry.m_lastUsed = ++m_useCounter;
+                    m_cacheUsage += write.m_entry.m_size;
+                    m_entries.emplace(write.m_key, write.m_entry);
+                    m_indexDirty = true;
+                }
+            }
+            ReleaseWrite(write);
+            m_pendingWrites.pop_front();
+        }
+        if (m_indexDirty)
+        {
+            StoreIndex();
+        }
+    }
+
+    void PersistentCache::PrepareRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void PersistentCache::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                ReadCompressedFile(request, args);
+            }
+            else
+            {
+                if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+                {
+                    FlushCache(args.m_path);
+                }
+                else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+                {
+                    FlushEntireCache();
+                }
+                else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+                {
+                    Report(args);
+                }
+                StreamStackEntry::QueueRequest(request);
+            }
+        }, request->GetCommand());
+    }
+
+    bool PersistentCache::ExecuteRequests()
+    {
+        bool result = StreamStackEntry::ExecuteRequests();
+        // Writing to the cache is never time critical so only do it when there's nothing to read from the cache. This
+        // also guarantees that files aren't removed while they're being read.
+        if (m_inFlightHits.empty())
+        {
+            result = StartFileJob() || result;
+        }
+        return result;
+    }
+
+    void PersistentCache::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_isIdle = status.m_isIdle && m_inFlightHits.empty() && m_pendingWrites.empty() && m_pendingDeletes.empty() &&
+            !m_fileJobInFlight;
+    }
+
+    void PersistentCache::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+        StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        // Reads from the cache are queued in the next entry ahead of the requests that haven't been queued yet, so these
+        // will complete first.
+        u64 totalBytesRead = m_readSizeAverage.GetTotal();
+        double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+        auto estimate = [&now, totalBytesRead, totalReadTime](FileRequest* request, u64 size)
+        {
+            now += Statistic::TimeValue(aznumeric_cast<u64>((size * totalReadTime) / totalBytesRead));
+            request->SetEstimatedCompletion(now);
+        };
+
+        for (FileRequest* request : m_inFlightHits)
+        {
+            estimate(request, AZStd::get<Requests::CompressedReadData>(request->GetCommand()).m_readSize);
+        }
+
+        // The next entry will have estimated requests that will be read from the cache as if they need to be decompressed. Only
+        // archives that have been used before are checked as looking up the modification time of an archive is too slow here.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            if (auto data = AZStd::get_if<Requests::CompressedReadData>(&(*requestIt)->GetCommand()); data != nullptr)
+            {
+                if (FindEntry(data->m_compressionInfo, false) != nullptr)
+                {
+                    estimate(*requestIt, data->m_readSize);
+                }
+            }
+        }
+    }
+
+    void PersistentCache::ReadCompressedFile(FileRequest* request, Requests::CompressedReadData& data)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        if (!m_next)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        LoadIndex();
+
+        const CompressionInfo& info = data.m_compressionInfo;
+        Key key;
+        u64 modificationTime;
+        if (info.m_uncompressedSize < m_minFileSize || !CalculateKey(key, modificationTime, info, true))
+        {
+            m_cacheableStat.PushSample(0.0);
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+        m_cacheableStat.PushSample(1.0);
+
+        if (auto it = m_entries.find(key); it != m_entries.end() && IsMatch(it->second, info, modificationTime))
+        {
+            m_hitRateStat.PushSample(1.0);
+            it->second.m_lastUsed = ++m_useCounter;
+            m_indexDirty = true;
+            ReadFromCache(request, key);
+            return;
+        }
+        m_hitRateStat.PushSample(0.0);
+
+        // Only full reads are stored in the cache as partial reads don't return the entire file. This is the most common case
+        // as the entire file needs to be decompressed anyway.
+        if (data.m_readOffset != 0 || data.m_readSize != info.m_uncompressedSize ||
+            m_pendingWriteSize + info.m_uncompressedSize > m_maxPendingWriteSize)
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        // Have the next entry decompress the file on behalf of this request so the decompressed data can be captured before
+        // the request completes and ownership of the output is returned.
+        FileRequest* decompressRequest = m_context->GetNewInternalRequest();
+        decompressRequest->CreateCompressedRead(request, info, data.m_output, data.m_readOffset, data.m_readSize);
+        decompressRequest->SetCompletionCallback([this, key, modificationTime](FileRequest& decompressed)
+            {
+                AZ_PROFILE_SCOPE(AzCore, "PersistentCache::ReadCompressedFile completion");
+                if (decompressed.GetStatus() != IStreamerTypes::RequestStatus::Completed)
+                {
+                    return;
+                }
+                auto& decompressedData = AZStd::get<Requests::CompressedReadData>(decompressed.GetCommand());
+                const CompressionInfo& decompressedInfo = decompressedData.m_compressionInfo;
+
+                PendingWrite write;
+                write.m_key = key;
+                write.m_entry.m_archivePath = decompressedInfo.m_archiveFilename.GetAbsolutePath().Native();
+                write.m_entry.m_modificationTime = modificationTime;
+                write.m_entry.m_offset = decompressedInfo.m_offset;
+                write.m_entry.m_size = decompressedInfo.m_uncompressedSize;
+                write.m_data = reinterpret_cast<u8*>(azmalloc(write.m_entry.m_size, alignof(u8), AZ::SystemAllocator));
+                memcpy(write.m_data, decompressedData.m_output, write.m_entry.m_size);
+                m_pendingWriteSize += write.m_entry.m_size;
+                m_pendingWrites.push_back(AZStd::move(write));
+            });
+        StreamStackEntry::QueueRequest(decompressRequest);
+    }
+
+    void PersistentCache::ReadFromCache(FileRequest* request, Key key)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        // The cached file is read by the rest of the stack like any other file. The read isn't a child of the original request
+        // because a failed read would otherwise fail the original request, while the file can still be decompressed instead.
+        auto& data = AZStd::get<Requests::CompressedReadData>(request->GetCommand());
+        m_inFlightHits.push_back(request);
+
+        FileRequest* cacheRead = m_context->GetNewInternalRequest();
+        cacheRead->CreateRead(nullptr, data.m_output, data.m_readSize, RequestPath(AZ::IO::PathView(GetEntryPath(key))),
+            data.m_readOffset, data.m_readSize);
+        cacheRead->SetCompletionCallback([this, request, key, startTime = AZStd::chrono::steady_clock::now()](FileRequest& read)
+            {
+                FinishCacheRead(request, key, read.GetStatus() == IStreamerTypes::RequestStatus::Completed, startTime);
+            });
+        StreamStackEntry::QueueRequest(cacheRead);
+    }
+
+    void PersistentCache::FinishCacheRead(FileRequest* request, Key key, bool success, AZStd::chrono::steady_clock::time_point startTime)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        auto it = AZStd::find(m_inFlightHits.begin(), m_inFlightHits.end(), request);
+        AZ_Assert(it != m_inFlightHits.end(), "A read from the persistent cache completed for a request that isn't tracked.");
+        m_inFlightHits.erase(it);
+
+        auto& data = AZStd::get<Requests::CompressedReadData>(request->GetCommand());
+        if (success)
+        {
+            m_readTimeAverage.PushEntry(
+                AZStd::chrono::duration_cast<Statistic::TimeValue>(AZStd::chrono::steady_clock::now() - startTime));
+            m_readSizeAverage.PushEntry(data.m_readSize);
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+        else
+        {
+            AZ_Warning("Streamer", false, "Unable to read '%s' from the persistent cache. The file will be decompressed instead.",
+                data.m_compressionInfo.m_archiveFilename.GetRelativePathCStr());
+            RemoveEntry(key);
+            StreamStackEntry::QueueRequest(request);
+        }
+    }
+
+    bool PersistentCache::StartFileJob()
+    {
+        if (m_fileJobInFlight || (m_pendingWrites.empty() && m_pendingDeletes.empty()))
+        {
+            return false;
+        }
+
+        // Make room for the write first, so the files of the evicted entries are removed by the same job.
+        if (!m_pendingWrites.empty())
+        {
+            m_activeWrite = AZStd::move(m_pendingWrites.front());
+            m_pendingWrites.pop_front();
+            if (m_activeWrite.m_entry.m_size <= m_cacheSize && m_entries.find(m_activeWrite.m_key) == m_entries.end())
+            {
+                EvictEntries(m_activeWrite.m_entry.m_size);
+                // Reserve the space now so later writes don't overcommit the cache while this one is in flight.
+                m_cacheUsage += m_activeWrite.m_entry.m_size;
+                m_activeWritePath = GetEntryPath(m_activeWrite.m_key);
+                m_hasActiveWrite = true;
+            }
+            else
+            {
+                ReleaseWrite(m_activeWrite);
+            }
+        }
+
+        m_activeDeletes = AZStd::move(m_pendingDeletes);
+        m_pendingDeletes.clear();
+        if (!m_hasActiveWrite && m_activeDeletes.empty())
+        {
+            return true;
+        }
+
+        FileRequest* waitRequest = m_context->GetNewInternalRequest();
+        waitRequest->CreateWait(nullptr);
+        waitRequest->SetCompletionCallback([this](FileRequest& request)
+            {
+                FinishFileJob(request.GetStatus() == IStreamerTypes::RequestStatus::Completed);
+            });
+
+        auto job = [this, waitRequest]()
+        {
+            bool success = RunFileJob();
+            waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(waitRequest);
+            m_context->WakeUpSchedulingThread();
+        };
+        m_fileJobInFlight = true;
+        AZ::Job* fileJob = AZ::CreateJobFunction(job, true, m_fileJobContext.get());
+        fileJob->Start();
+        return true;
+    }
+
+    bool PersistentCache::RunFileJob()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        for (const AZStd::string& path : m_activeDeletes)
+        {
+            SystemFile::Delete(path.c_str());
+        }
+
+        if (!m_hasActiveWrite)
+        {
+            return true;
+        }
+
+        auto startTime = AZStd::chrono::steady_clock::now();
+        bool result = WriteFile(m_activeWritePath, m_activeWrite);
+        m_activeWriteTime = AZStd::chrono::duration_cast<Statistic::TimeValue>(AZStd::chrono::steady_clock::now() - startTime);
+        return result;
+    }
+
+    void PersistentCache::FinishFileJob(bool success)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        m_fileJobInFlight = false;
+        m_activeDeletes.clear();
+        if (!m_hasActiveWrite)
+        {
+            return;
+        }
+        m_hasActiveWrite = false;
+
+        if (success)
+        {
+            m_writeTimeAverage.PushEntry(m_activeWriteTime);
+            m_activeWrite.m_entry.m_lastUsed = ++m_useCounter;
+            m_entries.emplace(m_activeWrite.m_key, m_activeWrite.m_entry);
+            m_indexDirty = true;
+        }
+        else
+        {
+            AZ_Warning("Streamer", false, "Unable to write '%s' to the persistent cache.", m_activeWritePath.c_str());
+            m_cacheUsage -= m_activeWrite.m_entry.m_size;
+        }
+        ReleaseWrite(m_activeWrite);
+    }
+
+    void PersistentCache::ReleaseWrite(PendingWrite& write)
+    {
+        m_pendingWriteSize -= write.m_entry.m_size;
+        azfree(write.m_data, AZ::SystemAllocator);
+        write.m_data = nullptr;
+    }
+
+    bool PersistentCache::WriteFile(const AZStd::string& path, const PendingWrite& write)
+    {
+        EntryFooter footer;
+        footer.m_modificationTime = write.m_entry.m_modificationTime;
+        footer.m_offset = write.m_entry.m_offset;
+        footer.m_size = write.m_entry.m_size;
+        footer.m_pathLength = aznumeric_cast<u32>(write.m_entry.m_archivePath.size());
+        footer.m_magic = EntryMagic;
+
+        // The decompressed data is stored first so cached files can be read at the same offsets as the original file. The footer
+        // is written last so a file that was only partially written, for instance because the application crashed, is detected.
+        SystemFile file;
+        bool result = false;
+        if (file.Open(path.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            result =
+                file.Write(write.m_data, write.m_entry.m_size) == write.m_entry.m_size &&
+                file.Write(write.m_entry.m_archivePath.data(), footer.m_pathLength) == footer.m_pathLength &&
+                file.Write(&footer, sizeof(footer)) == sizeof(footer);
+            file.Close();
+        }
+        if (!result)
+        {
+            SystemFile::Delete(path.c_str());
+        }
+        return result;
+    }
+
+    bool PersistentCache::ReadFooter(const AZStd::string& path, CacheEntry& entry)
+    {
+        SystemFile file;
+        if (!file.Open(path.c_str(), SystemFile::SF_OPEN_READ_ONLY))
+        {
+            return false;
+        }
+
+        EntryFooter footer;
+        SystemFile::SizeType length = file.Length();
+        if (length < sizeof(footer))
+        {
+            return false;
+        }
+        file.Seek(length - sizeof(footer), SystemFile::SF_SEEK_BEGIN);
+        if (file.Read(sizeof(footer), &footer) != sizeof(footer) || footer.m_magic != EntryMagic ||
+            footer.m_size + footer.m_pathLength + sizeof(footer) != length)
+        {
+            return false;
+        }
+
+        entry.m_archivePath.resize_no_construct(footer.m_pathLength);
+        file.Seek(footer.m_size, SystemFile::SF_SEEK_BEGIN);
+        if (file.Read(footer.m_pathLength, entry.m_archivePath.data()) != footer.m_pathLength)
+        {
+            return false;
+        }
+        entry.m_modificationTime = footer.m_modificationTime;
+        entry.m_offset = footer.m_offset;
+        entry.m_size = footer.m_size;
+        return true;
+    }
+
+    void PersistentCache::LoadIndex()
+    {
+        if (m_indexLoaded)
+        {
+            return;
+        }
+        m_indexLoaded = true;
+
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        ReadIndex();
+        RebuildIndex();
+    }
+
+    void PersistentCache::ReadIndex()
+    {
+        AZ::IO::FixedMaxPath indexPath = m_cachePath.GetAbsolutePath();
+        indexPath /= IndexFileName;
+        SystemFile file;
+        if (!file.Open(indexPath.c_str(), SystemFile::SF_OPEN_READ_ONLY))
+        {
+            return;
+        }
+
+        auto read = [&file](auto& value)
+        {
+            return file.Read(sizeof(value), &value) == sizeof(value);
+        };
+
+        u32 magic = 0;
+        u32 version = 0;
+        u64 count = 0;
+        if (!read(magic) || magic != IndexMagic || !read(version) || version != IndexVersion || !read(m_useCounter) || !read(count))
+        {
+            AZ_Warning("Streamer", false, "The persistent cache index at '%s' is not compatible and will be rebuilt.", indexPath.c_str());
+            m_useCounter = 0;
+            return;
+        }
+
+        for (u64 i = 0; i < count; ++i)
+        {
+            Key key;
+            CacheEntry entry;
+            u32 pathLength = 0;
+            if (!read(key) || !read(entry.m_modificationTime) || !read(entry.m_offset) || !read(entry.m_size) ||
+                !read(entry.m_lastUsed) || !read(pathLength))
+            {
+                break;
+            }
+            entry.m_archivePath.resize_no_construct(pathLength);
+            if (file.Read(pathLength, entry.m_archivePath.data()) != pathLength)
+            {
+                break;
+            }
+            m_cacheUsage += entry.m_size;
+            m_entries.emplace(key, AZStd::move(entry));
+        }
+    }
+
+    void PersistentCache::RebuildIndex()
+    {
+        // The index is only stored when the cache is destroyed or flushed, so after a crash there can be files that aren't in
+        // the index or entries whose file was never completely written or has been removed.
+        AZ::IO::FixedMaxPath filter = m_cachePath.GetAbsolutePath();
+        filter /= "*.bin";
+        AZStd::unordered_map<Key, AZStd::string> files;
+        SystemFile::FindFiles(filter.c_str(), [&files](const char* fileName, bool isFile)
+            {
+                Key key;
+                if (isFile && ParseEntryFileName(AZ::IO::PathView(fileName).Filename().Native(), key))
+                {
+                    files.emplace(key, fileName);
+                }
+                return true;
+            });
+
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+        {
+            if (files.erase(it->first) == 0)
+            {
+                m_cacheUsage -= it->second.m_size;
+                it = m_entries.erase(it);
+                m_indexDirty = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        for (const auto& [key, fileName] : files)
+        {
+            AZStd::string path = GetEntryPath(key);
+            CacheEntry entry;
+            if (ReadFooter(path, entry))
+            {
+                entry.m_lastUsed = ++m_useCounter;
+                m_cacheUsage += entry.m_size;
+                m_entries.emplace(key, AZStd::move(entry));
+            }
+            else
+            {
+                AZ_TracePrintf("Streamer", "Removing incomplete file '%s' from the persistent cache.\n", fileName.c_str());
+                m_pendingDeletes.push_back(AZStd::move(path));
+            }
+            m_indexDirty = true;
+        }
+
+        EvictEntries(0);
+    }
+
+    void PersistentCache::StoreIndex()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        AZ::IO::FixedMaxPath indexPath = m_cachePath.GetAbsolutePath();
+        indexPath /= IndexFileName;
+        SystemFile file;
+        if (!file.Open(indexPath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Streamer", false, "Unable to store the persistent cache index at '%s'.", indexPath.c_str());
+            return;
+        }
+
+        auto write = [&file](const auto& value)
+        {
+            file.Write(&value, sizeof(value));
+        };
+
+        write(IndexMagic);
+        write(IndexVersion);
+        write(m_useCounter);
+        write(aznumeric_cast<u64>(m_entries.size()));
+        for (const auto& [key, entry] : m_entries)
+        {
+            write(key);
+            write(entry.m_modificationTime);
+            write(entry.m_offset);
+            write(entry.m_size);
+            write(entry.m_lastUsed);
+            write(aznumeric_cast<u32>(entry.m_archivePath.size()));
+            file.Write(entry.m_archivePath.data(), entry.m_archivePath.size());
+        }
+        m_indexDirty = false;
+    }
+
+    void PersistentCache::EvictEntries(u64 requiredSpace)
+    {
+        while (!m_entries.empty() && m_cacheUsage + requiredSpace > m_cacheSize)
+        {
+            auto oldest = m_entries.begin();
+            for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+            {
+                if (it->second.m_lastUsed < oldest->second.m_lastUsed)
+                {
+                    oldest = it;
+                }
+            }
+            RemoveEntry(oldest->first);
+        }
+    }
+
+    void PersistentCache::RemoveEntry(Key key)
+    {
+        if (auto it = m_entries.find(key); it != m_entries.end())
+        {
+            AZStd::string path = GetEntryPath(key);
+            // The entries further down the stack may hold on to the file, so have them release it before it's removed.
+            if (m_next && m_context)
+            {
+                FileRequest* flushRequest = m_context->GetNewInternalRequest();
+                flushRequest->CreateFlush(RequestPath(AZ::IO::PathView(path)));
+                StreamStackEntry::QueueRequest(flushRequest);
+            }
+            m_pendingDeletes.push_back(AZStd::move(path));
+            m_cacheUsage -= it->second.m_size;
+            m_entries.erase(it);
+            m_indexDirty = true;
+        }
+    }
+
+    bool PersistentCache::CalculateKey(Key& key, u64& modificationTime, const CompressionInfo& info, bool allowFileAccess)
+    {
+        const RequestPath& archive = info.m_archiveFilename;
+        auto timeIt = m_archiveModificationTimes.find(archive.GetHash());
+        if (timeIt == m_archiveModificationTimes.end())
+        {
+            if (!allowFileAccess)
+            {
+                return false;
+            }
+            timeIt = m_archiveModificationTimes.emplace(archive.GetHash(), SystemFile::ModificationTime(archive.GetAbsolutePathCStr())).first;
+        }
+        if (timeIt->second == 0)
+        {
+            // The archive couldn't be found or doesn't support modification times, so there's no way to tell if it changed.
+            return false;
+        }
+
+        modificationTime = timeIt->second;
+        size_t hash = AZStd::hash<AZStd::string_view>{}(archive.GetAbsolutePath().Native());
+        AZStd::hash_combine(hash, modificationTime, info.m_offset, info.m_compressedSize);
+        key = hash;
+        return true;
+    }
+
+    bool PersistentCache::IsMatch(const CacheEntry& entry, const CompressionInfo& info, u64 modificationTime)
+    {
+        // The key is a hash, so check the entry is actually for the requested file.
+        return
+            entry.m_modificationTime == modificationTime &&
+            entry.m_offset == info.m_offset &&
+            entry.m_size == info.m_uncompressedSize &&
+            AZStd::string_view(entry.m_archivePath) == info.m_archiveFilename.GetAbsolutePath().Native();
+    }
+
+    auto PersistentCache::FindEntry(const CompressionInfo& info, bool allowFileAccess) -> const CacheEntry*
+    {
+        Key key;
+        u64 modificationTime;
+        if (CalculateKey(key, modificationTime, info, allowFileAccess))
+        {
+            if (auto it = m_entries.find(key); it != m_entries.end() && IsMatch(it->second, info, modificationTime))
+            {
+                return &it->second;
+            }
+        }
+        return nullptr;
+    }
+
+    AZStd::string PersistentCache::GetEntryPath(Key key) const
+    {
+        AZ::IO::FixedMaxPath path = m_cachePath.GetAbsolutePath();
+        path /= AZStd::string::format("%016llx.bin", static_cast<unsigned long long>(key));
+        return AZStd::string(path.Native());
+    }
+
+    bool PersistentCache::ParseEntryFileName(AZStd::string_view fileName, Key& key)
+    {
+        // Files are named after their key as 16 hexadecimal digits followed by ".bin", which also excludes the index.
+        constexpr size_t KeyLength = 16;
+        if (fileName.size() != KeyLength + 4 || !fileName.ends_with(".bin"))
+        {
+            return false;
+        }
+        key = 0;
+        for (char digit : fileName.substr(0, KeyLength))
+        {
+            u64 value;
+            if (digit >= '0' && digit <= '9')
+            {
+                value = digit - '0';
+            }
+            else if (digit >= 'a' && digit <= 'f')
+            {
+                value = digit - 'a' + 10;
+            }
+            else
+            {
+                return false;
+            }
+            key = (key << 4) | value;
+        }
+        return true;
+    }
+
+    void PersistentCache::FlushCache(const RequestPath& filePath)
+    {
+        // The archive may have been replaced so look up the modification time again the next time it's used. Files
+        // from the old archive are no longer found and will be removed once they're the least recently used.
+        m_archiveModificationTimes.erase(filePath.GetHash());
+    }
+
+    void PersistentCache::FlushEntireCache()
+    {
+        m_archiveModificationTimes.clear();
+        if (m_indexDirty)
+        {
+            StoreIndex();
+        }
+    }
+
+    void PersistentCache::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        statistics.push_back(Statistic::CreatePercentage(
+            m_name, CacheHitRateName, m_hitRateStat.GetAverage(),
+            "The percentage of cacheable requests that could be serviced with decompressed data from the cache. This will be low the "
+            "first time an application runs and should be high in later runs if the cache is large enough."));
+        statistics.push_back(Statistic::CreatePercentage(
+            m_name, CacheableName, m_cacheableStat.GetAverage(),
+            "The percentage of compressed reads that were candidates for caching. Files that are too small or archives whose "
+            "modification time can't be retrieved are not cached."));
+        statistics.push_back(Statistic::CreateByteSize(
+            m_name, "Cache usage", m_cacheUsage, "The amount of disk space used by the files in the cache."));
+        statistics.push_back(Statistic::CreateByteSize(
+            m_name, "Pending writes", m_pendingWriteSize,
+            "The amount of memory used by decompressed files waiting to be written to the cache."));
+        statistics.push_back(Statistic::CreateTime(
+            m_name, "Write time", m_writeTimeAverage.CalculateAverage(),
+            "The average time it takes to write a decompressed file to the cache."));
+
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void PersistentCache::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Cache path", m_cachePath.GetRelativePath().Native(), "The folder the decompressed files are stored in."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Cache size", m_cacheSize,
+                "The maximum amount of disk space the cache will use before the least recently used files are removed."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Max pending writes", m_maxPendingWriteSize,
+                "The maximum amount of memory used to hold decompressed files until they're written to the cache."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Min file size", m_minFileSize, "Files smaller than this will not be stored in the cache."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        };
+    }
+} // namespace AZ::IO
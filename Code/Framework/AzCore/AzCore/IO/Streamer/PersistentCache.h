@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+namespace AZ::IO
+{
+    struct CompressionInfo;
+
+    namespace Requests
+    {
+        struct CompressedReadData;
+        struct ReportData;
+    } // namespace Requests
+
+    struct PersistentCacheConfig final :
+        public IStreamerStackConfig
+    {
+        AZ_RTTI(AZ::IO::PersistentCacheConfig, "{449A4DEE-CFC7-4A7F-A611-2317A2338804}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(PersistentCacheConfig, AZ::SystemAllocator);
+
+        ~PersistentCacheConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! The folder the decompressed files are stored in. This should be on a fast local drive. Aliases are supported.
+        AZStd::string m_cachePath{ "@user@/StreamerCache" };
+        //! The maximum amount of disk space in megabytes the cache will use. When exceeded the least recently used files are removed.
+        u32 m_cacheSizeMib{ 2048 };
+        //! The maximum amount of memory in megabytes that's used to hold decompressed files until they're written to the cache.
+        //! Files that are decompressed while this limit is reached will not be cached.
+        u32 m_maxPendingWriteSizeMib{ 32 };
+        //! Files smaller than this are not cached as they're typically faster to decompress than to read from the cache.
+        u32 m_minFileSizeKib{ 16 };
+    };
+
+    //! Entry in the streaming stack that stores decompressed files on a local drive so they don't need to be read and
+    //! decompressed again in later sessions. This entry needs to sit on top of the decompressor as it works on the
+    //! compressed read requests the decompressor handles. Files are identified by their archive, the modification time
+    //! of the archive and their offset in the archive, so rebuilding an archive automatically invalidates its files.
+    //! The cache is limited in size and the least recently used files are removed first. The index with the cached
+    //! files is stored alongside the files when the cache is destroyed or flushed. Every cached file ends with a footer
+    //! describing it, so when the index is loaded, files that were cached after the index was last stored are added back
+    //! and files that were only partially written are removed.
+    //! Cached files are read through the entries further down the stack like any other file, while writing and removing
+    //! them is done on a dedicated job thread so the streaming thread doesn't block on the cache.
+    class PersistentCache
+        : public StreamStackEntry
+    {
+    public:
+        PersistentCache(AZStd::string_view cachePath, u64 cacheSize, u64 maxPendingWriteSize, u64 minFileSize);
+        ~PersistentCache() override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    private:
+        inline static constexpr u32 IndexVersion = 2;
+
+        using Key = u64;
+
+        struct CacheEntry
+        {
+            AZStd::string m_archivePath;
+            u64 m_modificationTime{ 0 };
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+            //! Value of m_useCounter when this entry was last used. Lower values were used longer ago.
+            u64 m_lastUsed{ 0 };
+        };
+
+        struct PendingWrite
+        {
+            CacheEntry m_entry;
+            Key m_key{ 0 };
+            u8* m_data{ nullptr };
+        };
+
+        //! Stored at the end of every cached file, after the archive path, so the index can be rebuilt from the files.
+        struct EntryFooter
+        {
+            u64 m_modificationTime{ 0 };
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+            u32 m_pathLength{ 0 };
+            u32 m_magic{ 0 };
+        };
+
+        void ReadCompressedFile(FileRequest* request, Requests::CompressedReadData& data);
+        void ReadFromCache(FileRequest* request, Key key);
+        void FinishCacheRead(FileRequest* request, Key key, bool success, AZStd::chrono::steady_clock::time_point startTime);
+
+        //! Starts a job that removes the files of evicted entries and writes the next pending write, if there's any
+        //! work and no job is running yet. Returns true if a job was started.
+        bool StartFileJob();
+        //! Runs on the job thread. Only touches the files and the members reserved for the job.
+        bool RunFileJob();
+        void FinishFileJob(bool success);
+        void ReleaseWrite(PendingWrite& write);
+        static bool WriteFile(const AZStd::string& path, const PendingWrite& write);
+        static bool ReadFooter(const AZStd::string& path, CacheEntry& entry);
+
+        //! Lazily loads the index as the file system may not be ready when the cache is created.
+        void LoadIndex();
+        void ReadIndex();
+        //! Brings the index in line with the files in the cache folder.
+        void RebuildIndex();
+        void StoreIndex();
+        void EvictEntries(u64 requiredSpace);
+        void RemoveEntry(Key key);
+
+        //! Returns the key for the file described by the compression info or false if the file can't be cached. If
+        //! allowFileAccess is false, this will only look at archives that have been seen before.
+        bool CalculateKey(Key& key, u64& modificationTime, const CompressionInfo& info, bool allowFileAccess);
+        static bool IsMatch(const CacheEntry& entry, const CompressionInfo& info, u64 modificationTime);
+        const CacheEntry* FindEntry(const CompressionInfo& info, bool allowFileAccess);
+        AZStd::string GetEntryPath(Key key) const;
+        static bool ParseEntryFileName(AZStd::string_view fileName, Key& key);
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        void Report(const Requests::ReportData& data) const;
+
+        AZStd::unordered_map<Key, CacheEntry> m_entries;
+        //! Modification times of the archives that have been used, indexed by the hash of the archive path.
+        AZStd::unordered_map<size_t, u64> m_archiveModificationTimes;
+
+        //! Requests that are waiting for their cached file to be read.
+        AZStd::vector<FileRequest*> m_inFlightHits;
+        AZStd::deque<PendingWrite> m_pendingWrites;
+        //! Files of removed entries that will be deleted by the next file job.
+        AZStd::vector<AZStd::string> m_pendingDeletes;
+
+        AZStd::unique_ptr<JobManager> m_fileJobManager;
+        AZStd::unique_ptr<JobContext> m_fileJobContext;
+        //! Work for the file job that's in flight. Only the job accesses these until it completes.
+        //! @{
+        PendingWrite m_activeWrite;
+        AZStd::string m_activeWritePath;
+        AZStd::vector<AZStd::string> m_activeDeletes;
+        Statistic::TimeValue m_activeWriteTime{};
+        bool m_hasActiveWrite{ false };
+        //! @}
+        bool m_fileJobInFlight{ false };
+
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_writeTimeAverage;
+        AZ::Statistics::RunningStatistic m_hitRateStat;
+        AZ::Statistics::RunningStatistic m_cacheableStat;
+
+        RequestPath m_cachePath;
+        u64 m_cacheSize;
+        u64 m_cacheUsage{ 0 };
+        u64 m_maxPendingWriteSize;
+        u64 m_pendingWriteSize{ 0 };
+        u64 m_minFileSize;
+        u64 m_useCounter{ 0 };
+        bool m_indexLoaded{ false };
+        bool m_indexDirty{ false };
+    };
+} // namespace AZ::IO
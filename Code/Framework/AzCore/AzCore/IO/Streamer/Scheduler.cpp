@@ -9,6 +9,7 @@
 #include <AzCore/IO/Streamer/Scheduler.h>
 
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/std/containers/deque.h>
@@ -19,9 +20,24 @@ namespace AZ::IO
     static constexpr const char* SchedulerName = "Scheduler";
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
     static constexpr const char* ImmediateReadsName = "Immediate reads";
+    static constexpr const char* CoalescedReadsName = "Coalesced reads";
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
 
-    Scheduler::Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment, u64 sizeAlignment, u64 granularity)
+    //! Incremented whenever cl_streamerTraceFile changes so schedulers only need to look at the cvar after a change.
+    static AZStd::atomic_uint32_t s_traceFileGeneration{ 0 };
+
+    static void OnTraceFileChanged([[maybe_unused]] const AZ::CVarFixedString& traceFile)
+    {
+        ++s_traceFileGeneration;
+    }
+
+    AZ_CVAR(AZ::CVarFixedString, cl_streamerTraceFile, "", &OnTraceFileChanged, ConsoleFunctorFlags::Null,
+        "When set, Streamer records all read requests to a trace at this path. Aliases are supported. Clearing the path stops "
+        "recording and stores the trace, which can be replayed with the Streamer trace replay benchmark.");
+
+    Scheduler::Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment, u64 sizeAlignment, u64 granularity,
+        const ReadCoalescingConfig& coalescing)
+        : m_coalescing(coalescing)
     {
         AZ_Assert(IStreamerTypes::IsPowerOf2(memoryAlignment), "Memory alignment provided to AZ::IO::Scheduler isn't a power of two.");
         AZ_Assert(IStreamerTypes::IsPowerOf2(sizeAlignment), "Size alignment provided to AZ::IO::Scheduler isn't a power of two.");
@@ -176,6 +192,19 @@ namespace AZ::IO
             "The number of read requests that were queued and needed immediate processing. These requests are immediately set to be "
             "processed and don't get scheduled. If this value is high there may be too many requests that are set to 'now' or have "
             "deadlines that too tight. Reducing these cases will help allow Streamer to schedule better and improves performance."));
+        if (m_coalescing.m_enabled)
+        {
+            statistics.push_back(Statistic::CreatePercentageRange(
+                SchedulerName, CoalescedReadsName, m_coalescedReadsPercentageStat.GetAverage(),
+                m_coalescedReadsPercentageStat.GetMinimum(), m_coalescedReadsPercentageStat.GetMaximum(),
+                "The percentage of reads that were merged with neighboring reads in the same file. Higher values mean fewer, but larger, "
+                "reads were issued. If this is low while running from archives, increasing the maximum gap or laying out the archive so "
+                "files that are loaded together are stored together can help."));
+            statistics.push_back(Statistic::CreateFloatRange(
+                SchedulerName, "Coalesced request count", m_coalescedRequestCountStat.CalculateAverage(),
+                aznumeric_caster(m_coalescedRequestCountStat.GetMinimum()), aznumeric_caster(m_coalescedRequestCountStat.GetMaximum()),
+                "The number of requests that were served by a single merged read."));
+        }
 #endif
         m_context.CollectStatistics(statistics);
         m_threadData.m_streamStack->CollectStatistics(statistics);
@@ -259,6 +288,28 @@ namespace AZ::IO
         // Make sure all requests in the stack are cleared out. This dangling async processes or async processes crashing as assigned
         // such as memory buffers are no longer available.
         Thread_ProcessTillIdle();
+        m_context.GetTraceRecorder().Stop();
+    }
+
+    void Scheduler::Thread_UpdateTraceRecording()
+    {
+        u32 generation = s_traceFileGeneration;
+        if (generation == m_threadData.m_traceFileGeneration)
+        {
+            return;
+        }
+        m_threadData.m_traceFileGeneration = generation;
+
+        AZ::CVarFixedString traceFile = static_cast<AZ::CVarFixedString>(cl_streamerTraceFile);
+        StreamerTraceRecorder& traceRecorder = m_context.GetTraceRecorder();
+        if (traceFile.empty())
+        {
+            traceRecorder.Stop();
+        }
+        else
+        {
+            traceRecorder.Start(traceFile);
+        }
     }
 
     void Scheduler::Thread_QueueNextRequest()
@@ -278,39 +329,9 @@ namespace AZ::IO
                 AZStd::is_same_v<Command, Requests::ReadData> ||
                 AZStd::is_same_v<Command, Requests::CompressedReadData>)
             {
-                auto parentReadRequest = next->GetCommandFromChain<Requests::ReadRequestData>();
-                AZ_Assert(parentReadRequest != nullptr, "The issued read request can't be found for the (compressed) read command.");
-
-                size_t size = parentReadRequest->m_size;
-                if (parentReadRequest->m_output == nullptr)
+                if (!Thread_AllocateReadOutput(next, args))
                 {
-                    AZ_Assert(parentReadRequest->m_allocator,
-                        "The read request was issued without a memory allocator or valid output address.");
-                    u64 recommendedSize = size;
-                    if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
-                    {
-                        recommendedSize = m_recommendations.CalculateRecommendedMemorySize(size, parentReadRequest->m_offset);
-                    }
-                    IStreamerTypes::RequestMemoryAllocatorResult allocation =
-                        parentReadRequest->m_allocator->Allocate(size, recommendedSize, m_recommendations.m_memoryAlignment);
-                    if (allocation.m_address == nullptr || allocation.m_size < parentReadRequest->m_size)
-                    {
-                        next->SetStatus(IStreamerTypes::RequestStatus::Failed);
-                        m_context.MarkRequestAsCompleted(next);
-                        return;
-                    }
-                    parentReadRequest->m_output = allocation.m_address;
-                    parentReadRequest->m_outputSize = allocation.m_size;
-                    parentReadRequest->m_memoryType = allocation.m_type;
-                    if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
-                    {
-                        args.m_output = parentReadRequest->m_output;
-                        args.m_outputSize = allocation.m_size;
-                    }
-                    else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
-                    {
-                        args.m_output = parentReadRequest->m_output;
-                    }
+                    return;
                 }
 
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
@@ -320,12 +341,15 @@ namespace AZ::IO
                 }
 #endif
 
+                FileRequest* queued = next;
                 if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
                 {
-                    m_threadData.m_lastFilePath = args.m_path;
-                    m_threadData.m_lastFileOffset = args.m_offset + args.m_size;
+                    queued = Thread_CoalesceReads(next, args);
+                    auto& queuedRead = AZStd::get<Requests::ReadData>(queued->GetCommand());
+                    m_threadData.m_lastFilePath = queuedRead.m_path;
+                    m_threadData.m_lastFileOffset = queuedRead.m_offset + queuedRead.m_size;
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
-                    m_processingSize += args.m_size;
+                    m_processingSize += queuedRead.m_size;
 #endif
                 }
                 else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
@@ -337,9 +361,10 @@ namespace AZ::IO
                     m_processingSize += info.m_uncompressedSize;
 #endif
                 }
+                [[maybe_unused]] auto parentReadRequest = next->GetCommandFromChain<Requests::ReadRequestData>();
                 AZ_PROFILE_INTERVAL_START_COLORED(AzCore, next, ProfilerColor,
                     "Streamer queued %zu: %s", next->GetCommand().index(), parentReadRequest->m_path.GetRelativePath());
-                m_threadData.m_streamStack->QueueRequest(next);
+                m_threadData.m_streamStack->QueueRequest(queued);
             }
             else if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
             {
@@ -368,6 +393,150 @@ namespace AZ::IO
         }, next->GetCommand());
     }
 
+    template<typename Command>
+    bool Scheduler::Thread_AllocateReadOutput(FileRequest* request, Command& command)
+    {
+        auto parentReadRequest = request->GetCommandFromChain<Requests::ReadRequestData>();
+        AZ_Assert(parentReadRequest != nullptr, "The issued read request can't be found for the (compressed) read command.");
+
+        if (parentReadRequest->m_output == nullptr)
+        {
+            AZ_Assert(parentReadRequest->m_allocator,
+                "The read request was issued without a memory allocator or valid output address.");
+            size_t size = parentReadRequest->m_size;
+            u64 recommendedSize = size;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                recommendedSize = m_recommendations.CalculateRecommendedMemorySize(size, parentReadRequest->m_offset);
+            }
+            IStreamerTypes::RequestMemoryAllocatorResult allocation =
+                parentReadRequest->m_allocator->Allocate(size, recommendedSize, m_recommendations.m_memoryAlignment);
+            if (allocation.m_address == nullptr || allocation.m_size < parentReadRequest->m_size)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context.MarkRequestAsCompleted(request);
+                return false;
+            }
+            parentReadRequest->m_output = allocation.m_address;
+            parentReadRequest->m_outputSize = allocation.m_size;
+            parentReadRequest->m_memoryType = allocation.m_type;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                command.m_output = parentReadRequest->m_output;
+                command.m_outputSize = allocation.m_size;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                command.m_output = parentReadRequest->m_output;
+            }
+        }
+        return true;
+    }
+
+    FileRequest* Scheduler::Thread_CoalesceReads(FileRequest* request, Requests::ReadData& data)
+    {
+        if (!m_coalescing.m_enabled)
+        {
+            return request;
+        }
+
+        const u64 maxGap = m_coalescing.m_maxGapKib * 1_kib;
+        const u64 maxSize = m_coalescing.m_maxReadSizeKib * 1_kib;
+        if (data.m_size >= maxSize)
+        {
+            return request;
+        }
+
+        // A merged read completes when all of its data has been read, so merging delays the completion of the original
+        // request. Requests that are already at risk of missing their deadline are therefore left as they are. The other
+        // reads are taken from the prepared queue, which is sorted by deadline, so they only ever complete earlier.
+        auto parentReadRequest = request->GetCommandFromChain<Requests::ReadRequestData>();
+        if (parentReadRequest == nullptr || request->GetEstimatedCompletion() > parentReadRequest->m_deadline)
+        {
+            return request;
+        }
+
+        AZStd::vector<FileRequest*> coalesced;
+        coalesced.push_back(request);
+        u64 start = data.m_offset;
+        u64 end = data.m_offset + data.m_size;
+
+        // Keep looking until nothing else can be merged, as merging a read can bring reads that were too far away in range.
+        auto& pending = m_context.GetPreparedRequests();
+        bool hasMerged = true;
+        while (hasMerged && coalesced.size() < m_coalescing.m_maxRequests)
+        {
+            hasMerged = false;
+            for (auto it = pending.begin(); it != pending.end() && coalesced.size() < m_coalescing.m_maxRequests;)
+            {
+                FileRequest* candidate = *it;
+                auto candidateRead = AZStd::get_if<Requests::ReadData>(&candidate->GetCommand());
+                if (candidateRead && candidateRead->m_path == data.m_path)
+                {
+                    const u64 candidateEnd = candidateRead->m_offset + candidateRead->m_size;
+                    const bool isNear = candidateRead->m_offset <= end + maxGap && candidateEnd + maxGap >= start;
+                    const u64 mergedStart = AZStd::min(start, candidateRead->m_offset);
+                    const u64 mergedEnd = AZStd::max(end, candidateEnd);
+                    if (isNear && mergedEnd - mergedStart <= maxSize)
+                    {
+                        it = pending.erase(it);
+                        candidate->SetStatus(IStreamerTypes::RequestStatus::Processing);
+                        // If no memory could be allocated the request has already been completed as failed.
+                        if (Thread_AllocateReadOutput(candidate, *candidateRead))
+                        {
+                            AZ_PROFILE_INTERVAL_START_COLORED(AzCore, candidate, ProfilerColor,
+                                "Streamer queued %zu: %s", candidate->GetCommand().index(), candidateRead->m_path.GetRelativePath());
+                            coalesced.push_back(candidate);
+                            start = mergedStart;
+                            end = mergedEnd;
+                            hasMerged = true;
+                        }
+                        continue;
+                    }
+                }
+                ++it;
+            }
+        }
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        m_coalescedReadsPercentageStat.PushSample(coalesced.size() > 1 ? 1.0 : 0.0);
+        Statistic::PlotImmediate(SchedulerName, CoalescedReadsName, m_coalescedReadsPercentageStat.GetMostRecentSample());
+        m_coalescedRequestCountStat.PushEntry(coalesced.size());
+#endif
+
+        if (coalesced.size() == 1)
+        {
+            return request;
+        }
+
+        const u64 size = end - start;
+        const u64 bufferSize = AZ_SIZE_ALIGN_UP(size, m_recommendations.m_sizeAlignment);
+        void* buffer = azmalloc(bufferSize, m_recommendations.m_memoryAlignment, AZ::SystemAllocator);
+
+        // The merged read doesn't have a parent as it services multiple requests. Instead it completes all of them once
+        // the data has been read. The path is owned by the first request, which is kept alive until the callback has run.
+        FileRequest* merged = m_context.GetNewInternalRequest();
+        merged->CreateRead(nullptr, buffer, bufferSize, data.m_path, start, size, data.m_sharedRead);
+        merged->SetCompletionCallback([this, buffer, start, coalesced = AZStd::move(coalesced)](FileRequest& mergedRequest)
+            {
+                AZ_PROFILE_SCOPE(AzCore, "Scheduler::Thread_CoalesceReads completion");
+                const IStreamerTypes::RequestStatus status = mergedRequest.GetStatus();
+                const u8* source = reinterpret_cast<const u8*>(buffer);
+                for (FileRequest* original : coalesced)
+                {
+                    if (status == IStreamerTypes::RequestStatus::Completed)
+                    {
+                        auto& read = AZStd::get<Requests::ReadData>(original->GetCommand());
+                        ::memcpy(read.m_output, source + (read.m_offset - start), read.m_size);
+                    }
+                    original->SetStatus(status);
+                    m_context.MarkRequestAsCompleted(original);
+                }
+                azfree(buffer, AZ::SystemAllocator);
+            });
+        return merged;
+    }
+
     bool Scheduler::Thread_ExecuteRequests()
     {
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
@@ -384,6 +553,8 @@ namespace AZ::IO
 #endif
         AZ_PROFILE_FUNCTION(AzCore);
 
+        Thread_UpdateTraceRecording();
+
         {
             AZStd::scoped_lock lock(m_pendingRequestsLock);
             if (!m_pendingRequests.empty())
@@ -421,6 +592,7 @@ namespace AZ::IO
         {
             AZStd::visit(visitor, request->m_request.GetCommand());
         }
+        StreamerTraceRecorder& traceRecorder = m_context.GetTraceRecorder();
         for (auto& request : outstandingRequests)
         {
             // Add a link in front of the external request to keep a reference to the FileRequestPtr alive while it's being processed.
@@ -428,6 +600,10 @@ namespace AZ::IO
             FileRequest* linkRequest = m_context.GetNewInternalRequest();
             linkRequest->CreateRequestLink(AZStd::move(request));
             requestPtr->SetStatus(IStreamerTypes::RequestStatus::Queued);
+            if (traceRecorder.IsRecording())
+            {
+                traceRecorder.RecordQueued(*requestPtr, AZStd::chrono::steady_clock::now());
+            }
             m_threadData.m_streamStack->PrepareRequest(requestPtr);
         }
         outstandingRequests.clear();
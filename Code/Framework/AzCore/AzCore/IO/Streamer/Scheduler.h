@@ -29,6 +29,7 @@ namespace AZ::IO
     namespace Requests
     {
         struct CancelData;
+        struct ReadData;
         struct RescheduleData;
     } // namespace Requests
 
@@ -36,7 +37,7 @@ namespace AZ::IO
     {
     public:
         explicit Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment = AZCORE_GLOBAL_NEW_ALIGNMENT,
-            u64 sizeAlignment = 1, u64 granularity = 1_mib);
+            u64 sizeAlignment = 1, u64 granularity = 1_mib, const ReadCoalescingConfig& coalescing = {});
         ~Scheduler();
 
         void Start(const AZStd::thread_desc& threadDesc);
@@ -74,8 +75,15 @@ namespace AZ::IO
         bool Thread_ExecuteRequests();
         bool Thread_PrepareRequests(AZStd::vector<FileRequestPtr>& outstandingRequests);
         void Thread_ProcessTillIdle();
+        //! Starts or stops recording a trace of the processed requests if cl_streamerTraceFile has changed.
+        void Thread_UpdateTraceRecording();
         void Thread_ProcessCancelRequest(FileRequest* request, Requests::CancelData& data);
         void Thread_ProcessRescheduleRequest(FileRequest* request, Requests::RescheduleData& data);
+        template<typename Command>
+        bool Thread_AllocateReadOutput(FileRequest* request, Command& command);
+        //! Merges prepared reads that are in the same file and close to the given read into a single read. Returns the
+        //! request to queue, which is either the provided request or a new read that completes all merged requests.
+        FileRequest* Thread_CoalesceReads(FileRequest* request, Requests::ReadData& data);
 
         enum class Order
         {
@@ -96,11 +104,13 @@ namespace AZ::IO
             RequestPath m_lastFilePath; //!< Path of the last file queued for reading.
             AZStd::shared_ptr<StreamStackEntry> m_streamStack;
             u64 m_lastFileOffset{ 0 }; //!< Offset of into the last file queued after reading has completed.
+            u32 m_traceFileGeneration{ 0 }; //!< The last seen change to cl_streamerTraceFile.
         };
         ThreadData m_threadData;
         StreamerContext m_context;
 
         IStreamerTypes::Recommendations m_recommendations;
+        ReadCoalescingConfig m_coalescing;
 
         StreamStackEntry::Status m_stackStatus;
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
@@ -119,6 +129,10 @@ namespace AZ::IO
         //! Percentage of reads that come in that are already on their deadline. Requests like this are disruptive
         //! as they cause the scheduler to prioritize these over the most optimal read layout.
         AZ::Statistics::RunningStatistic m_immediateReadsPercentageStat;
+        //! Percentage of queued reads that were merged with one or more other reads.
+        AZ::Statistics::RunningStatistic m_coalescedReadsPercentageStat;
+        //! The number of requests that were served by a single merged read.
+        AverageWindow<u64, double, s_statisticsWindowSize> m_coalescedRequestCountStat;
 #endif
 
         AZStd::mutex m_pendingRequestsLock;
@@ -15,6 +15,7 @@
 #include <AzCore/IO/Streamer/DedicatedCache.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/PersistentCache.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
@@ -104,7 +105,7 @@ namespace AZ
         if (stack)
         {
             return AZStd::make_unique<AZ::IO::Scheduler>(AZStd::move(stack), hardwareInfo.m_maxPhysicalSectorSize,
-                hardwareInfo.m_maxLogicalSectorSize, hardwareInfo.m_maxTransfer);
+                hardwareInfo.m_maxLogicalSectorSize, hardwareInfo.m_maxTransfer, config.m_coalescing);
         }
         else
         {
@@ -199,6 +200,7 @@ namespace AZ
         DedicatedCacheConfig::Reflect(context);
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
+        PersistentCacheConfig::Reflect(context);
         ReadSplitterConfig::Reflect(context);
         StorageDriveConfig::Reflect(context);
         StreamerConfig::Reflect(context);
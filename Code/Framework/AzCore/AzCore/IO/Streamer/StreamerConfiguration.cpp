@@ -21,13 +21,28 @@ namespace AZ::IO
         }
     }
 
+    void ReadCoalescingConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<ReadCoalescingConfig>()
+                ->Version(1)
+                ->Field("Enabled", &ReadCoalescingConfig::m_enabled)
+                ->Field("MaxGapKib", &ReadCoalescingConfig::m_maxGapKib)
+                ->Field("MaxReadSizeKib", &ReadCoalescingConfig::m_maxReadSizeKib)
+                ->Field("MaxRequests", &ReadCoalescingConfig::m_maxRequests);
+        }
+    }
+
     void StreamerConfig::Reflect(AZ::ReflectContext* context)
     {
+        ReadCoalescingConfig::Reflect(context);
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
         {
             serializeContext->Class<StreamerConfig>()
-                ->Version(1)
-                ->Field("Stack", &StreamerConfig::m_stackConfig);
+                ->Version(2)
+                ->Field("Stack", &StreamerConfig::m_stackConfig)
+                ->Field("Coalescing", &StreamerConfig::m_coalescing);
         }
     }
 } // namespace AZ::IO
@@ -55,6 +55,24 @@ namespace AZ::IO
         static void Reflect(ReflectContext* context);
     };
 
+    //! Settings for the Scheduler to merge reads that are close together in the same file into a single read. This
+    //! reduces the number of requests for many small reads into archives, at the cost of reading the data in the gaps.
+    struct ReadCoalescingConfig final
+    {
+        AZ_TYPE_INFO(AZ::IO::ReadCoalescingConfig, "{A65F108D-83BE-4D3B-A08F-ABF520109470}");
+        AZ_CLASS_ALLOCATOR(ReadCoalescingConfig, SystemAllocator);
+
+        static void Reflect(ReflectContext* context);
+
+        //! The maximum number of bytes between two reads that will be read and discarded to merge them.
+        AZ::u32 m_maxGapKib{ 16 };
+        //! The maximum size of a merged read.
+        AZ::u32 m_maxReadSizeKib{ 1024 };
+        //! The maximum number of reads that are merged into a single read.
+        AZ::u32 m_maxRequests{ 16 };
+        bool m_enabled{ false };
+    };
+
     class StreamerConfig final
     {
     public:
@@ -62,6 +80,7 @@ namespace AZ::IO
         AZ_CLASS_ALLOCATOR(StreamerConfig, SystemAllocator);
 
         ConfigurableStack<AZ::IO::IStreamerStackConfig> m_stackConfig;
+        ReadCoalescingConfig m_coalescing;
         static void Reflect(ReflectContext* context);
     };
 
@@ -218,6 +218,10 @@ namespace AZ
                     IStreamerTypes::RequestStatus status = top->GetStatus();
                     FileRequest* parent = top->m_parent;
                     bool isInternal = top->m_usage == FileRequest::Usage::Internal;
+                    if (!isInternal && m_traceRecorder.IsRecording())
+                    {
+                        m_traceRecorder.RecordCompleted(*top, AZStd::chrono::steady_clock::now());
+                    }
 
                     {
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
@@ -282,6 +286,11 @@ namespace AZ
             return m_threadSync;
         }
 
+        StreamerTraceRecorder& StreamerContext::GetTraceRecorder()
+        {
+            return m_traceRecorder;
+        }
+
         void StreamerContext::CollectStatistics(AZStd::vector<Statistic>& statistics)
         {
             statistics.push_back(Statistic::CreateInteger(
@@ -11,6 +11,7 @@
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamerContext_Platform.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
 #include <AzCore/Statistics/RunningStatistic.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/queue.h>
@@ -89,6 +90,10 @@ namespace AZ::IO
         //! Returns the native primitive(s) used to suspend and wake up the scheduling thread and possibly other threads.
         AZ::Platform::StreamerContextThreadSync& GetStreamerThreadSynchronizer();
 
+        //! Returns the recorder used to capture traces of the requests processed by Streamer. Only use this from
+        //! the main Streamer thread.
+        StreamerTraceRecorder& GetTraceRecorder();
+
         //! Collects statistics recorded during processing. This will only return statistics for the
         //! context. Use the CollectStatistics on AZ::IO::Streamer to get all statistics.
         void CollectStatistics(AZStd::vector<Statistic>& statistics);
@@ -134,6 +139,8 @@ namespace AZ::IO
         //! Platform-specific synchronization object used to suspend the Streamer thread and wake it up to resume procesing.
         AZ::Platform::StreamerContextThreadSync m_threadSync;
 
+        StreamerTraceRecorder m_traceRecorder;
+
         size_t m_pendingIdCounter{ 0 };
     };
 } // namespace AZ::IO
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/IO/SystemFile.h>
+
+namespace AZ::IO
+{
+    namespace StreamerTraceInternal
+    {
+        struct FileHeader
+        {
+            u32 m_magic{ StreamerTrace::FileMagic };
+            u32 m_version{ StreamerTrace::FileVersion };
+            u32 m_pathCount{ 0 };
+            u32 m_entryCount{ 0 };
+        };
+
+        class Reader
+        {
+        public:
+            Reader(const void* buffer, size_t size)
+                : m_cursor(reinterpret_cast<const u8*>(buffer))
+                , m_end(m_cursor + size)
+            {
+            }
+
+            template<typename T>
+            bool Read(T& value)
+            {
+                return ReadBytes(&value, sizeof(T));
+            }
+
+            bool ReadBytes(void* target, size_t size)
+            {
+                if (aznumeric_cast<size_t>(m_end - m_cursor) < size)
+                {
+                    return false;
+                }
+                memcpy(target, m_cursor, size);
+                m_cursor += size;
+                return true;
+            }
+
+        private:
+            const u8* m_cursor;
+            const u8* m_end;
+        };
+
+        template<typename T>
+        void Write(AZStd::vector<u8>& buffer, const T& value)
+        {
+            const u8* bytes = reinterpret_cast<const u8*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+    } // namespace StreamerTraceInternal
+
+    //
+    // StreamerTrace
+    //
+
+    u32 StreamerTrace::AddPath(AZStd::string_view path)
+    {
+        AZStd::string key(path);
+        auto it = m_pathLookup.find(key);
+        if (it != m_pathLookup.end())
+        {
+            return it->second;
+        }
+        u32 index = aznumeric_cast<u32>(m_paths.size());
+        m_paths.push_back(key);
+        m_pathLookup.emplace(AZStd::move(key), index);
+        return index;
+    }
+
+    void StreamerTrace::AddEntry(const StreamerTraceEntry& entry)
+    {
+        AZ_Assert(entry.m_pathIndex < m_paths.size(), "Streamer trace entry refers to unknown path %u.", entry.m_pathIndex);
+        m_entries.push_back(entry);
+    }
+
+    void StreamerTrace::Clear()
+    {
+        m_paths.clear();
+        m_pathLookup.clear();
+        m_entries.clear();
+    }
+
+    bool StreamerTrace::Save(AZStd::vector<u8>& buffer) const
+    {
+        using namespace StreamerTraceInternal;
+
+        buffer.clear();
+        buffer.reserve(sizeof(FileHeader) + m_entries.size() * (sizeof(StreamerTraceEntry)));
+
+        FileHeader header;
+        header.m_pathCount = aznumeric_cast<u32>(m_paths.size());
+        header.m_entryCount = aznumeric_cast<u32>(m_entries.size());
+        Write(buffer, header);
+
+        for (const AZStd::string& path : m_paths)
+        {
+            if (path.size() > AZStd::numeric_limits<u16>::max())
+            {
+                AZ_Warning("Streamer", false, "Path '%s' is too long to be stored in a Streamer trace.", path.c_str());
+                buffer.clear();
+                return false;
+            }
+            Write(buffer, aznumeric_cast<u16>(path.size()));
+            buffer.insert(buffer.end(), path.begin(), path.end());
+        }
+
+        // Fields are written individually so the file doesn't depend on the padding of StreamerTraceEntry.
+        for (const StreamerTraceEntry& entry : m_entries)
+        {
+            Write(buffer, entry.m_pathIndex);
+            Write(buffer, entry.m_priority);
+            Write(buffer, aznumeric_cast<u8>(entry.m_status));
+            Write(buffer, entry.m_offset);
+            Write(buffer, entry.m_size);
+            Write(buffer, entry.m_queueTime);
+            Write(buffer, entry.m_completionTime);
+            Write(buffer, entry.m_deadline);
+        }
+        return true;
+    }
+
+    bool StreamerTrace::Load(const void* buffer, size_t bufferSize)
+    {
+        using namespace StreamerTraceInternal;
+
+        Clear();
+
+        Reader reader(buffer, bufferSize);
+        FileHeader header;
+        if (!reader.Read(header) || header.m_magic != FileMagic || header.m_version != FileVersion)
+        {
+            return false;
+        }
+
+        m_paths.reserve(header.m_pathCount);
+        for (u32 i = 0; i < header.m_pathCount; ++i)
+        {
+            u16 length;
+            if (!reader.Read(length))
+            {
+                Clear();
+                return false;
+            }
+            AZStd::string path;
+            path.resize_no_construct(length);
+            if (!reader.ReadBytes(path.data(), length))
+            {
+                Clear();
+                return false;
+            }
+            AddPath(path);
+        }
+
+        m_entries.reserve(header.m_entryCount);
+        for (u32 i = 0; i < header.m_entryCount; ++i)
+        {
+            StreamerTraceEntry entry;
+            u8 status;
+            if (!reader.Read(entry.m_pathIndex) || !reader.Read(entry.m_priority) || !reader.Read(status) ||
+                !reader.Read(entry.m_offset) || !reader.Read(entry.m_size) || !reader.Read(entry.m_queueTime) ||
+                !reader.Read(entry.m_completionTime) || !reader.Read(entry.m_deadline) ||
+                entry.m_pathIndex >= m_paths.size())
+            {
+                Clear();
+                return false;
+            }
+            entry.m_status = static_cast<IStreamerTypes::RequestStatus>(status);
+            m_entries.push_back(entry);
+        }
+        return true;
+    }
+
+    bool StreamerTrace::Save(AZStd::string_view filePath) const
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        AZStd::vector<u8> buffer;
+        if (!Save(buffer))
+        {
+            return false;
+        }
+
+        RequestPath path(AZ::IO::PathView{ filePath });
+        SystemFile file;
+        if (!file.Open(path.GetAbsolutePathCStr(),
+            SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Streamer", false, "Unable to open '%s' to store the Streamer trace.", path.GetAbsolutePathCStr());
+            return false;
+        }
+        return file.Write(buffer.data(), buffer.size()) == buffer.size();
+    }
+
+    bool StreamerTrace::Load(AZStd::string_view filePath)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        RequestPath path(AZ::IO::PathView{ filePath });
+        SystemFile file;
+        if (!file.Open(path.GetAbsolutePathCStr(), SystemFile::SF_OPEN_READ_ONLY))
+        {
+            return false;
+        }
+
+        AZStd::vector<u8> buffer;
+        buffer.resize_no_construct(aznumeric_cast<size_t>(file.Length()));
+        if (file.Read(buffer.size(), buffer.data()) != buffer.size())
+        {
+            return false;
+        }
+        return Load(buffer.data(), buffer.size());
+    }
+
+    //
+    // StreamerTraceRecorder
+    //
+
+    void StreamerTraceRecorder::Start(AZStd::string_view filePath)
+    {
+        if (m_isRecording)
+        {
+            Stop();
+        }
+
+        m_trace.Clear();
+        m_inFlight.clear();
+        m_filePath = filePath;
+        m_startTime = AZStd::chrono::steady_clock::now();
+        m_isRecording = true;
+        AZ_Printf("Streamer", "Started recording Streamer trace to '%s'.\n", m_filePath.c_str());
+    }
+
+    void StreamerTraceRecorder::Stop()
+    {
+        if (!m_isRecording)
+        {
+            return;
+        }
+
+        m_isRecording = false;
+        m_inFlight.clear();
+        if (m_trace.Save(m_filePath))
+        {
+            AZ_Printf("Streamer", "Stored Streamer trace with %zu requests at '%s'.\n", m_trace.GetEntries().size(), m_filePath.c_str());
+        }
+        m_trace.Clear();
+    }
+
+    void StreamerTraceRecorder::RecordQueued(const FileRequest& request, AZStd::chrono::steady_clock::time_point now)
+    {
+        auto read = AZStd::get_if<Requests::ReadRequestData>(&request.GetCommand());
+        if (!read)
+        {
+            return;
+        }
+
+        StreamerTraceEntry entry;
+        entry.m_pathIndex = m_trace.AddPath(read->m_path.GetRelativePath().Native());
+        entry.m_priority = read->m_priority;
+        entry.m_status = IStreamerTypes::RequestStatus::Queued;
+        entry.m_offset = read->m_offset;
+        entry.m_size = read->m_size;
+        entry.m_queueTime = ToTraceTime(now);
+        if (read->m_deadline != FileRequest::s_noDeadlineTime)
+        {
+            entry.m_deadline = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(read->m_deadline - now).count();
+        }
+
+        m_inFlight[&request] = m_trace.GetEntries().size();
+        m_trace.AddEntry(entry);
+    }
+
+    void StreamerTraceRecorder::RecordCompleted(const FileRequest& request, AZStd::chrono::steady_clock::time_point now)
+    {
+        auto it = m_inFlight.find(&request);
+        if (it == m_inFlight.end())
+        {
+            return;
+        }
+
+        StreamerTraceEntry& entry = m_trace.GetEntries()[it->second];
+        entry.m_completionTime = ToTraceTime(now);
+        entry.m_status = request.GetStatus();
+        m_inFlight.erase(it);
+    }
+
+    s64 StreamerTraceRecorder::ToTraceTime(AZStd::chrono::steady_clock::time_point time) const
+    {
+        return AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(time - m_startTime).count();
+    }
+} // namespace AZ::IO
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    class FileRequest;
+
+    //! A single read request captured by the StreamerTraceRecorder. All times are in microseconds.
+    struct StreamerTraceEntry
+    {
+        inline static constexpr s64 NoDeadline = AZStd::numeric_limits<s64>::max();
+        inline static constexpr s64 NotCompleted = -1;
+
+        //! Index into the path table of the trace.
+        u32 m_pathIndex{ 0 };
+        IStreamerTypes::Priority m_priority{ IStreamerTypes::s_priorityMedium };
+        IStreamerTypes::RequestStatus m_status{ IStreamerTypes::RequestStatus::Pending };
+        u64 m_offset{ 0 };
+        u64 m_size{ 0 };
+        //! Time since the start of the capture at which the request was picked up by the scheduler.
+        s64 m_queueTime{ 0 };
+        //! Time since the start of the capture at which the request completed or NotCompleted if the capture ended first.
+        s64 m_completionTime{ NotCompleted };
+        //! Deadline relative to the queue time or NoDeadline.
+        s64 m_deadline{ NoDeadline };
+    };
+
+    //! A captured sequence of read requests. Traces are stored in a compact binary format so long captures such as
+    //! full level loads can be recorded and shared.
+    class StreamerTrace
+    {
+    public:
+        inline static constexpr u32 FileMagic = 0x52545341; // "ASTR"
+        inline static constexpr u32 FileVersion = 1;
+
+        //! Returns the index of the path in the path table, adding it if it hasn't been seen before.
+        u32 AddPath(AZStd::string_view path);
+        void AddEntry(const StreamerTraceEntry& entry);
+        void Clear();
+
+        const AZStd::vector<AZStd::string>& GetPaths() const { return m_paths; }
+        const AZStd::vector<StreamerTraceEntry>& GetEntries() const { return m_entries; }
+        AZStd::vector<StreamerTraceEntry>& GetEntries() { return m_entries; }
+
+        //! Stores the trace at the given path. Aliases are supported.
+        bool Save(AZStd::string_view filePath) const;
+        //! Loads a trace from the given path, replacing the current content. Aliases are supported.
+        bool Load(AZStd::string_view filePath);
+
+        bool Save(AZStd::vector<u8>& buffer) const;
+        bool Load(const void* buffer, size_t bufferSize);
+
+    private:
+        AZStd::vector<AZStd::string> m_paths;
+        AZStd::unordered_map<AZStd::string, u32> m_pathLookup;
+        AZStd::vector<StreamerTraceEntry> m_entries;
+    };
+
+    //! Records the external read requests that pass through Streamer. The recorder is owned by the StreamerContext and
+    //! is only accessed from the scheduling thread.
+    class StreamerTraceRecorder
+    {
+    public:
+        void Start(AZStd::string_view filePath);
+        //! Stops recording and stores the trace at the path provided to Start.
+        void Stop();
+        bool IsRecording() const { return m_isRecording; }
+
+        //! Records a read request that was just picked up by the scheduler.
+        void RecordQueued(const FileRequest& request, AZStd::chrono::steady_clock::time_point now);
+        //! Records the completion of a request that was previously recorded with RecordQueued.
+        void RecordCompleted(const FileRequest& request, AZStd::chrono::steady_clock::time_point now);
+
+        const StreamerTrace& GetTrace() const { return m_trace; }
+
+    private:
+        s64 ToTraceTime(AZStd::chrono::steady_clock::time_point time) const;
+
+        StreamerTrace m_trace;
+        AZStd::string m_filePath;
+        //! Requests that are in flight, mapped to their entry in the trace.
+        AZStd::unordered_map<const FileRequest*, size_t> m_inFlight;
+        AZStd::chrono::steady_clock::time_point m_startTime;
+        bool m_isRecording{ false };
+    };
+} // namespace AZ::IO
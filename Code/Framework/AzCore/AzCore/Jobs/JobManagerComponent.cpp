@@ -25,6 +25,8 @@
 AZ_CVAR(float, cl_jobThreadsConcurrencyRatio, AZ_TRAIT_USE_JOB_THREADS_CONCURRENCY_RATIO, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system multiplier on the number of hw threads the machine creates at initialization");
 AZ_CVAR(uint32_t, cl_jobThreadsNumReserved, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system number of hardware threads that are reserved for O3DE system threads");
 AZ_CVAR(uint32_t, cl_jobThreadsMinNumber, 3, nullptr, AZ::ConsoleFunctorFlags::Null, "Legacy Job system minimum number of worker threads to create after scaling the number of hw threads");
+AZ_CVAR(uint32_t, cl_workerThreadsTotal, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "Total number of worker threads shared by the Job and TaskGraph systems when cl_taskGraphUseJobScheduler is set (0 derives the count from the cl_jobThreads* settings)");
+AZ_CVAR_EXTERNED(bool, cl_taskGraphUseJobScheduler);
 
 namespace AZ
 {
@@ -63,6 +65,11 @@ namespace AZ
             uint32_t scaledHardwareThreads = Threading::CalcNumWorkerThreads(cl_jobThreadsConcurrencyRatio, cl_jobThreadsMinNumber, 0, cl_jobThreadsNumReserved);
             numberOfWorkerThreads = desc.GetWorkerThreadCount(scaledHardwareThreads);
         #endif // (AZ_TRAIT_THREAD_NUM_JOB_MANAGER_WORKER_THREADS)
+            if (cl_taskGraphUseJobScheduler && cl_workerThreadsTotal > 0)
+            {
+                // The TaskGraph spawns no threads of its own in this mode, this pool is the only one
+                numberOfWorkerThreads = static_cast<int>(static_cast<uint32_t>(cl_workerThreadsTotal));
+            }
         }
 
         threadDesc.m_cpuId = AFFINITY_MASK_USERTHREADS;
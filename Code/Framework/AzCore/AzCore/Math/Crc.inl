@@ -68,6 +68,33 @@ namespace AZ
             0x5d681b02L, 0x2a6f2b94L, 0xb40bbe37L, 0xc30c8ea1L, 0x5a05df1bL,
             0x2d02ef8dL
         };
+
+        //! Tables of the CRC-32's of all single-byte values followed by 0 to 7 zero bytes.
+        //! They let Crc32Set fold 8 bytes per step (slicing-by-8) instead of one, with the same result.
+        struct Crc32SliceTables
+        {
+            unsigned int m_tables[8][256];
+        };
+
+        constexpr Crc32SliceTables MakeCrc32SliceTables()
+        {
+            Crc32SliceTables sliceTables{};
+            for (size_t i = 0; i < 256; ++i)
+            {
+                sliceTables.m_tables[0][i] = crc_table[i];
+            }
+            for (size_t slice = 1; slice < 8; ++slice)
+            {
+                for (size_t i = 0; i < 256; ++i)
+                {
+                    const unsigned int previous = sliceTables.m_tables[slice - 1][i];
+                    sliceTables.m_tables[slice][i] = (previous >> 8) ^ crc_table[previous & 0xff];
+                }
+            }
+            return sliceTables;
+        }
+
+        inline constexpr Crc32SliceTables crc_slice_tables = MakeCrc32SliceTables();
     };
 
     //=========================================================================
@@ -85,6 +112,33 @@ namespace AZ
             return crc_table[(static_cast<int>(currentCrc) ^ dataOctet) & 0xff] ^ (currentCrc >> 8);
         }
 
+        constexpr uint8_t LoadCrc32Octet(uint8_t dataOctet, bool forceLowerCase)
+        {
+            return (forceLowerCase && dataOctet >= 'A' && dataOctet <= 'Z') ? static_cast<uint8_t>(dataOctet + 'a' - 'A') : dataOctet;
+        }
+
+        //! Folds 8 octets into the crc with the slice tables.
+        //! The octets are combined one by one rather than loaded as words so this stays usable at compile time
+        //! and is independent of the platform endianness and of the alignment of the data.
+        template<typename CharType>
+        constexpr unsigned int ComputeCrc32Octets8(unsigned int currentCrc, const CharType* buf, bool forceLowerCase)
+        {
+            const unsigned int low = currentCrc ^
+                (static_cast<unsigned int>(LoadCrc32Octet(static_cast<uint8_t>(buf[0]), forceLowerCase)) |
+                 (static_cast<unsigned int>(LoadCrc32Octet(static_cast<uint8_t>(buf[1]), forceLowerCase)) << 8) |
+                 (static_cast<unsigned int>(LoadCrc32Octet(static_cast<uint8_t>(buf[2]), forceLowerCase)) << 16) |
+                 (static_cast<unsigned int>(LoadCrc32Octet(static_cast<uint8_t>(buf[3]), forceLowerCase)) << 24));
+            const unsigned int high =
+                static_cast<unsigned int>(LoadCrc32Octet(static_cast<uint8_t>(buf[4]), forceLowerCase)) |
+                (static_cast<unsigned int>(LoadCrc32Octet(static_cast<uint8_t>(buf[5]), forceLowerCase)) << 8) |
+                (static_cast<unsigned int>(LoadCrc32Octet(static_cast<uint8_t>(buf[6]), forceLowerCase)) << 16) |
+                (static_cast<unsigned int>(LoadCrc32Octet(static_cast<uint8_t>(buf[7]), forceLowerCase)) << 24);
+
+            const auto& tables = crc_slice_tables.m_tables;
+            return tables[7][low & 0xff] ^ tables[6][(low >> 8) & 0xff] ^ tables[5][(low >> 16) & 0xff] ^ tables[4][low >> 24] ^
+                tables[3][high & 0xff] ^ tables[2][(high >> 8) & 0xff] ^ tables[1][(high >> 16) & 0xff] ^ tables[0][high >> 24];
+        }
+
         template<typename CharType>
         constexpr void Crc32Set(const CharType* data, size_t size, bool forceLowerCase, AZ::u32& value)
         {
@@ -96,6 +150,10 @@ namespace AZ
             else
             {
                 unsigned int crc = 0xffffffffL;
+                for (; size >= 8; size -= 8, buf += 8)
+                {
+                    crc = ComputeCrc32Octets8(crc, buf, forceLowerCase);
+                }
                 if (size)
                 {
                     if (forceLowerCase)
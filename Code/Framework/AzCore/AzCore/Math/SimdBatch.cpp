@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdBatch.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+
+namespace AZ::SimdBatch
+{
+    namespace
+    {
+        constexpr size_t LaneCount = 4;
+
+        Vector3 LoadVector3(ConstVector3Stream stream, size_t index)
+        {
+            return Vector3(stream.m_x[index], stream.m_y[index], stream.m_z[index]);
+        }
+
+        void StoreVector3(Vector3Stream stream, size_t index, const Vector3& value)
+        {
+            stream.m_x[index] = value.GetX();
+            stream.m_y[index] = value.GetY();
+            stream.m_z[index] = value.GetZ();
+        }
+    } // namespace
+
+    void TransformPoints(const Transform& transform, ConstVector3Stream points, Vector3Stream out, size_t count)
+    {
+        using Simd::Vec4;
+
+        // Transform::TransformPoint applies the scale, rotation and translation in turn, which is the 3x4 matrix of the transform
+        const Matrix3x4 matrix = Matrix3x4::CreateFromTransform(transform);
+        Vec4::FloatType rows[3][4];
+        for (int32_t row = 0; row < 3; ++row)
+        {
+            for (int32_t col = 0; col < 4; ++col)
+            {
+                rows[row][col] = Vec4::Splat(matrix.GetElement(row, col));
+            }
+        }
+
+        size_t i = 0;
+        for (; i + LaneCount <= count; i += LaneCount)
+        {
+            const Vec4::FloatType x = Vec4::LoadUnaligned(points.m_x + i);
+            const Vec4::FloatType y = Vec4::LoadUnaligned(points.m_y + i);
+            const Vec4::FloatType z = Vec4::LoadUnaligned(points.m_z + i);
+
+            Vec4::FloatType result[3];
+            for (int32_t row = 0; row < 3; ++row)
+            {
+                result[row] = Vec4::Madd(rows[row][0], x, Vec4::Madd(rows[row][1], y, Vec4::Madd(rows[row][2], z, rows[row][3])));
+            }
+
+            Vec4::StoreUnaligned(out.m_x + i, result[0]);
+            Vec4::StoreUnaligned(out.m_y + i, result[1]);
+            Vec4::StoreUnaligned(out.m_z + i, result[2]);
+        }
+
+        for (; i < count; ++i)
+        {
+            StoreVector3(out, i, matrix * LoadVector3(points, i));
+        }
+    }
+
+    void MultiplyQuaternions(ConstQuaternionStream lhs, ConstQuaternionStream rhs, QuaternionStream out, size_t count)
+    {
+        using Simd::Vec4;
+
+        size_t i = 0;
+        for (; i + LaneCount <= count; i += LaneCount)
+        {
+            const Vec4::FloatType ax = Vec4::LoadUnaligned(lhs.m_x + i);
+            const Vec4::FloatType ay = Vec4::LoadUnaligned(lhs.m_y + i);
+            const Vec4::FloatType az = Vec4::LoadUnaligned(lhs.m_z + i);
+            const Vec4::FloatType aw = Vec4::LoadUnaligned(lhs.m_w + i);
+            const Vec4::FloatType bx = Vec4::LoadUnaligned(rhs.m_x + i);
+            const Vec4::FloatType by = Vec4::LoadUnaligned(rhs.m_y + i);
+            const Vec4::FloatType bz = Vec4::LoadUnaligned(rhs.m_z + i);
+            const Vec4::FloatType bw = Vec4::LoadUnaligned(rhs.m_w + i);
+
+            // Hamilton product, in the same term order as Vec4::QuaternionMultiply
+            const Vec4::FloatType x = Vec4::Madd(ax, bw, Vec4::Madd(aw, bx, Vec4::Sub(Vec4::Mul(ay, bz), Vec4::Mul(az, by))));
+            const Vec4::FloatType y = Vec4::Madd(ay, bw, Vec4::Madd(aw, by, Vec4::Sub(Vec4::Mul(az, bx), Vec4::Mul(ax, bz))));
+            const Vec4::FloatType z = Vec4::Madd(az, bw, Vec4::Madd(aw, bz, Vec4::Sub(Vec4::Mul(ax, by), Vec4::Mul(ay, bx))));
+            const Vec4::FloatType w =
+                Vec4::Sub(Vec4::Mul(aw, bw), Vec4::Madd(ax, bx, Vec4::Madd(ay, by, Vec4::Mul(az, bz))));
+
+            Vec4::StoreUnaligned(out.m_x + i, x);
+            Vec4::StoreUnaligned(out.m_y + i, y);
+            Vec4::StoreUnaligned(out.m_z + i, z);
+            Vec4::StoreUnaligned(out.m_w + i, w);
+        }
+
+        for (; i < count; ++i)
+        {
+            const Quaternion result = Quaternion(lhs.m_x[i], lhs.m_y[i], lhs.m_z[i], lhs.m_w[i]) *
+                Quaternion(rhs.m_x[i], rhs.m_y[i], rhs.m_z[i], rhs.m_w[i]);
+            out.m_x[i] = result.GetX();
+            out.m_y[i] = result.GetY();
+            out.m_z[i] = result.GetZ();
+            out.m_w[i] = result.GetW();
+        }
+    }
+
+    void NormalizeVectorsSafe(ConstVector3Stream vectors, Vector3Stream out, size_t count, float tolerance)
+    {
+        using Simd::Vec4;
+
+        const Vec4::FloatType toleranceSq = Vec4::Splat(tolerance * tolerance);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+        size_t i = 0;
+        for (; i + LaneCount <= count; i += LaneCount)
+        {
+            const Vec4::FloatType x = Vec4::LoadUnaligned(vectors.m_x + i);
+            const Vec4::FloatType y = Vec4::LoadUnaligned(vectors.m_y + i);
+            const Vec4::FloatType z = Vec4::LoadUnaligned(vectors.m_z + i);
+
+            const Vec4::FloatType lengthSq = Vec4::Madd(x, x, Vec4::Madd(y, y, Vec4::Mul(z, z)));
+            const Vec4::FloatType tooShort = Vec4::CmpLt(lengthSq, toleranceSq);
+            // Short lanes are divided by one and then zeroed, so they never produce a division by zero
+            const Vec4::FloatType length = Vec4::Select(Vec4::Splat(1.0f), Vec4::Sqrt(lengthSq), tooShort);
+
+            Vec4::StoreUnaligned(out.m_x + i, Vec4::Select(zero, Vec4::Div(x, length), tooShort));
+            Vec4::StoreUnaligned(out.m_y + i, Vec4::Select(zero, Vec4::Div(y, length), tooShort));
+            Vec4::StoreUnaligned(out.m_z + i, Vec4::Select(zero, Vec4::Div(z, length), tooShort));
+        }
+
+        for (; i < count; ++i)
+        {
+            StoreVector3(out, i, LoadVector3(vectors, i).GetNormalizedSafe(tolerance));
+        }
+    }
+
+    size_t OverlapsFrustumAabbs(const Frustum& frustum, ConstVector3Stream aabbMins, ConstVector3Stream aabbMaxs, bool* out, size_t count)
+    {
+        using Simd::Vec4;
+
+        struct SplatPlane
+        {
+            Vec4::FloatType m_normal[3];
+            Vec4::FloatType m_absNormal[3];
+            Vec4::FloatType m_distance;
+        };
+
+        SplatPlane planes[Frustum::PlaneId::MAX];
+        for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+        {
+            const Plane plane = frustum.GetPlane(planeId);
+            const Vector3 normal = plane.GetNormal();
+            SplatPlane& splatPlane = planes[planeId];
+            for (int32_t axis = 0; axis < 3; ++axis)
+            {
+                splatPlane.m_normal[axis] = Vec4::Splat(normal.GetElement(axis));
+                splatPlane.m_absNormal[axis] = Vec4::Splat(AZ::GetAbs(normal.GetElement(axis)));
+            }
+            splatPlane.m_distance = Vec4::Splat(plane.GetDistance());
+        }
+
+        const Vec4::FloatType half = Vec4::Splat(0.5f);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+        size_t overlapCount = 0;
+        size_t i = 0;
+        for (; i + LaneCount <= count; i += LaneCount)
+        {
+            Vec4::FloatType center[3];
+            Vec4::FloatType extents[3];
+            const float* mins[3] = { aabbMins.m_x + i, aabbMins.m_y + i, aabbMins.m_z + i };
+            const float* maxs[3] = { aabbMaxs.m_x + i, aabbMaxs.m_y + i, aabbMaxs.m_z + i };
+            for (int32_t axis = 0; axis < 3; ++axis)
+            {
+                const Vec4::FloatType min = Vec4::LoadUnaligned(mins[axis]);
+                const Vec4::FloatType max = Vec4::LoadUnaligned(maxs[axis]);
+                center[axis] = Vec4::Mul(half, Vec4::Add(min, max));
+                // Halving before subtracting avoids overflowing for boxes reaching FLT_MAX, as in ShapeIntersection::Overlaps
+                extents[axis] = Vec4::Sub(Vec4::Mul(half, max), Vec4::Mul(half, min));
+            }
+
+            // The boxes are outside of the frustum if they are fully behind any of the planes
+            Vec4::FloatType outside = zero;
+            for (const SplatPlane& plane : planes)
+            {
+                Vec4::FloatType distance = plane.m_distance;
+                Vec4::FloatType radius = zero;
+                for (int32_t axis = 0; axis < 3; ++axis)
+                {
+                    distance = Vec4::Madd(plane.m_normal[axis], center[axis], distance);
+                    radius = Vec4::Madd(plane.m_absNormal[axis], extents[axis], radius);
+                }
+                outside = Vec4::Or(outside, Vec4::CmpLtEq(Vec4::Add(distance, radius), zero));
+            }
+
+            float overlaps[LaneCount];
+            Vec4::StoreUnaligned(overlaps, Vec4::Select(zero, one, outside));
+            for (size_t lane = 0; lane < LaneCount; ++lane)
+            {
+                out[i + lane] = overlaps[lane] != 0.0f;
+                overlapCount += out[i + lane] ? 1 : 0;
+            }
+        }
+
+        for (; i < count; ++i)
+        {
+            out[i] = ShapeIntersection::Overlaps(frustum, Aabb::CreateFromMinMax(LoadVector3(aabbMins, i), LoadVector3(aabbMaxs, i)));
+            overlapCount += out[i] ? 1 : 0;
+        }
+
+        return overlapCount;
+    }
+} // namespace AZ::SimdBatch
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace AZ
+{
+    class Frustum;
+    class Transform;
+
+    //! Batch math kernels operating on structure-of-arrays streams.
+    //! Each kernel processes four elements per iteration using the Simd::Vec4 backend selected for the platform
+    //! (SSE, NEON or scalar), and handles the remaining elements with the scalar math types. Results match the
+    //! equivalent single element operations on Vector3, Quaternion and ShapeIntersection within floating point
+    //! rounding.
+    //! Input and output streams may alias each other exactly (in place operation), but must not partially overlap.
+    namespace SimdBatch
+    {
+        //! A read-only stream of count 3 component vectors, stored as separate x, y and z arrays.
+        struct ConstVector3Stream
+        {
+            const float* m_x = nullptr;
+            const float* m_y = nullptr;
+            const float* m_z = nullptr;
+        };
+
+        //! A writable stream of 3 component vectors, stored as separate x, y and z arrays.
+        struct Vector3Stream
+        {
+            float* m_x = nullptr;
+            float* m_y = nullptr;
+            float* m_z = nullptr;
+
+            operator ConstVector3Stream() const
+            {
+                return { m_x, m_y, m_z };
+            }
+        };
+
+        //! A read-only stream of quaternions, stored as separate x, y, z and w arrays.
+        struct ConstQuaternionStream
+        {
+            const float* m_x = nullptr;
+            const float* m_y = nullptr;
+            const float* m_z = nullptr;
+            const float* m_w = nullptr;
+        };
+
+        //! A writable stream of quaternions, stored as separate x, y, z and w arrays.
+        struct QuaternionStream
+        {
+            float* m_x = nullptr;
+            float* m_y = nullptr;
+            float* m_z = nullptr;
+            float* m_w = nullptr;
+
+            operator ConstQuaternionStream() const
+            {
+                return { m_x, m_y, m_z, m_w };
+            }
+        };
+
+        //! Transforms count points by the transform, equivalent to Transform::TransformPoint.
+        void TransformPoints(const Transform& transform, ConstVector3Stream points, Vector3Stream out, size_t count);
+
+        //! Multiplies count pairs of quaternions, out[i] = lhs[i] * rhs[i], equivalent to Quaternion::operator*.
+        void MultiplyQuaternions(ConstQuaternionStream lhs, ConstQuaternionStream rhs, QuaternionStream out, size_t count);
+
+        //! Normalizes count vectors, equivalent to Vector3::GetNormalizedSafe.
+        //! Vectors whose length is below the tolerance are set to zero.
+        void NormalizeVectorsSafe(ConstVector3Stream vectors, Vector3Stream out, size_t count, float tolerance = Constants::Tolerance);
+
+        //! Tests count axis aligned boxes against a frustum, equivalent to ShapeIntersection::Overlaps(Frustum, Aabb).
+        //! @param aabbMins Stream of the box minimums.
+        //! @param aabbMaxs Stream of the box maximums.
+        //! @param out Receives true for boxes overlapping the frustum, false for boxes fully outside of it.
+        //! @return The number of boxes overlapping the frustum.
+        size_t OverlapsFrustumAabbs(const Frustum& frustum, ConstVector3Stream aabbMins, ConstVector3Stream aabbMaxs, bool* out, size_t count);
+    } // namespace SimdBatch
+} // namespace AZ
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/Memory/IAllocator.h>
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/time.h>
+
+#include <math.h>
+
+namespace AZ::Debug
+{
+    namespace Internal
+    {
+        // Sampling state of the current thread. Allocations are counted per thread so that the hot path of the
+        // allocators only touches thread local data.
+        struct ThreadSamplingState
+        {
+            const AllocationSampler* m_sampler = nullptr;
+            AZ::u32 m_generation = 0;
+            AZ::s64 m_bytesUntilSample = 0;
+            AZ::u64 m_random = 0;
+            bool m_isRecording = false; ///< Allocations made while recording a sample are not sampled
+        };
+        static thread_local ThreadSamplingState t_samplingState;
+
+        static AZ::s64 NextSampleDistance(ThreadSamplingState& state, size_t samplingInterval)
+        {
+            // xorshift64*
+            state.m_random ^= state.m_random >> 12;
+            state.m_random ^= state.m_random << 25;
+            state.m_random ^= state.m_random >> 27;
+            const AZ::u64 random = state.m_random * 0x2545F4914F6CDD1DULL;
+
+            // Exponentially distributed distance with a mean of samplingInterval, u is in (0, 1]
+            const double u = (static_cast<double>(random >> 11) + 1.0) * (1.0 / 9007199254740992.0);
+            const double distance = -log(u) * static_cast<double>(samplingInterval);
+            return AZStd::max<AZ::s64>(1, static_cast<AZ::s64>(distance));
+        }
+
+        // A sampled allocation stands for all the bytes allocated since the previous sample. Allocations larger than
+        // the interval are more likely to be sampled, which is compensated by dividing by the sampling probability.
+        static size_t EstimatedBytes(size_t byteSize, size_t samplingInterval)
+        {
+            const double ratio = static_cast<double>(byteSize) / static_cast<double>(samplingInterval);
+            const double probability = 1.0 - exp(-ratio);
+            return probability > 0.0 ? static_cast<size_t>(static_cast<double>(byteSize) / probability) : samplingInterval;
+        }
+    } // namespace Internal
+
+    AllocationSampler::AllocationSampler()
+    {
+        for (AZStd::atomic<AZ::u64>& filterWord : m_addressFilter)
+        {
+            filterWord.store(0, AZStd::memory_order_relaxed);
+        }
+    }
+
+    AllocationSampler::~AllocationSampler() = default;
+
+    void AllocationSampler::SetSamplingInterval(size_t samplingInterval)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        ResetSamples();
+        // Every thread draws a new sampling point on its next allocation
+        m_samplingGeneration.fetch_add(1, AZStd::memory_order_relaxed);
+        m_samplingInterval.store(samplingInterval, AZStd::memory_order_relaxed);
+    }
+
+    void AllocationSampler::ResetSamples()
+    {
+        m_sites.clear();
+        m_liveSamples.clear();
+        m_numLiveSamples.store(0, AZStd::memory_order_relaxed);
+        for (AZStd::atomic<AZ::u64>& filterWord : m_addressFilter)
+        {
+            filterWord.store(0, AZStd::memory_order_relaxed);
+        }
+    }
+
+    size_t AllocationSampler::AddressFilterBit(void* address)
+    {
+        // Allocations are at least 8 byte aligned, mix the higher bits in to spread neighboring addresses
+        const size_t value = reinterpret_cast<size_t>(address) >> 3;
+        return (value ^ (value >> 16) ^ (value >> 32)) & (AddressFilterBits - 1);
+    }
+
+    void AllocationSampler::SampleAllocation(const IAllocator& allocator, void* address, size_t byteSize, unsigned int stackSuppressCount)
+    {
+        const size_t samplingInterval = GetSamplingInterval();
+        if (samplingInterval == 0 || address == nullptr)
+        {
+            return;
+        }
+
+        Internal::ThreadSamplingState& state = Internal::t_samplingState;
+        if (state.m_isRecording)
+        {
+            return;
+        }
+
+        const AZ::u32 generation = m_samplingGeneration.load(AZStd::memory_order_relaxed);
+        if (state.m_sampler != this || state.m_generation != generation)
+        {
+            state.m_sampler = this;
+            state.m_generation = generation;
+            if (state.m_random == 0)
+            {
+                // Seed from the thread local storage address so threads don't sample in lockstep
+                state.m_random = (reinterpret_cast<AZ::u64>(&state) ^ AZStd::GetTimeNowMicroSecond()) | 1;
+            }
+            state.m_bytesUntilSample = Internal::NextSampleDistance(state, samplingInterval);
+        }
+
+        state.m_bytesUntilSample -= static_cast<AZ::s64>(byteSize);
+        if (state.m_bytesUntilSample > 0)
+        {
+            return;
+        }
+        state.m_bytesUntilSample = Internal::NextSampleDistance(state, samplingInterval);
+
+        state.m_isRecording = true;
+
+        Site sampledSite;
+        sampledSite.m_allocatorName = allocator.GetName();
+        sampledSite.m_stackFrameCount = StackRecorder::Record(sampledSite.m_stackFrames, MaxStackFrames, stackSuppressCount + 1);
+
+        size_t siteKey = AZStd::hash<const void*>{}(sampledSite.m_allocatorName);
+        for (unsigned int i = 0; i < sampledSite.m_stackFrameCount; ++i)
+        {
+            AZStd::hash_combine(siteKey, sampledSite.m_stackFrames[i].m_programCounter);
+        }
+        const size_t estimatedBytes = Internal::EstimatedBytes(byteSize, samplingInterval);
+
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            auto siteInserted = m_sites.try_emplace(siteKey);
+            Site& site = siteInserted.first->second;
+            if (siteInserted.second)
+            {
+                site = sampledSite;
+                site.m_liveBytes = 0;
+                site.m_totalBytes = 0;
+                site.m_sampleCount = 0;
+            }
+            site.m_liveBytes += estimatedBytes;
+            site.m_totalBytes += estimatedBytes;
+            ++site.m_sampleCount;
+
+            auto sampleInserted = m_liveSamples.try_emplace(address, LiveSample{ siteKey, estimatedBytes });
+            if (!sampleInserted.second)
+            {
+                // The previous allocation at this address was released without going through the allocator profiling
+                LiveSample& previous = sampleInserted.first->second;
+                auto previousSite = m_sites.find(previous.m_siteKey);
+                if (previousSite != m_sites.end())
+                {
+                    previousSite->second.m_liveBytes -= previous.m_estimatedBytes;
+                }
+                previous = LiveSample{ siteKey, estimatedBytes };
+            }
+            else
+            {
+                m_numLiveSamples.fetch_add(1, AZStd::memory_order_relaxed);
+            }
+
+            const size_t filterBit = AddressFilterBit(address);
+            m_addressFilter[filterBit / 64].fetch_or(AZ::u64(1) << (filterBit % 64), AZStd::memory_order_relaxed);
+        }
+
+        state.m_isRecording = false;
+    }
+
+    void AllocationSampler::SampleDeallocation(void* address)
+    {
+        if (!HasLiveSamples() || address == nullptr)
+        {
+            return;
+        }
+
+        const size_t filterBit = AddressFilterBit(address);
+        if ((m_addressFilter[filterBit / 64].load(AZStd::memory_order_relaxed) & (AZ::u64(1) << (filterBit % 64))) == 0)
+        {
+            return;
+        }
+
+        AZStd::scoped_lock lock(m_mutex);
+        auto sampleIt = m_liveSamples.find(address);
+        if (sampleIt == m_liveSamples.end())
+        {
+            return;
+        }
+
+        auto siteIt = m_sites.find(sampleIt->second.m_siteKey);
+        if (siteIt != m_sites.end())
+        {
+            siteIt->second.m_liveBytes -= sampleIt->second.m_estimatedBytes;
+        }
+        m_liveSamples.erase(sampleIt);
+        m_numLiveSamples.fetch_sub(1, AZStd::memory_order_relaxed);
+    }
+
+    void AllocationSampler::GetSiteReports(SiteReports& reports) const
+    {
+        // Copy the sites first, as decoding the call stacks allocates and may be sampled
+        AZStd::vector<Site, AZStd::stateless_allocator> sites;
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            sites.reserve(m_sites.size());
+            for (const auto& site : m_sites)
+            {
+                sites.push_back(site.second);
+            }
+        }
+
+        reports.clear();
+        reports.reserve(sites.size());
+        SymbolStorage::StackLine lines[MaxStackFrames];
+        for (const Site& site : sites)
+        {
+            SiteReport& report = reports.emplace_back();
+            report.m_allocatorName = site.m_allocatorName;
+            report.m_liveBytes = site.m_liveBytes;
+            report.m_totalBytes = site.m_totalBytes;
+            report.m_sampleCount = site.m_sampleCount;
+
+            SymbolStorage::DecodeFrames(site.m_stackFrames, site.m_stackFrameCount, lines);
+            for (unsigned int i = 0; i < site.m_stackFrameCount; ++i)
+            {
+                if (site.m_stackFrames[i].IsValid())
+                {
+                    report.m_stack.emplace_back(lines[i]);
+                }
+            }
+        }
+    }
+
+    // File layout, one record per line:
+    //     O3DEAllocationSamples <version>
+    //     interval <sampling interval in bytes>
+    //     site <live bytes> <total bytes> <sample count> <frame count> <allocator name>
+    //     <one line per frame, innermost first>
+    static constexpr const char* SampleFileHeader = "O3DEAllocationSamples";
+    static constexpr int SampleFileVersion = 1;
+
+    bool AllocationSampler::WriteSiteReports(IO::GenericStream& stream, size_t samplingInterval, const SiteReports& reports)
+    {
+        if (!stream.CanWrite())
+        {
+            return false;
+        }
+
+        auto writeLine = [&stream](const AZStd::string& line)
+        {
+            return stream.Write(line.size(), line.data()) == line.size() && stream.Write(1, "\n") == 1;
+        };
+
+        bool result = writeLine(AZStd::string::format("%s %d", SampleFileHeader, SampleFileVersion));
+        result = result && writeLine(AZStd::string::format("interval %zu", samplingInterval));
+        for (const SiteReport& report : reports)
+        {
+            result = result &&
+                writeLine(AZStd::string::format(
+                    "site %zu %zu %zu %zu %s", report.m_liveBytes, report.m_totalBytes, report.m_sampleCount, report.m_stack.size(),
+                    report.m_allocatorName.c_str()));
+            for (const AZStd::string& frame : report.m_stack)
+            {
+                result = result && writeLine(frame);
+            }
+        }
+        return result;
+    }
+
+    bool AllocationSampler::ReadSiteReports(IO::GenericStream& stream, size_t& samplingInterval, SiteReports& reports)
+    {
+        if (!stream.CanRead())
+        {
+            return false;
+        }
+
+        AZStd::string contents;
+        contents.resize(stream.GetLength());
+        contents.resize(stream.Read(contents.size(), contents.data()));
+
+        // Frames may be empty lines, so split on every line break
+        AZStd::vector<AZStd::string_view> lines;
+        AZStd::string_view remaining = contents;
+        while (!remaining.empty())
+        {
+            const size_t lineEnd = remaining.find('\n');
+            AZStd::string_view line = remaining.substr(0, lineEnd);
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.remove_suffix(1);
+            }
+            lines.push_back(line);
+            remaining = lineEnd == AZStd::string_view::npos ? AZStd::string_view{} : remaining.substr(lineEnd + 1);
+        }
+
+        reports.clear();
+        samplingInterval = 0;
+        int version = 0;
+        if (lines.size() < 2 || sscanf(AZStd::string(lines[0]).c_str(), "O3DEAllocationSamples %d", &version) != 1 ||
+            version != SampleFileVersion || sscanf(AZStd::string(lines[1]).c_str(), "interval %zu", &samplingInterval) != 1)
+        {
+            return false;
+        }
+
+        for (size_t lineIndex = 2; lineIndex < lines.size();)
+        {
+            const AZStd::string siteLine(lines[lineIndex++]);
+            SiteReport report;
+            size_t frameCount = 0;
+            int nameOffset = 0;
+            if (sscanf(
+                    siteLine.c_str(), "site %zu %zu %zu %zu %n", &report.m_liveBytes, &report.m_totalBytes, &report.m_sampleCount,
+                    &frameCount, &nameOffset) != 4 ||
+                nameOffset == 0 || frameCount > lines.size() - lineIndex)
+            {
+                return false;
+            }
+            report.m_allocatorName = siteLine.substr(nameOffset);
+            for (size_t i = 0; i < frameCount; ++i)
+            {
+                report.m_stack.emplace_back(lines[lineIndex++]);
+            }
+            reports.push_back(AZStd::move(report));
+        }
+        return true;
+    }
+} // namespace AZ::Debug
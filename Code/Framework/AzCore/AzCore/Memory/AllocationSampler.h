@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Debug/StackTracer.h>
+#include <AzCore/std/allocator_stateless.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    class IAllocator;
+
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    namespace Debug
+    {
+        /**
+         * Allocation sampler
+         * Low overhead alternative to AllocationRecords for finding leaks and hot allocation sites under real load.
+         * Instead of recording every allocation, it records one allocation per sampling interval bytes on average,
+         * with its call stack. The distance between two samples is drawn from an exponential distribution (Poisson
+         * sampling), so every allocated byte has the same chance of being sampled regardless of the allocation
+         * pattern, and each sample is weighted by the number of bytes it stands for.
+         * Samples are aggregated by allocator and call stack into allocation sites, which track both the estimated
+         * bytes that are still alive (leaks) and the estimated bytes allocated since sampling started (hot sites).
+         * The sampler is owned by the AllocatorManager and used by every registered allocator.
+         */
+        class AllocationSampler
+        {
+        public:
+            static constexpr unsigned int MaxStackFrames = 24;
+
+            //! Allocation site with decoded call stack, as written to and read from sample files
+            struct SiteReport
+            {
+                AZStd::string m_allocatorName;
+                size_t m_liveBytes = 0; ///< Estimated bytes allocated from this site that are still alive
+                size_t m_totalBytes = 0; ///< Estimated bytes allocated from this site since sampling started
+                size_t m_sampleCount = 0;
+                AZStd::vector<AZStd::string> m_stack; ///< Innermost frame first
+            };
+            using SiteReports = AZStd::vector<SiteReport>;
+
+            AllocationSampler();
+            ~AllocationSampler();
+
+            //! Samples one allocation per samplingInterval bytes on average. Changing the interval restarts sampling,
+            //! 0 stops sampling. Either drops the samples taken so far.
+            void SetSamplingInterval(size_t samplingInterval);
+            size_t GetSamplingInterval() const
+            {
+                return m_samplingInterval.load(AZStd::memory_order_relaxed);
+            }
+
+            AZ_FORCE_INLINE bool IsSampling() const
+            {
+                return GetSamplingInterval() != 0;
+            }
+
+            //! Called by the allocators for every allocation; only an allocation that crosses the sampling point is recorded
+            void SampleAllocation(const IAllocator& allocator, void* address, size_t byteSize, unsigned int stackSuppressCount);
+            //! Called by the allocators for every deallocation while sampled allocations are alive
+            void SampleDeallocation(void* address);
+
+            //! Returns true if some sampled allocation is still alive, in which case deallocations have to be checked
+            AZ_FORCE_INLINE bool HasLiveSamples() const
+            {
+                return m_numLiveSamples.load(AZStd::memory_order_relaxed) != 0;
+            }
+
+            //! Decodes the call stacks of the allocation sites sampled so far
+            void GetSiteReports(SiteReports& reports) const;
+
+            //! Text format shared by the sys_DumpAllocationSamples command and the Heap Profiler
+            static bool WriteSiteReports(IO::GenericStream& stream, size_t samplingInterval, const SiteReports& reports);
+            static bool ReadSiteReports(IO::GenericStream& stream, size_t& samplingInterval, SiteReports& reports);
+
+        private:
+            AllocationSampler(const AllocationSampler&) = delete;
+            AllocationSampler& operator=(const AllocationSampler&) = delete;
+
+            struct Site
+            {
+                const char* m_allocatorName;
+                size_t m_liveBytes;
+                size_t m_totalBytes;
+                size_t m_sampleCount;
+                unsigned int m_stackFrameCount;
+                StackFrame m_stackFrames[MaxStackFrames];
+            };
+
+            struct LiveSample
+            {
+                size_t m_siteKey;
+                size_t m_estimatedBytes;
+            };
+
+            // The sampler is called from within the allocators, so its containers allocate from the OS directly
+            using SiteMap = AZStd::unordered_map<size_t, Site, AZStd::hash<size_t>, AZStd::equal_to<size_t>, AZStd::stateless_allocator>;
+            using LiveSampleMap =
+                AZStd::unordered_map<void*, LiveSample, AZStd::hash<void*>, AZStd::equal_to<void*>, AZStd::stateless_allocator>;
+
+            static size_t AddressFilterBit(void* address);
+            void ResetSamples();
+
+            // One bit per address hash, set for every sampled address. Deallocations of addresses whose bit is clear
+            // don't need to take the lock. Bits are only cleared when the samples are dropped.
+            static constexpr size_t AddressFilterBits = 64 * 1024;
+            AZStd::atomic<AZ::u64> m_addressFilter[AddressFilterBits / 64];
+
+            AZStd::atomic<size_t> m_samplingInterval{ 0 };
+            AZStd::atomic<AZ::u32> m_samplingGeneration{ 0 };
+            AZStd::atomic<size_t> m_numLiveSamples{ 0 };
+
+            mutable AZStd::mutex m_mutex;
+            SiteMap m_sites;
+            LiveSampleMap m_liveSamples;
+        };
+    } // namespace Debug
+} // namespace AZ
@@ -188,6 +188,7 @@ namespace AZ
         if (m_registrationEnabled)
         {
             AllocatorManager::Instance().RegisterAllocator(this);
+            m_sampler = &AllocatorManager::Instance().GetAllocationSampler();
         }
 
         m_isReady = true;
@@ -199,6 +200,7 @@ namespace AZ
         {
             AllocatorManager::Instance().UnRegisterAllocator(this);
         }
+        m_sampler = nullptr;
 
         if (m_records)
         {
@@ -249,6 +251,7 @@ namespace AZ
                 m_records->UnregisterAllocation(ptr, byteSize, alignment, info);
             }
         }
+
 #if O3DE_RECORDING_ENABLED
         RecordAllocatorOperation(AllocatorOperation::DEALLOCATE, ptr, byteSize, alignment);
 #endif
@@ -263,6 +266,7 @@ namespace AZ
                 m_records->RegisterReallocation(ptr, newPtr, newSize, newAlignment, 1);
             }
         }
+
 #if O3DE_RECORDING_ENABLED
         RecordAllocatorOperation(AllocatorOperation::DEALLOCATE, ptr);
         RecordAllocatorOperation(AllocatorOperation::ALLOCATE, newPtr, newSize, newAlignment);
@@ -283,6 +287,37 @@ namespace AZ
 #endif
     }
 
+    void AllocatorBase::SampleAllocation(void* ptr, size_t byteSize, int suppressStackRecord)
+    {
+        if (m_sampler && m_sampler->IsSampling())
+        {
+            m_sampler->SampleAllocation(*this, ptr, byteSize, suppressStackRecord + 1);
+        }
+    }
+
+    void AllocatorBase::SampleDeallocation(void* ptr)
+    {
+        if (m_sampler && m_sampler->HasLiveSamples())
+        {
+            m_sampler->SampleDeallocation(ptr);
+        }
+    }
+
+    void AllocatorBase::SampleReallocation(void* ptr, void* newPtr, size_t newSize)
+    {
+        if (m_sampler)
+        {
+            if (m_sampler->HasLiveSamples())
+            {
+                m_sampler->SampleDeallocation(ptr);
+            }
+            if (newSize && m_sampler->IsSampling())
+            {
+                m_sampler->SampleAllocation(*this, newPtr, newSize, 1);
+            }
+        }
+    }
+
     bool AllocatorBase::OnOutOfMemory(size_t byteSize, size_t alignment)
     {
         if (AllocatorManager::IsReady() && AllocatorManager::Instance().m_outOfMemoryListener)
@@ -14,6 +14,7 @@ namespace AZ
     namespace Debug
     {
         struct AllocationInfo;
+        class AllocationSampler;
     }
 
     /**
@@ -81,11 +82,23 @@ namespace AZ
         /// Records a resize for profiling.
         void ProfileResize(void* ptr, size_t newSize);
 
+        /// Passes an allocation to the allocation sampler. Unlike the Profile functions above, which are only compiled
+        /// in when AZ_MEMORY_PROFILE is enabled, the sampler hooks are part of every build and return right away while
+        /// sampling is off.
+        void SampleAllocation(void* ptr, size_t byteSize, int suppressStackRecord);
+
+        /// Passes a deallocation to the allocation sampler.
+        void SampleDeallocation(void* ptr);
+
+        /// Passes a reallocation to the allocation sampler.
+        void SampleReallocation(void* ptr, void* newPtr, size_t newSize);
+
         /// User allocator should call this function when they run out of memory!
         bool OnOutOfMemory(size_t byteSize, size_t alignment);
 
     private:
         Debug::AllocationRecords* m_records = nullptr;  // Cached pointer to allocation records
+        Debug::AllocationSampler* m_sampler = nullptr;  // Cached pointer to the AllocatorManager's sampler, registered allocators only
         size_t m_memoryGuardSize = 0;
         bool m_isProfilingActive = false;
         bool m_isReady = false;
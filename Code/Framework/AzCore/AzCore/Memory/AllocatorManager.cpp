@@ -422,6 +422,77 @@ namespace AZ
         "NOTE: smaller values for the max index can be specified and still print out all the allocations, as long as it larger than the "
         "total number of allocation records\n");
 
+    static void StartAllocationSampling(const AZ::ConsoleCommandContainer& arguments)
+    {
+        [[maybe_unused]] static constexpr const char* MemoryTag = "mem";
+        // Roughly matches the interval of tcmalloc's heap profiler, a few thousand samples for a large heap
+        constexpr size_t DefaultSamplingInterval = 512 * 1024;
+
+        size_t samplingInterval = DefaultSamplingInterval;
+        if (!arguments.empty() && (!ConsoleTypeHelpers::ToValue(samplingInterval, arguments[0]) || samplingInterval == 0))
+        {
+            AZ_Error(MemoryTag, false, R"(Unable to convert the sampling interval of "%.*s" to a positive integer.)", AZ_STRING_ARG(arguments[0]));
+            return;
+        }
+        AllocatorManager::Instance().GetAllocationSampler().SetSamplingInterval(samplingInterval);
+    }
+    AZ_CONSOLEFREEFUNC("sys_StartAllocationSampling", StartAllocationSampling, AZ::ConsoleFunctorFlags::Null,
+        "Start recording the call stack of one allocation per <interval> bytes allocated, for all registered allocators.\n"
+        "Unlike allocation records, sampling is cheap enough to be left running under real load\n"
+        "Restarting sampling drops the samples taken so far\n"
+        "usage: sys_StartAllocationSampling [<interval-in-bytes>]\n"
+        "Ex. `sys_StartAllocationSampling 1048576`");
+
+    static void StopAllocationSampling([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        AllocatorManager::Instance().GetAllocationSampler().SetSamplingInterval(0);
+    }
+    AZ_CONSOLEFREEFUNC("sys_StopAllocationSampling", StopAllocationSampling, AZ::ConsoleFunctorFlags::Null,
+        "Stop sampling allocations and drop the samples taken so far.");
+
+    static void DumpAllocationSamples(const AZ::ConsoleCommandContainer& arguments)
+    {
+        using AllocationString [[maybe_unused]] = AZStd::fixed_string<1024>;
+        [[maybe_unused]] static constexpr const char* MemoryTag = "mem";
+
+        AZ::IO::FixedMaxPath filePath;
+        if (!arguments.empty())
+        {
+            filePath = arguments[0];
+        }
+        else
+        {
+            // Dump to <dev-write-storage>/allocation_samples/samples.<iso8601-timestamp>.<process-id>.txt
+            AZ::Date::Iso8601TimestampString utcTimestampString;
+            AZ::Date::GetFilenameCompatibleFormatNow(utcTimestampString);
+            AZStd::fixed_string<32> processIdString;
+            AZStd::to_string(processIdString, AZ::Platform::GetCurrentProcessId());
+            filePath = AZ::IO::FixedMaxPath{ AZ::Utils::GetDevWriteStoragePath() } / "allocation_samples" /
+                AZ::IO::FixedMaxPathString::format("samples.%s.%s.txt", utcTimestampString.c_str(), processIdString.c_str());
+        }
+
+        Debug::AllocationSampler& sampler = AllocatorManager::Instance().GetAllocationSampler();
+        Debug::AllocationSampler::SiteReports reports;
+        sampler.GetSiteReports(reports);
+
+        constexpr auto openMode = AZ::IO::OpenMode::ModeCreatePath | AZ::IO::OpenMode::ModeWrite;
+        AZ::IO::SystemFileStream stream(filePath.c_str(), openMode);
+        if (!stream.IsOpen() || !Debug::AllocationSampler::WriteSiteReports(stream, sampler.GetSamplingInterval(), reports))
+        {
+            AZ_Error(
+                MemoryTag, false,
+                AllocationString::format(R"("sys_DumpAllocationSamples" command could not write file path of "%s".)" "\n", filePath.c_str())
+                    .c_str());
+            return;
+        }
+        AZ_Printf(MemoryTag, "%zu allocation sites written to %s\n", reports.size(), filePath.c_str());
+    }
+    AZ_CONSOLEFREEFUNC("sys_DumpAllocationSamples", DumpAllocationSamples, AZ::ConsoleFunctorFlags::Null,
+        "Write the allocation sites sampled since sys_StartAllocationSampling, with their estimated live and total bytes.\n"
+        "The file can be loaded in the Heap Profiler of the Profiler gem\n"
+        "If no file path is specified, the samples are written to <dev-write-storage>/allocation_samples/samples.<iso8601-timestamp>.<process-id>.txt\n"
+        "usage: sys_DumpAllocationSamples [<file-path>]");
+
     static EnvironmentVariable<AllocatorManager>& GetAllocatorManagerEnvVar()
     {
         static EnvironmentVariable<AllocatorManager> s_allocManager;
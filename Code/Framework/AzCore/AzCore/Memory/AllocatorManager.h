@@ -9,6 +9,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
@@ -96,6 +97,9 @@ namespace AZ
         void SetTrackingForAllocator(AZStd::string_view allocatorName, AZ::Debug::AllocationRecords::Mode recordMode);
         bool RemoveTrackingForAllocator(AZStd::string_view allocatorName);
 
+        /// Sampling profiler shared by all registered allocators, see Debug::AllocationSampler
+        Debug::AllocationSampler& GetAllocationSampler() { return m_allocationSampler; }
+
         struct DumpInfo
         {
             // Must contain only POD types
@@ -170,6 +174,8 @@ namespace AZ
 
         AZ::Debug::AllocationRecords::Mode m_defaultTrackingRecordMode;
 
+        Debug::AllocationSampler m_allocationSampler;
+
         using AllocatorName = AZStd::fixed_string<128>;
         //! Stores the name
         struct AllocatorTrackingConfig
@@ -109,6 +109,7 @@ namespace AZ
         {
             const AllocateAddress allocateAddress = AZ::AllocatorInstance<Parent>::Get().allocate(byteSize, alignment);
             m_totalAllocatedBytes += allocateAddress.GetAllocatedBytes();
+            SampleAllocation(allocateAddress.GetAddress(), byteSize, 1);
             AZ_MEMORY_PROFILE(ProfileAllocation(allocateAddress.GetAddress(), byteSize, alignment, 1));
             return allocateAddress;
         }
@@ -118,6 +119,7 @@ namespace AZ
             // Record de-allocations in the ChildAllocatorSchema Allocations
             // before calling the parent allocator to make sure the allocation records
             // are up-to-date
+            SampleDeallocation(ptr);
             AZ_MEMORY_PROFILE(ProfileDeallocation(ptr, byteSize, alignment, nullptr));
 
             const size_type bytesDeallocated = AZ::AllocatorInstance<Parent>::Get().deallocate(ptr, byteSize, alignment);
@@ -131,6 +133,7 @@ namespace AZ
             AllocateAddress newAddress = AZ::AllocatorInstance<Parent>::Get().reallocate(ptr, newSize, newAlignment);
             // The reallocation might have clamped the newSize to be at least the minimum allocation size
             // used by the parent schema. For example the HphaSchemaBase has a minimum allocation size of 8 bytes
+            SampleReallocation(ptr, newAddress, newAddress.GetAllocatedBytes());
             AZ_MEMORY_PROFILE(ProfileReallocation(ptr, newAddress, newAddress.GetAllocatedBytes(), newAlignment));
             m_totalAllocatedBytes += newAddress.GetAllocatedBytes() - oldAllocatedSize;
             return newAddress;
@@ -0,0 +1,518 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/AllocatorInstance.h>
+
+#include <AzCore/std/allocator_stateless.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/typetraits/alignment_of.h>
+
+namespace AZ
+{
+    /**
+     * Header placed at the start of every block the arena takes from the page allocator.
+     */
+    struct alignas(16) FrameArenaPage
+    {
+        FrameArenaPage* m_next = nullptr;
+        size_t m_blockSize = 0;
+
+        char* Begin()
+        {
+            return reinterpret_cast<char*>(this + 1);
+        }
+
+        char* End()
+        {
+            return reinterpret_cast<char*>(this) + m_blockSize;
+        }
+    };
+
+    class FrameArenaSchemaImpl;
+
+    struct FrameArenaThreadData
+    {
+        FrameArenaPage* m_pages = nullptr; ///< Chain of regular pages, reused every frame.
+        FrameArenaPage* m_currentPage = nullptr; ///< Page in m_pages currently bumped from, null before the first allocation of a frame.
+        FrameArenaPage* m_largeBlocks = nullptr; ///< Dedicated blocks for allocations that don't fit a page, released on rewind.
+        char* m_cursor = nullptr;
+        char* m_end = nullptr;
+        char* m_lastAllocation = nullptr; ///< Start of the most recent allocation in the current page, it can be resized in place.
+        size_t m_pagesUsed = 0; ///< Number of regular pages touched since the last rewind.
+        AZ::u64 m_trimGeneration = 0;
+        /// Arena this data belongs to, cleared when the arena is destroyed before the owning thread exits.
+        AZStd::atomic<FrameArenaSchemaImpl*> m_arena{ nullptr };
+        bool m_threadExited = false; ///< Set when the owning thread exited and the data is in the free list of the arena.
+
+        // Only written by the owning thread, read by NumAllocatedBytes/NumReservedBytes from any thread
+        AZStd::atomic<AZ::u64> m_frameIndex{ 0 };
+        AZStd::atomic<size_t> m_allocatedBytes{ 0 };
+        AZStd::atomic<size_t> m_reservedBytes{ 0 };
+    };
+
+    class FrameArenaSchemaImpl
+    {
+    public:
+        FrameArenaSchemaImpl(
+            FrameArenaSchema::GetThreadData threadDataGetter,
+            FrameArenaSchema::SetThreadData threadDataSetter,
+            FrameArenaSchema::size_type pageSize);
+        ~FrameArenaSchemaImpl();
+
+        AllocateAddress Allocate(FrameArenaSchema::size_type byteSize, FrameArenaSchema::size_type alignment);
+        AllocateAddress Reallocate(FrameArenaSchema::pointer ptr, FrameArenaSchema::size_type newSize, FrameArenaSchema::size_type newAlignment);
+
+        FrameArenaThreadData& GetThreadData();
+        //! Called when the thread owning the data exits, see FrameArenaSchema::ThreadDataHolder.
+        static void ReleaseThreadData(FrameArenaThreadData* threadData);
+        static void DestroyThreadData(FrameArenaThreadData* threadData);
+        void Rewind(FrameArenaThreadData& threadData);
+        void* BumpAllocate(FrameArenaThreadData& threadData, size_t byteSize, size_t alignment);
+        bool AdvancePage(FrameArenaThreadData& threadData);
+        AllocateAddress AllocateLargeBlock(FrameArenaThreadData& threadData, size_t byteSize, size_t alignment);
+
+        FrameArenaPage* AllocatePage(FrameArenaThreadData& threadData, size_t blockSize);
+        void FreePage(FrameArenaThreadData& threadData, FrameArenaPage* page);
+
+        // Largest request served from a regular page, for any alignment up to the page header alignment
+        size_t MaxPageAllocationSize() const
+        {
+            return m_pageSize - sizeof(FrameArenaPage);
+        }
+
+        FrameArenaSchema::GetThreadData m_threadDataGetter;
+        FrameArenaSchema::SetThreadData m_threadDataSetter;
+
+        IAllocator* m_pageAllocator;
+        size_t m_pageSize;
+
+        AZStd::atomic<AZ::u64> m_frameIndex{ 1 };
+        AZStd::atomic<AZ::u64> m_trimGeneration{ 0 };
+
+        AZStd::vector<FrameArenaThreadData*, AZStd::stateless_allocator> m_threads; ///< Array with all separate thread data.
+        AZStd::vector<FrameArenaThreadData*, AZStd::stateless_allocator> m_freeThreads; ///< Data of exited threads, reused by new threads.
+        mutable AZStd::mutex m_mutex; ///< Only taken when a thread allocates for the first time or exits, and by the stats queries.
+    };
+
+    //=========================================================================
+    // FrameArenaSchemaImpl
+    //=========================================================================
+    FrameArenaSchemaImpl::FrameArenaSchemaImpl(
+        FrameArenaSchema::GetThreadData threadDataGetter,
+        FrameArenaSchema::SetThreadData threadDataSetter,
+        FrameArenaSchema::size_type pageSize)
+        : m_threadDataGetter(threadDataGetter)
+        , m_threadDataSetter(threadDataSetter)
+        , m_pageAllocator(&AllocatorInstance<SystemAllocator>::Get())
+        , m_pageSize(pageSize)
+    {
+        AZ_Assert(m_pageSize > 2 * sizeof(FrameArenaPage), "FrameArena page size %zu is too small", m_pageSize);
+    }
+
+    FrameArenaSchemaImpl::~FrameArenaSchemaImpl()
+    {
+        // IMPORTANT: We rely on all threads that used the arena (except the calling one) having finished with it,
+        // which holds since allocators are singletons destroyed at shutdown. Threads that are still running may
+        // exit later though, so their data is only detached here and destroyed by the thread on exit.
+        FrameArenaThreadData* callingThreadData = m_threadDataGetter();
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        for (FrameArenaThreadData*& threadData : m_threads)
+        {
+            for (FrameArenaPage* chain : { threadData->m_pages, threadData->m_largeBlocks })
+            {
+                while (chain)
+                {
+                    FrameArenaPage* next = chain->m_next;
+                    FreePage(*threadData, chain);
+                    chain = next;
+                }
+            }
+            if (threadData->m_threadExited || threadData == callingThreadData)
+            {
+                DestroyThreadData(threadData);
+            }
+            else
+            {
+                threadData->m_pages = nullptr;
+                threadData->m_largeBlocks = nullptr;
+                threadData->m_arena.store(nullptr, AZStd::memory_order_release);
+            }
+            threadData = nullptr;
+        }
+        m_threads.clear();
+        m_freeThreads.clear();
+
+        // reset the variable for the owner thread.
+        m_threadDataSetter(nullptr);
+    }
+
+    FrameArenaThreadData& FrameArenaSchemaImpl::GetThreadData()
+    {
+        FrameArenaThreadData* threadData = m_threadDataGetter();
+        if (threadData == nullptr)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (!m_freeThreads.empty())
+            {
+                // Continue where the exited thread left off, its allocations stay valid until the next ResetFrame
+                threadData = m_freeThreads.back();
+                m_freeThreads.pop_back();
+                threadData->m_threadExited = false;
+            }
+            else
+            {
+                void* memory = AZStd::stateless_allocator().allocate(
+                    sizeof(FrameArenaThreadData), AZStd::alignment_of<FrameArenaThreadData>::value);
+                threadData = new (memory) FrameArenaThreadData();
+                threadData->m_frameIndex.store(m_frameIndex.load(AZStd::memory_order_acquire), AZStd::memory_order_relaxed);
+                threadData->m_trimGeneration = m_trimGeneration.load(AZStd::memory_order_relaxed);
+                threadData->m_arena.store(this, AZStd::memory_order_relaxed);
+                m_threads.push_back(threadData);
+            }
+            m_threadDataSetter(threadData);
+        }
+        return *threadData;
+    }
+
+    void FrameArenaSchemaImpl::ReleaseThreadData(FrameArenaThreadData* threadData)
+    {
+        if (threadData == nullptr)
+        {
+            return;
+        }
+
+        FrameArenaSchemaImpl* arena = threadData->m_arena.load(AZStd::memory_order_acquire);
+        if (arena == nullptr)
+        {
+            // The arena was destroyed first and already released the pages
+            DestroyThreadData(threadData);
+            return;
+        }
+
+        // The pages are not rewound, as the allocations of this frame may still be used by other threads. Only the
+        // in place resizing of the last allocation isn't carried over to the next thread.
+        threadData->m_lastAllocation = nullptr;
+        AZStd::lock_guard<AZStd::mutex> lock(arena->m_mutex);
+        threadData->m_threadExited = true;
+        arena->m_freeThreads.push_back(threadData);
+    }
+
+    void FrameArenaSchemaImpl::DestroyThreadData(FrameArenaThreadData* threadData)
+    {
+        threadData->~FrameArenaThreadData();
+        AZStd::stateless_allocator().deallocate(
+            threadData, sizeof(FrameArenaThreadData), AZStd::alignment_of<FrameArenaThreadData>::value);
+    }
+
+    void FrameArenaSchemaImpl::Rewind(FrameArenaThreadData& threadData)
+    {
+        while (threadData.m_largeBlocks)
+        {
+            FrameArenaPage* next = threadData.m_largeBlocks->m_next;
+            FreePage(threadData, threadData.m_largeBlocks);
+            threadData.m_largeBlocks = next;
+        }
+
+        // Keep the pages the last frame needed, anything past that is released if a garbage collect was requested
+        const AZ::u64 trimGeneration = m_trimGeneration.load(AZStd::memory_order_relaxed);
+        if (threadData.m_trimGeneration != trimGeneration)
+        {
+            threadData.m_trimGeneration = trimGeneration;
+            FrameArenaPage** link = &threadData.m_pages;
+            for (size_t i = 0; i < threadData.m_pagesUsed && *link; ++i)
+            {
+                link = &(*link)->m_next;
+            }
+            FrameArenaPage* unused = *link;
+            *link = nullptr;
+            while (unused)
+            {
+                FrameArenaPage* next = unused->m_next;
+                FreePage(threadData, unused);
+                unused = next;
+            }
+        }
+
+        threadData.m_currentPage = nullptr;
+        threadData.m_cursor = nullptr;
+        threadData.m_end = nullptr;
+        threadData.m_lastAllocation = nullptr;
+        threadData.m_pagesUsed = 0;
+        threadData.m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+        threadData.m_frameIndex.store(m_frameIndex.load(AZStd::memory_order_acquire), AZStd::memory_order_relaxed);
+    }
+
+    void* FrameArenaSchemaImpl::BumpAllocate(FrameArenaThreadData& threadData, size_t byteSize, size_t alignment)
+    {
+        if (threadData.m_cursor == nullptr)
+        {
+            return nullptr;
+        }
+        char* address = PointerAlignUp(threadData.m_cursor, alignment);
+        if (address > threadData.m_end || static_cast<size_t>(threadData.m_end - address) < byteSize)
+        {
+            return nullptr;
+        }
+        threadData.m_cursor = address + byteSize;
+        threadData.m_lastAllocation = address;
+        return address;
+    }
+
+    bool FrameArenaSchemaImpl::AdvancePage(FrameArenaThreadData& threadData)
+    {
+        FrameArenaPage* next = threadData.m_currentPage ? threadData.m_currentPage->m_next : threadData.m_pages;
+        if (next == nullptr)
+        {
+            next = AllocatePage(threadData, m_pageSize);
+            if (next == nullptr)
+            {
+                return false;
+            }
+            if (threadData.m_currentPage)
+            {
+                threadData.m_currentPage->m_next = next;
+            }
+            else
+            {
+                threadData.m_pages = next;
+            }
+        }
+        threadData.m_currentPage = next;
+        threadData.m_cursor = next->Begin();
+        threadData.m_end = next->End();
+        threadData.m_lastAllocation = nullptr;
+        ++threadData.m_pagesUsed;
+        return true;
+    }
+
+    AllocateAddress FrameArenaSchemaImpl::AllocateLargeBlock(FrameArenaThreadData& threadData, size_t byteSize, size_t alignment)
+    {
+        // Over-allocate when needed so that the user data can be aligned after the header
+        const size_t alignmentPadding = alignment > alignof(FrameArenaPage) ? alignment : 0;
+        FrameArenaPage* block = AllocatePage(threadData, sizeof(FrameArenaPage) + alignmentPadding + byteSize);
+        if (block == nullptr)
+        {
+            return AllocateAddress{};
+        }
+        block->m_next = threadData.m_largeBlocks;
+        threadData.m_largeBlocks = block;
+        return AllocateAddress{ PointerAlignUp(block->Begin(), alignment), byteSize };
+    }
+
+    FrameArenaPage* FrameArenaSchemaImpl::AllocatePage(FrameArenaThreadData& threadData, size_t blockSize)
+    {
+        void* memory = m_pageAllocator->allocate(blockSize, alignof(FrameArenaPage));
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+        FrameArenaPage* page = new (memory) FrameArenaPage();
+        page->m_blockSize = blockSize;
+        threadData.m_reservedBytes.fetch_add(blockSize, AZStd::memory_order_relaxed);
+        return page;
+    }
+
+    void FrameArenaSchemaImpl::FreePage(FrameArenaThreadData& threadData, FrameArenaPage* page)
+    {
+        const size_t blockSize = page->m_blockSize;
+        threadData.m_reservedBytes.fetch_sub(blockSize, AZStd::memory_order_relaxed);
+        page->~FrameArenaPage();
+        m_pageAllocator->deallocate(page, blockSize, alignof(FrameArenaPage));
+    }
+
+    AllocateAddress FrameArenaSchemaImpl::Allocate(FrameArenaSchema::size_type byteSize, FrameArenaSchema::size_type alignment)
+    {
+        alignment = AZStd::max<size_t>(alignment, 1);
+        AZ_Assert((alignment & (alignment - 1)) == 0, "FrameArena alignment %zu must be a power of two", alignment);
+        // Zero sized requests still return a unique address
+        byteSize = AZStd::max<size_t>(byteSize, 1);
+
+        FrameArenaThreadData& threadData = GetThreadData();
+        if (threadData.m_frameIndex.load(AZStd::memory_order_relaxed) != m_frameIndex.load(AZStd::memory_order_relaxed))
+        {
+            Rewind(threadData);
+        }
+
+        void* address = BumpAllocate(threadData, byteSize, alignment);
+        if (address == nullptr)
+        {
+            if (byteSize + alignment > MaxPageAllocationSize())
+            {
+                AllocateAddress largeBlock = AllocateLargeBlock(threadData, byteSize, alignment);
+                if (largeBlock != nullptr)
+                {
+                    threadData.m_allocatedBytes.fetch_add(byteSize, AZStd::memory_order_relaxed);
+                }
+                return largeBlock;
+            }
+            if (!AdvancePage(threadData))
+            {
+                return AllocateAddress{};
+            }
+            address = BumpAllocate(threadData, byteSize, alignment);
+        }
+
+        threadData.m_allocatedBytes.fetch_add(byteSize, AZStd::memory_order_relaxed);
+        return AllocateAddress{ address, byteSize };
+    }
+
+    AllocateAddress FrameArenaSchemaImpl::Reallocate(
+        FrameArenaSchema::pointer ptr, FrameArenaSchema::size_type newSize, FrameArenaSchema::size_type newAlignment)
+    {
+        if (ptr == nullptr)
+        {
+            return Allocate(newSize, newAlignment);
+        }
+        if (newSize == 0)
+        {
+            return AllocateAddress{};
+        }
+
+        // Only the most recent allocation of the calling thread can be resized, in place, since the arena doesn't
+        // keep the size of individual allocations.
+        FrameArenaThreadData& threadData = GetThreadData();
+        char* address = static_cast<char*>(ptr);
+        const bool isCurrentFrame =
+            threadData.m_frameIndex.load(AZStd::memory_order_relaxed) == m_frameIndex.load(AZStd::memory_order_relaxed);
+        const bool isLastAllocation = address == threadData.m_lastAllocation &&
+            (reinterpret_cast<size_t>(address) & (newAlignment - 1)) == 0;
+        if (!isCurrentFrame || !isLastAllocation)
+        {
+            AZ_Assert(false, "FrameArena can only reallocate the most recent allocation of the calling thread");
+            return AllocateAddress{};
+        }
+        if (static_cast<size_t>(threadData.m_end - address) < newSize)
+        {
+            return AllocateAddress{};
+        }
+
+        const size_t oldSize = static_cast<size_t>(threadData.m_cursor - address);
+        threadData.m_cursor = address + newSize;
+        threadData.m_allocatedBytes.fetch_add(newSize - oldSize, AZStd::memory_order_relaxed);
+        return AllocateAddress{ ptr, newSize };
+    }
+
+    //=========================================================================
+    // FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::ThreadDataHolder::~ThreadDataHolder()
+    {
+        FrameArenaSchemaImpl::ReleaseThreadData(m_data);
+        m_data = nullptr;
+    }
+
+    FrameArenaSchema::FrameArenaSchema(GetThreadData getThreadData, SetThreadData setThreadData)
+        : m_threadDataGetter(getThreadData)
+        , m_threadDataSetter(setThreadData)
+        , m_impl(nullptr)
+    {
+    }
+
+    FrameArenaSchema::~FrameArenaSchema()
+    {
+        if (m_impl)
+        {
+            m_impl->~FrameArenaSchemaImpl();
+            AZStd::stateless_allocator().deallocate(m_impl, sizeof(FrameArenaSchemaImpl));
+            m_impl = nullptr;
+        }
+    }
+
+    bool FrameArenaSchema::Create(size_type pageSize)
+    {
+        AZ_Assert(m_impl == nullptr, "FrameArenaSchema was already created");
+        m_impl = new (AZStd::stateless_allocator().allocate(sizeof(FrameArenaSchemaImpl), AZStd::alignment_of<FrameArenaSchemaImpl>::value))
+                     FrameArenaSchemaImpl(m_threadDataGetter, m_threadDataSetter, pageSize);
+        return true;
+    }
+
+    AllocateAddress FrameArenaSchema::allocate(size_type byteSize, size_type alignment)
+    {
+        return m_impl->Allocate(byteSize, alignment);
+    }
+
+    auto FrameArenaSchema::deallocate(pointer ptr, size_type byteSize, size_type alignment) -> size_type
+    {
+        // Memory is reclaimed by ResetFrame
+        (void)ptr;
+        (void)byteSize;
+        (void)alignment;
+        return 0;
+    }
+
+    AllocateAddress FrameArenaSchema::reallocate(pointer ptr, size_type newSize, size_type newAlignment)
+    {
+        return m_impl->Reallocate(ptr, newSize, AZStd::max<size_type>(newAlignment, 1));
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::get_allocated_size(pointer ptr, align_type alignment) const
+    {
+        // Sizes of individual allocations are not recorded
+        (void)ptr;
+        (void)alignment;
+        return 0;
+    }
+
+    void FrameArenaSchema::GarbageCollect()
+    {
+        m_impl->m_trimGeneration.fetch_add(1, AZStd::memory_order_relaxed);
+
+        // Nothing rewinds the data of exited threads until a new thread picks it up, so trim it here. Data that was
+        // used during the current frame is skipped as its allocations are still valid.
+        const AZ::u64 frameIndex = m_impl->m_frameIndex.load(AZStd::memory_order_acquire);
+        AZStd::lock_guard<AZStd::mutex> lock(m_impl->m_mutex);
+        for (FrameArenaThreadData* threadData : m_impl->m_freeThreads)
+        {
+            if (threadData->m_frameIndex.load(AZStd::memory_order_relaxed) != frameIndex)
+            {
+                m_impl->Rewind(*threadData);
+            }
+        }
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::NumAllocatedBytes() const
+    {
+        const AZ::u64 frameIndex = m_impl->m_frameIndex.load(AZStd::memory_order_relaxed);
+        size_type bytesAllocated = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_impl->m_mutex);
+        for (const FrameArenaThreadData* threadData : m_impl->m_threads)
+        {
+            // Threads that haven't allocated since the last reset hold nothing from this frame
+            if (threadData->m_frameIndex.load(AZStd::memory_order_relaxed) == frameIndex)
+            {
+                bytesAllocated += threadData->m_allocatedBytes.load(AZStd::memory_order_relaxed);
+            }
+        }
+        return bytesAllocated;
+    }
+
+    FrameArenaSchema::size_type FrameArenaSchema::NumReservedBytes() const
+    {
+        size_type bytesReserved = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_impl->m_mutex);
+        for (const FrameArenaThreadData* threadData : m_impl->m_threads)
+        {
+            bytesReserved += threadData->m_reservedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return bytesReserved;
+    }
+
+    void FrameArenaSchema::ResetFrame()
+    {
+        m_impl->m_frameIndex.fetch_add(1, AZStd::memory_order_acq_rel);
+    }
+
+    AZ::u64 FrameArenaSchema::GetFrameIndex() const
+    {
+        return m_impl->m_frameIndex.load(AZStd::memory_order_acquire);
+    }
+} // namespace AZ
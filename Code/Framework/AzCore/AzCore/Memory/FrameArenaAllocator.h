@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/AllocatorBase.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ
+{
+    struct FrameArenaThreadData;
+
+    /**
+     * Frame arena schema
+     * Linear (bump pointer) allocator for temporaries that do not outlive the current frame. Every thread allocates
+     * from its own chain of pages, so allocation never takes a lock once a thread's pages are warm.
+     * deallocate is a no-op: all memory handed out during a frame is reclaimed at once by ResetFrame. Pages are kept
+     * from frame to frame, so in steady state no memory is requested from the page allocator. When a thread exits, its
+     * pages are handed to the next thread that starts allocating from the arena.
+     * IMPORTANT: Pointers returned by the schema are only valid until the next ResetFrame.
+     */
+    class FrameArenaSchema
+        : public IAllocator
+    {
+    public:
+        // Functions for getting an instance of a FrameArenaThreadData when using thread local storage
+        using GetThreadData = FrameArenaThreadData* (*)();
+        using SetThreadData = void (*)(FrameArenaThreadData*);
+
+        static constexpr size_type DefaultPageSize = 64 * 1024;
+
+        //! Thread local storage for a FrameArenaThreadData that returns it to its arena when the thread exits.
+        struct ThreadDataHolder
+        {
+            ~ThreadDataHolder();
+
+            FrameArenaThreadData* m_data = nullptr;
+        };
+
+        FrameArenaSchema(GetThreadData getThreadData, SetThreadData setThreadData);
+        ~FrameArenaSchema() override;
+
+        bool Create(size_type pageSize = DefaultPageSize);
+
+        AllocateAddress allocate(size_type byteSize, size_type alignment) override;
+        size_type deallocate(pointer ptr, size_type byteSize, size_type alignment) override;
+        AllocateAddress reallocate(pointer ptr, size_type newSize, size_type newAlignment) override;
+        size_type get_allocated_size(pointer ptr, align_type alignment) const override;
+        /// Releases pages that were not needed during the last frame. Takes effect on each thread's next allocation, or
+        /// right away for pages of exited threads.
+        void GarbageCollect() override;
+
+        /// Bytes handed out since the last ResetFrame
+        size_type NumAllocatedBytes() const override;
+        /// Bytes held in pages by all threads, including pages that are not in use this frame
+        size_type NumReservedBytes() const;
+
+        /// Starts a new frame, invalidating every allocation made so far. This only advances a counter; each thread
+        /// rewinds its pages lazily on its next allocation, so it is safe to call while other threads are idle.
+        void ResetFrame();
+        AZ::u64 GetFrameIndex() const;
+
+    protected:
+        FrameArenaSchema(const FrameArenaSchema&) = delete;
+        FrameArenaSchema& operator=(const FrameArenaSchema&) = delete;
+
+        GetThreadData m_threadDataGetter;
+        SetThreadData m_threadDataSetter;
+        class FrameArenaSchemaImpl* m_impl;
+    };
+
+    /**
+     * Helper class to allow multiple frame arenas that operate independently from each other, as every arena needs
+     * its own thread local storage.
+     */
+    template<class Allocator>
+    class FrameArenaSchemaHelper
+        : public FrameArenaSchema
+    {
+    public:
+        FrameArenaSchemaHelper()
+            : FrameArenaSchema(&GetThreadData, &SetThreadData)
+        {
+        }
+
+    protected:
+        static FrameArenaThreadData* GetThreadData()
+        {
+            return m_threadData.m_data;
+        }
+
+        static void SetThreadData(FrameArenaThreadData* data)
+        {
+            m_threadData.m_data = data;
+        }
+
+        // thread_local instead of AZ_THREAD_LOCAL as the holder needs to run its destructor when the thread exits
+        static thread_local ThreadDataHolder m_threadData;
+    };
+
+    template<class Allocator>
+    thread_local FrameArenaSchema::ThreadDataHolder FrameArenaSchemaHelper<Allocator>::m_threadData;
+
+    /*!
+     * Template you can use to create your own frame arenas, as you can't inherit from FrameArenaAllocator.
+     * Allocations are not tracked individually, since they are never freed individually; the allocator still
+     * registers with the AllocatorManager so its usage shows up in the memory tools.
+     */
+    template<class Allocator>
+    class FrameArenaAllocatorBase
+        : public AllocatorBase
+    {
+    public:
+        AZ_RTTI((FrameArenaAllocatorBase, "{5B7D3E1A-9C64-4F2B-A8D0-3E6C1F9B7A42}", Allocator), AllocatorBase);
+
+        explicit FrameArenaAllocatorBase(size_type pageSize = FrameArenaSchema::DefaultPageSize)
+            : AllocatorBase(false)
+        {
+            m_schema.Create(pageSize);
+            PostCreate();
+        }
+
+        ~FrameArenaAllocatorBase() override
+        {
+            PreDestroy();
+        }
+
+        AllocatorDebugConfig GetDebugConfig() override
+        {
+            return AllocatorDebugConfig().ExcludeFromDebugging();
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocateAddress allocate(size_type byteSize, size_type alignment) override
+        {
+            AllocateAddress address = m_schema.allocate(byteSize, alignment);
+            if (address == nullptr)
+            {
+                OnOutOfMemory(byteSize, alignment);
+            }
+            return address;
+        }
+
+        size_type deallocate(pointer ptr, size_type byteSize = 0, size_type alignment = 0) override
+        {
+            return m_schema.deallocate(ptr, byteSize, alignment);
+        }
+
+        AllocateAddress reallocate(pointer ptr, size_type newSize, size_type newAlignment = 1) override
+        {
+            return m_schema.reallocate(ptr, newSize, newAlignment);
+        }
+
+        size_type get_allocated_size(pointer ptr, align_type alignment = 1) const override
+        {
+            return m_schema.get_allocated_size(ptr, alignment);
+        }
+
+        void GarbageCollect() override
+        {
+            m_schema.GarbageCollect();
+        }
+
+        size_type NumAllocatedBytes() const override
+        {
+            return m_schema.NumAllocatedBytes();
+        }
+        //////////////////////////////////////////////////////////////////////////
+
+        size_type NumReservedBytes() const
+        {
+            return m_schema.NumReservedBytes();
+        }
+
+        //! Reclaims everything allocated from the arena. Must be called at a point where no allocation from the
+        //! previous frame is still referenced.
+        void ResetFrame()
+        {
+            m_schema.ResetFrame();
+        }
+
+        AZ::u64 GetFrameIndex() const
+        {
+            return m_schema.GetFrameIndex();
+        }
+
+    private:
+        FrameArenaSchemaHelper<Allocator> m_schema;
+    };
+
+    /*!
+     * Engine wide frame arena, reset by the ComponentApplication at the start of every tick. Use it for per-frame
+     * scratch containers:
+     *
+     *     AZStd::vector<AZ::EntityId, AZ::AZStdAlloc<AZ::FrameArenaAllocator>> visibleEntities;
+     *
+     * Anything allocated from it must not be kept past the end of the tick.
+     */
+    class FrameArenaAllocator final
+        : public FrameArenaAllocatorBase<FrameArenaAllocator>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameArenaAllocator, SystemAllocator);
+
+        using Base = FrameArenaAllocatorBase<FrameArenaAllocator>;
+
+        AZ_RTTI(FrameArenaAllocator, "{C4A2F6E8-1B3D-4E7A-9F05-7D8B2A6C3E91}", Base);
+    };
+} // namespace AZ
@@ -12,8 +12,10 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/containers/intrusive_set.h>
 
@@ -64,8 +66,57 @@ namespace AZ
 // Enabled mutex per bucket
 #define USE_MUTEX_PER_BUCKET
 
+#ifdef MULTITHREADED
+// Enable per-thread caches of small blocks in front of the buckets
+#   define USE_THREAD_CACHE
+#endif
+
     //////////////////////////////////////////////////////////////////////////
 
+#if defined(USE_THREAD_CACHE)
+    namespace HphaInternal
+    {
+        // Common part of the thread caches of all the heap allocator instances, so they can share the thread local slots
+        struct ThreadCacheBase
+        {
+            AZStd::atomic<void*> m_owner{ nullptr }; ///< Allocator the cache belongs to, null once that allocator is destroyed
+            void (*m_release)(ThreadCacheBase*) = nullptr; ///< Returns the cached blocks to the owner and frees the cache
+        };
+
+        // A thread holds caches for a few allocator instances at once, further instances are used without a cache
+        static constexpr size_t MaxThreadCachesPerThread = 4;
+
+        // Trivially destructible, so it stays valid while the other thread locals are destroyed at thread exit
+        struct ThreadCacheSlots
+        {
+            ThreadCacheBase* m_caches[MaxThreadCachesPerThread];
+            bool m_threadExiting;
+        };
+        static thread_local ThreadCacheSlots t_threadCaches;
+
+        // Returns the caches of an exiting thread to their allocators
+        struct ThreadCacheReaper
+        {
+            ~ThreadCacheReaper()
+            {
+                // Allocations made by the remaining thread local destructors bypass the cache
+                t_threadCaches.m_threadExiting = true;
+                for (ThreadCacheBase*& cache : t_threadCaches.m_caches)
+                {
+                    if (cache)
+                    {
+                        cache->m_release(cache);
+                        cache = nullptr;
+                    }
+                }
+            }
+
+            bool m_armed = false;
+        };
+        static thread_local ThreadCacheReaper t_threadCacheReaper;
+    } // namespace HphaInternal
+#endif // USE_THREAD_CACHE
+
     template<bool DebugAllocatorEnable>
     class HphaSchemaBase<DebugAllocatorEnable>::HpAllocator
         : public IAllocator
@@ -337,6 +388,66 @@ namespace AZ
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+#if defined(USE_THREAD_CACHE)
+        // Per-thread front end of the buckets. Small blocks are allocated from and freed to a thread local free list
+        // per bucket without taking the bucket lock, and move between the thread cache and the bucket in batches.
+        // Blocks held by a thread cache are not counted as allocated. The debug allocator doesn't use thread caches
+        // so that its records stay exact.
+        static constexpr bool THREAD_CACHE_ENABLED = !DebugAllocatorEnable;
+        static constexpr size_t THREAD_CACHE_BIN_BYTES = 2 * 1024;
+        static constexpr unsigned THREAD_CACHE_MIN_BLOCKS = 4;
+        static constexpr unsigned THREAD_CACHE_MAX_BLOCKS = 128;
+
+        // maximum number of blocks a thread keeps for a bucket, half of it is moved at once
+        static inline unsigned thread_cache_capacity(unsigned bi)
+        {
+            const size_t blocks = THREAD_CACHE_BIN_BYTES / bucket_spacing_function_inverse(bi);
+            return (unsigned)AZStd::clamp<size_t>(blocks, THREAD_CACHE_MIN_BLOCKS, THREAD_CACHE_MAX_BLOCKS);
+        }
+
+        struct thread_cache : public HphaInternal::ThreadCacheBase
+        {
+            struct bin
+            {
+                free_link* mHead = nullptr;
+                unsigned mCount = 0;
+            };
+            bin mBins[NUM_BUCKETS];
+            thread_cache* mNext = nullptr;
+            size_t mFlushGeneration = 0;
+            AZStd::thread_id mThreadId;
+
+            // Only written by the owning thread, read by the stats queries
+            AZStd::atomic<size_t> mCachedBytes{ 0 };
+            AZStd::atomic<size_t> mHits{ 0 };
+            AZStd::atomic<size_t> mMisses{ 0 };
+            AZStd::atomic<size_t> mFlushes{ 0 };
+
+            static void add(AZStd::atomic<size_t>& counter, size_t value)
+            {
+                counter.store(counter.load(AZStd::memory_order_relaxed) + value, AZStd::memory_order_relaxed);
+            }
+        };
+
+        thread_cache* find_thread_cache();
+        thread_cache* get_thread_cache();
+        AllocateAddress cache_alloc(thread_cache& cache, unsigned bi);
+        size_type cache_free(thread_cache& cache, page* p, void* ptr);
+        bool cache_refill(thread_cache& cache, unsigned bi);
+        void cache_flush(thread_cache& cache, unsigned bi, unsigned count);
+        void cache_flush_all(thread_cache& cache);
+        void thread_cache_detach_all();
+        static void thread_cache_release(HphaInternal::ThreadCacheBase* cache);
+        void get_thread_cache_stats(HphaThreadCacheStats& stats) const;
+
+        thread_cache* mThreadCaches = nullptr; ///< All the live caches of this allocator
+        mutable AZStd::mutex mThreadCacheMutex; ///< Protects mThreadCaches and the retired counters
+        AZStd::atomic<size_t> mThreadCacheFlushGeneration{ 0 }; ///< Bumped by purge to make every thread flush its cache
+        size_t mRetiredHits = 0;
+        size_t mRetiredMisses = 0;
+        size_t mRetiredFlushes = 0;
+#endif // USE_THREAD_CACHE
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -929,6 +1040,15 @@ namespace AZ
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+#if defined(USE_THREAD_CACHE)
+            // Blocks held by thread caches keep their pages alive. The calling thread returns its blocks right away,
+            // the other threads on their next allocation or free.
+            if (thread_cache* cache = find_thread_cache())
+            {
+                cache_flush_all(*cache);
+            }
+            mThreadCacheFlushGeneration.fetch_add(1, AZStd::memory_order_relaxed);
+#endif
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -1047,6 +1167,10 @@ namespace AZ
     template<bool DebugAllocatorEnable>
     HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::~HpAllocator()
     {
+#if defined(USE_THREAD_CACHE)
+        thread_cache_detach_all();
+#endif
+
         if constexpr (DebugAllocatorEnable)
         {
             // Check if there are not-freed allocations
@@ -1204,6 +1328,12 @@ namespace AZ
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(USE_THREAD_CACHE)
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return cache_alloc(*cache, bi);
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1233,6 +1363,12 @@ namespace AZ
     AllocateAddress HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(USE_THREAD_CACHE)
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return cache_alloc(*cache, bi);
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1303,6 +1439,12 @@ namespace AZ
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(USE_THREAD_CACHE)
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return cache_free(*cache, p, ptr);
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1325,6 +1467,12 @@ namespace AZ
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+#if defined(USE_THREAD_CACHE)
+        if (thread_cache* cache = get_thread_cache())
+        {
+            return cache_free(*cache, p, ptr);
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1448,6 +1596,296 @@ namespace AZ
         }
     }
 
+#if defined(USE_THREAD_CACHE)
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::find_thread_cache() -> thread_cache*
+    {
+        if constexpr (!THREAD_CACHE_ENABLED)
+        {
+            return nullptr;
+        }
+        else
+        {
+            for (HphaInternal::ThreadCacheBase* base : HphaInternal::t_threadCaches.m_caches)
+            {
+                if (base && base->m_owner.load(AZStd::memory_order_relaxed) == this)
+                {
+                    thread_cache* cache = static_cast<thread_cache*>(base);
+                    const size_t flushGeneration = mThreadCacheFlushGeneration.load(AZStd::memory_order_relaxed);
+                    if (cache->mFlushGeneration != flushGeneration)
+                    {
+                        cache->mFlushGeneration = flushGeneration;
+                        cache_flush_all(*cache);
+                    }
+                    return cache;
+                }
+            }
+            return nullptr;
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::get_thread_cache() -> thread_cache*
+    {
+        if constexpr (!THREAD_CACHE_ENABLED)
+        {
+            return nullptr;
+        }
+        else
+        {
+            if (thread_cache* cache = find_thread_cache())
+            {
+                return cache;
+            }
+
+            HphaInternal::ThreadCacheSlots& slots = HphaInternal::t_threadCaches;
+            if (slots.m_threadExiting)
+            {
+                return nullptr;
+            }
+
+            HphaInternal::ThreadCacheBase** freeSlot = nullptr;
+            for (HphaInternal::ThreadCacheBase*& slot : slots.m_caches)
+            {
+                // Caches whose allocator was destroyed are released here, or when the thread exits
+                if (slot && slot->m_owner.load(AZStd::memory_order_acquire) == nullptr)
+                {
+                    slot->m_release(slot);
+                    slot = nullptr;
+                }
+                if (!slot && !freeSlot)
+                {
+                    freeSlot = &slot;
+                }
+            }
+            if (!freeSlot)
+            {
+                return nullptr;
+            }
+
+            void* memory = AZ_OS_MALLOC(sizeof(thread_cache), alignof(thread_cache));
+            if (!memory)
+            {
+                return nullptr;
+            }
+            thread_cache* cache = new (memory) thread_cache();
+            cache->m_owner.store(this, AZStd::memory_order_relaxed);
+            cache->m_release = &thread_cache_release;
+            cache->mThreadId = AZStd::this_thread::get_id();
+            cache->mFlushGeneration = mThreadCacheFlushGeneration.load(AZStd::memory_order_relaxed);
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+                cache->mNext = mThreadCaches;
+                mThreadCaches = cache;
+            }
+            *freeSlot = cache;
+
+            // Make sure the cache is returned when the thread exits
+            HphaInternal::t_threadCacheReaper.m_armed = true;
+            return cache;
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    AllocateAddress HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::cache_alloc(thread_cache& cache, unsigned bi)
+    {
+        typename thread_cache::bin& bin = cache.mBins[bi];
+        if (bin.mHead)
+        {
+            thread_cache::add(cache.mHits, 1);
+        }
+        else
+        {
+            thread_cache::add(cache.mMisses, 1);
+            if (!cache_refill(cache, bi))
+            {
+                return AllocateAddress{};
+            }
+        }
+
+        free_link* block = bin.mHead;
+        bin.mHead = block->mNext;
+        --bin.mCount;
+
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        cache.mCachedBytes.store(cache.mCachedBytes.load(AZStd::memory_order_relaxed) - elemSize, AZStd::memory_order_relaxed);
+        mTotalAllocatedSizeBuckets += elemSize;
+        return AllocateAddress(block, elemSize);
+    }
+
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::cache_free(thread_cache& cache, page* p, void* ptr) -> size_type
+    {
+        const unsigned bi = p->bucket_index();
+        const size_type allocatedByteCount = p->elem_size();
+        mTotalAllocatedSizeBuckets -= allocatedByteCount;
+
+        typename thread_cache::bin& bin = cache.mBins[bi];
+        free_link* block = (free_link*)ptr;
+        block->mNext = bin.mHead;
+        bin.mHead = block;
+        ++bin.mCount;
+        thread_cache::add(cache.mCachedBytes, allocatedByteCount);
+
+        // keep half of the capacity around so that alternating alloc/free doesn't go back to the bucket every time
+        const unsigned capacity = thread_cache_capacity(bi);
+        if (bin.mCount > capacity)
+        {
+            cache_flush(cache, bi, bin.mCount - capacity / 2);
+        }
+        return allocatedByteCount;
+    }
+
+    template<bool DebugAllocatorEnable>
+    bool HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::cache_refill(thread_cache& cache, unsigned bi)
+    {
+        const unsigned batchSize = thread_cache_capacity(bi) / 2;
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        typename thread_cache::bin& bin = cache.mBins[bi];
+        unsigned count = 0;
+        {
+#if defined(USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+            for (; count < batchSize; ++count)
+            {
+                page* p = mBuckets[bi].get_free_page();
+                if (!p)
+                {
+                    p = bucket_grow(elemSize, mBuckets[bi].marker());
+                    if (!p)
+                    {
+                        break;
+                    }
+                    mBuckets[bi].add_free_page(p);
+                }
+                free_link* block = (free_link*)mBuckets[bi].alloc(p);
+                block->mNext = bin.mHead;
+                bin.mHead = block;
+            }
+        }
+        bin.mCount += count;
+        thread_cache::add(cache.mCachedBytes, count * elemSize);
+        return count > 0;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::cache_flush(thread_cache& cache, unsigned bi, unsigned count)
+    {
+        typename thread_cache::bin& bin = cache.mBins[bi];
+        HPPA_ASSERT(count <= bin.mCount);
+        {
+#if defined(USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+            for (unsigned i = 0; i < count; ++i)
+            {
+                free_link* block = bin.mHead;
+                bin.mHead = block->mNext;
+                mBuckets[bi].free(ptr_get_page(block), block);
+            }
+        }
+        bin.mCount -= count;
+        cache.mCachedBytes.store(
+            cache.mCachedBytes.load(AZStd::memory_order_relaxed) - count * bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+        thread_cache::add(cache.mFlushes, 1);
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::cache_flush_all(thread_cache& cache)
+    {
+        for (unsigned bi = 0; bi < NUM_BUCKETS; ++bi)
+        {
+            if (cache.mBins[bi].mCount)
+            {
+                cache_flush(cache, bi, cache.mBins[bi].mCount);
+            }
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_detach_all()
+    {
+        // IMPORTANT: We rely on all the other threads having stopped using the allocator, so their caches can be
+        // flushed from here. Their memory is released by the owning thread, once it exits or creates a new cache.
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        const AZStd::thread_id currentThread = AZStd::this_thread::get_id();
+        while (thread_cache* cache = mThreadCaches)
+        {
+            mThreadCaches = cache->mNext;
+            cache_flush_all(*cache);
+            cache->m_owner.store(nullptr, AZStd::memory_order_release);
+            if (cache->mThreadId == currentThread)
+            {
+                for (HphaInternal::ThreadCacheBase*& slot : HphaInternal::t_threadCaches.m_caches)
+                {
+                    if (slot == cache)
+                    {
+                        slot = nullptr;
+                    }
+                }
+                cache->~thread_cache();
+                AZ_OS_FREE(cache);
+            }
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_release(HphaInternal::ThreadCacheBase* base)
+    {
+        thread_cache* cache = static_cast<thread_cache*>(base);
+        if (HpAllocator* owner = static_cast<HpAllocator*>(cache->m_owner.load(AZStd::memory_order_acquire)))
+        {
+            owner->cache_flush_all(*cache);
+
+            AZStd::lock_guard<AZStd::mutex> lock(owner->mThreadCacheMutex);
+            for (thread_cache** link = &owner->mThreadCaches; *link; link = &(*link)->mNext)
+            {
+                if (*link == cache)
+                {
+                    *link = cache->mNext;
+                    break;
+                }
+            }
+            owner->mRetiredHits += cache->mHits.load(AZStd::memory_order_relaxed);
+            owner->mRetiredMisses += cache->mMisses.load(AZStd::memory_order_relaxed);
+            owner->mRetiredFlushes += cache->mFlushes.load(AZStd::memory_order_relaxed);
+        }
+        cache->~thread_cache();
+        AZ_OS_FREE(cache);
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::get_thread_cache_stats(HphaThreadCacheStats& stats) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        stats.m_hits = mRetiredHits;
+        stats.m_misses = mRetiredMisses;
+        stats.m_flushes = mRetiredFlushes;
+        for (const thread_cache* cache = mThreadCaches; cache; cache = cache->mNext)
+        {
+            HphaThreadCacheStats::ThreadStats threadStats;
+            threadStats.m_threadId = cache->mThreadId;
+            threadStats.m_cachedBytes = cache->mCachedBytes.load(AZStd::memory_order_relaxed);
+            threadStats.m_hits = cache->mHits.load(AZStd::memory_order_relaxed);
+            threadStats.m_misses = cache->mMisses.load(AZStd::memory_order_relaxed);
+
+            stats.m_cachedBytes += threadStats.m_cachedBytes;
+            stats.m_hits += threadStats.m_hits;
+            stats.m_misses += threadStats.m_misses;
+            stats.m_flushes += cache->mFlushes.load(AZStd::memory_order_relaxed);
+            if (stats.m_threads.size() < stats.m_threads.capacity())
+            {
+                stats.m_threads.push_back(threadStats);
+            }
+        }
+    }
+#endif // USE_THREAD_CACHE
+
     template<bool DebugAllocatorEnable>
     void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::split_block(block_header* bl, size_t size)
     {
@@ -2616,6 +3054,15 @@ namespace AZ
         return sizeof(typename HphaSchemaBase<DebugAllocator>::HpAllocator::free_link);
     }
 
+    template<bool DebugAllocator>
+    void HphaSchemaBase<DebugAllocator>::GetThreadCacheStats(HphaThreadCacheStats& stats) const
+    {
+        stats = {};
+#if defined(USE_THREAD_CACHE)
+        m_allocator->get_thread_cache_stats(stats);
+#endif
+    }
+
     // explicitly instantiate both the non-debug and debug schema classes
     template class HphaSchemaBase<false>;
     template class HphaSchemaBase<true>;
@@ -9,10 +9,39 @@
 #pragma once
 
 #include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/config.h>
 #include <AzCore/std/typetraits/aligned_storage.h>
 
 namespace AZ
 {
+    /**
+    * Statistics of the per-thread small block caches that sit in front of the heap allocator buckets.
+    */
+    struct HphaThreadCacheStats
+    {
+        struct ThreadStats
+        {
+            AZStd::thread_id m_threadId;
+            size_t m_cachedBytes = 0; ///< Free small blocks currently held by the thread
+            size_t m_hits = 0; ///< Small allocations served from the thread cache
+            size_t m_misses = 0; ///< Small allocations that had to refill the thread cache from the buckets
+        };
+
+        //! Hit rate of the small allocations, in [0, 1]
+        float GetHitRate() const
+        {
+            const size_t total = m_hits + m_misses;
+            return total ? static_cast<float>(m_hits) / static_cast<float>(total) : 0.0f;
+        }
+
+        size_t m_cachedBytes = 0;
+        size_t m_hits = 0; ///< Including threads that have exited
+        size_t m_misses = 0; ///< Including threads that have exited
+        size_t m_flushes = 0; ///< Number of batches returned from thread caches to the buckets
+        AZStd::fixed_vector<ThreadStats, 64> m_threads; ///< Live thread caches, the first 64 are reported
+    };
+
     /**
     * Heap allocator schema, based on Dimitar Lazarov "High Performance Heap Allocator".
     */
@@ -43,6 +72,9 @@ namespace AZ
         static size_t GetMemoryGuardSize();
         static size_t GetFreeLinkSize();
 
+        /// Gather the thread cache statistics. Thread caches are not used by the debug allocator.
+        void GetThreadCacheStats(HphaThreadCacheStats& stats) const;
+
     private:
         // Forward declare HpAllocator class
         // It is a private class implemented in the cpp
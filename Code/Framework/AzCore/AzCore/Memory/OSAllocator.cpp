@@ -73,6 +73,7 @@ namespace AZ
         // for cases where alignment != 1 and the OS could not find a block specifically for that alignment (the OS will give use a
         // block that is byteSize + (alignment - 1) and place the ptr in the first address that satisfies the alignment).
         size_type allocatedSize = get_allocated_size(address, 1);
+        SampleAllocation(address, byteSize, 1);
 #if defined(AZ_ENABLE_TRACING)
         m_numAllocatedBytes += allocatedSize;
         AZ_PROFILE_MEMORY_ALLOC_EX(MemoryReserved, fileName, lineNum, address, byteSize, name);
@@ -90,6 +91,7 @@ namespace AZ
         -> size_type
     {
         size_type allocatedSize = get_allocated_size(ptr, 1);
+        SampleDeallocation(ptr);
 #if defined(AZ_ENABLE_TRACING)
         if (ptr)
         {
@@ -111,6 +113,7 @@ namespace AZ
         pointer newPtr = AZ_OS_REALLOC(ptr, newSize, static_cast<AZStd::size_t>(alignment));
 
         const size_type allocatedSize = get_allocated_size(newPtr, 1);
+        SampleReallocation(ptr, newPtr, allocatedSize);
 #if defined(AZ_ENABLE_TRACING)
         m_numAllocatedBytes += (allocatedSize - previouslyAllocatedSize);
         AZ_PROFILE_MEMORY_ALLOC_EX(MemoryReserved, fileName, lineNum, address, byteSize, name);
@@ -86,6 +86,7 @@ namespace AZ
 
             if constexpr (ProfileAllocations)
             {
+                SampleAllocation(ptr, byteSize, 1);
                 AZ_MEMORY_PROFILE(ProfileAllocation(ptr, byteSize, alignment, 1));
             }
 
@@ -107,6 +108,7 @@ namespace AZ
             if constexpr (ProfileAllocations)
             {
                 AZ_PROFILE_MEMORY_FREE(MemoryReserved, ptr);
+                SampleDeallocation(ptr);
                 AZ_MEMORY_PROFILE(ProfileDeallocation(ptr, byteSize, alignment, nullptr));
             }
 
@@ -131,6 +133,7 @@ namespace AZ
             if constexpr (ProfileAllocations)
             {
                 AZ_PROFILE_MEMORY_ALLOC(MemoryReserved, newPtr, newSize, GetName());
+                SampleReallocation(ptr, newPtr, newSize);
                 AZ_MEMORY_PROFILE(ProfileReallocation(ptr, newPtr, newSize, newAlignment));
             }
 
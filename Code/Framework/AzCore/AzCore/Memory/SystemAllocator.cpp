@@ -99,6 +99,7 @@ namespace AZ
             alignment);
 
         AZ_PROFILE_MEMORY_ALLOC_EX(MemoryReserved, fileName, lineNum, address, byteSize, name);
+        SampleAllocation(address, byteSize, 1);
         AZ_MEMORY_PROFILE(ProfileAllocation(address, byteSize, alignment, 1));
 
         return address;
@@ -112,6 +113,7 @@ namespace AZ
     {
         byteSize = MemorySizeAdjustedUp(byteSize);
         AZ_PROFILE_MEMORY_FREE(MemoryReserved, ptr);
+        SampleDeallocation(ptr);
         AZ_MEMORY_PROFILE(ProfileDeallocation(ptr, byteSize, alignment, nullptr));
         return m_subAllocator->deallocate(ptr, byteSize, alignment);
     }
@@ -127,6 +129,7 @@ namespace AZ
         AZ_PROFILE_MEMORY_FREE(MemoryReserved, ptr);
 
         AllocateAddress newAddress = m_subAllocator->reallocate(ptr, newSize, newAlignment);
+        SampleReallocation(ptr, newAddress, newAddress.GetAllocatedBytes());
 
 #if defined(AZ_ENABLE_TRACING)
         [[maybe_unused]] const size_type allocatedSize = get_allocated_size(newAddress, 1);
@@ -147,4 +150,9 @@ namespace AZ
         return allocSize;
     }
 
+    void SystemAllocator::GetThreadCacheStats(HphaThreadCacheStats& stats) const
+    {
+        static_cast<const HphaSchema*>(m_subAllocator.get())->GetThreadCacheStats(stats);
+    }
+
 } // namespace AZ
@@ -14,6 +14,7 @@
 namespace AZ
 {
     class HphaSchema;
+    struct HphaThreadCacheStats;
 
     /**
      * System allocator
@@ -53,6 +54,9 @@ namespace AZ
 
         //////////////////////////////////////////////////////////////////////////
 
+        //! Hit rate and bytes held by the per-thread small block caches of the underlying HPHA schema
+        void GetThreadCacheStats(HphaThreadCacheStats& stats) const;
+
     protected:
         SystemAllocator(const SystemAllocator&);
         SystemAllocator& operator=(const SystemAllocator&);
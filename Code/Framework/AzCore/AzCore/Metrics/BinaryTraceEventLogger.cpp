@@ -0,0 +1,1240 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Metrics/BinaryTraceEventLogger.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace AZ::Metrics
+{
+    // The stream starts with the signature, the version and the id of the process, followed by blocks of records.
+    // Each block holds the records written by one thread since the previous block of the thread:
+    //   u64 thread id, u32 size in bytes, records
+    // A record is either the definition of an interned string:
+    //   u8 RecordStringDefinition, varint string id, varint size, characters
+    // or an event:
+    //   u8 RecordEvent, u8 phase, zigzag varint timestamp, string name, string category,
+    //   u8 has id, [string id], value args, varint extra field count, (string key, value extra field)...
+    // A string is a varint, either the id of an interned string shifted left by one, or the size of an inline string
+    // shifted left by one with the low bit set, followed by its characters.
+    // Integers are stored in little endian order.
+    namespace BinaryTraceEvent
+    {
+        enum RecordType : AZ::u8
+        {
+            RecordStringDefinition = 1,
+            RecordEvent = 2,
+        };
+
+        enum ValueType : AZ::u8
+        {
+            ValueString,
+            ValueFalse,
+            ValueTrue,
+            ValueInt64,
+            ValueUint64,
+            ValueDouble,
+            ValueArray,
+            ValueObject,
+        };
+
+        constexpr size_t BlockHeaderSize = sizeof(AZ::u64) + sizeof(AZ::u32);
+        // A nested array or object deeper than this is considered malformed by the converter
+        constexpr size_t MaxValueDepth = 64;
+
+        AZ::u64 ZigZagEncode(AZ::s64 value)
+        {
+            return (static_cast<AZ::u64>(value) << 1) ^ static_cast<AZ::u64>(value >> 63);
+        }
+
+        AZ::s64 ZigZagDecode(AZ::u64 value)
+        {
+            return static_cast<AZ::s64>(value >> 1) ^ -static_cast<AZ::s64>(value & 1);
+        }
+
+        void AppendFixed(AZStd::vector<AZ::u8>& buffer, AZ::u64 value, size_t byteCount)
+        {
+            for (size_t byteIndex = 0; byteIndex < byteCount; ++byteIndex)
+            {
+                buffer.push_back(static_cast<AZ::u8>(value >> (byteIndex * 8)));
+            }
+        }
+
+        void AppendVarint(AZStd::vector<AZ::u8>& buffer, AZ::u64 value)
+        {
+            while (value >= 0x80)
+            {
+                buffer.push_back(static_cast<AZ::u8>(value | 0x80));
+                value >>= 7;
+            }
+            buffer.push_back(static_cast<AZ::u8>(value));
+        }
+
+        // Reads the records of a block, every read fails once the end of the block is reached
+        struct Reader
+        {
+            bool ReadByte(AZ::u8& value)
+            {
+                if (m_position >= m_data.size())
+                {
+                    return false;
+                }
+                value = m_data[m_position++];
+                return true;
+            }
+
+            bool ReadVarint(AZ::u64& value)
+            {
+                value = 0;
+                for (AZ::u32 shift = 0; shift < 64; shift += 7)
+                {
+                    AZ::u8 byte;
+                    if (!ReadByte(byte))
+                    {
+                        return false;
+                    }
+                    value |= static_cast<AZ::u64>(byte & 0x7f) << shift;
+                    if ((byte & 0x80) == 0)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool ReadFixed(AZ::u64& value, size_t byteCount)
+            {
+                value = 0;
+                for (size_t byteIndex = 0; byteIndex < byteCount; ++byteIndex)
+                {
+                    AZ::u8 byte;
+                    if (!ReadByte(byte))
+                    {
+                        return false;
+                    }
+                    value |= static_cast<AZ::u64>(byte) << (byteIndex * 8);
+                }
+                return true;
+            }
+
+            bool ReadCharacters(AZStd::string_view& value, AZ::u64 size)
+            {
+                if (size > m_data.size() - m_position)
+                {
+                    return false;
+                }
+                value = AZStd::string_view(reinterpret_cast<const char*>(m_data.data() + m_position), static_cast<size_t>(size));
+                m_position += static_cast<size_t>(size);
+                return true;
+            }
+
+            AZStd::span<const AZ::u8> m_data;
+            size_t m_position{};
+        };
+    } // namespace BinaryTraceEvent
+
+    // Recording state of one thread.
+    // The ring buffer is written by the recording thread and read by the flush thread, which only
+    // synchronize through the atomic write and read positions. The positions only ever increase,
+    // and are wrapped to the ring buffer size when accessing the buffer.
+    struct BinaryTraceEventLogger::ThreadBuffer
+    {
+        ThreadBuffer(AZ::u64 threadId, size_t ringSize)
+            : m_threadId(threadId)
+            , m_ring(ringSize)
+        {
+        }
+
+        AZ::u64 m_threadId;
+        AZStd::vector<AZ::u8> m_ring;
+        AZStd::atomic<size_t> m_writePosition{ 0 };
+        AZStd::atomic<size_t> m_readPosition{ 0 };
+
+        // Only accessed by the recording thread
+        // The event record is encoded separately, so the string definitions it needs can be written before it
+        AZStd::vector<AZ::u8> m_encodedEvent;
+        AZStd::vector<AZ::u8> m_eventRecord;
+        // Looked up with the string_view of the recorded strings, without copying them
+        AZStd::unordered_map<AZStd::string, AZ::u64, AZStd::hash<AZStd::string>, AZStd::equal_to<>> m_internedStrings;
+        // The strings newly interned by the event being encoded, which are forgotten if the event is dropped
+        AZStd::vector<AZStd::string_view> m_pendingStrings;
+        AZ::u64 m_streamGeneration{ 0 };
+    };
+
+    namespace
+    {
+        // Caches the buffer the calling thread uses with the last logger it recorded an event with
+        struct ThreadBufferCache
+        {
+            AZ::u64 m_loggerId{};
+            BinaryTraceEventLogger::ThreadBuffer* m_threadBuffer{};
+        };
+        thread_local ThreadBufferCache t_threadBufferCache;
+
+        AZStd::atomic<AZ::u64> s_nextLoggerId{ 1 };
+
+        // Positions in the ring buffers are wrapped with a mask
+        size_t GetRingBufferSize(size_t requestedSize)
+        {
+            size_t ringSize = 1024;
+            while (ringSize < requestedSize)
+            {
+                ringSize <<= 1;
+            }
+            return ringSize;
+        }
+
+        AZ::u64 GetNumericThreadId(AZStd::thread_id threadId)
+        {
+            // Since only little_endian platforms are supported reinterprets the thread id as a uintptr_t type
+            uintptr_t numericThreadId{};
+            *reinterpret_cast<AZStd::thread_id*>(&numericThreadId) = threadId;
+            return numericThreadId;
+        }
+
+        class EventEncoder
+        {
+        public:
+            EventEncoder(BinaryTraceEventLogger::ThreadBuffer& threadBuffer, AZStd::atomic<AZ::u64>& nextStringId,
+                size_t maxInternedStrings)
+                : m_threadBuffer(threadBuffer)
+                , m_eventRecord(threadBuffer.m_eventRecord)
+                , m_nextStringId(nextStringId)
+                , m_maxInternedStrings(maxInternedStrings)
+            {
+            }
+
+            void EncodeEvent(const EventDesc& eventDesc)
+            {
+                using namespace BinaryTraceEvent;
+
+                m_eventRecord.clear();
+                m_eventRecord.push_back(RecordEvent);
+                m_eventRecord.push_back(static_cast<AZ::u8>(eventDesc.GetEventPhase()));
+                AppendVarint(m_eventRecord, ZigZagEncode(eventDesc.GetTimestamp().count()));
+                AppendString(eventDesc.GetName());
+                AppendString(eventDesc.GetCategory());
+                const AZStd::optional<AZStd::string_view> eventId = eventDesc.GetId();
+                m_eventRecord.push_back(eventId.has_value() ? 1 : 0);
+                if (eventId.has_value())
+                {
+                    AppendString(*eventId);
+                }
+                AppendValue(EventValue{ AZStd::in_place_type<EventObject>, eventDesc.GetArgs() });
+
+                const AZStd::span<EventField> extraParams = eventDesc.GetExtraParams();
+                AppendVarint(m_eventRecord, extraParams.size());
+                for (const EventField& extraField : extraParams)
+                {
+                    AppendString(extraField.m_name);
+                    AppendValue(extraField.m_value);
+                }
+
+                m_threadBuffer.m_encodedEvent.insert(m_threadBuffer.m_encodedEvent.end(), m_eventRecord.begin(), m_eventRecord.end());
+            }
+
+        private:
+            void AppendString(AZStd::string_view value)
+            {
+                using namespace BinaryTraceEvent;
+
+                auto& internedStrings = m_threadBuffer.m_internedStrings;
+                if (auto internedIt = internedStrings.find(value); internedIt != internedStrings.end())
+                {
+                    AppendVarint(m_eventRecord, internedIt->second << 1);
+                    return;
+                }
+
+                if (internedStrings.size() >= m_maxInternedStrings)
+                {
+                    AppendVarint(m_eventRecord, (static_cast<AZ::u64>(value.size()) << 1) | 1);
+                    m_eventRecord.insert(m_eventRecord.end(), value.begin(), value.end());
+                    return;
+                }
+
+                const AZ::u64 stringId = m_nextStringId.fetch_add(1, AZStd::memory_order_relaxed);
+                internedStrings.emplace(value, stringId);
+                m_threadBuffer.m_pendingStrings.push_back(value);
+
+                AZStd::vector<AZ::u8>& definition = m_threadBuffer.m_encodedEvent;
+                definition.push_back(RecordStringDefinition);
+                AppendVarint(definition, stringId);
+                AppendVarint(definition, value.size());
+                definition.insert(definition.end(), value.begin(), value.end());
+
+                AppendVarint(m_eventRecord, stringId << 1);
+            }
+
+            void AppendValue(const EventValue& value)
+            {
+                using namespace BinaryTraceEvent;
+
+                AZStd::visit(
+                    [this](auto&& fieldValue)
+                    {
+                        using FieldType = AZStd::remove_cvref_t<decltype(fieldValue)>;
+                        if constexpr (AZStd::same_as<FieldType, AZStd::string_view>)
+                        {
+                            m_eventRecord.push_back(ValueString);
+                            AppendString(fieldValue);
+                        }
+                        else if constexpr (AZStd::same_as<FieldType, bool>)
+                        {
+                            m_eventRecord.push_back(fieldValue ? ValueTrue : ValueFalse);
+                        }
+                        else if constexpr (AZStd::same_as<FieldType, AZ::s64>)
+                        {
+                            m_eventRecord.push_back(ValueInt64);
+                            AppendVarint(m_eventRecord, ZigZagEncode(fieldValue));
+                        }
+                        else if constexpr (AZStd::same_as<FieldType, AZ::u64>)
+                        {
+                            m_eventRecord.push_back(ValueUint64);
+                            AppendVarint(m_eventRecord, fieldValue);
+                        }
+                        else if constexpr (AZStd::same_as<FieldType, double>)
+                        {
+                            m_eventRecord.push_back(ValueDouble);
+                            AZ::u64 bits;
+                            memcpy(&bits, &fieldValue, sizeof(bits));
+                            AppendFixed(m_eventRecord, bits, sizeof(bits));
+                        }
+                        else if constexpr (AZStd::same_as<FieldType, EventArray>)
+                        {
+                            m_eventRecord.push_back(ValueArray);
+                            AppendVarint(m_eventRecord, fieldValue.GetArrayValues().size());
+                            for (const EventValue& element : fieldValue.GetArrayValues())
+                            {
+                                AppendValue(element);
+                            }
+                        }
+                        else if constexpr (AZStd::same_as<FieldType, EventObject>)
+                        {
+                            m_eventRecord.push_back(ValueObject);
+                            AppendVarint(m_eventRecord, fieldValue.GetObjectFields().size());
+                            for (const EventField& field : fieldValue.GetObjectFields())
+                            {
+                                AppendString(field.m_name);
+                                AppendValue(field.m_value);
+                            }
+                        }
+                    },
+                    value.m_value);
+            }
+
+            BinaryTraceEventLogger::ThreadBuffer& m_threadBuffer;
+            AZStd::vector<AZ::u8>& m_eventRecord;
+            AZStd::atomic<AZ::u64>& m_nextStringId;
+            size_t m_maxInternedStrings;
+        };
+    } // namespace
+
+    BinaryTraceEventLogger::BinaryTraceEventLogger()
+        : BinaryTraceEventLogger(nullptr, BinaryTraceEventLoggerConfig{})
+    {
+    }
+
+    BinaryTraceEventLogger::BinaryTraceEventLogger(BinaryTraceEventLoggerConfig config)
+        : BinaryTraceEventLogger(nullptr, AZStd::move(config))
+    {
+    }
+
+    BinaryTraceEventLogger::BinaryTraceEventLogger(AZStd::unique_ptr<AZ::IO::GenericStream> stream)
+        : BinaryTraceEventLogger(AZStd::move(stream), BinaryTraceEventLoggerConfig{})
+    {
+    }
+
+    BinaryTraceEventLogger::BinaryTraceEventLogger(AZStd::unique_ptr<AZ::IO::GenericStream> stream,
+        BinaryTraceEventLoggerConfig config)
+        : m_loggerId(s_nextLoggerId.fetch_add(1, AZStd::memory_order_relaxed))
+        , m_stream(AZStd::move(stream))
+        , m_threadBufferSize(GetRingBufferSize(config.m_threadBufferSize))
+        , m_flushInterval(config.m_flushInterval)
+        , m_maxInternedStringsPerThread(config.m_maxInternedStringsPerThread)
+        , m_name(config.m_loggerName)
+        , m_settingsRegistry{ config.m_settingsRegistry }
+    {
+        ResetSettingsHandler();
+        if (m_stream != nullptr)
+        {
+            Start(*m_stream);
+        }
+        StartFlushThread();
+    }
+
+    BinaryTraceEventLogger::~BinaryTraceEventLogger()
+    {
+        StopFlushThread();
+        // Writes the remaining events and closes the stream
+        ResetStream(nullptr);
+    }
+
+    bool BinaryTraceEventLogger::GetDefaultActiveState()
+    {
+#if !defined(AZ_RELEASE_BUILD)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void BinaryTraceEventLogger::SetName(AZStd::string_view name)
+    {
+        const bool nameChanged = m_name != name;
+        m_name = name;
+        if (nameChanged)
+        {
+            ResetSettingsHandler();
+        }
+    }
+
+    AZStd::string_view BinaryTraceEventLogger::GetName() const
+    {
+        return m_name;
+    }
+
+    void BinaryTraceEventLogger::Flush()
+    {
+        DrainThreadBuffers();
+    }
+
+    size_t BinaryTraceEventLogger::GetDroppedEventCount() const
+    {
+        return m_droppedEventCount.load(AZStd::memory_order_relaxed);
+    }
+
+    auto BinaryTraceEventLogger::RecordDurationEventBegin(const DurationArgs& durationArgs) -> ResultOutcome
+    {
+        if (!m_active)
+        {
+            return AZ::Success();
+        }
+
+        if (m_stream == nullptr)
+        {
+            return AZ::Failure(ErrorString("Logger has no output stream associated. The duration begin event cannot be recorded"));
+        }
+
+        EventDesc eventDesc;
+        eventDesc.SetName(durationArgs.m_name);
+        eventDesc.SetCategory(durationArgs.m_cat);
+        eventDesc.SetEventPhase(EventPhase::DurationBegin);
+        auto utcTimestamp = AZStd::chrono::utc_clock::now();
+        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        eventDesc.SetArgs(durationArgs.m_args);
+        eventDesc.SetId(durationArgs.m_id);
+
+        if (RecordEvent(eventDesc))
+        {
+            return AZ::Success();
+        }
+
+        return AZ::Failure(ErrorString("Logger thread buffer is full. The duration begin event has been dropped"));
+    }
+
+    auto BinaryTraceEventLogger::RecordDurationEventEnd(const DurationArgs& durationArgs) -> ResultOutcome
+    {
+        if (!m_active)
+        {
+            return AZ::Success();
+        }
+
+        if (m_stream == nullptr)
+        {
+            return AZ::Failure(ErrorString("Logger has no output stream associated. The duration end event cannot be recorded"));
+        }
+
+        EventDesc eventDesc;
+        eventDesc.SetName(durationArgs.m_name);
+        eventDesc.SetCategory(durationArgs.m_cat);
+        eventDesc.SetEventPhase(EventPhase::DurationEnd);
+        auto utcTimestamp = AZStd::chrono::utc_clock::now();
+        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        eventDesc.SetArgs(durationArgs.m_args);
+        eventDesc.SetId(durationArgs.m_id);
+
+        if (RecordEvent(eventDesc))
+        {
+            return AZ::Success();
+        }
+
+        return AZ::Failure(ErrorString("Logger thread buffer is full. The duration end event has been dropped"));
+    }
+
+    auto BinaryTraceEventLogger::RecordCompleteEvent(const CompleteArgs& completeArgs) -> ResultOutcome
+    {
+        if (!m_active)
+        {
+            return AZ::Success();
+        }
+
+        if (m_stream == nullptr)
+        {
+            return AZ::Failure(ErrorString("Logger has no output stream associated. The complete event cannot be recorded"));
+        }
+
+        EventDesc eventDesc;
+        eventDesc.SetName(completeArgs.m_name);
+        eventDesc.SetCategory(completeArgs.m_cat);
+        eventDesc.SetEventPhase(EventPhase::Complete);
+        auto utcTimestamp = AZStd::chrono::utc_clock::now();
+        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        eventDesc.SetArgs(completeArgs.m_args);
+        eventDesc.SetId(completeArgs.m_id);
+
+        // The extra fields are recorded with the names the JsonTraceEventLogger uses, so they convert as is
+        constexpr AZStd::string_view DurationKey = "dur";
+        constexpr AZStd::string_view ThreadDurationKey = "tdur";
+        constexpr size_t MaxExtraFieldCount = 8;
+        AZStd::fixed_vector<EventField, MaxExtraFieldCount> extraParams;
+        extraParams.emplace_back(DurationKey, EventValue{ AZStd::in_place_type<AZ::s64>, completeArgs.m_dur.count() });
+        if (completeArgs.m_tdur)
+        {
+            extraParams.emplace_back(ThreadDurationKey, EventValue{ AZStd::in_place_type<AZ::s64>, completeArgs.m_tdur->count() });
+        }
+        eventDesc.SetExtraParams(extraParams);
+
+        if (RecordEvent(eventDesc))
+        {
+            return AZ::Success();
+        }
+
+        return AZ::Failure(ErrorString("Logger thread buffer is full. The complete event has been dropped"));
+    }
+
+    auto BinaryTraceEventLogger::RecordInstantEvent(const InstantArgs& instantArgs) -> ResultOutcome
+    {
+        if (!m_active)
+        {
+            return AZ::Success();
+        }
+
+        if (m_stream == nullptr)
+        {
+            return AZ::Failure(ErrorString("Logger has no output stream associated. The instant event cannot be recorded"));
+        }
+
+        EventDesc eventDesc;
+        eventDesc.SetName(instantArgs.m_name);
+        eventDesc.SetCategory(instantArgs.m_cat);
+        eventDesc.SetEventPhase(EventPhase::Instant);
+        auto utcTimestamp = AZStd::chrono::utc_clock::now();
+        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        eventDesc.SetArgs(instantArgs.m_args);
+        eventDesc.SetId(instantArgs.m_id);
+
+        constexpr AZStd::string_view ScopeKey = "s";
+        constexpr size_t MaxExtraFieldCount = 8;
+        AZStd::fixed_vector<EventField, MaxExtraFieldCount> extraParams;
+        char scopeChar = static_cast<char>(instantArgs.m_scope);
+        extraParams.emplace_back(ScopeKey, EventValue{ AZStd::in_place_type<AZStd::string_view>, &scopeChar, 1 });
+        eventDesc.SetExtraParams(extraParams);
+
+        if (RecordEvent(eventDesc))
+        {
+            return AZ::Success();
+        }
+
+        return AZ::Failure(ErrorString("Logger thread buffer is full. The instant event has been dropped"));
+    }
+
+    auto BinaryTraceEventLogger::RecordCounterEvent(const CounterArgs& counterArgs) -> ResultOutcome
+    {
+        if (!m_active)
+        {
+            return AZ::Success();
+        }
+
+        if (m_stream == nullptr)
+        {
+            return AZ::Failure(ErrorString("Logger has no output stream associated. The counter event cannot be recorded"));
+        }
+
+        EventDesc eventDesc;
+        eventDesc.SetName(counterArgs.m_name);
+        eventDesc.SetCategory(counterArgs.m_cat);
+        eventDesc.SetEventPhase(EventPhase::Counter);
+        auto utcTimestamp = AZStd::chrono::utc_clock::now();
+        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        eventDesc.SetArgs(counterArgs.m_args);
+        eventDesc.SetId(counterArgs.m_id);
+
+        if (RecordEvent(eventDesc))
+        {
+            return AZ::Success();
+        }
+
+        return AZ::Failure(ErrorString("Logger thread buffer is full. The counter event has been dropped"));
+    }
+
+    auto BinaryTraceEventLogger::RecordAsyncEventStart(const AsyncArgs& asyncArgs) -> ResultOutcome
+    {
+        if (!m_active)
+        {
+            return AZ::Success();
+        }
+
+        if (m_stream == nullptr)
+        {
+            return AZ::Failure(ErrorString("Logger has no output stream associated. The async start event cannot be recorded"));
+        }
+
+        EventDesc eventDesc;
+        eventDesc.SetName(asyncArgs.m_name);
+        eventDesc.SetCategory(asyncArgs.m_cat);
+        eventDesc.SetEventPhase(EventPhase::AsyncStart);
+        auto utcTimestamp = AZStd::chrono::utc_clock::now();
+        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        eventDesc.SetArgs(asyncArgs.m_args);
+        eventDesc.SetId(asyncArgs.m_id);
+
+        constexpr AZStd::string_view ScopeKey = "scope";
+        constexpr size_t MaxExtraFieldCount = 8;
+        AZStd::fixed_vector<EventField, MaxExtraFieldCount> extraParams;
+        if (asyncArgs.m_scope)
+        {
+            extraParams.emplace_back(ScopeKey, EventValue{ AZStd::in_place_type<AZStd::string_view>, *asyncArgs.m_scope });
+        }
+        eventDesc.SetExtraParams(extraParams);
+
+        if (RecordEvent(eventDesc))
+        {
+            return AZ::Success();
+        }
+
+        return AZ::Failure(ErrorString("Logger thread buffer is full. The async start event has been dropped"));
+    }
+
+    auto BinaryTraceEventLogger::RecordAsyncEventInstant(const AsyncArgs& asyncArgs) -> ResultOutcome
+    {
+        if (!m_active)
+        {
+            return AZ::Success();
+        }
+
+        if (m_stream == nullptr)
+        {
+            return AZ::Failure(ErrorString("Logger has no output stream associated. The async instant event cannot be recorded"));
+        }
+
+        EventDesc eventDesc;
+        eventDesc.SetName(asyncArgs.m_name);
+        eventDesc.SetCategory(asyncArgs.m_cat);
+        eventDesc.SetEventPhase(EventPhase::AsyncInstant);
+        auto utcTimestamp = AZStd::chrono::utc_clock::now();
+        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        eventDesc.SetArgs(asyncArgs.m_args);
+        eventDesc.SetId(asyncArgs.m_id);
+
+        constexpr AZStd::string_view ScopeKey = "scope";
+        constexpr size_t MaxExtraFieldCount = 8;
+        AZStd::fixed_vector<EventField, MaxExtraFieldCount> extraParams;
+        if (asyncArgs.m_scope)
+        {
+            extraParams.emplace_back(ScopeKey, EventValue{ AZStd::in_place_type<AZStd::string_view>, *asyncArgs.m_scope });
+        }
+        eventDesc.SetExtraParams(extraParams);
+
+        if (RecordEvent(eventDesc))
+        {
+            return AZ::Success();
+        }
+
+        return AZ::Failure(ErrorString("Logger thread buffer is full. The async instant event has been dropped"));
+    }
+
+    auto BinaryTraceEventLogger::RecordAsyncEventEnd(const AsyncArgs& asyncArgs) -> ResultOutcome
+    {
+        if (!m_active)
+        {
+            return AZ::Success();
+        }
+
+        if (m_stream == nullptr)
+        {
+            return AZ::Failure(ErrorString("Logger has no output stream associated. The async end event cannot be recorded"));
+        }
+
+        EventDesc eventDesc;
+        eventDesc.SetName(asyncArgs.m_name);
+        eventDesc.SetCategory(asyncArgs.m_cat);
+        eventDesc.SetEventPhase(EventPhase::AsyncEnd);
+        auto utcTimestamp = AZStd::chrono::utc_clock::now();
+        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        eventDesc.SetArgs(asyncArgs.m_args);
+        eventDesc.SetId(asyncArgs.m_id);
+
+        constexpr AZStd::string_view ScopeKey = "scope";
+        constexpr size_t MaxExtraFieldCount = 8;
+        AZStd::fixed_vector<EventField, MaxExtraFieldCount> extraParams;
+        if (asyncArgs.m_scope)
+        {
+            extraParams.emplace_back(ScopeKey, EventValue{ AZStd::in_place_type<AZStd::string_view>, *asyncArgs.m_scope });
+        }
+        eventDesc.SetExtraParams(extraParams);
+
+        if (RecordEvent(eventDesc))
+        {
+            return AZ::Success();
+        }
+
+        return AZ::Failure(ErrorString("Logger thread buffer is full. The async end event has been dropped"));
+    }
+
+    void BinaryTraceEventLogger::ResetStream(AZStd::unique_ptr<AZ::IO::GenericStream> stream)
+    {
+        AZStd::scoped_lock drainLock(m_drainMutex);
+        // Writes the events recorded so far to the previous stream
+        WriteThreadBuffers();
+
+        AZStd::swap(stream, m_stream);
+        // The new stream doesn't contain the definitions of the strings interned so far
+        m_streamGeneration.fetch_add(1, AZStd::memory_order_release);
+
+        if (m_stream != nullptr)
+        {
+            Start(*m_stream);
+        }
+    }
+
+    bool BinaryTraceEventLogger::RecordEvent(const EventDesc& eventDesc)
+    {
+        ThreadBuffer& threadBuffer = GetThreadBuffer();
+
+        if (const AZ::u64 streamGeneration = m_streamGeneration.load(AZStd::memory_order_acquire);
+            threadBuffer.m_streamGeneration != streamGeneration)
+        {
+            threadBuffer.m_internedStrings.clear();
+            threadBuffer.m_streamGeneration = streamGeneration;
+        }
+
+        threadBuffer.m_encodedEvent.clear();
+        threadBuffer.m_pendingStrings.clear();
+        EventEncoder encoder(threadBuffer, m_nextStringId, m_maxInternedStringsPerThread);
+        encoder.EncodeEvent(eventDesc);
+
+        const AZStd::vector<AZ::u8>& encodedEvent = threadBuffer.m_encodedEvent;
+        const size_t ringSize = threadBuffer.m_ring.size();
+        const size_t writePosition = threadBuffer.m_writePosition.load(AZStd::memory_order_relaxed);
+        const size_t readPosition = threadBuffer.m_readPosition.load(AZStd::memory_order_acquire);
+        const size_t usedSize = writePosition - readPosition;
+        if (encodedEvent.size() > ringSize - usedSize)
+        {
+            // The strings defined with the event were never written, so they have to be defined again by the next event using them
+            for (AZStd::string_view pendingString : threadBuffer.m_pendingStrings)
+            {
+                if (auto internedIt = threadBuffer.m_internedStrings.find(pendingString); internedIt != threadBuffer.m_internedStrings.end())
+                {
+                    threadBuffer.m_internedStrings.erase(internedIt);
+                }
+            }
+            m_droppedEventCount.fetch_add(1, AZStd::memory_order_relaxed);
+            m_drainRequested = true;
+            m_flushThreadSignal.notify_one();
+            return false;
+        }
+
+        const size_t ringMask = ringSize - 1;
+        const size_t startIndex = writePosition & ringMask;
+        const size_t firstPartSize = AZStd::min(encodedEvent.size(), ringSize - startIndex);
+        memcpy(threadBuffer.m_ring.data() + startIndex, encodedEvent.data(), firstPartSize);
+        memcpy(threadBuffer.m_ring.data(), encodedEvent.data() + firstPartSize, encodedEvent.size() - firstPartSize);
+        threadBuffer.m_writePosition.store(writePosition + encodedEvent.size(), AZStd::memory_order_release);
+
+        if (usedSize + encodedEvent.size() > ringSize / 2 && !m_drainRequested.exchange(true))
+        {
+            m_flushThreadSignal.notify_one();
+        }
+        return true;
+    }
+
+    auto BinaryTraceEventLogger::GetThreadBuffer() -> ThreadBuffer&
+    {
+        if (t_threadBufferCache.m_loggerId == m_loggerId)
+        {
+            return *t_threadBufferCache.m_threadBuffer;
+        }
+
+        const AZ::u64 threadId = GetNumericThreadId(AZStd::this_thread::get_id());
+
+        AZStd::scoped_lock threadBuffersLock(m_threadBuffersMutex);
+        auto threadBufferIt = AZStd::find_if(m_threadBuffers.begin(), m_threadBuffers.end(),
+            [threadId](const AZStd::unique_ptr<ThreadBuffer>& threadBuffer)
+            {
+                return threadBuffer->m_threadId == threadId;
+            });
+        if (threadBufferIt == m_threadBuffers.end())
+        {
+            m_threadBuffers.emplace_back(AZStd::make_unique<ThreadBuffer>(threadId, m_threadBufferSize));
+            threadBufferIt = AZStd::prev(m_threadBuffers.end());
+        }
+
+        t_threadBufferCache = { m_loggerId, threadBufferIt->get() };
+        return **threadBufferIt;
+    }
+
+    void BinaryTraceEventLogger::DrainThreadBuffers()
+    {
+        AZStd::scoped_lock drainLock(m_drainMutex);
+        WriteThreadBuffers();
+    }
+
+    void BinaryTraceEventLogger::WriteThreadBuffers()
+    {
+        if (m_stream == nullptr)
+        {
+            return;
+        }
+
+        // The buffers registered later are drained on the next pass
+        AZStd::vector<ThreadBuffer*> threadBuffers;
+        {
+            AZStd::scoped_lock threadBuffersLock(m_threadBuffersMutex);
+            threadBuffers.reserve(m_threadBuffers.size());
+            for (auto& threadBuffer : m_threadBuffers)
+            {
+                threadBuffers.push_back(threadBuffer.get());
+            }
+        }
+
+        AZStd::vector<AZ::u8> blockHeader;
+        for (ThreadBuffer* threadBuffer : threadBuffers)
+        {
+            // Only the committed events are read, which are never modified until the read position moves past them
+            const size_t writePosition = threadBuffer->m_writePosition.load(AZStd::memory_order_acquire);
+            const size_t readPosition = threadBuffer->m_readPosition.load(AZStd::memory_order_relaxed);
+            if (writePosition == readPosition)
+            {
+                continue;
+            }
+
+            blockHeader.clear();
+            BinaryTraceEvent::AppendFixed(blockHeader, threadBuffer->m_threadId, sizeof(AZ::u64));
+            BinaryTraceEvent::AppendFixed(blockHeader, writePosition - readPosition, sizeof(AZ::u32));
+            m_stream->Write(blockHeader.size(), blockHeader.data());
+
+            const size_t ringSize = threadBuffer->m_ring.size();
+            const size_t startIndex = readPosition & (ringSize - 1);
+            const size_t blockSize = writePosition - readPosition;
+            const size_t firstPartSize = AZStd::min(blockSize, ringSize - startIndex);
+            m_stream->Write(firstPartSize, threadBuffer->m_ring.data() + startIndex);
+            if (firstPartSize < blockSize)
+            {
+                m_stream->Write(blockSize - firstPartSize, threadBuffer->m_ring.data());
+            }
+
+            threadBuffer->m_readPosition.store(writePosition, AZStd::memory_order_release);
+        }
+    }
+
+    bool BinaryTraceEventLogger::Start(AZ::IO::GenericStream& stream)
+    {
+        AZStd::vector<AZ::u8> header(StreamSignature.begin(), StreamSignature.end());
+        BinaryTraceEvent::AppendFixed(header, StreamVersion, sizeof(AZ::u32));
+        BinaryTraceEvent::AppendFixed(header, AZ::Platform::GetCurrentProcessId(), sizeof(AZ::u64));
+        return stream.Write(header.size(), header.data()) == header.size();
+    }
+
+    void BinaryTraceEventLogger::StartFlushThread()
+    {
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Metrics flush";
+        m_flushThread = AZStd::thread(
+            threadDesc,
+            [this]()
+            {
+                FlushThreadMain();
+            });
+    }
+
+    void BinaryTraceEventLogger::StopFlushThread()
+    {
+        {
+            AZStd::scoped_lock lock(m_flushThreadMutex);
+            m_stopFlushThread = true;
+        }
+        m_flushThreadSignal.notify_one();
+        if (m_flushThread.joinable())
+        {
+            m_flushThread.join();
+        }
+    }
+
+    void BinaryTraceEventLogger::FlushThreadMain()
+    {
+        while (true)
+        {
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_flushThreadMutex);
+                m_flushThreadSignal.wait_for(lock, m_flushInterval,
+                    [this]()
+                    {
+                        return m_stopFlushThread || m_drainRequested;
+                    });
+                if (m_stopFlushThread)
+                {
+                    return;
+                }
+            }
+
+            m_drainRequested = false;
+            DrainThreadBuffers();
+        }
+    }
+
+    void BinaryTraceEventLogger::ResetSettingsHandler()
+    {
+        // Reset the active option back to default active state based on the build configuration
+        // and then query it from the Settings Registry again
+        m_active = GetDefaultActiveState();
+
+        if (auto settingsRegistry = m_settingsRegistry != nullptr ? m_settingsRegistry : AZ::SettingsRegistry::Get();
+            settingsRegistry != nullptr)
+        {
+            // Read the "/O3DE/Metrics/<Name>/Active" setting from the Settings Registry
+            const AZStd::fixed_string<128> eventLoggerActiveSettingKey(SettingsKey(m_name + "/Active"));
+            settingsRegistry->Get(m_active, eventLoggerActiveSettingKey);
+
+            auto ActiveStateUpdateFunc = [this](const AZ::SettingsRegistryInterface::NotifyEventArgs& notifyArgs)
+            {
+                const AZStd::fixed_string<128> activeSettingKey(SettingsKey(m_name + "/Active"));
+                if (AZ::SettingsRegistryMergeUtils::IsPathAncestorDescendantOrEqual(notifyArgs.m_jsonKeyPath, activeSettingKey))
+                {
+                    if (auto settingsRegistry = m_settingsRegistry != nullptr ? m_settingsRegistry : AZ::SettingsRegistry::Get();
+                        settingsRegistry != nullptr)
+                    {
+                        // If the key has been deleted, then reset the active state to the default active state
+                        if (settingsRegistry->GetType(activeSettingKey).m_type == AZ::SettingsRegistryInterface::Type::NoType)
+                        {
+                            m_active = GetDefaultActiveState();
+                        }
+                        else
+                        {
+                            settingsRegistry->Get(m_active, activeSettingKey);
+                        }
+                    }
+                }
+            };
+            m_settingsHandler = settingsRegistry->RegisterNotifier(ActiveStateUpdateFunc);
+        }
+    }
+
+    namespace
+    {
+        // Exposes the JSON formatting of the JsonTraceEventLogger, so converted events are written exactly as if they
+        // had been recorded by it
+        class ConvertedEventWriter
+            : public JsonTraceEventLogger
+        {
+        public:
+            using JsonTraceEventLogger::JsonTraceEventLogger;
+            using JsonTraceEventLogger::FlushRequest;
+        };
+
+        class EventDecoder
+        {
+        public:
+            using ErrorString = IEventLogger::ErrorString;
+
+            //! Decodes the records of a block of one thread, writing every decoded event to the writer
+            AZ::Outcome<void, ErrorString> DecodeBlock(
+                AZStd::span<const AZ::u8> block, AZ::u64 threadId, AZ::u64 processId, ConvertedEventWriter& writer)
+            {
+                using namespace BinaryTraceEvent;
+
+                BinaryTraceEvent::Reader reader{ block };
+                while (reader.m_position < block.size())
+                {
+                    AZ::u8 recordType;
+                    reader.ReadByte(recordType);
+                    if (recordType == RecordStringDefinition)
+                    {
+                        AZ::u64 stringId, stringSize;
+                        AZStd::string_view value;
+                        if (!reader.ReadVarint(stringId) || !reader.ReadVarint(stringSize) || !reader.ReadCharacters(value, stringSize))
+                        {
+                            return AZ::Failure(ErrorString("Truncated string definition"));
+                        }
+                        m_strings[stringId] = value;
+                    }
+                    else if (recordType == RecordEvent)
+                    {
+                        m_valueStorage.clear();
+                        m_fieldStorage.clear();
+                        EventDesc eventDesc;
+                        if (!DecodeEvent(reader, eventDesc))
+                        {
+                            return AZ::Failure(ErrorString("Truncated or malformed event"));
+                        }
+                        eventDesc.SetProcessId(aznumeric_cast<AZ::Platform::ProcessId>(processId));
+                        AZStd::thread_id eventThreadId{};
+                        uintptr_t numericThreadId = static_cast<uintptr_t>(threadId);
+                        eventThreadId = *reinterpret_cast<AZStd::thread_id*>(&numericThreadId);
+                        eventDesc.SetThreadId(eventThreadId);
+                        writer.FlushRequest(eventDesc);
+                        ++m_eventCount;
+                    }
+                    else
+                    {
+                        return AZ::Failure(ErrorString::format("Unknown record type %u", static_cast<AZ::u32>(recordType)));
+                    }
+                }
+                return AZ::Success();
+            }
+
+            size_t GetEventCount() const
+            {
+                return m_eventCount;
+            }
+
+        private:
+            bool DecodeEvent(BinaryTraceEvent::Reader& reader, EventDesc& eventDesc)
+            {
+                using namespace BinaryTraceEvent;
+
+                AZ::u8 phase, hasId;
+                AZ::u64 timestamp;
+                AZStd::string_view name, category;
+                if (!reader.ReadByte(phase) || !reader.ReadVarint(timestamp) || !DecodeString(reader, name) ||
+                    !DecodeString(reader, category) || !reader.ReadByte(hasId))
+                {
+                    return false;
+                }
+                eventDesc.SetEventPhase(static_cast<EventPhase>(phase));
+                eventDesc.SetTimestamp(AZStd::chrono::microseconds(ZigZagDecode(timestamp)));
+                eventDesc.SetName(name);
+                eventDesc.SetCategory(category);
+                if (hasId)
+                {
+                    AZStd::string_view eventId;
+                    if (!DecodeString(reader, eventId))
+                    {
+                        return false;
+                    }
+                    eventDesc.SetId(eventId);
+                }
+
+                EventValue args;
+                if (!DecodeValue(reader, args, 0) || !AZStd::holds_alternative<EventObject>(args.m_value))
+                {
+                    return false;
+                }
+                eventDesc.SetArgs(AZStd::get<EventObject>(args.m_value).GetObjectFields());
+
+                AZStd::span<EventField> extraParams;
+                if (!DecodeFields(reader, extraParams, 0))
+                {
+                    return false;
+                }
+                eventDesc.SetExtraParams(extraParams);
+                return true;
+            }
+
+            bool DecodeString(BinaryTraceEvent::Reader& reader, AZStd::string_view& value)
+            {
+                AZ::u64 reference;
+                if (!reader.ReadVarint(reference))
+                {
+                    return false;
+                }
+                if (reference & 1)
+                {
+                    return reader.ReadCharacters(value, reference >> 1);
+                }
+
+                // An unknown id is a string interned in a previous stream, see BinaryTraceEventLogger::ResetStream
+                auto stringIt = m_strings.find(reference >> 1);
+                value = stringIt != m_strings.end() ? AZStd::string_view(stringIt->second) : AZStd::string_view{};
+                return true;
+            }
+
+            bool DecodeFields(BinaryTraceEvent::Reader& reader, AZStd::span<EventField>& fields, size_t depth)
+            {
+                AZ::u64 fieldCount;
+                if (!reader.ReadVarint(fieldCount) || fieldCount > reader.m_data.size())
+                {
+                    return false;
+                }
+                // Every array is allocated at its final size, so the spans of the parent values remain valid
+                AZStd::vector<EventField>& storage = m_fieldStorage.emplace_back(static_cast<size_t>(fieldCount));
+                for (EventField& field : storage)
+                {
+                    if (!DecodeString(reader, field.m_name) || !DecodeValue(reader, field.m_value, depth + 1))
+                    {
+                        return false;
+                    }
+                }
+                fields = storage;
+                return true;
+            }
+
+            bool DecodeValue(BinaryTraceEvent::Reader& reader, EventValue& value, size_t depth)
+            {
+                using namespace BinaryTraceEvent;
+
+                AZ::u8 valueType;
+                if (depth > MaxValueDepth || !reader.ReadByte(valueType))
+                {
+                    return false;
+                }
+
+                switch (valueType)
+                {
+                case ValueString:
+                {
+                    AZStd::string_view stringValue;
+                    if (!DecodeString(reader, stringValue))
+                    {
+                        return false;
+                    }
+                    value.m_value.emplace<AZStd::string_view>(stringValue);
+                    return true;
+                }
+                case ValueFalse:
+                case ValueTrue:
+                    value.m_value.emplace<bool>(valueType == ValueTrue);
+                    return true;
+                case ValueInt64:
+                case ValueUint64:
+                {
+                    AZ::u64 integer;
+                    if (!reader.ReadVarint(integer))
+                    {
+                        return false;
+                    }
+                    if (valueType == ValueInt64)
+                    {
+                        value.m_value.emplace<AZ::s64>(ZigZagDecode(integer));
+                    }
+                    else
+                    {
+                        value.m_value.emplace<AZ::u64>(integer);
+                    }
+                    return true;
+                }
+                case ValueDouble:
+                {
+                    AZ::u64 bits;
+                    if (!reader.ReadFixed(bits, sizeof(bits)))
+                    {
+                        return false;
+                    }
+                    double number;
+                    memcpy(&number, &bits, sizeof(number));
+                    value.m_value.emplace<double>(number);
+                    return true;
+                }
+                case ValueArray:
+                {
+                    AZ::u64 elementCount;
+                    if (!reader.ReadVarint(elementCount) || elementCount > reader.m_data.size())
+                    {
+                        return false;
+                    }
+                    AZStd::vector<EventValue>& storage = m_valueStorage.emplace_back(static_cast<size_t>(elementCount));
+                    for (EventValue& element : storage)
+                    {
+                        if (!DecodeValue(reader, element, depth + 1))
+                        {
+                            return false;
+                        }
+                    }
+                    value.m_value.emplace<EventArray>(storage);
+                    return true;
+                }
+                case ValueObject:
+                {
+                    AZStd::span<EventField> fields;
+                    if (!DecodeFields(reader, fields, depth))
+                    {
+                        return false;
+                    }
+                    value.m_value.emplace<EventObject>(fields);
+                    return true;
+                }
+                default:
+                    return false;
+                }
+            }
+
+            AZStd::unordered_map<AZ::u64, AZStd::string> m_strings;
+            // Storage of the arrays and objects of the event being decoded, the deques don't move their elements
+            AZStd::deque<AZStd::vector<EventValue>> m_valueStorage;
+            AZStd::deque<AZStd::vector<EventField>> m_fieldStorage;
+            size_t m_eventCount{};
+        };
+    } // namespace
+
+    AZ::Outcome<size_t, IEventLogger::ErrorString> ConvertBinaryTraceEventsToJson(
+        AZ::IO::GenericStream& binaryStream, AZStd::unique_ptr<AZ::IO::GenericStream> jsonStream)
+    {
+        using ErrorString = IEventLogger::ErrorString;
+
+        constexpr size_t StreamHeaderSize = BinaryTraceEventLogger::StreamSignature.size() + sizeof(AZ::u32) + sizeof(AZ::u64);
+        AZStd::array<AZ::u8, StreamHeaderSize> header;
+        if (binaryStream.Read(header.size(), header.data()) != header.size() ||
+            AZStd::string_view(reinterpret_cast<const char*>(header.data()), BinaryTraceEventLogger::StreamSignature.size()) !=
+                BinaryTraceEventLogger::StreamSignature)
+        {
+            return AZ::Failure(ErrorString("The stream doesn't start with a binary trace event signature"));
+        }
+
+        BinaryTraceEvent::Reader headerReader{ header };
+        headerReader.m_position = BinaryTraceEventLogger::StreamSignature.size();
+        AZ::u64 version, processId;
+        headerReader.ReadFixed(version, sizeof(AZ::u32));
+        headerReader.ReadFixed(processId, sizeof(AZ::u64));
+        if (version != BinaryTraceEventLogger::StreamVersion)
+        {
+            return AZ::Failure(ErrorString::format("Unsupported binary trace event version %llu", version));
+        }
+
+        // Writes the events even when the logger is inactive in this configuration
+        JsonTraceEventLoggerConfig writerConfig;
+        ConvertedEventWriter writer(AZStd::move(jsonStream), writerConfig);
+
+        EventDecoder decoder;
+        AZStd::vector<AZ::u8> block;
+        AZStd::array<AZ::u8, BinaryTraceEvent::BlockHeaderSize> blockHeader;
+        while (true)
+        {
+            const AZ::IO::SizeType headerBytesRead = binaryStream.Read(blockHeader.size(), blockHeader.data());
+            if (headerBytesRead == 0)
+            {
+                break;
+            }
+            if (headerBytesRead != blockHeader.size())
+            {
+                return AZ::Failure(ErrorString("Truncated block header"));
+            }
+
+            BinaryTraceEvent::Reader blockHeaderReader{ blockHeader };
+            AZ::u64 threadId, blockSize;
+            blockHeaderReader.ReadFixed(threadId, sizeof(AZ::u64));
+            blockHeaderReader.ReadFixed(blockSize, sizeof(AZ::u32));
+
+            block.resize_no_construct(static_cast<size_t>(blockSize));
+            if (binaryStream.Read(block.size(), block.data()) != block.size())
+            {
+                return AZ::Failure(ErrorString("Truncated block"));
+            }
+
+            if (auto decodeOutcome = decoder.DecodeBlock(block, threadId, processId, writer); !decodeOutcome)
+            {
+                return AZ::Failure(decodeOutcome.TakeError());
+            }
+        }
+
+        // The writer completes the JSON array when it is destroyed
+        return AZ::Success(decoder.GetEventCount());
+    }
+} // namespace AZ::Metrics
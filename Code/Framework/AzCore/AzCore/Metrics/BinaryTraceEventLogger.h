@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Metrics/IEventLogger.h>
+
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
+namespace AZ::Metrics
+{
+    // Contains BinaryTraceEventLogger specific configuration
+    struct BinaryTraceEventLoggerConfig
+    {
+        //! Name of the BinaryTraceEventLogger
+        AZStd::string_view m_loggerName;
+        //! Settings Registry reference used to query
+        //! to register an EventHandler for the BinaryTraceEventLogger
+        //! to get updates on setting modifications below the "/O3DE/Metrics/<LoggerName>" key
+        //! If nullptr, a handler is installed on the global settings registry
+        AZ::SettingsRegistryInterface* m_settingsRegistry{};
+        //! Size in bytes of the buffer each recording thread encodes its events into, rounded up to a power of two.
+        //! Events recorded while the buffer of the thread is full are dropped.
+        size_t m_threadBufferSize{ 64 * 1024 };
+        //! Interval at which the flush thread writes the buffers of the recording threads to the stream.
+        //! The flush thread is also woken when a buffer is half full.
+        AZStd::chrono::milliseconds m_flushInterval{ 100 };
+        //! Number of distinct strings each recording thread interns.
+        //! Strings recorded past that are written in full with every event, which bounds the memory used
+        //! when string arguments have many different values.
+        size_t m_maxInternedStringsPerThread{ 4096 };
+    };
+
+    //! Event logger which records events in a compact binary encoding instead of formatting them as JSON.
+    //! Each recording thread encodes its events into a buffer only it writes to, so recording an event takes no lock.
+    //! A background thread writes the buffers to the stream, so the recording threads don't wait on any I/O either.
+    //! Names, categories, ids and the strings of the arguments are interned per thread, and then recorded as integers.
+    //!
+    //! The stream can be converted to the JSON trace event format with ConvertBinaryTraceEventsToJson,
+    //! which can then be opened with Perfetto(ui.perfetto.dev) or chrome://tracing.
+    class BinaryTraceEventLogger
+        : public IEventLogger
+    {
+    public:
+        BinaryTraceEventLogger();
+        explicit BinaryTraceEventLogger(BinaryTraceEventLoggerConfig);
+        //! Generic stream which is owned by the BinaryTraceEventLogger
+        explicit BinaryTraceEventLogger(AZStd::unique_ptr<AZ::IO::GenericStream> stream);
+        BinaryTraceEventLogger(AZStd::unique_ptr<AZ::IO::GenericStream> stream, BinaryTraceEventLoggerConfig);
+
+        ~BinaryTraceEventLogger();
+
+        //! Set the name associated of this event logger
+        void SetName(AZStd::string_view) override;
+
+        //! Returns the name associated with this event logger
+        AZStd::string_view GetName() const override;
+
+        //! Writes the events recorded so far by all threads to the stream, on the calling thread
+        void Flush() override;
+
+        ResultOutcome RecordDurationEventBegin(const DurationArgs&) override;
+        ResultOutcome RecordDurationEventEnd(const DurationArgs&) override;
+        ResultOutcome RecordCompleteEvent(const CompleteArgs&) override;
+        ResultOutcome RecordInstantEvent(const InstantArgs&) override;
+        ResultOutcome RecordCounterEvent(const CounterArgs&) override;
+        ResultOutcome RecordAsyncEventStart(const AsyncArgs&) override;
+        ResultOutcome RecordAsyncEventInstant(const AsyncArgs&) override;
+        ResultOutcome RecordAsyncEventEnd(const AsyncArgs&) override;
+
+        //! Writes the recorded events to the previous stream and associates a new stream
+        //! NOTE: Events recorded by other threads while the stream is reset can reference strings
+        //! interned in the previous stream, they're converted with empty strings.
+        void ResetStream(AZStd::unique_ptr<AZ::IO::GenericStream> stream);
+
+        //! Returns the number of events that were dropped because the buffer of the recording thread was full
+        size_t GetDroppedEventCount() const;
+
+        //! Identifies a stream of binary trace events, followed by a little endian u32 version
+        static constexpr AZStd::string_view StreamSignature = "O3DEBTE\n";
+        static constexpr AZ::u32 StreamVersion = 1;
+
+        struct ThreadBuffer;
+    protected:
+        //! Encodes an event into the buffer of the calling thread
+        bool RecordEvent(const EventDesc&);
+
+        //! Returns the buffer of the calling thread, creating it for the first event the thread records
+        ThreadBuffer& GetThreadBuffer();
+
+        //! Writes the events committed to the thread buffers to the stream
+        void DrainThreadBuffers();
+        //! Implementation of DrainThreadBuffers, the drain mutex must be locked
+        void WriteThreadBuffers();
+
+        //! Writes the stream signature and version
+        bool Start(AZ::IO::GenericStream& stream);
+
+        void StartFlushThread();
+        void StopFlushThread();
+        void FlushThreadMain();
+
+        //! Reads the event logger "/O3DE/Metrics/<Name>/Active" setting from the Settings Registry
+        //! and resets a handler to listen for changes to any setting below "/O3DE/Metrics/<Name>" key
+        void ResetSettingsHandler();
+
+    private:
+        //! In non-release configurations, the event logger defaults to active.
+        //! In release configurations, the event logger defaults to inactive
+        //! This can be overrided through the settings registry
+        static bool GetDefaultActiveState();
+
+    protected:
+        //! Unique identifier of the logger, used by the recording threads to cache their buffer
+        //! without referring to a logger that may have been destroyed
+        const AZ::u64 m_loggerId;
+
+        //! Guards writing to the stream and reading the thread buffers
+        AZStd::mutex m_drainMutex;
+        AZStd::unique_ptr<AZ::IO::GenericStream> m_stream;
+
+        //! Guards the registration of recording threads
+        AZStd::mutex m_threadBuffersMutex;
+        AZStd::vector<AZStd::unique_ptr<ThreadBuffer>> m_threadBuffers;
+
+        AZStd::thread m_flushThread;
+        AZStd::mutex m_flushThreadMutex;
+        AZStd::condition_variable m_flushThreadSignal;
+        AZStd::atomic_bool m_drainRequested{ false };
+        bool m_stopFlushThread{ false };
+
+        //! Incremented each time the stream is reset, so the recording threads intern their strings again
+        AZStd::atomic<AZ::u64> m_streamGeneration{ 0 };
+        //! Source of the ids of the interned strings, unique across the threads
+        AZStd::atomic<AZ::u64> m_nextStringId{ 0 };
+        AZStd::atomic<size_t> m_droppedEventCount{ 0 };
+
+        size_t m_threadBufferSize;
+        AZStd::chrono::milliseconds m_flushInterval;
+        size_t m_maxInternedStringsPerThread;
+
+        //! Provides a user friendly name for the event logger
+        AZStd::string m_name;
+
+        //! Active flag to to allow the record functions to write event data to the stream member
+        //! When the name of the event logger is set, the value is updated from the settings registry
+        //! "/O3DE/Metrics/<Name>/Active" bool
+        bool m_active{ GetDefaultActiveState() };
+
+        AZ::SettingsRegistryInterface* m_settingsRegistry{};
+        AZ::SettingsRegistryInterface::NotifyEventHandler m_settingsHandler;
+    };
+
+    //! Converts a stream written by a BinaryTraceEventLogger to the JSON trace event format
+    //! written by the JsonTraceEventLogger.
+    //! @param binaryStream stream to read the binary events from
+    //! @param jsonStream stream to write the JSON trace events to
+    //! @return the number of converted events on success, or an error message if the binary stream is malformed
+    AZ::Outcome<size_t, IEventLogger::ErrorString> ConvertBinaryTraceEventsToJson(
+        AZ::IO::GenericStream& binaryStream, AZStd::unique_ptr<AZ::IO::GenericStream> jsonStream);
+} // namespace AZ::Metrics
@@ -43,6 +43,11 @@ namespace AZ
                 break;
         }
 
+        if (CheckBitsAny(flags, LoadFlags::SkipInitialize))
+        {
+            return true;
+        }
+
         // Call module's initialize function.
         auto initFunc = GetFunction<InitializeDynamicModuleFunction>(InitializeDynamicModuleFunctionName);
         if (initFunc)
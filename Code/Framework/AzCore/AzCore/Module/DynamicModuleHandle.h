@@ -31,8 +31,10 @@ namespace AZ
             InitFuncRequired    = 1 << 0, /// Whether a missing \ref InitializeDynamicModuleFunction causes the Load to fail.
             GlobalSymbols       = 1 << 1, /// On platforms that support it, make the module's symbols global and available for
                                           /// the relocation processing of other modules. Otherwise, the symbols need to be queried manually.
-            NoLoad              = 1 << 2  /// Don't load the library (only get a handle if it's already loaded).
+            NoLoad              = 1 << 2, /// Don't load the library (only get a handle if it's already loaded).
                                           /// This can be used to test if the library is already resident.
+            SkipInitialize      = 1 << 3  /// Only map the library into the process, without calling its \ref InitializeDynamicModuleFunction.
+                                          /// This can be used to load a library from another thread ahead of its initialization.
         };
 
         /// Platform-specific implementation should call Unload().
@@ -17,8 +17,11 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace
@@ -483,7 +486,10 @@ namespace AZ
                 continue;
             }
 
+            const auto phaseStartTime = AZStd::chrono::steady_clock::now();
             PhaseOutcome phaseResult = phasePair.second();
+            moduleDataPtr->m_initializationTime +=
+                AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - phaseStartTime);
             if (!phaseResult.IsSuccess())
             {
                 // Remove all references to the module from the owned and unowned list
@@ -517,6 +523,14 @@ namespace AZ
     {
         LoadModulesResult results;
 
+        // Mapping a library is the slow part of loading it, and it doesn't depend on the ModuleManager's state.
+        // The OS loader resolves the dependencies between libraries, so they can be mapped in any order.
+        AZStd::vector<AZStd::unique_ptr<DynamicModuleHandle>> preloadedLibraries;
+        if (lastStepToPerform >= ModuleInitializationSteps::Load)
+        {
+            preloadedLibraries = PreloadDynamicLibraries(modules);
+        }
+
         Internal::ModuleManagerSearchPathTool moduleSearchPathHelper;
 
         // Load DLLs specified in the application descriptor
@@ -532,6 +546,74 @@ namespace AZ
         return results;
     }
 
+    //=========================================================================
+    // PreloadDynamicLibraries
+    //=========================================================================
+    AZStd::vector<AZStd::unique_ptr<DynamicModuleHandle>> ModuleManager::PreloadDynamicLibraries(const ModuleDescriptorList& modules)
+    {
+        AZStd::vector<AZStd::unique_ptr<DynamicModuleHandle>> libraries;
+
+        bool parallelLoad = true;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Get(parallelLoad, ParallelLoadSettingKey);
+        }
+        if (!parallelLoad)
+        {
+            return libraries;
+        }
+
+        // The paths are resolved by the application, so the handles are created on this thread
+        for (const auto& moduleDescriptor : modules)
+        {
+            if (AZStd::shared_ptr<ModuleDataImpl> moduleData = GetLoadedModule(moduleDescriptor.m_dynamicLibraryPath);
+                moduleData && moduleData->m_lastCompletedStep >= ModuleInitializationSteps::Load)
+            {
+                continue;
+            }
+
+            if (auto library = DynamicModuleHandle::Create(PreProcessModule(moduleDescriptor.m_dynamicLibraryPath).c_str()))
+            {
+                libraries.emplace_back(AZStd::move(library));
+            }
+        }
+
+        const size_t threadCount = AZStd::min<size_t>(libraries.size(), AZStd::thread::hardware_concurrency());
+        if (threadCount < 2)
+        {
+            // Nothing to overlap, the libraries are loaded by the serial load
+            libraries.clear();
+            return libraries;
+        }
+
+        // Each library is only mapped, its initialization and module class creation happen on the main thread.
+        // A library that fails to load here is reported by the serial load, which retries it with its search path.
+        AZStd::atomic<size_t> nextLibraryIndex{ 0 };
+        auto LoadLibraries = [&libraries, &nextLibraryIndex]()
+        {
+            for (size_t libraryIndex = nextLibraryIndex++; libraryIndex < libraries.size(); libraryIndex = nextLibraryIndex++)
+            {
+                libraries[libraryIndex]->Load(DynamicModuleHandle::LoadFlags::SkipInitialize);
+            }
+        };
+
+        AZStd::vector<AZStd::thread> loadThreads;
+        loadThreads.reserve(threadCount - 1);
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "ModuleManager Preload";
+        for (size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+        {
+            loadThreads.emplace_back(threadDesc, LoadLibraries);
+        }
+        LoadLibraries();
+        for (AZStd::thread& loadThread : loadThreads)
+        {
+            loadThread.join();
+        }
+
+        return libraries;
+    }
+
     //=========================================================================
     // LoadStaticModules
     //=========================================================================
@@ -84,6 +84,7 @@ namespace AZ
         Module* GetModule() const override { return m_module; }
         Entity* GetEntity() const override { return m_moduleEntity.get(); }
         const char* GetDebugName() const override;
+        AZStd::chrono::microseconds GetInitializationTime() const override { return m_initializationTime; }
         ////////////////////////////////////////////////////////////////////////
 
         /// Deals with loading and unloading the AZ::Module's DLL.
@@ -98,6 +99,9 @@ namespace AZ
 
         //! The last step this module completed
         ModuleInitializationSteps m_lastCompletedStep = ModuleInitializationSteps::None;
+
+        //! The time spent in the initialization steps of this module
+        AZStd::chrono::microseconds m_initializationTime{};
     };
 
     /*!
@@ -111,6 +115,11 @@ namespace AZ
         AZ_CLASS_ALLOCATOR(ModuleManager, AZ::OSAllocator);
         static void Reflect(ReflectContext* context);
 
+        //! Settings registry key of the bool that enables loading the dynamic libraries of several modules in parallel
+        static constexpr const char* ParallelLoadSettingKey = "/O3DE/ModuleManager/ParallelLoad";
+        //! Settings registry key of the bool that enables printing the initialization time of each module at startup
+        static constexpr const char* ReportLoadTimesSettingKey = "/O3DE/ModuleManager/ReportLoadTimes";
+
         ModuleManager();
         ~ModuleManager() override;
 
@@ -163,6 +172,10 @@ namespace AZ
         // Helper function to preprocess the module names to handle any special processing
         static AZ::OSString PreProcessModule(AZStd::string_view moduleName);
 
+        //! Maps the dynamic libraries of the modules that aren't loaded yet from worker threads, so the
+        //! serial load only has to initialize them. The returned handles keep the libraries mapped until they're released.
+        AZStd::vector<AZStd::unique_ptr<DynamicModuleHandle>> PreloadDynamicLibraries(const ModuleDescriptorList& modules);
+
         // Tags to look for when activating system components
         AZStd::vector<Crc32> m_systemComponentTags;
 
@@ -11,6 +11,7 @@
 #include <AzCore/EBus/Event.h>
 #include <AzCore/Outcome/Outcome.h>
 
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/osstring.h>
 
@@ -37,6 +38,8 @@ namespace AZ
         virtual Entity* GetEntity() const = 0;
         /// Get the debug name of the module
         virtual const char* GetDebugName() const = 0;
+        /// Get the time spent loading and initializing the module, including the reflection of its component descriptors
+        virtual AZStd::chrono::microseconds GetInitializationTime() const { return {}; }
     };
 
     /**
@@ -106,30 +106,44 @@ namespace AZ
 
         [[maybe_unused]] bool leaksDetected = false;
 
-        for (auto i = m_dictionary.begin(), last = m_dictionary.end(); i != last;)
+        for (Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = i->second.m_nameData;
-            const int useCount = nameData->m_useCount;
-
-            if (useCount == 0)
-            {
-                i = m_dictionary.erase(i);
-                delete nameData;
-            }
-            else
+            for (auto i = shard.m_dictionary.begin(), last = shard.m_dictionary.end(); i != last;)
             {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, i->first, AZ_STRING_ARG(nameData->GetName()));
-                ++i;
+                Internal::NameData* nameData = i->second.m_nameData;
+                const int useCount = nameData->m_useCount;
+
+                if (useCount == 0)
+                {
+                    i = shard.m_dictionary.erase(i);
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, i->first, AZ_STRING_ARG(nameData->GetName()));
+                    ++i;
+                }
             }
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
+    NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash)
+    {
+        return m_shards[hash % ShardCount];
+    }
+
+    const NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[hash % ShardCount];
+    }
+
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        const Shard& shard = GetShard(hash);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
         // The NameData m_useCount check is to avoid a multithread race condition
         // where thread B is in NameData::release and reduces the m_useCount to 0
@@ -138,8 +152,8 @@ namespace AZ
         // If thread A continues along and releases the NameData again, before thread B can run
         // the the m_useCount can be reduced to 0 and multiple threads can be in the
         // NameData::release `if (m_useCount.fetch_sub(1) == 1)` block
-        if (auto iter = m_dictionary.find(hash);
-            iter != m_dictionary.end() && iter->second.m_nameData->m_useCount > 0)
+        if (auto iter = shard.m_dictionary.find(hash);
+            iter != shard.m_dictionary.end() && iter->second.m_nameData->m_useCount > 0)
         {
             return Name(iter->second.m_nameData);
         }
@@ -235,20 +249,24 @@ namespace AZ
             return AZStd::move(name);
         }
 
-        // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto iter = m_dictionary.find(hash);
+        // The name doesn't exist in the dictionary, so we have to lock and add it.
+        // Each probed hash is checked under the lock of its own shard. This is safe without holding the locks
+        // of the previous hashes because entries involved in a collision are flagged under their shard's lock
+        // and are never released, so the probe sequence of a string can't change.
         bool collisionDetected = false;
         while (true)
         {
+            Shard& shard = GetShard(hash);
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+
+            auto iter = shard.m_dictionary.find(hash);
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (iter == shard.m_dictionary.end())
             {
                 Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
                 // Piecewise construct to prevent creating a temporary ScopedNameDataWrapper that destructs
-                m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
+                shard.m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -262,7 +280,6 @@ namespace AZ
                 collisionDetected = true;
                 iter->second.m_nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
             }
         }
     }
@@ -281,38 +298,41 @@ namespace AZ
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
         {
-            // This check is to safeguard around the following scenario
-            // T1, gets into TryReleaseName
-            // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
-            // T2 deletes the Name decrements the counter, gets into TryReleaseName
-            // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
-            // Then T2 continues, gets the lock and crashes because nameData was deleted
-            return;
-        }
+            Shard& shard = GetShard(hash);
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-        Internal::NameData* nameData = dictIt->second.m_nameData;
+            auto dictIt = shard.m_dictionary.find(hash);
+            if (dictIt == shard.m_dictionary.end())
+            {
+                // This check is to safeguard around the following scenario
+                // T1, gets into TryReleaseName
+                // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
+                // T2 deletes the Name decrements the counter, gets into TryReleaseName
+                // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
+                // Then T2 continues, gets the lock and crashes because nameData was deleted
+                return;
+            }
 
-        // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
-        {
-            return;
-        }
+            Internal::NameData* nameData = dictIt->second.m_nameData;
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
-        {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            // Check m_hashCollision inside the shard's mutex because a new collision could have happened
+            // on another thread before taking the lock.
+            if (nameData->m_hashCollision)
+            {
+                return;
+            }
+
+            // We need to check the count again in here in case
+            // someone was trying to get the name on another thread.
+            // Set it to -1 so only this thread will attempt to clean up the
+            // dictionary and delete the name.
+            int32_t expectedRefCount = 0;
+            if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+            {
+                shard.m_dictionary.erase(nameData->GetHash());
+                delete nameData;
+            }
         }
 
         ReportStats();
@@ -333,35 +353,43 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            size_t nameCount = 0;
+
+            for (const Shard& shard : m_shards)
             {
-                Internal::NameData* nameData = iter.second.m_nameData;
-                const size_t nameLength = nameData->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
+                AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+                nameCount += shard.m_dictionary.size();
 
-                if (!longestName || longestName->m_name.size() < nameLength)
+                for (auto& iter : shard.m_dictionary)
                 {
-                    longestName = nameData;
-                }
+                    Internal::NameData* nameData = iter.second.m_nameData;
+                    const size_t nameLength = nameData->m_name.size();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
 
-                if (!mostRepeatedName)
-                {
-                    mostRepeatedName = nameData;
-                }
-                else
-                {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    if (!longestName || longestName->m_name.size() < nameLength)
+                    {
+                        longestName = nameData;
+                    }
+
+                    if (!mostRepeatedName)
                     {
                         mostRepeatedName = nameData;
                     }
+                    else
+                    {
+                        const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
+                        const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
+                        if (currentIndividualSavings > mostIndividualSavings)
+                        {
+                            mostRepeatedName = nameData;
+                        }
+                    }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
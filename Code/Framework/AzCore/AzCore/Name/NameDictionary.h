@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
@@ -127,8 +128,19 @@ namespace AZ
             NameDictionary& m_nameDictionary;
         };
 
-        AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        //! The names are split in shards by hash, each guarded by its own lock, so that threads
+        //! making, finding or releasing names with different hashes rarely wait for each other.
+        struct Shard
+        {
+            AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
+            mutable AZStd::shared_mutex m_sharedMutex;
+        };
+        static constexpr size_t ShardCount = 32;
+
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+
+        AZStd::array<Shard, ShardCount> m_shards;
 
         //! A fixed Name used as the head of a linked list of Name literals.
         //! These literals can be static and have lifecycles not coupled to the name dictionary,
@@ -14,6 +14,7 @@
 #include <AzCore/Script/ScriptProperty.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/string/conversions.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/Serialization/Locale.h>
 #include <AzCore/IO/GenericStreams.h>
@@ -3435,6 +3436,50 @@ LUA_API const Node* lua_getDummyNode()
             return result;
         }
 
+        //! Arguments of a call from Lua, only the ones in use are constructed.
+        //! A BehaviorArgument holds a function and a temp buffer, constructing the whole array on every call isn't free.
+        class LuaCallArguments
+        {
+        public:
+            // there's no limit inherently in BehaviorContext (as there is no document limit in C++), but the LY supported limits default to 40 for Lua, ScriptCanvas, and ScriptEvents.
+            // this limit of 40 is however implicit, for now.
+            static constexpr int MaxArguments = 40;
+
+            explicit LuaCallArguments(int count)
+                : m_count(count)
+            {
+                AZ_Assert(m_count <= MaxArguments, "Increase the argument array size!");
+                for (int i = 0; i < m_count; ++i)
+                {
+                    new (&Data()[i]) BehaviorArgument();
+                }
+            }
+
+            ~LuaCallArguments()
+            {
+                for (int i = 0; i < m_count; ++i)
+                {
+                    Data()[i].~BehaviorArgument();
+                }
+            }
+
+            BehaviorArgument* Data()
+            {
+                return reinterpret_cast<BehaviorArgument*>(&m_storage);
+            }
+
+            BehaviorArgument& operator[](int index)
+            {
+                return Data()[index];
+            }
+
+        private:
+            AZ_DISABLE_COPY_MOVE(LuaCallArguments);
+
+            AZStd::aligned_storage_t<sizeof(BehaviorArgument) * MaxArguments, alignof(BehaviorArgument)> m_storage;
+            int m_count;
+        };
+
         class LuaScriptCaller : public LuaCaller
         {
         public:
@@ -3500,17 +3545,13 @@ LUA_API const Node* lua_getDummyNode()
                     return 0;
                 }
 
-                // there's no limit inherently in BehaviorContext (as there is no document limit in C++), but the LY supported limits default to 40 for Lua, ScriptCanvas, and ScriptEvents.
-                // this limit of 40 is however implicit, for now.
-                BehaviorArgument arguments[40];
+                int numArguments = GetMin(static_cast<int>(thisPtr->m_method->GetNumArguments()), numElementsOnStack);
+                LuaCallArguments arguments(numArguments);
                 BehaviorArgument result;
                 ScriptContext::StackVariableAllocator tempData;
                 AZStd::allocator backupAllocator;
                 bool usedBackupAlloc  = false;
 
-                int numArguments = GetMin(static_cast<int>(thisPtr->m_method->GetNumArguments()), numElementsOnStack);
-                AZ_Assert(static_cast<int>(AZ_ARRAY_SIZE(arguments)) >= numArguments, "Increase the argument array size!");
-
                 // for each argument read a variable from the stack to a BehaviorArgument
                 for (int i = 0; i < numArguments; ++i)
                 {
@@ -3533,6 +3574,17 @@ LUA_API const Node* lua_getDummyNode()
                 }
                 int numResults = 0;
 
+                // Gathers what the result callback needs behind one pointer, so the callback fits in the function's
+                // small object storage and setting it doesn't allocate.
+                struct ResultPush
+                {
+                    LuaScriptCaller* m_caller;
+                    lua_State* m_lua;
+                    BehaviorArgument* m_result;
+                    int* m_numResults;
+                };
+                ResultPush resultPush{ thisPtr, lua, &result, &numResults };
+
                 if (thisPtr->m_resultToLua)
                 {
                     result.Set(*thisPtr->m_method->GetResult());
@@ -3543,17 +3595,17 @@ LUA_API const Node* lua_getDummyNode()
                     }
 
                     // TODO: Make it optional for EBuses only, make it light weight too, probably a virtual function for the store result.
-                    result.m_onAssignedResult = AZStd::function<void()>([&]()
+                    result.m_onAssignedResult = AZStd::function<void()>([push = &resultPush]()
                     {
-                        if (result.m_value)
+                        if (push->m_result->m_value)
                         {
-                            thisPtr->m_resultToLua(lua, result);
-                            ++numResults;
+                            push->m_caller->m_resultToLua(push->m_lua, *push->m_result);
+                            ++*push->m_numResults;
                         }
                     });
                 }
 
-                bool isCalled = thisPtr->m_method->Call(arguments, numArguments, thisPtr->m_resultToLua ? &result : nullptr);
+                bool isCalled = thisPtr->m_method->Call(arguments.Data(), numArguments, thisPtr->m_resultToLua ? &result : nullptr);
 
                 if (!isCalled)
                 {
@@ -5910,6 +5962,20 @@ LUA_API const Node* lua_getDummyNode()
         lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    void ScriptContext::SetGenerationalGarbageCollection(bool enabled)
+    {
+        // zero parameters keep the current tuning of the mode
+        if (enabled)
+        {
+            lua_gc(m_impl->m_lua, LUA_GCGEN, 0, 0);
+        }
+        else
+        {
+            lua_gc(m_impl->m_lua, LUA_GCINC, 0, 0, 0);
+        }
+    }
+
     //////////////////////////////////////////////////////////////////////////
     size_t ScriptContext::GetMemoryUsage() const
     {
@@ -868,6 +868,13 @@ namespace AZ
          */
         void GarbageCollectStep(int numberOfSteps = 2);
 
+        /**
+         * Switch the garbage collector between Lua's incremental mode, the default, and its generational mode. The generational
+         * mode collects the short lived objects scripts create every frame in frequent minor collections, which avoids the long
+         * incremental cycles over the whole heap that contexts with many scripts otherwise go through.
+         */
+        void SetGenerationalGarbageCollection(bool enabled);
+
         lua_State* NativeContext();
 
         //////////////////////////////////////////////////////////////////////////
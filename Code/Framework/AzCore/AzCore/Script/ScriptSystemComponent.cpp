@@ -15,6 +15,8 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Debug/ProfilerReflection.h>
 #include <AzCore/Debug/TraceReflection.h>
 #include <AzCore/IO/FileIO.h>
@@ -47,6 +49,9 @@ namespace AZ
  *      If the script was loaded by a ScriptComponent, Load will be called once reload is complete.
  */
 
+AZ_CVAR(bool, script_generationalGarbageCollection, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Use Lua's generational garbage collector in the script contexts instead of the incremental one.");
+
 namespace LocalTU_ScriptSystemComponent {
     // Called when a module has already been loaded
     static int LuaRequireLoadedModule(lua_State* l)
@@ -150,6 +155,7 @@ ScriptContext*  ScriptSystemComponent::AddContext(ScriptContext* context, int ga
         cc.m_context = context;
         cc.m_isOwner = false;
         cc.m_garbageCollectorSteps = garbageCollectorStep < 1 ? m_defaultGarbageCollectorSteps : garbageCollectorStep;
+        cc.m_heapCounterName = AZStd::wstring::format(L"Script/Context %u/Heap", context->GetId());
 
         if (context->GetId() != ScriptContextIds::CryScriptContextId)
         {
@@ -183,6 +189,7 @@ ScriptContext* ScriptSystemComponent::AddContextWithId(ScriptContextId id)
     cc.m_context = aznew ScriptContext(id);
     cc.m_isOwner = true;
     cc.m_garbageCollectorSteps = m_defaultGarbageCollectorSteps;
+    cc.m_heapCounterName = AZStd::wstring::format(L"Script/Context %u/Heap", id);
     cc.m_context->SetRequireHook(
         [this](lua_State* lua, ScriptContext* context, const char* module) -> int
         {
@@ -310,7 +317,18 @@ void    ScriptSystemComponent::OnSystemTick()
             contextContainer.m_context->GetDebugContext()->ProcessDebugCommands();
         }
 
-        contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        // the mode is switched here, so the console variable also applies to running contexts
+        if (contextContainer.m_isGenerationalGarbageCollection != script_generationalGarbageCollection)
+        {
+            contextContainer.m_isGenerationalGarbageCollection = script_generationalGarbageCollection;
+            contextContainer.m_context->SetGenerationalGarbageCollection(contextContainer.m_isGenerationalGarbageCollection);
+        }
+
+        {
+            AZ_PROFILE_SCOPE(AzCore, "ScriptSystemComponent::GarbageCollectStep context %u", contextContainer.m_context->GetId());
+            contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        }
+        AZ_PROFILE_DATAPOINT(AzCore, contextContainer.m_context->GetMemoryUsage(), contextContainer.m_heapCounterName.c_str());
     }
 }
 
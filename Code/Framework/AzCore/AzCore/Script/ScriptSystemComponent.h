@@ -13,6 +13,7 @@
 #include <AzCore/Script/ScriptSystemBus.h>
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetTypeInfoBus.h>
+#include <AzCore/std/string/string.h>
 
 namespace AZ
 {
@@ -130,6 +131,8 @@ namespace AZ
             ScriptContext* m_context = nullptr;
             bool m_isOwner = true;
             int m_garbageCollectorSteps = 0;
+            bool m_isGenerationalGarbageCollection = false;
+            AZStd::wstring m_heapCounterName;
             AZStd::unordered_map<Uuid, LoadedScriptInfo> m_loadedScripts;
             AZStd::unordered_map<Uuid, Data::Asset<ScriptAsset>> m_trackedScripts;
             AZStd::recursive_mutex m_loadedScriptsMutex;
@@ -147,6 +150,8 @@ namespace AZ
                 m_context = rhs.m_context;
                 m_isOwner = rhs.m_isOwner;
                 m_garbageCollectorSteps = rhs.m_garbageCollectorSteps;
+                m_isGenerationalGarbageCollection = rhs.m_isGenerationalGarbageCollection;
+                m_heapCounterName = AZStd::move(rhs.m_heapCounterName);
 
                 {
                     AZStd::lock_guard<AZStd::recursive_mutex> myLock(m_loadedScriptsMutex);
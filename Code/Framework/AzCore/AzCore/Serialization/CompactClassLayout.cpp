@@ -0,0 +1,501 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Serialization/CompactClassLayout.h>
+#include <AzCore/Serialization/DynamicSerializableField.h>
+
+namespace AZ
+{
+    namespace CompactClassLayoutInternal
+    {
+        struct PodType
+        {
+            Uuid m_typeId;
+            size_t m_size;
+        };
+
+        //! Types with a serializer that stores them as their raw bytes, so they can be copied directly.
+        static size_t GetPodSize(const Uuid& typeId)
+        {
+            static const PodType podTypes[] = {
+                { azrtti_typeid<bool>(), sizeof(bool) },
+                { azrtti_typeid<char>(), sizeof(char) },
+                { azrtti_typeid<s8>(), sizeof(s8) },
+                { azrtti_typeid<u8>(), sizeof(u8) },
+                { azrtti_typeid<s16>(), sizeof(s16) },
+                { azrtti_typeid<u16>(), sizeof(u16) },
+                { azrtti_typeid<s32>(), sizeof(s32) },
+                { azrtti_typeid<u32>(), sizeof(u32) },
+                { azrtti_typeid<long>(), sizeof(long) },
+                { azrtti_typeid<unsigned long>(), sizeof(unsigned long) },
+                { azrtti_typeid<s64>(), sizeof(s64) },
+                { azrtti_typeid<u64>(), sizeof(u64) },
+                { azrtti_typeid<float>(), sizeof(float) },
+                { azrtti_typeid<double>(), sizeof(double) },
+                { azrtti_typeid<Uuid>(), sizeof(Uuid) },
+            };
+
+            for (const PodType& podType : podTypes)
+            {
+                if (podType.m_typeId == typeId)
+                {
+                    return podType.m_size;
+                }
+            }
+            return 0;
+        }
+
+        static bool IsSupportedClass(const SerializeContext::ClassData& classData)
+        {
+            return !classData.IsDeprecated() &&
+                !classData.m_doSave &&
+                classData.m_typeId != azrtti_typeid<DynamicSerializableField>() &&
+                classData.FindAttribute(SerializeContextAttributes::ObjectStreamWriteElementOverride) == nullptr;
+        }
+
+        static const SerializeContext::ClassData* FindElementClassData(const SerializeContext& serializeContext,
+            const SerializeContext::ClassElement& element, const SerializeContext::ClassData* parent)
+        {
+            return element.m_genericClassInfo
+                ? element.m_genericClassInfo->GetClassData()
+                : serializeContext.FindClassData(element.m_typeId, parent, element.m_nameCrc);
+        }
+
+        template<typename T>
+        static void AddToFingerprint(Crc32& fingerprint, const T& value)
+        {
+            fingerprint.Add(&value, sizeof(T));
+        }
+
+        template<typename T>
+        static void Write(AZStd::vector<u8>& buffer, const T& value)
+        {
+            const u8* bytes = reinterpret_cast<const u8*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<typename T>
+        static bool Read(T& value, const u8*& cursor, const u8* end)
+        {
+            if (aznumeric_cast<size_t>(end - cursor) < sizeof(T))
+            {
+                return false;
+            }
+            memcpy(&value, cursor, sizeof(T));
+            cursor += sizeof(T);
+            return true;
+        }
+    } // namespace CompactClassLayoutInternal
+
+    //
+    // CompactClassLayout
+    //
+
+    bool CompactClassLayout::Save(const void* instance, AZStd::vector<u8>& buffer) const
+    {
+        using namespace CompactClassLayoutInternal;
+
+        void* mutableInstance = const_cast<void*>(instance);
+        if (m_classData->m_eventHandler)
+        {
+            m_classData->m_eventHandler->OnReadBegin(mutableInstance);
+        }
+
+        bool result = true;
+        const u8* base = reinterpret_cast<const u8*>(instance);
+        for (const Op& op : m_ops)
+        {
+            const u8* data = base + op.m_offset;
+            switch (op.m_type)
+            {
+            case OpType::PodRun:
+                buffer.insert(buffer.end(), data, data + op.m_size);
+                break;
+            case OpType::Serializer:
+            {
+                size_t sizeOffset = buffer.size();
+                Write(buffer, u32{ 0 });
+                IO::ByteContainerStream<AZStd::vector<u8>> stream(&buffer);
+                stream.Seek(0, IO::GenericStream::ST_SEEK_END);
+                size_t size = op.m_classData->m_serializer->Save(data, stream, false);
+                if (size > AZStd::numeric_limits<u32>::max())
+                {
+                    result = false;
+                    break;
+                }
+                u32 storedSize = aznumeric_cast<u32>(size);
+                memcpy(buffer.data() + sizeOffset, &storedSize, sizeof(storedSize));
+                break;
+            }
+            case OpType::Class:
+                result = op.m_layout->Save(data, buffer);
+                break;
+            case OpType::Container:
+            {
+                void* container = const_cast<u8*>(data);
+                SerializeContext::IEventHandler* eventHandler = op.m_classData->m_eventHandler;
+                if (eventHandler)
+                {
+                    eventHandler->OnReadBegin(container);
+                }
+
+                SerializeContext::IDataContainer* dataContainer = op.m_classData->m_container;
+                size_t count = dataContainer->Size(container);
+                bool isHeterogeneous = op.m_elements.size() > 1;
+                if (count > AZStd::numeric_limits<u32>::max() || (isHeterogeneous && count != op.m_elements.size()))
+                {
+                    // Containers such as variants only store one of their element types and can't use the compact format.
+                    result = false;
+                }
+                else
+                {
+                    Write(buffer, aznumeric_cast<u32>(count));
+                    size_t index = 0;
+                    dataContainer->EnumElements(container,
+                        [&](void* element, const Uuid&, const SerializeContext::ClassData*, const SerializeContext::ClassElement*)
+                        {
+                            const ContainerElement& elementInfo = op.m_elements[isHeterogeneous ? index : 0];
+                            ++index;
+                            result = index <= count && elementInfo.m_layout->Save(element, buffer);
+                            return result;
+                        });
+                    result = result && index == count;
+                }
+
+                if (eventHandler)
+                {
+                    eventHandler->OnReadEnd(container);
+                }
+                break;
+            }
+            }
+
+            if (!result)
+            {
+                break;
+            }
+        }
+
+        if (m_classData->m_eventHandler)
+        {
+            m_classData->m_eventHandler->OnReadEnd(mutableInstance);
+        }
+        return result;
+    }
+
+    bool CompactClassLayout::Load(void* instance, const u8*& cursor, const u8* end, SerializeContext& serializeContext,
+        const Data::AssetFilterCB& assetFilter) const
+    {
+        using namespace CompactClassLayoutInternal;
+
+        if (m_classData->m_eventHandler)
+        {
+            m_classData->m_eventHandler->OnWriteBegin(instance);
+        }
+
+        bool result = true;
+        u8* base = reinterpret_cast<u8*>(instance);
+        for (const Op& op : m_ops)
+        {
+            u8* data = base + op.m_offset;
+            switch (op.m_type)
+            {
+            case OpType::PodRun:
+                if (aznumeric_cast<size_t>(end - cursor) < op.m_size)
+                {
+                    result = false;
+                    break;
+                }
+                memcpy(data, cursor, op.m_size);
+                cursor += op.m_size;
+                break;
+            case OpType::Serializer:
+            {
+                u32 size = 0;
+                if (!Read(size, cursor, end) || aznumeric_cast<size_t>(end - cursor) < size)
+                {
+                    result = false;
+                    break;
+                }
+                IO::MemoryStream stream(cursor, size);
+                if (op.m_isAssetReference)
+                {
+                    result = static_cast<AssetSerializer*>(op.m_classData->m_serializer.get())->LoadWithFilter(
+                        data, stream, op.m_classData->m_version, assetFilter);
+                }
+                else
+                {
+                    result = op.m_classData->m_serializer->Load(data, stream, op.m_classData->m_version);
+                }
+                cursor += size;
+                break;
+            }
+            case OpType::Class:
+                result = op.m_layout->Load(data, cursor, end, serializeContext, assetFilter);
+                break;
+            case OpType::Container:
+            {
+                SerializeContext::IEventHandler* eventHandler = op.m_classData->m_eventHandler;
+                if (eventHandler)
+                {
+                    eventHandler->OnWriteBegin(data);
+                }
+
+                SerializeContext::IDataContainer* dataContainer = op.m_classData->m_container;
+                dataContainer->ClearElements(data, &serializeContext);
+
+                u32 count = 0;
+                bool isHeterogeneous = op.m_elements.size() > 1;
+                result = Read(count, cursor, end) && (!isHeterogeneous || count == op.m_elements.size());
+                for (u32 i = 0; result && i < count; ++i)
+                {
+                    const ContainerElement& elementInfo = op.m_elements[isHeterogeneous ? i : 0];
+                    void* element = dataContainer->ReserveElement(data, elementInfo.m_classElement);
+                    if (!element)
+                    {
+                        result = false;
+                        break;
+                    }
+                    if (!elementInfo.m_layout->Load(element, cursor, end, serializeContext, assetFilter))
+                    {
+                        dataContainer->FreeReservedElement(data, element, &serializeContext);
+                        result = false;
+                        break;
+                    }
+                    dataContainer->StoreElement(data, element);
+                }
+
+                if (eventHandler)
+                {
+                    eventHandler->OnWriteEnd(data);
+                    eventHandler->OnLoadedFromObjectStream(data);
+                }
+                break;
+            }
+            }
+
+            if (!result)
+            {
+                break;
+            }
+        }
+
+        if (m_classData->m_eventHandler)
+        {
+            m_classData->m_eventHandler->OnWriteEnd(instance);
+            m_classData->m_eventHandler->OnLoadedFromObjectStream(instance);
+        }
+        return result;
+    }
+
+    //
+    // CompactClassLayoutCache
+    //
+
+    const CompactClassLayout* CompactClassLayoutCache::GetLayout(const SerializeContext& serializeContext,
+        const SerializeContext::ClassData& classData)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+
+        BuildList buildList;
+        const CompactClassLayout* layout = GetOrBuildLayout(serializeContext, classData, buildList);
+        if (!layout)
+        {
+            // Layouts built along the way may refer to layouts that failed, so none of them can be kept. Failures
+            // aren't cached because reflecting more classes can make a layout possible.
+            for (const Uuid& typeId : buildList)
+            {
+                m_layouts.erase(typeId);
+            }
+        }
+        return layout;
+    }
+
+    void CompactClassLayoutCache::Clear()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_layouts.clear();
+    }
+
+    const CompactClassLayout* CompactClassLayoutCache::GetOrBuildLayout(const SerializeContext& serializeContext,
+        const SerializeContext::ClassData& classData, BuildList& buildList)
+    {
+        using namespace CompactClassLayoutInternal;
+
+        auto it = m_layouts.find(classData.m_typeId);
+        if (it != m_layouts.end())
+        {
+            return it->second.get();
+        }
+
+        if (!IsSupportedClass(classData))
+        {
+            return nullptr;
+        }
+
+        // The layout is registered before its ops are added so containers that recursively store the class can refer to it.
+        CompactClassLayout* layout = m_layouts.emplace(classData.m_typeId, AZStd::make_unique<CompactClassLayout>()).first->second.get();
+        buildList.push_back(classData.m_typeId);
+        layout->m_classData = &classData;
+
+        Crc32 fingerprint;
+        if (!AppendOps(serializeContext, classData, 0, true, *layout, fingerprint, buildList))
+        {
+            return nullptr;
+        }
+        layout->m_fingerprint = fingerprint;
+        layout->m_isComplete = true;
+        return layout;
+    }
+
+    bool CompactClassLayoutCache::AppendOps(const SerializeContext& serializeContext, const SerializeContext::ClassData& classData,
+        size_t offset, bool isLayoutClass, CompactClassLayout& layout, Crc32& fingerprint, BuildList& buildList)
+    {
+        using namespace CompactClassLayoutInternal;
+        using Op = CompactClassLayout::Op;
+        using OpType = CompactClassLayout::OpType;
+
+        if (!IsSupportedClass(classData))
+        {
+            return false;
+        }
+
+        AddToFingerprint(fingerprint, classData.m_typeId);
+        AddToFingerprint(fingerprint, classData.m_version);
+        AddToFingerprint(fingerprint, offset);
+
+        // Classes with an event handler need to be notified around their data, so they can't be flattened.
+        if (!isLayoutClass && classData.m_eventHandler)
+        {
+            const CompactClassLayout* nested = GetOrBuildLayout(serializeContext, classData, buildList);
+            if (!nested)
+            {
+                return false;
+            }
+            Op& op = layout.m_ops.emplace_back();
+            op.m_type = OpType::Class;
+            op.m_offset = offset;
+            op.m_classData = &classData;
+            op.m_layout = nested;
+            AddToFingerprint(fingerprint, nested->m_fingerprint);
+            return true;
+        }
+
+        if (classData.m_serializer)
+        {
+            if (size_t podSize = GetPodSize(classData.m_typeId); podSize != 0)
+            {
+                if (!layout.m_ops.empty() && layout.m_ops.back().m_type == OpType::PodRun &&
+                    layout.m_ops.back().m_offset + layout.m_ops.back().m_size == offset)
+                {
+                    layout.m_ops.back().m_size += podSize;
+                }
+                else
+                {
+                    Op& op = layout.m_ops.emplace_back();
+                    op.m_type = OpType::PodRun;
+                    op.m_offset = offset;
+                    op.m_size = podSize;
+                }
+            }
+            else
+            {
+                const GenericClassInfo* genericInfo = serializeContext.FindGenericClassInfo(classData.m_typeId);
+                Op& op = layout.m_ops.emplace_back();
+                op.m_type = OpType::Serializer;
+                op.m_offset = offset;
+                op.m_classData = &classData;
+                op.m_isAssetReference = genericInfo && genericInfo->GetGenericTypeId() == GetAssetClassId();
+            }
+            return true;
+        }
+
+        if (classData.m_container)
+        {
+            return AppendContainerOp(serializeContext, classData, offset, layout, fingerprint, buildList);
+        }
+
+        for (const SerializeContext::ClassElement& element : classData.m_elements)
+        {
+            if (element.m_flags & (SerializeContext::ClassElement::FLG_POINTER | SerializeContext::ClassElement::FLG_DYNAMIC_FIELD))
+            {
+                return false;
+            }
+
+            const SerializeContext::ClassData* elementClassData = FindElementClassData(serializeContext, element, &classData);
+            if (!elementClassData)
+            {
+                return false;
+            }
+
+            AddToFingerprint(fingerprint, element.m_nameCrc);
+            if (!AppendOps(serializeContext, *elementClassData, offset + element.m_offset, false, layout, fingerprint, buildList))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool CompactClassLayoutCache::AppendContainerOp(const SerializeContext& serializeContext, const SerializeContext::ClassData& classData,
+        size_t offset, CompactClassLayout& layout, Crc32& fingerprint, BuildList& buildList)
+    {
+        using namespace CompactClassLayoutInternal;
+
+        SerializeContext::IDataContainer* dataContainer = classData.m_container;
+        if (dataContainer->IsSmartPointer())
+        {
+            return false;
+        }
+
+        CompactClassLayout::Op op;
+        op.m_type = CompactClassLayout::OpType::Container;
+        op.m_offset = offset;
+        op.m_classData = &classData;
+
+        bool result = true;
+        dataContainer->EnumTypes(
+            [&](const Uuid&, const SerializeContext::ClassElement* classElement)
+            {
+                const SerializeContext::ClassData* elementClassData = classElement && (classElement->m_flags & SerializeContext::ClassElement::FLG_POINTER) == 0
+                    ? FindElementClassData(serializeContext, *classElement, &classData)
+                    : nullptr;
+                const CompactClassLayout* elementLayout = elementClassData
+                    ? GetOrBuildLayout(serializeContext, *elementClassData, buildList)
+                    : nullptr;
+                if (!elementLayout)
+                {
+                    result = false;
+                    return false;
+                }
+
+                op.m_elements.push_back({ classElement, elementLayout });
+                AddToFingerprint(fingerprint, classElement->m_nameCrc);
+                AddToFingerprint(fingerprint, elementClassData->m_typeId);
+                if (elementLayout->m_isComplete)
+                {
+                    AddToFingerprint(fingerprint, elementLayout->m_fingerprint);
+                }
+                return true;
+            });
+
+        // Containers without type restrictions are recorded element by element in the regular formats. Containers with
+        // multiple element types are only supported if they always store one element of each type.
+        if (!result || op.m_elements.empty() ||
+            (op.m_elements.size() > 1 && !(dataContainer->IsFixedSize() && dataContainer->CanAccessElementsByIndex())))
+        {
+            return false;
+        }
+
+        layout.m_ops.push_back(AZStd::move(op));
+        return true;
+    }
+} // namespace AZ
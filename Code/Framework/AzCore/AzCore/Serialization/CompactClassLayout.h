@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    //! Flat description of how an instance of a reflected class is stored in the compact binary ObjectStream format
+    //! (DataStream::ST_BINARY_COMPACT). Layouts are precompiled from the ClassData in a SerializeContext: the members
+    //! of a class and its bases are flattened into a list of operations with offsets relative to the instance, and
+    //! neighboring plain-old-data members are merged into runs that are copied with a single memcpy. Loading with a
+    //! layout doesn't need to look up elements by name or type, convert versions or allocate per element.
+    //!
+    //! The stored data is native endian and only valid for the exact reflection it was saved with, which is checked
+    //! through the layout fingerprint. It's intended for cooked data that's rebuilt when the reflection changes.
+    class CompactClassLayout
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompactClassLayout, SystemAllocator);
+
+        enum class OpType : u8
+        {
+            PodRun,     //!< m_size bytes stored as is.
+            Serializer, //!< Stored through the IDataSerializer of m_classData with a size prefix.
+            Class,      //!< Class that has an event handler and is stored through m_layout.
+            Container,  //!< Stored through the IDataContainer of m_classData with m_elements describing the elements.
+        };
+
+        struct ContainerElement
+        {
+            const SerializeContext::ClassElement* m_classElement{ nullptr };
+            const CompactClassLayout* m_layout{ nullptr };
+        };
+
+        struct Op
+        {
+            OpType m_type{ OpType::PodRun };
+            bool m_isAssetReference{ false };
+            size_t m_offset{ 0 };
+            size_t m_size{ 0 };
+            const SerializeContext::ClassData* m_classData{ nullptr };
+            const CompactClassLayout* m_layout{ nullptr };
+            //! Containers with a single element type store any number of elements. Containers with multiple element
+            //! types, such as pairs and tuples, store exactly one element of each type in order.
+            AZStd::vector<ContainerElement> m_elements;
+        };
+
+        const SerializeContext::ClassData* GetClassData() const { return m_classData; }
+        const AZStd::vector<Op>& GetOps() const { return m_ops; }
+        //! Hash of the reflected types, names, versions and offsets the layout was built from.
+        u32 GetFingerprint() const { return m_fingerprint; }
+
+        //! Appends the instance to the buffer. Returns false if the instance contains data the format can't store,
+        //! in which case the content of the buffer past its original size is undefined.
+        bool Save(const void* instance, AZStd::vector<u8>& buffer) const;
+        //! Loads an instance stored with Save into an already constructed object. On success cursor is moved past
+        //! the consumed data.
+        bool Load(void* instance, const u8*& cursor, const u8* end, SerializeContext& serializeContext,
+            const Data::AssetFilterCB& assetFilter) const;
+
+    private:
+        friend class CompactClassLayoutCache;
+
+        const SerializeContext::ClassData* m_classData{ nullptr };
+        AZStd::vector<Op> m_ops;
+        u32 m_fingerprint{ 0 };
+        //! Set once all ops have been added. Layouts can refer to unfinished layouts through recursive containers.
+        bool m_isComplete{ false };
+    };
+
+    //! Cache of the compact layouts for the classes in a SerializeContext. Layouts are built on first use and kept
+    //! until the reflection of a class is removed.
+    class CompactClassLayoutCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompactClassLayoutCache, SystemAllocator);
+
+        //! Returns the layout for the class, building it if needed. Returns null if the class uses features the
+        //! compact format doesn't support, such as pointers, dynamic fields or custom save filters.
+        const CompactClassLayout* GetLayout(const SerializeContext& serializeContext, const SerializeContext::ClassData& classData);
+        void Clear();
+
+    private:
+        using BuildList = AZStd::vector<Uuid>;
+
+        const CompactClassLayout* GetOrBuildLayout(const SerializeContext& serializeContext,
+            const SerializeContext::ClassData& classData, BuildList& buildList);
+        bool AppendOps(const SerializeContext& serializeContext, const SerializeContext::ClassData& classData, size_t offset,
+            bool isLayoutClass, CompactClassLayout& layout, Crc32& fingerprint, BuildList& buildList);
+        bool AppendContainerOp(const SerializeContext& serializeContext, const SerializeContext::ClassData& classData,
+            size_t offset, CompactClassLayout& layout, Crc32& fingerprint, BuildList& buildList);
+
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<Uuid, AZStd::unique_ptr<CompactClassLayout>> m_layouts;
+    };
+} // namespace AZ
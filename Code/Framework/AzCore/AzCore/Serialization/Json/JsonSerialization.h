@@ -20,6 +20,11 @@ namespace AZ
     class BaseJsonSerializer;
 
     struct JsonImportSettings;
+
+    namespace IO
+    {
+        class GenericStream;
+    }
     
     enum class JsonMergeApproach
     {
@@ -177,6 +182,38 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& objectType, const rapidjson::Value& root, JsonDeserializerSettings& settings);
 
+        //! Loads the data from json text in the provided stream into the supplied object while the text is being parsed, without
+        //! first creating a document for the entire text. This reduces the memory needed to load large files. The results are
+        //! the same as for Load, except that data read before a parse error was found will remain in the object.
+        //! The object is expected to be created before calling load.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream to read the json text from, starting at the current position.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadStreaming(
+            T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from json text in the provided stream into the supplied object while the text is being parsed.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream to read the json text from, starting at the current position.
+        //! @param settings Additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadStreaming(T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+        //! Loads the data from json text in the provided stream into the supplied object while the text is being parsed.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream to read the json text from, starting at the current position.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadStreaming(
+            void* object, const Uuid& objectType, IO::GenericStream& stream,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from json text in the provided stream into the supplied object while the text is being parsed.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream to read the json text from, starting at the current position.
+        //! @param settings Additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadStreaming(
+            void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+
         //! Loads the type id from the provided input.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -359,6 +396,20 @@ namespace AZ
         return Load(&object, azrtti_typeid(object), root, settings);
     }
 
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadStreaming(
+        T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings)
+    {
+        return LoadStreaming(&object, azrtti_typeid(object), stream, settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadStreaming(
+        T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings)
+    {
+        return LoadStreaming(&object, azrtti_typeid(object), stream, settings);
+    }
+
     template<typename T>
     JsonSerializationResult::ResultCode JsonSerialization::Store(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const T& object, const JsonSerializerSettings& settings)
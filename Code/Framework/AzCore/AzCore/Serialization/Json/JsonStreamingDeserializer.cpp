@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/JSON/reader.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/Serialization/Json/JsonStreamingDeserializer.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+
+namespace AZ
+{
+    namespace JsonStreamingDeserializerInternal
+    {
+        //! rapidjson input stream that reads from a GenericStream in blocks so the json text doesn't need to be fully loaded.
+        class GenericStreamReader final
+        {
+        public:
+            using Ch = char;
+
+            explicit GenericStreamReader(IO::GenericStream& stream)
+                : m_stream(stream)
+            {
+                Read();
+            }
+
+            Ch Peek() const
+            {
+                return *m_current;
+            }
+
+            Ch Take()
+            {
+                Ch result = *m_current;
+                Read();
+                return result;
+            }
+
+            size_t Tell() const
+            {
+                return m_count + aznumeric_cast<size_t>(m_current - m_buffer);
+            }
+
+            // The stream is read-only. rapidjson only calls these for in-situ parsing.
+            Ch* PutBegin()
+            {
+                AZ_Assert(false, "GenericStreamReader doesn't support in-situ parsing.");
+                return nullptr;
+            }
+            void Put(Ch)
+            {
+                AZ_Assert(false, "GenericStreamReader doesn't support in-situ parsing.");
+            }
+            void Flush()
+            {
+                AZ_Assert(false, "GenericStreamReader doesn't support in-situ parsing.");
+            }
+            size_t PutEnd(Ch*)
+            {
+                AZ_Assert(false, "GenericStreamReader doesn't support in-situ parsing.");
+                return 0;
+            }
+
+        private:
+            void Read()
+            {
+                if (m_current < m_bufferLast)
+                {
+                    ++m_current;
+                }
+                else if (!m_isEndOfStream)
+                {
+                    m_count += m_readCount;
+                    m_readCount = aznumeric_cast<size_t>(m_stream.Read(BufferSize, m_buffer));
+                    m_bufferLast = m_buffer + m_readCount - 1;
+                    m_current = m_buffer;
+
+                    if (m_readCount < BufferSize)
+                    {
+                        // The buffer has one additional character to store the terminator that rapidjson uses to detect the end.
+                        m_buffer[m_readCount] = '\0';
+                        ++m_bufferLast;
+                        m_isEndOfStream = true;
+                    }
+                }
+            }
+
+            static constexpr size_t BufferSize = 16 * 1024;
+
+            IO::GenericStream& m_stream;
+            Ch m_buffer[BufferSize + 1];
+            Ch* m_bufferLast{ nullptr };
+            Ch* m_current{ m_buffer };
+            size_t m_readCount{ 0 };
+            size_t m_count{ 0 };
+            bool m_isEndOfStream{ false };
+        };
+    } // namespace JsonStreamingDeserializerInternal
+
+    JsonStreamingDeserializer::JsonStreamingDeserializer(void* object, const Uuid& typeId, JsonDeserializerContext& context)
+        : m_context(context)
+        , m_rootObject(object)
+        , m_rootTypeId(typeId)
+    {
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Load(IO::GenericStream& stream)
+    {
+        using namespace JsonSerializationResult;
+
+        JsonStreamingDeserializerInternal::GenericStreamReader reader(stream);
+        rapidjson::Reader parser;
+        rapidjson::ParseResult parseResult = parser.Parse<rapidjson::kParseCommentsFlag>(reader, *this);
+        if (parseResult.IsError() && !m_halted)
+        {
+            m_result = m_context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                AZStd::string::format("JSON parse error at offset %zu: %s", parseResult.Offset(),
+                    rapidjson::GetParseError_En(parseResult.Code())));
+        }
+        return m_result;
+    }
+
+    bool JsonStreamingDeserializer::Null()
+    {
+        return AddScalar(rapidjson::Value(rapidjson::kNullType));
+    }
+
+    bool JsonStreamingDeserializer::Bool(bool value)
+    {
+        return AddScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Int(int value)
+    {
+        return AddScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Uint(unsigned value)
+    {
+        return AddScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Int64(int64_t value)
+    {
+        return AddScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Uint64(uint64_t value)
+    {
+        return AddScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Double(double value)
+    {
+        return AddScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::RawNumber(
+        [[maybe_unused]] const char* str, [[maybe_unused]] rapidjson::SizeType length, [[maybe_unused]] bool copy)
+    {
+        AZ_Assert(false, "Raw numbers are not supported by the streaming Json deserializer.");
+        return false;
+    }
+
+    bool JsonStreamingDeserializer::String(const char* str, rapidjson::SizeType length, [[maybe_unused]] bool copy)
+    {
+        if (m_skipDepth > 0 || (m_captureStack.empty() && m_pending == PendingValue::Skip))
+        {
+            // Avoid copying strings that are going to be ignored.
+            return AddScalar(rapidjson::Value(rapidjson::kNullType));
+        }
+        return AddScalar(rapidjson::Value(str, length, m_captureAllocator));
+    }
+
+    bool JsonStreamingDeserializer::StartObject()
+    {
+        if (m_skipDepth > 0)
+        {
+            ++m_skipDepth;
+            return true;
+        }
+        if (!m_captureStack.empty())
+        {
+            m_captureStack.emplace_back(rapidjson::kObjectType);
+            return true;
+        }
+
+        switch (m_pending)
+        {
+        case PendingValue::Skip:
+            m_skipDepth = 1;
+            return true;
+        case PendingValue::Root:
+            [[fallthrough]];
+        case PendingValue::Element:
+            if (const SerializeContext::ClassData* classData = FindStreamableClass(); classData)
+            {
+                ClassFrame& frame = m_frames.emplace_back();
+                frame.m_object = (m_pending == PendingValue::Root) ? m_rootObject : m_pendingObject;
+                frame.m_classData = classData;
+                m_pending = PendingValue::None;
+            }
+            else
+            {
+                m_captureStack.emplace_back(rapidjson::kObjectType);
+            }
+            return true;
+        default:
+            AZ_Assert(false, "Json object found where no value was expected.");
+            return false;
+        }
+    }
+
+    bool JsonStreamingDeserializer::Key(const char* str, rapidjson::SizeType length, [[maybe_unused]] bool copy)
+    {
+        using namespace JsonSerializationResult;
+
+        if (m_skipDepth > 0)
+        {
+            return true;
+        }
+        if (!m_captureStack.empty())
+        {
+            m_captureStack.emplace_back(str, length, m_captureAllocator);
+            return true;
+        }
+
+        AZ_Assert(!m_frames.empty() && m_pending == PendingValue::None, "Json key found outside of an object that's being loaded.");
+        ClassFrame& frame = m_frames.back();
+
+        AZStd::string_view name(str, length);
+        if (name == JsonSerialization::TypeIdFieldIdentifier)
+        {
+            m_pending = PendingValue::Skip;
+            m_skipHasPath = false;
+            return true;
+        }
+
+        Crc32 nameCrc(name);
+        JsonDeserializer::ElementDataResult foundElementData =
+            JsonDeserializer::FindElementByNameCrc(*m_context.GetSerializeContext(), frame.m_object, *frame.m_classData, nameCrc);
+
+        m_context.PushPath(name);
+        if (foundElementData.m_found)
+        {
+            m_pending = PendingValue::Element;
+            m_pendingObject = foundElementData.m_data;
+            m_pendingElement = foundElementData.m_info;
+        }
+        else
+        {
+            frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                "Skipping field as there's no matching variable in the target."));
+            m_pending = PendingValue::Skip;
+            m_skipHasPath = true;
+        }
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::EndObject(rapidjson::SizeType memberCount)
+    {
+        if (m_skipDepth > 0)
+        {
+            if (--m_skipDepth == 0)
+            {
+                CompleteSkip();
+            }
+            return true;
+        }
+        if (!m_captureStack.empty())
+        {
+            rapidjson::Value value(AZStd::move(m_captureStack.back()));
+            m_captureStack.pop_back();
+            return AddCapturedValue(AZStd::move(value));
+        }
+
+        AZ_Assert(!m_frames.empty(), "End of a json object found without a matching start.");
+        ClassFrame frame = m_frames.back();
+        m_frames.pop_back();
+        return CompleteClass(frame, memberCount);
+    }
+
+    bool JsonStreamingDeserializer::StartArray()
+    {
+        if (m_skipDepth > 0)
+        {
+            ++m_skipDepth;
+            return true;
+        }
+        if (m_captureStack.empty() && m_pending == PendingValue::Skip)
+        {
+            m_skipDepth = 1;
+            return true;
+        }
+        m_captureStack.emplace_back(rapidjson::kArrayType);
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::EndArray([[maybe_unused]] rapidjson::SizeType elementCount)
+    {
+        if (m_skipDepth > 0)
+        {
+            if (--m_skipDepth == 0)
+            {
+                CompleteSkip();
+            }
+            return true;
+        }
+
+        AZ_Assert(!m_captureStack.empty(), "End of a json array found without a matching start.");
+        rapidjson::Value value(AZStd::move(m_captureStack.back()));
+        m_captureStack.pop_back();
+        return AddCapturedValue(AZStd::move(value));
+    }
+
+    const SerializeContext::ClassData* JsonStreamingDeserializer::FindStreamableClass() const
+    {
+        // Mirrors the checks in JsonDeserializer::Load that lead to JsonDeserializer::LoadClass. Anything else is collected
+        // and passed to the regular deserializer so the behavior is identical.
+        void* object = m_rootObject;
+        Uuid typeId = m_rootTypeId;
+        if (m_pending == PendingValue::Element)
+        {
+            if (m_pendingElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+            {
+                return nullptr;
+            }
+            object = m_pendingObject;
+            typeId = m_pendingElement->m_typeId;
+        }
+        if (!object)
+        {
+            return nullptr;
+        }
+
+        const JsonRegistrationContext* registrationContext = m_context.GetRegistrationContext();
+        if (registrationContext->GetSerializerForType(typeId))
+        {
+            return nullptr;
+        }
+
+        const SerializeContext* serializeContext = m_context.GetSerializeContext();
+        const SerializeContext::ClassData* classData = serializeContext->FindClassData(typeId);
+        if (!classData || classData->m_container)
+        {
+            return nullptr;
+        }
+        if (classData->m_azRtti)
+        {
+            if (classData->m_azRtti->GetGenericTypeId() != typeId)
+            {
+                if ((classData->m_azRtti->GetTypeTraits() & (AZ::TypeTraits::is_signed | AZ::TypeTraits::is_unsigned)) !=
+                        AZ::TypeTraits{ 0 } &&
+                    serializeContext->GetUnderlyingTypeId(typeId) == classData->m_typeId)
+                {
+                    return nullptr;
+                }
+                if (registrationContext->GetSerializerForType(classData->m_azRtti->GetGenericTypeId()))
+                {
+                    return nullptr;
+                }
+            }
+            if ((classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum)
+            {
+                return nullptr;
+            }
+        }
+        return classData;
+    }
+
+    bool JsonStreamingDeserializer::AddScalar(rapidjson::Value&& value)
+    {
+        if (m_skipDepth > 0)
+        {
+            return true;
+        }
+        if (!m_captureStack.empty())
+        {
+            return AddCapturedValue(AZStd::move(value));
+        }
+        if (m_pending == PendingValue::Skip)
+        {
+            CompleteSkip();
+            return true;
+        }
+        return LoadCapturedValue(value);
+    }
+
+    bool JsonStreamingDeserializer::AddCapturedValue(rapidjson::Value&& value)
+    {
+        if (m_captureStack.empty())
+        {
+            return LoadCapturedValue(value);
+        }
+
+        rapidjson::Value& parent = m_captureStack.back();
+        if (parent.IsArray())
+        {
+            parent.PushBack(value, m_captureAllocator);
+            return true;
+        }
+
+        AZ_Assert(parent.IsString(), "Expected a key for the value in the captured json object.");
+        rapidjson::Value key(AZStd::move(parent));
+        m_captureStack.pop_back();
+        AZ_Assert(!m_captureStack.empty() && m_captureStack.back().IsObject(), "Expected a json object to add the captured member to.");
+        m_captureStack.back().AddMember(key, value, m_captureAllocator);
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::LoadCapturedValue(const rapidjson::Value& value)
+    {
+        JsonSerializationResult::ResultCode result = (m_pending == PendingValue::Root)
+            ? JsonDeserializer::Load(m_rootObject, m_rootTypeId, value, false, JsonDeserializer::UseTypeDeserializer::Yes, m_context)
+            : JsonDeserializer::LoadWithClassElement(m_pendingObject, value, *m_pendingElement, m_context);
+        // The values don't release their memory, so the pool can be cleared once the deserializer is done with them.
+        m_captureAllocator.Clear();
+        return CompleteValue(result);
+    }
+
+    bool JsonStreamingDeserializer::CompleteValue(JsonSerializationResult::ResultCode result)
+    {
+        using namespace JsonSerializationResult;
+
+        m_pending = PendingValue::None;
+        if (m_frames.empty())
+        {
+            m_result = result;
+            return true;
+        }
+
+        ClassFrame& frame = m_frames.back();
+        frame.m_result.Combine(result);
+        if (result.GetProcessing() == Processing::Halted)
+        {
+            return Halt(result);
+        }
+        else if (result.GetProcessing() != Processing::Altered)
+        {
+            frame.m_numLoads++;
+        }
+        m_context.PopPath();
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::CompleteClass(ClassFrame& frame, rapidjson::SizeType memberCount)
+    {
+        using namespace JsonSerializationResult;
+
+        if (memberCount == 0)
+        {
+            return CompleteValue(m_context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default."));
+        }
+
+        size_t elementCount = JsonDeserializer::CountElements(*m_context.GetSerializeContext(), *frame.m_classData);
+        if (elementCount > frame.m_numLoads)
+        {
+            frame.m_result.Combine(ResultCode(Tasks::ReadField, frame.m_numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+        }
+        return CompleteValue(frame.m_result);
+    }
+
+    void JsonStreamingDeserializer::CompleteSkip()
+    {
+        if (m_skipHasPath)
+        {
+            m_context.PopPath();
+            m_skipHasPath = false;
+        }
+        m_pending = PendingValue::None;
+    }
+
+    bool JsonStreamingDeserializer::Halt(JsonSerializationResult::ResultCode result)
+    {
+        // Unwind the same way the nested calls to JsonDeserializer::LoadClass would, with each class reporting the failure
+        // for the member it was loading.
+        while (!m_frames.empty())
+        {
+            result = m_context.Report(result, "Loading of element has failed.");
+            m_context.PopPath();
+            m_frames.pop_back();
+        }
+        m_result = result;
+        m_halted = true;
+        return false;
+    }
+} // namespace AZ
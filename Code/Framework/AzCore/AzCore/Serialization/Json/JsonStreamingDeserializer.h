@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/JSON/document.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonSerializationResult.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    //! Handler for a rapidjson::Reader that deserializes json into reflected objects while the json text is being parsed,
+    //! instead of first building a document for the entire file. Members of classes that are loaded through their reflected
+    //! fields are applied directly as the tokens arrive. Values that are handled by a json serializer, such as containers,
+    //! strings and math types, are collected into a small temporary rapidjson::Value and passed to the serializer as soon
+    //! as the value is complete, after which the memory used for the value is released again. This keeps memory usage
+    //! bounded by the largest individual serializer value rather than by the size of the file.
+    //! The reported results are the same as for JsonDeserializer, with the exception that data read before a parse error
+    //! was encountered remains applied to the object.
+    class JsonStreamingDeserializer final
+    {
+    public:
+        JsonStreamingDeserializer(void* object, const Uuid& typeId, JsonDeserializerContext& context);
+
+        //! Parses the json text from the stream and loads it into the object.
+        JsonSerializationResult::ResultCode Load(IO::GenericStream& stream);
+
+        // rapidjson::Reader handler interface.
+        bool Null();
+        bool Bool(bool value);
+        bool Int(int value);
+        bool Uint(unsigned value);
+        bool Int64(int64_t value);
+        bool Uint64(uint64_t value);
+        bool Double(double value);
+        bool RawNumber(const char* str, rapidjson::SizeType length, bool copy);
+        bool String(const char* str, rapidjson::SizeType length, bool copy);
+        bool StartObject();
+        bool Key(const char* str, rapidjson::SizeType length, bool copy);
+        bool EndObject(rapidjson::SizeType memberCount);
+        bool StartArray();
+        bool EndArray(rapidjson::SizeType elementCount);
+
+    private:
+        enum class PendingValue : u8
+        {
+            None,       //!< No value is expected, only keys or the end of the current object.
+            Root,       //!< The next value is the root of the document.
+            Element,    //!< The next value is loaded into a member of the class at the top of the frame stack.
+            Skip        //!< The next value is ignored.
+        };
+
+        //! An object in the json text that's being loaded directly into a reflected class.
+        struct ClassFrame
+        {
+            void* m_object{ nullptr };
+            const SerializeContext::ClassData* m_classData{ nullptr };
+            JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+            size_t m_numLoads{ 0 };
+        };
+
+        //! Returns the class data if the next value is an object that can be loaded member by member, otherwise null.
+        const SerializeContext::ClassData* FindStreamableClass() const;
+
+        bool AddScalar(rapidjson::Value&& value);
+        bool AddCapturedValue(rapidjson::Value&& value);
+        bool LoadCapturedValue(const rapidjson::Value& value);
+        bool CompleteValue(JsonSerializationResult::ResultCode result);
+        bool CompleteClass(ClassFrame& frame, rapidjson::SizeType memberCount);
+        void CompleteSkip();
+        bool Halt(JsonSerializationResult::ResultCode result);
+
+        JsonDeserializerContext& m_context;
+        void* m_rootObject;
+        Uuid m_rootTypeId;
+
+        AZStd::vector<ClassFrame> m_frames;
+        //! Values that are being collected for a json serializer. Keys are stored as strings on top of the object they belong to.
+        AZStd::vector<rapidjson::Value> m_captureStack;
+        rapidjson::Document::AllocatorType m_captureAllocator;
+        JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+
+        void* m_pendingObject{ nullptr };
+        const SerializeContext::ClassElement* m_pendingElement{ nullptr };
+        size_t m_skipDepth{ 0 };
+        PendingValue m_pending{ PendingValue::Root };
+        bool m_skipHasPath{ false };
+        bool m_halted{ false };
+    };
+} // namespace AZ
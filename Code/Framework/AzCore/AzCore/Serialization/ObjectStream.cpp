@@ -9,6 +9,7 @@
 #include <AzCore/RTTI/AttributeReader.h>
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Serialization/ObjectStream.h>
+#include <AzCore/Serialization/CompactClassLayout.h>
 #include <AzCore/Serialization/DataOverlayInstanceMsgs.h>
 #include <AzCore/Serialization/DataOverlayProviderMsgs.h>
 #include <AzCore/Serialization/DynamicSerializableField.h>
@@ -75,6 +76,8 @@ namespace AZ
         static const u8 s_binaryStreamTag = 0;
         static const u8 s_xmlStreamTag = '<';
         static const u8 s_jsonStreamTag = '{';
+        static const u8 s_compactBinaryStreamTag = 1;
+        static const u32 s_compactBinaryVersion = 1;
 
         class ObjectStreamImpl;
 
@@ -106,6 +109,14 @@ namespace AZ
                 ST_BINARYFLAG_ELEMENT_END       = 0
             };
 
+            // Every root object in a compact binary stream is stored as a record that starts with one of these.
+            enum CompactRecordType : u8
+            {
+                CRT_END             = 0,
+                CRT_LAYOUT          = 1, // Type id, layout fingerprint, size and the data stored through the CompactClassLayout.
+                CRT_OBJECT_STREAM   = 2, // Type id, size and a binary object stream, for types that don't have a compact layout.
+            };
+
             AZ_CLASS_ALLOCATOR(ObjectStreamImpl, SystemAllocator);
 
             ObjectStreamImpl(IO::GenericStream* stream, SerializeContext* sc, const ClassReadyCB& readyCB, const CompletionCB& doneCB, const FilterDescriptor& filterDesc = FilterDescriptor(), int flags = 0, const InplaceLoadRootInfoCB& inplaceLoadInfoCB = InplaceLoadRootInfoCB())
@@ -140,6 +151,8 @@ namespace AZ
             void SkipElement();
 
             bool WriteClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData) override;
+            bool WriteCompactClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData);
+            bool LoadCompactClasses();
             bool WriteElement(const void* elemPtr, const SerializeContext::ClassData* classData, const SerializeContext::ClassElement* classElement);
             bool CloseElement();
 
@@ -236,6 +249,7 @@ namespace AZ
             AZStd::vector<char> m_buffer2;
             IO::ByteContainerStream<AZStd::vector<char> > m_inStream;
             IO::ByteContainerStream<AZStd::vector<char> > m_outStream;
+            AZStd::vector<u8> m_compactBuffer;
 
             // other state info
             // keep tracks of the number of WriteElements that have
@@ -1514,6 +1528,11 @@ namespace AZ
         //=========================================================================
         bool ObjectStreamImpl::WriteClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData)
         {
+            if (GetType() == ST_BINARY_COMPACT)
+            {
+                return WriteCompactClass(classPtr, classId, classData);
+            }
+
             m_errorLogger.Reset();
             // The Write Element Stack reserve size is based on examining a ScriptCanvas object stream that had a depth of up 18 types
             // 32 should be enough slack to serialize an hierarchy of types without needing to realloc
@@ -1561,6 +1580,156 @@ namespace AZ
             return m_errorLogger.GetErrorCount() == 0;
         }
 
+        //=========================================================================
+        // WriteCompactClass
+        //=========================================================================
+        bool ObjectStreamImpl::WriteCompactClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData)
+        {
+            if (!classData)
+            {
+                classData = m_sc->FindClassData(classId);
+                if (!classData)
+                {
+                    AZ_Error("Serialize", false, "Class %s is not registered with the serializer and can't be written to an object stream.",
+                        classId.ToString<AZStd::string>().c_str());
+                    return false;
+                }
+            }
+
+            m_compactBuffer.clear();
+            const CompactClassLayout* layout = m_sc->GetCompactClassLayoutCache().GetLayout(*m_sc, *classData);
+            if (layout && layout->Save(classPtr, m_compactBuffer))
+            {
+                u8 recordType = CRT_LAYOUT;
+                u32 fingerprint = layout->GetFingerprint();
+                u64 size = m_compactBuffer.size();
+                m_stream->Write(sizeof(recordType), &recordType);
+                m_stream->Write(classId.end() - classId.begin(), classId.begin());
+                m_stream->Write(sizeof(fingerprint), &fingerprint);
+                m_stream->Write(sizeof(size), &size);
+                return m_stream->Write(m_compactBuffer.size(), m_compactBuffer.data()) == m_compactBuffer.size();
+            }
+
+            // Types that can't be described by a layout, for instance because they store pointers, are embedded as a
+            // regular binary object stream so the compact format can be used for any data.
+            m_compactBuffer.clear();
+            IO::ByteContainerStream<AZStd::vector<u8>> fallbackStream(&m_compactBuffer);
+            ObjectStream* fallbackObjectStream = ObjectStream::Create(&fallbackStream, *m_sc, ST_BINARY);
+            if (!fallbackObjectStream)
+            {
+                return false;
+            }
+            bool result = fallbackObjectStream->WriteClass(classPtr, classId, classData);
+            result = fallbackObjectStream->Finalize() && result;
+
+            u8 recordType = CRT_OBJECT_STREAM;
+            u64 size = m_compactBuffer.size();
+            m_stream->Write(sizeof(recordType), &recordType);
+            m_stream->Write(classId.end() - classId.begin(), classId.begin());
+            m_stream->Write(sizeof(size), &size);
+            return m_stream->Write(m_compactBuffer.size(), m_compactBuffer.data()) == m_compactBuffer.size() && result;
+        }
+
+        //=========================================================================
+        // LoadCompactClasses
+        //=========================================================================
+        bool ObjectStreamImpl::LoadCompactClasses()
+        {
+            bool result = true;
+            for (;;)
+            {
+                u8 recordType = CRT_END;
+                if (m_stream->Read(sizeof(recordType), &recordType) != sizeof(recordType) || recordType == CRT_END)
+                {
+                    break;
+                }
+
+                Uuid classId;
+                u32 fingerprint = 0;
+                u64 size = 0;
+                bool isHeaderValid = recordType == CRT_LAYOUT || recordType == CRT_OBJECT_STREAM;
+                isHeaderValid = isHeaderValid && m_stream->Read(classId.end() - classId.begin(), classId.begin()) == static_cast<IO::SizeType>(classId.end() - classId.begin());
+                isHeaderValid = isHeaderValid && (recordType != CRT_LAYOUT || m_stream->Read(sizeof(fingerprint), &fingerprint) == sizeof(fingerprint));
+                isHeaderValid = isHeaderValid && m_stream->Read(sizeof(size), &size) == sizeof(size);
+                isHeaderValid = isHeaderValid && size <= m_stream->GetLength() - m_stream->GetCurPos();
+                if (!isHeaderValid)
+                {
+                    m_errorLogger.ReportError("ObjectStream compact binary load error: Stream is truncated or corrupted.");
+                    // this is considered a "fatal" error since the rest of the stream can't be located.
+                    return false;
+                }
+
+                m_compactBuffer.resize_no_construct(static_cast<size_t>(size));
+                if (m_stream->Read(size, m_compactBuffer.data()) != size)
+                {
+                    m_errorLogger.ReportError("ObjectStream compact binary load error: Stream is truncated.");
+                    return false;
+                }
+
+                if (recordType == CRT_OBJECT_STREAM)
+                {
+                    IO::MemoryStream fallbackStream(m_compactBuffer.data(), m_compactBuffer.size());
+                    result = ObjectStream::LoadBlocking(&fallbackStream, *m_sc, m_readyCB, m_filterDesc, m_inplaceLoadInfoCB) && result;
+                    continue;
+                }
+
+                const SerializeContext::ClassData* classData = m_sc->FindClassData(classId);
+                if (!classData && m_inplaceLoadInfoCB)
+                {
+                    m_inplaceLoadInfoCB(nullptr, &classData, classId, m_sc);
+                }
+                const CompactClassLayout* layout = classData ? m_sc->GetCompactClassLayoutCache().GetLayout(*m_sc, *classData) : nullptr;
+                if (!layout || layout->GetFingerprint() != fingerprint)
+                {
+                    AZStd::string error = AZStd::string::format("ObjectStream compact binary load error: Element of type %s was stored with a different"
+                        " reflection than the current one and needs to be saved again. File %s", classId.ToString<AZStd::string>().c_str(), GetStreamFilename());
+                    m_errorLogger.ReportError(error.c_str());
+                    result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                    continue;
+                }
+
+                void* classPtr = nullptr;
+                if (m_inplaceLoadInfoCB)
+                {
+                    m_inplaceLoadInfoCB(&classPtr, nullptr, classId, m_sc);
+                }
+                bool isCreated = false;
+                if (!classPtr)
+                {
+                    if (!m_readyCB || !classData->m_factory)
+                    {
+                        AZStd::string error = AZStd::string::format("ObjectStream compact binary load error: Unable to create root element of type %s."
+                            " A ClassReadyCB and a reflected factory are needed to give ownership of the loaded element to the caller.", classData->m_name);
+                        m_errorLogger.ReportError(error.c_str());
+                        return false;
+                    }
+                    classPtr = classData->m_factory->Create(classData->m_name);
+                    isCreated = true;
+                }
+
+                const u8* cursor = m_compactBuffer.data();
+                const u8* end = cursor + m_compactBuffer.size();
+                if (!layout->Load(classPtr, cursor, end, *m_sc, m_filterDesc.m_assetCB) || cursor != end)
+                {
+                    AZStd::string error = AZStd::string::format("ObjectStream compact binary load error: Failed to load element of type %s. File %s",
+                        classData->m_name, GetStreamFilename());
+                    m_errorLogger.ReportError(error.c_str());
+                    result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                    if (isCreated)
+                    {
+                        classData->m_factory->Destroy(classPtr);
+                    }
+                    continue;
+                }
+
+                if (m_readyCB)
+                {
+                    m_readyCB(classPtr, classId, m_sc);
+                }
+            }
+            return result;
+        }
+
         //=========================================================================
         // WriteElement
         // [10/25/2012]
@@ -1984,6 +2153,13 @@ namespace AZ
                     m_jsonDoc->AddMember("version", m_version, m_jsonDoc->GetAllocator());
                     m_jsonWriteValues.emplace_back().SetArray();
                 }
+                else if (m_type == ST_BINARY_COMPACT)
+                {
+                    u8 compactTag = s_compactBinaryStreamTag;
+                    u32 version = s_compactBinaryVersion;
+                    m_stream->Write(sizeof(compactTag), &compactTag);
+                    m_stream->Write(sizeof(version), &version);
+                }
                 else
                 {
                     u8 binaryTag = s_binaryStreamTag;
@@ -2028,6 +2204,26 @@ namespace AZ
                             result = false;
                         }
                     }
+                    else if (streamTag == s_compactBinaryStreamTag)
+                    {
+                        SetType(ST_BINARY_COMPACT);
+
+                        u32 version = 0;
+                        m_stream->Read(sizeof(version), &version);
+                        if (version <= s_compactBinaryVersion)
+                        {
+                            result = LoadCompactClasses() && result;
+                        }
+                        else
+                        {
+                            AZStd::string newVersionError = AZStd::string::format("ObjectStream compact binary load error: Stream is a newer version than object stream supports. Compact binary version: %u, load stream version: %u",
+                                s_compactBinaryVersion, version);
+                            m_errorLogger.ReportError(newVersionError.c_str());
+
+                            // this is considered a "fatal" error since the entire stream is unreadable.
+                            result = false;
+                        }
+                    }
                     else if (streamTag == s_xmlStreamTag)
                     {
                         SetType(ST_XML);
@@ -2128,7 +2324,7 @@ namespace AZ
                     }
                     else
                     {
-                        m_errorLogger.ReportError("Unknown stream tag (first byte): '\\0' binary, '<' xml or '{' json!");
+                        m_errorLogger.ReportError("Unknown stream tag (first byte): '\\0' binary, '\\1' compact binary, '<' xml or '{' json!");
                         // this is considered a "fatal" error since the entire stream is unreadable.
                         result = false;
                     }
@@ -2179,6 +2375,11 @@ namespace AZ
                     azdestroy(m_jsonDoc, SystemAllocator, rapidjson::Document);
                     m_jsonDoc = nullptr;
                 }
+                else if (GetType() == ST_BINARY_COMPACT)
+                {
+                    u8 endTag = CRT_END;
+                    m_stream->Write(sizeof(u8), &endTag);
+                }
                 else
                 {   /* ST_BINARY */
                     u8 endTag = ST_BINARYFLAG_ELEMENT_END;
@@ -69,6 +69,7 @@ namespace AZ
             ST_XML,
             ST_JSON,
             ST_BINARY,
+            ST_BINARY_COMPACT, ///< Native endian binary that's loaded through precompiled class layouts, see CompactClassLayout.
             ST_MAX // insert new types before this.
         };
 
@@ -9,6 +9,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 
 #include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Serialization/CompactClassLayout.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/DataOverlay.h>
 #include <AzCore/Serialization/DynamicSerializableField.h>
@@ -428,6 +429,7 @@ namespace AZ
     //=========================================================================
     SerializeContext::SerializeContext(bool registerIntegralTypes, bool createEditContext)
         : m_editContext(nullptr)
+        , m_compactClassLayouts(AZStd::make_unique<CompactClassLayoutCache>())
     {
         if (registerIntegralTypes)
         {
@@ -548,6 +550,20 @@ namespace AZ
         return m_editContext;
     }
 
+    //=========================================================================
+    // ReserveClassData
+    //=========================================================================
+    void SerializeContext::ReserveClassData(size_t classCount)
+    {
+        auto ReserveMap = [classCount](auto& map)
+        {
+            map.rehash(static_cast<size_t>(classCount / map.max_load_factor()) + 1);
+        };
+        ReserveMap(m_uuidMap);
+        ReserveMap(m_classNameToUuid);
+        ReserveMap(m_uuidAnyCreationMap);
+    }
+
     auto SerializeContext::RegisterType(const AZ::TypeId& typeId, AZ::Serialize::ClassData&& classData, CreateAnyFunc createAnyFunc) -> ClassBuilder
     {
         auto [typeToClassIter, inserted] = m_uuidMap.try_emplace(typeId, AZStd::move(classData));
@@ -2032,11 +2048,22 @@ namespace AZ
         str += " ]\n";
     }
 
+    //=========================================================================
+    // GetCompactClassLayoutCache
+    //=========================================================================
+    CompactClassLayoutCache& SerializeContext::GetCompactClassLayoutCache() const
+    {
+        return *m_compactClassLayouts;
+    }
+
     //=========================================================================
     // RemoveClassData
     //=========================================================================
     void SerializeContext::RemoveClassData(ClassData* classData)
     {
+        // Layouts refer to the class data of their members, so any of them can be affected.
+        m_compactClassLayouts->Clear();
+
         if (m_editContext)
         {
             m_editContext->RemoveClassData(classData);
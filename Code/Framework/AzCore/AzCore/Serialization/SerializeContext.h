@@ -51,6 +51,7 @@ namespace AZ
     class EditContext;
 
     class ObjectStream;
+    class CompactClassLayoutCache;
     class GenericClassInfo;
     struct DataPatchNodeInfo;
     class DataOverlayTarget;
@@ -176,6 +177,9 @@ namespace AZ
         /// Returns the pointer to the current edit context or NULL if one was not created.
         EditContext*    GetEditContext() const;
 
+        /// Sizes the type maps for the given number of reflected classes, so they don't rehash repeatedly while the modules reflect.
+        void            ReserveClassData(size_t classCount);
+
         /**
         * \anchor SerializeBind
         * \name Code to bind classes and variables for serialization.
@@ -385,6 +389,9 @@ namespace AZ
         /// Find GenericClassData data based on the supplied class ID
         GenericClassInfo* FindGenericClassInfo(const Uuid& classId) const;
 
+        /// Returns the cache of precompiled layouts used by the compact binary ObjectStream format.
+        CompactClassLayoutCache& GetCompactClassLayoutCache() const;
+
         /// Creates an AZStd::any based on the provided class Uuid, or returns an empty AZStd::any if no class data is found or the class is virtual
         AZStd::any CreateAny(const Uuid& classId);
 
@@ -677,6 +684,7 @@ namespace AZ
         AZStd::unordered_map<Uuid, CreateAnyFunc>  m_uuidAnyCreationMap;      ///< Uuid to Any creation function map
         AZStd::unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
         AZStd::vector<AZStd::unique_ptr<IDataContainer>> m_dataContainers; ///< Takes care of all related IDataContainer's lifetimes
+        AZStd::unique_ptr<CompactClassLayoutCache> m_compactClassLayouts; ///< Layouts for the compact binary ObjectStream format, built on first use
 
         class PerModuleGenericClassInfo;
         AZStd::unordered_set<PerModuleGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
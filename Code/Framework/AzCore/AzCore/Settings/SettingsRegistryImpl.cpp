@@ -12,6 +12,8 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/FileReader.h>
 #include <AzCore/JSON/error/en.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
 #include <AzCore/Serialization/Json/JsonImporter.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
@@ -844,7 +846,13 @@ namespace AZ
             }
 
             auto findFilesCallback = CreateSettingsFindCallback(findFilesPayload.m_isPlatformFile);
-            if (AZ::IO::FileIOBase* fileIo = m_useFileIo ? AZ::IO::FileIOBase::GetInstance() : nullptr; fileIo != nullptr)
+            AZ::IO::FileIOBase* fileIo = m_useFileIo ? AZ::IO::FileIOBase::GetInstance() : nullptr;
+            if (m_recordSnapshotInputs)
+            {
+                // Track the folder so that adding or removing settings files is detected as well.
+                RecordSnapshotInput(SettingsRegistrySnapshot::CreateFolderInput(folderPath, fileIo));
+            }
+            if (fileIo != nullptr)
             {
                 auto FileIoToSystemFileFindFiles = [findFilesCallback = AZStd::move(findFilesCallback), fileIo](const char* filePath) -> bool
                 {
@@ -1203,10 +1211,28 @@ namespace AZ
         if (MergeSettingsResult loadFileResult = LoadJsonFileIntoString(jsonData, path);
             !loadFileResult)
         {
+            if (m_recordSnapshotInputs)
+            {
+                // A missing file is an input as well, as the settings change once the file is added
+                RecordSnapshotInput(SettingsRegistrySnapshot::CreateMissingFileInput(path));
+            }
             // If the Json file failed to load, then return that result
             return loadFileResult;
         }
 
+        if (m_recordSnapshotInputs)
+        {
+            if (AZ::IO::PathView(path) == "-")
+            {
+                // Data read from stdin can't be checked for changes
+                InvalidateSnapshotRecording();
+            }
+            else
+            {
+                RecordSnapshotInput(SettingsRegistrySnapshot::CreateFileInput(path, jsonData));
+            }
+        }
+
         return MergeSettingsString(AZStd::move(jsonData), format, rootKey, path);
     }
 
@@ -1423,6 +1449,15 @@ namespace AZ
             mergeResult.Combine(MergeSettingsReturnCode::Failure);
         }
 
+        if (m_recordSnapshotInputs)
+        {
+            AZ::IO::FileIOBase* fileIo = m_useFileIo ? AZ::IO::FileIOBase::GetInstance() : nullptr;
+            for (const AZ::IO::Path& importedFile : jsonImporter.GetImportedFiles())
+            {
+                RecordSnapshotInput(SettingsRegistrySnapshot::CreateFileInput(importedFile, fileIo));
+            }
+        }
+
         // Create a scoped merge event to trigger the PreMerge notification on construction
         // and PostMerge event on destruction
         ScopedMergeEvent scopedMergeEvent(*this, { filePath.Native(), anchorKey });
@@ -1474,6 +1509,77 @@ namespace AZ
         m_useFileIo = useFileIo;
     }
 
+    void SettingsRegistryImpl::StartSnapshotRecording()
+    {
+        AZStd::scoped_lock lock(LockForWriting());
+        m_snapshotInputs.clear();
+        m_snapshotInputsValid = true;
+        m_recordSnapshotInputs = true;
+    }
+
+    bool SettingsRegistryImpl::StoreSnapshot(const char* filePath, HashValue64 key)
+    {
+        AZStd::scoped_lock lock(LockForReading());
+        const bool isValid = m_recordSnapshotInputs && m_snapshotInputsValid;
+        m_recordSnapshotInputs = false;
+        if (!isValid)
+        {
+            m_snapshotInputs.clear();
+            return false;
+        }
+
+        bool result = SettingsRegistrySnapshot::Store(filePath, key, m_snapshotInputs, m_settings);
+        m_snapshotInputs.clear();
+        return result;
+    }
+
+    bool SettingsRegistryImpl::LoadSnapshot(const char* filePath, HashValue64 key)
+    {
+        AZ::IO::FileIOBase* fileIo = m_useFileIo ? AZ::IO::FileIOBase::GetInstance() : nullptr;
+        rapidjson::Document snapshotSettings;
+        if (!SettingsRegistrySnapshot::Load(snapshotSettings, filePath, key, fileIo))
+        {
+            return false;
+        }
+
+        {
+            ScopedMergeEvent scopedMergeEvent(*this, { filePath, "" });
+            {
+                AZStd::scoped_lock lock(LockForWriting());
+                m_settings.Swap(snapshotSettings);
+            }
+        }
+        // The entire registry has been replaced, so signal the root instead of each individual key
+        SignalNotifier("", GetType(""));
+        return true;
+    }
+
+    HashValue64 SettingsRegistryImpl::GetContentHash(HashValue64 seed) const
+    {
+        rapidjson::StringBuffer buffer;
+        {
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            AZStd::scoped_lock lock(LockForReading());
+            m_settings.Accept(writer);
+        }
+        return TypeHash64(reinterpret_cast<const uint8_t*>(buffer.GetString()), buffer.GetSize(), seed);
+    }
+
+    void SettingsRegistryImpl::RecordSnapshotInput(SettingsRegistrySnapshot::Input input)
+    {
+        AZStd::scoped_lock lock(LockForReading());
+        if (m_recordSnapshotInputs)
+        {
+            m_snapshotInputs.push_back(AZStd::move(input));
+        }
+    }
+
+    void SettingsRegistryImpl::InvalidateSnapshotRecording()
+    {
+        AZStd::scoped_lock lock(LockForReading());
+        m_snapshotInputsValid = false;
+    }
+
     AZStd::scoped_lock<AZStd::recursive_mutex> SettingsRegistryImpl::LockForWriting() const
     {
         // ensure that we aren't actively iterating over this data that is about to be
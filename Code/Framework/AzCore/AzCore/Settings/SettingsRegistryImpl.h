@@ -14,6 +14,7 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -88,6 +89,18 @@ namespace AZ
 
         void SetUseFileIO(bool useFileIo) override;
 
+        //! Starts recording the files and folders that are merged into the registry, so that the resulting settings can be
+        //! stored as a snapshot with StoreSnapshot.
+        void StartSnapshotRecording();
+        //! Stores the current settings together with the inputs recorded since StartSnapshotRecording and stops recording.
+        //! Nothing is stored if settings were merged from a source that can't be checked for changes, such as stdin.
+        bool StoreSnapshot(const char* filePath, HashValue64 key);
+        //! Replaces the settings with those from the snapshot file if it was stored with the same key and none of the
+        //! recorded inputs have changed since. A single notification for the root of the registry is signaled after loading.
+        bool LoadSnapshot(const char* filePath, HashValue64 key);
+        //! Returns a hash of the current content of the registry.
+        [[nodiscard]] HashValue64 GetContentHash(HashValue64 seed) const;
+
     private:
         using TagList = AZStd::fixed_vector<size_t, Specializations::MaxCount + 1>;
         struct RegistryFile
@@ -123,6 +136,10 @@ namespace AZ
             AZ::IO::PathView filePath);
         MergeSettingsResult LoadJsonFileIntoString(AZStd::string& jsonData, const char* filePath);
 
+        //! Adds the input to the snapshot inputs if a snapshot is being recorded.
+        void RecordSnapshotInput(SettingsRegistrySnapshot::Input input);
+        void InvalidateSnapshotRecording();
+
         void SignalNotifier(AZStd::string_view jsonPath, SettingsType type);
 
         //! Locks the m_settingMutex but also checks to make sure that someone is not currently
@@ -163,6 +180,12 @@ namespace AZ
         //! When true use the Registered FileIOBase for file open operations
         bool m_useFileIo{};
 
+        //! Files and folders that were merged since StartSnapshotRecording was called.
+        SettingsRegistrySnapshot::InputList m_snapshotInputs;
+        AZStd::atomic_bool m_recordSnapshotInputs{};
+        //! Set to false if something was merged that doesn't allow the settings to be restored from a snapshot.
+        bool m_snapshotInputsValid{};
+
 
         struct ScopedMergeEvent
         {
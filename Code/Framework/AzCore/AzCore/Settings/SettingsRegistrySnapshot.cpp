@@ -0,0 +1,518 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/FileReader.h>
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace SettingsRegistrySnapshotInternal
+    {
+        enum class NodeType : u8
+        {
+            Null,
+            False,
+            True,
+            Int64,
+            Uint64,
+            Double,
+            String,     //!< The value is the offset into the string table and the count is the length of the string.
+            Object,     //!< The count is the number of members, which directly follow the node.
+            Array       //!< The count is the number of elements, which directly follow the node.
+        };
+
+        struct FileHeader
+        {
+            u32 m_magic;
+            u32 m_version;
+            u64 m_key;
+            u32 m_inputCount;
+            u32 m_nodeCount;
+            u32 m_stringsSize;
+            u32 m_padding;
+        };
+
+        struct InputRecord
+        {
+            u64 m_hash;
+            u32 m_pathOffset;
+            u32 m_pathLength;
+            u8 m_type;
+            u8 m_padding[7];
+        };
+
+        //! Nodes are stored in pre-order, so the members of an object or the elements of an array directly follow the node of
+        //! the object or array.
+        struct NodeRecord
+        {
+            u64 m_value;
+            u32 m_nameOffset;
+            u32 m_nameLength;
+            u32 m_count;
+            u8 m_type;
+            u8 m_padding[3];
+        };
+
+        // Recursion limit while decoding, to protect against corrupted snapshots.
+        constexpr u32 MaxDepth = 256;
+
+        template<typename T>
+        void Append(AZStd::vector<u8>& buffer, const T& value)
+        {
+            const size_t offset = buffer.size();
+            buffer.resize_no_construct(offset + sizeof(T));
+            memcpy(buffer.data() + offset, &value, sizeof(T));
+        }
+
+        template<typename T>
+        bool Read(T& value, AZStd::span<const u8> buffer, size_t offset)
+        {
+            if (offset > buffer.size() || buffer.size() - offset < sizeof(T))
+            {
+                return false;
+            }
+            memcpy(&value, buffer.data() + offset, sizeof(T));
+            return true;
+        }
+
+        class Encoder
+        {
+        public:
+            void AddString(u32& offset, u32& length, AZStd::string_view text)
+            {
+                AZ_Assert(m_strings.size() + text.size() <= AZStd::numeric_limits<u32>::max(),
+                    "Settings Registry snapshot exceeds the maximum string table size.");
+                offset = aznumeric_cast<u32>(m_strings.size());
+                length = aznumeric_cast<u32>(text.size());
+                m_strings.insert(m_strings.end(), text.begin(), text.end());
+            }
+
+            void AddValue(const rapidjson::Value& value, AZStd::string_view name)
+            {
+                NodeRecord node{};
+                AddString(node.m_nameOffset, node.m_nameLength, name);
+                switch (value.GetType())
+                {
+                case rapidjson::kNullType:
+                    node.m_type = aznumeric_cast<u8>(NodeType::Null);
+                    break;
+                case rapidjson::kFalseType:
+                    node.m_type = aznumeric_cast<u8>(NodeType::False);
+                    break;
+                case rapidjson::kTrueType:
+                    node.m_type = aznumeric_cast<u8>(NodeType::True);
+                    break;
+                case rapidjson::kNumberType:
+                    if (value.IsDouble())
+                    {
+                        // Store the bits directly so the value is restored exactly.
+                        const double number = value.GetDouble();
+                        static_assert(sizeof(number) == sizeof(node.m_value));
+                        memcpy(&node.m_value, &number, sizeof(number));
+                        node.m_type = aznumeric_cast<u8>(NodeType::Double);
+                    }
+                    else if (value.IsInt64())
+                    {
+                        node.m_value = static_cast<u64>(value.GetInt64());
+                        node.m_type = aznumeric_cast<u8>(NodeType::Int64);
+                    }
+                    else
+                    {
+                        node.m_value = value.GetUint64();
+                        node.m_type = aznumeric_cast<u8>(NodeType::Uint64);
+                    }
+                    break;
+                case rapidjson::kStringType:
+                {
+                    u32 offset = 0;
+                    AddString(offset, node.m_count, AZStd::string_view(value.GetString(), value.GetStringLength()));
+                    node.m_value = offset;
+                    node.m_type = aznumeric_cast<u8>(NodeType::String);
+                    break;
+                }
+                case rapidjson::kObjectType:
+                    node.m_count = value.MemberCount();
+                    node.m_type = aznumeric_cast<u8>(NodeType::Object);
+                    m_nodes.push_back(node);
+                    for (auto it = value.MemberBegin(); it != value.MemberEnd(); ++it)
+                    {
+                        AddValue(it->value, AZStd::string_view(it->name.GetString(), it->name.GetStringLength()));
+                    }
+                    return;
+                case rapidjson::kArrayType:
+                    node.m_count = value.Size();
+                    node.m_type = aznumeric_cast<u8>(NodeType::Array);
+                    m_nodes.push_back(node);
+                    for (const rapidjson::Value& element : value.GetArray())
+                    {
+                        AddValue(element, {});
+                    }
+                    return;
+                default:
+                    AZ_Assert(false, "Unsupported json type %i in Settings Registry snapshot.", aznumeric_cast<int>(value.GetType()));
+                    node.m_type = aznumeric_cast<u8>(NodeType::Null);
+                    break;
+                }
+                m_nodes.push_back(node);
+            }
+
+            AZStd::vector<InputRecord> m_inputs;
+            AZStd::vector<NodeRecord> m_nodes;
+            AZStd::vector<char> m_strings;
+        };
+
+        class Decoder
+        {
+        public:
+            Decoder(AZStd::span<const u8> nodes, AZStd::span<const u8> strings, rapidjson::Document::AllocatorType& allocator)
+                : m_nodes(nodes)
+                , m_strings(strings)
+                , m_allocator(allocator)
+            {
+            }
+
+            bool DecodeValue(rapidjson::Value& value, AZStd::string_view& name, u32 depth)
+            {
+                NodeRecord node;
+                if (depth > MaxDepth || !Read(node, m_nodes, m_nextNode * sizeof(NodeRecord)) ||
+                    !GetString(name, node.m_nameOffset, node.m_nameLength))
+                {
+                    return false;
+                }
+                ++m_nextNode;
+
+                switch (static_cast<NodeType>(node.m_type))
+                {
+                case NodeType::Null:
+                    value.SetNull();
+                    return true;
+                case NodeType::False:
+                    value.SetBool(false);
+                    return true;
+                case NodeType::True:
+                    value.SetBool(true);
+                    return true;
+                case NodeType::Int64:
+                    value.SetInt64(static_cast<int64_t>(node.m_value));
+                    return true;
+                case NodeType::Uint64:
+                    value.SetUint64(node.m_value);
+                    return true;
+                case NodeType::Double:
+                {
+                    double number;
+                    memcpy(&number, &node.m_value, sizeof(number));
+                    value.SetDouble(number);
+                    return true;
+                }
+                case NodeType::String:
+                {
+                    AZStd::string_view text;
+                    if (node.m_value > AZStd::numeric_limits<u32>::max() ||
+                        !GetString(text, static_cast<u32>(node.m_value), node.m_count))
+                    {
+                        return false;
+                    }
+                    value.SetString(text.data(), aznumeric_cast<rapidjson::SizeType>(text.size()), m_allocator);
+                    return true;
+                }
+                case NodeType::Object:
+                    if (node.m_count > RemainingNodes())
+                    {
+                        return false;
+                    }
+                    value.SetObject();
+                    for (u32 i = 0; i < node.m_count; ++i)
+                    {
+                        rapidjson::Value member;
+                        AZStd::string_view memberName;
+                        if (!DecodeValue(member, memberName, depth + 1))
+                        {
+                            return false;
+                        }
+                        rapidjson::Value memberKey(memberName.data(), aznumeric_cast<rapidjson::SizeType>(memberName.size()), m_allocator);
+                        value.AddMember(memberKey, member, m_allocator);
+                    }
+                    return true;
+                case NodeType::Array:
+                    if (node.m_count > RemainingNodes())
+                    {
+                        return false;
+                    }
+                    value.SetArray();
+                    value.Reserve(node.m_count, m_allocator);
+                    for (u32 i = 0; i < node.m_count; ++i)
+                    {
+                        rapidjson::Value element;
+                        AZStd::string_view elementName;
+                        if (!DecodeValue(element, elementName, depth + 1))
+                        {
+                            return false;
+                        }
+                        value.PushBack(element, m_allocator);
+                    }
+                    return true;
+                default:
+                    return false;
+                }
+            }
+
+            bool IsComplete() const
+            {
+                return RemainingNodes() == 0;
+            }
+
+        private:
+            bool GetString(AZStd::string_view& result, u32 offset, u32 length) const
+            {
+                if (offset > m_strings.size() || m_strings.size() - offset < length)
+                {
+                    return false;
+                }
+                result = AZStd::string_view(reinterpret_cast<const char*>(m_strings.data()) + offset, length);
+                return true;
+            }
+
+            size_t RemainingNodes() const
+            {
+                return (m_nodes.size() / sizeof(NodeRecord)) - m_nextNode;
+            }
+
+            AZStd::span<const u8> m_nodes;
+            AZStd::span<const u8> m_strings;
+            rapidjson::Document::AllocatorType& m_allocator;
+            size_t m_nextNode{ 0 };
+        };
+
+        bool ReadFileContent(AZStd::string& content, const char* filePath, AZ::IO::FileIOBase* fileIo)
+        {
+            AZ::IO::FileReader fileReader(fileIo, filePath);
+            if (!fileReader.IsOpen())
+            {
+                return false;
+            }
+            content.resize_no_construct(fileReader.Length());
+            return fileReader.Read(content.size(), content.data()) == content.size();
+        }
+    } // namespace SettingsRegistrySnapshotInternal
+
+    auto SettingsRegistrySnapshot::CreateFileInput(AZ::IO::PathView filePath, AZStd::string_view content) -> Input
+    {
+        return Input{ AZ::IO::Path(filePath),
+            TypeHash64(reinterpret_cast<const uint8_t*>(content.data()), content.size()), InputType::File };
+    }
+
+    auto SettingsRegistrySnapshot::CreateFileInput(AZ::IO::PathView filePath, AZ::IO::FileIOBase* fileIo) -> Input
+    {
+        AZ::IO::FixedMaxPath path(filePath);
+        AZStd::string content;
+        // Empty files are treated the same as missing files, matching how the Settings Registry merges files.
+        if (!SettingsRegistrySnapshotInternal::ReadFileContent(content, path.c_str(), fileIo) || content.empty())
+        {
+            return CreateMissingFileInput(filePath);
+        }
+        return CreateFileInput(filePath, content);
+    }
+
+    auto SettingsRegistrySnapshot::CreateMissingFileInput(AZ::IO::PathView filePath) -> Input
+    {
+        return Input{ AZ::IO::Path(filePath), HashValue64{ 0 }, InputType::MissingFile };
+    }
+
+    auto SettingsRegistrySnapshot::CreateFolderInput(AZ::IO::PathView folderPath, AZ::IO::FileIOBase* fileIo) -> Input
+    {
+        AZStd::vector<AZStd::string> fileNames;
+        AZ::IO::FixedMaxPath folder(folderPath);
+        if (fileIo)
+        {
+            fileIo->FindFiles(folder.c_str(), "*", [&fileNames, fileIo](const char* filePath) -> bool
+                {
+                    if (!fileIo->IsDirectory(filePath))
+                    {
+                        fileNames.emplace_back(AZ::IO::PathView(filePath).Filename().Native());
+                    }
+                    return true;
+                });
+        }
+        else
+        {
+            AZ::IO::SystemFile::FindFiles((folder / "*").c_str(), [&fileNames](const char* fileName, bool isFile) -> bool
+                {
+                    if (isFile)
+                    {
+                        fileNames.emplace_back(fileName);
+                    }
+                    return true;
+                });
+        }
+        // The order in which files are found isn't guaranteed, so sort the names to get a stable hash.
+        AZStd::sort(fileNames.begin(), fileNames.end());
+
+        HashValue64 hash{ 0 };
+        for (const AZStd::string& fileName : fileNames)
+        {
+            // Include the terminator so that the boundaries between names are part of the hash.
+            hash = TypeHash64(reinterpret_cast<const uint8_t*>(fileName.c_str()), fileName.size() + 1, hash);
+        }
+        return Input{ AZ::IO::Path(folderPath), hash, InputType::Folder };
+    }
+
+    bool SettingsRegistrySnapshot::IsUpToDate(const Input& input, AZ::IO::FileIOBase* fileIo)
+    {
+        switch (input.m_type)
+        {
+        case InputType::File:
+        {
+            const Input current = CreateFileInput(input.m_path, fileIo);
+            return current.m_type == InputType::File && current.m_hash == input.m_hash;
+        }
+        case InputType::MissingFile:
+            return CreateFileInput(input.m_path, fileIo).m_type == InputType::MissingFile;
+        case InputType::Folder:
+            return CreateFolderInput(input.m_path, fileIo).m_hash == input.m_hash;
+        default:
+            return false;
+        }
+    }
+
+    void SettingsRegistrySnapshot::Store(AZStd::vector<u8>& buffer, HashValue64 key, const InputList& inputs, const rapidjson::Value& settings)
+    {
+        using namespace SettingsRegistrySnapshotInternal;
+
+        Encoder encoder;
+        encoder.m_inputs.reserve(inputs.size());
+        for (const Input& input : inputs)
+        {
+            InputRecord record{};
+            record.m_hash = static_cast<u64>(input.m_hash);
+            record.m_type = aznumeric_cast<u8>(input.m_type);
+            encoder.AddString(record.m_pathOffset, record.m_pathLength, input.m_path.Native());
+            encoder.m_inputs.push_back(record);
+        }
+        encoder.AddValue(settings, {});
+
+        FileHeader header{};
+        header.m_magic = FileMagic;
+        header.m_version = FileVersion;
+        header.m_key = static_cast<u64>(key);
+        header.m_inputCount = aznumeric_cast<u32>(encoder.m_inputs.size());
+        header.m_nodeCount = aznumeric_cast<u32>(encoder.m_nodes.size());
+        header.m_stringsSize = aznumeric_cast<u32>(encoder.m_strings.size());
+
+        buffer.clear();
+        buffer.reserve(sizeof(FileHeader) + encoder.m_inputs.size() * sizeof(InputRecord) +
+            encoder.m_nodes.size() * sizeof(NodeRecord) + encoder.m_strings.size());
+        Append(buffer, header);
+        for (const InputRecord& record : encoder.m_inputs)
+        {
+            Append(buffer, record);
+        }
+        for (const NodeRecord& node : encoder.m_nodes)
+        {
+            Append(buffer, node);
+        }
+        buffer.insert(buffer.end(), encoder.m_strings.begin(), encoder.m_strings.end());
+    }
+
+    bool SettingsRegistrySnapshot::Store(const char* filePath, HashValue64 key, const InputList& inputs, const rapidjson::Value& settings)
+    {
+        AZStd::vector<u8> buffer;
+        Store(buffer, key, inputs, settings);
+
+        // Write to a temporary file first so other processes never map a partially written snapshot.
+        AZ::IO::FixedMaxPath tempPath(filePath);
+        tempPath.Native() += ".tmp";
+        {
+            AZ::IO::SystemFile file;
+            if (!file.Open(tempPath.c_str(),
+                    AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                return false;
+            }
+            if (file.Write(buffer.data(), buffer.size()) != buffer.size())
+            {
+                file.Close();
+                AZ::IO::SystemFile::Delete(tempPath.c_str());
+                return false;
+            }
+        }
+        if (!AZ::IO::SystemFile::Rename(tempPath.c_str(), filePath, true))
+        {
+            AZ::IO::SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool SettingsRegistrySnapshot::Load(rapidjson::Document& settings, AZStd::span<const u8> snapshot, HashValue64 key, AZ::IO::FileIOBase* fileIo)
+    {
+        using namespace SettingsRegistrySnapshotInternal;
+
+        FileHeader header;
+        if (!Read(header, snapshot, 0) || header.m_magic != FileMagic || header.m_version != FileVersion ||
+            header.m_key != static_cast<u64>(key))
+        {
+            return false;
+        }
+
+        const size_t inputsOffset = sizeof(FileHeader);
+        const size_t nodesOffset = inputsOffset + size_t{ header.m_inputCount } * sizeof(InputRecord);
+        const size_t stringsOffset = nodesOffset + size_t{ header.m_nodeCount } * sizeof(NodeRecord);
+        if (snapshot.size() != stringsOffset + header.m_stringsSize || header.m_nodeCount == 0)
+        {
+            return false;
+        }
+        AZStd::span<const u8> strings = snapshot.subspan(stringsOffset, header.m_stringsSize);
+
+        // Check all the inputs before anything is decoded, as any change means the settings have to be fully merged again.
+        for (u32 i = 0; i < header.m_inputCount; ++i)
+        {
+            InputRecord record;
+            Read(record, snapshot, inputsOffset + i * sizeof(InputRecord));
+            if (record.m_pathOffset > strings.size() || strings.size() - record.m_pathOffset < record.m_pathLength)
+            {
+                return false;
+            }
+            Input input;
+            input.m_path = AZStd::string_view(reinterpret_cast<const char*>(strings.data()) + record.m_pathOffset, record.m_pathLength);
+            input.m_hash = HashValue64{ record.m_hash };
+            input.m_type = static_cast<InputType>(record.m_type);
+            if (!IsUpToDate(input, fileIo))
+            {
+                return false;
+            }
+        }
+
+        // Decode into a separate document so the settings are left untouched if the snapshot turns out to be corrupted.
+        rapidjson::Document document;
+        Decoder decoder(snapshot.subspan(nodesOffset, stringsOffset - nodesOffset), strings, document.GetAllocator());
+        AZStd::string_view rootName;
+        if (!decoder.DecodeValue(document, rootName, 0) || !decoder.IsComplete())
+        {
+            return false;
+        }
+        settings.Swap(document);
+        return true;
+    }
+
+    bool SettingsRegistrySnapshot::Load(rapidjson::Document& settings, const char* filePath, HashValue64 key, AZ::IO::FileIOBase* fileIo)
+    {
+        AZ::IO::MappedFile mappedFile;
+        if (!mappedFile.Open(filePath))
+        {
+            return false;
+        }
+        return Load(settings, AZStd::span<const u8>(mappedFile.GetData(), mappedFile.GetSize()), key, fileIo);
+    }
+} // namespace AZ
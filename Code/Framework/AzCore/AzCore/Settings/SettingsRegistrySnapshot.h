@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Utils/TypeHash.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::IO
+{
+    class FileIOBase;
+}
+
+namespace AZ
+{
+    //! Binary snapshot of the content of a Settings Registry, together with the files and folders that were used to build
+    //! that content. Loading a snapshot skips parsing the json text of the settings files and applying them as patches, only
+    //! the hashes of the inputs are checked to make sure none of them were changed, added or removed since the snapshot was
+    //! stored. The snapshot file is memory mapped and the values are copied directly into the registry document.
+    //!
+    //! Snapshots are native endian and are intended to be stored locally, for instance in the project user folder, as a
+    //! cache for the settings merged at startup.
+    class SettingsRegistrySnapshot final
+    {
+    public:
+        static constexpr u32 FileMagic = 0x53535253; // "SRSS"
+        static constexpr u32 FileVersion = 1;
+
+        enum class InputType : u8
+        {
+            File,           //!< A file that was merged. The hash is of the content of the file.
+            MissingFile,    //!< A file that was requested but couldn't be loaded.
+            Folder          //!< A settings folder that was scanned. The hash is of the names of the files in the folder.
+        };
+
+        struct Input
+        {
+            AZ::IO::Path m_path;
+            HashValue64 m_hash{ 0 };
+            InputType m_type{ InputType::File };
+        };
+        using InputList = AZStd::vector<Input>;
+
+        //! Creates an input entry for a file with the content that was read from it.
+        static Input CreateFileInput(AZ::IO::PathView filePath, AZStd::string_view content);
+        //! Creates an input entry for a file by reading its current content. If the file can't be read a MissingFile entry
+        //! is created.
+        static Input CreateFileInput(AZ::IO::PathView filePath, AZ::IO::FileIOBase* fileIo);
+        //! Creates an input entry for a file that couldn't be loaded.
+        static Input CreateMissingFileInput(AZ::IO::PathView filePath);
+        //! Creates an input entry for a folder from the names of the files it currently contains.
+        static Input CreateFolderInput(AZ::IO::PathView folderPath, AZ::IO::FileIOBase* fileIo);
+        //! Checks if the file or folder still matches the state it was in when the input was created.
+        static bool IsUpToDate(const Input& input, AZ::IO::FileIOBase* fileIo);
+
+        //! Writes the snapshot of the settings and their inputs to the buffer.
+        static void Store(AZStd::vector<u8>& buffer, HashValue64 key, const InputList& inputs, const rapidjson::Value& settings);
+        //! Writes the snapshot of the settings and their inputs to the file at the absolute path.
+        static bool Store(const char* filePath, HashValue64 key, const InputList& inputs, const rapidjson::Value& settings);
+
+        //! Restores the settings from a snapshot if it was stored with the same key and all inputs are up to date.
+        //! The content of settings is only changed if true is returned.
+        static bool Load(rapidjson::Document& settings, AZStd::span<const u8> snapshot, HashValue64 key, AZ::IO::FileIOBase* fileIo);
+        //! Restores the settings from a snapshot file at the absolute path, which will be memory mapped while loading.
+        static bool Load(rapidjson::Document& settings, const char* filePath, HashValue64 key, AZ::IO::FileIOBase* fileIo);
+
+    private:
+        SettingsRegistrySnapshot() = delete;
+    };
+} // namespace AZ
@@ -145,6 +145,8 @@ namespace AZ::Internal
 
         uint8_t GetPriorityNumber() const noexcept;
 
+        TaskPlacement GetPlacement() const noexcept;
+
     private:
         friend class CompiledTaskGraph;
         friend class TaskWorker;
@@ -71,6 +71,11 @@ namespace AZ::Internal
         return static_cast<uint8_t>(m_descriptor.priority);
     }
 
+    inline TaskPlacement Task::GetPlacement() const noexcept
+    {
+        return m_descriptor.placement;
+    }
+
     inline void Task::Link(Task& other)
     {
         ++m_outboundLinkCount;
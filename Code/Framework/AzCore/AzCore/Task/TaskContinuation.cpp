@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Task/TaskContinuation.h>
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        // Owns everything a continuation needs while the awaited operation is in flight. Tasks only capture a
+        // pointer to it, as the continuation doesn't fit in the inline storage of a task.
+        class TaskGraphContinuation final
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(TaskGraphContinuation, SystemAllocator);
+
+            TaskGraphContinuation(TaskExecutor& executor, const TaskDescriptor& descriptor, TaskContinuation continuation)
+                : m_executor{ executor }
+                , m_descriptor{ descriptor }
+                , m_continuation{ AZStd::move(continuation) }
+            {
+            }
+
+            void Schedule()
+            {
+                TaskGraph graph{ "TaskContinuation" };
+                graph.AddTask(
+                    m_descriptor,
+                    [this]
+                    {
+                        m_continuation();
+                        delete this;
+                    });
+                graph.Detach();
+                graph.SubmitOnExecutor(m_executor);
+            }
+
+            void SubmitAfter(TaskGraph& graph)
+            {
+                m_event.SetContinuation(&TaskGraphContinuation::OnGraphFinished, this);
+                graph.SubmitOnExecutor(m_executor, &m_event);
+            }
+
+        private:
+            static void OnGraphFinished(void* userData)
+            {
+                // Signaling doesn't touch the event after the continuation is invoked, so the task is free to delete it
+                static_cast<TaskGraphContinuation*>(userData)->Schedule();
+            }
+
+            TaskGraphEvent m_event{ "TaskGraphContinuation" };
+            TaskExecutor& m_executor;
+            TaskDescriptor m_descriptor;
+            TaskContinuation m_continuation;
+        };
+    } // namespace Internal
+
+    void ScheduleTaskContinuation(TaskExecutor& executor, const TaskDescriptor& descriptor, TaskContinuation continuation)
+    {
+        (new Internal::TaskGraphContinuation(executor, descriptor, AZStd::move(continuation)))->Schedule();
+    }
+
+    void SubmitTaskGraphThen(TaskGraph& graph, TaskExecutor& executor, const TaskDescriptor& descriptor, TaskContinuation continuation)
+    {
+        (new Internal::TaskGraphContinuation(executor, descriptor, AZStd::move(continuation)))->SubmitAfter(graph);
+    }
+
+    void QueueStreamerRequestThen(
+        IO::FileRequestPtr request, TaskExecutor& executor, const TaskDescriptor& descriptor, StreamerRequestContinuation continuation)
+    {
+        auto streamer = Interface<IO::IStreamer>::Get();
+        AZ_Assert(streamer, "QueueStreamerRequestThen requires the Streamer to be available");
+        streamer->SetRequestCompleteCallback(
+            request,
+            [&executor, descriptor, continuation = AZStd::move(continuation)](IO::FileRequestHandle handle) mutable
+            {
+                IO::IStreamerTypes::RequestStatus status = Interface<IO::IStreamer>::Get()->GetRequestStatus(handle);
+                ScheduleTaskContinuation(
+                    executor, descriptor,
+                    [continuation = AZStd::move(continuation), status]
+                    {
+                        continuation(status);
+                    });
+            });
+        streamer->QueueRequest(request);
+    }
+} // namespace AZ
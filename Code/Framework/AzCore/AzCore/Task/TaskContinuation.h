@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        class ExternalFileRequest;
+        using FileRequestPtr = AZStd::intrusive_ptr<ExternalFileRequest>;
+    } // namespace IO
+
+    class TaskExecutor;
+    class TaskGraph;
+
+    // Task continuations let a task wait on another task graph or a Streamer request without holding on to a worker
+    // thread, which blocking in TaskGraphEvent::Wait would do. Once the awaited operation completes, the continuation is
+    // scheduled as a new task on the given executor. Continuations may start further operations to build a chain:
+    //
+    //     AZ::SubmitTaskGraphThen(decompressGraph, executor, descriptor, [&processGraph, &executor, descriptor]
+    //     {
+    //         ... // runs on a worker thread once the decompression graph has finished
+    //         AZ::SubmitTaskGraphThen(processGraph, executor, descriptor, [] { ... });
+    //     });
+    //
+    // This is available in C++17. Toolchains with C++20 coroutines can write the same chain with TaskCoroutine.
+    using TaskContinuation = AZStd::function<void()>;
+    using StreamerRequestContinuation = AZStd::function<void(IO::IStreamerTypes::RequestStatus)>;
+
+    // Schedule the continuation as a new task on the executor
+    void ScheduleTaskContinuation(TaskExecutor& executor, const TaskDescriptor& descriptor, TaskContinuation continuation);
+
+    // Submit the graph on the executor and schedule the continuation once all tasks of the graph have finished
+    void SubmitTaskGraphThen(TaskGraph& graph, TaskExecutor& executor, const TaskDescriptor& descriptor, TaskContinuation continuation);
+
+    // Queue a prepared Streamer request (for instance one created with IStreamer::Read) and schedule the continuation
+    // with the final status of the request once it completes. The request's completion callback is taken over.
+    void QueueStreamerRequestThen(
+        IO::FileRequestPtr request, TaskExecutor& executor, const TaskDescriptor& descriptor, StreamerRequestContinuation continuation);
+} // namespace AZ
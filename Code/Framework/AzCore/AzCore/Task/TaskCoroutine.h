@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// Suspendable tasks are only available when the toolchain is configured for C++20 coroutines
+// (CMAKE_CXX_STANDARD 20). Code using them should test AZ_TASK_COROUTINES_ENABLED. The continuations in
+// TaskContinuation.h provide the same without coroutines.
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+#define AZ_TASK_COROUTINES_ENABLED 1
+#endif
+
+#if defined(AZ_TASK_COROUTINES_ENABLED)
+
+#include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/atomic.h>
+
+#include <coroutine>
+
+namespace AZ
+{
+    // A TaskCoroutine is a task that may suspend (co_await) on another task graph, a Streamer request or an asset
+    // without holding on to a worker thread. Each time an awaited operation completes, the remainder of the
+    // coroutine is scheduled as a new task on the executor it was started on.
+    //
+    //     AZ::TaskCoroutine LoadAndProcess(AZ::TaskGraph& decompressGraph)
+    //     {
+    //         co_await AZ::AwaitTaskGraph(decompressGraph);
+    //         ... // continues on a worker thread once the graph has finished
+    //     }
+    //
+    //     LoadAndProcess(graph).Start(executor, descriptor, &doneEvent);
+    //
+    // Coroutines are created suspended and run nothing until started. The coroutine frame is freed when the
+    // coroutine returns. Lambda coroutines must not capture state, since the lambda object is usually destroyed
+    // before the coroutine finishes; pass state as parameters instead.
+    class TaskCoroutine final
+    {
+    public:
+        struct promise_type;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(Handle handle) noexcept
+            {
+                TaskGraphEvent* completionEvent = handle.promise().m_completionEvent;
+                handle.destroy();
+                if (completionEvent)
+                {
+                    TaskCoroutine::SignalEvent(*completionEvent);
+                }
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+        };
+
+        struct promise_type
+        {
+            TaskCoroutine get_return_object() noexcept
+            {
+                return TaskCoroutine{ Handle::from_promise(*this) };
+            }
+
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            FinalAwaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void return_void() const noexcept
+            {
+            }
+
+            void unhandled_exception() const noexcept
+            {
+                AZ_Assert(false, "Unhandled exception escaped TaskCoroutine %s", m_descriptor.taskName);
+            }
+
+            TaskExecutor* m_executor = nullptr;
+            TaskDescriptor m_descriptor;
+            TaskGraphEvent* m_completionEvent = nullptr;
+        };
+
+        TaskCoroutine(TaskCoroutine&& other) noexcept
+            : m_handle{ other.m_handle }
+        {
+            other.m_handle = nullptr;
+        }
+
+        TaskCoroutine(const TaskCoroutine&) = delete;
+        TaskCoroutine& operator=(const TaskCoroutine&) = delete;
+        TaskCoroutine& operator=(TaskCoroutine&&) = delete;
+
+        ~TaskCoroutine()
+        {
+            // A coroutine that was never started is still owned by this object
+            if (m_handle)
+            {
+                m_handle.destroy();
+            }
+        }
+
+        // Schedule the coroutine on the executor. The optional event is signaled once the coroutine returns and
+        // may be waited on from outside the executor's worker threads.
+        void Start(TaskExecutor& executor, const TaskDescriptor& descriptor, TaskGraphEvent* completionEvent = nullptr)
+        {
+            AZ_Assert(m_handle, "TaskCoroutine %s was already started", descriptor.taskName);
+            promise_type& promise = m_handle.promise();
+            promise.m_executor = &executor;
+            promise.m_descriptor = descriptor;
+            promise.m_completionEvent = completionEvent;
+            if (completionEvent)
+            {
+                PrepareEvent(*completionEvent, executor);
+            }
+
+            Handle handle = m_handle;
+            m_handle = nullptr;
+            Schedule(handle);
+        }
+
+        // Resume a suspended coroutine as a new task on the executor it was started on
+        static void Schedule(Handle handle)
+        {
+            promise_type& promise = handle.promise();
+            TaskGraph graph{ "TaskCoroutine" };
+            graph.AddTask(
+                promise.m_descriptor,
+                [handle]
+                {
+                    handle.resume();
+                });
+            graph.Detach();
+            graph.SubmitOnExecutor(*promise.m_executor);
+        }
+
+    private:
+        friend class TaskGraphAwaiter;
+
+        explicit TaskCoroutine(Handle handle)
+            : m_handle{ handle }
+        {
+        }
+
+        static void PrepareEvent(TaskGraphEvent& event, TaskExecutor& executor)
+        {
+            event.IncWaitCount();
+            event.m_executor = &executor;
+        }
+
+        static void SignalEvent(TaskGraphEvent& event)
+        {
+            event.Signal();
+        }
+
+        static void SetContinuation(TaskGraphEvent& event, TaskGraphEvent::Continuation continuation, void* userData)
+        {
+            event.SetContinuation(continuation, userData);
+        }
+
+        Handle m_handle;
+    };
+
+    namespace Internal
+    {
+        // An awaited operation may complete before await_suspend has finished issuing it. Both parties arrive at
+        // the latch, and only the second one resumes the coroutine, so the awaiter is never touched after resumption.
+        class CoroutineResumeLatch final
+        {
+        public:
+            // Returns true for the second arrival
+            bool Arrive()
+            {
+                return m_arrivals.fetch_add(1, AZStd::memory_order_acq_rel) == 1;
+            }
+
+        private:
+            AZStd::atomic<uint32_t> m_arrivals{ 0 };
+        };
+    } // namespace Internal
+
+    // Awaits completion of a task graph, submitting it on the executor running the awaiting coroutine
+    class TaskGraphAwaiter final
+    {
+    public:
+        explicit TaskGraphAwaiter(TaskGraph& graph)
+            : m_graph{ graph }
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(TaskCoroutine::Handle handle)
+        {
+            m_handle = handle;
+            TaskCoroutine::SetContinuation(m_event, &TaskGraphAwaiter::OnGraphFinished, this);
+            m_graph.SubmitOnExecutor(*handle.promise().m_executor, &m_event);
+            // Resume inline if the graph already finished
+            return !m_latch.Arrive();
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+
+    private:
+        static void OnGraphFinished(void* userData)
+        {
+            auto awaiter = static_cast<TaskGraphAwaiter*>(userData);
+            if (awaiter->m_latch.Arrive())
+            {
+                TaskCoroutine::Schedule(awaiter->m_handle);
+            }
+        }
+
+        TaskGraph& m_graph;
+        TaskGraphEvent m_event{ "TaskGraphAwaiter" };
+        TaskCoroutine::Handle m_handle;
+        Internal::CoroutineResumeLatch m_latch;
+    };
+
+    inline TaskGraphAwaiter AwaitTaskGraph(TaskGraph& graph)
+    {
+        return TaskGraphAwaiter{ graph };
+    }
+} // namespace AZ
+
+#endif // AZ_TASK_COROUTINES_ENABLED
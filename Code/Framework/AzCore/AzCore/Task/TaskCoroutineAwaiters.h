@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// Awaitables that let a TaskCoroutine suspend on engine systems outside of the TaskGraph. Kept separate from
+// TaskCoroutine.h so that the core coroutine support does not depend on the Streamer or the AssetManager.
+
+#include <AzCore/Task/TaskCoroutine.h>
+
+#if defined(AZ_TASK_COROUTINES_ENABLED)
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+
+namespace AZ
+{
+    // Queues a prepared Streamer request (for instance one created with IStreamer::Read) and suspends until the
+    // request completes. Resumes with the final status of the request. The request's completion callback is
+    // taken over by the awaiter.
+    class StreamerRequestAwaiter final
+    {
+    public:
+        explicit StreamerRequestAwaiter(IO::FileRequestPtr request)
+            : m_request{ AZStd::move(request) }
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(TaskCoroutine::Handle handle)
+        {
+            m_handle = handle;
+            auto streamer = Interface<IO::IStreamer>::Get();
+            AZ_Assert(streamer, "StreamerRequestAwaiter requires the Streamer to be available");
+            streamer->SetRequestCompleteCallback(
+                m_request,
+                [this](IO::FileRequestHandle)
+                {
+                    if (m_latch.Arrive())
+                    {
+                        TaskCoroutine::Schedule(m_handle);
+                    }
+                });
+            streamer->QueueRequest(m_request);
+            return !m_latch.Arrive();
+        }
+
+        IO::IStreamerTypes::RequestStatus await_resume() const
+        {
+            return Interface<IO::IStreamer>::Get()->GetRequestStatus(m_request);
+        }
+
+    private:
+        IO::FileRequestPtr m_request;
+        TaskCoroutine::Handle m_handle;
+        Internal::CoroutineResumeLatch m_latch;
+    };
+
+    inline StreamerRequestAwaiter AwaitStreamerRequest(IO::FileRequestPtr request)
+    {
+        return StreamerRequestAwaiter{ AZStd::move(request) };
+    }
+
+    namespace Data
+    {
+        // Suspends until the asset is ready, failed to load or was canceled. Resumes with true if the asset is ready.
+        // The asset must have been queued for load beforehand (e.g. AssetManager::GetAsset).
+        class AssetReadyAwaiter final : private AssetBus::Handler
+        {
+        public:
+            explicit AssetReadyAwaiter(AssetId assetId)
+                : m_assetId{ assetId }
+            {
+            }
+
+            ~AssetReadyAwaiter() override
+            {
+                AssetBus::Handler::BusDisconnect();
+            }
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            bool await_suspend(TaskCoroutine::Handle handle)
+            {
+                m_handle = handle;
+                // Connecting to an asset that is already ready or in error dispatches the event synchronously
+                AssetBus::Handler::BusConnect(m_assetId);
+                return !m_latch.Arrive();
+            }
+
+            bool await_resume() const noexcept
+            {
+                return m_isReady;
+            }
+
+        private:
+            void OnAssetReady(Asset<AssetData>) override
+            {
+                Finish(true);
+            }
+
+            void OnAssetError(Asset<AssetData>) override
+            {
+                Finish(false);
+            }
+
+            void OnAssetCanceled(AssetId) override
+            {
+                Finish(false);
+            }
+
+            void Finish(bool isReady)
+            {
+                m_isReady = isReady;
+                AssetBus::Handler::BusDisconnect();
+                if (m_latch.Arrive())
+                {
+                    TaskCoroutine::Schedule(m_handle);
+                }
+            }
+
+            AssetId m_assetId;
+            TaskCoroutine::Handle m_handle;
+            AZ::Internal::CoroutineResumeLatch m_latch;
+            bool m_isReady = false;
+        };
+
+        inline AssetReadyAwaiter AwaitAssetReady(const AssetId& assetId)
+        {
+            return AssetReadyAwaiter{ assetId };
+        }
+    } // namespace Data
+} // namespace AZ
+
+#endif // AZ_TASK_COROUTINES_ENABLED
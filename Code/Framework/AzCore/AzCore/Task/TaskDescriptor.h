@@ -25,6 +25,15 @@ namespace AZ
         PRIORITY_COUNT = 4,
     };
 
+    // Placement hints are only honored by executors created in topology-aware mode (see cl_taskGraphTopologyAware).
+    // They steer a task towards a class of cores; they never prevent a task from running.
+    enum class TaskPlacement : uint8_t
+    {
+        ANY = 0, // Default
+        LATENCY_CRITICAL = 1, // Prefer performance cores (frame critical path work)
+        BACKGROUND = 2, // Prefer efficiency cores when the system has them (streaming, housekeeping)
+    };
+
     // All submitted tasks are associated with a TaskDescriptor which defines the priority, affinitization,
     // and tracking of the task resource utilization.
     //
@@ -42,6 +51,9 @@ namespace AZ
         // that were queued before it provided they had not yet started
         TaskPriority priority = TaskPriority::MEDIUM;
 
+        // Hint describing which class of cores should preferably run tasks of this kind
+        TaskPlacement placement = TaskPlacement::ANY;
+
         // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on cores
         // corresponding to a set bit. 0 is synonymous with all bits set
         uint32_t cpuMask = 0;
@@ -9,6 +9,11 @@
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 
+#include <AzCore/Jobs/Job.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
@@ -16,6 +21,7 @@
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/Module/Environment.h>
 
@@ -202,23 +208,28 @@ namespace AZ
         public:
             static thread_local TaskWorker* t_worker;
 
-            void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
+            void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, const Threading::LogicalProcessor* processor)
             {
                 m_executor = &executor;
 
                 m_threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
                 desc.m_name = m_threadName.c_str();
-                if (affinitize)
+                if (processor)
                 {
-                    desc.m_cpuId = 1 << id;
+                    m_processor = *processor;
                 }
                 m_active.store(true, AZStd::memory_order_release);
 
                 m_thread = AZStd::thread{ desc,
-                                          [this, &initSemaphore]
+                                          [this, &initSemaphore, pin = processor != nullptr]
                                           {
                                               t_worker = this;
+                                              if (pin && !Threading::SetCurrentThreadProcessor(m_processor.m_id))
+                                              {
+                                                  AZ_Warning("TaskExecutor", false, "Failed to pin %s to logical processor %u",
+                                                      m_threadName.c_str(), m_processor.m_id);
+                                              }
                                               initSemaphore.release();
                                               Run();
                                           } };
@@ -256,6 +267,37 @@ namespace AZ
 
             const char* GetThreadName() {return m_threadName.c_str();}
 
+            // Runs a ready task, then submits the successors it unblocks and releases its hold on the graph
+            static void Execute(::AZ::TaskExecutor& executor, Task* task)
+            {
+                task->Invoke();
+                // Decrement counts for all task successors
+                for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                {
+                    Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
+                    if (--successor->m_dependencyCount == 0)
+                    {
+                        executor.Submit(*successor);
+                    }
+                }
+
+                bool isRetained = task->m_graph->m_parent != nullptr;
+                if (task->m_graph->Release(executor.GetEventTracker()) == (isRetained ? 1u : 0u))
+                {
+                    executor.ReleaseGraph();
+                }
+            }
+
+            uint32_t GetNumaNode() const
+            {
+                return m_processor.m_numaNode;
+            }
+
+            Threading::CoreClass GetCoreClass() const
+            {
+                return m_processor.m_coreClass;
+            }
+
         private:
             void Run()
             {
@@ -268,29 +310,31 @@ namespace AZ
                         return;
                     }
 
-                    Task* task = m_queue.TryDequeue();
+                    Task* task = TryDequeueOrSteal();
                     while (task)
                     {
-                        task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
-                        {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
-                            {
-                                m_executor->Submit(*successor);
-                            }
-                        }
+                        Execute(*m_executor, task);
+                        task = TryDequeueOrSteal();
+                    }
+                }
+            }
 
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release(m_executor->GetEventTracker()) == (isRetained ? 1u : 0u))
-                        {
-                            m_executor->ReleaseGraph();
-                        }
+            Task* TryDequeueOrSteal()
+            {
+                if (Task* task = m_queue.TryDequeue(); task)
+                {
+                    return task;
+                }
 
-                        task = m_queue.TryDequeue();
+                // The steal order is only populated by topology-aware executors, nearest victims first
+                for (uint32_t victim : m_stealOrder)
+                {
+                    if (Task* task = m_executor->m_workers[victim].m_queue.TryDequeue(); task)
+                    {
+                        return task;
                     }
                 }
+                return nullptr;
             }
 
             AZStd::thread m_thread;
@@ -301,11 +345,44 @@ namespace AZ
             ::AZ::TaskExecutor* m_executor;
             TaskQueue m_queue;
             AZStd::string m_threadName;
+            Threading::LogicalProcessor m_processor;
+            AZStd::vector<uint32_t> m_stealOrder;
             friend class ::AZ::TaskExecutor;
         };
 
         thread_local TaskWorker* TaskWorker::t_worker = nullptr;
 
+        // Adapter used by shared executors to run a task on the job scheduler
+        class TaskJob final : public Job
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(TaskJob, ThreadPoolAllocator);
+
+            TaskJob(::AZ::TaskExecutor& executor, Task& task, JobContext* context)
+                : Job(true, context, false, JobPriority(task.GetPriorityNumber()))
+                , m_executor(executor)
+                , m_task(task)
+            {
+            }
+
+        protected:
+            void Process() override
+            {
+                TaskWorker::Execute(m_executor, &m_task);
+            }
+
+        private:
+            static s8 JobPriority(uint8_t taskPriority)
+            {
+                // Jobs run higher values first, task priorities run lower values first
+                constexpr s8 priorities[] = { 96, 32, 0, -64 };
+                return priorities[AZStd::min<size_t>(taskPriority, AZ_ARRAY_SIZE(priorities) - 1)];
+            }
+
+            ::AZ::TaskExecutor& m_executor;
+            Task& m_task;
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Implement basic CompiledTaskGraph event breadcrumbs to help debug
         // https://github.com/o3de/o3de/issues/12015
@@ -370,20 +447,36 @@ namespace AZ
         }
     }
 
-    TaskExecutor::TaskExecutor(uint32_t threadCount)
+    TaskExecutor::TaskExecutor(uint32_t threadCount, bool topologyAware)
         : m_eventTracker(this)
     {
-        // TODO: Configure thread count + affinity based on configuration
         m_threadCount = threadCount == 0 ? AZStd::thread::hardware_concurrency() : threadCount;
+        m_topologyAware = topologyAware;
 
         m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker)));
 
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            new (m_workers + i) Internal::TaskWorker{};
+        }
+
+        // Placement must be resolved before any worker runs since workers read their steal order lock-free
+        AZStd::vector<Threading::LogicalProcessor> placement;
+        if (m_topologyAware)
+        {
+            placement = AssignProcessors(Threading::QueryCpuTopology(), m_threadCount);
+            for (uint32_t i = 0; i != m_threadCount; ++i)
+            {
+                m_workers[i].m_processor = placement[i];
+            }
+            InitializeTopology();
+        }
+
         AZStd::semaphore initSemaphore;
 
         for (uint32_t i = 0; i != m_threadCount; ++i)
         {
-            new (m_workers + i) Internal::TaskWorker{};
-            m_workers[i].Spawn(*this, i, initSemaphore, false);
+            m_workers[i].Spawn(*this, i, initSemaphore, placement.empty() ? nullptr : &placement[i]);
         }
 
         for (size_t i = 0; i != m_threadCount; ++i)
@@ -392,15 +485,118 @@ namespace AZ
         }
     }
 
+    TaskExecutor::TaskExecutor(JobContext& jobContext)
+        : m_jobContext(&jobContext)
+        , m_eventTracker(this)
+    {
+        AZ_Assert(jobContext.GetJobManager().IsAsynchronous(), "A shared TaskExecutor requires a job manager with worker threads");
+    }
+
     TaskExecutor::~TaskExecutor()
     {
+        // Join every worker before destroying any of them, since workers may steal from each other's queues
         for (size_t i = 0; i != m_threadCount; ++i)
         {
             m_workers[i].Join();
+        }
+
+        for (size_t i = 0; i != m_threadCount; ++i)
+        {
             m_workers[i].~TaskWorker();
         }
 
-        azfree(m_workers);
+        if (m_workers)
+        {
+            azfree(m_workers);
+        }
+    }
+
+    void TaskExecutor::InitializeTopology()
+    {
+        constexpr uint32_t CoreClassCount = static_cast<uint32_t>(Threading::CoreClass::Count);
+
+        m_numaNodeCount = 1;
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            m_numaNodeCount = AZStd::max(m_numaNodeCount, m_workers[i].GetNumaNode() + 1);
+        }
+
+        m_nodeClassWorkers.resize(m_numaNodeCount * CoreClassCount);
+        m_nodeWorkers.resize(m_numaNodeCount);
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            const uint32_t node = m_workers[i].GetNumaNode();
+            const uint32_t coreClass = static_cast<uint32_t>(m_workers[i].GetCoreClass());
+            m_nodeClassWorkers[node * CoreClassCount + coreClass].push_back(i);
+            m_nodeWorkers[node].push_back(i);
+            m_classWorkers[coreClass].push_back(i);
+            m_allWorkers.push_back(i);
+        }
+
+        // Steal from the local node first, then the remote nodes. Efficiency workers never steal from
+        // performance workers so that work placed on performance cores does not migrate onto slower cores.
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            Internal::TaskWorker& thief = m_workers[i];
+            const bool thiefIsEfficiency = thief.GetCoreClass() == Threading::CoreClass::Efficiency;
+            for (uint32_t pass = 0; pass != 2; ++pass)
+            {
+                for (uint32_t victim = 0; victim != m_threadCount; ++victim)
+                {
+                    const bool sameNode = m_workers[victim].GetNumaNode() == thief.GetNumaNode();
+                    if (victim == i || sameNode != (pass == 0))
+                    {
+                        continue;
+                    }
+                    if (thiefIsEfficiency && m_workers[victim].GetCoreClass() != Threading::CoreClass::Efficiency)
+                    {
+                        continue;
+                    }
+                    thief.m_stealOrder.push_back(victim);
+                }
+            }
+        }
+    }
+
+    AZStd::vector<Threading::LogicalProcessor> TaskExecutor::AssignProcessors(const Threading::CpuTopology& topology, uint32_t threadCount)
+    {
+        // Bucket the processors per node, performance cores first, then deal them out across the nodes
+        // round-robin so that every node receives a share of the workers.
+        AZStd::vector<AZStd::vector<Threading::LogicalProcessor>> nodes(topology.m_numaNodeCount);
+        for (const Threading::LogicalProcessor& processor : topology.m_processors)
+        {
+            nodes[AZStd::min(processor.m_numaNode, topology.m_numaNodeCount - 1)].push_back(processor);
+        }
+        for (auto& node : nodes)
+        {
+            AZStd::stable_sort(
+                node.begin(), node.end(),
+                [](const Threading::LogicalProcessor& lhs, const Threading::LogicalProcessor& rhs)
+                {
+                    return lhs.m_coreClass < rhs.m_coreClass;
+                });
+        }
+
+        AZStd::vector<Threading::LogicalProcessor> ordered;
+        ordered.reserve(topology.m_processors.size());
+        for (size_t depth = 0; ordered.size() != topology.m_processors.size(); ++depth)
+        {
+            for (const auto& node : nodes)
+            {
+                if (depth < node.size())
+                {
+                    ordered.push_back(node[depth]);
+                }
+            }
+        }
+
+        AZStd::vector<Threading::LogicalProcessor> placement(threadCount);
+        for (uint32_t i = 0; i != threadCount; ++i)
+        {
+            // Oversubscribed executors wrap around so each processor receives at most one extra worker per lap
+            placement[i] = ordered.empty() ? Threading::LogicalProcessor{} : ordered[i % ordered.size()];
+        }
+        return placement;
     }
 
     Internal::TaskWorker* TaskExecutor::GetTaskWorker()
@@ -449,11 +645,65 @@ namespace AZ
         }
     }
 
+    const AZStd::vector<uint32_t>& TaskExecutor::SelectWorkerGroup(TaskPlacement placement) const
+    {
+        constexpr uint32_t CoreClassCount = static_cast<uint32_t>(Threading::CoreClass::Count);
+
+        // Tasks released from a worker (successors, subgraphs) stay on that worker's NUMA node
+        const Internal::TaskWorker* submitter = Internal::TaskWorker::t_worker;
+        const bool hasLocalNode = submitter && submitter->m_executor == this && m_numaNodeCount > 1;
+
+        if (placement != TaskPlacement::ANY)
+        {
+            const uint32_t coreClass = static_cast<uint32_t>(
+                placement == TaskPlacement::BACKGROUND ? Threading::CoreClass::Efficiency : Threading::CoreClass::Performance);
+            if (hasLocalNode)
+            {
+                const auto& local = m_nodeClassWorkers[submitter->GetNumaNode() * CoreClassCount + coreClass];
+                if (!local.empty())
+                {
+                    return local;
+                }
+            }
+            if (!m_classWorkers[coreClass].empty())
+            {
+                return m_classWorkers[coreClass];
+            }
+        }
+
+        if (hasLocalNode)
+        {
+            return m_nodeWorkers[submitter->GetNumaNode()];
+        }
+        return m_allWorkers;
+    }
+
     void TaskExecutor::Submit(Internal::Task& task)
     {
-        // TODO: Something more sophisticated is likely needed here.
-        // First, we are completely ignoring affinity.
-        // Second, some heuristics on core availability will help distribute work more effectively
+        if (m_jobContext)
+        {
+            // Placement hints are not honored here, the job scheduler's work stealing balances the load
+            Job* job = aznew Internal::TaskJob(*this, task, m_jobContext);
+            job->Start();
+            return;
+        }
+
+        // TODO: Some heuristics on core availability will help distribute work more effectively
+        if (m_topologyAware)
+        {
+            const AZStd::vector<uint32_t>& group = SelectWorkerGroup(task.GetPlacement());
+            for (size_t attempt = 0; attempt != group.size(); ++attempt)
+            {
+                uint32_t nextWorker = group[++m_lastSubmission % group.size()];
+                if (m_workers[nextWorker].Enabled())
+                {
+                    m_workers[nextWorker].Enqueue(&task);
+                    return;
+                }
+            }
+            // Every worker of the preferred group is unavailable, fall through to the full pool
+        }
+
         uint32_t nextWorker = ++m_lastSubmission % m_threadCount;
         while (!m_workers[nextWorker].Enabled())
         {
@@ -10,6 +10,7 @@
 
 #include <AzCore/Task/Internal/Task.h>
 #include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/Threading/CpuTopology.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
@@ -25,6 +26,7 @@ namespace AZ
     class TaskGraphEvent;
     class TaskGraph;
     class TaskExecutor;
+    class JobContext;
 
     namespace Internal
     {
@@ -126,8 +128,15 @@ namespace AZ
         // Invoked by a system component on program launch
         static void SetInstance(TaskExecutor* executor);
 
-        // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency
-        explicit TaskExecutor(uint32_t threadCount = 0);
+        // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency.
+        // A topology-aware executor pins each worker to a logical processor, spreading workers across NUMA nodes
+        // and core classes. Submission then honors TaskDescriptor::placement, successors stay on the NUMA node of
+        // the worker that released them, and idle workers steal from workers on their own node first.
+        explicit TaskExecutor(uint32_t threadCount = 0, bool topologyAware = false);
+
+        // A shared executor owns no threads. Every ready task is dispatched as a job on the work-stealing
+        // scheduler behind the given context, so the Job and TaskGraph APIs draw from a single worker pool.
+        explicit TaskExecutor(JobContext& jobContext);
         ~TaskExecutor();
 
         // Submit a task graph for execution. Waitable task graphs cannot enqueue work on the task thread
@@ -138,6 +147,12 @@ namespace AZ
 
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
+        bool IsTopologyAware() const { return m_topologyAware; }
+
+        bool IsSharedWithJobs() const { return m_jobContext != nullptr; }
+
+        uint32_t GetThreadCount() const { return m_threadCount; }
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
@@ -147,8 +162,22 @@ namespace AZ
         void ReleaseGraph();
         void ReactivateTaskWorker();
 
-        Internal::TaskWorker* m_workers;
+        static AZStd::vector<Threading::LogicalProcessor> AssignProcessors(const Threading::CpuTopology& topology, uint32_t threadCount);
+        void InitializeTopology();
+        const AZStd::vector<uint32_t>& SelectWorkerGroup(TaskPlacement placement) const;
+
+        Internal::TaskWorker* m_workers = nullptr;
+        JobContext* m_jobContext = nullptr;
         uint32_t m_threadCount = 0;
+        bool m_topologyAware = false;
+
+        // Worker index lists used to honor placement hints in topology-aware mode. Groups are indexed by
+        // (numaNode * CoreClassCount + coreClass), with per-class and per-node aggregates.
+        AZStd::vector<AZStd::vector<uint32_t>> m_nodeClassWorkers;
+        AZStd::vector<AZStd::vector<uint32_t>> m_nodeWorkers;
+        AZStd::vector<uint32_t> m_classWorkers[static_cast<size_t>(Threading::CoreClass::Count)];
+        AZStd::vector<uint32_t> m_allWorkers;
+        uint32_t m_numaNodeCount = 1;
         AZStd::atomic<uint32_t> m_lastSubmission;
         AZStd::atomic<uint64_t> m_graphsRemaining;
 
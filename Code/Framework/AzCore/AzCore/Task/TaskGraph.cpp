@@ -9,6 +9,8 @@
 #include <AzCore/Task/TaskGraph.h>
 
 #include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 
 namespace AZ
 {
@@ -17,6 +19,9 @@ namespace AZ
     void TaskGraphEvent::Wait()
     {
         AZ_Assert(m_executor->GetTaskWorker() == nullptr, "Event %s waiting in a task is unsupported", m_label);
+        AZ_Assert(
+            !m_executor->IsSharedWithJobs() || m_executor->m_jobContext->GetJobManager().GetCurrentJob() == nullptr,
+            "Event %s waiting in a job is unsupported when the TaskGraph shares the job scheduler", m_label);
         m_semaphore.acquire();
     }
 
@@ -55,7 +60,14 @@ namespace AZ
             // validate no one incremented the wait count and mark signalling state
             if (m_waitCount.compare_exchange_strong(expectedValue, -1))
             {
+                // The event may be destroyed as soon as the semaphore is released, read the continuation first
+                Continuation continuation = m_continuation;
+                void* continuationData = m_continuationData;
                 m_semaphore.release();
+                if (continuation)
+                {
+                    continuation(continuationData);
+                }
             }
         }
     }
@@ -103,9 +115,25 @@ namespace AZ
         }
         m_tasks.clear();
         m_links.clear();
+        m_parameters.clear();
         m_linkCount = 0;
     }
 
+    void TaskGraph::Compile()
+    {
+        AZ_Assert(!m_submitted, "Cannot compile task graph %s while it is in flight", m_label);
+        if (!m_compiledTaskGraph && !IsEmpty())
+        {
+            CompileInternal(TaskExecutor::Instance().GetEventTracker());
+        }
+    }
+
+    void TaskGraph::CompileInternal(Internal::CompiledTaskGraphTracker& eventTracker)
+    {
+        m_compiledTaskGraph = aznew CompiledTaskGraph(AZStd::move(m_tasks), m_links, m_linkCount, m_retained ? this : nullptr, m_label);
+        eventTracker.WriteEventInfo(m_compiledTaskGraph, Internal::CTGEvent::Allocated, "CompileInternal");
+    }
+
     void TaskGraph::Submit(TaskGraphEvent* waitEvent)
     {
         // If this is a new empty task graph (and not a retained taskgraph that was previously run),
@@ -128,10 +156,10 @@ namespace AZ
     void TaskGraph::SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent)
     {
         Internal::CompiledTaskGraphTracker& eventTracker = executor.GetEventTracker();
+        AZ_Assert(m_retained || m_parameters.empty(), "Detached task graph %s cannot own parameters, they would not outlive its tasks", m_label);
         if (!m_compiledTaskGraph)
         {
-            m_compiledTaskGraph = aznew CompiledTaskGraph(AZStd::move(m_tasks), m_links, m_linkCount, m_retained ? this : nullptr, m_label);
-            eventTracker.WriteEventInfo(m_compiledTaskGraph, Internal::CTGEvent::Allocated, "SubmitOnExecutor");
+            CompileInternal(eventTracker);
         }
 
         m_compiledTaskGraph->m_waitEvent = waitEvent;
@@ -16,6 +16,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/RTTI/RTTI.h>
 
 namespace AZ
@@ -23,10 +24,34 @@ namespace AZ
     namespace Internal
     {
         class CompiledTaskGraph;
+        class CompiledTaskGraphTracker;
+        class TaskGraphContinuation;
         class TaskWorker;
+
+        class TaskParameterStorage
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(TaskParameterStorage, SystemAllocator);
+            virtual ~TaskParameterStorage() = default;
+        };
+
+        template<typename T>
+        class TypedTaskParameterStorage final : public TaskParameterStorage
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(TypedTaskParameterStorage, SystemAllocator);
+
+            explicit TypedTaskParameterStorage(T&& value)
+                : m_value{ AZStd::move(value) }
+            {
+            }
+
+            T m_value;
+        };
     }
     class TaskExecutor;
     class TaskGraph;
+    class TaskCoroutine;
 
     class TaskGraphActiveInterface
     {
@@ -62,6 +87,42 @@ namespace AZ
         uint32_t m_index;
     };
 
+    // A TaskGraphParameter is a slot of per-submission data owned by a retained TaskGraph. Tasks capture the
+    // handle (a single pointer) by value and read through it when they run. Between submissions the owner
+    // patches the value with TaskGraph::SetParameter, which lets subsystems that run the same graph shape every
+    // frame resubmit the compiled graph instead of rebuilding it, without any heap allocation.
+    template<typename T>
+    class TaskGraphParameter final
+    {
+    public:
+        TaskGraphParameter() = default;
+
+        const T& Get() const
+        {
+            return *m_value;
+        }
+
+        const T& operator*() const
+        {
+            return *m_value;
+        }
+
+        const T* operator->() const
+        {
+            return m_value;
+        }
+
+    private:
+        friend class TaskGraph;
+
+        explicit TaskGraphParameter(T* value)
+            : m_value{ value }
+        {
+        }
+
+        T* m_value = nullptr;
+    };
+
     // A TaskGraphEvent may be used to block until one or more task graphs has finished executing. Usage
     // is NOT recommended for the majority of tasks (prefer to simply containing expanding/contracting
     // the graph without synchronization over the course of the frame). However, the event
@@ -74,6 +135,10 @@ namespace AZ
     class TaskGraphEvent
     {
     public:
+        // Invoked on the signaling thread once the event is signaled, used to schedule task continuations and to resume
+        // suspended TaskCoroutines
+        using Continuation = void (*)(void* userData);
+
         // ! The supplied string label is expected to be a string literal or otherwise outlive the lifetime of this TG event.
         explicit TaskGraphEvent(const char* label);
         bool IsSignaled();
@@ -81,15 +146,20 @@ namespace AZ
 
     private:
         friend class ::AZ::Internal::CompiledTaskGraph;
+        friend class ::AZ::Internal::TaskGraphContinuation;
         friend class TaskGraph;
         friend class TaskExecutor;
+        friend class TaskCoroutine;
 
         void IncWaitCount();
         void Signal();
+        void SetContinuation(Continuation continuation, void* userData);
 
         AZStd::binary_semaphore m_semaphore;
         AZStd::atomic_int       m_waitCount = 0;
         TaskExecutor*           m_executor = nullptr;
+        Continuation            m_continuation = nullptr;
+        void*                   m_continuationData = nullptr;
         [[maybe_unused]] const char* m_label = nullptr;
     };
 
@@ -123,6 +193,25 @@ namespace AZ
         template <typename... Lambdas>
         AZStd::array<TaskToken, sizeof...(Lambdas)> AddTasks(TaskDescriptor const& descriptor, Lambdas&&... lambdas);
 
+        // Reserve a parameter slot that tasks of this graph can capture and that is patched between submissions.
+        // Parameters live until the graph is Reset or destroyed.
+        // NOTE: This operation is invalid if the graph is in-flight
+        template<typename T>
+        TaskGraphParameter<T> AddParameter(T initialValue = {});
+
+        // Overwrite the value of a parameter before the next submission.
+        // NOTE: This operation is invalid if the graph is in-flight
+        template<typename T>
+        void SetParameter(TaskGraphParameter<T> parameter, T value);
+
+        // Compile the recorded tasks and edges ahead of the first submission. Retained graphs compile once, and
+        // every subsequent submission reuses the compiled graph. Submit compiles on demand if this is not called.
+        // NOTE: This operation is invalid if the graph is in-flight
+        void Compile();
+
+        // Returns true while a submission of this retained graph has yet to complete
+        bool IsInFlight() const;
+
         // By default, you are responsible for retaining the TaskGraph, indicating you promise that
         // this TaskGraph will live as long as it takes for all constituent tasks to complete.
         // Once retained, this task graph can be resubmitted after completion without any
@@ -159,10 +248,14 @@ namespace AZ
         friend class TaskToken;
         friend class Internal::CompiledTaskGraph;
 
+        void CompileInternal(Internal::CompiledTaskGraphTracker& eventTracker);
+
         Internal::CompiledTaskGraph* m_compiledTaskGraph = nullptr;
 
         AZStd::vector<Internal::Task> m_tasks;
 
+        AZStd::vector<AZStd::unique_ptr<Internal::TaskParameterStorage>> m_parameters;
+
         // Task index |-> Dependent task indices
         AZStd::unordered_map<uint32_t, AZStd::vector<uint32_t>> m_links;
 
@@ -38,6 +38,13 @@ namespace AZ
         return m_semaphore.try_acquire_for(AZStd::chrono::milliseconds{ 0 });
     }
 
+    inline void TaskGraphEvent::SetContinuation(Continuation continuation, void* userData)
+    {
+        AZ_Assert(m_waitCount == 0, "The continuation of TaskGraphEvent %s must be set before it is submitted", m_label);
+        m_continuation = continuation;
+        m_continuationData = userData;
+    }
+
     template<typename Lambda>
     TaskToken TaskGraph::AddTask(TaskDescriptor const& desc, Lambda&& lambda)
     {
@@ -54,6 +61,30 @@ namespace AZ
         return { AddTask(descriptor, AZStd::forward<Lambdas>(lambdas))... };
     }
 
+    template<typename T>
+    TaskGraphParameter<T> TaskGraph::AddParameter(T initialValue)
+    {
+        AZ_Assert(!m_submitted, "Cannot add parameters to TaskGraph %s while it is in flight.", m_label);
+
+        auto storage = aznew Internal::TypedTaskParameterStorage<T>(AZStd::move(initialValue));
+        m_parameters.emplace_back(storage);
+        return TaskGraphParameter<T>{ &storage->m_value };
+    }
+
+    template<typename T>
+    void TaskGraph::SetParameter(TaskGraphParameter<T> parameter, T value)
+    {
+        AZ_Assert(!m_submitted, "Cannot patch parameters of TaskGraph %s while it is in flight.", m_label);
+        AZ_Assert(parameter.m_value, "Cannot patch an unbound parameter of TaskGraph %s", m_label);
+
+        *parameter.m_value = AZStd::move(value);
+    }
+
+    inline bool TaskGraph::IsInFlight() const
+    {
+        return m_submitted;
+    }
+
     inline bool TaskGraph::IsEmpty()
     {
         return m_tasks.empty();
@@ -61,6 +92,7 @@ namespace AZ
 
     inline void TaskGraph::Detach()
     {
+        AZ_Assert(!m_compiledTaskGraph, "Cannot detach TaskGraph %s after it was compiled.", m_label);
         m_retained = false;
     }
 } // namespace AZ
@@ -14,6 +14,8 @@
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Threading/ThreadUtils.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 
  // PERFORMANCE NOTE & TODO
  // Profiling Ros Con demo, Task Graph was 2-3ms slower than Jobs
@@ -27,6 +29,8 @@ AZ_CVAR(float, cl_taskGraphThreadsConcurrencyRatio, 1.0f, nullptr, AZ::ConsoleFu
 AZ_CVAR(uint32_t, cl_taskGraphThreadsNumReserved, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph number of hardware threads that are reserved for O3DE system threads. Value is clamped between 0 and the number of logical cores in the system");
 AZ_CVAR(uint32_t, cl_taskGraphThreadsMinNumber, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph minimum number of worker threads to create after scaling the number of hw threads");
 AZ_CVAR(uint32_t, cl_taskGraphThreadsMaxNumber, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph maximum number of worker threads to create after scaling the number of hw threads (0 indicates uncapped)");
+AZ_CVAR(bool, cl_taskGraphUseJobScheduler, false, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph dispatches tasks onto the legacy Job system's work-stealing worker threads instead of spawning its own, so both APIs share one pool sized by cl_workerThreadsTotal. Read on activation");
+AZ_CVAR(bool, cl_taskGraphTopologyAware, false, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph pins worker threads per NUMA node and core class, honors TaskDescriptor placement hints and steals work from the local node first. Read on activation");
 
 static constexpr uint32_t TaskExecutorServiceCrc = AZ_CRC_CE("TaskExecutorService");
 
@@ -45,7 +49,15 @@ namespace AZ
             cl_taskGraphThreadsMaxNumber = 1;
         }
 
-        if (Interface<TaskGraphActiveInterface>::Get() == nullptr)
+        JobContext* jobContext = JobContext::GetGlobalContext();
+        if (Interface<TaskGraphActiveInterface>::Get() == nullptr && cl_taskGraphUseJobScheduler && jobContext &&
+            jobContext->GetJobManager().IsAsynchronous())
+        {
+            Interface<TaskGraphActiveInterface>::Register(this);
+            m_taskExecutor = aznew TaskExecutor(*jobContext);
+            TaskExecutor::SetInstance(m_taskExecutor);
+        }
+        else if (Interface<TaskGraphActiveInterface>::Get() == nullptr)
         {
         #if (AZ_TRAIT_THREAD_NUM_TASK_GRAPH_WORKER_THREADS)
             const uint32_t numberOfWorkerThreads = AZ_TRAIT_THREAD_NUM_TASK_GRAPH_WORKER_THREADS;
@@ -55,7 +67,7 @@ namespace AZ
                 cl_taskGraphThreadsNumReserved);
         #endif // (AZ_TRAIT_THREAD_NUM_TASK_GRAPH_WORKER_THREADS)
             Interface<TaskGraphActiveInterface>::Register(this); // small window that another thread can try to use taskgraph between this line and the set instance.
-            m_taskExecutor = aznew TaskExecutor(numberOfWorkerThreads);
+            m_taskExecutor = aznew TaskExecutor(numberOfWorkerThreads, cl_taskGraphTopologyAware);
             TaskExecutor::SetInstance(m_taskExecutor);
         }
     }
@@ -87,8 +99,10 @@ namespace AZ
         incompatible.push_back(TaskExecutorServiceCrc);
     }
 
-    void TaskGraphSystemComponent::GetDependentServices([[maybe_unused]] ComponentDescriptor::DependencyArrayType& dependent)
+    void TaskGraphSystemComponent::GetDependentServices(ComponentDescriptor::DependencyArrayType& dependent)
     {
+        // Activate after the job manager so that the executor can share its worker threads
+        dependent.push_back(AZ_CRC_CE("JobsService"));
     }
 
     void TaskGraphSystemComponent::Reflect(ReflectContext* context)
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::Threading
+{
+    //! Broad performance class of a logical processor. Hybrid CPUs (P/E-cores, big.LITTLE) report both classes,
+    //! homogeneous CPUs report every processor as Performance.
+    enum class CoreClass : uint8_t
+    {
+        Performance = 0,
+        Efficiency = 1,
+        Count = 2,
+    };
+
+    struct LogicalProcessor
+    {
+        //! Operating system index of the logical processor, suitable for SetCurrentThreadProcessor.
+        uint32_t m_id = 0;
+        //! NUMA node the processor belongs to. Always 0 on single-node systems.
+        uint32_t m_numaNode = 0;
+        CoreClass m_coreClass = CoreClass::Performance;
+    };
+
+    struct CpuTopology
+    {
+        //! All online logical processors, sorted by id.
+        AZStd::vector<LogicalProcessor> m_processors;
+        uint32_t m_numaNodeCount = 1;
+        bool m_hasEfficiencyCores = false;
+    };
+
+    //! Queries the NUMA node and core class of every online logical processor.
+    //! Platforms that cannot report a topology return a single node of hardware_concurrency() Performance processors.
+    CpuTopology QueryCpuTopology();
+
+    //! Restricts the calling thread to run only on the given logical processor.
+    //! @return false if pinning is unsupported on this platform or the request was rejected by the OS.
+    bool SetCurrentThreadProcessor(uint32_t logicalProcessorId);
+} // namespace AZ::Threading
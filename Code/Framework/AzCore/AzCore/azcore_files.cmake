@@ -41,6 +41,7 @@ set(FILES
     Component/ComponentApplicationLifecycle.h
     Component/ComponentBus.cpp
     Component/ComponentBus.h
+    Component/ComponentDataStorage.h
     Component/ComponentExport.h
     Component/Entity.cpp
     Component/Entity.h
@@ -134,6 +135,8 @@ set(FILES
     EBus/IEventScheduler.h
     EBus/OrderedEvent.h
     EBus/OrderedEvent.inl
+    EBus/ParallelDispatch.cpp
+    EBus/ParallelDispatch.h
     EBus/Policies.h
     EBus/Results.h
     EBus/ScheduledEvent.cpp
@@ -144,6 +147,7 @@ set(FILES
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
     EBus/Internal/Handlers.h
+    EBus/Internal/ParallelDispatch.h
     EBus/Internal/StoragePolicies.h
     Instance/InstancePool.h
     Interface/Interface.h
@@ -161,6 +165,9 @@ set(FILES
     IO/CompressorZStd.cpp
     IO/CompressorZStd.h
     IO/FileIO.cpp
+    IO/FramedCompression.cpp
+    IO/FramedCompression.h
+    IO/MappedFile.h
     IO/FileIO.h
     IO/FileReader.cpp
     IO/FileReader.h
@@ -197,6 +204,8 @@ set(FILES
     IO/Streamer/FileRequest.cpp
     IO/Streamer/FullFileDecompressor.h
     IO/Streamer/FullFileDecompressor.cpp
+    IO/Streamer/PersistentCache.h
+    IO/Streamer/PersistentCache.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
     IO/Streamer/RequestPath.h
@@ -215,6 +224,8 @@ set(FILES
     IO/Streamer/StreamerContext.cpp
     IO/Streamer/StreamerComponent.cpp
     IO/Streamer/StreamerComponent.h
+    IO/Streamer/StreamerTrace.h
+    IO/Streamer/StreamerTrace.cpp
     IO/Streamer/StreamStackEntry.h
     IO/Streamer/StreamStackEntry.cpp
     IPC/SharedMemory.cpp
@@ -364,6 +375,8 @@ set(FILES
     Math/ShapeIntersection.cpp
     Math/ShapeIntersection.h
     Math/ShapeIntersection.inl
+    Math/SimdBatch.cpp
+    Math/SimdBatch.h
     Math/SimdMath.h
     Math/SimdMathVec1.h
     Math/SimdMathVec2.h
@@ -409,6 +422,8 @@ set(FILES
     Math/ColorSerializer.cpp
     Memory/AllocationRecords.cpp
     Memory/AllocationRecords.h
+    Memory/AllocationSampler.cpp
+    Memory/AllocationSampler.h
     Memory/AllocatorBase.cpp
     Memory/AllocatorBase.h
     Memory/AllocatorInstance.h
@@ -420,6 +435,8 @@ set(FILES
     Memory/ChildAllocatorSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HphaAllocator.cpp
     Memory/HphaAllocator.h
     Memory/IAllocator.h
@@ -435,6 +452,8 @@ set(FILES
     Memory/SimpleSchemaAllocator.h
     Memory/SystemAllocator.cpp
     Memory/SystemAllocator.h
+    Metrics/BinaryTraceEventLogger.h
+    Metrics/BinaryTraceEventLogger.cpp
     Metrics/EventLoggerFactoryImpl.h
     Metrics/EventLoggerFactoryImpl.cpp
     Metrics/EventLoggerReflectUtils.cpp
@@ -563,6 +582,8 @@ set(FILES
     Serialization/Locale.cpp
     Serialization/Utils.h
     Serialization/SerializationUtils.cpp
+    Serialization/CompactClassLayout.cpp
+    Serialization/CompactClassLayout.h
     Serialization/ObjectStream.cpp
     Serialization/ObjectStream.h
     Serialization/PointerObject.h
@@ -609,6 +630,8 @@ set(FILES
     Serialization/Json/JsonSerializationSettings.h
     Serialization/Json/JsonSerializer.h
     Serialization/Json/JsonSerializer.cpp
+    Serialization/Json/JsonStreamingDeserializer.h
+    Serialization/Json/JsonStreamingDeserializer.cpp
     Serialization/Json/JsonStringConversionUtils.h
     Serialization/Json/JsonSystemComponent.h
     Serialization/Json/JsonSystemComponent.cpp
@@ -656,6 +679,8 @@ set(FILES
     Settings/SettingsRegistryOriginTracker.h
     Settings/SettingsRegistryScriptUtils.cpp
     Settings/SettingsRegistryScriptUtils.h
+    Settings/SettingsRegistrySnapshot.cpp
+    Settings/SettingsRegistrySnapshot.h
     Settings/SettingsRegistryVisitorUtils.cpp
     Settings/SettingsRegistryVisitorUtils.h
     Settings/TextParser.cpp
@@ -691,6 +716,10 @@ set(FILES
     Task/Internal/Task.inl
     Task/Internal/Task.h
     Task/Internal/TaskConfig.h
+    Task/TaskContinuation.cpp
+    Task/TaskContinuation.h
+    Task/TaskCoroutine.h
+    Task/TaskCoroutineAwaiters.h
     Task/TaskDescriptor.h
     Task/TaskExecutor.cpp
     Task/TaskExecutor.h
@@ -699,6 +728,7 @@ set(FILES
     Task/TaskGraph.inl
     Task/TaskGraphSystemComponent.h
     Task/TaskGraphSystemComponent.cpp
+    Threading/CpuTopology.h
     Threading/ThreadSafeDeque.h
     Threading/ThreadSafeDeque.inl
     Threading/ThreadSafeObject.h
@@ -97,6 +97,9 @@ set(FILES
     containers/fixed_unordered_map.h
     containers/fixed_unordered_set.h
     containers/fixed_vector.h
+    containers/flat_hash_map.h
+    containers/flat_hash_set.h
+    containers/flat_hash_table.h
     containers/forward_list.h
     containers/intrusive_list.h
     containers/intrusive_set.h
@@ -108,6 +111,7 @@ set(FILES
     containers/rbtree.h
     containers/ring_buffer.h
     containers/set.h
+    containers/small_vector.h
     containers/span_fwd.h
     containers/span.h
     containers/span.inl
@@ -145,6 +149,7 @@ set(FILES
     parallel/containers/lock_free_stack.h
     parallel/containers/lock_free_stamped_queue.h
     parallel/containers/lock_free_stamped_stack.h
+    parallel/containers/mpmc_queue.h
     parallel/containers/internal/concurrent_hash_table.h
     delegate/delegate.h
     delegate/delegate_bind.h
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_hash_table.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/tuple.h>
+#include <AzCore/std/typetraits/type_identity.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashMapTableTraits
+        {
+            using key_type = Key;
+            using key_equal = EqualKey;
+            using hasher = Hasher;
+            using mapped_type = MappedType;
+            using allocator_type = Allocator;
+            using value_type = AZStd::pair<Key, MappedType>;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value.first; }
+        };
+    } // namespace Internal
+
+    /**
+     * Hash map storing its elements inline in an open addressing table, see Internal::flat_hash_table.
+     * It has the interface of unordered_map without the bucket and node handle functions, and is the better
+     * choice for small keys and values that are looked up often, while unordered_map remains the choice when
+     * references to the elements must stay valid across insertions.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_map
+        : public Internal::flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>
+    {
+        using base_type = Internal::flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>;
+
+    public:
+        using traits_type = typename base_type::traits_type;
+
+        using key_type = typename base_type::key_type;
+        using key_equal = typename base_type::key_equal;
+        using hasher = typename base_type::hasher;
+        using mapped_type = MappedType;
+
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        using value_type = typename base_type::value_type;
+        using pair_iter_bool = typename base_type::pair_iter_bool;
+
+        flat_hash_map() = default;
+        explicit flat_hash_map(size_type numBucketsHint,
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numBucketsHint);
+        }
+        explicit flat_hash_map(const allocator_type& allocator)
+            : base_type(hasher(), key_equal(), allocator)
+        {
+        }
+        template<class InputIterator>
+        flat_hash_map(InputIterator first, InputIterator last, size_type numBucketsHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numBucketsHint);
+            base_type::insert(first, last);
+        }
+        flat_hash_map(std::initializer_list<value_type> list, size_type numBucketsHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : flat_hash_map(list.begin(), list.end(), numBucketsHint, hash, keyEqual, allocator)
+        {
+        }
+
+        flat_hash_map(const flat_hash_map& rhs) = default;
+        flat_hash_map(flat_hash_map&& rhs) = default;
+        flat_hash_map(const flat_hash_map& rhs, const type_identity_t<allocator_type>& allocator)
+            : base_type(rhs, allocator)
+        {
+        }
+
+        flat_hash_map& operator=(const flat_hash_map& rhs) = default;
+        flat_hash_map& operator=(flat_hash_map&& rhs) = default;
+        flat_hash_map& operator=(std::initializer_list<value_type> list)
+        {
+            base_type::clear();
+            base_type::insert(list);
+            return *this;
+        }
+
+        mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+        mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+
+        mapped_type& at(const key_type& key)
+        {
+            iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+
+        using base_type::insert;
+
+        template<class... Args>
+        pair_iter_bool try_emplace(const key_type& key, Args&&... args)
+        {
+            return base_type::find_or_construct(key,
+                [&](value_type* slot)
+                {
+                    AZStd::construct_at(slot, AZStd::piecewise_construct, AZStd::forward_as_tuple(key),
+                        AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+                });
+        }
+        template<class... Args>
+        pair_iter_bool try_emplace(key_type&& key, Args&&... args)
+        {
+            return base_type::find_or_construct(key,
+                [&](value_type* slot)
+                {
+                    AZStd::construct_at(slot, AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::move(key)),
+                        AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+                });
+        }
+        template<class... Args>
+        iterator try_emplace(const_iterator, const key_type& key, Args&&... args)
+        {
+            return try_emplace(key, AZStd::forward<Args>(args)...).first;
+        }
+        template<class... Args>
+        iterator try_emplace(const_iterator, key_type&& key, Args&&... args)
+        {
+            return try_emplace(AZStd::move(key), AZStd::forward<Args>(args)...).first;
+        }
+
+        template<class M>
+        pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(key, AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+        template<class M>
+        pair_iter_bool insert_or_assign(key_type&& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(AZStd::move(key), AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+        template<class M>
+        iterator insert_or_assign(const_iterator, const key_type& key, M&& value)
+        {
+            return insert_or_assign(key, AZStd::forward<M>(value)).first;
+        }
+        template<class M>
+        iterator insert_or_assign(const_iterator, key_type&& key, M&& value)
+        {
+            return insert_or_assign(AZStd::move(key), AZStd::forward<M>(value)).first;
+        }
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    //! The order of the elements depends on the insertion history, so maps are compared by lookup.
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    bool operator==(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (const auto& element : a)
+        {
+            auto found = b.find(element.first);
+            if (found == b.end() || !(found->second == element.second))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+
+        for (auto iter = container.begin(); iter != container.end();)
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        return originalSize - container.size();
+    }
+} // namespace AZStd
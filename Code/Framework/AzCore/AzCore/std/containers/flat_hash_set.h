@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_hash_table.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/typetraits/type_identity.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashSetTableTraits
+        {
+            using key_type = Key;
+            using key_equal = EqualKey;
+            using hasher = Hasher;
+            using allocator_type = Allocator;
+            using value_type = Key;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value; }
+        };
+    } // namespace Internal
+
+    /**
+     * Hash set storing its elements inline in an open addressing table, see Internal::flat_hash_table.
+     * It has the interface of unordered_set without the bucket and node handle functions.
+     * The elements must not be modified through the iterators, as that would change their hash.
+     */
+    template<class Key, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_set
+        : public Internal::flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>
+    {
+        using base_type = Internal::flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>;
+
+    public:
+        using traits_type = typename base_type::traits_type;
+
+        using key_type = typename base_type::key_type;
+        using key_equal = typename base_type::key_equal;
+        using hasher = typename base_type::hasher;
+
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        using value_type = typename base_type::value_type;
+        using pair_iter_bool = typename base_type::pair_iter_bool;
+
+        flat_hash_set() = default;
+        explicit flat_hash_set(size_type numBucketsHint,
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numBucketsHint);
+        }
+        explicit flat_hash_set(const allocator_type& allocator)
+            : base_type(hasher(), key_equal(), allocator)
+        {
+        }
+        template<class InputIterator>
+        flat_hash_set(InputIterator first, InputIterator last, size_type numBucketsHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::rehash(numBucketsHint);
+            base_type::insert(first, last);
+        }
+        flat_hash_set(std::initializer_list<value_type> list, size_type numBucketsHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : flat_hash_set(list.begin(), list.end(), numBucketsHint, hash, keyEqual, allocator)
+        {
+        }
+
+        flat_hash_set(const flat_hash_set& rhs) = default;
+        flat_hash_set(flat_hash_set&& rhs) = default;
+        flat_hash_set(const flat_hash_set& rhs, const type_identity_t<allocator_type>& allocator)
+            : base_type(rhs, allocator)
+        {
+        }
+
+        flat_hash_set& operator=(const flat_hash_set& rhs) = default;
+        flat_hash_set& operator=(flat_hash_set&& rhs) = default;
+        flat_hash_set& operator=(std::initializer_list<value_type> list)
+        {
+            base_type::clear();
+            base_type::insert(list);
+            return *this;
+        }
+    };
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_set<Key, Hasher, EqualKey, Allocator>& left, flat_hash_set<Key, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    bool operator==(const flat_hash_set<Key, Hasher, EqualKey, Allocator>& a, const flat_hash_set<Key, Hasher, EqualKey, Allocator>& b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (const auto& element : a)
+        {
+            if (!b.contains(element))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const flat_hash_set<Key, Hasher, EqualKey, Allocator>& a, const flat_hash_set<Key, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_set<Key, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+
+        for (auto iter = container.begin(); iter != container.end();)
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        return originalSize - container.size();
+    }
+} // namespace AZStd
@@ -0,0 +1,673 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/typetraits/conditional.h>
+#include <AzCore/std/typetraits/typetraits.h>
+#include <AzCore/std/utility/move.h>
+#include <AzCore/std/utility/pair.h>
+
+namespace AZStd::Internal
+{
+    //! Control bytes of a flat_hash_table, one per slot.
+    //! A full slot stores the low 7 bits of the hash of its element, so the top bit is only set for empty and deleted slots.
+    namespace flat_hash_control
+    {
+        using ctrl_type = int8_t;
+        static constexpr ctrl_type empty = -128; // 0b10000000
+        static constexpr ctrl_type deleted = -2; // 0b11111110
+
+        //! Number of slots probed together. The control bytes of a group are compared in parallel with 64 bit
+        //! arithmetic (SWAR) rather than SSE, so probing behaves the same on every platform and compiler.
+        static constexpr size_t group_width = 8;
+
+        static constexpr uint64_t lsbs = 0x0101010101010101ull;
+        static constexpr uint64_t msbs = 0x8080808080808080ull;
+
+        //! Has the high bit of each byte of a group set for the slots matching a query.
+        struct bit_mask
+        {
+            explicit operator bool() const { return m_mask != 0; }
+
+            //! Index in the group of the first matching slot, the mask must not be empty.
+            size_t lowest() const { return static_cast<size_t>(az_ctz_u64(m_mask)) >> 3; }
+            //! Number of slots that don't match at the start of the group.
+            size_t leading_unmatched() const { return m_mask ? lowest() : group_width; }
+            //! Number of slots that don't match at the end of the group.
+            size_t trailing_unmatched() const { return m_mask ? static_cast<size_t>(az_clz_u64(m_mask)) >> 3 : group_width; }
+            //! Removes the first matching slot from the mask.
+            void clear_lowest() { m_mask &= m_mask - 1; }
+
+            uint64_t m_mask;
+        };
+
+        //! The control bytes of group_width consecutive slots, loaded little-endian so slot i is byte i.
+        struct group
+        {
+            explicit group(const ctrl_type* ctrl)
+            {
+                for (size_t i = 0; i < group_width; ++i)
+                {
+                    m_ctrl |= static_cast<uint64_t>(static_cast<uint8_t>(ctrl[i])) << (i * 8);
+                }
+            }
+
+            //! Slots whose control byte is h2. May report false positives in the bytes following a true match,
+            //! which is harmless as the keys of the matches are compared anyway.
+            bit_mask match(ctrl_type h2) const
+            {
+                const uint64_t x = m_ctrl ^ (lsbs * static_cast<uint8_t>(h2));
+                return { (x - lsbs) & ~x & msbs };
+            }
+
+            bit_mask match_empty() const { return { m_ctrl & (~m_ctrl << 6) & msbs }; }
+            bit_mask match_empty_or_deleted() const { return { m_ctrl & (~m_ctrl << 7) & msbs }; }
+
+            uint64_t m_ctrl = 0;
+        };
+    } // namespace flat_hash_control
+
+    /**
+     * Open addressing hash table shared by flat_hash_map and flat_hash_set.
+     * Elements are stored in a single array of slots next to an array of one control byte per slot, so a lookup
+     * touches the control bytes of one or two groups and then usually a single slot, instead of walking the
+     * per-bucket linked lists of hash_table. Lookups probe whole groups of slots at once, with triangular probing
+     * between groups over a power of two capacity, and the table grows once it is 7/8 full.
+     * Unlike hash_table, insertions and erasures invalidate iterators and references when the table rehashes,
+     * and the arguments of an insertion must not refer to an element of the same table.
+     *
+     * Traits provide key_type, value_type, hasher, key_equal, allocator_type and key_from_value(const value_type&).
+     */
+    template<class Traits>
+    class flat_hash_table
+    {
+        using this_type = flat_hash_table<Traits>;
+        using ctrl_type = flat_hash_control::ctrl_type;
+        static constexpr size_t group_width = flat_hash_control::group_width;
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+    public:
+        using traits_type = Traits;
+        using key_type = typename Traits::key_type;
+        using value_type = typename Traits::value_type;
+        using hasher = typename Traits::hasher;
+        using key_equal = typename Traits::key_equal;
+        using allocator_type = typename Traits::allocator_type;
+
+        using size_type = AZStd::size_t;
+        using difference_type = AZStd::ptrdiff_t;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+        template<bool IsConst>
+        class iterator_impl
+        {
+            friend this_type;
+            friend class iterator_impl<!IsConst>;
+
+        public:
+            using iterator_category = forward_iterator_tag;
+            using value_type = typename this_type::value_type;
+            using difference_type = AZStd::ptrdiff_t;
+            using pointer = conditional_t<IsConst, const value_type*, value_type*>;
+            using reference = conditional_t<IsConst, const value_type&, value_type&>;
+
+            iterator_impl() = default;
+            template<bool WasConst, class = enable_if_t<IsConst && !WasConst>>
+            iterator_impl(const iterator_impl<WasConst>& rhs)
+                : m_ctrl(rhs.m_ctrl)
+                , m_slot(rhs.m_slot)
+                , m_ctrlEnd(rhs.m_ctrlEnd)
+            {
+            }
+
+            reference operator*() const { return *m_slot; }
+            pointer operator->() const { return m_slot; }
+
+            iterator_impl& operator++()
+            {
+                ++m_ctrl;
+                ++m_slot;
+                skip_unused_slots();
+                return *this;
+            }
+            iterator_impl operator++(int)
+            {
+                iterator_impl it = *this;
+                ++*this;
+                return it;
+            }
+
+            friend bool operator==(const iterator_impl& lhs, const iterator_impl& rhs) { return lhs.m_slot == rhs.m_slot; }
+            friend bool operator!=(const iterator_impl& lhs, const iterator_impl& rhs) { return lhs.m_slot != rhs.m_slot; }
+
+        private:
+            iterator_impl(const ctrl_type* ctrl, value_type* slot, const ctrl_type* ctrlEnd)
+                : m_ctrl(ctrl)
+                , m_slot(slot)
+                , m_ctrlEnd(ctrlEnd)
+            {
+            }
+
+            void skip_unused_slots()
+            {
+                while (m_ctrl != m_ctrlEnd && *m_ctrl < 0)
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                }
+            }
+
+            const ctrl_type* m_ctrl = nullptr;
+            value_type* m_slot = nullptr;
+            const ctrl_type* m_ctrlEnd = nullptr;
+        };
+
+        using iterator = iterator_impl<false>;
+        using const_iterator = iterator_impl<true>;
+        using pair_iter_bool = pair<iterator, bool>;
+
+        explicit flat_hash_table(const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : m_hasher(hash)
+            , m_keyEqual(keyEqual)
+            , m_allocator(allocator)
+        {
+        }
+
+        flat_hash_table(const flat_hash_table& rhs)
+            : flat_hash_table(rhs, rhs.m_allocator)
+        {
+        }
+
+        flat_hash_table(const flat_hash_table& rhs, const allocator_type& allocator)
+            : m_hasher(rhs.m_hasher)
+            , m_keyEqual(rhs.m_keyEqual)
+            , m_allocator(allocator)
+        {
+            if (rhs.m_size == 0)
+            {
+                return;
+            }
+            // Same capacity and hash function, so every element can be copied into the slot it has in rhs.
+            allocate_storage(rhs.m_capacity);
+            ::memcpy(m_ctrl, rhs.m_ctrl, m_capacity + group_width);
+            for (size_type i = 0; i < m_capacity; ++i)
+            {
+                if (m_ctrl[i] >= 0)
+                {
+                    AZStd::construct_at(m_slots + i, rhs.m_slots[i]);
+                }
+            }
+            m_size = rhs.m_size;
+            m_growthLeft = rhs.m_growthLeft;
+        }
+
+        flat_hash_table(flat_hash_table&& rhs)
+            : m_ctrl(rhs.m_ctrl)
+            , m_slots(rhs.m_slots)
+            , m_size(rhs.m_size)
+            , m_capacity(rhs.m_capacity)
+            , m_growthLeft(rhs.m_growthLeft)
+            , m_hasher(AZStd::move(rhs.m_hasher))
+            , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+            , m_allocator(AZStd::move(rhs.m_allocator))
+        {
+            rhs.reset_storage();
+        }
+
+        ~flat_hash_table()
+        {
+            destroy_and_deallocate();
+        }
+
+        flat_hash_table& operator=(const flat_hash_table& rhs)
+        {
+            if (this != &rhs)
+            {
+                flat_hash_table copy(rhs);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        flat_hash_table& operator=(flat_hash_table&& rhs)
+        {
+            if (this != &rhs)
+            {
+                destroy_and_deallocate();
+                m_ctrl = rhs.m_ctrl;
+                m_slots = rhs.m_slots;
+                m_size = rhs.m_size;
+                m_capacity = rhs.m_capacity;
+                m_growthLeft = rhs.m_growthLeft;
+                m_hasher = AZStd::move(rhs.m_hasher);
+                m_keyEqual = AZStd::move(rhs.m_keyEqual);
+                m_allocator = AZStd::move(rhs.m_allocator);
+                rhs.reset_storage();
+            }
+            return *this;
+        }
+
+        iterator begin()
+        {
+            iterator it(m_ctrl, m_slots, m_ctrl + m_capacity);
+            it.skip_unused_slots();
+            return it;
+        }
+        const_iterator begin() const { return const_cast<this_type*>(this)->begin(); }
+        const_iterator cbegin() const { return begin(); }
+        iterator end() { return iterator(m_ctrl + m_capacity, m_slots + m_capacity, m_ctrl + m_capacity); }
+        const_iterator end() const { return const_cast<this_type*>(this)->end(); }
+        const_iterator cend() const { return end(); }
+
+        bool empty() const { return m_size == 0; }
+        size_type size() const { return m_size; }
+        size_type max_size() const { return m_allocator.max_size() / (sizeof(value_type) + 1); }
+        //! Number of slots, the table rehashes once 7/8 of them are in use.
+        size_type capacity() const { return m_capacity; }
+        size_type bucket_count() const { return m_capacity; }
+        float load_factor() const { return m_capacity ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f; }
+        static constexpr float max_load_factor() { return 7.0f / 8.0f; }
+
+        hasher hash_function() const { return m_hasher; }
+        key_equal key_eq() const { return m_keyEqual; }
+        allocator_type& get_allocator() { return m_allocator; }
+        const allocator_type& get_allocator() const { return m_allocator; }
+
+        iterator find(const key_type& key)
+        {
+            const size_type index = find_index(key, hash_key(key));
+            return index != npos ? iterator_at(index) : end();
+        }
+        const_iterator find(const key_type& key) const { return const_cast<this_type*>(this)->find(key); }
+        bool contains(const key_type& key) const { return find_index(key, hash_key(key)) != npos; }
+        size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+        pair_iter_bool insert(const value_type& value)
+        {
+            return find_or_construct(Traits::key_from_value(value),
+                [&value](value_type* slot)
+                {
+                    AZStd::construct_at(slot, value);
+                });
+        }
+        pair_iter_bool insert(value_type&& value)
+        {
+            return find_or_construct(Traits::key_from_value(value),
+                [&value](value_type* slot)
+                {
+                    AZStd::construct_at(slot, AZStd::move(value));
+                });
+        }
+        iterator insert(const_iterator, const value_type& value) { return insert(value).first; }
+        iterator insert(const_iterator, value_type&& value) { return insert(AZStd::move(value)).first; }
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+            {
+                insert(*first);
+            }
+        }
+        void insert(std::initializer_list<value_type> list) { insert(list.begin(), list.end()); }
+
+        //! Constructs the value before looking its key up, prefer try_emplace when the key is at hand.
+        template<class... Args>
+        pair_iter_bool emplace(Args&&... args)
+        {
+            value_type value(AZStd::forward<Args>(args)...);
+            return insert(AZStd::move(value));
+        }
+        template<class... Args>
+        iterator emplace_hint(const_iterator, Args&&... args)
+        {
+            return emplace(AZStd::forward<Args>(args)...).first;
+        }
+
+        //! Returns the iterator following the erased element.
+        iterator erase(const_iterator it)
+        {
+            const size_type index = it.m_slot - m_slots;
+            AZSTD_CONTAINER_ASSERT(index < m_capacity && m_ctrl[index] >= 0, "Iterator doesn't point to an element of this table");
+            erase_at(index);
+            iterator next(m_ctrl + index, m_slots + index, m_ctrl + m_capacity);
+            next.skip_unused_slots();
+            return next;
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+            {
+                first = erase(first);
+            }
+            return iterator(first.m_ctrl, first.m_slot, first.m_ctrlEnd);
+        }
+        size_type erase(const key_type& key)
+        {
+            const size_type index = find_index(key, hash_key(key));
+            if (index == npos)
+            {
+                return 0;
+            }
+            erase_at(index);
+            return 1;
+        }
+
+        //! Destroys all the elements but keeps the capacity.
+        void clear()
+        {
+            if (m_capacity == 0)
+            {
+                return;
+            }
+            destroy_elements();
+            ::memset(m_ctrl, static_cast<uint8_t>(flat_hash_control::empty), m_capacity + group_width);
+            m_size = 0;
+            m_growthLeft = capacity_to_growth(m_capacity);
+        }
+
+        //! Makes room for count elements without rehashing.
+        void reserve(size_type count)
+        {
+            const size_type capacity = capacity_for(count);
+            if (capacity > m_capacity)
+            {
+                resize(capacity);
+            }
+        }
+
+        //! Rehashes to at least numBuckets slots, and to no less than the current elements need. Also removes
+        //! the tombstones of erased elements, so rehash(0) compacts the table.
+        void rehash(size_type numBuckets)
+        {
+            size_type capacity = AZStd::max(capacity_for(m_size), numBuckets ? normalize_capacity(numBuckets) : 0);
+            if (m_size == 0 && numBuckets == 0)
+            {
+                destroy_and_deallocate();
+                reset_storage();
+                return;
+            }
+            resize(capacity);
+        }
+
+        void swap(flat_hash_table& rhs)
+        {
+            AZStd::swap(m_ctrl, rhs.m_ctrl);
+            AZStd::swap(m_slots, rhs.m_slots);
+            AZStd::swap(m_size, rhs.m_size);
+            AZStd::swap(m_capacity, rhs.m_capacity);
+            AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+            AZStd::swap(m_hasher, rhs.m_hasher);
+            AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+            AZStd::swap(m_allocator, rhs.m_allocator);
+        }
+
+    protected:
+        //! Looks the key up, and if it's missing calls construct with the uninitialized slot reserved for it.
+        //! construct must create an element whose key equals key.
+        template<class Constructor>
+        pair_iter_bool find_or_construct(const key_type& key, Constructor&& construct)
+        {
+            const size_t hash = hash_key(key);
+            size_type index = find_index(key, hash);
+            if (index != npos)
+            {
+                return { iterator_at(index), false };
+            }
+            index = prepare_insert(hash);
+            construct(m_slots + index);
+            ++m_size;
+            return { iterator_at(index), true };
+        }
+
+        iterator iterator_at(size_type index) { return iterator(m_ctrl + index, m_slots + index, m_ctrl + m_capacity); }
+
+    private:
+        static size_t mix_hash(size_t hash)
+        {
+            // AZStd::hash is the identity for integers and pointers, the low bits select the probe start and
+            // the seven bits below them are stored in the control bytes, so every bit has to depend on all of them.
+            const uint64_t product = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+            return static_cast<size_t>(product ^ (product >> 32));
+        }
+        static size_t h1(size_t hash) { return hash >> 7; }
+        static ctrl_type h2(size_t hash) { return static_cast<ctrl_type>(hash & 0x7F); }
+
+        static size_type capacity_to_growth(size_type capacity) { return capacity - capacity / 8; }
+        static size_type normalize_capacity(size_type count)
+        {
+            size_type capacity = group_width;
+            while (capacity < count)
+            {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+        //! Smallest capacity that holds count elements.
+        static size_type capacity_for(size_type count)
+        {
+            if (count == 0)
+            {
+                return 0;
+            }
+            size_type capacity = group_width;
+            while (capacity_to_growth(capacity) < count)
+            {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+        size_t hash_key(const key_type& key) const { return mix_hash(m_hasher(key)); }
+
+        size_type find_index(const key_type& key, size_t hash) const
+        {
+            if (m_capacity == 0)
+            {
+                return npos;
+            }
+            const size_type mask = m_capacity - 1;
+            const ctrl_type h2Hash = h2(hash);
+            size_type position = h1(hash) & mask;
+            size_type step = 0;
+            while (true)
+            {
+                const flat_hash_control::group group(m_ctrl + position);
+                for (flat_hash_control::bit_mask matches = group.match(h2Hash); matches; matches.clear_lowest())
+                {
+                    const size_type index = (position + matches.lowest()) & mask;
+                    if (m_keyEqual(Traits::key_from_value(m_slots[index]), key))
+                    {
+                        return index;
+                    }
+                }
+                if (group.match_empty())
+                {
+                    return npos;
+                }
+                step += group_width;
+                position = (position + step) & mask;
+                AZSTD_CONTAINER_ASSERT(step <= m_capacity, "Probed the whole table without finding an empty slot");
+            }
+        }
+
+        size_type find_first_non_full(size_t hash) const
+        {
+            const size_type mask = m_capacity - 1;
+            size_type position = h1(hash) & mask;
+            size_type step = 0;
+            while (true)
+            {
+                const flat_hash_control::bit_mask available = flat_hash_control::group(m_ctrl + position).match_empty_or_deleted();
+                if (available)
+                {
+                    return (position + available.lowest()) & mask;
+                }
+                step += group_width;
+                position = (position + step) & mask;
+                AZSTD_CONTAINER_ASSERT(step <= m_capacity, "Probed the whole table without finding a free slot");
+            }
+        }
+
+        //! Claims the slot for a new element with the hash, rehashing first if the table is out of room.
+        size_type prepare_insert(size_t hash)
+        {
+            size_type index = m_capacity ? find_first_non_full(hash) : npos;
+            // Reusing the tombstone of an erased element doesn't consume growth.
+            if (index == npos || (m_growthLeft == 0 && m_ctrl[index] != flat_hash_control::deleted))
+            {
+                grow();
+                index = find_first_non_full(hash);
+            }
+            if (m_ctrl[index] == flat_hash_control::empty)
+            {
+                --m_growthLeft;
+            }
+            set_ctrl(index, h2(hash));
+            return index;
+        }
+
+        void grow()
+        {
+            // When tombstones of erased elements take much of the room, rehashing at the same capacity frees it.
+            if (m_capacity > group_width && m_size <= capacity_to_growth(m_capacity) / 2)
+            {
+                resize(m_capacity);
+            }
+            else
+            {
+                resize(m_capacity ? m_capacity * 2 : group_width);
+            }
+        }
+
+        void set_ctrl(size_type index, ctrl_type ctrl)
+        {
+            m_ctrl[index] = ctrl;
+            // The first group is mirrored after the last slot, so groups can be loaded at any position without wrapping.
+            if (index < group_width)
+            {
+                m_ctrl[m_capacity + index] = ctrl;
+            }
+        }
+
+        void erase_at(size_type index)
+        {
+            AZStd::destroy_at(m_slots + index);
+            --m_size;
+
+            // The slot can go back to empty only if no probe has ever passed it, which is when it never was inside
+            // a run of group_width slots that are not empty. Otherwise it becomes a tombstone that keeps probes going.
+            const size_type mask = m_capacity - 1;
+            const flat_hash_control::bit_mask emptyBefore = flat_hash_control::group(m_ctrl + ((index - group_width) & mask)).match_empty();
+            const flat_hash_control::bit_mask emptyAfter = flat_hash_control::group(m_ctrl + index).match_empty();
+            const bool wasNeverFull = emptyBefore && emptyAfter &&
+                emptyAfter.leading_unmatched() + emptyBefore.trailing_unmatched() < group_width;
+            if (wasNeverFull)
+            {
+                set_ctrl(index, flat_hash_control::empty);
+                ++m_growthLeft;
+            }
+            else
+            {
+                set_ctrl(index, flat_hash_control::deleted);
+            }
+        }
+
+        void resize(size_type newCapacity)
+        {
+            ctrl_type* oldCtrl = m_ctrl;
+            value_type* oldSlots = m_slots;
+            const size_type oldCapacity = m_capacity;
+
+            allocate_storage(newCapacity);
+            for (size_type i = 0; i < oldCapacity; ++i)
+            {
+                if (oldCtrl[i] >= 0)
+                {
+                    const size_t hash = hash_key(Traits::key_from_value(oldSlots[i]));
+                    const size_type index = find_first_non_full(hash);
+                    set_ctrl(index, h2(hash));
+                    AZStd::construct_at(m_slots + index, AZStd::move(oldSlots[i]));
+                    AZStd::destroy_at(oldSlots + i);
+                }
+            }
+            m_growthLeft = capacity_to_growth(m_capacity) - m_size;
+
+            if (oldCapacity)
+            {
+                m_allocator.deallocate(oldSlots, storage_size(oldCapacity), alignof(value_type));
+            }
+        }
+
+        static size_type storage_size(size_type capacity)
+        {
+            return capacity * sizeof(value_type) + capacity + group_width;
+        }
+
+        //! Slots and control bytes share one allocation, with the slots first to keep them aligned.
+        void allocate_storage(size_type capacity)
+        {
+            void* storage = m_allocator.allocate(storage_size(capacity), alignof(value_type));
+            m_slots = static_cast<value_type*>(storage);
+            m_ctrl = reinterpret_cast<ctrl_type*>(m_slots + capacity);
+            ::memset(m_ctrl, static_cast<uint8_t>(flat_hash_control::empty), capacity + group_width);
+            m_capacity = capacity;
+            m_growthLeft = capacity_to_growth(capacity);
+        }
+
+        void destroy_elements()
+        {
+            if constexpr (!is_trivially_destructible_v<value_type>)
+            {
+                for (size_type i = 0; i < m_capacity; ++i)
+                {
+                    if (m_ctrl[i] >= 0)
+                    {
+                        AZStd::destroy_at(m_slots + i);
+                    }
+                }
+            }
+        }
+
+        void destroy_and_deallocate()
+        {
+            if (m_capacity)
+            {
+                destroy_elements();
+                m_allocator.deallocate(m_slots, storage_size(m_capacity), alignof(value_type));
+            }
+        }
+
+        void reset_storage()
+        {
+            m_ctrl = nullptr;
+            m_slots = nullptr;
+            m_size = 0;
+            m_capacity = 0;
+            m_growthLeft = 0;
+        }
+
+        ctrl_type* m_ctrl = nullptr;
+        value_type* m_slots = nullptr;
+        size_type m_size = 0;
+        size_type m_capacity = 0;
+        //! Number of elements that can be inserted in empty slots before the table has to rehash.
+        size_type m_growthLeft = 0;
+        hasher m_hasher;
+        key_equal m_keyEqual;
+        allocator_type m_allocator;
+    };
+} // namespace AZStd::Internal
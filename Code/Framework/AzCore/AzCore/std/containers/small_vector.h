@@ -0,0 +1,473 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/typetraits/typetraits.h>
+#include <AzCore/std/utility/move.h>
+
+namespace AZStd
+{
+    //! Vector with inline storage for N elements, which spills to memory from its allocator once it grows past them.
+    //! Use it where a fixed_vector would be the right choice for the common case, but where the number of elements
+    //! isn't bounded. Elements are contiguous whether they are stored inline or on the heap.
+    //! Unlike vector, moving a small_vector whose elements are stored inline moves the elements one by one,
+    //! so iterators to the elements of a moved-from small_vector are only preserved when they were on the heap.
+    template<class T, size_t N, class Allocator = AZStd::allocator>
+    class small_vector
+    {
+        static_assert(N > 0, "small_vector needs inline storage for at least one element, use vector instead");
+
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = AZStd::size_t;
+        using difference_type = AZStd::ptrdiff_t;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = AZStd::reverse_iterator<iterator>;
+        using const_reverse_iterator = AZStd::reverse_iterator<const_iterator>;
+        using allocator_type = Allocator;
+
+        //! Number of elements stored without allocating.
+        static constexpr size_type inline_capacity = N;
+
+        small_vector() = default;
+
+        explicit small_vector(const allocator_type& allocator)
+            : m_allocator(allocator)
+        {
+        }
+
+        explicit small_vector(size_type count, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            resize(count);
+        }
+
+        small_vector(size_type count, const_reference value, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            assign(count, value);
+        }
+
+        template<class InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+        small_vector(InputIt first, InputIt last, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            assign(first, last);
+        }
+
+        small_vector(AZStd::initializer_list<T> ilist, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            assign(ilist.begin(), ilist.end());
+        }
+
+        small_vector(const small_vector& rhs)
+            : m_allocator(rhs.m_allocator)
+        {
+            assign(rhs.begin(), rhs.end());
+        }
+
+        small_vector(small_vector&& rhs)
+            : m_allocator(rhs.m_allocator)
+        {
+            steal_or_move(rhs);
+        }
+
+        ~small_vector()
+        {
+            clear();
+            release_heap();
+        }
+
+        small_vector& operator=(const small_vector& rhs)
+        {
+            if (this != &rhs)
+            {
+                assign(rhs.begin(), rhs.end());
+            }
+            return *this;
+        }
+
+        small_vector& operator=(small_vector&& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                if (!rhs.is_inline() && m_allocator == rhs.m_allocator)
+                {
+                    release_heap();
+                }
+                steal_or_move(rhs);
+            }
+            return *this;
+        }
+
+        small_vector& operator=(AZStd::initializer_list<T> ilist)
+        {
+            assign(ilist.begin(), ilist.end());
+            return *this;
+        }
+
+        void assign(size_type count, const_reference value)
+        {
+            clear();
+            reserve(count);
+            AZStd::uninitialized_fill_n(m_data, count, value);
+            m_size = count;
+        }
+
+        template<class InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+        void assign(InputIt first, InputIt last)
+        {
+            clear();
+            if constexpr (is_base_of_v<forward_iterator_tag, typename iterator_traits<InputIt>::iterator_category>)
+            {
+                reserve(static_cast<size_type>(AZStd::distance(first, last)));
+                m_size = static_cast<size_type>(AZStd::uninitialized_copy(first, last, m_data) - m_data);
+            }
+            else
+            {
+                for (; first != last; ++first)
+                {
+                    emplace_back(*first);
+                }
+            }
+        }
+
+        void assign(AZStd::initializer_list<T> ilist)
+        {
+            assign(ilist.begin(), ilist.end());
+        }
+
+        allocator_type& get_allocator() { return m_allocator; }
+        const allocator_type& get_allocator() const { return m_allocator; }
+
+        reference operator[](size_type index)
+        {
+            AZSTD_CONTAINER_ASSERT(index < m_size, "AZStd::small_vector<>::operator[] - position is out of range");
+            return m_data[index];
+        }
+        const_reference operator[](size_type index) const
+        {
+            AZSTD_CONTAINER_ASSERT(index < m_size, "AZStd::small_vector<>::operator[] - position is out of range");
+            return m_data[index];
+        }
+        reference at(size_type index) { return operator[](index); }
+        const_reference at(size_type index) const { return operator[](index); }
+
+        reference front()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size > 0, "AZStd::small_vector<>::front - container is empty");
+            return m_data[0];
+        }
+        const_reference front() const
+        {
+            AZSTD_CONTAINER_ASSERT(m_size > 0, "AZStd::small_vector<>::front - container is empty");
+            return m_data[0];
+        }
+        reference back()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size > 0, "AZStd::small_vector<>::back - container is empty");
+            return m_data[m_size - 1];
+        }
+        const_reference back() const
+        {
+            AZSTD_CONTAINER_ASSERT(m_size > 0, "AZStd::small_vector<>::back - container is empty");
+            return m_data[m_size - 1];
+        }
+
+        pointer data() { return m_data; }
+        const_pointer data() const { return m_data; }
+
+        iterator begin() { return m_data; }
+        const_iterator begin() const { return m_data; }
+        const_iterator cbegin() const { return m_data; }
+        iterator end() { return m_data + m_size; }
+        const_iterator end() const { return m_data + m_size; }
+        const_iterator cend() const { return m_data + m_size; }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+        const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
+
+        bool empty() const { return m_size == 0; }
+        size_type size() const { return m_size; }
+        size_type capacity() const { return m_capacity; }
+        size_type max_size() const { return m_allocator.max_size() / sizeof(T); }
+        //! Returns true while the elements are stored in the inline storage.
+        bool is_inline() const { return m_data == inline_data(); }
+
+        void reserve(size_type newCapacity)
+        {
+            if (newCapacity > m_capacity)
+            {
+                reallocate(newCapacity);
+            }
+        }
+
+        //! Releases the heap memory that isn't needed, moving the elements back to the inline storage if they fit.
+        void shrink_to_fit()
+        {
+            if (is_inline() || m_size == m_capacity)
+            {
+                return;
+            }
+
+            if (m_size <= N)
+            {
+                pointer heapData = m_data;
+                const size_type heapCapacity = m_capacity;
+                AZStd::uninitialized_move(heapData, heapData + m_size, inline_data());
+                AZStd::destroy(heapData, heapData + m_size);
+                m_allocator.deallocate(heapData, heapCapacity * sizeof(T), alignof(T));
+                m_data = inline_data();
+                m_capacity = N;
+            }
+            else
+            {
+                reallocate(m_size);
+            }
+        }
+
+        void clear()
+        {
+            AZStd::destroy(m_data, m_data + m_size);
+            m_size = 0;
+        }
+
+        void push_back(const_reference value) { emplace_back(value); }
+        void push_back(T&& value) { emplace_back(AZStd::move(value)); }
+
+        template<class... Args>
+        reference emplace_back(Args&&... args)
+        {
+            if (m_size == m_capacity)
+            {
+                // Construct the new element before moving the existing ones, the arguments may refer to them.
+                const size_type newCapacity = grow_capacity(m_size + 1);
+                pointer newData = static_cast<pointer>(m_allocator.allocate(newCapacity * sizeof(T), alignof(T)));
+                AZStd::construct_at(newData + m_size, AZStd::forward<Args>(args)...);
+                move_to(newData, newCapacity);
+            }
+            else
+            {
+                AZStd::construct_at(m_data + m_size, AZStd::forward<Args>(args)...);
+            }
+            return m_data[m_size++];
+        }
+
+        void pop_back()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size > 0, "AZStd::small_vector<>::pop_back - container is empty");
+            AZStd::destroy_at(m_data + --m_size);
+        }
+
+        template<class... Args>
+        iterator emplace(const_iterator position, Args&&... args)
+        {
+            const size_type index = position - m_data;
+            AZSTD_CONTAINER_ASSERT(index <= m_size, "AZStd::small_vector<>::emplace - position is out of range");
+            emplace_back(AZStd::forward<Args>(args)...);
+            AZStd::rotate(m_data + index, m_data + m_size - 1, m_data + m_size);
+            return m_data + index;
+        }
+
+        iterator insert(const_iterator position, const_reference value) { return emplace(position, value); }
+        iterator insert(const_iterator position, T&& value) { return emplace(position, AZStd::move(value)); }
+
+        iterator insert(const_iterator position, size_type count, const_reference value)
+        {
+            const size_type index = position - m_data;
+            AZSTD_CONTAINER_ASSERT(index <= m_size, "AZStd::small_vector<>::insert - position is out of range");
+            const size_type oldSize = m_size;
+            if (count > 0)
+            {
+                // Copy the value first, it may be one of the elements moved by the reallocation.
+                T valueCopy(value);
+                if (m_size + count > m_capacity)
+                {
+                    reserve(grow_capacity(m_size + count));
+                }
+                AZStd::uninitialized_fill_n(m_data + m_size, count, valueCopy);
+                m_size += count;
+                AZStd::rotate(m_data + index, m_data + oldSize, m_data + m_size);
+            }
+            return m_data + index;
+        }
+
+        template<class InputIt, typename = enable_if_t<!is_integral_v<InputIt>>>
+        iterator insert(const_iterator position, InputIt first, InputIt last)
+        {
+            const size_type index = position - m_data;
+            AZSTD_CONTAINER_ASSERT(index <= m_size, "AZStd::small_vector<>::insert - position is out of range");
+            const size_type oldSize = m_size;
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+            AZStd::rotate(m_data + index, m_data + oldSize, m_data + m_size);
+            return m_data + index;
+        }
+
+        iterator insert(const_iterator position, AZStd::initializer_list<T> ilist)
+        {
+            return insert(position, ilist.begin(), ilist.end());
+        }
+
+        iterator erase(const_iterator position)
+        {
+            return erase(position, position + 1);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            const size_type firstIndex = first - m_data;
+            const size_type lastIndex = last - m_data;
+            AZSTD_CONTAINER_ASSERT(firstIndex <= lastIndex && lastIndex <= m_size, "AZStd::small_vector<>::erase - range is out of range");
+            if (firstIndex != lastIndex)
+            {
+                pointer newEnd = AZStd::move(m_data + lastIndex, m_data + m_size, m_data + firstIndex);
+                AZStd::destroy(newEnd, m_data + m_size);
+                m_size -= lastIndex - firstIndex;
+            }
+            return m_data + firstIndex;
+        }
+
+        void resize(size_type newSize)
+        {
+            if (newSize < m_size)
+            {
+                AZStd::destroy(m_data + newSize, m_data + m_size);
+                m_size = newSize;
+            }
+            else if (newSize > m_size)
+            {
+                reserve(newSize);
+                for (; m_size < newSize; ++m_size)
+                {
+                    AZStd::construct_at(m_data + m_size);
+                }
+            }
+        }
+
+        void resize(size_type newSize, const_reference value)
+        {
+            if (newSize < m_size)
+            {
+                AZStd::destroy(m_data + newSize, m_data + m_size);
+                m_size = newSize;
+            }
+            else if (newSize > m_size)
+            {
+                insert(end(), newSize - m_size, value);
+            }
+        }
+
+        void swap(small_vector& rhs)
+        {
+            if (this != &rhs)
+            {
+                small_vector temp(AZStd::move(rhs));
+                rhs = AZStd::move(*this);
+                *this = AZStd::move(temp);
+            }
+        }
+
+    private:
+        pointer inline_data() { return reinterpret_cast<pointer>(m_inlineStorage); }
+        const_pointer inline_data() const { return reinterpret_cast<const_pointer>(m_inlineStorage); }
+
+        size_type grow_capacity(size_type minCapacity) const
+        {
+            return AZStd::max(minCapacity, m_capacity + m_capacity / 2);
+        }
+
+        //! Moves the elements to newly allocated memory and frees the current heap memory, if any.
+        void move_to(pointer newData, size_type newCapacity)
+        {
+            AZStd::uninitialized_move(m_data, m_data + m_size, newData);
+            AZStd::destroy(m_data, m_data + m_size);
+            release_heap();
+            m_data = newData;
+            m_capacity = newCapacity;
+        }
+
+        void reallocate(size_type newCapacity)
+        {
+            pointer newData = static_cast<pointer>(m_allocator.allocate(newCapacity * sizeof(T), alignof(T)));
+            move_to(newData, newCapacity);
+        }
+
+        void release_heap()
+        {
+            if (!is_inline())
+            {
+                m_allocator.deallocate(m_data, m_capacity * sizeof(T), alignof(T));
+                m_data = inline_data();
+                m_capacity = N;
+            }
+        }
+
+        //! Takes the heap memory of rhs if both allocators can free it, otherwise moves its elements one by one.
+        //! This container must be empty.
+        void steal_or_move(small_vector& rhs)
+        {
+            if (!rhs.is_inline() && is_inline() && m_allocator == rhs.m_allocator)
+            {
+                m_data = rhs.m_data;
+                m_size = rhs.m_size;
+                m_capacity = rhs.m_capacity;
+                rhs.m_data = rhs.inline_data();
+                rhs.m_size = 0;
+                rhs.m_capacity = N;
+            }
+            else
+            {
+                reserve(rhs.m_size);
+                AZStd::uninitialized_move(rhs.m_data, rhs.m_data + rhs.m_size, m_data);
+                m_size = rhs.m_size;
+                rhs.clear();
+            }
+        }
+
+        pointer m_data = inline_data();
+        size_type m_size = 0;
+        size_type m_capacity = N;
+        allocator_type m_allocator;
+        alignas(T) unsigned char m_inlineStorage[N * sizeof(T)];
+    };
+
+    template<class T, size_t N, class Allocator>
+    bool operator==(const small_vector<T, N, Allocator>& lhs, const small_vector<T, N, Allocator>& rhs)
+    {
+        return lhs.size() == rhs.size() && AZStd::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template<class T, size_t N, class Allocator>
+    bool operator!=(const small_vector<T, N, Allocator>& lhs, const small_vector<T, N, Allocator>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template<class T, size_t N, class Allocator>
+    void swap(small_vector<T, N, Allocator>& lhs, small_vector<T, N, Allocator>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+} // namespace AZStd
@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/utils.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        //! Keeps the producer and consumer positions of the queues apart to avoid false sharing.
+        constexpr size_t mpmc_queue_cache_line_size = 64;
+
+        template<typename T>
+        struct mpmc_queue_cell
+        {
+            atomic<size_t> m_sequence;
+            alignas(T) unsigned char m_storage[sizeof(T)];
+
+            T* value()
+            {
+                return reinterpret_cast<T*>(m_storage);
+            }
+        };
+    }
+
+    /**
+     * A bounded lock-free multi-producer multi-consumer queue, based on Dmitry Vyukov's array queue.
+     * Each cell holds a sequence number telling whether it's free or holds a value for the position claimed by a
+     * producer or consumer, so an uncontended push or pop is a single compare exchange on its position.
+     * The batch functions claim several consecutive cells with one compare exchange.
+     * The capacity is rounded up to a power of two. Pushing fails when the queue is full and popping when it's empty,
+     * popping can also fail while the oldest push is still in progress on another thread.
+     */
+    template<typename T, typename Allocator = AZStd::allocator>
+    class mpmc_bounded_queue
+    {
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using allocator_type = Allocator;
+
+        explicit mpmc_bounded_queue(size_type capacity, const allocator_type& allocator = allocator_type());
+        ~mpmc_bounded_queue();
+
+        mpmc_bounded_queue(const mpmc_bounded_queue&) = delete;
+        mpmc_bounded_queue& operator=(const mpmc_bounded_queue&) = delete;
+
+        bool try_push(const T& value);
+        bool try_push(T&& value);
+        template<typename... Args>
+        bool try_emplace(Args&&... args);
+
+        //! Pops the front value into valueOut, returns false if the queue was empty.
+        bool try_pop(T& valueOut);
+
+        //! Pushes as many values of [first, last) as there is free space for, in order.
+        //! Returns the iterator past the last pushed value.
+        template<typename ForwardIt>
+        ForwardIt try_push_batch(ForwardIt first, ForwardIt last);
+
+        //! Pops up to maxCount values into valuesOut, returns the number of values popped.
+        size_type try_pop_batch(T* valuesOut, size_type maxCount);
+
+        //! The number of values, which may be out of date by the time it's used.
+        size_type size_approx() const;
+        bool empty_approx() const;
+        size_type capacity() const;
+
+    private:
+        using cell_type = Internal::mpmc_queue_cell<T>;
+
+        //! Claims up to maxCount consecutive cells at the enqueue or dequeue position.
+        //! Returns the number of cells claimed and their first position.
+        size_type claim_push(size_type maxCount, size_type& positionOut);
+        size_type claim_pop(size_type maxCount, size_type& positionOut);
+
+        void publish_push(size_type position);
+        void publish_pop(size_type position);
+
+        alignas(Internal::mpmc_queue_cache_line_size) atomic<size_type> m_enqueuePosition{ 0 };
+        alignas(Internal::mpmc_queue_cache_line_size) atomic<size_type> m_dequeuePosition{ 0 };
+        alignas(Internal::mpmc_queue_cache_line_size) cell_type* m_cells = nullptr;
+        size_type m_mask = 0;
+        allocator_type m_allocator;
+    };
+
+    /**
+     * An unbounded multi-producer multi-consumer queue. Values go through a lock-free mpmc_bounded_queue and only spill
+     * into a mutex guarded deque while it's full, so the lock is only taken by bursts larger than the capacity.
+     * Values pushed by a thread are popped in the order they were pushed.
+     */
+    template<typename T, typename Allocator = AZStd::allocator>
+    class mpmc_queue
+    {
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using allocator_type = Allocator;
+
+        static constexpr size_type default_capacity = 1024;
+
+        explicit mpmc_queue(size_type capacity = default_capacity, const allocator_type& allocator = allocator_type());
+
+        mpmc_queue(const mpmc_queue&) = delete;
+        mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+        void push(const T& value);
+        void push(T&& value);
+        template<typename... Args>
+        void emplace(Args&&... args);
+
+        template<typename ForwardIt>
+        void push_batch(ForwardIt first, ForwardIt last);
+
+        //! Pops the front value into valueOut, returns false if the queue was empty.
+        bool try_pop(T& valueOut);
+
+        //! Pops up to maxCount values into valuesOut, returns the number of values popped.
+        size_type try_pop_batch(T* valuesOut, size_type maxCount);
+
+        //! The number of values, which may be out of date by the time it's used.
+        size_type size_approx() const;
+        bool empty_approx() const;
+
+    private:
+        //! Overflowed values are only popped once the values pushed to the bounded queue before them are.
+        bool can_pop_overflow() const;
+
+        mpmc_bounded_queue<T, Allocator> m_queue;
+        mutex m_overflowMutex;
+        deque<T, Allocator> m_overflow;
+        atomic<size_type> m_overflowSize{ 0 };
+    };
+
+    //============================================================================================================
+    //============================================================================================================
+    //============================================================================================================
+
+    template<typename T, typename Allocator>
+    inline mpmc_bounded_queue<T, Allocator>::mpmc_bounded_queue(size_type capacity, const allocator_type& allocator)
+        : m_allocator(allocator)
+    {
+        size_type cellCount = 2;
+        while (cellCount < capacity)
+        {
+            cellCount <<= 1;
+        }
+        m_mask = cellCount - 1;
+
+        m_cells = reinterpret_cast<cell_type*>(m_allocator.allocate(sizeof(cell_type) * cellCount, alignof(cell_type)));
+        for (size_type i = 0; i < cellCount; ++i)
+        {
+            new (&m_cells[i]) cell_type;
+            m_cells[i].m_sequence.store(i, memory_order_relaxed);
+        }
+    }
+
+    template<typename T, typename Allocator>
+    inline mpmc_bounded_queue<T, Allocator>::~mpmc_bounded_queue()
+    {
+        const size_type enqueuePosition = m_enqueuePosition.load(memory_order_acquire);
+        for (size_type position = m_dequeuePosition.load(memory_order_acquire); position != enqueuePosition; ++position)
+        {
+            m_cells[position & m_mask].value()->~T();
+        }
+        for (size_type i = 0; i <= m_mask; ++i)
+        {
+            m_cells[i].~cell_type();
+        }
+        m_allocator.deallocate(m_cells, sizeof(cell_type) * (m_mask + 1), alignof(cell_type));
+    }
+
+    template<typename T, typename Allocator>
+    inline bool mpmc_bounded_queue<T, Allocator>::try_push(const T& value)
+    {
+        return try_emplace(value);
+    }
+
+    template<typename T, typename Allocator>
+    inline bool mpmc_bounded_queue<T, Allocator>::try_push(T&& value)
+    {
+        return try_emplace(AZStd::move(value));
+    }
+
+    template<typename T, typename Allocator>
+    template<typename... Args>
+    inline bool mpmc_bounded_queue<T, Allocator>::try_emplace(Args&&... args)
+    {
+        size_type position;
+        if (claim_push(1, position) == 0)
+        {
+            return false;
+        }
+        new (m_cells[position & m_mask].value()) T(AZStd::forward<Args>(args)...);
+        publish_push(position);
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    inline bool mpmc_bounded_queue<T, Allocator>::try_pop(T& valueOut)
+    {
+        return try_pop_batch(&valueOut, 1) == 1;
+    }
+
+    template<typename T, typename Allocator>
+    template<typename ForwardIt>
+    inline ForwardIt mpmc_bounded_queue<T, Allocator>::try_push_batch(ForwardIt first, ForwardIt last)
+    {
+        while (first != last)
+        {
+            size_type position;
+            const size_type claimedCount = claim_push(AZStd::distance(first, last), position);
+            if (claimedCount == 0)
+            {
+                break;
+            }
+            for (size_type i = 0; i < claimedCount; ++i, ++first)
+            {
+                new (m_cells[(position + i) & m_mask].value()) T(*first);
+                publish_push(position + i);
+            }
+        }
+        return first;
+    }
+
+    template<typename T, typename Allocator>
+    inline auto mpmc_bounded_queue<T, Allocator>::try_pop_batch(T* valuesOut, size_type maxCount) -> size_type
+    {
+        size_type position;
+        const size_type claimedCount = claim_pop(maxCount, position);
+        for (size_type i = 0; i < claimedCount; ++i)
+        {
+            T* value = m_cells[(position + i) & m_mask].value();
+            valuesOut[i] = AZStd::move(*value);
+            value->~T();
+            publish_pop(position + i);
+        }
+        return claimedCount;
+    }
+
+    template<typename T, typename Allocator>
+    inline auto mpmc_bounded_queue<T, Allocator>::size_approx() const -> size_type
+    {
+        // The dequeue position is read first so the difference can't be negative
+        const size_type dequeuePosition = m_dequeuePosition.load(memory_order_acquire);
+        const size_type enqueuePosition = m_enqueuePosition.load(memory_order_acquire);
+        return enqueuePosition - dequeuePosition;
+    }
+
+    template<typename T, typename Allocator>
+    inline bool mpmc_bounded_queue<T, Allocator>::empty_approx() const
+    {
+        return size_approx() == 0;
+    }
+
+    template<typename T, typename Allocator>
+    inline auto mpmc_bounded_queue<T, Allocator>::capacity() const -> size_type
+    {
+        return m_mask + 1;
+    }
+
+    template<typename T, typename Allocator>
+    inline auto mpmc_bounded_queue<T, Allocator>::claim_push(size_type maxCount, size_type& positionOut) -> size_type
+    {
+        maxCount = AZStd::min(maxCount, m_mask + 1);
+        size_type position = m_enqueuePosition.load(memory_order_relaxed);
+        for (;;)
+        {
+            // A cell is free for a position when its sequence is that position
+            size_type count = 0;
+            while (count < maxCount && m_cells[(position + count) & m_mask].m_sequence.load(memory_order_acquire) == position + count)
+            {
+                ++count;
+            }
+
+            if (count == 0)
+            {
+                const size_type sequence = m_cells[position & m_mask].m_sequence.load(memory_order_acquire);
+                if (static_cast<ptrdiff_t>(sequence - position) < 0)
+                {
+                    // The cell still holds the value from the previous lap, the queue is full
+                    return 0;
+                }
+                // Another producer claimed the position
+                position = m_enqueuePosition.load(memory_order_relaxed);
+            }
+            else if (m_enqueuePosition.compare_exchange_weak(position, position + count, memory_order_relaxed))
+            {
+                positionOut = position;
+                return count;
+            }
+        }
+    }
+
+    template<typename T, typename Allocator>
+    inline auto mpmc_bounded_queue<T, Allocator>::claim_pop(size_type maxCount, size_type& positionOut) -> size_type
+    {
+        maxCount = AZStd::min(maxCount, m_mask + 1);
+        size_type position = m_dequeuePosition.load(memory_order_relaxed);
+        for (;;)
+        {
+            // A cell holds the value of a position when its sequence is that position plus one
+            size_type count = 0;
+            while (count < maxCount && m_cells[(position + count) & m_mask].m_sequence.load(memory_order_acquire) == position + count + 1)
+            {
+                ++count;
+            }
+
+            if (count == 0)
+            {
+                const size_type sequence = m_cells[position & m_mask].m_sequence.load(memory_order_acquire);
+                if (static_cast<ptrdiff_t>(sequence - (position + 1)) < 0)
+                {
+                    // The value for the position hasn't been pushed yet
+                    return 0;
+                }
+                // Another consumer claimed the position
+                position = m_dequeuePosition.load(memory_order_relaxed);
+            }
+            else if (m_dequeuePosition.compare_exchange_weak(position, position + count, memory_order_relaxed))
+            {
+                positionOut = position;
+                return count;
+            }
+        }
+    }
+
+    template<typename T, typename Allocator>
+    inline void mpmc_bounded_queue<T, Allocator>::publish_push(size_type position)
+    {
+        m_cells[position & m_mask].m_sequence.store(position + 1, memory_order_release);
+    }
+
+    template<typename T, typename Allocator>
+    inline void mpmc_bounded_queue<T, Allocator>::publish_pop(size_type position)
+    {
+        // Frees the cell for the position of the next lap
+        m_cells[position & m_mask].m_sequence.store(position + m_mask + 1, memory_order_release);
+    }
+
+    //============================================================================================================
+
+    template<typename T, typename Allocator>
+    inline mpmc_queue<T, Allocator>::mpmc_queue(size_type capacity, const allocator_type& allocator)
+        : m_queue(capacity, allocator)
+        , m_overflow(allocator)
+    {
+    }
+
+    template<typename T, typename Allocator>
+    inline void mpmc_queue<T, Allocator>::push(const T& value)
+    {
+        emplace(value);
+    }
+
+    template<typename T, typename Allocator>
+    inline void mpmc_queue<T, Allocator>::push(T&& value)
+    {
+        emplace(AZStd::move(value));
+    }
+
+    template<typename T, typename Allocator>
+    template<typename... Args>
+    inline void mpmc_queue<T, Allocator>::emplace(Args&&... args)
+    {
+        // Once values overflowed, the following ones overflow too until they're popped to keep them in order
+        if (m_overflowSize.load(memory_order_acquire) == 0 && m_queue.try_emplace(AZStd::forward<Args>(args)...))
+        {
+            return;
+        }
+
+        scoped_lock<mutex> lock(m_overflowMutex);
+        m_overflow.emplace_back(AZStd::forward<Args>(args)...);
+        m_overflowSize.store(m_overflow.size(), memory_order_release);
+    }
+
+    template<typename T, typename Allocator>
+    template<typename ForwardIt>
+    inline void mpmc_queue<T, Allocator>::push_batch(ForwardIt first, ForwardIt last)
+    {
+        if (m_overflowSize.load(memory_order_acquire) == 0)
+        {
+            first = m_queue.try_push_batch(first, last);
+        }
+        if (first != last)
+        {
+            scoped_lock<mutex> lock(m_overflowMutex);
+            for (; first != last; ++first)
+            {
+                m_overflow.emplace_back(*first);
+            }
+            m_overflowSize.store(m_overflow.size(), memory_order_release);
+        }
+    }
+
+    template<typename T, typename Allocator>
+    inline bool mpmc_queue<T, Allocator>::try_pop(T& valueOut)
+    {
+        return try_pop_batch(&valueOut, 1) == 1;
+    }
+
+    template<typename T, typename Allocator>
+    inline auto mpmc_queue<T, Allocator>::try_pop_batch(T* valuesOut, size_type maxCount) -> size_type
+    {
+        size_type poppedCount = m_queue.try_pop_batch(valuesOut, maxCount);
+        if (poppedCount < maxCount && can_pop_overflow())
+        {
+            scoped_lock<mutex> lock(m_overflowMutex);
+            for (; poppedCount < maxCount && !m_overflow.empty(); ++poppedCount)
+            {
+                valuesOut[poppedCount] = AZStd::move(m_overflow.front());
+                m_overflow.pop_front();
+            }
+            m_overflowSize.store(m_overflow.size(), memory_order_release);
+        }
+        return poppedCount;
+    }
+
+    template<typename T, typename Allocator>
+    inline auto mpmc_queue<T, Allocator>::size_approx() const -> size_type
+    {
+        return m_queue.size_approx() + m_overflowSize.load(memory_order_acquire);
+    }
+
+    template<typename T, typename Allocator>
+    inline bool mpmc_queue<T, Allocator>::empty_approx() const
+    {
+        return size_approx() == 0;
+    }
+
+    template<typename T, typename Allocator>
+    inline bool mpmc_queue<T, Allocator>::can_pop_overflow() const
+    {
+        // The bounded queue isn't empty while a push to it is in progress, even if it couldn't be popped yet
+        return m_overflowSize.load(memory_order_acquire) != 0 && m_queue.empty_approx();
+    }
+}
@@ -39,6 +39,7 @@ set(FILES
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.h
     ../Common/UnixLike/AzCore/IO/AnsiTerminalUtils_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/FileIO_UnixLike.cpp
+    ../Common/UnixLike/AzCore/IO/MappedFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.h
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.cpp
@@ -65,6 +66,7 @@ set(FILES
     AzCore/Socket/AzSocket_Platform.h
     ../Common/UnixLike/AzCore/std/time_UnixLike.cpp
     AzCore/Utils/Utils_Android.cpp
+    ../Common/Default/AzCore/Threading/CpuTopology_Default.cpp
     AzCore/Android/AndroidEnv.cpp
     AzCore/Android/AndroidEnv.h
     AzCore/Android/APKFileHandler.cpp
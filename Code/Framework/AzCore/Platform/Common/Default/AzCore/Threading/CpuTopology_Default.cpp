@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Threading/CpuTopology.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ::Threading
+{
+    CpuTopology QueryCpuTopology()
+    {
+        CpuTopology topology;
+        const uint32_t processorCount = AZStd::thread::hardware_concurrency();
+        topology.m_processors.resize(processorCount);
+        for (uint32_t i = 0; i < processorCount; ++i)
+        {
+            topology.m_processors[i].m_id = i;
+        }
+        return topology;
+    }
+
+    bool SetCurrentThreadProcessor([[maybe_unused]] uint32_t logicalProcessorId)
+    {
+        return false;
+    }
+} // namespace AZ::Threading
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    bool MappedFile::Open(const char* filePath)
+    {
+        Close();
+
+        int fileDescriptor = open(filePath, O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStats;
+        if (fstat(fileDescriptor, &fileStats) != 0 || fileStats.st_size <= 0)
+        {
+            close(fileDescriptor);
+            return false;
+        }
+
+        size_t size = aznumeric_cast<size_t>(fileStats.st_size);
+        void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        // The mapping remains valid after the file descriptor has been closed.
+        close(fileDescriptor);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_data = reinterpret_cast<const u8*>(data);
+        m_size = size;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+        {
+            munmap(const_cast<u8*>(m_data), aznumeric_cast<size_t>(m_size));
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/string/fixed_string.h>
+
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ::IO
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    bool MappedFile::Open(const char* filePath)
+    {
+        Close();
+
+        AZStd::fixed_wstring<MaxPathLength> filePathW;
+        AZStd::to_wstring(filePathW, filePath);
+        HANDLE file = CreateFileW(filePathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping)
+        {
+            return false;
+        }
+
+        void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        // The view keeps the mapping alive, so the handle isn't needed anymore.
+        CloseHandle(mapping);
+        if (!data)
+        {
+            return false;
+        }
+
+        m_data = reinterpret_cast<const u8*>(data);
+        m_size = aznumeric_cast<u64>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+        {
+            UnmapViewOfFile(m_data);
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/std/algorithm.h>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    // The ring indices are shared with the kernel. The head of the submission queue and tail of the completion queue are
+    // written by the kernel, the others by this process.
+    static u32 LoadAcquire(const u32* value)
+    {
+        return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+    }
+
+    static void StoreRelease(u32* value, u32 newValue)
+    {
+        __atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+    }
+
+    template<typename T>
+    static T* RingOffset(void* ring, u32 offset)
+    {
+        return reinterpret_cast<T*>(reinterpret_cast<u8*>(ring) + offset);
+    }
+
+    IoUring::~IoUring()
+    {
+        Shutdown();
+    }
+
+    bool IoUring::Initialize(u32 queueDepth)
+    {
+        AZ_Assert(!IsInitialized(), "IoUring has already been initialized.");
+
+        io_uring_params params{};
+        params.flags = IORING_SETUP_CLAMP;
+        int ringFd = aznumeric_cast<int>(::syscall(__NR_io_uring_setup, queueDepth, &params));
+        if (ringFd < 0)
+        {
+            AZ_Warning("IoUring", false, "io_uring_setup failed with error: %s\n", strerror(errno));
+            return false;
+        }
+        m_ringFd = ringFd;
+
+        // Map the submission ring. With IORING_FEAT_SINGLE_MMAP the completion ring shares the same mapping.
+        m_ringMemorySize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        const size_t completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_ringMemorySize = AZStd::max(m_ringMemorySize, completionRingSize);
+        }
+
+        m_ringMemory = ::mmap(nullptr, m_ringMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+        if (m_ringMemory == MAP_FAILED)
+        {
+            m_ringMemory = nullptr;
+            AZ_Warning("IoUring", false, "Failed to map the io_uring submission ring: %s\n", strerror(errno));
+            Shutdown();
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_completionRingMemory = m_ringMemory;
+        }
+        else
+        {
+            m_completionRingMemorySize = completionRingSize;
+            m_completionRingMemory = ::mmap(
+                nullptr, m_completionRingMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+            if (m_completionRingMemory == MAP_FAILED)
+            {
+                m_completionRingMemory = nullptr;
+                AZ_Warning("IoUring", false, "Failed to map the io_uring completion ring: %s\n", strerror(errno));
+                Shutdown();
+                return false;
+            }
+        }
+
+        m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* submissionEntries =
+            ::mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+        if (submissionEntries == MAP_FAILED)
+        {
+            AZ_Warning("IoUring", false, "Failed to map the io_uring submission entries: %s\n", strerror(errno));
+            Shutdown();
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(submissionEntries);
+
+        m_submissionHead = RingOffset<u32>(m_ringMemory, params.sq_off.head);
+        m_submissionTail = RingOffset<u32>(m_ringMemory, params.sq_off.tail);
+        m_submissionArray = RingOffset<u32>(m_ringMemory, params.sq_off.array);
+        m_submissionMask = *RingOffset<u32>(m_ringMemory, params.sq_off.ring_mask);
+        m_submissionEntryCount = params.sq_entries;
+        m_submissionLocalTail = *m_submissionTail;
+
+        m_completionHead = RingOffset<u32>(m_completionRingMemory, params.cq_off.head);
+        m_completionTail = RingOffset<u32>(m_completionRingMemory, params.cq_off.tail);
+        m_completionEntries = RingOffset<io_uring_cqe>(m_completionRingMemory, params.cq_off.cqes);
+        m_completionMask = *RingOffset<u32>(m_completionRingMemory, params.cq_off.ring_mask);
+
+        return true;
+    }
+
+    void IoUring::Shutdown()
+    {
+        if (m_submissionEntries)
+        {
+            ::munmap(m_submissionEntries, m_submissionEntriesSize);
+        }
+        if (m_completionRingMemory && m_completionRingMemory != m_ringMemory)
+        {
+            ::munmap(m_completionRingMemory, m_completionRingMemorySize);
+        }
+        if (m_ringMemory)
+        {
+            ::munmap(m_ringMemory, m_ringMemorySize);
+        }
+        if (m_ringFd >= 0)
+        {
+            // Closing the ring cancels any reads still in flight.
+            ::close(m_ringFd);
+        }
+
+        m_ringMemory = nullptr;
+        m_ringMemorySize = 0;
+        m_completionRingMemory = nullptr;
+        m_completionRingMemorySize = 0;
+        m_submissionEntries = nullptr;
+        m_submissionEntriesSize = 0;
+        m_submissionHead = nullptr;
+        m_submissionTail = nullptr;
+        m_submissionArray = nullptr;
+        m_submissionMask = 0;
+        m_submissionEntryCount = 0;
+        m_submissionLocalTail = 0;
+        m_completionHead = nullptr;
+        m_completionTail = nullptr;
+        m_completionEntries = nullptr;
+        m_completionMask = 0;
+        m_ringFd = -1;
+    }
+
+    bool IoUring::IsInitialized() const
+    {
+        return m_ringFd >= 0;
+    }
+
+    u32 IoUring::GetQueueDepth() const
+    {
+        return m_submissionEntryCount;
+    }
+
+    io_uring_sqe* IoUring::GetSubmissionEntry()
+    {
+        AZ_Assert(IsInitialized(), "IoUring is used before being initialized.");
+        if (m_submissionLocalTail - LoadAcquire(m_submissionHead) >= m_submissionEntryCount)
+        {
+            return nullptr;
+        }
+
+        const u32 index = m_submissionLocalTail & m_submissionMask;
+        io_uring_sqe* entry = &m_submissionEntries[index];
+        memset(entry, 0, sizeof(io_uring_sqe));
+        m_submissionArray[index] = index;
+        ++m_submissionLocalTail;
+        return entry;
+    }
+
+    int IoUring::Submit()
+    {
+        return Enter(0);
+    }
+
+    int IoUring::SubmitAndWait(u32 waitCount)
+    {
+        return Enter(waitCount);
+    }
+
+    int IoUring::Enter(u32 waitCount)
+    {
+        AZ_Assert(IsInitialized(), "IoUring is used before being initialized.");
+        StoreRelease(m_submissionTail, m_submissionLocalTail);
+
+        // Entries the kernel didn't consume in an earlier call, for instance because it was out of resources, are
+        // included again as they're still between the head and tail.
+        const u32 pending = m_submissionLocalTail - LoadAcquire(m_submissionHead);
+        if (pending == 0 && waitCount == 0)
+        {
+            return 0;
+        }
+
+        const u32 flags = waitCount > 0 ? IORING_ENTER_GETEVENTS : 0;
+        int result;
+        do
+        {
+            result = aznumeric_cast<int>(::syscall(__NR_io_uring_enter, m_ringFd, pending, waitCount, flags, nullptr, 0));
+        } while (result < 0 && errno == EINTR);
+        return result < 0 ? -errno : result;
+    }
+
+    bool IoUring::PopCompletion(io_uring_cqe& completion)
+    {
+        AZ_Assert(IsInitialized(), "IoUring is used before being initialized.");
+        const u32 head = *m_completionHead;
+        if (head == LoadAcquire(m_completionTail))
+        {
+            return false;
+        }
+        completion = m_completionEntries[head & m_completionMask];
+        StoreRelease(m_completionHead, head + 1);
+        return true;
+    }
+
+    u32 IoUring::GetCompletionCount() const
+    {
+        AZ_Assert(IsInitialized(), "IoUring is used before being initialized.");
+        return LoadAcquire(m_completionTail) - *m_completionHead;
+    }
+
+    bool IoUring::RegisterBuffers(const iovec* buffers, u32 count)
+    {
+        return Register(IORING_REGISTER_BUFFERS, buffers, count) == 0;
+    }
+
+    bool IoUring::RegisterEventFd(int eventFd)
+    {
+        return Register(IORING_REGISTER_EVENTFD, &eventFd, 1) == 0;
+    }
+
+    int IoUring::Register(u32 opcode, const void* arguments, u32 count)
+    {
+        AZ_Assert(IsInitialized(), "IoUring is used before being initialized.");
+        int result = aznumeric_cast<int>(::syscall(__NR_io_uring_register, m_ringFd, opcode, arguments, count));
+        if (result < 0)
+        {
+            const int error = errno;
+            AZ_Warning("IoUring", false, "io_uring_register (%u) failed with error: %s\n", opcode, strerror(error));
+            return -error;
+        }
+        return result;
+    }
+} // namespace AZ::IO
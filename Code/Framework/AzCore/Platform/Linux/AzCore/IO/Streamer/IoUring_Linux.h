@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+
+namespace AZ::IO
+{
+    //! Minimal wrapper around an io_uring submission and completion queue pair.
+    //! The ring is driven through the raw system calls so no additional libraries are needed. Only a single thread
+    //! may use a ring at a time.
+    class IoUring final
+    {
+    public:
+        IoUring() = default;
+        ~IoUring();
+
+        IoUring(const IoUring&) = delete;
+        IoUring& operator=(const IoUring&) = delete;
+
+        //! Creates the ring with room for at least queueDepth submissions. Returns false if io_uring isn't supported
+        //! by the kernel or is blocked, for instance by a seccomp profile inside a container.
+        bool Initialize(u32 queueDepth);
+        void Shutdown();
+        bool IsInitialized() const;
+
+        //! Returns the number of submissions the ring can hold.
+        u32 GetQueueDepth() const;
+
+        //! Returns a cleared submission entry to fill in, or nullptr if the submission queue is full. The entry is
+        //! queued but only handed to the kernel by the next call to Submit.
+        io_uring_sqe* GetSubmissionEntry();
+        //! Hands all queued submission entries to the kernel with a single system call.
+        //! @return The number of entries that were submitted or a negative errno value on failure.
+        int Submit();
+        //! Hands all queued submission entries to the kernel and blocks until at least waitCount completions are available.
+        //! @return The number of entries that were submitted or a negative errno value on failure.
+        int SubmitAndWait(u32 waitCount);
+
+        //! Copies the oldest completion into the provided entry and removes it from the completion queue.
+        //! @return True if a completion was available, otherwise false.
+        bool PopCompletion(io_uring_cqe& completion);
+        //! Returns the number of completions that are ready to be popped.
+        u32 GetCompletionCount() const;
+
+        //! Registers buffers with the kernel so they can be used with IORING_OP_READ_FIXED, which avoids mapping the
+        //! pages of the buffer for every read.
+        bool RegisterBuffers(const iovec* buffers, u32 count);
+        //! Registers an eventfd that's signaled whenever a completion is posted.
+        bool RegisterEventFd(int eventFd);
+
+    private:
+        int Enter(u32 waitCount);
+        int Register(u32 opcode, const void* arguments, u32 count);
+
+        void* m_ringMemory{ nullptr };
+        size_t m_ringMemorySize{ 0 };
+        void* m_completionRingMemory{ nullptr };
+        size_t m_completionRingMemorySize{ 0 };
+        io_uring_sqe* m_submissionEntries{ nullptr };
+        size_t m_submissionEntriesSize{ 0 };
+
+        u32* m_submissionHead{ nullptr };
+        u32* m_submissionTail{ nullptr };
+        u32* m_submissionArray{ nullptr };
+        u32 m_submissionMask{ 0 };
+        u32 m_submissionEntryCount{ 0 };
+        u32 m_submissionLocalTail{ 0 }; //!< Tail including the entries that have been filled in but not yet submitted.
+
+        u32* m_completionHead{ nullptr };
+        u32* m_completionTail{ nullptr };
+        io_uring_cqe* m_completionEntries{ nullptr };
+        u32 m_completionMask{ 0 };
+
+        int m_ringFd{ -1 };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        const DriveList* drives = AZStd::any_cast<DriveList>(&hardware.m_platformData);
+
+        if (drives && !drives->empty())
+        {
+            // Without io_uring the drives below this entry in the stack, typically the generic storage drive, will handle
+            // all requests.
+            if (!StorageDriveLinux::IsSupported())
+            {
+                AZ_Warning("Streamer", false, "io_uring isn't available, falling back to the next storage drive in the stack.\n");
+                return parent;
+            }
+
+            for (const DriveInformation& drive : *drives)
+            {
+                StorageDriveLinux::ConstructionOptions options;
+                options.m_enableDirectReads = m_enableDirectReads;
+                options.m_hasSeekPenalty = drive.m_hasSeekPenalty;
+                options.m_minimalReporting = m_minimalReporting;
+
+                AZStd::vector<AZStd::string_view> drivePaths(drive.m_paths.begin(), drive.m_paths.end());
+                AZ_Assert(!drive.m_paths.empty(), "Expected at least one drive path.");
+                auto stackEntry = AZStd::make_shared<StorageDriveLinux>(
+                    AZStd::move(drivePaths), m_maxFileHandles, m_maxMetaDataCache, drive.m_physicalSectorSize, drive.m_logicalSectorSize,
+                    drive.m_ioChannelCount, m_overcommit, m_registeredBufferCount, m_registeredBufferSizeKib * 1_kib, options);
+
+                stackEntry->SetNext(AZStd::move(parent));
+                parent = stackEntry;
+            }
+        }
+        else
+        {
+            AZ_Warning("Streamer", false, "No drives found that can make use of the available optimizations.\n");
+        }
+        return parent;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("RegisteredBufferCount", &LinuxStorageDriveConfig::m_registeredBufferCount)
+                ->Field("RegisteredBufferSizeKib", &LinuxStorageDriveConfig::m_registeredBufferSizeKib)
+                ->Field("EnableDirectReads", &LinuxStorageDriveConfig::m_enableDirectReads)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+namespace AZ::IO::Requests
+{
+    struct ReadData;
+    struct ReportData;
+}
+
+namespace AZ::IO
+{
+    //! Storage drive that reads through io_uring. Reads are issued asynchronously and all reads that are queued while
+    //! processing a scheduler tick are handed to the kernel in a single submission, allowing the device to work on
+    //! multiple requests in parallel.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        //! The maximum number of reads that are kept in flight by a single drive.
+        static constexpr u32 MaxQueueDepth = 128;
+
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Open files with O_DIRECT to bypass the Linux page cache. This results in a faster read the first time a
+            //! file is read, but subsequent reads will possibly be slower as those could have been serviced from the page
+            //! cache. Direct reads have alignment restrictions, reads that don't meet those are read into a sector aligned
+            //! buffer first. Files on file systems that don't support direct reads are read through the page cache.
+            u8 m_enableDirectReads : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Returns true if io_uring can be used by this process. It may be missing from older kernels or blocked by
+        //! security policies, for instance inside containers.
+        static bool IsSupported();
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param drivePaths The mount points of the file systems on the device.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntires The maximum number of files to keep meta data, such as the file size, to cache. Only
+        //!     a small number are needed when running from archives, but it's recommended that a larger number are kept open
+        //!     when reading from loose files.
+        //! @param physicalSectorSize The minimal sector size as instructed by the device. When direct reads are used the output
+        //!     buffer needs to be aligned to this value.
+        //! @param logicalSectorSize The minimal sector size as instructed by the device. When direct reads are used the
+        //!     read size and offset need to be aligned to this value.
+        //! @param ioChannelCount The maximum number of requests that are kept in flight. This value will be capped by
+        //!     MaxQueueDepth.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. An over-commit that is too large can negatively impact the
+        //!     scheduler's ability to re-order requests for optimal read order. A negative value will under-commit and will
+        //!     avoid saturating the IO controller which can be needed if the drive is used by other applications.
+        //! @param registeredBufferCount The number of sector aligned buffers that are registered with the kernel. These are used
+        //!     instead of temporary allocations when a direct read needs to be aligned, which also saves the kernel from mapping
+        //!     the buffer for every read. Set to 0 to disable registered buffers.
+        //! @param registeredBufferSize The size of each of the registered buffers.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(const AZStd::vector<AZStd::string_view>& drivePaths, u32 maxFileHandles, u32 maxMetaDataCacheEntries,
+            size_t physicalSectorSize, size_t logicalSectorSize, u32 ioChannelCount, s32 overCommit, u32 registeredBufferCount,
+            size_t registeredBufferSize, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr u32 InvalidRegisteredBufferIndex = std::numeric_limits<u32>::max();
+        //! Set in the user data of cancel submissions to tell their completions apart from the completions of reads.
+        inline static constexpr u64 CancelUserDataFlag = u64(1) << 63;
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::steady_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr };    // Buffer that is sector aligned, either allocated or registered.
+            size_t m_copyBackOffset{ 0 };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            u32 m_registeredBufferIndex{ InvalidRegisteredBufferIndex };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        bool InitializeRing();
+        OpenFileResult OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+        u32 ClaimRegisteredBuffer(size_t size);
+        bool IsServicedByThisDrive(AZ::IO::PathView filePath) const;
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request,
+            AZStd::chrono::steady_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        void SubmitQueuedEntries();
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, s32 result);
+
+        void Report(const Requests::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        //! The number of reads in flight after every submission to the kernel.
+        AverageWindow<u64, double, s_statisticsWindowSize> m_queueDepthAverage;
+        //! The number of reads handed to the kernel per submission.
+        AverageWindow<u64, double, s_statisticsWindowSize> m_submissionBatchSizeAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::steady_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        IoUring m_ring;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<bool> m_readSlots_active;
+
+        AZStd::vector<AZStd::chrono::steady_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        AZStd::vector<AZStd::string> m_drivePaths;
+
+        void* m_registeredBuffers{ nullptr };
+        AZStd::vector<u32> m_registeredBuffers_available;
+        size_t m_registeredBufferSize{ 0 };
+        u32 m_registeredBufferCount{ 0 };
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_ioChannelCount{ 1 };
+        s32 m_overCommit{ 0 };
+        u32 m_queuedSubmissions{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+        bool m_ringUnavailable{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/sort.h>
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    struct MountInformation
+    {
+        AZStd::string m_mountPoint;
+        u32 m_major{ 0 };
+        u32 m_minor{ 0 };
+    };
+
+    // Reads a single numeric sysfs attribute. Returns false if the file does not exist or doesn't contain a number.
+    static bool ReadSysfsValue(const AZStd::string& directory, const char* attribute, u64& value)
+    {
+        AZStd::string path = AZStd::string::format("%s/%s", directory.c_str(), attribute);
+        FILE* file = fopen(path.c_str(), "r");
+        if (!file)
+        {
+            return false;
+        }
+        unsigned long long result = 0;
+        const bool found = fscanf(file, "%llu", &result) == 1;
+        fclose(file);
+        if (found)
+        {
+            value = result;
+        }
+        return found;
+    }
+
+    // Mount points in /proc/self/mountinfo escape spaces, tabs, new lines and backslashes as octal numbers, e.g. "\040".
+    static void UnescapeMountPoint(AZStd::string& mountPoint)
+    {
+        size_t write = 0;
+        for (size_t read = 0; read < mountPoint.size(); ++read, ++write)
+        {
+            if (mountPoint[read] == '\\' && read + 3 < mountPoint.size())
+            {
+                const char* digits = mountPoint.c_str() + read + 1;
+                if (digits[0] >= '0' && digits[0] <= '7' && digits[1] >= '0' && digits[1] <= '7' && digits[2] >= '0' && digits[2] <= '7')
+                {
+                    mountPoint[write] = aznumeric_cast<char>(((digits[0] - '0') << 6) | ((digits[1] - '0') << 3) | (digits[2] - '0'));
+                    read += 3;
+                    continue;
+                }
+            }
+            mountPoint[write] = mountPoint[read];
+        }
+        mountPoint.resize(write);
+    }
+
+    static AZStd::vector<MountInformation> CollectMounts()
+    {
+        AZStd::vector<MountInformation> result;
+
+        FILE* file = fopen("/proc/self/mountinfo", "r");
+        if (!file)
+        {
+            return result;
+        }
+
+        // Later mounts on the same mount point hide the earlier ones, so only the last entry is kept.
+        AZStd::unordered_map<AZStd::string, size_t> mountIndices;
+        char* line = nullptr;
+        size_t lineSize = 0;
+        while (getline(&line, &lineSize, file) > 0)
+        {
+            // Format: <mount id> <parent id> <major>:<minor> <root> <mount point> <options> ...
+            unsigned int major = 0;
+            unsigned int minor = 0;
+            char mountPoint[PATH_MAX];
+            if (sscanf(line, "%*u %*u %u:%u %*s %4095s", &major, &minor, mountPoint) != 3)
+            {
+                continue;
+            }
+
+            MountInformation mount;
+            mount.m_mountPoint = mountPoint;
+            UnescapeMountPoint(mount.m_mountPoint);
+            mount.m_major = major;
+            mount.m_minor = minor;
+
+            auto it = mountIndices.find(mount.m_mountPoint);
+            if (it != mountIndices.end())
+            {
+                result[it->second] = AZStd::move(mount);
+            }
+            else
+            {
+                mountIndices.emplace(mount.m_mountPoint, result.size());
+                result.push_back(AZStd::move(mount));
+            }
+        }
+        free(line);
+        fclose(file);
+
+        return result;
+    }
+
+    // Finds the mount point with the longest path that contains the given path.
+    static const MountInformation* FindMount(const AZStd::vector<MountInformation>& mounts, AZ::IO::PathView path)
+    {
+        const MountInformation* result = nullptr;
+        for (const MountInformation& mount : mounts)
+        {
+            if ((!result || mount.m_mountPoint.size() > result->m_mountPoint.size()) &&
+                path.IsRelativeTo(AZ::IO::PathView(mount.m_mountPoint)))
+            {
+                result = &mount;
+            }
+        }
+        return result;
+    }
+
+    static AZStd::unordered_set<AZStd::string> CollectUsedMountPoints(const AZStd::vector<MountInformation>& mounts)
+    {
+        AZStd::unordered_set<AZStd::string> result;
+        auto IsMountInUse = [&mounts, &result](const AZ::SettingsRegistryInterface::VisitArgs& visitArgs)
+        {
+            AZ::IO::FixedMaxPath runtimePath;
+            if (visitArgs.m_registry.Get(runtimePath.Native(), visitArgs.m_jsonKeyPath))
+            {
+                if (const MountInformation* mount = FindMount(mounts, runtimePath); mount)
+                {
+                    result.insert(mount->m_mountPoint);
+                }
+            }
+            return AZ::SettingsRegistryInterface::VisitResponse::Skip;
+        };
+
+        if (auto settingsRegistry = SettingsRegistry::Get(); settingsRegistry)
+        {
+            AZ::SettingsRegistryVisitorUtils::VisitObject(*settingsRegistry, IsMountInUse, SettingsRegistryMergeUtils::FilePathsRootKey);
+        }
+        return result;
+    }
+
+    // Returns the sysfs directory for the disk that holds the given block device. For partitions this is the parent
+    // directory, e.g. "/sys/devices/.../block/nvme0n1" for "nvme0n1p2".
+    static bool FindDiskDirectory(u32 major, u32 minor, AZStd::string& diskDirectory)
+    {
+        AZStd::string devicePath = AZStd::string::format("/sys/dev/block/%u:%u", major, minor);
+        char resolvedPath[PATH_MAX];
+        if (!realpath(devicePath.c_str(), resolvedPath))
+        {
+            return false;
+        }
+        diskDirectory = resolvedPath;
+
+        struct stat attributes;
+        if (::stat((diskDirectory + "/partition").c_str(), &attributes) == 0)
+        {
+            size_t separator = diskDirectory.rfind('/');
+            if (separator == AZStd::string::npos || separator == 0)
+            {
+                return false;
+            }
+            diskDirectory.resize(separator);
+        }
+        return true;
+    }
+
+    static void CollectProfile(const AZStd::string& diskDirectory, DriveInformation& info)
+    {
+        // The resolved sysfs path contains the buses the device is connected through, for instance
+        // "/sys/devices/pci0000:00/0000:00:17.0/ata1/host0/target0:0:0/0:0:0:0/block/sda".
+        if (diskDirectory.contains("/nvme"))
+        {
+            info.m_profile = "Nvme";
+        }
+        else if (diskDirectory.contains("/usb"))
+        {
+            info.m_profile = "Usb";
+        }
+        else if (diskDirectory.contains("/ata"))
+        {
+            info.m_profile = "Sata";
+        }
+        else if (diskDirectory.contains("/mmc"))
+        {
+            info.m_profile = "Mmc";
+        }
+        else if (diskDirectory.contains("/virtio") || diskDirectory.contains("/virtual/"))
+        {
+            info.m_profile = "Virtual";
+        }
+        else
+        {
+            info.m_profile = "Generic";
+        }
+    }
+
+    static bool CollectDriveInfo(const AZStd::string& diskDirectory, DriveInformation& info, bool reportHardware)
+    {
+        CollectProfile(diskDirectory, info);
+
+        const AZStd::string queueDirectory = diskDirectory + "/queue";
+        u64 requestCount = 0;
+        if (!ReadSysfsValue(queueDirectory, "nr_requests", requestCount))
+        {
+            return false;
+        }
+        info.m_ioChannelCount = aznumeric_cast<u32>(AZStd::min<u64>(requestCount, AZStd::numeric_limits<u32>::max()));
+        info.m_supportsQueuing = requestCount > 1;
+
+        u64 value = 0;
+        if (ReadSysfsValue(queueDirectory, "rotational", value))
+        {
+            info.m_hasSeekPenalty = value != 0;
+            info.m_profile += info.m_hasSeekPenalty ? "_HDD" : "_SSD";
+        }
+        if (ReadSysfsValue(queueDirectory, "physical_block_size", value) && value > 0)
+        {
+            info.m_physicalSectorSize = aznumeric_cast<size_t>(value);
+        }
+        if (ReadSysfsValue(queueDirectory, "logical_block_size", value) && value > 0)
+        {
+            info.m_logicalSectorSize = aznumeric_cast<size_t>(value);
+        }
+        if (ReadSysfsValue(queueDirectory, "max_sectors_kb", value))
+        {
+            info.m_maxTransfer = aznumeric_cast<size_t>(value * 1_kib);
+        }
+        info.m_pageSize = aznumeric_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+        if (reportHardware)
+        {
+            AZ_Trace(
+                "Streamer",
+                "Drive info for '%s':\n"
+                "    Profile: %s\n"
+                "    Max transfer: %.3f kb\n"
+                "    Page size: %zu kb\n"
+                "    Max IO count: %u\n"
+                "    Has seek penalty: %s\n"
+                "    Physical sector size: %zu bytes\n"
+                "    Logical sector size: %zu bytes\n",
+                diskDirectory.c_str(), info.m_profile.c_str(), (1.0f / 1024.0f) * info.m_maxTransfer, info.m_pageSize / 1024,
+                info.m_ioChannelCount, info.m_hasSeekPenalty ? "Yes" : "No", info.m_physicalSectorSize, info.m_logicalSectorSize);
+        }
+        return true;
+    }
+
+    static size_t CalculatePathDepth(AZStd::string_view path)
+    {
+        return path == "/" ? 0 : AZStd::count_if(path.begin(), path.end(), [](char c) { return c == '/'; });
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool addAllDrives, bool reportHardware)
+    {
+        AZStd::vector<MountInformation> mounts = CollectMounts();
+        if (mounts.empty())
+        {
+            return false;
+        }
+
+        AZStd::unordered_set<AZStd::string> usedMountPoints;
+        if (!addAllDrives)
+        {
+            usedMountPoints = CollectUsedMountPoints(mounts);
+        }
+
+        AZStd::unordered_map<AZStd::string, DriveInformation> driveMappings;
+        AZStd::unordered_set<AZStd::string> skippedDisks;
+        for (const MountInformation& mount : mounts)
+        {
+            // Only file systems on block devices are supported. Virtual file systems such as proc, tmpfs and overlay
+            // use major number 0 and network file systems aren't backed by a local block device.
+            if (mount.m_major == 0)
+            {
+                continue;
+            }
+
+            if (!addAllDrives && !usedMountPoints.contains(mount.m_mountPoint))
+            {
+                if (reportHardware)
+                {
+                    AZ_Trace("Streamer", "Skipping mount point '%s' because no paths make use of it.\n", mount.m_mountPoint.c_str());
+                }
+                continue;
+            }
+
+            AZStd::string diskDirectory;
+            if (!FindDiskDirectory(mount.m_major, mount.m_minor, diskDirectory))
+            {
+                if (reportHardware)
+                {
+                    AZ_Trace(
+                        "Streamer", "Skipping mount point '%s' because device is not registered with OS as a block device.\n",
+                        mount.m_mountPoint.c_str());
+                }
+                continue;
+            }
+
+            if (skippedDisks.contains(diskDirectory))
+            {
+                continue;
+            }
+
+            auto driveInformationEntry = driveMappings.find(diskDirectory);
+            if (driveInformationEntry == driveMappings.end())
+            {
+                DriveInformation driveInformation;
+                driveInformation.m_paths.emplace_back(mount.m_mountPoint);
+                if (CollectDriveInfo(diskDirectory, driveInformation, reportHardware) && driveInformation.m_supportsQueuing)
+                {
+                    hardwareInfo.m_maxPhysicalSectorSize =
+                        AZStd::max(hardwareInfo.m_maxPhysicalSectorSize, driveInformation.m_physicalSectorSize);
+                    hardwareInfo.m_maxLogicalSectorSize =
+                        AZStd::max(hardwareInfo.m_maxLogicalSectorSize, driveInformation.m_logicalSectorSize);
+                    hardwareInfo.m_maxPageSize = AZStd::max(hardwareInfo.m_maxPageSize, driveInformation.m_pageSize);
+                    hardwareInfo.m_maxTransfer = AZStd::max(hardwareInfo.m_maxTransfer, driveInformation.m_maxTransfer);
+
+                    driveMappings.insert({ AZStd::move(diskDirectory), AZStd::move(driveInformation) });
+                }
+                else
+                {
+                    if (reportHardware)
+                    {
+                        AZ_Trace(
+                            "Streamer", "Skipping mount point '%s' because device does not support queuing requests.\n",
+                            mount.m_mountPoint.c_str());
+                    }
+                    skippedDisks.insert(AZStd::move(diskDirectory));
+                }
+            }
+            else
+            {
+                if (reportHardware)
+                {
+                    AZ_Trace(
+                        "Streamer", "Mount point '%s' is on the same storage drive as '%s'.\n",
+                        mount.m_mountPoint.c_str(), driveInformationEntry->second.m_paths[0].c_str());
+                }
+                driveInformationEntry->second.m_paths.emplace_back(mount.m_mountPoint);
+            }
+        }
+
+        DriveList driveList;
+        driveList.reserve(driveMappings.size());
+        for (auto& drive : driveMappings)
+        {
+            driveList.push_back(AZStd::move(drive.second));
+        }
+
+        // Mount points can be nested, for instance "/home" on one drive and "/" on another. Drives are added to the
+        // Streamer stack in order, with the last drive ending up on top, so drives with the deepest mount points need
+        // to be added last to get the first opportunity to claim a request.
+        auto DeepestMount = [](const DriveInformation& drive)
+        {
+            size_t depth = 0;
+            for (const AZStd::string& path : drive.m_paths)
+            {
+                depth = AZStd::max(depth, CalculatePathDepth(path));
+            }
+            return depth;
+        };
+        AZStd::sort(driveList.begin(), driveList.end(),
+            [&DeepestMount](const DriveInformation& lhs, const DriveInformation& rhs)
+            {
+                return DeepestMount(lhs) < DeepestMount(rhs);
+            });
+
+        const bool hasDrives = !driveList.empty();
+        hardwareInfo.m_profile = driveList.size() == 1 ? driveList.front().m_profile : "Generic";
+        hardwareInfo.m_platformData = AZStd::make_any<DriveList>(AZStd::move(driveList));
+
+        return hasDrives;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, includeAllHardware, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/std/utils.h>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    static int CreateEventFd()
+    {
+        int event = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        AZ_Assert(event >= 0, "Failed to create a required event for IO Scheduler (Error: %s).", strerror(errno));
+        return event;
+    }
+
+    static void ResetEventFd(int event)
+    {
+        // Reading the eventfd resets its counter. The eventfd is non-blocking, so this returns immediately if it wasn't signaled.
+        eventfd_t value;
+        [[maybe_unused]] int result = eventfd_read(event, &value);
+    }
+
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_events[0].fd = CreateEventFd();
+        m_events[0].events = POLLIN;
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        for (size_t i = 0; i < m_eventCount; ++i)
+        {
+            if (m_events[i].fd >= 0)
+            {
+                ::close(m_events[i].fd);
+            }
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_events[0].fd >= 0, "There is no synchronization event created for the main streamer thread to use to suspend.");
+
+        int result;
+        do
+        {
+            result = ::poll(m_events, aznumeric_cast<nfds_t>(m_eventCount), -1);
+        } while (result < 0 && errno == EINTR);
+
+        if (result > 0)
+        {
+            for (size_t i = 0; i < m_eventCount; ++i)
+            {
+                if (m_events[i].revents & POLLIN)
+                {
+                    ResetEventFd(m_events[i].fd);
+                }
+                m_events[i].revents = 0;
+            }
+        }
+        else
+        {
+            AZ_Assert(false, "Unexpected wait result: %i (Error: %s).", result, strerror(errno));
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_events[0].fd >= 0, "There is no synchronization event created for the main streamer thread to use to resume.");
+        eventfd_write(m_events[0].fd, 1);
+    }
+
+    int StreamerContextThreadSync::CreateEventHandle()
+    {
+        AZ_Assert(AreEventHandlesAvailable(), "There are no more slots available to allocate a new IO event in.");
+        int event = CreateEventFd();
+        if (event >= 0)
+        {
+            m_events[m_eventCount].fd = event;
+            m_events[m_eventCount].events = POLLIN;
+            m_events[m_eventCount].revents = 0;
+            m_eventCount++;
+        }
+        return event;
+    }
+
+    void StreamerContextThreadSync::DestroyEventHandle(int event)
+    {
+        AZ_Assert(m_eventCount > 1, "There are no more IO events that can be destroyed.");
+
+        for (size_t i = 1; i < m_eventCount; ++i)
+        {
+            if (m_events[i].fd == event)
+            {
+                ::close(event);
+                m_eventCount--;
+                AZStd::swap(m_events[i], m_events[m_eventCount]);
+                return;
+            }
+        }
+
+        AZ_Assert(false, "IO event couldn't be destroyed as it wasn't found.");
+    }
+
+    size_t StreamerContextThreadSync::GetEventHandleCount() const
+    {
+        return m_eventCount - 1;
+    }
+
+    bool StreamerContextThreadSync::AreEventHandlesAvailable() const
+    {
+        return m_eventCount < MaxIoEvents + 1;
+    }
+} // namespace AZ::Platform
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <poll.h>
+
+namespace AZ::Platform
+{
+    class StreamerContextThreadSync
+    {
+    public:
+        static constexpr size_t MaxIoEvents = 15;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Creates an eventfd that wakes up the scheduler thread when signaled, for instance by registering it with an io_uring.
+        //! The returned file descriptor is owned by the thread sync and is closed when it's destroyed, even if
+        //! DestroyEventHandle isn't called.
+        int CreateEventHandle();
+        void DestroyEventHandle(int event);
+        size_t GetEventHandleCount() const;
+        bool AreEventHandlesAvailable() const;
+
+    private:
+        // Note: The first event is reserved for the synchronization of the scheduler thread with the rest of
+        // the engine. The remaining events can be freely used by Streamer's internals.
+        pollfd m_events[MaxIoEvents + 1]{};
+        size_t m_eventCount{ 1 }; // The first event is for external wake up calls.
+    };
+
+} // namespace AZ::Platform
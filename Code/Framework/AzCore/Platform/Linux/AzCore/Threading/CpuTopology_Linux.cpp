@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Threading/CpuTopology.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/fixed_string.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace AZ::Threading
+{
+    namespace Platform
+    {
+        // Reads a single line sysfs attribute. Returns false if the file does not exist.
+        static bool ReadSysfsLine(const char* path, AZStd::fixed_string<1024>& line)
+        {
+            FILE* file = fopen(path, "r");
+            if (!file)
+            {
+                return false;
+            }
+            char buffer[1024];
+            const bool result = fgets(buffer, sizeof(buffer), file) != nullptr;
+            fclose(file);
+            line = result ? buffer : "";
+            return result;
+        }
+
+        // Parses the kernel cpulist format, e.g. "0-7,16-23,31", invoking visitor for every id in the list.
+        template<typename Visitor>
+        static void ParseCpuList(const char* list, Visitor&& visitor)
+        {
+            const char* cursor = list;
+            while (*cursor != '\0' && *cursor != '\n')
+            {
+                char* end = nullptr;
+                const unsigned long first = strtoul(cursor, &end, 10);
+                if (end == cursor)
+                {
+                    return;
+                }
+                unsigned long last = first;
+                cursor = end;
+                if (*cursor == '-')
+                {
+                    ++cursor;
+                    last = strtoul(cursor, &end, 10);
+                    cursor = end;
+                }
+                for (unsigned long id = first; id <= last; ++id)
+                {
+                    visitor(static_cast<uint32_t>(id));
+                }
+                if (*cursor == ',')
+                {
+                    ++cursor;
+                }
+            }
+        }
+
+        static LogicalProcessor* FindProcessor(CpuTopology& topology, uint32_t id)
+        {
+            auto it = AZStd::lower_bound(
+                topology.m_processors.begin(), topology.m_processors.end(), id,
+                [](const LogicalProcessor& processor, uint32_t value)
+                {
+                    return processor.m_id < value;
+                });
+            return (it != topology.m_processors.end() && it->m_id == id) ? it : nullptr;
+        }
+    } // namespace Platform
+
+    CpuTopology QueryCpuTopology()
+    {
+        CpuTopology topology;
+        AZStd::fixed_string<1024> line;
+
+        if (Platform::ReadSysfsLine("/sys/devices/system/cpu/online", line))
+        {
+            Platform::ParseCpuList(
+                line.c_str(),
+                [&topology](uint32_t id)
+                {
+                    LogicalProcessor processor;
+                    processor.m_id = id;
+                    topology.m_processors.push_back(processor);
+                });
+        }
+
+        if (topology.m_processors.empty())
+        {
+            const uint32_t processorCount = AZStd::thread::hardware_concurrency();
+            topology.m_processors.resize(processorCount);
+            for (uint32_t i = 0; i < processorCount; ++i)
+            {
+                topology.m_processors[i].m_id = i;
+            }
+            return topology;
+        }
+
+        // NUMA nodes are numbered contiguously in practice, but stop at the first gap of a few nodes to be safe
+        uint32_t highestNode = 0;
+        for (uint32_t node = 0, misses = 0; misses < 4; ++node)
+        {
+            AZStd::fixed_string<128> path = AZStd::fixed_string<128>::format("/sys/devices/system/node/node%u/cpulist", node);
+            if (!Platform::ReadSysfsLine(path.c_str(), line))
+            {
+                ++misses;
+                continue;
+            }
+            misses = 0;
+            highestNode = node;
+            Platform::ParseCpuList(
+                line.c_str(),
+                [&topology, node](uint32_t id)
+                {
+                    if (LogicalProcessor* processor = Platform::FindProcessor(topology, id))
+                    {
+                        processor->m_numaNode = node;
+                    }
+                });
+        }
+        topology.m_numaNodeCount = highestNode + 1;
+
+        // Intel hybrid parts expose the E-cores as a separate "cpu_atom" PMU
+        if (Platform::ReadSysfsLine("/sys/devices/cpu_atom/cpus", line))
+        {
+            Platform::ParseCpuList(
+                line.c_str(),
+                [&topology](uint32_t id)
+                {
+                    if (LogicalProcessor* processor = Platform::FindProcessor(topology, id))
+                    {
+                        processor->m_coreClass = CoreClass::Efficiency;
+                        topology.m_hasEfficiencyCores = true;
+                    }
+                });
+        }
+        else
+        {
+            // ARM big.LITTLE reports a relative capacity per core, anything below the maximum is an efficiency core
+            AZStd::vector<unsigned long> capacities(topology.m_processors.size(), 0);
+            unsigned long maxCapacity = 0;
+            for (size_t i = 0; i < topology.m_processors.size(); ++i)
+            {
+                AZStd::fixed_string<128> path = AZStd::fixed_string<128>::format(
+                    "/sys/devices/system/cpu/cpu%u/cpu_capacity", topology.m_processors[i].m_id);
+                if (Platform::ReadSysfsLine(path.c_str(), line))
+                {
+                    capacities[i] = strtoul(line.c_str(), nullptr, 10);
+                    maxCapacity = AZStd::max(maxCapacity, capacities[i]);
+                }
+            }
+            for (size_t i = 0; maxCapacity > 0 && i < topology.m_processors.size(); ++i)
+            {
+                if (capacities[i] != 0 && capacities[i] < maxCapacity)
+                {
+                    topology.m_processors[i].m_coreClass = CoreClass::Efficiency;
+                    topology.m_hasEfficiencyCores = true;
+                }
+            }
+        }
+
+        return topology;
+    }
+
+    bool SetCurrentThreadProcessor(uint32_t logicalProcessorId)
+    {
+        if (logicalProcessorId >= CPU_SETSIZE)
+        {
+            return false;
+        }
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(logicalProcessorId, &cpuset);
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) == 0;
+    }
+} // namespace AZ::Threading
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/Threading/CpuTopology.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ::Threading
+{
+    namespace Platform
+    {
+        // Logical processor ids are flattened across processor groups as (group * 64 + bit)
+        constexpr uint32_t ProcessorsPerGroup = 64;
+
+        template<typename Visitor>
+        static void VisitGroupMask(const GROUP_AFFINITY& affinity, Visitor&& visitor)
+        {
+            for (uint32_t bit = 0; bit < ProcessorsPerGroup; ++bit)
+            {
+                if (affinity.Mask & (KAFFINITY(1) << bit))
+                {
+                    visitor(affinity.Group * ProcessorsPerGroup + bit);
+                }
+            }
+        }
+
+        static AZStd::vector<uint8_t> QueryProcessorInformation(LOGICAL_PROCESSOR_RELATIONSHIP relationship)
+        {
+            DWORD length = 0;
+            GetLogicalProcessorInformationEx(relationship, nullptr, &length);
+            AZStd::vector<uint8_t> buffer(length);
+            if (length == 0 ||
+                !GetLogicalProcessorInformationEx(
+                    relationship, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data()), &length))
+            {
+                buffer.clear();
+            }
+            return buffer;
+        }
+
+        template<typename Visitor>
+        static void VisitProcessorInformation(const AZStd::vector<uint8_t>& buffer, Visitor&& visitor)
+        {
+            size_t offset = 0;
+            while (offset < buffer.size())
+            {
+                auto info = reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+                visitor(*info);
+                offset += info->Size;
+            }
+        }
+
+        static LogicalProcessor* FindProcessor(CpuTopology& topology, uint32_t id)
+        {
+            auto it = AZStd::lower_bound(
+                topology.m_processors.begin(), topology.m_processors.end(), id,
+                [](const LogicalProcessor& processor, uint32_t value)
+                {
+                    return processor.m_id < value;
+                });
+            return (it != topology.m_processors.end() && it->m_id == id) ? it : nullptr;
+        }
+    } // namespace Platform
+
+    CpuTopology QueryCpuTopology()
+    {
+        CpuTopology topology;
+
+        // Cores come first so that the processor list can be built sorted, then annotated with the NUMA information
+        AZStd::vector<uint8_t> coreInfo = Platform::QueryProcessorInformation(RelationProcessorCore);
+        BYTE maxEfficiencyClass = 0;
+        Platform::VisitProcessorInformation(
+            coreInfo,
+            [&maxEfficiencyClass](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& info)
+            {
+                maxEfficiencyClass = AZStd::max(maxEfficiencyClass, info.Processor.EfficiencyClass);
+            });
+        Platform::VisitProcessorInformation(
+            coreInfo,
+            [&topology, maxEfficiencyClass](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& info)
+            {
+                // A higher EfficiencyClass indicates a faster core. It is 0 for every core on homogeneous systems.
+                const CoreClass coreClass =
+                    info.Processor.EfficiencyClass < maxEfficiencyClass ? CoreClass::Efficiency : CoreClass::Performance;
+                for (WORD group = 0; group < info.Processor.GroupCount; ++group)
+                {
+                    Platform::VisitGroupMask(
+                        info.Processor.GroupMask[group],
+                        [&topology, coreClass](uint32_t id)
+                        {
+                            LogicalProcessor processor;
+                            processor.m_id = id;
+                            processor.m_coreClass = coreClass;
+                            topology.m_processors.push_back(processor);
+                            topology.m_hasEfficiencyCores |= coreClass == CoreClass::Efficiency;
+                        });
+                }
+            });
+
+        if (topology.m_processors.empty())
+        {
+            const uint32_t processorCount = AZStd::thread::hardware_concurrency();
+            topology.m_processors.resize(processorCount);
+            for (uint32_t i = 0; i < processorCount; ++i)
+            {
+                topology.m_processors[i].m_id = i;
+            }
+            return topology;
+        }
+
+        AZStd::sort(
+            topology.m_processors.begin(), topology.m_processors.end(),
+            [](const LogicalProcessor& lhs, const LogicalProcessor& rhs)
+            {
+                return lhs.m_id < rhs.m_id;
+            });
+
+        uint32_t highestNode = 0;
+        Platform::VisitProcessorInformation(
+            Platform::QueryProcessorInformation(RelationNumaNode),
+            [&topology, &highestNode](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& info)
+            {
+                const uint32_t node = info.NumaNode.NodeNumber;
+                highestNode = AZStd::max(highestNode, node);
+                Platform::VisitGroupMask(
+                    info.NumaNode.GroupMask,
+                    [&topology, node](uint32_t id)
+                    {
+                        if (LogicalProcessor* processor = Platform::FindProcessor(topology, id))
+                        {
+                            processor->m_numaNode = node;
+                        }
+                    });
+            });
+        topology.m_numaNodeCount = highestNode + 1;
+
+        return topology;
+    }
+
+    bool SetCurrentThreadProcessor(uint32_t logicalProcessorId)
+    {
+        GROUP_AFFINITY affinity = {};
+        affinity.Group = static_cast<WORD>(logicalProcessorId / Platform::ProcessorsPerGroup);
+        affinity.Mask = KAFFINITY(1) << (logicalProcessorId % Platform::ProcessorsPerGroup);
+        return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != FALSE;
+    }
+} // namespace AZ::Threading
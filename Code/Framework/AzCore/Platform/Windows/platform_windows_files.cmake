@@ -36,6 +36,7 @@ set(FILES
     ../Common/WinAPI/AzCore/Debug/Trace_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/AnsiTerminalUtils_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/FileIO_WinAPI.cpp
+    ../Common/WinAPI/AzCore/IO/MappedFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.h
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.cpp
@@ -76,6 +77,7 @@ set(FILES
     AzCore/std/time_Windows.cpp
     ../Common/WinAPI/AzCore/Utils/Utils_WinAPI.cpp
     AzCore/Utils/Utils_Windows.cpp
+    AzCore/Threading/CpuTopology_Windows.cpp
     AzCore/Debug/Profiler_Platform.inl
     ../Common/WinAPI/AzCore/Debug/Profiler_WinAPI.inl
 )
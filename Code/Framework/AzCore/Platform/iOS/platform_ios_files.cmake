@@ -38,6 +38,7 @@ set(FILES
     ../Common/Apple/AzCore/IO/SystemFile_Apple.h
     ../Common/UnixLike/AzCore/IO/AnsiTerminalUtils_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/FileIO_UnixLike.cpp
+    ../Common/UnixLike/AzCore/IO/MappedFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.h
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.cpp
@@ -74,6 +75,7 @@ set(FILES
     AzCore/Utils/Utils_iOS.mm
     ../Common/Apple/AzCore/Utils/Utils_Apple.cpp
     ../Common/UnixLike/AzCore/Utils/Utils_UnixLike.cpp
+    ../Common/Default/AzCore/Threading/CpuTopology_Default.cpp
     AzCore/Debug/Profiler_Platform.inl
     ../Common/Unimplemented/AzCore/Debug/Profiler_Unimplemented.inl
 )
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "UserTypes.h"
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+
+namespace UnitTest
+{
+    class FlatHashedContainers
+        : public LeakDetectionFixture
+    {
+    public:
+        //! Puts every key in the same probe sequence, so lookups have to walk past the other keys.
+        struct CollidingHash
+        {
+            size_t operator()(int key) const { return static_cast<size_t>(key % 3); }
+        };
+    };
+
+    TEST_F(FlatHashedContainers, FlatHashMap_InsertFindErase)
+    {
+        AZStd::flat_hash_map<int, int> map;
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(0, map.capacity());
+        EXPECT_TRUE(map.begin() == map.end());
+        EXPECT_TRUE(map.find(1) == map.end());
+
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_TRUE(map.emplace(i, i * 2).second);
+        }
+        EXPECT_FALSE(map.insert(AZStd::make_pair(10, 0)).second);
+        EXPECT_EQ(100, map.size());
+        EXPECT_LE(map.load_factor(), map.max_load_factor());
+
+        for (int i = 0; i < 100; ++i)
+        {
+            auto found = map.find(i);
+            ASSERT_NE(found, map.end());
+            EXPECT_EQ(i * 2, found->second);
+        }
+        EXPECT_FALSE(map.contains(100));
+
+        for (int i = 0; i < 100; i += 2)
+        {
+            EXPECT_EQ(1, map.erase(i));
+        }
+        EXPECT_EQ(0, map.erase(0));
+        EXPECT_EQ(50, map.size());
+        EXPECT_FALSE(map.contains(10));
+        EXPECT_TRUE(map.contains(11));
+
+        size_t visited = 0;
+        for (const auto& [key, value] : map)
+        {
+            EXPECT_EQ(1, key % 2);
+            EXPECT_EQ(key * 2, value);
+            ++visited;
+        }
+        EXPECT_EQ(50, visited);
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_SubscriptTryEmplaceAndInsertOrAssign)
+    {
+        AZStd::flat_hash_map<AZStd::string, AZStd::string> map;
+        map["one"] = "1";
+        EXPECT_EQ("1", map.at("one"));
+
+        EXPECT_FALSE(map.try_emplace("one", "uno").second);
+        EXPECT_EQ("1", map["one"]);
+        EXPECT_TRUE(map.try_emplace("two", "2").second);
+
+        EXPECT_FALSE(map.insert_or_assign("two", AZStd::string("dos")).second);
+        EXPECT_EQ("dos", map["two"]);
+        EXPECT_TRUE(map.insert_or_assign("three", AZStd::string("3")).second);
+        EXPECT_EQ(3, map.size());
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_ErasingWhileIteratingVisitsEveryElement)
+    {
+        AZStd::flat_hash_map<int, int> map;
+        for (int i = 0; i < 1000; ++i)
+        {
+            map.emplace(i, i);
+        }
+
+        EXPECT_EQ(500, AZStd::erase_if(map, [](const auto& element) { return element.first % 2 == 0; }));
+        EXPECT_EQ(500, map.size());
+        for (int i = 0; i < 1000; ++i)
+        {
+            EXPECT_EQ(i % 2 == 1, map.contains(i));
+        }
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_CollidingHashesMatchUnorderedMap)
+    {
+        AZStd::flat_hash_map<int, int, CollidingHash> map;
+        AZStd::unordered_map<int, int> expected;
+        // Interleaves insertions and erasures so lookups have to probe past the tombstones of erased elements.
+        for (int i = 0; i < 5000; ++i)
+        {
+            const int key = (i * 7919) % 211;
+            if (i % 3 == 2)
+            {
+                EXPECT_EQ(expected.erase(key), map.erase(key));
+            }
+            else
+            {
+                map[key] = i;
+                expected[key] = i;
+            }
+            ASSERT_EQ(expected.size(), map.size());
+        }
+        for (const auto& [key, value] : expected)
+        {
+            auto found = map.find(key);
+            ASSERT_NE(found, map.end());
+            EXPECT_EQ(value, found->second);
+        }
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_ChurnAtConstantSizeDoesNotGrow)
+    {
+        AZStd::flat_hash_map<int, int> map;
+        for (int i = 0; i < 100000; ++i)
+        {
+            map.emplace(i, i);
+            if (i >= 50)
+            {
+                map.erase(i - 50);
+            }
+        }
+        EXPECT_EQ(50, map.size());
+        EXPECT_LE(map.capacity(), 128);
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_ReserveAvoidsRehash)
+    {
+        AZStd::flat_hash_map<int, UnitTestInternal::MyClass> map;
+        map.reserve(200);
+        const size_t capacity = map.capacity();
+        auto first = map.emplace(0, UnitTestInternal::MyClass(0)).first;
+        for (int i = 1; i < 200; ++i)
+        {
+            map.emplace(i, UnitTestInternal::MyClass(i));
+        }
+        EXPECT_EQ(capacity, map.capacity());
+        EXPECT_EQ(UnitTestInternal::MyClass(0), first->second);
+
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(capacity, map.capacity());
+        map.rehash(0);
+        EXPECT_EQ(0, map.capacity());
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_CopyMoveAndCompare)
+    {
+        AZStd::flat_hash_map<int, AZStd::string> map{ { 1, "a" }, { 2, "b" }, { 3, "c" } };
+
+        AZStd::flat_hash_map<int, AZStd::string> copy(map);
+        EXPECT_EQ(map, copy);
+        copy[3] = "d";
+        EXPECT_NE(map, copy);
+
+        AZStd::flat_hash_map<int, AZStd::string> moved(AZStd::move(copy));
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ("d", moved[3]);
+
+        // Equal content inserted in a different order still compares equal.
+        AZStd::flat_hash_map<int, AZStd::string> reordered{ { 3, "c" }, { 1, "a" }, { 2, "b" } };
+        EXPECT_EQ(map, reordered);
+
+        moved.swap(map);
+        EXPECT_EQ("d", map[3]);
+        EXPECT_EQ("c", moved[3]);
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashMap_MoveOnlyValue)
+    {
+        AZStd::flat_hash_map<int, UnitTestInternal::MyNoCopyClass> map;
+        for (int i = 0; i < 64; ++i)
+        {
+            map.try_emplace(i, i, true, 1.0f);
+        }
+        EXPECT_EQ(64, map.size());
+        EXPECT_EQ(10, map.at(10).m_int);
+    }
+
+    TEST_F(FlatHashedContainers, FlatHashSet_InsertFindErase)
+    {
+        AZStd::flat_hash_set<AZStd::string> set{ "a", "b", "b", "c" };
+        EXPECT_EQ(3, set.size());
+        EXPECT_FALSE(set.insert("a").second);
+        EXPECT_TRUE(set.emplace("d").second);
+        EXPECT_TRUE(set.contains("d"));
+        EXPECT_EQ(1, set.erase("a"));
+        EXPECT_FALSE(set.contains("a"));
+
+        AZStd::flat_hash_set<AZStd::string> expected{ "d", "c", "b" };
+        EXPECT_EQ(expected, set);
+    }
+} // namespace UnitTest
@@ -8,6 +8,7 @@
 #include "UserTypes.h"
 #include <AzCore/std/hash_table.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/flat_hash_map.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
@@ -2333,6 +2334,30 @@ namespace UnitTest
         Benchmark_Thrash<AZStd::unordered_map>(state);
     }
     BENCHMARK(Benchmark_UnorderedMapThrash);
+
+    void Benchmark_FlatHashMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapLookup);
+
+    void Benchmark_FlatHashMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapInsert);
+
+    void Benchmark_FlatHashMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapErase);
+
+    void Benchmark_FlatHashMapThrash(benchmark::State& state)
+    {
+        Benchmark_Thrash<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapThrash);
 #endif
 } // namespace UnitTest
 
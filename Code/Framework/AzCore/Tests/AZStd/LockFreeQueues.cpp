@@ -11,6 +11,10 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/containers/lock_free_queue.h>
 #include <AzCore/std/parallel/containers/lock_free_stamped_queue.h>
+#include <AzCore/std/parallel/containers/mpmc_queue.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Threading/ThreadSafeDeque.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -222,4 +226,261 @@ namespace UnitTest
             AZ_TEST_ASSERT(queue.empty());
         }
     }
+
+    class MpmcQueue
+        : public LeakDetectionFixture
+    {
+    protected:
+        static constexpr int ProducerCount = 4;
+        static constexpr int ConsumerCount = 4;
+#ifdef _DEBUG
+        static constexpr int ValuesPerProducer = 5000;
+#else
+        static constexpr int ValuesPerProducer = 50000;
+#endif
+        static constexpr int TotalValueCount = ProducerCount * ValuesPerProducer;
+
+        //! Pushes ValuesPerProducer values from each producer thread, encoded as producer * ValuesPerProducer + index,
+        //! and checks that every value is popped once and in the order it was pushed by its producer.
+        template<class PushFunction, class PopBatchFunction>
+        void RunProducersAndConsumers(PushFunction push, PopBatchFunction popBatch)
+        {
+            AZStd::unique_ptr<atomic<int>[]> popCounts(new atomic<int>[TotalValueCount]);
+            for (int i = 0; i < TotalValueCount; ++i)
+            {
+                popCounts[i] = 0;
+            }
+            atomic<int> poppedCount{ 0 };
+            atomic<int> outOfOrderCount{ 0 };
+
+            AZStd::vector<AZStd::thread> threads;
+            for (int producer = 0; producer < ProducerCount; ++producer)
+            {
+                threads.emplace_back([producer, &push]()
+                {
+                    for (int i = 0; i < ValuesPerProducer; ++i)
+                    {
+                        push(producer * ValuesPerProducer + i);
+                    }
+                });
+            }
+            for (int consumer = 0; consumer < ConsumerCount; ++consumer)
+            {
+                threads.emplace_back([consumer, &popBatch, &popCounts, &poppedCount, &outOfOrderCount]()
+                {
+                    int lastPopped[ProducerCount];
+                    AZStd::fill(AZStd::begin(lastPopped), AZStd::end(lastPopped), -1);
+                    int values[8];
+                    while (poppedCount < TotalValueCount)
+                    {
+                        // Half of the consumers pop in batches
+                        const size_t count = popBatch(values, (consumer % 2) ? AZ_ARRAY_SIZE(values) : 1);
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            const int producer = values[i] / ValuesPerProducer;
+                            const int index = values[i] % ValuesPerProducer;
+                            if (index <= lastPopped[producer])
+                            {
+                                ++outOfOrderCount;
+                            }
+                            lastPopped[producer] = index;
+                            ++popCounts[values[i]];
+                        }
+                        poppedCount += static_cast<int>(count);
+                    }
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            EXPECT_EQ(TotalValueCount, poppedCount);
+            EXPECT_EQ(0, outOfOrderCount);
+            for (int i = 0; i < TotalValueCount; ++i)
+            {
+                ASSERT_EQ(1, popCounts[i]);
+            }
+        }
+    };
+
+    TEST_F(MpmcQueue, BoundedQueue_PushAndPop_RespectsCapacity)
+    {
+        mpmc_bounded_queue<int> queue(3);
+        EXPECT_EQ(4u, queue.capacity());
+        EXPECT_TRUE(queue.empty_approx());
+
+        int result = 0;
+        EXPECT_FALSE(queue.try_pop(result));
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.try_push(i));
+        }
+        EXPECT_FALSE(queue.try_push(4));
+        EXPECT_EQ(4u, queue.size_approx());
+
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.try_pop(result));
+            EXPECT_EQ(i, result);
+        }
+        EXPECT_FALSE(queue.try_pop(result));
+        EXPECT_TRUE(queue.empty_approx());
+    }
+
+    TEST_F(MpmcQueue, BoundedQueue_Batches_PushAndPopInOrderUpToCapacity)
+    {
+        mpmc_bounded_queue<int> queue(4);
+        const int values[] = { 1, 2, 3, 4, 5, 6 };
+        const int* pushedEnd = queue.try_push_batch(AZStd::begin(values), AZStd::end(values));
+        EXPECT_EQ(values + 4, pushedEnd);
+
+        int results[6] = {};
+        EXPECT_EQ(3u, queue.try_pop_batch(results, 3));
+        EXPECT_EQ(1, results[0]);
+        EXPECT_EQ(3, results[2]);
+
+        // Wraps around the end of the cells
+        EXPECT_EQ(values + 6, queue.try_push_batch(pushedEnd, AZStd::end(values)));
+        EXPECT_EQ(3u, queue.try_pop_batch(results, 6));
+        EXPECT_EQ(4, results[0]);
+        EXPECT_EQ(5, results[1]);
+        EXPECT_EQ(6, results[2]);
+        EXPECT_TRUE(queue.empty_approx());
+    }
+
+    TEST_F(MpmcQueue, BoundedQueue_NonTrivialValues_AreDestroyed)
+    {
+        AZStd::shared_ptr<int> value = AZStd::make_shared<int>(10);
+        {
+            mpmc_bounded_queue<AZStd::shared_ptr<int>> queue(4);
+            queue.try_push(value);
+            queue.try_push(value);
+            EXPECT_EQ(3, value.use_count());
+
+            AZStd::shared_ptr<int> result;
+            EXPECT_TRUE(queue.try_pop(result));
+            EXPECT_EQ(3, value.use_count());
+            result.reset();
+            EXPECT_EQ(2, value.use_count());
+        }
+        EXPECT_EQ(1, value.use_count());
+    }
+
+    TEST_F(MpmcQueue, UnboundedQueue_PushPastCapacity_PopsAllInOrder)
+    {
+        mpmc_queue<int> queue(4);
+        for (int i = 0; i < 10; ++i)
+        {
+            queue.push(i);
+        }
+        const int values[] = { 10, 11, 12 };
+        queue.push_batch(AZStd::begin(values), AZStd::end(values));
+        EXPECT_EQ(13u, queue.size_approx());
+
+        int results[13] = {};
+        EXPECT_EQ(13u, queue.try_pop_batch(results, 13));
+        for (int i = 0; i < 13; ++i)
+        {
+            EXPECT_EQ(i, results[i]);
+        }
+        EXPECT_TRUE(queue.empty_approx());
+
+        // Values go through the bounded queue again once the overflow is empty
+        queue.push(13);
+        EXPECT_TRUE(queue.try_pop(results[0]));
+        EXPECT_EQ(13, results[0]);
+    }
+
+    TEST_F(MpmcQueue, BoundedQueue_ConcurrentProducersAndConsumers_PopAllValuesInProducerOrder)
+    {
+        mpmc_bounded_queue<int> queue(64);
+        RunProducersAndConsumers(
+            [&queue](int value)
+            {
+                while (!queue.try_push(value))
+                {
+                    AZStd::this_thread::yield();
+                }
+            },
+            [&queue](int* values, size_t maxCount)
+            {
+                return queue.try_pop_batch(values, maxCount);
+            });
+        EXPECT_TRUE(queue.empty_approx());
+    }
+
+    TEST_F(MpmcQueue, UnboundedQueue_ConcurrentProducersAndConsumers_PopAllValuesInProducerOrder)
+    {
+        // A small capacity to go through the overflow often
+        mpmc_queue<int> queue(16);
+        RunProducersAndConsumers(
+            [&queue](int value)
+            {
+                queue.push(value);
+            },
+            [&queue](int* values, size_t maxCount)
+            {
+                return queue.try_pop_batch(values, maxCount);
+            });
+        EXPECT_TRUE(queue.empty_approx());
+    }
 }
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Every thread pushes a value and pops one, so all threads contend on the queue
+    static void BM_ThreadSafeDeque_PushPop(benchmark::State& state)
+    {
+        static AZ::ThreadSafeDeque<int> queue;
+        int value = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            queue.PushBackItem(value);
+            queue.PopFrontItem(value);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_ThreadSafeDeque_PushPop)->ThreadRange(1, AZStd::thread::hardware_concurrency());
+
+    static void BM_MpmcBoundedQueue_PushPop(benchmark::State& state)
+    {
+        static AZStd::mpmc_bounded_queue<int> queue(1024);
+        int value = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            queue.try_push(value);
+            queue.try_pop(value);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_MpmcBoundedQueue_PushPop)->ThreadRange(1, AZStd::thread::hardware_concurrency());
+
+    static void BM_MpmcQueue_PushPop(benchmark::State& state)
+    {
+        static AZStd::mpmc_queue<int> queue;
+        int value = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            queue.push(value);
+            queue.try_pop(value);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_MpmcQueue_PushPop)->ThreadRange(1, AZStd::thread::hardware_concurrency());
+
+    static void BM_MpmcQueue_PushPopBatch(benchmark::State& state)
+    {
+        static AZStd::mpmc_queue<int> queue;
+        int values[16] = {};
+        for ([[maybe_unused]] auto _ : state)
+        {
+            queue.push_batch(AZStd::begin(values), AZStd::end(values));
+            queue.try_pop_batch(values, AZ_ARRAY_SIZE(values));
+        }
+        state.SetItemsProcessed(state.iterations() * AZ_ARRAY_SIZE(values));
+    }
+    BENCHMARK(BM_MpmcQueue_PushPopBatch)->ThreadRange(1, AZStd::thread::hardware_concurrency());
+}
+#endif
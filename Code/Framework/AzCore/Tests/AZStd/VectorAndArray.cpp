@@ -12,6 +12,7 @@
 #include <AzCore/std/containers/bitset.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/small_vector.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/ranges/subrange.h>
@@ -1177,4 +1178,58 @@ namespace UnitTest
         testVec.append_range(testView | AZStd::views::transform([](const char elem) -> char { return elem + 3; }));
         EXPECT_THAT(testVec, ::testing::ElementsAre('a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i'));
     }
+
+    TEST_F(Arrays, SmallVector_StaysInlineUpToInlineCapacity)
+    {
+        AZStd::small_vector<int, 4> testVec{ 1, 2, 3 };
+        EXPECT_TRUE(testVec.is_inline());
+        EXPECT_EQ(4, testVec.capacity());
+        testVec.push_back(4);
+        EXPECT_TRUE(testVec.is_inline());
+
+        testVec.push_back(5);
+        EXPECT_FALSE(testVec.is_inline());
+        EXPECT_THAT(testVec, ::testing::ElementsAre(1, 2, 3, 4, 5));
+
+        testVec.erase(testVec.begin(), testVec.begin() + 2);
+        testVec.shrink_to_fit();
+        EXPECT_TRUE(testVec.is_inline());
+        EXPECT_THAT(testVec, ::testing::ElementsAre(3, 4, 5));
+    }
+
+    TEST_F(Arrays, SmallVector_InsertAndEraseNonTrivialElements)
+    {
+        AZStd::small_vector<AZStd::string, 2> testVec;
+        testVec.emplace_back("b");
+        testVec.insert(testVec.begin(), "a");
+        testVec.insert(testVec.end(), 3, "c");
+        EXPECT_THAT(testVec, ::testing::ElementsAre("a", "b", "c", "c", "c"));
+
+        testVec.erase(testVec.begin() + 1);
+        testVec.resize(2);
+        EXPECT_THAT(testVec, ::testing::ElementsAre("a", "c"));
+        testVec.clear();
+        EXPECT_TRUE(testVec.empty());
+    }
+
+    TEST_F(Arrays, SmallVector_CopyMoveAndSwapBetweenInlineAndHeapStorage)
+    {
+        AZStd::small_vector<UnitTestInternal::MyClass, 2> inlineVec(2, UnitTestInternal::MyClass(1));
+        AZStd::small_vector<UnitTestInternal::MyClass, 2> heapVec(5, UnitTestInternal::MyClass(2));
+
+        AZStd::small_vector<UnitTestInternal::MyClass, 2> copy = heapVec;
+        EXPECT_EQ(copy, heapVec);
+
+        const UnitTestInternal::MyClass* heapData = heapVec.data();
+        AZStd::small_vector<UnitTestInternal::MyClass, 2> moved = AZStd::move(heapVec);
+        EXPECT_EQ(heapData, moved.data());
+        EXPECT_TRUE(heapVec.empty());
+
+        moved.swap(inlineVec);
+        EXPECT_EQ(2, moved.size());
+        EXPECT_TRUE(moved.is_inline());
+        EXPECT_EQ(5, inlineVec.size());
+        EXPECT_EQ(heapData, inlineVec.data());
+        EXPECT_EQ(UnitTestInternal::MyClass(2), inlineVec.back());
+    }
 }
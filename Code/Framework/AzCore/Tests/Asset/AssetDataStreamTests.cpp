@@ -6,8 +6,11 @@
  *
  */
 #include <AzCore/Asset/AssetDataStream.h>
+#include <AzCore/IO/MappedFile.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
 #include <AZTestShared/Utils/Utils.h>
 #include <Tests/Streamer/IStreamerMock.h>
 
@@ -236,6 +239,102 @@ TEST_F(AssetDataStreamTest, Open_OpenAndReadFile_FileReadSuccessfully)
     assetDataStream.Close();
 }
 
+TEST_F(AssetDataStreamTest, Open_OpenFilesInRequestBatch_ReadsQueuedTogetherWhenBatchEnds)
+{
+    using ::testing::_;
+
+    constexpr size_t assetSize = 500;
+    size_t callbackCount = 0;
+    auto loadCallback = [&callbackCount]([[maybe_unused]] AZ::IO::IStreamerTypes::RequestStatus status)
+    {
+        ++callbackCount;
+    };
+
+    AZ::Data::AssetDataStream firstStream;
+    AZ::Data::AssetDataStream secondStream;
+
+    EXPECT_CALL(m_mockStreamer, QueueRequest(_)).Times(0);
+    EXPECT_CALL(m_mockStreamer, QueueRequestBatch(::testing::An<AZStd::vector<FileRequestPtr>&&>()))
+        .WillOnce([](AZStd::vector<FileRequestPtr>&& requests)
+            {
+                EXPECT_EQ(2, requests.size());
+            });
+    {
+        AZ::Data::AssetDataStream::StreamerRequestBatch batch;
+        {
+            // Nested batches add their reads to the outermost batch.
+            AZ::Data::AssetDataStream::StreamerRequestBatch nestedBatch;
+            firstStream.Open("path/first", 0, assetSize, AZ::IO::IStreamerTypes::s_noDeadline,
+                AZ::IO::IStreamerTypes::s_priorityMedium, loadCallback);
+        }
+        secondStream.Open("path/second", 0, assetSize, AZ::IO::IStreamerTypes::s_noDeadline,
+            AZ::IO::IStreamerTypes::s_priorityMedium, loadCallback);
+    }
+
+    // The mock streamer doesn't complete batched requests, so nothing should have been called back.
+    EXPECT_EQ(0, callbackCount);
+}
+
+class MappedFileProviderMock
+    : public AZ::IO::IMappedFileProvider
+{
+public:
+    AZ::IO::MappedFileView MapFile([[maybe_unused]] AZ::IO::PathView filePath) override
+    {
+        AZ::IO::MappedFileView view;
+        if (m_file)
+        {
+            view.m_file = m_file;
+            view.m_data = AZStd::span<const AZ::u8>(m_file->GetData(), m_file->GetSize());
+        }
+        return view;
+    }
+
+    AZStd::shared_ptr<AZ::IO::MappedFile> m_file;
+};
+
+TEST_F(AssetDataStreamTest, Open_OpenFileFromMappedArchive_DataUsedFromMappingWithoutStreamer)
+{
+    constexpr size_t fileOffset = 64;
+    constexpr size_t assetSize = 500;
+
+    AZ::Test::ScopedAutoTempDirectory tempDirectory;
+    AZStd::vector<AZ::u8> fileContents(fileOffset + assetSize, m_expectedBufferChar);
+    auto archivePath = AZ::Test::CreateTestFile(tempDirectory, "archive.pak",
+        AZStd::span<const AZStd::byte>(reinterpret_cast<const AZStd::byte*>(fileContents.data()), fileContents.size()));
+    ASSERT_TRUE(archivePath.has_value());
+
+    MappedFileProviderMock provider;
+    provider.m_file = AZStd::make_shared<AZ::IO::MappedFile>();
+    ASSERT_TRUE(provider.m_file->Open(archivePath->c_str()));
+    AZ::Interface<AZ::IO::IMappedFileProvider>::Register(&provider);
+
+    EXPECT_CALL(m_mockStreamer, QueueRequest(::testing::_)).Times(0);
+
+    bool callbackCalled = false;
+    AZ::Data::AssetDataStream assetDataStream;
+    assetDataStream.Open("path/test", fileOffset, assetSize, AZ::IO::IStreamerTypes::s_noDeadline,
+        AZ::IO::IStreamerTypes::s_priorityMedium, [&callbackCalled](AZ::IO::IStreamerTypes::RequestStatus status)
+        {
+            callbackCalled = true;
+            EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, status);
+        });
+    assetDataStream.BlockUntilLoadComplete();
+
+    EXPECT_TRUE(callbackCalled);
+    EXPECT_TRUE(assetDataStream.IsFullyLoaded());
+    EXPECT_TRUE(assetDataStream.IsMemoryMapped());
+    EXPECT_EQ(provider.m_file->GetData() + fileOffset, assetDataStream.GetLoadedData().data());
+    EXPECT_EQ(assetSize, assetDataStream.GetLoadedData().size());
+
+    AZStd::vector<AZ::u8> outBuffer(assetSize, m_badBufferChar);
+    EXPECT_EQ(assetSize, assetDataStream.Read(outBuffer.size(), outBuffer.data()));
+    EXPECT_EQ(AZStd::vector<AZ::u8>(assetSize, m_expectedBufferChar), outBuffer);
+
+    assetDataStream.Close();
+    AZ::Interface<AZ::IO::IMappedFileProvider>::Unregister(&provider);
+}
+
 TEST_F(AssetDataStreamTest, IsOpen_OpenAndCloseStream_OnlyTrueWhileOpen)
 {
     // Pick an arbitrary buffer size
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/Component/ComponentDataStorage.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    struct MovementData
+    {
+        MovementData() = default;
+        MovementData(float position, float velocity)
+            : m_position(position)
+            , m_velocity(velocity)
+        {
+        }
+
+        float m_position = 0.0f;
+        float m_velocity = 0.0f;
+    };
+
+    class ComponentDataStorageTests
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(ComponentDataStorageTests, Insert_DataCanBeFoundByEntity)
+    {
+        AZ::ComponentDataStorage<MovementData> storage;
+        storage.Insert(AZ::EntityId(1), 1.0f, 2.0f);
+        storage.Insert(AZ::EntityId(2), 3.0f, 4.0f);
+
+        EXPECT_EQ(storage.GetSize(), 2);
+        ASSERT_NE(storage.Find(AZ::EntityId(2)), nullptr);
+        EXPECT_FLOAT_EQ(storage.Find(AZ::EntityId(2))->m_position, 3.0f);
+        EXPECT_EQ(storage.Find(AZ::EntityId(3)), nullptr);
+    }
+
+    TEST_F(ComponentDataStorageTests, Remove_LastElementMovesIntoFreedSlot)
+    {
+        AZ::ComponentDataStorage<MovementData> storage;
+        storage.Insert(AZ::EntityId(1), 1.0f, 0.0f);
+        storage.Insert(AZ::EntityId(2), 2.0f, 0.0f);
+        storage.Insert(AZ::EntityId(3), 3.0f, 0.0f);
+
+        EXPECT_TRUE(storage.Remove(AZ::EntityId(1)));
+        EXPECT_FALSE(storage.Remove(AZ::EntityId(1)));
+
+        ASSERT_EQ(storage.GetSize(), 2);
+        EXPECT_EQ(storage.GetEntityIds()[0], AZ::EntityId(3));
+        EXPECT_FLOAT_EQ(storage.GetData()[0].m_position, 3.0f);
+        ASSERT_NE(storage.Find(AZ::EntityId(3)), nullptr);
+        EXPECT_FLOAT_EQ(storage.Find(AZ::EntityId(3))->m_position, 3.0f);
+        EXPECT_EQ(storage.Find(AZ::EntityId(1)), nullptr);
+    }
+
+    TEST_F(ComponentDataStorageTests, ForEach_VisitsEveryEntityOnce)
+    {
+        AZ::ComponentDataStorage<MovementData> storage;
+        for (AZ::u64 id = 1; id <= 10; ++id)
+        {
+            storage.Insert(AZ::EntityId(id), 0.0f, static_cast<float>(id));
+        }
+        storage.Remove(AZ::EntityId(5));
+
+        size_t visitCount = 0;
+        storage.ForEach(
+            [&visitCount](AZ::EntityId entityId, MovementData& data)
+            {
+                EXPECT_NE(entityId, AZ::EntityId(5));
+                data.m_position += data.m_velocity;
+                ++visitCount;
+            });
+
+        EXPECT_EQ(visitCount, 9);
+        EXPECT_FLOAT_EQ(storage.Find(AZ::EntityId(10))->m_position, 10.0f);
+    }
+} // namespace UnitTest
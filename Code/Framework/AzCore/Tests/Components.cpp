@@ -724,6 +724,30 @@ namespace UnitTest
         EXPECT_TRUE(components[4]->RTTI_IsTypeOf(AzTypeInfo<ComponentC>::Uuid()));
     }
 
+    TEST_F(ComponentDependency, ActivateEntities_ActivatesAllEntitiesWithSortedComponents)
+    {
+        CreateComponents_ABCDE();
+        m_entity->Init();
+
+        Entity otherEntity;
+        otherEntity.CreateComponent<ComponentC>();
+        otherEntity.CreateComponent<ComponentB>();
+        otherEntity.Init();
+
+        Entity* entities[] = { m_entity, &otherEntity };
+        Entity::ActivateEntities(entities);
+
+        EXPECT_EQ(Entity::State::Active, m_entity->GetState());
+        EXPECT_EQ(Entity::State::Active, otherEntity.GetState());
+
+        const Entity::ComponentArrayType& components = m_entity->GetComponents();
+        EXPECT_TRUE(components[0]->RTTI_IsTypeOf(AzTypeInfo<ComponentA>::Uuid()));
+        EXPECT_TRUE(components[4]->RTTI_IsTypeOf(AzTypeInfo<ComponentC>::Uuid()));
+        EXPECT_TRUE(otherEntity.GetComponents()[0]->RTTI_IsTypeOf(AzTypeInfo<ComponentB>::Uuid()));
+
+        otherEntity.Deactivate();
+    }
+
     TEST_F(ComponentDependency, Deactivate_DoesNotChangeComponentOrder)
     {
         CreateComponents_ABCDE();
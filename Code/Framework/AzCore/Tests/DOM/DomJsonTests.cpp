@@ -215,4 +215,34 @@ namespace AZ::Dom::Tests
             CreateString("long_string"), CreateString("abcdefghijklmnopqrstuvwxyz0123456789"), m_document->GetAllocator());
         PerformSerializationChecks();
     }
+
+    TEST_F(DomJsonTests, SerializedStringToValueAtPath_MatchesValueOfFullDocument)
+    {
+        constexpr AZStd::string_view serializedDocument =
+            R"({"skipped": {"nested": [1, 2, 3]}, "entities": [{"name": "first"}, {"name": "second", "ids": [4, 5]}], "version": 2})";
+
+        JsonBackend backend;
+        auto fullDocument = Dom::Utils::SerializedStringToValue(backend, serializedDocument, Lifetime::Temporary);
+        ASSERT_TRUE(fullDocument.IsSuccess());
+
+        for (const char* pathString : { "", "/entities", "/entities/1", "/entities/1/ids/0", "/entities/0/name", "/version" })
+        {
+            const Path path(pathString);
+            auto valueAtPath = Dom::Utils::SerializedStringToValueAtPath(backend, serializedDocument, path, Lifetime::Temporary);
+            ASSERT_TRUE(valueAtPath.IsSuccess()) << pathString << ": " << valueAtPath.GetError().c_str();
+            EXPECT_TRUE(Dom::Utils::DeepCompareIsEqual(fullDocument.GetValue()[path], valueAtPath.GetValue())) << pathString;
+        }
+    }
+
+    TEST_F(DomJsonTests, SerializedStringToValueAtPath_MissingPath_Fails)
+    {
+        constexpr AZStd::string_view serializedDocument = R"({"entities": [{"name": "first"}], "version": 2})";
+
+        JsonBackend backend;
+        for (const char* pathString : { "/missing", "/entities/1", "/entities/0/name/0", "/version/name" })
+        {
+            EXPECT_FALSE(Dom::Utils::SerializedStringToValueAtPath(backend, serializedDocument, Path(pathString), Lifetime::Temporary))
+                << pathString;
+        }
+    }
 } // namespace AZ::Dom::Tests
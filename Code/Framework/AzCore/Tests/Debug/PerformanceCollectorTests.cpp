@@ -187,6 +187,43 @@ namespace UnitTest
         }
     }
 
+    TEST_F(PerformanceCollectorTest, CreatePerformanceCollector_CollectPerformance_ValidatePercentiles)
+    {
+        constexpr AZStd::string_view PerfParam("param1");
+        constexpr AZ::u32 frameCountPerCaptureBatch = 100;
+
+        auto paramList = AZStd::to_array<AZStd::string_view>({ PerfParam });
+        AZ::Debug::PerformanceCollector performanceCollector("PerformanceCollectorTest", paramList, [](AZ::u32) {});
+        performanceCollector.UpdateDataLogType(AZ::Debug::PerformanceCollector::DataLogType::LogStatistics);
+        performanceCollector.UpdateFrameCountPerCaptureBatch(frameCountPerCaptureBatch);
+        performanceCollector.UpdateWaitTimeBeforeEachBatch(AZStd::chrono::seconds(0));
+        performanceCollector.UpdateNumberOfCaptureBatches(1);
+
+        // Records the durations 100us down to 1us, the percentiles must not depend on the order of the samples.
+        for (AZ::u32 frame = 0; frame < frameCountPerCaptureBatch; ++frame)
+        {
+            performanceCollector.FrameTick();
+            performanceCollector.RecordSample(PerfParam, AZStd::chrono::microseconds(frameCountPerCaptureBatch - frame));
+        }
+        // Completes the batch.
+        performanceCollector.FrameTick();
+
+        rapidjson::Document jsonDoc;
+        jsonDoc.Parse(performanceCollector.GetOutputDataBuffer().c_str());
+        ASSERT_FALSE(jsonDoc.HasParseError());
+        ASSERT_TRUE(jsonDoc.IsArray());
+        ASSERT_EQ(jsonDoc.Size(), 1);
+
+        auto argsObj = jsonDoc[0]["args"].GetObject();
+        ASSERT_TRUE(argsObj.HasMember(AZ::Debug::PerformanceCollector::P50.data()));
+        ASSERT_TRUE(argsObj.HasMember(AZ::Debug::PerformanceCollector::P90.data()));
+        ASSERT_TRUE(argsObj.HasMember(AZ::Debug::PerformanceCollector::P99.data()));
+        EXPECT_DOUBLE_EQ(argsObj[AZ::Debug::PerformanceCollector::P50.data()].GetDouble(), 50.0);
+        EXPECT_DOUBLE_EQ(argsObj[AZ::Debug::PerformanceCollector::P90.data()].GetDouble(), 90.0);
+        EXPECT_DOUBLE_EQ(argsObj[AZ::Debug::PerformanceCollector::P99.data()].GetDouble(), 99.0);
+        EXPECT_EQ(argsObj[AZ::Debug::PerformanceCollector::SAMPLE_COUNT.data()].GetUint(), frameCountPerCaptureBatch);
+    }
+
     TEST_F(PerformanceCollectorTest, CreatePerformnaceCollector_WithDefaultFileExtension_ValidateFileExtension)
     {
         auto paramList = AZStd::to_array<AZStd::string_view>({ "param1" });
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/OrderedEvent.h>
+#include <AzCore/EBus/ParallelDispatch.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <gtest/gtest.h>
+
+namespace UnitTest
+{
+    // Ordered bus whose handlers share an order in groups, so that parallel dispatch has both concurrent
+    // handlers and an ordering to preserve.
+    class ParallelDispatchNotifications : public AZ::EBusTraits
+    {
+    public:
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::MultipleAndOrdered;
+        using MutexType = AZStd::recursive_mutex;
+        static constexpr bool EnableParallelDispatch = true;
+        static constexpr size_t ParallelDispatchBatchSize = 4;
+
+        struct BusHandlerOrderCompare
+        {
+            bool operator()(ParallelDispatchNotifications* left, ParallelDispatchNotifications* right) const
+            {
+                return left->GetOrder() < right->GetOrder();
+            }
+        };
+
+        virtual int GetOrder() const = 0;
+        virtual void OnNotify(int value) = 0;
+    };
+    using ParallelDispatchNotificationBus = AZ::EBus<ParallelDispatchNotifications>;
+
+    class ParallelDispatchHandler : public ParallelDispatchNotificationBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ParallelDispatchHandler, AZ::SystemAllocator);
+
+        ParallelDispatchHandler(int order, AZStd::atomic_int& completedOrders)
+            : m_order(order)
+            , m_completedOrders(completedOrders)
+        {
+            BusConnect();
+        }
+
+        ~ParallelDispatchHandler() override
+        {
+            BusDisconnect();
+        }
+
+        int GetOrder() const override
+        {
+            return m_order;
+        }
+
+        void OnNotify(int value) override
+        {
+            // Every handler of the previous orders must have been notified already
+            m_completedBefore = m_completedOrders.load() == m_order * HandlersPerOrder;
+            m_value = value;
+            m_completedOrders.fetch_add(1);
+        }
+
+        static constexpr int HandlersPerOrder = 32;
+
+        int m_order;
+        int m_value = 0;
+        bool m_completedBefore = false;
+        AZStd::atomic_int& m_completedOrders;
+    };
+
+    class ParallelDispatchTests : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_executor = aznew AZ::TaskExecutor(4);
+        }
+
+        void TearDown() override
+        {
+            azdestroy(m_executor);
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        AZ::TaskExecutor* m_executor = nullptr;
+    };
+
+    TEST_F(ParallelDispatchTests, ParallelBroadcast_OrderedHandlers_GroupsDispatchedInOrder)
+    {
+        constexpr int NumOrders = 4;
+        AZStd::atomic_int completedOrders{ 0 };
+        AZStd::vector<AZStd::unique_ptr<ParallelDispatchHandler>> handlers;
+        for (int i = 0; i < ParallelDispatchHandler::HandlersPerOrder; ++i)
+        {
+            // Connect out of order, the bus sorts the handlers
+            for (int order = NumOrders - 1; order >= 0; --order)
+            {
+                handlers.emplace_back(AZStd::make_unique<ParallelDispatchHandler>(order, completedOrders));
+            }
+        }
+
+        AZ::ParallelBroadcastOnExecutor<ParallelDispatchNotificationBus>(m_executor, &ParallelDispatchNotifications::OnNotify, 7);
+
+        EXPECT_EQ(NumOrders * ParallelDispatchHandler::HandlersPerOrder, completedOrders.load());
+        for (const auto& handler : handlers)
+        {
+            EXPECT_EQ(7, handler->m_value);
+        }
+
+        // Handlers of an order run concurrently, but only once every handler of the previous orders is done
+        completedOrders = 0;
+        AZ::ParallelBroadcastOnExecutor<ParallelDispatchNotificationBus>(
+            m_executor,
+            [](ParallelDispatchNotifications* handler, int value)
+            {
+                auto* testHandler = static_cast<ParallelDispatchHandler*>(handler);
+                EXPECT_GE(testHandler->m_completedOrders.load(), testHandler->m_order * ParallelDispatchHandler::HandlersPerOrder);
+                EXPECT_LT(testHandler->m_completedOrders.load(), (testHandler->m_order + 1) * ParallelDispatchHandler::HandlersPerOrder);
+                testHandler->m_completedOrders.fetch_add(1);
+                testHandler->m_value = value;
+            },
+            9);
+
+        EXPECT_EQ(NumOrders * ParallelDispatchHandler::HandlersPerOrder, completedOrders.load());
+        for (const auto& handler : handlers)
+        {
+            EXPECT_EQ(9, handler->m_value);
+        }
+    }
+
+    TEST_F(ParallelDispatchTests, ParallelBroadcast_WithoutExecutor_DispatchesInOrderOnCallingThread)
+    {
+        AZStd::atomic_int completedOrders{ 0 };
+        AZStd::vector<AZStd::unique_ptr<ParallelDispatchHandler>> handlers;
+        for (int order = 0; order < 3; ++order)
+        {
+            for (int i = 0; i < ParallelDispatchHandler::HandlersPerOrder; ++i)
+            {
+                handlers.emplace_back(AZStd::make_unique<ParallelDispatchHandler>(order, completedOrders));
+            }
+        }
+
+        const AZStd::thread_id callingThread = AZStd::this_thread::get_id();
+        AZ::ParallelBroadcastOnExecutor<ParallelDispatchNotificationBus>(
+            nullptr,
+            [callingThread](ParallelDispatchNotifications* handler, int value)
+            {
+                EXPECT_EQ(callingThread, AZStd::this_thread::get_id());
+                handler->OnNotify(value);
+            },
+            3);
+
+        for (const auto& handler : handlers)
+        {
+            EXPECT_TRUE(handler->m_completedBefore);
+            EXPECT_EQ(3, handler->m_value);
+        }
+    }
+
+    TEST_F(ParallelDispatchTests, ParallelBroadcast_NoHandlers_DoesNothing)
+    {
+        AZ::ParallelBroadcastOnExecutor<ParallelDispatchNotificationBus>(m_executor, &ParallelDispatchNotifications::OnNotify, 1);
+    }
+
+    TEST_F(ParallelDispatchTests, OrderedEventSignalParallel_HandlersInvokedByPriority)
+    {
+        AZ::OrderedEvent<int32_t> testEvent;
+        AZStd::vector<int32_t> signaledPriorities;
+        AZStd::vector<AZStd::unique_ptr<AZ::OrderedEventHandler<int32_t>>> testHandlers;
+        for (int32_t priority : { 1, 3, 2, 3, 1, 2 })
+        {
+            testHandlers.emplace_back(AZStd::make_unique<AZ::OrderedEventHandler<int32_t>>(
+                [&signaledPriorities, priority](int32_t value)
+                {
+                    signaledPriorities.push_back(priority * value);
+                },
+                priority));
+            testHandlers.back()->Connect(testEvent);
+        }
+
+        // A disconnected handler leaves a hole in the handler list that must be skipped
+        testHandlers[1]->Disconnect();
+
+        // No priority has more handlers than a batch, so the handlers run on this thread
+        testEvent.SignalParallel(2);
+        EXPECT_EQ((AZStd::vector<int32_t>{ 6, 4, 4, 2, 2 }), signaledPriorities);
+    }
+} // namespace UnitTest
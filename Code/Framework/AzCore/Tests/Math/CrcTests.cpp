@@ -61,6 +61,37 @@ namespace Benchmark
     }
 
     BENCHMARK(MeasureCrc32ConstevalTime);
+
+    static void MeasureCrc32RuntimeThroughput(::benchmark::State& state)
+    {
+        static uint8_t buffer[1 << 20];
+        const size_t size = static_cast<size_t>(state.range(0));
+        for (size_t i = 0; i < size; ++i)
+        {
+            buffer[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZ::Crc32(buffer, size, false));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(MeasureCrc32RuntimeThroughput)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+    static void MeasureCrc32LowerCaseRuntimeThroughput(::benchmark::State& state)
+    {
+        // Typical asset path, hashed lower cased as done for names and identifiers
+        constexpr AZStd::string_view path = "Objects/Characters/Jack/Textures/Jack_BaseColor.png.streamingimage";
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(AZ::Crc32(path));
+        }
+        state.SetBytesProcessed(state.iterations() * path.size());
+    }
+
+    BENCHMARK(MeasureCrc32LowerCaseRuntimeThroughput);
 }
 
 #endif
@@ -118,4 +149,43 @@ namespace UnitTest
         EXPECT_EQ(AZ::Crc32(0x4727dc92), constEvalIntValue);
     }
 
+    TEST_F(Crc32Fixture, Set_LongData_MatchesBytewiseCrc)
+    {
+        // Bit at a time CRC-32 to compare the table driven version against
+        auto referenceCrc32 = [](const uint8_t* data, size_t size, bool forceLowerCase)
+        {
+            AZ::u32 crc = 0xffffffff;
+            for (size_t i = 0; i < size; ++i)
+            {
+                uint8_t octet = data[i];
+                if (forceLowerCase && octet >= 'A' && octet <= 'Z')
+                {
+                    octet = static_cast<uint8_t>(octet + 'a' - 'A');
+                }
+                crc ^= octet;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc & 1) ? (crc >> 1) ^ 0xedb88320 : crc >> 1;
+                }
+            }
+            return AZ::Crc32(crc ^ 0xffffffff);
+        };
+
+        AZStd::array<uint8_t, 100> data{};
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i * 37 + 'A');
+        }
+
+        // Covers every remainder of the 8 byte steps, both with and without lower casing
+        for (size_t size = 0; size <= data.size(); ++size)
+        {
+            EXPECT_EQ(referenceCrc32(data.data(), size, false), AZ::Crc32(data.data(), size, false));
+            EXPECT_EQ(referenceCrc32(data.data(), size, true), AZ::Crc32(data.data(), size, true));
+        }
+
+        static_assert(AZ::Crc32("Hello World, This Is A Long String") == AZ::Crc32(0x44f379cc));
+        static_assert(AZ::Crc32("Hello World, This Is A Long String", 34, false) == AZ::Crc32(0x8b99769b));
+    }
+
 }
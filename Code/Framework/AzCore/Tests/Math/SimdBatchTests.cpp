@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdBatch.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+#include <random>
+
+namespace UnitTest
+{
+    // Not a multiple of the batch width, so that both the SIMD path and the scalar tail are exercised
+    constexpr size_t SimdBatchTestCount = 103;
+
+    class MATH_SimdBatch : public LeakDetectionFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<float> unif(-10.0f, 10.0f);
+            for (AZStd::vector<float>* stream : { &m_x, &m_y, &m_z, &m_w })
+            {
+                stream->resize(SimdBatchTestCount);
+                for (float& value : *stream)
+                {
+                    value = unif(rng);
+                }
+            }
+            for (AZStd::vector<float>* stream : { &m_outX, &m_outY, &m_outZ, &m_outW })
+            {
+                stream->resize(SimdBatchTestCount, 0.0f);
+            }
+        }
+
+        void TearDown() override
+        {
+            m_x = m_y = m_z = m_w = {};
+            m_outX = m_outY = m_outZ = m_outW = {};
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZ::SimdBatch::ConstVector3Stream Input() const
+        {
+            return { m_x.data(), m_y.data(), m_z.data() };
+        }
+
+        AZ::SimdBatch::Vector3Stream Output()
+        {
+            return { m_outX.data(), m_outY.data(), m_outZ.data() };
+        }
+
+        AZ::Vector3 GetInput(size_t index) const
+        {
+            return AZ::Vector3(m_x[index], m_y[index], m_z[index]);
+        }
+
+        AZ::Vector3 GetOutput(size_t index) const
+        {
+            return AZ::Vector3(m_outX[index], m_outY[index], m_outZ[index]);
+        }
+
+        AZStd::vector<float> m_x, m_y, m_z, m_w;
+        AZStd::vector<float> m_outX, m_outY, m_outZ, m_outW;
+    };
+
+    TEST_F(MATH_SimdBatch, TransformPoints_MatchesTransformPoint)
+    {
+        AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationZ(0.7f) * AZ::Quaternion::CreateRotationX(0.3f), AZ::Vector3(1.0f, 2.0f, 3.0f));
+        transform.MultiplyByUniformScale(2.5f);
+
+        AZ::SimdBatch::TransformPoints(transform, Input(), Output(), SimdBatchTestCount);
+
+        for (size_t i = 0; i < SimdBatchTestCount; ++i)
+        {
+            EXPECT_THAT(GetOutput(i), IsCloseTolerance(transform.TransformPoint(GetInput(i)), 1e-4f));
+        }
+    }
+
+    TEST_F(MATH_SimdBatch, TransformPoints_InPlace_MatchesTransformPoint)
+    {
+        const AZ::Transform transform =
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationY(1.2f), AZ::Vector3(-4.0f, 0.5f, 8.0f));
+        AZStd::vector<AZ::Vector3> expected;
+        for (size_t i = 0; i < SimdBatchTestCount; ++i)
+        {
+            expected.push_back(transform.TransformPoint(GetInput(i)));
+        }
+
+        AZ::SimdBatch::TransformPoints(transform, Input(), { m_x.data(), m_y.data(), m_z.data() }, SimdBatchTestCount);
+
+        for (size_t i = 0; i < SimdBatchTestCount; ++i)
+        {
+            EXPECT_THAT(GetInput(i), IsCloseTolerance(expected[i], 1e-4f));
+        }
+    }
+
+    TEST_F(MATH_SimdBatch, MultiplyQuaternions_MatchesQuaternionMultiply)
+    {
+        // Multiply each quaternion by the quaternion built from the same components in reverse order
+        AZ::SimdBatch::MultiplyQuaternions(
+            { m_x.data(), m_y.data(), m_z.data(), m_w.data() },
+            { m_w.data(), m_z.data(), m_y.data(), m_x.data() },
+            { m_outX.data(), m_outY.data(), m_outZ.data(), m_outW.data() },
+            SimdBatchTestCount);
+
+        for (size_t i = 0; i < SimdBatchTestCount; ++i)
+        {
+            const AZ::Quaternion expected =
+                AZ::Quaternion(m_x[i], m_y[i], m_z[i], m_w[i]) * AZ::Quaternion(m_w[i], m_z[i], m_y[i], m_x[i]);
+            EXPECT_THAT(AZ::Quaternion(m_outX[i], m_outY[i], m_outZ[i], m_outW[i]), IsCloseTolerance(expected, 1e-3f));
+        }
+    }
+
+    TEST_F(MATH_SimdBatch, NormalizeVectorsSafe_MatchesGetNormalizedSafe)
+    {
+        // Include short vectors in both the SIMD path and the scalar tail
+        for (size_t index : { size_t{ 5 }, SimdBatchTestCount - 1 })
+        {
+            m_x[index] = 0.0f;
+            m_y[index] = AZ::Constants::Tolerance * 0.5f;
+            m_z[index] = 0.0f;
+        }
+
+        AZ::SimdBatch::NormalizeVectorsSafe(Input(), Output(), SimdBatchTestCount);
+
+        for (size_t i = 0; i < SimdBatchTestCount; ++i)
+        {
+            EXPECT_THAT(GetOutput(i), IsClose(GetInput(i).GetNormalizedSafe()));
+        }
+        EXPECT_THAT(GetOutput(5), IsClose(AZ::Vector3::CreateZero()));
+        EXPECT_THAT(GetOutput(SimdBatchTestCount - 1), IsClose(AZ::Vector3::CreateZero()));
+    }
+
+    TEST_F(MATH_SimdBatch, OverlapsFrustumAabbs_MatchesShapeIntersectionOverlaps)
+    {
+        const AZ::Frustum frustum(AZ::ViewFrustumAttributes(
+            AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, -5.0f, 0.0f)), 1.5f, 1.0f, 0.1f, 20.0f));
+
+        // Boxes of up to 4 units on a side, with their minimum at the random input points
+        AZStd::vector<float> maxX(SimdBatchTestCount), maxY(SimdBatchTestCount), maxZ(SimdBatchTestCount);
+        for (size_t i = 0; i < SimdBatchTestCount; ++i)
+        {
+            maxX[i] = m_x[i] + AZ::GetAbs(m_w[i]) * 0.4f;
+            maxY[i] = m_y[i] + 0.5f;
+            maxZ[i] = m_z[i] + 2.0f;
+        }
+
+        bool overlaps[SimdBatchTestCount];
+        const size_t overlapCount = AZ::SimdBatch::OverlapsFrustumAabbs(
+            frustum, Input(), { maxX.data(), maxY.data(), maxZ.data() }, overlaps, SimdBatchTestCount);
+
+        size_t expectedOverlapCount = 0;
+        for (size_t i = 0; i < SimdBatchTestCount; ++i)
+        {
+            const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(GetInput(i), AZ::Vector3(maxX[i], maxY[i], maxZ[i]));
+            const bool expected = AZ::ShapeIntersection::Overlaps(frustum, aabb);
+            EXPECT_EQ(expected, overlaps[i]);
+            expectedOverlapCount += expected ? 1 : 0;
+        }
+        EXPECT_EQ(expectedOverlapCount, overlapCount);
+        // The test data should contain boxes on both sides of the frustum
+        EXPECT_GT(overlapCount, 0u);
+        EXPECT_LT(overlapCount, SimdBatchTestCount);
+    }
+
+    TEST_F(MATH_SimdBatch, OverlapsFrustumAabbs_InfiniteBox_Overlaps)
+    {
+        const AZ::Frustum frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, AZ::Constants::HalfPi, 1.0f, 100.0f));
+
+        // Four lanes of boxes reaching FLT_MAX, which must not overflow
+        float minValues[4] = { -AZ::Constants::FloatMax, -AZ::Constants::FloatMax, -AZ::Constants::FloatMax, -AZ::Constants::FloatMax };
+        float maxValues[4] = { AZ::Constants::FloatMax, AZ::Constants::FloatMax, AZ::Constants::FloatMax, AZ::Constants::FloatMax };
+        bool overlaps[4] = { false, false, false, false };
+
+        EXPECT_EQ(4u,
+            AZ::SimdBatch::OverlapsFrustumAabbs(
+                frustum, { minValues, minValues, minValues }, { maxValues, maxValues, maxValues }, overlaps, 4));
+        for (bool overlap : overlaps)
+        {
+            EXPECT_TRUE(overlap);
+        }
+    }
+
+    TEST_F(MATH_SimdBatch, EmptyStreams_DoNothing)
+    {
+        AZ::SimdBatch::TransformPoints(AZ::Transform::CreateIdentity(), {}, {}, 0);
+        AZ::SimdBatch::MultiplyQuaternions({}, {}, {}, 0);
+        AZ::SimdBatch::NormalizeVectorsSafe({}, {}, 0);
+        EXPECT_EQ(0u, AZ::SimdBatch::OverlapsFrustumAabbs(AZ::Frustum(), {}, {}, nullptr, 0));
+    }
+} // namespace UnitTest
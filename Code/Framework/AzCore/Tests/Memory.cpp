@@ -8,6 +8,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/HphaAllocator.h>
 
 #include <AzCore/Memory/AllocationRecords.h>
@@ -726,6 +727,248 @@ namespace UnitTest
         run();
     }
 
+    constexpr size_t s_testFrameArenaPageSize = 1024;
+
+    class TestFrameArenaAllocator final : public AZ::FrameArenaAllocatorBase<TestFrameArenaAllocator>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestFrameArenaAllocator, AZ::SystemAllocator);
+        AZ_RTTI(TestFrameArenaAllocator, "{8E0C5A27-3F4B-4D61-B9A2-6C17E5D30F84}", AZ::FrameArenaAllocatorBase<TestFrameArenaAllocator>);
+
+        TestFrameArenaAllocator()
+            : AZ::FrameArenaAllocatorBase<TestFrameArenaAllocator>(s_testFrameArenaPageSize)
+        {
+        }
+    };
+
+    /**
+     * Tests FrameArenaAllocator
+     */
+    class FrameArenaAllocatorTest
+        : public MemoryTrackingFixture
+    {
+    public:
+        TestFrameArenaAllocator& GetArena()
+        {
+            return static_cast<TestFrameArenaAllocator&>(AllocatorInstance<TestFrameArenaAllocator>::Get());
+        }
+
+        void TearDown() override
+        {
+            GetArena().ResetFrame();
+            MemoryTrackingFixture::TearDown();
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_RespectsAlignmentAndDoesNotOverlap)
+    {
+        TestFrameArenaAllocator& arena = GetArena();
+        arena.ResetFrame();
+
+        AZStd::vector<AZStd::pair<char*, size_t>> allocations;
+        size_t totalBytes = 0;
+        for (size_t i = 0; i < 64; ++i)
+        {
+            const size_t size = 1 + (i * 37) % 200;
+            const size_t alignment = size_t{ 1 } << (i % 7);
+            char* ptr = static_cast<char*>(arena.allocate(size, alignment));
+            ASSERT_NE(nullptr, ptr);
+            EXPECT_EQ(0, reinterpret_cast<size_t>(ptr) & (alignment - 1));
+            memset(ptr, static_cast<int>(i), size);
+            allocations.emplace_back(ptr, size);
+            totalBytes += size;
+        }
+        EXPECT_EQ(totalBytes, arena.NumAllocatedBytes());
+
+        for (size_t i = 0; i < allocations.size(); ++i)
+        {
+            for (size_t byte = 0; byte < allocations[i].second; ++byte)
+            {
+                ASSERT_EQ(static_cast<char>(i), allocations[i].first[byte]);
+            }
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, ResetFrame_ReusesPages)
+    {
+        TestFrameArenaAllocator& arena = GetArena();
+        arena.ResetFrame();
+
+        void* first = arena.allocate(64, 16);
+        for (size_t i = 0; i < 32; ++i)
+        {
+            arena.allocate(200, 8);
+        }
+        const size_t reserved = arena.NumReservedBytes();
+        EXPECT_GT(reserved, s_testFrameArenaPageSize);
+
+        const AZ::u64 frameIndex = arena.GetFrameIndex();
+        arena.ResetFrame();
+        EXPECT_EQ(frameIndex + 1, arena.GetFrameIndex());
+        EXPECT_EQ(0, arena.NumAllocatedBytes());
+
+        // The same sequence of allocations is served from the pages kept from the previous frame
+        EXPECT_EQ(first, arena.allocate(64, 16));
+        for (size_t i = 0; i < 32; ++i)
+        {
+            arena.allocate(200, 8);
+        }
+        EXPECT_EQ(reserved, arena.NumReservedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, LargeAllocation_IsReleasedOnReset)
+    {
+        TestFrameArenaAllocator& arena = GetArena();
+        arena.ResetFrame();
+        arena.allocate(16, 16);
+        const size_t reserved = arena.NumReservedBytes();
+
+        void* large = arena.allocate(4 * s_testFrameArenaPageSize, 256);
+        ASSERT_NE(nullptr, large);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(large) & 255);
+        EXPECT_GT(arena.NumReservedBytes(), reserved + 4 * s_testFrameArenaPageSize);
+
+        arena.ResetFrame();
+        arena.allocate(16, 16);
+        EXPECT_EQ(reserved, arena.NumReservedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Reallocate_GrowsMostRecentAllocationInPlace)
+    {
+        TestFrameArenaAllocator& arena = GetArena();
+        arena.ResetFrame();
+
+        void* ptr = arena.allocate(32, 8);
+        void* grown = arena.reallocate(ptr, 96, 8);
+        EXPECT_EQ(ptr, grown);
+        EXPECT_EQ(96, arena.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, GarbageCollect_ReleasesPagesUnusedLastFrame)
+    {
+        TestFrameArenaAllocator& arena = GetArena();
+        arena.ResetFrame();
+        for (size_t i = 0; i < 32; ++i)
+        {
+            arena.allocate(200, 8);
+        }
+        const size_t peakReserved = arena.NumReservedBytes();
+
+        // A quiet frame followed by a collect trims the chain down to what that frame used
+        arena.ResetFrame();
+        arena.allocate(16, 8);
+        arena.GarbageCollect();
+        arena.ResetFrame();
+        arena.allocate(16, 8);
+        EXPECT_LT(arena.NumReservedBytes(), peakReserved);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, AZStdContainers_AllocateFromArena)
+    {
+        TestFrameArenaAllocator& arena = GetArena();
+        arena.ResetFrame();
+        {
+            AZStd::vector<int, AZ::AZStdAlloc<TestFrameArenaAllocator>> values;
+            for (int i = 0; i < 1000; ++i)
+            {
+                values.push_back(i);
+            }
+            for (int i = 0; i < 1000; ++i)
+            {
+                EXPECT_EQ(i, values[i]);
+            }
+        }
+        EXPECT_GT(arena.NumAllocatedBytes(), 1000 * sizeof(int));
+    }
+
+    TEST_F(FrameArenaAllocatorTest, RegistersWithAllocatorManager)
+    {
+        AZ::IAllocator* arena = &GetArena();
+        AZ::AllocatorManager& manager = AZ::AllocatorManager::Instance();
+        auto lock = manager.LockAllocators();
+        bool found = false;
+        for (int i = 0; i < manager.GetNumAllocators(); ++i)
+        {
+            found |= manager.GetAllocator(i) == arena;
+        }
+        EXPECT_TRUE(found);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, MultipleThreads_AllocateIndependently)
+    {
+        TestFrameArenaAllocator& arena = GetArena();
+        arena.ResetFrame();
+
+        constexpr size_t threadCount = 4;
+        constexpr size_t allocationsPerThread = 512;
+        AZStd::atomic<size_t> failures{ 0 };
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&arena, &failures, threadIndex]()
+                {
+                    AZStd::vector<uint32_t*> allocations;
+                    for (size_t i = 0; i < allocationsPerThread; ++i)
+                    {
+                        auto value = static_cast<uint32_t*>(arena.allocate(sizeof(uint32_t), alignof(uint32_t)));
+                        *value = static_cast<uint32_t>(threadIndex * allocationsPerThread + i);
+                        allocations.push_back(value);
+                    }
+                    for (size_t i = 0; i < allocationsPerThread; ++i)
+                    {
+                        if (*allocations[i] != threadIndex * allocationsPerThread + i)
+                        {
+                            ++failures;
+                        }
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, failures.load());
+        EXPECT_EQ(threadCount * allocationsPerThread * sizeof(uint32_t), arena.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, ExitedThreads_PagesAreReusedByNewThreads)
+    {
+        TestFrameArenaAllocator& arena = GetArena();
+        arena.ResetFrame();
+
+        auto allocatePages = [&arena]()
+        {
+            for (size_t i = 0; i < 8; ++i)
+            {
+                EXPECT_NE(nullptr, arena.allocate(s_testFrameArenaPageSize / 2, 16));
+            }
+        };
+
+        AZStd::thread firstThread(allocatePages);
+        firstThread.join();
+        const size_t reserved = arena.NumReservedBytes();
+        EXPECT_GT(reserved, s_testFrameArenaPageSize);
+
+        // Threads that come and go don't keep adding pages
+        for (int i = 0; i < 4; ++i)
+        {
+            arena.ResetFrame();
+            AZStd::thread thread(allocatePages);
+            thread.join();
+            EXPECT_EQ(reserved, arena.NumReservedBytes());
+        }
+
+        // Like for running threads, a garbage collect releases the pages exited threads didn't need in their last frame
+        arena.ResetFrame();
+        arena.GarbageCollect();
+        EXPECT_EQ(reserved, arena.NumReservedBytes());
+        arena.ResetFrame();
+        arena.GarbageCollect();
+        EXPECT_LT(arena.NumReservedBytes(), reserved);
+    }
+
     /**
      * Tests azmalloc,azmallocex/azfree.
      */
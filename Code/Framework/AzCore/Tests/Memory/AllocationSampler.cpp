@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace UnitTest
+{
+    class AllocationSamplerTest
+        : public LeakDetectionFixture
+    {
+    protected:
+        // The sampler never touches the memory, so distinct fake addresses are enough
+        static void* FakeAddress(size_t index)
+        {
+            return reinterpret_cast<void*>(0x10000 + index * 64);
+        }
+
+        static size_t SumSampleCount(const AZ::Debug::AllocationSampler::SiteReports& reports)
+        {
+            size_t sampleCount = 0;
+            for (const auto& report : reports)
+            {
+                sampleCount += report.m_sampleCount;
+            }
+            return sampleCount;
+        }
+
+        AZ::IAllocator& m_allocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+    };
+
+    TEST_F(AllocationSamplerTest, NotSampling_RecordsNothing)
+    {
+        AZ::Debug::AllocationSampler sampler;
+        EXPECT_FALSE(sampler.IsSampling());
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            sampler.SampleAllocation(m_allocator, FakeAddress(i), 1024, 0);
+        }
+        EXPECT_FALSE(sampler.HasLiveSamples());
+
+        AZ::Debug::AllocationSampler::SiteReports reports;
+        sampler.GetSiteReports(reports);
+        EXPECT_TRUE(reports.empty());
+    }
+
+    TEST_F(AllocationSamplerTest, LargeAllocations_AreAlwaysSampled_AndReleasedOnDeallocation)
+    {
+        AZ::Debug::AllocationSampler sampler;
+        sampler.SetSamplingInterval(64);
+
+        // Allocations much larger than the interval are sampled with a probability of almost 1
+        constexpr size_t NumAllocations = 100;
+        constexpr size_t AllocationSize = 64 * 1024;
+        for (size_t i = 0; i < NumAllocations; ++i)
+        {
+            sampler.SampleAllocation(m_allocator, FakeAddress(i), AllocationSize, 0);
+        }
+        EXPECT_TRUE(sampler.HasLiveSamples());
+
+        AZ::Debug::AllocationSampler::SiteReports reports;
+        sampler.GetSiteReports(reports);
+        ASSERT_FALSE(reports.empty());
+        EXPECT_EQ(NumAllocations, SumSampleCount(reports));
+        for (const auto& report : reports)
+        {
+            EXPECT_STREQ(m_allocator.GetName(), report.m_allocatorName.c_str());
+            EXPECT_EQ(report.m_liveBytes, report.m_totalBytes);
+        }
+
+        for (size_t i = 0; i < NumAllocations; ++i)
+        {
+            sampler.SampleDeallocation(FakeAddress(i));
+        }
+        EXPECT_FALSE(sampler.HasLiveSamples());
+
+        sampler.GetSiteReports(reports);
+        size_t totalBytes = 0;
+        for (const auto& report : reports)
+        {
+            EXPECT_EQ(0u, report.m_liveBytes);
+            totalBytes += report.m_totalBytes;
+        }
+        EXPECT_EQ(NumAllocations * AllocationSize, totalBytes);
+    }
+
+    TEST_F(AllocationSamplerTest, SmallAllocations_EstimatedBytes_AreCloseToAllocatedBytes)
+    {
+        AZ::Debug::AllocationSampler sampler;
+        constexpr size_t SamplingInterval = 1024;
+        sampler.SetSamplingInterval(SamplingInterval);
+
+        constexpr size_t NumAllocations = 100000;
+        constexpr size_t AllocationSize = 64;
+        for (size_t i = 0; i < NumAllocations; ++i)
+        {
+            sampler.SampleAllocation(m_allocator, FakeAddress(i), AllocationSize, 0);
+        }
+
+        AZ::Debug::AllocationSampler::SiteReports reports;
+        sampler.GetSiteReports(reports);
+        size_t sampleCount = 0;
+        size_t estimatedBytes = 0;
+        for (const auto& report : reports)
+        {
+            sampleCount += report.m_sampleCount;
+            estimatedBytes += report.m_totalBytes;
+        }
+
+        // About one sample per interval; the estimate of 6.4 MB is based on about 6000 samples, so 10% is a wide margin
+        const double allocatedBytes = static_cast<double>(NumAllocations * AllocationSize);
+        EXPECT_NEAR(allocatedBytes / SamplingInterval, static_cast<double>(sampleCount), 0.1 * allocatedBytes / SamplingInterval);
+        EXPECT_NEAR(allocatedBytes, static_cast<double>(estimatedBytes), 0.1 * allocatedBytes);
+    }
+
+    TEST_F(AllocationSamplerTest, SetSamplingInterval_DropsSamples)
+    {
+        AZ::Debug::AllocationSampler sampler;
+        sampler.SetSamplingInterval(64);
+        sampler.SampleAllocation(m_allocator, FakeAddress(0), 4096, 0);
+        EXPECT_TRUE(sampler.HasLiveSamples());
+
+        sampler.SetSamplingInterval(0);
+        EXPECT_FALSE(sampler.IsSampling());
+        EXPECT_FALSE(sampler.HasLiveSamples());
+
+        AZ::Debug::AllocationSampler::SiteReports reports;
+        sampler.GetSiteReports(reports);
+        EXPECT_TRUE(reports.empty());
+    }
+
+    TEST_F(AllocationSamplerTest, SiteReports_RoundTripThroughStream)
+    {
+        AZ::Debug::AllocationSampler::SiteReports reports(2);
+        reports[0].m_allocatorName = "SystemAllocator";
+        reports[0].m_liveBytes = 1024;
+        reports[0].m_totalBytes = 4096;
+        reports[0].m_sampleCount = 3;
+        reports[0].m_stack = { "Foo.cpp (12) : Foo()", "", "Main.cpp (3) : main()" };
+        reports[1].m_allocatorName = "Pool Allocator With Spaces";
+        reports[1].m_liveBytes = 0;
+        reports[1].m_totalBytes = 64;
+        reports[1].m_sampleCount = 1;
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(AZ::Debug::AllocationSampler::WriteSiteReports(stream, 2048, reports));
+
+        stream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        size_t samplingInterval = 0;
+        AZ::Debug::AllocationSampler::SiteReports readReports;
+        ASSERT_TRUE(AZ::Debug::AllocationSampler::ReadSiteReports(stream, samplingInterval, readReports));
+        EXPECT_EQ(2048u, samplingInterval);
+        ASSERT_EQ(reports.size(), readReports.size());
+        for (size_t i = 0; i < reports.size(); ++i)
+        {
+            EXPECT_EQ(reports[i].m_allocatorName, readReports[i].m_allocatorName);
+            EXPECT_EQ(reports[i].m_liveBytes, readReports[i].m_liveBytes);
+            EXPECT_EQ(reports[i].m_totalBytes, readReports[i].m_totalBytes);
+            EXPECT_EQ(reports[i].m_sampleCount, readReports[i].m_sampleCount);
+            EXPECT_EQ(reports[i].m_stack, readReports[i].m_stack);
+        }
+    }
+
+    TEST_F(AllocationSamplerTest, ReadSiteReports_InvalidFile_Fails)
+    {
+        AZStd::string contents = "not a sample file\n";
+        AZ::IO::ByteContainerStream<AZStd::string> stream(&contents);
+        size_t samplingInterval = 0;
+        AZ::Debug::AllocationSampler::SiteReports reports;
+        EXPECT_FALSE(AZ::Debug::AllocationSampler::ReadSiteReports(stream, samplingInterval, reports));
+    }
+} // namespace UnitTest
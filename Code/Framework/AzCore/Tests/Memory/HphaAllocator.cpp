@@ -9,6 +9,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -102,4 +103,106 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    // The thread caches are only used by the non-debug schema
+    class HphaThreadCache_TestAllocator : public AZ::SimpleSchemaAllocator<AZ::HphaSchemaBase<false>>
+    {
+    public:
+        AZ_TYPE_INFO(HphaThreadCache_TestAllocator, "{3F6B1C2D-8E4A-4B7D-9A15-C2E7D0F46B38}");
+
+        HphaThreadCache_TestAllocator()
+        {
+            Create();
+        }
+
+        ~HphaThreadCache_TestAllocator() override = default;
+
+        void GetThreadCacheStats(AZ::HphaThreadCacheStats& stats) const
+        {
+            static_cast<const AZ::HphaSchemaBase<false>*>(GetSchema())->GetThreadCacheStats(stats);
+        }
+    };
+
+    class HphaSchemaThreadCacheTest
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(HphaSchemaThreadCacheTest, SmallAllocations_AreServedFromThreadCaches)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaThreadCache_TestAllocator>::Get();
+        constexpr size_t NumThreads = 4;
+        constexpr size_t NumAllocations = 1000;
+        constexpr size_t NumIterations = 10;
+
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < NumThreads; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&allocator]
+                {
+                    AZStd::vector<void*, AZ::OSStdAllocator> allocations(NumAllocations);
+                    for (size_t iteration = 0; iteration < NumIterations; ++iteration)
+                    {
+                        for (size_t i = 0; i < NumAllocations; ++i)
+                        {
+                            allocations[i] = allocator.Allocate(s_smallAllocationSizes[i % s_smallAllocationSizes.size()], 0);
+                            EXPECT_NE(nullptr, allocations[i]);
+                        }
+                        for (void* allocation : allocations)
+                        {
+                            allocator.DeAllocate(allocation);
+                        }
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // The caches of exited threads are returned to the buckets, but their counters are kept
+        AZ::HphaThreadCacheStats stats;
+        allocator.GetThreadCacheStats(stats);
+        EXPECT_TRUE(stats.m_threads.empty());
+        EXPECT_EQ(0u, stats.m_cachedBytes);
+        EXPECT_EQ(NumThreads * NumAllocations * NumIterations, stats.m_hits + stats.m_misses);
+        EXPECT_GT(stats.GetHitRate(), 0.5f);
+        EXPECT_GT(stats.m_flushes, 0u);
+        EXPECT_EQ(0u, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTest, FreeOnOtherThread_ReturnsBlocksToOwningBucket)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaThreadCache_TestAllocator>::Get();
+        constexpr size_t NumAllocations = 1000;
+
+        AZStd::vector<void*, AZ::OSStdAllocator> allocations(NumAllocations);
+        for (size_t i = 0; i < NumAllocations; ++i)
+        {
+            allocations[i] = allocator.Allocate(s_smallAllocationSizes[i % s_smallAllocationSizes.size()], 0);
+            ASSERT_NE(nullptr, allocations[i]);
+        }
+
+        AZStd::thread freeThread(
+            [&allocator, &allocations]
+            {
+                for (void* allocation : allocations)
+                {
+                    allocator.DeAllocate(allocation);
+                }
+            });
+        freeThread.join();
+        EXPECT_EQ(0u, allocator.NumAllocatedBytes());
+
+        AZ::HphaThreadCacheStats stats;
+        allocator.GetThreadCacheStats(stats);
+        ASSERT_EQ(1u, stats.m_threads.size());
+        EXPECT_EQ(AZStd::this_thread::get_id(), stats.m_threads[0].m_threadId);
+
+        // Returning the blocks of this thread leaves the buckets as if no thread cache was in use
+        allocator.GarbageCollect();
+        allocator.GetThreadCacheStats(stats);
+        EXPECT_EQ(0u, stats.m_cachedBytes);
+    }
 }
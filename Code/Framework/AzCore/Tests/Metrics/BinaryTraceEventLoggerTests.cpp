@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Metrics/BinaryTraceEventLogger.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class BinaryTraceEventLoggerTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        using BinaryStream = AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>>;
+
+        //! Converts the binary events to JSON and parses them
+        void ConvertToJson(rapidjson::Document& jsonDoc, size_t expectedEventCount)
+        {
+            BinaryStream binaryStream(&m_binaryOutput);
+            AZStd::string jsonOutput;
+            auto convertOutcome = AZ::Metrics::ConvertBinaryTraceEventsToJson(
+                binaryStream, AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::string>>(&jsonOutput));
+            ASSERT_TRUE(convertOutcome) << convertOutcome.GetError().c_str();
+            EXPECT_EQ(expectedEventCount, convertOutcome.GetValue());
+
+            rapidjson::ParseResult parseResult = jsonDoc.Parse(jsonOutput.c_str());
+            ASSERT_TRUE(parseResult) << R"(JSON parse error ")" << rapidjson::GetParseError_En(parseResult.Code())
+                << R"(" at offset (")" << parseResult.Offset() << ")";
+            ASSERT_TRUE(jsonDoc.IsArray());
+            EXPECT_EQ(expectedEventCount, jsonDoc.Size());
+        }
+
+        AZStd::vector<AZ::u8> m_binaryOutput;
+    };
+
+    TEST_F(BinaryTraceEventLoggerTest, RecordEvents_ConvertedToJson_MatchRecordedFields)
+    {
+        {
+            AZ::Metrics::BinaryTraceEventLogger eventLogger(AZStd::make_unique<BinaryStream>(&m_binaryOutput));
+
+            AZStd::fixed_vector<AZ::Metrics::EventValue, 4> arrayValues{ AZ::s64{ -2 }, 1.5, true, AZStd::string_view("element") };
+            AZStd::fixed_vector<AZ::Metrics::EventField, 2> objectFields{ { "uint64_t", AZ::u64{ 18446462603027808255ULL } } };
+            AZStd::fixed_vector<AZ::Metrics::EventField, 8> argContainer{
+                { "string", AZStd::string_view("Hello world") },
+                { "array", AZ::Metrics::EventArray(arrayValues) },
+                { "object", AZ::Metrics::EventObject(objectFields) } };
+
+            AZ::Metrics::CompleteArgs completeArgs;
+            completeArgs.m_name = "CompleteEvent";
+            completeArgs.m_cat = "Test";
+            completeArgs.m_dur = AZStd::chrono::microseconds(42);
+            completeArgs.m_args = argContainer;
+            EXPECT_TRUE(eventLogger.RecordCompleteEvent(completeArgs));
+
+            AZ::Metrics::InstantArgs instantArgs;
+            instantArgs.m_name = "InstantEvent";
+            instantArgs.m_cat = "Test";
+            instantArgs.m_id = "InstantId";
+            instantArgs.m_scope = AZ::Metrics::InstantEventScope::Global;
+            EXPECT_TRUE(eventLogger.RecordInstantEvent(instantArgs));
+
+            AZ::Metrics::AsyncArgs asyncArgs;
+            asyncArgs.m_name = "AsyncEvent";
+            asyncArgs.m_cat = "Test";
+            asyncArgs.m_id = "AsyncId";
+            asyncArgs.m_scope = "AsyncScope";
+            EXPECT_TRUE(eventLogger.RecordAsyncEventStart(asyncArgs));
+            // Recorded a second time with the strings interned
+            EXPECT_TRUE(eventLogger.RecordAsyncEventEnd(asyncArgs));
+
+            // Writes the events and closes the stream
+            eventLogger.ResetStream(nullptr);
+            EXPECT_EQ(0, eventLogger.GetDroppedEventCount());
+        }
+
+        rapidjson::Document jsonDoc;
+        ConvertToJson(jsonDoc, 4);
+        ASSERT_FALSE(HasFailure());
+
+        const rapidjson::Value& completeEvent = jsonDoc[0];
+        EXPECT_STREQ("CompleteEvent", completeEvent["name"].GetString());
+        EXPECT_STREQ("Test", completeEvent["cat"].GetString());
+        EXPECT_STREQ("X", completeEvent["ph"].GetString());
+        EXPECT_EQ(42, completeEvent["dur"].GetInt64());
+        EXPECT_TRUE(completeEvent.HasMember("ts"));
+        EXPECT_TRUE(completeEvent.HasMember("pid"));
+        EXPECT_TRUE(completeEvent.HasMember("tid"));
+        const rapidjson::Value& args = completeEvent["args"];
+        EXPECT_STREQ("Hello world", args["string"].GetString());
+        ASSERT_TRUE(args["array"].IsArray());
+        ASSERT_EQ(4, args["array"].Size());
+        EXPECT_EQ(-2, args["array"][0].GetInt64());
+        EXPECT_DOUBLE_EQ(1.5, args["array"][1].GetDouble());
+        EXPECT_TRUE(args["array"][2].GetBool());
+        EXPECT_STREQ("element", args["array"][3].GetString());
+        EXPECT_EQ(18446462603027808255ULL, args["object"]["uint64_t"].GetUint64());
+
+        const rapidjson::Value& instantEvent = jsonDoc[1];
+        EXPECT_STREQ("InstantEvent", instantEvent["name"].GetString());
+        EXPECT_STREQ("i", instantEvent["ph"].GetString());
+        EXPECT_STREQ("InstantId", instantEvent["id"].GetString());
+        EXPECT_STREQ("g", instantEvent["s"].GetString());
+
+        for (rapidjson::SizeType asyncIndex : { 2, 3 })
+        {
+            const rapidjson::Value& asyncEvent = jsonDoc[asyncIndex];
+            EXPECT_STREQ("AsyncEvent", asyncEvent["name"].GetString());
+            EXPECT_STREQ("AsyncId", asyncEvent["id"].GetString());
+            EXPECT_STREQ("AsyncScope", asyncEvent["scope"].GetString());
+        }
+        EXPECT_STREQ("b", jsonDoc[2]["ph"].GetString());
+        EXPECT_STREQ("e", jsonDoc[3]["ph"].GetString());
+    }
+
+    TEST_F(BinaryTraceEventLoggerTest, RecordEvents_FromMultipleThreads_AllEventsConverted)
+    {
+        constexpr size_t totalThreads = 4;
+        constexpr size_t eventsPerThread = 500;
+        {
+            AZ::Metrics::BinaryTraceEventLoggerConfig config;
+            // Keeps all the events of a thread in its buffer, so none are dropped however late the flush thread runs
+            config.m_threadBufferSize = 1024 * 1024;
+            // Writes the strings of half of the events inline
+            config.m_maxInternedStringsPerThread = 4;
+            AZ::Metrics::BinaryTraceEventLogger eventLogger(AZStd::make_unique<BinaryStream>(&m_binaryOutput), config);
+
+            auto RecordEvents = [&eventLogger](size_t threadIndex)
+            {
+                for (size_t eventIndex = 0; eventIndex < eventsPerThread; ++eventIndex)
+                {
+                    const AZStd::string counterName = AZStd::string::format("Counter%zu", eventIndex % 8);
+                    AZStd::fixed_vector<AZ::Metrics::EventField, 2> argContainer{ { "thread", AZ::u64{ threadIndex } } };
+                    AZ::Metrics::CounterArgs counterArgs;
+                    counterArgs.m_name = counterName;
+                    counterArgs.m_cat = "Test";
+                    counterArgs.m_args = argContainer;
+                    EXPECT_TRUE(eventLogger.RecordCounterEvent(counterArgs));
+                }
+            };
+
+            AZStd::array<AZStd::thread, totalThreads> threads;
+            for (size_t threadIndex = 0; threadIndex < totalThreads; ++threadIndex)
+            {
+                threads[threadIndex] = AZStd::thread(RecordEvents, threadIndex);
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            eventLogger.ResetStream(nullptr);
+            EXPECT_EQ(0, eventLogger.GetDroppedEventCount());
+        }
+
+        rapidjson::Document jsonDoc;
+        ConvertToJson(jsonDoc, totalThreads * eventsPerThread);
+        ASSERT_FALSE(HasFailure());
+
+        AZStd::array<size_t, totalThreads> eventsOfThread{};
+        for (const rapidjson::Value& event : jsonDoc.GetArray())
+        {
+            EXPECT_EQ(0, strncmp("Counter", event["name"].GetString(), 7));
+            ++eventsOfThread[event["args"]["thread"].GetUint64()];
+        }
+        for (size_t eventCount : eventsOfThread)
+        {
+            EXPECT_EQ(eventsPerThread, eventCount);
+        }
+    }
+
+    TEST_F(BinaryTraceEventLoggerTest, RecordEvents_ThreadBufferFull_DropsEventsAndStreamRemainsValid)
+    {
+        constexpr size_t recordedEventCount = 1000;
+        size_t droppedEventCount{};
+        {
+            AZ::Metrics::BinaryTraceEventLoggerConfig config;
+            config.m_threadBufferSize = 1024;
+            // Leaves the flush thread asleep, until it is woken by the full buffer
+            config.m_flushInterval = AZStd::chrono::milliseconds(60000);
+            AZ::Metrics::BinaryTraceEventLogger eventLogger(AZStd::make_unique<BinaryStream>(&m_binaryOutput), config);
+
+            AZ::Metrics::InstantArgs instantArgs;
+            instantArgs.m_name = "InstantEvent";
+            instantArgs.m_cat = "Test";
+            for (size_t eventIndex = 0; eventIndex < recordedEventCount; ++eventIndex)
+            {
+                eventLogger.RecordInstantEvent(instantArgs);
+            }
+
+            eventLogger.ResetStream(nullptr);
+            droppedEventCount = eventLogger.GetDroppedEventCount();
+        }
+
+        rapidjson::Document jsonDoc;
+        ConvertToJson(jsonDoc, recordedEventCount - droppedEventCount);
+    }
+
+    TEST_F(BinaryTraceEventLoggerTest, ConvertToJson_InvalidStream_Fails)
+    {
+        constexpr AZStd::string_view notBinaryEvents = R"([{"name": "JsonEvent"}])";
+        m_binaryOutput.assign(notBinaryEvents.begin(), notBinaryEvents.end());
+
+        BinaryStream binaryStream(&m_binaryOutput);
+        AZStd::string jsonOutput;
+        EXPECT_FALSE(AZ::Metrics::ConvertBinaryTraceEventsToJson(
+            binaryStream, AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::string>>(&jsonOutput)));
+    }
+} // namespace UnitTest
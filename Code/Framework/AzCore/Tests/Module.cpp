@@ -9,8 +9,11 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Module/Module.h>
 #include <AzCore/PlatformIncl.h>
+#include <AzCore/Module/ModuleManager.h>
 #include <AzCore/Module/ModuleManagerBus.h>
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include "ModuleTestBus.h"
 
@@ -342,6 +345,7 @@ namespace UnitTest
                 )
             {
                 m_foundWhatWeWereWatchingFor = true;
+                m_foundOnThread = AZStd::this_thread::get_id();
             }
             return false;
         }
@@ -352,6 +356,7 @@ namespace UnitTest
         }
 
         bool m_foundWhatWeWereWatchingFor = false;
+        AZStd::thread_id m_foundOnThread;
         AZ::OSString m_stringToWatchFor;
     };
 
@@ -436,6 +441,159 @@ namespace UnitTest
         app.Destroy();
     }
 
+    TEST_F(ModuleManager, SkipInitializeLoadsWithoutInitializingTest)
+    {
+        ComponentApplication app;
+
+        ComponentApplication::Descriptor appDesc;
+        ComponentApplication::StartupParameters startupParams;
+        startupParams.m_loadSettingsRegistry = false;
+        Entity* systemEntity = app.Create(appDesc, startupParams);
+        ASSERT_NE(nullptr, systemEntity);
+
+        {
+            PrintFCollector watchForDestruction("UninitializeDynamicModule called");
+            PrintFCollector watchForCreation("InitializeDynamicModule called");
+
+            // A library mapped ahead of its load isn't initialized, and isn't uninitialized when it's released
+            auto preloadHandle = DynamicModuleHandle::Create("AzCoreTestDLL");
+            ASSERT_TRUE(preloadHandle->Load(AZ::DynamicModuleHandle::LoadFlags::SkipInitialize));
+            EXPECT_TRUE(preloadHandle->IsLoaded());
+            EXPECT_FALSE(watchForCreation.m_foundWhatWeWereWatchingFor);
+
+            {
+                auto handle = DynamicModuleHandle::Create("AzCoreTestDLL");
+                ASSERT_TRUE(handle->Load(AZ::DynamicModuleHandle::LoadFlags::InitFuncRequired));
+                EXPECT_TRUE(watchForCreation.m_foundWhatWeWereWatchingFor);
+            }
+            EXPECT_TRUE(watchForDestruction.m_foundWhatWeWereWatchingFor);
+
+            PrintFCollector watchForSecondDestruction("UninitializeDynamicModule called");
+            preloadHandle.reset();
+            EXPECT_FALSE(watchForSecondDestruction.m_foundWhatWeWereWatchingFor);
+        }
+
+        app.Destroy();
+    }
+
+    class ModuleManagerParallelLoad
+        : public UnitTest::LeakDetectionFixture
+        , public ::testing::WithParamInterface<bool>
+    {
+    public:
+        void SetUp() override
+        {
+            UnitTest::LeakDetectionFixture::SetUp();
+
+            ComponentApplication::Descriptor appDesc;
+            ComponentApplication::StartupParameters startupParams;
+            startupParams.m_loadSettingsRegistry = false;
+            m_app = AZStd::make_unique<ComponentApplication>();
+            Entity* systemEntity = m_app->Create(appDesc, startupParams);
+            ASSERT_NE(nullptr, systemEntity);
+            systemEntity->Init();
+            systemEntity->Activate();
+
+            auto settingsRegistry = AZ::SettingsRegistry::Get();
+            ASSERT_NE(nullptr, settingsRegistry);
+            settingsRegistry->Set(AZ::ModuleManager::ParallelLoadSettingKey, GetParam());
+        }
+
+        void TearDown() override
+        {
+            // shut down application (deletes Modules, unloads DLLs)
+            m_app->Destroy();
+            m_app.reset();
+
+            UnitTest::LeakDetectionFixture::TearDown();
+        }
+
+        ModuleManagerRequests::LoadModulesResult LoadDynamicModules(
+            AZStd::initializer_list<const char*> modulePaths, ModuleInitializationSteps lastStepToPerform)
+        {
+            ModuleDescriptorList modules;
+            for (const char* modulePath : modulePaths)
+            {
+                modules.emplace_back().m_dynamicLibraryPath = modulePath;
+            }
+
+            ModuleManagerRequests::LoadModulesResult results;
+            ModuleManagerRequestBus::BroadcastResult(
+                results, &ModuleManagerRequestBus::Events::LoadDynamicModules, modules, lastStepToPerform, true);
+            return results;
+        }
+
+        AZStd::unique_ptr<ComponentApplication> m_app;
+    };
+
+    TEST_P(ModuleManagerParallelLoad, MissingLibrary_FailsOnlyItsOwnModule)
+    {
+        PrintFCollector watchForCreation("InitializeDynamicModule called");
+
+        ModuleManagerRequests::LoadModulesResult results = LoadDynamicModules(
+            { "MissingModuleForPreloadTestA", "AzCoreTestDLL", "MissingModuleForPreloadTestB" }, ModuleInitializationSteps::ActivateEntity);
+
+        // The results are in the order of the descriptors, whether the libraries were mapped in parallel or not
+        ASSERT_EQ(results.size(), 3u);
+        ASSERT_FALSE(results[0].IsSuccess());
+        EXPECT_NE(results[0].GetError().find("MissingModuleForPreloadTestA"), AZStd::string::npos);
+        ASSERT_TRUE(results[1].IsSuccess());
+        EXPECT_NE(nullptr, results[1].GetValue()->GetModule());
+        EXPECT_NE(nullptr, results[1].GetValue()->GetEntity());
+        ASSERT_FALSE(results[2].IsSuccess());
+        EXPECT_NE(results[2].GetError().find("MissingModuleForPreloadTestB"), AZStd::string::npos);
+
+        // The failed modules aren't kept by the manager
+        size_t moduleCount = 0;
+        ModuleManagerRequestBus::Broadcast(&ModuleManagerRequestBus::Events::EnumerateModules,
+            [&moduleCount](const ModuleData&)
+            {
+                ++moduleCount;
+                return true;
+            });
+        EXPECT_EQ(moduleCount, 1u);
+
+        // The library is only initialized by the serial load, on the calling thread
+        EXPECT_TRUE(watchForCreation.m_foundWhatWeWereWatchingFor);
+        EXPECT_EQ(watchForCreation.m_foundOnThread, AZStd::this_thread::get_id());
+    }
+
+    TEST_P(ModuleManagerParallelLoad, StepsBeforeLoad_DoNotMapLibraries)
+    {
+        PrintFCollector watchForCreation("InitializeDynamicModule called");
+
+        ModuleManagerRequests::LoadModulesResult results =
+            LoadDynamicModules({ "AzCoreTestDLL", "MissingModuleForPreloadTestA" }, ModuleInitializationSteps::None);
+
+        // Without the load step, the modules are only created, so even the missing library doesn't fail
+        ASSERT_EQ(results.size(), 2u);
+        ASSERT_TRUE(results[0].IsSuccess());
+        ASSERT_TRUE(results[1].IsSuccess());
+        EXPECT_EQ(nullptr, results[0].GetValue()->GetDynamicModuleHandle());
+        EXPECT_EQ(nullptr, results[1].GetValue()->GetDynamicModuleHandle());
+        EXPECT_FALSE(watchForCreation.m_foundWhatWeWereWatchingFor);
+    }
+
+    TEST_P(ModuleManagerParallelLoad, AlreadyLoadedModule_IsLoadedOnce)
+    {
+        ModuleManagerRequests::LoadModulesResult results =
+            LoadDynamicModules({ "AzCoreTestDLL" }, ModuleInitializationSteps::ActivateEntity);
+        ASSERT_EQ(results.size(), 1u);
+        ASSERT_TRUE(results[0].IsSuccess());
+        AZStd::shared_ptr<ModuleData> moduleHandle = results[0].GetValue();
+
+        // The loaded module is skipped by the preload, and the serial load returns the module it already has
+        PrintFCollector watchForCreation("InitializeDynamicModule called");
+        results = LoadDynamicModules({ "MissingModuleForPreloadTestA", "AzCoreTestDLL" }, ModuleInitializationSteps::ActivateEntity);
+        ASSERT_EQ(results.size(), 2u);
+        EXPECT_FALSE(results[0].IsSuccess());
+        ASSERT_TRUE(results[1].IsSuccess());
+        EXPECT_EQ(moduleHandle.get(), results[1].GetValue().get());
+        EXPECT_FALSE(watchForCreation.m_foundWhatWeWereWatchingFor);
+    }
+
+    INSTANTIATE_TEST_CASE_P(ParallelLoad, ModuleManagerParallelLoad, ::testing::Bool());
+
 #endif // AZ_TRAIT_TEST_SUPPORT_MODULE_LOADING
 
 } // namespace UnitTest
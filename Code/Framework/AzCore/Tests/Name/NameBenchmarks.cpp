@@ -177,4 +177,88 @@ namespace AZ::NameBenchmarks
         state.SetItemsProcessed(state.iterations() * state.range(0));
     }
     BENCHMARK_REGISTER_F(NameBenchmarkFixture, NameLiteralCreateAndDestroy)->Arg(10)->Arg(100)->Arg(1000);
+
+    //! Measures the contention on the dictionary when many threads make and find names at the same time.
+    //! The fixture is shared by the threads of a run, so only the first thread sets it up and tears it down.
+    class NameDictionaryContentionFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t PoolSize = 256;
+
+        void SetUp(const ::benchmark::State& st) override
+        {
+            if (st.thread_index() == 0)
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+                AZ::NameDictionary::Create();
+                for (size_t i = 0; i < PoolSize; ++i)
+                {
+                    m_existingNames.emplace_back(AZStd::string::format("contended_name%zu", i));
+                }
+            }
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(st));
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            if (st.thread_index() == 0)
+            {
+                m_existingNames = {};
+                AZ::NameDictionary::Destroy();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+            }
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(st));
+        }
+
+        AZStd::vector<AZ::Name> m_existingNames;
+    };
+
+    BENCHMARK_DEFINE_F(NameDictionaryContentionFixture, CreateNameCacheHit)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                benchmark::DoNotOptimize(AZ::Name(m_existingNames[i].GetStringView()));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryContentionFixture, CreateNameCacheHit)->ThreadRange(1, AZStd::thread::hardware_concurrency());
+
+    BENCHMARK_DEFINE_F(NameDictionaryContentionFixture, FindNameByHash)(::benchmark::State& state)
+    {
+        AZ::NameDictionary& nameDictionary = AZ::NameDictionary::Instance();
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                benchmark::DoNotOptimize(nameDictionary.FindName(m_existingNames[i].GetHash()));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryContentionFixture, FindNameByHash)->ThreadRange(1, AZStd::thread::hardware_concurrency());
+
+    BENCHMARK_DEFINE_F(NameDictionaryContentionFixture, NameCreateAndDestroy)(::benchmark::State& state)
+    {
+        const AZStd::string threadName = AZStd::string::format("contended_thread_name%d", state.thread_index());
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            benchmark::DoNotOptimize(AZ::Name(threadName));
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryContentionFixture, NameCreateAndDestroy)->ThreadRange(1, AZStd::thread::hardware_concurrency());
 } // namespace AZ::NameBenchmarks
@@ -50,9 +50,29 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const auto& GetDictionary()
+        static size_t GetDictionarySize()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            size_t size = 0;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                size += shard.m_dictionary.size();
+            }
+            return size;
+        }
+
+        static bool DictionaryContains(AZStd::string_view nameString)
+        {
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                for (const auto& entry : shard.m_dictionary)
+                {
+                    if (entry.second.m_nameData->GetName() == nameString)
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
         }
         
         static size_t GetEntryCount()
@@ -76,7 +96,7 @@ namespace UnitTest
                     break;
                 }
             }
-            return GetDictionary().size() - staticNameCount;
+            return GetDictionarySize() - staticNameCount;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -297,13 +317,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            // Workaround VS2022 17.3 issue with incorrect detection of unused lambda captures assigning the nameString reference to a same type
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString = nameString](const AZStd::pair<AZ::Name::Hash, AZ::NameDictionary::ScopedNameDataWrapper>& entry)
-            {
-                return entry.second.m_nameData->GetName() == nameString;
-            });
-            EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
+            EXPECT_TRUE(NameDictionaryTester::DictionaryContains(nameString)) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
 
         // Make sure all the threads got an accurate Name object
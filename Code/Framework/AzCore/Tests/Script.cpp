@@ -4430,6 +4430,22 @@ ramenShop.handler:Connect(4);
         lua_pop(m_lua, 1);
     }
 
+    using ScriptGarbageCollectionTest = ScriptCacheTableTest;
+
+    TEST_F(ScriptGarbageCollectionTest, SetGenerationalGarbageCollection_SwitchesCollectorMode)
+    {
+        m_script->SetGenerationalGarbageCollection(true);
+        m_script->Execute("for i = 1, 1000 do local t = { i } end");
+        m_script->GarbageCollectStep();
+
+        // switching the mode returns the previous one
+        EXPECT_EQ(LUA_GCGEN, lua_gc(m_lua, LUA_GCINC, 0, 0, 0));
+        m_script->SetGenerationalGarbageCollection(true);
+        m_script->SetGenerationalGarbageCollection(false);
+        EXPECT_EQ(LUA_GCINC, lua_gc(m_lua, LUA_GCGEN, 0, 0));
+        m_script->SetGenerationalGarbageCollection(false);
+    }
+
     class UnregisteredSharedPointerTest
         : public BehaviorContextFixture
     {
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Serialization/CompactClassLayout.h>
+#include <AzCore/Serialization/ObjectStream.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    namespace CompactClassLayoutTestTypes
+    {
+        struct Point
+        {
+            AZ_TYPE_INFO(Point, "{3E4D5C1B-6A0F-4C52-9E5B-2B7B0A8F61C4}");
+
+            float m_x{ 0.0f };
+            float m_y{ 0.0f };
+            float m_z{ 0.0f };
+        };
+
+        struct BaseRecord
+        {
+            AZ_TYPE_INFO(BaseRecord, "{A4B0E2C9-91E4-4F0D-8C77-5E4E1B0E3D22}");
+
+            AZ::u32 m_id{ 0 };
+        };
+
+        struct Record
+            : public BaseRecord
+        {
+            AZ_TYPE_INFO(Record, "{C2D9F1E3-2B7A-4E55-A3C5-0F6A9B1D7E48}");
+            AZ_CLASS_ALLOCATOR(Record, AZ::SystemAllocator);
+
+            AZ::u32 m_flags{ 0 };
+            Point m_position;
+            AZStd::string m_name;
+            AZStd::vector<AZ::s32> m_values;
+            AZStd::vector<Point> m_path;
+            AZStd::unordered_map<AZ::u32, AZStd::string> m_tags;
+        };
+
+        struct PointerRecord
+        {
+            AZ_TYPE_INFO(PointerRecord, "{5B8C0E73-1D4F-4A9C-B2E6-7F3A1C9D0E85}");
+            AZ_CLASS_ALLOCATOR(PointerRecord, AZ::SystemAllocator);
+
+            AZ::u32 m_id{ 0 };
+            AZStd::unique_ptr<Point> m_point;
+        };
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<Point>()
+                ->Field("x", &Point::m_x)
+                ->Field("y", &Point::m_y)
+                ->Field("z", &Point::m_z);
+            context.Class<BaseRecord>()
+                ->Field("id", &BaseRecord::m_id);
+            context.Class<Record, BaseRecord>()
+                ->Field("flags", &Record::m_flags)
+                ->Field("position", &Record::m_position)
+                ->Field("name", &Record::m_name)
+                ->Field("values", &Record::m_values)
+                ->Field("path", &Record::m_path)
+                ->Field("tags", &Record::m_tags);
+            context.Class<PointerRecord>()
+                ->Field("id", &PointerRecord::m_id)
+                ->Field("point", &PointerRecord::m_point);
+        }
+
+        static Record CreateRecord(size_t elementCount)
+        {
+            Record record;
+            record.m_id = 42;
+            record.m_flags = 0xf00d;
+            record.m_position = { 1.0f, 2.0f, 3.0f };
+            record.m_name = "Record";
+            for (size_t i = 0; i < elementCount; ++i)
+            {
+                float value = static_cast<float>(i);
+                record.m_values.push_back(static_cast<AZ::s32>(i) - 3);
+                record.m_path.push_back({ value, value * 2.0f, value * 3.0f });
+                record.m_tags.emplace(static_cast<AZ::u32>(i), AZStd::string::format("tag%zu", i));
+            }
+            return record;
+        }
+    } // namespace CompactClassLayoutTestTypes
+
+    class CompactClassLayoutTest
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            CompactClassLayoutTestTypes::Reflect(*m_serializeContext);
+        }
+
+        void TearDown() override
+        {
+            m_serializeContext.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        template<typename T>
+        void Save(const T& object, AZStd::vector<AZ::u8>& buffer)
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&buffer);
+            AZ::ObjectStream* objectStream = AZ::ObjectStream::Create(&stream, *m_serializeContext, AZ::ObjectStream::ST_BINARY_COMPACT);
+            ASSERT_NE(nullptr, objectStream);
+            EXPECT_TRUE(objectStream->WriteClass(&object));
+            EXPECT_TRUE(objectStream->Finalize());
+        }
+
+        template<typename T>
+        AZStd::unique_ptr<T> Load(const AZStd::vector<AZ::u8>& buffer, AZ::SerializeContext& serializeContext)
+        {
+            AZStd::unique_ptr<T> result;
+            AZ::IO::MemoryStream stream(buffer.data(), buffer.size());
+            AZ::ObjectStream::LoadBlocking(&stream, serializeContext,
+                [&result](void* classPtr, const AZ::Uuid& classId, AZ::SerializeContext*)
+                {
+                    EXPECT_EQ(azrtti_typeid<T>(), classId);
+                    result.reset(reinterpret_cast<T*>(classPtr));
+                });
+            return result;
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+    };
+
+    TEST_F(CompactClassLayoutTest, GetLayout_ContiguousPlainOldData_MergedIntoSingleRun)
+    {
+        using namespace CompactClassLayoutTestTypes;
+        using OpType = AZ::CompactClassLayout::OpType;
+
+        const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<Record>());
+        ASSERT_NE(nullptr, classData);
+        const AZ::CompactClassLayout* layout = m_serializeContext->GetCompactClassLayoutCache().GetLayout(*m_serializeContext, *classData);
+        ASSERT_NE(nullptr, layout);
+
+        // The base class id, the flags and the flattened position are next to each other in memory.
+        const auto& ops = layout->GetOps();
+        ASSERT_EQ(5, ops.size());
+        EXPECT_EQ(OpType::PodRun, ops[0].m_type);
+        EXPECT_EQ(0, ops[0].m_offset);
+        EXPECT_EQ(sizeof(AZ::u32) * 2 + sizeof(float) * 3, ops[0].m_size);
+        EXPECT_EQ(OpType::Serializer, ops[1].m_type);
+        EXPECT_EQ(OpType::Container, ops[2].m_type);
+        EXPECT_EQ(OpType::Container, ops[3].m_type);
+        EXPECT_EQ(OpType::Container, ops[4].m_type);
+
+        EXPECT_EQ(layout, m_serializeContext->GetCompactClassLayoutCache().GetLayout(*m_serializeContext, *classData));
+    }
+
+    TEST_F(CompactClassLayoutTest, GetLayout_ClassWithPointer_ReturnsNull)
+    {
+        using namespace CompactClassLayoutTestTypes;
+
+        const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<PointerRecord>());
+        ASSERT_NE(nullptr, classData);
+        EXPECT_EQ(nullptr, m_serializeContext->GetCompactClassLayoutCache().GetLayout(*m_serializeContext, *classData));
+    }
+
+    TEST_F(CompactClassLayoutTest, ObjectStream_SaveAndLoadCompact_RoundTripsAllMembers)
+    {
+        using namespace CompactClassLayoutTestTypes;
+
+        Record original = CreateRecord(8);
+        AZStd::vector<AZ::u8> buffer;
+        Save(original, buffer);
+
+        AZStd::unique_ptr<Record> loaded = Load<Record>(buffer, *m_serializeContext);
+        ASSERT_NE(nullptr, loaded);
+        EXPECT_EQ(original.m_id, loaded->m_id);
+        EXPECT_EQ(original.m_flags, loaded->m_flags);
+        EXPECT_FLOAT_EQ(original.m_position.m_z, loaded->m_position.m_z);
+        EXPECT_EQ(original.m_name, loaded->m_name);
+        EXPECT_EQ(original.m_values, loaded->m_values);
+        ASSERT_EQ(original.m_path.size(), loaded->m_path.size());
+        for (size_t i = 0; i < original.m_path.size(); ++i)
+        {
+            EXPECT_FLOAT_EQ(original.m_path[i].m_x, loaded->m_path[i].m_x);
+            EXPECT_FLOAT_EQ(original.m_path[i].m_y, loaded->m_path[i].m_y);
+            EXPECT_FLOAT_EQ(original.m_path[i].m_z, loaded->m_path[i].m_z);
+        }
+        EXPECT_EQ(original.m_tags, loaded->m_tags);
+    }
+
+    TEST_F(CompactClassLayoutTest, ObjectStream_SaveCompactClassWithPointer_FallsBackToBinaryObjectStream)
+    {
+        using namespace CompactClassLayoutTestTypes;
+
+        PointerRecord original;
+        original.m_id = 7;
+        original.m_point = AZStd::make_unique<Point>(Point{ 4.0f, 5.0f, 6.0f });
+        AZStd::vector<AZ::u8> buffer;
+        Save(original, buffer);
+
+        AZStd::unique_ptr<PointerRecord> loaded = Load<PointerRecord>(buffer, *m_serializeContext);
+        ASSERT_NE(nullptr, loaded);
+        EXPECT_EQ(7, loaded->m_id);
+        ASSERT_NE(nullptr, loaded->m_point);
+        EXPECT_FLOAT_EQ(5.0f, loaded->m_point->m_y);
+    }
+
+    TEST_F(CompactClassLayoutTest, ObjectStream_LoadCompactWithChangedReflection_RejectsObject)
+    {
+        using namespace CompactClassLayoutTestTypes;
+
+        AZStd::vector<AZ::u8> buffer;
+        Save(CreateRecord(2), buffer);
+
+        // Point is reflected without its z member, which changes the layout the data was stored with.
+        AZ::SerializeContext changedContext;
+        changedContext.Class<Point>()
+            ->Field("x", &Point::m_x)
+            ->Field("y", &Point::m_y);
+        changedContext.Class<BaseRecord>()
+            ->Field("id", &BaseRecord::m_id);
+        changedContext.Class<Record, BaseRecord>()
+            ->Field("flags", &Record::m_flags)
+            ->Field("position", &Record::m_position)
+            ->Field("name", &Record::m_name)
+            ->Field("values", &Record::m_values)
+            ->Field("path", &Record::m_path)
+            ->Field("tags", &Record::m_tags);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        AZStd::unique_ptr<Record> loaded = Load<Record>(buffer, changedContext);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        EXPECT_EQ(nullptr, loaded);
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class CompactClassLayoutBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            UnitTest::CompactClassLayoutTestTypes::Reflect(*m_serializeContext);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_buffer = {};
+            m_serializeContext.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RunLoadBenchmark(benchmark::State& state, AZ::DataStream::StreamType streamType)
+        {
+            using namespace UnitTest::CompactClassLayoutTestTypes;
+
+            Record record = CreateRecord(aznumeric_cast<size_t>(state.range(0)));
+            AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> saveStream(&m_buffer);
+            AZ::ObjectStream* objectStream = AZ::ObjectStream::Create(&saveStream, *m_serializeContext, streamType);
+            objectStream->WriteClass(&record);
+            objectStream->Finalize();
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZ::IO::MemoryStream loadStream(m_buffer.data(), m_buffer.size());
+                AZ::ObjectStream::LoadBlocking(&loadStream, *m_serializeContext,
+                    [](void* classPtr, const AZ::Uuid&, AZ::SerializeContext*)
+                    {
+                        delete reinterpret_cast<Record*>(classPtr);
+                    });
+            }
+            state.SetBytesProcessed(state.iterations() * m_buffer.size());
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::vector<AZ::u8> m_buffer;
+    };
+
+    BENCHMARK_DEFINE_F(CompactClassLayoutBenchmarkFixture, BM_LoadBinary)(benchmark::State& state)
+    {
+        RunLoadBenchmark(state, AZ::DataStream::ST_BINARY);
+    }
+    BENCHMARK_REGISTER_F(CompactClassLayoutBenchmarkFixture, BM_LoadBinary)->Arg(16)->Arg(1024);
+
+    BENCHMARK_DEFINE_F(CompactClassLayoutBenchmarkFixture, BM_LoadBinaryCompact)(benchmark::State& state)
+    {
+        RunLoadBenchmark(state, AZ::DataStream::ST_BINARY_COMPACT);
+    }
+    BENCHMARK_REGISTER_F(CompactClassLayoutBenchmarkFixture, BM_LoadBinaryCompact)->Arg(16)->Arg(1024);
+} // namespace Benchmark
+#endif
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+#include <AzTest/AzTest.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    namespace JsonStreamingDeserializerTestTypes
+    {
+        struct Inner
+        {
+            AZ_TYPE_INFO(Inner, "{0D5F0A3E-5B7B-4F0E-9A8C-2E0A6F2C4B11}");
+
+            int m_int = 0;
+            float m_float = 0.0f;
+            AZStd::string m_string;
+
+            bool operator==(const Inner& rhs) const
+            {
+                return m_int == rhs.m_int && m_float == rhs.m_float && m_string == rhs.m_string;
+            }
+        };
+
+        struct Outer
+        {
+            AZ_TYPE_INFO(Outer, "{9B1E8E62-4F8A-4E54-8D55-7A31C1C8D2A4}");
+
+            Inner m_first;
+            Inner m_second;
+            AZStd::vector<int> m_values;
+            AZStd::vector<Inner> m_inners;
+            bool m_flag = false;
+
+            bool operator==(const Outer& rhs) const
+            {
+                return m_first == rhs.m_first && m_second == rhs.m_second && m_values == rhs.m_values && m_inners == rhs.m_inners &&
+                    m_flag == rhs.m_flag;
+            }
+        };
+
+        void Reflect(SerializeContext& context)
+        {
+            context.Class<Inner>()
+                ->Field("int", &Inner::m_int)
+                ->Field("float", &Inner::m_float)
+                ->Field("string", &Inner::m_string);
+            context.Class<Outer>()
+                ->Field("first", &Outer::m_first)
+                ->Field("second", &Outer::m_second)
+                ->Field("values", &Outer::m_values)
+                ->Field("inners", &Outer::m_inners)
+                ->Field("flag", &Outer::m_flag);
+        }
+    } // namespace JsonStreamingDeserializerTestTypes
+
+    class JsonStreamingDeserializerTests
+        : public LeakDetectionFixture
+    {
+    protected:
+        struct Report
+        {
+            AZStd::string m_path;
+            JsonSerializationResult::Outcomes m_outcome;
+        };
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            m_serializeContext = AZStd::make_unique<SerializeContext>();
+            m_jsonRegistrationContext = AZStd::make_unique<JsonRegistrationContext>();
+            m_jsonSystemComponent = AZStd::make_unique<JsonSystemComponent>();
+
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            JsonStreamingDeserializerTestTypes::Reflect(*m_serializeContext);
+        }
+
+        void TearDown() override
+        {
+            m_jsonRegistrationContext->EnableRemoveReflection();
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            m_jsonRegistrationContext->DisableRemoveReflection();
+
+            m_serializeContext->EnableRemoveReflection();
+            JsonStreamingDeserializerTestTypes::Reflect(*m_serializeContext);
+            m_serializeContext->DisableRemoveReflection();
+
+            m_jsonRegistrationContext.reset();
+            m_serializeContext.reset();
+            m_jsonSystemComponent.reset();
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        JsonDeserializerSettings CreateSettings(AZStd::vector<Report>& reports)
+        {
+            JsonDeserializerSettings settings;
+            settings.m_serializeContext = m_serializeContext.get();
+            settings.m_registrationContext = m_jsonRegistrationContext.get();
+            settings.m_reporting = [&reports](AZStd::string_view, JsonSerializationResult::ResultCode result, AZStd::string_view path)
+            {
+                reports.push_back(Report{ AZStd::string(path), result.GetOutcome() });
+                return result;
+            };
+            return settings;
+        }
+
+        //! Loads the json with both the document based and the streaming deserializer and checks that they produce the same
+        //! result, the same reports and the same object.
+        template<typename T>
+        JsonSerializationResult::ResultCode LoadAndCompare(T& streamedObject, AZStd::string_view json)
+        {
+            rapidjson::Document document;
+            document.Parse<rapidjson::kParseCommentsFlag>(json.data(), json.size());
+            EXPECT_FALSE(document.HasParseError());
+
+            AZStd::vector<Report> documentReports;
+            T documentObject;
+            JsonSerializationResult::ResultCode documentResult =
+                JsonSerialization::Load(documentObject, document, CreateSettings(documentReports));
+
+            AZStd::vector<Report> streamReports;
+            IO::MemoryStream stream(json.data(), json.size());
+            JsonSerializationResult::ResultCode streamResult =
+                JsonSerialization::LoadStreaming(streamedObject, stream, CreateSettings(streamReports));
+
+            EXPECT_EQ(documentResult.GetTask(), streamResult.GetTask());
+            EXPECT_EQ(documentResult.GetProcessing(), streamResult.GetProcessing());
+            EXPECT_EQ(documentResult.GetOutcome(), streamResult.GetOutcome());
+            EXPECT_TRUE(documentObject == streamedObject);
+
+            EXPECT_EQ(documentReports.size(), streamReports.size());
+            for (size_t i = 0; i < AZStd::min(documentReports.size(), streamReports.size()); ++i)
+            {
+                EXPECT_STREQ(documentReports[i].m_path.c_str(), streamReports[i].m_path.c_str());
+                EXPECT_EQ(documentReports[i].m_outcome, streamReports[i].m_outcome);
+            }
+            return streamResult;
+        }
+
+        AZStd::unique_ptr<SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<JsonRegistrationContext> m_jsonRegistrationContext;
+        AZStd::unique_ptr<JsonSystemComponent> m_jsonSystemComponent;
+    };
+
+    TEST_F(JsonStreamingDeserializerTests, LoadStreaming_NestedClasses_MatchesDocumentLoad)
+    {
+        using namespace JsonStreamingDeserializerTestTypes;
+
+        const char* json = R"(
+            {
+                // Comments are supported the same way as for the regular loading.
+                "first": { "int": 42, "float": 2.5, "string": "hello" },
+                "second": { "string": "world", "int": -7, "float": 1.0 },
+                "values": [ 1, 2, 3, 4 ],
+                "inners": [ { "int": 1 }, { "int": 2, "string": "two" } ],
+                "flag": true
+            })";
+
+        Outer object;
+        JsonSerializationResult::ResultCode result = LoadAndCompare(object, json);
+        EXPECT_NE(JsonSerializationResult::Processing::Halted, result.GetProcessing());
+
+        EXPECT_EQ(42, object.m_first.m_int);
+        EXPECT_FLOAT_EQ(2.5f, object.m_first.m_float);
+        EXPECT_STREQ("hello", object.m_first.m_string.c_str());
+        EXPECT_EQ(-7, object.m_second.m_int);
+        EXPECT_STREQ("world", object.m_second.m_string.c_str());
+        ASSERT_EQ(4, object.m_values.size());
+        EXPECT_EQ(4, object.m_values[3]);
+        ASSERT_EQ(2, object.m_inners.size());
+        EXPECT_STREQ("two", object.m_inners[1].m_string.c_str());
+        EXPECT_TRUE(object.m_flag);
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadStreaming_UnknownFieldsAndTypeId_SkippedAsInDocumentLoad)
+    {
+        using namespace JsonStreamingDeserializerTestTypes;
+
+        const char* json = R"(
+            {
+                "$type": "Outer",
+                "unknown": { "nested": [ { "a": 1 }, "text" ], "more": null },
+                "first": { "int": 3, "unknownString": "ignored", "unknownArray": [ [ 1 ], { } ] },
+                "flag": true
+            })";
+
+        Outer object;
+        LoadAndCompare(object, json);
+        EXPECT_EQ(3, object.m_first.m_int);
+        EXPECT_TRUE(object.m_flag);
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadStreaming_ExplicitAndPartialDefaults_MatchesDocumentLoad)
+    {
+        using namespace JsonStreamingDeserializerTestTypes;
+
+        Outer explicitDefault;
+        LoadAndCompare(explicitDefault, R"({ "first": {}, "second": { "int": 1 } })");
+
+        Outer rootDefault;
+        JsonSerializationResult::ResultCode result = LoadAndCompare(rootDefault, "{}");
+        EXPECT_EQ(JsonSerializationResult::Outcomes::DefaultsUsed, result.GetOutcome());
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadStreaming_InvalidValue_MatchesDocumentLoad)
+    {
+        using namespace JsonStreamingDeserializerTestTypes;
+
+        Outer object;
+        LoadAndCompare(object, R"({ "first": { "int": "not a number", "string": 42 }, "values": { "a": 1 } })");
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadStreaming_NonClassRoot_LoadsThroughSerializer)
+    {
+        AZStd::vector<int> object;
+        LoadAndCompare(object, "[ 5, 6, 7 ]");
+        ASSERT_EQ(3, object.size());
+        EXPECT_EQ(7, object[2]);
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadStreaming_TextLargerThanReadBuffer_LoadsAllValues)
+    {
+        using namespace JsonStreamingDeserializerTestTypes;
+
+        constexpr size_t valueCount = 20000;
+        AZStd::string json = R"({ "first": { "string": ")";
+        json.append(valueCount, 'x');
+        json += R"(" }, "values": [)";
+        for (size_t i = 0; i < valueCount; ++i)
+        {
+            json += AZStd::string::format("%s%zu", i == 0 ? "" : ",", i);
+        }
+        json += R"(], "flag": true })";
+
+        Outer object;
+        LoadAndCompare(object, json);
+        EXPECT_EQ(valueCount, object.m_first.m_string.size());
+        ASSERT_EQ(valueCount, object.m_values.size());
+        EXPECT_EQ(aznumeric_cast<int>(valueCount - 1), object.m_values.back());
+        EXPECT_TRUE(object.m_flag);
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadStreaming_ParseError_ReportsCatastrophic)
+    {
+        using namespace JsonStreamingDeserializerTestTypes;
+
+        const char* json = R"({ "flag": true, "first": { "int": 1, )";
+
+        AZStd::vector<Report> reports;
+        Outer object;
+        IO::MemoryStream stream(json, strlen(json));
+        JsonSerializationResult::ResultCode result = JsonSerialization::LoadStreaming(object, stream, CreateSettings(reports));
+
+        EXPECT_EQ(JsonSerializationResult::Processing::Halted, result.GetProcessing());
+        EXPECT_EQ(JsonSerializationResult::Outcomes::Catastrophic, result.GetOutcome());
+        ASSERT_FALSE(reports.empty());
+        EXPECT_EQ(JsonSerializationResult::Outcomes::Catastrophic, reports.back().m_outcome);
+        // Values that were read before the error are kept.
+        EXPECT_TRUE(object.m_flag);
+    }
+} // namespace UnitTest
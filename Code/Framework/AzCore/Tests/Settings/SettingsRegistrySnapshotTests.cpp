@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+#include <AzTest/Utils.h>
+
+namespace SettingsRegistrySnapshotTests
+{
+    class SettingsRegistrySnapshotTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_registrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+
+            m_snapshotPath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Snapshot" / "Test.setregsnapshot";
+            m_registryFolder = m_tempDirectory.GetDirectoryAsFixedMaxPath() / AZ::SettingsRegistryInterface::RegistryFolder;
+            AZ::Test::CreateTestFile(m_tempDirectory, AZ::IO::FixedMaxPath(AZ::SettingsRegistryInterface::RegistryFolder) / "a.setreg",
+                R"({ "Test": { "String": "Hello", "Integer": -12, "Unsigned": 18446744073709551615, "Double": 0.1 } })");
+            AZ::Test::CreateTestFile(m_tempDirectory, AZ::IO::FixedMaxPath(AZ::SettingsRegistryInterface::RegistryFolder) / "b.setreg",
+                R"({ "Test": { "Array": [ true, false, null, [ 1, 2 ], { "Nested": "Value" } ], "Empty": {} } })");
+        }
+
+        void TearDown() override
+        {
+            m_registrationContext->EnableRemoveReflection();
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+            m_registrationContext->DisableRemoveReflection();
+
+            m_registrationContext.reset();
+            m_serializeContext.reset();
+        }
+
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> CreateRegistry()
+        {
+            auto registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            registry->SetContext(m_serializeContext.get());
+            registry->SetContext(m_registrationContext.get());
+            return registry;
+        }
+
+        AZ::HashValue64 RecordAndStoreSnapshot(AZ::SettingsRegistryImpl& registry, AZ::HashValue64 key = AZ::HashValue64{ 42 })
+        {
+            registry.StartSnapshotRecording();
+            EXPECT_TRUE(registry.MergeSettingsFolder(m_registryFolder.Native(), {}, {}));
+            EXPECT_TRUE(registry.StoreSnapshot(m_snapshotPath.c_str(), key));
+            return registry.GetContentHash(AZ::HashValue64{ 0 });
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_registrationContext;
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZ::IO::FixedMaxPath m_snapshotPath;
+        AZ::IO::FixedMaxPath m_registryFolder;
+    };
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_UnchangedInputs_RestoresAllValues)
+    {
+        auto sourceRegistry = CreateRegistry();
+        const AZ::HashValue64 sourceHash = RecordAndStoreSnapshot(*sourceRegistry);
+
+        auto registry = CreateRegistry();
+        ASSERT_TRUE(registry->LoadSnapshot(m_snapshotPath.c_str(), AZ::HashValue64{ 42 }));
+        EXPECT_EQ(sourceHash, registry->GetContentHash(AZ::HashValue64{ 0 }));
+
+        AZStd::string stringValue;
+        EXPECT_TRUE(registry->Get(stringValue, "/Test/String"));
+        EXPECT_STREQ("Hello", stringValue.c_str());
+        AZ::s64 intValue = 0;
+        EXPECT_TRUE(registry->Get(intValue, "/Test/Integer"));
+        EXPECT_EQ(-12, intValue);
+        AZ::u64 unsignedValue = 0;
+        EXPECT_TRUE(registry->Get(unsignedValue, "/Test/Unsigned"));
+        EXPECT_EQ(AZStd::numeric_limits<AZ::u64>::max(), unsignedValue);
+        double doubleValue = 0.0;
+        EXPECT_TRUE(registry->Get(doubleValue, "/Test/Double"));
+        EXPECT_EQ(0.1, doubleValue);
+        EXPECT_TRUE(registry->Get(stringValue, "/Test/Array/4/Nested"));
+        EXPECT_STREQ("Value", stringValue.c_str());
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, registry->GetType("/Test/Empty").m_type);
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_SignalsRootNotification)
+    {
+        auto sourceRegistry = CreateRegistry();
+        RecordAndStoreSnapshot(*sourceRegistry);
+
+        auto registry = CreateRegistry();
+        size_t notifyCount = 0;
+        auto notifier = registry->RegisterNotifier([&notifyCount](const AZ::SettingsRegistryInterface::NotifyEventArgs& notifyEventArgs)
+            {
+                EXPECT_TRUE(notifyEventArgs.m_jsonKeyPath.empty());
+                ++notifyCount;
+            });
+        ASSERT_TRUE(registry->LoadSnapshot(m_snapshotPath.c_str(), AZ::HashValue64{ 42 }));
+        EXPECT_EQ(1, notifyCount);
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_DifferentKey_Fails)
+    {
+        auto sourceRegistry = CreateRegistry();
+        RecordAndStoreSnapshot(*sourceRegistry);
+
+        auto registry = CreateRegistry();
+        EXPECT_FALSE(registry->LoadSnapshot(m_snapshotPath.c_str(), AZ::HashValue64{ 43 }));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, registry->GetType("/Test").m_type);
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_ChangedFile_Fails)
+    {
+        auto sourceRegistry = CreateRegistry();
+        RecordAndStoreSnapshot(*sourceRegistry);
+
+        AZ::Test::CreateTestFile(m_tempDirectory, AZ::IO::FixedMaxPath(AZ::SettingsRegistryInterface::RegistryFolder) / "a.setreg",
+            R"({ "Test": { "String": "Changed" } })");
+
+        auto registry = CreateRegistry();
+        EXPECT_FALSE(registry->LoadSnapshot(m_snapshotPath.c_str(), AZ::HashValue64{ 42 }));
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_FileAddedToFolder_Fails)
+    {
+        auto sourceRegistry = CreateRegistry();
+        RecordAndStoreSnapshot(*sourceRegistry);
+
+        AZ::Test::CreateTestFile(m_tempDirectory, AZ::IO::FixedMaxPath(AZ::SettingsRegistryInterface::RegistryFolder) / "c.setreg",
+            R"({ "Test": { "Added": true } })");
+
+        auto registry = CreateRegistry();
+        EXPECT_FALSE(registry->LoadSnapshot(m_snapshotPath.c_str(), AZ::HashValue64{ 42 }));
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_MissingFileCreated_Fails)
+    {
+        const AZ::IO::FixedMaxPath missingPath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "missing.setreg";
+
+        auto sourceRegistry = CreateRegistry();
+        sourceRegistry->StartSnapshotRecording();
+        EXPECT_FALSE(sourceRegistry->MergeSettingsFile(missingPath.Native(), AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        EXPECT_TRUE(sourceRegistry->StoreSnapshot(m_snapshotPath.c_str(), AZ::HashValue64{ 42 }));
+
+        auto registry = CreateRegistry();
+        EXPECT_TRUE(registry->LoadSnapshot(m_snapshotPath.c_str(), AZ::HashValue64{ 42 }));
+
+        AZ::Test::CreateTestFile(m_tempDirectory, "missing.setreg", R"({ "Test": 1 })");
+        EXPECT_FALSE(registry->LoadSnapshot(m_snapshotPath.c_str(), AZ::HashValue64{ 42 }));
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, StoreSnapshot_NotRecording_Fails)
+    {
+        auto registry = CreateRegistry();
+        EXPECT_TRUE(registry->MergeSettingsFolder(m_registryFolder.Native(), {}, {}));
+        EXPECT_FALSE(registry->StoreSnapshot(m_snapshotPath.c_str(), AZ::HashValue64{ 42 }));
+        EXPECT_FALSE(AZ::IO::SystemFile::Exists(m_snapshotPath.c_str()));
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, Load_TruncatedSnapshot_FailsWithoutChangingSettings)
+    {
+        rapidjson::Document settings;
+        settings.Parse(R"({ "Test": { "Array": [ 1, 2, 3 ], "String": "Text" } })");
+        AZStd::vector<AZ::u8> buffer;
+        AZ::SettingsRegistrySnapshot::Store(buffer, AZ::HashValue64{ 7 }, {}, settings);
+
+        rapidjson::Document restored;
+        restored.Parse(R"({ "Original": true })");
+        for (size_t size = 0; size < buffer.size(); ++size)
+        {
+            EXPECT_FALSE(AZ::SettingsRegistrySnapshot::Load(restored, AZStd::span<const AZ::u8>(buffer.data(), size), AZ::HashValue64{ 7 }, nullptr));
+        }
+        EXPECT_TRUE(restored.HasMember("Original"));
+
+        ASSERT_TRUE(AZ::SettingsRegistrySnapshot::Load(restored, AZStd::span<const AZ::u8>(buffer), AZ::HashValue64{ 7 }, nullptr));
+        EXPECT_TRUE(restored == settings);
+    }
+} // namespace SettingsRegistrySnapshotTests
@@ -9,6 +9,7 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzTest/AzTest.h>
+#include <AzCore/IO/FramedCompression.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
@@ -135,6 +136,19 @@ namespace AZ::IO
             m_context->MarkRequestAsCompleted(request);
         }
 
+        void PrepareFramedReadRequest(FileRequest* request)
+        {
+            auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+
+            // Reads are aligned, so they may extend past the end of the fake archive.
+            ASSERT_LE(data->m_offset, m_framedFile.size());
+            u64 size = AZStd::min(data->m_size, m_framedFile.size() - data->m_offset);
+            memcpy(data->m_output, m_framedFile.data() + data->m_offset, size);
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
         void PrepareFailedReadRequest(FileRequest* request)
         {
             request->SetStatus(IStreamerTypes::RequestStatus::Failed);
@@ -272,6 +286,78 @@ namespace AZ::IO
             EXPECT_TRUE(allCompleted);
         }
 
+        void CreateFramedFile(u32 frameSize)
+        {
+            AZStd::unique_ptr<u32[]> uncompressed = AZStd::unique_ptr<u32[]>(new u32[m_fakeFileLength >> 2]);
+            for (u64 i = 0; i < (m_fakeFileLength >> 2); ++i)
+            {
+                uncompressed[i] = aznumeric_caster(i << 2);
+            }
+
+            // Use a copy as the fake compression algorithm so the frame size and compressed size are the same.
+            bool result = FramedCompression::Compress(m_framedFile, uncompressed.get(), m_fakeFileLength, frameSize, frameSize,
+                [](const void* source, size_t sourceSize, void* target, [[maybe_unused]] size_t targetSize) -> size_t
+                {
+                    memcpy(target, source, sourceSize);
+                    return sourceSize;
+                });
+            ASSERT_TRUE(result);
+        }
+
+        void ProcessFramedRead(u64 offset, u64 size, IStreamerTypes::RequestStatus expectedResult)
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Return;
+
+            EXPECT_CALL(*m_mock, ExecuteRequests())
+                .WillOnce(Return(true))
+                .WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, QueueRequest(_));
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+            ON_CALL(*m_mock, QueueRequest(_))
+                .WillByDefault(Invoke(this, &Streamer_FullDecompressorTest::PrepareFramedReadRequest));
+
+            CompressionInfo compressionInfo;
+            compressionInfo.m_compressedSize = m_framedFile.size();
+            compressionInfo.m_isCompressed = true;
+            compressionInfo.m_isFramed = true;
+            compressionInfo.m_offset = 0;
+            compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            compressionInfo.m_decompressor = [this](const CompressionInfo&, const void* compressed,
+                size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize) -> bool
+            {
+                ++m_numFramesDecompressed;
+                return Streamer_FullDecompressorTest::Decompressor(false,
+                    compressed, compressedSize, uncompressed, uncompressedBufferSize);
+            };
+
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), m_buffer, offset, size);
+            bool result = true;
+            auto completed = [&result, expectedResult](const FileRequest& request)
+            {
+                result = result && request.GetStatus() == expectedResult;
+            };
+            request->SetCompletionCallback(completed);
+
+            m_decompressor->QueueRequest(request);
+            bool hasCompleted = false;
+            while (m_decompressor->ExecuteRequests() || !hasCompleted)
+            {
+                StreamStackEntry::Status status;
+                m_decompressor->UpdateStatus(status);
+                if (status.m_isIdle)
+                {
+                    hasCompleted = true;
+                }
+
+                m_context->FinalizeCompletedRequests();
+            }
+
+            EXPECT_TRUE(result);
+        }
+
         void VerifyReadBuffer(u32* buffer, u64 offset, u64 size)
         {
             size = size >> 2;
@@ -292,6 +378,8 @@ namespace AZ::IO
         StreamerContext* m_context;
         AZStd::shared_ptr<FullFileDecompressor> m_decompressor;
         AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        AZStd::vector<u8> m_framedFile;
+        AZStd::atomic_int m_numFramesDecompressed{ 0 };
         u64 m_fakeFileLength{ 1 * 1024 * 1024 };
     };
 
@@ -348,6 +436,37 @@ namespace AZ::IO
         ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Corrupted, IStreamerTypes::RequestStatus::Failed);
     }
 
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadOfFramedFile_AllFramesDecompressed)
+    {
+        constexpr u32 FrameSize = 64 * 1024;
+        SetupEnvironment();
+        CreateFramedFile(FrameSize);
+        ProcessFramedRead(0, m_fakeFileLength, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(0, m_fakeFileLength);
+        EXPECT_EQ(m_fakeFileLength / FrameSize, m_numFramesDecompressed);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_PartialReadOfFramedFile_OnlyOverlappingFramesDecompressed)
+    {
+        constexpr u32 FrameSize = 64 * 1024;
+        SetupEnvironment();
+        CreateFramedFile(FrameSize);
+        // Start halfway through the second frame and end halfway through the fourth.
+        ProcessFramedRead(FrameSize + FrameSize / 2, 2 * FrameSize, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(FrameSize + FrameSize / 2, 2 * FrameSize);
+        EXPECT_EQ(3, m_numFramesDecompressed);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FramedFileWithCorruptedFrameTable_RequestIsCompletedWithFailedState)
+    {
+        SetupEnvironment();
+        CreateFramedFile(64 * 1024);
+        m_framedFile[0] = 0;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        ProcessFramedRead(0, m_fakeFileLength, IStreamerTypes::RequestStatus::Failed);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_MultipleRequestsWithSingleJob_AllRequestsComplete)
     {
         SetupEnvironment(4, 1);
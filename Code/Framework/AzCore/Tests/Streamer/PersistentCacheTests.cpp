@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/PersistentCache.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class PersistentCacheTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<PersistentCache>
+    {
+    public:
+        PersistentCache CreateInstance() override
+        {
+            return PersistentCache("@user@/StreamerCacheTests", 16 * 1024 * 1024, 1024 * 1024, 0);
+        }
+
+        bool UsesSlots() const override
+        {
+            return false;
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(Streamer_PersistentCacheConformityTests, StreamStackEntryConformityTests, PersistentCacheTestDescription);
+
+    class Streamer_PersistentCacheTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        static constexpr u64 FileSize = 64 * 1024;
+
+        void SetUp() override
+        {
+            UnitTest::LeakDetectionFixture::SetUp();
+
+            m_archivePath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Archive.pak";
+            m_cachePath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Cache";
+            WriteArchive();
+
+            m_context = new StreamerContext();
+            m_mock = AZStd::make_shared<::testing::NiceMock<StreamStackEntryMock>>();
+            ON_CALL(*m_mock, QueueRequest(::testing::_))
+                .WillByDefault(::testing::Invoke(this, &Streamer_PersistentCacheTest::ProcessRequest));
+        }
+
+        void TearDown() override
+        {
+            m_cache.reset();
+            m_mock.reset();
+
+            delete m_context;
+            m_context = nullptr;
+
+            UnitTest::LeakDetectionFixture::TearDown();
+        }
+
+        void CreateCache(u64 cacheSize)
+        {
+            m_cache = AZStd::make_shared<PersistentCache>(m_cachePath.Native(), cacheSize, 1024 * 1024, 0);
+            m_cache->SetContext(*m_context);
+            m_cache->SetNext(m_mock);
+        }
+
+        void WriteArchive()
+        {
+            // The content of the archive isn't used as the mock provides the decompressed data.
+            SystemFile archive;
+            ASSERT_TRUE(archive.Open(m_archivePath.c_str(),
+                SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY));
+            archive.Write(m_archivePath.c_str(), m_archivePath.Native().size());
+            archive.Close();
+        }
+
+        // Fakes the decompressor for compressed reads and reads the cached files from disk for regular reads.
+        void ProcessRequest(FileRequest* request)
+        {
+            bool success = true;
+            if (auto compressed = AZStd::get_if<Requests::CompressedReadData>(&request->GetCommand()); compressed != nullptr)
+            {
+                ++m_numDecompressions;
+                u8* output = reinterpret_cast<u8*>(compressed->m_output);
+                for (u64 i = 0; i < compressed->m_readSize; ++i)
+                {
+                    output[i] = GetExpectedValue(compressed->m_compressionInfo.m_offset, compressed->m_readOffset + i);
+                }
+            }
+            else if (auto read = AZStd::get_if<Requests::ReadData>(&request->GetCommand()); read != nullptr)
+            {
+                ++m_numCacheReads;
+                SystemFile file;
+                success = file.Open(read->m_path.GetAbsolutePathCStr(), SystemFile::SF_OPEN_READ_ONLY);
+                if (success)
+                {
+                    file.Seek(read->m_offset, SystemFile::SF_SEEK_BEGIN);
+                    success = file.Read(read->m_size, read->m_output) == read->m_size;
+                    file.Close();
+                }
+            }
+            request->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        static u8 GetExpectedValue(u64 fileOffset, u64 index)
+        {
+            return aznumeric_cast<u8>((fileOffset / FileSize + index) & 0xff);
+        }
+
+        // Runs the cache until all reads have completed and all files have been written.
+        void ProcessTillIdle()
+        {
+            while (true)
+            {
+                bool hasWork = m_cache->ExecuteRequests();
+                hasWork = m_context->FinalizeCompletedRequests() || hasWork;
+                StreamStackEntry::Status status;
+                m_cache->UpdateStatus(status);
+                if (!hasWork && status.m_isIdle)
+                {
+                    break;
+                }
+                AZStd::this_thread::yield();
+            }
+        }
+
+        // Reads the file with the given index from the archive and checks if the correct data was returned.
+        void ReadFile(u64 fileIndex)
+        {
+            CompressionInfo info;
+            info.m_archiveFilename = RequestPath(AZ::IO::PathView(m_archivePath));
+            info.m_offset = fileIndex * FileSize;
+            info.m_compressedSize = FileSize / 2;
+            info.m_uncompressedSize = FileSize;
+            info.m_isCompressed = true;
+
+            AZStd::vector<u8> buffer(FileSize, 0);
+            IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, AZStd::move(info), buffer.data(), 0, FileSize);
+            request->SetCompletionCallback([&result](const FileRequest& request)
+                {
+                    result = request.GetStatus();
+                });
+            m_cache->QueueRequest(request);
+            ProcessTillIdle();
+
+            ASSERT_EQ(IStreamerTypes::RequestStatus::Completed, result);
+            for (u64 i = 0; i < FileSize; ++i)
+            {
+                ASSERT_EQ(GetExpectedValue(fileIndex * FileSize, i), buffer[i]);
+            }
+        }
+
+        AZStd::vector<AZStd::string> FindCachedFiles() const
+        {
+            AZStd::vector<AZStd::string> files;
+            AZ::IO::FixedMaxPath filter(m_cachePath);
+            filter /= "*.bin";
+            SystemFile::FindFiles(filter.c_str(), [this, &files](const char* fileName, bool isFile)
+                {
+                    AZ::IO::PathView name = AZ::IO::PathView(fileName).Filename();
+                    if (isFile && name != "index.bin")
+                    {
+                        files.emplace_back((AZ::IO::FixedMaxPath(m_cachePath) / name).c_str());
+                    }
+                    return true;
+                });
+            return files;
+        }
+
+        void DeleteIndex()
+        {
+            AZ::IO::FixedMaxPath indexPath(m_cachePath);
+            indexPath /= "index.bin";
+            ASSERT_TRUE(SystemFile::Delete(indexPath.c_str()));
+        }
+
+    protected:
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZ::IO::FixedMaxPath m_archivePath;
+        AZ::IO::FixedMaxPath m_cachePath;
+        StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<::testing::NiceMock<StreamStackEntryMock>> m_mock;
+        AZStd::shared_ptr<PersistentCache> m_cache;
+        size_t m_numDecompressions{ 0 };
+        size_t m_numCacheReads{ 0 };
+    };
+
+    TEST_F(Streamer_PersistentCacheTest, ReadFile_NotCached_FileIsDecompressedAndCached)
+    {
+        CreateCache(1024 * 1024);
+        ReadFile(0);
+
+        EXPECT_EQ(1, m_numDecompressions);
+        EXPECT_EQ(0, m_numCacheReads);
+        EXPECT_EQ(1, FindCachedFiles().size());
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, ReadFile_Cached_FileIsReadFromCache)
+    {
+        CreateCache(1024 * 1024);
+        ReadFile(0);
+        ReadFile(0);
+
+        EXPECT_EQ(1, m_numDecompressions);
+        EXPECT_EQ(1, m_numCacheReads);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, ReadFile_CachedInPreviousSession_FileIsReadFromCache)
+    {
+        CreateCache(1024 * 1024);
+        ReadFile(0);
+        m_cache.reset();
+
+        CreateCache(1024 * 1024);
+        ReadFile(0);
+
+        EXPECT_EQ(1, m_numDecompressions);
+        EXPECT_EQ(1, m_numCacheReads);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, ReadFile_ArchiveModified_CachedFileIsIgnored)
+    {
+        CreateCache(1024 * 1024);
+        ReadFile(0);
+        m_cache.reset();
+
+        // Modification times may only have a resolution of a second, so keep updating the archive until the time changes.
+        const u64 originalTime = SystemFile::ModificationTime(m_archivePath.c_str());
+        for (int i = 0; i < 50 && SystemFile::ModificationTime(m_archivePath.c_str()) == originalTime; ++i)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(100));
+            WriteArchive();
+        }
+        ASSERT_NE(originalTime, SystemFile::ModificationTime(m_archivePath.c_str()));
+
+        CreateCache(1024 * 1024);
+        ReadFile(0);
+
+        EXPECT_EQ(2, m_numDecompressions);
+        EXPECT_EQ(0, m_numCacheReads);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, ReadFile_CacheFull_LeastRecentlyUsedFileIsEvicted)
+    {
+        CreateCache(3 * FileSize);
+        ReadFile(0);
+        ReadFile(1);
+        ReadFile(2);
+        // Use the first file again so the second file becomes the least recently used file.
+        ReadFile(0);
+        ReadFile(3);
+        EXPECT_EQ(4, m_numDecompressions);
+        EXPECT_EQ(1, m_numCacheReads);
+        EXPECT_EQ(3, FindCachedFiles().size());
+
+        ReadFile(0);
+        EXPECT_EQ(4, m_numDecompressions);
+        EXPECT_EQ(2, m_numCacheReads);
+
+        ReadFile(1);
+        EXPECT_EQ(5, m_numDecompressions);
+        EXPECT_EQ(2, m_numCacheReads);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, ReadFile_IndexMissing_IndexIsRebuiltFromCachedFiles)
+    {
+        CreateCache(1024 * 1024);
+        ReadFile(0);
+        ReadFile(1);
+        m_cache.reset();
+
+        // Simulate a crash before the index was stored.
+        DeleteIndex();
+
+        CreateCache(1024 * 1024);
+        ReadFile(0);
+        ReadFile(1);
+
+        EXPECT_EQ(2, m_numDecompressions);
+        EXPECT_EQ(2, m_numCacheReads);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, ReadFile_IncompleteCachedFiles_FilesAreRemoved)
+    {
+        CreateCache(1024 * 1024);
+        ReadFile(0);
+        m_cache.reset();
+        DeleteIndex();
+
+        // Truncate the cached file and add a file that was never completely written.
+        AZStd::vector<AZStd::string> cachedFiles = FindCachedFiles();
+        ASSERT_EQ(1, cachedFiles.size());
+        AZ::IO::FixedMaxPath orphanPath(m_cachePath);
+        orphanPath /= "0123456789abcdef.bin";
+        for (const char* path : { cachedFiles[0].c_str(), orphanPath.c_str() })
+        {
+            SystemFile file;
+            ASSERT_TRUE(file.Open(path, SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_WRITE_ONLY));
+            file.Write(path, 8);
+            file.Close();
+        }
+
+        CreateCache(1024 * 1024);
+        ReadFile(0);
+
+        EXPECT_EQ(2, m_numDecompressions);
+        EXPECT_EQ(0, m_numCacheReads);
+        EXPECT_FALSE(SystemFile::Exists(orphanPath.c_str()));
+        EXPECT_EQ(1, FindCachedFiles().size());
+    }
+} // namespace AZ::IO
@@ -56,7 +56,7 @@ namespace AZ::IO
 
             auto isIdle = m_isStackIdle.load();
             m_isStackIdle = true;
-            m_streamer = aznew IO::Streamer(AZStd::thread_desc{}, AZStd::make_unique<Scheduler>(m_mock));
+            m_streamer = aznew IO::Streamer(AZStd::thread_desc{}, CreateScheduler());
             m_isStackIdle = isIdle;
             Interface<IO::IStreamer>::Register(m_streamer);
         }
@@ -75,6 +75,11 @@ namespace AZ::IO
             UnitTest::LeakDetectionFixture::TearDown();
         }
 
+        virtual AZStd::unique_ptr<Scheduler> CreateScheduler()
+        {
+            return AZStd::make_unique<Scheduler>(m_mock);
+        }
+
         void MockForRead()
         {
             using ::testing::_;
@@ -428,4 +433,90 @@ namespace AZ::IO
             m_streamer->m_streamStack->Thread_PrioritizeRequests(&sameFileRequest->m_request, &sameFileRequest2->m_request),
             Scheduler::Order::Equal);
     }
+
+    class Streamer_SchedulerCoalescingTest
+        : public Streamer_SchedulerTest
+    {
+    public:
+        AZStd::unique_ptr<Scheduler> CreateScheduler() override
+        {
+            ReadCoalescingConfig coalescing;
+            coalescing.m_enabled = true;
+            return AZStd::make_unique<Scheduler>(m_mock, AZCORE_GLOBAL_NEW_ALIGNMENT, 1, 1_mib, coalescing);
+        }
+    };
+
+    TEST_F(Streamer_SchedulerCoalescingTest, QueueNextRequest_QueueNearbyReadsInSameFile_ReadsAreMergedIntoSingleRead)
+    {
+        using ::testing::_;
+        using ::testing::AtLeast;
+
+        constexpr static size_t ReadCount = 3;
+        constexpr static size_t ReadSize = 8;
+        // The last read leaves a gap which is read and discarded.
+        constexpr static u64 Offsets[ReadCount] = { 0, 8, 24 };
+
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AtLeast(1));
+        EXPECT_CALL(*m_mock, UpdateCompletionEstimates(_, _, _, _)).Times(AtLeast(1));
+        EXPECT_CALL(*m_mock, PrepareRequest(_))
+            .Times(ReadCount)
+            .WillRepeatedly([this](FileRequest* request)
+                {
+                    auto readData = AZStd::get_if<Requests::ReadRequestData>(&request->GetCommand());
+                    ASSERT_NE(nullptr, readData);
+                    FileRequest* read = m_streamerContext->GetNewInternalRequest();
+                    read->CreateRead(request, readData->m_output, readData->m_outputSize, readData->m_path,
+                        readData->m_offset, readData->m_size);
+                    m_streamerContext->PushPreparedRequest(read);
+                });
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AtLeast(1));
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(1)
+            .WillOnce([this](FileRequest* request)
+                {
+                    auto readData = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+                    ASSERT_NE(nullptr, readData);
+                    EXPECT_EQ(0, readData->m_offset);
+                    EXPECT_EQ(Offsets[ReadCount - 1] + ReadSize, readData->m_size);
+                    auto output = reinterpret_cast<uint8_t*>(readData->m_output);
+                    for (size_t i = 0; i < readData->m_size; ++i)
+                    {
+                        output[i] = azlossy_cast<uint8_t>(readData->m_offset + i);
+                    }
+                    request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_streamerContext->MarkRequestAsCompleted(request);
+                });
+
+        AZStd::atomic_int counter = ReadCount;
+        AZStd::binary_semaphore sync;
+        auto wait = [&sync, &counter](FileRequestHandle)
+        {
+            if (--counter == 0)
+            {
+                sync.release();
+            }
+        };
+
+        u8 buffers[ReadCount][ReadSize];
+        FileRequestPtr reads[ReadCount];
+        m_streamer->SuspendProcessing();
+        for (size_t i = 0; i < ReadCount; ++i)
+        {
+            reads[i] = m_streamer->Read("TestPath", buffers[i], ReadSize, ReadSize, IStreamerTypes::s_noDeadline,
+                IStreamerTypes::s_priorityMedium, Offsets[i]);
+            m_streamer->SetRequestCompleteCallback(reads[i], wait);
+            m_streamer->QueueRequest(reads[i]);
+        }
+        m_streamer->ResumeProcessing();
+
+        ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+        for (size_t i = 0; i < ReadCount; ++i)
+        {
+            EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(reads[i]));
+            for (size_t j = 0; j < ReadSize; ++j)
+            {
+                EXPECT_EQ(azlossy_cast<u8>(Offsets[i] + j), buffers[i][j]);
+            }
+        }
+    }
 } // namespace AZ::IO
@@ -0,0 +1,434 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+#include <FileIOBaseTestTypes.h>
+
+namespace AZ::IO
+{
+    class Streamer_StreamerTraceTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            m_prevFileIO = FileIOBase::GetInstance();
+            FileIOBase::SetInstance(nullptr);
+            FileIOBase::SetInstance(&m_fileIO);
+        }
+
+        void TearDown() override
+        {
+            FileIOBase::SetInstance(nullptr);
+            FileIOBase::SetInstance(m_prevFileIO);
+
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        static StreamerTrace CreateTrace()
+        {
+            StreamerTrace trace;
+            StreamerTraceEntry entry;
+            entry.m_pathIndex = trace.AddPath("@products@/levels/level.pak");
+            entry.m_offset = 1024;
+            entry.m_size = 4096;
+            entry.m_priority = IStreamerTypes::s_priorityHigh;
+            entry.m_status = IStreamerTypes::RequestStatus::Completed;
+            entry.m_queueTime = 10;
+            entry.m_completionTime = 250;
+            entry.m_deadline = 1000;
+            trace.AddEntry(entry);
+
+            entry.m_pathIndex = trace.AddPath("@products@/textures/texture.dds");
+            entry.m_offset = 0;
+            entry.m_size = 64;
+            entry.m_priority = IStreamerTypes::s_priorityLow;
+            entry.m_status = IStreamerTypes::RequestStatus::Failed;
+            entry.m_queueTime = 20;
+            entry.m_completionTime = 30;
+            entry.m_deadline = StreamerTraceEntry::NoDeadline;
+            trace.AddEntry(entry);
+            return trace;
+        }
+
+        static void ExpectEqual(const StreamerTrace& lhs, const StreamerTrace& rhs)
+        {
+            ASSERT_EQ(lhs.GetPaths().size(), rhs.GetPaths().size());
+            for (size_t i = 0; i < lhs.GetPaths().size(); ++i)
+            {
+                EXPECT_STREQ(lhs.GetPaths()[i].c_str(), rhs.GetPaths()[i].c_str());
+            }
+            ASSERT_EQ(lhs.GetEntries().size(), rhs.GetEntries().size());
+            for (size_t i = 0; i < lhs.GetEntries().size(); ++i)
+            {
+                const StreamerTraceEntry& left = lhs.GetEntries()[i];
+                const StreamerTraceEntry& right = rhs.GetEntries()[i];
+                EXPECT_EQ(left.m_pathIndex, right.m_pathIndex);
+                EXPECT_EQ(left.m_offset, right.m_offset);
+                EXPECT_EQ(left.m_size, right.m_size);
+                EXPECT_EQ(left.m_priority, right.m_priority);
+                EXPECT_EQ(left.m_status, right.m_status);
+                EXPECT_EQ(left.m_queueTime, right.m_queueTime);
+                EXPECT_EQ(left.m_completionTime, right.m_completionTime);
+                EXPECT_EQ(left.m_deadline, right.m_deadline);
+            }
+        }
+
+        UnitTest::TestFileIOBase m_fileIO;
+        FileIOBase* m_prevFileIO{ nullptr };
+    };
+
+    TEST_F(Streamer_StreamerTraceTest, AddPath_SamePathTwice_ReturnsSameIndex)
+    {
+        StreamerTrace trace;
+        u32 first = trace.AddPath("file0.bin");
+        u32 second = trace.AddPath("file1.bin");
+        EXPECT_NE(first, second);
+        EXPECT_EQ(first, trace.AddPath("file0.bin"));
+        EXPECT_EQ(2, trace.GetPaths().size());
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, SaveLoad_BufferRoundTrip_TraceIsUnchanged)
+    {
+        StreamerTrace trace = CreateTrace();
+        AZStd::vector<u8> buffer;
+        ASSERT_TRUE(trace.Save(buffer));
+
+        StreamerTrace loaded;
+        ASSERT_TRUE(loaded.Load(buffer.data(), buffer.size()));
+        ExpectEqual(trace, loaded);
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, SaveLoad_FileRoundTrip_TraceIsUnchanged)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        AZ::IO::Path tracePath = tempDirectory.GetDirectory();
+        tracePath /= "Streamer.trace";
+
+        StreamerTrace trace = CreateTrace();
+        ASSERT_TRUE(trace.Save(tracePath.Native()));
+
+        StreamerTrace loaded;
+        ASSERT_TRUE(loaded.Load(tracePath.Native()));
+        ExpectEqual(trace, loaded);
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, Load_TruncatedBuffer_FailsAndLeavesTraceEmpty)
+    {
+        StreamerTrace trace = CreateTrace();
+        AZStd::vector<u8> buffer;
+        ASSERT_TRUE(trace.Save(buffer));
+
+        StreamerTrace loaded;
+        EXPECT_FALSE(loaded.Load(buffer.data(), buffer.size() - 1));
+        EXPECT_TRUE(loaded.GetPaths().empty());
+        EXPECT_TRUE(loaded.GetEntries().empty());
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, Load_InvalidMagic_Fails)
+    {
+        StreamerTrace trace = CreateTrace();
+        AZStd::vector<u8> buffer;
+        ASSERT_TRUE(trace.Save(buffer));
+        buffer[0] ^= 0xff;
+
+        StreamerTrace loaded;
+        EXPECT_FALSE(loaded.Load(buffer.data(), buffer.size()));
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, Recorder_QueuedAndCompletedRead_EntryStoredInTraceFile)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        AZ::IO::Path tracePath = tempDirectory.GetDirectory();
+        tracePath /= "Recorded.trace";
+
+        StreamerContext context;
+        FileRequest* request = context.GetNewInternalRequest();
+        char buffer[16];
+        auto queueTime = AZStd::chrono::steady_clock::now();
+        request->CreateReadRequest(RequestPath(AZ::IO::PathView("TestFile.bin")), buffer, sizeof(buffer), 8, sizeof(buffer),
+            queueTime + AZStd::chrono::milliseconds(5), IStreamerTypes::s_priorityHigh);
+
+        StreamerTraceRecorder recorder;
+        EXPECT_FALSE(recorder.IsRecording());
+        recorder.Start(tracePath.Native());
+        EXPECT_TRUE(recorder.IsRecording());
+
+        recorder.RecordQueued(*request, queueTime);
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        recorder.RecordCompleted(*request, queueTime + AZStd::chrono::milliseconds(2));
+        recorder.Stop();
+        EXPECT_FALSE(recorder.IsRecording());
+
+        StreamerTrace loaded;
+        ASSERT_TRUE(loaded.Load(tracePath.Native()));
+        ASSERT_EQ(1, loaded.GetEntries().size());
+        const StreamerTraceEntry& entry = loaded.GetEntries()[0];
+        EXPECT_STREQ("TestFile.bin", loaded.GetPaths()[entry.m_pathIndex].c_str());
+        EXPECT_EQ(8, entry.m_offset);
+        EXPECT_EQ(sizeof(buffer), entry.m_size);
+        EXPECT_EQ(IStreamerTypes::s_priorityHigh, entry.m_priority);
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, entry.m_status);
+        EXPECT_EQ(5000, entry.m_deadline);
+        EXPECT_EQ(2000, entry.m_completionTime - entry.m_queueTime);
+
+        context.RecycleRequest(request);
+    }
+} // namespace AZ::IO
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/Streamer/BlockCache.h>
+#include <AzCore/IO/Streamer/ReadSplitter.h>
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Replays a Streamer trace against different stream stacks. Set AZ_STREAMER_TRACE to the path of a trace captured
+    //! with cl_streamerTraceFile to replay a real load, otherwise a synthetic trace is generated. Requests are issued at
+    //! the same time offsets as in the capture, so the results show how a stack would have handled the original load.
+    class StreamerTraceReplayFixture
+        : public benchmark::Fixture
+    {
+    public:
+        enum class Stack : int64_t
+        {
+            StorageDrive,
+            BlockCache,
+            ReadSplitterAndBlockCache
+        };
+
+        constexpr static size_t SyntheticFileCount = 8;
+        constexpr static size_t SyntheticFileSize = 4_mib;
+        constexpr static size_t SyntheticRequestCount = 512;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void TearDown(const benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            InternalTearDown();
+        }
+
+        void Replay(benchmark::State& state)
+        {
+            using namespace AZ::IO;
+            using namespace AZStd::chrono;
+
+            const AZStd::vector<StreamerTraceEntry>& entries = m_trace.GetEntries();
+            AZStd::vector<AZStd::unique_ptr<AZ::u8[]>> buffers;
+            buffers.resize(entries.size());
+            for (size_t i = 0; i < entries.size(); ++i)
+            {
+                buffers[i].reset(new AZ::u8[entries[i].m_size]);
+            }
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZStd::binary_semaphore allCompleted;
+                AZStd::atomic_uint64_t remaining{ entries.size() };
+                AZStd::atomic_uint64_t missedDeadlines{ 0 };
+                AZStd::atomic_uint64_t failed{ 0 };
+                AZStd::atomic<steady_clock::time_point> end;
+                steady_clock::time_point start = steady_clock::now();
+
+                for (size_t i = 0; i < entries.size(); ++i)
+                {
+                    const StreamerTraceEntry& entry = entries[i];
+                    steady_clock::time_point queueTime = start + microseconds(entry.m_queueTime);
+                    steady_clock::time_point now = steady_clock::now();
+                    if (queueTime > now)
+                    {
+                        AZStd::this_thread::sleep_for(duration_cast<microseconds>(queueTime - now));
+                    }
+
+                    IStreamerTypes::Deadline deadline = entry.m_deadline == StreamerTraceEntry::NoDeadline
+                        ? IStreamerTypes::s_noDeadline
+                        : IStreamerTypes::Deadline(AZStd::max<AZ::s64>(entry.m_deadline, 0));
+                    steady_clock::time_point deadlineTime = entry.m_deadline == StreamerTraceEntry::NoDeadline
+                        ? FileRequest::s_noDeadlineTime
+                        : queueTime + deadline;
+
+                    FileRequestPtr request = m_streamer->Read(m_trace.GetPaths()[entry.m_pathIndex], buffers[i].get(), entry.m_size, entry.m_size,
+                        deadline, entry.m_priority, entry.m_offset);
+                    m_streamer->SetRequestCompleteCallback(request,
+                        [this, deadlineTime, &remaining, &missedDeadlines, &failed, &end, &allCompleted](FileRequestHandle handle)
+                        {
+                            steady_clock::time_point now = steady_clock::now();
+                            if (now > deadlineTime)
+                            {
+                                ++missedDeadlines;
+                            }
+                            if (m_streamer->GetRequestStatus(handle) != IStreamerTypes::RequestStatus::Completed)
+                            {
+                                ++failed;
+                            }
+                            if (--remaining == 0)
+                            {
+                                end = now;
+                                allCompleted.release();
+                            }
+                        });
+                    m_streamer->QueueRequest(AZStd::move(request));
+                }
+
+                allCompleted.try_acquire_for(AZStd::chrono::minutes(5));
+                auto duration = duration_cast<AZStd::chrono::duration<double>>(end.load() - start);
+                state.SetIterationTime(duration.count());
+
+                state.counters["MissedDeadlines"] = aznumeric_cast<double>(missedDeadlines.load());
+                state.counters["Failed"] = aznumeric_cast<double>(failed.load());
+
+                m_streamer->QueueRequest(m_streamer->FlushCaches());
+            }
+
+            state.counters["Requests"] = aznumeric_cast<double>(entries.size());
+            state.SetBytesProcessed(aznumeric_cast<int64_t>(m_totalBytes * state.iterations()));
+        }
+
+    private:
+        void InternalSetUp(const benchmark::State& state)
+        {
+            using namespace AZ::IO;
+
+            m_fileIO = new UnitTest::TestFileIOBase();
+            m_previousFileIO = FileIOBase::GetInstance();
+            FileIOBase::SetInstance(nullptr);
+            FileIOBase::SetInstance(m_fileIO);
+
+            char tracePath[AZ::IO::MaxPathLength];
+            auto traceEnv = AZ::Utils::GetEnv(AZStd::span(tracePath), "AZ_STREAMER_TRACE");
+            if (!traceEnv || !m_trace.Load(traceEnv.GetValue()))
+            {
+                CreateSyntheticTrace();
+            }
+
+            // Sort by queue time so requests are issued in the order they were captured.
+            AZStd::vector<StreamerTraceEntry>& entries = m_trace.GetEntries();
+            AZStd::sort(entries.begin(), entries.end(), [](const StreamerTraceEntry& lhs, const StreamerTraceEntry& rhs)
+                {
+                    return lhs.m_queueTime < rhs.m_queueTime;
+                });
+            m_totalBytes = 0;
+            for (const StreamerTraceEntry& entry : entries)
+            {
+                m_totalBytes += entry.m_size;
+            }
+
+            AZStd::shared_ptr<StreamStackEntry> stack = AZStd::make_shared<StorageDrive>(1024);
+            Stack stackType = static_cast<Stack>(state.range(0));
+            if (stackType == Stack::BlockCache || stackType == Stack::ReadSplitterAndBlockCache)
+            {
+                auto blockCache = AZStd::make_shared<BlockCache>(16_mib, aznumeric_cast<AZ::u32>(64_kib), AZCORE_GLOBAL_NEW_ALIGNMENT, false);
+                blockCache->SetNext(AZStd::move(stack));
+                stack = AZStd::move(blockCache);
+            }
+            if (stackType == Stack::ReadSplitterAndBlockCache)
+            {
+                auto readSplitter = AZStd::make_shared<ReadSplitter>(256_kib, AZCORE_GLOBAL_NEW_ALIGNMENT, 1, 4_mib, false, false);
+                readSplitter->SetNext(AZStd::move(stack));
+                stack = AZStd::move(readSplitter);
+            }
+            m_streamer = aznew Streamer(AZStd::thread_desc{}, AZStd::make_unique<Scheduler>(AZStd::move(stack)));
+        }
+
+        void InternalTearDown()
+        {
+            using namespace AZ::IO;
+
+            delete m_streamer;
+            m_streamer = nullptr;
+
+            m_trace.Clear();
+            m_tempDirectory.reset();
+
+            FileIOBase::SetInstance(nullptr);
+            FileIOBase::SetInstance(m_previousFileIO);
+            delete m_fileIO;
+            m_fileIO = nullptr;
+        }
+
+        void CreateSyntheticTrace()
+        {
+            using namespace AZ::IO;
+
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            AZStd::unique_ptr<AZ::u8[]> data(new AZ::u8[SyntheticFileSize]);
+            memset(data.get(), 'c', SyntheticFileSize);
+            for (size_t i = 0; i < SyntheticFileCount; ++i)
+            {
+                AZ::IO::Path filePath = m_tempDirectory->GetDirectory();
+                filePath /= AZStd::string::format("StreamerTraceReplay%zu.bin", i);
+                SystemFile file;
+                file.Open(filePath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_WRITE_ONLY);
+                file.Write(data.get(), SyntheticFileSize);
+                m_trace.AddPath(filePath.Native());
+            }
+
+            // Mimic a load with bursts of small reads spread over several files, some of which have tight deadlines.
+            constexpr AZ::u64 readSizes[] = { 4_kib, 16_kib, 64_kib, 256_kib };
+            for (size_t i = 0; i < SyntheticRequestCount; ++i)
+            {
+                StreamerTraceEntry entry;
+                entry.m_pathIndex = aznumeric_cast<AZ::u32>((i * 7) % SyntheticFileCount);
+                entry.m_size = readSizes[i % AZ_ARRAY_SIZE(readSizes)];
+                entry.m_offset = ((i * 104729) % (SyntheticFileSize / entry.m_size)) * entry.m_size;
+                entry.m_queueTime = aznumeric_cast<AZ::s64>((i / 32) * 2000);
+                entry.m_deadline = (i % 5 == 0) ? 1000 : StreamerTraceEntry::NoDeadline;
+                m_trace.AddEntry(entry);
+            }
+        }
+
+        AZ::IO::StreamerTrace m_trace;
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+        AZ::u64 m_totalBytes{ 0 };
+        AZ::IO::Streamer* m_streamer{};
+        AZ::IO::FileIOBase* m_previousFileIO{};
+        UnitTest::TestFileIOBase* m_fileIO{};
+    };
+
+    BENCHMARK_DEFINE_F(StreamerTraceReplayFixture, Replay)(benchmark::State& state)
+    {
+        Replay(state);
+    }
+
+    BENCHMARK_REGISTER_F(StreamerTraceReplayFixture, Replay)
+        ->ArgName("Stack")
+        ->Arg(static_cast<int64_t>(StreamerTraceReplayFixture::Stack::StorageDrive))
+        ->Arg(static_cast<int64_t>(StreamerTraceReplayFixture::Stack::BlockCache))
+        ->Arg(static_cast<int64_t>(StreamerTraceReplayFixture::Stack::ReadSplitterAndBlockCache))
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -7,7 +7,11 @@
  */
 
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/Task/TaskContinuation.h>
+#include <AzCore/Task/TaskCoroutine.h>
 #include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
@@ -624,6 +628,307 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, RetainedGraphParameters)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph{ "RetainedGraphParameters" };
+        auto scale = graph.AddParameter<int>(1);
+        auto offset = graph.AddParameter<int>(0);
+        auto a = graph.AddTask(
+            defaultTD,
+            [&x, scale]
+            {
+                x = 10 * *scale;
+            });
+        auto b = graph.AddTask(
+            defaultTD,
+            [&x, offset]
+            {
+                x += *offset;
+            });
+        a.Precedes(b);
+        graph.Compile();
+
+        for (int frame = 1; frame != 4; ++frame)
+        {
+            graph.SetParameter(scale, frame);
+            graph.SetParameter(offset, frame * 2);
+
+            TaskGraphEvent ev{ "ev" };
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+
+            EXPECT_EQ(12 * frame, x);
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, ContinuationsRunAfterGraphs)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph first{ "ContinuationFirst" };
+        first.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x = 4;
+            });
+        TaskGraph second{ "ContinuationSecond" };
+        second.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x = x + 2;
+            });
+
+        AZStd::binary_semaphore done;
+        AZ::SubmitTaskGraphThen(first, *m_executor, defaultTD, [this, &second, &x, &done]
+            {
+                x = x * 10;
+                AZ::SubmitTaskGraphThen(second, *m_executor, defaultTD, [&x, &done]
+                    {
+                        x = x + 1;
+                        done.release();
+                    });
+            });
+        done.acquire();
+
+        EXPECT_EQ(43, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, ContinuationDoesNotHoldWorker)
+    {
+        // With a single worker, waiting on the inner graph from within a task would never finish
+        TaskExecutor executor{ 1 };
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph inner{ "ContinuationInner" };
+        inner.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x = x + 1;
+            });
+
+        AZStd::binary_semaphore done;
+        AZ::ScheduleTaskContinuation(executor, defaultTD, [&executor, &inner, &x, &done]
+            {
+                AZ::SubmitTaskGraphThen(inner, executor, defaultTD, [&x, &done]
+                    {
+                        x = x * 2;
+                        done.release();
+                    });
+            });
+        done.acquire();
+
+        EXPECT_EQ(2, x);
+    }
+
+#if defined(AZ_TASK_COROUTINES_ENABLED)
+    static AZ::TaskCoroutine AwaitTwoGraphs(TaskGraph& first, TaskGraph& second, AZStd::atomic<int>& x)
+    {
+        co_await AZ::AwaitTaskGraph(first);
+        x = x * 10;
+        co_await AZ::AwaitTaskGraph(second);
+        x = x + 1;
+    }
+
+    TEST_F(TaskGraphTestFixture, CoroutineAwaitsGraphs)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph first{ "CoroutineFirst" };
+        first.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x = 4;
+            });
+        TaskGraph second{ "CoroutineSecond" };
+        second.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x = x + 2;
+            });
+
+        TaskGraphEvent ev{ "ev" };
+        AwaitTwoGraphs(first, second, x).Start(*m_executor, defaultTD, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(43, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, CoroutineNotStartedIsDestroyed)
+    {
+        AZStd::atomic<int> x = 0;
+        TaskGraph graph{ "CoroutineNeverStarted" };
+        {
+            AZ::TaskCoroutine coroutine = AwaitTwoGraphs(graph, graph, x);
+        }
+        EXPECT_EQ(0, x);
+    }
+#endif // AZ_TASK_COROUTINES_ENABLED
+
+    TEST(TaskGraphTests, CpuTopologyReportsOnlineProcessors)
+    {
+        AZ::Threading::CpuTopology topology = AZ::Threading::QueryCpuTopology();
+
+        ASSERT_FALSE(topology.m_processors.empty());
+        EXPECT_GE(topology.m_numaNodeCount, 1u);
+        for (size_t i = 0; i != topology.m_processors.size(); ++i)
+        {
+            EXPECT_LT(topology.m_processors[i].m_numaNode, topology.m_numaNodeCount);
+            if (i > 0)
+            {
+                EXPECT_LT(topology.m_processors[i - 1].m_id, topology.m_processors[i].m_id);
+            }
+        }
+    }
+
+    class TopologyAwareTaskGraphTestFixture : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_executor = aznew TaskExecutor(0, true);
+        }
+
+        void TearDown() override
+        {
+            azdestroy(m_executor);
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        TaskExecutor* m_executor;
+    };
+
+    TEST_F(TopologyAwareTaskGraphTestFixture, PlacementHintsExecuteAllTasks)
+    {
+        EXPECT_TRUE(m_executor->IsTopologyAware());
+
+        TaskDescriptor criticalTD{ "Critical", "TaskGraphTests" };
+        criticalTD.placement = AZ::TaskPlacement::LATENCY_CRITICAL;
+        TaskDescriptor backgroundTD{ "Background", "TaskGraphTests" };
+        backgroundTD.placement = AZ::TaskPlacement::BACKGROUND;
+
+        constexpr int TaskCount = 256;
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph{ "Placement" };
+        auto root = graph.AddTask(
+            criticalTD,
+            [&]
+            {
+                ++x;
+            });
+        for (int i = 0; i != TaskCount; ++i)
+        {
+            auto task = graph.AddTask(
+                (i % 2) ? criticalTD : backgroundTD,
+                [&]
+                {
+                    ++x;
+                });
+            root.Precedes(task);
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(TaskCount + 1, x);
+    }
+
+    class SharedJobSchedulerTaskGraphTestFixture : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            AZ::JobManagerDesc desc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(desc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            m_executor = aznew TaskExecutor(*m_jobContext);
+        }
+
+        void TearDown() override
+        {
+            azdestroy(m_executor);
+            delete m_jobContext;
+            delete m_jobManager;
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        AZ::JobManager* m_jobManager;
+        AZ::JobContext* m_jobContext;
+        TaskExecutor* m_executor;
+    };
+
+    TEST_F(SharedJobSchedulerTaskGraphTestFixture, ForkJoinRunsOnJobWorkers)
+    {
+        EXPECT_TRUE(m_executor->IsSharedWithJobs());
+
+        AZStd::atomic<int> x = 0;
+        AZStd::atomic<int> tasksOnJobWorkers = 0;
+        auto countJobWorker = [&]
+        {
+            if (m_jobManager->GetCurrentJob() != nullptr)
+            {
+                ++tasksOnJobWorkers;
+            }
+        };
+
+        TaskGraph graph{ "SharedForkJoin" };
+        auto a = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 0b111;
+                countJobWorker();
+            });
+        auto b = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x ^= 1;
+                countJobWorker();
+            });
+        auto c = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x ^= 2;
+                countJobWorker();
+            });
+        auto d = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x -= 1;
+                countJobWorker();
+            });
+        a.Precedes(b, c);
+        d.Follows(b, c);
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(3, x);
+        EXPECT_EQ(4, tasksOnJobWorkers);
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -739,5 +1044,72 @@ namespace Benchmark
             ev.Wait();
         }
     }
+
+    // Both benchmarks below record a 16-way fan-out followed by a join, once per iteration, with a per-frame
+    // value each task needs to read. The first rebuilds and recompiles the graph every frame, the second
+    // compiles once and only patches the parameter before resubmitting.
+    constexpr int FrameFanOut = 16;
+
+    BENCHMARK_F(TaskGraphBenchmarkFixture, RebuildEachFrame)(benchmark::State& state)
+    {
+        AZStd::atomic<int> sum = 0;
+        int frame = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ++frame;
+            graph->Reset();
+            auto join = graph->AddTask(
+                descriptors[2],
+                []
+                {
+                });
+            for (int i = 0; i != FrameFanOut; ++i)
+            {
+                auto task = graph->AddTask(
+                    descriptors[2],
+                    [&sum, frame]
+                    {
+                        sum += frame;
+                    });
+                task.Precedes(join);
+            }
+
+            TaskGraphEvent ev{ "ev" };
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
+
+    BENCHMARK_F(TaskGraphBenchmarkFixture, RetainedPatchEachFrame)(benchmark::State& state)
+    {
+        AZStd::atomic<int> sum = 0;
+        auto frameParameter = graph->AddParameter<int>(0);
+        auto join = graph->AddTask(
+            descriptors[2],
+            []
+            {
+            });
+        for (int i = 0; i != FrameFanOut; ++i)
+        {
+            auto task = graph->AddTask(
+                descriptors[2],
+                [&sum, frameParameter]
+                {
+                    sum += *frameParameter;
+                });
+            task.Precedes(join);
+        }
+        graph->Compile();
+
+        int frame = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            graph->SetParameter(frameParameter, ++frame);
+
+            TaskGraphEvent ev{ "ev" };
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
 } // namespace Benchmark
 #endif
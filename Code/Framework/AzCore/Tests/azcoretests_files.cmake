@@ -31,6 +31,7 @@ set(FILES
     AZStd/DequeAndSimilar.cpp
     AZStd/Examples.cpp
     AZStd/ExpectedTests.cpp
+    AZStd/FlatHashed.cpp
     AZStd/FunctionalBasic.cpp
     AZStd/FunctorsBind.cpp
     AZStd/Hashed.cpp
@@ -71,6 +72,7 @@ set(FILES
     AssetSerializerTests.cpp
     BehaviorContext.cpp
     BehaviorContextFixture.h
+    ComponentDataStorageTests.cpp
     Components.cpp
     Console/LoggerSystemComponentTests.cpp
     Console/ConsoleTests.cpp
@@ -92,6 +94,7 @@ set(FILES
     DOM/DomPrefixTreeTests.cpp
     DOM/DomPrefixTreeBenchmarks.cpp
     EBus/EBusSharedDispatchMutexTests.cpp
+    EBus/ParallelDispatchTests.cpp
     EBus/ScheduledEventTests.cpp
     EBus.cpp
     EntityIdTests.cpp
@@ -148,6 +151,7 @@ set(FILES
     Math/ShapeIntersectionPerformanceTests.cpp
     Math/ShapeIntersectionTests.cpp
     Math/SfmtTests.cpp
+    Math/SimdBatchTests.cpp
     Math/SimdMathTests.cpp
     Math/SphereTests.cpp
     Math/RayTests.cpp
@@ -164,11 +168,13 @@ set(FILES
     Math/VectorNTests.cpp
     Math/VectorNPerformanceTests.cpp
     Math/PackedVectorTest.cpp
+    Memory/AllocationSampler.cpp
     Memory/AllocatorBenchmarks.cpp
     Memory/HphaAllocator.cpp
     Memory/HphaAllocatorErrorDetection.cpp
     Memory/LeakDetection.cpp
     Memory.cpp
+    Metrics/BinaryTraceEventLoggerTests.cpp
     Metrics/EventLoggerFactoryTests.cpp
     Metrics/EventLoggerReflectUtilsTests.cpp
     Metrics/EventLoggerUtilsTests.cpp
@@ -188,6 +194,7 @@ set(FILES
     Rtti.cpp
     Script.cpp
     ScriptMath.cpp
+    Serialization/CompactClassLayoutTests.cpp
     Serialization/Json/ArraySerializerTests.cpp
     Serialization/Json/AnySerializerTests.cpp
     Serialization/Json/BaseJsonSerializerFixture.h
@@ -206,6 +213,7 @@ set(FILES
     Serialization/Json/JsonSerializationUtilsTests.cpp
     Serialization/Json/JsonSerializerConformityTests.h
     Serialization/Json/JsonSerializerMock.h
+    Serialization/Json/JsonStreamingDeserializerTests.cpp
     Serialization/Json/MapSerializerTests.cpp
     Serialization/Json/MathVectorSerializerTests.cpp
     Serialization/Json/MathMatrixSerializerTests.cpp
@@ -240,6 +248,7 @@ set(FILES
     Settings/SettingsRegistryMergeUtilsTests.cpp
     Settings/SettingsRegistryOriginTrackerTests.cpp
     Settings/SettingsRegistryScriptUtilsTests.cpp
+    Settings/SettingsRegistrySnapshotTests.cpp
     Settings/SettingsRegistryVisitorUtilsTests.cpp
     Settings/TextParserTests.cpp
     Slice.cpp
@@ -253,11 +262,13 @@ set(FILES
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
+    Streamer/PersistentCacheTests.cpp
     Streamer/ReadSplitterTests.cpp
     Streamer/SchedulerTests.cpp
     Streamer/StreamStackEntryConformityTests.h
     Streamer/StreamStackEntryMock.h
     Streamer/StreamStackEntryTests.cpp
+    Streamer/StreamerTraceTests.cpp
     StreamerTests.cpp
     StringFunc.cpp
     SystemFileTest.cpp
@@ -218,6 +218,23 @@ namespace AZ::IO::ArchiveInternal
         return (uint32_t)m_nCurSeek >= GetFileSize();
     }
 
+    // calls the visitor with the full path and the entry of every file of a pack directory tree
+    // the full path starts with the path of the tree, and is restored before returning
+    template<class Visitor>
+    static void VisitFileEntries(ZipDir::FileEntryTree* tree, AZ::IO::FixedMaxPath& fullPath, Visitor& visitor)
+    {
+        for (auto itFile = tree->GetFileBegin(); itFile != tree->GetFileEnd(); ++itFile)
+        {
+            visitor(fullPath / itFile->first, tree->GetFileEntry(itFile));
+        }
+        for (auto itDir = tree->GetDirBegin(); itDir != tree->GetDirEnd(); ++itDir)
+        {
+            const size_t pathLength = fullPath.Native().size();
+            fullPath /= itDir->first;
+            VisitFileEntries(tree->GetDirEntry(itDir), fullPath, visitor);
+            fullPath.Native().resize(pathLength);
+        }
+    }
 }
 
 namespace AZ::IO
@@ -359,6 +376,10 @@ namespace AZ::IO
         , m_mainThreadId{ AZStd::this_thread::get_id() }
     {
         CompressionBus::Handler::BusConnect();
+        if (AZ::Interface<AZ::IO::IMappedFileProvider>::Get() == nullptr)
+        {
+            AZ::Interface<AZ::IO::IMappedFileProvider>::Register(this);
+        }
 
         // If the settings registry is not available at this point,
         // then something catastrophic has happened in the application startup.
@@ -381,8 +402,13 @@ namespace AZ::IO
     //////////////////////////////////////////////////////////////////////////
     Archive::~Archive()
     {
+        if (AZ::Interface<AZ::IO::IMappedFileProvider>::Get() == this)
+        {
+            AZ::Interface<AZ::IO::IMappedFileProvider>::Unregister(this);
+        }
         CompressionBus::Handler::BusDisconnect();
 
+        m_fileIndex = {};
         m_arrZips = {};
 
         [[maybe_unused]] uint32_t numFilesForcedToClose = 0;
@@ -701,33 +727,27 @@ namespace AZ::IO
         }
 
 
+        // the index is keyed by the normalized bind root followed by the path in the pack
+        resolvedPath = resolvedPath.LexicallyNormal();
+
         AZStd::shared_lock lock(m_csZips);
-        // scan through registered archive files and try to find this file
-        for (auto itZip = m_arrZips.rbegin(); itZip != m_arrZips.rend(); ++itZip)
+        // the packs containing the file are in priority order, so the first one which isn't disabled is the one to use
+        if (auto itFile = m_fileIndex.find(AZ::IO::PathView(resolvedPath)); itFile != m_fileIndex.end())
         {
-            if (itZip->pArchive->GetFlags() & INestedArchive::FLAGS_DISABLE_PAK)
+            for (const IndexedFile& indexedFile : itFile->second)
             {
-                continue;
-            }
-
-
-            // If the bindRootIter is at the end then it is a prefix of the source path
-            if (resolvedPath.IsRelativeTo(itZip->m_pathBindRoot))
-            {
-                // unaliasedIter is past the bind root, so append the rest of it to a new relative path object
-                AZ::IO::FixedMaxPath relativePathInZip = resolvedPath.LexicallyRelative(itZip->m_pathBindRoot);
-
-                ZipDir::FileEntry* pFileEntry = itZip->pZip->FindFile(relativePathInZip.Native());
-                if (pFileEntry)
+                if (indexedFile.m_archive->GetFlags() & INestedArchive::FLAGS_DISABLE_PAK)
                 {
-                    if (pZip)
-                    {
-                        *pZip = itZip->pZip;
-                    }
+                    continue;
+                }
 
-                    nArchiveFlags = itZip->pArchive->GetFlags();
-                    return pFileEntry;
+                if (pZip)
+                {
+                    *pZip = indexedFile.m_zip;
                 }
+
+                nArchiveFlags = indexedFile.m_archive->GetFlags();
+                return indexedFile.m_fileEntry;
             }
         }
         nArchiveFlags = 0;
@@ -1206,6 +1226,7 @@ namespace AZ::IO
         }
 
         m_arrZips.insert(revItZip.base(), desc);
+        AddToFileIndex(desc);
 
         if (bundleManifest && bundleCatalog)
         {
@@ -1247,6 +1268,7 @@ namespace AZ::IO
                     archiveNotifications->BundleClosed(bundleName.c_str());
                 }, it->GetFullPath());
 
+                RemoveFromFileIndex(*it);
                 it = m_arrZips.erase(it);
             }
             else
@@ -1257,6 +1279,58 @@ namespace AZ::IO
         return true;
     }
 
+    void Archive::AddToFileIndex(const PackDesc& desc)
+    {
+        IndexedFile indexedFile;
+        indexedFile.m_zip = desc.pZip.get();
+        indexedFile.m_archive = desc.pArchive.get();
+        const AZ::IO::PathView archivePath = desc.GetFullPath();
+
+        auto AddFile = [this, &indexedFile, archivePath](const AZ::IO::FixedMaxPath& filePath, ZipDir::FileEntry* fileEntry)
+        {
+            indexedFile.m_fileEntry = fileEntry;
+            auto& packsWithFile = m_fileIndex[AZ::IO::Path(filePath)];
+            // m_arrZips is sorted by archive path and searched from its end, so an archive has priority over the ones
+            // with a lower path, and an archive with the same path as another has a lower priority than the one already opened
+            auto itInsert = AZStd::find_if(packsWithFile.begin(), packsWithFile.end(),
+                [archivePath](const IndexedFile& other)
+                {
+                    return archivePath > other.m_zip->GetFilePath();
+                });
+            packsWithFile.insert(itInsert, indexedFile);
+        };
+
+        AZ::IO::FixedMaxPath fullPath(desc.m_pathBindRoot);
+        ArchiveInternal::VisitFileEntries(desc.pZip->GetRoot(), fullPath, AddFile);
+    }
+
+    void Archive::RemoveFromFileIndex(const PackDesc& desc)
+    {
+        const ZipDir::Cache* zip = desc.pZip.get();
+        auto RemoveFile = [this, zip](const AZ::IO::FixedMaxPath& filePath, ZipDir::FileEntry*)
+        {
+            auto itFile = m_fileIndex.find(AZ::IO::PathView(filePath));
+            if (itFile == m_fileIndex.end())
+            {
+                return;
+            }
+
+            auto& packsWithFile = itFile->second;
+            packsWithFile.erase(AZStd::remove_if(packsWithFile.begin(), packsWithFile.end(),
+                [zip](const IndexedFile& indexedFile)
+                {
+                    return indexedFile.m_zip == zip;
+                }), packsWithFile.end());
+            if (packsWithFile.empty())
+            {
+                m_fileIndex.erase(itFile);
+            }
+        };
+
+        AZ::IO::FixedMaxPath fullPath(desc.m_pathBindRoot);
+        ArchiveInternal::VisitFileEntries(desc.pZip->GetRoot(), fullPath, RemoveFile);
+    }
+
     bool Archive::FindPacks(AZStd::string_view pWildcardIn)
     {
         auto filePath = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(pWildcardIn);
@@ -1389,7 +1463,12 @@ namespace AZ::IO
     CCachedFileData::~CCachedFileData()
     {
         // forced destruction
-        if (m_pFileData)
+        if (m_mappedData)
+        {
+            m_mappedData = {};
+            m_pFileData = nullptr;
+        }
+        else if (m_pFileData)
         {
             AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(m_pFileData);
             m_pFileData = nullptr;
@@ -1451,6 +1530,14 @@ namespace AZ::IO
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
             if (!m_pFileData)
             {
+                // files that are stored without compression can be used directly from the memory mapped archive
+                if (AZ::IO::MappedFileView view = m_pZip->GetMappedFileData(m_pFileEntry); view)
+                {
+                    m_mappedData = AZStd::move(view);
+                    m_pFileData = const_cast<uint8_t*>(m_mappedData.m_data.data());
+                    return m_pFileData;
+                }
+
                 // don't try to decompress if its not actually compressed
                 decompress = decompress && m_pFileEntry->IsCompressed();
 
@@ -1500,7 +1587,11 @@ namespace AZ::IO
             return 0;
         }
 
-        if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
+        if (AZ::IO::MappedFileView view = m_pZip->GetMappedFileData(m_pFileEntry); view)
+        {
+            memcpy(pBuffer, view.m_data.data() + nFileOffset, aznumeric_cast<size_t>(nReadSize));
+        }
+        else if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
         {
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
             // Uncompressed read.
@@ -1938,6 +2029,13 @@ namespace AZ::IO
                 info.m_uncompressedSize = entry->desc.lSizeUncompressed;
                 info.m_isCompressed = entry->IsCompressed();
                 info.m_isSharedPak = true;
+                if (info.m_isCompressed)
+                {
+                    // Framed files are decompressed frame by frame, which the decompressor below also handles since every
+                    // frame is compressed on its own.
+                    AZStd::scoped_lock lock(entry->m_readLock);
+                    info.m_isFramed = archive->IsFramed(entry);
+                }
 
                 switch (GetPakPriority())
                 {
@@ -1961,6 +2059,35 @@ namespace AZ::IO
         }
     }
 
+    AZ::IO::MappedFileView Archive::MapFile(AZ::IO::PathView filePath)
+    {
+        if (!ZipDir::Cache::IsMemoryMappingEnabled())
+        {
+            return {};
+        }
+
+        auto correctedFilename = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(filePath);
+        if (!correctedFilename)
+        {
+            return {};
+        }
+
+        uint32_t archiveFlags = 0;
+        ZipDir::CachePtr archive;
+        CCachedFileDataPtr pFileData = GetFileData(correctedFilename->Native(), archiveFlags, &archive);
+        if (!pFileData || !archive)
+        {
+            return {};
+        }
+
+        ZipDir::FileEntry* entry = pFileData->GetFileEntry();
+        if (!entry || !entry->IsInitialized())
+        {
+            return {};
+        }
+        return archive->GetMappedFileData(entry);
+    }
+
     // return offset in archive file (ideally has to return offset on DVD)
     uint64_t Archive::GetFileOffsetOnMedia(AZStd::string_view sFilename) const
     {
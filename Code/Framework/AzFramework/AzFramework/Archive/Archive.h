@@ -17,10 +17,13 @@
 
 
 #include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/MappedFile.h>
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/small_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
@@ -69,6 +72,8 @@ namespace AZ::IO
         uint32_t GetFileDataOffset();
 
         void* m_pFileData;
+        // if set, m_pFileData points into this memory mapping of the archive instead of an allocated buffer
+        AZ::IO::MappedFileView m_mappedData;
 
         // the zip file in which this file is opened
         ZipDir::CachePtr m_pZip;
@@ -89,9 +94,10 @@ namespace AZ::IO
     class Archive
         : public IArchive
         , public AZ::IO::CompressionBus::Handler
+        , public AZ::IO::IMappedFileProvider
     {
     public:
-        AZ_RTTI(Archive, "{764A2260-FF8A-4C86-B958-EBB0B69D9DFA}", IArchive);
+        AZ_RTTI(Archive, "{764A2260-FF8A-4C86-B958-EBB0B69D9DFA}", IArchive, AZ::IO::IMappedFileProvider);
         AZ_CLASS_ALLOCATOR(Archive, AZ::OSAllocator);
     private:
         friend struct CCachedFileData;
@@ -128,6 +134,31 @@ namespace AZ::IO
         };
         using ZipArray = AZStd::vector<PackDesc, AZ::OSStdAllocator>;
 
+        // a file of an opened pack, as found through the file index
+        struct IndexedFile
+        {
+            ZipDir::FileEntry* m_fileEntry{};
+            ZipDir::Cache* m_zip{};
+            INestedArchive* m_archive{};
+        };
+
+        // the file index is queried with the resolved paths, without copying them
+        struct FileIndexHash
+        {
+            using is_transparent = void;
+            size_t operator()(AZ::IO::PathView path) const { return AZStd::hash<AZ::IO::PathView>{}(path); }
+        };
+        struct FileIndexEqual
+        {
+            using is_transparent = void;
+            bool operator()(AZ::IO::PathView lhs, AZ::IO::PathView rhs) const { return lhs == rhs; }
+        };
+
+        // maps the full path (bind root and path in the pack) of the files of all the opened packs
+        // to the packs containing them, in the order they're searched in: highest priority first
+        using FileIndex = AZStd::unordered_map<AZ::IO::Path, AZStd::small_vector<IndexedFile, 1, AZ::OSStdAllocator>,
+            FileIndexHash, FileIndexEqual, AZ::OSStdAllocator>;
+
         // ArchiveFindDataSet entire purpose is to keep a reference to the intrusive_ptr of ArchiveFindData
         // so that it doesn't go out of scope
         using ArchiveFindDataSet = AZStd::set<AZStd::intrusive_ptr<AZ::IO::FindData>>;
@@ -152,6 +183,10 @@ namespace AZ::IO
         //! CompressionBus Handler implementation.
         void FindCompressionInfo(bool& found, AZ::IO::CompressionInfo& info, const AZ::IO::PathView filePath) override;
 
+        //! IMappedFileProvider implementation.
+        //! Files are only mapped if they're stored uncompressed and az_archive_memory_map is enabled.
+        AZ::IO::MappedFileView MapFile(AZ::IO::PathView filePath) override;
+
         // Set the localization folder
         void SetLocalizationFolder(AZStd::string_view sLocalizationFolder) override;
         const char* GetLocalizationFolder() const override { return m_sLocalizationFolder.c_str(); }
@@ -298,6 +333,10 @@ namespace AZ::IO
         void Unregister(INestedArchive* pArchive);
         INestedArchive* FindArchive(AZStd::string_view szFullPath) const;
 
+        // Adds the files of an opened pack to the file index, or removes them, the m_csZips lock must be held exclusively
+        void AddToFileIndex(const PackDesc& desc);
+        void RemoveFromFileIndex(const PackDesc& desc);
+
         //! Return the Manifest from a bundle, if it exists
         AZStd::shared_ptr<AzFramework::AssetBundleManifest> GetBundleManifest(ZipDir::CachePtr pZip);
         AZStd::shared_ptr<AzFramework::AssetRegistry> GetBundleCatalog(ZipDir::CachePtr pZip, const AZStd::string& catalogName);
@@ -316,6 +355,9 @@ namespace AZ::IO
 
         mutable AZStd::shared_mutex m_csZips;
         ZipArray m_arrZips;
+        // lets FindPakFileEntry find a file with a single lookup instead of searching each opened pack in turn
+        // updated with m_arrZips, under the m_csZips lock
+        FileIndex m_fileIndex;
 
         AZ::SettingsRegistryInterface::NotifyEventHandler m_componentApplicationLifecycleHandler;
 
@@ -102,8 +102,10 @@ namespace AZ::IO
         //   METHOD_DEFLATE == METHOD_COMPRESS == 8 (deflate) , compression
         //   level is LEVEL_FASTEST == 0 till LEVEL_BEST == 9 or LEVEL_DEFAULT == -1
         //   for default (like in zlib)
+        //   a non zero frame size stores compressed files as independent frames of that many uncompressed
+        //   bytes (see AzCore/IO/FramedCompression.h), which the streamer decompresses in parallel
         virtual int UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = 0,
-            int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) = 0;
+            int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB, uint32_t nFrameSize = 0) = 0;
 
         // Summary:
         //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
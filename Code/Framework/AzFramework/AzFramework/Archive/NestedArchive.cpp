@@ -138,7 +138,7 @@ namespace AZ::IO
     // Adds a new file to the zip or update an existing one
     // adds a directory (creates several nested directories if needed)
     // compression methods supported are 0 (store) and 8 (deflate) , compression level is 0..9 or -1 for default (like in zlib)
-    int NestedArchive::UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec)
+    int NestedArchive::UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec, uint32_t nFrameSize)
     {
         if (m_nFlags & FLAGS_READ_ONLY)
         {
@@ -150,7 +150,7 @@ namespace AZ::IO
         {
             return ZipDir::ZD_ERROR_INVALID_PATH;
         }
-        return m_pCache->UpdateFile(fullPath, pUncompressed, nSize, nCompressionMethod, nCompressionLevel, codec);
+        return m_pCache->UpdateFile(fullPath, pUncompressed, nSize, nCompressionMethod, nCompressionLevel, codec, nFrameSize);
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -46,7 +46,7 @@ namespace AZ::IO
         // adds a directory (creates several nested directories if needed)
         // compression methods supported are 0 (store) and 8 (deflate) , compression level is 0..9 or -1 for default (like in zlib)
         int UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = ZipFile::METHOD_STORE,
-            int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) override;
+            int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB, uint32_t nFrameSize = 0) override;
 
         // Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         int StartContinuousFileUpdate(AZStd::string_view szRelativePath, uint64_t nSize) override;
@@ -9,7 +9,9 @@
 
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/FramedCompression.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/conversions.h>
 
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -34,6 +36,10 @@ namespace AZ::IO::ZipDir
         "Sets the verbosity level for zip directory cache operations\n"
         ">=1 - Turns on verbose logging of all operations");
 
+    AZ_CVAR(bool, az_archive_memory_map, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Memory maps archives that are opened read-only, so files stored without compression can be read from the mapping\n"
+        "instead of being copied through intermediate read buffers.");
+
     namespace ZipDirCacheInternal
     {
         [[nodiscard]] static AZStd::intrusive_ptr<AZ::IO::MemoryBlock> CreateMemoryBlock(size_t size)
@@ -46,6 +52,22 @@ namespace AZ::IO::ZipDir
             return memoryBlock;
         }
 
+        // compresses the data with the ZipRawCompress function of the codec
+        static int ZipRawCompressCodec(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel, CompressionCodec::Codec codec)
+        {
+            switch (codec)
+            {
+            case CompressionCodec::Codec::ZSTD:
+                return ZipRawCompressZSTD(pUncompressed, pDestSize, pCompressed, nSrcSize, nLevel);
+            case CompressionCodec::Codec::ZLIB:
+                return ZipRawCompress(pUncompressed, pDestSize, pCompressed, nSrcSize, nLevel);
+            case CompressionCodec::Codec::LZ4:
+                return ZipRawCompressLZ4(pUncompressed, pDestSize, pCompressed, nSrcSize, nLevel);
+            default:
+                return Z_ERRNO;
+            }
+        }
+
         // generates random file name
         static AZStd::fixed_string<8> GetRandomName(int nAttempt)
         {
@@ -151,6 +173,11 @@ namespace AZ::IO::ZipDir
             }
         }
         m_treeDir.Clear();
+
+        // Views handed out earlier keep their own reference to the mapping.
+        AZStd::scoped_lock lock(m_mappedFileMutex);
+        m_mappedFile.reset();
+        m_mappingAttempted = false;
     }
 
     bool Cache::WriteCompressedData(uint8_t* data, size_t size, bool)
@@ -225,9 +252,10 @@ namespace AZ::IO::ZipDir
 
     // Adds a new file to the zip or update an existing one
     // adds a directory (creates several nested directories if needed)
-    ErrorEnum Cache::UpdateFile(AZStd::string_view szRelativePathSrc, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec)
+    ErrorEnum Cache::UpdateFile(AZStd::string_view szRelativePathSrc, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec, uint32_t nFrameSize)
     {
         AZStd::intrusive_ptr<AZ::IO::MemoryBlock> memoryBlock;
+        AZStd::vector<AZ::u8> framedData;
 
         // we'll need the compressed data
         void* pCompressed = nullptr;
@@ -242,29 +270,43 @@ namespace AZ::IO::ZipDir
         switch (nCompressionMethod)
         {
         case ZipFile::METHOD_DEFLATE:
-            nSizeCompressed = GetCompressedSizeEstimate(nSize, codec);
-            memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(nSizeCompressed);
-            pCompressed = memoryBlock->m_address.get();
-            dataBuffer = pCompressed;
-
-            switch (codec)
+            if (nFrameSize != 0)
             {
-            case CompressionCodec::Codec::ZSTD:
-                nError = ZipRawCompressZSTD(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
-                break;
-
-            case CompressionCodec::Codec::ZLIB:
-                nError = ZipRawCompress(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
-                break;
-
-            case CompressionCodec::Codec::LZ4:
-                nError = ZipRawCompressLZ4(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
-                break;
+                // every frame is compressed with the codec on its own, so ZipRawUncompress can detect the codec per frame
+                auto compressFrame = [codec, nCompressionLevel](const void* uncompressed, size_t uncompressedSize, void* compressed, size_t compressedBufferSize) -> size_t
+                {
+                    size_t frameSizeCompressed = compressedBufferSize;
+                    int nFrameError = ZipDirCacheInternal::ZipRawCompressCodec(uncompressed, &frameSizeCompressed, compressed, uncompressedSize, nCompressionLevel, codec);
+                    return nFrameError == Z_OK ? frameSizeCompressed : 0;
+                };
+                if (AZ::IO::FramedCompression::Compress(framedData, pUncompressed, nSize, nFrameSize,
+                    GetCompressedSizeEstimate(AZStd::min<size_t>(nFrameSize, nSize), codec), compressFrame))
+                {
+                    pCompressed = framedData.data();
+                    nSizeCompressed = framedData.size();
+                    nError = Z_OK;
+                }
+            }
+            else
+            {
+                nSizeCompressed = GetCompressedSizeEstimate(nSize, codec);
+                memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(nSizeCompressed);
+                pCompressed = memoryBlock->m_address.get();
+                nError = ZipDirCacheInternal::ZipRawCompressCodec(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel, codec);
             }
+            dataBuffer = pCompressed;
             if (Z_OK != nError)
             {
                 return ZD_ERROR_ZLIB_FAILED;
             }
+            if (nSizeCompressed >= nSize)
+            {
+                // The data doesn't compress, e.g. it is already compressed, so it's stored instead.
+                // That keeps the entry as small and spares the reads of the entry from decompressing it.
+                nCompressionMethod = ZipFile::METHOD_STORE;
+                dataBuffer = pUncompressed;
+                nSizeCompressed = nSize;
+            }
             break;
 
         case ZipFile::METHOD_STORE:
@@ -286,6 +328,7 @@ namespace AZ::IO::ZipDir
         }
 
         pFileEntry->OnNewFileData(pUncompressed, nSize, aznumeric_cast<uint32_t>(nSizeCompressed), nCompressionMethod, false);
+        pFileEntry->m_isFramed = nFrameSize != 0 && nCompressionMethod == ZipFile::METHOD_DEFLATE;
         // since we changed the time, we'll have to update CDR
         m_nFlags |= FLAGS_CDR_DIRTY;
 
@@ -666,6 +709,15 @@ namespace AZ::IO::ZipDir
             return nError;
         }
 
+        if (pFileEntry->nMethod == ZipFile::METHOD_STORE && pUncompressed)
+        {
+            if (MappedFileView view = GetMappedFileData(pFileEntry); view)
+            {
+                memcpy(pUncompressed, view.m_data.data(), view.m_data.size());
+                return ZD_ERROR_SUCCESS;
+            }
+        }
+
         if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
         {
             return ZD_ERROR_IO_FAILED;
@@ -728,6 +780,36 @@ namespace AZ::IO::ZipDir
         return ZD_ERROR_SUCCESS;
     }
 
+    bool Cache::IsFramed(FileEntry* pFileEntry)
+    {
+        if (!pFileEntry)
+        {
+            return false;
+        }
+        if (pFileEntry->m_isFramed.has_value())
+        {
+            return *pFileEntry->m_isFramed;
+        }
+
+        if (!pFileEntry->IsCompressed() || pFileEntry->desc.lSizeCompressed < sizeof(AZ::IO::FramedCompression::FrameHeader) ||
+            Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            pFileEntry->m_isFramed = false;
+            return false;
+        }
+
+        AZ::IO::FramedCompression::FrameHeader header;
+        if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart) ||
+            !AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, &header, sizeof(header), true))
+        {
+            // don't remember the result so the check is retried on the next read
+            return false;
+        }
+        pFileEntry->m_isFramed = AZ::IO::FramedCompression::IsFramed(&header, sizeof(header)) &&
+            header.m_uncompressedSize == pFileEntry->desc.lSizeUncompressed;
+        return *pFileEntry->m_isFramed;
+    }
+
 
     //////////////////////////////////////////////////////////////////////////
     // finds the file by exact path
@@ -749,6 +831,56 @@ namespace AZ::IO::ZipDir
     }
 
     // refreshes information about the given file entry into this file entry
+    bool Cache::IsMemoryMappingEnabled()
+    {
+        return az_archive_memory_map;
+    }
+
+    MappedFileView Cache::GetMappedFileData(FileEntry* pFileEntry)
+    {
+        if (!az_archive_memory_map || !pFileEntry || pFileEntry->nMethod != ZipFile::METHOD_STORE ||
+            pFileEntry->desc.lSizeUncompressed == 0 || (m_nFlags & FLAGS_READ_ONLY) == 0 || m_strFilePath.empty())
+        {
+            return {};
+        }
+
+        if (Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return {};
+        }
+
+        AZStd::shared_ptr<const MappedFile> mappedFile;
+        {
+            AZStd::scoped_lock lock(m_mappedFileMutex);
+            if (!m_mappingAttempted)
+            {
+                // Only try once so archives that can't be mapped don't retry on every read.
+                m_mappingAttempted = true;
+                if (auto resolvedPath = AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(m_strFilePath); resolvedPath)
+                {
+                    auto file = AZStd::make_shared<MappedFile>();
+                    if (file->Open(resolvedPath->c_str()))
+                    {
+                        m_mappedFile = AZStd::move(file);
+                    }
+                }
+                AZ_Warning("Archive", m_mappedFile, "Unable to memory map '%s'.", m_strFilePath.c_str());
+            }
+            mappedFile = m_mappedFile;
+        }
+
+        const uint64_t dataEnd = aznumeric_cast<uint64_t>(pFileEntry->nFileDataOffset) + pFileEntry->desc.lSizeUncompressed;
+        if (!mappedFile || dataEnd > mappedFile->GetSize())
+        {
+            return {};
+        }
+
+        MappedFileView view;
+        view.m_data = AZStd::span<const uint8_t>(mappedFile->GetData() + pFileEntry->nFileDataOffset, pFileEntry->desc.lSizeUncompressed);
+        view.m_file = AZStd::move(mappedFile);
+        return view;
+    }
+
     ErrorEnum Cache::Refresh(FileEntryBase* pFileEntry)
     {
         if (!pFileEntry)
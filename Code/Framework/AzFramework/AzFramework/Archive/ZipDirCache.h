@@ -16,9 +16,11 @@
 #pragma once
 
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/MappedFile.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
@@ -53,7 +55,9 @@ namespace AZ::IO::ZipDir
 
         // Adds a new file to the zip or update an existing one
         // adds a directory (creates several nested directories if needed)
-        ErrorEnum UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = ZipFile::METHOD_STORE, int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB);
+        // if nFrameSize isn't 0, compressed files are stored in the seekable multi-frame format from AzCore/IO/FramedCompression.h
+        // with frames of nFrameSize uncompressed bytes, which the streamer can decompress in parallel and partially
+        ErrorEnum UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = ZipFile::METHOD_STORE, int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB, uint32_t nFrameSize = 0);
 
         //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         ErrorEnum StartContinuousFileUpdate(AZStd::string_view szRelativePath, uint64_t nSize);
@@ -82,6 +86,10 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // returns true if the compressed data of the file is in the framed format from AzCore/IO/FramedCompression.h
+        // the first call reads the frame header from the zip file, the result is kept in the file entry after that
+        bool IsFramed(FileEntry* pFileEntry);
+
         void Free(void* ptr)
         {
             azfree(ptr);
@@ -108,6 +116,13 @@ namespace AZ::IO::ZipDir
             return &m_treeDir;
         }
 
+        // returns a view of the data of a file that's stored without compression or encryption directly from a read-only
+        // memory mapping of the zip file. The mapping is created the first time this is called. An empty view is returned
+        // if the file can't be mapped, the zip file was opened for writing or az_archive_memory_map is disabled.
+        MappedFileView GetMappedFileData(FileEntry* pFileEntry);
+        // returns true if archives opened read-only are memory mapped, as set by az_archive_memory_map
+        static bool IsMemoryMappingEnabled();
+
         // writes the CDR to the disk
         bool WriteCDR() { return WriteCDR(m_fileHandle); }
         bool WriteCDR(AZ::IO::HandleType fTarget);
@@ -158,6 +173,11 @@ namespace AZ::IO::ZipDir
         // CDR buffer.
         AZStd::vector<uint8_t> m_CDR_buffer;
 
+        // read-only memory mapping of the entire zip file, created on first use
+        AZStd::shared_ptr<const MappedFile> m_mappedFile;
+        AZStd::mutex m_mappedFileMutex;
+        bool m_mappingAttempted = false;
+
         ZipFile::EHeaderEncryptionType m_encryptedHeaders = ZipFile::HEADERS_NOT_ENCRYPTED;
         ZipFile::EHeaderSignatureType m_signedHeaders;
 
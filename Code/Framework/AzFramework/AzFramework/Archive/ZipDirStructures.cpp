@@ -10,6 +10,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/IO/FramedCompression.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzFramework/Archive/Codec.h>
@@ -497,6 +498,31 @@ namespace AZ::IO::ZipDir
     {
         int nReturnCode = Z_OK;
 
+        // framed data stores every frame with one of the codecs below, so each frame is uncompressed individually
+        if (AZ::IO::FramedCompression::IsFramed(pCompressed, nSrcSize))
+        {
+            AZ::IO::FramedCompression::FrameTable frameTable;
+            if (!frameTable.Read(pCompressed, nSrcSize) || frameTable.GetUncompressedSize() > *pDestSize)
+            {
+                AZ_Error("ZipDirStructures", false, "Error decompressing framed data: the frame table is invalid or doesn't fit in the output.");
+                return Z_DATA_ERROR;
+            }
+
+            auto decompressFrame = [](const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedSize)
+            {
+                size_t frameSize = uncompressedSize;
+                return ZipRawUncompress(uncompressed, &frameSize, compressed, compressedSize) == Z_OK && frameSize == uncompressedSize;
+            };
+            // Archive reads can come from tasks, so the frames aren't spread over the task executor here.
+            if (!AZ::IO::FramedCompression::Decompress(frameTable, pCompressed, nSrcSize, 0, frameTable.GetUncompressedSize(),
+                pUncompressed, decompressFrame, false))
+            {
+                return Z_DATA_ERROR;
+            }
+            *pDestSize = aznumeric_cast<size_t>(frameTable.GetUncompressedSize());
+            return Z_OK;
+        }
+
         //check first 4 bytes to see what compression codec was used
         if (CompressionCodec::TestForZSTDMagic(pCompressed))
         {
@@ -15,6 +15,7 @@
 #include <AzCore/base.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/optional.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
 
@@ -144,6 +145,7 @@ namespace AZ::IO::ZipDir
     };
 
     // Uncompresses raw (without wrapping) data that is compressed with method 8 (deflated) in the Zip file
+    // data in the seekable multi-frame format from AzCore/IO/FramedCompression.h is uncompressed frame by frame
     // returns one of the Z_* errors (Z_OK upon success)
     int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize);
 
@@ -207,6 +209,10 @@ namespace AZ::IO::ZipDir
         // mutex that can be used to product reads for the current file entry
         AZStd::mutex m_readLock;
 
+        // whether the compressed data is in the framed format from AzCore/IO/FramedCompression.h
+        // this isn't stored in the CDR, so it's set the first time Cache::IsFramed checks the data
+        AZStd::optional<bool> m_isFramed;
+
         using FileEntryBase::FileEntryBase;
 
         FileEntry(const FileEntry&) = delete;
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/Event.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTIMacros.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AzFramework
+{
+    class TransformComponent;
+
+    //! Event signaled once per resolved batch with every entity whose transform changed during the batch,
+    //! parents before children.
+    using TransformBatchResolvedEvent = AZ::Event<const AZStd::vector<AZ::EntityId>&>;
+
+    //! Batches the transform changes of TransformComponents.
+    //! While a batch is open, setting a transform only updates the transform itself and marks it dirty; the
+    //! TransformNotificationBus notifications and the change events are held back. When the outermost batch ends,
+    //! dirty transforms are resolved from the top of the hierarchy down, and every entity in a changed hierarchy
+    //! notifies exactly once, however many times it or its ancestors were moved during the batch.
+    //! This turns the O(depth x changes) notification cascades of rigs that set many transforms per frame into a
+    //! single pass.
+    //! While a batch is open, the world transform of children of a moved entity is stale until the batch ends.
+    //! Batches must only be used on the main thread.
+    class ITransformBatch
+    {
+    public:
+        AZ_RTTI(ITransformBatch, "{6A3C2E84-95B1-4D7F-A0E2-7C18F4B9D356}");
+
+        virtual ~ITransformBatch() = default;
+
+        //! Opens a batch. Batches nest, changes are resolved when the outermost batch ends.
+        virtual void BeginBatch() = 0;
+        //! Closes a batch, resolving the batched changes if it is the outermost one.
+        virtual void EndBatch() = 0;
+        //! Returns true while a batch is open and transform changes are deferred.
+        virtual bool IsBatching() const = 0;
+
+        //! Connects a handler to the event signaled after every resolved batch.
+        virtual void BindBatchResolvedEventHandler(TransformBatchResolvedEvent::Handler& handler) = 0;
+
+        //! Used by the TransformComponent to defer its change notifications while a batch is open.
+        //! @{
+        virtual void MarkDirty(TransformComponent& transform) = 0;
+        virtual void RemoveDirty(TransformComponent& transform) = 0;
+        //! Returns true while a batch is being resolved, in which case notifying transforms must report themselves.
+        virtual bool IsResolving() const = 0;
+        virtual void OnTransformResolved(AZ::EntityId entityId) = 0;
+        //! @}
+
+    protected:
+        ITransformBatch() = default;
+    };
+
+    //! Keeps a transform batch open for the lifetime of the scope. Does nothing if no batch system is available.
+    //! @code{.cpp}
+    //!     {
+    //!         AzFramework::TransformBatchScope batch;
+    //!         for (const BoneUpdate& bone : rigUpdate)
+    //!         {
+    //!             AZ::TransformBus::Event(bone.m_entityId, &AZ::TransformBus::Events::SetLocalTM, bone.m_localTM);
+    //!         }
+    //!     } // Every moved bone and its children notify once here
+    //! @endcode
+    class TransformBatchScope final
+    {
+    public:
+        TransformBatchScope()
+            : m_batch(AZ::Interface<ITransformBatch>::Get())
+        {
+            if (m_batch)
+            {
+                m_batch->BeginBatch();
+            }
+        }
+
+        ~TransformBatchScope()
+        {
+            if (m_batch)
+            {
+                m_batch->EndBatch();
+            }
+        }
+
+        TransformBatchScope(const TransformBatchScope&) = delete;
+        TransformBatchScope& operator=(const TransformBatchScope&) = delete;
+
+    private:
+        ITransformBatch* m_batch;
+    };
+} // namespace AzFramework
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformBatchSystem.h>
+#include <AzFramework/Components/TransformComponent.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    TransformBatchSystem::~TransformBatchSystem()
+    {
+        AZ_Assert(m_batchDepth == 0, "TransformBatchSystem destroyed with %u batches still open", m_batchDepth);
+    }
+
+    void TransformBatchSystem::Connect()
+    {
+        AZ::Interface<ITransformBatch>::Register(this);
+    }
+
+    void TransformBatchSystem::Disconnect()
+    {
+        AZ_Assert(m_batchDepth == 0, "TransformBatchSystem disconnected with %u batches still open", m_batchDepth);
+        AZ::Interface<ITransformBatch>::Unregister(this);
+    }
+
+    void TransformBatchSystem::BeginBatch()
+    {
+        ++m_batchDepth;
+    }
+
+    void TransformBatchSystem::EndBatch()
+    {
+        AZ_Assert(m_batchDepth > 0, "EndBatch called without a matching BeginBatch");
+        if (--m_batchDepth == 0 && !m_resolving)
+        {
+            ResolveBatch();
+        }
+    }
+
+    bool TransformBatchSystem::IsBatching() const
+    {
+        return m_batchDepth > 0;
+    }
+
+    void TransformBatchSystem::BindBatchResolvedEventHandler(TransformBatchResolvedEvent::Handler& handler)
+    {
+        handler.Connect(m_batchResolvedEvent);
+    }
+
+    void TransformBatchSystem::MarkDirty(TransformComponent& transform)
+    {
+        m_dirtyTransforms.push_back(&transform);
+    }
+
+    void TransformBatchSystem::RemoveDirty(TransformComponent& transform)
+    {
+        if (auto it = AZStd::find(m_dirtyTransforms.begin(), m_dirtyTransforms.end(), &transform); it != m_dirtyTransforms.end())
+        {
+            *it = m_dirtyTransforms.back();
+            m_dirtyTransforms.pop_back();
+        }
+
+        // Resolution may be running a handler that deactivates the entity, leave a hole so the iteration stays valid
+        for (DirtyTransform& dirtyTransform : m_resolvingTransforms)
+        {
+            if (dirtyTransform.m_transform == &transform)
+            {
+                dirtyTransform.m_transform = nullptr;
+            }
+        }
+    }
+
+    bool TransformBatchSystem::IsResolving() const
+    {
+        return m_resolving;
+    }
+
+    void TransformBatchSystem::OnTransformResolved(AZ::EntityId entityId)
+    {
+        m_resolvedEntities.push_back(entityId);
+    }
+
+    void TransformBatchSystem::ResolveBatch()
+    {
+        if (m_dirtyTransforms.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        m_resolving = true;
+
+        // Handlers notified while resolving may open and close batches of their own, resolve those in follow-up passes
+        while (!m_dirtyTransforms.empty())
+        {
+            m_resolvingTransforms.clear();
+            m_resolvingTransforms.reserve(m_dirtyTransforms.size());
+            for (TransformComponent* transform : m_dirtyTransforms)
+            {
+                m_resolvingTransforms.push_back({ transform->GetHierarchyDepth(), transform });
+            }
+            m_dirtyTransforms.clear();
+
+            // Parents first: resolving a parent notifies its children, which resolves every dirty child that follows it
+            AZStd::stable_sort(
+                m_resolvingTransforms.begin(),
+                m_resolvingTransforms.end(),
+                [](const DirtyTransform& lhs, const DirtyTransform& rhs)
+                {
+                    return lhs.m_depth < rhs.m_depth;
+                });
+
+            for (size_t i = 0; i < m_resolvingTransforms.size(); ++i)
+            {
+                if (TransformComponent* transform = m_resolvingTransforms[i].m_transform; transform && transform->m_isBatchDirty)
+                {
+                    transform->ResolveBatchedTransform();
+                }
+            }
+        }
+
+        m_resolvingTransforms.clear();
+        m_resolving = false;
+
+        m_batchResolvedEvent.Signal(m_resolvedEntities);
+        m_resolvedEntities.clear();
+    }
+} // namespace AzFramework
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzFramework/Components/TransformBatch.h>
+
+namespace AzFramework
+{
+    //! Default ITransformBatch implementation, owned by the game entity context.
+    class TransformBatchSystem
+        : public ITransformBatch
+    {
+    public:
+        AZ_RTTI(TransformBatchSystem, "{E1B5C7A2-3F48-4D69-8B0C-91D2A6E4F837}", ITransformBatch);
+
+        TransformBatchSystem() = default;
+        ~TransformBatchSystem() override;
+
+        void Connect();
+        void Disconnect();
+
+        // ITransformBatch overrides ...
+        void BeginBatch() override;
+        void EndBatch() override;
+        bool IsBatching() const override;
+        void BindBatchResolvedEventHandler(TransformBatchResolvedEvent::Handler& handler) override;
+        void MarkDirty(TransformComponent& transform) override;
+        void RemoveDirty(TransformComponent& transform) override;
+        bool IsResolving() const override;
+        void OnTransformResolved(AZ::EntityId entityId) override;
+
+    private:
+        struct DirtyTransform
+        {
+            AZ::u32 m_depth;
+            TransformComponent* m_transform;
+        };
+
+        void ResolveBatch();
+
+        AZStd::vector<TransformComponent*> m_dirtyTransforms; //!< Transforms changed during the open batch.
+        AZStd::vector<DirtyTransform> m_resolvingTransforms; //!< Transforms being resolved, sorted parents first.
+        AZStd::vector<AZ::EntityId> m_resolvedEntities; //!< Entities that notified while resolving.
+        TransformBatchResolvedEvent m_batchResolvedEvent;
+        AZ::u32 m_batchDepth = 0;
+        bool m_resolving = false;
+    };
+} // namespace AzFramework
@@ -7,6 +7,7 @@
  */
 
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformBatch.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -165,6 +166,13 @@ namespace AzFramework
             parentTransform->NotifyChildChangedEvent(AZ::ChildChangeType::Removed, GetEntityId());
         }
 
+        if (ITransformBatch* transformBatch = AZ::Interface<ITransformBatch>::Get();
+            transformBatch && (m_isBatchDirty || transformBatch->IsResolving()))
+        {
+            transformBatch->RemoveDirty(*this);
+            m_isBatchDirty = false;
+        }
+
         m_notificationBus = nullptr;
         if (m_parentId.IsValid())
         {
@@ -637,9 +645,7 @@ namespace AzFramework
             if (m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
             {
                 m_worldTM = parentWorldTM * m_localTM;
-                AZ::TransformNotificationBus::Event(
-                    m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
-                m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+                NotifyTransformChanged();
             }
             else
             {
@@ -663,9 +669,7 @@ namespace AzFramework
             m_localTM = m_worldTM;
         }
 
-        AZ::TransformNotificationBus::Event(
-            m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
-        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+        NotifyTransformChanged();
 
         AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
         if (boundsUnion != nullptr)
@@ -685,11 +689,66 @@ namespace AzFramework
             m_worldTM = m_localTM;
         }
 
+        NotifyTransformChanged();
+    }
+
+    void TransformComponent::NotifyTransformChanged()
+    {
+        if (ITransformBatch* transformBatch = AZ::Interface<ITransformBatch>::Get())
+        {
+            // Only active transforms are batched, an inactive one may be destroyed before the batch ends
+            if (transformBatch->IsBatching() && m_notificationBus)
+            {
+                if (!m_isBatchDirty)
+                {
+                    m_isBatchDirty = true;
+                    transformBatch->MarkDirty(*this);
+                }
+                return;
+            }
+
+            if (transformBatch->IsResolving())
+            {
+                // Notifying brings this transform up to date, whether it was dirty itself or one of its ancestors was
+                m_isBatchDirty = false;
+                transformBatch->OnTransformResolved(GetEntityId());
+            }
+        }
+
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
     }
 
+    void TransformComponent::ResolveBatchedTransform()
+    {
+        // Ancestors moved during the batch did not notify this transform, apply their movement the way
+        // OnTransformChangedImpl would have
+        if (m_parentTM)
+        {
+            if (m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
+            {
+                m_worldTM = m_parentTM->GetWorldTM() * m_localTM;
+            }
+            else
+            {
+                m_localTM = m_parentTM->GetWorldTM().GetInverse() * m_worldTM;
+            }
+        }
+
+        NotifyTransformChanged();
+    }
+
+    AZ::u32 TransformComponent::GetHierarchyDepth() const
+    {
+        AZ::u32 depth = 0;
+        for (AZ::TransformInterface* parent = m_parentTM; parent; parent = parent->GetParent())
+        {
+            ++depth;
+        }
+        return depth;
+    }
+
     bool TransformComponent::AreMoveRequestsAllowed() const
     {
         // Don't allow static transform to be moved while entity is activated.
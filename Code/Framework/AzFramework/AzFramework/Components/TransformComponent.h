@@ -162,6 +162,17 @@ namespace AzFramework
         void ComputeWorldTM();
         //////////////////////////////////////////////////////////////////////////
 
+        //! Sends the change notifications, or defers them while a transform batch is open.
+        void NotifyTransformChanged();
+
+        //! Transform batching support, used by the TransformBatchSystem.
+        //! @{
+        //! Brings the deferred transform up to date with its parent and sends the change notifications.
+        void ResolveBatchedTransform();
+        //! Returns the number of ancestors of this transform.
+        AZ::u32 GetHierarchyDepth() const;
+        //! @}
+
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
@@ -188,6 +199,7 @@ namespace AzFramework
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
+        bool m_isBatchDirty = false; ///< If true, the transform changed during the open transform batch and has not notified yet.
         /// Behavior for this entity's transform when its parent's transform changes.
         AZ::OnParentChangedBehavior m_onParentChangedBehavior = AZ::OnParentChangedBehavior::Update;
     };
@@ -100,6 +100,7 @@ namespace AzFramework
         GameEntityContextRequestBus::Handler::BusConnect();
 
         m_entityVisibilityBoundsUnionSystem.Connect();
+        m_transformBatchSystem.Connect();
     }
 
     //=========================================================================
@@ -107,6 +108,7 @@ namespace AzFramework
     //=========================================================================
     void GameEntityContextComponent::Deactivate()
     {
+        m_transformBatchSystem.Disconnect();
         m_entityVisibilityBoundsUnionSystem.Disconnect();
 
         GameEntityContextRequestBus::Handler::BusDisconnect();
@@ -234,6 +236,7 @@ namespace AzFramework
             }
         }
 
+    #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
         for (AZ::Entity* entity : entities)
         {
             if (entity->GetState() == AZ::Entity::State::Init)
@@ -241,12 +244,23 @@ namespace AzFramework
                 if (entity->IsRuntimeActiveByDefault())
                 {
                     entity->Activate();
-                #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
                     PumpSystemEventsIfNeeded();
-                #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
                 }
             }
         }
+    #else
+        // Activated as a batch so the thread-safe components of all the entities can be activated in parallel
+        EntityList entitiesToActivate;
+        entitiesToActivate.reserve(entities.size());
+        for (AZ::Entity* entity : entities)
+        {
+            if (entity->GetState() == AZ::Entity::State::Init && entity->IsRuntimeActiveByDefault())
+            {
+                entitiesToActivate.push_back(entity);
+            }
+        }
+        AZ::Entity::ActivateEntities(entitiesToActivate);
+    #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
     }
 
     //=========================================================================
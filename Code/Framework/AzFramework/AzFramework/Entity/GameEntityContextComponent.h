@@ -14,6 +14,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipService.h>
+#include <AzFramework/Components/TransformBatchSystem.h>
 #include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
 
 #include "EntityContext.h"
@@ -92,6 +93,7 @@ namespace AzFramework
     private:
 
         AzFramework::EntityVisibilityBoundsUnionSystem m_entityVisibilityBoundsUnionSystem;
+        AzFramework::TransformBatchSystem m_transformBatchSystem;
     };
 } // namespace AzFramework
 
@@ -12,6 +12,7 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/string/conversions.h>
@@ -26,6 +27,15 @@ namespace AZ
     {
         const HandleType LocalHandleStartValue = 1000000; //start the local file io handles at 1 million
 
+        AZ_CVAR(AZ::u32, sys_fileMetadataCacheMs, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Milliseconds the existence, size and modification time of files are cached by LocalFileIO (0 disables the cache)."
+            " Useful for tools issuing many queries on slow or network drives, changes made by other processes are only seen"
+            " once the cached entry expires unless they're reported with InvalidateFileMetadata.");
+
+        // The caches are emptied when they reach these sizes, as entries can't be expired cheaply one by one
+        constexpr size_t MaxFileMetadataCacheEntries = 64 * 1024;
+        constexpr size_t MaxResolvedPathCacheEntries = 16 * 1024;
+
         LocalFileIO::LocalFileIO()
         {
             m_nextHandle = LocalHandleStartValue;
@@ -74,6 +84,10 @@ namespace AZ
                 // Attempt to open the newly created file
                 if (newPair.first->second.Open(resolvedPath, systemFileMode, 0))
                 {
+                    if (write)
+                    {
+                        InvalidateResolvedFileMetadata(resolvedPath);
+                    }
                     return ResultCode::Success;
                 }
                 else
@@ -97,6 +111,8 @@ namespace AZ
             }
 
             filePointer->Close();
+            // The size and modification time of a file written to are only final once it's closed
+            InvalidateResolvedFileMetadata(filePointer->Name());
 
             {
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_openFileGuard);
@@ -228,10 +244,11 @@ namespace AZ
             char resolvedPath[AZ_MAX_PATH_LEN];
             ResolvePath(filePath, resolvedPath, AZ_MAX_PATH_LEN);
 
-            size = SystemFile::Length(resolvedPath);
+            size = QueryFileMetadata(resolvedPath, FileMetadataSize, &FileMetadata::m_size,
+                [&resolvedPath] { return static_cast<AZ::u64>(SystemFile::Length(resolvedPath)); });
             if (!size)
             {
-                return SystemFile::Exists(resolvedPath) ? ResultCode::Success : ResultCode::Error;
+                return Exists(resolvedPath) ? ResultCode::Success : ResultCode::Error;
             }
 
             return ResultCode::Success;
@@ -261,7 +278,8 @@ namespace AZ
             char resolvedPath[AZ_MAX_PATH_LEN];
             ResolvePath(filePath, resolvedPath, AZ_MAX_PATH_LEN);
 
-            return SystemFile::ModificationTime(resolvedPath);
+            return QueryFileMetadata(resolvedPath, FileMetadataModificationTime, &FileMetadata::m_modificationTime,
+                [&resolvedPath] { return SystemFile::ModificationTime(resolvedPath); });
         }
 
         AZ::u64 LocalFileIO::ModificationTime(HandleType fileHandle)
@@ -280,7 +298,8 @@ namespace AZ
             char resolvedPath[AZ_MAX_PATH_LEN];
             ResolvePath(filePath, resolvedPath, AZ_MAX_PATH_LEN);
 
-            return SystemFile::Exists(resolvedPath);
+            return QueryFileMetadata(resolvedPath, FileMetadataExists, &FileMetadata::m_exists,
+                [&resolvedPath] { return SystemFile::Exists(resolvedPath); });
         }
 
         bool LocalFileIO::IsDirectory(const char* filePath)
@@ -288,7 +307,88 @@ namespace AZ
             char resolvedPath[AZ_MAX_PATH_LEN];
             ResolvePath(filePath, resolvedPath, AZ_MAX_PATH_LEN);
 
-            return SystemFile::IsDirectory(resolvedPath);
+            return QueryFileMetadata(resolvedPath, FileMetadataIsDirectory, &FileMetadata::m_isDirectory,
+                [&resolvedPath] { return SystemFile::IsDirectory(resolvedPath); });
+        }
+
+        template<typename ValueType, typename QueryFunction>
+        ValueType LocalFileIO::QueryFileMetadata(const char* resolvedPath, FileMetadataField field, ValueType FileMetadata::*value, QueryFunction&& query)
+        {
+            const AZ::u32 cacheDurationMs = sys_fileMetadataCacheMs;
+            if (cacheDurationMs == 0)
+            {
+                ++m_fileSystemQueries;
+                return query();
+            }
+
+            const auto now = AZStd::chrono::steady_clock::now();
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(m_fileMetadataCacheMutex);
+                if (auto it = m_fileMetadataCache.find(AZStd::string_view(resolvedPath));
+                    it != m_fileMetadataCache.end() && (it->second.m_knownFields & field) && now < it->second.m_expiration)
+                {
+                    ++m_fileMetadataCacheHits;
+                    return it->second.*value;
+                }
+            }
+
+            const AZ::u64 generation = m_fileMetadataGeneration.load(AZStd::memory_order_acquire);
+            ++m_fileSystemQueries;
+            const ValueType result = query();
+
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_fileMetadataCacheMutex);
+            if (generation == m_fileMetadataGeneration.load(AZStd::memory_order_acquire))
+            {
+                if (m_fileMetadataCache.size() >= MaxFileMetadataCacheEntries)
+                {
+                    m_fileMetadataCache.clear();
+                }
+
+                FileMetadata& metadata = m_fileMetadataCache[resolvedPath];
+                if (now >= metadata.m_expiration)
+                {
+                    metadata = {};
+                    metadata.m_expiration = now + AZStd::chrono::milliseconds(cacheDurationMs);
+                }
+                metadata.*value = result;
+                metadata.m_knownFields |= field;
+            }
+            return result;
+        }
+
+        void LocalFileIO::InvalidateResolvedFileMetadata(const char* resolvedPath)
+        {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_fileMetadataCacheMutex);
+            ++m_fileMetadataGeneration;
+            if (auto it = m_fileMetadataCache.find(AZStd::string_view(resolvedPath)); it != m_fileMetadataCache.end())
+            {
+                m_fileMetadataCache.erase(it);
+            }
+        }
+
+        void LocalFileIO::InvalidateFileMetadata(const char* filePath)
+        {
+            char resolvedPath[AZ_MAX_PATH_LEN];
+            if (ResolvePath(filePath, resolvedPath, AZ_MAX_PATH_LEN))
+            {
+                InvalidateResolvedFileMetadata(resolvedPath);
+            }
+        }
+
+        void LocalFileIO::ClearFileMetadataCache()
+        {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_fileMetadataCacheMutex);
+            ++m_fileMetadataGeneration;
+            m_fileMetadataCache.clear();
+        }
+
+        FileSystemQueryStatistics LocalFileIO::GetFileSystemQueryStatistics() const
+        {
+            FileSystemQueryStatistics statistics;
+            statistics.m_fileSystemQueries = m_fileSystemQueries;
+            statistics.m_fileMetadataCacheHits = m_fileMetadataCacheHits;
+            statistics.m_resolvedPathCacheHits = m_resolvedPathCacheHits;
+            return statistics;
         }
 
         void LocalFileIO::CheckInvalidWrite([[maybe_unused]] const char* path)
@@ -328,7 +428,9 @@ namespace AZ
                 return ResultCode::Error;
             }
 
-            return SystemFile::Delete(resolvedPath) ? ResultCode::Success : ResultCode::Error;
+            const bool deleted = SystemFile::Delete(resolvedPath);
+            InvalidateResolvedFileMetadata(resolvedPath);
+            return deleted ? ResultCode::Success : ResultCode::Error;
         }
 
         Result LocalFileIO::Rename(const char* originalFilePath, const char* newFilePath)
@@ -341,7 +443,10 @@ namespace AZ
 
             CheckInvalidWrite(resolvedNewPath);
 
-            if (!SystemFile::Rename(resolvedOldPath, resolvedNewPath))
+            const bool renamed = SystemFile::Rename(resolvedOldPath, resolvedNewPath);
+            // A renamed directory moves everything below it
+            ClearFileMetadataCache();
+            if (!renamed)
             {
                 return ResultCode::Error;
             }
@@ -423,7 +528,9 @@ namespace AZ
                 return ResultCode::Error;
             }
 
-            return DestroyPath_Recurse(this, resolvedPath);
+            const ResultCode result = DestroyPath_Recurse(this, resolvedPath);
+            ClearFileMetadataCache();
+            return result;
         }
 
         static void ToUnixSlashes(char* path, AZ::u64 size)
@@ -517,6 +624,14 @@ namespace AZ
                 }
             }
 
+            // Relative paths without a @products@ alias are resolved against the current directory, which isn't cached
+            const bool cacheResolvedPath = path[0] == '@' || GetAlias("@products@") != nullptr;
+            const AZ::u64 aliasVersion = m_aliasVersion.load(AZStd::memory_order_acquire);
+            if (cacheResolvedPath && FindResolvedPath(path, resolvedPath, resolvedPathSize))
+            {
+                return true;
+            }
+
             constexpr AZStd::string_view productAssetAlias = "@products@";
             // Add plus one for the path separator: <alias>/<path>
             constexpr size_t MaxPathSizeWithProductAssetAlias = AZ::IO::MaxPathLength + productAssetAlias.size() + 1;
@@ -555,12 +670,51 @@ namespace AZ
             if (ResolveAliases(rootedPath, resolvedPath, resolvedPathSize))
             {
                 ToUnixSlashes(resolvedPath, resolvedPathSize);
+                if (cacheResolvedPath)
+                {
+                    StoreResolvedPath(path, resolvedPath, aliasVersion);
+                }
                 return true;
             }
 
             return false;
         }
 
+        bool LocalFileIO::FindResolvedPath(const char* path, char* resolvedPath, AZ::u64 resolvedPathSize) const
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_resolvedPathCacheMutex);
+            if (auto it = m_resolvedPathCache.find(AZStd::string_view(path));
+                it != m_resolvedPathCache.end() && it->second.size() < resolvedPathSize)
+            {
+                azstrncpy(resolvedPath, resolvedPathSize, it->second.c_str(), it->second.size() + 1);
+                ++m_resolvedPathCacheHits;
+                return true;
+            }
+            return false;
+        }
+
+        void LocalFileIO::StoreResolvedPath(const char* path, const char* resolvedPath, AZ::u64 aliasVersion) const
+        {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_resolvedPathCacheMutex);
+            // Skip paths resolved while the aliases were changing
+            if (aliasVersion != m_aliasVersion.load(AZStd::memory_order_acquire))
+            {
+                return;
+            }
+            if (m_resolvedPathCache.size() >= MaxResolvedPathCacheEntries)
+            {
+                m_resolvedPathCache.clear();
+            }
+            m_resolvedPathCache.emplace(path, resolvedPath);
+        }
+
+        void LocalFileIO::OnAliasesChanged()
+        {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_resolvedPathCacheMutex);
+            ++m_aliasVersion;
+            m_resolvedPathCache.clear();
+        }
+
         bool LocalFileIO::ResolvePath(AZ::IO::FixedMaxPath& resolvedPath, const AZ::IO::PathView& path) const
         {
             if (AZ::IO::FixedMaxPathString fixedPath{ path.Native() };
@@ -580,6 +734,7 @@ namespace AZ
             ConvertToAbsolutePath(path, fullPath, AZ_MAX_PATH_LEN);
 
             m_aliases[key] = fullPath;
+            OnAliasesChanged();
         }
 
         const char* LocalFileIO::GetAlias(const char* key) const
@@ -641,11 +796,13 @@ namespace AZ
         void LocalFileIO::ClearAlias(const char* key)
         {
             m_aliases.erase(key);
+            OnAliasesChanged();
         }
 
         void LocalFileIO::SetDeprecatedAlias(AZStd::string_view oldAlias, AZStd::string_view newAlias)
         {
             m_deprecatedAliases[oldAlias] = newAlias;
+            OnAliasesChanged();
         }
 
         AZStd::optional<AZ::u64> LocalFileIO::ConvertToAliasBuffer(char* outBuffer, AZ::u64 outBufferLength, AZStd::string_view inBuffer) const
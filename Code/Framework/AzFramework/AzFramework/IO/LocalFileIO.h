@@ -8,8 +8,10 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/RTTI/RTTI.h>
@@ -24,6 +26,15 @@ namespace AZ
     namespace IO
     {
         class SystemFile;
+
+        //! Counts of the file system queries made by LocalFileIO and of the queries answered by its caches.
+        struct FileSystemQueryStatistics
+        {
+            AZ::u64 m_fileSystemQueries = 0;
+            AZ::u64 m_fileMetadataCacheHits = 0;
+            AZ::u64 m_resolvedPathCacheHits = 0;
+        };
+
         class LocalFileIO
             : public FileIOBase
         {
@@ -74,7 +85,41 @@ namespace AZ
             bool GetFilename(HandleType fileHandle, char* filename, AZ::u64 filenameSize) const override;
             bool ConvertToAbsolutePath(const char* path, char* absolutePath, AZ::u64 maxLength) const;
 
+            //! Exists, IsDirectory, Size and ModificationTime results are cached for sys_fileMetadataCacheMs milliseconds.
+            //! Changes made through this LocalFileIO invalidate the cache, changes made by other processes must be
+            //! reported with InvalidateFileMetadata, for instance from a file watcher.
+            void InvalidateFileMetadata(const char* filePath);
+            void ClearFileMetadataCache();
+
+            FileSystemQueryStatistics GetFileSystemQueryStatistics() const;
+
         private:
+            enum FileMetadataField : AZ::u8
+            {
+                FileMetadataExists = 1 << 0,
+                FileMetadataIsDirectory = 1 << 1,
+                FileMetadataSize = 1 << 2,
+                FileMetadataModificationTime = 1 << 3
+            };
+
+            struct FileMetadata
+            {
+                AZStd::chrono::steady_clock::time_point m_expiration;
+                AZ::u64 m_size = 0;
+                AZ::u64 m_modificationTime = 0;
+                bool m_exists = false;
+                bool m_isDirectory = false;
+                AZ::u8 m_knownFields = 0;
+            };
+
+            template<typename ValueType, typename QueryFunction>
+            ValueType QueryFileMetadata(const char* resolvedPath, FileMetadataField field, ValueType FileMetadata::*value, QueryFunction&& query);
+            void InvalidateResolvedFileMetadata(const char* resolvedPath);
+
+            bool FindResolvedPath(const char* path, char* resolvedPath, AZ::u64 resolvedPathSize) const;
+            void StoreResolvedPath(const char* path, const char* resolvedPath, AZ::u64 aliasVersion) const;
+            void OnAliasesChanged();
+
             SystemFile* GetFilePointerFromHandle(HandleType fileHandle);
 
             HandleType GetNextHandle();
@@ -94,6 +139,21 @@ namespace AZ
             AZStd::unordered_map<AZStd::string, AZStd::string> m_aliases;
             AZStd::unordered_map<AZStd::string, AZStd::string> m_deprecatedAliases;
 
+            // Alias paths resolved with the aliases of m_aliasVersion, cleared when the aliases change
+            mutable AZStd::shared_mutex m_resolvedPathCacheMutex;
+            mutable AZStd::unordered_map<AZStd::string, AZStd::string, AZStd::hash<AZStd::string>, AZStd::equal_to<>> m_resolvedPathCache;
+            AZStd::atomic<AZ::u64> m_aliasVersion{ 0 };
+
+            // Metadata of resolved paths, m_fileMetadataGeneration is incremented on every invalidation
+            // so queries racing with an invalidation don't store their result
+            AZStd::shared_mutex m_fileMetadataCacheMutex;
+            AZStd::unordered_map<AZStd::string, FileMetadata, AZStd::hash<AZStd::string>, AZStd::equal_to<>> m_fileMetadataCache;
+            AZStd::atomic<AZ::u64> m_fileMetadataGeneration{ 0 };
+
+            AZStd::atomic<AZ::u64> m_fileSystemQueries{ 0 };
+            AZStd::atomic<AZ::u64> m_fileMetadataCacheHits{ 0 };
+            mutable AZStd::atomic<AZ::u64> m_resolvedPathCacheHits{ 0 };
+
             void CheckInvalidWrite(const char* path);
         };
     } // namespace IO
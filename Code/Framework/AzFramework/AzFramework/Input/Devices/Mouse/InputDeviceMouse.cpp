@@ -193,6 +193,20 @@ namespace AzFramework
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputDeviceMouse::GetRawMovementSamples(AZStd::chrono::steady_clock::time_point since,
+                                                 AZStd::vector<RawMovementSample>& o_samples) const
+    {
+        if (m_pimpl)
+        {
+            m_pimpl->GetRawMovementSamples(since, o_samples);
+        }
+        else
+        {
+            o_samples.clear();
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     InputDeviceMouse::Implementation::Implementation(InputDeviceMouse& inputDevice)
         : m_inputDevice(inputDevice)
@@ -247,6 +261,42 @@ namespace AzFramework
         }
 
         lastSampleForThisAxis = now; // note:  this is intentionally tautology when its not a movement axis.
+
+        // Keep every raw movement sample before it is accumulated, for latency sensitive systems
+        for (AZ::u32 movementIndex = 0; movementIndex < Movement::All.size(); ++movementIndex)
+        {
+            if (inputChannelId == Movement::All[movementIndex])
+            {
+                RawMovementSample& sample = m_rawMovementSampleHistory[m_numRawMovementSamples % RawMovementSampleHistorySize];
+                sample.m_time = now;
+                sample.m_movementDelta = rawMovementDelta;
+                sample.m_movementIndex = movementIndex;
+                ++m_numRawMovementSamples;
+                break;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void InputDeviceMouse::Implementation::GetRawMovementSamples(AZStd::chrono::steady_clock::time_point since,
+                                                                 AZStd::vector<RawMovementSample>& o_samples) const
+    {
+        o_samples.clear();
+
+        // Walk back from the most recent sample to find the oldest one received after 'since'
+        const AZ::u64 numSamplesKept = AZStd::min<AZ::u64>(m_numRawMovementSamples, RawMovementSampleHistorySize);
+        AZ::u64 firstSample = m_numRawMovementSamples;
+        while (m_numRawMovementSamples - firstSample < numSamplesKept &&
+               m_rawMovementSampleHistory[(firstSample - 1) % RawMovementSampleHistorySize].m_time > since)
+        {
+            --firstSample;
+        }
+
+        o_samples.reserve(m_numRawMovementSamples - firstSample);
+        for (AZ::u64 sampleIndex = firstSample; sampleIndex < m_numRawMovementSamples; ++sampleIndex)
+        {
+            o_samples.push_back(m_rawMovementSampleHistory[sampleIndex % RawMovementSampleHistorySize]);
+        }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
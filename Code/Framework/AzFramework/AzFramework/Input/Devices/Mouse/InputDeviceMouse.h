@@ -194,6 +194,31 @@ namespace AzFramework
         //! \param[in] captureCursor True if the cursor should be visible, false if it should be hidden
         void SetCaptureCursor(bool captureCursor);
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! A raw mouse movement event as it was received from the platform, before it was queued
+        //! or accumulated according to the raw movement sample rate.
+        struct RawMovementSample
+        {
+            AZStd::chrono::steady_clock::time_point m_time; //!< The time the event was received
+            float m_movementDelta = 0.0f;                    //!< The raw movement delta
+            AZ::u32 m_movementIndex = 0;                     //!< The index of the channel in Movement::All
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! The number of most recent raw movement samples that are kept for GetRawMovementSamples
+        static constexpr inline AZ::u32 RawMovementSampleHistorySize{256};
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Get the raw mouse movement samples received after a point in time. Movement events are
+        //! dispatched at most at the raw movement sample rate, so latency sensitive systems can use
+        //! these to follow the movement at the polling rate of the mouse instead. Only the most
+        //! recent RawMovementSampleHistorySize samples are kept. This function is not thread safe,
+        //! and so should only be called from the main thread.
+        //! \param[in] since The samples received at or before this time are not returned
+        //! \param[out] o_samples The samples, ordered from oldest to newest
+        void GetRawMovementSamples(AZStd::chrono::steady_clock::time_point since,
+                                   AZStd::vector<RawMovementSample>& o_samples) const;
+
     protected:
         ////////////////////////////////////////////////////////////////////////////////////////////
         ///@{
@@ -283,6 +308,11 @@ namespace AzFramework
             //! \param[in] captureCursor True if the cursor should be visible, false if it should be hidden
             void SetCaptureCursor(bool captureCursor);
 
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! \ref AzFramework::InputDeviceMouse::GetRawMovementSamples
+            void GetRawMovementSamples(AZStd::chrono::steady_clock::time_point since,
+                                       AZStd::vector<RawMovementSample>& o_samples) const;
+
         protected:
             ////////////////////////////////////////////////////////////////////////////////////////
             //! Queue raw button events to be processed in the next call to ProcessRawEventQueues.
@@ -313,6 +343,7 @@ namespace AzFramework
             using RawButtonEventQueueByIdMap = AZStd::unordered_map<InputChannelId, AZStd::vector<bool>>;
             using RawMovementEventQueueByIdMap = AZStd::unordered_map<InputChannelId, AZStd::vector<float>>;
             using LastSampleTimeArray = AZStd::array<AZStd::chrono::steady_clock::time_point, InputDeviceMouse::Movement::All.size()>;
+            using RawMovementSampleHistory = AZStd::array<RawMovementSample, RawMovementSampleHistorySize>;
 
             ///@}
 
@@ -324,6 +355,8 @@ namespace AzFramework
             RawButtonEventQueueByIdMap   m_rawButtonEventQueuesById;   //!< Raw button events by id
             RawMovementEventQueueByIdMap m_rawMovementEventQueuesById; //!< Raw movement events by id
             LastSampleTimeArray          m_timeOfLastRawMovementSample;  //!< Time of the last raw movement sample
+            RawMovementSampleHistory     m_rawMovementSampleHistory;   //!< Ring of the most recent raw movement samples
+            AZ::u64                      m_numRawMovementSamples = 0;  //!< Total number of raw movement samples received
         protected:
             bool                         m_captureCursor;              //!< Should the cursor be captured?
         };
@@ -235,6 +235,7 @@ namespace AzFramework
         virtual bool IsEndpointOnline(AZ::Crc32 key, AZ::u32 desiredTargetID) = 0;
 
         //! Send a message to a remote endpoint
+        //! Messages of the same type are received in the order they're sent, messages of different types can be received out of order.
         //! @param target The endpoint to send a message to
         //! @param msg The message to send
         virtual void SendRemoteToolsMessage(const RemoteToolsEndpointInfo& target, const RemoteToolsMessage& msg) = 0;
@@ -11,6 +11,7 @@
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/algorithm.h>
 
 
 namespace AzPhysics
@@ -74,4 +75,25 @@ namespace AzPhysics
     {
         return &m_sceneGravityChangedEvent;
     }
+
+    bool Scene::QuerySceneBatch(const SceneQueryRequests& requests, SceneQueryHitsList& results)
+    {
+        results.resize(requests.size());
+        bool hasHits = false;
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            results[i].m_hits.clear();
+            hasHits = QueryScene(requests[i].get(), results[i]) || hasHits;
+        }
+        return hasHits;
+    }
+
+    bool SceneInterface::QuerySceneBatch(SceneHandle sceneHandle, const SceneQueryRequests& requests, SceneQueryHitsList& results)
+    {
+        results = QuerySceneBatch(sceneHandle, requests);
+        return AZStd::any_of(results.begin(), results.end(), [](const SceneQueryHits& hits)
+            {
+                return !hits.m_hits.empty();
+            });
+    }
 } // namespace AzPhysics
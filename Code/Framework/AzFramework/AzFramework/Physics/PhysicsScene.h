@@ -145,6 +145,15 @@ namespace AzPhysics
         //! @return Returns a list of SceneQueryHits. Will be in the same order as supplied in SceneQueryRequests.
         virtual SceneQueryHitsList QuerySceneBatch(SceneHandle sceneHandle, const SceneQueryRequests& requests) = 0;
 
+        //! Make many blocking queries into the scene, writing the hits into a list owned by the caller.
+        //! Reusing the same list each frame keeps the allocations of the hit lists.
+        //! The queries may run in parallel, so the filter callbacks of the requests need to be thread safe.
+        //! @param sceneHandle A handle to the scene to make the scene query with.
+        //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
+        //! @param results Resized to the number of requests, and filled in the same order as supplied in SceneQueryRequests.
+        //! @return Returns true if there is at least one hit for any of the requests.
+        virtual bool QuerySceneBatch(SceneHandle sceneHandle, const SceneQueryRequests& requests, SceneQueryHitsList& results);
+
         //! Make a non-blocking query into the scene.
         //! @param sceneHandle A handle to the scene to make the scene query with.
         //! @param requestId A user defined value to identify the request when the callback is called.
@@ -362,6 +371,14 @@ namespace AzPhysics
         //! @return Returns a list of SceneQueryHits. Will be in the same order as supplied in SceneQueryRequests.
         virtual SceneQueryHitsList QuerySceneBatch(const SceneQueryRequests& requests) = 0;
 
+        //! Make many blocking queries into the scene, writing the hits into a list owned by the caller.
+        //! Reusing the same list each frame keeps the allocations of the hit lists.
+        //! The queries may run in parallel, so the filter callbacks of the requests need to be thread safe.
+        //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
+        //! @param results Resized to the number of requests, and filled in the same order as supplied in SceneQueryRequests.
+        //! @return Returns true if there is at least one hit for any of the requests.
+        virtual bool QuerySceneBatch(const SceneQueryRequests& requests, SceneQueryHitsList& results);
+
         //! Make a non-blocking query into the scene.
         //! @param requestId A user defined valid to identify the request when the callback is called.
         //! @param request The request to make. Should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
@@ -203,6 +203,7 @@ namespace AzFramework
 
     using EntitySpawnCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableConstEntityContainerView)>;
     using EntityPreInsertionCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableEntityContainerView)>;
+    using EntitySpawnProgressCallback = AZStd::function<void(EntitySpawnTicket::Id, size_t activatedCount, size_t totalCount)>;
     using EntityDespawnCallback = AZStd::function<void(EntitySpawnTicket::Id)>;
     using RetrieveEntitySpawnTicketCallback = AZStd::function<void(EntitySpawnTicket&&)>;
     using ReloadSpawnableCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableConstEntityContainerView)>;
@@ -220,6 +221,10 @@ namespace AzFramework
         //! Callback that's called when spawning entities has completed. This can be triggered from a different thread than the one that
         //!     made the function call to spawn. The returned list of entities contains all the newly created entities.
         EntitySpawnCallback m_completionCallback;
+        //! Callback that's called every time a part of the newly created entities has been added to the game context. Adding entities
+        //!     is spread over multiple frames when the queue executing the call has a time budget, this reports how many of the
+        //!     entities have been added so far. This can be triggered from a different thread than the one that made the function call.
+        EntitySpawnProgressCallback m_progressCallback;
         //! The Serialize Context used to clone entities with. If this is not provided the global Serialize Contetx will be used.
         AZ::SerializeContext* m_serializeContext { nullptr };
         //! The priority at which this call will be executed.
@@ -234,6 +239,10 @@ namespace AzFramework
         //! Callback that's called when spawning entities has completed. This can be triggered from a different thread than the one that
         //!     made the function call to spawn. The returned list of entities contains all the newly created entities.
         EntitySpawnCallback m_completionCallback;
+        //! Callback that's called every time a part of the newly created entities has been added to the game context. Adding entities
+        //!     is spread over multiple frames when the queue executing the call has a time budget, this reports how many of the
+        //!     entities have been added so far. This can be triggered from a different thread than the one that made the function call.
+        EntitySpawnProgressCallback m_progressCallback;
         //! The Serialize Context used to clone entities with. If this is not provided the global Serialize Contetx will be used.
         AZ::SerializeContext* m_serializeContext{ nullptr };
         //! The priority at which this call will be executed.
@@ -309,6 +318,17 @@ namespace AzFramework
         SpawnablePriority m_priority{ SpawnablePriority_Default };
     };
 
+    struct PrewarmAllEntitiesOptionalArgs final
+    {
+        //! Callback that's called when the requested number of instances has been prepared. This can be triggered from a different
+        //!     thread than the one that made the function call.
+        BarrierCallback m_completionCallback;
+        //! The Serialize Context used to clone entities with. If this is not provided the global Serialize Context will be used.
+        AZ::SerializeContext* m_serializeContext{ nullptr };
+        //! The priority at which this call will be executed. Prewarming is meant to happen ahead of the spawns, so it defaults to low.
+        SpawnablePriority m_priority{ SpawnablePriority_Low };
+    };
+
     struct LoadBarrierOptionalArgs final
     {
         //! The priority at which this call will be executed.
@@ -409,6 +429,16 @@ namespace AzFramework
         virtual void ClaimEntities(
             EntitySpawnTicket& ticket, ClaimEntitiesCallback listCallback, ClaimEntitiesOptionalArgs optionalArgs = {}) = 0;
 
+        //! Prepares instances of all entities in the spawnable ahead of time, so that later calls to SpawnAllEntities on the same ticket
+        //!     only need to add the prepared entities to the game context instead of cloning them. The prepared entities are kept
+        //!     inactive by the ticket until they're spawned, and are released when the spawnable is reloaded, its aliases are updated
+        //!     or the ticket is destroyed. The number of prepared instances a ticket can hold may be capped by the implementation.
+        //! @param ticket The ticket the instances are prepared for.
+        //! @param instanceCount The number of prepared instances the ticket should hold, extra instances are released.
+        //! @param optionalArgs Optional additional arguments, see PrewarmAllEntitiesOptionalArgs.
+        virtual void PrewarmAllEntities(
+            EntitySpawnTicket& ticket, uint32_t instanceCount, PrewarmAllEntitiesOptionalArgs optionalArgs = {}) = 0;
+
         //! Blocks until all operations made on the provided ticket before the barrier call have completed.
         //! @param ticket The ticket to monitor.
         //! @param completionCallback Required callback that will be called as soon as the barrier has been reached.
@@ -44,6 +44,21 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            AZ::u64 maxPrewarmedInstances = m_maxPrewarmedInstancesPerTicket;
+            settingsRegistry->Get(maxPrewarmedInstances, "/O3DE/AzFramework/Spawnables/MaxPrewarmedInstancesPerTicket");
+            m_maxPrewarmedInstancesPerTicket = aznumeric_cast<uint32_t>(AZStd::min<AZ::u64>(maxPrewarmedInstances, UINT32_MAX));
+
+            double budgetMs = 0.0;
+            if (settingsRegistry->Get(budgetMs, "/O3DE/AzFramework/Spawnables/HighPriorityTimeBudgetMs"))
+            {
+                SetQueueTimeBudget(CommandQueuePriority::High, AZStd::chrono::microseconds(aznumeric_cast<AZ::s64>(budgetMs * 1000.0)));
+            }
+            if (settingsRegistry->Get(budgetMs, "/O3DE/AzFramework/Spawnables/RegularPriorityTimeBudgetMs"))
+            {
+                SetQueueTimeBudget(
+                    CommandQueuePriority::Regular, AZStd::chrono::microseconds(aznumeric_cast<AZ::s64>(budgetMs * 1000.0)));
+            }
         }
     }
 
@@ -61,6 +76,10 @@ namespace AzFramework
         queueEntry.m_serializeContext =
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
+        queueEntry.m_progressCallback = AZStd::move(optionalArgs.m_progressCallback);
+        queueEntry.m_firstNewEntityIndex = 0;
+        queueEntry.m_activatedCount = 0;
+        queueEntry.m_isActivating = false;
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
@@ -76,6 +95,10 @@ namespace AzFramework
         queueEntry.m_serializeContext =
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
+        queueEntry.m_progressCallback = AZStd::move(optionalArgs.m_progressCallback);
+        queueEntry.m_firstNewEntityIndex = 0;
+        queueEntry.m_activatedCount = 0;
+        queueEntry.m_isActivating = false;
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
         queueEntry.m_referencePreviouslySpawnedEntities = optionalArgs.m_referencePreviouslySpawnedEntities;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
@@ -186,6 +209,20 @@ namespace AzFramework
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
+    void SpawnableEntitiesManager::PrewarmAllEntities(
+        EntitySpawnTicket& ticket, uint32_t instanceCount, PrewarmAllEntitiesOptionalArgs optionalArgs)
+    {
+        AZ_Assert(ticket.IsValid(), "Ticket provided to PrewarmAllEntities hasn't been initialized.");
+
+        PrewarmAllEntitiesCommand queueEntry;
+        queueEntry.m_ticketId = ticket.GetId();
+        queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
+        queueEntry.m_serializeContext =
+            optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
+        queueEntry.m_instanceCount = instanceCount;
+        QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
+    }
+
     void SpawnableEntitiesManager::Barrier(EntitySpawnTicket& ticket, BarrierCallback completionCallback, BarrierOptionalArgs optionalArgs)
     {
         AZ_Assert(completionCallback, "Barrier on spawnable entities called without a valid callback to use.");
@@ -230,8 +267,30 @@ namespace AzFramework
         return result;
     }
 
+    void SpawnableEntitiesManager::SetQueueTimeBudget(CommandQueuePriority priority, AZStd::chrono::microseconds budget)
+    {
+        AZ_Assert(budget.count() >= 0, "The time budget for the spawnable entities queue can't be negative.");
+        if ((priority & CommandQueuePriority::High) == CommandQueuePriority::High)
+        {
+            m_highPriorityQueue.m_timeBudget = budget;
+        }
+        if ((priority & CommandQueuePriority::Regular) == CommandQueuePriority::Regular)
+        {
+            m_regularPriorityQueue.m_timeBudget = budget;
+        }
+    }
+
+    bool SpawnableEntitiesManager::HasTimeBudgetLeft() const
+    {
+        return AZStd::chrono::steady_clock::now() < m_budgetDeadline;
+    }
+
     auto SpawnableEntitiesManager::ProcessQueue(Queue& queue) -> CommandQueueStatus
     {
+        // The budget is only checked after a request has been processed so every call makes progress, even with a tiny budget.
+        m_budgetDeadline = queue.m_timeBudget.count() > 0 ? AZStd::chrono::steady_clock::now() + queue.m_timeBudget
+                                                          : AZStd::chrono::steady_clock::time_point::max();
+
         // Process delayed requests first.
         // Only process the requests that are currently in this queue, not the ones that could be re-added if they still can't complete.
         size_t delayedSize = queue.m_delayed.size();
@@ -249,6 +308,11 @@ namespace AzFramework
                 queue.m_delayed.emplace_back(AZStd::move(request));
             }
             queue.m_delayed.pop_front();
+
+            if (!HasTimeBudgetLeft())
+            {
+                return CommandQueueStatus::HasCommandsLeft;
+            }
         }
 
         // Process newly added requests.
@@ -276,6 +340,18 @@ namespace AzFramework
                         queue.m_delayed.emplace_back(AZStd::move(request));
                     }
                     pendingRequestQueue.pop();
+
+                    if (!HasTimeBudgetLeft())
+                    {
+                        // Keep the requests that weren't processed for the next call. Requests on the same ticket are executed in
+                        // the order they were queued in, so it's safe to move them behind the delayed requests.
+                        while (!pendingRequestQueue.empty())
+                        {
+                            queue.m_delayed.emplace_back(AZStd::move(pendingRequestQueue.front()));
+                            pendingRequestQueue.pop();
+                        }
+                        return CommandQueueStatus::HasCommandsLeft;
+                    }
                 }
             }
             else
@@ -342,20 +418,106 @@ namespace AzFramework
         return reinterpret_cast<Ticket*>(ticket)->m_spawnable;
     }
 
-    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityPrototype,
-        EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    auto SpawnableEntitiesManager::CreateClonePlan(const AZ::Entity& entityPrototype, AZ::SerializeContext& serializeContext)
+        -> ClonePlan
     {
-        // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
-        constexpr bool allowDuplicateIds = false;
+        size_t generatedIdCount = 0;
+        bool hasEntityReferences = false;
+        auto beginCB = [&generatedIdCount, &hasEntityReferences](
+                           void* ptr, const AZ::SerializeContext::ClassData* classData,
+                           const AZ::SerializeContext::ClassElement* elementData) -> bool
+        {
+            if (classData->m_typeId == azrtti_typeid<AZ::EntityId>())
+            {
+                if (elementData && AZ::FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction, elementData->m_attributes))
+                {
+                    generatedIdCount++;
+                }
+                else
+                {
+                    const AZ::EntityId* id = reinterpret_cast<const AZ::EntityId*>(ptr);
+                    if (elementData && (elementData->m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER))
+                    {
+                        id = *reinterpret_cast<const AZ::EntityId* const*>(ptr);
+                    }
+                    hasEntityReferences = hasEntityReferences || id->IsValid();
+                }
+            }
+            return true;
+        };
+        serializeContext.EnumerateObject(&entityPrototype, beginCB, nullptr, AZ::SerializeContext::ENUM_ACCESS_FOR_READ);
+
+        ClonePlan plan;
+        // Nested entities have their own generated ids, which need the full remapping to get new values.
+        plan.m_canRemapInSinglePass = generatedIdCount == 1;
+        plan.m_hasEntityReferences = hasEntityReferences;
+        plan.m_componentCount = entityPrototype.GetComponents().size();
+        return plan;
+    }
 
-        return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-            &entityPrototype, prototypeToCloneMap, &serializeContext);
+    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(
+        const AZ::Entity& entityPrototype,
+        EntityIdMap& prototypeToCloneMap,
+        ClonePlanMap& clonePlans,
+        AZ::SerializeContext& serializeContext)
+    {
+        auto planIt = clonePlans.find(&entityPrototype);
+        if (planIt == clonePlans.end())
+        {
+            planIt = clonePlans.emplace(&entityPrototype, CreateClonePlan(entityPrototype, serializeContext)).first;
+        }
+        else if (planIt->second.m_componentCount != entityPrototype.GetComponents().size())
+        {
+            planIt->second = CreateClonePlan(entityPrototype, serializeContext);
+        }
+        const ClonePlan& plan = planIt->second;
+
+        if (!plan.m_canRemapInSinglePass)
+        {
+            // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
+            constexpr bool allowDuplicateIds = false;
+
+            return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                &entityPrototype, prototypeToCloneMap, &serializeContext);
+        }
+
+        AZ::Entity* clone = serializeContext.CloneObject(&entityPrototype);
+        if (!clone)
+        {
+            return nullptr;
+        }
+
+        // Matches the id generation pass of the remapper, which keeps an existing mapping instead of overwriting it.
+        auto cloneIdIt = prototypeToCloneMap.find(entityPrototype.GetId());
+        if (cloneIdIt == prototypeToCloneMap.end())
+        {
+            cloneIdIt = prototypeToCloneMap.emplace(entityPrototype.GetId(), AZ::Entity::MakeId()).first;
+        }
+
+        if (plan.m_hasEntityReferences)
+        {
+            // The clone's own id is in the map now, so it's remapped together with the references to other entities.
+            AZ::IdUtils::Remapper<AZ::EntityId>::RemapIdsAndIdRefs(
+                clone,
+                [&prototypeToCloneMap](const AZ::EntityId& originalId) -> AZ::EntityId
+                {
+                    auto findIt = prototypeToCloneMap.find(originalId);
+                    return findIt != prototypeToCloneMap.end() ? findIt->second : originalId;
+                },
+                &serializeContext);
+        }
+        else
+        {
+            clone->SetId(cloneIdIt->second);
+        }
+        return clone;
     }
 
     AZ::Entity* SpawnableEntitiesManager::CloneSingleAliasedEntity(
         const AZ::Entity& entityPrototype,
         const Spawnable::EntityAlias& alias,
         EntityIdMap& prototypeToCloneMap,
+        ClonePlanMap& clonePlans,
         AZ::Entity* previouslySpawnedEntity,
         AZ::SerializeContext& serializeContext)
     {
@@ -364,20 +526,22 @@ namespace AzFramework
         {
         case Spawnable::EntityAliasType::Original:
             // Behave as the original version.
-            clone = CloneSingleEntity(entityPrototype, prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(entityPrototype, prototypeToCloneMap, clonePlans, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Disable:
             // Do nothing.
             return nullptr;
         case Spawnable::EntityAliasType::Replace:
-            clone = CloneSingleEntity(*(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(
+                *(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, clonePlans, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Additional:
             // The asset handler will have sorted and inserted a Spawnable::EntityAliasType::Original, so the just
             // spawn the additional entity.
-            clone = CloneSingleEntity(*(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(
+                *(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, clonePlans, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Merge:
@@ -444,8 +608,137 @@ namespace AzFramework
         }
     }
 
+    void SpawnableEntitiesManager::CloneAllEntities(
+        const Spawnable::EntityList& entitiesToSpawn,
+        const Spawnable::EntityAliasConstVisitor& aliases,
+        EntityIdMap& idMap,
+        AZStd::unordered_set<AZ::EntityId>& previouslySpawned,
+        ClonePlanMap& clonePlans,
+        AZStd::vector<AZ::Entity*>& clones,
+        AZStd::vector<uint32_t>& cloneIndices,
+        AZ::SerializeContext& serializeContext)
+    {
+        uint32_t entitiesToSpawnSize = aznumeric_caster(entitiesToSpawn.size());
+
+        // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
+        // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
+        // We clear out and regenerate the set of IDs for every instance of all entities, because presumably every entity reference
+        // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
+        // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
+        // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
+        InitializeEntityIdMappings(entitiesToSpawn, idMap, previouslySpawned);
+
+        auto aliasIt = aliases.begin();
+        auto aliasEnd = aliases.end();
+        if (aliasIt == aliasEnd)
+        {
+            for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+            {
+                // If this entity has previously been spawned, give it a new id in the reference map
+                RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), idMap, previouslySpawned);
+
+                clones.emplace_back(CloneSingleEntity(*entitiesToSpawn[i], idMap, clonePlans, serializeContext));
+                cloneIndices.push_back(i);
+            }
+        }
+        else
+        {
+            for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+            {
+                // If this entity has previously been spawned, give it a new id in the reference map
+                RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), idMap, previouslySpawned);
+
+                if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
+                {
+                    clones.emplace_back(CloneSingleEntity(*entitiesToSpawn[i], idMap, clonePlans, serializeContext));
+                    cloneIndices.push_back(i);
+                }
+                else
+                {
+                    // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so can
+                    // be safely executed in order without risking an invalid state.
+                    AZ::Entity* previousEntity = nullptr;
+                    do
+                    {
+                        AZ::Entity* clone = CloneSingleAliasedEntity(
+                            *entitiesToSpawn[i], *aliasIt, idMap, clonePlans, previousEntity, serializeContext);
+                        previousEntity = clone;
+                        if (clone)
+                        {
+                            clones.emplace_back(clone);
+                            cloneIndices.push_back(i);
+                        }
+                        ++aliasIt;
+                    } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == i);
+                }
+            }
+        }
+    }
+
+    void SpawnableEntitiesManager::ReleasePrewarmedInstances(Ticket& ticket, size_t keepCount)
+    {
+        while (ticket.m_prewarmedInstances.size() > keepCount)
+        {
+            // The entities were never added to the game context, so the ticket still owns them.
+            for (AZ::Entity* entity : ticket.m_prewarmedInstances.back().m_entities)
+            {
+                delete entity;
+            }
+            ticket.m_prewarmedInstances.pop_back();
+        }
+    }
+
+    template<typename T>
+    auto SpawnableEntitiesManager::ActivateSpawnedEntities(T& request) -> CommandResult
+    {
+        Ticket& ticket = *request.m_ticket;
+        auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + request.m_firstNewEntityIndex;
+        auto newEntitiesEnd = ticket.m_spawnedEntities.end();
+        size_t newEntityCount = AZStd::distance(newEntitiesBegin, newEntitiesEnd);
+
+        // Add to the game context, now the entities are active
+        while (request.m_activatedCount < newEntityCount)
+        {
+            AZ::Entity* clone = *(newEntitiesBegin + request.m_activatedCount);
+            clone->SetEntitySpawnTicketId(request.m_ticketId);
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+            ++request.m_activatedCount;
+
+            if (!HasTimeBudgetLeft())
+            {
+                break;
+            }
+        }
+
+        if (request.m_progressCallback && newEntityCount > 0)
+        {
+            request.m_progressCallback(request.m_ticketId, request.m_activatedCount, newEntityCount);
+        }
+
+        if (request.m_activatedCount < newEntityCount)
+        {
+            // Other requests on this ticket wait until all entities have been added, so the ticket's entities don't change meanwhile.
+            return CommandResult::Requeue;
+        }
+
+        // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
+        if (request.m_completionCallback)
+        {
+            request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
+        }
+
+        request.m_isActivating = false;
+        ticket.m_currentRequestId++;
+        return CommandResult::Executed;
+    }
+
     auto SpawnableEntitiesManager::ProcessRequest(SpawnAllEntitiesCommand& request) -> CommandResult
     {
+        if (request.m_isActivating)
+        {
+            return ActivateSpawnedEntities(request);
+        }
+
         Ticket& ticket = *request.m_ticket;
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
@@ -466,63 +759,22 @@ namespace AzFramework
                 spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
                 spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
 
-                // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
-                // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
-                // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
-                // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
-                // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
-                // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
-                InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                auto aliasIt = aliases.begin();
-                auto aliasEnd = aliases.end();
-                if (aliasIt == aliasEnd)
+                if (!ticket.m_prewarmedInstances.empty())
                 {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
-                    {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                        spawnedEntities.emplace_back(
-                            CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                        spawnedEntityIndices.push_back(i);
-                    }
+                    // Use an instance that was cloned ahead of time, together with the id mappings it was cloned with.
+                    PrewarmedInstance& instance = ticket.m_prewarmedInstances.back();
+                    spawnedEntities.insert(spawnedEntities.end(), instance.m_entities.begin(), instance.m_entities.end());
+                    spawnedEntityIndices.insert(
+                        spawnedEntityIndices.end(), instance.m_entityIndices.begin(), instance.m_entityIndices.end());
+                    ticket.m_entityIdReferenceMap = AZStd::move(instance.m_entityIdReferenceMap);
+                    ticket.m_previouslySpawned = AZStd::move(instance.m_previouslySpawned);
+                    ticket.m_prewarmedInstances.pop_back();
                 }
                 else
                 {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
-                    {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                        if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
-                        {
-                            spawnedEntities.emplace_back(
-                                CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                            spawnedEntityIndices.push_back(i);
-                        }
-                        else
-                        {
-                            // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so can
-                            // be safely executed in order without risking an invalid state.
-                            AZ::Entity* previousEntity = nullptr;
-                            do
-                            {
-                                AZ::Entity* clone = CloneSingleAliasedEntity(
-                                    *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
-                                    *request.m_serializeContext);
-                                previousEntity = clone;
-                                if (clone)
-                                {
-                                    spawnedEntities.emplace_back(clone);
-                                    spawnedEntityIndices.push_back(i);
-                                }
-                                ++aliasIt;
-                            } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == i);
-                        }
-                    }
+                    CloneAllEntities(
+                        entitiesToSpawn, aliases, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned, ticket.m_clonePlans,
+                        spawnedEntities, spawnedEntityIndices, *request.m_serializeContext);
                 }
 
                 // There were no initial entities then the ticket now holds exactly all entities. If there were already entities then
@@ -537,22 +789,9 @@ namespace AzFramework
                     request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
                 }
 
-                // Add to the game context, now the entities are active
-                for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
-                {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
-                }
-
-                // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
-                if (request.m_completionCallback)
-                {
-                    request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
-                }
-
-                ticket.m_currentRequestId++;
-                return CommandResult::Executed;
+                request.m_firstNewEntityIndex = spawnedEntitiesInitialCount;
+                request.m_isActivating = true;
+                return ActivateSpawnedEntities(request);
             }
         }
         return CommandResult::Requeue;
@@ -560,6 +799,11 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessRequest(SpawnEntitiesCommand& request) -> CommandResult
     {
+        if (request.m_isActivating)
+        {
+            return ActivateSpawnedEntities(request);
+        }
+
         Ticket& ticket = *request.m_ticket;
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
@@ -607,8 +851,8 @@ namespace AzFramework
                             RefreshEntityIdMapping(
                                 entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                            spawnedEntities.push_back(
-                                CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                            spawnedEntities.push_back(CloneSingleEntity(
+                                *entitiesToSpawn[index], ticket.m_entityIdReferenceMap, ticket.m_clonePlans, *request.m_serializeContext));
                             spawnedEntityIndices.push_back(index);
                         }
                     }
@@ -632,8 +876,9 @@ namespace AzFramework
 
                             if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != index)
                             {
-                                spawnedEntities.emplace_back(
-                                    CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                spawnedEntities.emplace_back(CloneSingleEntity(
+                                    *entitiesToSpawn[index], ticket.m_entityIdReferenceMap, ticket.m_clonePlans,
+                                    *request.m_serializeContext));
                                 spawnedEntityIndices.push_back(index);
                             }
                             else
@@ -644,8 +889,8 @@ namespace AzFramework
                                 do
                                 {
                                     AZ::Entity* clone = CloneSingleAliasedEntity(
-                                        *entitiesToSpawn[index], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
-                                        *request.m_serializeContext);
+                                        *entitiesToSpawn[index], *aliasIt, ticket.m_entityIdReferenceMap, ticket.m_clonePlans,
+                                        previousEntity, *request.m_serializeContext);
                                     previousEntity = clone;
                                     if (clone)
                                     {
@@ -670,24 +915,9 @@ namespace AzFramework
                             ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
                 }
 
-                // Add to the game context, now the entities are active
-                for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
-                {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
-                }
-
-                if (request.m_completionCallback)
-                {
-                    request.m_completionCallback(
-                        request.m_ticketId,
-                        SpawnableConstEntityContainerView(
-                            ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
-                }
-
-                ticket.m_currentRequestId++;
-                return CommandResult::Executed;
+                request.m_firstNewEntityIndex = spawnedEntitiesInitialCount;
+                request.m_isActivating = true;
+                return ActivateSpawnedEntities(request);
             }
         }
         return CommandResult::Requeue;
@@ -782,6 +1012,8 @@ namespace AzFramework
 
             // Rebuild the list of entities.
             ticket.m_spawnedEntities.clear();
+            ReleasePrewarmedInstances(ticket, 0);
+            ticket.m_clonePlans.clear();
             const Spawnable::EntityList& entities = request.m_spawnable->GetEntities();
 
             // Pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
@@ -802,7 +1034,8 @@ namespace AzFramework
                     // If this entity has previously been spawned, give it a new id in the reference map
                     RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone = CloneSingleEntity(
+                        *entities[i], ticket.m_entityIdReferenceMap, ticket.m_clonePlans, *request.m_serializeContext);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     ticket.m_spawnedEntities.push_back(clone);
@@ -823,7 +1056,8 @@ namespace AzFramework
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        AZ::Entity* clone = CloneSingleEntity(
+                            *entities[index], ticket.m_entityIdReferenceMap, ticket.m_clonePlans, *request.m_serializeContext);
                         AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
                         ticket.m_spawnedEntities.push_back(clone);
                     }
@@ -859,6 +1093,8 @@ namespace AzFramework
                     aliases.UpdateAliasType(replacement.m_aliasIndex, replacement.m_newAliasType);
                 }
                 aliases.Optimize();
+                // The prewarmed instances were cloned with the previous alias types.
+                ReleasePrewarmedInstances(ticket, 0);
 
                 if (request.m_completionCallback)
                 {
@@ -927,6 +1163,50 @@ namespace AzFramework
         }
     }
 
+    auto SpawnableEntitiesManager::ProcessRequest(PrewarmAllEntitiesCommand& request) -> CommandResult
+    {
+        Ticket& ticket = *request.m_ticket;
+        if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
+        {
+            if (Spawnable::EntityAliasConstVisitor aliases = ticket.m_spawnable->TryGetAliasesConst();
+                aliases.IsValid() && aliases.AreAllSpawnablesReady())
+            {
+                AZ_Warning(
+                    "Spawnables", request.m_instanceCount <= m_maxPrewarmedInstancesPerTicket,
+                    "Requested %u prewarmed instances, but tickets are limited to %u.", request.m_instanceCount,
+                    m_maxPrewarmedInstancesPerTicket);
+                size_t instanceCount = AZStd::min(request.m_instanceCount, m_maxPrewarmedInstancesPerTicket);
+                ReleasePrewarmedInstances(ticket, instanceCount);
+
+                const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+                while (ticket.m_prewarmedInstances.size() < instanceCount)
+                {
+                    PrewarmedInstance& instance = ticket.m_prewarmedInstances.emplace_back();
+                    instance.m_entities.reserve(entitiesToSpawn.size());
+                    instance.m_entityIndices.reserve(entitiesToSpawn.size());
+                    CloneAllEntities(
+                        entitiesToSpawn, aliases, instance.m_entityIdReferenceMap, instance.m_previouslySpawned, ticket.m_clonePlans,
+                        instance.m_entities, instance.m_entityIndices, *request.m_serializeContext);
+
+                    // The instances cloned so far are kept on the ticket, so the remaining ones can continue on the next call.
+                    if (ticket.m_prewarmedInstances.size() < instanceCount && !HasTimeBudgetLeft())
+                    {
+                        return CommandResult::Requeue;
+                    }
+                }
+
+                if (request.m_completionCallback)
+                {
+                    request.m_completionCallback(request.m_ticketId);
+                }
+
+                ticket.m_currentRequestId++;
+                return CommandResult::Executed;
+            }
+        }
+        return CommandResult::Requeue;
+    }
+
     auto SpawnableEntitiesManager::ProcessRequest(BarrierCommand& request) -> CommandResult
     {
         Ticket& ticket = *request.m_ticket;
@@ -1046,6 +1326,7 @@ namespace AzFramework
                 }
             }
 
+            ReleasePrewarmedInstances(*request.m_ticket, 0);
             m_entitySpawnTicketMap.erase(request.m_ticket->m_ticketId);
 
             delete request.m_ticket;
@@ -10,6 +10,7 @@
 
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/limits.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/variant.h>
@@ -34,6 +35,20 @@ namespace AzFramework
         AZ_CLASS_ALLOCATOR(SpawnableEntitiesManager, AZ::SystemAllocator);
 
         using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        //! Summary of the entity ids in a prototype entity, gathered the first time the prototype is cloned so repeated spawns can
+        //! skip the id remapping passes that wouldn't change anything.
+        struct ClonePlan
+        {
+            //! The prototype's own id is the only id that gets a newly generated value, so the clone's own id and its references can
+            //! be remapped in a single pass.
+            bool m_canRemapInSinglePass;
+            //! The prototype has valid entity ids besides its own. Without these only the clone's own id needs to be replaced.
+            bool m_hasEntityReferences;
+            //! Number of components on the prototype when the plan was made, to catch prototypes that were changed since.
+            size_t m_componentCount;
+        };
+        using ClonePlanMap = AZStd::unordered_map<const AZ::Entity*, ClonePlan>;
         
         enum class CommandQueueStatus : bool
         {
@@ -77,6 +92,8 @@ namespace AzFramework
             EntitySpawnTicket& ticket, ListIndicesEntitiesCallback listCallback, ListEntitiesOptionalArgs optionalArgs = {}) override;
         void ClaimEntities(
             EntitySpawnTicket& ticket, ClaimEntitiesCallback listCallback, ClaimEntitiesOptionalArgs optionalArgs = {}) override;
+        void PrewarmAllEntities(
+            EntitySpawnTicket& ticket, uint32_t instanceCount, PrewarmAllEntitiesOptionalArgs optionalArgs = {}) override;
 
         void Barrier(EntitySpawnTicket& spawnInfo, BarrierCallback completionCallback, BarrierOptionalArgs optionalArgs = {}) override;
         void LoadBarrier(
@@ -88,6 +105,14 @@ namespace AzFramework
 
         CommandQueueStatus ProcessQueue(CommandQueuePriority priority);
 
+        //! Sets the time a single call to ProcessQueue can spend on the commands of the queues with the given priorities.
+        //! Commands that are started after the budget ran out wait for the next call, and spawn commands add their entities to the
+        //! game context in parts spread over multiple calls. A budget of zero, the default, means there's no limit.
+        //! The starting budgets can be configured through the Settings Registry under the keys
+        //! "/O3DE/AzFramework/Spawnables/HighPriorityTimeBudgetMs" and "/O3DE/AzFramework/Spawnables/RegularPriorityTimeBudgetMs".
+        //! This function isn't thread safe and should be called from the same thread as ProcessQueue.
+        void SetQueueTimeBudget(CommandQueuePriority priority, AZStd::chrono::microseconds budget);
+
     protected:
         enum class CommandResult : bool
         {
@@ -95,6 +120,16 @@ namespace AzFramework
             Requeue
         };
 
+        //! Instance of all entities in a spawnable that was cloned ahead of time by PrewarmAllEntities.
+        struct PrewarmedInstance final
+        {
+            AZStd::vector<AZ::Entity*> m_entities;
+            AZStd::vector<uint32_t> m_entityIndices;
+            //! The id mappings the entities were cloned with, taken over by the ticket when the instance is spawned.
+            EntityIdMap m_entityIdReferenceMap;
+            AZStd::unordered_set<AZ::EntityId> m_previouslySpawned;
+        };
+
         struct Ticket final
         {
             AZ_CLASS_ALLOCATOR(Ticket, AZ::ThreadPoolAllocator);
@@ -116,6 +151,11 @@ namespace AzFramework
             //! For this to work, we also need to keep track of whether or not each entity has been spawned at least once, so we know
             //! whether or not to replace the id in the map when spawning a new instance of that entity.
             AZStd::unordered_set<AZ::EntityId> m_previouslySpawned;
+            //! Clone plans of the prototype entities spawned through this ticket, including the ones from aliased spawnables.
+            //! Cleared when the spawnable is reloaded, as the prototypes are replaced.
+            ClonePlanMap m_clonePlans;
+            //! Inactive instances of all entities owned by the ticket, used by SpawnAllEntities before cloning new ones.
+            AZStd::vector<PrewarmedInstance> m_prewarmedInstances;
 
             AZStd::vector<AZ::Entity*> m_spawnedEntities;
             AZStd::vector<uint32_t> m_spawnedEntityIndices;
@@ -129,21 +169,31 @@ namespace AzFramework
         struct SpawnAllEntitiesCommand final
         {
             EntitySpawnCallback m_completionCallback;
+            EntitySpawnProgressCallback m_progressCallback;
             EntityPreInsertionCallback m_preInsertionCallback;
             AZ::SerializeContext* m_serializeContext;
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            //! Entities are added to the game context after they've all been cloned, possibly over multiple calls to ProcessQueue.
+            size_t m_firstNewEntityIndex;
+            size_t m_activatedCount;
+            bool m_isActivating;
         };
         struct SpawnEntitiesCommand final
         {
             AZStd::vector<uint32_t> m_entityIndices;
             EntitySpawnCallback m_completionCallback;
+            EntitySpawnProgressCallback m_progressCallback;
             EntityPreInsertionCallback m_preInsertionCallback;
             AZ::SerializeContext* m_serializeContext;
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            //! Entities are added to the game context after they've all been cloned, possibly over multiple calls to ProcessQueue.
+            size_t m_firstNewEntityIndex;
+            size_t m_activatedCount;
+            bool m_isActivating;
             bool m_referencePreviouslySpawnedEntities;
         };
         struct DespawnAllEntitiesCommand final
@@ -199,6 +249,15 @@ namespace AzFramework
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
         };
+        struct PrewarmAllEntitiesCommand final
+        {
+            BarrierCallback m_completionCallback;
+            AZ::SerializeContext* m_serializeContext;
+            Ticket* m_ticket;
+            EntitySpawnTicket::Id m_ticketId;
+            uint32_t m_requestId;
+            uint32_t m_instanceCount;
+        };
         struct BarrierCommand final
         {
             BarrierCallback m_completionCallback;
@@ -240,6 +299,7 @@ namespace AzFramework
             ListEntitiesCommand,
             ListIndicesEntitiesCommand,
             ClaimEntitiesCommand,
+            PrewarmAllEntitiesCommand,
             BarrierCommand,
             LoadBarrierCommand,
             RetrieveTicketCommand,
@@ -251,6 +311,7 @@ namespace AzFramework
             AZStd::deque<Requests> m_delayed; //!< Requests that were processed before, but couldn't be completed.
             AZStd::queue<Requests> m_pendingRequest; //!< Requests waiting to be processed for the first time.
             AZStd::mutex m_pendingRequestMutex;
+            AZStd::chrono::microseconds m_timeBudget{ 0 }; //!< Time each call to ProcessQueue can spend on this queue, zero for no limit.
         };
 
         template<typename T>
@@ -263,13 +324,33 @@ namespace AzFramework
         const AZ::Data::Asset<Spawnable>& GetSpawnableOnTicket(void* ticket) override;
         
         CommandQueueStatus ProcessQueue(Queue& queue);
+        bool HasTimeBudgetLeft() const;
 
+        //! Adds the entities cloned by a spawn command to the game context for as long as the time budget allows.
+        template<typename T>
+        CommandResult ActivateSpawnedEntities(T& request);
+
+        static ClonePlan CreateClonePlan(const AZ::Entity& entityPrototype, AZ::SerializeContext& serializeContext);
+        void CloneAllEntities(
+            const Spawnable::EntityList& entitiesToSpawn,
+            const Spawnable::EntityAliasConstVisitor& aliases,
+            EntityIdMap& idMap,
+            AZStd::unordered_set<AZ::EntityId>& previouslySpawned,
+            ClonePlanMap& clonePlans,
+            AZStd::vector<AZ::Entity*>& clones,
+            AZStd::vector<uint32_t>& cloneIndices,
+            AZ::SerializeContext& serializeContext);
+        static void ReleasePrewarmedInstances(Ticket& ticket, size_t keepCount);
         AZ::Entity* CloneSingleEntity(
-            const AZ::Entity& entityPrototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+            const AZ::Entity& entityPrototype,
+            EntityIdMap& prototypeToCloneMap,
+            ClonePlanMap& clonePlans,
+            AZ::SerializeContext& serializeContext);
         AZ::Entity* CloneSingleAliasedEntity(
             const AZ::Entity& entityPrototype,
             const Spawnable::EntityAlias& alias,
             EntityIdMap& prototypeToCloneMap,
+            ClonePlanMap& clonePlans,
             AZ::Entity* previouslySpawnedEntity,
             AZ::SerializeContext& serializeContext);
         void AppendComponents(
@@ -287,6 +368,7 @@ namespace AzFramework
         CommandResult ProcessRequest(ListEntitiesCommand& request);
         CommandResult ProcessRequest(ListIndicesEntitiesCommand& request);
         CommandResult ProcessRequest(ClaimEntitiesCommand& request);
+        CommandResult ProcessRequest(PrewarmAllEntitiesCommand& request);
         CommandResult ProcessRequest(BarrierCommand& request);
         CommandResult ProcessRequest(LoadBarrierCommand& request);
         CommandResult ProcessRequest(RetrieveTicketCommand& request);
@@ -304,6 +386,8 @@ namespace AzFramework
 
         Queue m_highPriorityQueue;
         Queue m_regularPriorityQueue;
+        //! The time at which the queue that's currently being processed runs out of its time budget.
+        AZStd::chrono::steady_clock::time_point m_budgetDeadline{ AZStd::chrono::steady_clock::time_point::max() };
 
         AZ::SerializeContext* m_defaultSerializeContext { nullptr };
         //! The threshold used to determine if a request goes in the regular (if bigger than the value) or high priority queue (if smaller
@@ -311,6 +395,9 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! The maximum number of prewarmed instances a single ticket can hold, to cap the memory kept by inactive entities. This can be
+        //! configured through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/MaxPrewarmedInstancesPerTicket".
+        uint32_t m_maxPrewarmedInstancesPerTicket { 64 };
 
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
@@ -0,0 +1,670 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Visibility/BvhScene.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdBatch.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/utility/pair.h>
+
+namespace AzFramework
+{
+    AZ_CVAR(uint32_t, bg_bvhLeafMaxEntries,              32, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries in a bvh leaf when the bvh is rebuilt");
+    AZ_CVAR(float,    bg_bvhRebuildRatio,              0.2f, nullptr, AZ::ConsoleFunctorFlags::Null, "Fraction of the entries that must be inserted, moved or removed before the bvh is rebuilt");
+    AZ_CVAR(uint32_t, bg_bvhRebuildMinModifications,    256, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entry insertions, moves or removals before the bvh is rebuilt");
+    AZ_CVAR(bool,     bg_bvhBackgroundRebuild,         true, nullptr, AZ::ConsoleFunctorFlags::Null, "If set to true, the bvh is rebuilt on a job while the current hierarchy stays in use");
+
+    // Bounds how deep a hierarchy can be traversed, built hierarchies are balanced so this is never reached in practice
+    static constexpr uint32_t MaxTraversalStackSize = 256;
+
+    static float GetInsertionCost(const AZ::Aabb& childBounds, const AZ::Aabb& bounds)
+    {
+        if (!childBounds.IsValid())
+        {
+            return bounds.GetSurfaceArea();
+        }
+        AZ::Aabb combined = childBounds;
+        combined.AddAabb(bounds);
+        return combined.GetSurfaceArea() - childBounds.GetSurfaceArea();
+    }
+
+    BvhScene::Node::Node()
+    {
+        for (uint32_t child = 0; child < ChildCount; ++child)
+        {
+            m_minX[child] = m_minY[child] = m_minZ[child] = AZ::Constants::FloatMax;
+            m_maxX[child] = m_maxY[child] = m_maxZ[child] = -AZ::Constants::FloatMax;
+            m_children[child] = InvalidIndex;
+        }
+    }
+
+    AZ::Aabb BvhScene::Node::GetChildBounds(uint32_t child) const
+    {
+        // Unused children have null bounds, which CreateFromMinMax would assert on
+        return AZ::Aabb::CreateFromMinMaxValues(m_minX[child], m_minY[child], m_minZ[child], m_maxX[child], m_maxY[child], m_maxZ[child]);
+    }
+
+    void BvhScene::Node::SetChildBounds(uint32_t child, const AZ::Aabb& bounds)
+    {
+        const AZ::Vector3& min = bounds.GetMin();
+        const AZ::Vector3& max = bounds.GetMax();
+        m_minX[child] = min.GetX();
+        m_minY[child] = min.GetY();
+        m_minZ[child] = min.GetZ();
+        m_maxX[child] = max.GetX();
+        m_maxY[child] = max.GetY();
+        m_maxZ[child] = max.GetZ();
+    }
+
+    BvhScene::BvhScene(const AZ::Name& sceneName)
+        : m_sceneName(sceneName)
+    {
+        AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
+        InitializeTree(m_tree);
+    }
+
+    BvhScene::~BvhScene()
+    {
+        WaitForRebuild();
+    }
+
+    const AZ::Name& BvhScene::GetName() const
+    {
+        return m_sceneName;
+    }
+
+    void BvhScene::InsertOrUpdateEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (InsertOrUpdateEntryLocked(entry))
+        {
+            TryStartRebuild();
+        }
+    }
+
+    void BvhScene::InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> entries)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        bool modified = false;
+        for (VisibilityEntry* entry : entries)
+        {
+            modified |= InsertOrUpdateEntryLocked(*entry);
+        }
+
+        // A single rebuild check for the whole batch
+        if (modified)
+        {
+            TryStartRebuild();
+        }
+    }
+
+    bool BvhScene::InsertOrUpdateEntryLocked(VisibilityEntry& entry)
+    {
+        if (entry.m_internalNode == &m_boundNode)
+        {
+            const uint32_t slot = entry.m_internalNodeIndex;
+            AZ_Assert(m_slotEntries[slot] == &entry, "Visibility entry data is corrupt");
+
+            // Entries that are still within their leaf are left untouched, otherwise the leaf and its ancestors are grown
+            Leaf& leaf = m_tree.m_leaves[m_slotLeaves[slot]];
+            if (AZ::ShapeIntersection::Contains(leaf.m_bounds, entry.m_boundingVolume))
+            {
+                return false;
+            }
+            leaf.m_bounds.AddAabb(entry.m_boundingVolume);
+            RefitFromLeaf(m_slotLeaves[slot]);
+        }
+        else
+        {
+            AZ_Assert(entry.m_internalNode == nullptr, "Insert invoked for an entry bound to a different IVisibilityScene");
+
+            uint32_t slot;
+            if (!m_freeSlots.empty())
+            {
+                slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+            else
+            {
+                slot = aznumeric_cast<uint32_t>(m_slotEntries.size());
+                m_slotEntries.push_back(nullptr);
+                m_slotLeaves.push_back(InvalidIndex);
+                m_slotLeafIndices.push_back(0);
+                m_slotVersions.push_back(0);
+            }
+
+            m_slotEntries[slot] = &entry;
+            ++m_slotVersions[slot];
+            entry.m_internalNode = &m_boundNode;
+            entry.m_internalNodeIndex = slot;
+            InsertIntoTree(slot);
+            ++m_entryCount;
+        }
+
+        ++m_modificationCount;
+        return true;
+    }
+
+    void BvhScene::RemoveEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalNode != &m_boundNode)
+        {
+            AZ_Assert(entry.m_internalNode == nullptr, "Remove invoked for an entry bound to a different IVisibilityScene");
+            return;
+        }
+
+        const uint32_t slot = entry.m_internalNodeIndex;
+        AZ_Assert(m_slotEntries[slot] == &entry, "Visibility entry data is corrupt");
+        RemoveFromTree(slot);
+        m_slotEntries[slot] = nullptr;
+        m_freeSlots.push_back(slot);
+
+        entry.m_internalNode = nullptr;
+        entry.m_internalNodeIndex = 0;
+        --m_entryCount;
+
+        ++m_modificationCount;
+        TryStartRebuild();
+    }
+
+    template <typename ChildTest>
+    void BvhScene::EnumerateHelper(const ChildTest& childTest, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+
+        AZStd::fixed_vector<uint32_t, MaxTraversalStackSize> nodeStack;
+        nodeStack.push_back(0);
+        while (!nodeStack.empty())
+        {
+            const Node& node = m_tree.m_nodes[nodeStack.back()];
+            nodeStack.pop_back();
+
+            // All children of a node are tested together
+            bool overlaps[ChildCount];
+            childTest(node, overlaps);
+
+            for (uint32_t child = 0; child < ChildCount; ++child)
+            {
+                const uint32_t childIndex = node.m_children[child];
+                if (childIndex == InvalidIndex || !overlaps[child])
+                {
+                    continue;
+                }
+
+                if (childIndex & LeafFlag)
+                {
+                    const Leaf& leaf = m_tree.m_leaves[childIndex & ~LeafFlag];
+                    if (!leaf.m_entries.empty())
+                    {
+                        callback({ leaf.m_bounds, leaf.m_entries });
+                    }
+                }
+                else
+                {
+                    AZ_Assert(nodeStack.size() < MaxTraversalStackSize, "BvhScene hierarchy is too deep to traverse");
+                    nodeStack.push_back(childIndex);
+                }
+            }
+        }
+    }
+
+    void BvhScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper([&aabb](const Node& node, bool* overlaps)
+            {
+                for (uint32_t child = 0; child < ChildCount; ++child)
+                {
+                    overlaps[child] = (aabb.GetMin().GetX() <= node.m_maxX[child]) && (aabb.GetMax().GetX() >= node.m_minX[child]) &&
+                        (aabb.GetMin().GetY() <= node.m_maxY[child]) && (aabb.GetMax().GetY() >= node.m_minY[child]) &&
+                        (aabb.GetMin().GetZ() <= node.m_maxZ[child]) && (aabb.GetMax().GetZ() >= node.m_minZ[child]);
+                }
+            }, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper([&sphere](const Node& node, bool* overlaps)
+            {
+                for (uint32_t child = 0; child < ChildCount; ++child)
+                {
+                    overlaps[child] = AZ::ShapeIntersection::Overlaps(sphere, node.GetChildBounds(child));
+                }
+            }, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper([&hemisphere](const Node& node, bool* overlaps)
+            {
+                for (uint32_t child = 0; child < ChildCount; ++child)
+                {
+                    overlaps[child] = AZ::ShapeIntersection::Overlaps(hemisphere, node.GetChildBounds(child));
+                }
+            }, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper([&capsule](const Node& node, bool* overlaps)
+            {
+                for (uint32_t child = 0; child < ChildCount; ++child)
+                {
+                    overlaps[child] = AZ::ShapeIntersection::Overlaps(capsule, node.GetChildBounds(child));
+                }
+            }, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper([&frustum](const Node& node, bool* overlaps)
+            {
+                AZ::SimdBatch::OverlapsFrustumAabbs(
+                    frustum, { node.m_minX, node.m_minY, node.m_minZ }, { node.m_maxX, node.m_maxY, node.m_maxZ }, overlaps, ChildCount);
+            }, callback);
+    }
+
+    void BvhScene::Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const
+    {
+        EnumerateHelper([&includeFrustum, &excludeFrustum](const Node& node, bool* overlaps)
+            {
+                AZ::SimdBatch::OverlapsFrustumAabbs(
+                    includeFrustum, { node.m_minX, node.m_minY, node.m_minZ }, { node.m_maxX, node.m_maxY, node.m_maxZ }, overlaps, ChildCount);
+                for (uint32_t child = 0; child < ChildCount; ++child)
+                {
+                    overlaps[child] = overlaps[child] && !AZ::ShapeIntersection::Contains(excludeFrustum, node.GetChildBounds(child));
+                }
+            }, callback);
+    }
+
+    void BvhScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper([](const Node&, bool* overlaps)
+            {
+                AZStd::fill(overlaps, overlaps + ChildCount, true);
+            }, callback);
+    }
+
+    uint32_t BvhScene::GetEntryCount() const
+    {
+        return m_entryCount;
+    }
+
+    void BvhScene::Rebuild()
+    {
+        WaitForRebuild();
+
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::vector<BuildItem> items = GatherBuildItems();
+        Tree tree;
+        BuildTree(tree, items);
+        InstallTree(tree, items);
+        m_modificationCount = 0;
+        ++m_rebuildCount;
+    }
+
+    uint32_t BvhScene::GetNodeCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_tree.m_nodes.size());
+    }
+
+    uint32_t BvhScene::GetLeafCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_tree.m_leaves.size());
+    }
+
+    uint32_t BvhScene::GetRebuildCount() const
+    {
+        return m_rebuildCount;
+    }
+
+    void BvhScene::DumpStats()
+    {
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::NodeCount = %u", GetName().GetCStr(), GetNodeCount());
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::LeafCount = %u", GetName().GetCStr(), GetLeafCount());
+        AZ_TracePrintf("Console", "BvhScene[\"%s\"]::RebuildCount = %u", GetName().GetCStr(), GetRebuildCount());
+    }
+
+    void BvhScene::InitializeTree(Tree& tree)
+    {
+        // The root node always has at least one child so entries can be inserted before the first rebuild
+        tree.m_nodes.clear();
+        tree.m_leaves.clear();
+        tree.m_nodes.emplace_back();
+        tree.m_leaves.emplace_back();
+        tree.m_leaves[0].m_parent = 0;
+        tree.m_nodes[0].m_children[0] = 0 | LeafFlag;
+    }
+
+    void BvhScene::BuildTree(Tree& tree, AZStd::vector<BuildItem>& items)
+    {
+        tree.m_nodes.clear();
+        tree.m_leaves.clear();
+        tree.m_nodes.reserve(2 * items.size() / AZStd::max<uint32_t>(bg_bvhLeafMaxEntries, 1) + 1);
+        BuildNode(tree, items, 0, aznumeric_cast<uint32_t>(items.size()), InvalidIndex, 0);
+    }
+
+    uint32_t BvhScene::BuildNode(Tree& tree, AZStd::vector<BuildItem>& items, uint32_t begin, uint32_t end, uint32_t parent, uint32_t parentChild)
+    {
+        const uint32_t leafMaxEntries = AZStd::max<uint32_t>(bg_bvhLeafMaxEntries, 1);
+
+        const uint32_t nodeIndex = aznumeric_cast<uint32_t>(tree.m_nodes.size());
+        tree.m_nodes.emplace_back();
+        tree.m_nodes[nodeIndex].m_parent = parent;
+        tree.m_nodes[nodeIndex].m_parentChild = parentChild;
+
+        // Split the largest range at the median of its longest axis until there is one range per child
+        using Range = AZStd::pair<uint32_t, uint32_t>;
+        AZStd::fixed_vector<Range, ChildCount> ranges;
+        ranges.push_back({ begin, end });
+        while (ranges.size() < ChildCount)
+        {
+            Range* largest = &ranges[0];
+            for (Range& range : ranges)
+            {
+                if ((range.second - range.first) > (largest->second - largest->first))
+                {
+                    largest = &range;
+                }
+            }
+            if (largest->second - largest->first <= leafMaxEntries)
+            {
+                break;
+            }
+
+            AZ::Aabb centerBounds = AZ::Aabb::CreateNull();
+            for (uint32_t item = largest->first; item < largest->second; ++item)
+            {
+                centerBounds.AddPoint(items[item].m_center);
+            }
+            const AZ::Vector3 centerExtents = centerBounds.GetExtents();
+            const int32_t axis = (centerExtents.GetX() >= centerExtents.GetY())
+                ? ((centerExtents.GetX() >= centerExtents.GetZ()) ? 0 : 2)
+                : ((centerExtents.GetY() >= centerExtents.GetZ()) ? 1 : 2);
+
+            const uint32_t mid = largest->first + (largest->second - largest->first) / 2;
+            AZStd::nth_element(items.begin() + largest->first, items.begin() + mid, items.begin() + largest->second,
+                [axis](const BuildItem& lhs, const BuildItem& rhs)
+                {
+                    return lhs.m_center.GetElement(axis) < rhs.m_center.GetElement(axis);
+                });
+
+            const Range upper = { mid, largest->second };
+            largest->second = mid;
+            ranges.push_back(upper);
+        }
+
+        for (uint32_t child = 0; child < ranges.size(); ++child)
+        {
+            const Range& range = ranges[child];
+            if (range.second - range.first <= leafMaxEntries)
+            {
+                const uint32_t leafIndex = aznumeric_cast<uint32_t>(tree.m_leaves.size());
+                Leaf& leaf = tree.m_leaves.emplace_back();
+                leaf.m_parent = nodeIndex;
+                leaf.m_parentChild = child;
+
+                // Until the tree is installed the leaf slots hold indices into the build items
+                leaf.m_slots.reserve(range.second - range.first);
+                for (uint32_t item = range.first; item < range.second; ++item)
+                {
+                    leaf.m_slots.push_back(item);
+                }
+                tree.m_nodes[nodeIndex].m_children[child] = leafIndex | LeafFlag;
+            }
+            else
+            {
+                const uint32_t childNodeIndex = BuildNode(tree, items, range.first, range.second, nodeIndex, child);
+                tree.m_nodes[nodeIndex].m_children[child] = childNodeIndex;
+            }
+        }
+
+        return nodeIndex;
+    }
+
+    void BvhScene::InsertIntoTree(uint32_t slot)
+    {
+        VisibilityEntry* entry = m_slotEntries[slot];
+        const AZ::Aabb& bounds = entry->m_boundingVolume;
+
+        // Descend into the child whose bounds grow the least
+        uint32_t childIndex = 0;
+        for (uint32_t nodeIndex = 0;;)
+        {
+            const Node& node = m_tree.m_nodes[nodeIndex];
+            float bestCost = AZStd::numeric_limits<float>::max();
+            for (uint32_t child = 0; child < ChildCount; ++child)
+            {
+                if (node.m_children[child] != InvalidIndex)
+                {
+                    const float cost = GetInsertionCost(node.GetChildBounds(child), bounds);
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        childIndex = node.m_children[child];
+                    }
+                }
+            }
+
+            AZ_Assert(bestCost < AZStd::numeric_limits<float>::max(), "BvhScene node has no children");
+            if (childIndex & LeafFlag)
+            {
+                break;
+            }
+            nodeIndex = childIndex;
+        }
+
+        const uint32_t leafIndex = childIndex & ~LeafFlag;
+        Leaf& leaf = m_tree.m_leaves[leafIndex];
+        m_slotLeaves[slot] = leafIndex;
+        m_slotLeafIndices[slot] = aznumeric_cast<uint32_t>(leaf.m_entries.size());
+        leaf.m_entries.push_back(entry);
+        leaf.m_slots.push_back(slot);
+        leaf.m_bounds.AddAabb(bounds);
+        RefitFromLeaf(leafIndex);
+    }
+
+    void BvhScene::RemoveFromTree(uint32_t slot)
+    {
+        Leaf& leaf = m_tree.m_leaves[m_slotLeaves[slot]];
+        const uint32_t removeIndex = m_slotLeafIndices[slot];
+        AZ_Assert(leaf.m_slots[removeIndex] == slot, "Visibility entry data is corrupt");
+
+        // Swap and pop the removed entry, the leaf bounds are tightened by the next rebuild
+        if (removeIndex < (leaf.m_entries.size() - 1))
+        {
+            leaf.m_entries[removeIndex] = leaf.m_entries.back();
+            leaf.m_slots[removeIndex] = leaf.m_slots.back();
+            m_slotLeafIndices[leaf.m_slots[removeIndex]] = removeIndex;
+        }
+        leaf.m_entries.pop_back();
+        leaf.m_slots.pop_back();
+
+        m_slotLeaves[slot] = InvalidIndex;
+        m_slotLeafIndices[slot] = 0;
+    }
+
+    void BvhScene::RefitFromLeaf(uint32_t leafIndex)
+    {
+        const Leaf& leaf = m_tree.m_leaves[leafIndex];
+        AZ::Aabb bounds = leaf.m_bounds;
+        uint32_t nodeIndex = leaf.m_parent;
+        uint32_t child = leaf.m_parentChild;
+
+        // Grow the bounds of each ancestor until one already contains the new bounds
+        while (nodeIndex != InvalidIndex)
+        {
+            Node& node = m_tree.m_nodes[nodeIndex];
+            AZ::Aabb childBounds = node.GetChildBounds(child);
+            if (AZ::ShapeIntersection::Contains(childBounds, bounds))
+            {
+                return;
+            }
+
+            childBounds.AddAabb(bounds);
+            node.SetChildBounds(child, childBounds);
+            bounds = childBounds;
+            child = node.m_parentChild;
+            nodeIndex = node.m_parent;
+        }
+    }
+
+    void BvhScene::InstallTree(Tree& tree, const AZStd::vector<BuildItem>& items)
+    {
+        // Entries are bound to the new leaves and the leaf bounds are computed from the current entry bounds,
+        // skipping any entry that was removed while the tree was being built
+        AZStd::vector<bool> installed(m_slotEntries.size(), false);
+        for (uint32_t leafIndex = 0; leafIndex < tree.m_leaves.size(); ++leafIndex)
+        {
+            Leaf& leaf = tree.m_leaves[leafIndex];
+            AZStd::vector<uint32_t> itemIndices = AZStd::move(leaf.m_slots);
+            leaf.m_slots.clear();
+            leaf.m_slots.reserve(itemIndices.size());
+            leaf.m_entries.reserve(itemIndices.size());
+
+            for (uint32_t itemIndex : itemIndices)
+            {
+                const BuildItem& item = items[itemIndex];
+                VisibilityEntry* entry = m_slotEntries[item.m_slot];
+                if (entry == nullptr || m_slotVersions[item.m_slot] != item.m_slotVersion)
+                {
+                    continue;
+                }
+
+                m_slotLeaves[item.m_slot] = leafIndex;
+                m_slotLeafIndices[item.m_slot] = aznumeric_cast<uint32_t>(leaf.m_entries.size());
+                leaf.m_entries.push_back(entry);
+                leaf.m_slots.push_back(item.m_slot);
+                leaf.m_bounds.AddAabb(entry->m_boundingVolume);
+                installed[item.m_slot] = true;
+            }
+        }
+
+        // Children are always stored after their parents, so refitting in reverse order visits children first
+        for (size_t nodeIndex = tree.m_nodes.size(); nodeIndex-- > 0;)
+        {
+            Node& node = tree.m_nodes[nodeIndex];
+            for (uint32_t child = 0; child < ChildCount; ++child)
+            {
+                const uint32_t childIndex = node.m_children[child];
+                if (childIndex == InvalidIndex)
+                {
+                    continue;
+                }
+
+                if (childIndex & LeafFlag)
+                {
+                    node.SetChildBounds(child, tree.m_leaves[childIndex & ~LeafFlag].m_bounds);
+                }
+                else
+                {
+                    const Node& childNode = tree.m_nodes[childIndex];
+                    AZ::Aabb childBounds = AZ::Aabb::CreateNull();
+                    for (uint32_t grandChild = 0; grandChild < ChildCount; ++grandChild)
+                    {
+                        childBounds.AddAabb(childNode.GetChildBounds(grandChild));
+                    }
+                    node.SetChildBounds(child, childBounds);
+                }
+            }
+        }
+
+        m_tree = AZStd::move(tree);
+
+        // Entries inserted while the tree was being built are added to it incrementally
+        for (uint32_t slot = 0; slot < m_slotEntries.size(); ++slot)
+        {
+            if (m_slotEntries[slot] != nullptr && !installed[slot])
+            {
+                InsertIntoTree(slot);
+            }
+        }
+    }
+
+    void BvhScene::TryStartRebuild()
+    {
+        if (m_rebuildInProgress)
+        {
+            return;
+        }
+
+        const uint32_t rebuildThreshold = AZStd::max(
+            static_cast<uint32_t>(bg_bvhRebuildMinModifications), static_cast<uint32_t>(bg_bvhRebuildRatio * m_entryCount));
+        if (m_modificationCount < rebuildThreshold)
+        {
+            return;
+        }
+        m_modificationCount = 0;
+
+        AZStd::vector<BuildItem> items = GatherBuildItems();
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (!bg_bvhBackgroundRebuild || jobContext == nullptr)
+        {
+            Tree tree;
+            BuildTree(tree, items);
+            InstallTree(tree, items);
+            ++m_rebuildCount;
+            return;
+        }
+
+        // The current hierarchy stays in use until the job has built the new one. The rebuild state outlives the scene's
+        // access to it, so the destructor can wait on it without racing the end of the job.
+        AZStd::shared_ptr<RebuildState> rebuildState = AZStd::make_shared<RebuildState>();
+        m_rebuildState = rebuildState;
+        m_rebuildInProgress = true;
+
+        AZ::Job* job = AZ::CreateJobFunction([this, rebuildState, items = AZStd::move(items)]() mutable
+            {
+                Tree tree;
+                BuildTree(tree, items);
+                {
+                    AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+                    InstallTree(tree, items);
+                    m_rebuildInProgress = false;
+                    ++m_rebuildCount;
+                }
+                rebuildState->m_finished.release();
+            }, true, jobContext);
+        job->Start();
+    }
+
+    AZStd::vector<BvhScene::BuildItem> BvhScene::GatherBuildItems() const
+    {
+        AZStd::vector<BuildItem> items;
+        items.reserve(m_entryCount);
+        for (uint32_t slot = 0; slot < m_slotEntries.size(); ++slot)
+        {
+            if (const VisibilityEntry* entry = m_slotEntries[slot])
+            {
+                items.push_back({ entry->m_boundingVolume.GetCenter(), slot, m_slotVersions[slot] });
+            }
+        }
+        return items;
+    }
+
+    void BvhScene::WaitForRebuild()
+    {
+        AZStd::shared_ptr<RebuildState> rebuildState;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+            if (!m_rebuildInProgress)
+            {
+                return;
+            }
+            rebuildState = m_rebuildState;
+        }
+        rebuildState->m_finished.acquire();
+    }
+}
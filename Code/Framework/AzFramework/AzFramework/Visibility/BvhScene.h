@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace AzFramework
+{
+    //! Implementation of the visibility system interface using a flat bounding volume hierarchy.
+    //! Nodes have four children whose bounds are stored as a structure of arrays, so each node is tested against a query
+    //! volume in a single batch, and nodes and leaves are stored in contiguous arrays that are traversed by index.
+    //! Entries that move are refit in place, growing the bounds of their leaf and its ancestors, and the hierarchy is
+    //! periodically rebuilt on a background job once enough entries have been inserted, moved or removed.
+    //! Selected over the OctreeScene with bg_visibilityUseBvh.
+    class BvhScene
+        : public IVisibilityScene
+    {
+    public:
+        AZ_RTTI(BvhScene, "{3E0B6C52-9A4F-4D1E-8C27-5B7A9F16E4D3}", IVisibilityScene);
+        AZ_CLASS_ALLOCATOR(BvhScene, AZ::SystemAllocator);
+        AZ_DISABLE_COPY_MOVE(BvhScene);
+
+        explicit BvhScene(const AZ::Name& sceneName);
+        virtual ~BvhScene();
+
+        //! IVisibilityScene overrides.
+        //! @{
+        const AZ::Name& GetName() const override;
+        void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> entries) override;
+        void RemoveEntry(VisibilityEntry& entry) override;
+        void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const override;
+        void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        uint32_t GetEntryCount() const override;
+        //! @}
+
+        //! Rebuilds the hierarchy immediately, waiting for any background rebuild in flight first.
+        void Rebuild();
+
+        //! Stats
+        //! @{
+        uint32_t GetNodeCount() const;
+        uint32_t GetLeafCount() const;
+        uint32_t GetRebuildCount() const;
+        void DumpStats();
+        //! @}
+
+    private:
+        static constexpr uint32_t ChildCount = 4;
+        static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+        static constexpr uint32_t LeafFlag = 0x80000000; //< Set on child indices that reference a leaf rather than a node
+
+        //! An internal node of the hierarchy, with the bounds of its children stored as a structure of arrays.
+        //! Unused children have null bounds and an invalid child index.
+        struct Node
+        {
+            alignas(16) float m_minX[ChildCount];
+            alignas(16) float m_minY[ChildCount];
+            alignas(16) float m_minZ[ChildCount];
+            alignas(16) float m_maxX[ChildCount];
+            alignas(16) float m_maxY[ChildCount];
+            alignas(16) float m_maxZ[ChildCount];
+            uint32_t m_children[ChildCount];
+            uint32_t m_parent = InvalidIndex;
+            uint32_t m_parentChild = 0; //< The child of the parent node referencing this node
+
+            Node();
+            AZ::Aabb GetChildBounds(uint32_t child) const;
+            void SetChildBounds(uint32_t child, const AZ::Aabb& bounds);
+        };
+
+        //! A leaf of the hierarchy, holding the entries passed to the enumerate callbacks.
+        struct Leaf
+        {
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+            AZStd::vector<VisibilityEntry*> m_entries;
+            AZStd::vector<uint32_t> m_slots; //< The entry slot of each entry
+            uint32_t m_parent = InvalidIndex;
+            uint32_t m_parentChild = 0;
+        };
+
+        struct Tree
+        {
+            AZStd::vector<Node> m_nodes; //< Parents are always stored before their children, the root node is m_nodes[0]
+            AZStd::vector<Leaf> m_leaves;
+        };
+
+        //! An entry captured when a rebuild starts, the entry is skipped when the rebuilt tree is installed if its slot was
+        //! reused in the meantime.
+        struct BuildItem
+        {
+            AZ::Vector3 m_center;
+            uint32_t m_slot;
+            uint32_t m_slotVersion;
+        };
+
+        //! The state shared between the scene and an in flight background rebuild.
+        struct RebuildState
+        {
+            AZStd::binary_semaphore m_finished;
+        };
+
+        static void BuildTree(Tree& tree, AZStd::vector<BuildItem>& items);
+        static uint32_t BuildNode(Tree& tree, AZStd::vector<BuildItem>& items, uint32_t begin, uint32_t end, uint32_t parent, uint32_t parentChild);
+
+        static void InitializeTree(Tree& tree);
+        //! Returns false when the entry was still within its leaf and the hierarchy was left untouched.
+        bool InsertOrUpdateEntryLocked(VisibilityEntry& entry);
+        void InsertIntoTree(uint32_t slot);
+        void RemoveFromTree(uint32_t slot);
+        void RefitFromLeaf(uint32_t leafIndex);
+        void InstallTree(Tree& tree, const AZStd::vector<BuildItem>& items);
+        void TryStartRebuild();
+        AZStd::vector<BuildItem> GatherBuildItems() const;
+        void WaitForRebuild();
+
+        template <typename ChildTest>
+        void EnumerateHelper(const ChildTest& childTest, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        mutable AZStd::shared_mutex m_sharedMutex;
+
+        AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
+        Tree m_tree;
+
+        //! Per entry slot data, an entry's m_internalNodeIndex is its slot.
+        //! @{
+        AZStd::vector<VisibilityEntry*> m_slotEntries; //< nullptr for free slots
+        AZStd::vector<uint32_t> m_slotLeaves;
+        AZStd::vector<uint32_t> m_slotLeafIndices;
+        AZStd::vector<uint32_t> m_slotVersions;
+        AZStd::vector<uint32_t> m_freeSlots;
+        //! @}
+
+        //! Entries bound to this scene point their m_internalNode here.
+        VisibilityNode m_boundNode;
+
+        uint32_t m_entryCount = 0;
+        uint32_t m_modificationCount = 0; //< Inserts, removes and refits since the last rebuild started
+        uint32_t m_rebuildCount = 0;
+        bool m_rebuildInProgress = false;
+        AZStd::shared_ptr<RebuildState> m_rebuildState;
+    };
+}
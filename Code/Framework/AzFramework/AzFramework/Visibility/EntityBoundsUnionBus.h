@@ -40,6 +40,8 @@ namespace AzFramework
         virtual void ProcessEntityBoundsUnionRequests() = 0;
 
         //! Notifies the EntityBoundsUnion system that an entities transform has been modified.
+        //! @note The visibility system is updated in the next call to ProcessEntityBoundsUnionRequests, so an entity
+        //! moving several times in a frame (e.g. as part of a hierarchy) is only updated once.
         //! @param entity the entity whose transform has been modified.
         virtual void OnTransformUpdated(AZ::Entity* entity) = 0;
 
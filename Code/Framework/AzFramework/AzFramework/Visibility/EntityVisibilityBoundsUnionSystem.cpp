@@ -9,12 +9,18 @@
 #include "EntityVisibilityBoundsUnionSystem.h"
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzFramework/Visibility/BoundsBus.h>
 
 AZ_DECLARE_BUDGET(AzFramework);
 
 namespace AzFramework
 {
+    //! Below this many moved entities the world bounds are calculated on the calling thread,
+    //! as the cost of scheduling the jobs outweighs the work.
+    static constexpr size_t ParallelWorldBoundsUpdateMinCount = 512;
+
     EntityVisibilityBoundsUnionSystem::EntityVisibilityBoundsUnionSystem()
         : m_entityActivatedEventHandler(
               [this](AZ::Entity* entity)
@@ -106,6 +112,15 @@ namespace AzFramework
         }
     }
 
+    void EntityVisibilityBoundsUnionSystem::QueueWorldBoundsUpdate(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance)
+    {
+        if (!instance.m_worldBoundsDirty)
+        {
+            instance.m_worldBoundsDirty = true;
+            m_entityWorldBoundsDirty.push_back(entity);
+        }
+    }
+
     void EntityVisibilityBoundsUnionSystem::RefreshEntityLocalBoundsUnion(const AZ::EntityId entityId)
     {
         if (AZ::Entity* entity = AZ::Interface<AZ::ComponentApplicationRequests>::Get()->FindEntity(entityId))
@@ -160,21 +175,80 @@ namespace AzFramework
                 instanceIt != m_entityVisibilityBoundsUnionInstanceMapping.end())
             {
                 instanceIt->second.m_localEntityBoundsUnion = CalculateEntityLocalBoundsUnion(entity);
-                UpdateVisibilitySystem(entity, instanceIt->second);
+                QueueWorldBoundsUpdate(entity, instanceIt->second);
             }
         }
-
-        // clear dirty entities once the visibility system has been updated
         m_entityBoundsDirty.clear();
+
+        // gather the entities that moved or were resized, each one only once however many times it changed
+        m_worldBoundsUpdates.clear();
+        for (AZ::Entity* entity : m_entityWorldBoundsDirty)
+        {
+            // entities deactivated since they were queued are no longer in the mapping
+            if (auto instanceIt = m_entityVisibilityBoundsUnionInstanceMapping.find(entity);
+                instanceIt != m_entityVisibilityBoundsUnionInstanceMapping.end() && instanceIt->second.m_worldBoundsDirty)
+            {
+                instanceIt->second.m_worldBoundsDirty = false;
+                if (instanceIt->second.m_localEntityBoundsUnion.IsValid())
+                {
+                    m_worldBoundsUpdates.push_back({ entity, &instanceIt->second });
+                }
+            }
+        }
+        m_entityWorldBoundsDirty.clear();
+
+        // transform the cached local bounds, which only reads the world transforms so can be done in parallel
+        // note: worldEntityBounds will not be a 'tight-fit' Aabb but that of a transformed local aabb
+        // there will be some wasted space but it should be sufficient for the visibility system
+        auto calculateWorldBounds = [this](int index)
+        {
+            WorldBoundsUpdate& update = m_worldBoundsUpdates[index];
+            update.m_worldEntityBoundsUnion =
+                update.m_instance->m_localEntityBoundsUnion.GetTransformedAabb(update.m_entity->GetTransform()->GetWorldTM());
+        };
+        if (m_worldBoundsUpdates.size() >= ParallelWorldBoundsUpdateMinCount && AZ::JobContext::GetGlobalContext())
+        {
+            AZ::parallel_for(0, aznumeric_cast<int>(m_worldBoundsUpdates.size()), calculateWorldBounds);
+        }
+        else
+        {
+            for (int index = 0; index < aznumeric_cast<int>(m_worldBoundsUpdates.size()); ++index)
+            {
+                calculateWorldBounds(index);
+            }
+        }
+
+        // write the changed bounds to the visibility system in a single batch
+        IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
+        if (!visibilitySystem)
+        {
+            return;
+        }
+
+        m_visibilityEntryUpdates.clear();
+        for (const WorldBoundsUpdate& update : m_worldBoundsUpdates)
+        {
+            VisibilityEntry& visibilityEntry = update.m_instance->m_visibilityEntry;
+            if (!update.m_worldEntityBoundsUnion.IsClose(visibilityEntry.m_boundingVolume))
+            {
+                visibilityEntry.m_boundingVolume = update.m_worldEntityBoundsUnion;
+                m_visibilityEntryUpdates.push_back(&visibilityEntry);
+            }
+        }
+
+        if (!m_visibilityEntryUpdates.empty())
+        {
+            visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntries(m_visibilityEntryUpdates);
+        }
     }
 
     void EntityVisibilityBoundsUnionSystem::OnTransformUpdated(AZ::Entity* entity)
     {
-        // update the world transform of the visibility bounds union
+        // the world bounds of the visibility bounds union are updated in ProcessEntityBoundsUnionRequests
         if (auto instanceIt = m_entityVisibilityBoundsUnionInstanceMapping.find(entity);
             instanceIt != m_entityVisibilityBoundsUnionInstanceMapping.end())
         {
-            UpdateVisibilitySystem(entity, instanceIt->second);
+            QueueWorldBoundsUpdate(entity, instanceIt->second);
         }
     }
 
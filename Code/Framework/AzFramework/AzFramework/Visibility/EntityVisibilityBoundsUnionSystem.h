@@ -40,6 +40,15 @@ namespace AzFramework
         {
             AZ::Aabb m_localEntityBoundsUnion = AZ::Aabb::CreateNull(); //!< Entity union bounding volume in local space.
             VisibilityEntry m_visibilityEntry; //!< Hook into the IVisibilitySystem interface.
+            bool m_worldBoundsDirty = false; //!< Queued in m_entityWorldBoundsDirty.
+        };
+
+        //! An entity whose world bounds union is recalculated in ProcessEntityBoundsUnionRequests.
+        struct WorldBoundsUpdate
+        {
+            AZ::Entity* m_entity = nullptr;
+            EntityVisibilityBoundsUnionInstance* m_instance = nullptr;
+            AZ::Aabb m_worldEntityBoundsUnion = AZ::Aabb::CreateNull();
         };
 
         using UniqueEntities = AZStd::set<AZ::Entity*>;
@@ -53,9 +62,17 @@ namespace AzFramework
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
         void UpdateVisibilitySystem(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance);
+        void QueueWorldBoundsUpdate(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance);
 
         EntityVisibilityBoundsUnionInstanceMapping m_entityVisibilityBoundsUnionInstanceMapping;
         UniqueEntities m_entityBoundsDirty;
+        AZStd::vector<AZ::Entity*> m_entityWorldBoundsDirty; //!< Entities moved or resized since the last update.
+
+        //! Scratch buffers reused by each update.
+        //! @{
+        AZStd::vector<WorldBoundsUpdate> m_worldBoundsUpdates;
+        AZStd::vector<VisibilityEntry*> m_visibilityEntryUpdates;
+        //! @}
 
         AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
         AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
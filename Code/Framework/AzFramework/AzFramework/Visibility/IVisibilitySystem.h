@@ -19,6 +19,7 @@
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AzFramework
@@ -75,6 +76,10 @@ namespace AzFramework
         //! @param visibilityEntry data for the object being added/updated
         virtual void InsertOrUpdateEntry(VisibilityEntry& visibilityEntry) = 0;
 
+        //! Insert or update a batch of entries within the visibility system, locking the scene once for the whole batch.
+        //! @param visibilityEntries data for the objects being added/updated
+        virtual void InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> visibilityEntries) = 0;
+
         //! Removes an entry from the visibility system.
         //! @param visibilityEntry data for the object being removed
         virtual void RemoveEntry(VisibilityEntry& visibilityEntry) = 0;
@@ -7,6 +7,7 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzFramework/Visibility/BvhScene.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
@@ -16,6 +17,7 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(bool,     bg_visibilityUseBvh,          false, nullptr, AZ::ConsoleFunctorFlags::Null, "If set to true, visibility scenes created afterwards use a BvhScene instead of an OctreeScene");
 
     static uint32_t GetChildNodeCount()
     {
@@ -400,6 +402,23 @@ namespace AzFramework
         }
     }
 
+    void OctreeScene::InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> entries)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        for (VisibilityEntry* entry : entries)
+        {
+            if (entry->m_internalNode != nullptr)
+            {
+                static_cast<OctreeNode*>(entry->m_internalNode)->Update(*this, entry);
+            }
+            else
+            {
+                m_root.Insert(*this, entry);
+                ++m_entryCount;
+            }
+        }
+    }
+
     void OctreeScene::RemoveEntry(VisibilityEntry& entry)
     {
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -580,7 +599,7 @@ namespace AzFramework
         AZ::Interface<IVisibilitySystem>::Register(this);
         IVisibilitySystemRequestBus::Handler::BusConnect();
 
-        m_defaultScene = aznew OctreeScene(AZ::Name("DefaultVisibilityScene"));
+        m_defaultScene = CreateScene(AZ::Name("DefaultVisibilityScene"));
     }
 
     OctreeSystemComponent::~OctreeSystemComponent()
@@ -603,6 +622,15 @@ namespace AzFramework
         ;
     }
 
+    IVisibilityScene* OctreeSystemComponent::CreateScene(const AZ::Name& sceneName)
+    {
+        if (bg_visibilityUseBvh)
+        {
+            return aznew BvhScene(sceneName);
+        }
+        return aznew OctreeScene(sceneName);
+    }
+
     IVisibilityScene* OctreeSystemComponent::GetDefaultVisibilityScene()
     {
         return m_defaultScene;
@@ -611,7 +639,7 @@ namespace AzFramework
     IVisibilityScene* OctreeSystemComponent::CreateVisibilityScene(const AZ::Name& sceneName)
     {
         AZ_Assert(FindVisibilityScene(sceneName) == nullptr, "Scene with same name already created!");
-        OctreeScene* newScene = aznew OctreeScene(sceneName);
+        IVisibilityScene* newScene = CreateScene(sceneName);
         m_scenes.push_back(newScene);
         return newScene;
     }
@@ -632,7 +660,7 @@ namespace AzFramework
 
     IVisibilityScene* OctreeSystemComponent::FindVisibilityScene(const AZ::Name& sceneName)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             if(scene->GetName() == sceneName)
             {
@@ -644,10 +672,17 @@ namespace AzFramework
 
     void OctreeSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             AZ_TracePrintf("Console", "============================================");
-            scene->DumpStats();
+            if (OctreeScene* octreeScene = azrtti_cast<OctreeScene*>(scene))
+            {
+                octreeScene->DumpStats();
+            }
+            else if (BvhScene* bvhScene = azrtti_cast<BvhScene*>(scene))
+            {
+                bvhScene->DumpStats();
+            }
         }
         AZ_TracePrintf("Console", "============================================");
     }
@@ -106,6 +106,7 @@ namespace AzFramework
         //! @{
         const AZ::Name& GetName() const override;
         void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> entries) override;
         void RemoveEntry(VisibilityEntry& entry) override;
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
@@ -184,11 +185,14 @@ namespace AzFramework
         //! @}
 
     private:
+        //! Creates an OctreeScene, or a BvhScene when bg_visibilityUseBvh is set.
+        static IVisibilityScene* CreateScene(const AZ::Name& sceneName);
+
         //! The default scene used for most entities (e.g. gameplay, networking)
-        OctreeScene* m_defaultScene = nullptr;
+        IVisibilityScene* m_defaultScene = nullptr;
 
         //! Other scenes (e.g. each rendering scene) are stored here and looked up by name.
-        AZStd::vector<OctreeScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
+        AZStd::vector<IVisibilityScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
         
     };
 }
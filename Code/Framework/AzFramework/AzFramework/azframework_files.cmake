@@ -134,6 +134,9 @@ set(FILES
     Components/ComponentAdapter.inl
     Components/ComponentAdapterHelpers.h
     Components/EditorEntityEvents.h
+    Components/TransformBatch.h
+    Components/TransformBatchSystem.cpp
+    Components/TransformBatchSystem.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
     Components/CameraBus.h
@@ -483,6 +486,8 @@ set(FILES
     Slice/SliceInstantiationTicket.cpp
     Visibility/BoundsBus.cpp
     Visibility/BoundsBus.h
+    Visibility/BvhScene.cpp
+    Visibility/BvhScene.h
     Visibility/EntityBoundsUnionBus.h
     Visibility/EntityVisibilityBoundsUnionSystem.cpp
     Visibility/EntityVisibilityBoundsUnionSystem.h
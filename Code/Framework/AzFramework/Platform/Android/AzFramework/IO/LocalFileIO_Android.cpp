@@ -69,6 +69,7 @@ namespace AZ
                 }
                 destFile << sourceFile.rdbuf();
             }
+            InvalidateFileMetadata(resolvedDestPath.c_str());
             return ResultCode::Success;
         }
 
@@ -165,6 +166,7 @@ namespace AZ
             {
                 directoryPath /= pathSegment;
                 mkdir(directoryPath.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+                InvalidateFileMetadata(directoryPath.c_str());
                 if (!IsDirectory(directoryPath.c_str()))
                 {
                     return ResultCode::Error;
@@ -40,6 +40,7 @@ namespace AZ
                 }
                 dst << src.rdbuf();
             }
+            InvalidateFileMetadata(resolvedDestPath.c_str());
             return ResultCode::Success;
         }
 
@@ -98,6 +99,7 @@ namespace AZ
             {
                 directoryPath /= pathSegment;
                 mkdir(directoryPath.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+                InvalidateFileMetadata(directoryPath.c_str());
                 if (!IsDirectory(directoryPath.c_str()))
                 {
                     return ResultCode::Error;
@@ -96,6 +96,7 @@ namespace AZ
             {
                 directoryPath /= pathSegment;
                 CreateDirectoryA(directoryPath.c_str(), nullptr);
+                InvalidateFileMetadata(directoryPath.c_str());
                 if (!IsDirectory(directoryPath.c_str()))
                 {
                     return ResultCode::Error;
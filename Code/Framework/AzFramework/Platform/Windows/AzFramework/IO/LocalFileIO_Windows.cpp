@@ -25,6 +25,8 @@ namespace AZ::IO
         AZStd::to_wstring(resolvedSourcePathW, resolvedSourcePath.Native());
         AZStd::to_wstring(resolvedDestPathW, resolvedDestPath.Native());
 
-        return ::CopyFileW(resolvedSourcePathW.c_str(), resolvedDestPathW.c_str(), false) != 0 ? ResultCode::Success : ResultCode::Error;
+        const bool copied = ::CopyFileW(resolvedSourcePathW.c_str(), resolvedDestPathW.c_str(), false) != 0;
+        InvalidateFileMetadata(resolvedDestPath.c_str());
+        return copied ? ResultCode::Success : ResultCode::Error;
     }
 }//namespace AZ::IO
@@ -11,6 +11,8 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
 
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/FramedCompression.h>
 #include <AzCore/IO/SystemFile.h> // for max path decl
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/parallel/thread.h>
@@ -808,6 +810,118 @@ namespace UnitTest
         EXPECT_TRUE(archive->ClosePack(realNameBuf));
     }
 
+    TEST_F(ArchiveTestFixture, FileInSeveralPacks_IsFoundInHighestPriorityPack_UntilItIsClosed)
+    {
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        // Packs sorting higher by path have priority over the others, whatever order they're opened in
+        constexpr const char* lowPriorityPackPath = "@usercache@/priority_a.pak";
+        constexpr const char* highPriorityPackPath = "@usercache@/priority_b.pak";
+        constexpr AZStd::string_view lowPriorityData = "low";
+        constexpr AZStd::string_view highPriorityData = "high_priority";
+        for (auto [packPath, data] : { AZStd::make_pair(lowPriorityPackPath, lowPriorityData), AZStd::make_pair(highPriorityPackPath, highPriorityData) })
+        {
+            archive->ClosePack(packPath);
+            AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(packPath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(0, pArchive->UpdateFile("shared/file.dat", data.data(), data.size(), AZ::IO::INestedArchive::METHOD_STORE, 0));
+            EXPECT_EQ(0, pArchive->UpdateFile(AZStd::string::format("%.*s.dat", AZ_STRING_ARG(data)), data.data(), data.size(), AZ::IO::INestedArchive::METHOD_STORE, 0));
+            pArchive.reset();
+            EXPECT_TRUE(IsPackValid(packPath));
+        }
+
+        EXPECT_TRUE(archive->OpenPack("@products@", highPriorityPackPath));
+        EXPECT_TRUE(archive->OpenPack("@products@", lowPriorityPackPath));
+        EXPECT_EQ(highPriorityData.size(), archive->FGetSize("@products@/shared/file.dat"));
+        EXPECT_TRUE(archive->IsFileExist("@products@/low.dat"));
+        EXPECT_TRUE(archive->IsFileExist("@products@/high_priority.dat"));
+
+        // Closing a pack removes its files, and reveals the files it was hiding
+        EXPECT_TRUE(archive->ClosePack(highPriorityPackPath));
+        EXPECT_EQ(lowPriorityData.size(), archive->FGetSize("@products@/shared/file.dat"));
+        EXPECT_FALSE(archive->IsFileExist("@products@/high_priority.dat"));
+
+        EXPECT_TRUE(archive->ClosePack(lowPriorityPackPath));
+        EXPECT_FALSE(archive->IsFileExist("@products@/shared/file.dat"));
+        EXPECT_FALSE(archive->IsFileExist("@products@/low.dat"));
+    }
+
+    TEST_F(ArchiveTestFixture, FramedFileInPack_IsReportedAsFramed_AndDecompressesThroughTheArchiveLookup)
+    {
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        constexpr const char* packPath = "@usercache@/framed.pak";
+        constexpr AZ::u32 frameSize = 4 * 1024;
+        AZStd::vector<AZ::u8> data(10 * frameSize + 123);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = aznumeric_cast<AZ::u8>((i / 7) ^ (i % 13));
+        }
+
+        archive->ClosePack(packPath);
+        {
+            AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(packPath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            EXPECT_EQ(0, pArchive->UpdateFile("framed.dat", data.data(), data.size(), AZ::IO::INestedArchive::METHOD_COMPRESS,
+                AZ::IO::INestedArchive::LEVEL_FASTEST, CompressionCodec::Codec::ZSTD, frameSize));
+            EXPECT_EQ(0, pArchive->UpdateFile("single.dat", data.data(), data.size(), AZ::IO::INestedArchive::METHOD_COMPRESS,
+                AZ::IO::INestedArchive::LEVEL_FASTEST, CompressionCodec::Codec::ZSTD));
+        }
+        EXPECT_TRUE(IsPackValid(packPath));
+        ASSERT_TRUE(archive->OpenPack("@products@", packPath));
+
+        // Files compressed as a single stream aren't framed
+        AZ::IO::CompressionInfo singleInfo;
+        ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(singleInfo, "@products@/single.dat"));
+        EXPECT_TRUE(singleInfo.m_isCompressed);
+        EXPECT_FALSE(singleInfo.m_isFramed);
+
+        // The archive lookup is what the streamer uses to pick the framed decompression path
+        AZ::IO::CompressionInfo info;
+        ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(info, "@products@/framed.dat"));
+        EXPECT_TRUE(info.m_isCompressed);
+        EXPECT_TRUE(info.m_isFramed);
+        EXPECT_EQ(data.size(), info.m_uncompressedSize);
+        ASSERT_TRUE(info.m_decompressor);
+
+        // Read the compressed data the same way the streamer does and decompress a range that straddles frames
+        AZStd::vector<AZ::u8> compressed(info.m_compressedSize);
+        AZ::IO::FileIOBase* directIo = AZ::IO::FileIOBase::GetDirectInstance();
+        AZ::IO::HandleType archiveHandle = AZ::IO::InvalidHandle;
+        ASSERT_TRUE(directIo->Open(info.m_archiveFilename.GetAbsolutePathCStr(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, archiveHandle));
+        EXPECT_TRUE(directIo->Seek(archiveHandle, info.m_offset, AZ::IO::SeekType::SeekFromStart));
+        EXPECT_TRUE(directIo->Read(archiveHandle, compressed.data(), compressed.size(), true));
+        directIo->Close(archiveHandle);
+
+        AZ::IO::FramedCompression::FrameTable frameTable;
+        ASSERT_TRUE(frameTable.Read(compressed.data(), compressed.size(), info.m_uncompressedSize));
+        EXPECT_EQ(11, frameTable.GetFrameCount());
+
+        constexpr AZ::u64 readOffset = frameSize + 100;
+        constexpr AZ::u64 readSize = 3 * frameSize;
+        AZStd::vector<AZ::u8> partial(readSize);
+        auto decompressFrame = [&info](const void* frame, size_t frameCompressedSize, void* uncompressed, size_t uncompressedSize)
+        {
+            return info.m_decompressor(info, frame, frameCompressedSize, uncompressed, uncompressedSize);
+        };
+        EXPECT_TRUE(AZ::IO::FramedCompression::Decompress(frameTable, compressed.data(), compressed.size(), readOffset, readSize,
+            partial.data(), decompressFrame, false));
+        EXPECT_EQ(0, memcmp(partial.data(), data.data() + readOffset, readSize));
+
+        // Regular archive reads decompress all frames
+        AZ::IO::HandleType fileHandle = archive->FOpen("@products@/framed.dat", "rb");
+        ASSERT_NE(AZ::IO::InvalidHandle, fileHandle);
+        AZStd::vector<AZ::u8> readBack(data.size());
+        EXPECT_EQ(data.size(), archive->FRead(readBack.data(), readBack.size(), fileHandle));
+        archive->FClose(fileHandle);
+        EXPECT_EQ(data, readBack);
+
+        EXPECT_TRUE(archive->ClosePack(packPath));
+        AZ::IO::FileIOBase::GetInstance()->Remove(packPath);
+    }
+
     TEST_F(ArchiveTestFixture, IResourceList_Add_EmptyFileName_DoesNotInsert)
     {
         AZ::IO::IResourceList* reslist = AZ::Interface<AZ::IO::IArchive>::Get()->GetResourceList(AZ::IO::IArchive::RFOM_EngineStartup);
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzFramework/Visibility/BvhScene.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <random>
+
+using namespace AzFramework;
+
+namespace UnitTest
+{
+    class BvhSceneTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_console = aznew AZ::Console();
+            AZ::Interface<AZ::IConsole>::Register(m_console);
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+            m_console->GetCvarValue("bg_bvhLeafMaxEntries", m_savedLeafMaxEntries);
+            m_console->GetCvarValue("bg_bvhRebuildMinModifications", m_savedRebuildMinModifications);
+            m_console->GetCvarValue("bg_bvhBackgroundRebuild", m_savedBackgroundRebuild);
+
+            // Small leaves and frequent synchronous rebuilds, so the tests exercise deep hierarchies deterministically
+            m_console->PerformCommand("bg_bvhLeafMaxEntries 2");
+            m_console->PerformCommand("bg_bvhRebuildMinModifications 16");
+            m_console->PerformCommand("bg_bvhBackgroundRebuild false");
+            m_console->PerformCommand("bg_visibilityUseBvh true");
+
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+            }
+            m_octreeSystemComponent = new OctreeSystemComponent;
+            IVisibilityScene* visScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("BvhUnitTestScene"));
+            m_bvhScene = azrtti_cast<BvhScene*>(visScene);
+        }
+
+        void TearDown() override
+        {
+            AZStd::string commandString;
+            commandString.format("bg_bvhLeafMaxEntries %u", m_savedLeafMaxEntries);
+            m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_bvhRebuildMinModifications %u", m_savedRebuildMinModifications);
+            m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_bvhBackgroundRebuild %s", m_savedBackgroundRebuild ? "true" : "false");
+            m_console->PerformCommand(commandString.c_str());
+            m_console->PerformCommand("bg_visibilityUseBvh false");
+
+            m_octreeSystemComponent->DestroyVisibilityScene(m_bvhScene);
+            delete m_octreeSystemComponent;
+            m_octreeSystemComponent = nullptr;
+
+            AZ::NameDictionary::Destroy();
+
+            AZ::Interface<AZ::IConsole>::Unregister(m_console);
+            delete m_console;
+            m_console = nullptr;
+        }
+
+        // Returns the number of entries the bvh enumerates for the bounds, and checks they match a brute force test
+        template <typename BoundType>
+        size_t EnumerateAndValidate(const BoundType& bounds, const AZStd::vector<VisibilityEntry>& entries)
+        {
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            m_bvhScene->Enumerate(bounds, [&gatheredEntries](const IVisibilityScene::NodeData& nodeData)
+                {
+                    gatheredEntries.insert(gatheredEntries.end(), nodeData.m_entries.begin(), nodeData.m_entries.end());
+                });
+
+            // Enumeration is conservative per leaf, but every overlapping entry must be gathered exactly once
+            for (const VisibilityEntry& entry : entries)
+            {
+                if (AZ::ShapeIntersection::Overlaps(bounds, entry.m_boundingVolume))
+                {
+                    EXPECT_EQ(AZStd::count_if(gatheredEntries.begin(), gatheredEntries.end(), [&entry](const VisibilityEntry* gathered) { return gathered == &entry; }), 1);
+                }
+            }
+            return gatheredEntries.size();
+        }
+
+        size_t CountEntriesNoCull()
+        {
+            size_t entryCount = 0;
+            m_bvhScene->EnumerateNoCull([&entryCount](const IVisibilityScene::NodeData& nodeData)
+                {
+                    entryCount += nodeData.m_entries.size();
+                });
+            return entryCount;
+        }
+
+        OctreeSystemComponent* m_octreeSystemComponent = nullptr;
+        BvhScene* m_bvhScene = nullptr;
+        uint32_t m_savedLeafMaxEntries = 0;
+        uint32_t m_savedRebuildMinModifications = 0;
+        bool m_savedBackgroundRebuild = true;
+        AZ::Console* m_console = nullptr;
+    };
+
+    static AZStd::vector<VisibilityEntry> CreateRandomEntries(std::mt19937& rng, size_t entryCount)
+    {
+        std::uniform_real_distribution<float> unif;
+        AZStd::vector<VisibilityEntry> entries(entryCount);
+        for (VisibilityEntry& entry : entries)
+        {
+            const AZ::Vector3 aabbMin = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 100.0f;
+            entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 5.0f);
+        }
+        return entries;
+    }
+
+    TEST_F(BvhSceneTests, CreateVisibilityScene_UseBvhSet_CreatesBvhScene)
+    {
+        EXPECT_TRUE(m_bvhScene != nullptr);
+    }
+
+    TEST_F(BvhSceneTests, InsertDeleteSingleEntry)
+    {
+        VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne());
+
+        m_bvhScene->InsertOrUpdateEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode != nullptr);
+        EXPECT_EQ(m_bvhScene->GetEntryCount(), 1);
+        EXPECT_EQ(CountEntriesNoCull(), 1);
+
+        m_bvhScene->RemoveEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode == nullptr);
+        EXPECT_EQ(m_bvhScene->GetEntryCount(), 0);
+        EXPECT_EQ(CountEntriesNoCull(), 0);
+    }
+
+    TEST_F(BvhSceneTests, InsertManyEntries_RebuildsHierarchy_EntriesAreNotLost)
+    {
+        std::mt19937 rng(1);
+        AZStd::vector<VisibilityEntry> entries = CreateRandomEntries(rng, 500);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->InsertOrUpdateEntry(entry);
+        }
+
+        EXPECT_GT(m_bvhScene->GetRebuildCount(), 0);
+        EXPECT_GT(m_bvhScene->GetNodeCount(), 1);
+        EXPECT_EQ(m_bvhScene->GetEntryCount(), entries.size());
+        EXPECT_EQ(CountEntriesNoCull(), entries.size());
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->RemoveEntry(entry);
+        }
+        EXPECT_EQ(CountEntriesNoCull(), 0);
+    }
+
+    TEST_F(BvhSceneTests, EnumerateAfterMovesAndRebuilds_MatchesBruteForce)
+    {
+        std::mt19937 rng(2);
+        AZStd::vector<VisibilityEntry> entries = CreateRandomEntries(rng, 300);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->InsertOrUpdateEntry(entry);
+        }
+
+        const AZ::Aabb queryAabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(20.0f), AZ::Vector3(60.0f));
+        const AZ::Sphere querySphere(AZ::Vector3(50.0f), 25.0f);
+        const AZ::Frustum queryFrustum(AZ::ViewFrustumAttributes(
+            AZ::Transform::CreateTranslation(AZ::Vector3(50.0f, -10.0f, 50.0f)), 1.0f, AZ::Constants::HalfPi, 1.0f, 80.0f));
+
+        std::uniform_real_distribution<float> unif(-10.0f, 10.0f);
+        for (uint32_t iteration = 0; iteration < 4; ++iteration)
+        {
+            // Move every other entry, the first moves refit the hierarchy and later ones trigger rebuilds
+            for (size_t index = iteration % 2; index < entries.size(); index += 2)
+            {
+                entries[index].m_boundingVolume.Translate(AZ::Vector3(unif(rng), unif(rng), unif(rng)));
+                m_bvhScene->InsertOrUpdateEntry(entries[index]);
+            }
+
+            EXPECT_GT(EnumerateAndValidate(queryAabb, entries), 0);
+            EXPECT_GT(EnumerateAndValidate(querySphere, entries), 0);
+            EXPECT_GT(EnumerateAndValidate(queryFrustum, entries), 0);
+            EXPECT_EQ(CountEntriesNoCull(), entries.size());
+        }
+
+        m_bvhScene->Rebuild();
+        EXPECT_GT(EnumerateAndValidate(queryFrustum, entries), 0);
+        EXPECT_EQ(CountEntriesNoCull(), entries.size());
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_bvhScene->RemoveEntry(entry);
+        }
+    }
+
+    TEST_F(BvhSceneTests, ExcludeFrustum_EntriesInsideExclusion_AreRejected)
+    {
+        // One entry per leaf, so the leaf bounds of the first entry are fully inside the exclusion frustum
+        m_console->PerformCommand("bg_bvhLeafMaxEntries 1");
+
+        VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.5f, 2.0f, -0.5f), AZ::Vector3(0.5f, 3.0f, 0.5f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.5f, 8.0f, -0.5f), AZ::Vector3(0.5f, 9.0f, 0.5f));
+        m_bvhScene->InsertOrUpdateEntry(visEntry[0]);
+        m_bvhScene->InsertOrUpdateEntry(visEntry[1]);
+        m_bvhScene->Rebuild();
+
+        const AZ::Transform frustumTransform = AZ::Transform::CreateIdentity();
+        const AZ::Frustum include(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, AZ::Constants::HalfPi, 1.0f, 10.0f));
+        const AZ::Frustum exclude(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, AZ::Constants::HalfPi, 1.0f, 5.0f));
+
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        m_bvhScene->Enumerate(include, exclude, [&gatheredEntries](const IVisibilityScene::NodeData& nodeData)
+            {
+                gatheredEntries.insert(gatheredEntries.end(), nodeData.m_entries.begin(), nodeData.m_entries.end());
+            });
+        ASSERT_EQ(gatheredEntries.size(), 1);
+        EXPECT_EQ(gatheredEntries[0], &visEntry[1]);
+
+        m_bvhScene->RemoveEntry(visEntry[0]);
+        m_bvhScene->RemoveEntry(visEntry[1]);
+    }
+}
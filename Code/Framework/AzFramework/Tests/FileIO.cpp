@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
@@ -954,5 +955,94 @@ namespace UnitTest
         {
             run();
         }
+
+        TEST_F(AliasTest, ResolvePath_AfterAliasChanged_ResolvesWithNewAlias)
+        {
+            AZ::IO::LocalFileIO local;
+            local.SetAlias("@test@", m_folderName.c_str());
+
+            AZ::IO::FixedMaxPath resolvedPath;
+            ASSERT_TRUE(local.ResolvePath(resolvedPath, "@test@/somefile.txt"));
+            EXPECT_EQ(m_folderName / "somefile.txt", resolvedPath);
+
+            // The second resolve is answered by the cache
+            ASSERT_TRUE(local.ResolvePath(resolvedPath, "@test@/somefile.txt"));
+            EXPECT_EQ(m_folderName / "somefile.txt", resolvedPath);
+            EXPECT_EQ(1u, local.GetFileSystemQueryStatistics().m_resolvedPathCacheHits);
+
+            local.SetAlias("@test@", m_deepFolder.c_str());
+            ASSERT_TRUE(local.ResolvePath(resolvedPath, "@test@/somefile.txt"));
+            EXPECT_EQ(m_deepFolder / "somefile.txt", resolvedPath);
+        }
+
+        class FileMetadataCacheTest
+            : public FolderFixture
+        {
+        public:
+            void SetUp() override
+            {
+                FolderFixture::SetUp();
+                m_console = aznew AZ::Console();
+                AZ::Interface<AZ::IConsole>::Register(m_console);
+                m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+                m_console->PerformCommand("sys_fileMetadataCacheMs 60000");
+            }
+
+            void TearDown() override
+            {
+                m_console->PerformCommand("sys_fileMetadataCacheMs 0");
+                AZ::Interface<AZ::IConsole>::Unregister(m_console);
+                delete m_console;
+                m_console = nullptr;
+
+                LocalFileIO local;
+                local.DestroyPath(m_folderName.c_str());
+                FolderFixture::TearDown();
+            }
+
+            AZ::Console* m_console = nullptr;
+        };
+
+        TEST_F(FileMetadataCacheTest, Exists_RepeatedQueries_AreCachedUntilInvalidated)
+        {
+            CreateTestFiles();
+
+            LocalFileIO local;
+            EXPECT_TRUE(local.Exists(m_file01Name.c_str()));
+            EXPECT_TRUE(local.Exists(m_file01Name.c_str()));
+            EXPECT_EQ(1u, local.GetFileSystemQueryStatistics().m_fileSystemQueries);
+            EXPECT_EQ(1u, local.GetFileSystemQueryStatistics().m_fileMetadataCacheHits);
+
+            // Changes made outside of the file IO are only seen once they're reported
+            EXPECT_TRUE(SystemFile::Delete(m_file01Name.c_str()));
+            EXPECT_TRUE(local.Exists(m_file01Name.c_str()));
+            local.InvalidateFileMetadata(m_file01Name.c_str());
+            EXPECT_FALSE(local.Exists(m_file01Name.c_str()));
+        }
+
+        TEST_F(FileMetadataCacheTest, Exists_AfterChangesThroughFileIO_IsUpToDate)
+        {
+            CreateTestFiles();
+
+            LocalFileIO local;
+            EXPECT_TRUE(local.Exists(m_file02Name.c_str()));
+            EXPECT_TRUE(local.Remove(m_file02Name.c_str()));
+            EXPECT_FALSE(local.Exists(m_file02Name.c_str()));
+
+            HandleType fileHandle = InvalidHandle;
+            ASSERT_TRUE(local.Open(m_file02Name.c_str(), OpenMode::ModeWrite | OpenMode::ModeBinary, fileHandle));
+            EXPECT_TRUE(local.Write(fileHandle, "test", 4));
+            EXPECT_TRUE(local.Close(fileHandle));
+            EXPECT_TRUE(local.Exists(m_file02Name.c_str()));
+
+            AZ::u64 fileSize = 0;
+            EXPECT_TRUE(local.Size(m_file02Name.c_str(), fileSize));
+            EXPECT_EQ(4u, fileSize);
+
+            AZ::IO::Path newFolder = m_folderName / "newfolder";
+            EXPECT_FALSE(local.IsDirectory(newFolder.c_str()));
+            EXPECT_TRUE(local.CreatePath(newFolder.c_str()));
+            EXPECT_TRUE(local.IsDirectory(newFolder.c_str()));
+        }
     }
 }   // namespace UnitTest
@@ -68,6 +68,9 @@ namespace AzFramework
             ClaimEntities,
             void(EntitySpawnTicket& ticket, ClaimEntitiesCallback listCallback, ClaimEntitiesOptionalArgs optionalArgs));
 
+        MOCK_METHOD3(
+            PrewarmAllEntities, void(EntitySpawnTicket& ticket, uint32_t instanceCount, PrewarmAllEntitiesOptionalArgs optionalArgs));
+
         MOCK_METHOD3(Barrier, void(EntitySpawnTicket& ticket, BarrierCallback completionCallback, BarrierOptionalArgs optionalArgs));
         MOCK_METHOD3(LoadBarrier, void(EntitySpawnTicket& ticket, BarrierCallback completionCallback, LoadBarrierOptionalArgs optionalArgs));
 
@@ -172,6 +172,32 @@ namespace UnitTest
         EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1);
     }
 
+    TEST_F(OctreeTests, InsertOrUpdateEntries_BatchOfEntries_MatchesIndividualUpdates)
+    {
+        AzFramework::VisibilityEntry visEntry[3];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        AzFramework::VisibilityEntry* visEntries[] = { &visEntry[0], &visEntry[1], &visEntry[2] };
+
+        m_octreeScene->InsertOrUpdateEntries(visEntries);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1 + (2 * m_octreeScene->GetChildNodeCount()));
+
+        // Moving the entries into a single child of the root merges the other nodes
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.2f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.3f), AZ::Vector3( 0.4f));
+        m_octreeScene->InsertOrUpdateEntries(visEntries);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+
+        for (AzFramework::VisibilityEntry& entry : visEntry)
+        {
+            m_octreeScene->RemoveEntry(entry);
+            EXPECT_TRUE(entry.m_internalNode == nullptr);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
+
     TEST_F(OctreeTests, UpdateSplitMerge)
     {
         AzFramework::VisibilityEntry visEntry[3];
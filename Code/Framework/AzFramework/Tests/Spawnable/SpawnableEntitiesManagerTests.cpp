@@ -524,6 +524,46 @@ namespace UnitTest
         EXPECT_EQ(NumEntities, spawnedEntitiesCount);
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_QueueHasTimeBudget_EntitiesAddedInPartsBeforeCompletion)
+    {
+        static constexpr size_t NumEntities = 64;
+        FillSpawnable(NumEntities);
+
+        // A budget this small runs out after every entity, so the entities are added to the game context one call at a time.
+        m_manager->SetQueueTimeBudget(
+            AzFramework::SpawnableEntitiesManager::CommandQueuePriority::High |
+                AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular,
+            AZStd::chrono::microseconds(1));
+
+        size_t lastActivatedCount = 0;
+        size_t progressCallCount = 0;
+        bool progressIsIncreasing = true;
+        auto progressCallback = [&](AzFramework::EntitySpawnTicket::Id, size_t activatedCount, size_t totalCount)
+        {
+            EXPECT_EQ(NumEntities, totalCount);
+            progressIsIncreasing = progressIsIncreasing && activatedCount > lastActivatedCount;
+            lastActivatedCount = activatedCount;
+            ++progressCallCount;
+        };
+        size_t spawnedEntitiesCount = 0;
+        size_t activatedCountAtCompletion = 0;
+        auto callback = [&](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntitiesCount += entities.size();
+            activatedCountAtCompletion = lastActivatedCount;
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        optionalArgs.m_progressCallback = AZStd::move(progressCallback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+        EXPECT_EQ(NumEntities, activatedCountAtCompletion);
+        EXPECT_TRUE(progressIsIncreasing);
+        EXPECT_GE(progressCallCount, 1);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_SetParentOnSpawnedEntities_LineageIsPreserved)
     {
         static constexpr size_t NumEntities = 4;
@@ -622,6 +662,51 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_SpawnRepeatedly_ClonesGetNewIdsAndKeepExternalReferences)
+    {
+        constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+
+        // Half of the entities refer to an entity that isn't part of the spawnable, which should be left untouched.
+        const AZ::EntityId externalEntityId(EntityIdStartId + 1000);
+        AzFramework::Spawnable::EntityList& prototypes = m_spawnable->GetEntities();
+        for (size_t i = 0; i < NumEntities; i += 2)
+        {
+            prototypes[i]->CreateComponent<ComponentWithEntityReference>()->m_entityReference = externalEntityId;
+        }
+
+        AZStd::unordered_set<AZ::EntityId> spawnedIds;
+        size_t spawnedEntitiesCount = 0;
+        auto callback = [&](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            for (const AZ::Entity* entity : entities)
+            {
+                spawnedIds.insert(entity->GetId());
+                if (auto component = entity->FindComponent<ComponentWithEntityReference>())
+                {
+                    EXPECT_EQ(externalEntityId, component->m_entityReference);
+                }
+            }
+            spawnedEntitiesCount += entities.size();
+        };
+
+        constexpr size_t NumSpawnAllCalls = 3;
+        for (size_t spawns = 0; spawns < NumSpawnAllCalls; spawns++)
+        {
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = callback;
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        }
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(NumEntities * NumSpawnAllCalls, spawnedEntitiesCount);
+        EXPECT_EQ(NumEntities * NumSpawnAllCalls, spawnedIds.size());
+        for (const auto& prototype : prototypes)
+        {
+            EXPECT_FALSE(spawnedIds.contains(prototype->GetId()));
+        }
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_DeleteTicketBeforeCall_NoCrash)
     {
         {
@@ -1448,6 +1533,60 @@ namespace UnitTest
     }
 
 
+    //
+    // PrewarmAllEntities
+    //
+
+    TEST_F(SpawnableEntitiesManagerTest, PrewarmAllEntities_SpawnMoreThanPrewarmed_AllEntitiesSpawnedAndReferencesMapped)
+    {
+        constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceFirst);
+
+        bool prewarmCompleted = false;
+        m_manager->PrewarmAllEntities(
+            *m_ticket, 2,
+            { [&prewarmCompleted](AzFramework::EntitySpawnTicket::Id)
+              {
+                  prewarmCompleted = true;
+              } });
+        ProcessQueueTillEmtpy();
+        EXPECT_TRUE(prewarmCompleted);
+
+        // The first two calls use the prewarmed instances, the third one clones new entities.
+        AZStd::unordered_set<AZ::EntityId> spawnedIds;
+        auto callback = [this, &spawnedIds](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceFirst, NumEntities, entities);
+            for (const AZ::Entity* entity : entities)
+            {
+                spawnedIds.insert(entity->GetId());
+            }
+        };
+        constexpr size_t NumSpawnAllCalls = 3;
+        for (size_t spawns = 0; spawns < NumSpawnAllCalls; spawns++)
+        {
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = callback;
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        }
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(NumEntities * NumSpawnAllCalls, spawnedIds.size());
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, PrewarmAllEntities_DeleteTicketWithPrewarmedEntities_NoLeaks)
+    {
+        FillSpawnable(4);
+        {
+            AzFramework::EntitySpawnTicket ticket(*m_spawnableAsset);
+            m_manager->PrewarmAllEntities(ticket, 3);
+            ProcessQueueTillEmtpy();
+        }
+        ProcessQueueTillEmtpy();
+    }
+
+
     //
     // Barrier
     //
@@ -16,6 +16,7 @@ set(FILES
     ArchiveTests.cpp
     BehaviorEntityTests.cpp
     BinToTextEncode.cpp
+    BvhSceneTests.cpp
     CameraInputTests.cpp
     ClickDetectorTests.cpp
     CursorStateTests.cpp
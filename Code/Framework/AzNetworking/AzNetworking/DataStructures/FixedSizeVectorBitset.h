@@ -33,6 +33,12 @@ namespace AzNetworking
         //! @return reference to the LHS
         SelfType& operator |=(const SelfType& rhs);
 
+        //! Equality operators, two bitsets are equal if they have the same size and the same bits set.
+        //! @param rhs instance to compare against
+        //! @return boolean true if the bitsets are equal (or not equal for operator !=)
+        bool operator ==(const SelfType& rhs) const;
+        bool operator !=(const SelfType& rhs) const;
+
         //! Sets the specified bit to the provided value.
         //! @param index index of the bit to set
         //! @param value value to set the bit to
@@ -33,6 +33,38 @@ namespace AzNetworking
         return *this;
     }
 
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator==(const SelfType& rhs) const
+    {
+        if (GetSize() != rhs.GetSize())
+        {
+            return false;
+        }
+        // Compare whole elements first, the trailing bits of the last element aren't guaranteed to be cleared
+        const uint32_t fullElementSize = static_cast<uint32_t>(GetSize() / BitsetType::ElementTypeBits);
+        for (uint32_t i = 0; i < fullElementSize; ++i)
+        {
+            if (m_bitset.GetContainer()[i] != rhs.m_bitset.GetContainer()[i])
+            {
+                return false;
+            }
+        }
+        for (uint32_t i = fullElementSize * static_cast<uint32_t>(BitsetType::ElementTypeBits); i < GetSize(); ++i)
+        {
+            if (m_bitset.GetBit(i) != rhs.m_bitset.GetBit(i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator!=(const SelfType& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
     template <AZStd::size_t CAPACITY, typename ElementType>
     inline void FixedSizeVectorBitset<CAPACITY, ElementType>::SetBit(uint32_t index, bool value)
     {
@@ -13,30 +13,53 @@
 
 namespace AzNetworking
 {
+    TimeoutQueue::TimeoutQueue()
+    {
+        m_bucketHeads.fill(InvalidIndex);
+    }
+
     void TimeoutQueue::Reset()
     {
-        m_timeoutItemMap.clear();
-        m_timeoutItemQueue = TimeoutItemQueue();
-        m_nextTimeoutId = TimeoutId{0};
+        AZStd::lock_guard lock(m_mutex);
+
+        m_slots.clear();
+        m_bucketHeads.fill(InvalidIndex);
+        m_wheelItemCounts.fill(0);
+        m_freeHead = InvalidIndex;
+        m_freeTail = InvalidIndex;
+        m_itemCount = 0;
+        m_currentTick = 0;
     }
 
     TimeoutId TimeoutQueue::RegisterItem(uint64_t userData, AZ::TimeMs timeoutMs)
     {
         AZStd::lock_guard lock(m_mutex);
 
-        const TimeoutId timeoutId = m_nextTimeoutId;
-        const AZ::TimeMs timeoutTimeMs = AZ::GetElapsedTimeMs() + timeoutMs;
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        if (m_itemCount == 0)
+        {
+            // Nothing is scheduled, so the wheels can skip straight to the current time
+            m_currentTick = AZStd::max<uint64_t>(static_cast<uint64_t>(currentTimeMs), 1) - 1;
+        }
+
+        const int32_t slotIndex = AllocateSlot();
+        if (slotIndex == InvalidIndex)
+        {
+            AZ_Assert(false, "TimeoutQueue is full, unable to register %u items", IndexMask + 1);
+            return TimeoutId{ 0 };
+        }
+
+        TimeoutSlot& slot = m_slots[slotIndex];
+        slot.m_item = TimeoutItem(userData, timeoutMs);
+        const TimeoutId timeoutId = aznumeric_cast<TimeoutId>((slot.m_generation << IndexBits) | aznumeric_cast<uint32_t>(slotIndex));
         AZLOG(TimeoutQueue, "Pushing timeoutid %u with user data %" PRIu64 " to expire at time %u",
             aznumeric_cast<uint32_t>(timeoutId),
             userData,
-            aznumeric_cast<uint32_t>(timeoutTimeMs)
+            aznumeric_cast<uint32_t>(slot.m_item.m_nextTimeoutTimeMs)
         );
 
-        TimeoutQueueItem queueItem(timeoutId, timeoutTimeMs);
-        m_timeoutItemMap[timeoutId] = TimeoutItem(userData, timeoutMs);
-        m_timeoutItemQueue.push(queueItem);
-        ++m_nextTimeoutId;
-
+        ScheduleSlot(slotIndex);
+        ++m_itemCount;
         return timeoutId;
     }
 
@@ -44,91 +67,288 @@ namespace AzNetworking
     {
         AZStd::lock_guard lock(m_mutex);
 
-        TimeoutItemMap::iterator iter = m_timeoutItemMap.find(timeoutId);
-        if (iter != m_timeoutItemMap.end())
-        {
-            return &(iter->second);
-        }
-        return nullptr;
+        const int32_t slotIndex = GetSlotIndex(timeoutId);
+        return (slotIndex != InvalidIndex) ? &m_slots[slotIndex].m_item : nullptr;
     }
 
     void TimeoutQueue::RemoveItem(TimeoutId timeoutId)
     {
         AZStd::lock_guard lock(m_mutex);
 
-        m_timeoutItemMap.erase(timeoutId);
+        const int32_t slotIndex = GetSlotIndex(timeoutId);
+        if (slotIndex != InvalidIndex)
+        {
+            UnlinkSlot(slotIndex);
+            FreeSlot(slotIndex);
+        }
     }
 
     void TimeoutQueue::UpdateTimeouts(const TimeoutHandler& timeoutHandler, int32_t maxTimeouts)
     {
         AZStd::lock_guard lock(m_mutex);
 
-        int32_t numTimeouts = 0;
         if (maxTimeouts < 0)
         {
             maxTimeouts = INT_MAX;
         }
-        AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
-        while (m_timeoutItemQueue.size() > 0)
+
+        // Items time out once their timeout time is in the past, so the current millisecond is never expired
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        const uint64_t lastExpiredTick = AZStd::max<uint64_t>(static_cast<uint64_t>(currentTimeMs), 1) - 1;
+        if (m_itemCount == 0)
         {
-            const TimeoutQueueItem queueItem = m_timeoutItemQueue.top();
-            const TimeoutId    itemTimeoutId = queueItem.m_timeoutId;
-            const AZ::TimeMs   itemTimeoutMs = queueItem.m_timeoutTimeMs;
+            m_currentTick = AZStd::max(m_currentTick, lastExpiredTick);
+            return;
+        }
 
-            // Head item has not timed out yet, we can terminate because we've run out of timed out items
-            if (itemTimeoutMs >= currentTimeMs)
+        int32_t remainingTimeouts = maxTimeouts;
+        while (m_currentTick < lastExpiredTick)
+        {
+            const uint64_t tick = m_currentTick + 1;
+            const uint32_t wheelIndex = aznumeric_cast<uint32_t>(tick & WheelMask);
+            if ((wheelIndex != 0) && (m_wheelItemCounts[0] == 0))
             {
-                break;
+                // Nothing can expire until the coarser wheels cascade at the start of the next turn of the finest wheel
+                m_currentTick = AZStd::min(tick | WheelMask, lastExpiredTick);
+                continue;
             }
 
-            ++numTimeouts;
+            m_currentTick = tick;
+            if (wheelIndex == 0)
+            {
+                // Move the items of the coarser wheels that are now within range down, starting from the coarsest wheel that turned
+                uint32_t wheel = 1;
+                while ((wheel < WheelCount - 1) && (((tick >> (wheel * WheelBits)) & WheelMask) == 0))
+                {
+                    ++wheel;
+                }
+                for (; wheel > 0; --wheel)
+                {
+                    CascadeBucket(wheel * WheelSize + aznumeric_cast<uint32_t>((tick >> (wheel * WheelBits)) & WheelMask));
+                }
+            }
 
-            if (numTimeouts >= maxTimeouts)
+            if (!ExpireBucket(wheelIndex, currentTimeMs, timeoutHandler, remainingTimeouts))
             {
-                AZLOG_WARN("Terminating timeout queue iteration due to hitting timeout count limit: %d", numTimeouts);
+                m_currentTick = tick - 1;
+                AZLOG_WARN("Terminating timeout queue iteration due to hitting timeout count limit: %d", maxTimeouts);
                 break;
             }
+        }
+    }
 
-            // Pop the item, we're either going to time it out or reinsert it
-            m_timeoutItemQueue.pop();
+    int32_t TimeoutQueue::GetSlotIndex(TimeoutId timeoutId) const
+    {
+        const uint32_t value = aznumeric_cast<uint32_t>(timeoutId);
+        const uint32_t slotIndex = value & IndexMask;
+        if (slotIndex >= m_slots.size())
+        {
+            return InvalidIndex;
+        }
+
+        const TimeoutSlot& slot = m_slots[slotIndex];
+        if ((slot.m_bucket == FreeBucket) || (slot.m_generation != (value >> IndexBits)))
+        {
+            return InvalidIndex;
+        }
+        return aznumeric_cast<int32_t>(slotIndex);
+    }
 
-            TimeoutItemMap::iterator iter = m_timeoutItemMap.find(itemTimeoutId);
-            if (iter == m_timeoutItemMap.end())
+    int32_t TimeoutQueue::AllocateSlot()
+    {
+        if (m_freeHead != InvalidIndex)
+        {
+            const int32_t slotIndex = m_freeHead;
+            m_freeHead = m_slots[slotIndex].m_next;
+            if (m_freeHead == InvalidIndex)
             {
-                // Item has already been deleted, just continue
-                continue;
+                m_freeTail = InvalidIndex;
+            }
+            m_slots[slotIndex].m_next = InvalidIndex;
+            return slotIndex;
+        }
+
+        if (m_slots.size() > IndexMask)
+        {
+            return InvalidIndex;
+        }
+        m_slots.emplace_back();
+        return aznumeric_cast<int32_t>(m_slots.size() - 1);
+    }
+
+    void TimeoutQueue::FreeSlot(int32_t slotIndex)
+    {
+        TimeoutSlot& slot = m_slots[slotIndex];
+        slot.m_bucket = FreeBucket;
+        slot.m_prev = InvalidIndex;
+        slot.m_next = InvalidIndex;
+        slot.m_generation = ((slot.m_generation + 1) & GenerationMask);
+        if (slot.m_generation == 0)
+        {
+            // Generation zero is skipped so that a zero timeout id never refers to an item
+            slot.m_generation = 1;
+        }
+
+        // Slots are reused in the order they were freed, which keeps the generation of each slot from wrapping quickly
+        if (m_freeTail != InvalidIndex)
+        {
+            m_slots[m_freeTail].m_next = slotIndex;
+        }
+        else
+        {
+            m_freeHead = slotIndex;
+        }
+        m_freeTail = slotIndex;
+        --m_itemCount;
+    }
+
+    void TimeoutQueue::ScheduleSlot(int32_t slotIndex)
+    {
+        const uint64_t timeoutTick = static_cast<uint64_t>(AZStd::max(m_slots[slotIndex].m_item.m_nextTimeoutTimeMs, AZ::Time::ZeroTimeMs));
+        uint64_t tick = AZStd::max(timeoutTick, m_currentTick + 1);
+
+        // Pick the finest wheel whose next turn doesn't reach the item's tick
+        uint32_t wheel = 0;
+        while ((wheel < WheelCount - 1) && ((tick >> ((wheel + 1) * WheelBits)) != (m_currentTick >> ((wheel + 1) * WheelBits))))
+        {
+            ++wheel;
+        }
+        if (wheel == WheelCount - 1)
+        {
+            // The coarsest wheel wraps around, items beyond a full turn are parked at the end of the turn and rescheduled as they cascade
+            tick = AZStd::min(tick, m_currentTick + (uint64_t{ 1 } << (WheelCount * WheelBits)) - 1);
+        }
+
+        LinkSlot(slotIndex, wheel * WheelSize + aznumeric_cast<uint32_t>((tick >> (wheel * WheelBits)) & WheelMask));
+    }
+
+    void TimeoutQueue::LinkSlot(int32_t slotIndex, uint32_t bucket)
+    {
+        TimeoutSlot& slot = m_slots[slotIndex];
+        slot.m_bucket = bucket;
+        slot.m_prev = InvalidIndex;
+        slot.m_next = m_bucketHeads[bucket];
+        if (slot.m_next != InvalidIndex)
+        {
+            m_slots[slot.m_next].m_prev = slotIndex;
+        }
+        m_bucketHeads[bucket] = slotIndex;
+
+        if (bucket < ProcessingBucket)
+        {
+            ++m_wheelItemCounts[bucket / WheelSize];
+        }
+    }
+
+    void TimeoutQueue::UnlinkSlot(int32_t slotIndex)
+    {
+        TimeoutSlot& slot = m_slots[slotIndex];
+        if (slot.m_prev != InvalidIndex)
+        {
+            m_slots[slot.m_prev].m_next = slot.m_next;
+        }
+        else
+        {
+            m_bucketHeads[slot.m_bucket] = slot.m_next;
+        }
+        if (slot.m_next != InvalidIndex)
+        {
+            m_slots[slot.m_next].m_prev = slot.m_prev;
+        }
+
+        if (slot.m_bucket < ProcessingBucket)
+        {
+            --m_wheelItemCounts[slot.m_bucket / WheelSize];
+        }
+        slot.m_prev = InvalidIndex;
+        slot.m_next = InvalidIndex;
+    }
+
+    void TimeoutQueue::CascadeBucket(uint32_t bucket)
+    {
+        int32_t slotIndex = m_bucketHeads[bucket];
+        while (slotIndex != InvalidIndex)
+        {
+            const int32_t nextIndex = m_slots[slotIndex].m_next;
+            UnlinkSlot(slotIndex);
+            if (static_cast<uint64_t>(m_slots[slotIndex].m_item.m_nextTimeoutTimeMs) <= m_currentTick)
+            {
+                // Items due on the current tick go straight to the finest wheel bucket that's about to be expired
+                LinkSlot(slotIndex, aznumeric_cast<uint32_t>(m_currentTick & WheelMask));
+            }
+            else
+            {
+                ScheduleSlot(slotIndex);
             }
+            slotIndex = nextIndex;
+        }
+    }
 
-            TimeoutItem mapItem = iter->second;
+    bool TimeoutQueue::ExpireBucket(uint32_t bucket, AZ::TimeMs currentTimeMs, const TimeoutHandler& timeoutHandler, int32_t& inOutRemainingTimeouts)
+    {
+        // Move the bucket to the processing list first, timeout handlers may register or remove items while it's being expired
+        while (m_bucketHeads[bucket] != InvalidIndex)
+        {
+            const int32_t slotIndex = m_bucketHeads[bucket];
+            UnlinkSlot(slotIndex);
+            LinkSlot(slotIndex, ProcessingBucket);
+        }
 
-            // Check to see if the item has been refreshed since it was inserted
-            if (mapItem.m_nextTimeoutTimeMs > currentTimeMs)
+        while (m_bucketHeads[ProcessingBucket] != InvalidIndex)
+        {
+            const int32_t slotIndex = m_bucketHeads[ProcessingBucket];
+            UnlinkSlot(slotIndex);
+
+            // Check to see if the item has been refreshed since it was scheduled
+            if (m_slots[slotIndex].m_item.m_nextTimeoutTimeMs >= currentTimeMs)
             {
-                TimeoutQueueItem reQueueItem(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
-                m_timeoutItemQueue.push(reQueueItem);
+                ScheduleSlot(slotIndex);
                 continue;
             }
 
+            if (inOutRemainingTimeouts <= 0)
+            {
+                // Put the item and the rest of the bucket back, the bucket is expired again on the next update
+                LinkSlot(slotIndex, bucket);
+                while (m_bucketHeads[ProcessingBucket] != InvalidIndex)
+                {
+                    const int32_t remainingIndex = m_bucketHeads[ProcessingBucket];
+                    UnlinkSlot(remainingIndex);
+                    LinkSlot(remainingIndex, bucket);
+                }
+                return false;
+            }
+            --inOutRemainingTimeouts;
+
             // By this point, the item is definitely timed out
-            // Invoke the timeout function to see how to proceed
-            const TimeoutResult result = timeoutHandler(mapItem);
+            // The handler gets a copy, since registering items from the handler may reallocate the slots
+            TimeoutItem item = m_slots[slotIndex].m_item;
+            const uint32_t generation = m_slots[slotIndex].m_generation;
+            const TimeoutResult result = timeoutHandler(item);
+
+            TimeoutSlot& slot = m_slots[slotIndex];
+            if ((slot.m_bucket == FreeBucket) || (slot.m_generation != generation))
+            {
+                // The handler removed the item itself
+                continue;
+            }
 
             if (result == TimeoutResult::Refresh)
             {
-                mapItem.UpdateTimeoutTime(currentTimeMs);
-                // Re-insert into priority queue
-                TimeoutQueueItem reQueueItem(itemTimeoutId, mapItem.m_nextTimeoutTimeMs);
-                m_timeoutItemQueue.push(reQueueItem);
+                item.UpdateTimeoutTime(currentTimeMs);
+                slot.m_item = item;
+                ScheduleSlot(slotIndex);
                 continue;
             }
 
             AZLOG(TimeoutQueue, "Popping timeoutid %u with user data %" PRIu64 ", expire time %d, current time %u",
-                aznumeric_cast<uint32_t>(itemTimeoutId),
-                mapItem.m_userData,
-                aznumeric_cast<uint32_t>(mapItem.m_nextTimeoutTimeMs),
+                (generation << IndexBits) | aznumeric_cast<uint32_t>(slotIndex),
+                item.m_userData,
+                aznumeric_cast<uint32_t>(item.m_nextTimeoutTimeMs),
                 aznumeric_cast<uint32_t>(currentTimeMs));
 
-            m_timeoutItemMap.erase(itemTimeoutId);
+            FreeSlot(slotIndex);
         }
+        return true;
     }
 }
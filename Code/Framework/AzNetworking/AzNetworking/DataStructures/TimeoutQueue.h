@@ -10,8 +10,10 @@
 
 #include <AzCore/Time/ITime.h>
 #include <AzCore/RTTI/TypeSafeIntegral.h>
-#include <AzCore/std/containers/map.h>
-#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AzNetworking
 {
@@ -25,6 +27,12 @@ namespace AzNetworking
 
     //! @class TimeoutQueue
     //! @brief class for managing timeout items.
+    //!
+    //! Items are stored in a hierarchical timing wheel with millisecond resolution, four wheels of 256 buckets each covering
+    //! 256ms, 65s, 4.6 hours and 49 days. Registering and removing an item are constant time, and updating only visits the items of
+    //! the buckets that expired since the last update, items in the coarser wheels are moved to the finer wheels as their time
+    //! approaches. Items live in a single array reused through a free list, so no allocations are made per item once the array
+    //! has grown to the peak number of items.
     class TimeoutQueue
     {
     public:
@@ -41,7 +49,7 @@ namespace AzNetworking
             AZ::TimeMs m_nextTimeoutTimeMs = AZ::Time::ZeroTimeMs;
         };
 
-        TimeoutQueue() = default;
+        TimeoutQueue();
         ~TimeoutQueue() = default;
 
         //! Resets all internal state for this timeout queue.
@@ -70,22 +78,46 @@ namespace AzNetworking
 
     private:
 
-        struct TimeoutQueueItem
-        {
-            TimeoutQueueItem(TimeoutId timeoutId, AZ::TimeMs timeoutTimeMs);
+        static constexpr uint32_t WheelBits = 8;
+        static constexpr uint32_t WheelSize = 1 << WheelBits;
+        static constexpr uint64_t WheelMask = WheelSize - 1;
+        static constexpr uint32_t WheelCount = 4;
+        static constexpr uint32_t ProcessingBucket = WheelCount * WheelSize;
+        static constexpr uint32_t FreeBucket = ProcessingBucket + 1;
 
-            bool operator < (const TimeoutQueueItem &rhs) const;
+        // Timeout ids combine the item index with a generation, so ids of removed items don't match the items reusing their slot
+        static constexpr uint32_t IndexBits = 22;
+        static constexpr uint32_t IndexMask = (1 << IndexBits) - 1;
+        static constexpr uint32_t GenerationMask = (1 << (32 - IndexBits)) - 1;
+        static constexpr int32_t InvalidIndex = -1;
 
-            TimeoutId m_timeoutId;
-            AZ::TimeMs m_timeoutTimeMs;
+        struct TimeoutSlot
+        {
+            TimeoutItem m_item;
+            int32_t m_prev = InvalidIndex;
+            int32_t m_next = InvalidIndex;
+            uint32_t m_bucket = FreeBucket;
+            uint32_t m_generation = 1;
         };
 
-        using TimeoutItemMap   = AZStd::map<TimeoutId, TimeoutItem>;
-        using TimeoutItemQueue = AZStd::priority_queue<TimeoutQueueItem>;
-
-        TimeoutId        m_nextTimeoutId = TimeoutId{ 0 };
-        TimeoutItemMap   m_timeoutItemMap;
-        TimeoutItemQueue m_timeoutItemQueue;
+        int32_t GetSlotIndex(TimeoutId timeoutId) const;
+        int32_t AllocateSlot();
+        void FreeSlot(int32_t slotIndex);
+        void ScheduleSlot(int32_t slotIndex);
+        void LinkSlot(int32_t slotIndex, uint32_t bucket);
+        void UnlinkSlot(int32_t slotIndex);
+        void CascadeBucket(uint32_t bucket);
+        bool ExpireBucket(uint32_t bucket, AZ::TimeMs currentTimeMs, const TimeoutHandler& timeoutHandler, int32_t& inOutRemainingTimeouts);
+
+        AZStd::vector<TimeoutSlot> m_slots;
+        AZStd::array<int32_t, ProcessingBucket + 1> m_bucketHeads;
+        AZStd::array<uint32_t, WheelCount> m_wheelItemCounts = {};
+        int32_t m_freeHead = InvalidIndex;
+        int32_t m_freeTail = InvalidIndex;
+        uint32_t m_itemCount = 0;
+
+        // All ticks up to and including the current tick have been expired
+        uint64_t m_currentTick = 0;
 
         // TimeoutQueue is a shared resource among connections. A mutex (or a read-write sync object) is required with multi-threaded sends.
         // See @sv_multithreadedConnectionUpdates cvar.
@@ -93,98 +93,118 @@ namespace AzNetworking
 
     void TcpConnection::UpdateSend()
     {
-        const uint32_t numSendBytes = m_sendRingbuffer.GetReadBufferSize();
-        if (numSendBytes <= 0)
-        {
-            return;
-        }
+        m_sendFlushQueued = false;
+        FlushSendBuffer();
+        ReportSocketMetrics();
+        HandlePendingDisconnect();
+    }
+
+    bool TcpConnection::UpdateRecv()
+    {
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        GetMetrics().LogPacketRecv(0, startTimeMs);
+        m_queuedForUpdate = false;
 
-        uint8_t* sendData = m_sendRingbuffer.GetReadBufferData();
-        const int32_t sentBytes = m_socket->Send(sendData, numSendBytes);
-        const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(sentBytes);
-        if (disconnectReason != DisconnectReason::MAX)
+        // Reactor threads read sockets as data arrives, so only read here if the receive ringbuffer filled up before the socket drained
+        bool socketDrained = m_networkInterface.HasReactorThreads() && !m_recvStalled;
+        for (;;)
         {
-            Disconnect(disconnectReason, TerminationEndpoint::Remote);
-            return;
-        }
+            if (!socketDrained)
+            {
+                socketDrained = ReadFromSocket();
+            }
 
-        m_sendRingbuffer.AdvanceReadBuffer(sentBytes);
-        m_networkInterface.GetMetrics().m_sendBytes += numSendBytes;
-        m_networkInterface.GetMetrics().m_sendBytesUncompressed += numSendBytes;
+            const uint32_t receivedPackets = ProcessReceivedPackets(startTimeMs);
+            if (socketDrained || (m_state == ConnectionState::Disconnected))
+            {
+                break;
+            }
 
-        if (m_socket->IsEncrypted() && sentBytes > 0)
-        {
-            m_networkInterface.GetMetrics().m_sendBytesEncryptionInflation += (aznumeric_cast<uint32_t>(sentBytes) - numSendBytes);
-            m_networkInterface.GetMetrics().m_sendPacketsEncrypted++;
+            if (receivedPackets == 0)
+            {
+                // The ringbuffer is full without holding a single complete packet
+                AZLOG_ERROR("Receive ringbuffer full, dropped connection");
+                ReportSocketMetrics();
+                Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+                return false;
+            }
         }
+
+        ReportSocketMetrics();
+        HandlePendingDisconnect();
+        m_networkInterface.GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+        return true;
     }
 
-    bool TcpConnection::UpdateRecv()
+    bool TcpConnection::ReadFromSocket()
     {
-        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
-        GetMetrics().LogPacketRecv(0, startTimeMs);
+        AZStd::lock_guard<AZStd::mutex> lock(m_ioMutex);
 
-        // Read new data off the input socket
+        // Read until the socket would block, edge triggered sockets won't report readability again until more data arrives
+        for (;;)
         {
             uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
             if (srcData == nullptr)
             {
-                AZLOG_ERROR("Receive ringbuffer full, dropped connection");
-                Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+                m_recvStalled = true;
                 return false;
             }
 
             const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
             if (receivedBytes == 0)
             {
-                // No data on the socket, can happen if we're not in select or epoll mode
-                return true;
+                // No more data on the socket
+                break;
             }
 
             const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
             if (disconnectReason != DisconnectReason::MAX)
             {
-                Disconnect(disconnectReason, TerminationEndpoint::Remote);
-                return true;
+                m_pendingDisconnectReason = disconnectReason;
+                break;
             }
             m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
-            m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
-            m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
+            m_socketRecvBytes += receivedBytes;
         }
 
-        // Process received packets
+        m_recvStalled = false;
+        return true;
+    }
+
+    void TcpConnection::FlushSendBuffer()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_ioMutex);
+
+        // The read region of the send ringbuffer is contiguous, so everything queued since the last flush goes out in as few sends as the socket allows
         for (;;)
         {
-            TcpPacketHeader header(PacketType(0), 0);
-            TcpPacketEncodingBuffer buffer;
+            const uint32_t numSendBytes = m_sendRingbuffer.GetReadBufferSize();
+            if (numSendBytes <= 0)
+            {
+                return;
+            }
 
-            if (!ReceivePacketInternal(header, buffer, startTimeMs))
+            const int32_t sentBytes = m_socket->Send(m_sendRingbuffer.GetReadBufferData(), numSendBytes);
+            if (sentBytes == 0)
             {
-                break;
+                // The socket would block, the remainder is sent once the socket reports it is writable again
+                return;
             }
 
-            NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
-            if (m_state == ConnectionState::Connecting)
+            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(sentBytes);
+            if (disconnectReason != DisconnectReason::MAX)
             {
-                const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
-                if (connectResult == ConnectResult::Rejected)
-                {
-                    Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
-                }
-                else
-                {
-                    m_state = ConnectionState::Connected;
-                }
+                m_pendingDisconnectReason = disconnectReason;
+                return;
             }
 
-            if (m_state == ConnectionState::Connected)
+            m_sendRingbuffer.AdvanceReadBuffer(sentBytes);
+            m_socketSendBytes += sentBytes;
+            if (m_socket->IsEncrypted())
             {
-                m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+                ++m_socketSendsEncrypted;
             }
         }
-
-        m_networkInterface.GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
-        return true;
     }
 
     bool TcpConnection::SendReliablePacket(const IPacket& packet)
@@ -324,28 +344,43 @@ namespace AzNetworking
         }
 
         const uint16_t headerSize = aznumeric_cast<uint16_t>(headerBuffer.GetSize());
-        uint8_t* dstData = reinterpret_cast<uint8_t*>(m_sendRingbuffer.ReserveBlockForWrite(headerSize + payloadSize));
-
-        if (dstData == nullptr)
         {
-            AZLOG_ERROR("Send ringbuffer full, dropped packet");
-            return false;
+            AZStd::lock_guard<AZStd::mutex> lock(m_ioMutex);
+            uint8_t* dstData = reinterpret_cast<uint8_t*>(m_sendRingbuffer.ReserveBlockForWrite(headerSize + payloadSize));
+
+            if (dstData == nullptr)
+            {
+                AZLOG_ERROR("Send ringbuffer full, dropped packet");
+                return false;
+            }
+
+            // Copy the header data to the ring buffer
+            {
+                memcpy(dstData, headerBuffer.GetBuffer(), headerSize);
+            }
+
+            // Write payload...
+            {
+                memcpy(dstData + headerSize, srcData, payloadSize);
+            }
+
+            m_sendRingbuffer.AdvanceWriteBuffer(headerSize + payloadSize);
         }
+        GetMetrics().LogPacketSent(headerSize + payloadSize, currentTimeMs);
+        m_networkInterface.GetMetrics().m_sendPackets++;
 
-        // Copy the header data to the ring buffer
+        if (m_networkInterface.IsBatchingSends())
         {
-            memcpy(dstData, headerBuffer.GetBuffer(), headerSize);
+            // Packets sent while the network interface updates are coalesced and flushed together at the end of the update
+            if (!m_sendFlushQueued.exchange(true))
+            {
+                m_networkInterface.QueueSendFlush(GetConnectionId());
+            }
         }
-
-        // Write payload...
+        else
         {
-            memcpy(dstData + headerSize, srcData, payloadSize);
+            UpdateSend();
         }
-
-        m_sendRingbuffer.AdvanceWriteBuffer(headerSize + payloadSize);
-        GetMetrics().LogPacketSent(headerSize + payloadSize, currentTimeMs);
-        m_networkInterface.GetMetrics().m_sendPackets++;
-        UpdateSend();
         return true;
     }
 
@@ -422,4 +457,74 @@ namespace AzNetworking
         packetBufferOut.Resize(aznumeric_cast<uint32_t>(uncompSize)); // Decompress will fail if larger than buffer size, so this cast is safe
         return true;
     }
+
+    uint32_t TcpConnection::ProcessReceivedPackets(AZ::TimeMs currentTimeMs)
+    {
+        uint32_t receivedPackets = 0;
+        for (;;)
+        {
+            TcpPacketHeader header(PacketType(0), 0);
+            TcpPacketEncodingBuffer buffer;
+            {
+                // Only hold the lock while the packet is copied out, listeners are free to send on this connection
+                AZStd::lock_guard<AZStd::mutex> lock(m_ioMutex);
+                if (!ReceivePacketInternal(header, buffer, currentTimeMs))
+                {
+                    break;
+                }
+            }
+            ++receivedPackets;
+
+            NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+            if (m_state == ConnectionState::Connecting)
+            {
+                const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
+                if (connectResult == ConnectResult::Rejected)
+                {
+                    Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
+                }
+                else
+                {
+                    m_state = ConnectionState::Connected;
+                }
+            }
+
+            if (m_state == ConnectionState::Connected)
+            {
+                m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+            }
+        }
+        return receivedPackets;
+    }
+
+    bool TcpConnection::HandlePendingDisconnect()
+    {
+        const DisconnectReason disconnectReason = m_pendingDisconnectReason.exchange(DisconnectReason::MAX);
+        if (disconnectReason == DisconnectReason::MAX)
+        {
+            return false;
+        }
+        Disconnect(disconnectReason, TerminationEndpoint::Remote);
+        return true;
+    }
+
+    void TcpConnection::ReportSocketMetrics()
+    {
+        uint64_t sendBytes = 0;
+        uint64_t recvBytes = 0;
+        uint64_t sendsEncrypted = 0;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_ioMutex);
+            AZStd::swap(sendBytes, m_socketSendBytes);
+            AZStd::swap(recvBytes, m_socketRecvBytes);
+            AZStd::swap(sendsEncrypted, m_socketSendsEncrypted);
+        }
+
+        NetworkInterfaceMetrics& metrics = m_networkInterface.GetMetrics();
+        metrics.m_sendBytes += sendBytes;
+        metrics.m_sendBytesUncompressed += sendBytes;
+        metrics.m_sendPacketsEncrypted += sendsEncrypted;
+        metrics.m_recvBytes += recvBytes;
+        metrics.m_recvBytesUncompressed += recvBytes;
+    }
 }
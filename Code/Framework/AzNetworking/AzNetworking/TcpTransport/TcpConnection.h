@@ -17,6 +17,8 @@
 #include <AzNetworking/TcpTransport/TlsSocket.h>
 #include <AzNetworking/TcpTransport/TcpRingBuffer.h>
 #include <AzNetworking/TcpTransport/TcpPacketHeader.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 namespace AzNetworking
 {
@@ -83,6 +85,27 @@ namespace AzNetworking
         //! @return boolean true if the socket is still active, false if it has been remotely terminated
         bool UpdateRecv();
 
+        //! Reads all available data off the socket into the receive ring buffer, safe to invoke from a reactor thread.
+        //! Socket errors are deferred and handled by the next UpdateRecv or UpdateSend.
+        //! @return boolean true if the socket was drained, false if the receive ring buffer filled up first
+        bool ReadFromSocket();
+
+        //! Sends as much of the send ring buffer as the socket accepts, safe to invoke from a reactor thread.
+        //! Socket errors are deferred and handled by the next UpdateRecv or UpdateSend.
+        void FlushSendBuffer();
+
+        //! Requests a disconnect from a thread other than the updating thread, the disconnect is performed by the next UpdateRecv.
+        //! @param reason reason for the disconnect
+        void QueueDisconnect(DisconnectReason reason);
+
+        //! Returns true if a socket error or disconnect request is waiting to be handled by the updating thread.
+        //! @return boolean true if a disconnect is pending
+        bool HasPendingDisconnect() const;
+
+        //! Flags the connection as queued for a receive update by its network interface.
+        //! @return boolean true if the connection was not already queued
+        bool MarkQueuedForUpdate();
+
         //! IConnection interface.
         // @{
         bool SendReliablePacket(const IPacket& packet) override;
@@ -126,6 +149,18 @@ namespace AzNetworking
         //! @return boolean true on success, false on failure
         bool DecompressPacket(const uint8_t* packetBuffer, AZStd::size_t packetSize, TcpPacketEncodingBuffer& packetBufferOut) const;
 
+        //! Decodes and dispatches all complete packets in the receive ring buffer.
+        //! @param currentTimeMs current process time in milliseconds
+        //! @return the number of packets that were received
+        uint32_t ProcessReceivedPackets(AZ::TimeMs currentTimeMs);
+
+        //! Disconnects the connection if a socket error or disconnect request is pending.
+        //! @return boolean true if the connection was disconnected
+        bool HandlePendingDisconnect();
+
+        //! Moves the byte counts gathered by socket operations into the network interface metrics, must be invoked on the updating thread.
+        void ReportSocketMetrics();
+
         //! Private copy operator, do not allow copying instances
         TcpConnection& operator=(const TcpConnection&) = delete;
 
@@ -143,6 +178,17 @@ namespace AzNetworking
 
         static const uint32_t RecvRingbufferSize = 1024 * 1024; // 1 MB recv buffer
         TcpRingBuffer<RecvRingbufferSize> m_recvRingbuffer;
+
+        // Guards the socket, the ring buffers and the socket byte counts, which reactor threads access concurrently
+        AZStd::mutex m_ioMutex;
+        uint64_t m_socketSendBytes = 0;
+        uint64_t m_socketRecvBytes = 0;
+        uint64_t m_socketSendsEncrypted = 0;
+
+        AZStd::atomic<DisconnectReason> m_pendingDisconnectReason{ DisconnectReason::MAX };
+        AZStd::atomic_bool m_queuedForUpdate{ false };
+        AZStd::atomic_bool m_recvStalled{ false };
+        AZStd::atomic_bool m_sendFlushQueued{ false };
     };
 }
 
@@ -29,4 +29,19 @@ namespace AzNetworking
     {
         return m_registeredSocketFd;
     }
+
+    inline void TcpConnection::QueueDisconnect(DisconnectReason reason)
+    {
+        m_pendingDisconnectReason = reason;
+    }
+
+    inline bool TcpConnection::HasPendingDisconnect() const
+    {
+        return m_pendingDisconnectReason != DisconnectReason::MAX;
+    }
+
+    inline bool TcpConnection::MarkQueuedForUpdate()
+    {
+        return !m_queuedForUpdate.exchange(true);
+    }
 }
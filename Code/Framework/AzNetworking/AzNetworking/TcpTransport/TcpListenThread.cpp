@@ -45,11 +45,30 @@ namespace AzNetworking
         }
 
         ++m_listenPortCount;
-        ListenPort listenPort;
-        listenPort.m_listenPort = tcpNetworkInterface.GetPort();
-        listenPort.m_tcpNetworkInterface = &tcpNetworkInterface;
-        m_listenPorts.PushBackItem(listenPort);
-        AZLOG_INFO("TcpListenThread opening port: %d for incoming traffic", aznumeric_cast<int32_t>(listenPort.m_listenPort));
+        const uint16_t port = tcpNetworkInterface.GetPort();
+
+        // Listen sockets close when they're destroyed, so ports are never erased from the deque, whose erase copies elements.
+        // Instead the entries of ports the listen thread has closed are reused.
+        bool reusedPort = false;
+        auto reuseVisitor = [&tcpNetworkInterface, port, &reusedPort](ListenPort& listenPort)
+        {
+            if (!reusedPort && (listenPort.m_tcpNetworkInterface == nullptr) && !listenPort.m_listenSocket.IsOpen())
+            {
+                listenPort.m_listenPort = port;
+                listenPort.m_tcpNetworkInterface = &tcpNetworkInterface;
+                reusedPort = true;
+            }
+        };
+        m_listenPorts.Visit(reuseVisitor);
+
+        if (!reusedPort)
+        {
+            ListenPort listenPort;
+            listenPort.m_listenPort = port;
+            listenPort.m_tcpNetworkInterface = &tcpNetworkInterface;
+            m_listenPorts.PushBackItem(listenPort);
+        }
+        AZLOG_INFO("TcpListenThread opening port: %d for incoming traffic", aznumeric_cast<int32_t>(port));
 
         // Start the listen thread if we have ports to listen on
         if (!IsRunning())
@@ -68,14 +87,14 @@ namespace AzNetworking
         {
             if (listenPort.m_tcpNetworkInterface == &tcpNetworkInterface)
             {
-                // This kills any ability to route new incoming connections to the network interface
+                // This kills any ability to route new incoming connections to the network interface.
+                // The socket is closed by the listen thread, which has to remove it from the socket manager first.
                 listenPort.m_tcpNetworkInterface = nullptr;
-                listenPort.m_listenSocket.Close();
             }
         };
         m_listenPorts.Visit(visitor);
 
-        // Stops the listen thread if there are no more listen sockets active
+        // Stops the listen thread if there are no more listen sockets active, the thread closes the unused ports as it stops
         if (IsRunning() && (m_listenPortCount == 0))
         {
             Stop();
@@ -102,11 +121,15 @@ namespace AzNetworking
 
     void TcpListenThread::OnStop()
     {
+        CloseUnusedPorts();
         AZLOG_INFO("Stopping TcpListenThread");
     }
 
     void TcpListenThread::OnUpdate(AZ::TimeMs updateRateMs)
     {
+        // Release the ports that stopped listening before opening new listen sockets, which may bind the same ports
+        CloseUnusedPorts();
+
         // Don't proceed with any processing if our network state is not valid
         if (!EnsureSocketState())
         {
@@ -125,7 +148,11 @@ namespace AzNetworking
             {
                 if (listenPort.m_listenSocket.GetSocketFd() == socketFd)
                 {
-                    HandleSocketAccept((void*)&newConnection, connectionLength, listenPort);
+                    // Accept every pending connection, socket events may be edge triggered and won't be reported again
+                    while (HandleSocketAccept((void*)&newConnection, connectionLength, listenPort))
+                    {
+                        ;
+                    }
                 }
             };
             m_listenPorts.Visit(visitor);
@@ -133,13 +160,21 @@ namespace AzNetworking
         auto writeCallback = [](SocketFd) {};
         m_tcpSocketManager.ProcessEvents(updateRateMs, readCallback, writeCallback);
 
-        auto cleanupUnused = [](AZ::ThreadSafeDeque<ListenPort>::DequeType& deque)
+        m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+    }
+
+    void TcpListenThread::CloseUnusedPorts()
+    {
+        auto visitor = [this](ListenPort& listenPort)
         {
-            AZStd::remove_if(deque.begin(), deque.end(), [](ListenPort& listenPort) { return listenPort.m_tcpNetworkInterface == nullptr; });
+            if ((listenPort.m_tcpNetworkInterface == nullptr) && listenPort.m_listenSocket.IsOpen())
+            {
+                // An io_uring poll holds on to the socket, which would stay bound to its port if it was only closed
+                m_tcpSocketManager.ClearSocket(listenPort.m_listenSocket.GetSocketFd());
+                listenPort.m_listenSocket.Close();
+            }
         };
-        m_listenPorts.VisitDeque(cleanupUnused);
-
-        m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+        m_listenPorts.Visit(visitor);
     }
 
     bool TcpListenThread::EnsureSocketState()
@@ -175,7 +210,10 @@ namespace AzNetworking
         if (newSocketFd <= SocketFd{ 0 })
         {
             const int32_t error = GetLastNetworkError();
-            AZLOG_WARN("Failed to accept incoming connection (%d:%s)", error, GetNetworkErrorDesc(error));
+            if (!ErrorIsWouldBlock(error))
+            {
+                AZLOG_WARN("Failed to accept incoming connection (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
             return false;
         }
 
@@ -61,6 +61,8 @@ namespace AzNetworking
         void OnStop() override;
         void OnUpdate(AZ::TimeMs updateRateMs) override;
 
+        //! Closes the listen sockets of the ports that stopped listening, on the listen thread that owns the socket manager.
+        void CloseUnusedPorts();
         bool EnsureSocketState();
         bool HandleSocketAccept(void* newConnection, int32_t newConnectionLength, ListenPort& listenPort);
 
@@ -21,13 +21,27 @@ namespace AzNetworking
     static const bool net_TcpUseEncryption = false;
 #endif
 
+    AZ_CVAR(uint32_t, net_TcpReactorThreadCount, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Number of reactor threads servicing the sockets of each TCP network interface, 0 services sockets during the network interface update. Requires epoll");
+
     TcpNetworkInterface::TcpNetworkInterface(const AZ::Name& name, IConnectionListener& connectionListener, TrustZone trustZone, TcpListenThread& listenThread)
         : m_name(name)
         , m_trustZone(trustZone)
         , m_connectionListener(connectionListener)
         , m_listenThread(listenThread)
     {
-        ;
+        const uint32_t reactorThreadCount = net_TcpReactorThreadCount;
+#if AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
+        for (uint32_t i = 0; i < reactorThreadCount; ++i)
+        {
+            m_reactorThreads.emplace_back(AZStd::make_unique<TcpReactorThread>(*this));
+        }
+#else
+        if (reactorThreadCount > 0)
+        {
+            AZLOG_WARN("net_TcpReactorThreadCount requires epoll, sockets will be serviced during the network interface update");
+        }
+#endif
     }
 
     TcpNetworkInterface::~TcpNetworkInterface()
@@ -91,7 +105,7 @@ namespace AzNetworking
             return InvalidConnectionId;
         }
 
-        if (!m_tcpSocketManager.AddSocket(tcpSocket->GetSocketFd()))
+        if (!BindSocket(*connection))
         {
             tcpSocket->Close();
             AZLOG_ERROR("Failed to bind new incoming connection to socket manager, failed fd: %d", static_cast<int32_t>(tcpSocket->GetSocketFd()));
@@ -109,12 +123,24 @@ namespace AzNetworking
     {
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
 
+        // Packets sent during the update are coalesced and flushed once all incoming traffic has been handled
+        m_batchingSends = true;
+
         AcceptNewConnections();
 
-        auto readCallback = [this, startTimeMs](SocketFd socketFd) { HandleConnectionRecv(socketFd, startTimeMs); };
-        auto writeCallback = [this](SocketFd socketFd) { HandleConnectionSend(socketFd); };
-        m_tcpSocketManager.ProcessEvents(AZ::Time::ZeroTimeMs, readCallback, writeCallback);
+        if (m_reactorThreads.empty())
+        {
+            auto readCallback = [this, startTimeMs](SocketFd socketFd) { HandleConnectionRecv(socketFd, startTimeMs); };
+            auto writeCallback = [this](SocketFd socketFd) { HandleConnectionSend(socketFd); };
+            m_tcpSocketManager.ProcessEvents(AZ::Time::ZeroTimeMs, readCallback, writeCallback);
+        }
+        else
+        {
+            ProcessReactorEvents(startTimeMs);
+        }
 
+        m_batchingSends = false;
+        FlushQueuedSends();
         FlushQueuedRemoves();
 
         // Update metrics
@@ -193,6 +219,89 @@ namespace AzNetworking
         m_pendingConnections.PushBackItem(pendingConnection);
     }
 
+    void TcpNetworkInterface::QueueReactorEvent(SocketFd socketFd)
+    {
+        m_reactorEvents.push(socketFd);
+    }
+
+    bool TcpNetworkInterface::HasReactorThreads() const
+    {
+        return !m_reactorThreads.empty();
+    }
+
+    bool TcpNetworkInterface::IsBatchingSends() const
+    {
+        return m_batchingSends;
+    }
+
+    void TcpNetworkInterface::QueueSendFlush(ConnectionId connectionId)
+    {
+        m_pendingSendFlushes.push_back(connectionId);
+    }
+
+    void TcpNetworkInterface::FlushQueuedSends()
+    {
+        for (const ConnectionId connectionId : m_pendingSendFlushes)
+        {
+            IConnection* connection = m_connectionSet.GetConnection(connectionId);
+            if (connection != nullptr)
+            {
+                static_cast<TcpConnection*>(connection)->UpdateSend();
+            }
+        }
+
+        m_pendingSendFlushes.resize_no_construct(0);
+    }
+
+    void TcpNetworkInterface::ProcessReactorEvents(AZ::TimeMs currentTimeMs)
+    {
+        // Only handles the events queued so far so a flood of events can't stall the update
+        size_t remainingEventCount = m_reactorEvents.size_approx();
+        SocketFd reactorEvents[64];
+        while (remainingEventCount > 0)
+        {
+            const size_t eventCount = m_reactorEvents.try_pop_batch(reactorEvents, AZStd::min(remainingEventCount, AZ_ARRAY_SIZE(reactorEvents)));
+            if (eventCount == 0)
+            {
+                break;
+            }
+
+            for (size_t i = 0; i < eventCount; ++i)
+            {
+                HandleConnectionRecv(reactorEvents[i], currentTimeMs);
+            }
+            remainingEventCount -= eventCount;
+        }
+    }
+
+    bool TcpNetworkInterface::BindSocket(TcpConnection& connection)
+    {
+        const SocketFd socketFd = connection.GetTcpSocket()->GetSocketFd();
+        if (m_reactorThreads.empty())
+        {
+            return m_tcpSocketManager.AddSocket(socketFd);
+        }
+
+        // Spread connections evenly across the reactor threads
+        m_reactorThreads[m_nextReactorThread]->RegisterConnection(socketFd, connection);
+        m_nextReactorThread = (m_nextReactorThread + 1) % aznumeric_cast<uint32_t>(m_reactorThreads.size());
+        return true;
+    }
+
+    void TcpNetworkInterface::UnbindSocket(SocketFd socketFd)
+    {
+        if (m_reactorThreads.empty())
+        {
+            m_tcpSocketManager.ClearSocket(socketFd);
+            return;
+        }
+
+        for (AZStd::unique_ptr<TcpReactorThread>& reactorThread : m_reactorThreads)
+        {
+            reactorThread->UnregisterConnection(socketFd);
+        }
+    }
+
     bool TcpNetworkInterface::HandleConnectionRecv(SocketFd socketFd, [[maybe_unused]] AZ::TimeMs currentTimeMs)
     {
         TcpConnection* connection = m_connectionSet.GetConnection(socketFd);
@@ -260,15 +369,16 @@ namespace AzNetworking
             return;
         }
 
-        if(!m_tcpSocketManager.AddSocket(tcpSocket.GetSocketFd()))
+        AZStd::unique_ptr<TcpConnection> connection = AZStd::make_unique<TcpConnection>(connectionId, remoteAddress, *this, tcpSocket);
+        AZ_Assert(connection->GetConnectionRole() == ConnectionRole::Acceptor, "Invalid role for connection");
+        const SocketFd socketFd = connection->GetTcpSocket()->GetSocketFd();
+        if (!BindSocket(*connection))
         {
-            tcpSocket.Close();
-            AZLOG_ERROR("Failed to bind new incoming connection to socket manager, failed fd: %d", static_cast<int32_t>(tcpSocket.GetSocketFd()));
+            connection->GetTcpSocket()->Close();
+            AZLOG_ERROR("Failed to bind new incoming connection to socket manager, failed fd: %d", static_cast<int32_t>(socketFd));
             return;
         }
-        AZLOG(NET_TcpTraffic, "Adding new socket %d", static_cast<int32_t>(tcpSocket.GetSocketFd()));
-        AZStd::unique_ptr<TcpConnection> connection = AZStd::make_unique<TcpConnection>(connectionId, remoteAddress, *this, tcpSocket);
-        AZ_Assert(connection->GetConnectionRole() == ConnectionRole::Acceptor, "Invalid role for connection");
+        AZLOG(NET_TcpTraffic, "Adding new socket %d", static_cast<int32_t>(socketFd));
         GetConnectionListener().OnConnect(connection.get());
         m_connectionSet.AddConnection(AZStd::move(connection));
     }
@@ -287,7 +397,7 @@ namespace AzNetworking
             }
 
             AZLOG_INFO("Removing socket %d due to %s", static_cast<int32_t>(socketFd), AZStd::string(ToString(reason)).c_str());
-            m_tcpSocketManager.ClearSocket(socketFd);
+            UnbindSocket(socketFd);
             m_connectionSet.DeleteConnection(socketFd);
         }
 
@@ -11,9 +11,11 @@
 #include <AzNetworking/TcpTransport/TcpPacketHeader.h>
 #include <AzNetworking/TcpTransport/TcpConnectionSet.h>
 #include <AzNetworking/TcpTransport/TcpListenThread.h>
+#include <AzNetworking/TcpTransport/TcpReactorThread.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
+#include <AzCore/std/parallel/containers/mpmc_queue.h>
 
 namespace AzNetworking
 {
@@ -59,6 +61,12 @@ namespace AzNetworking
     //! 
     //! AzNetworking uses the [OpenSSL](https://www.openssl.org/) library to implement TLS encryption. If enabled,
     //! the O3DE network layer handles the OpenSSL handshake under the hood using provided certificates.
+    //!
+    //! ## Reactor threads
+    //!
+    //! By default sockets are serviced by Update. On platforms using epoll, net_TcpReactorThreadCount moves socket reads and
+    //! writes onto background reactor threads, with connections spread across them. Update then only decodes and dispatches
+    //! packets for connections that received data, which scales to thousands of connections per network interface.
     class TcpNetworkInterface final
         : public INetworkInterface
     {
@@ -109,8 +117,40 @@ namespace AzNetworking
         //! @param pendingConnection info on the new incoming connection
         void QueueNewConnection(const PendingConnection& pendingConnection);
 
+        //! Queues a connection serviced by a reactor thread for a receive update, safe to invoke from any thread.
+        //! @param socketFd socket descriptor of the connection with new incoming data or a pending disconnect
+        void QueueReactorEvent(SocketFd socketFd);
+
+        //! Returns true if sockets are serviced by reactor threads rather than by Update.
+        //! @return boolean true if this network interface uses reactor threads
+        bool HasReactorThreads() const;
+
     private:
 
+        //! Returns true if packets should be queued and sent at the end of the current update.
+        //! @return boolean true if sends are being batched
+        bool IsBatchingSends() const;
+
+        //! Queues a connection to flush its send ring buffer at the end of the current update.
+        //! @param connectionId connection id of the connection to flush
+        void QueueSendFlush(ConnectionId connectionId);
+
+        //! Flushes the send ring buffers of all connections that sent packets during the current update.
+        void FlushQueuedSends();
+
+        //! Performs connection receive updates for all connections queued by reactor threads.
+        //! @param currentTimeMs current time in milliseconds for metrics management
+        void ProcessReactorEvents(AZ::TimeMs currentTimeMs);
+
+        //! Starts servicing the socket of a connection, either on the updating thread or on a reactor thread.
+        //! @param connection the connection to service
+        //! @return boolean true on success
+        bool BindSocket(TcpConnection& connection);
+
+        //! Stops servicing the socket of a connection.
+        //! @param socketFd socket descriptor of the connection
+        void UnbindSocket(SocketFd socketFd);
+
         //! Performs connection receive updates for a single socket.
         //! @param socketFd      socket descriptor with new incoming data
         //! @param currentTimeMs current time in milliseconds for metrics management
@@ -154,8 +194,15 @@ namespace AzNetworking
         TcpSocketManager m_tcpSocketManager;
         AZ::ThreadSafeDeque<PendingConnection> m_pendingConnections;
         AZStd::vector<PendingRemove> m_pendingRemoves;
+        AZStd::vector<ConnectionId> m_pendingSendFlushes;
+        AZStd::mpmc_queue<SocketFd> m_reactorEvents; // Pushed by every reactor thread for each socket with incoming data
         TcpListenThread& m_listenThread;
+        bool m_batchingSends = false;
+
+        // Declared after the connection set so reactors are stopped before the connections they reference are destroyed
+        AZStd::vector<AZStd::unique_ptr<TcpReactorThread>> m_reactorThreads;
+        uint32_t m_nextReactorThread = 0;
 
-        friend class TcpConnection; // For access to private RequestDisconnect() method
+        friend class TcpConnection; // For access to private RequestDisconnect() and send batching methods
     };
 }
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/TcpTransport/TcpReactorThread.h>
+#include <AzNetworking/TcpTransport/TcpConnection.h>
+#include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    // The reactor blocks inside the socket manager rather than sleeping between updates, this bounds how long new sockets wait to be added
+    static constexpr AZ::TimeMs ReactorMaxBlockMs{ 10 };
+
+    TcpReactorThread::TcpReactorThread(TcpNetworkInterface& tcpNetworkInterface)
+        : TimedThread("AzNetworking::TcpReactorThread", AZ::Time::ZeroTimeMs)
+        , m_tcpNetworkInterface(tcpNetworkInterface)
+    {
+        ;
+    }
+
+    TcpReactorThread::~TcpReactorThread()
+    {
+        Stop();
+        Join();
+    }
+
+    void TcpReactorThread::RegisterConnection(SocketFd socketFd, TcpConnection& connection)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_connections[socketFd] = &connection;
+            m_pendingOperations.push_back(PendingOperation{ socketFd, true });
+        }
+
+        if (!IsRunning())
+        {
+            Start();
+        }
+    }
+
+    void TcpReactorThread::UnregisterConnection(SocketFd socketFd)
+    {
+        // Socket events are processed while holding the lock, so the connection can't be in use once it is erased
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_connections.erase(socketFd) > 0)
+        {
+            m_pendingOperations.push_back(PendingOperation{ socketFd, false });
+        }
+    }
+
+    uint32_t TcpReactorThread::GetConnectionCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return aznumeric_cast<uint32_t>(m_connections.size());
+    }
+
+    void TcpReactorThread::OnStart()
+    {
+        ;
+    }
+
+    void TcpReactorThread::OnStop()
+    {
+        ;
+    }
+
+    void TcpReactorThread::OnUpdate([[maybe_unused]] AZ::TimeMs updateRateMs)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            for (const PendingOperation& operation : m_pendingOperations)
+            {
+                if (!operation.m_add)
+                {
+                    m_tcpSocketManager.ClearSocket(operation.m_socketFd);
+                    continue;
+                }
+
+                if (!m_tcpSocketManager.AddSocket(operation.m_socketFd))
+                {
+                    auto iter = m_connections.find(operation.m_socketFd);
+                    if (iter != m_connections.end())
+                    {
+                        AZLOG_ERROR("Failed to bind connection to reactor socket manager, failed fd: %d", static_cast<int32_t>(operation.m_socketFd));
+                        iter->second->QueueDisconnect(DisconnectReason::TransportError);
+                        if (iter->second->MarkQueuedForUpdate())
+                        {
+                            m_tcpNetworkInterface.QueueReactorEvent(operation.m_socketFd);
+                        }
+                    }
+                }
+            }
+            m_pendingOperations.clear();
+        }
+
+        auto readCallback = [this](SocketFd socketFd)
+        {
+            VisitConnection(socketFd, [](TcpConnection& connection)
+            {
+                connection.ReadFromSocket();
+                return true;
+            });
+        };
+        auto writeCallback = [this](SocketFd socketFd)
+        {
+            VisitConnection(socketFd, [](TcpConnection& connection)
+            {
+                // Only wake the updating thread if the flush failed
+                connection.FlushSendBuffer();
+                return connection.HasPendingDisconnect();
+            });
+        };
+        m_tcpSocketManager.ProcessEvents(ReactorMaxBlockMs, readCallback, writeCallback);
+    }
+
+    template <typename FUNCTOR>
+    void TcpReactorThread::VisitConnection(SocketFd socketFd, const FUNCTOR& functor)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        auto iter = m_connections.find(socketFd);
+        if (iter == m_connections.end())
+        {
+            return;
+        }
+
+        TcpConnection& connection = *iter->second;
+        if (functor(connection) && connection.MarkQueuedForUpdate())
+        {
+            m_tcpNetworkInterface.QueueReactorEvent(socketFd);
+        }
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/TcpTransport/TcpSocketManager.h>
+#include <AzNetworking/Utilities/TimedThread.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AzNetworking
+{
+    class TcpConnection;
+    class TcpNetworkInterface;
+
+    //! @class TcpReactorThread
+    //! @brief A class for servicing the sockets of a set of TCP connections on a background thread.
+    //!
+    //! The reactor waits on its sockets using the TcpSocketManager, reads incoming data into the receive ring buffers of its
+    //! connections and flushes their send ring buffers as the sockets become writable. Received packets are still decoded and
+    //! dispatched by TcpNetworkInterface::Update, so connection listeners are only ever invoked from the updating thread.
+    class TcpReactorThread final
+        : public TimedThread
+    {
+    public:
+
+        //! Constructor.
+        //! @param tcpNetworkInterface the TcpNetworkInterface that owns the connections serviced by this reactor
+        TcpReactorThread(TcpNetworkInterface& tcpNetworkInterface);
+        ~TcpReactorThread() override;
+
+        //! Starts servicing the socket of the provided connection.
+        //! @param socketFd   the socket file descriptor of the connection
+        //! @param connection the connection to service, must remain valid until UnregisterConnection is invoked
+        void RegisterConnection(SocketFd socketFd, TcpConnection& connection);
+
+        //! Stops servicing the provided socket, once this returns the reactor no longer accesses the connection.
+        //! @param socketFd the socket file descriptor of the connection
+        void UnregisterConnection(SocketFd socketFd);
+
+        //! Returns the number of connections serviced by this reactor.
+        //! @return the number of connections serviced by this reactor
+        uint32_t GetConnectionCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(TcpReactorThread);
+
+        struct PendingOperation
+        {
+            SocketFd m_socketFd;
+            bool m_add;
+        };
+
+        void OnStart() override;
+        void OnStop() override;
+        void OnUpdate(AZ::TimeMs updateRateMs) override;
+
+        //! Invokes the provided functor for the connection bound to a socket, while holding the connection lock.
+        template <typename FUNCTOR>
+        void VisitConnection(SocketFd socketFd, const FUNCTOR& functor);
+
+        TcpNetworkInterface& m_tcpNetworkInterface;
+        TcpSocketManager m_tcpSocketManager;
+
+        // Guards the connections and pending socket operations, which are modified by the updating thread
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<SocketFd, TcpConnection*> m_connections;
+        AZStd::vector<PendingOperation> m_pendingOperations;
+    };
+}
@@ -16,12 +16,25 @@
 
 #if AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
 #   include <sys/epoll.h>
+#   include <AzCore/std/containers/unordered_map.h>
+#   include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ::IO
+{
+    class IoUring;
+}
 #endif
 
 namespace AzNetworking
 {
     //! @class TcpSocketManager
     //! @brief internal helper implementation that manages basic details related to handling large numbers of TCP sockets efficiently.
+    //!
+    //! Events may be edge triggered, in which case a callback is only invoked when a socket changes state. Read callbacks must drain
+    //! the socket until it would block, and write callbacks must send until the socket would block or there's nothing left to send.
+    //!
+    //! With epoll, sockets may instead be waited on through io_uring multishot polls (net_TcpUseIoUring), which arm each socket once
+    //! and batch registration changes and the wait into a single system call.
     class TcpSocketManager
     {
     public:
@@ -29,6 +42,7 @@ namespace AzNetworking
         using SocketEventCallback = AZStd::function<void(SocketFd)>;
 
         TcpSocketManager();
+        ~TcpSocketManager();
 
         //! Adds the provided socket to the internal socket management mechanism.
         //! @param socketFd the socket file descriptor to add
@@ -36,6 +50,7 @@ namespace AzNetworking
         bool AddSocket(SocketFd socketFd);
 
         //! Removes the requested socket from the internal socket management mechanism.
+        //! Sockets have to be removed before they are closed, as io_uring polls keep closed sockets alive.
         //! @param socketFd the socket file descriptor to remove
         //! @return boolean true on success, false otherwise
         bool ClearSocket(SocketFd socketFd);
@@ -59,7 +74,24 @@ namespace AzNetworking
         AZ_DISABLE_COPY_MOVE(TcpSocketManager);
 
 #if AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
+        //! io_uring implementations of the public functions, used when m_ioUring is valid
+        //! @{
+        bool AddSocketIoUring(SocketFd socketFd);
+        bool ClearSocketIoUring(SocketFd socketFd);
+        void ProcessEventsIoUring(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback);
+        //! @}
+
+        //! Queues a multishot poll for the socket, tagged with the generation of its registration.
+        //! @param socketFd   the socket file descriptor to poll
+        //! @param generation the generation of the registration, used to ignore completions of earlier registrations of the same fd
+        //! @return boolean true on success, false otherwise
+        bool QueuePoll(SocketFd socketFd, uint32_t generation);
+
         SocketFd m_epollFd = InvalidSocketFd;
+        AZStd::unique_ptr<AZ::IO::IoUring> m_ioUring;
+        AZStd::unordered_map<SocketFd, uint32_t> m_ioUringGenerations;
+        uint32_t m_nextIoUringGeneration = 0;
+        bool m_ioUringMultishot = true; //!< Cleared if the kernel predates multishot polls
 #elif AZ_TRAIT_USE_SOCKET_SERVER_SELECT
         fd_set   m_sourceFdSet;
         fd_set   m_readerFdSet;
@@ -7,18 +7,57 @@
  */
 
 #include <AzNetworking/TcpTransport/TcpSocketManager.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 
 #if AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
 
+// Epoll is only used on Linux, which provides the io_uring wrapper
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <poll.h>
+
 namespace AzNetworking
 {
+    AZ_CVAR(bool, net_TcpUseIoUring, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Wait on TCP sockets with io_uring multishot polls instead of epoll, falls back to epoll if the kernel doesn't support io_uring");
+
     static constexpr uint32_t MaxEpollEvents = 256;
 
+    // Completions that don't belong to a socket poll, these never collide with poll user data as their fd bits are invalid
+    static constexpr uint64_t IoUringTimeoutUserData = ~uint64_t{ 0 };
+    static constexpr uint64_t IoUringRemoveUserData = ~uint64_t{ 0 } - 1;
+
+    static uint64_t MakeIoUringUserData(SocketFd socketFd, uint32_t generation)
+    {
+        return (static_cast<uint64_t>(generation) << 32) | static_cast<uint32_t>(socketFd);
+    }
+
+    // Returns a submission entry, handing the queued entries to the kernel first if the submission queue is full
+    static io_uring_sqe* GetIoUringSubmissionEntry(AZ::IO::IoUring& ioUring)
+    {
+        io_uring_sqe* entry = ioUring.GetSubmissionEntry();
+        if (entry == nullptr && ioUring.Submit() >= 0)
+        {
+            entry = ioUring.GetSubmissionEntry();
+        }
+        return entry;
+    }
+
     TcpSocketManager::TcpSocketManager()
-        // Don't propagate fd's to child processes, not that we should ever be spawning children
-        : m_epollFd(static_cast<SocketFd>(epoll_create1(EPOLL_CLOEXEC)))
     {
+        if (net_TcpUseIoUring)
+        {
+            m_ioUring = AZStd::make_unique<AZ::IO::IoUring>();
+            if (m_ioUring->Initialize(MaxEpollEvents))
+            {
+                return;
+            }
+            AZLOG_WARN("io_uring is unavailable, falling back to epoll for TCP sockets");
+            m_ioUring.reset();
+        }
+
+        // Don't propagate fd's to child processes, not that we should ever be spawning children
+        m_epollFd = static_cast<SocketFd>(epoll_create1(EPOLL_CLOEXEC));
         if (m_epollFd == InvalidSocketFd)
         {
             const int32_t error = GetLastNetworkError();
@@ -28,6 +67,16 @@ namespace AzNetworking
         }
     }
 
+    TcpSocketManager::~TcpSocketManager()
+    {
+        // Closing the ring cancels all polls, which releases the sockets they hold on to
+        m_ioUring.reset();
+        if (m_epollFd != InvalidSocketFd)
+        {
+            CloseSocket(m_epollFd);
+        }
+    }
+
     bool TcpSocketManager::AddSocket(SocketFd socketFd)
     {
         if (socketFd < SocketFd{ 0 })
@@ -35,8 +84,14 @@ namespace AzNetworking
             return false;
         }
 
+        if (m_ioUring)
+        {
+            return AddSocketIoUring(socketFd);
+        }
+
+        // Sockets are registered edge triggered for both directions once, so neither direction needs to be re-armed as it's serviced
         struct epoll_event fdEvents;
-        fdEvents.events = EPOLLIN | EPOLLOUT | EPOLLET;
+        fdEvents.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
         fdEvents.data.fd = static_cast<int32_t>(socketFd);
 
         if (epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_ADD, static_cast<int32_t>(socketFd), &fdEvents) < 0)
@@ -46,24 +101,39 @@ namespace AzNetworking
             return false;
         }
 
-        AddSocketHelper(socketFd);
+        // The epoll set tracks its own sockets, m_socketFds is only required by the polling implementations
         return true;
     }
 
     bool TcpSocketManager::ClearSocket(SocketFd socketFd)
     {
-        ClearSocketHelper(socketFd);
+        if (m_ioUring)
+        {
+            return ClearSocketIoUring(socketFd);
+        }
+
+        // Closed sockets are removed from the epoll set automatically, so failures here are expected and not reported
+        epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_DEL, static_cast<int32_t>(socketFd), nullptr);
         return true;
     }
 
     void TcpSocketManager::ProcessEvents(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback)
     {
+        if (m_ioUring)
+        {
+            ProcessEventsIoUring(maxBlockMs, readCallback, writeCallback);
+            return;
+        }
+
         struct epoll_event socketEvents[MaxEpollEvents];
-        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, -1);
+        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, AZStd::max(static_cast<int32_t>(maxBlockMs), 0));
         if (numEpollEvents < 0)
         {
             const int32_t error = GetLastNetworkError();
-            AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
+            if (error != EINTR)
+            {
+                AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
         }
 
         if (numEpollEvents > 0)
@@ -71,7 +141,9 @@ namespace AzNetworking
             for (int32_t event = 0; event < numEpollEvents; ++event)
             {
                 const SocketFd socketFd = static_cast<SocketFd>(socketEvents[event].data.fd);
-                if (socketEvents[event].events & EPOLLIN)
+
+                // Errors and hangups are surfaced through the read callback, where the failed receive disconnects the socket
+                if (socketEvents[event].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
                 {
                     readCallback(socketFd);
                 }
@@ -83,6 +155,162 @@ namespace AzNetworking
             }
         }
     }
+
+    bool TcpSocketManager::AddSocketIoUring(SocketFd socketFd)
+    {
+        // A new generation tells completions of this registration apart from those of a closed socket that used the same fd
+        const uint32_t generation = ++m_nextIoUringGeneration;
+        if (!m_ioUringGenerations.emplace(socketFd, generation).second)
+        {
+            ClearSocketIoUring(socketFd);
+            m_ioUringGenerations.emplace(socketFd, generation);
+        }
+
+        if (!QueuePoll(socketFd, generation))
+        {
+            m_ioUringGenerations.erase(socketFd);
+            AZLOG_ERROR("Failed to queue an io_uring poll to bind socket %d", static_cast<int32_t>(socketFd));
+            return false;
+        }
+        return true;
+    }
+
+    bool TcpSocketManager::ClearSocketIoUring(SocketFd socketFd)
+    {
+        auto iter = m_ioUringGenerations.find(socketFd);
+        if (iter == m_ioUringGenerations.end())
+        {
+            return true;
+        }
+        const uint64_t pollUserData = MakeIoUringUserData(socketFd, iter->second);
+        m_ioUringGenerations.erase(iter);
+
+        // Unlike epoll, a pending poll keeps a closed socket alive, so it always has to be removed explicitly
+        io_uring_sqe* entry = GetIoUringSubmissionEntry(*m_ioUring);
+        if (entry == nullptr)
+        {
+            AZLOG_ERROR("Failed to queue the removal of the io_uring poll for socket %d", static_cast<int32_t>(socketFd));
+            return false;
+        }
+        entry->opcode = IORING_OP_POLL_REMOVE;
+        entry->fd = -1;
+        entry->addr = pollUserData;
+        entry->user_data = IoUringRemoveUserData;
+
+        // Submit the removal right away, so the poll has released the socket by the time the caller closes it.
+        // Otherwise a listen socket would stay bound to its port until the next call to ProcessEvents.
+        const int result = m_ioUring->Submit();
+        if (result < 0 && result != -EINTR)
+        {
+            AZLOG_ERROR("Failed to submit the removal of the io_uring poll for socket %d (%d:%s)", static_cast<int32_t>(socketFd), -result, GetNetworkErrorDesc(-result));
+            return false;
+        }
+        return true;
+    }
+
+    bool TcpSocketManager::QueuePoll(SocketFd socketFd, uint32_t generation)
+    {
+        io_uring_sqe* entry = GetIoUringSubmissionEntry(*m_ioUring);
+        if (entry == nullptr)
+        {
+            return false;
+        }
+
+        // Multishot polls post a completion every time the socket changes state and stay armed, which matches the edge
+        // triggered epoll registration. Kernels without multishot support complete the poll once, after which it's re-armed.
+        entry->opcode = IORING_OP_POLL_ADD;
+        entry->fd = static_cast<int32_t>(socketFd);
+        entry->poll32_events = POLLIN | POLLOUT | POLLRDHUP;
+        entry->len = m_ioUringMultishot ? IORING_POLL_ADD_MULTI : 0;
+        entry->user_data = MakeIoUringUserData(socketFd, generation);
+        return true;
+    }
+
+    void TcpSocketManager::ProcessEventsIoUring(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback)
+    {
+        // Only block if nothing is ready yet. The timeout completes with the first completion posted after it or when the timer
+        // expires, so a timeout rarely outlives its wait, and never for longer than maxBlockMs.
+        __kernel_timespec timeout{};
+        const int32_t blockMs = AZStd::max(static_cast<int32_t>(maxBlockMs), 0);
+        const bool wait = blockMs > 0 && m_ioUring->GetCompletionCount() == 0;
+        io_uring_sqe* timeoutEntry = wait ? GetIoUringSubmissionEntry(*m_ioUring) : nullptr;
+        if (timeoutEntry != nullptr)
+        {
+            timeout.tv_sec = blockMs / 1000;
+            timeout.tv_nsec = static_cast<long long>(blockMs % 1000) * 1000000;
+            timeoutEntry->opcode = IORING_OP_TIMEOUT;
+            timeoutEntry->fd = -1;
+            timeoutEntry->addr = reinterpret_cast<uint64_t>(&timeout);
+            timeoutEntry->len = 1;
+            timeoutEntry->off = 1;
+            timeoutEntry->user_data = IoUringTimeoutUserData;
+        }
+
+        // Registration changes, the timeout and the wait are all handled by a single system call
+        const int result = timeoutEntry != nullptr ? m_ioUring->SubmitAndWait(1) : m_ioUring->Submit();
+        if (result < 0 && result != -EINTR && result != -ETIME)
+        {
+            AZLOG_ERROR("io_uring_enter returned an error (%d:%s)", -result, GetNetworkErrorDesc(-result));
+        }
+
+        io_uring_cqe completion;
+        for (uint32_t count = 0; count < MaxEpollEvents && m_ioUring->PopCompletion(completion); ++count)
+        {
+            if (completion.user_data == IoUringTimeoutUserData || completion.user_data == IoUringRemoveUserData)
+            {
+                continue;
+            }
+
+            const SocketFd socketFd = static_cast<SocketFd>(static_cast<int32_t>(completion.user_data & 0xFFFFFFFF));
+            const uint32_t generation = static_cast<uint32_t>(completion.user_data >> 32);
+            auto iter = m_ioUringGenerations.find(socketFd);
+            if (iter == m_ioUringGenerations.end() || iter->second != generation)
+            {
+                // Completion for a socket that has since been cleared, for instance the cancellation of its poll
+                continue;
+            }
+
+            if (completion.res == -EINVAL && m_ioUringMultishot)
+            {
+                // Kernels before 5.13 reject multishot polls, switch to single shot polls that are re-armed after every completion
+                m_ioUringMultishot = false;
+                if (!QueuePoll(socketFd, generation))
+                {
+                    AZLOG_ERROR("Failed to re-arm the io_uring poll for socket %d", static_cast<int32_t>(socketFd));
+                }
+                continue;
+            }
+
+            if (completion.res < 0)
+            {
+                // The poll itself failed, surface it through the read callback where the failed receive disconnects the socket
+                readCallback(socketFd);
+                continue;
+            }
+
+            // Errors and hangups are surfaced through the read callback, where the failed receive disconnects the socket
+            const uint32_t events = static_cast<uint32_t>(completion.res);
+            if (events & (POLLIN | POLLRDHUP | POLLHUP | POLLERR))
+            {
+                readCallback(socketFd);
+            }
+
+            if (events & POLLOUT)
+            {
+                writeCallback(socketFd);
+            }
+
+            // Re-arm polls the kernel stopped, provided the callbacks didn't clear the socket
+            if ((completion.flags & IORING_CQE_F_MORE) == 0)
+            {
+                iter = m_ioUringGenerations.find(socketFd);
+                if (iter != m_ioUringGenerations.end() && iter->second == generation && !QueuePoll(socketFd, generation))
+                {
+                    AZLOG_ERROR("Failed to re-arm the io_uring poll for socket %d", static_cast<int32_t>(socketFd));
+                }
+            }
+        }
+    }
 }
 
 #endif
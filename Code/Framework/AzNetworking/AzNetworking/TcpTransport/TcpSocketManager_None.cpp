@@ -18,6 +18,8 @@ namespace AzNetworking
         ;
     }
 
+    TcpSocketManager::~TcpSocketManager() = default;
+
     bool TcpSocketManager::AddSocket(SocketFd socketFd)
     {
         AddSocketHelper(socketFd);
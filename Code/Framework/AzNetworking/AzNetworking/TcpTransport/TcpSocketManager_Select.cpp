@@ -20,6 +20,8 @@ namespace AzNetworking
         FD_ZERO(&m_writerFdSet);
     }
 
+    TcpSocketManager::~TcpSocketManager() = default;
+
     bool TcpSocketManager::AddSocket(SocketFd socketFd)
     {
         if (socketFd <= SocketFd{ 0 })
@@ -84,16 +84,23 @@ namespace AzNetworking
         }
 
 #if AZ_TRAIT_USE_OPENSSL
-        uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
+        // Read the encrypted datagram straight into the send batch when sends are batched, this saves a copy per datagram
+        uint8_t encryptedSendBuffer[MaxUdpTransmissionUnit];
+        uint8_t* sendBuffer = GetSendBatchBuffer();
+        if (sendBuffer == nullptr)
+        {
+            sendBuffer = encryptedSendBuffer;
+        }
+
         // Write out the packet we were requested to send
         SSL_write(dtlsEndpoint.m_sslSocket, data, size);
-        const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encrpytedSendBuffer, sizeof(encrpytedSendBuffer));
+        const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, sendBuffer, MaxUdpTransmissionUnit);
 
         // Track encryption metrics
         m_sentBytesEncryptionInflation += aznumeric_cast<uint32_t>(sentBytesEnc - aznumeric_cast<int32_t>(size));
         m_sentPacketsEncrypted++;
 
-        return UdpSocket::SendInternal(address, encrpytedSendBuffer, sentBytesEnc, encrypt, dtlsEndpoint);
+        return UdpSocket::SendInternal(address, sendBuffer, sentBytesEnc, encrypt, dtlsEndpoint);
 #else
         return 0;
 #endif
@@ -17,6 +17,9 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/MathUtils.h>
 
 namespace AzNetworking
@@ -39,6 +42,10 @@ namespace AzNetworking
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(bool, net_FragmentsAlwaysReliable, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether fragmented packets should be reliable by default or use their source packet's reliability type");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
+    AZ_CVAR(uint32_t, net_UdpDecodeShardCount, 4, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of jobs received packets are decoded on, packets are decoded on the main thread if less than 2");
+    AZ_CVAR(uint32_t, net_UdpParallelDecodeMinPackets, 64, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The minimum number of packets received in an update before they are decoded in parallel");
+
+    static constexpr uint32_t MaxDecodeShards = 16;
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
     {
@@ -65,8 +72,8 @@ namespace AzNetworking
         , m_heartbeatThread(heartbeatThread)
         , m_timeoutMs(net_UdpDefaultTimeoutMs)
     {
-        const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
-        m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressor);
+        m_compressorName = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
+        m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(m_compressorName);
         m_heartbeatThread.RegisterNetworkInterface(this);
     }
 
@@ -164,6 +171,7 @@ namespace AzNetworking
         // Signal the connection attempt
         CorePackets::InitiateConnectionPacket connectPacket = CorePackets::InitiateConnectionPacket();
         connectPacket.SetHandshakeBuffer(dtlsData);
+        connectPacket.SetCompressorType(m_compressor ? m_compressor->GetType() : CompressorType{ 0 });
         connection->SendReliablePacket(connectPacket);
 
         m_connectionListener.OnConnect(connection.get());
@@ -188,6 +196,13 @@ namespace AzNetworking
             return;
         }
 
+        // Acks, resends and any replies sent while processing are submitted to the socket together at the end of the update
+        m_socket->BeginSendBatch();
+
+        // Decryption and decompression don't depend on the dispatch of earlier packets, so decode ahead on the job workers when there
+        // is enough work. Dispatch below stays serial and in receive order
+        const bool decodedInParallel = DecodePacketsInParallel(*packets);
+
         for (uint32_t i = 0; i < packets->size(); ++i)
         {
             const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
@@ -222,48 +237,39 @@ namespace AzNetworking
                 continue;
             }
 
+            UdpPacketHeader header;
+            const uint8_t* decodedPacketData = nullptr;
             int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
-
-            if (decodedPacketSize == 0)
+            uint32_t packetFlagsSize = 0;
+            DecodeResult decodeResult = DecodeResult::Discard;
+            if (decodedInParallel && m_decodedPackets[i].m_connection == connection)
             {
-                // OpenSSL may have consumed packets during handshake negotiation
-                continue;
+                const DecodedPacket& decodedPacket = m_decodedPackets[i];
+                header = decodedPacket.m_header;
+                decodedPacketData = (decodedPacket.m_data != nullptr)
+                    ? decodedPacket.m_data
+                    : m_decodeShards[decodedPacket.m_shardIndex]->m_decodedData.data() + decodedPacket.m_dataOffset;
+                decodedPacketSize = decodedPacket.m_size;
+                packetFlagsSize = decodedPacket.m_flagsSize;
+                decodeResult = decodedPacket.m_result;
             }
-            else if (decodedPacketSize < 0)
+            else
             {
-                // Late unencrypted handshake packets or just random garbage can show up, discard and continue
-                continue;
+                // The connection was accepted or changed state after the packets were decoded ahead, decode it now
+                decodeResult = DecodePacket(*connection, packet, m_compressor.get(), m_decryptBuffer, m_decompressBuffer,
+                    header, decodedPacketData, decodedPacketSize, packetFlagsSize);
             }
 
-            connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
-
-            // Decode the packet flag bitset first since it's always uncompressed
-            UdpPacketHeader header;
+            if (decodeResult == DecodeResult::Discard)
             {
-                NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
-                if (!header.SerializePacketFlags(flagSerializer))
-                {
-                    continue;
-                }
-                // Adjust decoded tracking to represent the payload now that we've grabbed the flags
-                decodedPacketData = flagSerializer.GetUnreadData();
-                decodedPacketSize = flagSerializer.GetUnreadSize();
-                GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
+                continue;
             }
 
-            if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
+            connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
+            GetMetrics().m_recvBytesUncompressed += packetFlagsSize;
+            if (decodeResult == DecodeResult::Failed)
             {
-                // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
-                {
-                    AZLOG_WARN("Failed to decompress packet!");
-                    continue;
-                }
-                decodedPacketData = m_decompressBuffer.GetBuffer();
-                decodedPacketSize = static_cast<int32_t>(m_decompressBuffer.GetSize());
+                continue;
             }
             GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
 
@@ -346,6 +352,8 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        m_socket->EndSendBatch();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
@@ -441,9 +449,9 @@ namespace AzNetworking
         m_packetTimeoutQueue.RegisterItem(ConstructTimeoutId(connectionId, packetId, reliability), packetTimeoutMs);
     }
 
-    bool UdpNetworkInterface::DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
+    bool UdpNetworkInterface::DecompressPacket(ICompressor* compressor, const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
     {
-        if (!m_compressor) // should probably have some compression handshake than relying on existence of compressor
+        if (!compressor) // should probably have some compression handshake than relying on existence of compressor
         {
             AZLOG_ERROR("Decompress called without a compressor.");
             return false;
@@ -453,7 +461,7 @@ namespace AzNetworking
         AZStd::size_t bytesConsumed = 0;
 
         packetBufferOut.Resize(packetBufferOut.GetCapacity());
-        const CompressorError compErr = m_compressor->Decompress(packetBuffer, packetSize, packetBufferOut.GetBuffer(), packetBufferOut.GetCapacity(), bytesConsumed, uncompSize);
+        const CompressorError compErr = compressor->Decompress(packetBuffer, packetSize, packetBufferOut.GetBuffer(), packetBufferOut.GetCapacity(), bytesConsumed, uncompSize);
         packetBufferOut.Resize(aznumeric_cast<uint32_t>(uncompSize)); // Decompress will fail if larger than buffer size, so this cast is safe
 
         if (compErr != CompressorError::Ok)
@@ -470,6 +478,158 @@ namespace AzNetworking
         return true;
     }
 
+    UdpNetworkInterface::DecodeResult UdpNetworkInterface::DecodePacket
+    (
+        UdpConnection& connection,
+        const UdpReaderThread::ReceivedPacket& packet,
+        ICompressor* compressor,
+        UdpPacketEncodingBuffer& decryptBuffer,
+        UdpPacketEncodingBuffer& decompressBuffer,
+        UdpPacketHeader& outHeader,
+        const uint8_t*& outData,
+        int32_t& outSize,
+        uint32_t& outFlagsSize
+    ) const
+    {
+        outFlagsSize = 0;
+
+        int32_t decodedPacketSize = 0;
+        decryptBuffer.Resize(decryptBuffer.GetCapacity());
+        const uint8_t* decodedPacketData = connection.GetDtlsEndpoint().DecodePacket(connection, packet.m_buffer, packet.m_receivedBytes, decryptBuffer.GetBuffer(), decodedPacketSize);
+        decryptBuffer.Resize(decodedPacketSize);
+
+        if (decodedPacketSize == 0)
+        {
+            // OpenSSL may have consumed packets during handshake negotiation
+            return DecodeResult::Discard;
+        }
+        else if (decodedPacketSize < 0)
+        {
+            // Late unencrypted handshake packets or just random garbage can show up, discard and continue
+            return DecodeResult::Discard;
+        }
+
+        // Decode the packet flag bitset first since it's always uncompressed
+        {
+            NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
+            if (!outHeader.SerializePacketFlags(flagSerializer))
+            {
+                return DecodeResult::Failed;
+            }
+            // Adjust decoded tracking to represent the payload now that we've grabbed the flags
+            decodedPacketData = flagSerializer.GetUnreadData();
+            decodedPacketSize = flagSerializer.GetUnreadSize();
+            outFlagsSize = flagSerializer.GetReadSize();
+        }
+
+        if (compressor && outHeader.IsPacketFlagSet(PacketFlag::Compressed))
+        {
+            // Only the payload is compressed
+            if (!DecompressPacket(compressor, decodedPacketData, decodedPacketSize, decompressBuffer))
+            {
+                AZLOG_WARN("Failed to decompress packet!");
+                return DecodeResult::Failed;
+            }
+            decodedPacketData = decompressBuffer.GetBuffer();
+            decodedPacketSize = static_cast<int32_t>(decompressBuffer.GetSize());
+        }
+
+        outData = decodedPacketData;
+        outSize = decodedPacketSize;
+        return DecodeResult::Success;
+    }
+
+    bool UdpNetworkInterface::DecodePacketsInParallel(const UdpReaderThread::ReceivedPackets& packets)
+    {
+        const uint32_t shardCount = AZStd::min<uint32_t>(net_UdpDecodeShardCount, MaxDecodeShards);
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if ((shardCount < 2) || (packets.size() < net_UdpParallelDecodeMinPackets) || (jobContext == nullptr))
+        {
+            return false;
+        }
+
+        while (m_decodeShards.size() < shardCount)
+        {
+            AZStd::unique_ptr<DecodeShard> shard = AZStd::make_unique<DecodeShard>();
+            if (m_compressor)
+            {
+                // Compressors may keep state between calls, so every shard gets its own
+                shard->m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(m_compressorName);
+            }
+            m_decodeShards.push_back(AZStd::move(shard));
+        }
+
+        // Assign the packets to shards on the main thread, since the connection set isn't thread safe. Only established
+        // connections are decoded ahead, packets for new or handshaking connections are decoded while dispatching
+        m_decodedPackets.clear();
+        m_decodedPackets.resize(packets.size());
+        for (uint32_t i = 0; i < packets.size(); ++i)
+        {
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
+            if (packet.m_receivedBytes <= 0)
+            {
+                continue;
+            }
+
+            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+            if ((connection == nullptr) || (connection->GetConnectionState() != ConnectionState::Connected)
+                || connection->GetDtlsEndpoint().IsConnecting())
+            {
+                continue;
+            }
+
+            m_decodedPackets[i].m_connection = connection;
+            m_decodedPackets[i].m_shardIndex = aznumeric_cast<uint32_t>(connection->GetConnectionId()) % shardCount;
+        }
+
+        AZ::JobCompletion jobCompletion(jobContext);
+        for (uint32_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([this, shardIndex, &packets]() { DecodeShardPackets(shardIndex, packets); }, true, jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+        return true;
+    }
+
+    void UdpNetworkInterface::DecodeShardPackets(uint32_t shardIndex, const UdpReaderThread::ReceivedPackets& packets)
+    {
+        DecodeShard& shard = *m_decodeShards[shardIndex];
+        shard.m_decodedData.clear();
+
+        for (uint32_t i = 0; i < packets.size(); ++i)
+        {
+            DecodedPacket& decodedPacket = m_decodedPackets[i];
+            if ((decodedPacket.m_connection == nullptr) || (decodedPacket.m_shardIndex != shardIndex))
+            {
+                continue;
+            }
+
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
+            const uint8_t* decodedPacketData = nullptr;
+            decodedPacket.m_result = DecodePacket(*decodedPacket.m_connection, packet, shard.m_compressor.get(), shard.m_decryptBuffer,
+                shard.m_decompressBuffer, decodedPacket.m_header, decodedPacketData, decodedPacket.m_size, decodedPacket.m_flagsSize);
+            if (decodedPacket.m_result != DecodeResult::Success)
+            {
+                continue;
+            }
+
+            if ((decodedPacketData >= packet.m_buffer) && (decodedPacketData < packet.m_buffer + packet.m_receivedBytes))
+            {
+                // Unencrypted and uncompressed payloads are read straight from the receive buffer
+                decodedPacket.m_data = decodedPacketData;
+            }
+            else
+            {
+                // The shard buffers are reused for the next packet, keep a copy until the packet is dispatched
+                decodedPacket.m_data = nullptr;
+                decodedPacket.m_dataOffset = aznumeric_cast<uint32_t>(shard.m_decodedData.size());
+                shard.m_decodedData.insert(shard.m_decodedData.end(), decodedPacketData, decodedPacketData + decodedPacket.m_size);
+            }
+        }
+    }
+
     PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence)
     {
         AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packet.GetPacketType()), connection.GetRemoteAddress().GetString().c_str());
@@ -555,12 +715,16 @@ namespace AzNetworking
             const uint8_t* chunkStart = packetData;
             const SequenceId fragmentedSequence = connection.m_fragmentQueue.GetNextFragmentedSequenceId();
             uint32_t bytesRemaining = packetSize;
-            ChunkBuffer chunkBuffer;
+            // The fragment is reused for every chunk and its chunk buffer written directly, rather than copying each chunk into the packet
+            CorePackets::FragmentedPacket fragmentedPacket;
+            fragmentedPacket.SetUnfragmentedSequence(ToSequenceId(localPacketId));
+            fragmentedPacket.SetFragmentSequence(fragmentedSequence);
+            fragmentedPacket.SetChunkCount(aznumeric_cast<uint8_t>(numChunks));
             for (uint32_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
             {
                 const uint32_t nextChunkSize = AZStd::min(bytesRemaining, chunkSize);
-                chunkBuffer.CopyValues(chunkStart, nextChunkSize);
-                CorePackets::FragmentedPacket fragmentedPacket(ToSequenceId(localPacketId), fragmentedSequence, aznumeric_cast<uint8_t>(chunkIndex), aznumeric_cast<uint8_t>(numChunks), chunkBuffer);
+                fragmentedPacket.SetChunkIndex(aznumeric_cast<uint8_t>(chunkIndex));
+                fragmentedPacket.ModifyChunkBuffer().CopyValues(chunkStart, nextChunkSize);
                 const SequenceId chunkReliableId = (net_FragmentsAlwaysReliable || reliabilityType == ReliabilityType::Reliable)
                     ? connection.m_reliableQueue.GetNextSequenceId()
                     : InvalidSequenceId;
@@ -677,6 +841,15 @@ namespace AzNetworking
                 }
             }
 
+            // Both endpoints must use the same compressor, including any compression dictionary, to decode each other's packets
+            const CompressorType compressorType = m_compressor ? m_compressor->GetType() : CompressorType{ 0 };
+            if (packet.GetCompressorType() != compressorType)
+            {
+                AZLOG_WARN("Rejecting connection from %s, it uses compressor type %u but this endpoint uses %u",
+                    connectPacket.m_address.GetString().c_str(), aznumeric_cast<uint32_t>(packet.GetCompressorType()), aznumeric_cast<uint32_t>(compressorType));
+                return;
+            }
+
             // Retrieve the connection type, and run application layer connection filtering (state checks, CIDR address filtering, etc..)
             const ConnectResult connectResult = m_connectionListener.ValidateConnect(connectPacket.m_address, header, networkSerializer);
 
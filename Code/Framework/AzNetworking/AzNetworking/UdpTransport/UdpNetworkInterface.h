@@ -16,6 +16,7 @@
 #include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
+#include <AzCore/Console/IConsoleTypes.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
 #include <AzCore/std/containers/vector.h>
 
@@ -132,11 +133,46 @@ namespace AzNetworking
         void RegisterWithTimeoutQueue(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability, const ConnectionMetrics& metrics);
 
         //! Decompresses an incoming packet data buffer.
+        //! @param compressor      the compressor to decompress the data with
         //! @param packetBuffer    the compressed packet buffer to decode
         //! @param packetSize      the size of the compressed packet buffer
         //! @param packetBufferOut the decoded data
         //! @return boolean true on success, false on failure
-        bool DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
+        bool DecompressPacket(ICompressor* compressor, const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
+
+        enum class DecodeResult : uint8_t
+        {
+            Discard,    //!< The packet contained no data for the connection, such as handshake data consumed by the encryption layer
+            Failed,     //!< The packet was received for the connection but could not be decoded
+            Success
+        };
+
+        //! Decrypts and decompresses a received packet and reads its packet flags.
+        //! Only touches the state of the connection and the provided buffers, so packets of different connections can be decoded concurrently.
+        //! @param connection       the connection the packet was received for
+        //! @param packet           the received packet
+        //! @param compressor       the compressor to decompress the packet with
+        //! @param decryptBuffer    scratch buffer for the decrypted data
+        //! @param decompressBuffer scratch buffer for the decompressed data
+        //! @param outHeader        the header to read the packet flags into
+        //! @param outData          on success, the decoded payload following the packet flags
+        //! @param outSize          on success, the size of the decoded payload
+        //! @param outFlagsSize     the number of bytes used by the packet flags, 0 if they could not be read
+        //! @return the result of decoding the packet
+        DecodeResult DecodePacket(UdpConnection& connection, const UdpReaderThread::ReceivedPacket& packet, ICompressor* compressor,
+            UdpPacketEncodingBuffer& decryptBuffer, UdpPacketEncodingBuffer& decompressBuffer, UdpPacketHeader& outHeader,
+            const uint8_t*& outData, int32_t& outSize, uint32_t& outFlagsSize) const;
+
+        //! Decodes the packets of established connections on worker threads before they are dispatched.
+        //! Connections are sharded so that the packets of a connection are always decoded in order by the same worker.
+        //! @param packets the packets received since the last update
+        //! @return boolean true if the packets were decoded, false if the packets should be decoded while dispatching
+        bool DecodePacketsInParallel(const UdpReaderThread::ReceivedPackets& packets);
+
+        //! Decodes the packets that were assigned to a single shard by DecodePacketsInParallel.
+        //! @param shardIndex index of the shard to decode the packets for
+        //! @param packets    the packets received since the last update
+        void DecodeShardPackets(uint32_t shardIndex, const UdpReaderThread::ReceivedPackets& packets);
 
         //! Sends a packet to the remote connection.
         //! @param connection         the UdpConnection instance to send the packet on
@@ -184,6 +220,7 @@ namespace AzNetworking
         TimeoutQueue m_packetTimeoutQueue;
         AZStd::unique_ptr<UdpSocket> m_socket;
         AZStd::unique_ptr<ICompressor> m_compressor;
+        AZ::CVarFixedString m_compressorName;
         UdpReaderThread& m_readerThread;
         UdpHeartbeatThread& m_heartbeatThread;
         AZStd::atomic<AZ::TimeMs> m_lastSystemTickUpdate;
@@ -199,6 +236,31 @@ namespace AzNetworking
         UdpPacketEncodingBuffer m_decryptBuffer;
         UdpPacketEncodingBuffer m_decompressBuffer;
 
+        //! A packet that was decoded by DecodePacketsInParallel.
+        struct DecodedPacket
+        {
+            UdpConnection* m_connection = nullptr;  //!< The connection the packet was decoded for, nullptr if it was not decoded
+            UdpPacketHeader m_header;
+            const uint8_t* m_data = nullptr;        //!< The payload if it is stored in the received packet, otherwise it's in the shard data
+            uint32_t m_dataOffset = 0;
+            int32_t m_size = 0;
+            uint32_t m_flagsSize = 0;
+            uint32_t m_shardIndex = 0;
+            DecodeResult m_result = DecodeResult::Discard;
+        };
+
+        //! The state owned by a single decoding worker.
+        struct DecodeShard
+        {
+            AZStd::unique_ptr<ICompressor> m_compressor;
+            UdpPacketEncodingBuffer m_decryptBuffer;
+            UdpPacketEncodingBuffer m_decompressBuffer;
+            AZStd::vector<uint8_t> m_decodedData;
+        };
+
+        AZStd::vector<DecodedPacket> m_decodedPackets;
+        AZStd::vector<AZStd::unique_ptr<DecodeShard>> m_decodeShards;
+
         friend class UdpReliableQueue;
         friend class UdpConnection; // For access to private RequestDisconnect() method
     };
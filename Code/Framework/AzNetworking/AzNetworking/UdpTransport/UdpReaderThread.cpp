@@ -176,7 +176,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,18 +184,48 @@ namespace AzNetworking
                     break;
                 }
 
+                // Drain as many datagrams as fit in the remaining buffer space with a single call, each one is given a full MTU
+                const uint32_t freeBufferSlots = aznumeric_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit;
+                const uint32_t freePacketSlots = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t batchSize = AZStd::min(AZStd::min(freeBufferSlots, freePacketSlots), UdpSocket::MaxReceiveBatchSize);
+                if (batchSize == 0)
+                {
+                    break;
+                }
+
+                UdpSocket::ReceiveBatchEntry entries[UdpSocket::MaxReceiveBatchSize];
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                for (uint32_t i = 0; i < batchSize; ++i)
+                {
+                    entries[i].m_data = dstData + i * MaxUdpTransmissionUnit;
+                    entries[i].m_size = MaxUdpTransmissionUnit;
+                }
+                receiveBuffer.Resize(bufferHead + batchSize * MaxUdpTransmissionUnit);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                const uint32_t receivedCount = socket->ReceiveBatch(entries, batchSize);
+
+                // Pack the received datagrams tightly so the remaining buffer can be used by the next batch
+                uint32_t packedSize = 0;
+                for (uint32_t i = 0; i < receivedCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    const UdpSocket::ReceiveBatchEntry& entry = entries[i];
+                    if (entry.m_size == 0)
+                    {
+                        continue;
+                    }
+                    uint8_t* packetData = dstData + packedSize;
+                    if (packetData != entry.m_data)
+                    {
+                        memmove(packetData, entry.m_data, entry.m_size);
+                    }
+                    receivedPackets.push_back(ReceivedPacket(entry.m_address, packetData, aznumeric_cast<int32_t>(entry.m_size)));
+                    packedSize += entry.m_size;
                 }
-                else
+                receiveBuffer.Resize(bufferHead + packedSize);
+
+                if (receivedCount < batchSize)
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket has been drained
                     break;
                 }
             }
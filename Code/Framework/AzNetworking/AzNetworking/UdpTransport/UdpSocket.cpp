@@ -23,6 +23,30 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchSyscalls, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, UDP sockets send and receive multiple datagrams per system call on platforms that support it");
+
+    // The socket that sends are currently being queued for on this thread, see UdpSocket::BeginSendBatch
+    static thread_local const UdpSocket* s_sendBatchSocket = nullptr;
+
+    // Returns 0 if the error of a failed receive can be ignored, otherwise SocketOpResultError
+    static int32_t HandleReceiveError()
+    {
+        const int32_t error = GetLastNetworkError();
+
+        if (ErrorIsWouldBlock(error)) // Filter would block messages
+        {
+            return 0;
+        }
+
+        bool ignoreForciblyClosedError = false;
+        if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+        {
+            return ignoreForciblyClosedError ? 0 : SocketOpResultError;
+        }
+
+        AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        return 0;
+    }
 
     UdpSocket::~UdpSocket()
     {
@@ -96,6 +120,7 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        m_queuedSends.clear();
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -191,42 +216,195 @@ namespace AzNetworking
 
         if (receivedBytes < 0)
         {
-            const int32_t error = GetLastNetworkError();
+            return HandleReceiveError();
+        }
 
-            if (ErrorIsWouldBlock(error)) // Filter would block messages
-            {
-                return 0;
-            }
+        if (receivedBytes == 0)
+        {
+            return 0;
+        }
 
-            bool ignoreForciblyClosedError = false;
-            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+        m_recvPackets++;
+        m_recvBytes += receivedBytes;
+        return receivedBytes;
+    }
+
+    uint32_t UdpSocket::ReceiveBatch(ReceiveBatchEntry* entries, uint32_t entryCount) const
+    {
+        AZ_Assert(entries != nullptr || entryCount == 0, "NULL entries passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+        uint32_t receivedCount = 0;
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        if (net_UdpBatchSyscalls)
+        {
+            mmsghdr messages[MaxReceiveBatchSize];
+            iovec buffers[MaxReceiveBatchSize];
+            sockaddr_in addresses[MaxReceiveBatchSize];
+            while (receivedCount < entryCount)
             {
-                if (ignoreForciblyClosedError)
+                const uint32_t batchSize = AZStd::min(entryCount - receivedCount, MaxReceiveBatchSize);
+                memset(messages, 0, sizeof(mmsghdr) * batchSize);
+                for (uint32_t i = 0; i < batchSize; ++i)
                 {
-                    return 0;
+                    ReceiveBatchEntry& entry = entries[receivedCount + i];
+                    buffers[i].iov_base = entry.m_data;
+                    buffers[i].iov_len = entry.m_size;
+                    messages[i].msg_hdr.msg_name = &addresses[i];
+                    messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                    messages[i].msg_hdr.msg_iov = &buffers[i];
+                    messages[i].msg_hdr.msg_iovlen = 1;
                 }
-                else
+
+                const int32_t messageCount = recvmmsg(static_cast<int32_t>(m_socketFd), messages, batchSize, MSG_DONTWAIT, nullptr);
+                if (messageCount <= 0)
+                {
+                    if (messageCount < 0)
+                    {
+                        HandleReceiveError();
+                    }
+                    break;
+                }
+
+                for (int32_t i = 0; i < messageCount; ++i)
+                {
+                    ReceiveBatchEntry& entry = entries[receivedCount + i];
+                    entry.m_address = IpAddress(ByteOrder::Network, addresses[i].sin_addr.s_addr, addresses[i].sin_port);
+                    entry.m_size = messages[i].msg_len;
+                    m_recvPackets++;
+                    m_recvBytes += entry.m_size;
+                }
+                receivedCount += aznumeric_cast<uint32_t>(messageCount);
+
+                if (aznumeric_cast<uint32_t>(messageCount) < batchSize)
                 {
-                    return SocketOpResultError;
+                    // No more data is waiting on the socket
+                    break;
                 }
             }
+            return receivedCount;
+        }
+#endif
+        for (; receivedCount < entryCount; ++receivedCount)
+        {
+            ReceiveBatchEntry& entry = entries[receivedCount];
+            const int32_t receivedBytes = Receive(entry.m_address, entry.m_data, entry.m_size);
+            if (receivedBytes <= 0)
+            {
+                break;
+            }
+            entry.m_size = aznumeric_cast<uint32_t>(receivedBytes);
+        }
+        return receivedCount;
+    }
 
-            AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+    void UdpSocket::BeginSendBatch() const
+    {
+        AZ_Assert(s_sendBatchSocket == nullptr, "BeginSendBatch called while a send batch is already active on this thread");
+        s_sendBatchSocket = this;
+    }
+
+    void UdpSocket::EndSendBatch() const
+    {
+        AZ_Assert(s_sendBatchSocket == this, "EndSendBatch called without a matching BeginSendBatch");
+        FlushSendBatch();
+        s_sendBatchSocket = nullptr;
+    }
+
+    void UdpSocket::FlushSendBatch() const
+    {
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        const uint32_t queuedCount = aznumeric_cast<uint32_t>(m_queuedSends.size());
+        if (queuedCount == 0 || !IsOpen())
+        {
+            m_queuedSends.clear();
+            return;
         }
 
-        if (receivedBytes <= 0)
+        mmsghdr messages[MaxSendBatchSize];
+        iovec buffers[MaxSendBatchSize];
+        sockaddr_in addresses[MaxSendBatchSize];
+        memset(messages, 0, sizeof(mmsghdr) * queuedCount);
+        memset(addresses, 0, sizeof(sockaddr_in) * queuedCount);
+        for (uint32_t i = 0; i < queuedCount; ++i)
         {
-            return 0;
+            const QueuedSend& queuedSend = m_queuedSends[i];
+            addresses[i].sin_family = AF_INET;
+            addresses[i].sin_addr.s_addr = queuedSend.m_address.GetAddress(ByteOrder::Network);
+            addresses[i].sin_port = queuedSend.m_address.GetPort(ByteOrder::Network);
+            buffers[i].iov_base = m_sendBatchBuffer.data() + queuedSend.m_offset;
+            buffers[i].iov_len = queuedSend.m_size;
+            messages[i].msg_hdr.msg_name = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
         }
 
-        m_recvPackets++;
-        m_recvBytes += receivedBytes;
-        return receivedBytes;
+        uint32_t sentCount = 0;
+        while (sentCount < queuedCount)
+        {
+            const int32_t result = sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentCount, queuedCount - sentCount, 0);
+            if (result < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (ErrorIsWouldBlock(error))
+                {
+                    // The send buffer is full, drop the remaining datagrams the same way an individual send would
+                    break;
+                }
+
+                // Skip the datagram that failed and continue with the rest of the batch
+                AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                ++sentCount;
+                continue;
+            }
+            sentCount += aznumeric_cast<uint32_t>(result);
+        }
+#endif
+        m_queuedSends.clear();
+    }
+
+    uint8_t* UdpSocket::GetSendBatchBuffer() const
+    {
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        if (s_sendBatchSocket == this && net_UdpBatchSyscalls)
+        {
+            if (m_queuedSends.full())
+            {
+                FlushSendBatch();
+            }
+            if (m_sendBatchBuffer.empty())
+            {
+                m_sendBatchBuffer.resize_no_construct(MaxSendBatchSize * MaxUdpTransmissionUnit);
+            }
+            return m_sendBatchBuffer.data() + m_queuedSends.size() * MaxUdpTransmissionUnit;
+        }
+#endif
+        return nullptr;
     }
 
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        uint8_t* batchBuffer = (size <= MaxUdpTransmissionUnit) ? GetSendBatchBuffer() : nullptr;
+        if (batchBuffer != nullptr)
+        {
+            // Queue the datagram in the send batch, it's submitted together with the others once the batch is full or ends
+            // Payloads that were already written to the batch entry, like encrypted datagrams, don't need to be copied
+            if (batchBuffer != data)
+            {
+                memcpy(batchBuffer, data, size);
+            }
+            const uint32_t offset = aznumeric_cast<uint32_t>(batchBuffer - m_sendBatchBuffer.data());
+            m_queuedSends.push_back(QueuedSend{ address, offset, size });
+            return aznumeric_cast<int32_t>(size);
+        }
+#endif
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
@@ -14,6 +14,7 @@
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -93,6 +94,32 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Describes the buffer for a single payload received by ReceiveBatch.
+        struct ReceiveBatchEntry
+        {
+            IpAddress m_address;
+            uint8_t* m_data = nullptr;
+            uint32_t m_size = 0;            //!< The size of the buffer, on return the number of bytes received
+        };
+
+        //! Maximum number of payloads read from the operating system with a single system call.
+        static constexpr uint32_t MaxReceiveBatchSize = 64;
+        //! Maximum number of payloads that are queued for sending before a send batch is submitted.
+        static constexpr uint32_t MaxSendBatchSize = 64;
+
+        //! Receives multiple payloads from the UDP socket using as few system calls as the platform supports.
+        //! @param entries    buffers to write the received payloads to, the address and size are updated for every filled entry
+        //! @param entryCount number of entries, receiving stops early once no more data is available
+        //! @return number of entries that were filled
+        uint32_t ReceiveBatch(ReceiveBatchEntry* entries, uint32_t entryCount) const;
+
+        //! Queues the sends made from the calling thread until EndSendBatch is called, so they can be passed to the operating
+        //! system together. Sends from other threads, such as heartbeats, are not affected. Batches can not be nested.
+        void BeginSendBatch() const;
+
+        //! Submits all payloads queued since BeginSendBatch and stops queueing sends.
+        void EndSendBatch() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -128,9 +155,26 @@ namespace AzNetworking
 
         virtual int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const;
 
+        //! Returns the memory the next datagram queued in the active send batch is stored in, so it can be written in place.
+        //! A payload of up to MaxUdpTransmissionUnit bytes written to this buffer and passed to SendInternal is not copied again.
+        //! @return pointer to the next send batch entry, or nullptr if sends from the calling thread are not being batched
+        uint8_t* GetSendBatchBuffer() const;
+
     private:
 
+        //! Submits the queued sends of the current send batch.
+        void FlushSendBatch() const;
+
+        struct QueuedSend
+        {
+            IpAddress m_address;
+            uint32_t m_offset = 0;
+            uint32_t m_size = 0;
+        };
+
         SocketFd m_socketFd = InvalidSocketFd;
+        mutable AZStd::vector<uint8_t> m_sendBatchBuffer;
+        mutable AZStd::fixed_vector<QueuedSend, MaxSendBatchSize> m_queuedSends;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+
+namespace AzNetworking
+{
+    //! @class QuantizedQuaternion
+    //! @brief Serializes a rotation using the smallest three encoding.
+    //!
+    //! The largest component of a unit quaternion can be recomputed from the other three, and the other three always lie in
+    //! the range [-1/sqrt(2), 1/sqrt(2)]. Only the index of the largest component and the three smallest components,
+    //! quantized to BITS_PER_COMPONENT bits each, are serialized. The bits are packed into the minimum number of bytes,
+    //! so 10 bits per component serializes a rotation in 4 bytes rather than the 16 bytes of four floats.
+    template <AZStd::size_t BITS_PER_COMPONENT>
+    class QuantizedQuaternion
+    {
+    public:
+
+        static_assert(BITS_PER_COMPONENT >= 2 && BITS_PER_COMPONENT <= 20, "Bits per component must be in the range [2, 20]");
+
+        using SelfType = QuantizedQuaternion<BITS_PER_COMPONENT>;
+        using ValueType = AZ::Quaternion;
+
+        static constexpr AZStd::size_t TotalBits = 2 + 3 * BITS_PER_COMPONENT;
+        static constexpr AZStd::size_t TotalBytes = (TotalBits + 7) / 8;
+
+        //! Default constructor, initializes to the identity rotation.
+        QuantizedQuaternion();
+
+        //! Construct from a rotation.
+        //! @param value rotation to construct from, it does not need to be normalized
+        explicit QuantizedQuaternion(const ValueType& value);
+
+        //! Assignment from a rotation.
+        //! @param rhs rotation to assign from
+        SelfType& operator =(const ValueType& rhs);
+
+        //! Const underlying type operator.
+        //! @return the quantized rotation
+        operator ValueType() const;
+
+        //! Equality operator.
+        //! @param rhs instance to compare against
+        //! @return boolean true if both quantize to the same value
+        bool operator ==(const SelfType& rhs) const;
+
+        //! Inequality operator.
+        //! @param rhs instance to compare against
+        //! @return boolean true if the quantized values differ
+        bool operator !=(const SelfType& rhs) const;
+
+        //! Retrieves the packed integral value used during serialization.
+        //! @return the packed index of the largest component and the three quantized smallest components
+        uint64_t GetQuantizedIntegralValue() const;
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+
+    private:
+
+        //! Helper method to quantize and store a rotation.
+        //! @param value the input rotation to quantize
+        void Set(const ValueType& value);
+
+        //! Takes the packed integral value and stores the rotation it represents.
+        void DecodeQuantizedValue();
+
+        ValueType m_quantizedValue = ValueType::CreateIdentity();
+        uint64_t  m_serializeValue = 0;
+    };
+}
+
+#include <AzNetworking/Utilities/QuantizedQuaternion.inl>
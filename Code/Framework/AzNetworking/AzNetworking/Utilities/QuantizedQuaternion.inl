@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/math.h>
+
+namespace AzNetworking
+{
+    namespace QuantizedQuaternionInternal
+    {
+        // The smallest three components of a unit quaternion are within [-1/sqrt(2), 1/sqrt(2)]
+        static constexpr float ComponentRange = 0.7071067811865475f;
+    }
+
+    template <AZStd::size_t BITS_PER_COMPONENT>
+    inline QuantizedQuaternion<BITS_PER_COMPONENT>::QuantizedQuaternion()
+    {
+        Set(ValueType::CreateIdentity());
+    }
+
+    template <AZStd::size_t BITS_PER_COMPONENT>
+    inline QuantizedQuaternion<BITS_PER_COMPONENT>::QuantizedQuaternion(const ValueType& value)
+    {
+        Set(value);
+    }
+
+    template <AZStd::size_t BITS_PER_COMPONENT>
+    inline auto QuantizedQuaternion<BITS_PER_COMPONENT>::operator =(const ValueType& rhs) -> SelfType&
+    {
+        Set(rhs);
+        return *this;
+    }
+
+    template <AZStd::size_t BITS_PER_COMPONENT>
+    inline QuantizedQuaternion<BITS_PER_COMPONENT>::operator ValueType() const
+    {
+        return m_quantizedValue;
+    }
+
+    template <AZStd::size_t BITS_PER_COMPONENT>
+    inline bool QuantizedQuaternion<BITS_PER_COMPONENT>::operator ==(const SelfType& rhs) const
+    {
+        return m_serializeValue == rhs.m_serializeValue;
+    }
+
+    template <AZStd::size_t BITS_PER_COMPONENT>
+    inline bool QuantizedQuaternion<BITS_PER_COMPONENT>::operator !=(const SelfType& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    template <AZStd::size_t BITS_PER_COMPONENT>
+    inline uint64_t QuantizedQuaternion<BITS_PER_COMPONENT>::GetQuantizedIntegralValue() const
+    {
+        return m_serializeValue;
+    }
+
+    template <AZStd::size_t BITS_PER_COMPONENT>
+    inline bool QuantizedQuaternion<BITS_PER_COMPONENT>::Serialize(ISerializer& serializer)
+    {
+        uint64_t serializedValue = 0;
+        for (AZStd::size_t i = 0; i < TotalBytes; ++i)
+        {
+            uint8_t byteValue = static_cast<uint8_t>(m_serializeValue >> (i * 8));
+            serializer.Serialize(byteValue, GenerateIndexLabel<TotalBytes>(i).c_str());
+            serializedValue |= static_cast<uint64_t>(byteValue) << (i * 8);
+        }
+
+        AZ_Assert((serializer.GetSerializerMode() == SerializerMode::WriteToObject) || (m_serializeValue == serializedValue),
+            "If we're reading, the temporary serialized value must match the instance value");
+        m_serializeValue = serializedValue & ((uint64_t{ 1 } << TotalBits) - 1);
+        DecodeQuantizedValue();
+        return serializer.IsValid();
+    }
+
+    template <AZStd::size_t BITS_PER_COMPONENT>
+    inline void QuantizedQuaternion<BITS_PER_COMPONENT>::Set(const ValueType& value)
+    {
+        constexpr uint64_t MaxComponentValue = (uint64_t{ 1 } << BITS_PER_COMPONENT) - 1;
+        const ValueType normalized = value.GetNormalized();
+
+        // Find the largest component, it is the one that is dropped and recomputed on decode
+        uint32_t largestIndex = 0;
+        for (uint32_t i = 1; i < 4; ++i)
+        {
+            if (AZStd::abs(normalized.GetElement(i)) > AZStd::abs(normalized.GetElement(largestIndex)))
+            {
+                largestIndex = i;
+            }
+        }
+
+        // q and -q represent the same rotation, flip the sign so the dropped component is always positive
+        const float sign = (normalized.GetElement(largestIndex) < 0.0f) ? -1.0f : 1.0f;
+
+        uint64_t packedValue = largestIndex;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            if (i == largestIndex)
+            {
+                continue;
+            }
+
+            const float component = AZStd::clamp(normalized.GetElement(i) * sign,
+                -QuantizedQuaternionInternal::ComponentRange, QuantizedQuaternionInternal::ComponentRange);
+            const float normalizedComponent = (component + QuantizedQuaternionInternal::ComponentRange) / (2.0f * QuantizedQuaternionInternal::ComponentRange);
+            const uint64_t quantizedComponent = static_cast<uint64_t>(normalizedComponent * static_cast<float>(MaxComponentValue) + 0.5f);
+            packedValue = (packedValue << BITS_PER_COMPONENT) | AZStd::min(quantizedComponent, MaxComponentValue);
+        }
+
+        m_serializeValue = packedValue;
+        DecodeQuantizedValue();
+    }
+
+    template <AZStd::size_t BITS_PER_COMPONENT>
+    inline void QuantizedQuaternion<BITS_PER_COMPONENT>::DecodeQuantizedValue()
+    {
+        constexpr uint64_t MaxComponentValue = (uint64_t{ 1 } << BITS_PER_COMPONENT) - 1;
+        const uint32_t largestIndex = static_cast<uint32_t>(m_serializeValue >> (3 * BITS_PER_COMPONENT)) & 0x3;
+
+        float components[4];
+        float sumSquares = 0.0f;
+        uint64_t packedValue = m_serializeValue;
+        for (int32_t i = 3; i >= 0; --i)
+        {
+            if (static_cast<uint32_t>(i) == largestIndex)
+            {
+                continue;
+            }
+
+            const float normalizedComponent = static_cast<float>(packedValue & MaxComponentValue) / static_cast<float>(MaxComponentValue);
+            components[i] = normalizedComponent * (2.0f * QuantizedQuaternionInternal::ComponentRange) - QuantizedQuaternionInternal::ComponentRange;
+            sumSquares += components[i] * components[i];
+            packedValue >>= BITS_PER_COMPONENT;
+        }
+        components[largestIndex] = AZStd::sqrt(AZStd::max(0.0f, 1.0f - sumSquares));
+
+        m_quantizedValue = ValueType(components[0], components[1], components[2], components[3]).GetNormalized();
+    }
+}
@@ -75,6 +75,8 @@ set(FILES
     TcpTransport/TcpPacketHeader.cpp
     TcpTransport/TcpPacketHeader.h
     TcpTransport/TcpPacketHeader.inl
+    TcpTransport/TcpReactorThread.cpp
+    TcpTransport/TcpReactorThread.h
     TcpTransport/TcpRingBuffer.h
     TcpTransport/TcpRingBuffer.inl
     TcpTransport/TcpRingBufferImpl.cpp
@@ -136,6 +138,8 @@ set(FILES
     Utilities/NetworkCommon.h
     Utilities/NetworkCommon.inl
     Utilities/NetworkIncludes.h
+    Utilities/QuantizedQuaternion.h
+    Utilities/QuantizedQuaternion.inl
     Utilities/QuantizedValues.h
     Utilities/QuantizedValues.inl
     Utilities/TimedThread.cpp
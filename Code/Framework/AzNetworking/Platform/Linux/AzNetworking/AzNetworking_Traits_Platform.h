@@ -10,8 +10,9 @@
 
 #define AZ_TRAIT_OS_USE_WINSOCK 0
 #define AZ_TRAIT_OS_USE_MACH 0
-#define AZ_TRAIT_USE_SOCKET_SERVER_EPOLL 0
-#define AZ_TRAIT_USE_SOCKET_SERVER_SELECT 1
+#define AZ_TRAIT_USE_SOCKET_SERVER_EPOLL 1
+#define AZ_TRAIT_USE_SOCKET_SERVER_SELECT 0
 #define AZ_TRAIT_USE_OPENSSL 1
 #define AZ_TRAIT_NEEDS_HTONLL 1
+#define AZ_TRAIT_USE_SOCKET_MMSG 1
 
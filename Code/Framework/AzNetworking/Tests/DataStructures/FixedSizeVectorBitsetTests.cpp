@@ -11,4 +11,25 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitset, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<128> lhs;
+        lhs.Resize(12);
+        lhs.SetBit(3, true);
+        lhs.SetBit(11, true);
+        AzNetworking::FixedSizeVectorBitset<128> rhs;
+        rhs.Resize(12);
+        rhs.SetBit(3, true);
+        EXPECT_TRUE(lhs != rhs);
+
+        rhs.SetBit(11, true);
+        EXPECT_TRUE(lhs == rhs);
+
+        // A bit past the valid size doesn't make the bitsets different
+        rhs.SetBit(12, true);
+        EXPECT_TRUE(lhs == rhs);
+
+        rhs.Resize(13);
+        EXPECT_TRUE(lhs != rhs);
+    }
 }
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzNetworking/DataStructures/TimeoutQueue.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/Mocks/MockITime.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/queue.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! The previous TimeoutQueue implementation, a map of items and a priority queue of timeout times, kept for comparison.
+    class PriorityQueueTimeoutQueue
+    {
+    public:
+        TimeoutId RegisterItem(uint64_t userData, AZ::TimeMs timeoutMs)
+        {
+            const TimeoutId timeoutId = m_nextTimeoutId++;
+            const TimeoutQueue::TimeoutItem item(userData, timeoutMs);
+            m_timeoutItemMap[timeoutId] = item;
+            m_timeoutItemQueue.push(QueueItem{ timeoutId, item.m_nextTimeoutTimeMs });
+            return timeoutId;
+        }
+
+        void RemoveItem(TimeoutId timeoutId)
+        {
+            m_timeoutItemMap.erase(timeoutId);
+        }
+
+        void UpdateTimeouts(const TimeoutQueue::TimeoutHandler& timeoutHandler)
+        {
+            const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+            while (!m_timeoutItemQueue.empty() && (m_timeoutItemQueue.top().m_timeoutTimeMs < currentTimeMs))
+            {
+                const QueueItem queueItem = m_timeoutItemQueue.top();
+                m_timeoutItemQueue.pop();
+
+                auto iter = m_timeoutItemMap.find(queueItem.m_timeoutId);
+                if (iter == m_timeoutItemMap.end())
+                {
+                    continue;
+                }
+
+                TimeoutQueue::TimeoutItem item = iter->second;
+                if (item.m_nextTimeoutTimeMs > currentTimeMs)
+                {
+                    m_timeoutItemQueue.push(QueueItem{ queueItem.m_timeoutId, item.m_nextTimeoutTimeMs });
+                    continue;
+                }
+
+                if (timeoutHandler(item) == TimeoutResult::Refresh)
+                {
+                    item.UpdateTimeoutTime(currentTimeMs);
+                    iter->second = item;
+                    m_timeoutItemQueue.push(QueueItem{ queueItem.m_timeoutId, item.m_nextTimeoutTimeMs });
+                    continue;
+                }
+                m_timeoutItemMap.erase(iter);
+            }
+        }
+
+    private:
+        struct QueueItem
+        {
+            TimeoutId m_timeoutId;
+            AZ::TimeMs m_timeoutTimeMs;
+
+            bool operator<(const QueueItem& rhs) const
+            {
+                return m_timeoutTimeMs > rhs.m_timeoutTimeMs;
+            }
+        };
+
+        TimeoutId m_nextTimeoutId = TimeoutId{ 0 };
+        AZStd::map<TimeoutId, TimeoutQueue::TimeoutItem> m_timeoutItemMap;
+        AZStd::priority_queue<QueueItem> m_timeoutItemQueue;
+    };
+
+    class TimeoutQueueBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_mockTime = AZStd::make_unique<AZ::NiceTimeSystemMock>();
+            ON_CALL(*m_mockTime, GetElapsedTimeMs()).WillByDefault(testing::Invoke([this]() { return m_currentTimeMs; }));
+        }
+
+        void SetUp(benchmark::State& state) override
+        {
+            SetUp(static_cast<const benchmark::State&>(state));
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_mockTime.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            TearDown(static_cast<const benchmark::State&>(state));
+        }
+
+        //! Simulates the packet acknowledgement pattern of a connection, every tick registers a batch of items that are mostly removed
+        //! before they time out, while the rest time out and are deleted by the handler.
+        template <typename QueueType>
+        void RunAckPattern(benchmark::State& state)
+        {
+            const int64_t itemsPerTick = state.range(0);
+            AZ::SimpleLcgRandom random;
+            AZStd::vector<TimeoutId> pendingIds;
+            pendingIds.reserve(itemsPerTick * 8);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                QueueType queue;
+                m_currentTimeMs = AZ::TimeMs{ 1000 };
+                pendingIds.clear();
+                for (uint32_t tick = 0; tick < 100; ++tick)
+                {
+                    for (int64_t i = 0; i < itemsPerTick; ++i)
+                    {
+                        pendingIds.push_back(queue.RegisterItem(i, AZ::TimeMs{ 100 + random.GetRandom() % 400 }));
+                    }
+
+                    // Acknowledge the older three quarters of the outstanding items
+                    const size_t acknowledgedCount = pendingIds.size() * 3 / 4;
+                    for (size_t i = 0; i < acknowledgedCount; ++i)
+                    {
+                        queue.RemoveItem(pendingIds[i]);
+                    }
+                    pendingIds.erase(pendingIds.begin(), pendingIds.begin() + acknowledgedCount);
+
+                    m_currentTimeMs = m_currentTimeMs + AZ::TimeMs{ 16 };
+                    queue.UpdateTimeouts([](TimeoutQueue::TimeoutItem&) { return TimeoutResult::Delete; });
+                }
+                benchmark::DoNotOptimize(queue);
+            }
+            state.SetItemsProcessed(state.iterations() * itemsPerTick * 100);
+        }
+
+        AZ::TimeMs m_currentTimeMs = AZ::TimeMs{ 1000 };
+        AZStd::unique_ptr<AZ::NiceTimeSystemMock> m_mockTime;
+    };
+
+    BENCHMARK_DEFINE_F(TimeoutQueueBenchmark, TimingWheel_AckPattern)(benchmark::State& state)
+    {
+        RunAckPattern<TimeoutQueue>(state);
+    }
+    BENCHMARK_REGISTER_F(TimeoutQueueBenchmark, TimingWheel_AckPattern)
+        ->RangeMultiplier(8)->Range(8, 4096)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(TimeoutQueueBenchmark, PriorityQueue_AckPattern)(benchmark::State& state)
+    {
+        RunAckPattern<PriorityQueueTimeoutQueue>(state);
+    }
+    BENCHMARK_REGISTER_F(TimeoutQueueBenchmark, PriorityQueue_AckPattern)
+        ->RangeMultiplier(8)->Range(8, 4096)
+        ->Unit(benchmark::kMicrosecond);
+}
+
+#endif
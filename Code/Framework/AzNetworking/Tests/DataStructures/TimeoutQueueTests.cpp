@@ -8,7 +8,172 @@
 
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/Mocks/MockITime.h>
 
 namespace UnitTest
 {
+    using namespace AzNetworking;
+
+    class TimeoutQueueTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_mockTime = AZStd::make_unique<AZ::NiceTimeSystemMock>();
+            ON_CALL(*m_mockTime, GetElapsedTimeMs()).WillByDefault(testing::Invoke([this]() { return m_currentTimeMs; }));
+        }
+
+        void TearDown() override
+        {
+            m_timeoutQueue.Reset();
+            m_mockTime.reset();
+        }
+
+        AZStd::vector<uint64_t> UpdateTimeouts(AZ::TimeMs currentTimeMs, TimeoutResult result = TimeoutResult::Delete, int32_t maxTimeouts = -1)
+        {
+            m_currentTimeMs = currentTimeMs;
+            AZStd::vector<uint64_t> timedOut;
+            m_timeoutQueue.UpdateTimeouts([&timedOut, result](TimeoutQueue::TimeoutItem& item)
+            {
+                timedOut.push_back(item.m_userData);
+                return result;
+            }, maxTimeouts);
+            return timedOut;
+        }
+
+        AZ::TimeMs m_currentTimeMs = AZ::TimeMs{ 1000 };
+        AZStd::unique_ptr<AZ::NiceTimeSystemMock> m_mockTime;
+        TimeoutQueue m_timeoutQueue;
+    };
+
+    TEST_F(TimeoutQueueTests, RegisterAndRetrieve)
+    {
+        const TimeoutId timeoutId = m_timeoutQueue.RegisterItem(42, AZ::TimeMs{ 100 });
+
+        TimeoutQueue::TimeoutItem* item = m_timeoutQueue.RetrieveItem(timeoutId);
+        ASSERT_NE(item, nullptr);
+        EXPECT_EQ(item->m_userData, 42);
+        EXPECT_EQ(item->m_timeoutMs, AZ::TimeMs{ 100 });
+        EXPECT_EQ(item->m_nextTimeoutTimeMs, AZ::TimeMs{ 1100 });
+
+        m_timeoutQueue.RemoveItem(timeoutId);
+        EXPECT_EQ(m_timeoutQueue.RetrieveItem(timeoutId), nullptr);
+        EXPECT_EQ(m_timeoutQueue.RetrieveItem(TimeoutId{ 0 }), nullptr);
+    }
+
+    TEST_F(TimeoutQueueTests, StaleIdsDoNotMatchReusedItems)
+    {
+        const TimeoutId firstId = m_timeoutQueue.RegisterItem(1, AZ::TimeMs{ 100 });
+        m_timeoutQueue.RemoveItem(firstId);
+
+        const TimeoutId secondId = m_timeoutQueue.RegisterItem(2, AZ::TimeMs{ 100 });
+        EXPECT_NE(firstId, secondId);
+        EXPECT_EQ(m_timeoutQueue.RetrieveItem(firstId), nullptr);
+
+        // Removing through the stale id leaves the new item alone
+        m_timeoutQueue.RemoveItem(firstId);
+        ASSERT_NE(m_timeoutQueue.RetrieveItem(secondId), nullptr);
+        EXPECT_EQ(m_timeoutQueue.RetrieveItem(secondId)->m_userData, 2);
+    }
+
+    TEST_F(TimeoutQueueTests, ExpiresInTimeoutOrder)
+    {
+        m_timeoutQueue.RegisterItem(3, AZ::TimeMs{ 300 });
+        m_timeoutQueue.RegisterItem(1, AZ::TimeMs{ 10 });
+        m_timeoutQueue.RegisterItem(2, AZ::TimeMs{ 200 });
+
+        // Items only time out once their timeout time has passed
+        EXPECT_TRUE(UpdateTimeouts(AZ::TimeMs{ 1010 }).empty());
+        EXPECT_EQ(UpdateTimeouts(AZ::TimeMs{ 1011 }), AZStd::vector<uint64_t>({ 1 }));
+        EXPECT_EQ(UpdateTimeouts(AZ::TimeMs{ 2000 }), AZStd::vector<uint64_t>({ 2, 3 }));
+        EXPECT_TRUE(UpdateTimeouts(AZ::TimeMs{ 3000 }).empty());
+    }
+
+    TEST_F(TimeoutQueueTests, RemovedItemsDoNotExpire)
+    {
+        const TimeoutId timeoutId = m_timeoutQueue.RegisterItem(1, AZ::TimeMs{ 10 });
+        m_timeoutQueue.RegisterItem(2, AZ::TimeMs{ 10 });
+        m_timeoutQueue.RemoveItem(timeoutId);
+
+        EXPECT_EQ(UpdateTimeouts(AZ::TimeMs{ 1100 }), AZStd::vector<uint64_t>({ 2 }));
+    }
+
+    TEST_F(TimeoutQueueTests, RefreshReschedulesItem)
+    {
+        const TimeoutId timeoutId = m_timeoutQueue.RegisterItem(1, AZ::TimeMs{ 50 });
+
+        EXPECT_EQ(UpdateTimeouts(AZ::TimeMs{ 1100 }, TimeoutResult::Refresh), AZStd::vector<uint64_t>({ 1 }));
+        ASSERT_NE(m_timeoutQueue.RetrieveItem(timeoutId), nullptr);
+        EXPECT_EQ(m_timeoutQueue.RetrieveItem(timeoutId)->m_nextTimeoutTimeMs, AZ::TimeMs{ 1150 });
+
+        EXPECT_TRUE(UpdateTimeouts(AZ::TimeMs{ 1150 }).empty());
+        EXPECT_EQ(UpdateTimeouts(AZ::TimeMs{ 1151 }), AZStd::vector<uint64_t>({ 1 }));
+        EXPECT_EQ(m_timeoutQueue.RetrieveItem(timeoutId), nullptr);
+    }
+
+    TEST_F(TimeoutQueueTests, UpdatedTimeoutTimeDefersExpiry)
+    {
+        const TimeoutId timeoutId = m_timeoutQueue.RegisterItem(1, AZ::TimeMs{ 50 });
+
+        m_currentTimeMs = AZ::TimeMs{ 1040 };
+        m_timeoutQueue.RetrieveItem(timeoutId)->UpdateTimeoutTime(m_currentTimeMs);
+
+        EXPECT_TRUE(UpdateTimeouts(AZ::TimeMs{ 1060 }).empty());
+        EXPECT_EQ(UpdateTimeouts(AZ::TimeMs{ 1091 }), AZStd::vector<uint64_t>({ 1 }));
+    }
+
+    TEST_F(TimeoutQueueTests, LongTimeoutsCascade)
+    {
+        // Cover every wheel, including timeouts that straddle the turns of the coarser wheels
+        const AZ::TimeMs timeouts[] = { AZ::TimeMs{ 255 }, AZ::TimeMs{ 256 }, AZ::TimeMs{ 70000 }, AZ::TimeMs{ 20000000 }, AZ::TimeMs{ 5000000000 } };
+        for (const AZ::TimeMs timeoutMs : timeouts)
+        {
+            m_timeoutQueue.RegisterItem(static_cast<uint64_t>(timeoutMs), timeoutMs);
+        }
+
+        for (const AZ::TimeMs timeoutMs : timeouts)
+        {
+            const AZ::TimeMs timeoutTimeMs = AZ::TimeMs{ 1000 } + timeoutMs;
+            EXPECT_TRUE(UpdateTimeouts(timeoutTimeMs).empty());
+            EXPECT_EQ(UpdateTimeouts(timeoutTimeMs + AZ::TimeMs{ 1 }), AZStd::vector<uint64_t>({ static_cast<uint64_t>(timeoutMs) }));
+        }
+    }
+
+    TEST_F(TimeoutQueueTests, MaxTimeoutsDefersRemainingItems)
+    {
+        for (uint64_t i = 0; i < 5; ++i)
+        {
+            m_timeoutQueue.RegisterItem(i, AZ::TimeMs{ 10 });
+        }
+
+        EXPECT_EQ(UpdateTimeouts(AZ::TimeMs{ 1100 }, TimeoutResult::Delete, 2).size(), 2);
+        EXPECT_EQ(UpdateTimeouts(AZ::TimeMs{ 1100 }, TimeoutResult::Delete, 2).size(), 2);
+        EXPECT_EQ(UpdateTimeouts(AZ::TimeMs{ 1100 }).size(), 1);
+    }
+
+    TEST_F(TimeoutQueueTests, HandlerCanModifyQueue)
+    {
+        const TimeoutId firstId = m_timeoutQueue.RegisterItem(1, AZ::TimeMs{ 10 });
+        const TimeoutId secondId = m_timeoutQueue.RegisterItem(2, AZ::TimeMs{ 10 });
+        TimeoutId registeredId = TimeoutId{ 0 };
+
+        m_currentTimeMs = AZ::TimeMs{ 1100 };
+        uint32_t timeoutCount = 0;
+        m_timeoutQueue.UpdateTimeouts([&](TimeoutQueue::TimeoutItem& item)
+        {
+            ++timeoutCount;
+
+            // Remove whichever item didn't time out first, and register a new one in its place
+            m_timeoutQueue.RemoveItem((item.m_userData == 1) ? secondId : firstId);
+            registeredId = m_timeoutQueue.RegisterItem(3, AZ::TimeMs{ 10 });
+            return TimeoutResult::Delete;
+        });
+
+        EXPECT_EQ(timeoutCount, 1);
+        EXPECT_EQ(m_timeoutQueue.RetrieveItem(firstId), nullptr);
+        EXPECT_EQ(m_timeoutQueue.RetrieveItem(secondId), nullptr);
+        ASSERT_NE(m_timeoutQueue.RetrieveItem(registeredId), nullptr);
+        EXPECT_EQ(UpdateTimeouts(AZ::TimeMs{ 1111 }), AZStd::vector<uint64_t>({ 3 }));
+    }
 }
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzNetworking/Serialization/DeltaSerializer.h>
+#include <AzNetworking/Serialization/HashSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Synthetic replicated entity state, modeled after the properties of the network transform and a gameplay component.
+    struct EntityState
+    {
+        static constexpr int64_t PropertyCount = 12;
+
+        uint64_t m_netEntityId = 0;
+        uint8_t m_resetCount = 0;
+        bool m_isActive = true;
+        AZ::Vector3 m_translation = AZ::Vector3::CreateZero();
+        AZ::Quaternion m_rotation = AZ::Quaternion::CreateIdentity();
+        float m_scale = 1.0f;
+        AZ::Vector3 m_velocity = AZ::Vector3::CreateZero();
+        uint16_t m_health = 100;
+        uint16_t m_ammo = 30;
+        int32_t m_score = 0;
+        uint32_t m_stateFlags = 0;
+        AZ::TimeMs m_lastHitTimeMs = AZ::Time::ZeroTimeMs;
+
+        bool Serialize(ISerializer& serializer)
+        {
+            return serializer.Serialize(m_netEntityId, "NetEntityId")
+                && serializer.Serialize(m_resetCount, "ResetCount")
+                && serializer.Serialize(m_isActive, "IsActive")
+                && serializer.Serialize(m_translation, "Translation")
+                && serializer.Serialize(m_rotation, "Rotation")
+                && serializer.Serialize(m_scale, "Scale")
+                && serializer.Serialize(m_velocity, "Velocity")
+                && serializer.Serialize(m_health, "Health")
+                && serializer.Serialize(m_ammo, "Ammo")
+                && serializer.Serialize(m_score, "Score")
+                && serializer.Serialize(m_stateFlags, "StateFlags")
+                && serializer.Serialize(m_lastHitTimeMs, "LastHitTimeMs");
+        }
+    };
+
+    class SerializerBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            // One engine update worth of entities, each moving a little and with a few of them changing gameplay state
+            AZ::SimpleLcgRandom random;
+            const int64_t entityCount = state.range(0);
+            m_previousStates.resize(entityCount);
+            m_currentStates.resize(entityCount);
+            for (int64_t i = 0; i < entityCount; ++i)
+            {
+                EntityState& previous = m_previousStates[i];
+                previous.m_netEntityId = static_cast<uint64_t>(i + 1);
+                previous.m_translation = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 1000.0f;
+                previous.m_score = static_cast<int32_t>(random.GetRandom() % 1000);
+
+                EntityState& current = m_currentStates[i];
+                current = previous;
+                current.m_translation += AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), 0.0f);
+                current.m_velocity = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), 0.0f);
+                if (random.GetRandom() % 8 == 0)
+                {
+                    current.m_health = static_cast<uint16_t>(random.GetRandom() % 100);
+                    current.m_lastHitTimeMs = AZ::TimeMs{ 1000 };
+                }
+            }
+            m_buffer.resize(entityCount * MaxEntityStateSize);
+        }
+
+        void SetUp(benchmark::State& state) override
+        {
+            SetUp(static_cast<const benchmark::State&>(state));
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_buffer = {};
+            m_previousStates = {};
+            m_currentStates = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            TearDown(static_cast<const benchmark::State&>(state));
+        }
+
+        //! Reports the serialized bytes per second and the nanoseconds spent per serialized property.
+        void ReportCounters(benchmark::State& state, uint32_t bytesPerIteration)
+        {
+            const int64_t propertiesPerIteration = state.range(0) * EntityState::PropertyCount;
+            state.SetBytesProcessed(state.iterations() * bytesPerIteration);
+            state.SetItemsProcessed(state.iterations() * propertiesPerIteration);
+            state.counters["ns_per_property"] = benchmark::Counter(
+                static_cast<double>(state.iterations() * propertiesPerIteration) / 1e9,
+                benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+        }
+
+        uint32_t WriteCurrentStates()
+        {
+            NetworkInputSerializer serializer(m_buffer.data(), static_cast<uint32_t>(m_buffer.size()));
+            for (EntityState& state : m_currentStates)
+            {
+                state.Serialize(serializer);
+            }
+            return serializer.GetSize();
+        }
+
+        static constexpr uint32_t MaxEntityStateSize = 128;
+
+        AZStd::vector<uint8_t> m_buffer;
+        AZStd::vector<EntityState> m_previousStates;
+        AZStd::vector<EntityState> m_currentStates;
+    };
+
+    BENCHMARK_DEFINE_F(SerializerBenchmark, NetworkInputSerializer_WriteEntities)(benchmark::State& state)
+    {
+        uint32_t serializedSize = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            serializedSize = WriteCurrentStates();
+            benchmark::DoNotOptimize(m_buffer.data());
+        }
+        ReportCounters(state, serializedSize);
+    }
+    BENCHMARK_REGISTER_F(SerializerBenchmark, NetworkInputSerializer_WriteEntities)
+        ->RangeMultiplier(4)->Range(16, 4096)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SerializerBenchmark, NetworkOutputSerializer_ReadEntities)(benchmark::State& state)
+    {
+        const uint32_t serializedSize = WriteCurrentStates();
+        AZStd::vector<EntityState> readStates(m_currentStates.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            NetworkOutputSerializer serializer(m_buffer.data(), serializedSize);
+            for (EntityState& readState : readStates)
+            {
+                readState.Serialize(serializer);
+            }
+            benchmark::DoNotOptimize(readStates.data());
+        }
+        ReportCounters(state, serializedSize);
+    }
+    BENCHMARK_REGISTER_F(SerializerBenchmark, NetworkOutputSerializer_ReadEntities)
+        ->RangeMultiplier(4)->Range(16, 4096)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SerializerBenchmark, HashSerializer_HashEntities)(benchmark::State& state)
+    {
+        const uint32_t serializedSize = WriteCurrentStates();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            HashSerializer serializer;
+            for (EntityState& currentState : m_currentStates)
+            {
+                currentState.Serialize(serializer);
+            }
+            benchmark::DoNotOptimize(serializer.GetHash());
+        }
+        ReportCounters(state, serializedSize);
+    }
+    BENCHMARK_REGISTER_F(SerializerBenchmark, HashSerializer_HashEntities)
+        ->RangeMultiplier(4)->Range(16, 4096)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SerializerBenchmark, DeltaSerializer_CreateAndWriteDeltas)(benchmark::State& state)
+    {
+        uint32_t serializedSize = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            NetworkInputSerializer serializer(m_buffer.data(), static_cast<uint32_t>(m_buffer.size()));
+            for (size_t i = 0; i < m_currentStates.size(); ++i)
+            {
+                SerializerDelta delta;
+                DeltaSerializerCreate createSerializer(delta);
+                createSerializer.CreateDelta(m_previousStates[i], m_currentStates[i]);
+                delta.Serialize(serializer);
+            }
+            serializedSize = serializer.GetSize();
+            benchmark::DoNotOptimize(m_buffer.data());
+        }
+        ReportCounters(state, serializedSize);
+    }
+    BENCHMARK_REGISTER_F(SerializerBenchmark, DeltaSerializer_CreateAndWriteDeltas)
+        ->RangeMultiplier(4)->Range(16, 4096)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SerializerBenchmark, DeltaSerializer_ReadAndApplyDeltas)(benchmark::State& state)
+    {
+        NetworkInputSerializer inputSerializer(m_buffer.data(), static_cast<uint32_t>(m_buffer.size()));
+        for (size_t i = 0; i < m_currentStates.size(); ++i)
+        {
+            SerializerDelta delta;
+            DeltaSerializerCreate createSerializer(delta);
+            createSerializer.CreateDelta(m_previousStates[i], m_currentStates[i]);
+            delta.Serialize(inputSerializer);
+        }
+        const uint32_t serializedSize = inputSerializer.GetSize();
+
+        AZStd::vector<EntityState> appliedStates;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            appliedStates = m_previousStates;
+            NetworkOutputSerializer serializer(m_buffer.data(), serializedSize);
+            for (EntityState& appliedState : appliedStates)
+            {
+                SerializerDelta delta;
+                delta.Serialize(serializer);
+                DeltaSerializerApply applySerializer(delta);
+                applySerializer.ApplyDelta(appliedState);
+            }
+            benchmark::DoNotOptimize(appliedStates.data());
+        }
+        ReportCounters(state, serializedSize);
+    }
+    BENCHMARK_REGISTER_F(SerializerBenchmark, DeltaSerializer_ReadAndApplyDeltas)
+        ->RangeMultiplier(4)->Range(16, 4096)
+        ->Unit(benchmark::kMicrosecond);
+}
+
+#endif
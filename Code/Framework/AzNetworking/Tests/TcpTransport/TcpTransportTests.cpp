@@ -15,6 +15,14 @@
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
+namespace AzNetworking
+{
+    AZ_CVAR_EXTERNED(uint32_t, net_TcpReactorThreadCount);
+#if AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
+    AZ_CVAR_EXTERNED(bool, net_TcpUseIoUring);
+#endif
+}
+
 namespace UnitTest
 {
     using namespace AzNetworking;
@@ -121,6 +129,44 @@ namespace UnitTest
         AZStd::unique_ptr<AzNetworking::NetworkingSystemComponent> m_networkingSystemComponent;
     };
 
+#if AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
+    class TcpTransportIoUringTests
+        : public TcpTransportTests
+    {
+    public:
+
+        void SetUp() override
+        {
+            // Socket managers pick their backend when they are created, the one of the listen thread along with the networking
+            // system component. They fall back to epoll if io_uring is unavailable.
+            net_TcpUseIoUring = true;
+            TcpTransportTests::SetUp();
+        }
+
+        void TearDown() override
+        {
+            TcpTransportTests::TearDown();
+            net_TcpUseIoUring = false;
+        }
+
+        bool WaitForServerConnectionCount(const TestTcpServer& testServer, uint32_t connectionCount)
+        {
+            constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            while (AZ::GetElapsedTimeMs() - startTimeMs <= TotalIterationTimeMs)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+                m_networkingSystemComponent->OnSystemTick();
+                if (testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == connectionCount)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+#endif // AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
+
     #if AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
     TEST_F(TcpTransportTests, DISABLED_TestSingleClient)
     #else
@@ -190,4 +236,129 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+#if AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
+    #if AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    TEST_F(TcpTransportTests, DISABLED_TestMultipleClientsReactorThreads)
+    #else
+    TEST_F(TcpTransportTests, SUITE_sandbox_TestMultipleClientsReactorThreads)
+    #endif // AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    {
+        constexpr uint32_t NumTestClients = 50;
+
+        // Network interfaces read the reactor thread count when they are created
+        net_TcpReactorThreadCount = 2;
+        {
+            TestTcpServer testServer;
+            TestTcpClient testClient[NumTestClients];
+
+            constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            for (;;)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+                m_networkingSystemComponent->OnSystemTick();
+                bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+                bool canTerminate = testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == NumTestClients;
+                for (uint32_t i = 0; i < NumTestClients; ++i)
+                {
+                    canTerminate &= testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1;
+                }
+                if (canTerminate || timeExpired)
+                {
+                    break;
+                }
+            }
+
+            EXPECT_EQ(testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+            for (uint32_t i = 0; i < NumTestClients; ++i)
+            {
+                EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
+            }
+        }
+        net_TcpReactorThreadCount = 0;
+    }
+
+    #if AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    TEST_F(TcpTransportIoUringTests, DISABLED_TestMultipleClientsIoUring)
+    #else
+    TEST_F(TcpTransportIoUringTests, SUITE_sandbox_TestMultipleClientsIoUring)
+    #endif // AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    {
+        constexpr uint32_t NumTestClients = 50;
+
+        TestTcpServer testServer;
+        TestTcpClient testClient[NumTestClients];
+
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        for (;;)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_networkingSystemComponent->OnSystemTick();
+            bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+            bool canTerminate = testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == NumTestClients;
+            for (uint32_t i = 0; i < NumTestClients; ++i)
+            {
+                canTerminate &= testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount() == 1;
+            }
+            if (canTerminate || timeExpired)
+            {
+                break;
+            }
+        }
+
+        EXPECT_EQ(testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+        for (uint32_t i = 0; i < NumTestClients; ++i)
+        {
+            EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
+        }
+    }
+
+    #if AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    TEST_F(TcpTransportIoUringTests, DISABLED_TestListenAgainAfterStopListeningIoUring)
+    #else
+    TEST_F(TcpTransportIoUringTests, SUITE_sandbox_TestListenAgainAfterStopListeningIoUring)
+    #endif // AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    {
+        TestTcpServer testServer;
+        TestTcpClient firstClient;
+        EXPECT_TRUE(WaitForServerConnectionCount(testServer, 1));
+
+        // The listen thread stops with its last port, then starts again and has to bind the port that was just released
+        EXPECT_TRUE(testServer.m_serverNetworkInterface->StopListening());
+        EXPECT_TRUE(testServer.m_serverNetworkInterface->Listen(12345));
+
+        TestTcpClient secondClient;
+        EXPECT_TRUE(WaitForServerConnectionCount(testServer, 2));
+    }
+
+    #if AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    TEST_F(TcpTransportIoUringTests, DISABLED_TestListenAgainWhileListenThreadRunsIoUring)
+    #else
+    TEST_F(TcpTransportIoUringTests, SUITE_sandbox_TestListenAgainWhileListenThreadRunsIoUring)
+    #endif // AZ_TRAIT_DISABLE_FAILED_NETWORKING_TESTS
+    {
+        // Another listening interface keeps the listen thread running, so it releases the port while it updates
+        TestTcpConnectionListener otherConnectionListener;
+        const AZ::Name otherServerName = AZ::Name(AZStd::string_view("OtherTcpServer"));
+        INetworkInterface* otherServerNetworkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(
+            otherServerName, ProtocolType::Tcp, TrustZone::ExternalClientToServer, otherConnectionListener);
+        EXPECT_TRUE(otherServerNetworkInterface->Listen(12346));
+
+        {
+            TestTcpServer testServer;
+            TestTcpClient firstClient;
+            EXPECT_TRUE(WaitForServerConnectionCount(testServer, 1));
+
+            EXPECT_TRUE(testServer.m_serverNetworkInterface->StopListening());
+            EXPECT_TRUE(testServer.m_serverNetworkInterface->Listen(12345));
+
+            TestTcpClient secondClient;
+            EXPECT_TRUE(WaitForServerConnectionCount(testServer, 2));
+        }
+
+        AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(otherServerName);
+    }
+#endif // AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
 }
@@ -9,6 +9,7 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -320,4 +321,57 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, SocketSendBatch_ReceiveBatch_AllDatagramsReceivedInOrder)
+    {
+        UdpSocket receiver;
+        UdpSocket sender;
+        ASSERT_TRUE(receiver.Open(12346, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(sender.Open(12347, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+
+        // Send more datagrams than fit in a single batch so the batch is submitted while it's still active
+        constexpr uint32_t DatagramCount = UdpSocket::MaxSendBatchSize + UdpSocket::MaxSendBatchSize / 2;
+        const IpAddress receiverAddress(127, 0, 0, 1, 12346);
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        sender.BeginSendBatch();
+        for (uint32_t i = 0; i < DatagramCount; ++i)
+        {
+            const uint8_t payload[] = { aznumeric_cast<uint8_t>(i), 0xAB, 0xCD };
+            EXPECT_EQ(sizeof(payload), sender.Send(receiverAddress, payload, sizeof(payload), false, dtlsEndpoint, connectionQuality));
+        }
+        sender.EndSendBatch();
+        EXPECT_EQ(DatagramCount, sender.GetSentPackets());
+
+        AZStd::vector<uint8_t> receivedIds;
+        uint8_t buffers[UdpSocket::MaxReceiveBatchSize][MaxUdpTransmissionUnit];
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while (receivedIds.size() < DatagramCount && (AZ::GetElapsedTimeMs() - startTimeMs) < AZ::TimeMs{ 2000 })
+        {
+            UdpSocket::ReceiveBatchEntry entries[UdpSocket::MaxReceiveBatchSize];
+            for (uint32_t i = 0; i < UdpSocket::MaxReceiveBatchSize; ++i)
+            {
+                entries[i].m_data = buffers[i];
+                entries[i].m_size = MaxUdpTransmissionUnit;
+            }
+            const uint32_t receivedCount = receiver.ReceiveBatch(entries, UdpSocket::MaxReceiveBatchSize);
+            for (uint32_t i = 0; i < receivedCount; ++i)
+            {
+                EXPECT_EQ(3, entries[i].m_size);
+                EXPECT_EQ(12347, entries[i].m_address.GetPort(ByteOrder::Host));
+                receivedIds.push_back(entries[i].m_data[0]);
+            }
+            if (receivedCount == 0)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+        }
+
+        ASSERT_EQ(DatagramCount, receivedIds.size());
+        for (uint32_t i = 0; i < DatagramCount; ++i)
+        {
+            EXPECT_EQ(aznumeric_cast<uint8_t>(i), receivedIds[i]);
+        }
+        EXPECT_EQ(DatagramCount, receiver.GetRecvPackets());
+    }
 }
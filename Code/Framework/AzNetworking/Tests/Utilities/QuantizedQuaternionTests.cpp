@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/QuantizedQuaternion.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    static bool IsSameRotation(const AZ::Quaternion& a, const AZ::Quaternion& b, float tolerance)
+    {
+        // q and -q represent the same rotation
+        return a.IsClose(b, tolerance) || a.IsClose(-b, tolerance);
+    }
+
+    template <AZStd::size_t BITS_PER_COMPONENT>
+    void TestQuantizedQuaternionHelper(float tolerance)
+    {
+        const AZ::Quaternion rotations[] =
+        {
+            AZ::Quaternion::CreateIdentity(),
+            AZ::Quaternion::CreateRotationX(AZ::Constants::HalfPi),
+            AZ::Quaternion::CreateRotationY(-AZ::Constants::Pi * 0.75f),
+            AZ::Quaternion::CreateRotationZ(AZ::Constants::Pi),
+            AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 2.0f, -3.0f).GetNormalized(), 2.5f),
+            AZ::Quaternion(-0.5f, -0.5f, -0.5f, -0.5f),
+        };
+
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer  inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        AzNetworking::QuantizedQuaternion<BITS_PER_COMPONENT> testOut;
+        for (const AZ::Quaternion& rotation : rotations)
+        {
+            AzNetworking::QuantizedQuaternion<BITS_PER_COMPONENT> testIn(rotation);
+            EXPECT_TRUE(IsSameRotation(static_cast<AZ::Quaternion>(testIn), rotation, tolerance));
+
+            const uint32_t prevSize = inputSerializer.GetSize();
+            testIn.Serialize(inputSerializer);
+            EXPECT_EQ(inputSerializer.GetSize() - prevSize, AzNetworking::QuantizedQuaternion<BITS_PER_COMPONENT>::TotalBytes);
+
+            testOut.Serialize(outputSerializer);
+            EXPECT_EQ(testIn, testOut);
+            EXPECT_EQ(testIn.GetQuantizedIntegralValue(), testOut.GetQuantizedIntegralValue());
+            EXPECT_TRUE(IsSameRotation(static_cast<AZ::Quaternion>(testOut), rotation, tolerance));
+        }
+    }
+
+    TEST(QuantizedQuaternionTests, TestQuantizedQuaternion)
+    {
+        TestQuantizedQuaternionHelper<10>(0.005f);
+        TestQuantizedQuaternionHelper<15>(0.0005f);
+        TestQuantizedQuaternionHelper<20>(0.00005f);
+    }
+
+    TEST(QuantizedQuaternionTests, TestSerializedSize)
+    {
+        EXPECT_EQ(AzNetworking::QuantizedQuaternion<10>::TotalBytes, 4);
+        EXPECT_EQ(AzNetworking::QuantizedQuaternion<15>::TotalBytes, 6);
+        EXPECT_EQ(AzNetworking::QuantizedQuaternion<20>::TotalBytes, 8);
+    }
+
+    TEST(QuantizedQuaternionTests, TestUnnormalizedInput)
+    {
+        const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationZ(1.0f);
+        AzNetworking::QuantizedQuaternion<15> quantized(rotation * 4.0f);
+        EXPECT_TRUE(IsSameRotation(static_cast<AZ::Quaternion>(quantized), rotation, 0.0005f));
+        EXPECT_EQ(quantized, AzNetworking::QuantizedQuaternion<15>(rotation));
+    }
+}
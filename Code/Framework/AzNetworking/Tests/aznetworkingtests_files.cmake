@@ -14,10 +14,12 @@ set(FILES
     DataStructures/FixedSizeBitsetViewTests.cpp
     DataStructures/FixedSizeVectorBitsetTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
+    DataStructures/TimeoutQueueBenchmarks.cpp
     DataStructures/TimeoutQueueTests.cpp
     Serialization/DeltaSerializerTests.cpp
     Serialization/HashSerializerTests.cpp
     Serialization/NetworkInputOutputSerializerTests.cpp
+    Serialization/SerializerBenchmarks.cpp
     Serialization/StringifySerializerTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
     Serialization/TypeValidatingSerializerTests.cpp
@@ -26,5 +28,6 @@ set(FILES
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
     Utilities/NetworkCommonTests.cpp
+    Utilities/QuantizedQuaternionTests.cpp
     Utilities/QuantizedValuesTests.cpp
 )
@@ -989,6 +989,13 @@ namespace AzToolsFramework
         void Instance::EnableDomCaching(bool enableDomCaching)
         {
             m_isDomCachingEnabled = enableDomCaching;
+
+            // The cache of the focused instance can hold the whole level, so release it as soon as the instance loses focus.
+            // It would also go stale while caching is disabled, since SetCachedInstanceDom no longer refreshes it.
+            if (!enableDomCaching)
+            {
+                m_cachedInstanceDom = PrefabDom();
+            }
         }
     }
 } // namespace AzToolsFramework
@@ -17,6 +17,12 @@
 #include <AzToolsFramework/Prefab/PrefabDomTypes.h>
 #include <AzToolsFramework/Prefab/PrefabIdTypes.h>
 
+// Predefinition for unit test friend class
+namespace UnitTest
+{
+    class PrefabUpdateLinkedInstancesTest;
+}
+
 namespace AzToolsFramework
 {
     namespace Prefab
@@ -29,6 +35,8 @@ namespace AzToolsFramework
         class InstanceUpdateExecutor
             : public InstanceUpdateExecutorInterface
         {
+            friend class UnitTest::PrefabUpdateLinkedInstancesTest;
+
         public:
             AZ_RTTI(InstanceUpdateExecutor, "{E21DB0D4-0478-4DA9-9011-31BC96F55837}", InstanceUpdateExecutorInterface);
             AZ_CLASS_ALLOCATOR(InstanceUpdateExecutor, AZ::SystemAllocator);
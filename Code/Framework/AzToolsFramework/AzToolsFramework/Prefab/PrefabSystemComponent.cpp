@@ -267,6 +267,7 @@ namespace AzToolsFramework
             TemplateReference findTemplateResult = FindTemplate(templateId);
             if (findTemplateResult.has_value())
             {
+                LinkIdSet unchangedLinkIds;
                 auto templateIdToLinkIdsIterator = m_templateToLinkIdsMap.find(templateId);
                 if (templateIdToLinkIdsIterator != m_templateToLinkIdsMap.end())
                 {
@@ -275,9 +276,30 @@ namespace AzToolsFramework
                     AZStd::queue<LinkIds> linkIdsToUpdateQueue;
                     linkIdsToUpdateQueue.push(
                         LinkIds(templateIdToLinkIdsIterator->second.begin(), templateIdToLinkIdsIterator->second.end()));
-                    UpdateLinkedInstances(linkIdsToUpdateQueue);
+                    UpdateLinkedInstances(linkIdsToUpdateQueue, unchangedLinkIds);
+                }
+
+                if (unchangedLinkIds.empty())
+                {
+                    UpdatePrefabInstances(templateId, instanceToExclude);
+                }
+                else
+                {
+                    // The overrides of an instance masked the change when its linked instance DOM came out of the update unchanged.
+                    // The DOM generated for the instance is then the same as the one it was loaded from, so it doesn't need a reload.
+                    auto findInstancesResult = m_templateInstanceMapper.FindInstancesOwnedByTemplate(templateId);
+                    if (findInstancesResult.has_value())
+                    {
+                        const Instance* instanceToExcludePtr = instanceToExclude.has_value() ? &(instanceToExclude->get()) : nullptr;
+                        for (Instance* instance : findInstancesResult->get())
+                        {
+                            if (instance != instanceToExcludePtr && unchangedLinkIds.find(instance->GetLinkId()) == unchangedLinkIds.end())
+                            {
+                                m_instanceUpdateExecutor.AddInstanceToQueue(*instance);
+                            }
+                        }
+                    }
                 }
-                UpdatePrefabInstances(templateId, instanceToExclude);
                 m_templatesWhichNeedGarbageCollection.insert(templateId);
             }
         }
@@ -302,7 +324,7 @@ namespace AzToolsFramework
             m_instanceUpdateExecutor.AddTemplateInstancesToQueue(templateId, instanceToExclude);
         }
 
-        void PrefabSystemComponent::UpdateLinkedInstances(AZStd::queue<LinkIds>& linkIdsQueue)
+        void PrefabSystemComponent::UpdateLinkedInstances(AZStd::queue<LinkIds>& linkIdsQueue, LinkIdSet& unchangedLinkIds)
         {
             TargetTemplateIdToLinkIdMap targetTemplateIdToLinkIdMap;
 
@@ -317,7 +339,14 @@ namespace AzToolsFramework
                 // This will ensure that templates are updated with changes in the same order they are received.
                 for (const LinkId& linkIdToUpdate : LinkIdsToUpdate)
                 {
-                    UpdateLinkedInstance(linkIdToUpdate, targetTemplateIdToLinkIdMap, linkIdsQueue);
+                    if (UpdateLinkedInstance(linkIdToUpdate, targetTemplateIdToLinkIdMap, linkIdsQueue))
+                    {
+                        unchangedLinkIds.erase(linkIdToUpdate);
+                    }
+                    else
+                    {
+                        unchangedLinkIds.insert(linkIdToUpdate);
+                    }
                 }
 
                 linkIdsQueue.pop();
@@ -353,7 +382,7 @@ namespace AzToolsFramework
         }
 
       
-        void PrefabSystemComponent::UpdateLinkedInstance(const LinkId linkIdToUpdate,
+        bool PrefabSystemComponent::UpdateLinkedInstance(const LinkId linkIdToUpdate,
             TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap, AZStd::queue<LinkIds>& linkIdsQueue)
         {
             Link& linkToUpdate = m_linkIdMap[linkIdToUpdate];
@@ -375,13 +404,12 @@ namespace AzToolsFramework
             // if it didn't change, we don't need to recurse into its children and propogate the changes - the propogation
             // will end at this point in the heirarchy since it will not have any downstream effects.
 
-            // It is expensive to compare a DOM, so once we've compared one, we cache the fact that we compared it and it differed
-            // from before in targetTemplateIdToLinkIdMap[targetTemplateId].second.  This also means that if
-            // targetTemplateIdToLinkIdMap[targetTemplateId].second is true, there is no need to compare it again, as it will have
-            // already added its links to the queue.
-            
-            bool isTemplateUpdated = targetTemplateIdToLinkIdMap[targetTemplateId].second;
-            if (!isTemplateUpdated || AZ::JsonSerialization::Compare(linkedDomBeforeUpdate, linkedInstanceDom) != AZ::JsonSerializerCompareResult::Equal)
+            // Whether the target template changed is cached in targetTemplateIdToLinkIdMap[targetTemplateId].second, so its links
+            // are only added to the queue once. Every link is still compared, because the instances of the source template whose
+            // linked instance DOM didn't change are skipped when reloading instances.
+            const bool isLinkedInstanceUpdated =
+                AZ::JsonSerialization::Compare(linkedDomBeforeUpdate, linkedInstanceDom) != AZ::JsonSerializerCompareResult::Equal;
+            if (isLinkedInstanceUpdated)
             {
                 targetTemplateIdToLinkIdMap[targetTemplateId].second = true;
             }
@@ -391,6 +419,8 @@ namespace AzToolsFramework
                 targetTemplateIdToLinkIdMap[targetTemplateId].first.erase(linkIdToUpdate);
                 UpdateTemplateChangePropagationQueue(targetTemplateIdToLinkIdMap, targetTemplateId, linkIdsQueue);
             }
+
+            return isLinkedInstanceUpdated;
         }
 
         void PrefabSystemComponent::UpdateTemplateChangePropagationQueue(
@@ -38,6 +38,12 @@ namespace AZ
     class SerializeContext;
 } // namespace AZ
 
+// Predefinition for unit test friend class
+namespace UnitTest
+{
+    class PrefabUpdateLinkedInstancesTest;
+}
+
 namespace AzToolsFramework
 {
     namespace Prefab
@@ -56,6 +62,8 @@ namespace AzToolsFramework
             , private AZ::SystemTickBus::Handler
             , private AzToolsFramework::AssetBrowser::AssetBrowserFileActionNotificationBus::Handler
         {
+            friend class UnitTest::PrefabUpdateLinkedInstancesTest;
+
         public:
 
             using TargetTemplateIdToLinkIdMap = AZStd::unordered_map<TemplateId, AZStd::pair<AZStd::unordered_set<LinkId>, bool>>;
@@ -288,8 +296,9 @@ namespace AzToolsFramework
              * Queue gets populated with more linkId lists as linked instances are updated. Updating stops when the queue is empty.
              *
              * @param linkIdsQueue A queue of vector of link-Ids to update.
+             * @param unchangedLinkIds Filled with the ids of the updated links whose linked instance DOM didn't change.
              */
-            void UpdateLinkedInstances(AZStd::queue<LinkIds>& linkIdsQueue);
+            void UpdateLinkedInstances(AZStd::queue<LinkIds>& linkIdsQueue, LinkIdSet& unchangedLinkIds);
 
             /**
              * Given a vector of link ids to update, splits them into smaller lists based on the target template id of the links.
@@ -309,8 +318,9 @@ namespace AzToolsFramework
              * @param targetTemplateIdToLinkIdMap The map of target templateIds to a pair of lists of linkIds and a bool flag indicating
              *                                    whether any of the instances of the target template were updated.
              * @param linkIdsQueue A queue of vector of link-Ids to update.
+             * @return True if the linked instance DOM changed.
              */
-            void UpdateLinkedInstance(const LinkId linkIdToUpdate, TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap,
+            bool UpdateLinkedInstance(const LinkId linkIdToUpdate, TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap,
                 AZStd::queue<LinkIds>& linkIdsQueue);
 
             /**
@@ -7,6 +7,8 @@
  */
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceDomGeneratorInterface.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceToTemplateInterface.h>
 #include <AzToolsFramework/Prefab/PrefabSystemComponentInterface.h>
@@ -16,6 +18,28 @@ namespace AzToolsFramework
 {
     namespace Prefab
     {
+        namespace Internal
+        {
+            static AZStd::string CompactPatch(PrefabDom& patch)
+            {
+                rapidjson::StringBuffer patchBuffer;
+                rapidjson::Writer<rapidjson::StringBuffer> writer(patchBuffer);
+                patch.Accept(writer);
+
+                // swapping with an empty DOM releases the memory pool of the patch
+                PrefabDom emptyPatch;
+                patch.Swap(emptyPatch);
+                return AZStd::string(patchBuffer.GetString(), patchBuffer.GetSize());
+            }
+
+            static void RestorePatch(PrefabDom& patch, AZStd::string& compactPatch)
+            {
+                patch.Parse(compactPatch.c_str(), compactPatch.size());
+                AZ_Error("Prefab", !patch.HasParseError(), "Failed to restore a compacted undo patch");
+                compactPatch = {};
+            }
+        } // namespace Internal
+
         PrefabUndoBase::PrefabUndoBase(const AZStd::string& undoOperationName)
             : UndoSystem::URSequencePoint(undoOperationName)
             , m_redoPatch(rapidjson::kArrayType)
@@ -53,6 +77,26 @@ namespace AzToolsFramework
             Redo(AZStd::nullopt);
         }
 
+        void PrefabUndoBase::Compact()
+        {
+            if (!m_isCompacted)
+            {
+                m_compactRedoPatch = Internal::CompactPatch(m_redoPatch);
+                m_compactUndoPatch = Internal::CompactPatch(m_undoPatch);
+                m_isCompacted = true;
+            }
+        }
+
+        void PrefabUndoBase::Restore()
+        {
+            if (m_isCompacted)
+            {
+                Internal::RestorePatch(m_redoPatch, m_compactRedoPatch);
+                Internal::RestorePatch(m_undoPatch, m_compactUndoPatch);
+                m_isCompacted = false;
+            }
+        }
+
         void PrefabUndoBase::Redo(InstanceOptionalConstReference instanceToExclude)
         {
             [[maybe_unused]] bool isPatchApplicationSuccessful =
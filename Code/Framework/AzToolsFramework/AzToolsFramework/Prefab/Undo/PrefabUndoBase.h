@@ -35,6 +35,10 @@ namespace AzToolsFramework
             //! Overload to allow to apply the change, but prevent instanceToExclude from being refreshed.
             void virtual Redo(InstanceOptionalConstReference instanceToExclude);
 
+            //! Stores the patches as compact JSON strings, which free the memory pools of the DOMs.
+            void Compact() override;
+            void Restore() override;
+
         protected:
             PrefabDom m_redoPatch;
             PrefabDom m_undoPatch;
@@ -46,6 +50,11 @@ namespace AzToolsFramework
             PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
 
             bool m_changed;
+
+        private:
+            AZStd::string m_compactRedoPatch;
+            AZStd::string m_compactUndoPatch;
+            bool m_isCompacted = false;
         };
     }
 }
@@ -112,6 +112,7 @@ namespace AzToolsFramework
                 sqlite3_close(m_db);
                 m_db = NULL;
             }
+            m_transactionDepth = 0;
         }
 
         void Connection::FinalizeAll()
@@ -221,7 +222,18 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                // nested transactions become savepoints, so that they can be committed or rolled back on their own
+                // while everything is written to disk once, when the outermost transaction commits.
+                AZStd::string savepoint = AZStd::string::format("SAVEPOINT nested_%u;", m_transactionDepth);
+                sqlite3_exec(m_db, savepoint.c_str(), NULL, NULL, NULL);
+            }
+            ++m_transactionDepth;
         }
 
         void Connection::CommitTransaction()
@@ -231,7 +243,21 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            AZ_Assert(m_transactionDepth > 0, "CommitTransaction:  No transaction is in progress!");
+            if (m_transactionDepth > 0)
+            {
+                --m_transactionDepth;
+            }
+
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                AZStd::string release = AZStd::string::format("RELEASE nested_%u;", m_transactionDepth);
+                sqlite3_exec(m_db, release.c_str(), NULL, NULL, NULL);
+            }
         }
 
         void Connection::RollbackTransaction()
@@ -241,7 +267,22 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            AZ_Assert(m_transactionDepth > 0, "RollbackTransaction:  No transaction is in progress!");
+            if (m_transactionDepth > 0)
+            {
+                --m_transactionDepth;
+            }
+
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            }
+            else
+            {
+                // only undoes the changes made since the matching BeginTransaction, the outer transaction carries on.
+                AZStd::string rollback = AZStd::string::format("ROLLBACK TO nested_%u; RELEASE nested_%u;", m_transactionDepth, m_transactionDepth);
+                sqlite3_exec(m_db, rollback.c_str(), NULL, NULL, NULL);
+            }
         }
 
         void Connection::Vacuum()
@@ -54,6 +54,8 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
+            //! Transactions can be nested, only the outermost one is written to the database when it commits.
+            //! Rolling back a nested transaction only undoes the changes made since it began.
             void BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
@@ -97,6 +99,7 @@ namespace AzToolsFramework
             sqlite3* m_db;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
+            AZ::u32 m_transactionDepth = 0;
         };
 
         AZStd::string GetColumnText(sqlite3_stmt* statement, int col);
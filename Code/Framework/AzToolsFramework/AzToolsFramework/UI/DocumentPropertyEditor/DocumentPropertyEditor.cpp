@@ -32,6 +32,17 @@ AZ_CVAR(
     AZ::ConsoleFunctorFlags::DontReplicate | AZ::ConsoleFunctorFlags::DontDuplicate,
     "If set, enables experimental DPE-based CVar Editor");
 
+AZ_CVAR(
+    bool,
+    ed_dpeDeferOffscreenRows,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::DontReplicate | AZ::ConsoleFunctorFlags::DontDuplicate,
+    "If set, the DPE only creates the rows that fit on screen immediately and creates the rest in later batches");
+
+// minimum number of rows created in each batch, in case the DPE isn't laid out yet
+static constexpr int MinRowsPerBatch = 32;
+
 static constexpr const char* GetHandlerPropertyName()
 {
     return "handlerId";
@@ -529,7 +540,13 @@ namespace AzToolsFramework
 
         if (childType == AZ::Dpe::GetNodeName<AZ::Dpe::Nodes::Row>())
         {
-            if (IsExpanded())
+            if (IsExpanded() && GetDPE()->ShouldDeferRowCreation())
+            {
+                // leave a null widget at the given DOM index, and create the row in a later batch
+                AddRowChild(nullptr, domIndex);
+                GetDPE()->DeferRowCreation(this, domIndex);
+            }
+            else if (IsExpanded())
             {
                 // create and add the row child to m_domOrderedChildren
                 auto newRow = DocumentPropertyEditor::GetRowPool()->GetInstance();
@@ -1198,6 +1215,13 @@ namespace AzToolsFramework
         DocumentPropertyEditor* dpe = GetDPE();
         bool isExpanded = expanderState != Qt::Unchecked;
 
+        if (!m_expandingProgrammatically)
+        {
+            // the deferred rows must exist before the user changes the hierarchy
+            dpe->FlushDeferredRows();
+            dpe->ResetRowCreationBudget();
+        }
+
         const bool expandRecursively = (!m_expandingProgrammatically && QGuiApplication::keyboardModifiers().testFlag(Qt::ShiftModifier));
         if (!isExpanded)
         {
@@ -1356,6 +1380,8 @@ namespace AzToolsFramework
 
     void DocumentPropertyEditor::Clear()
     {
+        // the parents of the deferred rows are returned to the pool
+        m_deferredRows.clear();
         m_rowPool->RecycleInstance(m_rootNode);
         m_rootNode = nullptr;
     }
@@ -1478,6 +1504,7 @@ namespace AzToolsFramework
 
     void DocumentPropertyEditor::ApplyExpansionStates()
     {
+        FlushDeferredRows();
         auto applyExpansionRecursively =
             [](DPERowWidget* currRow, AZ::Dom::Path rowPath, DocumentPropertyEditor* theDPE, auto&& applyExpansionRecursively) -> void
         {
@@ -1499,16 +1526,21 @@ namespace AzToolsFramework
 
     void DocumentPropertyEditor::ExpandAll()
     {
+        // recursive expansion walks the created rows, so every row is created right away
+        FlushDeferredRows();
+        m_allowDeferredRowCreation = false;
         for (auto child : m_rootNode->m_domOrderedChildren)
         {
             // all direct children of the root are rows
             auto row = static_cast<DPERowWidget*>(child);
             row->SetExpanded(true, true);
         }
+        m_allowDeferredRowCreation = true;
     }
 
     void DocumentPropertyEditor::CollapseAll()
     {
+        FlushDeferredRows();
         for (auto child : m_rootNode->m_domOrderedChildren)
         {
             // all direct children of the root are rows
@@ -1603,10 +1635,98 @@ namespace AzToolsFramework
         m_isRecursiveExpansionOngoing = isExpanding;
     }
 
+    void DocumentPropertyEditor::ResetRowCreationBudget()
+    {
+        // rows are at least one line of text high, so this overestimates the rows that fit on screen
+        const int rowHeightEstimate = AZStd::max(fontMetrics().height(), 1);
+        const int visibleHeight = AZStd::max(viewport()->height(), window()->height());
+        m_rowCreationBudget = AZStd::max(visibleHeight / rowHeightEstimate, MinRowsPerBatch);
+        m_rowsCreatedInBatch = 0;
+    }
+
+    bool DocumentPropertyEditor::ShouldDeferRowCreation()
+    {
+        if (!ed_dpeDeferOffscreenRows || !m_allowDeferredRowCreation || m_isRecursiveExpansionOngoing)
+        {
+            return false;
+        }
+        return m_rowsCreatedInBatch++ >= m_rowCreationBudget;
+    }
+
+    void DocumentPropertyEditor::DeferRowCreation(DPERowWidget* parentRow, size_t domIndex)
+    {
+        m_deferredRows.push_back({ parentRow, domIndex });
+        if (!m_deferredRowsQueued)
+        {
+            m_deferredRowsQueued = true;
+            QTimer::singleShot(0, this, &DocumentPropertyEditor::ProcessDeferredRows);
+        }
+    }
+
+    void DocumentPropertyEditor::ProcessDeferredRows()
+    {
+        m_deferredRowsQueued = false;
+        if (m_deferredRows.empty())
+        {
+            return;
+        }
+
+        // create one more batch; the children of these rows past the budget are deferred again
+        ResetRowCreationBudget();
+        while (!m_deferredRows.empty() && m_rowsCreatedInBatch < m_rowCreationBudget)
+        {
+            const DeferredRow deferredRow = m_deferredRows.front();
+            m_deferredRows.pop_front();
+
+            DPERowWidget* parentRow = deferredRow.m_parentRow;
+            auto& siblings = parentRow->m_domOrderedChildren;
+            if (parentRow->IsExpanded() && deferredRow.m_domIndex < siblings.size() && siblings[deferredRow.m_domIndex] == nullptr)
+            {
+                // counted against the budget by ShouldDeferRowCreation
+                siblings.erase(siblings.begin() + deferredRow.m_domIndex);
+                parentRow->AddChildFromDomValue(GetDomValueForRow(parentRow)[deferredRow.m_domIndex], deferredRow.m_domIndex);
+            }
+        }
+
+        if (!m_deferredRows.empty() && !m_deferredRowsQueued)
+        {
+            m_deferredRowsQueued = true;
+            QTimer::singleShot(0, this, &DocumentPropertyEditor::ProcessDeferredRows);
+        }
+        updateGeometry();
+        emit RequestSizeUpdate();
+    }
+
+    void DocumentPropertyEditor::FlushDeferredRows()
+    {
+        if (m_deferredRows.empty())
+        {
+            return;
+        }
+
+        const bool allowDeferredRowCreation = m_allowDeferredRowCreation;
+        m_allowDeferredRowCreation = false;
+        while (!m_deferredRows.empty())
+        {
+            const DeferredRow deferredRow = m_deferredRows.front();
+            m_deferredRows.pop_front();
+
+            DPERowWidget* parentRow = deferredRow.m_parentRow;
+            auto& siblings = parentRow->m_domOrderedChildren;
+            if (parentRow->IsExpanded() && deferredRow.m_domIndex < siblings.size() && siblings[deferredRow.m_domIndex] == nullptr)
+            {
+                siblings.erase(siblings.begin() + deferredRow.m_domIndex);
+                parentRow->AddChildFromDomValue(GetDomValueForRow(parentRow)[deferredRow.m_domIndex], deferredRow.m_domIndex);
+            }
+        }
+        m_allowDeferredRowCreation = allowDeferredRowCreation;
+    }
+
     void DocumentPropertyEditor::HandleReset()
     {
         // clear any pre-existing DPERowWidgets
         Clear();
+        ResetRowCreationBudget();
 
         // invisible root node has a "depth" of -1; its children are all at indent 0
         m_rootNode = m_rowPool->GetInstance();
@@ -1644,6 +1764,9 @@ namespace AzToolsFramework
 
         if (m_rootNode)
         {
+            // patches address the full row hierarchy, so the deferred rows are created first
+            FlushDeferredRows();
+
             bool needsReset = false;
             for (auto operationIterator = patch.begin(), endIterator = patch.end(); !needsReset && operationIterator != endIterator;
                  ++operationIterator)
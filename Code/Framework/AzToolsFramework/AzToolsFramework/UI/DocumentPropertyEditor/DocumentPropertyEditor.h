@@ -10,6 +10,7 @@
 
 #if !defined(Q_MOC_RUN)
 #include <AzCore/Instance/InstancePool.h>
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzFramework/DocumentPropertyEditor/DocumentAdapter.h>
 #include <AzFramework/DocumentPropertyEditor/ExpanderSettings.h>
@@ -287,6 +288,15 @@ namespace AzToolsFramework
 
         QWidget* GetWidgetAtPath(const AZ::Dom::Path& path);
 
+        //! Starts a new batch of row creation, sized to the rows that fit in the visible area
+        void ResetRowCreationBudget();
+        //! Returns true if the next row should be created in a later batch, because the current batch is full
+        bool ShouldDeferRowCreation();
+        void DeferRowCreation(DPERowWidget* parentRow, size_t domIndex);
+        void ProcessDeferredRows();
+        //! Creates all deferred rows, so that the row hierarchy matches the adapter contents
+        void FlushDeferredRows();
+
         void HandleReset();
         void HandleDomChange(const AZ::Dom::Patch& patch);
         void HandleDomMessage(const AZ::DocumentPropertyEditor::AdapterMessage& message, AZ::Dom::Value& value);
@@ -308,6 +318,19 @@ namespace AzToolsFramework
 
         bool m_isBeingCleared = false;
 
+        // rows past the first screen are created over the next event loop iterations,
+        // so large components show up without waiting for all of their widgets
+        struct DeferredRow
+        {
+            DPERowWidget* m_parentRow = nullptr;
+            size_t m_domIndex = 0;
+        };
+        AZStd::deque<DeferredRow> m_deferredRows;
+        bool m_deferredRowsQueued = false;
+        bool m_allowDeferredRowCreation = true;
+        int m_rowCreationBudget = 0;
+        int m_rowsCreatedInBatch = 0;
+
         // keep pools of frequently used widgets that can be recycled for efficiency without
         // incurring the cost of creating and destroying them
         AZStd::shared_ptr<AZ::InstancePool<DPERowWidget>> m_rowPool;
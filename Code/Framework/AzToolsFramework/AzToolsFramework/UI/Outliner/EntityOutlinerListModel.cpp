@@ -73,6 +73,8 @@
 
 namespace AzToolsFramework
 {
+    //! Number of hierarchy changes applied individually in a frame, before the remaining changes are applied with a model reset.
+    static constexpr int MaxIndividualHierarchyChangesPerFrame = 64;
 
     bool EntityOutlinerListModel::s_paintingName = false;
 
@@ -1072,6 +1074,74 @@ namespace AzToolsFramework
         m_entityChangeQueue.insert(entityId);
     }
 
+    void EntityOutlinerListModel::QueueReapplyFilter()
+    {
+        // entities are often initialized in bulk, only reapply the filter once for all of them
+        m_isFilterDirty = true;
+        if (!m_reapplyFilterQueued)
+        {
+            m_reapplyFilterQueued = true;
+            QTimer::singleShot(
+                0, this,
+                [this]()
+                {
+                    m_reapplyFilterQueued = false;
+                    emit ReapplyFilter();
+                });
+        }
+    }
+
+    bool EntityOutlinerListModel::BeginHierarchyChange(AZ::EntityId parentId)
+    {
+        if (m_hierarchyResetInProgress)
+        {
+            m_hierarchyChangeInReset = true;
+            return true;
+        }
+
+        // ensures the change count is cleared when the updates are processed
+        QueueEntityUpdate(parentId);
+
+        m_hierarchyChangeInReset = ++m_hierarchyChangeCount > MaxIndividualHierarchyChangesPerFrame;
+        if (m_hierarchyChangeInReset)
+        {
+            beginResetModel();
+            m_hierarchyResetInProgress = true;
+        }
+        return m_hierarchyChangeInReset;
+    }
+
+    void EntityOutlinerListModel::EndHierarchyReset()
+    {
+        if (!m_hierarchyResetInProgress)
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AzToolsFramework);
+        m_hierarchyResetInProgress = false;
+        endResetModel();
+
+        // the reset cleared the selection of the views, restore it
+        EntityIdList selectedEntityIds;
+        ToolsApplicationRequests::Bus::BroadcastResult(selectedEntityIds, &ToolsApplicationRequests::GetSelectedEntities);
+        for (AZ::EntityId entityId : selectedEntityIds)
+        {
+            m_entitySelectQueue.insert(entityId);
+            QueueEntityUpdate(entityId);
+
+            //expand ancestors if a new entity is already selected
+            if (m_hierarchyResetAddedEntityIds.contains(entityId) && !m_dropOperationInProgress)
+            {
+                ExpandAncestors(entityId);
+            }
+        }
+        m_hierarchyResetAddedEntityIds.clear();
+
+        m_isFilterDirty = true;
+        emit EnableSelectionUpdates(true);
+    }
+
     void EntityOutlinerListModel::QueueAncestorUpdate(AZ::EntityId entityId)
     {
         //primarily needed for ancestors that reflect child state (selected, locked, hidden)
@@ -1108,6 +1178,10 @@ namespace AzToolsFramework
             return;
         }
         m_entityChangeQueued = false;
+
+        m_hierarchyChangeCount = 0;
+        EndHierarchyReset();
+
         if (m_layoutResetQueued)
         {
             return;
@@ -1159,6 +1233,9 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::OnEntityInfoResetBegin()
     {
+        EndHierarchyReset();
+        m_searchNames.clear();
+
         emit EnableSelectionUpdates(false);
         beginResetModel();
     }
@@ -1185,6 +1262,11 @@ namespace AzToolsFramework
         //add/remove operations trigger selection change signals which assert and break undo/redo operations in progress in inspector etc.
         //so disallow selection updates until change is complete
         emit EnableSelectionUpdates(false);
+        if (BeginHierarchyChange(parentId))
+        {
+            return;
+        }
+
         auto parentIndex = GetIndexFromEntity(parentId);
         auto childIndex = GetIndexFromEntity(childId);
         beginInsertRows(parentIndex, childIndex.row(), childIndex.row());
@@ -1194,6 +1276,14 @@ namespace AzToolsFramework
     {
         (void)parentId;
         AZ_PROFILE_FUNCTION(AzToolsFramework);
+        if (m_hierarchyChangeInReset)
+        {
+            // the selection and expansion are restored when the reset ends
+            m_hierarchyChangeInReset = false;
+            m_hierarchyResetAddedEntityIds.insert(childId);
+            return;
+        }
+
         endInsertRows();
 
         //expand ancestors if a new descendant is already selected
@@ -1252,6 +1342,10 @@ namespace AzToolsFramework
         //add/remove operations trigger selection change signals which assert and break undo/redo operations in progress in inspector etc.
         //so disallow selection updates until change is complete
         emit EnableSelectionUpdates(false);
+        if (BeginHierarchyChange(parentId))
+        {
+            return;
+        }
 
         auto parentIndex = GetIndexFromEntity(parentId);
         auto childIndex = GetIndexFromEntity(childId);
@@ -1260,9 +1354,19 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::OnEntityInfoUpdatedRemoveChildEnd(AZ::EntityId parentId, AZ::EntityId childId)
     {
-        (void)childId;
         AZ_PROFILE_FUNCTION(AzToolsFramework);
 
+        // Remove any cached state of the removed entity.
+        m_searchNames.erase(childId);
+
+        if (m_hierarchyChangeInReset)
+        {
+            m_hierarchyChangeInReset = false;
+            m_hierarchyResetAddedEntityIds.erase(childId);
+            m_entityChangeQueue.erase(childId);
+            return;
+        }
+
         endRemoveRows();
 
         //must refresh partial lock/visibility of parents
@@ -1332,7 +1436,10 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::OnEntityInfoUpdatedName(AZ::EntityId entityId, const AZStd::string& name)
     {
-        (void)name;
+        if (auto searchNameIt = m_searchNames.find(entityId); searchNameIt != m_searchNames.end())
+        {
+            searchNameIt->second = name;
+        }
         QueueEntityUpdate(entityId);
 
         bool isSelected = false;
@@ -1382,6 +1489,15 @@ namespace AzToolsFramework
         }
 
         m_filterString = filter;
+
+        // entities can also be searched by id
+        m_filterStringEntityId.SetInvalid();
+        if (!filter.empty() && AZStd::all_of(filter.begin(), filter.end(), [](char c) { return c >= '0' && c <= '9'; }) &&
+            filter.size() <= AZStd::numeric_limits<AZ::u64>::digits10)
+        {
+            m_filterStringEntityId = AZ::EntityId(AZStd::stoull(filter));
+        }
+
         InvalidateFilter();
 
         RestoreSelectionIfAppropriate();
@@ -1571,11 +1687,8 @@ namespace AzToolsFramework
 
         if (m_filterString.size() > 0)
         {
-            AZStd::string name;
-            EditorEntityInfoRequestBus::EventResult(name, entityId, &EditorEntityInfoRequestBus::Events::GetName);
-
-            if (AzFramework::StringFunc::Find(name.c_str(), m_filterString.c_str()) == AZStd::string::npos
-                && AZStd::to_string(static_cast<AZ::u64>(entityId)) != m_filterString)
+            if (AzFramework::StringFunc::Find(GetSearchName(entityId).c_str(), m_filterString.c_str()) == AZStd::string::npos &&
+                (!m_filterStringEntityId.IsValid() || entityId != m_filterStringEntityId))
             {
                 isFilterMatch = false;
             }
@@ -1685,6 +1798,16 @@ namespace AzToolsFramework
         return isFilterMatch;
     }
 
+    const AZStd::string& EntityOutlinerListModel::GetSearchName(AZ::EntityId entityId)
+    {
+        auto [searchNameIt, inserted] = m_searchNames.try_emplace(entityId);
+        if (inserted)
+        {
+            EditorEntityInfoRequestBus::EventResult(searchNameIt->second, entityId, &EditorEntityInfoRequestBus::Events::GetName);
+        }
+        return searchNameIt->second;
+    }
+
     bool EntityOutlinerListModel::IsFiltered(const AZ::EntityId& entityId) const
     {
         auto hiddenItr = m_entityFilteredState.find(entityId);
@@ -1770,8 +1893,7 @@ namespace AzToolsFramework
 
         if (!m_beginStartPlayInEditor && (m_filterString.size() > 0 || m_componentFilters.size() > 0))
         {
-            m_isFilterDirty = true;
-            emit ReapplyFilter();
+            QueueReapplyFilter();
         }
     }
 
@@ -1779,8 +1901,7 @@ namespace AzToolsFramework
     {
         if (m_componentFilters.size() > 0)
         {
-            m_isFilterDirty = true;
-            emit ReapplyFilter();
+            QueueReapplyFilter();
         }
     }
 
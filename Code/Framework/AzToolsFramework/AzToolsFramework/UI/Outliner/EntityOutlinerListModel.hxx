@@ -193,7 +193,19 @@ namespace AzToolsFramework
         void QueueEntityUpdate(AZ::EntityId entityId);
         void QueueAncestorUpdate(AZ::EntityId entityId);
         void QueueEntityToExpand(AZ::EntityId entityId, bool expand);
+        void QueueReapplyFilter();
         void ProcessEntityInfoResetEnd();
+
+        //! Hierarchy changes past the first few of a frame are applied with a single model reset, ended when the updates
+        //! are processed, so bulk changes (e.g. instantiating a large prefab) don't update the views for every entity.
+        //! @return True if the change is part of the reset and its rows must not be inserted or removed individually.
+        bool BeginHierarchyChange(AZ::EntityId parentId);
+        void EndHierarchyReset();
+        AZStd::unordered_set<AZ::EntityId> m_hierarchyResetAddedEntityIds; //!< Entities added during the reset.
+        int m_hierarchyChangeCount = 0; //!< Hierarchy changes since the updates were last processed.
+        bool m_hierarchyResetInProgress = false;
+        bool m_hierarchyChangeInReset = false; //!< The current hierarchy change is part of the reset.
+        bool m_reapplyFilterQueued = false;
         AZStd::unordered_set<AZ::EntityId> m_entitySelectQueue;
         AZStd::unordered_set<AZ::EntityId> m_entityChangeQueue;
         bool m_entityChangeQueued;
@@ -205,9 +217,15 @@ namespace AzToolsFramework
         bool m_suppressNextSelectEntity = false;
 
         AZStd::string m_filterString;
+        AZ::EntityId m_filterStringEntityId; //!< The entity id matching the filter string, if it is a number.
         AZStd::vector<ComponentTypeValue> m_componentFilters;
         bool m_isFilterDirty = true;
 
+        //! Names of the entities searched by the filter, so filtering doesn't query and copy the name of every entity.
+        //! The names are added the first time an entity is filtered and kept up to date by the name notifications.
+        const AZStd::string& GetSearchName(AZ::EntityId entityId);
+        AZStd::unordered_map<AZ::EntityId, AZStd::string> m_searchNames;
+
         void OnEntityCompositionChanged(const EntityIdList& entityIds) override;
 
         void OnEntityInitialized(const AZ::EntityId& entityId) override;
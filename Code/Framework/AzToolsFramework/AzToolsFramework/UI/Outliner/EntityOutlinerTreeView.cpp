@@ -49,6 +49,8 @@ namespace AzToolsFramework
 
         FocusModeNotificationBus::Handler::BusConnect(editorEntityContextId);
 
+        connect(this, &QTreeView::expanded, this, &EntityOutlinerTreeView::CheckChildExpandedStates);
+
         viewport()->setMouseTracking(true);
     }
 
@@ -64,6 +66,14 @@ namespace AzToolsFramework
         m_expandOnlyDelay = delay;
     }
 
+    void EntityOutlinerTreeView::reset()
+    {
+        AzQtComponents::StyledTreeView::reset();
+
+        // a model reset collapses every row, expand the rows that were expanded again
+        CheckChildExpandedStates(rootIndex());
+    }
+
     void EntityOutlinerTreeView::dataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles)
     {
         AzQtComponents::StyledTreeView::dataChanged(topLeft, bottomRight, roles);
@@ -91,16 +101,21 @@ namespace AzToolsFramework
                 auto modelRow = model()->index(i, EntityOutlinerListModel::ColumnName, parent);
                 if (modelRow.isValid())
                 {
+                    // expanding the row checks the states of its children
                     CheckExpandedState(modelRow);
-                    RecursiveCheckExpandedStates(modelRow);
                 }
             }
         }
         AzQtComponents::StyledTreeView::rowsInserted(parent, start, end);
     }
 
-    void EntityOutlinerTreeView::RecursiveCheckExpandedStates(const QModelIndex& current)
+    void EntityOutlinerTreeView::CheckChildExpandedStates(const QModelIndex& current)
     {
+        if (!model())
+        {
+            return;
+        }
+
         const int rowCount = model()->rowCount(current);
         for (int i = 0; i < rowCount; i++)
         {
@@ -108,7 +123,6 @@ namespace AzToolsFramework
             if (modelRow.isValid())
             {
                 CheckExpandedState(modelRow);
-                RecursiveCheckExpandedStates(modelRow);
             }
         }
     }
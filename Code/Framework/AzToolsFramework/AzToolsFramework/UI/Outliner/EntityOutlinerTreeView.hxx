@@ -48,6 +48,9 @@ namespace AzToolsFramework
 
         void setAutoExpandDelay(int delay);
 
+        // QAbstractItemView overrides ...
+        void reset() override;
+
     Q_SIGNALS:
         void ItemDropped();
 
@@ -84,7 +87,9 @@ namespace AzToolsFramework
         void HandleDrag();
         void StartCustomDrag(const QModelIndexList& indexList, Qt::DropActions supportedActions) override;
 
-        void RecursiveCheckExpandedStates(const QModelIndex& parent);
+        //! Applies the expanded state of the children of an expanded row.
+        //! The descendants of collapsed rows are only visited once their parent is expanded.
+        void CheckChildExpandedStates(const QModelIndex& parent);
         void CheckExpandedState(const QModelIndex& current);
 
         void PaintBranchBackground(QPainter* painter, const QRect& rect, const QModelIndex& index) const;
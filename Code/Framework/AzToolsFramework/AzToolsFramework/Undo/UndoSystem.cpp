@@ -8,6 +8,24 @@
 
 #include "UndoSystem.h"
 
+#include <AzCore/Console/IConsole.h>
+
+AZ_CVAR(
+    int,
+    ed_undoCompactAfterSteps,
+    16,
+    nullptr,
+    AZ::ConsoleFunctorFlags::DontReplicate,
+    "Number of undo steps after which a command is stored in its compact form. Negative values disable compaction.");
+
+AZ_CVAR(
+    int,
+    ed_undoMaxHistorySteps,
+    0,
+    nullptr,
+    AZ::ConsoleFunctorFlags::DontReplicate,
+    "Maximum number of undo steps kept in the history, the oldest ones are dropped past it. 0 keeps the full history.");
+
 namespace AzToolsFramework
 {
     namespace UndoSystem
@@ -59,6 +77,26 @@ namespace AzToolsFramework
             }
         }
 
+        void URSequencePoint::RunCompact()
+        {
+            for (URSequencePoint* child : m_children)
+            {
+                child->RunCompact();
+            }
+
+            Compact();
+        }
+
+        void URSequencePoint::RunRestore()
+        {
+            Restore();
+
+            for (URSequencePoint* child : m_children)
+            {
+                child->RunRestore();
+            }
+        }
+
         void URSequencePoint::Undo()
         {
         }
@@ -67,6 +105,14 @@ namespace AzToolsFramework
         {
         }
 
+        void URSequencePoint::Compact()
+        {
+        }
+
+        void URSequencePoint::Restore()
+        {
+        }
+
         URSequencePoint* URSequencePoint::Find(URCommandID id, const AZ::Uuid& typeOfCommand)
         {
             if (*this == id && this->RTTI_IsTypeOf(typeOfCommand))
@@ -188,6 +234,7 @@ namespace AzToolsFramework
 
             m_SequencePointsBuffer.push_back(cmd);
             m_Cursor = int(m_SequencePointsBuffer.size()) - 1;
+            TrimHistory();
 #ifdef _DEBUG
             CleanCheck();
 #endif
@@ -215,6 +262,7 @@ namespace AzToolsFramework
             //or something... remember if sliced notified then dont notify again maybe
             Slice();
 
+            RestoreAt(m_Cursor);
             URSequencePoint* returned = m_SequencePointsBuffer[m_Cursor];
             m_SequencePointsBuffer.pop_back();
             returned->m_isPosted = false;
@@ -244,6 +292,7 @@ namespace AzToolsFramework
         void UndoStack::Reset()
         {
             m_Cursor = m_CleanPoint = -1;
+            m_compactedCount = 0;
             for (AZStd::size_t idx = 0; idx < m_SequencePointsBuffer.size(); ++idx)
             {
                 if (m_SequencePointsBuffer[idx])
@@ -272,6 +321,7 @@ namespace AzToolsFramework
 
             if (m_Cursor >= 0)
             {
+                RestoreAt(m_Cursor);
                 m_SequencePointsBuffer[m_Cursor]->RunUndo();
                 --m_Cursor;
                 if (m_notify)
@@ -296,6 +346,7 @@ namespace AzToolsFramework
             if (m_Cursor < int(m_SequencePointsBuffer.size()) - 1)
             {
                 ++m_Cursor;
+                RestoreAt(m_Cursor);
                 m_SequencePointsBuffer[m_Cursor]->RunRedo();
 #ifdef _DEBUG
                 CleanCheck();
@@ -330,6 +381,7 @@ namespace AzToolsFramework
                 {
                     m_SequencePointsBuffer.pop_back();
                 }
+                m_compactedCount = AZStd::min(m_compactedCount, int(m_SequencePointsBuffer.size()));
 
                 if (m_CleanPoint > m_Cursor)
                 {
@@ -353,6 +405,8 @@ namespace AzToolsFramework
                 URSequencePoint* cPtr = m_SequencePointsBuffer[idx]->Find(id, typeOfCommand);
                 if (cPtr)
                 {
+                    // the caller may inspect or amend the command
+                    RestoreAt(idx);
                     return cPtr;
                 }
             }
@@ -363,12 +417,61 @@ namespace AzToolsFramework
         {
             if (m_Cursor >= 0)
             {
+                RestoreAt(m_Cursor);
                 return m_SequencePointsBuffer[m_Cursor];
             }
 
             return nullptr;
         }
 
+        void UndoStack::TrimHistory()
+        {
+            if (const int compactAfterSteps = ed_undoCompactAfterSteps; compactAfterSteps >= 0)
+            {
+                const int compactEnd = m_Cursor - compactAfterSteps;
+                for (int idx = m_compactedCount; idx < compactEnd; ++idx)
+                {
+                    m_SequencePointsBuffer[idx]->RunCompact();
+                }
+                m_compactedCount = AZStd::max(m_compactedCount, compactEnd);
+            }
+
+            const int maxHistorySteps = ed_undoMaxHistorySteps;
+            if (maxHistorySteps <= 0 || int(m_SequencePointsBuffer.size()) <= maxHistorySteps)
+            {
+                return;
+            }
+
+            const int droppedCount = int(m_SequencePointsBuffer.size()) - maxHistorySteps;
+            for (int idx = 0; idx < droppedCount; ++idx)
+            {
+                delete m_SequencePointsBuffer[idx];
+            }
+            m_SequencePointsBuffer.erase(m_SequencePointsBuffer.begin(), m_SequencePointsBuffer.begin() + droppedCount);
+
+            m_Cursor -= droppedCount;
+            m_compactedCount = AZStd::max(m_compactedCount - droppedCount, 0);
+            if (m_CleanPoint >= droppedCount - 1)
+            {
+                m_CleanPoint -= droppedCount;
+            }
+            else
+            {
+                // the clean state was dropped with the history, so it can't be reached anymore
+                m_CleanPoint = -2;
+            }
+        }
+
+        void UndoStack::RestoreAt(int index)
+        {
+            if (index < m_compactedCount)
+            {
+                m_SequencePointsBuffer[index]->RunRestore();
+                // the commands above the restored one are compacted again on the next post
+                m_compactedCount = index;
+            }
+        }
+
         bool UndoStack::IsClean() const
         {
             return m_Cursor == m_CleanPoint;
@@ -62,6 +62,13 @@ namespace AzToolsFramework
             void RunUndo();
             void RunRedo();
 
+            /**
+            Usage: compacts or restores this command and all of its children.
+            The undo stack compacts the commands that are deep in the history and restores them before running them.
+            */
+            void RunCompact();
+            void RunRestore();
+
             /**
             Usage: override with class specific actions
             */
@@ -75,6 +82,14 @@ namespace AzToolsFramework
             */
             virtual bool Changed() const = 0;
 
+            /**
+            Usage: override to store the state needed by undo+redo in a compact form, releasing the memory of the
+            expanded state. Compact may be called on a command that's already compacted.
+            Restore must bring back the expanded state before the command is run or inspected again.
+            */
+            virtual void Compact();
+            virtual void Restore();
+
             /**
             Usage: return the first command in the parent/child tree with a matching id
             returns NULL on failure to make any match
@@ -189,8 +204,15 @@ namespace AzToolsFramework
             void CleanCheck();
 #endif
 
+            // compacts the commands that are deep enough below the cursor, and drops the oldest ones past the history limit
+            void TrimHistory();
+            // restores the command at the given index before it is run or handed out
+            void RestoreAt(int index);
+
             int m_Cursor;
             int m_CleanPoint;
+            // the commands below this index have been compacted
+            int m_compactedCount = 0;
 
             typedef AZStd::vector<URSequencePoint*> SequencePointBuffer;
 
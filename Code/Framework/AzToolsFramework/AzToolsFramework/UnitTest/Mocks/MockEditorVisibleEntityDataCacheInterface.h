@@ -34,5 +34,8 @@ namespace UnitTest
         MOCK_CONST_METHOD1(IsVisibleEntityIndividuallySelectableInViewport, bool(size_t));
         MOCK_CONST_METHOD1(IsVisibleEntityInFocusSubTree, bool(size_t));
         MOCK_CONST_METHOD1(GetVisibleEntityIndexFromId, AZStd::optional<size_t>(AZ::EntityId entityId));
+        MOCK_CONST_METHOD5(
+            FindVisibleEntityIndicesIntersectingRay,
+            bool(const AzFramework::CameraState&, int, const AZ::Vector3&, const AZ::Vector3&, AZStd::vector<size_t>&));
     };
 } // namespace UnitTest
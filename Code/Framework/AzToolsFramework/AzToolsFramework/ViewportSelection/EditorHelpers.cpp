@@ -193,6 +193,13 @@ namespace AzToolsFramework
         const AZ::Matrix3x4 cameraView = AzFramework::CameraView(cameraState);
         const AZ::Matrix4x4 cameraProjection = AzFramework::CameraProjection(cameraState);
 
+        // only the entities with selection bounds along the ray need a precise intersection test (icons are tested for every entity)
+        AZStd::vector<size_t> pickCandidateIndices;
+        const bool pickCandidatesFound = m_entityDataCache->FindVisibleEntityIndicesIntersectingRay(
+            cameraState, viewportId, mouseInteraction.m_mouseInteraction.m_mousePick.m_rayOrigin,
+            mouseInteraction.m_mouseInteraction.m_mousePick.m_rayDirection, pickCandidateIndices);
+        size_t nextPickCandidate = 0;
+
         // selecting new entities
         AZ::EntityId entityIdUnderCursor;
         float closestDistance = AZStd::numeric_limits<float>::max();
@@ -202,6 +209,13 @@ namespace AzToolsFramework
         {
             const AZ::EntityId entityId = m_entityDataCache->GetVisibleEntityId(entityCacheIndex);
 
+            bool pickCandidate = !pickCandidatesFound;
+            if (nextPickCandidate < pickCandidateIndices.size() && pickCandidateIndices[nextPickCandidate] == entityCacheIndex)
+            {
+                pickCandidate = true;
+                ++nextPickCandidate;
+            }
+
             if (m_entityDataCache->IsVisibleEntityLocked(entityCacheIndex) || !m_entityDataCache->IsVisibleEntityVisible(entityCacheIndex))
             {
                 continue;
@@ -240,7 +254,7 @@ namespace AzToolsFramework
             }
 
             float closestBoundDifference;
-            if (PickEntity(entityId, mouseInteraction.m_mouseInteraction, closestBoundDifference, viewportId))
+            if (pickCandidate && PickEntity(entityId, mouseInteraction.m_mouseInteraction, closestBoundDifference, viewportId))
             {
                 if (closestBoundDifference < closestDistance)
                 {
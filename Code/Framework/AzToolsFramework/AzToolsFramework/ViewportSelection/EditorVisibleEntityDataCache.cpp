@@ -8,15 +8,32 @@
 
 #include "EditorVisibleEntityDataCache.h"
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Capsule.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/sort.h>
+#include <AzFramework/Visibility/BvhScene.h>
 #include <AzToolsFramework/ContainerEntity/ContainerEntityInterface.h>
 #include <AzToolsFramework/Entity/EditorEntityModel.h>
 #include <AzToolsFramework/FocusMode/FocusModeInterface.h>
 #include <AzToolsFramework/Viewport/ViewportMessages.h>
+#include <AzToolsFramework/ViewportSelection/EditorSelectionUtil.h>
 #include <Entity/EditorEntityHelpers.h>
 
+AZ_CVAR(
+    bool,
+    ed_viewportPickingUseBvh,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Use a bounding volume hierarchy over the cached entity selection bounds to find the entities under the cursor");
+
 namespace AzToolsFramework
 {
+    //! Radius of the capsule used to query the entities along a pick ray.
+    static constexpr float PickRayQueryRadius = 0.01f;
+
     //! Cached Entity data required by the selection.
     struct EntityData final
     {
@@ -55,14 +72,137 @@ namespace AzToolsFramework
         bool operator()(const EntityData& lhs, const EntityData& rhs) const;
     };
 
+    //! Cached selection bounds of a visible entity, inserted in the picking hierarchy.
+    struct EntityPickingEntry final
+    {
+        AzFramework::VisibilityEntry m_visibilityEntry;
+        AZ::EntityId m_entityId;
+        bool m_boundsDirty = true; //!< The selection bounds must be recalculated before the next pick.
+    };
+
     class EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl
     {
     public:
+        void AddPickingEntry(AZ::EntityId entityId);
+        void RemovePickingEntry(AZ::EntityId entityId);
+        void MarkPickingBoundsDirty(AZ::EntityId entityId);
+        void RefreshPickingBounds(const AzFramework::CameraState& cameraState, int viewportId);
+
         EntityIdList m_visibleEntityIds; //!< The EntityIds that are visible this frame.
         EntityIdList m_prevVisibleEntityIds; //!< The EntityIds that were visible the previous frame (unsorted).
         EntityDatas m_visibleEntityDatas; //!< Cached EntityData required by EditorTransformComponentSelection.
+
+        //! Selection bounds of the visible entities, recalculated lazily when an entity changes and picked against
+        //! with m_pickingScene. The entries must outlive the scene (which is destroyed first) as it references them.
+        AZStd::unordered_map<AZ::EntityId, EntityPickingEntry> m_pickingEntries;
+        AZStd::unique_ptr<AzFramework::BvhScene> m_pickingScene; //!< Created on the first pick.
+        EntityIdList m_dirtyPickingEntityIds; //!< Entities with bounds to recalculate (may include removed entities).
+        AZStd::vector<AzFramework::VisibilityEntry*> m_pickingEntryUpdates; //!< Reused to update the scene entries at once.
+        AzFramework::CameraState m_pickingCameraState; //!< The camera the selection bounds were calculated with.
+        int m_pickingViewportId = -1;
+        bool m_allPickingBoundsDirty = true; //!< All the selection bounds must be recalculated before the next pick.
     };
 
+    void EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl::AddPickingEntry(const AZ::EntityId entityId)
+    {
+        EntityPickingEntry& pickingEntry = m_pickingEntries[entityId];
+        pickingEntry.m_visibilityEntry.m_userData = &pickingEntry;
+        pickingEntry.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_Entity;
+        pickingEntry.m_entityId = entityId;
+        pickingEntry.m_boundsDirty = true;
+        m_dirtyPickingEntityIds.push_back(entityId);
+    }
+
+    void EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl::RemovePickingEntry(const AZ::EntityId entityId)
+    {
+        if (auto pickingEntryIt = m_pickingEntries.find(entityId); pickingEntryIt != m_pickingEntries.end())
+        {
+            if (m_pickingScene)
+            {
+                m_pickingScene->RemoveEntry(pickingEntryIt->second.m_visibilityEntry);
+            }
+            m_pickingEntries.erase(pickingEntryIt);
+        }
+    }
+
+    void EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl::MarkPickingBoundsDirty(const AZ::EntityId entityId)
+    {
+        if (auto pickingEntryIt = m_pickingEntries.find(entityId); pickingEntryIt != m_pickingEntries.end() &&
+            !pickingEntryIt->second.m_boundsDirty)
+        {
+            pickingEntryIt->second.m_boundsDirty = true;
+            m_dirtyPickingEntityIds.push_back(entityId);
+        }
+    }
+
+    static bool CameraStatesEqual(const AzFramework::CameraState& lhs, const AzFramework::CameraState& rhs)
+    {
+        return lhs.m_position == rhs.m_position && lhs.m_forward == rhs.m_forward && lhs.m_up == rhs.m_up &&
+            lhs.m_viewportSize == rhs.m_viewportSize && lhs.m_fovOrZoom == rhs.m_fovOrZoom && lhs.m_orthographic == rhs.m_orthographic;
+    }
+
+    void EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl::RefreshPickingBounds(
+        const AzFramework::CameraState& cameraState, const int viewportId)
+    {
+        AZ_PROFILE_FUNCTION(AzToolsFramework);
+
+        if (!m_pickingScene)
+        {
+            m_pickingScene = AZStd::make_unique<AzFramework::BvhScene>(AZ::Name("EditorVisibleEntityPicking"));
+        }
+
+        // some selection bounds depend on the camera (e.g. to keep a constant size on screen)
+        if (viewportId != m_pickingViewportId || !CameraStatesEqual(cameraState, m_pickingCameraState))
+        {
+            m_pickingViewportId = viewportId;
+            m_pickingCameraState = cameraState;
+            m_allPickingBoundsDirty = true;
+        }
+
+        const auto viewportInfo = AzFramework::ViewportInfo{ viewportId };
+        m_pickingEntryUpdates.clear();
+        const auto refreshBounds = [this, &viewportInfo](EntityPickingEntry& pickingEntry)
+        {
+            pickingEntry.m_boundsDirty = false;
+            pickingEntry.m_visibilityEntry.m_boundingVolume = CalculateEditorEntitySelectionBounds(pickingEntry.m_entityId, viewportInfo);
+            if (pickingEntry.m_visibilityEntry.m_boundingVolume.IsValid())
+            {
+                m_pickingEntryUpdates.push_back(&pickingEntry.m_visibilityEntry);
+            }
+            else
+            {
+                // entities without selection bounds can only be picked with their icon
+                m_pickingScene->RemoveEntry(pickingEntry.m_visibilityEntry);
+            }
+        };
+
+        if (m_allPickingBoundsDirty)
+        {
+            for (auto& [entityId, pickingEntry] : m_pickingEntries)
+            {
+                refreshBounds(pickingEntry);
+            }
+        }
+        else
+        {
+            for (AZ::EntityId entityId : m_dirtyPickingEntityIds)
+            {
+                if (auto pickingEntryIt = m_pickingEntries.find(entityId);
+                    pickingEntryIt != m_pickingEntries.end() && pickingEntryIt->second.m_boundsDirty)
+                {
+                    refreshBounds(pickingEntryIt->second);
+                }
+            }
+        }
+        m_dirtyPickingEntityIds.clear();
+        m_allPickingBoundsDirty = false;
+
+        if (!m_pickingEntryUpdates.empty())
+        {
+            m_pickingScene->InsertOrUpdateEntries(m_pickingEntryUpdates);
+        }
+    }
+
     // constructor for EntityData to support emplace_back in vector
     EntityData::EntityData(
         const AZ::EntityId entityId,
@@ -169,6 +309,7 @@ namespace AzToolsFramework
         EditorComponentSelectionNotificationsBus::Router::BusRouterConnect();
         EntitySelectionEvents::Bus::Router::BusRouterConnect();
         EditorEntityIconComponentNotificationBus::Router::BusRouterConnect();
+        PropertyEditorEntityChangeNotificationBus::Router::BusRouterConnect();
         ToolsApplicationNotificationBus::Handler::BusConnect();
 
         AzFramework::EntityContextId editorEntityContextId = AzToolsFramework::GetEntityContextId();
@@ -182,6 +323,7 @@ namespace AzToolsFramework
         FocusModeNotificationBus::Handler::BusDisconnect();
         ContainerEntityNotificationBus::Handler::BusDisconnect();
         ToolsApplicationNotificationBus::Handler::BusDisconnect();
+        PropertyEditorEntityChangeNotificationBus::Router::BusRouterDisconnect();
         EditorEntityIconComponentNotificationBus::Router::BusRouterDisconnect();
         EntitySelectionEvents::Bus::Router::BusRouterDisconnect();
         EditorComponentSelectionNotificationsBus::Router::BusRouterDisconnect();
@@ -203,6 +345,11 @@ namespace AzToolsFramework
             m_impl->m_visibleEntityDatas.push_back(EntityDataFromEntityId(entityId));
         }
 
+        for (AZ::EntityId entityId : entityIds)
+        {
+            m_impl->AddPickingEntry(entityId);
+        }
+
         AZStd::sort(m_impl->m_visibleEntityDatas.begin(), m_impl->m_visibleEntityDatas.end());
     }
 
@@ -252,11 +399,17 @@ namespace AzToolsFramework
                 AZStd::remove_if(m_impl->m_visibleEntityDatas.begin(), m_impl->m_visibleEntityDatas.end(), removePredicate),
                 m_impl->m_visibleEntityDatas.end());
 
+            for (const EntityData& entityData : removed)
+            {
+                m_impl->RemovePickingEntry(entityData.m_entityId);
+            }
+
             // for newly added entities, request their initial state when first cached
             // and add them to our tracked entity data
             for (AZ::EntityId entityId : added)
             {
                 m_impl->m_visibleEntityDatas.push_back(EntityDataFromEntityId(entityId));
+                m_impl->AddPickingEntry(entityId);
             }
 
             // after inserting added elements, ensure we keep the visible entity data in sorted order
@@ -333,6 +486,51 @@ namespace AzToolsFramework
         return {};
     }
 
+    bool EditorVisibleEntityDataCache::FindVisibleEntityIndicesIntersectingRay(
+        const AzFramework::CameraState& cameraState,
+        const int viewportId,
+        const AZ::Vector3& rayOrigin,
+        const AZ::Vector3& rayDirection,
+        AZStd::vector<size_t>& visibleEntityIndices) const
+    {
+        AZ_PROFILE_FUNCTION(AzToolsFramework);
+
+        if (!ed_viewportPickingUseBvh)
+        {
+            return false;
+        }
+
+        m_impl->RefreshPickingBounds(cameraState, viewportId);
+
+        const size_t firstIndex = visibleEntityIndices.size();
+        const AZ::Capsule rayCapsule(rayOrigin, rayOrigin + rayDirection * EditorPickRayLength, PickRayQueryRadius);
+        m_impl->m_pickingScene->Enumerate(
+            rayCapsule,
+            [this, &rayOrigin, &rayDirection, &visibleEntityIndices](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                for (const AzFramework::VisibilityEntry* visibilityEntry : nodeData.m_entries)
+                {
+                    // the nodes are only bounds of the entries, test the ray against each entry
+                    float unused;
+                    if (!AabbIntersectRay(rayOrigin, rayDirection, visibilityEntry->m_boundingVolume, unused))
+                    {
+                        continue;
+                    }
+
+                    const auto* pickingEntry = static_cast<const EntityPickingEntry*>(visibilityEntry->m_userData);
+                    if (AZStd::optional<size_t> entityIndex = GetVisibleEntityIndexFromId(pickingEntry->m_entityId))
+                    {
+                        visibleEntityIndices.push_back(entityIndex.value());
+                    }
+                }
+            });
+
+        // keep the order of the visible entities, so picks resolve ties as when testing every entity
+        AZStd::sort(visibleEntityIndices.begin() + firstIndex, visibleEntityIndices.end());
+
+        return true;
+    }
+
     void EditorVisibleEntityDataCache::AfterUndoRedo()
     {
         // ensure we refresh all EntityData after an undo/redo action as
@@ -341,6 +539,7 @@ namespace AzToolsFramework
         {
             entityData = EntityDataFromEntityId(entityData.m_entityId);
         }
+        m_impl->m_allPickingBoundsDirty = true;
     }
 
     void EditorVisibleEntityDataCache::OnEntityVisibilityChanged(const bool visibility)
@@ -374,6 +573,7 @@ namespace AzToolsFramework
         if (AZStd::optional<size_t> entityIndex = GetVisibleEntityIndexFromId(entityId))
         {
             m_impl->m_visibleEntityDatas[entityIndex.value()].m_worldFromLocal = world;
+            m_impl->MarkPickingBoundsDirty(entityId);
         }
     }
 
@@ -429,6 +629,12 @@ namespace AzToolsFramework
         }
     }
 
+    void EditorVisibleEntityDataCache::OnEntityComponentPropertyChanged(const AZ::ComponentId /*componentId*/)
+    {
+        // component properties (e.g. a shape size or a mesh asset) may change the selection bounds
+        m_impl->MarkPickingBoundsDirty(*PropertyEditorEntityChangeNotificationBus::GetCurrentBusId());
+    }
+
     void EditorVisibleEntityDataCache::OnContainerEntityStatusChanged(AZ::EntityId entityId, [[maybe_unused]] bool open)
     {
         // Get container descendants
@@ -9,7 +9,9 @@
 #pragma once
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/optional.h>
+#include <AzFramework/Viewport/CameraState.h>
 #include <AzToolsFramework/API/ComponentEntitySelectionBus.h>
 #include <AzToolsFramework/ContainerEntity/ContainerEntityNotificationBus.h>
 #include <AzToolsFramework/FocusMode/FocusModeNotificationBus.h>
@@ -17,6 +19,7 @@
 #include <AzToolsFramework/ToolsComponents/EditorLockComponentBus.h>
 #include <AzToolsFramework/ToolsComponents/EditorSelectionAccentSystemComponent.h>
 #include <AzToolsFramework/ToolsComponents/EditorVisibilityBus.h>
+#include <AzToolsFramework/UI/PropertyEditor/PropertyEditorAPI.h>
 
 namespace AzToolsFramework
 {
@@ -44,6 +47,15 @@ namespace AzToolsFramework
         virtual bool IsVisibleEntityIndividuallySelectableInViewport(size_t index) const = 0;
         virtual bool IsVisibleEntityInFocusSubTree(size_t index) const = 0;
         virtual AZStd::optional<size_t> GetVisibleEntityIndexFromId(AZ::EntityId entityId) const = 0;
+        //! Finds the visible entities whose selection bounds intersect the ray, so only they need a precise intersection test.
+        //! The indices are appended to visibleEntityIndices in ascending order.
+        //! @return False if the query is not available and every visible entity should be tested instead.
+        virtual bool FindVisibleEntityIndicesIntersectingRay(
+            const AzFramework::CameraState& cameraState,
+            int viewportId,
+            const AZ::Vector3& rayOrigin,
+            const AZ::Vector3& rayDirection,
+            AZStd::vector<size_t>& visibleEntityIndices) const = 0;
     };
 
     //! A cache of packed EntityData that can be iterated over efficiently without
@@ -56,6 +68,7 @@ namespace AzToolsFramework
         , private EditorComponentSelectionNotificationsBus::Router
         , private EntitySelectionEvents::Bus::Router
         , private EditorEntityIconComponentNotificationBus::Router
+        , private PropertyEditorEntityChangeNotificationBus::Router
         , private ToolsApplicationNotificationBus::Handler
         , private ContainerEntityNotificationBus::Handler
         , private FocusModeNotificationBus::Handler
@@ -85,6 +98,12 @@ namespace AzToolsFramework
         bool IsVisibleEntityIndividuallySelectableInViewport(size_t index) const override;
         bool IsVisibleEntityInFocusSubTree(size_t index) const override;
         AZStd::optional<size_t> GetVisibleEntityIndexFromId(AZ::EntityId entityId) const override;
+        bool FindVisibleEntityIndicesIntersectingRay(
+            const AzFramework::CameraState& cameraState,
+            int viewportId,
+            const AZ::Vector3& rayOrigin,
+            const AZ::Vector3& rayDirection,
+            AZStd::vector<size_t>& visibleEntityIndices) const override;
 
         void AddEntityIds(const EntityIdList& entityIds);
 
@@ -111,6 +130,9 @@ namespace AzToolsFramework
         // EditorEntityIconComponentNotificationBus overrides ...
         void OnEntityIconChanged(const AZ::Data::AssetId& entityIconAssetId) override;
 
+        // PropertyEditorEntityChangeNotificationBus overrides ...
+        void OnEntityComponentPropertyChanged(AZ::ComponentId componentId) override;
+
         // ContainerEntityNotificationBus overrides ...
         void OnContainerEntityStatusChanged(AZ::EntityId entityId, bool open) override;
 
@@ -169,6 +169,26 @@ namespace UnitTest
             });
     }
 
+    TEST_F(InstanceDeserializationTest, DisablingDomCachingReleasesCachedDom)
+    {
+        AZ::Entity* entity1 = CreateEntity("Entity1", false);
+        AZStd::pair<InstanceUniquePointer, InstanceUniquePointer> prefabInstances =
+            SetupPrefabInstances(AzToolsFramework::EntityList{ entity1 }, {}, m_prefabSystemComponent);
+        InstanceUniquePointer createdPrefab = AZStd::move(prefabInstances.first);
+
+        PrefabDom instanceDom;
+        PrefabDomUtils::StoreInstanceInPrefabDom(*createdPrefab, instanceDom);
+        createdPrefab->SetCachedInstanceDom(instanceDom);
+        ASSERT_TRUE(createdPrefab->GetCachedInstanceDom().has_value());
+
+        // A stale cache would make the next selective reload skip changes made while caching was disabled.
+        createdPrefab->EnableDomCaching(false);
+        EXPECT_FALSE(createdPrefab->GetCachedInstanceDom().has_value());
+
+        createdPrefab->SetCachedInstanceDom(instanceDom);
+        EXPECT_FALSE(createdPrefab->GetCachedInstanceDom().has_value());
+    }
+
     TEST_F(InstanceDeserializationTest, ReloadInstanceUponComponentAdd)
     {
         AZ::Entity* entity1 = CreateEntity("Entity1", false);
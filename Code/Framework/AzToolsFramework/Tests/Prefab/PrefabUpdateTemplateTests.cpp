@@ -417,4 +417,210 @@ namespace UnitTest
         // Validate that the axles under the car have the same DOM as the axle template.
         PrefabTestDomUtils::ValidatePrefabDomInstances(axleInstanceAliasesUnderCar, carTemplateDom, axleTemplateDom);
     }
+
+    //! Builds a car with one axle that has two wheels, and gives access to the propagation state of the prefab system component.
+    class PrefabUpdateLinkedInstancesTest
+        : public PrefabTestFixture
+    {
+    protected:
+        inline static const char* WheelEntityName = "WheelEntity";
+        inline static const char* OverriddenWheelEntityName = "OverriddenWheelEntity";
+
+        void TearDownEditorFixtureImpl() override
+        {
+            m_carInstance.reset();
+            m_axleInstance.reset();
+            m_wheelIsolatedInstance.reset();
+
+            PrefabTestFixture::TearDownEditorFixtureImpl();
+        }
+
+        void CreateCarWithTwoWheels()
+        {
+            m_wheelEntity = CreateEntity(WheelEntityName);
+            m_wheelIsolatedInstance = m_prefabSystemComponent->CreatePrefab({ m_wheelEntity }, {}, WheelPrefabMockFilePath);
+            m_wheelTemplateId = m_wheelIsolatedInstance->GetTemplateId();
+            const AZStd::vector<EntityAlias> wheelEntityAliases = m_wheelIsolatedInstance->GetEntityAliases();
+            ASSERT_EQ(wheelEntityAliases.size(), 1);
+            m_wheelEntityAlias = wheelEntityAliases.front();
+
+            AZStd::unique_ptr<Instance> wheel1UnderAxle = m_prefabSystemComponent->InstantiatePrefab(m_wheelTemplateId);
+            AZStd::unique_ptr<Instance> wheel2UnderAxle = m_prefabSystemComponent->InstantiatePrefab(m_wheelTemplateId);
+            m_axleInstance = m_prefabSystemComponent->CreatePrefab({},
+                MakeInstanceList(AZStd::move(wheel1UnderAxle), AZStd::move(wheel2UnderAxle)), AxlePrefabMockFilePath);
+            m_axleTemplateId = m_axleInstance->GetTemplateId();
+            m_wheelInstanceAliasesUnderAxle = m_axleInstance->GetNestedInstanceAliases(m_wheelTemplateId);
+            ASSERT_EQ(m_wheelInstanceAliasesUnderAxle.size(), 2);
+
+            AZStd::unique_ptr<Instance> axleUnderCar = m_prefabSystemComponent->InstantiatePrefab(m_axleTemplateId);
+            m_carInstance = m_prefabSystemComponent->CreatePrefab({},
+                MakeInstanceList(AZStd::move(axleUnderCar)), CarPrefabMockFilePath);
+            m_carTemplateId = m_carInstance->GetTemplateId();
+            m_axleInstanceAliasesUnderCar = m_carInstance->GetNestedInstanceAliases(m_axleTemplateId);
+            ASSERT_EQ(m_axleInstanceAliasesUnderCar.size(), 1);
+        }
+
+        //! Overrides the name of the entity in a wheel under the axle instance, which adds a patch to the link of the wheel.
+        void OverrideWheelEntityName(const InstanceAlias& wheelInstanceAlias, const char* entityName)
+        {
+            InstanceOptionalReference wheelInstance = m_axleInstance->FindNestedInstance(wheelInstanceAlias);
+            ASSERT_TRUE(wheelInstance);
+            EntityOptionalReference wheelEntity = wheelInstance->get().GetEntity(m_wheelEntityAlias);
+            ASSERT_TRUE(wheelEntity);
+
+            PrefabDom entityDomBefore;
+            m_instanceToTemplateInterface->GenerateEntityDomBySerializing(entityDomBefore, wheelEntity->get());
+            wheelEntity->get().SetName(entityName);
+            PrefabDom entityDomAfter;
+            m_instanceToTemplateInterface->GenerateEntityDomBySerializing(entityDomAfter, wheelEntity->get());
+
+            PrefabDom patches;
+            ASSERT_TRUE(m_instanceToTemplateInterface->GeneratePatchForLink(
+                patches, entityDomBefore, entityDomAfter, wheelInstance->get().GetLinkId()));
+            m_instanceToTemplateInterface->ApplyPatchesToInstance(wheelEntity->get().GetId(), patches, *m_axleInstance);
+            m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+        }
+
+        //! Renames the entity of the isolated wheel instance and uses it to update the wheel template.
+        void RenameWheelTemplateEntity(const char* entityName)
+        {
+            // Start from a clean propagation state, so the checks only see the effects of this template update.
+            m_prefabSystemComponent->GarbageCollectTemplates(true);
+
+            m_wheelEntity->SetName(entityName);
+            PrefabDom updatedWheelInstanceDom;
+            ASSERT_TRUE(PrefabDomUtils::StoreInstanceInPrefabDom(*m_wheelIsolatedInstance, updatedWheelInstanceDom));
+            m_prefabSystemComponent->UpdatePrefabTemplate(m_wheelTemplateId, updatedWheelInstanceDom);
+        }
+
+        Instance* FindWheelUnderAxle(size_t wheelIndex)
+        {
+            InstanceOptionalReference wheelInstance = m_axleInstance->FindNestedInstance(m_wheelInstanceAliasesUnderAxle[wheelIndex]);
+            return wheelInstance.has_value() ? &(wheelInstance->get()) : nullptr;
+        }
+
+        Instance* FindWheelUnderCar(size_t wheelIndex)
+        {
+            InstanceOptionalReference axleInstance = m_carInstance->FindNestedInstance(m_axleInstanceAliasesUnderCar.front());
+            if (!axleInstance.has_value())
+            {
+                return nullptr;
+            }
+
+            InstanceOptionalReference wheelInstance =
+                axleInstance->get().FindNestedInstance(m_wheelInstanceAliasesUnderAxle[wheelIndex]);
+            return wheelInstance.has_value() ? &(wheelInstance->get()) : nullptr;
+        }
+
+        bool IsInstanceQueuedForUpdate(Instance* instance) const
+        {
+            const AZStd::unordered_set<Instance*>& queuedInstances =
+                m_prefabSystemComponent->m_instanceUpdateExecutor.m_uniqueInstancesForPropagation;
+            return queuedInstances.find(instance) != queuedInstances.end();
+        }
+
+        //! Templates marked as updated by change propagation are queued for garbage collection.
+        bool IsTemplateMarkedUpdated(TemplateId templateId) const
+        {
+            const AZStd::unordered_set<TemplateId>& updatedTemplates = m_prefabSystemComponent->m_templatesWhichNeedGarbageCollection;
+            return updatedTemplates.find(templateId) != updatedTemplates.end();
+        }
+
+        AZ::Entity* m_wheelEntity = nullptr;
+        EntityAlias m_wheelEntityAlias;
+        AZStd::vector<InstanceAlias> m_wheelInstanceAliasesUnderAxle;
+        AZStd::vector<InstanceAlias> m_axleInstanceAliasesUnderCar;
+        AZStd::unique_ptr<Instance> m_wheelIsolatedInstance;
+        AZStd::unique_ptr<Instance> m_axleInstance;
+        AZStd::unique_ptr<Instance> m_carInstance;
+        TemplateId m_wheelTemplateId = InvalidTemplateId;
+        TemplateId m_axleTemplateId = InvalidTemplateId;
+        TemplateId m_carTemplateId = InvalidTemplateId;
+    };
+
+    TEST_F(PrefabUpdateLinkedInstancesTest, UpdatePrefabTemplate_OverrideMasksChange_InstancesWithUnchangedLinkSkipped)
+    {
+        CreateCarWithTwoWheels();
+
+        // The override on the first wheel already sets the name the wheel template changes to, which masks the change.
+        OverrideWheelEntityName(m_wheelInstanceAliasesUnderAxle[0], OverriddenWheelEntityName);
+        RenameWheelTemplateEntity(OverriddenWheelEntityName);
+
+        // The wheels linked through the unchanged link keep the DOM they were loaded from, so they aren't reloaded.
+        EXPECT_FALSE(IsInstanceQueuedForUpdate(FindWheelUnderAxle(0)));
+        EXPECT_FALSE(IsInstanceQueuedForUpdate(FindWheelUnderCar(0)));
+
+        // The second wheel link changed, and the isolated wheel instance has no link, so these instances are reloaded.
+        EXPECT_TRUE(IsInstanceQueuedForUpdate(FindWheelUnderAxle(1)));
+        EXPECT_TRUE(IsInstanceQueuedForUpdate(FindWheelUnderCar(1)));
+        EXPECT_TRUE(IsInstanceQueuedForUpdate(m_wheelIsolatedInstance.get()));
+    }
+
+    TEST_F(PrefabUpdateLinkedInstancesTest, UpdatePrefabTemplate_NoLinkedInstanceChanged_AncestorTemplatesNotMarkedUpdated)
+    {
+        CreateCarWithTwoWheels();
+
+        OverrideWheelEntityName(m_wheelInstanceAliasesUnderAxle[0], OverriddenWheelEntityName);
+        OverrideWheelEntityName(m_wheelInstanceAliasesUnderAxle[1], OverriddenWheelEntityName);
+
+        PrefabDom axleTemplateDomBeforeUpdate;
+        axleTemplateDomBeforeUpdate.CopyFrom(
+            m_prefabSystemComponent->FindTemplateDom(m_axleTemplateId), axleTemplateDomBeforeUpdate.GetAllocator());
+        PrefabDom carTemplateDomBeforeUpdate;
+        carTemplateDomBeforeUpdate.CopyFrom(
+            m_prefabSystemComponent->FindTemplateDom(m_carTemplateId), carTemplateDomBeforeUpdate.GetAllocator());
+
+        RenameWheelTemplateEntity(OverriddenWheelEntityName);
+
+        // Only the wheel template changed. The propagation stops at the wheel links, so the axle and the car are left alone.
+        EXPECT_TRUE(IsTemplateMarkedUpdated(m_wheelTemplateId));
+        EXPECT_FALSE(IsTemplateMarkedUpdated(m_axleTemplateId));
+        EXPECT_FALSE(IsTemplateMarkedUpdated(m_carTemplateId));
+        EXPECT_EQ(
+            AZ::JsonSerialization::Compare(axleTemplateDomBeforeUpdate, m_prefabSystemComponent->FindTemplateDom(m_axleTemplateId)),
+            AZ::JsonSerializerCompareResult::Equal);
+        EXPECT_EQ(
+            AZ::JsonSerialization::Compare(carTemplateDomBeforeUpdate, m_prefabSystemComponent->FindTemplateDom(m_carTemplateId)),
+            AZ::JsonSerializerCompareResult::Equal);
+
+        EXPECT_FALSE(IsInstanceQueuedForUpdate(FindWheelUnderAxle(0)));
+        EXPECT_FALSE(IsInstanceQueuedForUpdate(FindWheelUnderAxle(1)));
+        EXPECT_FALSE(IsInstanceQueuedForUpdate(FindWheelUnderCar(0)));
+        EXPECT_FALSE(IsInstanceQueuedForUpdate(FindWheelUnderCar(1)));
+        EXPECT_TRUE(IsInstanceQueuedForUpdate(m_wheelIsolatedInstance.get()));
+    }
+
+    TEST_F(PrefabUpdateLinkedInstancesTest, UpdatePrefabTemplate_IntermediateLinkChanged_ChangeReachesNestedTemplates)
+    {
+        CreateCarWithTwoWheels();
+
+        // Only the first wheel link masks the change, so the axle template still changes and passes it on to the car.
+        OverrideWheelEntityName(m_wheelInstanceAliasesUnderAxle[0], OverriddenWheelEntityName);
+        RenameWheelTemplateEntity(OverriddenWheelEntityName);
+
+        EXPECT_TRUE(IsTemplateMarkedUpdated(m_wheelTemplateId));
+        EXPECT_TRUE(IsTemplateMarkedUpdated(m_axleTemplateId));
+        EXPECT_TRUE(IsTemplateMarkedUpdated(m_carTemplateId));
+
+        m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+
+        // Validate that the wheels under the axle have the same DOM as the wheel template.
+        PrefabDom& wheelTemplateDom = m_prefabSystemComponent->FindTemplateDom(m_wheelTemplateId);
+        PrefabDom& axleTemplateDom = m_prefabSystemComponent->FindTemplateDom(m_axleTemplateId);
+        PrefabTestDomUtils::ValidatePrefabDomInstances({ m_wheelInstanceAliasesUnderAxle[1] }, axleTemplateDom, wheelTemplateDom);
+
+        // Validate that the axles under the car have the same DOM as the axle template.
+        PrefabDom& carTemplateDom = m_prefabSystemComponent->FindTemplateDom(m_carTemplateId);
+        PrefabTestDomUtils::ValidatePrefabDomInstances(m_axleInstanceAliasesUnderCar, carTemplateDom, axleTemplateDom);
+
+        // Validate that the wheels nested two levels under the car were reloaded with the renamed entity.
+        for (size_t wheelIndex = 0; wheelIndex < m_wheelInstanceAliasesUnderAxle.size(); ++wheelIndex)
+        {
+            Instance* wheelUnderCar = FindWheelUnderCar(wheelIndex);
+            ASSERT_NE(wheelUnderCar, nullptr);
+            EntityOptionalReference wheelEntityUnderCar = wheelUnderCar->GetEntity(m_wheelEntityAlias);
+            ASSERT_TRUE(wheelEntityUnderCar);
+            EXPECT_EQ(wheelEntityUnderCar->get().GetName(), OverriddenWheelEntityName);
+        }
+    }
 }
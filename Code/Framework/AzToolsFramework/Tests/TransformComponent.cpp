@@ -15,6 +15,7 @@
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 
 #include <AzFramework/Application/Application.h>
+#include <AzFramework/Components/TransformBatchSystem.h>
 #include <AzFramework/Components/TransformComponent.h>
 
 #include <AzToolsFramework/Application/ToolsApplication.h>
@@ -720,6 +721,151 @@ namespace UnitTest
         EXPECT_TRUE(actualChildWorldPos == expectedChildLocalPos);
     }
 
+    // Fixture with a parent and child (from TransformComponentHierarchy) and a transform batch system.
+    class TransformComponentBatch
+        : public TransformComponentHierarchy
+    {
+    protected:
+        void SetUp() override
+        {
+            TransformComponentHierarchy::SetUp();
+
+            // The game entity context provides the batch system when the application activates it
+            m_transformBatch = AZ::Interface<AzFramework::ITransformBatch>::Get();
+            if (!m_transformBatch)
+            {
+                m_batchSystem.Connect();
+                m_transformBatch = &m_batchSystem;
+            }
+
+            TransformBus::Event(m_childId, &TransformBus::Events::SetParent, m_parentId);
+
+            m_childTransformChangedHandler = AZ::TransformChangedEvent::Handler(
+                [this](const AZ::Transform&, const AZ::Transform&)
+                {
+                    ++m_childNotificationCount;
+                });
+            TransformBus::Event(m_childId, &TransformBus::Events::BindTransformChangedEventHandler, m_childTransformChangedHandler);
+        }
+
+        void TearDown() override
+        {
+            m_childTransformChangedHandler.Disconnect();
+            if (m_transformBatch == &m_batchSystem)
+            {
+                m_batchSystem.Disconnect();
+            }
+            TransformComponentHierarchy::TearDown();
+        }
+
+        AzFramework::TransformBatchSystem m_batchSystem;
+        AzFramework::ITransformBatch* m_transformBatch = nullptr;
+        AZ::TransformChangedEvent::Handler m_childTransformChangedHandler;
+        int m_childNotificationCount = 0;
+    };
+
+    TEST_F(TransformComponentBatch, MovingParentInBatch_ChildNotifiesOnceWhenBatchEnds)
+    {
+        const AZ::Vector3 childLocalPos(1.0f, 2.0f, 3.0f);
+        TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, childLocalPos);
+        m_childNotificationCount = 0;
+
+        const AZ::Vector3 parentWorldPos(30.0f, 20.0f, 10.0f);
+        {
+            AzFramework::TransformBatchScope batch;
+            EXPECT_TRUE(m_transformBatch->IsBatching());
+            for (float x = 0.0f; x < 10.0f; x += 1.0f)
+            {
+                TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTranslation, AZ::Vector3(x, 0.0f, 0.0f));
+            }
+            TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTranslation, parentWorldPos);
+
+            // The parent itself is up to date, its children are resolved at the end of the batch
+            AZ::Vector3 batchedParentWorldPos;
+            TransformBus::EventResult(batchedParentWorldPos, m_parentId, &TransformBus::Events::GetWorldTranslation);
+            EXPECT_THAT(batchedParentWorldPos, IsClose(parentWorldPos));
+            EXPECT_EQ(0, m_childNotificationCount);
+        }
+
+        EXPECT_FALSE(m_transformBatch->IsBatching());
+        EXPECT_EQ(1, m_childNotificationCount);
+
+        AZ::Vector3 childWorldPos;
+        TransformBus::EventResult(childWorldPos, m_childId, &TransformBus::Events::GetWorldTranslation);
+        EXPECT_THAT(childWorldPos, IsClose(parentWorldPos + childLocalPos));
+    }
+
+    TEST_F(TransformComponentBatch, MovingParentAndChildInBatch_MatchesUnbatchedResult)
+    {
+        const AZ::Transform childLocalTM = AZ::Transform::CreateTranslation(AZ::Vector3(4.0f, 5.0f, 6.0f));
+        const AZ::Transform parentWorldTM =
+            AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(0.5f), AZ::Vector3(7.0f, 8.0f, 9.0f));
+
+        // Unbatched reference
+        TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTM, childLocalTM);
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTM, parentWorldTM);
+        AZ::Transform expectedChildWorldTM;
+        TransformBus::EventResult(expectedChildWorldTM, m_childId, &TransformBus::Events::GetWorldTM);
+
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTM, AZ::Transform::CreateIdentity());
+        TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTM, AZ::Transform::CreateIdentity());
+        m_childNotificationCount = 0;
+
+        {
+            AzFramework::TransformBatchScope batch;
+            TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTM, childLocalTM);
+            TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTM, parentWorldTM);
+        }
+
+        EXPECT_EQ(1, m_childNotificationCount);
+        AZ::Transform childWorldTM;
+        TransformBus::EventResult(childWorldTM, m_childId, &TransformBus::Events::GetWorldTM);
+        EXPECT_THAT(childWorldTM, IsClose(expectedChildWorldTM));
+    }
+
+    TEST_F(TransformComponentBatch, BatchResolved_ListsChangedEntitiesParentsFirst)
+    {
+        AZStd::vector<AZ::EntityId> resolvedEntities;
+        AzFramework::TransformBatchResolvedEvent::Handler resolvedHandler(
+            [&resolvedEntities](const AZStd::vector<AZ::EntityId>& entities)
+            {
+                resolvedEntities = entities;
+            });
+        m_transformBatch->BindBatchResolvedEventHandler(resolvedHandler);
+
+        {
+            AzFramework::TransformBatchScope batch;
+            TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, AZ::Vector3(1.0f, 0.0f, 0.0f));
+            {
+                AzFramework::TransformBatchScope nestedBatch;
+                TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalTranslation, AZ::Vector3(0.0f, 1.0f, 0.0f));
+            }
+            EXPECT_TRUE(resolvedEntities.empty());
+        }
+
+        EXPECT_EQ((AZStd::vector<AZ::EntityId>{ m_parentId, m_childId }), resolvedEntities);
+    }
+
+    TEST_F(TransformComponentBatch, DeactivatingDirtyEntityInBatch_EntityIsNotResolved)
+    {
+        AZStd::vector<AZ::EntityId> resolvedEntities;
+        AzFramework::TransformBatchResolvedEvent::Handler resolvedHandler(
+            [&resolvedEntities](const AZStd::vector<AZ::EntityId>& entities)
+            {
+                resolvedEntities = entities;
+            });
+        m_transformBatch->BindBatchResolvedEventHandler(resolvedHandler);
+
+        {
+            AzFramework::TransformBatchScope batch;
+            TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, AZ::Vector3(1.0f, 0.0f, 0.0f));
+            m_childEntity->Deactivate();
+        }
+
+        EXPECT_TRUE(resolvedEntities.empty());
+        m_childEntity->Activate();
+    }
+
     // Fixture provides TransformComponent that is static (or not static) on an entity that has been activated.
     template<bool IsStatic>
     class StaticOrMovableTransformComponent
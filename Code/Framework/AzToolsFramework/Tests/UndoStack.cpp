@@ -519,4 +519,62 @@ namespace UnitTest
         EXPECT_EQ(numUndos, counter);
         EXPECT_EQ(tracker, numUndos);
     }
+
+    class UndoCompactTracker : public URSequencePoint
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(UndoCompactTracker, AZ::SystemAllocator)
+        UndoCompactTracker()
+            : URSequencePoint("UndoCompactTracker", 0)
+        {
+        }
+
+        void Undo() override
+        {
+            EXPECT_FALSE(m_compacted) << "A compacted command was undone before being restored";
+            m_undoCalled = true;
+        }
+
+        void Compact() override
+        {
+            m_compacted = true;
+        }
+
+        void Restore() override
+        {
+            m_compacted = false;
+        }
+
+        bool Changed() const override { return true; }
+
+        bool m_compacted = false;
+        bool m_undoCalled = false;
+    };
+
+    TEST(UndoStack, Post_DeepHistory_OldCommandsCompactedAndRestoredBeforeUndo)
+    {
+        UndoStack undoStack(nullptr);
+
+        constexpr int numCommands = 64;
+        AZStd::vector<UndoCompactTracker*> commands;
+        for (int i = 0; i < numCommands; i++)
+        {
+            commands.push_back(aznew UndoCompactTracker());
+            undoStack.Post(commands.back());
+        }
+
+        EXPECT_TRUE(commands.front()->m_compacted);
+        EXPECT_FALSE(commands.back()->m_compacted);
+
+        while (undoStack.CanUndo())
+        {
+            undoStack.Undo();
+        }
+
+        for (const UndoCompactTracker* command : commands)
+        {
+            EXPECT_TRUE(command->m_undoCalled);
+            EXPECT_FALSE(command->m_compacted);
+        }
+    }
 }
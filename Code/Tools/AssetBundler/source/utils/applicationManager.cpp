@@ -15,6 +15,7 @@
 #include <AzCore/Jobs/JobManagerComponent.h>
 #include <AzCore/Module/DynamicModuleHandle.h>
 #include <AzCore/Module/ModuleManagerBus.h>
+#include <AzCore/Serialization/Utils.h>
 #include <AzCore/Slice/SliceSystemComponent.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/StringFunc/StringFunc.h>
@@ -359,6 +360,7 @@ namespace AssetBundler
             MaxBundleSizeArg,
             PlatformArg,
             AllowOverwritesFlag,
+            LoadOrderFileArg,
             VerboseFlag,
             ProjectArg
         };
@@ -1264,7 +1266,20 @@ namespace AssetBundler
             return AZ::Failure(parseSettingsOutcome.GetError());
         }
 
-        return AZ::Success(parseSettingsOutcome.TakeValue());
+        // Read in Load Order File args, which apply to all the Bundles
+        auto loadOrderOutcome = GetArgsList<FilePath>(parser, LoadOrderFileArg, BundlesCommand);
+        if (!loadOrderOutcome.IsSuccess())
+        {
+            return AZ::Failure(loadOrderOutcome.GetError());
+        }
+
+        BundlesParamsList bundleParamsList = parseSettingsOutcome.TakeValue();
+        for (BundlesParams& bundleParams : bundleParamsList)
+        {
+            bundleParams.m_loadOrderFiles = loadOrderOutcome.GetValue();
+        }
+
+        return AZ::Success(AZStd::move(bundleParamsList));
     }
 
     AZ::Outcome<BundleSeedParams, AZStd::string> ApplicationManager::ParseBundleSeedCommandData(const AZ::CommandLine* parser)
@@ -2243,7 +2258,22 @@ namespace AssetBundler
 
                 AZ_TracePrintf(AssetBundler::AppWindowName, "Creating Bundle ( %s )...\n", bundleFilePath.AbsolutePath().c_str());
                 bool result = false;
-                AssetBundleCommandsBus::BroadcastResult(result, &AssetBundleCommandsBus::Events::CreateAssetBundle, bundleSettings.first);
+                if (params.m_loadOrderFiles.empty())
+                {
+                    AssetBundleCommandsBus::BroadcastResult(result, &AssetBundleCommandsBus::Events::CreateAssetBundle, bundleSettings.first);
+                }
+                else
+                {
+                    auto assetFileInfoListOutcome = LoadAssetFileInfoListInLoadOrder(bundleSettings.first, params.m_loadOrderFiles);
+                    if (!assetFileInfoListOutcome.IsSuccess())
+                    {
+                        AZ_Error(AppWindowName, false, assetFileInfoListOutcome.GetError().c_str());
+                        failureCount.fetch_add(1, AZStd::memory_order::memory_order_relaxed);
+                        return;
+                    }
+                    AssetBundleCommandsBus::BroadcastResult(
+                        result, &AssetBundleCommandsBus::Events::CreateAssetBundleFromList, bundleSettings.first, assetFileInfoListOutcome.GetValue());
+                }
                 if (!result)
                 {
                     AZ_Error(AssetBundler::AppWindowName, false, "Unable to create bundle, target Bundle file path is ( %s ).", bundleFilePath.AbsolutePath().c_str());
@@ -2256,6 +2286,40 @@ namespace AssetBundler
         return failureCount == 0;
     }
 
+    AZ::Outcome<AzToolsFramework::AssetFileInfoList, AZStd::string> ApplicationManager::LoadAssetFileInfoListInLoadOrder(
+        const AzToolsFramework::AssetBundleSettings& bundleSettings, const AZStd::vector<FilePath>& loadOrderFiles)
+    {
+        using namespace AzToolsFramework;
+
+        AZStd::vector<AZStd::string> loadOrder;
+        for (const FilePath& loadOrderFile : loadOrderFiles)
+        {
+            auto loadOrderOutcome = LoadAssetLoadOrder(loadOrderFile.AbsolutePath());
+            if (!loadOrderOutcome.IsSuccess())
+            {
+                return AZ::Failure(loadOrderOutcome.TakeError());
+            }
+            loadOrder.insert(loadOrder.end(), loadOrderOutcome.GetValue().begin(), loadOrderOutcome.GetValue().end());
+        }
+
+        // The Asset List path is resolved the same way AssetBundleCommands::CreateAssetBundle resolves it
+        AZ::IO::Path assetFileInfoListPath = AZ::IO::Path(AZStd::string_view{ AZ::Utils::GetEnginePath() }) / bundleSettings.m_assetFileInfoListPath;
+        AssetFileInfoList assetFileInfoList;
+        if (!AZ::Utils::LoadObjectFromFileInPlace(assetFileInfoListPath.Native(), assetFileInfoList))
+        {
+            return AZ::Failure(AZStd::string::format("Failed to load Asset List file ( %s ).", assetFileInfoListPath.c_str()));
+        }
+
+        AzFramework::PlatformId platformId = static_cast<AzFramework::PlatformId>(
+            AzFramework::PlatformHelper::GetPlatformIndexFromName(bundleSettings.m_platform.c_str()));
+        const size_t loadedAssetCount = SortAssetFileInfoListByLoadOrder(
+            assetFileInfoList, loadOrder, PlatformAddressedAssetCatalog::GetAssetRootForPlatform(platformId));
+
+        AZ_TracePrintf(AssetBundler::AppWindowName, "Ordered %zu of the %zu assets of Asset List ( %s ) by their load order.\n",
+            loadedAssetCount, assetFileInfoList.m_fileInfoList.size(), assetFileInfoListPath.c_str());
+        return AZ::Success(AZStd::move(assetFileInfoList));
+    }
+
     bool ApplicationManager::RunBundleSeedCommands(const AZ::Outcome<BundleSeedParams, AZStd::string>& paramsOutcome)
     {
         using namespace AzToolsFramework;
@@ -2867,6 +2931,8 @@ namespace AssetBundler
         AZ_Printf(AppWindowName, "    --%-25s-Specifies the platform(s) that will be referenced when generating Bundles.\n", PlatformArg);
         AZ_Printf(AppWindowName, "%-31s---If no platforms are specified, Bundles will be generated for all available platforms.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Allow destructive overwrites of files. Include this arg in automation.\n", AllowOverwritesFlag);
+        AZ_Printf(AppWindowName, "    --%-25s-Specifies files listing the assets in the order a session loaded them, one path per line.\n", LoadOrderFileArg);
+        AZ_Printf(AppWindowName, "%-31s---Bundles store the listed assets first and in that order, so loading them reads the Bundles sequentially.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Specifies the game project to use rather than the current default project set in bootstrap.cfg's project_path.\n", ProjectArg);
     }
 
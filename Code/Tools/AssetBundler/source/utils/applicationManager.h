@@ -144,6 +144,9 @@ namespace AssetBundler
         AzFramework::PlatformFlags m_platformFlags = AzFramework::PlatformFlags::Platform_NONE;
 
         bool m_allowOverwrites = false;
+
+        //! Files listing the assets in the order sessions loaded them, which the Bundles store their assets in
+        AZStd::vector<FilePath> m_loadOrderFiles;
     };
 
     typedef AZStd::vector<BundlesParams> BundlesParamsList;
@@ -262,6 +265,9 @@ namespace AssetBundler
         AZ::Outcome<void, AZStd::string> ParseComparisonTypesAndPatternsForEditCommand(const AzFramework::CommandLine* parser, ComparisonRulesParams& params);
         AZ::Outcome<void, AZStd::string> ParseComparisonRulesFirstAndSecondInputArgs(const AzFramework::CommandLine* parser, ComparisonRulesParams& params);
         AZ::Outcome<BundlesParamsList, AZStd::string> ParseBundleSettingsAndOverrides(const AzFramework::CommandLine* parser, const char* commandName);
+        //! Loads the Asset List of the Bundle Settings, with the assets sorted by the order the load order files list them in
+        AZ::Outcome<AzToolsFramework::AssetFileInfoList, AZStd::string> LoadAssetFileInfoListInLoadOrder(
+            const AzToolsFramework::AssetBundleSettings& bundleSettings, const AZStd::vector<FilePath>& loadOrderFiles);
         bool ConvertRulesParamsToComparisonData(const ComparisonRulesParams& params, AzToolsFramework::AssetFileInfoListComparison& assetListComparison, size_t startingIndex);
         bool EditComparisonData(const ComparisonRulesParams& params, AzToolsFramework::AssetFileInfoListComparison& assetListComparison, size_t index);
         void PrintComparisonRules(const AzToolsFramework::AssetFileInfoListComparison& assetListComparison, const AZStd::string& comparisonRulesAbsoluteFilePath);
@@ -19,6 +19,7 @@
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/regex.h>
 #include <AzCore/Utils/Utils.h>
 #include <cctype>
@@ -99,6 +100,7 @@ namespace AssetBundler
 
     // Bundles
     const char* BundlesCommand = "bundles";
+    const char* LoadOrderFileArg = "loadOrderFile";
 
     // Bundle Seed
     const char* BundleSeedCommand = "bundleSeed";
@@ -789,6 +791,109 @@ namespace AssetBundler
         return false;
     }
 
+    namespace Internal
+    {
+        //! Converts a path of the load order or of the Asset List to the lowercase relative path of the asset
+        AZStd::string GetLoadOrderKey(AZStd::string_view assetPath, AZStd::string_view assetRoot)
+        {
+            constexpr AZStd::string_view ProductsAlias = "@products@/";
+
+            AZStd::string key(AZ::StringFunc::StripEnds(assetPath, " \t"));
+            AZStd::replace(key.begin(), key.end(), AZ_WRONG_FILESYSTEM_SEPARATOR, AZ_CORRECT_FILESYSTEM_SEPARATOR);
+            AZStd::to_lower(key.begin(), key.end());
+
+            AZStd::string_view relativePath = key;
+            if (relativePath.starts_with(ProductsAlias))
+            {
+                relativePath.remove_prefix(ProductsAlias.size());
+            }
+            else if (!assetRoot.empty())
+            {
+                AZStd::string rootKey(assetRoot);
+                AZStd::replace(rootKey.begin(), rootKey.end(), AZ_WRONG_FILESYSTEM_SEPARATOR, AZ_CORRECT_FILESYSTEM_SEPARATOR);
+                AZStd::to_lower(rootKey.begin(), rootKey.end());
+                if (!rootKey.ends_with(AZ_CORRECT_FILESYSTEM_SEPARATOR))
+                {
+                    rootKey.push_back(AZ_CORRECT_FILESYSTEM_SEPARATOR);
+                }
+                if (relativePath.starts_with(rootKey))
+                {
+                    relativePath.remove_prefix(rootKey.size());
+                }
+            }
+
+            while (relativePath.starts_with("./"))
+            {
+                relativePath.remove_prefix(2);
+            }
+            return AZStd::string(relativePath);
+        }
+    } // namespace Internal
+
+    AZ::Outcome<AZStd::vector<AZStd::string>, AZStd::string> LoadAssetLoadOrder(const AZStd::string& loadOrderFilePath)
+    {
+        auto readOutcome = AZ::Utils::ReadFile<AZStd::string>(loadOrderFilePath);
+        if (!readOutcome.IsSuccess())
+        {
+            return AZ::Failure(AZStd::string::format(
+                "Unable to read Load Order file ( %s ): %s", loadOrderFilePath.c_str(), readOutcome.GetError().c_str()));
+        }
+
+        AZStd::vector<AZStd::string> loadOrder;
+        AZ::StringFunc::TokenizeVisitor(
+            readOutcome.GetValue(),
+            [&loadOrder](AZStd::string_view line)
+            {
+                line = AZ::StringFunc::StripEnds(line, " \t");
+                if (!line.empty() && !line.starts_with('#'))
+                {
+                    loadOrder.emplace_back(line);
+                }
+            },
+            "\r\n");
+        return AZ::Success(AZStd::move(loadOrder));
+    }
+
+    size_t SortAssetFileInfoListByLoadOrder(
+        AzToolsFramework::AssetFileInfoList& assetFileInfoList,
+        const AZStd::vector<AZStd::string>& loadOrder,
+        AZStd::string_view assetRoot)
+    {
+        // Only the first load of an asset counts, later loads of it are most often served from memory
+        AZStd::unordered_map<AZStd::string, size_t> loadIndices;
+        for (const AZStd::string& loadedPath : loadOrder)
+        {
+            loadIndices.emplace(Internal::GetLoadOrderKey(loadedPath, assetRoot), loadIndices.size());
+        }
+
+        constexpr size_t NotLoaded = AZStd::numeric_limits<size_t>::max();
+        AZStd::vector<AZStd::pair<size_t, AzToolsFramework::AssetFileInfo>> rankedAssets;
+        rankedAssets.reserve(assetFileInfoList.m_fileInfoList.size());
+        size_t loadedAssetCount = 0;
+        for (AzToolsFramework::AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
+        {
+            auto loadIndexIt = loadIndices.find(Internal::GetLoadOrderKey(assetFileInfo.m_assetRelativePath, {}));
+            const size_t loadIndex = loadIndexIt != loadIndices.end() ? loadIndexIt->second : NotLoaded;
+            loadedAssetCount += loadIndex != NotLoaded ? 1 : 0;
+            rankedAssets.emplace_back(loadIndex, AZStd::move(assetFileInfo));
+        }
+
+        AZStd::stable_sort(
+            rankedAssets.begin(),
+            rankedAssets.end(),
+            [](const auto& lhs, const auto& rhs)
+            {
+                return lhs.first < rhs.first;
+            });
+
+        assetFileInfoList.m_fileInfoList.clear();
+        for (auto& [loadIndex, assetFileInfo] : rankedAssets)
+        {
+            assetFileInfoList.m_fileInfoList.emplace_back(AZStd::move(assetFileInfo));
+        }
+        return loadedAssetCount;
+    }
+
     QJsonObject ReadJson(const AZStd::string& filePath)
     {
         QByteArray byteArray;
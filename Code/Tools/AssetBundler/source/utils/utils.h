@@ -110,6 +110,7 @@ namespace AssetBundler
     ////////////////////////////////////////////////////////////////////////////////////////////
     // Bundles
     extern const char* BundlesCommand;
+    extern const char* LoadOrderFileArg;
     ////////////////////////////////////////////////////////////////////////////////////////////
 
     ////////////////////////////////////////////////////////////////////////////////////////////
@@ -285,4 +286,20 @@ namespace AssetBundler
         const AZStd::string& filePatternType);
     bool LooksLikePath(const AZStd::string& inputString);
     bool LooksLikeWildcardPattern(const AZStd::string& inputPattern);
+
+    //! Reads a load order file, which lists the product assets a session loaded in the order they were first loaded,
+    //! one path per line. Paths can be relative to the asset cache of the platform, start with the @products@ alias
+    //! or be absolute paths in the asset cache. Empty lines and lines starting with '#' are ignored.
+    AZ::Outcome<AZStd::vector<AZStd::string>, AZStd::string> LoadAssetLoadOrder(const AZStd::string& loadOrderFilePath);
+
+    //! Moves the assets of the Asset List that are in the load order to its front, in the order they were first loaded.
+    //! Bundles store their files in the order of the Asset List, so the assets a level loads together end up next to
+    //! each other, and loading them reads the bundle mostly sequentially instead of seeking across it.
+    //! The assets that weren't loaded keep their relative order after them.
+    //! @param assetRoot the asset cache folder of the platform, stripped from the absolute paths of the load order
+    //! @return the number of assets of the Asset List that are in the load order
+    size_t SortAssetFileInfoListByLoadOrder(
+        AzToolsFramework::AssetFileInfoList& assetFileInfoList,
+        const AZStd::vector<AZStd::string>& loadOrder,
+        AZStd::string_view assetRoot = {});
 }
@@ -11,6 +11,7 @@
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
 #include <Utils/Utils.h>
 #include <AzFramework/IO/LocalFileIO.h>
 
@@ -156,4 +157,38 @@ namespace AssetBundler
         EXPECT_FALSE(LooksLikeWildcardPattern("test"));
         EXPECT_FALSE(LooksLikeWildcardPattern("test/path.xml"));
     }
+
+    TEST_F(MockUtilsTest, SortAssetFileInfoListByLoadOrder_LoadedAssetsFirst_InFirstLoadOrder)
+    {
+        AzToolsFramework::AssetFileInfoList assetFileInfoList;
+        for (const char* assetPath : { "a.azmodel", "b.azmaterial", "c.dds", "levels/d/d.spawnable", "e.azmodel" })
+        {
+            assetFileInfoList.m_fileInfoList.emplace_back().m_assetRelativePath = assetPath;
+        }
+
+        const AZStd::string assetRoot = "/cache/pc";
+        const AZStd::vector<AZStd::string> loadOrder = {
+            "@products@/levels/d/d.spawnable", "/cache/pc/E.azmodel", "c.dds", "e.azmodel", "unlisted.azmodel" };
+        EXPECT_EQ(3, SortAssetFileInfoListByLoadOrder(assetFileInfoList, loadOrder, assetRoot));
+
+        const AZStd::vector<AZStd::string> expectedOrder = { "levels/d/d.spawnable", "e.azmodel", "c.dds", "a.azmodel", "b.azmaterial" };
+        ASSERT_EQ(expectedOrder.size(), assetFileInfoList.m_fileInfoList.size());
+        for (size_t index = 0; index < expectedOrder.size(); ++index)
+        {
+            EXPECT_EQ(expectedOrder[index], assetFileInfoList.m_fileInfoList[index].m_assetRelativePath);
+        }
+    }
+
+    TEST_F(MockUtilsTest, LoadAssetLoadOrder_SkipsEmptyLinesAndComments)
+    {
+        AZ::IO::Path loadOrderFilePath = AZ::IO::Path(GetTempDir()) / "loadorder.txt";
+        ASSERT_TRUE(AZ::Utils::WriteFile("# Level load\r\nlevels/d/d.spawnable\n\n  c.dds  \n", loadOrderFilePath.Native()));
+
+        auto loadOrderOutcome = LoadAssetLoadOrder(loadOrderFilePath.Native());
+        ASSERT_TRUE(loadOrderOutcome.IsSuccess());
+        const AZStd::vector<AZStd::string> expectedLoadOrder = { "levels/d/d.spawnable", "c.dds" };
+        EXPECT_EQ(expectedLoadOrder, loadOrderOutcome.GetValue());
+
+        EXPECT_FALSE(LoadAssetLoadOrder((AZ::IO::Path(GetTempDir()) / "missing.txt").Native()).IsSuccess());
+    }
 }
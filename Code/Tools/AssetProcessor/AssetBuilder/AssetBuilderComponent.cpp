@@ -13,6 +13,7 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Serialization/Utils.h>
@@ -54,6 +55,7 @@ static const char* const s_paramDebugProcess = "debug_process"; // Debug mode fo
 static const char* const s_paramPlatformTags = "tags"; // Additional list of tags to add platform tag list.
 static const char* const s_paramPlatform = "platform"; // Platform to use
 static const char* const s_paramRegisterBuilders = "register"; // Indicates the AP is starting up and requesting a list of registered builders
+static const char* const s_paramRemote = "remote"; // For resident mode, indicates the builder runs on another machine than the AP and can't access its files.
 
 // Task modes:
 static const char* const s_taskResident = "resident"; // stays up and running indefinitely, accepting jobs via network connection
@@ -148,6 +150,9 @@ void AssetBuilderComponent::PrintHelp()
     AZ_TracePrintf("Help", "%s - For resident mode, the path to the builder dll folder, otherwise the full path to a single builder dll to use.\n", s_paramModule);
     AZ_TracePrintf("Help", "%s - Optional, port number to use to connect to the AP.\n", s_paramPort);
     AZ_TracePrintf("Help", "%s - UUID string that identifies the builder.  Only used for resident mode when the AP directly starts up the AssetBuilder.\n", s_paramId);
+    AZ_TracePrintf("Help", "%s - Optional, IP address to use to connect to the AP.\n", s_paramIp);
+    AZ_TracePrintf("Help", "%s - For resident mode, indicates the builder runs on another machine than the AP and can't access its files.\n", s_paramRemote);
+    AZ_TracePrintf("Help", "  Job inputs and outputs are then sent over the connection.  Requires the AP to allow unmanaged builder connections.\n");
     AZ_TracePrintf("Help", "%s - For non-resident mode, full path to the file containing the serialized job request.\n", s_paramInput);
     AZ_TracePrintf("Help", "%s - For non-resident mode, full path to the file to write the job response to.\n", s_paramOutput);
     AZ_TracePrintf("Help", "%s - Debug mode for the create and process job of the specified file.\n", s_paramDebug);
@@ -215,12 +220,14 @@ bool AssetBuilderComponent::DoHelloPing()
 
     AZStd::string id;
 
-    if (!GetParameter(s_paramId, id))
+    // Remote builders aren't started by the AP, it assigns them an ID when they connect
+    if (!GetParameter(s_paramId, id, !m_remote) && !m_remote)
     {
         return false;
     }
 
-    request.m_uuid = AZ::Uuid::CreateString(id.c_str());
+    request.m_uuid = id.empty() ? AZ::Uuid::CreateNull() : AZ::Uuid::CreateString(id.c_str());
+    request.m_remote = m_remote;
 
     AZ_TracePrintf(
         "AssetBuilderComponent", "RunInResidentMode: Pinging asset processor with the builder UUID %s\n",
@@ -295,6 +302,7 @@ bool AssetBuilderComponent::Run()
     AZ_Error("AssetBuilder", connectedToAssetProcessor, "Failed to establish a network connection to the AssetProcessor. Use -help for options.");
 
     bool registerBuilders = commandLine->GetNumSwitchValues(s_paramRegisterBuilders) > 0;
+    m_remote = commandLine->HasSwitch(s_paramRemote);
 
     IBuilderApplication* builderApplication = AZ::Interface<IBuilderApplication>::Get();
 
@@ -757,6 +765,110 @@ void AssetBuilderComponent::ProcessJob(const AssetBuilderSDK::ProcessJobFunction
     UpdateResultCode(request, outResponse);
 }
 
+void AssetBuilderComponent::ProcessRemoteJob(
+    const AssetBuilderSDK::ProcessJobFunction& job,
+    AssetBuilder::ProcessJobNetRequest& netRequest,
+    AssetBuilder::ProcessJobNetResponse& netResponse)
+{
+    // Every job gets its own sandbox folder, so it only sees the inputs sent for it and none of the files of previous jobs
+    const AZ::IO::Path sandboxFolder =
+        AZ::IO::Path(m_gameCache) / "RemoteJobs" / AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false);
+
+    if (UnpackRemoteJobInputs(netRequest, sandboxFolder))
+    {
+        ProcessJob(job, netRequest.m_request, netResponse.m_response);
+
+        if (netResponse.m_response.m_resultCode == AssetBuilderSDK::ProcessJobResult_Success &&
+            !PackRemoteJobOutputs(netRequest.m_request, netResponse))
+        {
+            netResponse.m_response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+            netResponse.m_outputFiles.clear();
+        }
+    }
+    else
+    {
+        netResponse.m_response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+    }
+
+    AZ::IO::FileIOBase::GetInstance()->DestroyPath(sandboxFolder.c_str());
+}
+
+bool AssetBuilderComponent::UnpackRemoteJobInputs(AssetBuilder::ProcessJobNetRequest& netRequest, const AZ::IO::Path& sandboxFolder) const
+{
+    // Inputs keep their absolute path on the AP machine under the sandbox folder, so relative references between them still resolve
+    const AZ::IO::Path inputsFolder = sandboxFolder / "Inputs";
+    auto toSandboxPath = [&inputsFolder](const AZStd::string& path)
+    {
+        return (inputsFolder / AZ::IO::PathView(path).RelativePath()).LexicallyNormal().String();
+    };
+
+    for (const AssetBuilder::JobFile& inputFile : netRequest.m_inputFiles)
+    {
+        auto writeResult = AZ::Utils::WriteFile(
+            AZStd::span(reinterpret_cast<const AZStd::byte*>(inputFile.m_data.data()), inputFile.m_data.size()),
+            toSandboxPath(inputFile.m_path));
+        if (!writeResult.IsSuccess())
+        {
+            AZ_Error("AssetBuilder", false, "Failed to write remote job input: %s", writeResult.GetError().c_str());
+            return false;
+        }
+    }
+
+    AssetBuilderSDK::ProcessJobRequest& request = netRequest.m_request;
+    request.m_fullPath = toSandboxPath(request.m_fullPath);
+    request.m_watchFolder = toSandboxPath(request.m_watchFolder);
+    for (AssetBuilderSDK::SourceFileDependency& dependency : request.m_sourceFileDependencyList)
+    {
+        if (dependency.m_sourceDependencyType == AssetBuilderSDK::SourceFileDependency::SourceFileDependencyType::Absolute)
+        {
+            dependency.m_sourceFileDependencyPath = toSandboxPath(dependency.m_sourceFileDependencyPath);
+        }
+    }
+
+    // The temp folder of the AP doesn't exist on this machine, products are written to the sandbox instead and sent back
+    const AZ::IO::Path tempFolder = sandboxFolder / "Temp";
+    if (!AZ::IO::SystemFile::CreateDir(tempFolder.c_str()))
+    {
+        AZ_Error("AssetBuilder", false, "Failed to create remote job temp folder %s", tempFolder.c_str());
+        return false;
+    }
+    request.m_tempDirPath = tempFolder.String();
+
+    return true;
+}
+
+bool AssetBuilderComponent::PackRemoteJobOutputs(
+    const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilder::ProcessJobNetResponse& netResponse) const
+{
+    const AZ::IO::Path tempFolder = AZ::IO::Path(request.m_tempDirPath).LexicallyNormal();
+
+    for (AssetBuilderSDK::JobProduct& product : netResponse.m_response.m_outputProducts)
+    {
+        // Products are relative to the temp folder or absolute paths in it, the AP reads the relative paths from its own temp folder
+        const AZ::IO::Path productPath = (tempFolder / product.m_productFileName).LexicallyNormal();
+        if (!productPath.IsRelativeTo(tempFolder))
+        {
+            AZ_Error("AssetBuilder", false, "Product %s of remote job is not in the job temp folder and can't be sent to the Asset Processor",
+                product.m_productFileName.c_str());
+            return false;
+        }
+
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<AZ::u8>>(productPath.Native());
+        if (!readResult.IsSuccess())
+        {
+            AZ_Error("AssetBuilder", false, "Failed to read remote job product: %s", readResult.GetError().c_str());
+            return false;
+        }
+
+        AssetBuilder::JobFile& outputFile = netResponse.m_outputFiles.emplace_back();
+        outputFile.m_path = productPath.LexicallyRelative(tempFolder).String();
+        outputFile.m_data = readResult.TakeValue();
+        product.m_productFileName = outputFile.m_path;
+    }
+
+    return true;
+}
+
 bool AssetBuilderComponent::RunOneShotTask(const AZStd::string& task)
 {
     AZ_TracePrintf("AssetBuilderComponent", "RunOneShotTask - running one-shot task [%s]\n", task.c_str());
@@ -990,7 +1102,14 @@ void AssetBuilderComponent::JobThread()
                         AZ_Warning("AssetBuilder", false, "Failed to retrieve IToolsAssetCatalog interface, cannot set current platform");
                     }
 
-                    ProcessJob(assetBuilderDescIt->second->m_processJobFunction, netRequest->m_request, netResponse->m_response);
+                    if (m_remote)
+                    {
+                        ProcessRemoteJob(assetBuilderDescIt->second->m_processJobFunction, *netRequest, *netResponse);
+                    }
+                    else
+                    {
+                        ProcessJob(assetBuilderDescIt->second->m_processJobFunction, netRequest->m_request, netResponse->m_response);
+                    }
                 }
                 else
                 {
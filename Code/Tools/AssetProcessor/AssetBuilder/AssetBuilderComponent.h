@@ -11,12 +11,19 @@
 #include <AssetBuilderSDK/AssetBuilderBusses.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzFramework/Network/SocketConnection.h>
 #include <AzToolsFramework/Application/ToolsApplication.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 #include "AssetBuilderInfo.h"
 
+namespace AssetBuilder
+{
+    class ProcessJobNetRequest;
+    class ProcessJobNetResponse;
+}
+
 //! This bus is used to signal to the AssetBuilderComponent to start up and execute while providing a return code
 class BuilderBusTraits
     : public AZ::EBusTraits
@@ -122,6 +129,15 @@ protected:
 
     void ProcessJob(const AssetBuilderSDK::ProcessJobFunction& job, const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& outResponse);
 
+    //! Runs a job sent to a remote builder in a sandbox folder holding the job inputs sent by the AP, and adds the products to the response
+    void ProcessRemoteJob(const AssetBuilderSDK::ProcessJobFunction& job, AssetBuilder::ProcessJobNetRequest& netRequest, AssetBuilder::ProcessJobNetResponse& netResponse);
+
+    //! Writes the job inputs to the sandbox folder and points the request at them
+    bool UnpackRemoteJobInputs(AssetBuilder::ProcessJobNetRequest& netRequest, const AZ::IO::Path& sandboxFolder) const;
+
+    //! Adds the products of the job to the response and makes their paths relative to the job temp folder
+    bool PackRemoteJobOutputs(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilder::ProcessJobNetResponse& netResponse) const;
+
     //! If needed looks at collected data and updates the result code from the job accordingly.
     void UpdateResultCode(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response) const;
 
@@ -162,4 +178,7 @@ protected:
     AZStd::string m_gameName;
     AZStd::string m_projectPath;
     AZStd::string m_gameCache;
+
+    //! Indicates the builder runs on another machine than the AP, so job inputs and outputs are sent over the connection
+    bool m_remote = false;
 };
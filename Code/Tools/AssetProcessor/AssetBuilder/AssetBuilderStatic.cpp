@@ -19,6 +19,7 @@ namespace AssetBuilder
         BuilderHelloResponse::Reflect(context);
         CreateJobsNetRequest::Reflect(context);
         CreateJobsNetResponse::Reflect(context);
+        JobFile::Reflect(context);
         ProcessJobNetRequest::Reflect(context);
         ProcessJobNetResponse::Reflect(context);
     }
@@ -38,7 +39,10 @@ namespace AssetBuilder
         auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
         if (serialize)
         {
-            serialize->Class<BuilderHelloRequest>()->Version(1)->Field("UUID", &BuilderHelloRequest::m_uuid);
+            serialize->Class<BuilderHelloRequest>()
+                ->Version(2)
+                ->Field("UUID", &BuilderHelloRequest::m_uuid)
+                ->Field("Remote", &BuilderHelloRequest::m_remote);
         }
     }
 
@@ -108,12 +112,27 @@ namespace AssetBuilder
         return CreateJobsNetRequest::MessageType();
     }
 
+    void JobFile::Reflect(AZ::ReflectContext* context)
+    {
+        auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serialize)
+        {
+            serialize->Class<JobFile>()
+                ->Version(1)
+                ->Field("Path", &JobFile::m_path)
+                ->Field("Data", &JobFile::m_data);
+        }
+    }
+
     void ProcessJobNetRequest::Reflect(AZ::ReflectContext* context)
     {
         auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
         if (serialize)
         {
-            serialize->Class<ProcessJobNetRequest>()->Version(1)->Field("Request", &ProcessJobNetRequest::m_request);
+            serialize->Class<ProcessJobNetRequest>()
+                ->Version(2)
+                ->Field("Request", &ProcessJobNetRequest::m_request)
+                ->Field("InputFiles", &ProcessJobNetRequest::m_inputFiles);
         }
     }
 
@@ -134,7 +153,10 @@ namespace AssetBuilder
         auto serialize = azrtti_cast<AZ::SerializeContext*>(context);
         if (serialize)
         {
-            serialize->Class<ProcessJobNetResponse>()->Version(1)->Field("Response", &ProcessJobNetResponse::m_response);
+            serialize->Class<ProcessJobNetResponse>()
+                ->Version(2)
+                ->Field("Response", &ProcessJobNetResponse::m_response)
+                ->Field("OutputFiles", &ProcessJobNetResponse::m_outputFiles);
         }
     }
 
@@ -31,6 +31,10 @@ namespace AssetBuilder
 
         //! Unique ID assigned to this builder to identify it
         AZ::Uuid m_uuid = AZ::Uuid::CreateNull();
+
+        //! Indicates the builder runs on another machine and can't access the AP's files, so job inputs and outputs are sent
+        //! along with the job messages
+        bool m_remote = false;
     };
 
     //! BuilderHelloResponse contains the AssetProcessor's response to a builder connection attempt, indicating if it is accepted and the ID
@@ -79,6 +83,19 @@ namespace AssetBuilder
         AssetBuilderSDK::CreateJobsResponse m_response;
     };
 
+    //! JobFile holds the contents of a file sent along with a job to or from a remote builder
+    struct JobFile
+    {
+        AZ_CLASS_ALLOCATOR(JobFile, AZ::OSAllocator);
+        AZ_TYPE_INFO(JobFile, "{6B0E4A0C-2D7F-4C55-9B0A-8F3E61D2C7A4}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! For job inputs, the absolute path of the file on the AP machine.  For job outputs, the path relative to the job temp folder
+        AZStd::string m_path;
+        AZStd::vector<AZ::u8> m_data;
+    };
+
     class ProcessJobNetRequest : public AzFramework::AssetSystem::BaseAssetProcessorMessage
     {
     public:
@@ -91,6 +108,9 @@ namespace AssetBuilder
         unsigned int GetMessageType() const override;
 
         AssetBuilderSDK::ProcessJobRequest m_request;
+
+        //! Source file and source dependencies of the job, only sent to remote builders
+        AZStd::vector<JobFile> m_inputFiles;
     };
 
     class ProcessJobNetResponse : public AzFramework::AssetSystem::BaseAssetProcessorMessage
@@ -104,6 +124,9 @@ namespace AssetBuilder
         unsigned int GetMessageType() const override;
 
         AssetBuilderSDK::ProcessJobResponse m_response;
+
+        //! Products of the job, only sent by remote builders
+        AZStd::vector<JobFile> m_outputFiles;
     };
 
     //////////////////////////////////////////////////////////////////////////
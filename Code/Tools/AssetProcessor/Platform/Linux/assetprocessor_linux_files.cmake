@@ -10,4 +10,5 @@ set(FILES
     native/FileWatcher/FileWatcher_linux.cpp
     native/FileWatcher/FileWatcher_linux.h
     native/FileWatcher/FileWatcher_platform.h
+    native/utilities/AvailableMemory_linux.cpp
 )
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/AvailableMemory.h>
+
+#include <stdio.h>
+
+namespace AssetProcessor
+{
+    AZStd::optional<AZ::u64> GetAvailablePhysicalMemory()
+    {
+        // MemAvailable accounts for the page cache and reclaimable slabs, unlike the free memory reported by sysinfo.
+        FILE* memInfo = fopen("/proc/meminfo", "r");
+        if (!memInfo)
+        {
+            return AZStd::nullopt;
+        }
+
+        AZStd::optional<AZ::u64> availableMemory;
+        char line[256];
+        while (fgets(line, sizeof(line), memInfo))
+        {
+            unsigned long long availableKiB = 0;
+            if (sscanf(line, "MemAvailable: %llu kB", &availableKiB) == 1)
+            {
+                availableMemory = static_cast<AZ::u64>(availableKiB) * 1024;
+                break;
+            }
+        }
+        fclose(memInfo);
+        return availableMemory;
+    }
+} // namespace AssetProcessor
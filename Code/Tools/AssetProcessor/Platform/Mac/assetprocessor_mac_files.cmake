@@ -10,4 +10,5 @@ set(FILES
     native/FileWatcher/FileWatcher_macos.cpp
     native/FileWatcher/FileWatcher_mac.h
     native/FileWatcher/FileWatcher_platform.h
+    native/utilities/AvailableMemory_mac.cpp
 )
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/AvailableMemory.h>
+
+#include <mach/mach.h>
+
+namespace AssetProcessor
+{
+    AZStd::optional<AZ::u64> GetAvailablePhysicalMemory()
+    {
+        vm_size_t pageSize = 0;
+        if (host_page_size(mach_host_self(), &pageSize) != KERN_SUCCESS)
+        {
+            return AZStd::nullopt;
+        }
+
+        vm_statistics64_data_t vmStats;
+        mach_msg_type_number_t count = HOST_VM_INFO64_COUNT;
+        if (host_statistics64(mach_host_self(), HOST_VM_INFO64, reinterpret_cast<host_info64_t>(&vmStats), &count) != KERN_SUCCESS)
+        {
+            return AZStd::nullopt;
+        }
+
+        // inactive and purgeable pages are reclaimed by the OS before it starts compressing or swapping.
+        const AZ::u64 availablePages = static_cast<AZ::u64>(vmStats.free_count) + vmStats.inactive_count + vmStats.purgeable_count;
+        return availablePages * pageSize;
+    }
+} // namespace AssetProcessor
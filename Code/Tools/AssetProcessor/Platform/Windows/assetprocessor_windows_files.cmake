@@ -10,4 +10,5 @@ set(FILES
     native/FileWatcher/FileWatcher_platform.h
     native/FileWatcher/FileWatcher_windows.cpp
     native/FileWatcher/FileWatcher_windows.h
+    native/utilities/AvailableMemory_windows.cpp
 )
@@ -83,6 +83,7 @@ set(FILES
     native/utilities/AssetUtilEBusHelper.h
     native/utilities/assetUtils.cpp
     native/utilities/assetUtils.h
+    native/utilities/AvailableMemory.h
     native/utilities/BuilderConfigurationBus.h
     native/utilities/BuilderConfigurationManager.cpp
     native/utilities/BuilderConfigurationManager.h
@@ -1540,6 +1540,23 @@ namespace AssetProcessor
         }
     }
 
+    AssetDatabaseConnection::ScopedWriteBatch::ScopedWriteBatch(AssetDatabaseConnection& connection)
+        : m_connection(connection.m_databaseConnection)
+    {
+        if (m_connection)
+        {
+            m_connection->BeginTransaction();
+        }
+    }
+
+    AssetDatabaseConnection::ScopedWriteBatch::~ScopedWriteBatch()
+    {
+        if (m_connection)
+        {
+            m_connection->CommitTransaction();
+        }
+    }
+
     bool AssetDatabaseConnection::GetScanFolderByScanFolderID(AZ::s64 scanfolderID, ScanFolderDatabaseEntry& entry)
     {
         bool found = false;
@@ -45,6 +45,22 @@ namespace AssetProcessor
         }
         void VacuumAndAnalyze();
 
+        //! Groups the writes made during its lifetime into a single transaction, so that the database only syncs them
+        //! to disk once. Each write still commits or rolls back on its own, and the batch commits whatever succeeded
+        //! when it goes out of scope, so it makes writes cheaper without making them atomic.
+        class ScopedWriteBatch
+        {
+        public:
+            explicit ScopedWriteBatch(AssetDatabaseConnection& connection);
+            ~ScopedWriteBatch();
+
+            ScopedWriteBatch(const ScopedWriteBatch&) = delete;
+            ScopedWriteBatch& operator=(const ScopedWriteBatch&) = delete;
+
+        private:
+            AzToolsFramework::SQLite::Connection* m_connection = nullptr;
+        };
+
     protected:
         void CreateStatements() override;
         bool PostOpenDatabase(bool ignoreFutureAssetDBVersionError) override;
@@ -38,6 +38,7 @@ namespace AssetProcessor
             }
 
             m_platforms.push_back(QString::fromUtf8(info.m_identifier.c_str()));
+            m_dirtyPlatforms.insert(m_platforms.back());
         }
 
         [[maybe_unused]] bool computedCacheRoot = AssetUtilities::ComputeProjectCacheRoot(m_cacheRoot);
@@ -89,6 +90,7 @@ namespace AssetProcessor
             m_catalogIsDirty = true;
             {
                 QMutexLocker locker(&m_registriesMutex);
+                m_dirtyPlatforms.insert(assetPlatform);
                 m_registries[message.m_platform.c_str()].RegisterAsset(assetInfo.m_assetId, assetInfo);
                 m_registries[assetPlatform].SetAssetDependencies(message.m_assetId, message.m_dependencies);
 
@@ -132,6 +134,7 @@ namespace AssetProcessor
             if (found != m_registries[assetPlatform].m_assetIdToInfo.end())
             {
                 m_catalogIsDirty = true;
+                m_dirtyPlatforms.insert(assetPlatform);
 
                 m_registries[assetPlatform].UnregisterAsset(message.m_assetId);
 
@@ -290,9 +293,21 @@ namespace AssetProcessor
                 AzFramework::AssetRegistry::ReflectSerialize(serializeContext);
             }
 
+            // only the catalogs of the platforms which changed since they were last saved are written out again.
+            QSet<QString> dirtyPlatforms;
+            {
+                QMutexLocker locker(&m_registriesMutex);
+                dirtyPlatforms.swap(m_dirtyPlatforms);
+            }
+
             // save out a catalog for each platform
             for (const QString& platform : m_platforms)
             {
+                if (!dirtyPlatforms.contains(platform))
+                {
+                    continue;
+                }
+
                 // Serialize out the catalog to a memory buffer, and then dump that memory buffer to stream.
                 QElapsedTimer timer;
                 timer.start();
@@ -314,6 +329,9 @@ namespace AssetProcessor
                 if (!AssetUtilities::CreateTempWorkspace(workSpace))
                 {
                     AZ_Warning(AssetProcessor::ConsoleChannel, false, "Failed to create a temp workspace for catalog writing\n");
+
+                    QMutexLocker locker(&m_registriesMutex);
+                    m_dirtyPlatforms.insert(platform);
                 }
                 else
                 {
@@ -352,11 +370,20 @@ namespace AssetProcessor
                         {
                             AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Saved %s catalog containing %u assets in %fs\n", platform.toUtf8().constData(), m_registries[platform].m_assetIdToInfo.size(), timer.elapsed() / 1000.0f);
                         }
+                        else
+                        {
+                            // try this platform again on the next save.
+                            QMutexLocker locker(&m_registriesMutex);
+                            m_dirtyPlatforms.insert(platform);
+                        }
                     }
                     else
                     {
                         AZ_Warning(AssetProcessor::ConsoleChannel, false, "Failed to create catalog file %s", tempRegistryFile.toUtf8().constData());
                         allCatalogsSaved = false;
+
+                        QMutexLocker locker(&m_registriesMutex);
+                        m_dirtyPlatforms.insert(platform);
                     }
 
                     AZ::IO::FileIOBase::GetInstance()->DestroyPath(workSpace.toUtf8().data());
@@ -460,6 +487,7 @@ namespace AssetProcessor
 
             for (QString platform : m_platforms)
             {
+                m_dirtyPlatforms.insert(platform);
                 auto inserted = m_registries.insert(platform, AzFramework::AssetRegistry());
                 AzFramework::AssetRegistry& currentRegistry = inserted.value();
                 // list of source entries in the database that need to have their UUID updated
@@ -658,6 +686,7 @@ namespace AssetProcessor
         {
             QMutexLocker locker(&m_registriesMutex);
             m_registries[platform].RegisterAssetDependency(assetId, newDependency);
+            m_dirtyPlatforms.insert(platform);
             message.m_dependencies = AZStd::move(m_registries[platform].GetAssetDependencies(assetId));
         }
 
@@ -16,6 +16,7 @@
 #include <QTimer>
 #include <QStringList>
 #include <QHash>
+#include <QSet>
 #include <QDir>
 #include "native/AssetDatabase/AssetDatabase.h"
 #include "native/assetprocessor.h"
@@ -194,6 +195,7 @@ namespace AssetProcessor
 
         QMutex m_registriesMutex;
         QHash<QString, AzFramework::AssetRegistry> m_registries; // per platform.
+        QSet<QString> m_dirtyPlatforms; // platforms whose registry changed since it was last saved, guarded by m_registriesMutex.
         AssetProcessor::PlatformConfiguration* m_platformConfig;
         QStringList m_platforms;
         AZStd::unique_ptr<AssetDatabaseConnection> m_db;
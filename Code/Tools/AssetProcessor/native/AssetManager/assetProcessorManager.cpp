@@ -50,6 +50,17 @@ namespace AssetProcessor
     using namespace AzToolsFramework::AssetSystem;
     using namespace AzFramework::AssetSystem;
 
+    //! Name of the stat the duration of a job is recorded under, the last recorded duration is used to estimate the next one.
+    static QString GetProcessJobStatName(const JobEntry& jobEntry)
+    {
+        return QString("ProcessJob,%1,%2,%3,%4,%5")
+            .arg(jobEntry.m_sourceAssetReference.ScanFolderPath().c_str())
+            .arg(jobEntry.m_sourceAssetReference.RelativePath().c_str())
+            .arg(jobEntry.m_jobKey)
+            .arg(jobEntry.m_platformInfo.m_identifier.c_str())
+            .arg(jobEntry.m_builderGuid.ToString<AZStd::string>().c_str());
+    }
+
     AssetProcessorManager::AssetProcessorManager(AssetProcessor::PlatformConfiguration* config, QObject* parent)
         : QObject(parent)
         , m_platformConfig(config)
@@ -240,12 +251,7 @@ namespace AssetProcessor
         }
         else
         {
-            QString statKey = QString("ProcessJob,%1,%2,%3,%4,%5")
-                                  .arg(jobEntry.m_sourceAssetReference.ScanFolderPath().c_str())
-                                  .arg(jobEntry.m_sourceAssetReference.RelativePath().c_str())
-                                  .arg(jobEntry.m_jobKey)
-                                  .arg(jobEntry.m_platformInfo.m_identifier.c_str())
-                                  .arg(jobEntry.m_builderGuid.ToString<AZStd::string>().c_str());
+            QString statKey = GetProcessJobStatName(jobEntry);
 
             if (status == JobStatus::InProgress)
             {
@@ -1533,6 +1539,10 @@ namespace AssetProcessor
                 auto& pair = newProducts[productIdx];
                 auto pathDependencies = AZStd::move(pair.second->m_pathDependencies);
 
+                // the product, its legacy sub ids and its dependencies are written in one batch, which is committed
+                // before anyone is notified about the product so that they find it in the database.
+                AZStd::optional<AssetDatabaseConnection::ScopedWriteBatch> writeBatch(AZStd::in_place, *m_stateData);
+
                 AZStd::vector<AssetBuilderSDK::ProductDependency> resolvedDependencies;
                 m_pathDependencyManager->ResolveDependencies(pathDependencies, resolvedDependencies, job.m_platform, pair.first.m_productName);
 
@@ -1589,6 +1599,7 @@ namespace AssetProcessor
 
                 // Save any unresolved dependencies
                 m_pathDependencyManager->SaveUnresolvedDependenciesToDatabase(pathDependencies, pair.first, job.m_platform);
+                writeBatch.reset();
 
                 // now we need notify everyone about the new products
                 AzToolsFramework::AssetDatabase::ProductDatabaseEntry& newProduct = pair.first;
@@ -3929,6 +3940,12 @@ namespace AssetProcessor
         // Check to see whether we need to process this asset
         if (AnalyzeJob(job))
         {
+            // the duration of the last run lets the queue start the longest chains of dependent jobs first.
+            AzToolsFramework::AssetDatabase::StatDatabaseEntryContainer jobStats;
+            if (m_stateData->GetStatByStatName(GetProcessJobStatName(job.m_jobEntry), jobStats))
+            {
+                job.m_estimatedDurationMs = jobStats.front().m_statValue;
+            }
             Q_EMIT AssetToProcess(job);
         }
         else
@@ -10,6 +10,7 @@
 #include "native/utilities/PlatformConfiguration.h"
 #include <QDir>
 #include <QtConcurrent/QtConcurrentFilter>
+#include <QtConcurrent/QtConcurrentMap>
 
 using namespace AssetProcessor;
 
@@ -35,10 +36,27 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
-    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
+    // the scan folders are walked in parallel, most of the scan time is spent waiting on the file system, then their results
+    // are merged in scan folder order so that files found by several scan folders keep the one of the first
+    const int scanFolderCount = m_platformConfiguration->GetScanFolderCount();
+    QVector<ScanResult> scanResults(scanFolderCount);
+    QVector<int> scanFolderIndices(scanFolderCount);
+    for (int idx = 0; idx < scanFolderCount; idx++)
+    {
+        scanFolderIndices[idx] = idx;
+    }
+
+    QtConcurrent::blockingMap(scanFolderIndices, [this, &scanResults](int idx)
     {
         const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
+        ScanForSourceFiles(scanFolderInfo, scanFolderInfo, scanResults[idx]);
+    });
+
+    for (ScanResult& scanResult : scanResults)
+    {
+        m_fileList.unite(scanResult.m_fileList);
+        m_folderList.unite(scanResult.m_folderList);
+        m_excludedList.unite(scanResult.m_excludedList);
     }
 
     // we want not to emit any signals until we're finished scanning
@@ -72,7 +90,7 @@ void AssetScannerWorker::StopScan()
     m_doScan = false;
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder, ScanResult& result)
 {
     if (!m_doScan)
     {
@@ -135,13 +153,13 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
 
                 if (m_platformConfiguration->IsFileExcludedRelPath(relPath))
                 {
-                    m_excludedList.insert(AZStd::move(assetFileInfo));
+                    result.m_excludedList.insert(AZStd::move(assetFileInfo));
                     continue;
                 }
 
                 // Entry is a directory
                 // The AP needs to know about all directories so it knows when a delete occurs if the path refers to a folder or a file
-                m_folderList.insert(AZStd::move(assetFileInfo));
+                result.m_folderList.insert(AZStd::move(assetFileInfo));
 
                 // recurse into this folder.
                 // Since we only care about source files, we can skip cache folders that are not the Intermediate Assets Folder.
@@ -173,11 +191,11 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
                 {
                     if (!m_platformConfiguration->IsFileExcludedRelPath(relPath))
                     {
-                        m_fileList.insert(AZStd::move(assetFileInfo));
+                        result.m_fileList.insert(AZStd::move(assetFileInfo));
                     }
                     else
                     {
-                        m_excludedList.insert(AZStd::move(assetFileInfo));
+                        result.m_excludedList.insert(AZStd::move(assetFileInfo));
                     }
                 }
             }
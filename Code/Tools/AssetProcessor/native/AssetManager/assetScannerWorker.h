@@ -43,9 +43,17 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
+        //! What the scan of one scan folder found, each scan folder is scanned on its own thread.
+        struct ScanResult
+        {
+            QSet<AssetFileInfo> m_fileList;
+            QSet<AssetFileInfo> m_folderList;
+            QSet<AssetFileInfo> m_excludedList;
+        };
+
         // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
         // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder, ScanResult& result);
         void EmitFiles();
 
     private:
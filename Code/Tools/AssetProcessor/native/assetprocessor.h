@@ -222,6 +222,8 @@ namespace AssetProcessor
 
         bool m_critical = false;
         int m_priority = -1;
+        // how long the last run of this job took in milliseconds, from the recorded job stats. 0 when it never ran.
+        AZ::s64 m_estimatedDurationMs = 0;
         // indicates whether we need to check the server first for the outputs of this job
         // before we start processing locally
         bool m_checkServer = false;
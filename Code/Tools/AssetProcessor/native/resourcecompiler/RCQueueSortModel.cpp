@@ -11,6 +11,35 @@
 
 namespace AssetProcessor
 {
+    namespace
+    {
+        bool IsOrderDependency(const JobDependencyInternal& jobDependencyInternal)
+        {
+            return jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order ||
+                jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce ||
+                jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnly;
+        }
+
+        QueueElementID GetDependencyElementId(const JobDependencyInternal& jobDependencyInternal)
+        {
+            const AssetBuilderSDK::JobDependency& jobDependency = jobDependencyInternal.m_jobDependency;
+            AZ_Assert(
+                AZ::IO::PathView(jobDependency.m_sourceFile.m_sourceFileDependencyPath).IsAbsolute(),
+                "Dependency path %s is not an absolute path",
+                jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str());
+            return QueueElementID(
+                SourceAssetReference(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str()),
+                jobDependency.m_platformIdentifier.c_str(),
+                jobDependency.m_jobKey.c_str());
+        }
+
+        //! Jobs that never ran count as taking a millisecond, so that the critical path still favors long chains of them.
+        AZ::s64 GetJobCost(const RCJob* rcJob)
+        {
+            return AZStd::max<AZ::s64>(rcJob->GetEstimatedDuration(), 1);
+        }
+    } // namespace
+
     RCQueueSortModel::RCQueueSortModel(QObject* parent)
         : QSortFilterProxyModel(parent)
     {
@@ -93,19 +122,9 @@ namespace AssetProcessor
                 bool canProcessJob = true;
                 for (const JobDependencyInternal& jobDependencyInternal : actualJob->GetJobDependencies())
                 {
-                    if (jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order ||
-                        jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce ||
-                        jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnly)
+                    if (IsOrderDependency(jobDependencyInternal))
                     {
-                        const AssetBuilderSDK::JobDependency& jobDependency = jobDependencyInternal.m_jobDependency;
-                        AZ_Assert(
-                            AZ::IO::PathView(jobDependency.m_sourceFile.m_sourceFileDependencyPath).IsAbsolute(),
-                            "Dependency path %s is not an absolute path",
-                            jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str());
-                        QueueElementID elementId(
-                            SourceAssetReference(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str()),
-                            jobDependency.m_platformIdentifier.c_str(),
-                            jobDependency.m_jobKey.c_str());
+                        QueueElementID elementId = GetDependencyElementId(jobDependencyInternal);
 
                         if (m_sourceModel->isInFlight(elementId) || m_sourceModel->isInQueue(elementId))
                         {
@@ -273,6 +292,13 @@ namespace AssetProcessor
             return priorityLeft > priorityRight;
         }
 
+        // start the jobs heading the longest chains of dependent jobs first, so that those chains don't end up
+        // running one job at a time once everything else has finished.
+        if (leftJob->GetCriticalPathDuration() != rightJob->GetCriticalPathDuration())
+        {
+            return leftJob->GetCriticalPathDuration() > rightJob->GetCriticalPathDuration();
+        }
+
         if (leftJob->GetJobEntry().m_sourceAssetReference == rightJob->GetJobEntry().m_sourceAssetReference)
         {
             // If there are two jobs for the same source, then sort by job run key.
@@ -311,11 +337,71 @@ namespace AssetProcessor
     void RCQueueSortModel::AddJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
         m_currentJobRunKeyToJobEntries[rcJob->GetJobEntry().m_jobRunKey] = rcJob;
+        m_currentJobsByElementId.insert(rcJob->GetElementID(), rcJob);
+
+        // jobs queued earlier may already be waiting on this one.
+        AZ::s64 longestDependentPath = 0;
+        for (const RCJob* dependentJob : m_currentDependentJobsByElementId.values(rcJob->GetElementID()))
+        {
+            longestDependentPath = AZStd::max(longestDependentPath, dependentJob->GetCriticalPathDuration());
+        }
+        rcJob->SetCriticalPathDuration(GetJobCost(rcJob) + longestDependentPath);
+
+        for (const JobDependencyInternal& jobDependencyInternal : rcJob->GetJobDependencies())
+        {
+            if (IsOrderDependency(jobDependencyInternal))
+            {
+                m_currentDependentJobsByElementId.insert(GetDependencyElementId(jobDependencyInternal), rcJob);
+            }
+        }
+
+        QSet<RCJob*> jobsOnPath;
+        jobsOnPath.insert(rcJob);
+        UpdateCriticalPathsOfDependencies(rcJob, jobsOnPath);
     }
 
     void RCQueueSortModel::RemoveJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
         m_currentJobRunKeyToJobEntries.erase(rcJob->GetJobEntry().m_jobRunKey);
+        m_currentJobsByElementId.remove(rcJob->GetElementID(), rcJob);
+
+        // the critical paths of the jobs this one depended on are left as they are, they are only used as a
+        // heuristic and those jobs have usually started by the time this one finishes.
+        for (const JobDependencyInternal& jobDependencyInternal : rcJob->GetJobDependencies())
+        {
+            if (IsOrderDependency(jobDependencyInternal))
+            {
+                m_currentDependentJobsByElementId.remove(GetDependencyElementId(jobDependencyInternal), rcJob);
+            }
+        }
+    }
+
+    void RCQueueSortModel::UpdateCriticalPathsOfDependencies(RCJob* rcJob, QSet<RCJob*>& jobsOnPath)
+    {
+        for (const JobDependencyInternal& jobDependencyInternal : rcJob->GetJobDependencies())
+        {
+            if (!IsOrderDependency(jobDependencyInternal))
+            {
+                continue;
+            }
+
+            for (RCJob* dependencyJob : m_currentJobsByElementId.values(GetDependencyElementId(jobDependencyInternal)))
+            {
+                const AZ::s64 pathThroughJob = GetJobCost(dependencyJob) + rcJob->GetCriticalPathDuration();
+                if (pathThroughJob <= dependencyJob->GetCriticalPathDuration() || jobsOnPath.contains(dependencyJob))
+                {
+                    continue;
+                }
+
+                dependencyJob->SetCriticalPathDuration(pathThroughJob);
+                // the queue is only sorted again when a job is pulled from it.
+                m_dirtyNeedsResort = true;
+
+                jobsOnPath.insert(dependencyJob);
+                UpdateCriticalPathsOfDependencies(dependencyJob, jobsOnPath);
+                jobsOnPath.remove(dependencyJob);
+            }
+        }
     }
 
     void RCQueueSortModel::OnEscalateJobs(AssetProcessor::JobIdEscalationList jobIdEscalationList)
@@ -10,10 +10,12 @@
 
 #if !defined(Q_MOC_RUN)
 #include <QSortFilterProxyModel>
+#include <QMultiHash>
 #include <QSet>
 #include <QString>
 
 
+#include "native/resourcecompiler/RCCommon.h"
 #include "native/utilities/AssetUtilEBusHelper.h"
 #include <AzCore/std/containers/unordered_map.h>
 #include "native/assetprocessor.h"
@@ -33,7 +35,7 @@ namespace AssetProcessor
     //!  * Critical (currently Copy) jobs for currently connected platforms
     //!  * Jobs in Sync Compile Requests for currently connected platforms (with most recent requests first)
     //!  * Jobs in Async Compile Lists for currently connected platforms
-    //!  * Remaining jobs in currently connected platforms, in priority order
+    //!  * Remaining jobs in currently connected platforms, in priority order, then heading the longest chains of order dependent jobs first
     //!  (The same, repeated, for unconnected platforms).
     class RCQueueSortModel
         : public QSortFilterProxyModel
@@ -64,6 +66,15 @@ namespace AssetProcessor
 
         JobRunKeyToRCJobMap m_currentJobRunKeyToJobEntries;
 
+        //! Jobs which have not finished yet, by their element id, and those of them which have order dependencies, by
+        //! the element id of the job they depend on. Used to work out the critical path of each job as jobs are added.
+        QMultiHash<QueueElementID, RCJob*> m_currentJobsByElementId;
+        QMultiHash<QueueElementID, RCJob*> m_currentDependentJobsByElementId;
+
+        //! Lengthens the critical paths of the jobs that rcJob order depends on, and of theirs in turn, to account for the
+        //! critical path of rcJob. jobsOnPath holds the jobs being updated further down the chain, to stop on cyclic dependencies.
+        void UpdateCriticalPathsOfDependencies(RCJob* rcJob, QSet<RCJob*>& jobsOnPath);
+
         QSet<QString> m_currentlyConnectedPlatforms;
         bool m_dirtyNeedsResort = false; // instead of constantly resorting, we resort only when someone wants to pull an element from us
 
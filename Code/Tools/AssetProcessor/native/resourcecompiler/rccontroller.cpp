@@ -8,9 +8,12 @@
 
 #include "rccontroller.h"
 #include <native/resourcecompiler/RCCommon.h>
+#include <native/utilities/AvailableMemory.h>
 #include <QTimer>
 #include <QThreadPool>
 
+#include <inttypes.h>
+
 
 
 namespace AssetProcessor
@@ -338,6 +341,12 @@ namespace AssetProcessor
 
             while (m_RCJobListModel.jobsInFlight() < m_maxJobs && rcJob && !m_shuttingDown)
             {
+                if (m_RCJobListModel.jobsInFlight() > 0 && !rcJob->IsAutoFail() && !HasMemoryForAnotherJob())
+                {
+                    // dispatch is attempted again whenever a job finishes.
+                    break;
+                }
+
                 if (m_dispatchingPaused)
                 {
                     // note, even if dispatching is "paused" we start all "auto fail jobs" so that user gets instant feedback on failure.
@@ -352,6 +361,36 @@ namespace AssetProcessor
             m_dispatchingJobs = false;
         }
     }
+    void RCController::SetMinAvailableMemoryMB(AZ::u64 minAvailableMemoryMB)
+    {
+        m_minAvailableMemoryMB = minAvailableMemoryMB;
+    }
+
+    bool RCController::HasMemoryForAnotherJob()
+    {
+        if (m_minAvailableMemoryMB == 0)
+        {
+            return true;
+        }
+
+        AZStd::optional<AZ::u64> availableMemory = GetAvailablePhysicalMemory();
+        if (!availableMemory)
+        {
+            return true;
+        }
+
+        const bool hasMemory = availableMemory.value() / (1024 * 1024) >= m_minAvailableMemoryMB;
+        if (hasMemory == m_throttledByMemory)
+        {
+            m_throttledByMemory = !hasMemory;
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "RCController: %s starting jobs, %" PRIu64 " MB of memory available (minimum %" PRIu64 " MB).\n",
+                hasMemory ? "Resumed" : "Holding off",
+                availableMemory.value() / (1024 * 1024),
+                m_minAvailableMemoryMB);
+        }
+        return hasMemory;
+    }
+
     void RCController::DispatchJobs()
     {
         if (!m_dispatchJobsQueued)
@@ -57,6 +57,10 @@ namespace AssetProcessor
         int NumberOfPendingJobsPerPlatform(QString platform);
         bool IsIdle();
 
+        //! While the available physical memory is below this amount, no job is started unless none are in flight,
+        //! which keeps memory hungry jobs from running out of memory when many of them run at once. 0 disables the limit.
+        void SetMinAvailableMemoryMB(AZ::u64 minAvailableMemoryMB);
+
     Q_SIGNALS:
         void FileCompiled(JobEntry entry, AssetBuilderSDK::ProcessJobResponse response);
         void FileFailed(JobEntry entry);
@@ -111,7 +115,11 @@ namespace AssetProcessor
     private:
         void FinishJob(AssetProcessor::RCJob* rcJob);
 
+        bool HasMemoryForAnotherJob();
+
         unsigned int m_maxJobs;
+        AZ::u64 m_minAvailableMemoryMB = 0;
+        bool m_throttledByMemory = false;
 
         bool m_dispatchingJobs = false;
         bool m_shuttingDown = false;
@@ -246,6 +246,16 @@ namespace AssetProcessor
         processJobRequest.m_watchFolder = GetJobEntry().m_sourceAssetReference.ScanFolderPath().c_str();
         processJobRequest.m_fullPath = GetJobEntry().GetAbsoluteSourcePath().toUtf8().data();
         processJobRequest.m_jobId = GetJobEntry().m_jobRunKey;
+
+        // The other files the job's fingerprint depends on, these are sent along with the source file to remote builders
+        for (const auto& [absolutePath, databasePath] : m_jobDetails.m_fingerprintFiles)
+        {
+            if (AZ::IO::PathView(absolutePath) != AZ::IO::PathView(processJobRequest.m_fullPath))
+            {
+                processJobRequest.m_sourceFileDependencyList.emplace_back(
+                    absolutePath, AZ::Uuid::CreateNull(), AssetBuilderSDK::SourceFileDependency::SourceFileDependencyType::Absolute);
+            }
+        }
     }
 
     QString RCJob::GetJobKey() const
@@ -278,6 +288,21 @@ namespace AssetProcessor
         return m_jobDetails.m_jobDependencyList;
     }
 
+    AZ::s64 RCJob::GetEstimatedDuration() const
+    {
+        return m_jobDetails.m_estimatedDurationMs;
+    }
+
+    AZ::s64 RCJob::GetCriticalPathDuration() const
+    {
+        return m_criticalPathDuration;
+    }
+
+    void RCJob::SetCriticalPathDuration(AZ::s64 criticalPathDuration)
+    {
+        m_criticalPathDuration = criticalPathDuration;
+    }
+
     void RCJob::Start()
     {
         // the following trace can be uncommented if there is a need to deeply inspect job running.
@@ -540,12 +565,14 @@ namespace AssetProcessor
                         AssetServerMode assetServerMode = AssetServerMode::Inactive;
                         AssetServerBus::BroadcastResult(assetServerMode, &AssetServerBus::Events::GetRemoteCachingMode);
 
+                        // the key addresses the job results by content, the local fingerprint can depend on modification times
+                        // which differ between machines
                         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
                         builderParams.m_serverKey = QString("%1_%2_%3_%4")
                             .arg(fileInfo.completeBaseName(),
                                  builderParams.m_processJobRequest.m_jobDescription.m_jobKey.c_str(),
-                                 builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str())
-                            .arg(builderParams.m_rcJob->GetOriginalFingerprint());
+                                 builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str(),
+                                 AssetUtilities::GenerateContentFingerprint(builderParams.m_rcJob->m_jobDetails).c_str());
                         bool operationResult = false;
                         if (assetServerMode == AssetServerMode::Server)
                         {
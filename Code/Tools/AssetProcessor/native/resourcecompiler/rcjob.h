@@ -252,6 +252,12 @@ namespace AssetProcessor
         int GetPriority() const;
         const AZStd::vector<JobDependencyInternal>& GetJobDependencies();
 
+        //! How long the job is expected to take in milliseconds, 0 when it is unknown.
+        AZ::s64 GetEstimatedDuration() const;
+        //! Expected duration of the longest chain of queued jobs made of this job and the jobs that wait on it through order dependencies.
+        AZ::s64 GetCriticalPathDuration() const;
+        void SetCriticalPathDuration(AZ::s64 criticalPathDuration);
+
     protected:
         //! DoWork ensure that the job is ready for being processing and than makes the actual builder call
         virtual void DoWork(AssetBuilderSDK::ProcessJobResponse& result, BuilderParams& builderParams, AssetUtilities::QuitListener& listener);
@@ -264,6 +270,7 @@ namespace AssetProcessor
         QueueElementID m_queueElementID; // cached to prevent lots of construction of this all over the place
 
         int m_JobEscalation = AssetProcessor::JobEscalation::Default; // Escalation indicates how important the job is and how soon it needs processing, the greater the number the greater the escalation
+        AZ::s64 m_criticalPathDuration = 0;
 
         QDateTime m_timeCreated;
         QDateTime m_timeLaunched;
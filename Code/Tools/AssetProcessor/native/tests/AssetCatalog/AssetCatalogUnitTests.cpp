@@ -49,6 +49,12 @@ namespace AssetProcessor
         void ClearDirtyFlag()
         {
             m_catalogIsDirty = false;
+            m_dirtyPlatforms.clear();
+        }
+
+        const QSet<QString>& GetDirtyPlatforms() const
+        {
+            return m_dirtyPlatforms;
         }
 
         AzFramework::AssetRegistry& GetRegistry(QString platformKey)
@@ -612,6 +618,24 @@ namespace AssetProcessor
         EXPECT_EQ(mockConnection.m_messages, 2); // No extra messages for the pc platform
     }
 
+    TEST_F(AssetCatalogTestWithProducts, AssetChanged_OnlyMarksItsPlatformForSaving)
+    {
+        m_data->m_assetCatalog->ClearDirtyFlag();
+
+        AssetNotificationMessage message;
+        message.m_type = AssetNotificationMessage::AssetChanged;
+        message.m_data = "filea.png";
+        message.m_assetId = AZ::Data::AssetId("{4DBBC5A7-ACEE-4084-A435-9CA8AA05B01B}");
+        message.m_assetType = AZ::Data::AssetType("{01E432B8-4252-40F5-86CC-4CB554004C49}");
+        message.m_platform = "android";
+        message.m_sizeBytes = 10;
+
+        m_data->m_assetCatalog->OnAssetMessage(message);
+
+        ASSERT_EQ(m_data->m_assetCatalog->GetDirtyPlatforms().size(), 1);
+        EXPECT_TRUE(m_data->m_assetCatalog->GetDirtyPlatforms().contains("android"));
+    }
+
     class AssetCatalogTestRelativeSourcePath : public AssetCatalogTest
     {
     public:
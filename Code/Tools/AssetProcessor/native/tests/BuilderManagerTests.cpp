@@ -11,8 +11,13 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #endif
 #include "BuilderManagerTests.h"
+#include <AssetBuilder/AssetBuilderStatic.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/IO/LocalFileIO.h>
 #include <native/connection/connectionManager.h>
+#include <native/unittests/UnitTestUtils.h>
+#include <QTemporaryDir>
 
 namespace UnitTests
 {
@@ -56,6 +61,82 @@ namespace UnitTests
         ASSERT_EQ(bm.GetBuilderCreationCount(), NumberOfBuilders + 1);
     }
 
+    class RemoteBuilderTest : public ::UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            m_localFileIo = AZStd::make_unique<AZ::IO::LocalFileIO>();
+            m_priorFileIo = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_localFileIo.get());
+        }
+
+        void TearDown() override
+        {
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_priorFileIo);
+            m_localFileIo.reset();
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZStd::string TempFilePath(const char* relativePath) const
+        {
+            return QDir(m_tempDir.path()).absoluteFilePath(relativePath).toUtf8().constData();
+        }
+
+        QTemporaryDir m_tempDir;
+        AZStd::unique_ptr<AZ::IO::LocalFileIO> m_localFileIo;
+        AZ::IO::FileIOBase* m_priorFileIo = nullptr;
+    };
+
+    TEST_F(RemoteBuilderTest, AddRemoteJobInputs_SendsSourceAndExistingDependencies)
+    {
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(TempFilePath("source/file.txt").c_str(), "source"));
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(TempFilePath("source/dependency.txt").c_str(), "dependency"));
+
+        AssetUtilities::QuitListener quitListener;
+        TestBuilder builder(quitListener, AZ::Uuid::CreateRandom(), 1);
+
+        AssetBuilder::ProcessJobNetRequest netRequest;
+        netRequest.m_request.m_fullPath = TempFilePath("source/file.txt");
+        netRequest.m_request.m_sourceFileDependencyList.emplace_back(TempFilePath("source/dependency.txt"), AZ::Uuid::CreateNull());
+        netRequest.m_request.m_sourceFileDependencyList.emplace_back(TempFilePath("source/missing.txt"), AZ::Uuid::CreateNull());
+
+        ASSERT_TRUE(builder.AddRemoteJobInputs(netRequest));
+
+        // Dependencies that don't exist have nothing to send
+        ASSERT_EQ(netRequest.m_inputFiles.size(), 2u);
+        EXPECT_EQ(netRequest.m_inputFiles[0].m_path, TempFilePath("source/file.txt"));
+        EXPECT_EQ(AZStd::string(netRequest.m_inputFiles[0].m_data.begin(), netRequest.m_inputFiles[0].m_data.end()), "source");
+        EXPECT_EQ(netRequest.m_inputFiles[1].m_path, TempFilePath("source/dependency.txt"));
+        EXPECT_EQ(AZStd::string(netRequest.m_inputFiles[1].m_data.begin(), netRequest.m_inputFiles[1].m_data.end()), "dependency");
+    }
+
+    TEST_F(RemoteBuilderTest, WriteRemoteJobOutputs_WritesOutputsToTempFolder)
+    {
+        AssetUtilities::QuitListener quitListener;
+        TestBuilder builder(quitListener, AZ::Uuid::CreateRandom(), 1);
+
+        AssetBuilder::ProcessJobNetResponse netResponse;
+        AssetBuilder::JobFile& outputFile = netResponse.m_outputFiles.emplace_back();
+        outputFile.m_path = "products/product.bin";
+        outputFile.m_data = { 1, 2, 3 };
+
+        ASSERT_TRUE(builder.WriteRemoteJobOutputs(netResponse, TempFilePath("temp")));
+        EXPECT_EQ(AZ::IO::SystemFile::Length(TempFilePath("temp/products/product.bin").c_str()), 3u);
+
+        // Outputs can't be written outside of the temp folder
+        outputFile.m_path = "../escaped.bin";
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(builder.WriteRemoteJobOutputs(netResponse, TempFilePath("temp")));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(AZ::IO::SystemFile::Exists(TempFilePath("escaped.bin").c_str()));
+    }
+
     AZ::Outcome<void, AZStd::string> TestBuilder::Start(AssetProcessor::BuilderPurpose /*purpose*/)
     {
         return AZ::Success();
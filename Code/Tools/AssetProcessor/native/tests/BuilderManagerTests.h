@@ -22,6 +22,9 @@ namespace UnitTests
             m_connectionId = connectionId;
         }
 
+        using Builder::AddRemoteJobInputs;
+        using Builder::WriteRemoteJobOutputs;
+
     protected:
         AZ::Outcome<void, AZStd::string> Start(AssetProcessor::BuilderPurpose purpose) override;
     };
@@ -242,6 +242,31 @@ namespace UnitTests
         EXPECT_EQ(products.size(), 0);
     }
 
+    TEST_F(AssetDatabaseTest, SetProduct_InWriteBatch_FailedWriteDoesNotUndoOtherWrites)
+    {
+        CreateCoverageTestData();
+
+        ProductDatabaseEntry validProduct{ AzToolsFramework::AssetDatabase::InvalidEntryId, m_data->m_job1.m_jobID, 5, "someproduct5.dds", AZ::Data::AssetType::CreateRandom() };
+        ProductDatabaseEntry invalidProduct{ AzToolsFramework::AssetDatabase::InvalidEntryId, 234234, 6, "someproduct6.dds", AZ::Data::AssetType::CreateRandom() };
+
+        m_errorAbsorber->Clear();
+        {
+            AssetProcessor::AssetDatabaseConnection::ScopedWriteBatch writeBatch(m_data->m_connection);
+            EXPECT_TRUE(m_data->m_connection.SetProduct(validProduct));
+            EXPECT_FALSE(m_data->m_connection.SetProduct(invalidProduct));
+        }
+        EXPECT_GT(m_errorAbsorber->m_numErrorsAbsorbed, 0);
+        EXPECT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 0);
+
+        ProductDatabaseEntryContainer products;
+        EXPECT_TRUE(m_data->m_connection.GetProductsByJobID(m_data->m_job1.m_jobID, products));
+        EXPECT_EQ(products.size(), 3);
+        EXPECT_NE(AZStd::find(products.begin(), products.end(), validProduct), products.end());
+
+        products.clear();
+        EXPECT_FALSE(m_data->m_connection.GetProductsByJobID(234234, products));
+    }
+
     // if we give it a valid command and a -1 product, we expect it to succeed without assert or warning
     // and we expect it to tell us (by filling in the entry) what the new PK is.
     TEST_F(AssetDatabaseTest, SetProduct_AutoPK_Succeeds)
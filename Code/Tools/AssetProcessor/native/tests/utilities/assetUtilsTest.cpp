@@ -323,6 +323,36 @@ TEST_F(AssetUtilitiesTest, GenerateFingerprint_OneFile_Differs)
     EXPECT_NE(fingerprint3, fingerprint1);
 }
 
+TEST_F(AssetUtilitiesTest, GenerateContentFingerprint_SameContents_SameFingerprint)
+{
+    QTemporaryDir dir;
+    QDir tempPath(dir.path());
+    QString canonicalTempDirPath = AssetUtilities::NormalizeDirectoryPath(tempPath.canonicalPath());
+    UnitTestUtils::ScopedDir changeDir(canonicalTempDirPath);
+    tempPath = QDir(canonicalTempDirPath);
+    QString absoluteTestFilePath = tempPath.absoluteFilePath("basicfile.txt");
+
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath, "contents"));
+
+    AssetProcessor::JobDetails jobDetail;
+    jobDetail.m_extraInformationForFingerprinting = "extra info1";
+    jobDetail.m_fingerprintFiles.insert(AZStd::make_pair(absoluteTestFilePath.toUtf8().constData(), "basicfile.txt"));
+
+    AZStd::string fingerprint1 = AssetUtilities::GenerateContentFingerprint(jobDetail);
+    EXPECT_EQ(fingerprint1.size(), 40);
+
+    // rewriting the same contents changes the modification time, but not the content fingerprint
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath, "contents"));
+    EXPECT_EQ(AssetUtilities::GenerateContentFingerprint(jobDetail), fingerprint1);
+
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath, "contents2"));
+    AZStd::string fingerprint2 = AssetUtilities::GenerateContentFingerprint(jobDetail);
+    EXPECT_NE(fingerprint2, fingerprint1);
+
+    jobDetail.m_extraInformationForFingerprinting = "extra info2";
+    EXPECT_NE(AssetUtilities::GenerateContentFingerprint(jobDetail), fingerprint2);
+}
+
 TEST_F(AssetUtilitiesTest, GenerateFingerprint_MultipleFile_Differs)
 {
     // given multiple files, make sure that the fingerprint for multiple files differs from the one file (that each file is taken into account)
@@ -180,6 +180,8 @@ void RCcontrollerUnitTests::Reset()
     m_rcController->m_RCQueueSortModel.AttachToModel(nullptr);
     m_rcController->m_RCQueueSortModel.AttachToModel(&m_rcController->m_RCJobListModel);
     m_rcController->m_RCQueueSortModel.m_currentJobRunKeyToJobEntries.clear();
+    m_rcController->m_RCQueueSortModel.m_currentJobsByElementId.clear();
+    m_rcController->m_RCQueueSortModel.m_currentDependentJobsByElementId.clear();
     m_rcController->m_RCQueueSortModel.m_currentlyConnectedPlatforms.clear();
 }
 
@@ -772,6 +774,53 @@ TEST_F(RCcontrollerUnitTests, TestRCController_FeedJobsWithDependencies_Dispatch
     EXPECT_TRUE(jobFinishedB);
 }
 
+TEST_F(RCcontrollerUnitTests, TestRCController_FeedJobsWithDependencies_CriticalPathCoversDependentJobs)
+{
+    Reset();
+    m_rcController->SetDispatchPaused(true);
+
+    // Job C has an order job dependency on Job B, which has one on Job A. The jobs are fed out of order.
+    auto createJob = [this](const char* fileName, const char* jobKey, AZ::s64 estimatedDurationMs, const char* dependencyFileName, const char* dependencyJobKey)
+    {
+        JobDetails jobDetails;
+        jobDetails.m_scanFolder = &TestScanFolderInfo;
+        jobDetails.m_assetBuilderDesc = m_assetBuilderDesc;
+        jobDetails.m_jobEntry.m_sourceAssetReference = AssetProcessor::SourceAssetReference(TestScanFolderInfo.ScanPath(), fileName);
+        jobDetails.m_jobEntry.m_platformInfo = { "pc" ,{ "desktop", "renderer" } };
+        jobDetails.m_jobEntry.m_jobKey = jobKey;
+        jobDetails.m_jobEntry.m_builderGuid = BuilderUuid;
+        jobDetails.m_estimatedDurationMs = estimatedDurationMs;
+
+        if (dependencyFileName)
+        {
+            AssetBuilderSDK::SourceFileDependency sourceFileDependency;
+            sourceFileDependency.m_sourceFileDependencyPath = (AZ::IO::Path(TestScanFolderInfo.ScanPath().toUtf8().constData()) / dependencyFileName).Native();
+            AssetBuilderSDK::JobDependency jobDependency(dependencyJobKey, "pc", AssetBuilderSDK::JobDependencyType::Order, sourceFileDependency);
+            jobDetails.m_jobDependencyList.push_back({ jobDependency });
+        }
+
+        MockRCJob* job = new MockRCJob(m_rcJobListModel);
+        job->Init(jobDetails);
+        m_rcQueueSortModel->AddJobIdEntry(job);
+        m_rcJobListModel->addNewJob(job);
+        return job;
+    };
+
+    MockRCJob* jobC = createJob("fileC.txt", "TestJobC", 300, "fileB.txt", "TestJobB");
+    MockRCJob* jobA = createJob("fileA.txt", "TestJobA", 100, nullptr, nullptr);
+    MockRCJob* jobB = createJob("fileB.txt", "TestJobB", 200, "fileA.txt", "TestJobA");
+    MockRCJob* jobD = createJob("fileD.txt", "TestJobD", 0, nullptr, nullptr);
+
+    EXPECT_EQ(jobC->GetCriticalPathDuration(), 300);
+    EXPECT_EQ(jobB->GetCriticalPathDuration(), 500);
+    EXPECT_EQ(jobA->GetCriticalPathDuration(), 600);
+    // jobs that never ran count as a millisecond long.
+    EXPECT_EQ(jobD->GetCriticalPathDuration(), 1);
+
+    // the head of the longest chain is the first job that can start.
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), jobA);
+}
+
 TEST_F(RCcontrollerUnitTests, TestRCController_FeedJobsWithCyclicDependencies_AllJobsFinish)
 {
     // Now test the use case where we have a cyclic dependency,
@@ -10,6 +10,7 @@
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/sort.h>
+#include <AzFramework/IO/LocalFileIO.h>
 
 #include <native/assetprocessor.h>
 #include <native/utilities/BuilderConfigurationManager.h>
@@ -384,6 +385,7 @@ void ApplicationManagerBase::ConnectAssetCatalog()
 void ApplicationManagerBase::InitRCController()
 {
     m_rcController = new AssetProcessor::RCController(m_platformConfiguration->GetMinJobs(), m_platformConfiguration->GetMaxJobs());
+    m_rcController->SetMinAvailableMemoryMB(m_platformConfiguration->GetMinAvailableMemoryMB());
 
     QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssetToProcess, m_rcController, &AssetProcessor::RCController::JobSubmitted);
     QObject::connect(m_rcController, &AssetProcessor::RCController::FileCompiled, m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssetProcessed, Qt::UniqueConnection);
@@ -509,19 +511,31 @@ void ApplicationManagerBase::InitFileMonitor(AZStd::unique_ptr<FileWatcherBase>
         m_fileWatcher->AddFolderWatch(info.ScanPath(), info.RecurseSubFolders());
     }
 
-    const auto OnFileAdded = [this](QString path)
+    // Keeps the file metadata cached by the local file IO in sync with the changes made by other processes
+    const auto InvalidateFileIOMetadata = [](const QString& path)
     {
+        if (auto* localFileIO = azrtti_cast<AZ::IO::LocalFileIO*>(AZ::IO::FileIOBase::GetDirectInstance()))
+        {
+            localFileIO->InvalidateFileMetadata(path.toUtf8().constData());
+        }
+    };
+
+    const auto OnFileAdded = [this, InvalidateFileIOMetadata](QString path)
+    {
+        InvalidateFileIOMetadata(path);
         m_fileStateCache->AddFile(path);
     };
 
-    const auto OnFileModified = [this](QString path)
+    const auto OnFileModified = [this, InvalidateFileIOMetadata](QString path)
     {
+        InvalidateFileIOMetadata(path);
         m_fileStateCache->UpdateFile(path);
         m_uuidManager->FileChanged(path.toUtf8().constData());
     };
 
-    const auto OnFileRemoved = [this](QString path)
+    const auto OnFileRemoved = [this, InvalidateFileIOMetadata](QString path)
     {
+        InvalidateFileIOMetadata(path);
         m_fileStateCache->RemoveFile(path);
         m_uuidManager->FileRemoved(path.toUtf8().constData());
     };
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/optional.h>
+
+namespace AssetProcessor
+{
+    //! Returns the amount of physical memory, in bytes, that the OS can hand out to new allocations without swapping.
+    //! This includes memory used by caches the OS can reclaim. Returns nothing if the OS does not report it.
+    //! Implemented per platform.
+    AZStd::optional<AZ::u64> GetAvailablePhysicalMemory();
+} // namespace AssetProcessor
@@ -12,7 +12,9 @@
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/Utils/Utils.h>
+#include <AssetBuilder/AssetBuilderStatic.h>
 #include <utilities/Builder.h>
 #include <utilities/AssetBuilderInfo.h>
 
@@ -325,6 +327,70 @@ namespace AssetProcessor
         }
     }
 
+    bool Builder::AddRemoteJobInputs(AssetBuilder::ProcessJobNetRequest& netRequest) const
+    {
+        auto addInputFile = [&netRequest](const AZStd::string& filePath)
+        {
+            auto readResult = AZ::Utils::ReadFile<AZStd::vector<AZ::u8>>(filePath);
+            if (!readResult.IsSuccess())
+            {
+                AZ_Error("Builder", false, "Failed to read job input for remote builder: %s", readResult.GetError().c_str());
+                return false;
+            }
+
+            AssetBuilder::JobFile& inputFile = netRequest.m_inputFiles.emplace_back();
+            inputFile.m_path = filePath;
+            inputFile.m_data = readResult.TakeValue();
+            return true;
+        };
+
+        const AssetBuilderSDK::ProcessJobRequest& request = netRequest.m_request;
+        if (!addInputFile(request.m_fullPath))
+        {
+            return false;
+        }
+
+        for (const AssetBuilderSDK::SourceFileDependency& dependency : request.m_sourceFileDependencyList)
+        {
+            // Dependencies on files that don't exist (yet) are part of the fingerprint, but there is nothing to send for them
+            if (dependency.m_sourceDependencyType == AssetBuilderSDK::SourceFileDependency::SourceFileDependencyType::Absolute &&
+                AZ::IO::SystemFile::Exists(dependency.m_sourceFileDependencyPath.c_str()) &&
+                !addInputFile(dependency.m_sourceFileDependencyPath))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool Builder::WriteRemoteJobOutputs(const AssetBuilder::ProcessJobNetResponse& netResponse, const AZStd::string& tempFolderPath) const
+    {
+        const AZ::IO::FixedMaxPath tempFolder = AZ::IO::PathView(tempFolderPath).LexicallyNormal();
+
+        for (const AssetBuilder::JobFile& outputFile : netResponse.m_outputFiles)
+        {
+            // Outputs are relative to the job temp folder, reject anything that would be written outside of it
+            const AZ::IO::FixedMaxPath outputPath = (tempFolder / outputFile.m_path).LexicallyNormal();
+            if (AZ::IO::PathView(outputFile.m_path).IsAbsolute() || !outputPath.IsRelativeTo(tempFolder) || outputPath == tempFolder)
+            {
+                AZ_Error("Builder", false, "Remote builder %s sent job output %s which is not in the job temp folder",
+                    UuidString().c_str(), outputFile.m_path.c_str());
+                return false;
+            }
+
+            auto writeResult = AZ::Utils::WriteFile(
+                AZStd::span(reinterpret_cast<const AZStd::byte*>(outputFile.m_data.data()), outputFile.m_data.size()), outputPath.Native());
+            if (!writeResult.IsSuccess())
+            {
+                AZ_Error("Builder", false, "Failed to write job output of remote builder: %s", writeResult.GetError().c_str());
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     //////////////////////////////////////////////////////////////////////////////////////////
 
     BuilderRef::BuilderRef(const AZStd::shared_ptr<Builder>& builder)
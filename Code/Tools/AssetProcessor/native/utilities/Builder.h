@@ -13,6 +13,12 @@
 #include <AzFramework/Process/ProcessWatcher.h>
 #include <AzFramework/Process/ProcessCommunicatorTracePrinter.h>
 
+namespace AssetBuilder
+{
+    class ProcessJobNetRequest;
+    class ProcessJobNetResponse;
+}
+
 namespace AssetProcessor
 {
     //! Enum used to indicate the purpose of a builder which may result in special handling
@@ -31,7 +37,8 @@ namespace AssetProcessor
         JobCancelled,
         ResponseFailure,
         FailedToDecodeResponse,
-        FailedToWriteDebugRequest
+        FailedToWriteDebugRequest,
+        FailedToTransferJobFiles
     };
 
     //! Wrapper for managing a single builder process and sending job requests to it
@@ -107,6 +114,22 @@ namespace AssetProcessor
             AZ::u32 processTimeoutLimitInSeconds,
             AZStd::binary_semaphore* waitEvent) const;
 
+        //! Adds the source file and source dependencies of the job to a request sent to a remote builder
+        bool AddRemoteJobInputs(AssetBuilder::ProcessJobNetRequest& netRequest) const;
+        template<typename TNetRequest>
+        bool AddRemoteJobInputs(TNetRequest&) const
+        {
+            return true;
+        }
+
+        //! Writes the products streamed back by a remote builder to the job temp folder, where the AP expects them
+        bool WriteRemoteJobOutputs(const AssetBuilder::ProcessJobNetResponse& netResponse, const AZStd::string& tempFolderPath) const;
+        template<typename TNetResponse>
+        bool WriteRemoteJobOutputs(const TNetResponse&, const AZStd::string&) const
+        {
+            return true;
+        }
+
         //! Writes the request out to disk for debug purposes and logs info on how to manually run the asset builder
         template<typename TRequest>
         bool DebugWriteRequestFile(
@@ -121,6 +144,9 @@ namespace AssetProcessor
         //! Indicates if the builder is currently in use
         bool m_busy = false;
 
+        //! Indicates if the builder runs on another machine, only unmanaged builders can be remote
+        bool m_remote = false;
+
         AZStd::atomic<AZ::u32> m_connectionId = 0;
 
         //! Signals the exe has successfully established a connection
@@ -7,6 +7,7 @@
  */
 
 #include <utilities/BuilderManager.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/API/ApplicationAPI.h>
@@ -37,6 +38,12 @@ namespace AssetProcessor
                 }
             });
 
+        if (const auto* settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            settingsRegistry->Get(
+                m_allowUnmanagedBuilderConnections, "/Amazon/AssetProcessor/Settings/BuilderManager/AllowUnmanagedBuilderConnections");
+        }
+
         m_quitListener.BusConnect();
         BusConnect();
     }
@@ -89,8 +96,15 @@ namespace AssetProcessor
             {
                 if (m_allowUnmanagedBuilderConnections)
                 {
-                    AZ_TracePrintf("BuilderManager", "External builder connection accepted for ProcessJob work\n");
+                    AZ_TracePrintf("BuilderManager", "External %s builder connection accepted for ProcessJob work\n",
+                        requestPing.m_remote ? "remote" : "local");
                     builder = AddNewBuilder(BuilderPurpose::ProcessJob); // We only accept external connections for ProcessJob builders
+
+                    if (builder)
+                    {
+                        // Remote builders can't see the files of this machine, their job inputs and outputs are sent over the connection
+                        builder->m_remote = requestPing.m_remote;
+                    }
                 }
                 else
                 {
@@ -98,7 +112,7 @@ namespace AssetProcessor
                         "BuilderManager",
                         false,
                         "Received request ping from builder but could not match uuid %s to list of builders started by this AssetProcessor instance.  "
-                        "If you intended to connect an external builder, please set BuilderManager::m_allowUnmanagedBuilderConnections to true to allow this.",
+                        "If you intended to connect an external builder, please set /Amazon/AssetProcessor/Settings/BuilderManager/AllowUnmanagedBuilderConnections to true to allow this.",
                         requestPing.m_uuid.ToString<AZStd::string>().c_str());
                 }
             }
@@ -19,6 +19,11 @@ namespace AssetProcessor
         TNetResponse netResponse;
         netRequest.m_request = request;
 
+        if (m_remote && !AddRemoteJobInputs(netRequest))
+        {
+            return BuilderRunJobOutcome::FailedToTransferJobFiles;
+        }
+
         struct BuildTracker final
         {
             BuildTracker(const Builder& builder, const AZStd::string& sourceFile, const AZStd::string& task)
@@ -71,6 +76,11 @@ namespace AssetProcessor
             return BuilderRunJobOutcome::FailedToDecodeResponse;
         }
 
+        if (m_remote && !WriteRemoteJobOutputs(netResponse, tempFolderPath))
+        {
+            return BuilderRunJobOutcome::FailedToTransferJobFiles;
+        }
+
         if (!netResponse.m_response.Succeeded() || s_createRequestFileForSuccessfulJob)
         {
             // we write the request out to disk for failure or debugging
@@ -1145,6 +1145,8 @@ namespace AssetProcessor
             m_maxJobs = aznumeric_cast<int>(jobCount);
         }
 
+        settingsRegistry->Get(m_minAvailableMemoryMB, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/Jobs/minAvailableMemoryMB");
+
         if (!skipScanFolders)
         {
             AZStd::unordered_map<AZStd::string, AZ::IO::Path> gemNameToPathMap;
@@ -1852,6 +1854,11 @@ namespace AssetProcessor
         return m_maxJobs;
     }
 
+    AZ::u64 PlatformConfiguration::GetMinAvailableMemoryMB() const
+    {
+        return m_minAvailableMemoryMB;
+    }
+
     void PlatformConfiguration::EnableCommonPlatform()
     {
         EnablePlatform(AssetBuilderSDK::PlatformInfo{ AssetBuilderSDK::CommonPlatformName, AZStd::unordered_set<AZStd::string>{ "common" } });
@@ -181,6 +181,8 @@ namespace AssetProcessor
         //! Gets the minumum jobs specified in the configuration file
         int GetMinJobs() const;
         int GetMaxJobs() const;
+        //! Gets the amount of available physical memory, in megabytes, below which no additional job is started (0 when unlimited)
+        AZ::u64 GetMinAvailableMemoryMB() const;
 
         void EnableCommonPlatform();
         void AddIntermediateScanFolder();
@@ -334,6 +336,7 @@ namespace AssetProcessor
 
         int m_minJobs = 1;
         int m_maxJobs = 3;
+        AZ::u64 m_minAvailableMemoryMB = 0;
 
         // used only during file read, keeps the total running list of all the enabled platforms from all config files and command lines
         AZStd::vector<AZStd::string> m_tempEnabledPlatforms;
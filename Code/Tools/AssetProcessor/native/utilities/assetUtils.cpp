@@ -225,6 +225,32 @@ namespace AssetUtilsInternal
 
         return false;
     }
+
+    //! Appends the fingerprints of the jobs the job depends on, the dependencies which only order the jobs are skipped.
+    void AppendJobDependencyFingerprints(const AssetProcessor::JobDetails& jobDetail, AZStd::string& fingerprintString)
+    {
+        for (const AssetProcessor::JobDependencyInternal& jobDependencyInternal : jobDetail.m_jobDependencyList)
+        {
+            if (jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce ||
+                jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnly)
+            {
+                // We do not want to include the fingerprint of dependent jobs if the job dependency type is OrderOnce or OrderOnly.
+                continue;
+            }
+            AssetProcessor::JobDesc jobDesc(AssetProcessor::SourceAssetReference(jobDependencyInternal.m_jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str()),
+                jobDependencyInternal.m_jobDependency.m_jobKey, jobDependencyInternal.m_jobDependency.m_platformIdentifier);
+
+            for (auto builderIter = jobDependencyInternal.m_builderUuidList.begin(); builderIter != jobDependencyInternal.m_builderUuidList.end(); ++builderIter)
+            {
+                AZ::u32 dependentJobFingerprint;
+                AssetProcessor::ProcessingJobInfoBus::BroadcastResult(dependentJobFingerprint, &AssetProcessor::ProcessingJobInfoBusTraits::GetJobFingerprint, AssetProcessor::JobIndentifier(jobDesc, *builderIter));
+                if (dependentJobFingerprint != 0)
+                {
+                    fingerprintString.append(AZStd::string::format(":%u", dependentJobFingerprint));
+                }
+            }
+        }
+    }
 }
 
 namespace AssetUtilities
@@ -1074,27 +1100,7 @@ namespace AssetUtilities
             fingerprintString.append(GetFileFingerprint(fingerprintFile.first, fingerprintFile.second));
         }
         // now the other jobs, which this job depends on:
-        for (const AssetProcessor::JobDependencyInternal& jobDependencyInternal : jobDetail.m_jobDependencyList)
-        {
-            if (jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce ||
-                jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnly)
-            {
-                // We do not want to include the fingerprint of dependent jobs if the job dependency type is OrderOnce or OrderOnly.
-                continue;
-            }
-            AssetProcessor::JobDesc jobDesc(AssetProcessor::SourceAssetReference(jobDependencyInternal.m_jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str()),
-                jobDependencyInternal.m_jobDependency.m_jobKey, jobDependencyInternal.m_jobDependency.m_platformIdentifier);
-
-            for (auto builderIter = jobDependencyInternal.m_builderUuidList.begin(); builderIter != jobDependencyInternal.m_builderUuidList.end(); ++builderIter)
-            {
-                AZ::u32 dependentJobFingerprint;
-                AssetProcessor::ProcessingJobInfoBus::BroadcastResult(dependentJobFingerprint, &AssetProcessor::ProcessingJobInfoBusTraits::GetJobFingerprint, AssetProcessor::JobIndentifier(jobDesc, *builderIter));
-                if (dependentJobFingerprint != 0)
-                {
-                    fingerprintString.append(AZStd::string::format(":%u", dependentJobFingerprint));
-                }
-            }
-        }
+        AssetUtilsInternal::AppendJobDependencyFingerprints(jobDetail, fingerprintString);
         s_largestFingerprintCapacitySoFar = AZStd::GetMax(fingerprintString.capacity(), s_largestFingerprintCapacitySoFar);
 
         if (fingerprintString.empty())
@@ -1111,6 +1117,36 @@ namespace AssetUtilities
         return digest[0]; // we only currently use 32-bit hashes.  This could be extended if collisions still occur.
     }
 
+    AZStd::string GenerateContentFingerprint(const AssetProcessor::JobDetails& jobDetail)
+    {
+        // same inputs as GenerateFingerprint, but the files are always identified by a hash of their contents instead of their
+        // modification time, so that the fingerprint matches on every machine which has the same content.
+        AZStd::string fingerprintString(jobDetail.m_extraInformationForFingerprinting);
+
+        for (const auto& fingerprintFile : jobDetail.m_fingerprintFiles)
+        {
+            // GetFileHash reuses the hashes of the file state cache, but only hashes when file hashing is enabled
+            const AZ::u64 fileHash = ShouldUseFileHashing() ? GetFileHash(fingerprintFile.first.c_str())
+                                                            : AssetBuilderSDK::GetFileHash(fingerprintFile.first.c_str());
+            if (fileHash == 0)
+            {
+                fingerprintString.append(AZStd::string::format(":-:-:%s", fingerprintFile.second.c_str()));
+            }
+            else
+            {
+                fingerprintString.append(AZStd::string::format(":%llX:%s", fileHash, fingerprintFile.second.c_str()));
+            }
+        }
+        AssetUtilsInternal::AppendJobDependencyFingerprints(jobDetail, fingerprintString);
+
+        AZ::Sha1 sha;
+        sha.ProcessBytes(AZStd::as_bytes(AZStd::span(fingerprintString)));
+        AZ::u32 digest[5];
+        sha.GetDigest(digest);
+
+        return AZStd::string::format("%08X%08X%08X%08X%08X", digest[0], digest[1], digest[2], digest[3], digest[4]);
+    }
+
     std::uint64_t AdjustTimestamp(QDateTime timestamp, int overridePrecision)
     {
         if (timestamp.isDaylightTime())
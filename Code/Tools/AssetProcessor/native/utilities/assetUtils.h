@@ -235,6 +235,11 @@ namespace AssetUtilities
     //! interrogate a given file, which is specified as a full path name, and generate a fingerprint for it.
     unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail);
 
+    //! Generates a fingerprint of the job from the contents of its files, its builder version and parameters and the jobs it
+    //! depends on. Unlike GenerateFingerprint it never uses modification times and keeps the whole SHA1, so it can address job
+    //! results shared between machines.
+    AZStd::string GenerateContentFingerprint(const AssetProcessor::JobDetails& jobDetail);
+
     //! Returns a hash of the contents of the specified file
     // hashMsDelay is only for automated tests to test that writing to a file while it's hashing does not cause a crash.
     // hashMsDelay is not used in non-unit test builds.
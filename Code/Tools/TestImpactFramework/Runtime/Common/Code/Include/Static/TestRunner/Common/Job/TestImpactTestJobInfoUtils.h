@@ -20,6 +20,9 @@ namespace TestImpact
     //! Generates the path to the enumeration cache file for the specified test target.
     RepoPath GenerateTargetEnumerationCacheFilePath(const TestTarget* testTarget, const RepoPath& cacheDir);
 
+    //! Generates the path to the file caching the last test run of the specified test target.
+    RepoPath GenerateTargetRunHistoryFilePath(const TestTarget* testTarget, const RepoPath& cacheDir);
+
     //! Generates the path to the enumeration artifact file for the specified test target.
     RepoPath GenerateTargetEnumerationArtifactFilePath(const TestTarget* testTarget, const RepoPath& artifactDir);
 
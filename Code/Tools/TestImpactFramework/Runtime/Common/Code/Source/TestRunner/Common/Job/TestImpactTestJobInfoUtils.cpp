@@ -27,6 +27,11 @@ namespace TestImpact
         return AZStd::string::format("%s.cache", (cacheDir / RepoPath(testTarget->GetName())).c_str());
     }
 
+    RepoPath GenerateTargetRunHistoryFilePath(const TestTarget* testTarget, const RepoPath& cacheDir)
+    {
+        return AZStd::string::format("%s.RunHistory.json", (cacheDir / RepoPath(testTarget->GetName())).c_str());
+    }
+
     RepoPath GenerateTargetEnumerationArtifactFilePath(const TestTarget* testTarget, const RepoPath& artifactDir)
     {
         return AZStd::string::format("%s.Enumeration.xml", (artifactDir / RepoPath(testTarget->GetName())).c_str());
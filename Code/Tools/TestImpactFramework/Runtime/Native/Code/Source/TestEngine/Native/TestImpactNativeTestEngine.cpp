@@ -17,9 +17,26 @@
 #include <TestRunner/Native/TestImpactNativeShardedRegularTestRunner.h>
 #include <TestRunner/Native/Job/TestImpactNativeTestJobInfoGenerator.h>
 #include <TestRunner/Native/Job/TestImpactNativeShardedTestJobInfoGenerator.h>
+#include <TestRunner/Common/Run/TestImpactTestRunSerializer.h>
+
+#include <AzCore/IO/SystemFile.h>
 
 namespace TestImpact
 {
+    //! Caches the runs of the test targets that ran tests, which the next runs use to balance the shards of these test targets.
+    template<typename TestEngineRun>
+    void WriteTestRunHistory(const AZStd::vector<TestEngineRun>& engineRuns, const RepoPath& cacheDir)
+    {
+        for (const auto& engineRun : engineRuns)
+        {
+            if (const auto& testRun = engineRun.GetTestRun(); testRun.has_value() && testRun->GetNumRuns())
+            {
+                WriteFileContents<TestEngineException>(
+                    SerializeTestRun(testRun.value()), GenerateTargetRunHistoryFilePath(engineRun.GetTestTarget(), cacheDir));
+            }
+        }
+    }
+
     //! Determines the test run result of a native regular test run.
     AZStd::optional<Client::TestRunResult> NativeRegularTestRunnerErrorCodeChecker(
         const typename NativeRegularTestRunner::JobInfo& jobInfo, const JobMeta& meta)
@@ -219,10 +236,11 @@ namespace TestImpact
     {
         DeleteXmlArtifacts();
 
+        m_shardedRegularTestJobInfoGenerator->SetTestDurations(ReadTestDurations(testTargets));
         const auto shardedJobInfos =
             m_shardedRegularTestJobInfoGenerator->GenerateJobInfos(GenerateTestTargetAndEnumerations(testTargets));
 
-        return RunTests(
+        auto result = RunTests(
             m_shardedTestRunner.get(),
             shardedJobInfos,
             testTargets,
@@ -232,6 +250,9 @@ namespace TestImpact
             targetOutputCapture,
             testTargetTimeout,
             globalTimeout);
+
+        WriteTestRunHistory(result.second, m_artifactDir.m_enumerationCacheDirectory);
+        return result;
     }
 
     TestEngineInstrumentedRunResult<NativeTestTarget, TestCoverage> NativeTestEngine::InstrumentedRun(
@@ -245,6 +266,7 @@ namespace TestImpact
     {
         DeleteXmlArtifacts();
 
+        m_shardedInstrumentedTestJobInfoGenerator->SetTestDurations(ReadTestDurations(testTargets));
         const auto shardedJobInfos =
             m_shardedInstrumentedTestJobInfoGenerator->GenerateJobInfos(GenerateTestTargetAndEnumerations(testTargets));
         
@@ -266,9 +288,49 @@ namespace TestImpact
             AZ_Error("InstrumentedRun", false, integrityErrors.c_str());
         }
 
+        WriteTestRunHistory(result.second, m_artifactDir.m_enumerationCacheDirectory);
         return result;
     }
 
+    AZStd::unordered_map<const NativeTestTarget*, TestDurations> NativeTestEngine::ReadTestDurations(
+        const AZStd::vector<const NativeTestTarget*>& testTargets) const
+    {
+        AZStd::unordered_map<const NativeTestTarget*, TestDurations> testDurations;
+        for (const auto* testTarget : testTargets)
+        {
+            const auto runHistoryFile = GenerateTargetRunHistoryFilePath(testTarget, m_artifactDir.m_enumerationCacheDirectory);
+            if (!AZ::IO::SystemFile::Exists(runHistoryFile.c_str()))
+            {
+                continue;
+            }
+
+            try
+            {
+                const auto testRun = DeserializeTestRun(ReadFileContents<TestEngineException>(runHistoryFile));
+                auto& targetTestDurations = testDurations[testTarget];
+                for (const auto& testSuite : testRun.GetTestSuites())
+                {
+                    for (const auto& test : testSuite.m_tests)
+                    {
+                        if (test.m_status == TestRunStatus::Run)
+                        {
+                            targetTestDurations[AZStd::string::format("%s.%s", testSuite.m_name.c_str(), test.m_name.c_str())] =
+                                test.m_duration;
+                        }
+                    }
+                }
+            }
+            catch (const Exception& e)
+            {
+                // A stale or corrupt history only means the shards of this test target are interleaved instead
+                AZ_Warning("ReadTestDurations", false, "Couldn't read the run history of '%s': %s", testTarget->GetName().c_str(), e.what());
+                testDurations.erase(testTarget);
+            }
+        }
+
+        return testDurations;
+    }
+
     AZStd::vector<TestTargetAndEnumeration> NativeTestEngine::GenerateTestTargetAndEnumerations(
         const AZStd::vector<const NativeTestTarget*>& testTargets) const
     {
@@ -121,6 +121,10 @@ namespace TestImpact
         //! Helper function to generate the test target and enumeration pairs for a given set of test targets.
         AZStd::vector<TestTargetAndEnumeration> GenerateTestTargetAndEnumerations(const AZStd::vector<const NativeTestTarget*>& testTargets) const;
 
+        //! Reads the test durations of the last run of each test target (if any), used to balance the test target shards.
+        AZStd::unordered_map<const NativeTestTarget*, TestDurations> ReadTestDurations(
+            const AZStd::vector<const NativeTestTarget*>& testTargets) const;
+
         AZStd::unique_ptr<NativeTestEnumerationJobInfoGenerator> m_enumerationTestJobInfoGenerator;
         AZStd::unique_ptr<NativeRegularTestRunJobInfoGenerator> m_regularTestJobInfoGenerator;
         AZStd::unique_ptr<NativeInstrumentedTestRunJobInfoGenerator> m_instrumentedTestJobInfoGenerator;
@@ -19,6 +19,10 @@
 #include <TestRunner/Native/Job/TestImpactNativeTestJobInfoGenerator.h>
 #include <TestRunner/Native/Job/TestImpactNativeTestJobInfoUtils.h>
 
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/sort.h>
+
 namespace TestImpact
 {
     //! Job info for all shards of a given test target.
@@ -69,6 +73,9 @@ namespace TestImpact
     //! Helper pair for a test target and its enumeration (if any).
     using TestTargetAndEnumeration = AZStd::pair<const NativeTestTarget*, AZStd::optional<TestEnumeration>>;
 
+    //! Historical durations of the tests of a test target, keyed by their "Fixture.Test" name.
+    using TestDurations = AZStd::unordered_map<AZStd::string, AZStd::chrono::milliseconds>;
+
     //! Base class for the regular and instrumented sharded job info generators.
     template<typename TestJobRunner>
     class NativeShardedTestRunJobInfoGeneratorBase
@@ -96,6 +103,10 @@ namespace TestImpact
         AZStd::vector<ShardedTestJobInfo<TestJobRunner>> GenerateJobInfos(
             const AZStd::vector<TestTargetAndEnumeration>& testTargetsAndEnumerations);
 
+        //! Sets the historical test durations of the test targets.
+        //! The shards of a test target with durations are balanced by duration rather than by test count.
+        void SetTestDurations(AZStd::unordered_map<const NativeTestTarget*, TestDurations>&& testDurations);
+
     protected:
         //! The interleaved tests for a given set of shards.
         using ShardedTestsList = AZStd::vector<AZStd::vector<AZStd::string>>;
@@ -131,11 +142,26 @@ namespace TestImpact
         RepoPath m_testRunnerBinary; //!< Path to the test runner binary.
 
     private:
+        //! A test or fixture filter and its expected duration.
+        using ShardItem = AZStd::pair<AZStd::string, AZStd::chrono::milliseconds>;
+
         //! Interleaves the enumerated tests across the shards.
         ShardedTestsList ShardTestInterleaved(const TestTargetAndEnumeration& testTargetAndEnumeration) const;
 
         //! Interleaves the enumerated fixtures across the shards.
         ShardedTestsList ShardFixtureInterleaved(const TestTargetAndEnumeration& testTargetAndEnumeration) const;
+
+        //! Assigns the longest items first, each to the shard with the lowest expected duration so far.
+        static ShardedTestsList ShardByDuration(AZStd::vector<ShardItem>&& shardItems, size_t numShards);
+
+        //! Returns the historical duration of the specified test, or the mean duration of the test target if the test has no history.
+        static AZStd::chrono::milliseconds GetTestDuration(
+            const TestDurations& testDurations, const AZStd::string& testName, AZStd::chrono::milliseconds meanDuration);
+
+        //! Returns the mean historical duration of the tests of a test target.
+        static AZStd::chrono::milliseconds GetMeanTestDuration(const TestDurations& testDurations);
+
+        AZStd::unordered_map<const NativeTestTarget*, TestDurations> m_testDurations; //!< Historical test durations of the test targets.
     };
 
     //! Job info generator for the instrumented sharded test runner.
@@ -268,6 +294,32 @@ namespace TestImpact
             // If there are no shards, there is no work to be done
             return {};
         }
+        if (const auto testDurations = m_testDurations.find(testTarget); testDurations != m_testDurations.end())
+        {
+            const auto meanDuration = GetMeanTestDuration(testDurations->second);
+            AZStd::vector<ShardItem> shardItems;
+            shardItems.reserve(numTests);
+            for (const auto& fixture : testEnumeration->GetTestSuites())
+            {
+                if (!fixture.m_enabled)
+                {
+                    continue;
+                }
+
+                for (const auto& test : fixture.m_tests)
+                {
+                    if (test.m_enabled)
+                    {
+                        auto testName = AZStd::string::format("%s.%s", fixture.m_name.c_str(), test.m_name.c_str());
+                        const auto duration = GetTestDuration(testDurations->second, testName, meanDuration);
+                        shardItems.emplace_back(AZStd::move(testName), duration);
+                    }
+                }
+            }
+
+            return ShardByDuration(AZStd::move(shardItems), numShards);
+        }
+
         ShardedTestsList shardTestList(numShards);
 
         size_t testIndex = 0;
@@ -305,6 +357,41 @@ namespace TestImpact
             // If there are no shards, there is no work to be done
             return {};
         }
+        if (const auto testDurations = m_testDurations.find(testTarget); testDurations != m_testDurations.end())
+        {
+            const auto meanDuration = GetMeanTestDuration(testDurations->second);
+            AZStd::vector<ShardItem> shardItems;
+            shardItems.reserve(numFixtures);
+            for (const auto& fixture : testEnumeration->GetTestSuites())
+            {
+                if (!fixture.m_enabled)
+                {
+                    continue;
+                }
+
+                size_t numEnabledTests = 0;
+                AZStd::chrono::milliseconds fixtureDuration{ 0 };
+                for (const auto& test : fixture.m_tests)
+                {
+                    if (test.m_enabled)
+                    {
+                        numEnabledTests++;
+                        fixtureDuration += GetTestDuration(
+                            testDurations->second,
+                            AZStd::string::format("%s.%s", fixture.m_name.c_str(), test.m_name.c_str()),
+                            meanDuration);
+                    }
+                }
+
+                if (numEnabledTests)
+                {
+                    shardItems.emplace_back(AZStd::string::format("%s.*", fixture.m_name.c_str()), fixtureDuration);
+                }
+            }
+
+            return ShardByDuration(AZStd::move(shardItems), numShards);
+        }
+
         ShardedTestsList shardTestList(numShards);
 
         size_t fixtureIndex = 0;
@@ -330,6 +417,65 @@ namespace TestImpact
         return shardTestList;
     }
 
+    template<typename TestJobRunner>
+    typename NativeShardedTestRunJobInfoGeneratorBase<TestJobRunner>::ShardedTestsList NativeShardedTestRunJobInfoGeneratorBase<
+        TestJobRunner>::ShardByDuration(AZStd::vector<ShardItem>&& shardItems, size_t numShards)
+    {
+        AZStd::stable_sort(
+            shardItems.begin(),
+            shardItems.end(),
+            [](const ShardItem& lhs, const ShardItem& rhs)
+            {
+                return lhs.second > rhs.second;
+            });
+
+        // The test count breaks the ties between shards, so that tests without any duration are still spread across the shards
+        ShardedTestsList shardTestList(numShards);
+        AZStd::vector<AZStd::pair<AZStd::chrono::milliseconds, size_t>> shardLoads(numShards, { AZStd::chrono::milliseconds{ 0 }, 0 });
+        for (auto& [testFilter, duration] : shardItems)
+        {
+            const size_t shardIndex = AZStd::distance(shardLoads.begin(), AZStd::min_element(shardLoads.begin(), shardLoads.end()));
+            shardLoads[shardIndex].first += duration;
+            shardLoads[shardIndex].second++;
+            shardTestList[shardIndex].emplace_back(AZStd::move(testFilter));
+        }
+
+        return shardTestList;
+    }
+
+    template<typename TestJobRunner>
+    AZStd::chrono::milliseconds NativeShardedTestRunJobInfoGeneratorBase<TestJobRunner>::GetTestDuration(
+        const TestDurations& testDurations, const AZStd::string& testName, AZStd::chrono::milliseconds meanDuration)
+    {
+        const auto testDuration = testDurations.find(testName);
+        return testDuration != testDurations.end() ? testDuration->second : meanDuration;
+    }
+
+    template<typename TestJobRunner>
+    AZStd::chrono::milliseconds NativeShardedTestRunJobInfoGeneratorBase<TestJobRunner>::GetMeanTestDuration(
+        const TestDurations& testDurations)
+    {
+        if (testDurations.empty())
+        {
+            return AZStd::chrono::milliseconds{ 0 };
+        }
+
+        AZStd::chrono::milliseconds totalDuration{ 0 };
+        for (const auto& [testName, duration] : testDurations)
+        {
+            totalDuration += duration;
+        }
+
+        return totalDuration / testDurations.size();
+    }
+
+    template<typename TestJobRunner>
+    void NativeShardedTestRunJobInfoGeneratorBase<TestJobRunner>::SetTestDurations(
+        AZStd::unordered_map<const NativeTestTarget*, TestDurations>&& testDurations)
+    {
+        m_testDurations = AZStd::move(testDurations);
+    }
+
     template<typename TestJobRunner>
     auto NativeShardedTestRunJobInfoGeneratorBase<TestJobRunner>::TestListsToTestFilters(const ShardedTestsList& shardedTestList) const
         -> ShardedTestsFilter
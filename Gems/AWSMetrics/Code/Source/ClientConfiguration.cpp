@@ -22,6 +22,7 @@ namespace AWSMetrics
         , m_queueFlushPeriodInSeconds(60)
         , m_offlineRecordingEnabled(false)
         , m_maxNumRetries(1)
+        , m_spoolFailedMetricsEnabled(false)
     {
     }
 
@@ -68,6 +69,12 @@ namespace AWSMetrics
             return false;
         }
 
+        // The spooling setting is optional, so it keeps the default value when it isn't set.
+        m_spoolFailedMetricsEnabled = false;
+        settingsRegistry->Get(
+            m_spoolFailedMetricsEnabled,
+            AZStd::string::format("%s%s", AZ::SettingsRegistryMergeUtils::OrganizationRootKey, AWSMetricsSpoolFailedMetricsKey));
+
         return ResolveMetricsFilePath();
     }
 
@@ -117,6 +124,11 @@ namespace AWSMetrics
         return m_maxNumRetries;
     }
 
+    bool ClientConfiguration::SpoolFailedMetricsEnabled() const
+    {
+        return m_spoolFailedMetricsEnabled;
+    }
+
     const char* ClientConfiguration::GetMetricsFileDir() const
     {
         return m_metricsDir.c_str();
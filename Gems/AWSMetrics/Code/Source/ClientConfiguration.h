@@ -23,6 +23,7 @@ namespace AWSMetrics
         static constexpr const char AWSMetricsQueueFlushPeriodInSecondsKey[] = "/Gems/AWSMetrics/QueueFlushPeriodInSeconds";
         static constexpr const char AWSMetricsOfflineRecordingEnabledKey[] = "/Gems/AWSMetrics/OfflineRecording";
         static constexpr const char AWSMetricsMaxNumRetriesKey[] = "/Gems/AWSMetrics/MaxNumRetries";
+        static constexpr const char AWSMetricsSpoolFailedMetricsKey[] = "/Gems/AWSMetrics/SpoolFailedMetrics";
         
         ClientConfiguration();
 
@@ -46,6 +47,11 @@ namespace AWSMetrics
         //! @return Maximum number of retries.
         AZ::s64 GetMaxNumRetries() const;
 
+        //! Status of the spooling. Metrics which reach the maximum number of retries will be written to the local file instead of being dropped,
+        //! and resubmitted once the backend can be reached again.
+        //! @return Whether the spooling of failed metrics is enabled.
+        bool SpoolFailedMetricsEnabled() const;
+
         //! Retrieve the directory of the local metrics file
         //! @return Directory of the local metrics file
         const char* GetMetricsFileDir() const;
@@ -65,6 +71,7 @@ namespace AWSMetrics
         AZ::s64 m_queueFlushPeriodInSeconds; //< Default to 60 seconds to guarantee the near real time data input.
         AZStd::atomic_bool m_offlineRecordingEnabled; //< Default to false to disable the offline recording.
         AZ::s64 m_maxNumRetries; //< Maximum number of retries for submission.
+        bool m_spoolFailedMetricsEnabled; //< Default to false to drop the metrics which reach the maximum number of retries.
 
         AZStd::string m_metricsDir;
         AZStd::string m_metricsFilePath;
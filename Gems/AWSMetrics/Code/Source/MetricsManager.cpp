@@ -214,6 +214,12 @@ namespace AWSMetrics
             {
                 OnResponseReceived(successJob->parameters.m_metricsQueue, successJob->result.m_responseEntries);
 
+                // The backend can be reached again, resubmit the metrics spooled while it couldn't.
+                if (!m_clientConfiguration->OfflineRecordingEnabled() && m_hasSpooledMetrics.exchange(false))
+                {
+                    SubmitLocalMetricsAsync();
+                }
+
                 AZ::TickBus::QueueFunction([requestId]()
                 {
                     AWSMetricsNotificationBus::Broadcast(&AWSMetricsNotifications::OnSendMetricsSuccess, requestId);
@@ -237,6 +243,7 @@ namespace AWSMetrics
     void MetricsManager::OnResponseReceived(const MetricsQueue& metricsEventsInRequest, const ServiceAPI::PostMetricsEventsResponseEntries& responseEntries)
     {
         MetricsQueue metricsEventsForRetry;
+        MetricsQueue metricsEventsToSpool;
         int numMetricsEventsInRequest = metricsEventsInRequest.GetNumMetrics();
         for (int index = 0; index < numMetricsEventsInRequest; ++index)
         {
@@ -273,6 +280,13 @@ namespace AWSMetrics
                 {
                     metricsEventsForRetry.AddMetrics(metricsEvent);
                 }
+                else if (m_clientConfiguration->SpoolFailedMetricsEnabled() && !m_clientConfiguration->OfflineRecordingEnabled())
+                {
+                    // Spooled metrics events are counted again when they are resubmitted from the local metrics file.
+                    m_globalStats.m_numErrors--;
+                    m_globalStats.m_numEvents--;
+                    metricsEventsToSpool.AddMetrics(metricsEvent);
+                }
                 else
                 {
                     m_globalStats.m_numDropped++;
@@ -281,6 +295,7 @@ namespace AWSMetrics
         }
 
         PushMetricsForRetry(metricsEventsForRetry);
+        SpoolMetricsAsync(metricsEventsToSpool);
     }
 
     void MetricsManager::PushMetricsForRetry(MetricsQueue& metricsEventsForRetry)
@@ -300,6 +315,37 @@ namespace AWSMetrics
         m_globalStats.m_numDropped += m_metricsQueue.FilterMetricsByPriority(m_clientConfiguration->GetMaxQueueSizeInBytes());
     }
 
+    void MetricsManager::SpoolMetricsAsync(MetricsQueue& metricsEventsToSpool)
+    {
+        if (metricsEventsToSpool.GetNumMetrics() == 0)
+        {
+            return;
+        }
+
+        auto metricsQueue = AZStd::make_shared<MetricsQueue>();
+        metricsQueue->AppendMetrics(metricsEventsToSpool);
+
+        // Write the metrics events on the job context since the file IO is blocking.
+        AZ::Job* job{ nullptr };
+        job = AZ::CreateJobFunction(
+            [this, metricsQueue]()
+            {
+                AZ::Outcome<void, AZStd::string> outcome = SendMetricsToFile(metricsQueue);
+                if (outcome.IsSuccess())
+                {
+                    m_hasSpooledMetrics = true;
+                }
+                else
+                {
+                    AZ_Warning("AWSMetrics", false, "Failed to spool the metrics events to the local file: %s", outcome.GetError().c_str());
+                    m_globalStats.m_numDropped += metricsQueue->GetNumMetrics();
+                }
+            },
+            true, m_jobContext.get());
+
+        job->Start();
+    }
+
     AZ::Outcome<void, AZStd::string> MetricsManager::SendMetricsToFile(AZStd::shared_ptr<MetricsQueue> metricsQueue)
     {
         AZStd::lock_guard<AZStd::mutex> lock(m_metricsFileMutex);
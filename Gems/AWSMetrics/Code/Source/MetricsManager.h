@@ -121,12 +121,18 @@ namespace AWSMetrics
         //! @param metricsEventsForRetry Metrics events for retry.
         void PushMetricsForRetry(MetricsQueue& metricsEventsForRetry);
 
+        //! Write the metrics events which reached the maximum number of retries to the local metrics file asynchronously,
+        //! so they can be resubmitted once the backend can be reached again.
+        //! @param metricsEventsToSpool Metrics events to write.
+        void SpoolMetricsAsync(MetricsQueue& metricsEventsToSpool);
+
         void SubmitLocalMetricsAsync();
 
         AZStd::mutex m_metricsMutex; //!< Mutex to protect the metrics queue
         MetricsQueue m_metricsQueue; //!< Queue fo buffering the metrics events
 
         AZStd::mutex m_metricsFileMutex; //!< Mutex to protect the local metrics file
+        AZStd::atomic<bool> m_hasSpooledMetrics{ false }; //!< Whether failed metrics were written to the local metrics file for resubmission
 
         AZStd::atomic<int> m_sendMetricsId;//!< Request ID for sending metrics
 
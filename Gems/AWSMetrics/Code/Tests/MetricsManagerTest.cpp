@@ -14,6 +14,7 @@
 #include <MetricsManager.h>
 
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -531,6 +532,36 @@ namespace AWSMetrics
         ASSERT_EQ(m_metricsManager->GetNumBufferedMetrics(), 0);
     }
 
+    TEST_F(MetricsManagerTest, OnResponseReceived_MaxNumRetriesWithSpooling_SpoolMetrics)
+    {
+        m_settingsRegistry->Set(
+            AZStd::string::format("%s%s", AZ::SettingsRegistryMergeUtils::OrganizationRootKey, ClientConfiguration::AWSMetricsSpoolFailedMetricsKey),
+            true);
+
+        // Reset the config file to change the max queue size setting.
+        ResetClientConfig(false, (double)TestMetricsEventSizeInBytes * (MaxNumMetricsEvents + 1) / MbToBytes,
+            DefaultFlushPeriodInSeconds, 0);
+
+        MetricsQueue metricsEvents;
+        for (int index = 0; index < MaxNumMetricsEvents; ++index)
+        {
+            metricsEvents.AddMetrics(MetricsEvent());
+        }
+
+        m_metricsManager->OnResponseReceived(metricsEvents);
+
+        // The metrics events are written to the local metrics file instead of being dropped,
+        // and are counted when they are resubmitted.
+        const GlobalStatistics& stats = m_metricsManager->GetGlobalStatistics();
+        EXPECT_EQ(stats.m_numEvents, 0);
+        EXPECT_EQ(stats.m_numSuccesses, 0);
+        EXPECT_EQ(stats.m_numErrors, 0);
+        EXPECT_EQ(stats.m_sendSizeInBytes, 0);
+        EXPECT_EQ(stats.m_numDropped, 0);
+
+        ASSERT_EQ(m_metricsManager->GetNumBufferedMetrics(), 0);
+    }
+
     TEST_F(MetricsManagerTest, PushMetricsForRetries_NoRetry_DropMetrics)
     {
         // Reset the config file to change the max queue size setting.
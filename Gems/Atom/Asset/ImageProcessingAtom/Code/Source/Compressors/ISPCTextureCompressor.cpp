@@ -7,6 +7,12 @@
  */
 
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/function/function_template.h>
 
 #include <Atom/ImageProcessing/ImageObject.h>
@@ -55,6 +61,71 @@ namespace ImageProcessingAtom
         AZStd::function<void(astc_enc_settings*, int block_width, int block_height)>   m_astcAlpha;
     };
 
+    // Number of 4x4 block rows compressed by a single job, large mips are split into strips of this height.
+    static constexpr uint32_t BlockRowsPerJob = 32;
+
+    // Compresses the surface in horizontal strips of blocks on parallel jobs, the blocks of a strip only read the
+    // source rows they cover and only write their own rows of the destination.
+    static void CompressSurfaceInStrips(
+        const rgba_surface& sourceSurface,
+        AZ::u8* destinationImageData,
+        uint32_t destinationPitch,
+        const AZStd::function<void(const rgba_surface*, uint8_t*)>& compressBlocks)
+    {
+        const uint32_t stripHeight = BlockRowsPerJob * 4;
+        const uint32_t height = static_cast<uint32_t>(sourceSurface.height);
+        if (height <= stripHeight)
+        {
+            compressBlocks(&sourceSurface, destinationImageData);
+            return;
+        }
+
+        auto compressStrip = [&sourceSurface, destinationImageData, destinationPitch, &compressBlocks, stripHeight, height](uint32_t stripIndex)
+        {
+            const uint32_t firstRow = stripIndex * stripHeight;
+            rgba_surface stripSurface = sourceSurface;
+            stripSurface.ptr = sourceSurface.ptr + static_cast<size_t>(firstRow) * sourceSurface.stride;
+            stripSurface.height = static_cast<int32_t>(AZStd::min(stripHeight, height - firstRow));
+            compressBlocks(&stripSurface, destinationImageData + static_cast<size_t>(stripIndex) * BlockRowsPerJob * destinationPitch);
+        };
+
+        // Same as the ASTC compressor, run the strips as children of the current job if we are on one,
+        // otherwise wait for them through a completion job.
+        AZ::Job* currentJob = AZ::JobContext::GetGlobalContext()->GetJobManager().GetCurrentJob();
+        AZ::JobCompletion completionJob;
+
+        const uint32_t stripCount = AZ::DivideAndRoundUp(height, stripHeight);
+        for (uint32_t stripIndex = 1; stripIndex < stripCount; ++stripIndex)
+        {
+            AZ::Job* stripJob = AZ::CreateJobFunction([&compressStrip, stripIndex]()
+            {
+                compressStrip(stripIndex);
+            }, true, nullptr);
+
+            if (currentJob)
+            {
+                currentJob->StartAsChild(stripJob);
+            }
+            else
+            {
+                stripJob->SetDependent(&completionJob);
+                stripJob->Start();
+            }
+        }
+
+        // Compress the first strip on this thread while the jobs run.
+        compressStrip(0);
+
+        if (currentJob)
+        {
+            currentJob->WaitForChildren();
+        }
+        else
+        {
+            completionJob.StartAndWaitForCompletion();
+        }
+    }
+
     bool ISPCCompressor::IsCompressedPixelFormatSupported(EPixelFormat fmt)
     {
         // Even though the ISPC compressor support ASTC formats. But it has restrictions
@@ -210,7 +281,11 @@ namespace ImageProcessingAtom
             switch (destinationFormat)
             {
             case ePixelFormat_BC3:
-                CompressBlocksBC3(&sourceSurface, destinationImageData);
+                CompressSurfaceInStrips(sourceSurface, destinationImageData, destinationPitch,
+                    [](const rgba_surface* surface, uint8_t* blocks)
+                    {
+                        CompressBlocksBC3(surface, blocks);
+                    });
                 break;
             case ePixelFormat_BC6UH:
             {
@@ -220,7 +295,11 @@ namespace ImageProcessingAtom
                 setProfile(&settings);
 
                 // Compress with BC6 half precision
-                CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
+                CompressSurfaceInStrips(sourceSurface, destinationImageData, destinationPitch,
+                    [&settings](const rgba_surface* surface, uint8_t* blocks)
+                    {
+                        CompressBlocksBC6H(surface, blocks, &settings);
+                    });
             }
             break;
             case ePixelFormat_BC7:
@@ -232,7 +311,11 @@ namespace ImageProcessingAtom
                 setProfile(&settings);
 
                 // Compress with BC7
-                CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
+                CompressSurfaceInStrips(sourceSurface, destinationImageData, destinationPitch,
+                    [&settings](const rgba_surface* surface, uint8_t* blocks)
+                    {
+                        CompressBlocksBC7(surface, blocks, &settings);
+                    });
             }
             break;
             default:
@@ -14,6 +14,7 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/math.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzCore/StringFunc/StringFunc.h>
@@ -31,10 +32,12 @@
 #include <Atom/RPI.Reflect/Image/AttachmentImageAssetCreator.h>
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 
+#include <Atom/RPI.Public/Pass/ParentPass.h>
 #include <Atom/RPI.Public/Pass/Pass.h>
 #include <Atom/RPI.Public/Pass/PassSystemInterface.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/ViewportContextBus.h>
+#include <Atom/RPI.Public/WindowContext.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Shader/ShaderSystem.h>
@@ -136,6 +139,10 @@ AZ_CVAR(uint32_t, r_height, 1080, cvar_r_resolution_Changed, AZ::ConsoleFunctorF
 AZ_CVAR(uint32_t, r_fullscreen, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Starting fullscreen state.");
 AZ_CVAR(uint32_t, r_resolutionMode, 0, cvar_r_resolution_Changed, AZ::ConsoleFunctorFlags::DontReplicate, "0: render resolution same as window client area size, 1: render resolution use the values specified by r_width and r_height");
 AZ_CVAR(float, r_renderScale, 1.0f, cvar_r_renderScale_Changed, AZ::ConsoleFunctorFlags::DontReplicate, "Scale to apply to the window resolution.");
+AZ_CVAR(bool, r_dynamicResolution, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Lower the render resolution below r_renderScale when the GPU frame time exceeds r_dynamicResolutionTargetFrameTimeMs.");
+AZ_CVAR(float, r_dynamicResolutionTargetFrameTimeMs, 16.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The GPU frame time in milliseconds the dynamic resolution holds.");
+AZ_CVAR(float, r_dynamicResolutionMinScale, 0.5f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The minimum scale the dynamic resolution applies to the render resolution.");
+AZ_CVAR(uint32_t, r_dynamicResolutionAdjustmentFrames, 30, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of frames the GPU frame time is averaged over before the dynamic resolution is adjusted.");
 AZ_CVAR(AZ::CVarFixedString, r_antiAliasing, "", cvar_r_antiAliasing_Changed, AZ::ConsoleFunctorFlags::DontReplicate, "The anti-aliasing to be used for the current render pipeline. Available options: MSAA, TAA, SMAA");
 AZ_CVAR(uint16_t, r_multiSampleCount, 0, cvar_r_multiSample_Changed, AZ::ConsoleFunctorFlags::DontReplicate, "The multi-sample count to be used for the current render pipeline."); // 0 stands for unchanged, load the default setting from the pipeline itself
 
@@ -512,7 +519,7 @@ namespace AZ
                 {
                     // wait until swapchain has been created before setting fullscreen state
                     AzFramework::WindowSize resolution;
-                    float scale = AZStd::max(static_cast<float>(r_renderScale), 0.f);
+                    float scale = AZStd::max(static_cast<float>(r_renderScale), 0.f) * m_dynamicRenderScale;
                     if (r_resolutionMode > 0u)
                     {
                         resolution.m_width = static_cast<uint32_t>(r_width * scale);
@@ -828,7 +835,85 @@ namespace AZ
                     if (appType.IsGame())
                     {
                         m_viewportContext->RenderTick();
+
+                        // In low latency mode this blocks until the display is ready for the next frame, so the input
+                        // sampled at the start of the next tick is as recent as possible. Does nothing otherwise.
+                        if (const RPI::WindowContextSharedPtr windowContext = m_viewportContext->GetWindowContext())
+                        {
+                            if (const RHI::Ptr<RHI::SwapChain>& swapChain = windowContext->GetSwapChain())
+                            {
+                                swapChain->WaitForPresentLatency();
+                            }
+                        }
+                    }
+                }
+
+                UpdateDynamicResolution();
+            }
+
+            void BootstrapSystemComponent::UpdateDynamicResolution()
+            {
+                // The scale is snapped to steps so small variations of the frame time don't reallocate the attachments of the pipeline,
+                // and the render resolution is recreated the least number of times while the frame time settles.
+                constexpr float ScaleStep = 0.05f;
+                constexpr float MaxScaleChange = 0.2f;
+
+                RPI::PassSystemInterface* passSystem = RPI::PassSystemInterface::Get();
+                const RHI::Ptr<RPI::ParentPass> rootPass = passSystem ? passSystem->GetRootPass() : nullptr;
+
+                if (!r_dynamicResolution || !m_nativeWindow || !rootPass)
+                {
+                    if (m_dynamicResolutionTimestampsEnabled && rootPass)
+                    {
+                        rootPass->SetTimestampQueryEnabled(false);
+                    }
+                    m_dynamicResolutionTimestampsEnabled = false;
+                    m_accumulatedGpuFrameTimeMs = 0.0;
+                    m_numGpuFrameTimeSamples = 0;
+
+                    if (m_dynamicRenderScale != 1.0f)
+                    {
+                        m_dynamicRenderScale = 1.0f;
+                        SetWindowResolution();
                     }
+                    return;
+                }
+
+                // The GPU frame time is measured by the timestamp queries of the root pass, which the profilers can disable
+                if (!rootPass->IsTimestampQueryEnabled())
+                {
+                    rootPass->SetTimestampQueryEnabled(true);
+                    m_dynamicResolutionTimestampsEnabled = true;
+                    return;
+                }
+
+                const uint64_t gpuFrameTimeNs = rootPass->GetLatestTimestampResult().GetDurationInNanoseconds();
+                if (gpuFrameTimeNs == 0)
+                {
+                    return;
+                }
+
+                m_accumulatedGpuFrameTimeMs += aznumeric_cast<double>(gpuFrameTimeNs) / 1000000.0;
+                ++m_numGpuFrameTimeSamples;
+                if (m_numGpuFrameTimeSamples < AZStd::max(static_cast<uint32_t>(r_dynamicResolutionAdjustmentFrames), 1u))
+                {
+                    return;
+                }
+
+                const float averageGpuFrameTimeMs = aznumeric_cast<float>(m_accumulatedGpuFrameTimeMs / m_numGpuFrameTimeSamples);
+                m_accumulatedGpuFrameTimeMs = 0.0;
+                m_numGpuFrameTimeSamples = 0;
+
+                // The cost of most passes is proportional to the number of pixels, which is the square of the scale
+                const float targetFrameTimeMs = AZStd::max(static_cast<float>(r_dynamicResolutionTargetFrameTimeMs), 1.0f);
+                float newScale = m_dynamicRenderScale * AZStd::sqrt(targetFrameTimeMs / averageGpuFrameTimeMs);
+                newScale = AZStd::clamp(newScale, m_dynamicRenderScale - MaxScaleChange, m_dynamicRenderScale + MaxScaleChange);
+                newScale = AZStd::clamp(AZStd::round(newScale / ScaleStep) * ScaleStep, AZStd::clamp(static_cast<float>(r_dynamicResolutionMinScale), ScaleStep, 1.0f), 1.0f);
+
+                if (AZStd::abs(newScale - m_dynamicRenderScale) >= ScaleStep * 0.5f)
+                {
+                    m_dynamicRenderScale = newScale;
+                    SetWindowResolution();
                 }
             }
 
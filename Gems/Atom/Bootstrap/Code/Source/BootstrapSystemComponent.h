@@ -105,6 +105,9 @@ namespace AZ
                 void CreateViewportContext();
                 void SetWindowResolution();
 
+                //! Adjust the dynamic render scale from the GPU frame time when r_dynamicResolution is enabled
+                void UpdateDynamicResolution();
+
                 //! Load a render pipeline from disk and add it to the scene
                 RPI::RenderPipelinePtr LoadPipeline(
                     const AZ::RPI::ScenePtr scene,
@@ -138,6 +141,12 @@ namespace AZ
                 AZStd::unordered_map<AzFramework::Scene*, AZStd::weak_ptr<AZ::RPI::Scene>> m_azSceneToAtomSceneMap;
 
                 AZ::SettingsRegistryInterface::NotifyEventHandler m_componentApplicationLifecycleHandler;
+
+                // Dynamic resolution scale applied on top of r_renderScale, and the GPU frame times it's adjusted from
+                float m_dynamicRenderScale = 1.0f;
+                double m_accumulatedGpuFrameTimeMs = 0.0;
+                uint32_t m_numGpuFrameTimeSamples = 0;
+                bool m_dynamicResolutionTimestampsEnabled = false;
             };
         } // namespace Bootstrap
     } // namespace Render
@@ -0,0 +1,15 @@
+{
+    "Source": "LightCullingBounds.azsl",
+    
+    "ProgramSettings" :
+    {
+        "EntryPoints":
+        [
+        {
+            "name": "MainCS",
+            "type" : "Compute"
+        }
+        ]
+    }
+
+}
@@ -0,0 +1,14 @@
+{
+    "Source": "MeshCullingCS.azsl",
+
+    "ProgramSettings":
+    {
+      "EntryPoints":
+      [
+        {
+          "name": "MainCS",
+          "type": "Compute"
+        }
+      ]
+    }
+}
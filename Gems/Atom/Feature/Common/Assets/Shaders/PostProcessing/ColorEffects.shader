@@ -0,0 +1,14 @@
+{
+    "Source": "ColorEffects.azsl",
+
+    "ProgramSettings": 
+    {
+        "EntryPoints": 
+        [
+            {
+                "name": "MainCS",
+                "type": "Compute"
+            }
+        ]
+    }
+}
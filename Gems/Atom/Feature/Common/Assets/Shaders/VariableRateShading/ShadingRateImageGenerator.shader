@@ -0,0 +1,14 @@
+{
+    "Source": "ShadingRateImageGenerator.azsl",
+
+    "ProgramSettings":
+    {
+      "EntryPoints":
+      [
+        {
+          "name": "MainCS",
+          "type": "Compute"
+        }
+      ]
+    }
+}
@@ -89,6 +89,7 @@ set(FILES
     Passes/PaniniProjection.pass
     Passes/FilmGrain.pass
     Passes/Vignette.pass
+    Passes/ColorEffects.pass
     Passes/ContrastAdaptiveSharpening.pass
     Passes/ConvertToAcescg.pass
     Passes/DebugOverlayParent.pass
@@ -199,6 +200,7 @@ set(FILES
     Passes/ReflectionScreenSpaceMobile.pass
     Passes/ReflectionScreenSpaceRayTracing.pass
     Passes/ReflectionScreenSpaceTrace.pass
+    Passes/ShadingRateImageGenerator.pass
     Passes/ShadowParent.pass
     Passes/Skinning.pass
     Passes/SkyAtmosphere.pass
@@ -476,6 +478,8 @@ set(FILES
     Shaders/PostProcessing/FilmGrain.shader
     Shaders/PostProcessing/Vignette.azsl
     Shaders/PostProcessing/Vignette.shader
+    Shaders/PostProcessing/ColorEffects.azsl
+    Shaders/PostProcessing/ColorEffects.shader
     Shaders/PostProcessing/ContrastAdaptiveSharpening.azsl
     Shaders/PostProcessing/ContrastAdaptiveSharpening.shader
     Shaders/PostProcessing/ConvertToAcescg.azsl
@@ -620,6 +624,8 @@ set(FILES
     Shaders/Shadow/FullscreenShadow.shader
     Shaders/Shadow/KawaseShadowBlur.azsl
     Shaders/Shadow/KawaseShadowBlur.shader
+    Shaders/Shadow/RestoreStaticShadowmap.azsl
+    Shaders/Shadow/RestoreStaticShadowmap.shader
     Shaders/Shadow/Shadowmap.azsl
     Shaders/Shadow/Shadowmap.shader
     Shaders/SkinnedMesh/LinearSkinningCS.azsl
@@ -640,4 +646,6 @@ set(FILES
     Shaders/SkyBox/SkyBox_TwoOutputs.shader
     Shaders/SplashScreen/SplashScreenPass.azsl
     Shaders/SplashScreen/SplashScreenPass.shader
+    Shaders/VariableRateShading/ShadingRateImageGenerator.azsl
+    Shaders/VariableRateShading/ShadingRateImageGenerator.shader
 ) 
@@ -24,6 +24,10 @@ namespace AZ::Render::MeshCommon
 
     inline static AZ::Name MeshMovedName = AZ::Name::FromStringLiteral("MeshMoved", AZ::Interface<AZ::NameDictionary>::Get());
 
+    // Set on the cullables of meshes that are expected to keep moving: the ones flagged as always dynamic, and the ones that moved
+    // since they were initialized. Views can render these apart from the static meshes, see RPI::View::SetDynamicCullableFlags().
+    inline static AZ::Name MeshDynamicName = AZ::Name::FromStringLiteral("MeshDynamic", AZ::Interface<AZ::NameDictionary>::Get());
+
     // The DrawListTag name for drawing to MeshMotionVector pass
     inline static AZ::Name MotionDrawListTagName = AZ::Name::FromStringLiteral("motion", AZ::Interface<AZ::NameDictionary>::Get());
 
@@ -67,6 +67,34 @@ namespace AZ
             "Enable instanced draw calls in the MeshFeatureProcessor, but force one object per draw call. "
             "This is helpful for simulating the worst case scenario for instancing for profiling performance.");
 
+        AZ_CVAR(
+            bool,
+            r_meshInstancingMergeMaterials,
+            false,
+            nullptr,
+            AZ::ConsoleFunctorFlags::Null,
+            "Instance meshes that have different materials of the same material type, shader variants and render states together, "
+            "passing the material parameter index of each instance in the view srg m_instanceMaterialParameterIndices buffer. "
+            "Requires r_bindlessMaterials, and shaders that read their material parameters by instance.");
+
+        AZ_CVAR(
+            bool,
+            r_meshGpuCullingEnabled,
+            false,
+            nullptr,
+            AZ::ConsoleFunctorFlags::Null,
+            "Cull mesh instances and select their lods on the GPU, and draw instance groups with indirect draw calls. "
+            "Requires r_meshInstancingEnabled, and only applies to views rendered by a pipeline that contains a MeshCullingPass.");
+
+        AZ_CVAR(
+            bool,
+            r_meshGpuClusterCullingEnabled,
+            true,
+            nullptr,
+            AZ::ConsoleFunctorFlags::Null,
+            "When culling on the GPU, also test the meshlet clusters of models built with meshlets, and cull instances whose "
+            "clusters are all outside the view frustum or facing away from the camera.");
+
         class ModelDataInstance;
 
         //! Mesh feature processor data types for customizing model materials
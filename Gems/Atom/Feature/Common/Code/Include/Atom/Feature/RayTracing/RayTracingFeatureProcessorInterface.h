@@ -30,7 +30,9 @@ namespace AZ::Render
 
         Tangent = AZ_BIT(0),
         Bitangent = AZ_BIT(1),
-        UV = AZ_BIT(2)
+        UV = AZ_BIT(2),
+        // The UVs are stored as half floats
+        QuantizedUV = AZ_BIT(3)
     };
     AZ_DEFINE_ENUM_BITWISE_OPERATORS(AZ::Render::RayTracingSubMeshBufferFlags);
 
@@ -349,9 +351,15 @@ namespace AZ::Render
         //! RayTracingAccelerationStructurePass
         virtual void UpdateRayTracingSrgs() = 0;
 
+        //! Returns true if the TLAS was refit with new instance transforms this frame, instead of being rebuilt
+        virtual bool IsTlasRefit() const = 0;
+
         struct SubMeshBlasInstance
         {
             RHI::Ptr<RHI::RayTracingBlas> m_blas;
+
+            // compacted copy of m_blas, which replaces it once the compaction is recorded on every device
+            RHI::Ptr<RHI::RayTracingBlas> m_compactedBlas;
         };
 
         struct MeshBlasInstance
@@ -362,6 +370,19 @@ namespace AZ::Render
             // Flags indicating if the Blas objects in the sub-mesh list are already built
             RHI::MultiDevice::DeviceMask m_blasBuilt = RHI::MultiDevice::NoDevices;
             bool m_isSkinnedMesh = false;
+
+            // the Blas objects are only built once they are scheduled within the per-frame build budget,
+            // until then the instances of the mesh are inactive in the TLAS
+            bool m_buildScheduled = false;
+            uint32_t m_triangleCount = 0;
+
+            // compaction state, the Blas objects are compacted once their compacted size is read back
+            bool m_compactionEnabled = false;
+            bool m_compacted = false;
+            uint32_t m_framesSinceBuild = 0;
+
+            // Flags indicating if the compaction of the Blas objects is already recorded
+            RHI::MultiDevice::DeviceMask m_blasCompacted = RHI::MultiDevice::NoDevices;
         };
 
         using BlasInstanceMap = AZStd::unordered_map<AZ::Data::AssetId, MeshBlasInstance>;
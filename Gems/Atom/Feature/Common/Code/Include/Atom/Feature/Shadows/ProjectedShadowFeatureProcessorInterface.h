@@ -81,6 +81,8 @@ namespace AZ::Render
         //! See MeshCommon::MeshMovedName for the name of the flag used to track movement
         //! See RPI::Scene::GetViewTagBitRegistry() for where the flag bits are determined
         //! See RPI::View::GetOrFlags() for how the bits are retrieved
+        //! Unless r_projectedShadowStaticCasterCache is off, the meshes flagged with MeshCommon::MeshDynamicName are rendered on top
+        //! of a cache of the static casters, so they don't cause the static casters to re-render.
         virtual void SetUseCachedShadows(ShadowId id, bool useCachedShadows) = 0;
         //! Sets all of the shadow properties in one call
         virtual void SetShadowProperties(ShadowId id, const ProjectedShadowDescriptor& descriptor) = 0;
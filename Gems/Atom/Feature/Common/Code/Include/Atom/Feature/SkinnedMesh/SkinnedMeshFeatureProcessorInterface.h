@@ -12,6 +12,8 @@
 #include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
 #include <AtomCore/Instance/Instance.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/functional.h>
 
 namespace AZ
 {
@@ -38,6 +40,9 @@ namespace AZ
                 SkinnedMeshShaderOptions m_shaderOptions;
             };
 
+            //! Receives the skinned positions of a mesh, or no positions if the readback failed
+            using SkinnedPositionsCallback = AZStd::function<void(AZStd::vector<Vector3>&& positions)>;
+
             //! Given a descriptor of the input and output for skinning, acquire a handle to the instance that will be skinned
             virtual SkinnedMeshHandle AcquireSkinnedMesh(const SkinnedMeshHandleDescriptor& desc) = 0;
             //! Releases the skinned mesh handle
@@ -51,6 +56,10 @@ namespace AZ
             virtual void EnableSkinning(const SkinnedMeshHandle& handle, uint32_t lodIndex, uint32_t meshIndex) = 0;
             //! Disable skinning for a given mesh and lod of a skinned mesh handle
             virtual void DisableSkinning(const SkinnedMeshHandle& handle, uint32_t lodIndex, uint32_t meshIndex) = 0;
+            //! Copies the skinned vertex positions of a mesh back to the CPU, for the rare gameplay queries that need the deformed vertices.
+            //! The positions are copied after the next skinning pass, and the callback is called from another thread once the GPU
+            //! finished the copy, usually a few frames later. The positions are in model space, as of the last frame the lod was skinned.
+            virtual void ReadbackSkinnedPositions(const SkinnedMeshHandle& handle, uint32_t lodIndex, uint32_t meshIndex, SkinnedPositionsCallback callback) = 0;
         };
     } // namespace Render
 } // namespace AZ
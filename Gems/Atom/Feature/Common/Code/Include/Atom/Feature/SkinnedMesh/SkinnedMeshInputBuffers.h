@@ -178,6 +178,9 @@ namespace AZ
             //! Get the number of vertices for the specified lod.
             uint32_t GetVertexCount(uint32_t lodIndex, uint32_t meshIndex) const;
 
+            //! Get the skinning input buffer views of a mesh, with the names of the SRG inputs they are bound to
+            const AZStd::vector<SkinnedSubMeshProperties::SrgNameViewPair>& GetInputBufferViews(uint32_t lodIndex, uint32_t meshIndex) const;
+
             //! Set the buffer views and vertex count on the given SRG
             void SetBufferViewsOnShaderResourceGroup(uint32_t lodIndex, uint32_t meshIndex, const Data::Instance<RPI::ShaderResourceGroup>& perInstanceSRG);
 
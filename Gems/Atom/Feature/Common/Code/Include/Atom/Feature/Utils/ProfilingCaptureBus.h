@@ -30,6 +30,10 @@ namespace AZ
 
             //! Dump the benchmark metadata to a json file.
             virtual bool CaptureBenchmarkMetadata(const AZStd::string& benchmarkName, const AZStd::string& outputFilePath) = 0;
+
+            //! Record the Timestamp and PipelineStatistics of passes for a number of frames, and dump them to a json file in the
+            //! format of the CPU profiler captures, so they can be viewed next to a CPU capture of the same frames.
+            virtual bool CaptureGpuProfilingTrace(const AZStd::string& outputFilePath, uint32_t frameCount) = 0;
         };
         using ProfilingCaptureRequestBus = EBus<ProfilingCaptureRequests>;
 
@@ -58,6 +62,11 @@ namespace AZ
             //! @param result Set to true if it's finished successfully
             //! @param info The output file path or error information which depends on the return.
             virtual void OnCaptureBenchmarkMetadataFinished(bool result, const AZStd::string& info) = 0;
+
+            //! Notify when the current GPU profiling trace capture is finished
+            //! @param result Set to true if it's finished successfully
+            //! @param info The output file path or error information which depends on the return.
+            virtual void OnCaptureGpuProfilingTraceFinished(bool result, const AZStd::string& info) = 0;
         };
         using ProfilingCaptureNotificationBus = EBus<ProfilingCaptureNotifications>;
 
@@ -41,7 +41,8 @@ namespace AZ
 
         int32_t AuxGeomDrawQueue::AddViewProjOverride(const AZ::Matrix4x4& viewProj)
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_buffersWriteLock);
+            AZStd::lock_guard<AZStd::mutex> overridesLock(m_viewProjOverridesLock);
             AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
 
             //the override matrix is pushed an array that persists until the frame is over, so that the matrix can be looked up later
@@ -51,7 +52,8 @@ namespace AZ
 
         int32_t AuxGeomDrawQueue::GetOrAdd2DViewProjOverride()
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_buffersWriteLock);
+            AZStd::lock_guard<AZStd::mutex> overridesLock(m_viewProjOverridesLock);
             AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
 
             if (buffer.m_2DViewProjOverrideIndex == -1)
@@ -64,7 +66,8 @@ namespace AZ
                     0.0f,  0.0f, 0.0f, 1.0f};
                 static Matrix4x4 s_proj2D = Matrix4x4::CreateFromRowMajorFloat16(s_Matrix4x4Floats);
 
-                buffer.m_2DViewProjOverrideIndex = AddViewProjOverride(s_proj2D);
+                buffer.m_viewProjOverrides.push_back(s_proj2D);
+                buffer.m_2DViewProjOverrideIndex = aznumeric_cast<int32_t>(buffer.m_viewProjOverrides.size()) - 1;
             }
             return buffer.m_2DViewProjOverrideIndex;
         }
@@ -753,10 +756,11 @@ namespace AZ
             // get a mutually exclusive lock and then switch to the next buffer, returning a pointer to the current buffer (before the switch)
 
             // grab the lock
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_buffersWriteLock);
 
             // get a pointer to the buffer we have been filling
             AuxGeomBufferData* filledBufferData = &m_buffers[m_currentBufferIndex];
+            MergeThreadBuffers(*filledBufferData);
 
             // switch the buffer for future requests to the other buffer
             m_currentBufferIndex = (m_currentBufferIndex + 1) % NumBuffers;
@@ -791,6 +795,97 @@ namespace AZ
             data.m_2DViewProjOverrideIndex = -1;
         }
 
+        template<typename WriteFunction>
+        void AuxGeomDrawQueue::WriteThreadBuffer(WriteFunction&& writeFunction)
+        {
+            const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(m_buffersWriteLock);
+                auto threadBufferIt = m_threadBuffers.find(threadId);
+                if (threadBufferIt != m_threadBuffers.end())
+                {
+                    // Only this thread writes to its buffer, the shared lock is enough to keep a commit from reading it
+                    writeFunction(*threadBufferIt->second);
+                    return;
+                }
+            }
+
+            // The first draw of this thread, the thread buffers are kept across commits so this rarely happens
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_buffersWriteLock);
+            AZStd::unique_ptr<AuxGeomBufferData>& threadBuffer = m_threadBuffers[threadId];
+            if (!threadBuffer)
+            {
+                threadBuffer = AZStd::make_unique<AuxGeomBufferData>();
+            }
+            writeFunction(*threadBuffer);
+        }
+
+        void AuxGeomDrawQueue::MergeThreadBuffers(AuxGeomBufferData& buffer)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "AuxGeomDrawQueue: MergeThreadBuffers");
+            // no need for mutex here, this function is only called from a function holding the lock exclusively
+            DynamicPrimitiveData& primitives = buffer.m_primitiveData;
+
+            for (auto& [threadId, threadBuffer] : m_threadBuffers)
+            {
+                DynamicPrimitiveData& threadPrimitives = threadBuffer->m_primitiveData;
+                if (!threadPrimitives.m_primitiveBuffer.empty())
+                {
+                    const size_t vertexCountTotal = primitives.m_vertexBuffer.size() + threadPrimitives.m_vertexBuffer.size();
+                    if (vertexCountTotal > MaxDynamicVertexCount)
+                    {
+                        AZ_WarningOnce("AuxGeom", false, "Draw function ignored, would exceed maximum allowed index of %d", MaxDynamicVertexCount);
+                    }
+                    else
+                    {
+                        const AuxGeomIndex vertexOffset = aznumeric_cast<AuxGeomIndex>(primitives.m_vertexBuffer.size());
+                        const AuxGeomIndex indexOffset = aznumeric_cast<AuxGeomIndex>(primitives.m_indexBuffer.size());
+
+                        primitives.m_vertexBuffer.insert(
+                            primitives.m_vertexBuffer.end(), threadPrimitives.m_vertexBuffer.begin(), threadPrimitives.m_vertexBuffer.end());
+                        primitives.m_indexBuffer.reserve(primitives.m_indexBuffer.size() + threadPrimitives.m_indexBuffer.size());
+                        for (AuxGeomIndex index : threadPrimitives.m_indexBuffer)
+                        {
+                            primitives.m_indexBuffer.push_back(vertexOffset + index);
+                        }
+
+                        for (PrimitiveBufferEntry& primitive : threadPrimitives.m_primitiveBuffer)
+                        {
+                            // The indices of the thread's first primitive follow the ones of the previous thread's last primitive
+                            if (ShouldBatchDraw(primitives, primitive.m_primitiveType, primitive.m_blendMode, primitive.m_depthReadType,
+                                primitive.m_depthWriteType, primitive.m_faceCullMode, primitive.m_width, primitive.m_viewProjOverrideIndex) &&
+                                primitive.m_indexOffset == 0)
+                            {
+                                primitives.m_primitiveBuffer.back().m_indexCount += primitive.m_indexCount;
+                            }
+                            else
+                            {
+                                primitive.m_indexOffset += indexOffset;
+                                primitives.m_primitiveBuffer.push_back(primitive);
+                            }
+                        }
+                    }
+
+                    threadPrimitives.m_primitiveBuffer.clear();
+                    threadPrimitives.m_vertexBuffer.clear();
+                    threadPrimitives.m_indexBuffer.clear();
+                }
+
+                for (int drawStyle = 0; drawStyle < DrawStyle_Count; ++drawStyle)
+                {
+                    auto appendAndClear = [](auto& destination, auto& source)
+                    {
+                        destination.insert(destination.end(), source.begin(), source.end());
+                        source.clear();
+                    };
+                    appendAndClear(buffer.m_opaqueShapes[drawStyle], threadBuffer->m_opaqueShapes[drawStyle]);
+                    appendAndClear(buffer.m_translucentShapes[drawStyle], threadBuffer->m_translucentShapes[drawStyle]);
+                    appendAndClear(buffer.m_opaqueBoxes[drawStyle], threadBuffer->m_opaqueBoxes[drawStyle]);
+                    appendAndClear(buffer.m_translucentBoxes[drawStyle], threadBuffer->m_translucentBoxes[drawStyle]);
+                }
+            }
+        }
+
         bool AuxGeomDrawQueue::ShouldBatchDraw(
             DynamicPrimitiveData& primBuffer, 
             AuxGeomPrimitiveType primType, 
@@ -833,56 +928,56 @@ namespace AZ
             AZ::u8 width,
             int32_t viewProjOverrideIndex)
         {
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
-
-            // We have a separate PrimitiveBufferEntry for each AuxGeomDraw call
-            DynamicPrimitiveData& primBuffer = buffer.m_primitiveData;
+            // write to the buffer of this thread, so that a commit cannot happen during it and
+            // other threads can keep adding geometry to theirs
+            WriteThreadBuffer([&](AuxGeomBufferData& buffer)
+            {
+                // We have a separate PrimitiveBufferEntry for each AuxGeomDraw call
+                DynamicPrimitiveData& primBuffer = buffer.m_primitiveData;
 
-            AuxGeomIndex vertexOffset = aznumeric_cast<AuxGeomIndex>(primBuffer.m_vertexBuffer.size());
-            AuxGeomIndex indexOffset = aznumeric_cast<AuxGeomIndex>(primBuffer.m_indexBuffer.size());
-            const size_t vertexCountTotal = aznumeric_cast<size_t>(vertexOffset) + vertexCount;
+                AuxGeomIndex vertexOffset = aznumeric_cast<AuxGeomIndex>(primBuffer.m_vertexBuffer.size());
+                AuxGeomIndex indexOffset = aznumeric_cast<AuxGeomIndex>(primBuffer.m_indexBuffer.size());
+                const size_t vertexCountTotal = aznumeric_cast<size_t>(vertexOffset) + vertexCount;
 
-            if (vertexCountTotal > MaxDynamicVertexCount)
-            {
-                AZ_WarningOnce("AuxGeom", false, "Draw function ignored, would exceed maximum allowed index of %d", MaxDynamicVertexCount);
-                return;
-            }
+                if (vertexCountTotal > MaxDynamicVertexCount)
+                {
+                    AZ_WarningOnce("AuxGeom", false, "Draw function ignored, would exceed maximum allowed index of %d", MaxDynamicVertexCount);
+                    return;
+                }
 
-            AZ::Vector3 center(0.0f, 0.0f, 0.0f);
-            for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
-            {
-                AZ::u32 packedColor = packedColorFunction(vertexIndex);
-                const AZ::Vector3& vertex = points[vertexIndex];
-                primBuffer.m_vertexBuffer.push_back(AuxGeomDynamicVertex(vertex, packedColor));
-                primBuffer.m_indexBuffer.push_back(vertexOffset + vertexIndex);
+                AZ::Vector3 center(0.0f, 0.0f, 0.0f);
+                for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+                {
+                    AZ::u32 packedColor = packedColorFunction(vertexIndex);
+                    const AZ::Vector3& vertex = points[vertexIndex];
+                    primBuffer.m_vertexBuffer.push_back(AuxGeomDynamicVertex(vertex, packedColor));
+                    primBuffer.m_indexBuffer.push_back(vertexOffset + vertexIndex);
 
-                center += vertex;
-            }
-            center /= static_cast<float>(vertexCount);
+                    center += vertex;
+                }
+                center /= static_cast<float>(vertexCount);
 
-            AuxGeomBlendMode blendMode = isOpaque ? BlendMode_Off : BlendMode_Alpha;
-            if (ShouldBatchDraw(primBuffer, primitiveType, blendMode, depthRead, depthWrite, faceCull, width, viewProjOverrideIndex))
-            {
-                auto& primitive = primBuffer.m_primitiveBuffer.back();
-                primitive.m_indexCount += vertexCount;
-            }
-            else
-            {
-                auto& primitive = primBuffer.m_primitiveBuffer.emplace_back();
-                primitive.m_primitiveType = primitiveType;
-                primitive.m_depthReadType = depthRead;
-                primitive.m_depthWriteType = depthWrite;
-                primitive.m_blendMode = blendMode;
-                primitive.m_faceCullMode = faceCull;
-                primitive.m_width = width;
-                primitive.m_indexOffset = indexOffset;
-                primitive.m_indexCount = vertexCount;
-                primitive.m_center = center;
-                primitive.m_viewProjOverrideIndex = viewProjOverrideIndex;
-            }
+                AuxGeomBlendMode blendMode = isOpaque ? BlendMode_Off : BlendMode_Alpha;
+                if (ShouldBatchDraw(primBuffer, primitiveType, blendMode, depthRead, depthWrite, faceCull, width, viewProjOverrideIndex))
+                {
+                    auto& primitive = primBuffer.m_primitiveBuffer.back();
+                    primitive.m_indexCount += vertexCount;
+                }
+                else
+                {
+                    auto& primitive = primBuffer.m_primitiveBuffer.emplace_back();
+                    primitive.m_primitiveType = primitiveType;
+                    primitive.m_depthReadType = depthRead;
+                    primitive.m_depthWriteType = depthWrite;
+                    primitive.m_blendMode = blendMode;
+                    primitive.m_faceCullMode = faceCull;
+                    primitive.m_width = width;
+                    primitive.m_indexOffset = indexOffset;
+                    primitive.m_indexCount = vertexCount;
+                    primitive.m_center = center;
+                    primitive.m_viewProjOverrideIndex = viewProjOverrideIndex;
+                }
+            });
         }
 
         void AuxGeomDrawQueue::DrawPrimitiveWithSharedVerticesCommon(
@@ -904,98 +999,98 @@ namespace AZ
                 "Index count must be at least %d and must be a multiple of %d",
                 verticesPerPrimitiveType, verticesPerPrimitiveType);
 
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
-
-            // We have a separate PrimitiveBufferEntry for each AuxGeomDraw call
-            DynamicPrimitiveData& primBuffer = buffer.m_primitiveData;
+            // write to the buffer of this thread, so that a commit cannot happen during it and
+            // other threads can keep adding geometry to theirs
+            WriteThreadBuffer([&](AuxGeomBufferData& buffer)
+            {
+                // We have a separate PrimitiveBufferEntry for each AuxGeomDraw call
+                DynamicPrimitiveData& primBuffer = buffer.m_primitiveData;
 
-            AuxGeomIndex vertexOffset = aznumeric_cast<AuxGeomIndex>(primBuffer.m_vertexBuffer.size());
-            AuxGeomIndex indexOffset = aznumeric_cast<AuxGeomIndex>(primBuffer.m_indexBuffer.size());
-            const size_t vertexCountTotal = aznumeric_cast<size_t>(vertexOffset) + vertexCount;
+                AuxGeomIndex vertexOffset = aznumeric_cast<AuxGeomIndex>(primBuffer.m_vertexBuffer.size());
+                AuxGeomIndex indexOffset = aznumeric_cast<AuxGeomIndex>(primBuffer.m_indexBuffer.size());
+                const size_t vertexCountTotal = aznumeric_cast<size_t>(vertexOffset) + vertexCount;
 
-            if (vertexCountTotal > MaxDynamicVertexCount)
-            {
-                AZ_WarningOnce("AuxGeom", false, "Draw function ignored, would exceed maximum allowed index of %d", MaxDynamicVertexCount);
-                return;
-            }
+                if (vertexCountTotal > MaxDynamicVertexCount)
+                {
+                    AZ_WarningOnce("AuxGeom", false, "Draw function ignored, would exceed maximum allowed index of %d", MaxDynamicVertexCount);
+                    return;
+                }
 
-            AZ::Vector3 center(0.0f, 0.0f, 0.0f);
-            for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
-            {
-                AZ::u32 packedColor = packedColorFunction(vertexIndex);
-                const AZ::Vector3& vertex = points[vertexIndex];
-                primBuffer.m_vertexBuffer.push_back(AuxGeomDynamicVertex(vertex, packedColor));
+                AZ::Vector3 center(0.0f, 0.0f, 0.0f);
+                for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+                {
+                    AZ::u32 packedColor = packedColorFunction(vertexIndex);
+                    const AZ::Vector3& vertex = points[vertexIndex];
+                    primBuffer.m_vertexBuffer.push_back(AuxGeomDynamicVertex(vertex, packedColor));
 
-                center += vertex;
-            }
-            center /= aznumeric_cast<float>(vertexCount);
+                    center += vertex;
+                }
+                center /= aznumeric_cast<float>(vertexCount);
 
-            for (uint32_t index = 0; index < indexCount; ++index)
-            {
-                primBuffer.m_indexBuffer.push_back(vertexOffset + indexFunction(index));
-            }
+                for (uint32_t index = 0; index < indexCount; ++index)
+                {
+                    primBuffer.m_indexBuffer.push_back(vertexOffset + indexFunction(index));
+                }
 
-            AuxGeomBlendMode blendMode = isOpaque ? BlendMode_Off : BlendMode_Alpha;
-            if (ShouldBatchDraw(primBuffer, primitiveType, blendMode, depthRead, depthWrite, faceCull, width, viewProjOverrideIndex))
-            {
-                auto& primitive = primBuffer.m_primitiveBuffer.back();
-                primitive.m_indexCount += indexCount;
-            }
-            else
-            {
-                auto& primitive = primBuffer.m_primitiveBuffer.emplace_back();
-                primitive.m_primitiveType = primitiveType;
-                primitive.m_depthReadType = depthRead;
-                primitive.m_depthWriteType = depthWrite;
-                primitive.m_blendMode = blendMode;
-                primitive.m_faceCullMode = faceCull;
-                primitive.m_width = width;
-                primitive.m_indexOffset = indexOffset;
-                primitive.m_indexCount = indexCount;
-                primitive.m_center = center;
-                primitive.m_viewProjOverrideIndex = viewProjOverrideIndex;
-            }
+                AuxGeomBlendMode blendMode = isOpaque ? BlendMode_Off : BlendMode_Alpha;
+                if (ShouldBatchDraw(primBuffer, primitiveType, blendMode, depthRead, depthWrite, faceCull, width, viewProjOverrideIndex))
+                {
+                    auto& primitive = primBuffer.m_primitiveBuffer.back();
+                    primitive.m_indexCount += indexCount;
+                }
+                else
+                {
+                    auto& primitive = primBuffer.m_primitiveBuffer.emplace_back();
+                    primitive.m_primitiveType = primitiveType;
+                    primitive.m_depthReadType = depthRead;
+                    primitive.m_depthWriteType = depthWrite;
+                    primitive.m_blendMode = blendMode;
+                    primitive.m_faceCullMode = faceCull;
+                    primitive.m_width = width;
+                    primitive.m_indexOffset = indexOffset;
+                    primitive.m_indexCount = indexCount;
+                    primitive.m_center = center;
+                    primitive.m_viewProjOverrideIndex = viewProjOverrideIndex;
+                }
+            });
         }
 
         void AuxGeomDrawQueue::AddShape(DrawStyle style, const ShapeBufferEntry& shape)
         {
             AuxGeomDrawStyle drawStyle = ConvertRPIDrawStyle(style);
 
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
-
-            if (IsOpaque(shape.m_color))
-            {
-                buffer.m_opaqueShapes[drawStyle].push_back(shape);
-            }
-            else
+            // write to the buffer of this thread, so that a commit cannot happen during it and
+            // other threads can keep adding geometry to theirs
+            WriteThreadBuffer([&](AuxGeomBufferData& buffer)
             {
-                buffer.m_translucentShapes[drawStyle].push_back(shape);
-            }
+                if (IsOpaque(shape.m_color))
+                {
+                    buffer.m_opaqueShapes[drawStyle].push_back(shape);
+                }
+                else
+                {
+                    buffer.m_translucentShapes[drawStyle].push_back(shape);
+                }
+            });
         }
 
         void AuxGeomDrawQueue::AddBox(DrawStyle style, BoxBufferEntry& box)
         {
             AuxGeomDrawStyle drawStyle = ConvertRPIDrawStyle(style);
 
-            // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
-            // other threads can't add geometry during it
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
-            AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
-
-            if (IsOpaque(box.m_color))
-            {
-                buffer.m_opaqueBoxes[drawStyle].push_back(box);
-            }
-            else
+            // write to the buffer of this thread, so that a commit cannot happen during it and
+            // other threads can keep adding geometry to theirs
+            WriteThreadBuffer([&](AuxGeomBufferData& buffer)
             {
-                buffer.m_translucentBoxes[drawStyle].push_back(box);
-            }
+                if (IsOpaque(box.m_color))
+                {
+                    buffer.m_opaqueBoxes[drawStyle].push_back(box);
+                }
+                else
+                {
+                    buffer.m_translucentBoxes[drawStyle].push_back(box);
+                }
+            });
         }
 
     } // namespace Render
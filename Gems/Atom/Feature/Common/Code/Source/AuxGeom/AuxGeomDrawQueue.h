@@ -9,7 +9,12 @@
 #pragma once
 
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Math/Transform.h>
 
@@ -31,6 +36,8 @@ namespace AZ
         /**
          * Class that stores up AuxGeom draw requests for one RPI scene.
          * This acts somewhat like a render proxy in that it stores data that is consumed by the feature processor.
+         * Each thread records its draws in its own buffer, so threads drawing at the same time don't wait on each other.
+         * The thread buffers are merged into the buffer returned by Commit.
          */
         class AuxGeomDrawQueue final
             : public RPI::AuxGeomDraw
@@ -83,6 +90,13 @@ namespace AZ
             //! Clear the current buffers
             void ClearCurrentBufferData();
 
+            //! Calls writeFunction with the buffer of the calling thread, while a commit can't happen
+            template<typename WriteFunction>
+            void WriteThreadBuffer(WriteFunction&& writeFunction);
+
+            //! Moves the draws of all the thread buffers to the buffer, then clears the thread buffers
+            void MergeThreadBuffers(AuxGeomBufferData& buffer);
+
             bool ShouldBatchDraw(
                 DynamicPrimitiveData& primBuffer, 
                 AuxGeomPrimitiveType primType, 
@@ -134,7 +148,13 @@ namespace AZ
             int m_currentBufferIndex = 0;
             float m_pointSize = 3.0f;
 
-            AZStd::recursive_mutex m_buffersWriteLock;
+            //! The draws of each thread since the last commit. Their view proj override indices index the shared buffer's overrides.
+            AZStd::unordered_map<AZStd::thread_id, AZStd::unique_ptr<AuxGeomBufferData>> m_threadBuffers;
+
+            //! Drawing threads share it, commits and adding a thread buffer take it exclusively
+            AZStd::shared_mutex m_buffersWriteLock;
+            //! The view proj overrides are shared by all threads, in the buffer being filled
+            AZStd::mutex m_viewProjOverridesLock;
         };
 
     } // namespace Render
@@ -43,6 +43,7 @@
 #include <ColorGrading/LutGenerationPass.h>
 #include <Debug/RayTracingDebugFeatureProcessor.h>
 #include <Debug/RenderDebugFeatureProcessor.h>
+#include <Mesh/MeshCullingPass.h>
 #include <Mesh/MeshFeatureProcessor.h>
 #include <Silhouette/SilhouetteFeatureProcessor.h>
 #include <Silhouette/SilhouetteCompositePass.h>
@@ -78,6 +79,7 @@
 #include <PostProcessing/FilmGrainPass.h>
 #include <PostProcessing/WhiteBalancePass.h>
 #include <PostProcessing/VignettePass.h>
+#include <PostProcessing/ColorEffectsPass.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
 #include <ScreenSpace/DeferredFogPass.h>
 #include <Shadows/ProjectedShadowFeatureProcessor.h>
@@ -86,12 +88,14 @@
 #include <SkyBox/SkyBoxFeatureProcessor.h>
 #include <SplashScreen/SplashScreenFeatureProcessor.h>
 #include <SplashScreen/SplashScreenPass.h>
+#include <VariableRateShading/ShadingRateImageGeneratorPass.h>
 
 #include <Atom/RPI.Public/Pass/PassSystemInterface.h>
 
 #include <Checkerboard/CheckerboardPass.h>
 #include <Checkerboard/CheckerboardColorResolvePass.h>
 
+#include <CoreLights/LightCullingBoundsPass.h>
 #include <CoreLights/LightCullingTilePreparePass.h>
 #include <CoreLights/LightCullingPass.h>
 #include <Shadows/FullscreenShadowPass.h>
@@ -242,9 +246,11 @@ namespace AZ
             passSystem->AddPassCreator(Name("OutputTransformPass"), &OutputTransformPass::Create);
             passSystem->AddPassCreator(Name("EyeAdaptationPass"), &EyeAdaptationPass::Create);
             passSystem->AddPassCreator(Name("ImGuiPass"), &ImGuiPass::Create);
+            passSystem->AddPassCreator(Name("LightCullingBoundsPass"), &LightCullingBoundsPass::Create);
             passSystem->AddPassCreator(Name("LightCullingPass"), &LightCullingPass::Create);
             passSystem->AddPassCreator(Name("LightCullingRemapPass"), &LightCullingRemap::Create);
             passSystem->AddPassCreator(Name("LightCullingTilePreparePass"), &LightCullingTilePreparePass::Create);
+            passSystem->AddPassCreator(Name("MeshCullingPass"), &MeshCullingPass::Create);
             passSystem->AddPassCreator(Name("BlendColorGradingLutsPass"), &BlendColorGradingLutsPass::Create);
             passSystem->AddPassCreator(Name("HDRColorGradingPass"), &HDRColorGradingPass::Create);
             passSystem->AddPassCreator(Name("FullscreenShadowPass"), &FullscreenShadowPass::Create);
@@ -309,6 +315,9 @@ namespace AZ
             // Add Vignette
             passSystem->AddPassCreator(Name("VignettePass"), &VignettePass::Create);
 
+            // Add the fused film grain, white balance and vignette pass
+            passSystem->AddPassCreator(Name("ColorEffectsPass"), &ColorEffectsPass::Create);
+
             // Add Luminance Histogram pass
             passSystem->AddPassCreator(Name("LuminanceHistogramGeneratorPass"), &LuminanceHistogramGeneratorPass::Create);
 
@@ -336,6 +345,9 @@ namespace AZ
             // Add splash screen pass
             passSystem->AddPassCreator(Name("SplashScreenPass"), &Render::SplashScreenPass::Create);
 
+            // Add variable rate shading pass
+            passSystem->AddPassCreator(Name("ShadingRateImageGeneratorPass"), &Render::ShadingRateImageGeneratorPass::Create);
+
             // setup handler for load pass template mappings
             m_loadTemplatesHandler = RPI::PassSystemInterface::OnReadyLoadTemplatesEvent::Handler([this]() { this->LoadPassTemplateMappings(); });
             RPI::PassSystemInterface::Get()->ConnectEvent(m_loadTemplatesHandler);
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CoreLights/LightCullingBoundsPass.h>
+
+#include <Atom/RHI/CommandList.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <AzCore/Math/Vector4.h>
+#include <CoreLights/LightCullingConstants.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        AZ_CVAR(bool, r_lightCullingLightGroupBounds, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Skip the light groups whose bounds don't overlap a tile during the light culling, instead of testing each light against each tile.");
+
+        RPI::Ptr<LightCullingBoundsPass> LightCullingBoundsPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<LightCullingBoundsPass> pass = aznew LightCullingBoundsPass(descriptor);
+            return pass;
+        }
+
+        LightCullingBoundsPass::LightCullingBoundsPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        {
+            LightCulling::InitLightTypeData(m_lightdata);
+        }
+
+        void LightCullingBoundsPass::ResetInternal()
+        {
+            LightCulling::ResetLightTypeData(m_lightdata);
+            m_lightGroupBounds = nullptr;
+            m_lightGroupCount = 0;
+        }
+
+        void LightCullingBoundsPass::BuildInternal()
+        {
+            CreateLightGroupBounds();
+            if (m_lightGroupBounds != nullptr)
+            {
+                AttachBufferToSlot(Name("LightGroupBounds"), m_lightGroupBounds);
+            }
+        }
+
+        void LightCullingBoundsPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            AZ_Assert(m_shaderResourceGroup != nullptr, "LightCullingBoundsPass %s has a null shader resource group when calling CompileResources.", GetPathName().GetCStr());
+
+            LightCulling::GetLightTypeDataFromFeatureProcessors(*m_pipeline->GetScene(), m_lightdata);
+            LightCulling::SetLightTypeDataToSrg(m_lightdata, *m_shaderResourceGroup);
+            m_lightGroupCount = r_lightCullingLightGroupBounds ? LightCulling::GetMaxLightGroupCount(m_lightdata) : 0;
+
+            BindPassSrg(context, m_shaderResourceGroup);
+
+            m_shaderResourceGroup->Compile();
+        }
+
+        void LightCullingBoundsPass::BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context)
+        {
+            // The LightCullingPass reads the same light group count, and doesn't read the bounds when it's 0
+            if (m_lightGroupCount == 0)
+            {
+                return;
+            }
+
+            SetSrgsForDispatch(context);
+
+            // One thread group per light group, and one row of light groups per light type
+            auto arguments{m_dispatchItem.GetArguments()};
+            arguments.m_direct.m_totalNumberOfThreadsX = m_lightGroupCount * LightCulling::LightGroupSize;
+            arguments.m_direct.m_totalNumberOfThreadsY = LightCulling::eLightTypes_Count;
+            arguments.m_direct.m_totalNumberOfThreadsZ = 1;
+            m_dispatchItem.SetArguments(arguments);
+
+            context.GetCommandList()->Submit(m_dispatchItem.GetDeviceDispatchItem(context.GetDeviceIndex()));
+        }
+
+        void LightCullingBoundsPass::CreateLightGroupBounds()
+        {
+            RPI::CommonBufferDescriptor desc;
+            desc.m_poolType = RPI::CommonBufferPoolType::ReadWrite;
+            desc.m_bufferName = "LightGroupBounds";
+            desc.m_elementSize = sizeof(Vector4);
+            desc.m_byteCount = LightCulling::eLightTypes_Count * LightCulling::MaxLightGroupsPerType * 2 * sizeof(Vector4);
+            m_lightGroupBounds = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            AZ_Assert(m_lightGroupBounds != nullptr, "Unable to allocate buffer for the light group bounds");
+            if (m_lightGroupBounds != nullptr)
+            {
+                m_lightGroupBounds->SetAsStructured<Vector4>();
+            }
+        }
+    }   // namespace Render
+}   // namespace AZ
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+#include <CoreLights/LightCullingLightData.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! When enabled, the light culling skips the groups of lights whose bounds don't overlap a tile, see LightCullingBoundsPass.
+        AZ_CVAR_EXTERNED(bool, r_lightCullingLightGroupBounds);
+
+        //! Compute shader that builds the light culling hierarchy on the GPU every frame.
+        //! The lights of each type are split in groups of LightCulling::LightGroupSize consecutive lights, one light for each
+        //! thread of a culling tile, and this pass writes the world space bounds of each group to the LightGroupBounds buffer.
+        //! The LightCullingPass tests a tile against the bounds of a group before testing its lights, so a tile only pays for
+        //! the groups of lights near it. Lights that are placed together are usually added together, which keeps the groups tight.
+        class LightCullingBoundsPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(LightCullingBoundsPass);
+
+        public:
+            AZ_RTTI(AZ::Render::LightCullingBoundsPass, "{6D3C2A1B-8E4F-4B9A-A7C5-2F1E0D9B8C74}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(LightCullingBoundsPass, SystemAllocator);
+            virtual ~LightCullingBoundsPass() = default;
+
+            //! Creates a LightCullingBoundsPass
+            static RPI::Ptr<LightCullingBoundsPass> Create(const RPI::PassDescriptor& descriptor);
+
+        private:
+            LightCullingBoundsPass(const RPI::PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void ResetInternal() override;
+            void BuildInternal() override;
+
+            // Scope producer functions...
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+            void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
+
+            void CreateLightGroupBounds();
+
+            LightCulling::LightTypeDataArray m_lightdata;
+
+            // Two float4 per light group, the minimum and maximum corners of its bounds, for MaxLightGroupsPerType groups of each light type
+            Data::Instance<RPI::Buffer> m_lightGroupBounds;
+            uint32_t m_lightGroupCount = 0;
+        };
+    }   // namespace Render
+}   // namespace AZ
@@ -18,6 +18,12 @@ namespace AZ
             const uint32_t TileDimX = 16;
             const uint32_t TileDimY = 16;
             const uint32_t NumBinsPerTile = 32;
+
+            // The lights of each type are split in groups of one light per thread of a culling tile, and the culling skips the groups
+            // whose bounds don't overlap the tile. These should match the numbers in LightCullingShared.azsli
+            const uint32_t LightGroupSize = TileDimX * TileDimY;
+            // Light indices are 16 bits in the light list, so this covers every light of a type
+            const uint32_t MaxLightGroupsPerType = 65536 / LightGroupSize;
         }
     }
 }
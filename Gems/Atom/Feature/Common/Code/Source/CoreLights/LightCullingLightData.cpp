@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CoreLights/LightCullingLightData.h>
+
+#include <Atom/Feature/Decals/DecalFeatureProcessorInterface.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <AzCore/Math/MathUtils.h>
+#include <CoreLights/CapsuleLightFeatureProcessor.h>
+#include <CoreLights/DiskLightFeatureProcessor.h>
+#include <CoreLights/LightCullingConstants.h>
+#include <CoreLights/PointLightFeatureProcessor.h>
+#include <CoreLights/QuadLightFeatureProcessor.h>
+#include <CoreLights/SimplePointLightFeatureProcessor.h>
+#include <CoreLights/SimpleSpotLightFeatureProcessor.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        namespace LightCulling
+        {
+            void InitLightTypeData(LightTypeDataArray& lightData)
+            {
+                lightData[eLightTypes_SimplePoint].m_lightCountIndex  = Name("m_simplePointLightCount");
+                lightData[eLightTypes_SimplePoint].m_lightBufferIndex = Name("m_simplePointLights");
+                lightData[eLightTypes_SimpleSpot].m_lightCountIndex   = Name("m_simpleSpotLightCount");
+                lightData[eLightTypes_SimpleSpot].m_lightBufferIndex  = Name("m_simpleSpotLights");
+                lightData[eLightTypes_Point].m_lightCountIndex        = Name("m_pointLightCount");
+                lightData[eLightTypes_Point].m_lightBufferIndex       = Name("m_pointLights");
+                lightData[eLightTypes_Disk].m_lightCountIndex         = Name("m_diskLightCount");
+                lightData[eLightTypes_Disk].m_lightBufferIndex        = Name("m_diskLights");
+                lightData[eLightTypes_Capsule].m_lightCountIndex      = Name("m_capsuleLightCount");
+                lightData[eLightTypes_Capsule].m_lightBufferIndex     = Name("m_capsuleLights");
+                lightData[eLightTypes_Quad].m_lightCountIndex         = Name("m_quadLightCount");
+                lightData[eLightTypes_Quad].m_lightBufferIndex        = Name("m_quadLights");
+                lightData[eLightTypes_Decal].m_lightCountIndex        = Name("m_decalCount");
+                lightData[eLightTypes_Decal].m_lightBufferIndex       = Name("m_decals");
+            }
+
+            void ResetLightTypeData(LightTypeDataArray& lightData)
+            {
+                for (auto& elem : lightData)
+                {
+                    elem.m_lightBufferIndex.Reset();
+                    elem.m_lightBuffer = nullptr;
+                    elem.m_lightCountIndex.Reset();
+                    elem.m_lightCount = 0;
+                }
+            }
+
+            void GetLightTypeDataFromFeatureProcessors(const RPI::Scene& scene, LightTypeDataArray& lightData)
+            {
+                const auto simplePointLightFP = scene.GetFeatureProcessor<SimplePointLightFeatureProcessor>();
+                lightData[eLightTypes_SimplePoint].m_lightBuffer = simplePointLightFP->GetLightBuffer();
+                lightData[eLightTypes_SimplePoint].m_lightCount = simplePointLightFP->GetLightCount();
+
+                const auto simpleSpotLightFP = scene.GetFeatureProcessor<SimpleSpotLightFeatureProcessor>();
+                lightData[eLightTypes_SimpleSpot].m_lightBuffer = simpleSpotLightFP->GetLightBuffer();
+                lightData[eLightTypes_SimpleSpot].m_lightCount = simpleSpotLightFP->GetLightCount();
+
+                const auto pointLightFP = scene.GetFeatureProcessor<PointLightFeatureProcessor>();
+                lightData[eLightTypes_Point].m_lightBuffer = pointLightFP->GetLightBuffer();
+                lightData[eLightTypes_Point].m_lightCount = pointLightFP->GetLightCount();
+
+                const auto diskLightFP = scene.GetFeatureProcessor<DiskLightFeatureProcessor>();
+                lightData[eLightTypes_Disk].m_lightBuffer = diskLightFP->GetLightBuffer();
+                lightData[eLightTypes_Disk].m_lightCount = diskLightFP->GetLightCount();
+
+                const auto capsuleLightFP = scene.GetFeatureProcessor<CapsuleLightFeatureProcessor>();
+                lightData[eLightTypes_Capsule].m_lightBuffer = capsuleLightFP->GetLightBuffer();
+                lightData[eLightTypes_Capsule].m_lightCount = capsuleLightFP->GetLightCount();
+
+                const auto quadLightFP = scene.GetFeatureProcessor<QuadLightFeatureProcessor>();
+                lightData[eLightTypes_Quad].m_lightBuffer = quadLightFP->GetLightBuffer();
+                lightData[eLightTypes_Quad].m_lightCount = quadLightFP->GetLightCount();
+
+                const auto decalFP = scene.GetFeatureProcessor<DecalFeatureProcessorInterface>();
+                lightData[eLightTypes_Decal].m_lightBuffer = decalFP->GetDecalBuffer();
+                lightData[eLightTypes_Decal].m_lightCount = decalFP->GetDecalCount();
+            }
+
+            void SetLightTypeDataToSrg(LightTypeDataArray& lightData, RPI::ShaderResourceGroup& srg)
+            {
+                for (auto& elem : lightData)
+                {
+                    srg.SetBuffer(elem.m_lightBufferIndex, elem.m_lightBuffer.get());
+                    elem.m_lightBufferIndex.AssertValid();
+                }
+
+                for (auto& elem : lightData)
+                {
+                    srg.SetConstant(elem.m_lightCountIndex, elem.m_lightCount);
+                    elem.m_lightCountIndex.AssertValid();
+                }
+            }
+
+            uint32_t GetMaxLightGroupCount(const LightTypeDataArray& lightData)
+            {
+                uint32_t maxLightGroupCount = 0;
+                for (const auto& elem : lightData)
+                {
+                    const uint32_t lightGroupCount = DivideAndRoundUp(aznumeric_cast<uint32_t>(elem.m_lightCount), LightGroupSize);
+                    maxLightGroupCount = AZStd::max(maxLightGroupCount, lightGroupCount);
+                }
+                return AZStd::min(maxLightGroupCount, MaxLightGroupsPerType);
+            }
+        } // namespace LightCulling
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/ShaderInputNameIndex.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+
+#include <AzCore/std/containers/array.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Scene;
+        class ShaderResourceGroup;
+    }
+
+    namespace Render
+    {
+        namespace LightCulling
+        {
+            //! The types of lights culled by the light culling passes, in the order of the culling shader
+            enum LightTypes
+            {
+                eLightTypes_SimplePoint,
+                eLightTypes_SimpleSpot,
+                eLightTypes_Point,
+                eLightTypes_Disk,
+                eLightTypes_Capsule,
+                eLightTypes_Quad,
+                eLightTypes_Decal,
+                eLightTypes_Count
+            };
+
+            //! The light buffer and light count of a light type, and their inputs in the pass SRG of a light culling shader
+            struct LightTypeData
+            {
+                Data::Instance<RPI::Buffer>     m_lightBuffer;
+                AZ::RHI::ShaderInputNameIndex   m_lightBufferIndex;
+                AZ::RHI::ShaderInputNameIndex   m_lightCountIndex;
+                int m_lightCount = 0;
+            };
+
+            using LightTypeDataArray = AZStd::array<LightTypeData, eLightTypes_Count>;
+
+            //! Sets the names of the SRG inputs of each light type, which are the same in every light culling shader
+            void InitLightTypeData(LightTypeDataArray& lightData);
+
+            //! Releases the light buffers and resets the SRG inputs
+            void ResetLightTypeData(LightTypeDataArray& lightData);
+
+            //! Gets the light buffers and light counts of this frame from the light feature processors of the scene
+            void GetLightTypeDataFromFeatureProcessors(const RPI::Scene& scene, LightTypeDataArray& lightData);
+
+            //! Sets the light buffers and light counts to the SRG
+            void SetLightTypeDataToSrg(LightTypeDataArray& lightData, RPI::ShaderResourceGroup& srg);
+
+            //! Returns the number of light groups of the light type with the most lights, see LightGroupSize
+            uint32_t GetMaxLightGroupCount(const LightTypeDataArray& lightData);
+        } // namespace LightCulling
+    } // namespace Render
+} // namespace AZ
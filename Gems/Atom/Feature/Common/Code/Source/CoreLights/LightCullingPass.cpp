@@ -14,7 +14,6 @@
 #include <Atom/RHI/FrameGraphAttachmentInterface.h>
 #include <Atom/RHI/Device.h>
 
-#include <Atom/Feature/Decals/DecalFeatureProcessorInterface.h>
 #include <Atom/RHI/ImagePool.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
@@ -30,13 +29,8 @@
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Math/Plane.h>
 #include <AzCore/std/algorithm.h>
-#include <CoreLights/CapsuleLightFeatureProcessor.h>
-#include <CoreLights/DiskLightFeatureProcessor.h>
+#include <CoreLights/LightCullingBoundsPass.h>
 #include <CoreLights/LightCullingConstants.h>
-#include <CoreLights/PointLightFeatureProcessor.h>
-#include <CoreLights/QuadLightFeatureProcessor.h>
-#include <CoreLights/SimplePointLightFeatureProcessor.h>
-#include <CoreLights/SimpleSpotLightFeatureProcessor.h>
 #include <cmath>
 
 namespace AZ
@@ -113,29 +107,15 @@ namespace AZ
         LightCullingPass::LightCullingPass(const RPI::PassDescriptor& descriptor)
             : RPI::ComputePass(descriptor)
         {
-            m_lightdata[eLightTypes_SimplePoint].m_lightCountIndex  = Name("m_simplePointLightCount");
-            m_lightdata[eLightTypes_SimplePoint].m_lightBufferIndex = Name("m_simplePointLights");
-            m_lightdata[eLightTypes_SimpleSpot].m_lightCountIndex   = Name("m_simpleSpotLightCount");
-            m_lightdata[eLightTypes_SimpleSpot].m_lightBufferIndex  = Name("m_simpleSpotLights");
-            m_lightdata[eLightTypes_Point].m_lightCountIndex        = Name("m_pointLightCount");
-            m_lightdata[eLightTypes_Point].m_lightBufferIndex       = Name("m_pointLights");
-            m_lightdata[eLightTypes_Disk].m_lightCountIndex         = Name("m_diskLightCount");
-            m_lightdata[eLightTypes_Disk].m_lightBufferIndex        = Name("m_diskLights");
-            m_lightdata[eLightTypes_Capsule].m_lightCountIndex      = Name("m_capsuleLightCount");
-            m_lightdata[eLightTypes_Capsule].m_lightBufferIndex     = Name("m_capsuleLights");
-            m_lightdata[eLightTypes_Quad].m_lightCountIndex         = Name("m_quadLightCount");
-            m_lightdata[eLightTypes_Quad].m_lightBufferIndex        = Name("m_quadLights");
-            m_lightdata[eLightTypes_Decal].m_lightCountIndex        = Name("m_decalCount");
-            m_lightdata[eLightTypes_Decal].m_lightBufferIndex       = Name("m_decals");
+            LightCulling::InitLightTypeData(m_lightdata);
         }
 
         void LightCullingPass::CompileResources(const RHI::FrameGraphCompileContext& context)
         {
             AZ_Assert(m_shaderResourceGroup != nullptr, "LightCullingPass %s has a null shader resource group when calling FrameBeginInternal.", GetPathName().GetCStr());
 
-            GetLightDataFromFeatureProcessor();
-            SetLightBuffersToSRG();
-            SetLightsCountToSRG();
+            LightCulling::GetLightTypeDataFromFeatureProcessors(*m_pipeline->GetScene(), m_lightdata);
+            LightCulling::SetLightTypeDataToSrg(m_lightdata, *m_shaderResourceGroup);
             SetConstantdataToSRG();
 
             BindPassSrg(context, m_shaderResourceGroup);
@@ -164,35 +144,12 @@ namespace AZ
         {
             m_tileDataIndex = std::numeric_limits<uint32_t>::max();
             m_constantDataIndex.Reset();
+            m_lightGroupCountIndex.Reset();
 
-            for (auto& elem : m_lightdata)
-            {
-                elem.m_lightBufferIndex.Reset();
-                elem.m_lightBuffer = nullptr;
-                elem.m_lightCountIndex.Reset();
-                elem.m_lightCount = 0;
-            }
+            LightCulling::ResetLightTypeData(m_lightdata);
             m_lightList = nullptr;
         }
 
-        void LightCullingPass::SetLightBuffersToSRG()
-        {
-            for (auto& elem : m_lightdata)
-            {
-                m_shaderResourceGroup->SetBuffer(elem.m_lightBufferIndex, elem.m_lightBuffer.get());
-                elem.m_lightBufferIndex.AssertValid();
-            }
-        }
-
-        void LightCullingPass::SetLightsCountToSRG()
-        {
-            for (auto& elem : m_lightdata)
-            {
-                m_shaderResourceGroup->SetConstant(elem.m_lightCountIndex, elem.m_lightCount);
-                elem.m_lightCountIndex.AssertValid();
-            }
-        }
-
         AZ::RHI::Size LightCullingPass::GetDepthBufferResolution()
         {
             const RPI::PassAttachment* tileBuffer = GetInputBinding(m_tileDataIndex).GetAttachment().get();
@@ -225,6 +182,10 @@ namespace AZ
             cullingConstants.m_gridWidth = GetTileDataBufferResolution().m_width;
 
             m_shaderResourceGroup->SetConstant(m_constantDataIndex, cullingConstants);
+
+            // Must match the light groups the LightCullingBoundsPass writes this frame
+            const uint32_t lightGroupCount = r_lightCullingLightGroupBounds ? LightCulling::GetMaxLightGroupCount(m_lightdata) : 0;
+            m_shaderResourceGroup->SetConstant(m_lightGroupCountIndex, lightGroupCount);
         }
 
         uint32_t LightCullingPass::FindInputBinding(const AZ::Name& name)
@@ -265,37 +226,6 @@ namespace AZ
             AttachLightList();
         }
 
-        void LightCullingPass::GetLightDataFromFeatureProcessor()
-        {
-            const auto simplePointLightFP = m_pipeline->GetScene()->GetFeatureProcessor<SimplePointLightFeatureProcessor>();
-            m_lightdata[eLightTypes_SimplePoint].m_lightBuffer = simplePointLightFP->GetLightBuffer();
-            m_lightdata[eLightTypes_SimplePoint].m_lightCount = simplePointLightFP->GetLightCount();
-
-            const auto simpleSpotLightFP = m_pipeline->GetScene()->GetFeatureProcessor<SimpleSpotLightFeatureProcessor>();
-            m_lightdata[eLightTypes_SimpleSpot].m_lightBuffer = simpleSpotLightFP->GetLightBuffer();
-            m_lightdata[eLightTypes_SimpleSpot].m_lightCount = simpleSpotLightFP->GetLightCount();
-
-            const auto pointLightFP = m_pipeline->GetScene()->GetFeatureProcessor<PointLightFeatureProcessor>();
-            m_lightdata[eLightTypes_Point].m_lightBuffer = pointLightFP->GetLightBuffer();
-            m_lightdata[eLightTypes_Point].m_lightCount = pointLightFP->GetLightCount();
-
-            const auto diskLightFP = m_pipeline->GetScene()->GetFeatureProcessor<DiskLightFeatureProcessor>();
-            m_lightdata[eLightTypes_Disk].m_lightBuffer = diskLightFP->GetLightBuffer();
-            m_lightdata[eLightTypes_Disk].m_lightCount = diskLightFP->GetLightCount();
-
-            const auto capsuleLightFP = m_pipeline->GetScene()->GetFeatureProcessor<CapsuleLightFeatureProcessor>();
-            m_lightdata[eLightTypes_Capsule].m_lightBuffer = capsuleLightFP->GetLightBuffer();
-            m_lightdata[eLightTypes_Capsule].m_lightCount = capsuleLightFP->GetLightCount();
-
-            const auto quadLightFP = m_pipeline->GetScene()->GetFeatureProcessor<QuadLightFeatureProcessor>();
-            m_lightdata[eLightTypes_Quad].m_lightBuffer = quadLightFP->GetLightBuffer();
-            m_lightdata[eLightTypes_Quad].m_lightCount = quadLightFP->GetLightCount();
-
-            const auto decalFP = m_pipeline->GetScene()->GetFeatureProcessor<DecalFeatureProcessorInterface>();
-            m_lightdata[eLightTypes_Decal].m_lightBuffer = decalFP->GetDecalBuffer();
-            m_lightdata[eLightTypes_Decal].m_lightCount = decalFP->GetDecalCount();
-        }
-
         float LightCullingPass::CreateTraceValues(const AZ::Vector2& unprojection)
         {
             RHI::Size numTiles = GetTileDataBufferResolution();
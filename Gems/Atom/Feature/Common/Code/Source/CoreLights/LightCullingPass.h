@@ -16,6 +16,7 @@
 #include <Atom/RPI.Public/Pass/ComputePass.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <CoreLights/LightCullingLightData.h>
 
 namespace AZ
 {
@@ -52,13 +53,10 @@ namespace AZ
             void CompileResources(const RHI::FrameGraphCompileContext& context) override;
             void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
 
-            void SetLightBuffersToSRG();
-            void SetLightsCountToSRG();
             void SetConstantdataToSRG();
 
             AZ::RHI::Size GetDepthBufferResolution();
             float CreateTraceValues(const AZ::Vector2& unprojection);
-            void GetLightDataFromFeatureProcessor();
 
             uint32_t FindInputBinding(const AZ::Name& name);
 
@@ -68,29 +66,12 @@ namespace AZ
             void AttachLightList();
 
             AZ::RHI::Size GetTileDataBufferResolution();
-            struct LightTypeData
-            {
-                Data::Instance<RPI::Buffer>     m_lightBuffer;
-                AZ::RHI::ShaderInputNameIndex   m_lightBufferIndex;
-                AZ::RHI::ShaderInputNameIndex   m_lightCountIndex;
-                int m_lightCount = 0;
-            };
 
-            enum LightTypes
-            {
-                eLightTypes_SimplePoint,
-                eLightTypes_SimpleSpot,
-                eLightTypes_Point,
-                eLightTypes_Disk,
-                eLightTypes_Capsule,
-                eLightTypes_Quad,
-                eLightTypes_Decal,
-                eLightTypes_Count
-            };
-
-            AZStd::array<LightTypeData, eLightTypes_Count> m_lightdata;
+            LightCulling::LightTypeDataArray m_lightdata;
 
             AZ::RHI::ShaderInputNameIndex m_constantDataIndex = "m_constantData";
+            // The number of light groups of each light type written by the LightCullingBoundsPass, or 0 to cull every light
+            AZ::RHI::ShaderInputNameIndex m_lightGroupCountIndex = "m_lightGroupCount";
 
             Data::Instance<RPI::Buffer> m_lightList;
 
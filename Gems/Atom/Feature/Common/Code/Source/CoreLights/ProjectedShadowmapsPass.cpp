@@ -65,6 +65,15 @@ namespace AZ
             }
         }
 
+        void ProjectedShadowmapsPass::SetStaticAtlasAttachmentImage(Data::Instance<RPI::AttachmentImage> staticAtlasAttachmentImage)
+        {
+            if (m_staticAtlasAttachmentImage != staticAtlasAttachmentImage)
+            {
+                m_staticAtlasAttachmentImage = staticAtlasAttachmentImage;
+                QueueForBuildAndInitialization();
+            }
+        }
+
         void ProjectedShadowmapsPass::BuildInternal()
         {
             for (auto passToAddOrRemove : m_passesToAddOrRemove)
@@ -89,6 +98,10 @@ namespace AZ
             }
 
             AttachImageToSlot(Name("Shadowmap"), m_atlasAttachmentImage);
+            if (m_staticAtlasAttachmentImage)
+            {
+                AttachImageToSlot(Name("StaticShadowmap"), m_staticAtlasAttachmentImage);
+            }
             SetEnabled(true);
             Base::BuildInternal();
         }
@@ -35,6 +35,10 @@ namespace AZ
             //! Sets the image to use as the output for all esm passes. This is needed so multiple pipelines in a scene can share the same resource.
             void SetAtlasAttachmentImage(Data::Instance<RPI::AttachmentImage> atlasAttachmentIamge);
 
+            //! Sets the image the static casters of cached shadows are rendered to, with the same layout as the atlas.
+            //! The StaticCasters shadowmap passes render to it and the DynamicCasters passes read it. Can be null if no shadow uses it.
+            void SetStaticAtlasAttachmentImage(Data::Instance<RPI::AttachmentImage> staticAtlasAttachmentImage);
+
             void QueueAddChild(RPI::Ptr<Pass> pass);
             void QueueRemoveChild(RPI::Ptr<Pass> pass);
 
@@ -48,6 +52,7 @@ namespace AZ
             RHI::DrawListTag m_drawListTag;
             RPI::PipelineViewTag m_pipelineViewTag;
             Data::Instance<RPI::AttachmentImage> m_atlasAttachmentImage;
+            Data::Instance<RPI::AttachmentImage> m_staticAtlasAttachmentImage;
 
             struct PassAddRemove
             {
@@ -16,6 +16,8 @@ namespace AZ
 {
     namespace Render
     {
+        static const Name StaticShadowmapSlotName{ "StaticShadowmap" };
+
         // --- Pass Creation ---
 
         RPI::Ptr<Render::ShadowmapPass> ShadowmapPass::Create(const RPI::PassDescriptor& descriptor)
@@ -60,7 +62,7 @@ namespace AZ
             m_childTemplate->m_name = Name{ "ShadowmapPassTemplate" };
             m_childTemplate->m_passClass = "ShadowmapPass";
 
-            m_childTemplate->m_slots.resize(2);
+            m_childTemplate->m_slots.resize(3);
             RPI::PassSlot& slot = m_childTemplate->m_slots[0];
             slot.m_name = Name{ "Shadowmap" };
             slot.m_slotType = RPI::PassSlotType::Output;
@@ -72,6 +74,12 @@ namespace AZ
             skinnedMeshSlot.m_slotType = RPI::PassSlotType::Input;
             skinnedMeshSlot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::InputAssembly;
 
+            // This slot is only connected for DynamicCasters passes, which read the static casters cached by their StaticCasters pass
+            RPI::PassSlot& staticShadowmapSlot = m_childTemplate->m_slots[2];
+            staticShadowmapSlot.m_name = StaticShadowmapSlotName;
+            staticShadowmapSlot.m_slotType = RPI::PassSlotType::Input;
+            staticShadowmapSlot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::Shader;
+
             m_childTemplate->m_connections.resize(1);
             RPI::PassConnection& connection = m_childTemplate->m_connections[0];
             connection.m_localSlot = Name{ "Shadowmap" };
@@ -96,8 +104,21 @@ namespace AZ
             imageViewDescriptor.m_arraySliceMax = m_arraySlice;
 
             RPI::PassAttachmentBinding& binding = GetOutputBinding(0);
+            RPI::PassAttachmentBinding* staticShadowmapBinding = parentPass->FindAttachmentBinding(StaticShadowmapSlotName);
+            const bool hasStaticShadowmap = staticShadowmapBinding && staticShadowmapBinding->GetAttachment();
+            AZ_Assert(
+                m_casterContent == CasterContent::All || hasStaticShadowmap,
+                "[ShadowmapPass %s] Cannot find the static shadowmap image attachment of the parent pass.",
+                GetPathName().GetCStr());
 
             RPI::Ptr<RPI::PassAttachment> attachment = parentPass->GetOutputBinding(0).GetAttachment();
+            if (m_casterContent == CasterContent::StaticCasters && hasStaticShadowmap)
+            {
+                // Render to the cache instead of the shadowmap
+                binding.m_connectedBinding = staticShadowmapBinding;
+                attachment = staticShadowmapBinding->GetAttachment();
+                binding.SetAttachment(attachment);
+            }
             if (!attachment)
             {
                 AZ_Assert(false, "[ShadowmapPass %s] Cannot find shadowmap image attachment.", GetPathName().GetCStr());
@@ -105,6 +126,19 @@ namespace AZ
             }
             const RHI::AttachmentId attachmentId = attachment->GetAttachmentId();
 
+            if (m_casterContent == CasterContent::DynamicCasters && hasStaticShadowmap)
+            {
+                // Read the cached static casters of the same atlas slice
+                RPI::PassAttachmentBinding* inputBinding = FindAttachmentBinding(StaticShadowmapSlotName);
+                inputBinding->m_connectedBinding = staticShadowmapBinding;
+                inputBinding->SetAttachment(staticShadowmapBinding->GetAttachment());
+
+                RHI::ImageViewDescriptor inputViewDescriptor = imageViewDescriptor;
+                inputViewDescriptor.m_aspectFlags = RHI::ImageAspectFlags::Depth;
+                inputBinding->m_unifiedScopeDesc =
+                    RHI::UnifiedScopeAttachmentDescriptor(staticShadowmapBinding->GetAttachment()->GetAttachmentId(), inputViewDescriptor);
+            }
+
             RHI::AttachmentLoadStoreAction action;
             action.m_clearValue = RHI::ClearValue::CreateDepth(1.f);
             action.m_loadAction = m_clearEnabled ? RHI::AttachmentLoadAction::Clear : RHI::AttachmentLoadAction::DontCare;
@@ -142,6 +176,35 @@ namespace AZ
             m_forceRenderNextFrame = true;
         }
 
+        void ShadowmapPass::SetCasterContent(CasterContent casterContent)
+        {
+            if (m_casterContent != casterContent)
+            {
+                m_casterContent = casterContent;
+                QueueForBuildAndInitialization();
+            }
+        }
+
+        ShadowmapPass::CasterContent ShadowmapPass::GetCasterContent() const
+        {
+            return m_casterContent;
+        }
+
+        void ShadowmapPass::SetStaticCasterPass(ShadowmapPass* staticCasterPass)
+        {
+            m_staticCasterPass = staticCasterPass;
+        }
+
+        void ShadowmapPass::SetStaticShadowmapSrg(Data::Instance<RPI::ShaderResourceGroup> staticShadowmapSrg)
+        {
+            m_staticShadowmapSrg = staticShadowmapSrg;
+        }
+
+        bool ShadowmapPass::IsRenderingThisFrame() const
+        {
+            return m_isRenderingThisFrame;
+        }
+
         void ShadowmapPass::SetViewportScissorFromImageSize(const RHI::Size& imageSize)
         {
             const RHI::Viewport viewport(
@@ -169,31 +232,73 @@ namespace AZ
             SetPipelineViewTag(viewTag);
         }
         
+        bool ShadowmapPass::IsStaticContentUnchanged() const
+        {
+            // Draw item count is compared against the last frame to detect cases where a moving object leaves the shadow
+            // frustum. It wouldn't set m_casterMovedBit since its outside the view, but needs to trigger a re-render anyway.
+            if (!m_isStatic || m_forceRenderNextFrame || m_lastFrameDrawCount != m_drawItemCount)
+            {
+                return false;
+            }
+
+            const auto& views = m_pipeline->GetViews(GetPipelineViewTag());
+            if (views.empty() || !views.front())
+            {
+                return false;
+            }
+
+            // The dynamic casters of a view that separates them don't invalidate its static casters
+            const RPI::ViewPtr& view = views.front();
+            const uint32_t flags = m_casterContent == CasterContent::StaticCasters ? view->GetStaticOrFlags() : view->GetOrFlags();
+            return (flags & m_casterMovedBit.GetIndex()) == 0;
+        }
+
         void ShadowmapPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
         {
             Base::SetupFrameGraphDependencies(frameGraph);
 
-            // Override the estimated item count set by the base class. Draw item count is compared against
-            // the last frame to detect cases where a moving object leaves the shadow frustum. It wouldn't
-            // set m_casterMovedBit since its outside the view, but needs to trigger a re-render anyway.
-            if (m_isStatic && !m_forceRenderNextFrame && m_lastFrameDrawCount == m_drawItemCount)
+            // Override the estimated item count set by the base class.
+            if (m_casterContent == CasterContent::DynamicCasters)
             {
-                const auto& views = m_pipeline->GetViews(GetPipelineViewTag());
-                if (!views.empty())
-                {
-                    const RPI::ViewPtr& view = views.front();
-                    if (view && (view->GetOrFlags() & m_casterMovedBit.GetIndex()) == 0)
-                    {
-                        // Shadow is static and no casters moved since last frame.
-                        frameGraph.SetEstimatedItemCount(0);
-                    }
-                }
+                // The static casters are restored from the cache, so the shadow only needs to render again when they changed,
+                // or when dynamic casters are in view this frame or were last frame. The static caster pass is an earlier
+                // sibling, so it already decided if it renders this frame.
+                m_isRenderingThisFrame = m_forceRenderNextFrame || m_drawItemCount > 0 || m_lastFrameDrawCount > 0 ||
+                    (m_staticCasterPass && m_staticCasterPass->IsRenderingThisFrame());
             }
             else
             {
-                // Report + 1 to make room for the clear draw packet.
-                frameGraph.SetEstimatedItemCount(static_cast<uint32_t>(m_drawListView.size() + 1));
+                // Shadow is static and no casters moved since last frame.
+                m_isRenderingThisFrame = !IsStaticContentUnchanged();
             }
+
+            // Report + 1 to make room for the clear draw packet.
+            frameGraph.SetEstimatedItemCount(m_isRenderingThisFrame ? static_cast<uint32_t>(m_drawListView.size() + 1) : 0);
+        }
+
+        void ShadowmapPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            if (m_staticShadowmapSrg && m_casterContent == CasterContent::DynamicCasters)
+            {
+                const RPI::PassAttachmentBinding* binding = FindAttachmentBinding(StaticShadowmapSlotName);
+                if (binding && binding->GetAttachment())
+                {
+                    const RHI::ImageView* imageView = context.GetImageView(
+                        binding->GetAttachment()->GetAttachmentId(),
+                        binding->m_unifiedScopeDesc.GetAsImage().m_imageViewDescriptor,
+                        RHI::ScopeAttachmentUsage::Shader);
+                    m_staticShadowmapSrg->SetImageView(m_staticShadowmapIndex, imageView);
+                    m_staticShadowmapSrg->Compile();
+                }
+            }
+
+            Base::CompileResources(context);
+        }
+
+        RHI::DrawListView ShadowmapPass::GetViewDrawList(RPI::View& view) const
+        {
+            // A view that separates its dynamic casters only has the static ones in its main draw list
+            return m_casterContent == CasterContent::DynamicCasters ? view.GetDynamicDrawList(m_drawListTag) : view.GetDrawList(m_drawListTag);
         }
 
         void ShadowmapPass::SubmitDrawItems(const RHI::FrameGraphExecuteContext& context, uint32_t startIndex, uint32_t endIndex, uint32_t offset) const
@@ -56,6 +56,33 @@ namespace AZ
             //! When the shadow is static, this forces the shadow to still re-render next frame (due to the light moving for instance)
             void ForceRenderNextFrame();
 
+            //! Which casters of the shadow view this pass renders.
+            enum class CasterContent : uint8_t
+            {
+                //! Every caster, to the Shadowmap attachment of the parent pass
+                All,
+                //! Only the static casters, to the StaticShadowmap attachment of the parent pass, which caches them
+                StaticCasters,
+                //! Only the dynamic casters, on top of the static casters restored from the StaticShadowmap attachment
+                DynamicCasters,
+            };
+
+            //! Sets which casters this pass renders. The shadow view must separate its dynamic casters for the static and dynamic
+            //! content, see RPI::View::SetDynamicCullableFlags(). Changing the content requires a rebuild of the pass.
+            void SetCasterContent(CasterContent casterContent);
+            CasterContent GetCasterContent() const;
+
+            //! Sets the pass that renders the static casters of this pass's shadow. A DynamicCasters pass only re-renders when there
+            //! are dynamic casters or the static casters were re-rendered, and restores the static casters with the clear draw packet,
+            //! which must be created with SetStaticShadowmapSrg.
+            void SetStaticCasterPass(ShadowmapPass* staticCasterPass);
+
+            //! Sets the SRG the clear draw packet of a DynamicCasters pass reads the cached static shadowmap from.
+            void SetStaticShadowmapSrg(Data::Instance<RPI::ShaderResourceGroup> staticShadowmapSrg);
+
+            //! Returns true if this pass renders its draws this frame, which is only known after SetupFrameGraphDependencies.
+            bool IsRenderingThisFrame() const;
+
             //! This update viewport and scissor for this shadowmap from the given image size.
             void SetViewportScissorFromImageSize(const RHI::Size& imageSize);
 
@@ -75,10 +102,15 @@ namespace AZ
             // RHI::Pass overrides...
             void BuildInternal() override;
             void SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph) override;
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
             void FrameEndInternal() override;
 
             // RPI::RasterPass overrides...
             void SubmitDrawItems(const RHI::FrameGraphExecuteContext& context, uint32_t startIndex, uint32_t endIndex, uint32_t indexOffset) const override;
+            RHI::DrawListView GetViewDrawList(RPI::View& view) const override;
+
+            // Returns true if the static content of the shadow is unchanged since the last frame it rendered
+            bool IsStaticContentUnchanged() const;
 
             // Gets the number of expected draws, taking into account if this shadow is static.
             uint32_t GetNumDraws() const;
@@ -86,9 +118,14 @@ namespace AZ
             RHI::ConstPtr<RHI::DrawPacket> m_clearShadowDrawPacket;
             RHI::DrawItemProperties m_clearShadowDrawItemProperties;
             RHI::Handle<uint32_t> m_casterMovedBit;
+            Data::Instance<RPI::ShaderResourceGroup> m_staticShadowmapSrg;
+            RHI::ShaderInputNameIndex m_staticShadowmapIndex = "m_staticShadowmap";
+            ShadowmapPass* m_staticCasterPass = nullptr;
             uint16_t m_arraySlice = 0;
+            CasterContent m_casterContent = CasterContent::All;
             bool m_clearEnabled = true;
             bool m_isStatic = false;
+            bool m_isRenderingThisFrame = true;
             uint32_t m_lastFrameDrawCount = 0;
             mutable bool m_forceRenderNextFrame = false;
         };
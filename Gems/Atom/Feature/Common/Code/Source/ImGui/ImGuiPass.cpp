@@ -590,26 +590,40 @@ namespace AZ
             Base::SetupFrameGraphDependencies(frameGraph);
             auto imguiContextScope = ImguiContextScope(m_imguiContext);
             ImGui::Render();
-            uint32_t drawCount = UpdateImGuiResources();
-            frameGraph.SetEstimatedItemCount(drawCount);
+            const uint32_t drawCmdCount = UpdateImGuiResources();
 
             m_drawInfos.NextBuffer();
             m_drawInfos.Get().clear();
-            m_drawInfos.Get().reserve(drawCount);
+            m_userTextures.clear();
+            if (drawCmdCount > 0)
+            {
+                m_drawInfos.Get().reserve(drawCmdCount);
+                BuildDrawInfos();
+            }
+            frameGraph.SetEstimatedItemCount(aznumeric_cast<uint32_t>(m_drawInfos.Get().size()));
         }
 
-        void ImGuiPass::CompileResources([[maybe_unused]] const RHI::FrameGraphCompileContext& context)
+        void ImGuiPass::BuildDrawInfos()
         {
+            AZ_PROFILE_SCOPE(AzRender, "ImGuiPass: BuildDrawInfos");
+
             // Create all the DrawIndexeds so they can be submitted in parallel on BuildCommandListInternal()
             uint32_t vertexOffset = 0;
             uint32_t indexOffset = 0;
-            
-            m_userTextures.clear();
+
+            AZStd::vector<DrawInfo>& drawInfos = m_drawInfos.Get();
             for (ImDrawData& drawData : m_drawData)
             {
                 for (int32_t cmdListIdx = 0; cmdListIdx < drawData.CmdListsCount; cmdListIdx++)
                 {
                     const ImDrawList* drawList = drawData.CmdLists[cmdListIdx];
+
+                    // Consecutive commands of a draw list use contiguous indices, so the ones sharing the texture and the clip
+                    // rect are merged into a single draw. Commands of different draw lists use a different vertex offset.
+                    bool canMergeWithLastDraw = false;
+                    uint32_t lastDrawIndexOffset = 0;
+                    uint32_t lastDrawIndexCount = 0;
+
                     for (const ImDrawCmd& drawCmd : drawList->CmdBuffer)
                     {
                         AZ_Assert(drawCmd.UserCallback == nullptr, "ImGui UserCallbacks are not supported by the ImGui Pass");
@@ -621,16 +635,28 @@ namespace AZ
                         scissorMaxX = AZStd::min(scissorMaxX, m_viewportWidth);
                         scissorMaxY = AZStd::min(scissorMaxY, m_viewportHeight);
 
+                        const RHI::Scissor scissor(
+                            static_cast<int32_t>(drawCmd.ClipRect.x),
+                            static_cast<int32_t>(drawCmd.ClipRect.y),
+                            scissorMaxX,
+                            scissorMaxY);
+
                         // check if texture id needs to be bound to the srg
                         uint32_t index = 0;
                         if (drawCmd.TextureId && drawCmd.TextureId != m_imguiFontTexId)
                         {
-                            if (m_userTextures.size() < MaxUserTextures)
+                            Data::Instance<RPI::StreamingImage> img = reinterpret_cast<RPI::StreamingImage*>(drawCmd.TextureId);
+                            // Textures drawn several times in the frame reuse the index they were first bound to
+                            auto textureIt = m_userTextures.find(img);
+                            if (textureIt != m_userTextures.end())
+                            {
+                                index = textureIt->second;
+                            }
+                            else if (m_userTextures.size() < MaxUserTextures)
                             {
-                                Data::Instance<RPI::StreamingImage> img = reinterpret_cast<RPI::StreamingImage*>(drawCmd.TextureId);
                                 // Texture index 0 is reserved for the font atlas, so we start from 1 to 15 for user textures.
                                 index = aznumeric_cast<uint32_t>(m_userTextures.size() + 1);
-                                m_userTextures[img.get()] = index;
+                                m_userTextures.emplace(AZStd::move(img), index);
                             }
                             else
                             {
@@ -638,30 +664,42 @@ namespace AZ
                             }
                         }
 
+                        if (canMergeWithLastDraw)
+                        {
+                            DrawInfo& lastDrawInfo = drawInfos.back();
+                            const RHI::Scissor& lastScissor = lastDrawInfo.m_scissor;
+                            if (lastDrawInfo.m_drawInstanceArgs.m_instanceOffset == index &&
+                                lastScissor.m_minX == scissor.m_minX && lastScissor.m_minY == scissor.m_minY &&
+                                lastScissor.m_maxX == scissor.m_maxX && lastScissor.m_maxY == scissor.m_maxY)
+                            {
+                                lastDrawIndexCount += drawCmd.ElemCount;
+                                lastDrawInfo.m_geometryView.SetDrawArguments(
+                                    RHI::DrawIndexed(vertexOffset, lastDrawIndexCount, lastDrawIndexOffset));
+                                indexOffset += drawCmd.ElemCount;
+                                continue;
+                            }
+                        }
+
                         RHI::GeometryView geometryView;
                         geometryView.SetDrawArguments(RHI::DrawIndexed(vertexOffset, drawCmd.ElemCount, indexOffset));
                         geometryView.SetIndexBufferView(m_indexBufferView);
                         geometryView.AddStreamBufferView(m_vertexBufferView[0]);
                         geometryView.AddStreamBufferView(m_vertexBufferView[1]);
 
-                        m_drawInfos.Get().push_back(
-                            {
-                                RHI::DrawInstanceArguments(1, index),
-                                geometryView,
-                                RHI::Scissor(
-                                    static_cast<int32_t>(drawCmd.ClipRect.x),
-                                    static_cast<int32_t>(drawCmd.ClipRect.y),
-                                             scissorMaxX,
-                                             scissorMaxY
-                                )
-                            }
-                        );
+                        drawInfos.push_back({ RHI::DrawInstanceArguments(1, index), geometryView, scissor });
 
+                        canMergeWithLastDraw = true;
+                        lastDrawIndexOffset = indexOffset;
+                        lastDrawIndexCount = drawCmd.ElemCount;
                         indexOffset += drawCmd.ElemCount;
                     }
                     vertexOffset += drawList->VtxBuffer.size();
                 }
             }
+        }
+
+        void ImGuiPass::CompileResources([[maybe_unused]] const RHI::FrameGraphCompileContext& context)
+        {
             m_drawData.clear();
             
             auto imguiContextScope = ImguiContextScope(m_imguiContext);
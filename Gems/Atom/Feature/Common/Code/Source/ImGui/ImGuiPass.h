@@ -148,9 +148,13 @@ namespace AZ
                 AZStd::vector<DrawInfo>& Get() { return m_drawInfos[m_currentIndex]; }
             };
 
-            //! Updates the index and vertex buffers, and returns the total number of draw items.
+            //! Updates the index and vertex buffers, and returns the total number of ImGui draw commands.
             uint32_t UpdateImGuiResources();
 
+            //! Creates the draw items of the frame from the ImGui draw commands, merging consecutive commands that share
+            //! the texture and clip rect, and assigns the user textures to their shader resource group slots.
+            void BuildDrawInfos();
+
             // Initializes ImGui related data in the pass. Called during the pass's initialization phase.
             void InitializeImGui();
 
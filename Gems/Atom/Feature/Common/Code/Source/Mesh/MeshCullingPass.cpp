@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshCullingPass.h>
+#include <Mesh/MeshFeatureProcessor.h>
+
+#include <Atom/RHI/CommandList.h>
+#include <Atom/RHI/FrameGraphAttachmentInterface.h>
+#include <Atom/RHI/FrameGraphInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <Atom/RPI.Public/View.h>
+#include <AzCore/Math/Frustum.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        RPI::Ptr<MeshCullingPass> MeshCullingPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<MeshCullingPass> pass = aznew MeshCullingPass(descriptor);
+            return pass;
+        }
+
+        MeshCullingPass::MeshCullingPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        {
+        }
+
+        void MeshCullingPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            m_viewResources = nullptr;
+            m_entryBuffer = nullptr;
+            m_clusterBuffer = nullptr;
+            m_entryCount = 0;
+
+            MeshFeatureProcessor* meshFeatureProcessor = GetScene() ? GetScene()->GetFeatureProcessor<MeshFeatureProcessor>() : nullptr;
+            RPI::ViewPtr view = GetView();
+            if (meshFeatureProcessor && view)
+            {
+                MeshGpuCulling& gpuCulling = meshFeatureProcessor->GetMeshGpuCulling();
+                m_viewResources = gpuCulling.RequestView(view.get());
+                if (m_viewResources)
+                {
+                    m_entryBuffer = gpuCulling.GetEntryBuffer();
+                    m_clusterBuffer = gpuCulling.GetClusterBuffer();
+                    m_entryCount = gpuCulling.GetEntryCount();
+                }
+            }
+
+            SetTargetThreadCounts(AZStd::max(m_entryCount, 1u), 1, 1);
+
+            RPI::ComputePass::FrameBeginInternal(params);
+        }
+
+        void MeshCullingPass::ImportViewBuffer(RHI::FrameGraphInterface frameGraph, const Data::Instance<RPI::Buffer>& buffer)
+        {
+            const RHI::AttachmentId& attachmentId = buffer->GetAttachmentId();
+            if (!frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
+            {
+                [[maybe_unused]] RHI::ResultCode result = frameGraph.GetAttachmentDatabase().ImportBuffer(attachmentId, buffer->GetRHIBuffer());
+                AZ_Assert(result == RHI::ResultCode::Success, "Failed to import mesh culling buffer with error %d", result);
+            }
+
+            RHI::BufferScopeAttachmentDescriptor desc;
+            desc.m_attachmentId = attachmentId;
+            desc.m_bufferViewDescriptor = buffer->GetBufferViewDescriptor();
+            desc.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::Load;
+
+            frameGraph.UseShaderAttachment(desc, RHI::ScopeAttachmentAccess::ReadWrite, RHI::ScopeAttachmentStage::ComputeShader);
+        }
+
+        void MeshCullingPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
+        {
+            RPI::ComputePass::SetupFrameGraphDependencies(frameGraph);
+
+            if (m_viewResources)
+            {
+                ImportViewBuffer(frameGraph, m_viewResources->m_indirectArgsBuffer);
+                ImportViewBuffer(frameGraph, m_viewResources->m_instanceBuffer);
+            }
+        }
+
+        void MeshCullingPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            if (m_viewResources && m_shaderResourceGroup)
+            {
+                const RPI::ViewPtr view = GetView();
+
+                m_shaderResourceGroup->SetBufferView(m_cullingEntriesIndex, m_entryBuffer->GetBufferView());
+                m_shaderResourceGroup->SetBufferView(m_cullingClustersIndex, m_clusterBuffer->GetBufferView());
+                m_shaderResourceGroup->SetBufferView(m_indirectArgsIndex, m_viewResources->m_indirectArgsBuffer->GetBufferView());
+                m_shaderResourceGroup->SetBufferView(m_visibleInstancesIndex, m_viewResources->m_instanceBuffer->GetBufferView());
+
+                const Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
+                AZStd::array<Vector4, Frustum::PlaneId::MAX> frustumPlanes;
+                for (int planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    frustumPlanes[planeId] = frustum.GetPlane(static_cast<Frustum::PlaneId>(planeId)).GetPlaneEquationCoefficients();
+                }
+                m_shaderResourceGroup->SetConstantArray(m_frustumPlanesIndex, frustumPlanes);
+
+                // Matches the lod selection of RPI::View culling, see ModelLodUtils::ApproxScreenPercentage
+                const Matrix4x4& viewToClip = view->GetViewToClipMatrix();
+                const bool isPerspective = viewToClip.GetElement(3, 3) == 0.0f;
+                m_shaderResourceGroup->SetConstant(m_cameraPositionIndex, view->GetViewToWorldMatrix().GetTranslation());
+                m_shaderResourceGroup->SetConstant(m_lodScaleIndex, viewToClip.GetElement(1, 1));
+                m_shaderResourceGroup->SetConstant(m_isPerspectiveIndex, isPerspective ? 1u : 0u);
+
+                m_shaderResourceGroup->SetConstant(m_entryCountIndex, m_entryCount);
+                m_shaderResourceGroup->SetConstant(m_indirectArgsStrideIndex, m_viewResources->m_indirectArgsStride);
+                m_shaderResourceGroup->SetConstant(m_instanceCountOffsetIndex, m_viewResources->m_instanceCountOffset);
+                m_shaderResourceGroup->SetConstant(m_viewUsageFlagsIndex, aznumeric_cast<uint32_t>(view->GetUsageFlags()));
+            }
+
+            RPI::ComputePass::CompileResources(context);
+        }
+
+        void MeshCullingPass::BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context)
+        {
+            // Without any entries the indirect draws of the view all stay at zero instances
+            if (m_viewResources)
+            {
+                RPI::ComputePass::BuildCommandListInternal(context);
+            }
+        }
+    } // namespace Render
+} // namespace AZ
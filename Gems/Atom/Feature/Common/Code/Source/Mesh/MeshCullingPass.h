@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/ShaderInputNameIndex.h>
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+#include <Mesh/MeshGpuCulling.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Culls the instanced meshes of the pass's view on the GPU and writes the indirect draw arguments and visible instance
+        //! lists used by the view's raster passes. Adding this pass to a pipeline moves its view to the GPU culling path of the
+        //! MeshFeatureProcessor when r_meshGpuCullingEnabled is set, see MeshGpuCulling.
+        class MeshCullingPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(MeshCullingPass);
+
+        public:
+            AZ_RTTI(AZ::Render::MeshCullingPass, "{6C3E1F8A-4B7D-4E59-9A2C-1D5F8E7B3A60}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(MeshCullingPass, SystemAllocator);
+            virtual ~MeshCullingPass() = default;
+
+            static RPI::Ptr<MeshCullingPass> Create(const RPI::PassDescriptor& descriptor);
+
+        private:
+            MeshCullingPass(const RPI::PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void FrameBeginInternal(FramePrepareParams params) override;
+
+            // Scope producer functions...
+            void SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph) override;
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+            void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
+
+            void ImportViewBuffer(RHI::FrameGraphInterface frameGraph, const Data::Instance<RPI::Buffer>& buffer);
+
+            // The resources of the view culled this frame, null when there is nothing to cull
+            const MeshGpuCulling::ViewResources* m_viewResources = nullptr;
+            Data::Instance<RPI::Buffer> m_entryBuffer;
+            Data::Instance<RPI::Buffer> m_clusterBuffer;
+            uint32_t m_entryCount = 0;
+
+            RHI::ShaderInputNameIndex m_cullingEntriesIndex = "m_cullingEntries";
+            RHI::ShaderInputNameIndex m_cullingClustersIndex = "m_cullingClusters";
+            RHI::ShaderInputNameIndex m_indirectArgsIndex = "m_indirectArgs";
+            RHI::ShaderInputNameIndex m_visibleInstancesIndex = "m_visibleInstances";
+            RHI::ShaderInputNameIndex m_frustumPlanesIndex = "m_frustumPlanes";
+            RHI::ShaderInputNameIndex m_cameraPositionIndex = "m_cameraPosition";
+            RHI::ShaderInputNameIndex m_lodScaleIndex = "m_lodScale";
+            RHI::ShaderInputNameIndex m_isPerspectiveIndex = "m_isPerspective";
+            RHI::ShaderInputNameIndex m_entryCountIndex = "m_entryCount";
+            RHI::ShaderInputNameIndex m_indirectArgsStrideIndex = "m_indirectArgsStride";
+            RHI::ShaderInputNameIndex m_instanceCountOffsetIndex = "m_instanceCountOffset";
+            RHI::ShaderInputNameIndex m_viewUsageFlagsIndex = "m_viewUsageFlags";
+        };
+    } // namespace Render
+} // namespace AZ
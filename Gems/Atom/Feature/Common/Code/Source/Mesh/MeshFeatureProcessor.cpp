@@ -19,6 +19,7 @@
 #include <Atom/RPI.Public/Culling.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/Model/ModelTagSystemComponent.h>
+#include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <Atom/RPI.Public/Scene.h>
 
@@ -147,9 +148,12 @@ namespace AZ
             }
 
             m_meshMovedFlag = GetParentScene()->GetViewTagBitRegistry().AcquireTag(MeshCommon::MeshMovedName);
+            m_meshDynamicFlag = GetParentScene()->GetViewTagBitRegistry().AcquireTag(MeshCommon::MeshDynamicName);
             m_meshMotionDrawListTag = AZ::RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->AcquireTag(MeshCommon::MotionDrawListTagName);
             m_transparentDrawListTag = AZ::RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->AcquireTag(s_transparent_Name);
 
+            m_gpuCulling.Activate();
+
             if (auto* console = AZ::Interface<AZ::IConsole>::Get(); console != nullptr)
             {
                 console->GetCvarValue("r_meshInstancingEnabled", m_enableMeshInstancing);
@@ -192,8 +196,11 @@ namespace AZ
             m_rayTracingFeatureProcessor = nullptr;
             m_reflectionProbeFeatureProcessor = nullptr;
             m_forceRebuildDrawPackets = false;
+            m_gpuCulling.Deactivate();
+            m_retiredDrawPackets.clear();
 
             GetParentScene()->GetViewTagBitRegistry().ReleaseTag(m_meshMovedFlag);
+            GetParentScene()->GetViewTagBitRegistry().ReleaseTag(m_meshDynamicFlag);
             RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->ReleaseTag(m_meshMotionDrawListTag);
             RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->ReleaseTag(m_transparentDrawListTag);
         }
@@ -215,6 +222,12 @@ namespace AZ
             AZ::Job* parentJob = packet.m_parentJob;
             AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
 
+            // The frame that referenced the retired draw packets was ended before the simulation started
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_retiredDrawPacketsMutex);
+                m_retiredDrawPackets.clear();
+            }
+
             // If the instancing cvar has changed, we need to re-initalize the ModelDataInstances
             CheckForInstancingCVarChange();
 
@@ -386,11 +399,13 @@ namespace AZ
                         if (meshDataIter->m_flags.m_cullableNeedsRebuild)
                         {
                             meshDataIter->BuildCullable();
+                            m_gpuCulling.SetEntriesDirty();
                         }
 
                         if (meshDataIter->m_flags.m_cullBoundsNeedsUpdate)
                         {
                             meshDataIter->UpdateCullBounds(this);
+                            m_gpuCulling.SetEntriesDirty();
                         }
                     }
                 };
@@ -473,6 +488,23 @@ namespace AZ
                 // If necessary, allocate memory up front for the work that needs to be done this frame
                 ResizePerViewInstanceVectors(packet.m_views.size());
 
+                // Views rendered by a MeshCullingPass get one indirect draw per instance group, and skip the per-instance work below
+                m_gpuCulling.BeginFrame(m_modelData, *m_transformService);
+                m_perViewGpuCulled.resize(packet.m_views.size());
+                for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
+                {
+                    const RPI::ViewPtr& view = packet.m_views[viewIndex];
+                    m_perViewGpuCulled[viewIndex] = m_gpuCulling.IsViewGpuCulled(view.get());
+                    if (m_perViewGpuCulled[viewIndex])
+                    {
+                        m_gpuCulling.SubmitView(view);
+                    }
+                    else
+                    {
+                        m_gpuCulling.ReleaseView(view);
+                    }
+                }
+
                 {
                     // Iterate over all of the visible objects for each view, and perform the first stage of the bucket sort
                     // where each visible object is sorted into its bucket
@@ -481,6 +513,10 @@ namespace AZ
                     AZ::TaskGraph addVisibleObjectsToBucketsTG{ "AddVisibleObjectsToBuckets" };
                     for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
                     {
+                        if (m_perViewGpuCulled[viewIndex])
+                        {
+                            continue;
+                        }
                         AddVisibleObjectsToBuckets(addVisibleObjectsToBucketsTG, viewIndex, packet.m_views[viewIndex]);
                     }
 
@@ -495,6 +531,10 @@ namespace AZ
                     AZ::TaskGraph sortInstanceBufferBucketsTG{ "SortInstanceBufferBuckets" };
                     for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
                     {
+                        if (m_perViewGpuCulled[viewIndex])
+                        {
+                            continue;
+                        }
                         SortInstanceBufferBuckets(sortInstanceBufferBucketsTG, viewIndex);
                     }
 
@@ -511,6 +551,10 @@ namespace AZ
                     AZ::TaskGraph buildInstanceBufferTG{ "BuildInstanceBuffer" };
                     for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
                     {
+                        if (m_perViewGpuCulled[viewIndex])
+                        {
+                            continue;
+                        }
                         BuildInstanceBufferAndDrawCalls(buildInstanceBufferTG, viewIndex, packet.m_views[viewIndex]);
                     }
 
@@ -521,6 +565,10 @@ namespace AZ
 
                 for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
                 {
+                    if (m_perViewGpuCulled[viewIndex])
+                    {
+                        continue;
+                    }
                     // Now that the per-view instance buffers are up to date on the CPU, update them on the GPU
                     UpdateGPUInstanceBufferForView(viewIndex, packet.m_views[viewIndex]);
                 }
@@ -537,6 +585,11 @@ namespace AZ
                     viewCount, AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>());
             }
 
+            if (m_perViewInstanceMaterialParameterIndices.size() <= viewCount)
+            {
+                m_perViewInstanceMaterialParameterIndices.resize(viewCount, AZStd::vector<uint32_t>());
+            }
+
             if (m_perViewInstanceGroupBuckets.size() <= viewCount)
             {
                 m_perViewInstanceGroupBuckets.resize(viewCount, AZStd::vector<InstanceGroupBucket>());
@@ -561,6 +614,21 @@ namespace AZ
                 }
             }
 
+            if (m_perViewInstanceMaterialParameterIndexBufferHandlers.size() <= viewCount)
+            {
+                GpuBufferHandler::Descriptor desc;
+                desc.m_bufferName = "MeshInstanceMaterialParameterIndexBuffer";
+                desc.m_bufferSrgName = "m_instanceMaterialParameterIndices";
+                desc.m_elementSize = sizeof(uint32_t);
+                desc.m_srgLayout = RPI::RPISystemInterface::Get()->GetViewSrgLayout().get();
+
+                m_perViewInstanceMaterialParameterIndexBufferHandlers.reserve(viewCount);
+                while (m_perViewInstanceMaterialParameterIndexBufferHandlers.size() < viewCount)
+                {
+                    m_perViewInstanceMaterialParameterIndexBufferHandlers.push_back(GpuBufferHandler(desc));
+                }
+            }
+
             AZStd::vector<uint32_t> perBucketInstanceCounts;
             const auto instanceManagerRanges = m_meshInstanceManager.GetParallelRanges();
             if (instanceManagerRanges.size() > 0)
@@ -685,6 +753,7 @@ namespace AZ
                                     SortInstanceData instanceData;
                                     instanceData.m_instanceGroupHandle = postCullingData.m_instanceGroupHandle;
                                     instanceData.m_objectId = postCullingData.m_objectId;
+                                    instanceData.m_materialParameterIndex = postCullingData.m_materialParameterIndex;
                                     instanceData.m_depth = visibleObject.m_depth;
 
                                     // Sort transparent objects in reverse by making their depths negative.
@@ -796,7 +865,9 @@ namespace AZ
             TaskGraph& buildInstanceBufferTG, size_t viewIndex, const RPI::ViewPtr& view)
         {
             AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>& perViewInstanceData = m_perViewInstanceData[viewIndex];
+            AZStd::vector<uint32_t>& perViewMaterialParameterIndices = m_perViewInstanceMaterialParameterIndices[viewIndex];
             AZStd::vector<InstanceGroupBucket>& currentViewInstanceGroupBuckets = m_perViewInstanceGroupBuckets[viewIndex];
+            const bool writeMaterialParameterIndices = r_meshInstancingMergeMaterials;
 
             uint32_t currentBatchStart = 0;
             for (InstanceGroupBucket& instanceGroupBucket : currentViewInstanceGroupBuckets)
@@ -812,7 +883,8 @@ namespace AZ
                         [currentBatchStart,
                         viewIndex,
                         &view,
-                        &perViewInstanceData, &instanceGroupBucket]()
+                        writeMaterialParameterIndices,
+                        &perViewInstanceData, &perViewMaterialParameterIndices, &instanceGroupBucket]()
                         {
                             ModelDataInstance::InstanceGroupHandle currentInstanceGroup =
                                 instanceGroupBucket.m_sortInstanceData.begin()->m_instanceGroupHandle;
@@ -833,6 +905,10 @@ namespace AZ
                                     currentInstanceGroup = sortInstanceData.m_instanceGroupHandle;
                                 }
                                 perViewInstanceData[instanceDataIndex] = sortInstanceData.m_objectId;
+                                if (writeMaterialParameterIndices)
+                                {
+                                    perViewMaterialParameterIndices[instanceDataIndex] = sortInstanceData.m_materialParameterIndex;
+                                }
                                 accumulatedDepth += sortInstanceData.m_depth;
                                 instanceDataIndex++;
                             }
@@ -852,6 +928,7 @@ namespace AZ
             // currentBatchStart now represents the total count of visible instances in this view.
             // Re-size the instance data buffer so that we can fill it with the tasks created above
             perViewInstanceData.resize_no_construct(currentBatchStart);
+            perViewMaterialParameterIndices.resize_no_construct(writeMaterialParameterIndices ? currentBatchStart : 0);
         }
 
         void MeshFeatureProcessor::UpdateGPUInstanceBufferForView(size_t viewIndex, const RPI::ViewPtr& view)
@@ -867,6 +944,15 @@ namespace AZ
             // create output buffer descriptors
             AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>& perViewInstanceData = m_perViewInstanceData[viewIndex];
             instanceDataBufferHandler.UpdateBuffer(perViewInstanceData.data(), static_cast<uint32_t>(perViewInstanceData.size()));
+
+            AZStd::vector<uint32_t>& perViewMaterialParameterIndices = m_perViewInstanceMaterialParameterIndices[viewIndex];
+            if (!perViewMaterialParameterIndices.empty())
+            {
+                GpuBufferHandler& materialParameterIndexBufferHandler = m_perViewInstanceMaterialParameterIndexBufferHandlers[viewIndex];
+                materialParameterIndexBufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
+                materialParameterIndexBufferHandler.UpdateBuffer(
+                    perViewMaterialParameterIndices.data(), static_cast<uint32_t>(perViewMaterialParameterIndices.size()));
+            }
         }
 
         void MeshFeatureProcessor::OnBeginPrepareRender()
@@ -987,6 +1073,13 @@ namespace AZ
             {
                 model.m_cullable.m_prevShaderOptionFlags = model.m_cullable.m_shaderOptionFlags.exchange(0);
                 model.m_cullable.m_flags = model.m_flags.m_isAlwaysDynamic ? m_meshMovedFlag.GetIndex() : 0;
+
+                // A mesh that just started moving keeps only the moved flag for the frame it moved in, so the views caching their
+                // static meshes see it move out of them before it is separated as dynamic.
+                if (model.m_flags.m_isAlwaysDynamic || model.m_flags.m_dynamic)
+                {
+                    model.m_cullable.m_flags = model.m_cullable.m_flags | m_meshDynamicFlag.GetIndex();
+                }
             }
         }
 
@@ -1028,6 +1121,7 @@ namespace AZ
 
                 AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
                 m_modelData.erase(meshHandle);
+                m_gpuCulling.SetEntriesDirty();
 
                 return true;
             }
@@ -1404,6 +1498,7 @@ namespace AZ
             if (meshHandle.IsValid())
             {
                 meshHandle->SetVisible(visible);
+                m_gpuCulling.SetEntriesDirty();
 
                 if (m_rayTracingFeatureProcessor && meshHandle->m_descriptor.m_isRayTracingEnabled)
                 {
@@ -1513,11 +1608,27 @@ namespace AZ
             return m_transparentDrawListTag;
         }
 
+        void MeshFeatureProcessor::RetireDrawPackets(RPI::MeshDrawPacketLods&& drawPacketListsByLod)
+        {
+            RPI::RPISystemInterface* rpiSystem = RPI::RPISystemInterface::Get();
+            if (rpiSystem && rpiSystem->IsRenderFrameInFlight())
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_retiredDrawPacketsMutex);
+                m_retiredDrawPackets.emplace_back(AZStd::move(drawPacketListsByLod));
+            }
+            drawPacketListsByLod.clear();
+        }
+
         MeshInstanceManager& MeshFeatureProcessor::GetMeshInstanceManager()
         {
             return m_meshInstanceManager;
         }
 
+        MeshGpuCulling& MeshFeatureProcessor::GetMeshGpuCulling()
+        {
+            return m_gpuCulling;
+        }
+
         bool MeshFeatureProcessor::IsMeshInstancingEnabled() const
         {
             return m_enableMeshInstancing;
@@ -1642,6 +1753,12 @@ namespace AZ
                 if (AZ::RPI::ModelAssetCreator::Clone(m_modelAsset, clonedAsset, newId))
                 {
                     model = RPI::Model::FindOrCreate(clonedAsset);
+
+                    // The lods of the cloned model are only in memory, they can't be streamed in again once released
+                    if (model)
+                    {
+                        model->DisableLodStreaming();
+                    }
                 }
                 else
                 {
@@ -1666,6 +1783,16 @@ namespace AZ
                 // we always start out with a refcount of 1
                 model->GetModelAsset()->AddRefBufferAssets();
 
+                // The occluder geometry is read from the buffer assets, which may be released below. Deformed meshes can't occlude.
+                m_parent->m_occluder.m_geometry = nullptr;
+                const AZStd::vector<AZ::Name>& modelTags = model->GetModelAsset()->GetTags();
+                if (!m_parent->m_flags.m_isAlwaysDynamic && !m_parent->m_descriptor.m_isSkinnedMesh &&
+                    AZStd::find(modelTags.begin(), modelTags.end(), AZ::Name(RPI::CullingScene::OccluderModelTag)) != modelTags.end())
+                {
+                    m_parent->m_occluder.m_geometry =
+                        m_parent->m_scene->GetCullingScene()->FindOrCreateOccluderGeometry(model->GetModelAsset());
+                }
+
                 // if we don't want to keep them, this will drop the refcount to 0.
                 if (!m_parent->m_flags.m_keepBufferAssetsInMemory)
                 {
@@ -1763,6 +1890,8 @@ namespace AZ
         {
             RayTracingFeatureProcessor* rayTracingFeatureProcessor = meshFeatureProcessor->GetRayTracingFeatureProcessor();
             m_scene->GetCullingScene()->UnregisterCullable(m_cullable);
+            m_scene->GetCullingScene()->UnregisterOccluder(m_occluder);
+            m_occluder.m_aabb = Aabb::CreateNull();
 
             RemoveRayTracingData(rayTracingFeatureProcessor);
 
@@ -1772,10 +1901,16 @@ namespace AZ
             // value in that case
             if (!meshFeatureProcessor->IsMeshInstancingEnabled())
             {
-                m_meshDrawPacketListsByLod.clear();
+                meshFeatureProcessor->RetireDrawPackets(AZStd::move(m_meshDrawPacketListsByLod));
             }
             else
             {
+                // The instance groups release their draw packets with their last instance, which the frame in flight may still draw
+                if (RPI::RPISystemInterface* rpiSystem = RPI::RPISystemInterface::Get())
+                {
+                    rpiSystem->WaitForRenderFrame();
+                }
+
                 // Remove all the meshes from the MeshInstanceManager
                 MeshInstanceManager& meshInstanceManager = meshFeatureProcessor->GetMeshInstanceManager();
 
@@ -1797,6 +1932,7 @@ namespace AZ
 
             m_descriptor.m_customMaterials.clear();
             m_objectSrgList = {};
+            m_lodResidencyChangedHandler.Disconnect();
             m_model = {};
         }
 
@@ -1815,6 +1951,22 @@ namespace AZ
             m_model = model;
             m_flags.m_needsInit = true;
             m_aabb = m_model->GetModelAsset()->GetAabb();
+
+            // Connected here rather than in Init, which runs in parallel jobs for meshes that can share the model
+            m_lodResidencyChangedHandler.Disconnect();
+            if (m_model->IsLodStreamingEnabled())
+            {
+                m_model->ConnectLodResidencyChangedHandler(m_lodResidencyChangedHandler);
+            }
+        }
+
+        void ModelDataInstance::OnLodResidencyChanged()
+        {
+            // Meshes that aren't initialized yet pick up the resident lods in Init
+            if (m_model && !m_flags.m_needsInit)
+            {
+                ReInit(m_scene->GetFeatureProcessor<MeshFeatureProcessor>());
+            }
         }
 
         void ModelDataInstance::Init(MeshFeatureProcessor* meshFeatureProcessor)
@@ -1926,8 +2078,40 @@ namespace AZ
             return result;
         }
 
+        // Hashes everything about a material that ends up in the draw packet other than its material SRG: the shader variant,
+        // render states and draw list of each enabled shader item. Materials of the same type with the same hash can share a
+        // draw packet when their parameters are read from the material parameter buffer.
+        static HashValue64 GetMaterialStateHash(const Data::Instance<RPI::Material>& material)
+        {
+            HashValue64 hash = HashValue64{ 0 };
+            material->ForAllShaderItems(
+                [&hash](const Name& materialPipelineName, const RPI::ShaderCollection::Item& shaderItem)
+                {
+                    if (shaderItem.IsEnabled())
+                    {
+                        hash = TypeHash64(materialPipelineName.GetHash(), hash);
+                        hash = TypeHash64(shaderItem.GetShaderAssetId().m_guid, hash);
+                        hash = TypeHash64(shaderItem.GetShaderAssetId().m_subId, hash);
+                        hash = TypeHash64(shaderItem.GetShaderVariantId().m_key, hash);
+                        hash = TypeHash64(shaderItem.GetDrawListTagOverride().GetIndex(), hash);
+                        if (const RHI::RenderStates* renderStates = shaderItem.GetRenderStatesOverlay())
+                        {
+                            hash = renderStates->GetHash(hash);
+                        }
+                    }
+                    return true; // continue
+                });
+            return hash;
+        }
+
         void ModelDataInstance::BuildDrawPacketList(MeshFeatureProcessor* meshFeatureProcessor, size_t modelLodIndex)
         {
+            if (!m_model->IsLodResident(modelLodIndex))
+            {
+                // The cullable draws a less detailed lod until this one is streamed in
+                return;
+            }
+
             RPI::ModelLod& modelLod = *m_model->GetLods()[modelLodIndex];
             const size_t meshCount = modelLod.GetMeshes().size();
             MeshInstanceManager& meshInstanceManager = meshFeatureProcessor->GetMeshInstanceManager();
@@ -2010,6 +2194,15 @@ namespace AZ
                     key.m_meshIndex = static_cast<uint32_t>(meshIndex);
                     key.m_materialId = material->GetId();
 
+                    // Materials that have their parameters in the material parameter buffer only need to match their material type
+                    // and draw state, each instance passes its own material parameter index
+                    const uint32_t materialParameterIndex = material->GetParameterEntryIndex();
+                    if (r_meshInstancingMergeMaterials && materialParameterIndex != RPI::MaterialParameterBuffer::InvalidEntryIndex)
+                    {
+                        key.m_materialId = Data::InstanceId::CreateFromAssetId(material->GetAsset()->GetMaterialTypeAsset().GetId());
+                        key.m_materialStateHash = GetMaterialStateHash(material);
+                    }
+
                     // Two meshes that could otherwise be instanced but have manually specified sort keys will not be instanced together
                     key.m_sortKey = m_sortKey;
 
@@ -2039,6 +2232,8 @@ namespace AZ
                     postCullingData.m_instanceGroupHandle = instanceGroupInsertResult.m_handle;
                     postCullingData.m_instanceGroupPageIndex = instanceGroupInsertResult.m_pageIndex;
                     postCullingData.m_objectId = m_objectId;
+                    postCullingData.m_meshIndex = aznumeric_cast<uint32_t>(meshIndex);
+                    postCullingData.m_materialParameterIndex = material->GetParameterEntryIndex();
                     // Mark the group as transparent so that the depth can be sorted in reverse
                     postCullingData.m_instanceGroupHandle->m_isTransparent = instancingSupport.m_isTransparent;
                     m_postCullingInstanceDataByLod[modelLodIndex].push_back(postCullingData);
@@ -2285,6 +2480,13 @@ namespace AZ
                 {
                     subMesh.m_bufferFlags |= RayTracingSubMeshBufferFlags::UV;
                     subMesh.m_uvFormat = UVStreamFormat;
+
+                    // The model builder can store the UVs as half floats
+                    if (inputStreamLayout.GetStreamChannels()[4].m_format == RHI::Format::R16G16_FLOAT)
+                    {
+                        subMesh.m_bufferFlags |= RayTracingSubMeshBufferFlags::QuantizedUV;
+                        subMesh.m_uvFormat = RHI::Format::R16G16_FLOAT;
+                    }
                     subMesh.m_uvVertexBufferView = streamIter[4];
                     subMesh.m_uvShaderBufferView = const_cast<RHI::Buffer*>(streamIter[4].GetBuffer())->BuildBufferView(uvBufferDescriptor);
                 }
@@ -2722,6 +2924,7 @@ namespace AZ
             AZ_Assert(m_lodBias <= modelLodCount - 1, "Incorrect lod bias");
 
             lodData.m_lods.resize(modelLodCount);
+            lodData.m_streamingModel = m_model->IsLodStreamingEnabled() ? m_model.get() : nullptr;
             cullData.m_drawListMask.reset();
 
             const size_t lodCount = lodAssets.size();
@@ -2762,10 +2965,19 @@ namespace AZ
                     }
                 }
 
+                // A lod that isn't streamed in draws the most detailed resident lod instead, and culling requests it from the model
+                size_t drawnLodIndex = lodIndex + m_lodBias;
+                lod.m_streamingLodRequest = RPI::Cullable::LodData::NoStreamingLodRequest;
+                if (lodData.m_streamingModel && drawnLodIndex < modelLodCount && !m_model->IsLodResident(drawnLodIndex))
+                {
+                    lod.m_streamingLodRequest = aznumeric_cast<uint32_t>(drawnLodIndex);
+                    drawnLodIndex = m_model->GetResidentLodIndex(drawnLodIndex);
+                }
+
                 lod.m_drawPackets.clear();
                 if (!r_meshInstancingEnabled)
                 {
-                    const RPI::MeshDrawPacketList& drawPacketList = m_meshDrawPacketListsByLod[lodIndex + m_lodBias];
+                    const RPI::MeshDrawPacketList& drawPacketList = m_meshDrawPacketListsByLod[drawnLodIndex];
                     for (const RPI::MeshDrawPacket& drawPacket : drawPacketList)
                     {
                         // If mesh instancing is disabled, get the draw packets directly from this ModelDataInstance
@@ -2782,7 +2994,7 @@ namespace AZ
                 }
                 else
                 {
-                    const PostCullingInstanceDataList& postCullingInstanceDataList = m_postCullingInstanceDataByLod[lodIndex + m_lodBias];
+                    const PostCullingInstanceDataList& postCullingInstanceDataList = m_postCullingInstanceDataByLod[drawnLodIndex];
                     for (const ModelDataInstance::PostCullingInstanceData& postCullingData : postCullingInstanceDataList)
                     {
                         // If mesh instancing is enabled, get the draw packet from the MeshInstanceManager
@@ -2795,7 +3007,7 @@ namespace AZ
                         }
 
                         // Set the user data for the cullable lod to reference the intance group handles for the lod
-                        lod.m_visibleObjectUserData = static_cast<void*>(&m_postCullingInstanceDataByLod[lodIndex + m_lodBias]);
+                        lod.m_visibleObjectUserData = static_cast<void*>(&m_postCullingInstanceDataByLod[drawnLodIndex]);
                     }
                 }
             }
@@ -2846,6 +3058,16 @@ namespace AZ
             }
             m_scene->GetCullingScene()->RegisterOrUpdateCullable(m_cullable);
 
+            if (m_occluder.m_geometry)
+            {
+                m_occluder.m_localToWorld = Matrix3x4::CreateFromTransform(localToWorld) * Matrix3x4::CreateScale(nonUniformScale);
+                m_occluder.m_aabb = m_cullable.m_cullData.m_visibilityEntry.m_boundingVolume;
+                if (m_flags.m_visible)
+                {
+                    m_scene->GetCullingScene()->RegisterOrUpdateOccluder(m_occluder);
+                }
+            }
+
             m_flags.m_cullBoundsNeedsUpdate = false;
         }
 
@@ -2962,6 +3184,16 @@ namespace AZ
         {
             m_flags.m_visible = isVisible;
             m_cullable.m_isHidden = !isVisible;
+
+            // A hidden mesh must not occlude, the occluder is registered again once its bounds are known
+            if (!isVisible)
+            {
+                m_scene->GetCullingScene()->UnregisterOccluder(m_occluder);
+            }
+            else if (m_occluder.m_geometry && m_occluder.m_aabb.IsValid())
+            {
+                m_scene->GetCullingScene()->RegisterOrUpdateOccluder(m_occluder);
+            }
         }
 
         CustomMaterialInfo ModelDataInstance::GetCustomMaterialWithFallback(const CustomMaterialId& id) const
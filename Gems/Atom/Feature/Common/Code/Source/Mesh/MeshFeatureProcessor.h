@@ -12,13 +12,16 @@
 #include <Atom/Feature/Mesh/ModelReloaderSystemInterface.h>
 #include <Atom/RHI/TagBitRegistry.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Material/MaterialParameterBuffer.h>
 #include <Atom/RPI.Public/MeshDrawPacket.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <AtomCore/std/parallel/concurrency_checker.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzFramework/Asset/AssetCatalogBus.h>
+#include <Mesh/MeshGpuCulling.h>
 #include <Mesh/MeshInstanceManager.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
 #include <TransformService/TransformServiceFeatureProcessor.h>
@@ -36,6 +39,7 @@ namespace AZ
         class ModelDataInstance
         {
             friend class MeshFeatureProcessor;
+            friend class MeshGpuCulling;
             friend class MeshLoader;
 
         public:
@@ -44,6 +48,15 @@ namespace AZ
             const Data::Instance<RPI::Model>& GetModel() { return m_model; }
             const RPI::Cullable& GetCullable() { return m_cullable; }
 
+            //! Returns true if culling added the mesh to any view since the last call, and clears the flag.
+            //! Used by the SkinnedMeshFeatureProcessor after culling, to skip the skinning of meshes that aren't visible.
+            bool ConsumeVisibility()
+            {
+                const bool isVisible = m_cullable.m_isVisible;
+                m_cullable.m_isVisible = false;
+                return isVisible;
+            }
+
             const uint32_t GetLightingChannelMask() { return m_lightingChannelMask; }
 
             using InstanceGroupHandle = StableDynamicArrayWeakHandle<MeshInstanceGroupData>;
@@ -55,6 +68,11 @@ namespace AZ
                 InstanceGroupHandle m_instanceGroupHandle;
                 uint32_t m_instanceGroupPageIndex;
                 TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
+                //! The index of the mesh in its model lod
+                uint32_t m_meshIndex = 0;
+                //! The entry of the material in the material parameter buffer, which may differ between the instances of a group
+                //! when r_meshInstancingMergeMaterials is enabled
+                uint32_t m_materialParameterIndex = RPI::MaterialParameterBuffer::InvalidEntryIndex;
             };
 
             using PostCullingInstanceDataList = AZStd::vector<PostCullingInstanceData>;
@@ -136,6 +154,7 @@ namespace AZ
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
             void SetVisible(bool isVisible);
             CustomMaterialInfo GetCustomMaterialWithFallback(const CustomMaterialId& id) const;
+            void OnLodResidencyChanged();
 
             // When instancing is disabled, draw packets are owned by the ModelDataInstance
             RPI::MeshDrawPacketLods m_meshDrawPacketListsByLod;
@@ -148,6 +167,8 @@ namespace AZ
             size_t m_lodBias = 0;
 
             RPI::Cullable m_cullable;
+            //! Set when the model is tagged as an occluder, see RPI::CullingScene::OccluderModelTag
+            RPI::Occluder m_occluder;
             MeshHandleDescriptor m_descriptor;
             Data::Instance<RPI::Model> m_model;
 
@@ -165,6 +186,12 @@ namespace AZ
             //! Event that triggers whenever a MeshDrawPacket gets updated.
             MeshDrawPacketUpdatedEvent m_meshDrawPacketUpdatedEvent;
 
+            //! Rebuilds the draw packets when the model streams a lod in or out.
+            RPI::Model::LodResidencyChangedEvent::Handler m_lodResidencyChangedHandler{ [this]()
+                                                                                        {
+                                                                                            OnLodResidencyChanged();
+                                                                                        } };
+
             // MeshLoader is a shared pointer because it can queue a reference to itself on the SystemTickBus. The reference
             // needs to stay alive until the queued function is executed.
             AZStd::shared_ptr<MeshLoader> m_meshLoader;
@@ -287,6 +314,13 @@ namespace AZ
 
             MeshInstanceManager& GetMeshInstanceManager();
             bool IsMeshInstancingEnabled() const;
+
+            //! Takes the draw packets of a mesh that is released or reinitialized. While a frame is in flight on the render thread
+            //! (see r_pipelinedRendering) they are kept until the next Simulate, since the frame's draw lists still reference them.
+            void RetireDrawPackets(RPI::MeshDrawPacketLods&& drawPacketListsByLod);
+
+            //! Used by the MeshCullingPass to find the buffers to cull the instances of its view into
+            MeshGpuCulling& GetMeshGpuCulling();
         private:
             MeshFeatureProcessor(const MeshFeatureProcessor&) = delete;
 
@@ -328,6 +362,7 @@ namespace AZ
                 ModelDataInstance::InstanceGroupHandle m_instanceGroupHandle;
                 float m_depth = 0.0f;
                 TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
+                uint32_t m_materialParameterIndex = RPI::MaterialParameterBuffer::InvalidEntryIndex;
 
                 bool operator<(const SortInstanceData& rhs) const
                 {
@@ -362,14 +397,23 @@ namespace AZ
             AZStd::vector<AZStd::vector<InstanceGroupBucket>> m_perViewInstanceGroupBuckets;
             AZStd::vector<AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>> m_perViewInstanceData;
             AZStd::vector<GpuBufferHandler> m_perViewInstanceDataBufferHandlers;
+            // The material parameter index of each instance, parallel to m_perViewInstanceData. Only filled when
+            // r_meshInstancingMergeMaterials is enabled.
+            AZStd::vector<AZStd::vector<uint32_t>> m_perViewInstanceMaterialParameterIndices;
+            AZStd::vector<GpuBufferHandler> m_perViewInstanceMaterialParameterIndexBufferHandlers;
+            AZStd::vector<bool> m_perViewGpuCulled;
+            MeshGpuCulling m_gpuCulling;
             
             TransformServiceFeatureProcessor* m_transformService = nullptr;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
             ReflectionProbeFeatureProcessor* m_reflectionProbeFeatureProcessor = nullptr;
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
             RPI::MeshDrawPacketLods m_emptyDrawPacketLods;
+            AZStd::vector<RPI::MeshDrawPacketLods> m_retiredDrawPackets;
+            AZStd::mutex m_retiredDrawPacketsMutex;
             RHI::Ptr<FlagRegistry> m_flagRegistry = nullptr;
             AZ::RHI::Handle<uint32_t> m_meshMovedFlag;
+            AZ::RHI::Handle<uint32_t> m_meshDynamicFlag;
             RHI::DrawListTag m_meshMotionDrawListTag;
             RHI::DrawListTag m_transparentDrawListTag;
             bool m_forceRebuildDrawPackets = false;
@@ -0,0 +1,480 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshGpuCulling.h>
+#include <Mesh/MeshFeatureProcessor.h>
+#include <TransformService/TransformServiceFeatureProcessor.h>
+
+#include <Atom/RHI.Reflect/Bits.h>
+#include <Atom/RHI/DrawPacketBuilder.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/View.h>
+
+namespace AZ::Render
+{
+    [[maybe_unused]] static const char* MeshGpuCullingName = "MeshGpuCulling";
+    static const uint32_t BufferMinSize = 1 << 16; // Min 64Kb.
+
+    static Data::Instance<RPI::Buffer> CreateCullingBuffer(
+        RPI::CommonBufferPoolType poolType, const AZStd::string& bufferName, uint32_t elementSize, uint32_t byteCount)
+    {
+        RPI::CommonBufferDescriptor desc;
+        desc.m_poolType = poolType;
+        desc.m_bufferName = bufferName;
+        desc.m_byteCount = RHI::NextPowerOfTwo(AZStd::max(BufferMinSize, byteCount));
+        desc.m_elementSize = elementSize;
+        return RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+    }
+
+    void MeshGpuCulling::Activate()
+    {
+        RHI::IndirectBufferLayout indirectBufferLayout;
+        indirectBufferLayout.AddIndirectCommand(RHI::IndirectCommandDescriptor(RHI::IndirectCommandType::DrawIndexed));
+        if (!indirectBufferLayout.Finalize())
+        {
+            AZ_Error(MeshGpuCullingName, false, "Failed to finalize the indirect draw layout, GPU culling is disabled.");
+            return;
+        }
+
+        m_indirectBufferSignature = aznew RHI::IndirectBufferSignature;
+        RHI::IndirectBufferSignatureDescriptor signatureDescriptor{};
+        signatureDescriptor.m_layout = indirectBufferLayout;
+        if (m_indirectBufferSignature->Init(RHI::MultiDevice::AllDevices, signatureDescriptor) != RHI::ResultCode::Success)
+        {
+            AZ_Error(MeshGpuCullingName, false, "Failed to initialize the indirect draw signature, GPU culling is disabled.");
+            m_indirectBufferSignature = nullptr;
+        }
+
+        m_entriesDirty = true;
+    }
+
+    void MeshGpuCulling::Deactivate()
+    {
+        m_viewData.clear();
+        m_entries.clear();
+        m_draws.clear();
+        m_entryBuffer = nullptr;
+        m_clusters.clear();
+        m_clusterBuffer = nullptr;
+        m_indirectBufferSignature = nullptr;
+    }
+
+    void MeshGpuCulling::SetEntriesDirty()
+    {
+        m_entriesDirty = true;
+    }
+
+    void MeshGpuCulling::BeginFrame(
+        StableDynamicArray<ModelDataInstance>& modelData, const TransformServiceFeatureProcessor& transformService)
+    {
+        AZ_PROFILE_SCOPE(RPI, "MeshGpuCulling: BeginFrame");
+
+        ++m_frameIndex;
+
+        // Views whose MeshCullingPass didn't run last frame are culled on the CPU again
+        AZStd::erase_if(
+            m_viewData,
+            [this](const auto& viewData)
+            {
+                return viewData.second.m_requestedFrame + 1 < m_frameIndex;
+            });
+
+        if (m_clusterCullingEnabled != r_meshGpuClusterCullingEnabled)
+        {
+            m_clusterCullingEnabled = r_meshGpuClusterCullingEnabled;
+            m_entriesDirty = true;
+        }
+
+        if (m_viewData.empty() || !m_entriesDirty.exchange(false))
+        {
+            return;
+        }
+
+        RebuildEntries(modelData, transformService);
+        UpdateEntryBuffer();
+    }
+
+    bool MeshGpuCulling::IsViewGpuCulled(const RPI::View* view) const
+    {
+        if (!r_meshGpuCullingEnabled || !m_indirectBufferSignature)
+        {
+            return false;
+        }
+
+        auto viewDataIter = m_viewData.find(view);
+        return viewDataIter != m_viewData.end() && viewDataIter->second.m_requestedFrame + 1 >= m_frameIndex;
+    }
+
+    void MeshGpuCulling::SubmitView(const RPI::ViewPtr& view)
+    {
+        AZ_PROFILE_SCOPE(RPI, "MeshGpuCulling: SubmitView");
+
+        auto viewDataIter = m_viewData.find(view.get());
+        if (viewDataIter == m_viewData.end())
+        {
+            return;
+        }
+
+        ViewData& viewData = viewDataIter->second;
+        if (!UpdateViewResources(viewData, *view))
+        {
+            return;
+        }
+
+        // Every draw starts the frame with no instances, the MeshCullingPass adds the visible ones
+        RHI::IndirectBufferWriter& writer = *viewData.m_indirectBufferWriter;
+        for (uint32_t drawIndex = 0; drawIndex < m_draws.size(); ++drawIndex)
+        {
+            const MeshInstanceGroupData& instanceGroup = *m_draws[drawIndex].m_instanceGroup;
+            RHI::DrawIndexed drawIndexed;
+            if (instanceGroup.m_drawPacket.GetRHIDrawPacket())
+            {
+                const RHI::DrawArguments& drawArguments = instanceGroup.m_drawPacket.GetMesh().GetDrawArguments();
+                if (drawArguments.m_type == RHI::DrawType::Indexed)
+                {
+                    drawIndexed = drawArguments.m_indexed;
+                }
+            }
+
+            writer.Seek(drawIndex);
+            writer.DrawIndexed(drawIndexed, RHI::DrawInstanceArguments(0, 0));
+        }
+        writer.Flush();
+
+        for (uint32_t drawIndex = 0; drawIndex < m_draws.size(); ++drawIndex)
+        {
+            UpdateViewDraw(viewData, drawIndex);
+            if (const RHI::Ptr<RHI::DrawPacket>& drawPacket = viewData.m_draws[drawIndex].m_drawPacket)
+            {
+                view->AddDrawPacket(drawPacket.get(), m_draws[drawIndex].m_sortPosition);
+            }
+        }
+
+        // The instanced mesh shaders read the object ids of the culled instances from the view srg
+        view->GetShaderResourceGroup()->SetBufferView(m_viewInstanceDataIndex, viewData.m_resources.m_instanceBuffer->GetBufferView());
+
+        RPI::View::DrawBufferAttachment attachments[2];
+        attachments[0].m_descriptor.m_attachmentId = viewData.m_resources.m_indirectArgsBuffer->GetAttachmentId();
+        attachments[0].m_descriptor.m_bufferViewDescriptor = viewData.m_resources.m_indirectArgsBuffer->GetBufferViewDescriptor();
+        attachments[0].m_usage = RHI::ScopeAttachmentUsage::Indirect;
+        attachments[0].m_stage = RHI::ScopeAttachmentStage::DrawIndirect;
+        attachments[1].m_descriptor.m_attachmentId = viewData.m_resources.m_instanceBuffer->GetAttachmentId();
+        attachments[1].m_descriptor.m_bufferViewDescriptor = viewData.m_resources.m_instanceBuffer->GetBufferViewDescriptor();
+        attachments[1].m_usage = RHI::ScopeAttachmentUsage::Shader;
+        attachments[1].m_stage = RHI::ScopeAttachmentStage::VertexShader;
+        view->SetDrawBufferAttachments(attachments);
+
+        viewData.m_submittedFrame = m_frameIndex;
+    }
+
+    void MeshGpuCulling::ReleaseView(const RPI::ViewPtr& view)
+    {
+        m_viewData.erase(view.get());
+        if (!view->GetDrawBufferAttachments().empty())
+        {
+            view->SetDrawBufferAttachments({});
+        }
+    }
+
+    const MeshGpuCulling::ViewResources* MeshGpuCulling::RequestView(const RPI::View* view)
+    {
+        if (!r_meshGpuCullingEnabled || !r_meshInstancingEnabled || !m_indirectBufferSignature)
+        {
+            return nullptr;
+        }
+
+        ViewData& viewData = m_viewData[view];
+        viewData.m_requestedFrame = m_frameIndex;
+
+        // Until the draws have been submitted for this frame there is nothing to cull into
+        return viewData.m_submittedFrame == m_frameIndex && !m_entries.empty() ? &viewData.m_resources : nullptr;
+    }
+
+    const Data::Instance<RPI::Buffer>& MeshGpuCulling::GetEntryBuffer() const
+    {
+        return m_entryBuffer;
+    }
+
+    uint32_t MeshGpuCulling::GetEntryCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_entries.size());
+    }
+
+    const Data::Instance<RPI::Buffer>& MeshGpuCulling::GetClusterBuffer() const
+    {
+        return m_clusterBuffer;
+    }
+
+    void MeshGpuCulling::RebuildEntries(
+        StableDynamicArray<ModelDataInstance>& modelData, const TransformServiceFeatureProcessor& transformService)
+    {
+        AZ_PROFILE_SCOPE(RPI, "MeshGpuCulling: RebuildEntries");
+
+        m_entries.clear();
+        m_draws.clear();
+        m_clusters.clear();
+
+        AZStd::unordered_map<const MeshInstanceGroupData*, uint32_t> drawIndices;
+        for (ModelDataInstance& modelDataInstance : modelData)
+        {
+            if (!modelDataInstance.m_model || modelDataInstance.m_flags.m_needsInit || !modelDataInstance.m_flags.m_visible)
+            {
+                continue;
+            }
+
+            const RPI::Cullable& cullable = modelDataInstance.m_cullable;
+            const RPI::Cullable::LodData& lodData = cullable.m_lodData;
+            const Vector3 center = cullable.m_cullData.m_boundingSphere.GetCenter();
+
+            // Skinned meshes are deformed on the GPU, so their clusters no longer bound their triangles
+            const bool hasClusters = m_clusterCullingEnabled && !modelDataInstance.IsSkinnedMesh();
+            const Transform localToWorld =
+                hasClusters ? transformService.GetTransformForId(modelDataInstance.m_objectId) : Transform::CreateIdentity();
+            const Vector3 nonUniformScale =
+                hasClusters ? transformService.GetNonUniformScaleForId(modelDataInstance.m_objectId) : Vector3::CreateOne();
+
+            const size_t lodCount = AZStd::min(modelDataInstance.m_postCullingInstanceDataByLod.size(), lodData.m_lods.size());
+            for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
+            {
+                // Screen coverage is clamped to [0, 1], so a specific lod covers the whole range and every other lod is skipped
+                float screenCoverageMin = 0.0f;
+                float screenCoverageMax = 1.0f;
+                if (lodData.m_lodConfiguration.m_lodType == RPI::Cullable::LodType::SpecificLod)
+                {
+                    if (lodIndex != lodData.m_lodConfiguration.m_lodOverride)
+                    {
+                        continue;
+                    }
+                }
+                else
+                {
+                    screenCoverageMin = lodData.m_lods[lodIndex].m_screenCoverageMin;
+                    screenCoverageMax = lodData.m_lods[lodIndex].m_screenCoverageMax;
+                }
+
+                for (const ModelDataInstance::PostCullingInstanceData& postCullingData :
+                     modelDataInstance.m_postCullingInstanceDataByLod[lodIndex])
+                {
+                    MeshInstanceGroupData* instanceGroup = &(*postCullingData.m_instanceGroupHandle);
+                    auto [drawIndexIter, inserted] = drawIndices.emplace(instanceGroup, aznumeric_cast<uint32_t>(m_draws.size()));
+                    if (inserted)
+                    {
+                        Draw& draw = m_draws.emplace_back();
+                        draw.m_instanceGroup = instanceGroup;
+                        draw.m_sortPosition = center;
+                    }
+                    ++m_draws[drawIndexIter->second].m_instanceCapacity;
+
+                    CullingEntry& entry = m_entries.emplace_back();
+                    center.StoreToFloat3(entry.m_boundingSphere);
+                    entry.m_boundingSphere[3] = cullable.m_cullData.m_boundingSphere.GetRadius();
+                    entry.m_lodSelectionRadius = lodData.m_lodSelectionRadius;
+                    entry.m_screenCoverageMin = screenCoverageMin;
+                    entry.m_screenCoverageMax = screenCoverageMax;
+                    entry.m_objectId = postCullingData.m_objectId.GetIndex();
+                    entry.m_drawIndex = drawIndexIter->second;
+                    entry.m_hideFlags = cullable.m_cullData.m_hideFlags;
+                    if (hasClusters)
+                    {
+                        AddClusters(entry, modelDataInstance, lodIndex, postCullingData.m_meshIndex, localToWorld, nonUniformScale);
+                    }
+                }
+            }
+        }
+
+        // Each instance group gets a range of the per-view instance buffer large enough for all of its instances to be visible
+        m_instanceCapacity = 0;
+        for (Draw& draw : m_draws)
+        {
+            draw.m_instanceOffset = m_instanceCapacity;
+            m_instanceCapacity += draw.m_instanceCapacity;
+        }
+
+        for (CullingEntry& entry : m_entries)
+        {
+            entry.m_instanceOffset = m_draws[entry.m_drawIndex].m_instanceOffset;
+        }
+    }
+
+    void MeshGpuCulling::AddClusters(
+        CullingEntry& entry,
+        const ModelDataInstance& modelDataInstance,
+        size_t lodIndex,
+        uint32_t meshIndex,
+        const Transform& localToWorld,
+        const Vector3& nonUniformScale)
+    {
+        const auto lodAssets = modelDataInstance.m_model->GetModelAsset()->GetLodAssets();
+        if (lodIndex >= lodAssets.size() || !lodAssets[lodIndex] || meshIndex >= lodAssets[lodIndex]->GetMeshes().size())
+        {
+            return;
+        }
+
+        const AZStd::span<const RPI::MeshletCluster> meshletClusters = lodAssets[lodIndex]->GetMeshes()[meshIndex].GetMeshletClusters();
+        if (meshletClusters.empty())
+        {
+            return;
+        }
+
+        // Normals only keep their directions under a positive uniform scale, otherwise the clusters are only frustum culled
+        const float scale = localToWorld.GetUniformScale() * nonUniformScale.GetMaxElement();
+        const bool keepsNormals = nonUniformScale.GetMinElement() > 0.0f && nonUniformScale.IsClose(Vector3(nonUniformScale.GetX()));
+
+        entry.m_clusterOffset = aznumeric_cast<uint32_t>(m_clusters.size());
+        entry.m_clusterCount = aznumeric_cast<uint32_t>(meshletClusters.size());
+        for (const RPI::MeshletCluster& meshletCluster : meshletClusters)
+        {
+            CullingCluster& cluster = m_clusters.emplace_back();
+            const Vector3 center = Vector3::CreateFromFloat3(meshletCluster.m_boundingSphere) * nonUniformScale;
+            localToWorld.TransformPoint(center).StoreToFloat3(cluster.m_boundingSphere);
+            cluster.m_boundingSphere[3] = meshletCluster.m_boundingSphere[3] * AZStd::abs(scale);
+
+            if (keepsNormals && meshletCluster.m_coneCutoff < 1.0f)
+            {
+                const Vector3 apex = Vector3::CreateFromFloat3(meshletCluster.m_coneApex) * nonUniformScale;
+                localToWorld.TransformPoint(apex).StoreToFloat3(cluster.m_coneApex);
+                localToWorld.TransformVector(Vector3::CreateFromFloat3(meshletCluster.m_coneAxis))
+                    .GetNormalizedSafe()
+                    .StoreToFloat3(cluster.m_coneAxis);
+                cluster.m_coneCutoff = meshletCluster.m_coneCutoff;
+            }
+        }
+    }
+
+    void MeshGpuCulling::UpdateEntryBuffer()
+    {
+        const uint32_t byteCount = aznumeric_cast<uint32_t>(m_entries.size() * sizeof(CullingEntry));
+        if (!m_entryBuffer)
+        {
+            m_entryBuffer = CreateCullingBuffer(RPI::CommonBufferPoolType::ReadOnly, "MeshGpuCullingEntries", sizeof(CullingEntry), byteCount);
+        }
+        else if (byteCount > m_entryBuffer->GetBufferSize())
+        {
+            m_entryBuffer->Resize(RHI::NextPowerOfTwo(byteCount));
+        }
+
+        if (m_entryBuffer && byteCount > 0)
+        {
+            m_entryBuffer->UpdateData(m_entries.data(), byteCount, 0);
+        }
+
+        // The culling shader always binds the cluster buffer, even when no mesh has clusters
+        const uint32_t clusterByteCount = aznumeric_cast<uint32_t>(m_clusters.size() * sizeof(CullingCluster));
+        if (!m_clusterBuffer)
+        {
+            m_clusterBuffer = CreateCullingBuffer(
+                RPI::CommonBufferPoolType::ReadOnly, "MeshGpuCullingClusters", sizeof(CullingCluster), clusterByteCount);
+        }
+        else if (clusterByteCount > m_clusterBuffer->GetBufferSize())
+        {
+            m_clusterBuffer->Resize(RHI::NextPowerOfTwo(clusterByteCount));
+        }
+
+        if (m_clusterBuffer && clusterByteCount > 0)
+        {
+            m_clusterBuffer->UpdateData(m_clusters.data(), clusterByteCount, 0);
+        }
+    }
+
+    bool MeshGpuCulling::UpdateViewResources(ViewData& viewData, const RPI::View& view)
+    {
+        if (m_draws.empty())
+        {
+            return false;
+        }
+
+        ViewResources& resources = viewData.m_resources;
+        resources.m_indirectArgsStride = m_indirectBufferSignature->GetByteStride();
+        resources.m_instanceCountOffset = m_indirectBufferSignature->GetOffset(RHI::IndirectCommandIndex(0)) + sizeof(uint32_t);
+
+        const uint32_t indirectArgsByteCount = aznumeric_cast<uint32_t>(m_draws.size()) * resources.m_indirectArgsStride;
+        if (!resources.m_indirectArgsBuffer || indirectArgsByteCount > resources.m_indirectArgsBuffer->GetBufferSize())
+        {
+            resources.m_indirectArgsBuffer = CreateCullingBuffer(
+                RPI::CommonBufferPoolType::Indirect,
+                AZStd::string::format("MeshGpuCullingIndirectArgs_%s_%u", view.GetName().GetCStr(), m_viewBufferCount++),
+                sizeof(uint32_t),
+                indirectArgsByteCount);
+            if (!resources.m_indirectArgsBuffer)
+            {
+                return false;
+            }
+
+            const uint32_t bufferByteCount = aznumeric_cast<uint32_t>(resources.m_indirectArgsBuffer->GetBufferSize());
+            RHI::Buffer& rhiBuffer = *resources.m_indirectArgsBuffer->GetRHIBuffer();
+            viewData.m_indirectBufferView = AZStd::make_unique<RHI::IndirectBufferView>(
+                rhiBuffer, *m_indirectBufferSignature, 0, bufferByteCount, resources.m_indirectArgsStride);
+
+            viewData.m_indirectBufferWriter = aznew RHI::IndirectBufferWriter;
+            viewData.m_indirectBufferWriter->Init(
+                rhiBuffer, 0, resources.m_indirectArgsStride, bufferByteCount / resources.m_indirectArgsStride, *m_indirectBufferSignature);
+
+            // Every draw refers to the previous indirect buffer view
+            viewData.m_draws.clear();
+        }
+
+        const uint32_t instanceByteCount = m_instanceCapacity * sizeof(uint32_t);
+        if (!resources.m_instanceBuffer || instanceByteCount > resources.m_instanceBuffer->GetBufferSize())
+        {
+            resources.m_instanceBuffer = CreateCullingBuffer(
+                RPI::CommonBufferPoolType::ReadWrite,
+                AZStd::string::format("MeshGpuCullingInstances_%s_%u", view.GetName().GetCStr(), m_viewBufferCount++),
+                sizeof(uint32_t),
+                instanceByteCount);
+            if (!resources.m_instanceBuffer)
+            {
+                return false;
+            }
+        }
+
+        viewData.m_draws.resize(m_draws.size());
+        return true;
+    }
+
+    void MeshGpuCulling::UpdateViewDraw(ViewData& viewData, uint32_t drawIndex)
+    {
+        const Draw& draw = m_draws[drawIndex];
+        ViewDraw& viewDraw = viewData.m_draws[drawIndex];
+
+        MeshInstanceGroupData& instanceGroup = *draw.m_instanceGroup;
+        const RHI::DrawPacket* sourceDrawPacket = instanceGroup.m_drawPacket.GetRHIDrawPacket();
+        if (!sourceDrawPacket)
+        {
+            viewDraw = {};
+            return;
+        }
+
+        const uint64_t indirectArgsByteOffset = aznumeric_cast<uint64_t>(drawIndex) * viewData.m_resources.m_indirectArgsStride;
+
+        // Draw packets are only cloned when the instance group rebuilds its draw packet, or its draw command moved
+        if (viewDraw.m_sourceDrawPacket != sourceDrawPacket)
+        {
+            RHI::DrawPacketBuilder drawPacketBuilder{ RHI::MultiDevice::AllDevices };
+            viewDraw.m_sourceDrawPacket = sourceDrawPacket;
+            viewDraw.m_drawPacket = drawPacketBuilder.Clone(sourceDrawPacket);
+            viewDraw.m_geometryView = AZStd::make_unique<RHI::GeometryView>(
+                static_cast<const RHI::GeometryView&>(instanceGroup.m_drawPacket.GetMesh()));
+            viewDraw.m_indirectArgsByteOffset = ~0ull;
+        }
+
+        if (viewDraw.m_indirectArgsByteOffset != indirectArgsByteOffset)
+        {
+            viewDraw.m_indirectArgsByteOffset = indirectArgsByteOffset;
+            viewDraw.m_geometryView->SetDrawArguments(RHI::DrawIndirect{ 1, *viewData.m_indirectBufferView, indirectArgsByteOffset });
+            for (size_t drawItemIndex = 0; drawItemIndex < viewDraw.m_drawPacket->GetDrawItemCount(); ++drawItemIndex)
+            {
+                viewDraw.m_drawPacket->GetDrawItem(drawItemIndex)->SetGeometryView(viewDraw.m_geometryView.get());
+            }
+        }
+
+        // The instance group's range of the instance buffer can move whenever the entries are rebuilt
+        uint32_t instanceOffset = draw.m_instanceOffset;
+        AZStd::span<uint8_t> data{ reinterpret_cast<uint8_t*>(&instanceOffset), sizeof(uint32_t) };
+        viewDraw.m_drawPacket->SetRootConstant(instanceGroup.m_drawRootConstantOffset, data);
+    }
+} // namespace AZ::Render
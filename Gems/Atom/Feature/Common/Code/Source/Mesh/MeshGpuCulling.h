@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI.Reflect/ShaderInputNameIndex.h>
+#include <Atom/RHI/DrawPacket.h>
+#include <Atom/RHI/GeometryView.h>
+#include <Atom/RHI/IndirectBufferSignature.h>
+#include <Atom/RHI/IndirectBufferView.h>
+#include <Atom/RHI/IndirectBufferWriter.h>
+#include <Atom/RPI.Public/Base.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/Utils/StableDynamicArray.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ::Render
+{
+    class ModelDataInstance;
+    class TransformServiceFeatureProcessor;
+    struct MeshInstanceGroupData;
+
+    //! Culls instanced meshes on the GPU for views rendered by a pipeline with a MeshCullingPass.
+    //!
+    //! Every lod of every mesh instance is kept in a persistent culling entry buffer that is only rebuilt when meshes are added,
+    //! removed or moved. Each instance group gets one indirect draw command per view. Each frame the MeshCullingPass tests the
+    //! entries against the view frustum and lod screen coverage, appends the object ids of the visible ones to the view's
+    //! instance buffer, and increments the instance count of their draw command. The CPU cost per view scales with the number of
+    //! instance groups rather than the number of visible instances.
+    //!
+    //! Meshes built with meshlet clusters (see RPI::MeshletCluster) also get their clusters in world space, and an instance is
+    //! only drawn if at least one of its clusters is inside the frustum and facing the camera.
+    class MeshGpuCulling
+    {
+    public:
+        //! One lod of one mesh instance, matches MeshCullingEntry in MeshCullingCS.azsl
+        struct CullingEntry
+        {
+            float m_boundingSphere[4] = { 0.0f, 0.0f, 0.0f, 0.0f }; // World space center and radius
+            float m_lodSelectionRadius = 0.0f;
+            float m_screenCoverageMin = 0.0f;
+            float m_screenCoverageMax = 0.0f;
+            uint32_t m_objectId = 0;
+            uint32_t m_drawIndex = 0; // Index of the indirect draw command of the instance group
+            uint32_t m_instanceOffset = 0; // Offset of the instance group in the per-view instance buffer
+            uint32_t m_hideFlags = 0; // RPI::View::UsageFlags of views the instance is hidden from
+            uint32_t m_clusterOffset = 0; // Index of the first cluster of the instance in the cluster buffer
+            uint32_t m_clusterCount = 0; // Zero if the clusters aren't tested
+            uint32_t m_pad[3] = { 0, 0, 0 };
+        };
+        static_assert(sizeof(CullingEntry) == 64, "CullingEntry must match the layout of MeshCullingEntry in MeshCullingCS.azsl");
+
+        //! The world space bounds of one meshlet cluster, matches MeshCullingCluster in MeshCullingCS.azsl
+        struct CullingCluster
+        {
+            float m_boundingSphere[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float m_coneApex[3] = { 0.0f, 0.0f, 0.0f };
+            float m_coneCutoff = 1.0f; // The cluster is never backface culled when the cutoff is 1
+            float m_coneAxis[3] = { 0.0f, 0.0f, 0.0f };
+            uint32_t m_pad = 0;
+        };
+        static_assert(sizeof(CullingCluster) == 48, "CullingCluster must match the layout of MeshCullingCluster in MeshCullingCS.azsl");
+
+        //! The resources the MeshCullingPass reads and writes for one view
+        struct ViewResources
+        {
+            Data::Instance<RPI::Buffer> m_indirectArgsBuffer;
+            Data::Instance<RPI::Buffer> m_instanceBuffer;
+            uint32_t m_indirectArgsStride = 0;
+            uint32_t m_instanceCountOffset = 0; // Byte offset of the instance count within a draw command
+        };
+
+        void Activate();
+        void Deactivate();
+
+        //! Marks the culling entries as out of date, they are rebuilt the next time the culling results are submitted.
+        //! Thread safe.
+        void SetEntriesDirty();
+
+        //! Called once per frame by the MeshFeatureProcessor after culling, before any view is submitted.
+        //! Rebuilds the culling entries if needed and releases views that are no longer culled on the GPU.
+        void BeginFrame(StableDynamicArray<ModelDataInstance>& modelData, const TransformServiceFeatureProcessor& transformService);
+
+        //! Returns true if the view is rendered by a MeshCullingPass and should be culled on the GPU.
+        bool IsViewGpuCulled(const RPI::View* view) const;
+
+        //! Resets the indirect draw commands of the view, adds an indirect draw packet for each instance group to it and binds
+        //! the view's instance buffer to the view srg.
+        void SubmitView(const RPI::ViewPtr& view);
+
+        //! Releases any GPU culling resources of a view that is now culled on the CPU.
+        void ReleaseView(const RPI::ViewPtr& view);
+
+        //! Called by the MeshCullingPass each frame for the view it culls. The view is culled on the GPU starting next frame.
+        //! Returns the resources to cull into, or nullptr if the view hasn't been submitted yet.
+        const ViewResources* RequestView(const RPI::View* view);
+
+        const Data::Instance<RPI::Buffer>& GetEntryBuffer() const;
+        uint32_t GetEntryCount() const;
+        const Data::Instance<RPI::Buffer>& GetClusterBuffer() const;
+
+    private:
+        // An instance group with at least one visible lod entry
+        struct Draw
+        {
+            MeshInstanceGroupData* m_instanceGroup = nullptr;
+            uint32_t m_instanceOffset = 0;
+            uint32_t m_instanceCapacity = 0;
+            Vector3 m_sortPosition = Vector3::CreateZero();
+        };
+
+        // The per-view copy of an instance group's draw packet, drawing with the view's indirect arguments
+        struct ViewDraw
+        {
+            RHI::ConstPtr<RHI::DrawPacket> m_sourceDrawPacket;
+            RHI::Ptr<RHI::DrawPacket> m_drawPacket;
+            AZStd::unique_ptr<RHI::GeometryView> m_geometryView;
+            uint64_t m_indirectArgsByteOffset = ~0ull;
+        };
+
+        struct ViewData
+        {
+            ViewResources m_resources;
+            AZStd::unique_ptr<RHI::IndirectBufferView> m_indirectBufferView;
+            RHI::Ptr<RHI::IndirectBufferWriter> m_indirectBufferWriter;
+            AZStd::vector<ViewDraw> m_draws;
+            uint64_t m_requestedFrame = 0;
+            uint64_t m_submittedFrame = 0;
+        };
+
+        void RebuildEntries(StableDynamicArray<ModelDataInstance>& modelData, const TransformServiceFeatureProcessor& transformService);
+        void AddClusters(
+            CullingEntry& entry,
+            const ModelDataInstance& modelDataInstance,
+            size_t lodIndex,
+            uint32_t meshIndex,
+            const Transform& localToWorld,
+            const Vector3& nonUniformScale);
+        void UpdateEntryBuffer();
+        bool UpdateViewResources(ViewData& viewData, const RPI::View& view);
+        void UpdateViewDraw(ViewData& viewData, uint32_t drawIndex);
+
+        RHI::Ptr<RHI::IndirectBufferSignature> m_indirectBufferSignature;
+
+        AZStd::atomic_bool m_entriesDirty{ true };
+        AZStd::vector<CullingEntry> m_entries;
+        AZStd::vector<Draw> m_draws;
+        uint32_t m_instanceCapacity = 0;
+        Data::Instance<RPI::Buffer> m_entryBuffer;
+        AZStd::vector<CullingCluster> m_clusters;
+        Data::Instance<RPI::Buffer> m_clusterBuffer;
+        bool m_clusterCullingEnabled = false;
+
+        AZStd::unordered_map<const RPI::View*, ViewData> m_viewData;
+        uint64_t m_frameIndex = 0;
+        uint32_t m_viewBufferCount = 0;
+
+        RHI::ShaderInputNameIndex m_viewInstanceDataIndex = "m_instanceData";
+    };
+} // namespace AZ::Render
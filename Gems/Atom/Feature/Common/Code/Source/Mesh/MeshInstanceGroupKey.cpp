@@ -14,7 +14,7 @@ namespace AZ
     {
         auto MeshInstanceGroupKey::MakeTie() const
         {
-            return AZStd::tie(m_modelId, m_lodIndex, m_meshIndex, m_materialId, m_forceInstancingOff, m_sortKey);
+            return AZStd::tie(m_modelId, m_lodIndex, m_meshIndex, m_materialId, m_forceInstancingOff, m_sortKey, m_materialStateHash);
         }
 
         bool MeshInstanceGroupKey::operator<(const MeshInstanceGroupKey& rhs) const
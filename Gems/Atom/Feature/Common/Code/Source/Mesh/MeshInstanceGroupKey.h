@@ -10,6 +10,7 @@
 
 #include<Atom/RHI/DeviceDrawItem.h>
 #include<AtomCore/Instance/InstanceId.h>
+#include<AzCore/Utils/TypeHash.h>
 
 namespace AZ
 {
@@ -26,6 +27,10 @@ namespace AZ
             // it can set a random uuid here to force it to get a unique key
             Uuid m_forceInstancingOff = Uuid::CreateNull();
             RHI::DrawItemSortKey m_sortKey = 0;
+            // When meshes with different materials of the same material type are merged into one instance group (see
+            // r_meshInstancingMergeMaterials), m_materialId holds the material type instead, and this holds the hash of the
+            // shader variants and render states of the material, which must match for the meshes to share a draw packet
+            HashValue64 m_materialStateHash = HashValue64{ 0 };
 
             bool operator<(const MeshInstanceGroupKey& rhs) const;
 
@@ -57,6 +62,7 @@ namespace AZStd
             hash_combine(h, key.m_materialId);
             hash_combine(h, key.m_forceInstancingOff);
             hash_combine(h, key.m_sortKey);
+            hash_combine(h, static_cast<uint64_t>(key.m_materialStateHash));
             return h;
         }
     };
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <PostProcessing/ColorEffectsPass.h>
+#include <PostProcess/PostProcessFeatureProcessor.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        RPI::Ptr<ColorEffectsPass> ColorEffectsPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<ColorEffectsPass> pass = aznew ColorEffectsPass(descriptor);
+            return AZStd::move(pass);
+        }
+
+        ColorEffectsPass::ColorEffectsPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        {
+        }
+
+        PostProcessSettings* ColorEffectsPass::GetPostProcessSettings() const
+        {
+            const RPI::Scene* scene = GetScene();
+            if (!scene || !GetRenderPipeline())
+            {
+                return nullptr;
+            }
+            PostProcessFeatureProcessor* fp = scene->GetFeatureProcessor<PostProcessFeatureProcessor>();
+            if (!fp)
+            {
+                return nullptr;
+            }
+            return fp->GetLevelSettingsFromView(GetRenderPipeline()->GetDefaultView());
+        }
+
+        bool ColorEffectsPass::IsEnabled() const
+        {
+            if (!ComputePass::IsEnabled())
+            {
+                return false;
+            }
+            PostProcessSettings* postProcessSettings = GetPostProcessSettings();
+            if (!postProcessSettings)
+            {
+                return false;
+            }
+            const FilmGrainSettings* filmGrainSettings = postProcessSettings->GetFilmGrainSettings();
+            const WhiteBalanceSettings* whiteBalanceSettings = postProcessSettings->GetWhiteBalanceSettings();
+            const VignetteSettings* vignetteSettings = postProcessSettings->GetVignetteSettings();
+            return (filmGrainSettings && filmGrainSettings->GetEnabled()) ||
+                (whiteBalanceSettings && whiteBalanceSettings->GetEnabled()) ||
+                (vignetteSettings && vignetteSettings->GetEnabled());
+        }
+
+        void ColorEffectsPass::OnShaderReloadedInternal()
+        {
+            // The reloaded shader starts with its default variant
+            m_shaderVariantInitialized = false;
+            RPI::ComputePass::OnShaderReloadedInternal();
+        }
+
+        void ColorEffectsPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            // Must match the struct in ColorEffects.azsl
+            struct Constants
+            {
+                AZStd::array<u32, 2> m_outputSize;
+                AZStd::array<float, 2> m_outputCenter;
+                AZStd::array<u32, 2> m_grainTextureSize;
+                float m_grainIntensity = FilmGrain::DefaultIntensity;
+                float m_grainLuminanceDampening = FilmGrain::DefaultLuminanceDampening;
+                float m_grainTilingScale = FilmGrain::DefaultTilingScale;
+                float m_temperature = WhiteBalance::DefaultTemperature;
+                float m_tint = WhiteBalance::DefaultTint;
+                float m_vignetteIntensity = Vignette::DefaultIntensity;
+            } constants{};
+
+            bool filmGrainEnabled = false;
+            bool whiteBalanceEnabled = false;
+            bool vignetteEnabled = false;
+            if (PostProcessSettings* postProcessSettings = GetPostProcessSettings())
+            {
+                FilmGrainSettings* filmGrainSettings = postProcessSettings->GetFilmGrainSettings();
+                if (filmGrainSettings && filmGrainSettings->GetEnabled())
+                {
+                    filmGrainEnabled = true;
+                    constants.m_grainIntensity = filmGrainSettings->GetIntensity();
+                    constants.m_grainLuminanceDampening = filmGrainSettings->GetLuminanceDampening();
+                    constants.m_grainTilingScale = filmGrainSettings->GetTilingScale();
+
+                    AZStd::string settingsGrainPath = filmGrainSettings->GetGrainPath();
+                    if (m_currentGrainPath != settingsGrainPath)
+                    {
+                        m_currentGrainPath = settingsGrainPath;
+                        m_grainImage = filmGrainSettings->LoadStreamingImage(settingsGrainPath.c_str(), "FilmGrain");
+                    }
+                }
+
+                WhiteBalanceSettings* whiteBalanceSettings = postProcessSettings->GetWhiteBalanceSettings();
+                if (whiteBalanceSettings && whiteBalanceSettings->GetEnabled())
+                {
+                    whiteBalanceEnabled = true;
+                    constants.m_temperature = whiteBalanceSettings->GetTemperature();
+                    constants.m_tint = whiteBalanceSettings->GetTint();
+                }
+
+                VignetteSettings* vignetteSettings = postProcessSettings->GetVignetteSettings();
+                if (vignetteSettings && vignetteSettings->GetEnabled())
+                {
+                    vignetteEnabled = true;
+                    constants.m_vignetteIntensity = vignetteSettings->GetIntensity();
+                }
+            }
+
+            // The grain image is bound even when the film grain is compiled out
+            if (!m_grainImage)
+            {
+                m_grainImage = RPI::ImageSystemInterface::Get()->GetSystemImage(RPI::SystemImage::Black);
+                m_currentGrainPath.clear();
+            }
+            m_shaderResourceGroup->SetImage(m_grainIndex, m_grainImage);
+
+            RHI::Size grainTextureSize = m_grainImage->GetDescriptor().m_size;
+            constants.m_grainTextureSize[0] = grainTextureSize.m_width;
+            constants.m_grainTextureSize[1] = grainTextureSize.m_height;
+
+            AZ_Assert(GetOutputCount() > 0, "ColorEffectsPass: No output bindings!");
+            RPI::PassAttachment* outputAttachment = GetOutputBinding(0).GetAttachment().get();
+
+            AZ_Assert(outputAttachment != nullptr, "ColorEffectsPass: Output binding has no attachment!");
+            RHI::Size size = outputAttachment->m_descriptor.m_image.m_size;
+
+            constants.m_outputSize[0] = size.m_width;
+            constants.m_outputSize[1] = size.m_height;
+            constants.m_outputCenter[0] = (size.m_width - 1) * 0.5f;
+            constants.m_outputCenter[1] = (size.m_height - 1) * 0.5f;
+
+            m_shaderResourceGroup->SetConstant(m_constantsIndex, constants);
+
+            // Select the variant with only the enabled effects
+            RPI::ShaderOptionGroup shaderOption = m_shader->CreateShaderOptionGroup();
+            shaderOption.SetValue(m_filmGrainOptionName, filmGrainEnabled ? AZ::Name("true") : AZ::Name("false"));
+            shaderOption.SetValue(m_whiteBalanceOptionName, whiteBalanceEnabled ? AZ::Name("true") : AZ::Name("false"));
+            shaderOption.SetValue(m_vignetteOptionName, vignetteEnabled ? AZ::Name("true") : AZ::Name("false"));
+            shaderOption.SetUnspecifiedToDefaultValues();
+            const RPI::ShaderVariantId shaderVariantId = shaderOption.GetShaderVariantId();
+            if (!m_shaderVariantInitialized || shaderVariantId.m_key != m_currentShaderVariantKey)
+            {
+                UpdateShaderOptions(shaderVariantId);
+                m_currentShaderVariantKey = shaderVariantId.m_key;
+                m_shaderVariantInitialized = true;
+            }
+
+            RPI::ComputePass::FrameBeginInternal(params);
+        }
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+#include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        class PostProcessSettings;
+
+        //! Applies the film grain, white balance and vignette effects in a single dispatch.
+        //! The effects only read the pixel they write, so fusing them saves reading and writing a full resolution
+        //! image for each enabled effect after the first. Disabled effects are compiled out with shader options.
+        class ColorEffectsPass final : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(ColorEffectsPass);
+
+        public:
+            AZ_RTTI(ColorEffectsPass, "{5C1F6A3E-2B0D-4C8E-9A57-8E4D3F7B1A26}", AZ::RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(ColorEffectsPass, SystemAllocator, 0);
+
+            ~ColorEffectsPass() = default;
+            static RPI::Ptr<ColorEffectsPass> Create(const RPI::PassDescriptor& descriptor);
+
+            bool IsEnabled() const override;
+
+        protected:
+            // Behavior functions override...
+            void FrameBeginInternal(FramePrepareParams params) override;
+            void OnShaderReloadedInternal() override;
+
+        private:
+            ColorEffectsPass(const RPI::PassDescriptor& descriptor);
+
+            PostProcessSettings* GetPostProcessSettings() const;
+
+            Data::Instance<RPI::Image> m_grainImage;
+            AZStd::string m_currentGrainPath = "";
+
+            RPI::ShaderVariantKey m_currentShaderVariantKey;
+            bool m_shaderVariantInitialized = false;
+
+            const Name m_filmGrainOptionName{ "o_filmGrain" };
+            const Name m_whiteBalanceOptionName{ "o_whiteBalance" };
+            const Name m_vignetteOptionName{ "o_vignette" };
+
+            RHI::ShaderInputNameIndex m_grainIndex = "m_grain";
+            AZ::RHI::ShaderInputNameIndex m_constantsIndex = "m_constants";
+        };
+    } // namespace Render
+} // namespace AZ
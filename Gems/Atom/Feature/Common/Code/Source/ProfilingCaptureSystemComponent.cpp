@@ -19,11 +19,13 @@
 
 #include <AzCore/Serialization/Json/JsonUtils.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/Json/JsonSerializationSettings.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/conversions.h>
 
 namespace AZ
 {
@@ -38,7 +40,8 @@ namespace AZ
                 OnCaptureQueryTimestampFinished,
                 OnCaptureCpuFrameTimeFinished,
                 OnCaptureQueryPipelineStatisticsFinished,
-                OnCaptureBenchmarkMetadataFinished
+                OnCaptureBenchmarkMetadataFinished,
+                OnCaptureGpuProfilingTraceFinished
             );
 
             void OnCaptureQueryTimestampFinished(bool result, const AZStd::string& info) override
@@ -61,6 +64,11 @@ namespace AZ
                 Call(FN_OnCaptureBenchmarkMetadataFinished, result, info);
             }
 
+            void OnCaptureGpuProfilingTraceFinished(bool result, const AZStd::string& info) override
+            {
+                Call(FN_OnCaptureGpuProfilingTraceFinished, result, info);
+            }
+
             static void Reflect(AZ::ReflectContext* context)
             {
                 if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
@@ -161,6 +169,54 @@ namespace AZ
             GpuEntry m_gpuEntry;
         };
 
+        // Intermediate class to serialize a GPU profiling trace. It has the fields of the CPU profiler captures
+        // (CpuProfilingStatisticsSerializer in the Profiler gem), so the tools that load CPU captures load it too. Each hardware queue
+        // shows as a thread, each pass as a region nested by its depth in the pass tree.
+        class GpuProfilingTraceSerializer
+        {
+        public:
+            class GpuProfilingTraceSerializerEntry
+            {
+            public:
+                AZ_TYPE_INFO(GpuProfilingTraceSerializer::GpuProfilingTraceSerializerEntry, "{5A0E8C27-9B41-4F3D-A6E2-7C1D3B58F940}");
+                static void Reflect(AZ::ReflectContext* context);
+
+                Name m_groupName;
+                Name m_regionName;
+                uint16_t m_stackDepth = 0;
+                AZStd::sys_time_t m_startTick = 0;
+                AZStd::sys_time_t m_endTick = 0;
+                size_t m_threadId = 0;
+
+                // Only in GPU traces, the CPU capture loaders skip these
+                uint32_t m_frameIndex = 0;
+                uint64_t m_timestampResultInNanoseconds = 0;
+                RPI::PipelineStatisticsResult m_pipelineStatisticsResult;
+            };
+
+            AZ_TYPE_INFO(GpuProfilingTraceSerializer, "{E37B1D94-2C6F-4A88-B05D-91F4A6C2E8D3}");
+            static void Reflect(AZ::ReflectContext* context);
+
+            AZStd::vector<GpuProfilingTraceSerializerEntry> m_entries;
+            AZStd::sys_time_t m_timeTicksPerSecond = 0;
+        };
+
+        static void gpuProfilingCapture(const AZ::ConsoleCommandContainer& arguments)
+        {
+            if (arguments.size() < 2)
+            {
+                AZ_Warning("ProfilingCaptureSystemComponent", false, "Usage: gpuProfilingCapture <output file path> <frame count>");
+                return;
+            }
+
+            const AZStd::string outputFilePath(arguments[0]);
+            const uint32_t frameCount = aznumeric_cast<uint32_t>(AZStd::stoul(AZStd::string(arguments[1])));
+            ProfilingCaptureRequestBus::Broadcast(&ProfilingCaptureRequestBus::Events::CaptureGpuProfilingTrace, outputFilePath, frameCount);
+        }
+        AZ_CONSOLEFREEFUNC(gpuProfilingCapture, AZ::ConsoleFunctorFlags::Null,
+            "Records the Timestamp and PipelineStatistics of the passes for a number of frames, and saves them to a json file in the "
+            "format of the CPU profiler captures. Usage: gpuProfilingCapture <output file path> <frame count>");
+
         // --- DelayedQueryCaptureHelper ---
 
         bool DelayedQueryCaptureHelper::StartCapture(CaptureCallback&& captureCallback)
@@ -332,6 +388,43 @@ namespace AZ
             }
         }
 
+        // --- GpuProfilingTraceSerializer ---
+
+        void GpuProfilingTraceSerializer::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<GpuProfilingTraceSerializer>()
+                    ->Version(1)
+                    ->Field("cpuProfilingStatisticsSerializerEntries", &GpuProfilingTraceSerializer::m_entries)
+                    ->Field("timeTicksPerSecond", &GpuProfilingTraceSerializer::m_timeTicksPerSecond)
+                    ;
+            }
+
+            GpuProfilingTraceSerializerEntry::Reflect(context);
+        }
+
+        // --- GpuProfilingTraceSerializerEntry ---
+
+        void GpuProfilingTraceSerializer::GpuProfilingTraceSerializerEntry::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<GpuProfilingTraceSerializerEntry>()
+                    ->Version(1)
+                    ->Field("groupName", &GpuProfilingTraceSerializerEntry::m_groupName)
+                    ->Field("regionName", &GpuProfilingTraceSerializerEntry::m_regionName)
+                    ->Field("stackDepth", &GpuProfilingTraceSerializerEntry::m_stackDepth)
+                    ->Field("startTick", &GpuProfilingTraceSerializerEntry::m_startTick)
+                    ->Field("endTick", &GpuProfilingTraceSerializerEntry::m_endTick)
+                    ->Field("threadId", &GpuProfilingTraceSerializerEntry::m_threadId)
+                    ->Field("frameIndex", &GpuProfilingTraceSerializerEntry::m_frameIndex)
+                    ->Field("timestampResultInNanoseconds", &GpuProfilingTraceSerializerEntry::m_timestampResultInNanoseconds)
+                    ->Field("pipelineStatisticsResult", &GpuProfilingTraceSerializerEntry::m_pipelineStatisticsResult)
+                    ;
+            }
+        }
+
         // --- ProfilingCaptureSystemComponent ---
 
         void ProfilingCaptureSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -352,6 +445,7 @@ namespace AZ
                     ->Event("CaptureCpuFrameTime", &ProfilingCaptureRequestBus::Events::CaptureCpuFrameTime)
                     ->Event("CapturePassPipelineStatistics", &ProfilingCaptureRequestBus::Events::CapturePassPipelineStatistics)
                     ->Event("CaptureBenchmarkMetadata", &ProfilingCaptureRequestBus::Events::CaptureBenchmarkMetadata)
+                    ->Event("CaptureGpuProfilingTrace", &ProfilingCaptureRequestBus::Events::CaptureGpuProfilingTrace)
                     ;
 
                 ProfilingCaptureNotificationBusHandler::Reflect(context);
@@ -361,6 +455,7 @@ namespace AZ
             CpuFrameTimeSerializer::Reflect(context);
             PipelineStatisticsSerializer::Reflect(context);
             BenchmarkMetadataSerializer::Reflect(context);
+            GpuProfilingTraceSerializer::Reflect(context);
         }
 
         void ProfilingCaptureSystemComponent::Activate()
@@ -372,6 +467,9 @@ namespace AZ
         {
             TickBus::Handler::BusDisconnect();
 
+            m_isRecordingGpuProfilingTrace = false;
+            m_gpuPassSamples.clear();
+
             ProfilingCaptureRequestBus::Handler::BusDisconnect();
         }
 
@@ -536,6 +634,184 @@ namespace AZ
             return captureStarted;
         }
 
+        bool ProfilingCaptureSystemComponent::CaptureGpuProfilingTrace(const AZStd::string& outputFilePath, uint32_t frameCount)
+        {
+            if (frameCount == 0)
+            {
+                AZ_Warning("ProfilingCaptureSystemComponent", false, "A GPU profiling trace needs at least one frame.");
+                return false;
+            }
+
+            if (m_isRecordingGpuProfilingTrace)
+            {
+                AZ_Warning("ProfilingCaptureSystemComponent", false, "A GPU profiling trace is already being recorded.");
+                return false;
+            }
+
+            RPI::Pass* root = AZ::RPI::PassSystemInterface::Get()->GetRootPass().get();
+
+            // Enable all the Timestamp and PipelineStatistics queries in passes.
+            root->SetTimestampQueryEnabled(true);
+            root->SetPipelineStatisticsQueryEnabled(true);
+
+            // The delay lets the first queries be read back, then a frame is recorded each tick
+            const bool captureStarted = m_gpuProfilingTraceCapture.StartCapture([this, outputFilePath, frameCount]()
+            {
+                m_isRecordingGpuProfilingTrace = true;
+                m_gpuProfilingTraceFilePath = outputFilePath;
+                m_gpuProfilingTraceFrameCount = frameCount;
+                m_gpuProfilingTraceRecordedFrameCount = 0;
+                // Ticks that don't have new results yet don't count, give up if the results stop coming
+                m_gpuProfilingTraceRemainingTicks = frameCount * 2 + 60;
+                m_gpuProfilingTraceLastFrameBegin = 0;
+                m_gpuPassSamples.clear();
+            });
+
+            // Start the TickBus.
+            if (captureStarted)
+            {
+                TickBus::Handler::BusConnect();
+            }
+
+            return captureStarted;
+        }
+
+        void ProfilingCaptureSystemComponent::RecordGpuProfilingFrame()
+        {
+            const RPI::Pass* root = AZ::RPI::PassSystemInterface::Get()->GetRootPass().get();
+
+            // The results of the passes only change once the queries of a new frame are read back
+            const RPI::TimestampResult rootTimestampResult = root->GetLatestTimestampResult();
+            if (rootTimestampResult.GetDurationInTicks() > 0 &&
+                rootTimestampResult.GetTimestampBeginInTicks() != m_gpuProfilingTraceLastFrameBegin)
+            {
+                if (m_gpuProfilingTraceRecordedFrameCount == 0)
+                {
+                    m_gpuProfilingTraceStartTick = AZStd::GetTimeNowTicks();
+                }
+                m_gpuProfilingTraceLastFrameBegin = rootTimestampResult.GetTimestampBeginInTicks();
+
+                AZStd::function<void(const RPI::Pass*, uint16_t)> collectPass = [&](const RPI::Pass* pass, uint16_t depth)
+                {
+                    if (!pass->IsEnabled())
+                    {
+                        return;
+                    }
+
+                    const RPI::TimestampResult timestampResult = pass->GetLatestTimestampResult();
+                    if (timestampResult.GetDurationInTicks() > 0)
+                    {
+                        GpuPassSample& sample = m_gpuPassSamples.emplace_back();
+                        sample.m_passPath = pass->GetPathName();
+                        sample.m_depth = depth;
+                        sample.m_frameIndex = m_gpuProfilingTraceRecordedFrameCount;
+                        sample.m_timestampResult = timestampResult;
+                        sample.m_pipelineStatisticsResult = pass->GetLatestPipelineStatisticsResult();
+                    }
+
+                    if (const RPI::ParentPass* asParent = pass->AsParent())
+                    {
+                        for (const auto& child : asParent->GetChildren())
+                        {
+                            collectPass(child.get(), depth + 1);
+                        }
+                    }
+                };
+                collectPass(root, 0);
+
+                ++m_gpuProfilingTraceRecordedFrameCount;
+            }
+
+            if (m_gpuProfilingTraceRecordedFrameCount >= m_gpuProfilingTraceFrameCount)
+            {
+                FinishGpuProfilingTrace(false);
+            }
+            else if (--m_gpuProfilingTraceRemainingTicks == 0)
+            {
+                FinishGpuProfilingTrace(true);
+            }
+        }
+
+        void ProfilingCaptureSystemComponent::FinishGpuProfilingTrace(bool timedOut)
+        {
+            m_isRecordingGpuProfilingTrace = false;
+
+            RPI::Pass* root = AZ::RPI::PassSystemInterface::Get()->GetRootPass().get();
+
+            // Disable all the Timestamp and PipelineStatistics queries in passes.
+            root->SetTimestampQueryEnabled(false);
+            root->SetPipelineStatisticsQueryEnabled(false);
+
+            // The RHI has no calibrated GPU and CPU clocks, so the GPU timeline starts at the CPU tick its first frame was read back,
+            // and keeps the spacing of the GPU timestamps from there. Each hardware queue has its own timestamp clock.
+            AZStd::array<uint64_t, RHI::HardwareQueueClassCount> firstBeginByQueue;
+            firstBeginByQueue.fill(AZStd::numeric_limits<uint64_t>::max());
+            for (const GpuPassSample& sample : m_gpuPassSamples)
+            {
+                uint64_t& firstBegin = firstBeginByQueue[static_cast<uint32_t>(sample.m_timestampResult.GetHardwareQueueClass())];
+                firstBegin = AZStd::min(firstBegin, sample.m_timestampResult.GetTimestampBeginInTicks());
+            }
+
+            GpuProfilingTraceSerializer serializer;
+            serializer.m_timeTicksPerSecond = AZStd::GetTimeTicksPerSecond();
+            serializer.m_entries.reserve(m_gpuPassSamples.size());
+
+            const RHI::Ptr<RHI::Device> device = RHI::GetRHIDevice();
+            const Name groupName("GPU");
+            auto gpuTicksToCpuTicks = [&](uint64_t gpuTicks, RHI::HardwareQueueClass queueClass)
+            {
+                const AZStd::sys_time_t microseconds = device->GpuTimestampToMicroseconds(gpuTicks, queueClass).count();
+                return microseconds * serializer.m_timeTicksPerSecond / 1000000;
+            };
+
+            for (const GpuPassSample& sample : m_gpuPassSamples)
+            {
+                const RHI::HardwareQueueClass queueClass = sample.m_timestampResult.GetHardwareQueueClass();
+                const uint64_t firstBegin = firstBeginByQueue[static_cast<uint32_t>(queueClass)];
+
+                GpuProfilingTraceSerializer::GpuProfilingTraceSerializerEntry& entry = serializer.m_entries.emplace_back();
+                entry.m_groupName = groupName;
+                entry.m_regionName = sample.m_passPath;
+                entry.m_stackDepth = sample.m_depth;
+                entry.m_startTick = m_gpuProfilingTraceStartTick +
+                    gpuTicksToCpuTicks(sample.m_timestampResult.GetTimestampBeginInTicks() - firstBegin, queueClass);
+                entry.m_endTick = entry.m_startTick + gpuTicksToCpuTicks(sample.m_timestampResult.GetDurationInTicks(), queueClass);
+                entry.m_threadId = AZStd::hash<AZStd::string_view>{}(RHI::GetHardwareQueueClassName(queueClass));
+                entry.m_frameIndex = sample.m_frameIndex;
+                entry.m_timestampResultInNanoseconds = sample.m_timestampResult.GetDurationInNanoseconds();
+                entry.m_pipelineStatisticsResult = sample.m_pipelineStatisticsResult;
+            }
+            m_gpuPassSamples.clear();
+
+            JsonSerializerSettings serializationSettings;
+            serializationSettings.m_keepDefaults = true;
+
+            const auto saveResult = JsonSerializationUtils::SaveObjectToFile(&serializer,
+                m_gpuProfilingTraceFilePath, (GpuProfilingTraceSerializer*)nullptr, &serializationSettings);
+
+            AZStd::string captureInfo = m_gpuProfilingTraceFilePath;
+            if (!saveResult.IsSuccess())
+            {
+                captureInfo = AZStd::string::format("Failed to save the GPU profiling trace to file '%s'. Error: %s",
+                    m_gpuProfilingTraceFilePath.c_str(),
+                    saveResult.GetError().c_str());
+                AZ_Warning("ProfilingCaptureSystemComponent", false, captureInfo.c_str());
+            }
+            else if (timedOut)
+            {
+                captureInfo = AZStd::string::format("Only %u of the %u frames of the GPU profiling trace were read back, saved them to file '%s'.",
+                    m_gpuProfilingTraceRecordedFrameCount,
+                    m_gpuProfilingTraceFrameCount,
+                    m_gpuProfilingTraceFilePath.c_str());
+                AZ_Warning("ProfilingCaptureSystemComponent", false, captureInfo.c_str());
+            }
+
+            // Notify listeners that the GPU profiling trace capture has finished.
+            ProfilingCaptureNotificationBus::Broadcast(&ProfilingCaptureNotificationBus::Events::OnCaptureGpuProfilingTraceFinished,
+                saveResult.IsSuccess() && !timedOut,
+                captureInfo);
+        }
+
         AZStd::vector<const RPI::Pass*> ProfilingCaptureSystemComponent::CollectPassesRecursively(const RPI::Pass* root) const
         {
             AZStd::vector<const RPI::Pass*> passes;
@@ -565,9 +841,16 @@ namespace AZ
             m_cpuFrameTimeStatisticsCapture.UpdateCapture();
             m_pipelineStatisticsCapture.UpdateCapture();
             m_benchmarkMetadataCapture.UpdateCapture();
+            m_gpuProfilingTraceCapture.UpdateCapture();
+
+            if (m_isRecordingGpuProfilingTrace)
+            {
+                RecordGpuProfilingFrame();
+            }
 
             // Disconnect from the TickBus if all capture states are set to idle.
-            if (m_timestampCapture.IsIdle() && m_pipelineStatisticsCapture.IsIdle() && m_benchmarkMetadataCapture.IsIdle() && m_cpuFrameTimeStatisticsCapture.IsIdle())
+            if (m_timestampCapture.IsIdle() && m_pipelineStatisticsCapture.IsIdle() && m_benchmarkMetadataCapture.IsIdle() && m_cpuFrameTimeStatisticsCapture.IsIdle() &&
+                m_gpuProfilingTraceCapture.IsIdle() && !m_isRecordingGpuProfilingTrace)
             {
                 TickBus::Handler::BusDisconnect();
             }
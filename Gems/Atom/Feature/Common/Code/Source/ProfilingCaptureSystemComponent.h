@@ -12,6 +12,11 @@
 #include <AzCore/Component/TickBus.h>
 
 #include <Atom/Feature/Utils/ProfilingCaptureBus.h>
+#include <Atom/RPI.Public/GpuQuery/GpuQueryTypes.h>
+
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/time.h>
 
 namespace AZ
 {
@@ -71,17 +76,46 @@ namespace AZ
             bool CaptureCpuFrameTime(const AZStd::string& outputFilePath) override;
             bool CapturePassPipelineStatistics(const AZStd::string& outputFilePath) override;
             bool CaptureBenchmarkMetadata(const AZStd::string& benchmarkName, const AZStd::string& outputFilePath) override;
+            bool CaptureGpuProfilingTrace(const AZStd::string& outputFilePath, uint32_t frameCount) override;
 
         private:
+            //! The queries of a pass read back for one frame of a GPU profiling trace.
+            struct GpuPassSample
+            {
+                Name m_passPath;
+                uint16_t m_depth = 0;
+                uint32_t m_frameIndex = 0;
+                RPI::TimestampResult m_timestampResult;
+                RPI::PipelineStatisticsResult m_pipelineStatisticsResult;
+            };
+
             void OnTick(float deltaTime, ScriptTimePoint time) override;
 
             // Recursively collect all the passes from the root pass.
             AZStd::vector<const RPI::Pass*> CollectPassesRecursively(const RPI::Pass* root) const;
 
+            // Records the query results of the passes for the next frame of the GPU profiling trace, once they were read back.
+            void RecordGpuProfilingFrame();
+
+            // Writes the recorded GPU profiling trace and stops it.
+            void FinishGpuProfilingTrace(bool timedOut);
+
             DelayedQueryCaptureHelper m_timestampCapture;
             DelayedQueryCaptureHelper m_cpuFrameTimeStatisticsCapture;
             DelayedQueryCaptureHelper m_pipelineStatisticsCapture;
             DelayedQueryCaptureHelper m_benchmarkMetadataCapture;
+
+            // The GPU profiling trace waits for the first query results with m_gpuProfilingTraceCapture, then records a frame per tick
+            DelayedQueryCaptureHelper m_gpuProfilingTraceCapture;
+            bool m_isRecordingGpuProfilingTrace = false;
+            AZStd::string m_gpuProfilingTraceFilePath;
+            uint32_t m_gpuProfilingTraceFrameCount = 0;
+            uint32_t m_gpuProfilingTraceRecordedFrameCount = 0;
+            uint32_t m_gpuProfilingTraceRemainingTicks = 0;
+            uint64_t m_gpuProfilingTraceLastFrameBegin = 0;
+            // The CPU tick the first recorded GPU frame is placed at
+            AZStd::sys_time_t m_gpuProfilingTraceStartTick = 0;
+            AZStd::vector<GpuPassSample> m_gpuPassSamples;
         };
     }
 }
@@ -217,8 +217,32 @@ namespace AZ
             // build newly added or skinned BLAS objects
             AZStd::vector<const AZ::RHI::DeviceRayTracingBlas*> changedBlasList;
             RayTracingFeatureProcessor::BlasInstanceMap& blasInstances = rayTracingFeatureProcessor->GetBlasInstances();
+            const RHI::MultiDevice::DeviceMask deviceMask = RHI::MultiDevice::DeviceMask(1 << context.GetDeviceIndex());
             for (auto& blasInstance : blasInstances)
             {
+                if (!blasInstance.second.m_buildScheduled)
+                {
+                    // deferred by the BLAS build budget, the TLAS instances of this mesh are inactive
+                    continue;
+                }
+
+                // copy the BLAS objects into their compacted BLAS objects, the feature processor replaces them once every device copied them
+                if (blasInstance.second.m_subMeshes.front().m_compactedBlas &&
+                    (blasInstance.second.m_blasCompacted & deviceMask) == RHI::MultiDevice::NoDevices)
+                {
+                    for (auto& submeshBlasInstance : blasInstance.second.m_subMeshes)
+                    {
+                        const RHI::DeviceRayTracingBlas* compactedBlas =
+                            submeshBlasInstance.m_compactedBlas->GetDeviceRayTracingBlas(context.GetDeviceIndex()).get();
+                        context.GetCommandList()->CompactBottomLevelAccelerationStructure(
+                            *submeshBlasInstance.m_blas->GetDeviceRayTracingBlas(context.GetDeviceIndex()), *compactedBlas);
+                        changedBlasList.push_back(compactedBlas);
+                    }
+
+                    AZStd::lock_guard lock(rayTracingFeatureProcessor->GetBlasBuiltMutex());
+                    blasInstance.second.m_blasCompacted |= deviceMask;
+                }
+
                 const bool isSkinnedMesh = blasInstance.second.m_isSkinnedMesh;
                 const bool buildBlas = (blasInstance.second.m_blasBuilt & RHI::MultiDevice::DeviceMask(1 << context.GetDeviceIndex())) ==
                     RHI::MultiDevice::NoDevices;
@@ -259,8 +283,16 @@ namespace AZ
                 }
             }
 
-            // build the TLAS object
-            context.GetCommandList()->BuildTopLevelAccelerationStructure(*rayTracingFeatureProcessor->GetTlas()->GetDeviceRayTracingTlas(context.GetDeviceIndex()), changedBlasList);
+            // build the TLAS object, or refit it if the feature processor only updated the instance transforms
+            const RHI::DeviceRayTracingTlas& rayTracingTlas = *rayTracingFeatureProcessor->GetTlas()->GetDeviceRayTracingTlas(context.GetDeviceIndex());
+            if (m_rayTracingRevisionOutDated && rayTracingFeatureProcessor->IsTlasRefit())
+            {
+                context.GetCommandList()->UpdateTopLevelAccelerationStructure(rayTracingTlas, changedBlasList);
+            }
+            else
+            {
+                context.GetCommandList()->BuildTopLevelAccelerationStructure(rayTracingTlas, changedBlasList);
+            }
 
             ++m_frameCount;
 
@@ -23,11 +23,21 @@
 #include <CoreLights/CapsuleLightFeatureProcessor.h>
 #include <CoreLights/QuadLightFeatureProcessor.h>
 #include <ImageBasedLights/ImageBasedLightFeatureProcessor.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_rayTracingBlasBuildBudget, 1000000, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Maximum number of triangles of the ray tracing BLAS objects built per frame, at least one BLAS is built per frame. 0 is unlimited.");
+
+        AZ_CVAR(bool, r_rayTracingTlasRefit, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Refit the ray tracing TLAS instead of rebuilding it when only the instance transforms changed.");
+
+        AZ_CVAR(bool, r_rayTracingBlasCompaction, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Compact the ray tracing BLAS objects of static meshes after they are built. Applies to meshes added after it is changed.");
+
         void RayTracingFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -163,9 +173,12 @@ namespace AZ
             proceduralGeometry.m_blas = rayTracingBlas;
             proceduralGeometry.m_localInstanceIndex = localInstanceIndex;
 
+            // the AABB BLAS is a single primitive, so it isn't deferred by the build budget
             MeshBlasInstance meshBlasInstance;
             meshBlasInstance.m_count = 1;
             meshBlasInstance.m_subMeshes.push_back(SubMeshBlasInstance{ rayTracingBlas });
+            meshBlasInstance.m_buildScheduled = true;
+            meshBlasInstance.m_triangleCount = 1;
 
             MaterialInfo materialInfo;
 
@@ -184,6 +197,7 @@ namespace AZ
             geometryTypeHandle->m_instanceCount++;
 
             m_revision++;
+            m_tlasNeedsRebuild = true;
             m_proceduralGeometryInfoBufferNeedsUpdate = true;
             m_materialInfoBufferNeedsUpdate = true;
             m_indexListNeedsUpdate = true;
@@ -277,10 +291,14 @@ namespace AZ
                 materialInfos.pop_back();
             }
 
-            m_blasInstanceMap.erase(uuid);
+            if (auto itBlas = m_blasInstanceMap.find(uuid); itBlas != m_blasInstanceMap.end())
+            {
+                EraseBlasInstance(itBlas);
+            }
             m_proceduralGeometryLookup.erase(uuid);
 
             m_revision++;
+            m_tlasNeedsRebuild = true;
             m_proceduralGeometryInfoBufferNeedsUpdate = true;
             m_materialInfoBufferNeedsUpdate = true;
             m_indexListNeedsUpdate = true;
@@ -350,11 +368,18 @@ namespace AZ
                 meshBlasInstance.m_count = 1;
                 meshBlasInstance.m_subMeshes.reserve(mesh.m_subMeshIndices.size());
                 meshBlasInstance.m_isSkinnedMesh = mesh.m_isSkinnedMesh;
+                meshBlasInstance.m_compactionEnabled = !mesh.m_isSkinnedMesh && r_rayTracingBlasCompaction;
                 itMeshBlasInstance = m_blasInstanceMap.insert({ mesh.m_assetId, meshBlasInstance }).first;
                 if (mesh.m_isSkinnedMesh)
                 {
                     ++m_skinnedMeshCount;
                 }
+
+                ++m_unscheduledBlasCount;
+                if (meshBlasInstance.m_compactionEnabled)
+                {
+                    ++m_pendingCompactionCount;
+                }
             }
             else
             {
@@ -366,6 +391,10 @@ namespace AZ
             // Note: the buffer is just reserved here, the BLAS is built in the RayTracingAccelerationStructurePass
             // Note: the build flags are set to be the same for each BLAS created for the mesh
             RHI::RayTracingAccelerationStructureBuildFlags buildFlags = CreateRayTracingAccelerationStructureBuildFlags(mesh.m_isSkinnedMesh);
+            if (itMeshBlasInstance->second.m_compactionEnabled)
+            {
+                buildFlags = buildFlags | RHI::RayTracingAccelerationStructureBuildFlags::ENABLE_COMPACTION;
+            }
             [[maybe_unused]] bool blasInstanceFound = false;
             for (uint32_t subMeshIndex = 0; subMeshIndex < mesh.m_subMeshIndices.size(); ++subMeshIndex)
             {
@@ -400,6 +429,10 @@ namespace AZ
                     // create the buffers from the BLAS descriptor
                     rayTracingBlas->CreateBuffers(RHI::RHISystemInterface::Get()->GetRayTracingSupport(), &blasDescriptor, *m_bufferPools);
 
+                    // the triangle count is used by the BLAS build budget
+                    const uint32_t indexSize = RHI::GetIndexFormatSize(subMesh.m_indexBufferView.GetIndexFormat());
+                    itMeshBlasInstance->second.m_triangleCount += subMesh.m_indexBufferView.GetByteCount() / indexSize / 3;
+
                     // store the BLAS in the mesh
                     subMesh.m_blas = rayTracingBlas;
                 }
@@ -482,6 +515,7 @@ namespace AZ
             }
 
             m_revision++;
+            m_tlasNeedsRebuild = true;
             m_subMeshCount += aznumeric_cast<uint32_t>(subMeshes.size());
 
             m_meshInfoBufferNeedsUpdate = true;
@@ -515,7 +549,7 @@ namespace AZ
                         {
                             --m_skinnedMeshCount;
                         }
-                        m_blasInstanceMap.erase(itBlas);
+                        EraseBlasInstance(itBlas);
                     }
                 }
 
@@ -586,6 +620,7 @@ namespace AZ
                 m_subMeshCount -= aznumeric_cast<uint32_t>(mesh.m_subMeshIndices.size());
                 m_meshes.erase(itMesh);
                 m_revision++;
+                m_tlasNeedsRebuild = true;
 
                 // reset all data structures if all meshes were removed (i.e., empty scene)
                 if (m_subMeshCount == 0)
@@ -749,6 +784,17 @@ namespace AZ
 
         uint32_t RayTracingFeatureProcessor::BeginFrame()
         {
+            if (m_pendingCompactionCount > 0)
+            {
+                UpdateBlasCompaction();
+            }
+
+            if (m_unscheduledBlasCount > 0)
+            {
+                ScheduleBlasBuilds();
+            }
+
+            m_tlasRefit = false;
             if (m_tlasRevision != m_revision)
             {
                 m_tlasRevision = m_revision;
@@ -757,14 +803,24 @@ namespace AZ
                 RHI::RayTracingTlasDescriptor tlasDescriptor;
                 RHI::RayTracingTlasDescriptor* tlasDescriptorBuild = tlasDescriptor.Build();
 
+                tlasDescriptorBuild->BuildFlags(
+                    r_rayTracingTlasRefit
+                        ? RHI::RayTracingAccelerationStructureBuildFlags::FAST_TRACE | RHI::RayTracingAccelerationStructureBuildFlags::ENABLE_UPDATE
+                        : RHI::RayTracingAccelerationStructureBuildFlags::FAST_TRACE);
+
+                // the instances of meshes whose BLAS isn't scheduled for its build yet are inactive, they keep their index
+                // so the instance IDs match the MeshInfo entries
                 uint32_t instanceIndex = 0;
                 for (auto& subMesh : m_subMeshes)
                 {
+                    BlasInstanceMap::const_iterator itBlas = m_blasInstanceMap.find(subMesh.m_mesh->m_assetId);
+                    const bool blasScheduled = itBlas != m_blasInstanceMap.end() && itBlas->second.m_buildScheduled;
+
                     tlasDescriptorBuild->Instance()
                         ->InstanceID(instanceIndex)
                         ->InstanceMask(subMesh.m_mesh->m_instanceMask)
                         ->HitGroupIndex(0)
-                        ->Blas(subMesh.m_blas)
+                        ->Blas(blasScheduled ? subMesh.m_blas : nullptr)
                         ->Transform(subMesh.m_mesh->m_transform)
                         ->NonUniformScale(subMesh.m_mesh->m_nonUniformScale)
                         ->Transparent(subMesh.m_material.m_irradianceColor.GetA() < 1.0f);
@@ -792,9 +848,23 @@ namespace AZ
                     instanceIndex++;
                 }
 
-                // create the TLAS buffers based on the descriptor
+                // refit the TLAS if only the instance transforms changed, otherwise create the TLAS buffers based on the descriptor
                 RHI::Ptr<RHI::RayTracingTlas>& rayTracingTlas = m_tlas;
-                rayTracingTlas->CreateBuffers(RHI::RHISystemInterface::Get()->GetRayTracingSupport(), &tlasDescriptor, *m_bufferPools);
+                if (r_rayTracingTlasRefit && !m_tlasNeedsRebuild && m_tlasRefitCount < MaxTlasRefitCount)
+                {
+                    m_tlasRefit = rayTracingTlas->UpdateBuffers(&tlasDescriptor, *m_bufferPools) == RHI::ResultCode::Success;
+                }
+
+                if (m_tlasRefit)
+                {
+                    ++m_tlasRefitCount;
+                }
+                else
+                {
+                    rayTracingTlas->CreateBuffers(RHI::RHISystemInterface::Get()->GetRayTracingSupport(), &tlasDescriptor, *m_bufferPools);
+                    m_tlasRefitCount = 0;
+                }
+                m_tlasNeedsRebuild = false;
             }
 
             // update and compile the RayTracingSceneSrg and RayTracingMaterialSrg
@@ -1187,6 +1257,142 @@ namespace AZ
             }
         }
 
+        void RayTracingFeatureProcessor::ScheduleBlasBuilds()
+        {
+            // spread the BLAS builds of a newly loaded level over several frames, at least one BLAS is scheduled per frame
+            // so a mesh larger than the budget is still built
+            const uint32_t budget = r_rayTracingBlasBuildBudget;
+            uint32_t scheduledTriangleCount = 0;
+            bool blasScheduled = false;
+            for (auto& [assetId, blasInstance] : m_blasInstanceMap)
+            {
+                if (blasInstance.m_buildScheduled)
+                {
+                    continue;
+                }
+
+                if (budget > 0 && blasScheduled && scheduledTriangleCount + blasInstance.m_triangleCount > budget)
+                {
+                    continue;
+                }
+
+                blasInstance.m_buildScheduled = true;
+                scheduledTriangleCount += blasInstance.m_triangleCount;
+                blasScheduled = true;
+                --m_unscheduledBlasCount;
+
+                if (m_unscheduledBlasCount == 0)
+                {
+                    break;
+                }
+            }
+
+            if (blasScheduled)
+            {
+                // the newly scheduled instances become active in the TLAS
+                m_revision++;
+                m_tlasNeedsRebuild = true;
+            }
+        }
+
+        void RayTracingFeatureProcessor::UpdateBlasCompaction()
+        {
+            const RHI::MultiDevice::DeviceMask rayTracingDevices = RHI::RHISystemInterface::Get()->GetRayTracingSupport();
+
+            // the build and compaction flags are set by the RayTracingAccelerationStructurePass
+            AZStd::lock_guard lock(m_blasBuiltMutex);
+
+            bool blasReplaced = false;
+            for (auto& [assetId, blasInstance] : m_blasInstanceMap)
+            {
+                if (!blasInstance.m_compactionEnabled || blasInstance.m_compacted || blasInstance.m_blasBuilt != rayTracingDevices)
+                {
+                    continue;
+                }
+
+                if (!blasInstance.m_subMeshes.front().m_compactedBlas)
+                {
+                    // the compacted size is written by the GPU, wait until the frame that built the BLAS objects completed
+                    if (++blasInstance.m_framesSinceBuild <= RHI::Limits::Device::FrameCountMax)
+                    {
+                        continue;
+                    }
+
+                    RHI::ResultCode resultCode = RHI::ResultCode::Success;
+                    for (SubMeshBlasInstance& subMeshBlasInstance : blasInstance.m_subMeshes)
+                    {
+                        subMeshBlasInstance.m_compactedBlas = aznew RHI::RayTracingBlas;
+                        resultCode = subMeshBlasInstance.m_compactedBlas->CreateCompactedBuffers(*subMeshBlasInstance.m_blas, *m_bufferPools);
+                        if (resultCode != RHI::ResultCode::Success)
+                        {
+                            break;
+                        }
+                    }
+
+                    if (resultCode != RHI::ResultCode::Success)
+                    {
+                        for (SubMeshBlasInstance& subMeshBlasInstance : blasInstance.m_subMeshes)
+                        {
+                            subMeshBlasInstance.m_compactedBlas = nullptr;
+                        }
+
+                        // the compacted size isn't available yet, try again next frame
+                        if (resultCode != RHI::ResultCode::NotReady)
+                        {
+                            AZ_Warning("RayTracingFeatureProcessor", false, "Failed to create the compacted ray tracing BLAS objects of a mesh with error %d", resultCode);
+                            blasInstance.m_compactionEnabled = false;
+                            --m_pendingCompactionCount;
+                        }
+                        continue;
+                    }
+
+                    // the RayTracingAccelerationStructurePass records the compaction when the revision changed
+                    m_revision++;
+                }
+                else if (blasInstance.m_blasCompacted == rayTracingDevices)
+                {
+                    // the compaction was recorded on every device, replace the BLAS objects with the compacted ones
+                    for (SubMeshBlasInstance& subMeshBlasInstance : blasInstance.m_subMeshes)
+                    {
+                        subMeshBlasInstance.m_blas = AZStd::move(subMeshBlasInstance.m_compactedBlas);
+                    }
+                    blasInstance.m_compacted = true;
+                    blasReplaced = true;
+                    --m_pendingCompactionCount;
+                }
+            }
+
+            if (blasReplaced)
+            {
+                for (SubMesh& subMesh : m_subMeshes)
+                {
+                    BlasInstanceMap::iterator itBlas = m_blasInstanceMap.find(subMesh.m_mesh->m_assetId);
+                    if (itBlas != m_blasInstanceMap.end() && itBlas->second.m_compacted)
+                    {
+                        subMesh.m_blas = itBlas->second.m_subMeshes[subMesh.m_subMeshIndex].m_blas;
+                    }
+                }
+
+                m_revision++;
+                m_tlasNeedsRebuild = true;
+            }
+        }
+
+        void RayTracingFeatureProcessor::EraseBlasInstance(BlasInstanceMap::iterator itBlas)
+        {
+            if (!itBlas->second.m_buildScheduled)
+            {
+                --m_unscheduledBlasCount;
+            }
+
+            if (itBlas->second.m_compactionEnabled && !itBlas->second.m_compacted)
+            {
+                --m_pendingCompactionCount;
+            }
+
+            m_blasInstanceMap.erase(itBlas);
+        }
+
         AZ::RHI::RayTracingAccelerationStructureBuildFlags RayTracingFeatureProcessor::CreateRayTracingAccelerationStructureBuildFlags(bool isSkinnedMesh)
         {
             AZ::RHI::RayTracingAccelerationStructureBuildFlags buildFlags;
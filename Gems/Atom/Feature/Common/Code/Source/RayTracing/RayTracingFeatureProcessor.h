@@ -110,6 +110,7 @@ namespace AZ
             bool HasMeshGeometry() const override { return m_subMeshCount != 0; }
             bool HasProceduralGeometry() const override { return !m_proceduralGeometry.empty(); }
             bool HasGeometry() const override { return HasMeshGeometry() || HasProceduralGeometry(); }
+            bool IsTlasRefit() const override { return m_tlasRefit; }
 
         private:
             AZ_DISABLE_COPY_MOVE(RayTracingFeatureProcessor);
@@ -123,6 +124,16 @@ namespace AZ
 
             static RHI::RayTracingAccelerationStructureBuildFlags CreateRayTracingAccelerationStructureBuildFlags(bool isSkinnedMesh);
 
+            // schedules the builds of the BLAS objects within the per-frame build budget
+            void ScheduleBlasBuilds();
+
+            // creates the compacted BLAS objects once the compacted sizes are available, and replaces the BLAS objects with them
+            // once the compaction was recorded
+            void UpdateBlasCompaction();
+
+            // removes a BLAS instance entry and its pending builds or compaction
+            void EraseBlasInstance(BlasInstanceMap::iterator itBlas);
+
             // flag indicating if RayTracing is enabled, currently based on device support
             bool m_rayTracingEnabled = false;
 
@@ -148,6 +159,17 @@ namespace AZ
             // latest tlas revision number
             uint32_t m_tlasRevision = 0;
 
+            // the TLAS is refit instead of rebuilt when only the instance transforms changed since it was built.
+            // The quality of a refit TLAS degrades as the instances move, so it is rebuilt after MaxTlasRefitCount refits.
+            static constexpr uint32_t MaxTlasRefitCount = 64;
+            bool m_tlasNeedsRebuild = true;
+            bool m_tlasRefit = false;
+            uint32_t m_tlasRefitCount = 0;
+
+            // number of BLAS instances waiting to be scheduled for their build, or for their compaction
+            uint32_t m_unscheduledBlasCount = 0;
+            uint32_t m_pendingCompactionCount = 0;
+
             uint32_t m_proceduralGeometryTypeRevision = 0;
 
             // total number of ray tracing sub-meshes
@@ -38,6 +38,15 @@ namespace AZ::Render
             AZ::ConsoleFunctorFlags::DontReplicate | AZ::ConsoleFunctorFlags::DontDuplicate,
             "If set, enables filtering of shadow maps that are outside of the view frustum.");
 
+        AZ_CVAR(
+            bool,
+            r_projectedShadowStaticCasterCache,
+            true,
+            nullptr,
+            AZ::ConsoleFunctorFlags::DontReplicate | AZ::ConsoleFunctorFlags::DontDuplicate,
+            "If set, cached shadows render their static casters once to a separate atlas, and only their dynamic casters on top of it "
+            "each frame, instead of re-rendering every caster whenever a dynamic caster moves.");
+
         bool IsShadowmapCullingEnabled()
         {
             bool cullShadowmapOutsideViewFrustum = true;
@@ -136,9 +145,13 @@ namespace AZ::Render
     {
         if (id.IsValid())
         {
+            // The shadow's view and draw packet may still be used by the frame in flight
+            RPI::RPISystemInterface::Get()->WaitForRenderFrame();
+
             auto& shadowProperty = GetShadowPropertyFromShadowId(id);
             if (m_primaryProjectedShadowmapsPass)
             {
+                m_primaryProjectedShadowmapsPass->QueueRemoveChild(shadowProperty.m_staticShadowmapPass);
                 m_primaryProjectedShadowmapsPass->QueueRemoveChild(shadowProperty.m_shadowmapPass);
             }
             m_shadowProperties.RemoveData(&shadowProperty);
@@ -327,6 +340,7 @@ namespace AZ::Render
         if (shadowProperty.m_useCachedShadows && m_primaryProjectedShadowmapsPass)
         {
             shadowProperty.m_shadowmapPass->ForceRenderNextFrame();
+            shadowProperty.m_staticShadowmapPass->ForceRenderNextFrame();
         }
 
         m_deviceBufferNeedsUpdate = true;
@@ -351,8 +365,7 @@ namespace AZ::Render
 
         if (m_primaryProjectedShadowmapsPass)
         {
-            shadowProperty.m_shadowmapPass = CreateShadowmapPass(shadowId.GetIndex());
-            m_primaryProjectedShadowmapsPass->QueueAddChild(shadowProperty.m_shadowmapPass);
+            AddShadowmapPasses(shadowProperty);
         }
     }
         
@@ -447,6 +460,7 @@ namespace AZ::Render
                 }
                 ProjectedShadowmapsPass* shadowmapPass = static_cast<ProjectedShadowmapsPass*>(pass);
                 shadowmapPass->SetAtlasAttachmentImage(m_atlasImage);
+                shadowmapPass->SetStaticAtlasAttachmentImage(m_staticAtlasImage);
                 m_projectedShadowmapsPasses[renderPipeline] = shadowmapPass;
 
                 return RPI::PassFilterExecutionFlow::ContinueVisitingPasses; // continue to check for multiple (error case)
@@ -502,9 +516,7 @@ namespace AZ::Render
 
                     for (auto& shadowProperty : m_shadowProperties.GetDataVector())
                     {
-                        size_t shadowIndex = shadowProperty.m_shadowId.GetIndex();
-                        shadowProperty.m_shadowmapPass = CreateShadowmapPass(shadowIndex);
-                        m_primaryProjectedShadowmapsPass->QueueAddChild(shadowProperty.m_shadowmapPass);
+                        AddShadowmapPasses(shadowProperty);
                     }
                 }
                 m_primaryShadowPipeline = pipeline.get();
@@ -557,6 +569,11 @@ namespace AZ::Render
             CreateClearShadowDrawPacket();
         }
 
+        if (m_primaryProjectedShadowmapsPass && !m_restoreStaticShadowmapPipelineState)
+        {
+            CreateRestoreStaticShadowmapPipelineState();
+        }
+
         m_shadowmapPassNeedsUpdate = true;
     }
     
@@ -622,6 +639,12 @@ namespace AZ::Render
     {
         AZ_PROFILE_SCOPE(RPI, "ProjectedShadowFeatureProcessor: Simulate");
 
+        if (m_staticCasterCacheEnabled != r_projectedShadowStaticCasterCache)
+        {
+            m_staticCasterCacheEnabled = r_projectedShadowStaticCasterCache;
+            m_shadowmapPassNeedsUpdate = true;
+        }
+
         if (m_shadowmapPassNeedsUpdate && m_primaryProjectedShadowmapsPass)
         {
             UpdateAtlas();
@@ -657,10 +680,11 @@ namespace AZ::Render
             m_deviceBufferNeedsUpdate = false;
         }
 
-        // Turn off cached esm shadow maps for next frame
+        // Turn off cached esm shadow maps for next frame. The shadows that cache their static casters still render their dynamic
+        // casters, so they keep filtering.
         for (const auto& shadowProperty : m_shadowProperties.GetDataVector())
         {
-            if (shadowProperty.m_useCachedShadows)
+            if (shadowProperty.m_useCachedShadows && !UsesStaticCasterCache(shadowProperty))
             {
                 FilterParameter& esmData = m_shadowData.GetElement<FilterParamIndex>(shadowProperty.m_shadowId.GetIndex());
                 if (esmData.m_isEnabled != 0)
@@ -798,6 +822,69 @@ namespace AZ::Render
         m_clearShadowDrawPacket = drawPacketBuilder.End();
     }
 
+    void ProjectedShadowFeatureProcessor::CreateRestoreStaticShadowmapPipelineState()
+    {
+        const AZStd::string restoreShaderFilePath = "Shaders/Shadow/RestoreStaticShadowmap.azshader";
+        Data::Asset<RPI::ShaderAsset> shaderAsset = RPI::AssetUtils::LoadCriticalAsset<RPI::ShaderAsset>
+            (restoreShaderFilePath, RPI::AssetUtils::TraceLevel::Warning);
+        if (!shaderAsset.IsReady())
+        {
+            // Cached shadows then re-render all their casters
+            return;
+        }
+
+        m_restoreStaticShadowmapShader = RPI::Shader::FindOrCreate(shaderAsset);
+        const RPI::ShaderVariant& variant = m_restoreStaticShadowmapShader->GetRootVariant();
+
+        RHI::PipelineStateDescriptorForDraw pipelineStateDescriptor;
+        variant.ConfigurePipelineState(pipelineStateDescriptor);
+
+        if (!GetParentScene()->ConfigurePipelineState(m_restoreStaticShadowmapShader->GetDrawListTag(), pipelineStateDescriptor))
+        {
+            AZ_Warning("ProjectedShadowFeatureProcessor", false,
+                "Could not find pipeline state for RestoreStaticShadowmap shader's draw list '%s'", shaderAsset->GetDrawListName().GetCStr());
+            m_restoreStaticShadowmapShader = nullptr;
+            return;
+        }
+
+        RHI::InputStreamLayoutBuilder layoutBuilder;
+        pipelineStateDescriptor.m_inputStreamLayout = layoutBuilder.End();
+
+        m_restoreStaticShadowmapPipelineState = m_restoreStaticShadowmapShader->AcquirePipelineState(pipelineStateDescriptor);
+        AZ_Warning("ProjectedShadowFeatureProcessor", m_restoreStaticShadowmapPipelineState,
+            "Shader '%s'. Failed to acquire default pipeline state", shaderAsset->GetName().GetCStr());
+    }
+
+    void ProjectedShadowFeatureProcessor::CreateRestoreStaticShadowmapDrawPacket(ShadowProperty& shadowProperty)
+    {
+        if (shadowProperty.m_restoreStaticShadowmapDrawPacket)
+        {
+            return;
+        }
+
+        // Each shadow reads its own slice of the static atlas, so it has its own SRG and draw packet
+        shadowProperty.m_restoreStaticShadowmapSrg = RPI::ShaderResourceGroup::Create(
+            m_restoreStaticShadowmapShader->GetAsset(), m_restoreStaticShadowmapShader->GetSupervariantIndex(), AZ_NAME_LITERAL("RestoreStaticShadowmapSrg"));
+        if (!shadowProperty.m_restoreStaticShadowmapSrg)
+        {
+            AZ_Error("ProjectedShadowFeatureProcessor", false, "Failed to create the RestoreStaticShadowmapSrg.");
+            return;
+        }
+
+        RHI::DrawPacketBuilder drawPacketBuilder{RHI::MultiDevice::AllDevices};
+        drawPacketBuilder.Begin(nullptr);
+        drawPacketBuilder.SetGeometryView(&m_geometryView);
+        drawPacketBuilder.AddShaderResourceGroup(shadowProperty.m_restoreStaticShadowmapSrg->GetRHIShaderResourceGroup());
+
+        RHI::DrawPacketBuilder::DrawRequest drawRequest;
+        drawRequest.m_listTag = m_restoreStaticShadowmapShader->GetDrawListTag();
+        drawRequest.m_pipelineState = m_restoreStaticShadowmapPipelineState;
+        drawRequest.m_sortKey = AZStd::numeric_limits<RHI::DrawItemSortKey>::min();
+
+        drawPacketBuilder.AddDrawItem(drawRequest);
+        shadowProperty.m_restoreStaticShadowmapDrawPacket = drawPacketBuilder.End();
+    }
+
     void ProjectedShadowFeatureProcessor::UpdateAtlas()
     {
         // Currently when something changes, the atlas is completely reset. This is ok when most shadows are dynamic,
@@ -840,9 +927,22 @@ namespace AZ::Render
 
         m_atlasImage = createAtlas(RHI::Format::D32_FLOAT, RHI::ImageBindFlags::Depth, RHI::ImageAspectFlags::Depth, "ProjectedShadowAtlas");
 
+        // The static casters are cached in an atlas of the same layout, so a shadow restores them from the same texels
+        const bool needsStaticAtlas = AZStd::any_of(
+            shadowProperties.begin(),
+            shadowProperties.end(),
+            [this](const ShadowProperty& shadowProperty)
+            {
+                return UsesStaticCasterCache(shadowProperty);
+            });
+        m_staticAtlasImage = needsStaticAtlas
+            ? createAtlas(RHI::Format::D32_FLOAT, RHI::ImageBindFlags::Depth | RHI::ImageBindFlags::ShaderRead, RHI::ImageAspectFlags::Depth, "ProjectedShadowStaticAtlas")
+            : Data::Instance<RPI::AttachmentImage>();
+
         for (auto& [key, projectedShadowmapsPass] : m_projectedShadowmapsPasses)
         {
             projectedShadowmapsPass->SetAtlasAttachmentImage(m_atlasImage);
+            projectedShadowmapsPass->SetStaticAtlasAttachmentImage(m_staticAtlasImage);
             projectedShadowmapsPass->QueueForBuildAndInitialization();
         }
 
@@ -862,10 +962,8 @@ namespace AZ::Render
         }
     }
 
-    RPI::Ptr<ShadowmapPass> ProjectedShadowFeatureProcessor::CreateShadowmapPass(size_t childIndex)
+    RPI::Ptr<ShadowmapPass> ProjectedShadowFeatureProcessor::CreateShadowmapPass(const Name& passName, size_t childIndex)
     {
-        const Name passName{ AZStd::string::format("ProjectedShadowmapPass.%zu", childIndex) };
-
         RHI::RHISystemInterface* rhiSystem = RHI::RHISystemInterface::Get();
         auto passData = AZStd::make_shared<RPI::RasterPassData>();
         passData->m_drawListTag = rhiSystem->GetDrawListTagRegistry()->GetName(m_primaryProjectedShadowmapsPass->GetDrawListTag());
@@ -874,6 +972,28 @@ namespace AZ::Render
         return ShadowmapPass::CreateWithPassRequest(passName, passData);
     }
 
+    void ProjectedShadowFeatureProcessor::AddShadowmapPasses(ShadowProperty& shadowProperty)
+    {
+        const size_t shadowIndex = shadowProperty.m_shadowId.GetIndex();
+        shadowProperty.m_shadowmapPass = CreateShadowmapPass(Name(AZStd::string::format("ProjectedShadowmapPass.%zu", shadowIndex)), shadowIndex);
+
+        // The static caster pass renders the same view. It stays disabled unless the shadow uses the static caster cache, and is added
+        // first since the shadowmap pass reads what it renders.
+        shadowProperty.m_staticShadowmapPass =
+            CreateShadowmapPass(Name(AZStd::string::format("ProjectedShadowmapPass.%zu.Static", shadowIndex)), shadowIndex);
+        shadowProperty.m_staticShadowmapPass->SetCasterContent(ShadowmapPass::CasterContent::StaticCasters);
+        shadowProperty.m_staticShadowmapPass->SetEnabled(false);
+
+        m_primaryProjectedShadowmapsPass->QueueAddChild(shadowProperty.m_staticShadowmapPass);
+        m_primaryProjectedShadowmapsPass->QueueAddChild(shadowProperty.m_shadowmapPass);
+    }
+
+    bool ProjectedShadowFeatureProcessor::UsesStaticCasterCache(const ShadowProperty& shadowProperty) const
+    {
+        return shadowProperty.m_useCachedShadows && m_staticCasterCacheEnabled && m_restoreStaticShadowmapPipelineState &&
+            GetParentScene()->GetViewTagBitRegistry().FindTag(MeshCommon::MeshDynamicName).IsValid();
+    }
+
     void ProjectedShadowFeatureProcessor::UpdateShadowPasses()
     {
         struct SliceInfo
@@ -882,20 +1002,48 @@ namespace AZ::Render
             AZStd::vector<ShadowmapPass*> m_shadowPasses;
         };
 
+        RHI::Handle<uint32_t> casterMovedBit = GetParentScene()->GetViewTagBitRegistry().FindTag(MeshCommon::MeshMovedName);
+        RHI::Handle<uint32_t> casterDynamicBit = GetParentScene()->GetViewTagBitRegistry().FindTag(MeshCommon::MeshDynamicName);
+
         AZStd::vector<SliceInfo> sliceInfo(m_atlas.GetArraySliceCount());
-        for (const auto& it : m_shadowProperties.GetDataVector())
+        for (auto& it : m_shadowProperties.GetDataVector())
         {
 
             // This index indicates the execution order of the passes.
             // The first pass to render a slice should clear the slice.
             size_t shadowIndex = it.m_shadowId.GetIndex();
             auto* pass = it.m_shadowmapPass.get();
+            auto* staticPass = it.m_staticShadowmapPass.get();
 
             const ShadowmapAtlas::Origin origin = m_atlas.GetOrigin(shadowIndex);
             pass->SetArraySlice(origin.m_arraySlice);
             pass->SetIsStatic(it.m_useCachedShadows);
             pass->ForceRenderNextFrame();
 
+            // With the static caster cache, the static casters render to the same tile of the static atlas, and the shadowmap pass
+            // restores them before drawing the dynamic casters of the view.
+            const bool usesStaticCasterCache = UsesStaticCasterCache(it) && m_staticAtlasImage;
+            if (usesStaticCasterCache)
+            {
+                CreateRestoreStaticShadowmapDrawPacket(it);
+            }
+            const bool hasStaticCasterPass = usesStaticCasterCache && it.m_restoreStaticShadowmapDrawPacket;
+            it.m_shadowmapView->SetDynamicCullableFlags(hasStaticCasterPass ? casterDynamicBit.GetIndex() : 0);
+            pass->SetCasterContent(hasStaticCasterPass ? ShadowmapPass::CasterContent::DynamicCasters : ShadowmapPass::CasterContent::All);
+            pass->SetStaticCasterPass(hasStaticCasterPass ? staticPass : nullptr);
+            pass->SetStaticShadowmapSrg(hasStaticCasterPass ? it.m_restoreStaticShadowmapSrg : nullptr);
+
+            staticPass->SetEnabled(hasStaticCasterPass);
+            staticPass->SetArraySlice(origin.m_arraySlice);
+            staticPass->SetIsStatic(true);
+            staticPass->ForceRenderNextFrame();
+            staticPass->SetClearEnabled(false);
+            staticPass->SetCasterMovedBit(casterMovedBit);
+            if (m_clearShadowDrawPacket)
+            {
+                staticPass->SetClearShadowDrawPacket(m_clearShadowDrawPacket);
+            }
+
             const auto& filterData = m_shadowData.GetElement<FilterParamIndex>(shadowIndex);
             if (filterData.m_shadowmapSize != static_cast<uint32_t>(ShadowmapSize::None))
             {
@@ -911,6 +1059,7 @@ namespace AZ::Render
                     origin.m_originInSlice[1] + filterData.m_shadowmapSize);
                 pass->SetViewportScissor(viewport, scissor);
                 pass->SetClearEnabled(false);
+                staticPass->SetViewportScissor(viewport, scissor);
 
                 SliceInfo& sliceInfoItem = sliceInfo.at(origin.m_arraySlice);
                 sliceInfoItem.m_shadowPasses.push_back(pass);
@@ -918,8 +1067,6 @@ namespace AZ::Render
             }
         }
 
-        RHI::Handle<uint32_t> casterMovedBit = GetParentScene()->GetViewTagBitRegistry().FindTag(MeshCommon::MeshMovedName);
-
         for (const auto& it : sliceInfo)
         {
             if (!it.m_hasStaticShadows)
@@ -940,6 +1087,15 @@ namespace AZ::Render
                 }
             }
         }
+
+        // Shadows that cache their static casters "clear" their tile with the restored static casters instead.
+        for (const auto& it : m_shadowProperties.GetDataVector())
+        {
+            if (it.m_shadowmapPass->GetCasterContent() == ShadowmapPass::CasterContent::DynamicCasters)
+            {
+                it.m_shadowmapPass->SetClearShadowDrawPacket(it.m_restoreStaticShadowmapDrawPacket);
+            }
+        }
     }
 
 }
@@ -86,6 +86,11 @@ namespace AZ::Render
             ProjectedShadowDescriptor m_desc;
             RPI::ViewPtr m_shadowmapView;
             RPI::Ptr<ShadowmapPass> m_shadowmapPass;
+
+            // Renders the static casters of a cached shadow to the static atlas, see UsesStaticCasterCache()
+            RPI::Ptr<ShadowmapPass> m_staticShadowmapPass;
+            Data::Instance<RPI::ShaderResourceGroup> m_restoreStaticShadowmapSrg;
+            RHI::ConstPtr<RHI::DrawPacket> m_restoreStaticShadowmapDrawPacket;
             float m_bias = 0.1f;
             ShadowId m_shadowId;
             bool m_useCachedShadows = false;
@@ -114,9 +119,18 @@ namespace AZ::Render
         bool FilterMethodIsEsm(const ShadowData& shadowData) const;
 
         ShadowProperty& GetShadowPropertyFromShadowId(ShadowId id);
-        RPI::Ptr<ShadowmapPass> CreateShadowmapPass(size_t childIndex);
+        RPI::Ptr<ShadowmapPass> CreateShadowmapPass(const Name& passName, size_t childIndex);
+
+        // Creates the shadowmap passes of a shadow and adds them to the primary projected shadowmaps pass.
+        void AddShadowmapPasses(ShadowProperty& shadowProperty);
+
+        // Returns true if a cached shadow renders its static casters once to the static atlas, and only its dynamic casters on top of
+        // them when they move, instead of re-rendering all its casters.
+        bool UsesStaticCasterCache(const ShadowProperty& shadowProperty) const;
 
         void CreateClearShadowDrawPacket();
+        void CreateRestoreStaticShadowmapPipelineState();
+        void CreateRestoreStaticShadowmapDrawPacket(ShadowProperty& shadowProperty);
 
         void UpdateAtlas();
         void UpdateShadowPasses();
@@ -144,6 +158,9 @@ namespace AZ::Render
         Data::Instance<RPI::AttachmentImage> m_atlasImage;
         Data::Instance<RPI::AttachmentImage> m_esmAtlasImage;
 
+        // Holds the static casters of the shadows using the static caster cache, with the same layout as m_atlasImage
+        Data::Instance<RPI::AttachmentImage> m_staticAtlasImage;
+
         AZStd::unordered_map<RPI::RenderPipeline*, ProjectedShadowmapsPass*> m_projectedShadowmapsPasses;
         AZStd::unordered_map<RPI::RenderPipeline*, EsmShadowmapsPass*> m_esmShadowmapsPasses;
         ProjectedShadowmapsPass* m_primaryProjectedShadowmapsPass = nullptr;
@@ -153,6 +170,9 @@ namespace AZ::Render
         Data::Instance<RPI::Shader> m_clearShadowShader;
         RHI::ConstPtr<RHI::DrawPacket> m_clearShadowDrawPacket;
 
+        Data::Instance<RPI::Shader> m_restoreStaticShadowmapShader;
+        const RHI::PipelineState* m_restoreStaticShadowmapPipelineState = nullptr;
+
         RHI::ShaderInputNameIndex m_shadowmapAtlasSizeIndex{ "m_shadowmapAtlasSize" };
         RHI::ShaderInputNameIndex m_invShadowmapAtlasSizeIndex{ "m_invShadowmapAtlasSize" };
 
@@ -161,5 +181,6 @@ namespace AZ::Render
         bool m_deviceBufferNeedsUpdate = false;
         bool m_shadowmapPassNeedsUpdate = true;
         bool m_filterParameterNeedsUpdate = false;
+        bool m_staticCasterCacheEnabled = false;
     };
 }
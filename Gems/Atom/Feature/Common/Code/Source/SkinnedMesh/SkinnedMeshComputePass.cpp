@@ -40,6 +40,18 @@ namespace AZ
             m_skinnedMeshFeatureProcessor = skinnedMeshFeatureProcessor;
         }
 
+        void SkinnedMeshComputePass::FrameBeginInternal(FramePrepareParams params)
+        {
+            ComputePass::FrameBeginInternal(params);
+
+            // The readback copies the skinned positions after this pass wrote them
+            const RPI::PassAttachmentBinding* outputStreamBinding = FindAttachmentBinding(Name{ "SkinnedMeshOutputStream" });
+            if (m_skinnedMeshFeatureProcessor && outputStreamBinding && outputStreamBinding->GetAttachment())
+            {
+                m_skinnedMeshFeatureProcessor->AddPositionReadbackScope(params, outputStreamBinding->m_unifiedScopeDesc.GetAsBuffer());
+            }
+        }
+
         void SkinnedMeshComputePass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
         {
             if (m_skinnedMeshFeatureProcessor)
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <SkinnedMesh/SkinnedMeshDispatchBatch.h>
+#include <SkinnedMesh/SkinnedMeshDispatchItem.h>
+
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RPI.Public/RPIUtils.h>
+#include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+
+#include <AzCore/Math/MathUtils.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        AZ_CVAR(bool, r_skinningBatchDispatches, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Skin all the meshes that support it with a single batched dispatch, instead of one dispatch per mesh.");
+
+        bool SkinnedMeshDispatchBatch::Init(Data::Instance<RPI::Shader> skinningShader)
+        {
+            Shutdown();
+
+            if (!skinningShader)
+            {
+                return false;
+            }
+
+            // The batched shader reads the input streams of every mesh from bindless buffers
+            RHI::RHISystemInterface* rhiSystem = RHI::RHISystemInterface::Get();
+            for (int deviceIndex = 0; deviceIndex < rhiSystem->GetDeviceCount(); ++deviceIndex)
+            {
+                if (!rhiSystem->GetDevice(deviceIndex)->GetFeatures().m_unboundedArrays)
+                {
+                    return false;
+                }
+            }
+
+            RPI::ShaderOptionGroup shaderOptionGroup = skinningShader->CreateShaderOptionGroup();
+            if (!shaderOptionGroup.SetValue(Name{ "o_batched" }, RPI::ShaderOptionValue{ true }))
+            {
+                return false;
+            }
+            shaderOptionGroup.SetUnspecifiedToDefaultValues();
+
+            const RPI::ShaderVariant& shaderVariant = skinningShader->GetVariant(shaderOptionGroup.GetShaderVariantId());
+            RHI::PipelineStateDescriptorForDispatch pipelineStateDescriptor;
+            shaderVariant.ConfigurePipelineState(pipelineStateDescriptor, shaderOptionGroup);
+
+            auto perInstanceSrgLayout = skinningShader->FindShaderResourceGroupLayout(Name{ "InstanceSrg" });
+            if (!perInstanceSrgLayout)
+            {
+                AZ_Error("SkinnedMeshDispatchBatch", false, "Failed to get shader resource group layout");
+                return false;
+            }
+
+            m_instanceSrg = RPI::ShaderResourceGroup::Create(skinningShader->GetAsset(), skinningShader->GetSupervariantIndex(), perInstanceSrgLayout->GetName());
+            if (!m_instanceSrg)
+            {
+                AZ_Error("SkinnedMeshDispatchBatch", false, "Failed to create shader resource group for batched skinning");
+                return false;
+            }
+
+            m_batchEntriesIndex = m_instanceSrg->FindShaderInputBufferIndex(Name{ "m_batchEntries" });
+            m_batchEntryCountIndex = m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_batchEntryCount" });
+            m_totalNumberOfThreadsXIndex = m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_totalNumberOfThreadsX" });
+            if (!m_batchEntriesIndex.IsValid() || !m_batchEntryCountIndex.IsValid() || !m_totalNumberOfThreadsXIndex.IsValid())
+            {
+                AZ_Error("SkinnedMeshDispatchBatch", false, "Failed to find the batch inputs in the skinning compute shader per-instance SRG.");
+                m_instanceSrg = nullptr;
+                return false;
+            }
+
+            if (shaderVariant.UseKeyFallback() && m_instanceSrg->HasShaderVariantKeyFallbackEntry())
+            {
+                m_instanceSrg->SetShaderVariantKeyFallbackValue(shaderOptionGroup.GetShaderVariantKeyFallbackValue());
+            }
+
+            const auto outcome = RPI::GetComputeShaderNumThreads(skinningShader->GetAsset(), m_arguments);
+            if (!outcome.IsSuccess())
+            {
+                AZ_Error("SkinnedMeshDispatchBatch", false, outcome.GetError().c_str());
+                m_instanceSrg = nullptr;
+                return false;
+            }
+
+            m_dispatchItem.SetPipelineState(skinningShader->AcquirePipelineState(pipelineStateDescriptor));
+            m_dispatchItem.SetUniqueShaderResourceGroup(m_instanceSrg->GetRHIShaderResourceGroup());
+            m_skinningShader = skinningShader;
+            m_isInitialized = true;
+            return true;
+        }
+
+        void SkinnedMeshDispatchBatch::Shutdown()
+        {
+            m_isInitialized = false;
+            m_skinningShader = nullptr;
+            m_instanceSrg = nullptr;
+            m_deviceEntries.clear();
+        }
+
+        bool SkinnedMeshDispatchBatch::IsInitialized() const
+        {
+            return m_isInitialized;
+        }
+
+        bool SkinnedMeshDispatchBatch::Update(AZStd::span<const SkinnedMeshDispatchItem* const> dispatchItems)
+        {
+            if (!m_isInitialized || dispatchItems.empty())
+            {
+                return false;
+            }
+
+            AZ_PROFILE_SCOPE(AzRender, "SkinnedMeshDispatchBatch: Update");
+
+            const uint32_t threadsPerGroup = AZStd::max<uint32_t>(m_arguments.m_threadsPerGroupX, 1);
+            uint32_t threadCount = 0;
+
+            const int deviceCount = RHI::RHISystemInterface::Get()->GetDeviceCount();
+            AZStd::unordered_map<int, const void*> deviceData;
+            for (int deviceIndex = 0; deviceIndex < deviceCount; ++deviceIndex)
+            {
+                AZStd::vector<SkinnedMeshBatchEntry>& entries = m_deviceEntries[deviceIndex];
+                entries.resize(dispatchItems.size());
+
+                // Aligning each mesh to a thread group keeps the meshes of a group uniform, and the first threads sorted
+                threadCount = 0;
+                for (size_t itemIndex = 0; itemIndex < dispatchItems.size(); ++itemIndex)
+                {
+                    SkinnedMeshBatchEntry& entry = entries[itemIndex];
+                    dispatchItems[itemIndex]->GetBatchEntry(deviceIndex, entry);
+                    entry.m_firstThread = threadCount;
+                    threadCount += AZ::RoundUpToMultiple(entry.m_numVertices, threadsPerGroup);
+                }
+                deviceData[deviceIndex] = entries.data();
+            }
+
+            if (threadCount == 0)
+            {
+                return false;
+            }
+
+            m_entryBuffer.AdvanceCurrentBufferAndUpdateData(deviceData, dispatchItems.size() * sizeof(SkinnedMeshBatchEntry));
+
+            // Spread the thread groups over both dimensions the same way a single mesh spreads its vertices
+            uint32_t xGroups = 0;
+            uint32_t yGroups = 0;
+            CalculateSkinnedMeshTotalThreadsPerDimension(threadCount / threadsPerGroup, xGroups, yGroups);
+
+            m_instanceSrg->SetBufferView(m_batchEntriesIndex, m_entryBuffer.GetCurrentBufferView());
+            m_instanceSrg->SetConstant(m_batchEntryCountIndex, aznumeric_cast<uint32_t>(dispatchItems.size()));
+            m_instanceSrg->SetConstant(m_totalNumberOfThreadsXIndex, xGroups * threadsPerGroup);
+            m_instanceSrg->Compile();
+
+            RHI::DispatchDirect arguments = m_arguments;
+            arguments.m_totalNumberOfThreadsX = xGroups * threadsPerGroup;
+            arguments.m_totalNumberOfThreadsY = yGroups;
+            arguments.m_totalNumberOfThreadsZ = 1;
+            m_dispatchItem.SetArguments(arguments);
+            return true;
+        }
+
+        const RHI::DispatchItem& SkinnedMeshDispatchBatch::GetRHIDispatchItem() const
+        {
+            return m_dispatchItem;
+        }
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Feature/SkinnedMesh/SkinnedMeshVertexStreams.h>
+
+#include <Atom/RHI/DispatchItem.h>
+#include <Atom/RPI.Public/Buffer/RingBuffer.h>
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Shader;
+        class ShaderResourceGroup;
+    }
+
+    namespace Render
+    {
+        class SkinnedMeshDispatchItem;
+
+        //! When enabled, the skinning of every mesh that supports it is done by a single batched dispatch per frame.
+        AZ_CVAR_EXTERNED(bool, r_skinningBatchDispatches);
+
+        namespace SkinnedMeshBatchFlags
+        {
+            //! The SkinningMethod of the mesh
+            static constexpr uint32_t SkinningMethodMask = 0x3;
+            static constexpr uint32_t ApplyMorphTargets = 0x4;
+        }
+
+        //! The per-mesh data of a batched skinning dispatch. Must match SkinningBatchEntry in LinearSkinningPassSRG.azsli.
+        //! This holds the same data as the InstanceSrg of a SkinnedMeshDispatchItem, except the input streams and the bone transforms
+        //! are read from bindless buffers, at a byte offset for the streams.
+        struct SkinnedMeshBatchEntry
+        {
+            //! The first thread of the batched dispatch that skins this mesh, aligned to the thread group size
+            uint32_t m_firstThread = 0;
+            uint32_t m_numVertices = 0;
+            uint32_t m_numInfluencesPerVertex = 0;
+            uint32_t m_flags = 0;
+
+            //! Bindless read index and byte offset of each input stream, indexed by SkinnedMeshInputVertexStreams
+            uint32_t m_sourceBuffers[static_cast<uint8_t>(SkinnedMeshInputVertexStreams::NumVertexStreams)] = {};
+            uint32_t m_sourceByteOffsets[static_cast<uint8_t>(SkinnedMeshInputVertexStreams::NumVertexStreams)] = {};
+
+            //! Bindless read index of the bone transforms
+            uint32_t m_boneTransforms = 0;
+
+            float m_morphTargetDeltaInverseIntegerEncoding = 0.0f;
+            //! Offsets to the morph target deltas of the position, normal, tangent and bitangent in the output stream, in floats
+            uint32_t m_morphTargetDeltaOffsets[4] = {};
+
+            //! Offsets to the skinned streams in the output stream, in floats, indexed by SkinnedMeshOutputVertexStreams
+            uint32_t m_targetOffsets[static_cast<uint8_t>(SkinnedMeshOutputVertexStreams::NumVertexStreams)] = {};
+            uint32_t m_targetPositionHistory = 0;
+
+            uint32_t m_pad = 0;
+        };
+        static_assert(sizeof(SkinnedMeshBatchEntry) == 112, "SkinnedMeshBatchEntry must match SkinningBatchEntry in LinearSkinningPassSRG.azsli");
+
+        //! Skins the meshes of many SkinnedMeshDispatchItems with a single dispatch of the o_batched variant of the skinning shader.
+        //! Each mesh gets a range of threads aligned to the thread group size, and the entries are sorted by their first thread, which
+        //! is the offset table the shader searches to find the mesh of a thread. This replaces a dispatch and an SRG per mesh with one
+        //! of each for the whole batch.
+        class SkinnedMeshDispatchBatch
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(SkinnedMeshDispatchBatch, SystemAllocator);
+
+            SkinnedMeshDispatchBatch() = default;
+            AZ_DISABLE_COPY_MOVE(SkinnedMeshDispatchBatch);
+
+            //! Creates the SRG and the pipeline state of the batched variant of the skinning shader.
+            //! Fails if the shader has no o_batched option or a device doesn't support bindless buffers.
+            bool Init(Data::Instance<RPI::Shader> skinningShader);
+            void Shutdown();
+
+            bool IsInitialized() const;
+
+            //! Uploads the entries of the dispatch items for this frame and sizes the dispatch to cover all of them.
+            //! The dispatch items must be batchable, see SkinnedMeshDispatchItem::IsBatchable.
+            //! @return false if there is nothing to dispatch.
+            bool Update(AZStd::span<const SkinnedMeshDispatchItem* const> dispatchItems);
+
+            const RHI::DispatchItem& GetRHIDispatchItem() const;
+
+        private:
+            Data::Instance<RPI::Shader> m_skinningShader;
+            Data::Instance<RPI::ShaderResourceGroup> m_instanceSrg;
+            RHI::ShaderInputBufferIndex m_batchEntriesIndex;
+            RHI::ShaderInputConstantIndex m_batchEntryCountIndex;
+            RHI::ShaderInputConstantIndex m_totalNumberOfThreadsXIndex;
+
+            RHI::DispatchItem m_dispatchItem{ RHI::MultiDevice::AllDevices };
+            RHI::DispatchDirect m_arguments;
+
+            //! The bindless indices differ between devices, so each device gets its own entries
+            AZStd::unordered_map<int, AZStd::vector<SkinnedMeshBatchEntry>> m_deviceEntries;
+            RPI::RingBuffer m_entryBuffer{ "SkinnedMeshBatchEntries", RPI::CommonBufferPoolType::ReadOnly, static_cast<uint32_t>(sizeof(SkinnedMeshBatchEntry)) };
+
+            bool m_isInitialized = false;
+        };
+    } // namespace Render
+} // namespace AZ
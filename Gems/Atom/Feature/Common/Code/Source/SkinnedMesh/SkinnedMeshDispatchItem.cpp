@@ -7,6 +7,7 @@
  */
 
 #include <SkinnedMesh/SkinnedMeshDispatchItem.h>
+#include <SkinnedMesh/SkinnedMeshDispatchBatch.h>
 #include <SkinnedMesh/SkinnedMeshOutputStreamManager.h>
 #include <SkinnedMesh/SkinnedMeshFeatureProcessor.h>
 
@@ -220,9 +221,57 @@ namespace AZ
 
             m_dispatchItem.SetArguments(arguments);
 
+            InitBatchViews();
+
             return true;
         }
 
+        // Builds a raw view of a whole buffer, for the bindless reads of a SkinnedMeshDispatchBatch
+        static RHI::Ptr<RHI::BufferView> BuildRawBufferView(const RHI::Buffer* buffer)
+        {
+            const uint32_t byteCount = aznumeric_cast<uint32_t>(buffer->GetDescriptor().m_byteCount);
+            return const_cast<RHI::Buffer*>(buffer)->BuildBufferView(RHI::BufferViewDescriptor::CreateRaw(0, byteCount));
+        }
+
+        void SkinnedMeshDispatchItem::InitBatchViews()
+        {
+            m_isBatchable = false;
+            m_batchViews = {};
+            m_batchViewByteOffsets = {};
+
+            constexpr uint8_t inputStreamCount = static_cast<uint8_t>(SkinnedMeshInputVertexStreams::NumVertexStreams);
+            const SkinnedMeshVertexStreamPropertyInterface* streamProperties = SkinnedMeshVertexStreamPropertyInterface::Get();
+            for (const SkinnedSubMeshProperties::SrgNameViewPair& nameViewPair : m_inputBuffers->GetInputBufferViews(m_lodIndex, m_meshIndex))
+            {
+                for (uint8_t inputStream = 0; inputStream < inputStreamCount; ++inputStream)
+                {
+                    const SkinnedMeshVertexStreamInfo& streamInfo =
+                        streamProperties->GetInputStreamInfo(static_cast<SkinnedMeshInputVertexStreams>(inputStream));
+                    if (nameViewPair.m_bufferView && nameViewPair.m_srgName == streamInfo.m_shaderResourceGroupName)
+                    {
+                        const RHI::BufferViewDescriptor& viewDescriptor = nameViewPair.m_bufferView->GetDescriptor();
+                        m_batchViews[inputStream] = BuildRawBufferView(nameViewPair.m_bufferView->GetBuffer());
+                        m_batchViewByteOffsets[inputStream] = viewDescriptor.m_elementOffset * viewDescriptor.m_elementSize;
+                    }
+                }
+            }
+
+            const bool isSkinned = m_shaderOptions.m_skinningMethod != SkinningMethod::NoSkinning;
+            if (isSkinned && m_boneTransforms && m_boneTransforms->GetRHIBuffer())
+            {
+                m_batchViews[inputStreamCount] = BuildRawBufferView(m_boneTransforms->GetRHIBuffer());
+            }
+
+            // The shader always reads the positions, normals, tangents and bitangents, and only reads the influences and bones
+            // when skinning
+            const uint8_t requiredViewCount = isSkinned ? BatchViewCount : static_cast<uint8_t>(SkinnedMeshInputVertexStreams::BlendIndices);
+            m_isBatchable = true;
+            for (uint8_t viewIndex = 0; viewIndex < requiredViewCount; ++viewIndex)
+            {
+                m_isBatchable = m_isBatchable && m_batchViews[viewIndex];
+            }
+        }
+
         const RHI::DispatchItem& SkinnedMeshDispatchItem::GetRHIDispatchItem() const
         {
             return m_dispatchItem;
@@ -253,6 +302,47 @@ namespace AZ
             return m_isEnabled;
         }
 
+        bool SkinnedMeshDispatchItem::IsBatchable() const
+        {
+            return m_isBatchable;
+        }
+
+        void SkinnedMeshDispatchItem::GetBatchEntry(int deviceIndex, SkinnedMeshBatchEntry& entry) const
+        {
+            entry.m_numVertices = GetVertexCount();
+            entry.m_numInfluencesPerVertex = m_inputBuffers->GetInfluenceCountPerVertex(m_lodIndex, m_meshIndex);
+            entry.m_flags = static_cast<uint32_t>(m_shaderOptions.m_skinningMethod) & SkinnedMeshBatchFlags::SkinningMethodMask;
+            if (m_shaderOptions.m_applyMorphTargets)
+            {
+                entry.m_flags |= SkinnedMeshBatchFlags::ApplyMorphTargets;
+            }
+
+            constexpr uint8_t inputStreamCount = static_cast<uint8_t>(SkinnedMeshInputVertexStreams::NumVertexStreams);
+            for (uint8_t inputStream = 0; inputStream < inputStreamCount; ++inputStream)
+            {
+                const RHI::Ptr<RHI::BufferView>& view = m_batchViews[inputStream];
+                entry.m_sourceBuffers[inputStream] =
+                    view ? view->GetDeviceBufferView(deviceIndex)->GetBindlessReadIndex() : RHI::DeviceBufferView::InvalidBindlessIndex;
+                entry.m_sourceByteOffsets[inputStream] = m_batchViewByteOffsets[inputStream];
+            }
+            const RHI::Ptr<RHI::BufferView>& boneTransformsView = m_batchViews[inputStreamCount];
+            entry.m_boneTransforms = boneTransformsView ? boneTransformsView->GetDeviceBufferView(deviceIndex)->GetBindlessReadIndex()
+                                                         : RHI::DeviceBufferView::InvalidBindlessIndex;
+
+            // The offsets are in floats, the same as the constants of the InstanceSrg
+            entry.m_morphTargetDeltaInverseIntegerEncoding = 1.0f / m_morphTargetDeltaIntegerEncoding;
+            entry.m_morphTargetDeltaOffsets[0] = m_morphTargetInstanceMetaData.m_accumulatedPositionDeltaOffsetInBytes / 4;
+            entry.m_morphTargetDeltaOffsets[1] = m_morphTargetInstanceMetaData.m_accumulatedNormalDeltaOffsetInBytes / 4;
+            entry.m_morphTargetDeltaOffsets[2] = m_morphTargetInstanceMetaData.m_accumulatedTangentDeltaOffsetInBytes / 4;
+            entry.m_morphTargetDeltaOffsets[3] = m_morphTargetInstanceMetaData.m_accumulatedBitangentDeltaOffsetInBytes / 4;
+
+            for (uint8_t outputStream = 0; outputStream < static_cast<uint8_t>(SkinnedMeshOutputVertexStreams::NumVertexStreams); ++outputStream)
+            {
+                entry.m_targetOffsets[outputStream] = m_outputBufferOffsetsInBytes[outputStream] / 4;
+            }
+            entry.m_targetPositionHistory = m_positionHistoryBufferOffsetInBytes / 4;
+        }
+
         void SkinnedMeshDispatchItem::OnShaderReinitialized(const CachedSkinnedMeshShaderOptions* cachedShaderOptions)
         {
             m_shaderOptionGroup = cachedShaderOptions->CreateShaderOptionGroup(m_shaderOptions);
@@ -12,6 +12,7 @@
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshShaderOptions.h>
 #include <SkinnedMesh/SkinnedMeshShaderOptionsCache.h>
 
+#include <Atom/RHI/Buffer.h>
 #include <Atom/RHI/DispatchItem.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <AtomCore/Instance/Instance.h>
@@ -35,6 +36,7 @@ namespace AZ
     namespace Render
     {
         class SkinnedMeshFeatureProcessor;
+        struct SkinnedMeshBatchEntry;
 
         //! Holds and manages an RHI DispatchItem for a specific skinned mesh, and the resources that are needed to build and maintain it.
         class SkinnedMeshDispatchItem
@@ -71,7 +73,16 @@ namespace AZ
             void Enable();
             void Disable();
             bool IsEnabled() const;
+
+            //! Returns true if the mesh can be skinned by a SkinnedMeshDispatchBatch instead of its own dispatch item,
+            //! which needs bindless views of its input streams and bone transforms.
+            bool IsBatchable() const;
+
+            //! Fills the entry of the mesh in a SkinnedMeshDispatchBatch for a device, except for the first thread.
+            void GetBatchEntry(int deviceIndex, SkinnedMeshBatchEntry& entry) const;
         private:
+            void InitBatchViews();
+
             // SkinnedMeshShaderOptionNotificationBus::Handler
             void OnShaderReinitialized(const CachedSkinnedMeshShaderOptions* cachedShaderOptions) override;
 
@@ -110,6 +121,13 @@ namespace AZ
             // A conservative value for encoding/decoding the accumulated deltas
             float m_morphTargetDeltaIntegerEncoding;
 
+            // Raw views of the whole buffers of the input streams, indexed by SkinnedMeshInputVertexStreams, with the byte offset of
+            // this mesh in each of them. The last view is of the bone transforms.
+            static constexpr uint8_t BatchViewCount = static_cast<uint8_t>(SkinnedMeshInputVertexStreams::NumVertexStreams) + 1;
+            AZStd::array<RHI::Ptr<RHI::BufferView>, BatchViewCount> m_batchViews;
+            AZStd::array<uint32_t, BatchViewCount> m_batchViewByteOffsets = {};
+            bool m_isBatchable = false;
+
             // Skip the skinning dispatch if this is false
             bool m_isEnabled = true;
         };
@@ -6,6 +6,7 @@
  *
  */
 
+#include <Atom/Feature/RayTracing/RayTracingFeatureProcessorInterface.h>
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshFeatureProcessorBus.h>
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshStatsBus.h>
 
@@ -34,6 +35,13 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(bool, r_skinningSkipInvisible, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Skip the skinning of meshes that were culled from every view, except the meshes in the ray tracing scene.");
+        AZ_CVAR(float, r_skinningReducedRateScreenCoverage, 0.05f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Meshes whose largest screen coverage is below this value are skinned at a reduced rate, see r_skinningReducedRateInterval. 0 disables it.");
+        AZ_CVAR(uint32_t, r_skinningReducedRateInterval, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of frames between the skinning updates of meshes that are skinned at a reduced rate.");
+
         const char* SkinnedMeshFeatureProcessor::s_featureProcessorName = "SkinnedMeshFeatureProcessor";
 
         void SkinnedMeshFeatureProcessor::Reflect(ReflectContext* context)
@@ -49,6 +57,7 @@ namespace AZ
         void SkinnedMeshFeatureProcessor::Activate()
         {
             m_statsCollector = AZStd::make_unique<SkinnedMeshStatsCollector>(this);
+            m_positionReadback = AZStd::make_unique<SkinnedMeshPositionReadback>();
 
             EnableSceneNotification();
         }
@@ -57,7 +66,9 @@ namespace AZ
         {
             DisableSceneNotification();
 
+            m_skinningBatch.Shutdown();
             m_statsCollector = nullptr;
+            m_positionReadback = nullptr;
 
             AZ_Warning("SkinnedMeshFeatureProcessor", m_renderProxies.size() == 0,
                 "Deactivaing the SkinnedMeshFeatureProcessor, but there are still outstanding render proxy handles. Components\n"
@@ -66,120 +77,76 @@ namespace AZ
 
         }
 
-        void SkinnedMeshFeatureProcessor::Render(const FeatureProcessor::RenderPacket& packet)
+        // Returns the mask of the lods of the cullable that are selected in any of the views, and the largest screen coverage
+        // of the cullable in those views
+        static uint32_t SelectLods(const RPI::Cullable& cullable, const RPI::FeatureProcessor::RenderPacket& packet, float& outMaxScreenCoverage)
         {
-            AZ_PROFILE_SCOPE(AzRender, "SkinnedMeshFeatureProcessor: Render");
+            outMaxScreenCoverage = 0.0f;
+            uint32_t lodMask = 0;
 
-#if 0 //[GFX_TODO][ATOM-13564] Temporarily disable skinning culling until we figure out how to hook up visibility & lod selection with skinning:
-            //Setup the culling workgroup (it will be re-used for each view)
+            const size_t lodCount = AZStd::min(cullable.m_lodData.m_lods.size(), RPI::ModelLodAsset::LodCountMax);
+            for (const RPI::ViewPtr& viewPtr : packet.m_views)
             {
-                AZ_PROFILE_SCOPE(AzRender, "set up skinned culling workgroup");
-                azsnprintf(m_workgroup.m_name, AZ_ARRAY_SIZE(m_workgroup.m_name), "SkinnedMeshFP workgroup");
-                m_workgroup.m_drawListMask.reset();
-                m_workgroup.m_cullPackets.clear();
-                m_lodPackets.clear();
-                m_potentiallyVisibleProxies.clear();
-
-                for (SkinnedMeshRenderProxy& renderProxy : m_renderProxies)
+                const RPI::View* view = viewPtr.get();
+                const Matrix4x4& viewToClip = view->GetViewToClipMatrix();
+
+                //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
+                //which is used to determine the (vertical) projected size in screen space
+                const float yScale = viewToClip.GetElement(1, 1);
+                const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+                const Vector3 cameraPos = view->GetViewToWorldMatrix().GetTranslation();
+
+                const Vector3 pos = cullable.m_cullData.m_boundingSphere.GetCenter();
+
+                const float approxScreenPercentage = RPI::ModelLodUtils::ApproxScreenPercentage(
+                    pos, cullable.m_lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
+                outMaxScreenCoverage = AZStd::max(outMaxScreenCoverage, approxScreenPercentage);
+
+                if (cullable.m_lodData.m_lodConfiguration.m_lodType == RPI::Cullable::LodType::SpecificLod)
                 {
-                    renderProxy.m_isQueuedForCompile = false;
-                    
-                    if (renderProxy.m_inputBuffers->GetModel()->IsUploadPending())
+                    if (cullable.m_lodData.m_lodConfiguration.m_lodOverride < lodCount)
                     {
-                        renderProxy.m_inputBuffers->GetModel()->WaitForUpload();
+                        lodMask |= 1u << cullable.m_lodData.m_lodConfiguration.m_lodOverride;
                     }
+                    continue;
+                }
+
+                for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
+                {
+                    const RPI::Cullable::LodData::Lod& lod = cullable.m_lodData.m_lods[lodIndex];
 
-                    if (renderProxy.m_instance->m_model->IsUploadPending())
+                    //Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
+                    if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                     {
-                        renderProxy.m_instance->m_model->WaitForUpload();
+                        lodMask |= 1u << lodIndex;
                     }
-
-                    //Note: we are creating pointers to the modelDataInstance cullpacket and lod packet here,
-                    //and holding them until the skinnedMeshDispatchItems are dispatched. There is an assumption that the underlying
-                    //data will not move during this phase.
-                    ModelDataInstance& modelDataInstance = **renderProxy.m_meshHandle;
-                    m_workgroup.m_cullPackets.push_back(&modelDataInstance.GetCullPacket());
-                    m_workgroup.m_drawListMask |= modelDataInstance.GetCullPacket().m_drawListMask;
-                    m_lodPackets.push_back(&modelDataInstance.GetLodPacket());
-                    m_potentiallyVisibleProxies.push_back(&renderProxy);
                 }
             }
+            return lodMask;
+        }
 
-            if (m_workgroup.m_cullPackets.size() > 0)
-            {
-                RPI::CullingSystem* cullingSystem = packet.m_cullingSystem;
-                Job* currentJob = JobContext::GetGlobalContext()->GetJobManager().GetCurrentJob();
+        void SkinnedMeshFeatureProcessor::OnEndCulling(const FeatureProcessor::RenderPacket& packet)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "SkinnedMeshFeatureProcessor: OnEndCulling");
 
-                //Dispatch the workgroup to each view
-                for (const RPI::ViewPtr& viewPtr : packet.m_views)
-                {
-                    Job* processWorkgroupJob = AZ::CreateJobFunction(
-                        [this, cullingSystem, viewPtr](AZ::Job& thisJob)
-                        {
-                            AZ_PROFILE_SCOPE(AzRender, "skinningMeshFP processWorkgroupJob - View: %s", viewPtr->GetName().GetCStr());
-
-                            auto dispatchSkinningComputeProgramsCallback = [this](AZStd::shared_ptr<RPI::CullingBatchResults> results) -> void
-                            {
-                                AZ_PROFILE_SCOPE(AzRender, "dispatchSkinningComputePrograms");
-
-                                //the [1][1] element of a projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
-                                //which is used to determine the (vertical) projected size in screen space            
-                                const float yScale = results->m_viewPtr->GetViewToClipMatrix().GetRow(1).GetY();
-                                const Vector3 cameraPos = results->m_viewPtr->GetViewToWorldMatrix().GetTranslation();
-                                const bool isPerspective = (results->m_viewPtr->GetViewToClipMatrix().GetElement(3, 3) == 0.f);
-
-                                for (size_t v = 0, numVisibleItems = results->m_visibleItems.size(); v < numVisibleItems; ++v)
-                                {
-                                    uint8_t relativeIndex = results->m_visibleItems[v];
-                                    uint32_t itemIndex = results->m_rangeFirst + relativeIndex;
-                                    const RPI::LodPacket* lodPacket = m_lodPackets[itemIndex];
-                                    Vector3 pos = m_workgroup.m_cullPackets[itemIndex]->m_boundingSphere.GetCenter();
-                                    SkinnedMeshRenderProxy* renderProxy = m_potentiallyVisibleProxies[itemIndex];
-
-                                    const float approxScreenPercentage = RPI::ModelLodUtils::ApproxScreenPercentage(
-                                        pos, lodPacket->m_lodSelectionRadius, cameraPos, yScale, isPerspective);
-
-                                    for (size_t lodIndex = 0, numLods = lodPacket->m_lods.size(); lodIndex < numLods; ++lodIndex)
-                                    {
-                                        const RPI::LodPacket::Lod& lod = lodPacket->m_lods[lodIndex];
-
-                                        //Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
-                                        float minScreenPercentage(lod.m_range.m_min);
-                                        float maxScreenPercentage(lod.m_range.m_max);
-                                        if (approxScreenPercentage >= minScreenPercentage && approxScreenPercentage <= maxScreenPercentage)
-                                        {
-                                            AZStd::lock_guard lock(m_dispatchItemMutex);
-                                            for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
-                                            {
-                                                // Add one skinning dispatch item for each mesh in the lod
-                                                if (skinnedMeshDispatchItem->IsEnabled())
-                                                {
-                                                    m_skinningDispatches.insert(skinnedMeshDispatchItem->GetRHIDispatchItem());
-                                                }
-                                            }
-                                            
-                                            for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy->m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                                            {
-                                                const MorphTargetDispatchItem* dispatchItem = renderProxy->m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                                if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                                                {
-                                                    m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                                                }
-                                            }
-                                        }
-                                    }
-                                }
-                            };
-
-                            cullingSystem->DispatchCullingWorkgroup(viewPtr, m_workgroup, &thisJob, dispatchSkinningComputeProgramsCallback);
-                        },
-                        true, nullptr); //auto-deletes
-
-                    currentJob->SetContinuation(processWorkgroupJob);
-                    processWorkgroupJob->Start();
-                }
+            // This runs after culling, so the visibility of the meshes is the one of this frame
+            ++m_frameIndex;
+
+            // Meshes in the ray tracing scene are skinned even when they aren't visible, since they can still be hit by rays
+            MeshFeatureProcessor* meshFeatureProcessor = nullptr;
+            if (auto* rayTracingFeatureProcessor = GetParentScene()->GetFeatureProcessor<RayTracingFeatureProcessorInterface>();
+                rayTracingFeatureProcessor && rayTracingFeatureProcessor->HasMeshGeometry())
+            {
+                meshFeatureProcessor = GetParentScene()->GetFeatureProcessor<MeshFeatureProcessor>();
             }
-#else  //[GFX_TODO][ATOM-13564] This is a temporary implementation that submits all of the skinning compute shaders without any culling:
+
+            const bool batchDispatches = r_skinningBatchDispatches && m_skinningBatch.IsInitialized();
+            const float reducedRateScreenCoverage = r_skinningReducedRateScreenCoverage;
+            const uint32_t reducedRateInterval = AZStd::max(static_cast<uint32_t>(r_skinningReducedRateInterval), 1u);
+
+            AZStd::lock_guard lock(m_dispatchItemMutex);
+            m_batchedSkinningItems.clear();
+
             for (SkinnedMeshRenderProxy& renderProxy : m_renderProxies)
             {
                 if (renderProxy.m_inputBuffers->GetModel()->IsUploadPending())
@@ -193,94 +160,72 @@ namespace AZ
                 }
 
                 ModelDataInstance& modelDataInstance = **renderProxy.m_meshHandle;
-                const RPI::Cullable& cullable = modelDataInstance.GetCullable();
+                const bool isVisible = modelDataInstance.ConsumeVisibility();
+                const bool isRayTraced = meshFeatureProcessor && meshFeatureProcessor->GetRayTracingEnabled(*renderProxy.m_meshHandle);
+                if (r_skinningSkipInvisible && !isVisible && !isRayTraced)
+                {
+                    // Skin it as soon as it becomes visible again, so it doesn't show a stale pose
+                    renderProxy.m_lastSkinnedLodMask = 0;
+                    continue;
+                }
+
+                float maxScreenCoverage = 0.0f;
+                const uint32_t lodMask = SelectLods(modelDataInstance.GetCullable(), packet, maxScreenCoverage);
 
-                for (const RPI::ViewPtr& viewPtr : packet.m_views)
+                // Small meshes are only skinned every few frames, and keep their last skinned pose in between. The lod change check
+                // makes sure a newly selected lod is skinned before it is drawn. Note the position history used for the motion
+                // vectors is only updated on the frames the mesh is skinned.
+                if (lodMask == renderProxy.m_lastSkinnedLodMask && maxScreenCoverage < reducedRateScreenCoverage &&
+                    (m_frameIndex + renderProxy.m_skinningFrameOffset) % reducedRateInterval != 0)
                 {
-                    RPI::View* view = viewPtr.get();
-                    const Matrix4x4& viewToClip = view->GetViewToClipMatrix();
-
-                    //[GFX_TODO][ATOM-13564]:
-                    // Option 1)
-                    //  store the lastVisibleFrameIndex and lowestLodIndex (or a bitfield of the visible lods) on the Cullable,
-                    //  ** run this code *after* culling is done **, use the cached info to decide what to dispatch here
-                    // Option 2)
-                    //  add a separate visibility entry for each skinned object to the IVisibilitySystem (with a different type flag),
-                    //  ensure the entries are kept in sync with the corresponding mesh entry
-                    //  do the enumeration for each view, keep track of the lowest lod for each entry,
-                    //  and submit the appropriate dispatch item
-
-                    switch (cullable.m_lodData.m_lodConfiguration.m_lodType)
+                    continue;
+                }
+                renderProxy.m_lastSkinnedLodMask = lodMask;
+
+                for (size_t lodIndex = 0; lodIndex < renderProxy.m_dispatchItemsByLod.size(); ++lodIndex)
+                {
+                    if (lodMask & (1u << lodIndex))
                     {
-                    case RPI::Cullable::LodType::SpecificLod:
+                        AddDispatchItems(renderProxy, lodIndex, batchDispatches);
+                    }
+                }
+            }
+
+            if (!m_batchedSkinningItems.empty() && m_skinningBatch.Update(m_batchedSkinningItems))
+            {
+                m_skinningDispatches.insert(&m_skinningBatch.GetRHIDispatchItem());
+            }
+        }
+
+        void SkinnedMeshFeatureProcessor::AddDispatchItems(const SkinnedMeshRenderProxy& renderProxy, size_t lodIndex, bool batchDispatches)
+        {
+            for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
+            {
+                // Add one skinning dispatch item for each mesh in the lod, or an entry of the batch
+                if (skinnedMeshDispatchItem->IsEnabled())
+                {
+                    if (batchDispatches && skinnedMeshDispatchItem->IsBatchable())
                     {
-                        AZStd::lock_guard lock(m_dispatchItemMutex);
-                        auto lodIndex = cullable.m_lodData.m_lodConfiguration.m_lodOverride;
-                        
-                        for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
-                        {
-                            // Add one skinning dispatch item for each mesh in the lod
-                            if (skinnedMeshDispatchItem->IsEnabled())
-                            {
-                                m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
-                            }
-                        }
-                        
-                        for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                        {
-                            const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                            if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                            {
-                                m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                            }
-                        }
+                        m_batchedSkinningItems.push_back(skinnedMeshDispatchItem.get());
                     }
-                    break;
-                    case RPI::Cullable::LodType::ScreenCoverage:
-                    default:
-                        //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
-                        //which is used to determine the (vertical) projected size in screen space
-                        const float yScale = viewToClip.GetElement(1, 1);
-                        const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
-                        const Vector3 cameraPos = view->GetViewToWorldMatrix().GetTranslation();
-
-                        const Vector3 pos = cullable.m_cullData.m_boundingSphere.GetCenter();
-
-                        const float approxScreenPercentage = RPI::ModelLodUtils::ApproxScreenPercentage(
-                            pos, cullable.m_lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
-
-                        for (size_t lodIndex = 0; lodIndex < cullable.m_lodData.m_lods.size(); ++lodIndex)
-                        {
-                            const RPI::Cullable::LodData::Lod& lod = cullable.m_lodData.m_lods[lodIndex];
-
-                            //Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
-                            if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
-                            {
-                                AZStd::lock_guard lock(m_dispatchItemMutex);
-                                for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
-                                {
-                                    // Add one skinning dispatch item for each mesh in the lod
-                                    if (skinnedMeshDispatchItem->IsEnabled())
-                                    {
-                                        m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
-                                    }
-                                }
-
-                                for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                                {
-                                    const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                    if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                                    {
-                                        m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                                    }
-                                }
-                            }
-                        }
-                        break;
+                    else
+                    {
+                        m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
+                    }
+                }
+            }
+
+            // The morph targets are skipped along with the skinning, since the skinning consumes the deltas they accumulate
+            if (lodIndex < renderProxy.m_morphTargetDispatchItemsByLod.size())
+            {
+                for (const AZStd::unique_ptr<MorphTargetDispatchItem>& morphTargetDispatchItem : renderProxy.m_morphTargetDispatchItemsByLod[lodIndex])
+                {
+                    if (morphTargetDispatchItem && morphTargetDispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
+                    {
+                        m_morphTargetDispatches.insert(&morphTargetDispatchItem->GetRHIDispatchItem());
                     }
                 }
             }
-#endif
         }
 
         void SkinnedMeshFeatureProcessor::OnRenderPipelineChanged(RPI::RenderPipeline* renderPipeline,
@@ -322,6 +267,10 @@ namespace AZ
             {
                 m_renderProxies.erase(handle);
             }
+            else
+            {
+                handle->m_skinningFrameOffset = m_nextSkinningFrameOffset++;
+            }
             return handle;
         }
 
@@ -369,6 +318,38 @@ namespace AZ
             }
         }
 
+        void SkinnedMeshFeatureProcessor::ReadbackSkinnedPositions(
+            const SkinnedMeshHandle& handle, uint32_t lodIndex, uint32_t meshIndex, SkinnedPositionsCallback callback)
+        {
+            if (!handle.IsValid() || !m_positionReadback)
+            {
+                callback({});
+                return;
+            }
+
+            const SkinnedMeshInstance& instance = *handle->m_instance;
+            if (lodIndex >= instance.m_outputStreamOffsetsInBytes.size() || meshIndex >= instance.m_outputStreamOffsetsInBytes[lodIndex].size() ||
+                !instance.IsSkinningEnabled(lodIndex, meshIndex))
+            {
+                AZ_Warning("SkinnedMeshFeatureProcessor", false, "Mesh %u of lod %u isn't skinned, its positions can't be read back.", meshIndex, lodIndex);
+                callback({});
+                return;
+            }
+
+            const uint32_t byteOffset =
+                instance.m_outputStreamOffsetsInBytes[lodIndex][meshIndex][static_cast<uint8_t>(SkinnedMeshOutputVertexStreams::Position)];
+            const uint32_t vertexCount = handle->m_inputBuffers->GetVertexCount(lodIndex, meshIndex);
+            m_positionReadback->AddRequest(handle->m_instance, byteOffset, vertexCount, AZStd::move(callback));
+        }
+
+        void SkinnedMeshFeatureProcessor::AddPositionReadbackScope(RPI::Pass::FramePrepareParams params, const RHI::BufferScopeAttachmentDescriptor& outputStream)
+        {
+            if (m_positionReadback)
+            {
+                m_positionReadback->FrameBegin(params, outputStream);
+            }
+        }
+
         void SkinnedMeshFeatureProcessor::InitSkinningAndMorphPass(RPI::RenderPipeline* renderPipeline)
         {
             RPI::PassFilter skinPassFilter = RPI::PassFilter::CreateWithPassName(AZ::Name{ "SkinningPass" }, renderPipeline);
@@ -388,6 +369,7 @@ namespace AZ
                 else
                 {
                     m_cachedSkinningShaderOptions.SetShader(m_skinningShader);
+                    InitSkinningBatch();
                 }
             }
 
@@ -418,6 +400,19 @@ namespace AZ
         {
             m_skinningShader = skinningShader;
             m_cachedSkinningShaderOptions.SetShader(m_skinningShader);
+            InitSkinningBatch();
+        }
+
+        void SkinnedMeshFeatureProcessor::InitSkinningBatch()
+        {
+            AZStd::lock_guard lock(m_dispatchItemMutex);
+
+            // Without the batch, every mesh is skinned by its own dispatch
+            if (!m_skinningBatch.Init(m_skinningShader))
+            {
+                AZ_Warning(s_featureProcessorName, !r_skinningBatchDispatches,
+                    "The skinning shader doesn't support batched dispatches on this device, each mesh is skinned with its own dispatch.");
+            }
         }
 
         void SkinnedMeshFeatureProcessor::SetupSkinningScope(RHI::FrameGraphInterface frameGraph)
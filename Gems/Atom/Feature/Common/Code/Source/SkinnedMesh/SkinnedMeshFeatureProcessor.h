@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <SkinnedMesh/SkinnedMeshDispatchBatch.h>
+#include <SkinnedMesh/SkinnedMeshPositionReadback.h>
 #include <SkinnedMesh/SkinnedMeshRenderProxy.h>
 #include <SkinnedMesh/SkinnedMeshStatsCollector.h>
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshFeatureProcessorInterface.h>
@@ -49,7 +51,7 @@ namespace AZ
             // FeatureProcessor overrides ...
             void Activate() override;
             void Deactivate() override;
-            void Render(const FeatureProcessor::RenderPacket& packet) override;
+            void OnEndCulling(const FeatureProcessor::RenderPacket& packet) override;
             void OnRenderEnd() override;
 
             // RPI::SceneNotificationBus overrides ...
@@ -63,12 +65,15 @@ namespace AZ
             void SetMorphTargetWeights(const SkinnedMeshHandle& handle, uint32_t lodIndex, const AZStd::vector<float>& weights) override;
             void EnableSkinning(const SkinnedMeshHandle& handle, uint32_t lodIndex, uint32_t meshIndex) override;
             void DisableSkinning(const SkinnedMeshHandle& handle, uint32_t lodIndex, uint32_t meshIndex) override;
+            void ReadbackSkinnedPositions(const SkinnedMeshHandle& handle, uint32_t lodIndex, uint32_t meshIndex, SkinnedPositionsCallback callback) override;
 
             Data::Instance<RPI::Shader> GetSkinningShader() const;
             RPI::ShaderOptionGroup CreateSkinningShaderOptionGroup(const SkinnedMeshShaderOptions shaderOptions, SkinnedMeshShaderOptionNotificationBus::Handler& shaderReinitializedHandler);
             void OnSkinningShaderReinitialized(const Data::Instance<RPI::Shader> skinningShader);
             void SubmitSkinningDispatchItems(const RHI::FrameGraphExecuteContext& context, uint32_t startIndex, uint32_t endIndex);
             void SetupSkinningScope(RHI::FrameGraphInterface frameGraph);
+            //! Adds the scope copying the requested skinned positions back, after the skinning pass added its scope
+            void AddPositionReadbackScope(RPI::Pass::FramePrepareParams params, const RHI::BufferScopeAttachmentDescriptor& outputStream);
 
             Data::Instance<RPI::Shader> GetMorphTargetShader() const;
             void SubmitMorphTargetDispatchItems(const RHI::FrameGraphExecuteContext& context, uint32_t startIndex, uint32_t endIndex);
@@ -78,6 +83,9 @@ namespace AZ
             AZ_DISABLE_COPY_MOVE(SkinnedMeshFeatureProcessor);
 
             void InitSkinningAndMorphPass(RPI::RenderPipeline* renderPipeline);
+            void InitSkinningBatch();
+
+            void AddDispatchItems(const SkinnedMeshRenderProxy& renderProxy, size_t lodIndex, bool batchDispatches);
 
             static const char* s_featureProcessorName;
 
@@ -89,8 +97,12 @@ namespace AZ
             AZStd::concurrency_checker m_renderProxiesChecker;
             StableDynamicArray<SkinnedMeshRenderProxy> m_renderProxies;
             AZStd::unique_ptr<SkinnedMeshStatsCollector> m_statsCollector;
+            AZStd::unique_ptr<SkinnedMeshPositionReadback> m_positionReadback;
 
             AZStd::unordered_set<const RHI::DispatchItem*> m_skinningDispatches;
+            SkinnedMeshDispatchBatch m_skinningBatch;
+            //! The skinning dispatch items of this frame that are skinned by m_skinningBatch instead of their own dispatch
+            AZStd::vector<const SkinnedMeshDispatchItem*> m_batchedSkinningItems;
             bool m_alreadyCreatedSkinningScopeThisFrame = false;
 
             AZStd::unordered_set<const RHI::DispatchItem*> m_morphTargetDispatches;
@@ -98,6 +110,10 @@ namespace AZ
 
             AZStd::mutex m_dispatchItemMutex;
 
+            uint32_t m_frameIndex = 0;
+            //! Staggers the frames the render proxies are skinned on when they are skinned at a reduced rate
+            uint32_t m_nextSkinningFrameOffset = 0;
+
         };
     } // namespace Render
 } // namespace AZ
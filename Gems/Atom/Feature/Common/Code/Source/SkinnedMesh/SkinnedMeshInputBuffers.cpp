@@ -349,6 +349,9 @@ namespace AZ
 
             if (m_model)
             {
+                // Skinning reads the input streams of every lod
+                m_model->DisableLodStreaming();
+
                 m_lods.resize(m_model->GetLodCount());
                 for (uint32_t lodIndex = 0; lodIndex < m_model->GetLodCount(); ++lodIndex)
                 {
@@ -429,6 +432,13 @@ namespace AZ
             }
         }
 
+        const AZStd::vector<SkinnedSubMeshProperties::SrgNameViewPair>& SkinnedMeshInputBuffers::GetInputBufferViews(
+            uint32_t lodIndex, uint32_t meshIndex) const
+        {
+            AZ_Assert(lodIndex < m_lods.size() && meshIndex < m_lods[lodIndex].m_meshes.size(), "Lod %" PRIu32 " Mesh %" PRIu32 " out of range for model '%s'", lodIndex, meshIndex, m_modelAsset->GetName().GetCStr());
+            return m_lods[lodIndex].m_meshes[meshIndex].m_inputBufferViews;
+        }
+
         void SkinnedMeshInputBuffers::SetBufferViewsOnShaderResourceGroup(
             uint32_t lodIndex, uint32_t meshIndex, const Data::Instance<RPI::ShaderResourceGroup>& perInstanceSRG)
         {
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <SkinnedMesh/SkinnedMeshPositionReadback.h>
+
+#include <Atom/Feature/SkinnedMesh/SkinnedMeshInstance.h>
+
+#include <Atom/RHI/CommandList.h>
+#include <Atom/RHI/FrameGraphBuilder.h>
+#include <Atom/RHI/FrameGraphCompileContext.h>
+#include <Atom/RHI/FrameGraphExecuteContext.h>
+#include <Atom/RHI/FrameGraphInterface.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+
+#include <AzCore/Math/PackedVector3.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        SkinnedMeshPositionReadback::SkinnedMeshPositionReadback()
+        {
+            m_fence = aznew RHI::Fence;
+            [[maybe_unused]] RHI::ResultCode result = m_fence->Init(RHI::MultiDevice::AllDevices, RHI::FenceState::Reset);
+            AZ_Error("SkinnedMeshPositionReadback", result == RHI::ResultCode::Success, "Failed to initialize the readback fence");
+
+            m_copyScopeProducer = AZStd::make_shared<RHI::ScopeProducerFunctionNoData>(
+                RHI::ScopeId{ "SkinnedMeshPositionReadback" },
+                AZStd::bind(&SkinnedMeshPositionReadback::CopyPrepare, this, AZStd::placeholders::_1),
+                AZStd::bind(&SkinnedMeshPositionReadback::CopyCompile, this, AZStd::placeholders::_1),
+                AZStd::bind(&SkinnedMeshPositionReadback::CopyExecute, this, AZStd::placeholders::_1));
+        }
+
+        SkinnedMeshPositionReadback::~SkinnedMeshPositionReadback()
+        {
+            // The fence callback of a submitted copy uses this object
+            bool isCopySubmitted = false;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                isCopySubmitted = m_isCopySubmitted;
+            }
+            if (isCopySubmitted)
+            {
+                m_fence->GetDeviceFence(m_copyDeviceIndex)->WaitOnCpu();
+            }
+            m_fence = nullptr;
+        }
+
+        void SkinnedMeshPositionReadback::AddRequest(AZStd::intrusive_ptr<SkinnedMeshInstance> instance, uint32_t byteOffset, uint32_t vertexCount,
+            SkinnedMeshFeatureProcessorInterface::SkinnedPositionsCallback callback)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            Request& request = m_queuedRequests.emplace_back();
+            request.m_instance = AZStd::move(instance);
+            request.m_byteOffset = byteOffset;
+            request.m_vertexCount = vertexCount;
+            request.m_callback = AZStd::move(callback);
+        }
+
+        void SkinnedMeshPositionReadback::FrameBegin(RPI::Pass::FramePrepareParams params, const RHI::BufferScopeAttachmentDescriptor& outputStream)
+        {
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                if (m_isReadbackInFlight || m_queuedRequests.empty())
+                {
+                    return;
+                }
+
+                m_inFlightRequests.swap(m_queuedRequests);
+                m_isReadbackInFlight = true;
+            }
+
+            m_outputStream = outputStream;
+            params.m_frameGraphBuilder->ImportScopeProducer(*m_copyScopeProducer);
+        }
+
+        void SkinnedMeshPositionReadback::CopyPrepare(RHI::FrameGraphInterface frameGraph)
+        {
+            // Reading the output stream attachment orders the copy after the skinning pass, which writes it
+            frameGraph.UseCopyAttachment(m_outputStream, RHI::ScopeAttachmentAccess::Read);
+            frameGraph.SetEstimatedItemCount(static_cast<uint32_t>(m_inFlightRequests.size()));
+            frameGraph.SignalFence(*m_fence);
+        }
+
+        void SkinnedMeshPositionReadback::CopyCompile(const RHI::FrameGraphCompileContext& context)
+        {
+            const RHI::Buffer* outputStreamBuffer = context.GetBuffer(m_outputStream.m_attachmentId);
+            for (Request& request : m_inFlightRequests)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadBack;
+                desc.m_bufferName = "SkinnedMeshPositionReadback";
+                desc.m_byteCount = request.m_vertexCount * sizeof(PackedVector3f);
+                request.m_readbackBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                if (!request.m_readbackBuffer || !outputStreamBuffer)
+                {
+                    continue;
+                }
+
+                RHI::CopyBufferDescriptor copyBuffer;
+                copyBuffer.m_sourceBuffer = outputStreamBuffer;
+                copyBuffer.m_sourceOffset = request.m_byteOffset;
+                copyBuffer.m_destinationBuffer = request.m_readbackBuffer->GetRHIBuffer();
+                copyBuffer.m_size = aznumeric_cast<uint32_t>(desc.m_byteCount);
+                request.m_copyItem = copyBuffer;
+            }
+        }
+
+        void SkinnedMeshPositionReadback::CopyExecute(const RHI::FrameGraphExecuteContext& context)
+        {
+            const int deviceIndex = context.GetDeviceIndex();
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                m_isCopySubmitted = true;
+                m_copyDeviceIndex = deviceIndex;
+            }
+
+            for (const Request& request : m_inFlightRequests)
+            {
+                if (request.m_readbackBuffer)
+                {
+                    context.GetCommandList()->Submit(request.m_copyItem.GetDeviceCopyItem(deviceIndex));
+                }
+            }
+
+            m_fence->GetDeviceFence(deviceIndex)->WaitOnCpuAsync(
+                [this, deviceIndex]()
+                {
+                    FinishReadback(deviceIndex);
+                });
+        }
+
+        void SkinnedMeshPositionReadback::FinishReadback(int deviceIndex)
+        {
+            for (Request& request : m_inFlightRequests)
+            {
+                AZStd::vector<Vector3> positions;
+                if (request.m_readbackBuffer)
+                {
+                    const size_t byteCount = request.m_vertexCount * sizeof(PackedVector3f);
+                    const auto mappedData = request.m_readbackBuffer->Map(byteCount, 0);
+                    const auto mappedDataIt = mappedData.find(deviceIndex);
+                    if (mappedDataIt != mappedData.end() && mappedDataIt->second)
+                    {
+                        const PackedVector3f* packedPositions = static_cast<const PackedVector3f*>(mappedDataIt->second);
+                        positions.reserve(request.m_vertexCount);
+                        for (uint32_t i = 0; i < request.m_vertexCount; ++i)
+                        {
+                            positions.emplace_back(Vector3(packedPositions[i]));
+                        }
+                    }
+                    request.m_readbackBuffer->Unmap();
+                }
+
+                AZ_Warning("SkinnedMeshPositionReadback", !positions.empty(), "Failed to read back the skinned positions of a mesh");
+                if (request.m_callback)
+                {
+                    request.m_callback(AZStd::move(positions));
+                }
+            }
+
+            m_inFlightRequests.clear();
+            m_fence->Reset();
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_isReadbackInFlight = false;
+            m_isCopySubmitted = false;
+        }
+    } // namespace Render
+} // namespace AZ
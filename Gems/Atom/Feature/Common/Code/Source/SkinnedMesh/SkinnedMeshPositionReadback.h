@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Feature/SkinnedMesh/SkinnedMeshFeatureProcessorInterface.h>
+
+#include <Atom/RHI/CopyItem.h>
+#include <Atom/RHI/Fence.h>
+#include <Atom/RHI/ScopeProducerFunction.h>
+#include <Atom/RHI.Reflect/BufferScopeAttachmentDescriptor.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Pass/Pass.h>
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        class SkinnedMeshInstance;
+
+        //! Copies the skinned positions of meshes from the skinned mesh output stream back to the CPU.
+        //! The copies of all the requests made during a frame are done by one copy scope after the skinning pass. The callbacks are
+        //! called once the GPU finished the copies, while the next requests wait for that.
+        class SkinnedMeshPositionReadback final
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(SkinnedMeshPositionReadback, SystemAllocator);
+
+            SkinnedMeshPositionReadback();
+            ~SkinnedMeshPositionReadback();
+
+            //! Queues the readback of vertexCount positions stored at byteOffset in the skinned mesh output stream.
+            //! The instance keeps the memory of the positions allocated until the readback is done.
+            void AddRequest(AZStd::intrusive_ptr<SkinnedMeshInstance> instance, uint32_t byteOffset, uint32_t vertexCount,
+                SkinnedMeshFeatureProcessorInterface::SkinnedPositionsCallback callback);
+
+            //! Adds the copy scope to the frame graph in case there are queued requests and no readback is in progress.
+            //! Must be called after the skinning pass added its scope, so the copy happens after the skinning of this frame.
+            //! @param outputStream The skinned mesh output stream attachment of the skinning pass.
+            void FrameBegin(RPI::Pass::FramePrepareParams params, const RHI::BufferScopeAttachmentDescriptor& outputStream);
+
+        private:
+            struct Request
+            {
+                AZStd::intrusive_ptr<SkinnedMeshInstance> m_instance;
+                uint32_t m_byteOffset = 0;
+                uint32_t m_vertexCount = 0;
+                SkinnedMeshFeatureProcessorInterface::SkinnedPositionsCallback m_callback;
+                Data::Instance<RPI::Buffer> m_readbackBuffer;
+                RHI::CopyItem m_copyItem;
+            };
+
+            // Scope producer functions for the copy
+            void CopyPrepare(RHI::FrameGraphInterface frameGraph);
+            void CopyCompile(const RHI::FrameGraphCompileContext& context);
+            void CopyExecute(const RHI::FrameGraphExecuteContext& context);
+
+            // Reads the positions from the readback buffers and calls the callbacks, once the fence is signaled
+            void FinishReadback(int deviceIndex);
+
+            AZStd::shared_ptr<RHI::ScopeProducer> m_copyScopeProducer;
+            RHI::Ptr<RHI::Fence> m_fence;
+            RHI::BufferScopeAttachmentDescriptor m_outputStream;
+
+            AZStd::mutex m_mutex;
+            //! The requests waiting for the next copy scope
+            AZStd::vector<Request> m_queuedRequests;
+            //! The requests copied by the copy scope in flight, only used by the copy scope and the fence callback
+            AZStd::vector<Request> m_inFlightRequests;
+            bool m_isReadbackInFlight = false;
+            bool m_isCopySubmitted = false;
+            int m_copyDeviceIndex = RHI::MultiDevice::DefaultDeviceIndex;
+        };
+    } // namespace Render
+} // namespace AZ
@@ -63,6 +63,11 @@ namespace AZ
             Data::Instance<RPI::Buffer> m_boneTransforms;
 
             SkinnedMeshFeatureProcessor* m_featureProcessor = nullptr;
+
+            //! The mask of the lods that were skinned the last time the render proxy was skinned, or 0 if it wasn't skinned last frame
+            uint32_t m_lastSkinnedLodMask = 0;
+            //! Offsets the frames this render proxy is skinned on when it is skinned at a reduced rate
+            uint32_t m_skinningFrameOffset = 0;
         };
     } // namespace Render
 } // namespace AZ
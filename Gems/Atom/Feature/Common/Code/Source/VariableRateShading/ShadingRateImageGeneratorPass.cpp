@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <VariableRateShading/ShadingRateImageGeneratorPass.h>
+
+#include <AzCore/Math/MathUtils.h>
+
+#include <Atom/RHI/CommandList.h>
+#include <Atom/RHI/Device.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RHI.Reflect/Bits.h>
+
+#include <Atom/RPI.Public/Pass/PassAttachment.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <PostProcess/PostProcessFeatureProcessor.h>
+#include <PostProcess/DepthOfField/DepthOfFieldSettings.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        // Used when the device doesn't report a tile size, matches the most common hardware tile size
+        static const uint32_t DefaultShadingRateTileSize = 16;
+
+        // Rates per axis are 1, 2 or 4 pixels, indexed by their log2
+        static const uint32_t ShadingRateLog2Count = 3;
+
+        RPI::Ptr<ShadingRateImageGeneratorPass> ShadingRateImageGeneratorPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<ShadingRateImageGeneratorPass> pass = aznew ShadingRateImageGeneratorPass(descriptor);
+            return AZStd::move(pass);
+        }
+
+        ShadingRateImageGeneratorPass::ShadingRateImageGeneratorPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        {
+            RHI::Device* device = RHI::RHISystemInterface::Get()->GetDevice();
+            const RHI::DeviceFeatures& features = device->GetFeatures();
+            m_supported = RHI::CheckBitsAll(features.m_shadingRateTypeMask, RHI::ShadingRateTypeFlags::PerRegion);
+            if (!m_supported)
+            {
+                return;
+            }
+
+            m_tileSize = device->GetLimits().m_shadingRateTileSize;
+            if (m_tileSize.m_width == 0 || m_tileSize.m_height == 0)
+            {
+                m_tileSize = RHI::Size(DefaultShadingRateTileSize, DefaultShadingRateTileSize, 1);
+            }
+
+            // The shader selects a rate per axis, and looks up how the device encodes it in the image.
+            // Only the single component encodings of the shading rate attachments are written, devices
+            // encoding the rates in two components (density maps) don't use the generated image.
+            if (device->ConvertShadingRate(RHI::ShadingRate::Rate2x2).m_y != 0)
+            {
+                m_supported = false;
+                return;
+            }
+
+            for (uint32_t log2Y = 0; log2Y < ShadingRateLog2Count; ++log2Y)
+            {
+                for (uint32_t log2X = 0; log2X < ShadingRateLog2Count; ++log2X)
+                {
+                    const RHI::ShadingRate rate = GetNearestSupportedRate(features.m_shadingRateMask, log2X, log2Y);
+                    const RHI::ShadingRateImageValue value = device->ConvertShadingRate(rate);
+                    m_shadingRateValues[log2Y * ShadingRateLog2Count + log2X] = { value.m_x, value.m_y, 0, 0 };
+                }
+            }
+        }
+
+        RHI::ShadingRate ShadingRateImageGeneratorPass::GetNearestSupportedRate(
+            RHI::ShadingRateFlags supportedRates, uint32_t log2X, uint32_t log2Y)
+        {
+            struct RateSize
+            {
+                RHI::ShadingRate m_rate;
+                uint32_t m_log2X;
+                uint32_t m_log2Y;
+            };
+
+            // Ordered from the coarsest to the finest rate
+            static const RateSize rates[] = {
+                { RHI::ShadingRate::Rate4x4, 2, 2 },
+                { RHI::ShadingRate::Rate4x2, 2, 1 },
+                { RHI::ShadingRate::Rate2x4, 1, 2 },
+                { RHI::ShadingRate::Rate2x2, 1, 1 },
+                { RHI::ShadingRate::Rate4x1, 2, 0 },
+                { RHI::ShadingRate::Rate1x4, 0, 2 },
+                { RHI::ShadingRate::Rate2x1, 1, 0 },
+                { RHI::ShadingRate::Rate1x2, 0, 1 },
+            };
+
+            for (const RateSize& rateSize : rates)
+            {
+                const auto rateFlag = static_cast<RHI::ShadingRateFlags>(AZ_BIT(static_cast<uint32_t>(rateSize.m_rate)));
+                if (rateSize.m_log2X <= log2X && rateSize.m_log2Y <= log2Y && RHI::CheckBitsAll(supportedRates, rateFlag))
+                {
+                    return rateSize.m_rate;
+                }
+            }
+            return RHI::ShadingRate::Rate1x1;
+        }
+
+        bool ShadingRateImageGeneratorPass::IsEnabled() const
+        {
+            return m_supported && ComputePass::IsEnabled();
+        }
+
+        void ShadingRateImageGeneratorPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            // The shading rate image has a texel per tile of the color input
+            const RPI::PassAttachment* colorAttachment = GetInputBinding(0).GetAttachment().get();
+            RPI::PassAttachment* outputAttachment = GetOutputBinding(0).GetAttachment().get();
+            if (colorAttachment && outputAttachment)
+            {
+                const RHI::Size colorSize = colorAttachment->m_descriptor.m_image.m_size;
+                if (m_colorSize != colorSize)
+                {
+                    m_colorSize = colorSize;
+                    outputAttachment->m_descriptor.m_image.m_size = RHI::Size(
+                        AZ::DivideAndRoundUp(colorSize.m_width, m_tileSize.m_width),
+                        AZ::DivideAndRoundUp(colorSize.m_height, m_tileSize.m_height),
+                        1);
+                }
+            }
+
+            // The rate is only reduced for the depth of field while the effect is enabled for the view
+            m_depthOfFieldEnabled = false;
+            RPI::Scene* scene = GetScene();
+            PostProcessFeatureProcessor* fp = scene ? scene->GetFeatureProcessor<PostProcessFeatureProcessor>() : nullptr;
+            RPI::ViewPtr view = m_pipeline->GetFirstView(GetPipelineViewTag());
+            if (fp && view)
+            {
+                PostProcessSettings* postProcessSettings = fp->GetLevelSettingsFromView(view);
+                if (postProcessSettings)
+                {
+                    DepthOfFieldSettings* depthOfFieldSettings = postProcessSettings->GetDepthOfFieldSettings();
+                    m_depthOfFieldEnabled = depthOfFieldSettings && depthOfFieldSettings->GetEnabled();
+                }
+            }
+
+            ComputePass::FrameBeginInternal(params);
+        }
+
+        void ShadingRateImageGeneratorPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            const RHI::Size imageSize = GetOutputBinding(0).GetAttachment()->m_descriptor.m_image.m_size;
+            const AZStd::array<uint32_t, 2> tileSize = { m_tileSize.m_width, m_tileSize.m_height };
+            const AZStd::array<uint32_t, 2> shadingRateImageSize = { imageSize.m_width, imageSize.m_height };
+
+            m_shaderResourceGroup->SetConstant(m_tileSizeIndex, tileSize);
+            m_shaderResourceGroup->SetConstant(m_shadingRateImageSizeIndex, shadingRateImageSize);
+            m_shaderResourceGroup->SetConstantArray(m_shadingRateValuesIndex, m_shadingRateValues);
+            m_shaderResourceGroup->SetConstant(m_depthOfFieldEnabledIndex, m_depthOfFieldEnabled ? 1u : 0u);
+
+            ComputePass::CompileResources(context);
+        }
+
+        void ShadingRateImageGeneratorPass::BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context)
+        {
+            RHI::CommandList* commandList = context.GetCommandList();
+
+            SetSrgsForDispatch(context);
+
+            // A thread per texel of the shading rate image
+            const RHI::Size imageSize = GetOutputBinding(0).GetAttachment()->m_descriptor.m_image.m_size;
+            SetTargetThreadCounts(imageSize.m_width, imageSize.m_height, 1);
+
+            commandList->Submit(m_dispatchItem.GetDeviceDispatchItem(context.GetDeviceIndex()));
+        }
+    }   // namespace Render
+}   // namespace AZ
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+
+#include <Atom/RHI.Reflect/Size.h>
+#include <Atom/RHI.Reflect/VariableRateShadingEnums.h>
+
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Generates a per region shading rate image from the color of the last frame, the motion vectors and the depth.
+        //! Each texel of the image covers a shading rate tile of the device. The rate is reduced along an axis when
+        //! the luminance contrast of the tile along that axis is low, with the contrast threshold raised where the
+        //! motion or the depth of field blurs the tile.
+        //! Passes rendering the forward and transparent geometry use the image through an input slot with the
+        //! "ShadingRate" scope attachment usage.
+        //! The pass disables itself on devices without per region shading rate support, or which don't encode
+        //! the rates in a single component image.
+        class ShadingRateImageGeneratorPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(ShadingRateImageGeneratorPass);
+
+        public:
+            AZ_RTTI(ShadingRateImageGeneratorPass, "{2F0C6D4A-8E73-4B1D-9A5F-3C6B7E1D0A92}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(ShadingRateImageGeneratorPass, SystemAllocator);
+            ~ShadingRateImageGeneratorPass() = default;
+
+            static RPI::Ptr<ShadingRateImageGeneratorPass> Create(const RPI::PassDescriptor& descriptor);
+
+            bool IsEnabled() const override;
+
+        protected:
+            ShadingRateImageGeneratorPass(const RPI::PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void FrameBeginInternal(FramePrepareParams params) override;
+
+            // Scope producer functions...
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+            void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
+
+        private:
+            //! Returns the largest rate supported by the device which doesn't exceed the requested rate along either axis
+            static RHI::ShadingRate GetNearestSupportedRate(RHI::ShadingRateFlags supportedRates, uint32_t log2X, uint32_t log2Y);
+
+            // Size in pixels of the region covered by a texel of the shading rate image
+            RHI::Size m_tileSize;
+            // Size of the color input the image was last sized for
+            RHI::Size m_colorSize;
+
+            // Device encoding of the rate for each pair of (log2 horizontal rate, log2 vertical rate), at [log2Y * 3 + log2X].x
+            AZStd::array<AZStd::array<uint32_t, 4>, 9> m_shadingRateValues = {};
+            bool m_supported = false;
+            bool m_depthOfFieldEnabled = false;
+
+            RHI::ShaderInputNameIndex m_tileSizeIndex = "m_tileSize";
+            RHI::ShaderInputNameIndex m_shadingRateImageSizeIndex = "m_shadingRateImageSize";
+            RHI::ShaderInputNameIndex m_shadingRateValuesIndex = "m_shadingRateValues";
+            RHI::ShaderInputNameIndex m_depthOfFieldEnabledIndex = "m_depthOfFieldEnabled";
+        };
+    }   // namespace Render
+}   // namespace AZ
@@ -143,4 +143,28 @@ namespace UnitTest
         AZ_TEST_STOP_TRACE_SUPPRESSION(1);
     }
 
+
+    TEST_F(MeshInstanceManagerTestFixture, MaterialStateHash_SeparatesMergedMaterialGroups)
+    {
+        // Keys of merged materials share the material type id, and only share an instance group with a matching state hash
+        MeshInstanceGroupKey mergedKeyA{ modelIdA, testLodIndex, testMeshIndex, materialIdA, Uuid::CreateNull(), testSortKey, HashValue64{ 1 } };
+        MeshInstanceGroupKey mergedKeyB = mergedKeyA;
+        MeshInstanceGroupKey otherStateKey = mergedKeyA;
+        otherStateKey.m_materialStateHash = HashValue64{ 2 };
+
+        MeshInstanceManager::InsertResult resultA = m_meshInstanceManager.AddInstance(mergedKeyA);
+        MeshInstanceManager::InsertResult resultB = m_meshInstanceManager.AddInstance(mergedKeyB);
+        MeshInstanceManager::InsertResult otherStateResult = m_meshInstanceManager.AddInstance(otherStateKey);
+
+        EXPECT_EQ(resultA.m_handle, resultB.m_handle);
+        EXPECT_EQ(resultB.m_instanceCount, 2);
+        EXPECT_NE(resultA.m_handle, otherStateResult.m_handle);
+        EXPECT_NE(resultA.m_handle, m_indices[0].m_handle);
+        EXPECT_EQ(otherStateResult.m_instanceCount, 1);
+
+        m_meshInstanceManager.RemoveInstance(mergedKeyA);
+        m_meshInstanceManager.RemoveInstance(mergedKeyB);
+        m_meshInstanceManager.RemoveInstance(otherStateKey);
+        EXPECT_EQ(m_meshInstanceManager.GetInstanceGroupCount(), keyCount);
+    }
 } // namespace UnitTest
@@ -51,6 +51,10 @@ set(FILES
     Source/CoreLights/DiskLightFeatureProcessor.cpp
     Source/CoreLights/EsmShadowmapsPass.h
     Source/CoreLights/EsmShadowmapsPass.cpp
+    Source/CoreLights/LightCullingBoundsPass.cpp
+    Source/CoreLights/LightCullingBoundsPass.h
+    Source/CoreLights/LightCullingLightData.cpp
+    Source/CoreLights/LightCullingLightData.h
     Source/CoreLights/LightCullingPass.cpp
     Source/CoreLights/LightCullingPass.h
     Source/CoreLights/LightCullingTilePreparePass.cpp
@@ -127,6 +131,10 @@ set(FILES
     Source/Math/MathFilter.h
     Source/Math/MathFilter.cpp
     Source/Math/MathFilterDescriptor.h
+    Source/Mesh/MeshCullingPass.cpp
+    Source/Mesh/MeshCullingPass.h
+    Source/Mesh/MeshGpuCulling.cpp
+    Source/Mesh/MeshGpuCulling.h
     Source/Mesh/MeshInstanceGroupKey.cpp
     Source/Mesh/MeshInstanceGroupKey.h
     Source/Mesh/MeshInstanceGroupList.cpp
@@ -199,6 +207,8 @@ set(FILES
     Source/PostProcessing/PaniniProjectionPass.cpp
     Source/PostProcessing/VignettePass.h
     Source/PostProcessing/VignettePass.cpp
+    Source/PostProcessing/ColorEffectsPass.h
+    Source/PostProcessing/ColorEffectsPass.cpp
     Source/PostProcessing/DepthOfFieldCompositePass.h
     Source/PostProcessing/DepthOfFieldCompositePass.cpp
     Source/PostProcessing/DepthOfFieldBokehBlurPass.h
@@ -291,12 +301,16 @@ set(FILES
     Source/Shadows/ProjectedShadowFeatureProcessor.cpp
     Source/SkinnedMesh/SkinnedMeshComputePass.cpp
     Source/SkinnedMesh/SkinnedMeshComputePass.h
+    Source/SkinnedMesh/SkinnedMeshDispatchBatch.cpp
+    Source/SkinnedMesh/SkinnedMeshDispatchBatch.h
     Source/SkinnedMesh/SkinnedMeshDispatchItem.cpp
     Source/SkinnedMesh/SkinnedMeshDispatchItem.h
     Source/SkinnedMesh/SkinnedMeshFeatureProcessor.cpp
     Source/SkinnedMesh/SkinnedMeshFeatureProcessor.h
     Source/SkinnedMesh/SkinnedMeshOutputStreamManager.cpp
     Source/SkinnedMesh/SkinnedMeshOutputStreamManager.h
+    Source/SkinnedMesh/SkinnedMeshPositionReadback.cpp
+    Source/SkinnedMesh/SkinnedMeshPositionReadback.h
     Source/SkinnedMesh/SkinnedMeshRenderProxy.cpp
     Source/SkinnedMesh/SkinnedMeshRenderProxy.h
     Source/SkinnedMesh/SkinnedMeshShaderOptionsCache.cpp
@@ -321,4 +335,6 @@ set(FILES
     Source/SplashScreen/SplashScreenPass.h
     Source/TransformService/TransformServiceFeatureProcessor.cpp
     Source/TransformService/TransformServiceFeatureProcessor.h
+    Source/VariableRateShading/ShadingRateImageGeneratorPass.cpp
+    Source/VariableRateShading/ShadingRateImageGeneratorPass.h
 )
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Math/Sha1.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/string/string.h>
 #include <Atom/RHI.Reflect/ShaderStages.h>
 #include <Atom/RHI.Edit/ShaderPlatformInterface.h>
@@ -89,6 +90,22 @@ namespace AZ::RHI
                                const AZStd::string& tempFolder,
                                const char* toolNameForLog);
 
+    //! Returns the folder of the compiled shader cache set in the Settings Registry,
+    //! or an empty string if the cache is disabled, which is the default.
+    AZStd::string GetCompiledShaderCacheFolder();
+
+    //! Same as ExecuteShaderCompiler, but first looks for the outputs of an identical compilation in the compiled shader cache.
+    //! Compilations are identified by the compiler, the parameters and the content of @inputFilePath, so the input must not
+    //! include other files. On a cache hit the cached outputs are copied to @outputFilePaths and the compiler isn't run,
+    //! otherwise the outputs of the compiler are stored in the cache once it succeeds.
+    bool ExecuteShaderCompilerWithCache(const AZStd::string& executablePath,
+                                        const AZStd::string& parameters,
+                                        const AZStd::string& inputFilePath,
+                                        AZStd::span<const AZStd::string> outputFilePaths,
+                                        const AZStd::string& shaderSourcePathForDebug,
+                                        const AZStd::string& tempFolder,
+                                        const char* toolNameForLog);
+
     //! Reports messages with AZ_Error or AZ_Warning (See @reportAsErrors).
     //! @param window  Debug window name used for AZ Trace functions.
     //! @param errorMessages  Message string.
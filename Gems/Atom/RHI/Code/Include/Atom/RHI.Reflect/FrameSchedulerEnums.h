@@ -69,7 +69,10 @@ namespace AZ::RHI
         GatherTransientAttachmentStatistics = AZ_BIT(2),
 
         //! Enables gathering of memory statistics across pools.
-        GatherMemoryStatistics = AZ_BIT(3)
+        GatherMemoryStatistics = AZ_BIT(3),
+
+        //! Enables gathering of command list recording time per thread.
+        GatherCommandListRecordingStatistics = AZ_BIT(4)
     };
 
     AZ_DEFINE_ENUM_BITWISE_OPERATORS(AZ::RHI::FrameSchedulerStatisticsFlags)
@@ -70,5 +70,9 @@ namespace AZ::RHI
         // Note: not all platforms support stretch or stretch with aspect ratio.
         // Use DeviceFeature::m_swapChainScalingFlags to find out supported stretch modes
         Scaling m_scalingMode = RHI::Scaling::None;
+
+        // Limits the presentation queue to a single frame, so the CPU can wait for the previous present
+        // before starting the next frame. Trades throughput for lower input latency.
+        bool m_isLowLatency = false;
     };
 }
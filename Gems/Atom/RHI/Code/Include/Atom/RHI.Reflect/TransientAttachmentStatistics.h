@@ -68,6 +68,10 @@ namespace AZ::RHI
             /// using the ObjectPooling policy, this will match the heap size.
             size_t m_watermarkSize = 0;
 
+            /// The watermark the attachments of the frame would have with first fit placement in activation order.
+            /// Lower than m_watermarkSize when the heap places them with offsets packed by lifetime, zero if it didn't record it.
+            size_t m_unpackedWatermarkSize = 0;
+
             /// Vector of attachments that were allocated on this heap for the previous frame.
             AZStd::vector<Attachment> m_attachments;
 
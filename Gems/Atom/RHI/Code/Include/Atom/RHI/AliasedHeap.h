@@ -122,6 +122,52 @@ namespace AZ::RHI
     private:
         void DeactivateResourceInternal(const AttachmentId& attachmentId, Scope& scope, AliasedResourceType type);
 
+        //! Returns the heap address where the attachment is placed, or a null address if it doesn't fit in the heap.
+        //! Uses the offsets of the active placement plan while the activations of the cycle match it, and the first fit
+        //! allocator when no plan is active.
+        VirtualAddress AllocatePlacement(const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes);
+
+        //! Returns the lowest aligned offset that doesn't overlap the active attachments, used once a cycle diverges from its plan.
+        VirtualAddress AllocateLowestFit(size_t sizeInBytes, size_t alignmentInBytes) const;
+
+        //! Appends an activation or deactivation to the placement log of the cycle, and checks it against the active plan.
+        void RecordPlacementEvent(const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes, bool isActivation);
+
+        //! Finds or builds the placement plan for the activation sequence recorded this cycle, and selects it for the next cycle
+        //! if it packs the attachments tighter than first fit placement.
+        void UpdatePlacementPlan();
+
+        /// An activation or deactivation of an attachment, in the order the frame graph compiler issued it.
+        struct PlacementEvent
+        {
+            bool operator==(const PlacementEvent& other) const
+            {
+                return m_attachmentId == other.m_attachmentId && m_sizeInBytes == other.m_sizeInBytes &&
+                    m_alignmentInBytes == other.m_alignmentInBytes && m_isActivation == other.m_isActivation;
+            }
+
+            AttachmentId m_attachmentId;
+            size_t m_sizeInBytes = 0;
+            size_t m_alignmentInBytes = 0;
+            bool m_isActivation = false;
+        };
+
+        /// Heap offsets computed by the TransientAttachmentPacker for one activation sequence (frame graph topology).
+        struct PlacementPlan
+        {
+            size_t m_topologyHash = 0;
+            AZStd::vector<PlacementEvent> m_events;
+
+            /// Heap offset of each activation event, in event order. Unused for deactivations.
+            AZStd::vector<size_t> m_offsets;
+
+            size_t m_inOrderPeakInBytes = 0;
+            size_t m_packedPeakInBytes = 0;
+            uint64_t m_lastUsedCycle = 0;
+        };
+
+        static const uint32_t PlacementPlanCacheSize = 4;
+
         /// Descriptor of the heap.
         AliasedHeapDescriptor m_descriptor;
 
@@ -158,5 +204,19 @@ namespace AZ::RHI
         // This map is used to reverse look up resource hash so we can clear them out of m_cache
         // once they have been replaced with a new resource at a different place in the heap. 
         AZStd::unordered_map<AttachmentId, HashValue64> m_reverseLookupHash;
+
+        /// Placement log of the current cycle, and the hash of its events so far.
+        AZStd::vector<PlacementEvent> m_placementEvents;
+        size_t m_placementTopologyHash = 0;
+
+        /// Most recently used placement plans, and the one used to place the attachments of the current cycle (if any).
+        AZStd::vector<PlacementPlan> m_placementPlans;
+        static const uint32_t InvalidPlacementPlanIndex = static_cast<uint32_t>(-1);
+        uint32_t m_activePlacementPlanIndex = InvalidPlacementPlanIndex;
+
+        /// Set when the current cycle stops matching the active plan, the rest of the cycle is placed at the lowest fit.
+        bool m_placementPlanDiverged = false;
+
+        uint64_t m_cycleIndex = 0;
     };
 }
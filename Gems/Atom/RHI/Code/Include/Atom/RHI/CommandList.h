@@ -89,6 +89,16 @@ namespace AZ::RHI
         virtual void BuildTopLevelAccelerationStructure(
             const RHI::DeviceRayTracingTlas& rayTracingTlas, const AZStd::vector<const RHI::DeviceRayTracingBlas*>& changedBlasList) = 0;
 
+        /// Refits a Top Level Acceleration Structure (TLAS) in place after DeviceRayTracingTlas::UpdateBuffers changed the transforms of its
+        /// instances, which is much cheaper than building it
+        virtual void UpdateTopLevelAccelerationStructure(
+            const RHI::DeviceRayTracingTlas& rayTracingTlas, const AZStd::vector<const RHI::DeviceRayTracingBlas*>& changedBlasList) = 0;
+
+        /// Copies a built Bottom Level Acceleration Structure (BLAS) created with ENABLE_COMPACTION to a compacted BLAS created with
+        /// DeviceRayTracingBlas::CreateCompactedBuffers
+        virtual void CompactBottomLevelAccelerationStructure(
+            const RHI::DeviceRayTracingBlas& sourceBlas, const RHI::DeviceRayTracingBlas& compactedBlas) = 0;
+
         /// Defines the submit range for a CommandList
         /// Note: the default is 0 items, which disables validation for items submitted outside of the framegraph
         struct SubmitRange
@@ -84,6 +84,13 @@ namespace AZ::RHI
         //! Returns the constants layout.
         const ConstantsLayout* GetLayout() const;
 
+        //! Returns the byte range of the constant data that was assigned since the last call to ResetDirtyInterval,
+        //! which is empty if nothing was. Newly created constant data is dirty as a whole.
+        Interval GetDirtyInterval() const;
+
+        //! Clears the dirty byte range, once the constant data was uploaded.
+        void ResetDirtyInterval();
+
         //! Returns whether other constant data and this have the same value at the specified shader input index
         bool ConstantIsEqual(const ConstantsData& other, ShaderInputConstantIndex inputIndex) const;
 
@@ -109,6 +116,9 @@ namespace AZ::RHI
         bool ValidateConstantAccess(ShaderInputConstantIndex inputIndex, ValidateConstantAccessExpect expect, size_t offsetInBytes, size_t sizeInBytes) const;
         bool ValidateConstantBufferAccess(size_t offsetInBytes, size_t sizeInBytes) const;
 
+        //! Grows the dirty byte range to include the interval.
+        void MarkDirty(const Interval& interval);
+
         //! Assigns a specified number of rows from a Matrix of type Matrix3x4 and Matrix4x4
         //! the function expects type T and matrixSize (number of floats, which is 12 for Matrix3x4 and 16 for Matrix4x4)
         template <typename T, uint32_t matrixSize>
@@ -116,6 +126,7 @@ namespace AZ::RHI
 
         ConstPtr<ConstantsLayout> m_layout;
         AZStd::vector<uint8_t> m_constantData;
+        Interval m_dirtyInterval;
     };
 
     template <typename T>
@@ -187,6 +198,7 @@ namespace AZ::RHI
         if (ValidateConstantAccess(inputIndex, ValidateConstantAccessExpect::Complete, 0, sizeInBytes))
         {
             const Interval interval = GetLayout()->GetInterval(inputIndex);
+            MarkDirty(interval);
             float* row = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             for (uint32_t i = 0; i < rowCount; i++)
             {
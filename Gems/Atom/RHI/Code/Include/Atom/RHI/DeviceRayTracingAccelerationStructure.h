@@ -27,12 +27,15 @@ namespace AZ::RHI
     //!
     //! FAST_TRACE: Sets a preference to build the RTAS to have faster raytracing capabilities. Can incur longer build times.
     //! FAST_BUILD: Sets a preference for faster build times of the Acceleration Structure over faster raytracing.
-    //! ENABLE_UPDATE: Enables incremental updating of a BLAS object. Needs to be set at BLAS creation time.
+    //! ENABLE_UPDATE: Enables incremental updating of a BLAS object, or refitting of a TLAS object. Needs to be set at creation time.
+    //! ENABLE_COMPACTION: Enables the compaction of a BLAS object after it is built, see DeviceRayTracingBlas::CreateCompactedBuffers.
+    //!                    Needs to be set at BLAS creation time.
     enum class RayTracingAccelerationStructureBuildFlags : uint32_t
     {
         FAST_TRACE = AZ_BIT(1),
         FAST_BUILD = AZ_BIT(2),
         ENABLE_UPDATE = AZ_BIT(3),
+        ENABLE_COMPACTION = AZ_BIT(4),
     };
     AZ_DEFINE_ENUM_BITWISE_OPERATORS(AZ::RHI::RayTracingAccelerationStructureBuildFlags);
 
@@ -125,9 +128,18 @@ namespace AZ::RHI
         //! Creates the internal BLAS buffers from the descriptor
         ResultCode CreateBuffers(Device& device, const DeviceRayTracingBlasDescriptor* descriptor, const DeviceRayTracingBufferPools& rayTracingBufferPools);
 
+        //! Creates the internal buffers of a compacted copy of the source BLAS, sized with its compacted size.
+        //! The BLAS is filled by CommandList::CompactBottomLevelAccelerationStructure, and can't be built or updated.
+        ResultCode CreateCompactedBuffers(Device& device, const DeviceRayTracingBlas& sourceBlas, const DeviceRayTracingBufferPools& rayTracingBufferPools);
+
         //! Returns true if the DeviceRayTracingBlas has been initialized
         virtual bool IsValid() const = 0;
 
+        //! Returns the size of the BLAS once compacted, which is written by the GPU when a BLAS created with ENABLE_COMPACTION is built.
+        //! Returns 0 if the BLAS can't be compacted or the size isn't available yet. The size is only reliable once the frame that
+        //! built the BLAS completed on the GPU.
+        virtual uint64_t GetCompactedSizeInBytes() const = 0;
+
         DeviceRayTracingGeometryVector& GetGeometries()
         {
             return m_geometries;
@@ -136,6 +148,7 @@ namespace AZ::RHI
     private:
         // Platform API
         virtual RHI::ResultCode CreateBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingBlasDescriptor* descriptor, const DeviceRayTracingBufferPools& rayTracingBufferPools) = 0;
+        virtual RHI::ResultCode CreateCompactedBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingBlas& sourceBlas, const DeviceRayTracingBufferPools& rayTracingBufferPools) = 0;
 
         DeviceRayTracingGeometryVector m_geometries;
     };
@@ -149,6 +162,7 @@ namespace AZ::RHI
     //! will be applied to all of the geometry entries in the Blas.  It also contains a hitGroupIndex
     //! which is used to index into the DeviceRayTracingShaderTable to determine the hit shader when a
     //! ray hits any geometry in the instance.
+    //! An instance without a BLAS is inactive, it keeps its index in the TLAS but is never hit.
     struct DeviceRayTracingTlasInstance
     {
         uint32_t m_instanceID = 0;
@@ -194,6 +208,8 @@ namespace AZ::RHI
 
         uint32_t GetNumInstancesInBuffer() const { return m_numInstancesInBuffer; }
 
+        [[nodiscard]] const RayTracingAccelerationStructureBuildFlags& GetBuildFlags() const { return m_buildFlags; }
+
         // build operations
         DeviceRayTracingTlasDescriptor* Build();
         DeviceRayTracingTlasDescriptor* Instance();
@@ -206,6 +222,7 @@ namespace AZ::RHI
         DeviceRayTracingTlasDescriptor* Blas(const RHI::Ptr<RHI::DeviceRayTracingBlas>& blas);
         DeviceRayTracingTlasDescriptor* InstancesBuffer(const RHI::Ptr<RHI::DeviceBuffer>& tlasInstances);
         DeviceRayTracingTlasDescriptor* NumInstances(uint32_t numInstancesInBuffer);
+        DeviceRayTracingTlasDescriptor* BuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags& buildFlags);
 
     private:
         DeviceRayTracingTlasInstanceVector m_instances;
@@ -214,6 +231,8 @@ namespace AZ::RHI
         // externally created Instances buffer, cannot be combined with other Instances
         RHI::Ptr<RHI::DeviceBuffer> m_instancesBuffer;
         uint32_t m_numInstancesInBuffer;
+
+        RayTracingAccelerationStructureBuildFlags m_buildFlags = AZ::RHI::RayTracingAccelerationStructureBuildFlags::FAST_TRACE;
     };
 
     //! DeviceRayTracingTlas
@@ -231,6 +250,12 @@ namespace AZ::RHI
         //! Creates the internal TLAS buffers from the descriptor
         ResultCode CreateBuffers(Device& device, const DeviceRayTracingTlasDescriptor* descriptor, const DeviceRayTracingBufferPools& rayTracingBufferPools);
 
+        //! Writes the instances of the descriptor to a new instances buffer and keeps the TLAS buffer, so the TLAS can be refit
+        //! in place with CommandList::UpdateTopLevelAccelerationStructure instead of being rebuilt.
+        //! The TLAS must have been created with ENABLE_UPDATE, and the descriptor must have the same instances and BLAS objects
+        //! as the one it was created with, only the transforms of the instances may change. Fails otherwise.
+        ResultCode UpdateBuffers(const DeviceRayTracingTlasDescriptor* descriptor, const DeviceRayTracingBufferPools& rayTracingBufferPools);
+
         //! Returns the TLAS RHI buffer
         virtual const RHI::Ptr<RHI::DeviceBuffer> GetTlasBuffer() const = 0;
         virtual const RHI::Ptr<RHI::DeviceBuffer> GetTlasInstancesBuffer() const = 0;
@@ -238,5 +263,6 @@ namespace AZ::RHI
     private:
         // Platform API
         virtual RHI::ResultCode CreateBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingTlasDescriptor* descriptor, const DeviceRayTracingBufferPools& rayTracingBufferPools) = 0;
+        virtual RHI::ResultCode UpdateBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingTlasDescriptor* descriptor, const DeviceRayTracingBufferPools& rayTracingBufferPools) = 0;
     };
 }
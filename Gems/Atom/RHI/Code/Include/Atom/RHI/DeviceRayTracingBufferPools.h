@@ -35,6 +35,8 @@ namespace AZ::RHI
         const RHI::Ptr<RHI::DeviceBufferPool>& GetBlasBufferPool() const;
         const RHI::Ptr<RHI::DeviceBufferPool>& GetTlasInstancesBufferPool() const;
         const RHI::Ptr<RHI::DeviceBufferPool>& GetTlasBufferPool() const;
+        const RHI::Ptr<RHI::DeviceBufferPool>& GetCompactedSizeBufferPool() const;
+        const RHI::Ptr<RHI::DeviceBufferPool>& GetCompactedSizeReadbackBufferPool() const;
 
         // operations
         void Init(RHI::Ptr<RHI::Device>& device);
@@ -48,6 +50,8 @@ namespace AZ::RHI
         virtual RHI::BufferBindFlags GetBlasBufferBindFlags() const { return RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::RayTracingAccelerationStructure; }
         virtual RHI::BufferBindFlags GetTlasInstancesBufferBindFlags() const { return RHI::BufferBindFlags::ShaderReadWrite; }
         virtual RHI::BufferBindFlags GetTlasBufferBindFlags() const { return RHI::BufferBindFlags::RayTracingAccelerationStructure; }
+        virtual RHI::BufferBindFlags GetCompactedSizeBufferBindFlags() const { return RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::CopyRead; }
+        virtual RHI::BufferBindFlags GetCompactedSizeReadbackBufferBindFlags() const { return RHI::BufferBindFlags::CopyWrite; }
 
     private:
         bool m_initialized = false;
@@ -57,5 +61,9 @@ namespace AZ::RHI
         RHI::Ptr<RHI::DeviceBufferPool> m_blasBufferPool;
         RHI::Ptr<RHI::DeviceBufferPool> m_tlasInstancesBufferPool;
         RHI::Ptr<RHI::DeviceBufferPool> m_tlasBufferPool;
+        // the compacted size of a BLAS is written on the GPU to a buffer of the compacted size pool, and copied to a
+        // buffer of the readback pool. Platforms that query the compacted size another way don't use these pools.
+        RHI::Ptr<RHI::DeviceBufferPool> m_compactedSizeBufferPool;
+        RHI::Ptr<RHI::DeviceBufferPool> m_compactedSizeReadbackBufferPool;
     };
 }
@@ -72,6 +72,11 @@ namespace AZ::RHI
 
         //! Update the view hash within m_viewHash
         void UpdateViewHash(const AZ::Name& viewName, const HashValue64 viewHash);
+
+        //! Returns the byte range of the constant data that the current compile has to write. Compiled data is ring buffered
+        //! across FrameCountMax compiles, so this spans the constants assigned since the compiled data being written was last
+        //! written. Platforms use it from CompileGroupInternal to only upload the bytes that changed.
+        Interval GetConstantDataDirtyInterval() const;
             
     protected:
         DeviceShaderResourceGroup() = default;
@@ -79,6 +84,12 @@ namespace AZ::RHI
     private:
         void SetData(const DeviceShaderResourceGroupData& data);
 
+        //! Records the dirty constants accumulated since the previous compile as the dirty constants of the current compile.
+        void BeginConstantDataCompile();
+
+        //! Makes the next compile write the whole constant data.
+        void InvalidateConstantData();
+
         DeviceShaderResourceGroupData m_data;
 
         // The binding slot cached from the layout.
@@ -94,6 +105,14 @@ namespace AZ::RHI
         uint32_t m_resourceTypeIteration[static_cast<uint32_t>(DeviceShaderResourceGroupData::ResourceType::Count)] = { 0 };
         uint32_t m_updateMaskResetLatency = RHI::Limits::Device::FrameCountMax - 1; //we do -1 because we update after compile
 
+        // Dirty constant byte range accumulated by SetData since the last compile.
+        Interval m_pendingConstantDirtyInterval;
+
+        // Dirty constant byte ranges of the last FrameCountMax compiles, ring buffered like the compiled data. They start
+        // as the whole constant data since none of the compiled data was written yet.
+        AZStd::array<Interval, RHI::Limits::Device::FrameCountMax> m_constantDirtyIntervals;
+        uint32_t m_constantDirtyIntervalIndex = 0;
+
         // Track hash related to views. This will help ensure we compile views in case they get invalidated and partial srg compilation is enabled
         AZStd::unordered_map<AZ::Name, HashValue64> m_viewHash;
     };
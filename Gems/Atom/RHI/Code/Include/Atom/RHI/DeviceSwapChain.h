@@ -33,6 +33,11 @@ namespace AZ::RHI
         //! Presents the swap chain to the display, and rotates the images.
         void Present();
 
+        //! Blocks until the presentation engine is ready to accept a new frame when the swap chain
+        //! was created with SwapChainDescriptor::m_isLowLatency. Called right before the CPU starts
+        //! a frame, so the input sampled by that frame is as recent as possible. Does nothing otherwise.
+        void WaitForPresentLatency();
+
         //! Sets the vertical sync interval for the swap chain.
         //!      0 - No vsync.
         //!      N - Sync to every N vertical refresh.
@@ -136,6 +141,9 @@ namespace AZ::RHI
 
         virtual void SetVerticalSyncIntervalInternal([[maybe_unused]]uint32_t previousVerticalSyncInterval) {}
 
+        //! Called when waiting for the previous frame to be presented in low latency mode.
+        virtual void WaitForPresentLatencyInternal() {}
+
         //////////////////////////////////////////////////////////////////////////
 
         SwapChainDescriptor m_descriptor;
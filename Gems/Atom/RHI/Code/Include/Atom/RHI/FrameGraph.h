@@ -133,7 +133,9 @@ namespace AZ::RHI
         void SignalFence(Fence& fence);
         void WaitFence(Fence& fence);
         void SetEstimatedItemCount(uint32_t itemCount);
+        void SetEstimatedItemCosts(AZStd::span<const uint32_t> itemCosts);
         void SetHardwareQueueClass(HardwareQueueClass hardwareQueueClass);
+        void SetAsyncComputeAllowed(bool asyncComputeAllowed);
         void SetGroupId(const ScopeGroupId& groupId);
 
         //! Declares a single color attachment for use on the current scope.             
@@ -125,7 +125,10 @@ namespace AZ::RHI
     //! compilation as part of the graph construction process. Scopes associate directly to a "Hardware Queue Class":
     //! Graphics, Compute, or Copy. These three queue classes must be synchronized between each other. To make this
     //! easier on platforms, the base compiler takes the topologically flattened graph and collates it into
-    //! three independent sorted lists--one for each queue class. Then, a queue-centric producer-consumer graph is
+    //! three independent sorted lists--one for each queue class. Before that, graphics scopes that allow async compute
+    //! (see FrameGraphInterface::SetAsyncComputeAllowed) are moved to the compute queue when they only use their attachments
+    //! from compute shaders or copies, and there is at least one independent graphics scope between their last producer
+    //! and first consumer for them to overlap with. Then, a queue-centric producer-consumer graph is
     //! constructed across the scopes. Specifically:
     //!
     //!  class Scope
@@ -208,6 +211,12 @@ namespace AZ::RHI
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags);
 
+        //! Moves the graphics scopes that allow async compute to the compute queue when they can overlap with graphics work.
+        void AssignAsyncComputeScopes(FrameGraph& frameGraph);
+
+        //! Returns whether a scope can run on the compute queue.
+        bool CanRunOnComputeQueue(const Scope& scope) const;
+
         void ExtendTransientAttachmentAsyncQueueLifetimes(
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags);
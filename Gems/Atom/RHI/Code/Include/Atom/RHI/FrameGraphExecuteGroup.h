@@ -9,6 +9,7 @@
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
 #include <Atom/RHI/FrameGraphExecuteContext.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/RTTI/RTTI.h>
@@ -70,6 +71,10 @@ namespace AZ::RHI
             /// The submit count for the scope
             uint32_t m_submitCount = 0;
 
+            /// Optional running total of the estimated cost of each submit (see Scope::GetEstimatedItemCostOffsets).
+            /// When it holds one entry per submit, the submit ranges are balanced by cost instead of by count.
+            AZStd::span<const uint32_t> m_submitCostOffsets;
+
             /// The ordered array of command lists in the group. This can be null if the user wishes to
             /// assign command lists at context begin time.
             CommandList* const * m_commandLists = nullptr;
@@ -82,6 +82,10 @@ namespace AZ::RHI
         //! and EndGroup on all instances prior to calling End.
         uint32_t GetGroupCount() const;
 
+        //! Returns the group at the specified index @param groupIndex, which must be less than GetGroupCount. This allows
+        //! inspecting the context count and job policy of a group before it begins, in order to schedule its contexts.
+        FrameGraphExecuteGroup* GetGroup(uint32_t groupIndex);
+
         //! Begins a new execution phase by inspecting an generating context groups from
         //! the provided frame graph instance. State within the executer is reset between
         //! each Begin / End cycle, so the implementor must rebuild the context groups each
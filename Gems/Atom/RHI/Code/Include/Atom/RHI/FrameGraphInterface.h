@@ -280,6 +280,15 @@ namespace AZ::RHI
         {
             m_frameGraph.SetEstimatedItemCount(itemCount);
         }
+
+        //! Sets the estimated relative recording cost of each work item that will be processed by this scope. This also
+        //! sets the estimated item count to the number of costs provided. When a scope is split across several command
+        //! lists, the split points are chosen so each command list records a similar total cost rather than a similar
+        //! number of items. The costs are copied and only need to remain valid for the duration of the call.
+        void SetEstimatedItemCosts(AZStd::span<const uint32_t> itemCosts)
+        {
+            m_frameGraph.SetEstimatedItemCosts(itemCosts);
+        }
             
         //! Requests that a specific GPU hardware queue be used for processing this scope.
         void SetHardwareQueueClass(HardwareQueueClass hardwareQueueClass)
@@ -287,6 +296,14 @@ namespace AZ::RHI
             m_frameGraph.SetHardwareQueueClass(hardwareQueueClass);
         }
 
+        //! Allows the frame graph compiler to move this graphics scope to the compute queue, when the scope only uses its
+        //! attachments from compute shaders or copies and there is independent graphics work for it to overlap with.
+        //! The scope must only record dispatches and copies. Needs to be called every frame.
+        void SetAsyncComputeAllowed(bool asyncComputeAllowed)
+        {
+            m_frameGraph.SetAsyncComputeAllowed(asyncComputeAllowed);
+        }
+
         void SetGroupId(const ScopeGroupId& groupId)
         {
             m_frameGraph.SetGroupId(groupId);
@@ -17,7 +17,10 @@
 #include <Atom/RHI/ScopeProducer.h>
 #include <Atom/RHI/ScopeProducerEmpty.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/time.h>
 
 namespace AZ
 {
@@ -55,8 +58,38 @@ namespace AZ::RHI
         /// Controls whether the phase is allowed to use jobs.
         JobPolicy m_jobPolicy = JobPolicy::Parallel;
 
-        /// Controls the number of ShaderResourceGroups compiled per job.
+        /// Controls the maximum number of ShaderResourceGroups compiled per job.
         uint32_t m_shaderResourceGroupCompilesPerJob = 256;
+
+        /// Controls the minimum number of ShaderResourceGroups compiled per job. The compiles of all the pools are split
+        /// down to this size so there are enough jobs for every worker thread.
+        uint32_t m_shaderResourceGroupMinCompilesPerJob = 16;
+    };
+
+    //! @brief Command list recording work performed by a single thread during FrameScheduler::Execute.
+    struct CommandListRecordingStatistics
+    {
+        /// The thread that recorded the execute contexts.
+        AZStd::thread_id m_threadId;
+
+        /// The total time spent recording execute contexts on the thread, in ticks (see AZStd::GetTimeTicksPerSecond).
+        AZStd::sys_time_t m_recordingTimeTicks = 0;
+
+        /// The number of execute contexts recorded on the thread.
+        uint32_t m_contextCount = 0;
+    };
+
+    //! @brief How much compute work ran on the compute queue during the most recent frame.
+    struct AsyncComputeStatistics
+    {
+        /// The number of scopes that ran on the compute queue.
+        uint32_t m_computeScopeCount = 0;
+
+        /// The number of those scopes that were moved to the compute queue by the frame graph compiler.
+        uint32_t m_autoAsyncComputeScopeCount = 0;
+
+        /// The sum, over the scopes moved by the compiler, of the independent graphics scopes each one can overlap with.
+        uint32_t m_overlappedGraphicsScopeCount = 0;
     };
 
     //! == Overview ==
@@ -174,6 +207,13 @@ namespace AZ::RHI
         //! Returns memory statistics for the previous frame.
         const MemoryStatistics* GetMemoryStatistics() const;
 
+        //! Returns the command list recording time of each thread for the most recent Execute. Only gathered
+        //! when FrameSchedulerStatisticsFlags::GatherCommandListRecordingStatistics is set.
+        AZStd::vector<CommandListRecordingStatistics> GetCommandListRecordingStatistics() const;
+
+        //! Returns the compute queue usage of the most recently compiled frame graph.
+        const AsyncComputeStatistics& GetAsyncComputeStatistics() const;
+
         //! Returns the implicit root scope id for the given deviceIndex.
         ScopeId GetRootScopeId(int deviceIndex = 0);
 
@@ -197,6 +237,9 @@ namespace AZ::RHI
         void CompileShaderResourceGroups();
         void BuildRayTracingShaderTables();
 
+        /// Returns the number of ShaderResourceGroups to compile per job to spread the compiles across the worker threads.
+        uint32_t GetShaderResourceGroupCompilesPerJob(uint32_t totalCompiles) const;
+
         ScopeProducer* FindScopeProducer(const ScopeId& scopeId);
 
         //! This method executes a single context on a scope. First find the scope and
@@ -208,6 +251,13 @@ namespace AZ::RHI
         //! on the respective job policies.
         void ExecuteGroupInternal(AZ::Job* parentJob, uint32_t groupIndex);
 
+        //! Records all groups on the task graph. Every context of a parallel group becomes its own task, enclosed
+        //! by tasks that begin and end the group, so contexts of different groups load-balance across all workers.
+        void ExecuteTaskGraph();
+
+        //! Accumulates recording time for the calling thread.
+        void RecordCommandListRecordingTime(AZStd::sys_time_t recordingTimeTicks);
+
         bool m_isProcessing = false;
 
         MultiDevice::DeviceMask m_deviceMask = static_cast<MultiDevice::DeviceMask>(0);
@@ -234,5 +284,10 @@ namespace AZ::RHI
         AZStd::vector<RHI::Ptr<DeviceRayTracingShaderTable>> m_rayTracingShaderTablesToBuild;
 
         AZ::TaskGraphActiveInterface* m_taskGraphActive = nullptr;
+
+        mutable AZStd::mutex m_recordingStatisticsMutex;
+        AZStd::vector<CommandListRecordingStatistics> m_recordingStatistics;
+
+        AsyncComputeStatistics m_asyncComputeStatistics;
     };
 }
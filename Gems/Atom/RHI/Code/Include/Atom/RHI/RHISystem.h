@@ -51,8 +51,17 @@ namespace AZ::RHI
         using FrameGraphCallback = AZStd::function<void(RHI::FrameGraphBuilder&)>;
 
         //! Invokes the frame scheduler. The provided callback is invoked prior to compilation of the graph.
+        //! Same as calling FramePrepare and then FrameExecute.
         void FrameUpdate(FrameGraphCallback frameGraphCallback);
 
+        //! Begins the frame, invokes the callback and compiles the frame graph, which also compiles the resources of the scope
+        //! producers. Once this returns the frame graph doesn't change anymore, so it can be executed on another thread as long as
+        //! the scope producers and the draw items they record stay alive until FrameExecute returns.
+        void FramePrepare(FrameGraphCallback frameGraphCallback);
+
+        //! Records and submits the frame compiled by FramePrepare and ends the frame. FramePrepare must be called first.
+        void FrameExecute();
+
         //! Register/Unregister xr system
         bool RegisterXRSystem(XRRenderingInterface* xrRenderingInterface);
         void UnregisterXRSystem();
@@ -73,6 +82,8 @@ namespace AZ::RHI
         RHI::PipelineStateCache* GetPipelineStateCache() override;
         void ModifyFrameSchedulerStatisticsFlags(RHI::FrameSchedulerStatisticsFlags statisticsFlags, bool enableFlags) override;
         double GetCpuFrameTime() const override;
+        AZStd::vector<CommandListRecordingStatistics> GetCommandListRecordingStatistics() const override;
+        AsyncComputeStatistics GetAsyncComputeStatistics() const override;
         const AZStd::unordered_map<int, TransientAttachmentPoolDescriptor>* GetTransientAttachmentPoolDescriptor() const override;
         ConstPtr<PlatformLimitsDescriptor> GetPlatformLimitsDescriptor(int deviceIndex = MultiDevice::DefaultDeviceIndex) const override;
         void QueueRayTracingShaderTableForBuild(DeviceRayTracingShaderTable* rayTracingShaderTable) override;
@@ -114,5 +125,8 @@ namespace AZ::RHI
         //Used for better verbosity related to gpu markers
         uint16_t m_numActiveRenderPipelines = 0;
         bool m_gpuMarkersEnabled = true;
+
+        //! Whether the frame of the last FramePrepare compiled and is waiting for FrameExecute
+        bool m_isFrameCompiled = false;
     };
 }
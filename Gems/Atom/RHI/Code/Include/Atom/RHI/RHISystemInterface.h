@@ -27,6 +27,8 @@ namespace AZ::RHI
     class PlatformLimitsDescriptor;
     class PhysicalDeviceDescriptor;
     class DeviceRayTracingShaderTable;
+    struct CommandListRecordingStatistics;
+    struct AsyncComputeStatistics;
     struct FrameSchedulerCompileRequest;
     struct TransientAttachmentStatistics;
     struct TransientAttachmentPoolDescriptor;
@@ -62,6 +64,10 @@ namespace AZ::RHI
 
         virtual double GetCpuFrameTime() const = 0;
 
+        virtual AZStd::vector<CommandListRecordingStatistics> GetCommandListRecordingStatistics() const = 0;
+
+        virtual AsyncComputeStatistics GetAsyncComputeStatistics() const = 0;
+
         virtual uint16_t GetNumActiveRenderPipelines() const = 0;
 
         virtual const AZStd::unordered_map<int, TransientAttachmentPoolDescriptor>* GetTransientAttachmentPoolDescriptor() const = 0;
@@ -104,6 +104,11 @@ namespace AZ::RHI
             const RayTracingBlasDescriptor* descriptor,
             const RayTracingBufferPools& rayTracingBufferPools);
 
+        //! Creates the internal buffers of a compacted copy of the source BLAS on the devices of the source, see
+        //! DeviceRayTracingBlas::CreateCompactedBuffers. Returns ResultCode::NotReady if the compacted size of the source
+        //! isn't available on every device yet.
+        ResultCode CreateCompactedBuffers(const RayTracingBlas& sourceBlas, const RayTracingBufferPools& rayTracingBufferPools);
+
         //! Returns true if the RayTracingBlas has been initialized
         bool IsValid() const;
 
@@ -120,6 +125,7 @@ namespace AZ::RHI
     //! will be applied to all of the geometry entries in the Blas.  It also contains a hitGroupIndex
     //! which is used to index into the RayTracingShaderTable to determine the hit shader when a
     //! ray hits any geometry in the instance.
+    //! An instance without a BLAS is inactive, it keeps its index in the TLAS but is never hit.
     struct RayTracingTlasInstance
     {
         uint32_t m_instanceID = 0;
@@ -183,6 +189,11 @@ namespace AZ::RHI
             return m_numInstancesInBuffer;
         }
 
+        [[nodiscard]] const RayTracingAccelerationStructureBuildFlags& GetBuildFlags() const
+        {
+            return m_buildFlags;
+        }
+
         //! Build operations
         RayTracingTlasDescriptor* Build();
         RayTracingTlasDescriptor* Instance();
@@ -195,6 +206,7 @@ namespace AZ::RHI
         RayTracingTlasDescriptor* Blas(const RHI::Ptr<RayTracingBlas> &blas);
         RayTracingTlasDescriptor* InstancesBuffer(RHI::Ptr<RHI::Buffer>& tlasInstances);
         RayTracingTlasDescriptor* NumInstances(uint32_t numInstancesInBuffer);
+        RayTracingTlasDescriptor* BuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags& buildFlags);
 
     private:
         MultiDeviceRayTracingTlasInstanceVector m_instances;
@@ -203,6 +215,8 @@ namespace AZ::RHI
         //! externally created Instances buffer, cannot be combined with other Instances
         RHI::Ptr<RHI::Buffer> m_instancesBuffer;
         uint32_t m_numInstancesInBuffer = 0;
+
+        RayTracingAccelerationStructureBuildFlags m_buildFlags = AZ::RHI::RayTracingAccelerationStructureBuildFlags::FAST_TRACE;
     };
 
     //! RayTracingTlas
@@ -223,6 +237,10 @@ namespace AZ::RHI
             const RayTracingTlasDescriptor* descriptor,
             const RayTracingBufferPools& rayTracingBufferPools);
 
+        //! Updates the instances of the TLAS on every device to refit it, see DeviceRayTracingTlas::UpdateBuffers.
+        //! Fails if the TLAS can't be refit with this descriptor, in which case it must be recreated with CreateBuffers.
+        ResultCode UpdateBuffers(const RayTracingTlasDescriptor* descriptor, const RayTracingBufferPools& rayTracingBufferPools);
+
         //! Returns the TLAS RHI buffer
         const RHI::Ptr<RHI::Buffer> GetTlasBuffer() const;
         const RHI::Ptr<RHI::Buffer> GetTlasInstancesBuffer() const;
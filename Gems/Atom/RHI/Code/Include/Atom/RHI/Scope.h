@@ -13,6 +13,7 @@
 #include <Atom/RHI/DeviceResourcePool.h>
 #include <Atom/RHI/QueryPool.h>
 #include <Atom/RHI/Fence.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/array.h>
 
@@ -90,11 +91,23 @@ namespace AZ::RHI
         //! Sets the hardware queue class for this scope.
         void SetHardwareQueueClass(HardwareQueueClass hardwareQueueClass);
 
+        //! Returns whether the frame graph compiler may move this graphics scope to the compute queue for the current frame.
+        bool IsAsyncComputeAllowed() const;
+
+        //! Returns the number of independent graphics scopes this scope can overlap with after the frame graph compiler moved
+        //! it to the compute queue, or 0 if the scope wasn't moved.
+        uint32_t GetAsyncComputeOverlapCount() const;
+
         //! Returns the estimated number of draw / dispatch / copy items that the user will submit
         //! while in this scope. This is an estimation intended to be used by the platform-specific
         //! load-balancer in the frame scheduler.
         uint32_t GetEstimatedItemCount() const;
 
+        //! Returns the running total of the estimated recording cost of each item in the scope, where element i holds the
+        //! summed cost of items [0, i]. Empty if the scope producer didn't provide per item costs, in which case all items
+        //! are assumed to cost the same.
+        AZStd::span<const uint32_t> GetEstimatedItemCostOffsets() const;
+
         //! Returns the scope for the given hardware queue which must be scheduled immediately prior to this scope (can be null).
         Scope* GetProducerByQueue(HardwareQueueClass hardwareQueueClass) const;
 
@@ -223,9 +236,18 @@ namespace AZ::RHI
         /// A load balancing factor for command list splitting (platform dependent).
         uint32_t m_estimatedItemCount = 1;
 
+        /// Running total of the estimated cost of each item, used to balance command list splitting.
+        AZStd::vector<uint32_t> m_estimatedItemCostOffsets;
+
         /// The hardware queue class that this scope is requested to execute on.
         HardwareQueueClass m_hardwareQueueClass = HardwareQueueClass::Graphics;
 
+        /// Whether the compiler may move the scope to the compute queue. Reset every frame.
+        bool m_asyncComputeAllowed = false;
+
+        /// The number of graphics scopes overlapped by the scope when the compiler moved it to the compute queue.
+        uint32_t m_asyncComputeOverlapCount = 0;
+
         /// Tracks whether the scope is initialized, which must occur before activation.
         bool m_isInitialized = false;
 
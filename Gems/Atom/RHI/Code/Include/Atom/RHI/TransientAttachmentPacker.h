@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/Base.h>
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::RHI
+{
+    //! Computes heap offsets for transient allocations whose lifetimes are known up front.
+    //! Each allocation is a rectangle in the (lifetime, heap offset) plane, and two allocations may share memory only if their
+    //! lifetimes don't intersect. Packing them is a 2D bin packing problem where the width of each rectangle is fixed by its
+    //! lifetime and the goal is to minimize the peak offset.
+    class TransientAttachmentPacker
+    {
+    public:
+        struct Allocation
+        {
+            size_t m_sizeInBytes = 0;
+            size_t m_alignmentInBytes = 1;
+
+            //! Inclusive lifetime range, allocations overlap in time if their ranges intersect.
+            uint32_t m_lifetimeBegin = 0;
+            uint32_t m_lifetimeEnd = 0;
+        };
+
+        struct Result
+        {
+            //! The heap offset of each allocation, in input order.
+            AZStd::vector<size_t> m_offsets;
+
+            //! The highest end offset of all allocations.
+            size_t m_peakInBytes = 0;
+        };
+
+        //! Places the allocations in lifetime order at the lowest offset that fits, the way a first fit heap allocator places
+        //! them when they are activated and deactivated in order.
+        static Result PackInOrder(AZStd::span<const Allocation> allocations);
+
+        //! Places the allocations in several orders (largest first, largest lifetime area first, longest lifetime first and
+        //! lifetime order), each at the lowest offset that doesn't overlap the allocations placed before it with an intersecting
+        //! lifetime, and returns the placement with the lowest peak.
+        static Result Pack(AZStd::span<const Allocation> allocations);
+
+    private:
+        static Result PlaceInOrder(AZStd::span<const Allocation> allocations, AZStd::span<const uint32_t> order);
+    };
+}
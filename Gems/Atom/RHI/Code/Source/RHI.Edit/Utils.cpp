@@ -20,6 +20,7 @@
 #include <AzCore/std/optional.h>
 #include <AzCore/std/string/regex.h>
 #include <AzCore/Math/Sha1.h>
+#include <AzCore/Math/Uuid.h>
 #include <AzCore/Platform.h>
 #include <AzCore/std/time.h>
 #include <AzCore/Settings/SettingsRegistry.h>
@@ -228,11 +229,9 @@ namespace AZ::RHI
         return combinedFile;
     }
 
-    bool ExecuteShaderCompiler(const AZStd::string& executablePath,
-                               const AZStd::string& parameters,
-                               const AZStd::string& shaderSourcePathForDebug,
-                               const AZStd::string& tempFolder,
-                               const char* toolNameForLog)
+    //! Resolves an executable path relative to the executable folder of the application.
+    //! Returns an empty string if the executable can't be found.
+    static AZStd::string GetExecutableAbsolutePath(const AZStd::string& executablePath)
     {
         AZStd::string executableAbsolutePath;
         if (AzFramework::StringFunc::Path::IsRelative(executablePath.c_str()))
@@ -244,7 +243,7 @@ namespace AZ::RHI
                 if (!executableFolder)
                 {
                     AZ_Error(ShaderPlatformInterfaceName, false, "Unable to determine application root.");
-                    return false;
+                    return {};
                 }
             }
 
@@ -258,6 +257,21 @@ namespace AZ::RHI
         if (!AZ::IO::SystemFile::Exists(executableAbsolutePath.c_str()))
         {
             AZ_Error(ShaderPlatformInterfaceName, false, "Executable not found: '%s'", executableAbsolutePath.c_str());
+            return {};
+        }
+
+        return executableAbsolutePath;
+    }
+
+    bool ExecuteShaderCompiler(const AZStd::string& executablePath,
+                               const AZStd::string& parameters,
+                               const AZStd::string& shaderSourcePathForDebug,
+                               const AZStd::string& tempFolder,
+                               const char* toolNameForLog)
+    {
+        const AZStd::string executableAbsolutePath = GetExecutableAbsolutePath(executablePath);
+        if (executableAbsolutePath.empty())
+        {
             return false;
         }
 
@@ -383,6 +397,116 @@ namespace AZ::RHI
         return true;
     }
 
+    AZStd::string GetCompiledShaderCacheFolder()
+    {
+        // Folder shared by the builders of every branch and machine that should reuse each other's shader compiler outputs.
+        static constexpr char CompiledShaderCachePathKey[] = "/O3DE/Atom/CompiledShaderCachePath";
+
+        AZStd::string cachePath;
+        if (auto setReg = AZ::Interface<SettingsRegistryInterface>::Get())
+        {
+            setReg->Get(cachePath, CompiledShaderCachePathKey);
+        }
+        return cachePath;
+    }
+
+    bool ExecuteShaderCompilerWithCache(const AZStd::string& executablePath,
+                                        const AZStd::string& parameters,
+                                        const AZStd::string& inputFilePath,
+                                        AZStd::span<const AZStd::string> outputFilePaths,
+                                        const AZStd::string& shaderSourcePathForDebug,
+                                        const AZStd::string& tempFolder,
+                                        const char* toolNameForLog)
+    {
+        const AZStd::string cacheFolder = GetCompiledShaderCacheFolder();
+        if (cacheFolder.empty())
+        {
+            return ExecuteShaderCompiler(executablePath, parameters, shaderSourcePathForDebug, tempFolder, toolNameForLog);
+        }
+
+        const AZStd::string executableAbsolutePath = GetExecutableAbsolutePath(executablePath);
+        auto inputFileLoadResult = LoadFileBytes(inputFilePath.c_str());
+        if (executableAbsolutePath.empty() || !inputFileLoadResult)
+        {
+            return ExecuteShaderCompiler(executablePath, parameters, shaderSourcePathForDebug, tempFolder, toolNameForLog);
+        }
+
+        // The job temp folder differs between builds of the same shader, so it's stripped from the paths in the parameters.
+        // The compiler is identified by its path and size, which changes with every compiler update we ship.
+        AZStd::string keyParameters = parameters;
+        AzFramework::StringFunc::Replace(keyParameters, tempFolder.c_str(), "", true);
+        const AZStd::string executableKey = AZStd::string::format("%s:%llu", executablePath.c_str(),
+            static_cast<unsigned long long>(AZ::IO::SystemFile::Length(executableAbsolutePath.c_str())));
+
+        AZ::Sha1 hasher;
+        hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(executableKey.data()), aznumeric_cast<unsigned>(executableKey.size() + 1));
+        hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(keyParameters.data()), aznumeric_cast<unsigned>(keyParameters.size() + 1));
+        hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(inputFileLoadResult.GetValue().data()), aznumeric_cast<unsigned>(inputFileLoadResult.GetValue().size()));
+        ArrayOfCharForSha1 digest;
+        hasher.GetDigest(reinterpret_cast<AZ::Sha1::DigestType>(digest));
+        const AZStd::string key = ByteToHexString(digest);
+
+        AZStd::vector<AZStd::string> cachedFilePaths;
+        cachedFilePaths.reserve(outputFilePaths.size());
+        bool cached = true;
+        for (size_t outputIndex = 0; outputIndex < outputFilePaths.size(); ++outputIndex)
+        {
+            AZStd::string cachedFilePath;
+            AzFramework::StringFunc::Path::Join(cacheFolder.c_str(), AZStd::string::format("%s/%s.%zu", key.substr(0, 2).c_str(), key.c_str(), outputIndex).c_str(), cachedFilePath);
+            cached = cached && AZ::IO::SystemFile::Exists(cachedFilePath.c_str());
+            cachedFilePaths.emplace_back(AZStd::move(cachedFilePath));
+        }
+
+        const auto copyFile = [](const AZStd::string& sourcePath, const AZStd::string& destinationPath)
+        {
+            auto loadResult = LoadFileBytes(sourcePath.c_str());
+            if (!loadResult)
+            {
+                return false;
+            }
+
+            AZ::IO::SystemFile file;
+            const int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+            return file.Open(destinationPath.c_str(), openMode) &&
+                file.Write(loadResult.GetValue().data(), loadResult.GetValue().size()) == loadResult.GetValue().size();
+        };
+
+        if (cached)
+        {
+            bool copied = true;
+            for (size_t outputIndex = 0; copied && outputIndex < outputFilePaths.size(); ++outputIndex)
+            {
+                copied = copyFile(cachedFilePaths[outputIndex], outputFilePaths[outputIndex]);
+            }
+
+            if (copied)
+            {
+                AZ_TracePrintf(ShaderPlatformInterfaceName, "%s outputs for '%s' found in the compiled shader cache (%s).\n", toolNameForLog, shaderSourcePathForDebug.c_str(), key.c_str());
+                return true;
+            }
+        }
+
+        if (!ExecuteShaderCompiler(executablePath, parameters, shaderSourcePathForDebug, tempFolder, toolNameForLog))
+        {
+            return false;
+        }
+
+        // Other builders may be storing the same entry, so each output is written to a unique file first and then renamed into place.
+        // Failing to store an entry isn't an error, the next build will just compile the shader again.
+        for (size_t outputIndex = 0; outputIndex < outputFilePaths.size(); ++outputIndex)
+        {
+            const AZStd::string stagingPath = cachedFilePaths[outputIndex] + "." + AZ::Uuid::CreateRandom().ToFixedString(false, false).c_str();
+            if (!copyFile(outputFilePaths[outputIndex], stagingPath) || !AZ::IO::SystemFile::Rename(stagingPath.c_str(), cachedFilePaths[outputIndex].c_str(), true))
+            {
+                AZ::IO::SystemFile::Delete(stagingPath.c_str());
+                AZ_Warning(ShaderPlatformInterfaceName, false, "Failed to store '%s' in the compiled shader cache.", outputFilePaths[outputIndex].c_str());
+                break;
+            }
+        }
+
+        return true;
+    }
+
     bool ReportMessages([[maybe_unused]] AZStd::string_view window, AZStd::string_view errorMessages, bool reportAsErrors)
     {
         if (errorMessages.empty())
@@ -13,17 +13,35 @@
 #include <Atom/RHI.Reflect/TransientBufferDescriptor.h>
 #include <Atom/RHI.Reflect/TransientImageDescriptor.h>
 #include <Atom/RHI/MemoryStatisticsBuilder.h>
+#include <Atom/RHI/TransientAttachmentPacker.h>
+#include <Atom/RHI.Reflect/Bits.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ::RHI
 {
+    AZ_CVAR(bool, r_transientAttachmentPacking, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Place the transient attachments of aliased heaps with offsets packed by lifetime for each frame graph topology, "
+        "instead of first fit in activation order.");
+
     void AliasedHeap::Begin(TransientAttachmentPoolCompileFlags compileFlags)
     {
         m_totalAllocations = 0;
         m_compileFlags = compileFlags;
         m_heapStats.m_watermarkSize = 0;
+        m_heapStats.m_unpackedWatermarkSize = 0;
         m_heapStats.m_attachments.clear();
         m_barrierTracker->Reset();
+
+        ++m_cycleIndex;
+        m_placementEvents.clear();
+        m_placementTopologyHash = 0;
+        m_placementPlanDiverged = false;
+        if (!r_transientAttachmentPacking)
+        {
+            m_activePlacementPlanIndex = InvalidPlacementPlanIndex;
+            m_placementPlans.clear();
+        }
     }
 
     void AliasedHeap::End()
@@ -31,6 +49,8 @@ namespace AZ::RHI
         AZ_Assert(m_activeAttachmentLookup.empty() && m_firstFitAllocator.GetAllocationCount() == 0,
             "There are still active allocations.");
 
+        UpdatePlacementPlan();
+
         if (RHI::CheckBitsAny(m_compileFlags, TransientAttachmentPoolCompileFlags::GatherStatistics))
         {
             AZStd::sort(m_heapStats.m_attachments.begin(), m_heapStats.m_attachments.end(),
@@ -95,6 +115,9 @@ namespace AZ::RHI
         m_cache.Clear();
         m_reverseLookupHash.clear();
         m_firstFitAllocator.Shutdown();
+        m_placementEvents.clear();
+        m_placementPlans.clear();
+        m_activePlacementPlanIndex = InvalidPlacementPlanIndex;
     }
 
     void AliasedHeap::ComputeFragmentation() const
@@ -111,7 +134,7 @@ namespace AZ::RHI
         ResourceMemoryRequirements memRequirements = GetDevice().GetResourceMemoryRequirements(descriptor.m_bufferDescriptor);
             
         const size_t alignmentInBytes = memRequirements.m_alignmentInBytes;
-        RHI::VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, alignmentInBytes);
+        RHI::VirtualAddress address = AllocatePlacement(descriptor.m_attachmentId, memRequirements.m_sizeInBytes, alignmentInBytes);
         if (address.IsNull())
         {
             return ResultCode::OutOfMemory;
@@ -181,6 +204,8 @@ namespace AZ::RHI
         attachment.m_scopeOffsetMin = scope.GetIndex();
         attachment.m_type = AliasedResourceType::Buffer;
 
+        RecordPlacementEvent(descriptor.m_attachmentId, memRequirements.m_sizeInBytes, alignmentInBytes, true);
+
         if (activatedBuffer)
         {
             *activatedBuffer = buffer;
@@ -223,17 +248,203 @@ namespace AZ::RHI
             m_barrierTracker->AddResource(aliasedResource);
         }
             
-        const VirtualAddress heapAddress{attachment.m_heapOffsetMin};
-        m_firstFitAllocator.DeAllocate(heapAddress);
-        m_firstFitAllocator.GarbageCollectForce();
+        // Placements of the active plan don't go through the first fit allocator.
+        if (m_activePlacementPlanIndex == InvalidPlacementPlanIndex)
+        {
+            const VirtualAddress heapAddress{attachment.m_heapOffsetMin};
+            m_firstFitAllocator.DeAllocate(heapAddress);
+            m_firstFitAllocator.GarbageCollectForce();
+        }
         m_activeAttachmentLookup.erase(findIter);
+
+        RecordPlacementEvent(attachmentId, 0, 0, false);
+    }
+
+    VirtualAddress AliasedHeap::AllocatePlacement(const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes)
+    {
+        if (m_activePlacementPlanIndex == InvalidPlacementPlanIndex)
+        {
+            return m_firstFitAllocator.Allocate(sizeInBytes, alignmentInBytes);
+        }
+
+        const PlacementPlan& plan = m_placementPlans[m_activePlacementPlanIndex];
+        const size_t eventIndex = m_placementEvents.size();
+        if (!m_placementPlanDiverged && eventIndex < plan.m_events.size())
+        {
+            const PlacementEvent placementEvent{ attachmentId, sizeInBytes, AZStd::max(alignmentInBytes, m_descriptor.m_alignment), true };
+            if (plan.m_events[eventIndex] == placementEvent)
+            {
+                // Every previous activation and deactivation matched the plan, so the active attachments are the ones
+                // the plan was packed with and the planned offset doesn't overlap any of them.
+                const size_t heapOffset = plan.m_offsets[eventIndex];
+                if (heapOffset + sizeInBytes <= m_descriptor.m_budgetInBytes)
+                {
+                    return VirtualAddress::CreateFromOffset(heapOffset);
+                }
+            }
+        }
+
+        m_placementPlanDiverged = true;
+        return AllocateLowestFit(sizeInBytes, alignmentInBytes);
+    }
+
+    VirtualAddress AliasedHeap::AllocateLowestFit(size_t sizeInBytes, size_t alignmentInBytes) const
+    {
+        struct Region
+        {
+            size_t m_begin;
+            size_t m_end;
+        };
+        AZStd::vector<Region> activeRegions;
+        activeRegions.reserve(m_activeAttachmentLookup.size());
+        for (const auto& activeAttachment : m_activeAttachmentLookup)
+        {
+            const TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments[activeAttachment.second.m_attachmentIndex];
+            activeRegions.push_back({ attachment.m_heapOffsetMin, attachment.m_heapOffsetMax + 1 });
+        }
+        AZStd::sort(activeRegions.begin(), activeRegions.end(), [](const Region& lhs, const Region& rhs) { return lhs.m_begin < rhs.m_begin; });
+
+        const size_t alignment = AZStd::max(alignmentInBytes, m_descriptor.m_alignment);
+        size_t heapOffset = 0;
+        for (const Region& region : activeRegions)
+        {
+            if (AlignUp(heapOffset, alignment) + sizeInBytes <= region.m_begin)
+            {
+                break;
+            }
+            heapOffset = AZStd::max(heapOffset, region.m_end);
+        }
+        heapOffset = AlignUp(heapOffset, alignment);
+
+        if (heapOffset + sizeInBytes > m_descriptor.m_budgetInBytes)
+        {
+            return VirtualAddress::CreateNull();
+        }
+        return VirtualAddress::CreateFromOffset(heapOffset);
+    }
+
+    void AliasedHeap::RecordPlacementEvent(const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes, bool isActivation)
+    {
+        // The first pass that computes the memory hint keeps first fit placement, so the hint remains an upper bound.
+        if (!r_transientAttachmentPacking || CheckBitsAny(m_compileFlags, TransientAttachmentPoolCompileFlags::DontAllocateResources))
+        {
+            return;
+        }
+
+        const PlacementEvent placementEvent{
+            attachmentId, sizeInBytes, isActivation ? AZStd::max(alignmentInBytes, m_descriptor.m_alignment) : 0, isActivation };
+
+        if (m_activePlacementPlanIndex != InvalidPlacementPlanIndex && !m_placementPlanDiverged)
+        {
+            const PlacementPlan& plan = m_placementPlans[m_activePlacementPlanIndex];
+            const size_t eventIndex = m_placementEvents.size();
+            m_placementPlanDiverged = eventIndex >= plan.m_events.size() || !(plan.m_events[eventIndex] == placementEvent);
+        }
+
+        AZStd::hash_combine(m_placementTopologyHash, attachmentId, sizeInBytes, placementEvent.m_alignmentInBytes, isActivation);
+        m_placementEvents.push_back(placementEvent);
+    }
+
+    void AliasedHeap::UpdatePlacementPlan()
+    {
+        // Heaps that didn't place anything this cycle (or that are only ended) keep their current plan.
+        if (m_placementEvents.empty())
+        {
+            return;
+        }
+
+        auto findPlan = [this]() -> uint32_t
+        {
+            for (uint32_t planIndex = 0; planIndex < m_placementPlans.size(); ++planIndex)
+            {
+                const PlacementPlan& plan = m_placementPlans[planIndex];
+                if (plan.m_topologyHash == m_placementTopologyHash && plan.m_events == m_placementEvents)
+                {
+                    return planIndex;
+                }
+            }
+            return InvalidPlacementPlanIndex;
+        };
+
+        uint32_t planIndex = findPlan();
+        if (planIndex == InvalidPlacementPlanIndex)
+        {
+            // Each activation lives until its deactivation, in placement event order.
+            AZStd::vector<TransientAttachmentPacker::Allocation> allocations;
+            AZStd::vector<uint32_t> allocationEventIndices;
+            AZStd::unordered_map<AttachmentId, uint32_t> activeAllocations;
+            const uint32_t lastEventIndex = static_cast<uint32_t>(m_placementEvents.size() - 1);
+            for (uint32_t eventIndex = 0; eventIndex <= lastEventIndex; ++eventIndex)
+            {
+                const PlacementEvent& placementEvent = m_placementEvents[eventIndex];
+                if (placementEvent.m_isActivation)
+                {
+                    activeAllocations[placementEvent.m_attachmentId] = static_cast<uint32_t>(allocations.size());
+                    allocations.push_back({ placementEvent.m_sizeInBytes, placementEvent.m_alignmentInBytes, eventIndex, lastEventIndex });
+                    allocationEventIndices.push_back(eventIndex);
+                }
+                else if (auto findIter = activeAllocations.find(placementEvent.m_attachmentId); findIter != activeAllocations.end())
+                {
+                    allocations[findIter->second].m_lifetimeEnd = eventIndex;
+                    activeAllocations.erase(findIter);
+                }
+            }
+
+            const TransientAttachmentPacker::Result inOrderResult = TransientAttachmentPacker::PackInOrder(allocations);
+            const TransientAttachmentPacker::Result packedResult = TransientAttachmentPacker::Pack(allocations);
+
+            PlacementPlan plan;
+            plan.m_topologyHash = m_placementTopologyHash;
+            plan.m_events = m_placementEvents;
+            plan.m_offsets.resize(m_placementEvents.size(), 0);
+            for (size_t allocationIndex = 0; allocationIndex < allocations.size(); ++allocationIndex)
+            {
+                plan.m_offsets[allocationEventIndices[allocationIndex]] = packedResult.m_offsets[allocationIndex];
+            }
+            plan.m_inOrderPeakInBytes = inOrderResult.m_peakInBytes;
+            plan.m_packedPeakInBytes = packedResult.m_peakInBytes;
+
+            if (plan.m_packedPeakInBytes < plan.m_inOrderPeakInBytes)
+            {
+                AZ_TracePrintf("AliasedHeap", "Packed the %zu transient attachments of heap %s from %zu to %zu bytes.\n",
+                    allocations.size(), GetName().GetCStr(), plan.m_inOrderPeakInBytes, plan.m_packedPeakInBytes);
+            }
+
+            // Replace the least recently used plan once the cache is full.
+            if (m_placementPlans.size() < PlacementPlanCacheSize)
+            {
+                planIndex = static_cast<uint32_t>(m_placementPlans.size());
+                m_placementPlans.push_back(AZStd::move(plan));
+            }
+            else
+            {
+                planIndex = 0;
+                for (uint32_t index = 1; index < m_placementPlans.size(); ++index)
+                {
+                    if (m_placementPlans[index].m_lastUsedCycle < m_placementPlans[planIndex].m_lastUsedCycle)
+                    {
+                        planIndex = index;
+                    }
+                }
+                m_placementPlans[planIndex] = AZStd::move(plan);
+            }
+        }
+
+        PlacementPlan& plan = m_placementPlans[planIndex];
+        plan.m_lastUsedCycle = m_cycleIndex;
+        m_heapStats.m_unpackedWatermarkSize = plan.m_inOrderPeakInBytes;
+
+        // The next cycle uses the plan of this topology, assuming the frame graph repeats. Plans that don't beat first fit
+        // are kept so the topology isn't packed again, but placement goes back to the first fit allocator.
+        m_activePlacementPlanIndex = plan.m_packedPeakInBytes < plan.m_inOrderPeakInBytes ? planIndex : InvalidPlacementPlanIndex;
+        m_placementEvents.clear();
     }
 
     ResultCode AliasedHeap::ActivateImage(const RHI::TransientImageDescriptor& descriptor, Scope& scope, DeviceImage** activatedImage)
     {
         ResourceMemoryRequirements memRequirements = GetDevice().GetResourceMemoryRequirements(descriptor.m_imageDescriptor);
 
-        VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes);
+        VirtualAddress address = AllocatePlacement(descriptor.m_attachmentId, memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes);
         if (address.IsNull())
         {
             return ResultCode::OutOfMemory;
@@ -307,6 +518,8 @@ namespace AZ::RHI
         attachment.m_type = CheckBitsAny(descriptor.m_imageDescriptor.m_bindFlags, ImageBindFlags::Color | ImageBindFlags::DepthStencil) ?
             AliasedResourceType::RenderTarget : AliasedResourceType::Image;
 
+        RecordPlacementEvent(descriptor.m_attachmentId, sizeInBytes, memRequirements.m_alignmentInBytes, true);
+
         if (activatedImage)
         {
             *activatedImage = image;
@@ -17,6 +17,9 @@ namespace AZ::RHI
         if (m_layout->GetDataSize() > 0)
         {
             m_constantData.resize(m_layout->GetDataSize());
+
+            // The zero initialized data was never uploaded.
+            m_dirtyInterval = Interval(0, m_layout->GetDataSize());
         }
     }
 
@@ -103,6 +106,7 @@ namespace AZ::RHI
         {
             const Interval interval = GetLayout()->GetInterval(inputIndex);
             memcpy(&m_constantData[interval.m_min + byteOffset], bytes, byteCount);
+            MarkDirty(Interval(aznumeric_cast<uint32_t>(interval.m_min + byteOffset), aznumeric_cast<uint32_t>(interval.m_min + byteOffset + byteCount)));
             return true;
         }
         return false;
@@ -113,6 +117,7 @@ namespace AZ::RHI
         if (ValidateConstantBufferAccess(0, byteCount))
         {
             memcpy(m_constantData.data(), bytes, byteCount);
+            MarkDirty(Interval(0, aznumeric_cast<uint32_t>(byteCount)));
             return true;
         }
         return false;
@@ -123,6 +128,7 @@ namespace AZ::RHI
         if (ValidateConstantBufferAccess(byteOffset, byteCount))
         {
             memcpy(&m_constantData[byteOffset], bytes, byteCount);
+            MarkDirty(Interval(aznumeric_cast<uint32_t>(byteOffset), aznumeric_cast<uint32_t>(byteOffset + byteCount)));
             return true;
         }
         return false;
@@ -185,6 +191,7 @@ namespace AZ::RHI
         {
             // Store the matrix into row major order
             const Interval interval = GetLayout()->GetInterval(inputIndex);
+            MarkDirty(interval);
             float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             transform.StoreToRowMajorFloat12(matrixValue);
 
@@ -201,6 +208,7 @@ namespace AZ::RHI
         {
             // Store the matrix into row major order
             const Interval interval = GetLayout()->GetInterval(inputIndex);
+            MarkDirty(interval);
             float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             value.StoreToRowMajorFloat12(matrixValue);
 
@@ -217,6 +225,7 @@ namespace AZ::RHI
         {
             // Store the matrix into row major order
             const Interval interval = GetLayout()->GetInterval(inputIndex);
+            MarkDirty(interval);
             float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             value.StoreToRowMajorFloat16(matrixValue);
 
@@ -233,6 +242,7 @@ namespace AZ::RHI
         if (ValidateConstantAccess(inputIndex, ValidateConstantAccessExpect::Complete, 0, aznumeric_caster(sizeOfVector2)))
         {
             const Interval interval = GetLayout()->GetInterval(inputIndex);
+            MarkDirty(interval);
             float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             value.StoreToFloat2(vectorValue);
 
@@ -249,6 +259,7 @@ namespace AZ::RHI
         if (ValidateConstantAccess(inputIndex, ValidateConstantAccessExpect::Complete, 0, sizeInBytes))
         {
             const Interval interval = GetLayout()->GetInterval(inputIndex);
+            MarkDirty(interval);
             float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             value.StoreToFloat3(vectorValue);
 
@@ -264,6 +275,7 @@ namespace AZ::RHI
         if (ValidateConstantAccess(inputIndex, ValidateConstantAccessExpect::Complete, 0, aznumeric_caster(sizeOfVector4)))
         {
             const Interval interval = GetLayout()->GetInterval(inputIndex);
+            MarkDirty(interval);
             float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             value.StoreToFloat4(vectorValue);
 
@@ -279,6 +291,7 @@ namespace AZ::RHI
         if (ValidateConstantAccess(inputIndex, ValidateConstantAccessExpect::Complete, 0, aznumeric_caster(sizeOfColor)))
         {
             const Interval interval = GetLayout()->GetInterval(inputIndex);
+            MarkDirty(interval);
             float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             value.StoreToFloat4(vectorValue);
 
@@ -421,6 +434,34 @@ namespace AZ::RHI
         return AZStd::span<const uint8_t>(&m_constantData[interval.m_min], interval.m_max - interval.m_min);
     }
 
+    Interval ConstantsData::GetDirtyInterval() const
+    {
+        return m_dirtyInterval;
+    }
+
+    void ConstantsData::ResetDirtyInterval()
+    {
+        m_dirtyInterval = Interval();
+    }
+
+    void ConstantsData::MarkDirty(const Interval& interval)
+    {
+        if (interval.m_min >= interval.m_max)
+        {
+            return;
+        }
+
+        if (m_dirtyInterval.m_min >= m_dirtyInterval.m_max)
+        {
+            m_dirtyInterval = interval;
+        }
+        else
+        {
+            m_dirtyInterval.m_min = AZStd::min(m_dirtyInterval.m_min, interval.m_min);
+            m_dirtyInterval.m_max = AZStd::max(m_dirtyInterval.m_max, interval.m_max);
+        }
+    }
+
     AZStd::span<const uint8_t> ConstantsData::GetConstantData() const
     {
         return m_constantData;
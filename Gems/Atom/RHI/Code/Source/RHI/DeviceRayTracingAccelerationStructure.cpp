@@ -135,6 +135,13 @@ namespace AZ::RHI
         return this;
     }
 
+    DeviceRayTracingTlasDescriptor* DeviceRayTracingTlasDescriptor::BuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags& buildFlags)
+    {
+        AZ_Assert(!m_buildContext, "BuildFlags property can only be added to the top level");
+        m_buildFlags = buildFlags;
+        return this;
+    }
+
     RHI::Ptr<RHI::DeviceRayTracingBlas> DeviceRayTracingBlas::CreateRHIRayTracingBlas()
     {
         RHI::Ptr<RHI::DeviceRayTracingBlas> rayTracingBlas = RHI::Factory::Get().CreateRayTracingBlas();
@@ -153,6 +160,23 @@ namespace AZ::RHI
         return resultCode;
     }
 
+    ResultCode DeviceRayTracingBlas::CreateCompactedBuffers(Device& device, const DeviceRayTracingBlas& sourceBlas, const DeviceRayTracingBufferPools& rayTracingBufferPools)
+    {
+        if (sourceBlas.GetCompactedSizeInBytes() == 0)
+        {
+            AZ_Error("DeviceRayTracingBlas", false, "The source BLAS has no compacted size, it must be built with ENABLE_COMPACTION first");
+            return ResultCode::InvalidOperation;
+        }
+
+        ResultCode resultCode = CreateCompactedBuffersInternal(device, sourceBlas, rayTracingBufferPools);
+        if (resultCode == ResultCode::Success)
+        {
+            DeviceObject::Init(device);
+            m_geometries = sourceBlas.m_geometries;
+        }
+        return resultCode;
+    }
+
     RHI::Ptr<RHI::DeviceRayTracingTlas> DeviceRayTracingTlas::CreateRHIRayTracingTlas()
     {
         RHI::Ptr<RHI::DeviceRayTracingTlas> rayTracingTlas = RHI::Factory::Get().CreateRayTracingTlas();
@@ -169,4 +193,13 @@ namespace AZ::RHI
         }
         return resultCode;
     }
+
+    ResultCode DeviceRayTracingTlas::UpdateBuffers(const DeviceRayTracingTlasDescriptor* descriptor, const DeviceRayTracingBufferPools& rayTracingBufferPools)
+    {
+        if (!IsInitialized())
+        {
+            return ResultCode::InvalidOperation;
+        }
+        return UpdateBuffersInternal(GetDevice(), descriptor, rayTracingBufferPools);
+    }
 }
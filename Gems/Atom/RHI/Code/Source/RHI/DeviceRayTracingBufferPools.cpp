@@ -55,6 +55,18 @@ namespace AZ::RHI
         return m_tlasBufferPool;
     }
 
+    const RHI::Ptr<RHI::DeviceBufferPool>& DeviceRayTracingBufferPools::GetCompactedSizeBufferPool() const
+    {
+        AZ_Assert(m_initialized, "DeviceRayTracingBufferPools was not initialized");
+        return m_compactedSizeBufferPool;
+    }
+
+    const RHI::Ptr<RHI::DeviceBufferPool>& DeviceRayTracingBufferPools::GetCompactedSizeReadbackBufferPool() const
+    {
+        AZ_Assert(m_initialized, "DeviceRayTracingBufferPools was not initialized");
+        return m_compactedSizeReadbackBufferPool;
+    }
+
     void DeviceRayTracingBufferPools::Init(RHI::Ptr<RHI::Device>& device)
     {
         if (m_initialized)
@@ -134,6 +146,31 @@ namespace AZ::RHI
             AZ_Assert(resultCode == RHI::ResultCode::Success, "Failed to initialize ray tracing TLAS buffer pool");
         }
 
+        // create compacted size buffer pool
+        {
+            RHI::BufferPoolDescriptor bufferPoolDesc;
+            bufferPoolDesc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Device;
+            bufferPoolDesc.m_bindFlags = GetCompactedSizeBufferBindFlags();
+
+            m_compactedSizeBufferPool = RHI::Factory::Get().CreateBufferPool();
+            m_compactedSizeBufferPool->SetName(Name("RayTracingCompactedSizeBufferPool"));
+            [[maybe_unused]] RHI::ResultCode resultCode = m_compactedSizeBufferPool->Init(*device, bufferPoolDesc);
+            AZ_Assert(resultCode == RHI::ResultCode::Success, "Failed to initialize ray tracing compacted size buffer pool");
+        }
+
+        // create compacted size readback buffer pool
+        {
+            RHI::BufferPoolDescriptor bufferPoolDesc;
+            bufferPoolDesc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Host;
+            bufferPoolDesc.m_hostMemoryAccess = RHI::HostMemoryAccess::Read;
+            bufferPoolDesc.m_bindFlags = GetCompactedSizeReadbackBufferBindFlags();
+
+            m_compactedSizeReadbackBufferPool = RHI::Factory::Get().CreateBufferPool();
+            m_compactedSizeReadbackBufferPool->SetName(Name("RayTracingCompactedSizeReadbackBufferPool"));
+            [[maybe_unused]] RHI::ResultCode resultCode = m_compactedSizeReadbackBufferPool->Init(*device, bufferPoolDesc);
+            AZ_Assert(resultCode == RHI::ResultCode::Success, "Failed to initialize ray tracing compacted size readback buffer pool");
+        }
+
         m_initialized = true;
     }
 }
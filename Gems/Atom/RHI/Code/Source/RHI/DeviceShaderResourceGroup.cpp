@@ -53,9 +53,26 @@ namespace AZ::RHI
         return m_data;
     }
 
+    namespace
+    {
+        Interval MergeIntervals(const Interval& lhs, const Interval& rhs)
+        {
+            if (lhs.m_min >= lhs.m_max)
+            {
+                return rhs;
+            }
+            if (rhs.m_min >= rhs.m_max)
+            {
+                return lhs;
+            }
+            return Interval(AZStd::min(lhs.m_min, rhs.m_min), AZStd::max(lhs.m_max, rhs.m_max));
+        }
+    }
+
     void DeviceShaderResourceGroup::SetData(const DeviceShaderResourceGroupData& data)
     {
         m_data = data;
+        m_pendingConstantDirtyInterval = MergeIntervals(m_pendingConstantDirtyInterval, data.GetConstantsData().GetDirtyInterval());
         uint32_t sourceUpdateMask = data.GetUpdateMask();
             
         //RHI has it's own copy of update mask that is reset after Compile is called m_updateMaskResetLatency times.
@@ -106,6 +123,28 @@ namespace AZ::RHI
         m_resourceTypeIteration[static_cast<uint32_t>(resourceType)] = 0;
     }
 
+    void DeviceShaderResourceGroup::BeginConstantDataCompile()
+    {
+        m_constantDirtyIntervalIndex = (m_constantDirtyIntervalIndex + 1) % RHI::Limits::Device::FrameCountMax;
+        m_constantDirtyIntervals[m_constantDirtyIntervalIndex] = m_pendingConstantDirtyInterval;
+        m_pendingConstantDirtyInterval = Interval();
+    }
+
+    void DeviceShaderResourceGroup::InvalidateConstantData()
+    {
+        m_constantDirtyIntervals.fill(Interval(0, static_cast<uint32_t>(m_data.GetConstantData().size())));
+    }
+
+    Interval DeviceShaderResourceGroup::GetConstantDataDirtyInterval() const
+    {
+        Interval dirtyInterval;
+        for (const Interval& interval : m_constantDirtyIntervals)
+        {
+            dirtyInterval = MergeIntervals(dirtyInterval, interval);
+        }
+        return dirtyInterval;
+    }
+
     HashValue64 DeviceShaderResourceGroup::GetViewHash(const AZ::Name& viewName)
     {
         return m_viewHash[viewName];
@@ -390,6 +390,7 @@ namespace AZ::RHI
     void DeviceShaderResourceGroupData::ResetUpdateMask()
     {
         m_updateMask = 0;
+        m_constantsData.ResetDirtyInterval();
     }
     
     void DeviceShaderResourceGroupData::SetBindlessViews(
@@ -70,6 +70,7 @@ namespace AZ::RHI
 
             // Pre-initialize the data so that we can build view diffs later.
             group.m_data = DeviceShaderResourceGroupData(layout);
+            group.InvalidateConstantData();
 
             // Cache off the binding slot for one less indirection.
             group.m_bindingSlot = layout->GetBindingSlot();
@@ -337,6 +338,7 @@ namespace AZ::RHI
             {
                 shaderResourceGroup.EnableRhiResourceTypeCompilation(static_cast<DeviceShaderResourceGroupData::ResourceTypeMask>(AZ_BIT(i)));
             }
+            shaderResourceGroup.InvalidateConstantData();
         }
 
         // Modify m_rhiUpdateMask in case a view was modified. This can happen if a view is invalidated
@@ -345,6 +347,7 @@ namespace AZ::RHI
         // Check if any part of the Srg was updated before trying to compile it
         if (shaderResourceGroup.IsAnyResourceTypeUpdated())
         {
+            shaderResourceGroup.BeginConstantDataCompile();
             ResultCode resultCode = CompileGroupInternal(shaderResourceGroup, shaderResourceGroupData);
                 
             //Reset update mask if the latency check has been fulfilled
@@ -207,6 +207,18 @@ namespace AZ::RHI
         }
     }
 
+    void DeviceSwapChain::WaitForPresentLatency()
+    {
+        if (!m_descriptor.m_isLowLatency || m_images.empty())
+        {
+            return;
+        }
+
+        // Shows up in the profiler as the time the CPU spends waiting for the display
+        AZ_PROFILE_SCOPE(RHI, "DeviceSwapChain: WaitForPresentLatency");
+        WaitForPresentLatencyInternal();
+    }
+
     RHI::XRRenderingInterface* DeviceSwapChain::GetXRSystem() const
     {
         return m_xrSystem;
@@ -349,11 +349,30 @@ namespace AZ::RHI
         m_currentScope->m_estimatedItemCount = itemCount;
     }
 
+    void FrameGraph::SetEstimatedItemCosts(AZStd::span<const uint32_t> itemCosts)
+    {
+        m_currentScope->m_estimatedItemCount = static_cast<uint32_t>(itemCosts.size());
+
+        AZStd::vector<uint32_t>& costOffsets = m_currentScope->m_estimatedItemCostOffsets;
+        costOffsets.resize(itemCosts.size());
+        uint32_t costTotal = 0;
+        for (size_t i = 0; i < itemCosts.size(); ++i)
+        {
+            costTotal += itemCosts[i];
+            costOffsets[i] = costTotal;
+        }
+    }
+
     void FrameGraph::SetHardwareQueueClass(HardwareQueueClass hardwareQueueClass)
     {
         m_currentScope->m_hardwareQueueClass = hardwareQueueClass;
     }
 
+    void FrameGraph::SetAsyncComputeAllowed(bool asyncComputeAllowed)
+    {
+        m_currentScope->m_asyncComputeAllowed = asyncComputeAllowed;
+    }
+
     void FrameGraph::SetGroupId(const ScopeGroupId& groupId)
     {
         AZ_Assert(m_currentScope, "Current scope is null while setting the group id");
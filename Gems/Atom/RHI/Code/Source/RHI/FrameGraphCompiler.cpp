@@ -17,12 +17,16 @@
 #include <Atom/RHI/Scope.h>
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
 
 namespace AZ::RHI
 {
+    AZ_CVAR(bool, r_autoAsyncCompute, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Move the scopes that allow async compute to the compute queue when they can overlap with independent graphics work.");
+
     ResultCode FrameGraphCompiler::Init()
     {
         const ResultCode resultCode = InitInternal();
@@ -153,6 +157,11 @@ namespace AZ::RHI
             }
         }
 
+        if (!disableAsyncQueues && r_autoAsyncCompute)
+        {
+            AssignAsyncComputeScopes(frameGraph);
+        }
+
         // Build the per-queue graph by first linking scopes on the same queue
         // with their neighbors. This is because the queue is going to execute serially.
         {
@@ -255,6 +264,101 @@ namespace AZ::RHI
         }
     }
 
+    void FrameGraphCompiler::AssignAsyncComputeScopes(FrameGraph& frameGraph)
+    {
+        AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: AssignAsyncComputeScopes");
+
+        const AZStd::vector<Scope*>& scopes = frameGraph.GetScopes();
+        for (Scope* scope : scopes)
+        {
+            if (!CanRunOnComputeQueue(*scope))
+            {
+                continue;
+            }
+
+            // Scopes are topologically sorted, so every scope between the last producer and the first consumer of this scope
+            // is independent from it, and is free to run at the same time on another queue.
+            uint32_t windowBegin = 0;
+            for (const Scope* producer : frameGraph.GetProducers(*scope))
+            {
+                windowBegin = AZStd::max(windowBegin, producer->GetIndex() + 1);
+            }
+
+            uint32_t windowEnd = aznumeric_cast<uint32_t>(scopes.size());
+            for (const Scope* consumer : frameGraph.GetConsumers(*scope))
+            {
+                windowEnd = AZStd::min(windowEnd, consumer->GetIndex());
+            }
+
+            uint32_t overlapCount = 0;
+            for (uint32_t index = windowBegin; index < windowEnd; ++index)
+            {
+                const Scope* otherScope = scopes[index];
+                if (otherScope != scope && otherScope->GetHardwareQueueClass() == HardwareQueueClass::Graphics &&
+                    otherScope->GetDeviceIndex() == scope->GetDeviceIndex())
+                {
+                    ++overlapCount;
+                }
+            }
+
+            if (overlapCount > 0)
+            {
+                scope->m_hardwareQueueClass = HardwareQueueClass::Compute;
+                scope->m_asyncComputeOverlapCount = overlapCount;
+            }
+        }
+    }
+
+    bool FrameGraphCompiler::CanRunOnComputeQueue(const Scope& scope) const
+    {
+        if (!scope.m_asyncComputeAllowed || scope.GetHardwareQueueClass() != HardwareQueueClass::Graphics ||
+            !scope.m_swapChainsToPresent.empty() || !scope.m_resolveAttachments.empty() || !scope.m_resourcePoolResolves.empty())
+        {
+            return false;
+        }
+
+        // Pipeline statistics aren't available on every compute queue
+        if (!scope.m_queryPools.empty())
+        {
+            return false;
+        }
+
+        const ScopeAttachmentStage computeStages =
+            ScopeAttachmentStage::ComputeShader | ScopeAttachmentStage::Copy | ScopeAttachmentStage::DrawIndirect;
+        for (const ScopeAttachment* scopeAttachment : scope.GetAttachments())
+        {
+            const ScopeAttachmentUsage usage = scopeAttachment->GetUsage();
+            if (usage != ScopeAttachmentUsage::Shader && usage != ScopeAttachmentUsage::Copy && usage != ScopeAttachmentUsage::Indirect)
+            {
+                return false;
+            }
+
+            const ScopeAttachmentStage stage = scopeAttachment->GetStage();
+            if (stage == ScopeAttachmentStage::Uninitialized || !CheckBitsAll(computeStages, stage))
+            {
+                return false;
+            }
+        }
+
+        // The resources must be usable from the compute queue without an ownership transfer
+        for (const ImageScopeAttachment* imageAttachment : scope.GetImageAttachments())
+        {
+            if (!CheckBitsAll(imageAttachment->GetFrameAttachment().GetImageDescriptor().m_sharedQueueMask, HardwareQueueClassMask::Compute))
+            {
+                return false;
+            }
+        }
+
+        for (const BufferScopeAttachment* bufferAttachment : scope.GetBufferAttachments())
+        {
+            if (!CheckBitsAll(bufferAttachment->GetFrameAttachment().GetBufferDescriptor().m_sharedQueueMask, HardwareQueueClassMask::Compute))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     void FrameGraphCompiler::ExtendTransientAttachmentAsyncQueueLifetimes(
         FrameGraph& frameGraph,
         FrameSchedulerCompileFlags compileFlags)
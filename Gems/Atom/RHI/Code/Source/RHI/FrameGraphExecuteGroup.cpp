@@ -8,6 +8,7 @@
 #include <Atom/RHI/FrameGraphExecuteGroup.h>
 #include <Atom/RHI/DeviceBuffer.h>
 #include <Atom/RHI/DeviceImage.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ::RHI
 {
@@ -43,15 +44,33 @@ namespace AZ::RHI
         descriptor.m_commandListCount = request.m_commandListCount;
 
         // build the execute contexts
-        // Note: each context includes a submission range, with the number of items in range equal to (submitCount / commandListCount)
-        uint32_t submitCount = request.m_submitCount;
-        uint32_t commandListCount = request.m_commandListCount;
-        for (uint32_t i = 0; i < request.m_commandListCount; ++i)
+        // Note: each context includes a submission range, with the number of items in range equal to (submitCount / commandListCount),
+        // or, when per submit costs are provided, with the cost of the items in range equal to (totalCost / commandListCount).
+        const uint32_t submitCount = request.m_submitCount;
+        const uint32_t commandListCount = request.m_commandListCount;
+        const AZStd::span<const uint32_t> costOffsets = request.m_submitCostOffsets;
+        const bool balanceByCost = submitCount > 0 && costOffsets.size() == submitCount && costOffsets.back() > 0;
+        const uint64_t totalCost = balanceByCost ? costOffsets.back() : 0;
+
+        uint32_t startIndex = 0;
+        for (uint32_t i = 0; i < commandListCount; ++i)
         {
+            uint32_t endIndex = ((i + 1) * submitCount) / commandListCount;
+            if (balanceByCost)
+            {
+                // The range ends after the first item whose running cost reaches this command list's share of the total
+                const uint64_t targetCost = ((i + 1) * totalCost) / commandListCount;
+                const auto splitIter = AZStd::lower_bound(costOffsets.begin() + startIndex, costOffsets.end(), targetCost,
+                    [](uint32_t costOffset, uint64_t cost) { return costOffset < cost; });
+                endIndex = (i + 1 == commandListCount) ? submitCount
+                                                       : AZStd::min(static_cast<uint32_t>(splitIter - costOffsets.begin()) + 1, submitCount);
+            }
+
             descriptor.m_commandListIndex = i;
             descriptor.m_commandList = request.m_commandLists[i];
-            descriptor.m_submitRange = { (i * submitCount) / commandListCount, ((i + 1) * submitCount) / commandListCount };
+            descriptor.m_submitRange = { startIndex, endIndex };
             m_contexts.emplace_back(descriptor);
+            startIndex = endIndex;
         }
     }
 
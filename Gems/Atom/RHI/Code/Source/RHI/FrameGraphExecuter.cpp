@@ -61,6 +61,11 @@ namespace AZ::RHI
         EndInternal();
     }
 
+    FrameGraphExecuteGroup* FrameGraphExecuter::GetGroup(uint32_t groupIndex)
+    {
+        return m_groups[groupIndex].get();
+    }
+
     FrameGraphExecuteGroup* FrameGraphExecuter::BeginGroup(uint32_t groupIndex)
     {
         FrameGraphExecuteGroup& group = *m_groups[groupIndex];
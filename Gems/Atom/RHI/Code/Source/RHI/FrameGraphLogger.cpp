@@ -45,6 +45,21 @@ namespace AZ::RHI
         AZ_Printf("FrameGraph", "\t\tImported Swapchains: %d\n", attachmentDatabase.GetSwapChainAttachments().size());
         AZ_Printf("FrameGraph", "\tScope Attachment Count: %d\n", scopeAttachmentCount);
 
+        uint32_t computeScopeCount = 0;
+        uint32_t autoAsyncComputeScopeCount = 0;
+        uint32_t overlappedGraphicsScopeCount = 0;
+        for (const Scope* scope : frameGraph.GetScopes())
+        {
+            if (scope->GetHardwareQueueClass() == HardwareQueueClass::Compute)
+            {
+                ++computeScopeCount;
+                autoAsyncComputeScopeCount += scope->GetAsyncComputeOverlapCount() > 0 ? 1 : 0;
+                overlappedGraphicsScopeCount += scope->GetAsyncComputeOverlapCount();
+            }
+        }
+        AZ_Printf("FrameGraph", "\tCompute Queue Scopes: %u (%u moved by the compiler, overlapping %u graphics scopes)\n",
+            computeScopeCount, autoAsyncComputeScopeCount, overlappedGraphicsScopeCount);
+
         if (logVerbosity != FrameSchedulerLogVerbosity::Detail)
         {
             return;
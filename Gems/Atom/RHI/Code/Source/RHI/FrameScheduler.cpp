@@ -30,6 +30,7 @@
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/time.h>
 
 namespace AZ::RHI
@@ -227,6 +228,20 @@ namespace AZ::RHI
                 FrameEventBus::Broadcast(&FrameEventBus::Events::OnFrameCompileEnd, *m_frameGraph);
             }
 
+            m_asyncComputeStatistics = {};
+            for (const Scope* scope : m_frameGraph->GetScopes())
+            {
+                if (scope->GetHardwareQueueClass() == HardwareQueueClass::Compute)
+                {
+                    ++m_asyncComputeStatistics.m_computeScopeCount;
+                    if (scope->GetAsyncComputeOverlapCount() > 0)
+                    {
+                        ++m_asyncComputeStatistics.m_autoAsyncComputeScopeCount;
+                        m_asyncComputeStatistics.m_overlappedGraphicsScopeCount += scope->GetAsyncComputeOverlapCount();
+                    }
+                }
+            }
+
             FrameGraphLogger::Log(*m_frameGraph, compileRequest.m_logVerbosity);
 
             // Builds the scope execution schedule using the compiled graph.
@@ -306,27 +321,37 @@ namespace AZ::RHI
 
                 if (m_compileRequest.m_jobPolicy == JobPolicy::Parallel)
                 {
-                    // Iterate over each SRG pool and fork jobs to compile SRGs.
-                    const uint32_t compilesPerJob = m_compileRequest.m_shaderResourceGroupCompilesPerJob;
+                    // Begin compiling every pool first, so the compiles of all the pools are partitioned together.
+                    AZStd::vector<AZStd::pair<DeviceShaderResourceGroupPool*, uint32_t>> poolCompiles;
+                    uint32_t totalCompiles = 0;
+                    const auto compileGroupsBeginFunction = [&poolCompiles, &totalCompiles](DeviceShaderResourceGroupPool* srgPool)
+                    {
+                        srgPool->CompileGroupsBegin();
+                        const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
+                        poolCompiles.emplace_back(srgPool, compilesInPool);
+                        totalCompiles += compilesInPool;
+                    };
+
+                    resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(
+                        compileGroupsBeginFunction);
+
+                    const uint32_t compilesPerJob = GetShaderResourceGroupCompilesPerJob(totalCompiles);
                     if (m_taskGraphActive && m_taskGraphActive->IsTaskGraphActive())
                     {
                         AZ::TaskGraph taskGraph{ "SRG Compilation" };
+                        AZ::TaskDescriptor srgCompileDesc{ "SrgCompile", "Graphics" };
+                        AZ::TaskDescriptor srgCompileEndDesc{ "SrgCompileEnd", "Graphics" };
 
-                        const auto compileIntervalsFunction = [compilesPerJob, &taskGraph](DeviceShaderResourceGroupPool* srgPool)
+                        for (const auto& [srgPool, compilesInPool] : poolCompiles)
                         {
-                            srgPool->CompileGroupsBegin();
-                            const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
-                            const uint32_t jobCount = AZ::DivideAndRoundUp(compilesInPool, compilesPerJob);
-                            AZ::TaskDescriptor srgCompileDesc{ "SrgCompile", "Graphics" };
-                            AZ::TaskDescriptor srgCompileEndDesc{ "SrgCompileEnd", "Graphics" };
-
                             auto srgCompileEndTask = taskGraph.AddTask(
                                 srgCompileEndDesc,
-                                [srgPool]()
+                                [srgPool = srgPool]()
                                 {
                                     srgPool->CompileGroupsEnd();
                                 });
 
+                            const uint32_t jobCount = AZ::DivideAndRoundUp(compilesInPool, compilesPerJob);
                             for (uint32_t i = 0; i < jobCount; ++i)
                             {
                                 Interval interval;
@@ -335,17 +360,15 @@ namespace AZ::RHI
 
                                 auto compileTask = taskGraph.AddTask(
                                     srgCompileDesc,
-                                    [srgPool, interval]()
+                                    [srgPool = srgPool, interval]()
                                     {
                                         AZ_PROFILE_SCOPE(RHI, "FrameScheduler : compileGroupsForIntervalLambda");
                                         srgPool->CompileGroupsForInterval(interval);
                                     });
                                 compileTask.Precedes(srgCompileEndTask);
                             }
-                        };
+                        }
 
-                        resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileIntervalsFunction)>(
-                            AZStd::move(compileIntervalsFunction));
                         if (!taskGraph.IsEmpty())
                         {
                             AZ::TaskGraphEvent finishedEvent{ "SRG Compile Wait" };
@@ -355,29 +378,19 @@ namespace AZ::RHI
                     }
                     else // use Job system
                     {
-                        const auto compileGroupsBeginFunction = [](DeviceShaderResourceGroupPool* srgPool)
-                        {
-                            srgPool->CompileGroupsBegin();
-                        };
-
-                        resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsBeginFunction)>(
-                            compileGroupsBeginFunction);
-
                         // Iterate over each SRG pool and fork jobs to compile SRGs.
                         AZ::JobCompletion jobCompletion;
 
-                        const auto compileIntervalsFunction = [compilesPerJob, &jobCompletion](DeviceShaderResourceGroupPool* srgPool)
+                        for (const auto& [srgPool, compilesInPool] : poolCompiles)
                         {
-                            const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
                             const uint32_t jobCount = AZ::DivideAndRoundUp(compilesInPool, compilesPerJob);
-
                             for (uint32_t i = 0; i < jobCount; ++i)
                             {
                                 Interval interval;
                                 interval.m_min = i * compilesPerJob;
                                 interval.m_max = AZStd::min(interval.m_min + compilesPerJob, compilesInPool);
 
-                                const auto compileGroupsForIntervalLambda = [srgPool, interval]()
+                                const auto compileGroupsForIntervalLambda = [srgPool = srgPool, interval]()
                                 {
                                     AZ_PROFILE_SCOPE(RHI, "FrameScheduler : compileGroupsForIntervalLambda");
                                     srgPool->CompileGroupsForInterval(interval);
@@ -388,19 +401,14 @@ namespace AZ::RHI
                                 executeGroupJob->SetDependent(&jobCompletion);
                                 executeGroupJob->Start();
                             }
-                        };
-
-                        resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileIntervalsFunction)>(
-                            AZStd::move(compileIntervalsFunction));
+                        }
 
                         jobCompletion.StartAndWaitForCompletion();
 
-                        const auto compileGroupsEndFunction = [](DeviceShaderResourceGroupPool* srgPool)
+                        for (const auto& poolCompile : poolCompiles)
                         {
-                            srgPool->CompileGroupsEnd();
-                        };
-
-                        resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileGroupsEndFunction)>(compileGroupsEndFunction);
+                            poolCompile.first->CompileGroupsEnd();
+                        }
                     }
                 }
                 else
@@ -423,6 +431,17 @@ namespace AZ::RHI
             });
     }
 
+    uint32_t FrameScheduler::GetShaderResourceGroupCompilesPerJob(uint32_t totalCompiles) const
+    {
+        // Split the compiles so every worker thread gets a few jobs to balance the load, without going over the requested
+        // compiles per job, or under the minimum that amortizes the cost of a job.
+        const uint32_t maxCompilesPerJob = AZStd::max(m_compileRequest.m_shaderResourceGroupCompilesPerJob, 1u);
+        const uint32_t minCompilesPerJob = AZStd::clamp(m_compileRequest.m_shaderResourceGroupMinCompilesPerJob, 1u, maxCompilesPerJob);
+        const uint32_t jobsPerThread = 4;
+        const uint32_t threadCount = AZStd::max(AZStd::thread::hardware_concurrency(), 1u);
+        return AZStd::clamp(AZ::DivideAndRoundUp(totalCompiles, threadCount * jobsPerThread), minCompilesPerJob, maxCompilesPerJob);
+    }
+
     void FrameScheduler::BuildRayTracingShaderTables()
     {
         AZ_PROFILE_SCOPE(RHI, "FrameScheduler: BuildRayTracingShaderTables");
@@ -560,6 +579,10 @@ namespace AZ::RHI
 
     void FrameScheduler::ExecuteContextInternal(FrameGraphExecuteGroup& group, uint32_t index)
     {
+        const bool gatherRecordingStatistics =
+            CheckBitsAny(m_compileRequest.m_statisticsFlags, FrameSchedulerStatisticsFlags::GatherCommandListRecordingStatistics);
+        const AZStd::sys_time_t recordingStartTicks = gatherRecordingStatistics ? AZStd::GetTimeNowTicks() : 0;
+
         FrameGraphExecuteContext* executeContext = group.BeginContext(index);
 
         {
@@ -583,6 +606,40 @@ namespace AZ::RHI
         }
 
         group.EndContext(index);
+
+        if (gatherRecordingStatistics)
+        {
+            RecordCommandListRecordingTime(AZStd::GetTimeNowTicks() - recordingStartTicks);
+        }
+    }
+
+    void FrameScheduler::RecordCommandListRecordingTime(AZStd::sys_time_t recordingTimeTicks)
+    {
+        const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_recordingStatisticsMutex);
+        auto statisticsIter = AZStd::find_if(m_recordingStatistics.begin(), m_recordingStatistics.end(),
+            [threadId](const CommandListRecordingStatistics& statistics)
+            {
+                return statistics.m_threadId == threadId;
+            });
+        if (statisticsIter == m_recordingStatistics.end())
+        {
+            statisticsIter = m_recordingStatistics.insert(m_recordingStatistics.end(), CommandListRecordingStatistics{ threadId });
+        }
+        statisticsIter->m_recordingTimeTicks += recordingTimeTicks;
+        ++statisticsIter->m_contextCount;
+    }
+
+    AZStd::vector<CommandListRecordingStatistics> FrameScheduler::GetCommandListRecordingStatistics() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_recordingStatisticsMutex);
+        return m_recordingStatistics;
+    }
+
+    const AsyncComputeStatistics& FrameScheduler::GetAsyncComputeStatistics() const
+    {
+        return m_asyncComputeStatistics;
     }
 
     void FrameScheduler::ExecuteGroupInternal(AZ::Job* parentJob, uint32_t groupIndex)
@@ -635,6 +692,11 @@ namespace AZ::RHI
         const uint32_t groupCount = m_frameGraphExecuter->GetGroupCount();
         const JobPolicy platformJobPolicy = m_frameGraphExecuter->GetJobPolicy();
 
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordingStatisticsMutex);
+            m_recordingStatistics.clear();
+        }
+
         // The scheduler itself can force serial execution even if the platform supports it (e.g. as a debugging flag).
         // We must run serially if the scheduler or the platform forces us to.
         if (overrideJobPolicy == JobPolicy::Serial ||
@@ -646,6 +708,12 @@ namespace AZ::RHI
             }
         }
 
+        // Prefer the task graph when it's active, recording contexts as individual tasks.
+        else if (m_taskGraphActive && m_taskGraphActive->IsTaskGraphActive())
+        {
+            ExecuteTaskGraph();
+        }
+
         // Otherwise, fork a job for each group.
         else
         {
@@ -666,6 +734,66 @@ namespace AZ::RHI
         }
     }
 
+    void FrameScheduler::ExecuteTaskGraph()
+    {
+        AZ::TaskGraph taskGraph{ "RHI Command List Recording" };
+        const AZ::TaskDescriptor executeGroupDesc{ "ExecuteGroup", "Graphics" };
+        const AZ::TaskDescriptor executeContextDesc{ "ExecuteContext", "Graphics" };
+
+        const uint32_t groupCount = m_frameGraphExecuter->GetGroupCount();
+        for (uint32_t groupIndex = 0; groupIndex < groupCount; ++groupIndex)
+        {
+            FrameGraphExecuteGroup* executeGroup = m_frameGraphExecuter->GetGroup(groupIndex);
+            const uint32_t contextCount = executeGroup->GetContextCount();
+
+            // Serial groups, and groups with a single context, are recorded start to finish by one task.
+            if (executeGroup->GetJobPolicy() == JobPolicy::Serial || contextCount == 1)
+            {
+                taskGraph.AddTask(
+                    executeGroupDesc,
+                    [this, groupIndex]()
+                    {
+                        ExecuteGroupInternal(nullptr, groupIndex);
+                    });
+                continue;
+            }
+
+            auto beginGroupTask = taskGraph.AddTask(
+                executeGroupDesc,
+                [this, groupIndex]()
+                {
+                    AZ_PROFILE_SCOPE(RHI, "FrameScheduler: ExecuteTaskGraph: BeginGroup");
+                    m_frameGraphExecuter->BeginGroup(groupIndex);
+                });
+            auto endGroupTask = taskGraph.AddTask(
+                executeGroupDesc,
+                [this, groupIndex]()
+                {
+                    AZ_PROFILE_SCOPE(RHI, "FrameScheduler: ExecuteTaskGraph: EndGroup");
+                    m_frameGraphExecuter->EndGroup(groupIndex);
+                });
+
+            for (uint32_t contextIndex = 0; contextIndex < contextCount; ++contextIndex)
+            {
+                auto executeContextTask = taskGraph.AddTask(
+                    executeContextDesc,
+                    [this, executeGroup, contextIndex]()
+                    {
+                        ExecuteContextInternal(*executeGroup, contextIndex);
+                    });
+                beginGroupTask.Precedes(executeContextTask);
+                executeContextTask.Precedes(endGroupTask);
+            }
+        }
+
+        if (!taskGraph.IsEmpty())
+        {
+            AZ::TaskGraphEvent finishedEvent{ "RHI Command List Recording Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+    }
+
     ScopeProducer* FrameScheduler::FindScopeProducer(const ScopeId& scopeId)
     {
         auto findIt = m_scopeProducerLookup.find(scopeId);
@@ -264,31 +264,45 @@ namespace AZ::RHI
     void RHISystem::FrameUpdate(FrameGraphCallback frameGraphCallback)
     {
         AZ_PROFILE_SCOPE(RHI, "RHISystem: FrameUpdate");
-        {
-            AZ_PROFILE_SCOPE(RHI, "main per-frame work");
-            if (m_frameScheduler.BeginFrame() == ResultCode::Success)
-            {
-                frameGraphCallback(m_frameScheduler);
+        FramePrepare(frameGraphCallback);
+        FrameExecute();
+    }
 
-                // This exists as a hook to enable RHI sample tests, which are allowed to queue their
-                // own RHI scopes to the frame scheduler. This happens prior to the RPI pass graph registration.
-                {
-                    AZ_PROFILE_SCOPE(RHI, "RHISystem: FrameUpdate: OnFramePrepare");
-                    RHISystemNotificationBus::Broadcast(&RHISystemNotificationBus::Events::OnFramePrepare, m_frameScheduler);
-                }
+    void RHISystem::FramePrepare(FrameGraphCallback frameGraphCallback)
+    {
+        AZ_PROFILE_SCOPE(RHI, "RHISystem: FramePrepare");
+        m_isFrameCompiled = false;
+        if (m_frameScheduler.BeginFrame() == ResultCode::Success)
+        {
+            frameGraphCallback(m_frameScheduler);
 
-                RHI::MessageOutcome outcome = m_frameScheduler.Compile(m_compileRequest);
-                if (outcome.IsSuccess())
-                {
-                    m_frameScheduler.Execute(RHI::JobPolicy::Parallel);
-                }
-                else
-                {
-                    AZ_Error("RHISystem", false, "Frame Scheduler Compilation Failure: %s", outcome.GetError().c_str());
-                }
+            // This exists as a hook to enable RHI sample tests, which are allowed to queue their
+            // own RHI scopes to the frame scheduler. This happens prior to the RPI pass graph registration.
+            {
+                AZ_PROFILE_SCOPE(RHI, "RHISystem: FrameUpdate: OnFramePrepare");
+                RHISystemNotificationBus::Broadcast(&RHISystemNotificationBus::Events::OnFramePrepare, m_frameScheduler);
+            }
 
-                m_pipelineStateCache->Compact();
+            RHI::MessageOutcome outcome = m_frameScheduler.Compile(m_compileRequest);
+            if (outcome.IsSuccess())
+            {
+                m_isFrameCompiled = true;
             }
+            else
+            {
+                AZ_Error("RHISystem", false, "Frame Scheduler Compilation Failure: %s", outcome.GetError().c_str());
+            }
+        }
+    }
+
+    void RHISystem::FrameExecute()
+    {
+        AZ_PROFILE_SCOPE(RHI, "RHISystem: FrameExecute");
+        if (m_isFrameCompiled)
+        {
+            m_frameScheduler.Execute(RHI::JobPolicy::Parallel);
+            m_pipelineStateCache->Compact();
+            m_isFrameCompiled = false;
         }
 
         m_frameScheduler.EndFrame();
@@ -380,6 +394,16 @@ namespace AZ::RHI
         return m_frameScheduler.GetCpuFrameTime();
     }
 
+    AZStd::vector<CommandListRecordingStatistics> RHISystem::GetCommandListRecordingStatistics() const
+    {
+        return m_frameScheduler.GetCommandListRecordingStatistics();
+    }
+
+    AsyncComputeStatistics RHISystem::GetAsyncComputeStatistics() const
+    {
+        return m_frameScheduler.GetAsyncComputeStatistics();
+    }
+
 
     const AZStd::unordered_map<int, TransientAttachmentPoolDescriptor>* RHISystem::GetTransientAttachmentPoolDescriptor() const
     {
@@ -96,7 +96,7 @@ namespace AZ::RHI
                 ->Transform(instance.m_transform)
                 ->NonUniformScale(instance.m_nonUniformScale)
                 ->Transparent(instance.m_transparent)
-                ->Blas(instance.m_blas->GetDeviceRayTracingBlas(deviceIndex));
+                ->Blas(instance.m_blas ? instance.m_blas->GetDeviceRayTracingBlas(deviceIndex) : nullptr);
         }
 
         if (m_instancesBuffer)
@@ -104,6 +104,8 @@ namespace AZ::RHI
             descriptor.InstancesBuffer(m_instancesBuffer->GetDeviceBuffer(deviceIndex))->NumInstances(m_numInstancesInBuffer);
         }
 
+        descriptor.BuildFlags(m_buildFlags);
+
         return descriptor;
     }
 
@@ -185,6 +187,13 @@ namespace AZ::RHI
         return this;
     }
 
+    RayTracingTlasDescriptor* RayTracingTlasDescriptor::BuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags& buildFlags)
+    {
+        AZ_Assert(!m_buildContext, "BuildFlags property can only be added to the top level");
+        m_buildFlags = buildFlags;
+        return this;
+    }
+
     ResultCode RayTracingBlas::CreateBuffers(
         MultiDevice::DeviceMask deviceMask,
         const RayTracingBlasDescriptor* descriptor,
@@ -225,6 +234,52 @@ namespace AZ::RHI
         return resultCode;
     }
 
+    ResultCode RayTracingBlas::CreateCompactedBuffers(const RayTracingBlas& sourceBlas, const RayTracingBufferPools& rayTracingBufferPools)
+    {
+        ResultCode resultCode = sourceBlas.IterateObjects<DeviceRayTracingBlas>(
+            [](auto /*deviceIndex*/, auto deviceRayTracingBlas)
+            {
+                return deviceRayTracingBlas->GetCompactedSizeInBytes() > 0 ? ResultCode::Success : ResultCode::NotReady;
+            });
+        if (resultCode != ResultCode::Success)
+        {
+            return resultCode;
+        }
+
+        m_descriptor = sourceBlas.m_descriptor;
+
+        MultiDeviceObject::Init(sourceBlas.GetDeviceMask());
+
+        IterateDevices(
+            [this, &resultCode, &sourceBlas, &rayTracingBufferPools](auto deviceIndex)
+            {
+                auto device = RHISystemInterface::Get()->GetDevice(deviceIndex);
+                this->m_deviceObjects[deviceIndex] = Factory::Get().CreateRayTracingBlas();
+
+                resultCode = GetDeviceRayTracingBlas(deviceIndex)
+                                 ->CreateCompactedBuffers(
+                                     *device,
+                                     *sourceBlas.GetDeviceRayTracingBlas(deviceIndex),
+                                     *rayTracingBufferPools.GetDeviceRayTracingBufferPools(deviceIndex).get());
+
+                return resultCode == ResultCode::Success;
+            });
+
+        if (resultCode != ResultCode::Success)
+        {
+            // Reset already initialized device-specific DeviceRayTracingBlas and set deviceMask to 0
+            m_deviceObjects.clear();
+            MultiDeviceObject::Init(static_cast<MultiDevice::DeviceMask>(0u));
+        }
+
+        if (const auto& name = GetName(); !name.IsEmpty())
+        {
+            SetName(name);
+        }
+
+        return resultCode;
+    }
+
     bool RayTracingBlas::IsValid() const
     {
         if (m_deviceObjects.empty())
@@ -287,6 +342,32 @@ namespace AZ::RHI
         return resultCode;
     }
 
+    ResultCode RayTracingTlas::UpdateBuffers(const RayTracingTlasDescriptor* descriptor, const RayTracingBufferPools& rayTracingBufferPools)
+    {
+        if (m_deviceObjects.empty())
+        {
+            return ResultCode::InvalidOperation;
+        }
+
+        ResultCode resultCode = IterateObjects<DeviceRayTracingTlas>(
+            [&descriptor, &rayTracingBufferPools](int deviceIndex, auto deviceRayTracingTlas)
+            {
+                auto deviceDescriptor{ descriptor->GetDeviceRayTracingTlasDescriptor(deviceIndex) };
+                return deviceRayTracingTlas->UpdateBuffers(
+                    &deviceDescriptor, *rayTracingBufferPools.GetDeviceRayTracingBufferPools(deviceIndex).get());
+            });
+
+        if (resultCode == ResultCode::Success)
+        {
+            m_descriptor = *descriptor;
+        }
+
+        // The TLAS buffer is kept when refitting, only the instances buffer is new
+        m_tlasInstancesBuffer.reset();
+
+        return resultCode;
+    }
+
     const RHI::Ptr<RHI::Buffer> RayTracingTlas::GetTlasBuffer() const
     {
         AZStd::lock_guard lock(m_tlasBufferMutex);
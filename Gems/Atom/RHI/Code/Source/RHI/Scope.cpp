@@ -96,6 +96,15 @@ namespace AZ::RHI
         m_index.Reset();
         m_graphNodeIndex.Reset();
         m_estimatedItemCount = 1;
+        m_estimatedItemCostOffsets.clear();
+
+        // Scopes moved to the compute queue by the compiler go back to the graphics queue they were requested on
+        if (m_asyncComputeOverlapCount > 0)
+        {
+            m_hardwareQueueClass = HardwareQueueClass::Graphics;
+        }
+        m_asyncComputeAllowed = false;
+        m_asyncComputeOverlapCount = 0;
         m_producersByQueueLast.fill(nullptr);
         m_producersByQueue.fill(nullptr);
         m_consumersByQueue.fill(nullptr);
@@ -196,11 +205,26 @@ namespace AZ::RHI
         m_hardwareQueueClass = hardwareQueueClass;
     }
 
+    bool Scope::IsAsyncComputeAllowed() const
+    {
+        return m_asyncComputeAllowed;
+    }
+
+    uint32_t Scope::GetAsyncComputeOverlapCount() const
+    {
+        return m_asyncComputeOverlapCount;
+    }
+
     uint32_t Scope::GetEstimatedItemCount() const
     {
         return m_estimatedItemCount;
     }
 
+    AZStd::span<const uint32_t> Scope::GetEstimatedItemCostOffsets() const
+    {
+        return m_estimatedItemCostOffsets;
+    }
+
     const AZStd::vector<ScopeAttachment*>& Scope::GetAttachments() const
     {
         return m_attachments;
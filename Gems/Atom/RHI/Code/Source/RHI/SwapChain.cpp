@@ -293,6 +293,14 @@ namespace AZ::RHI
         });
     }
 
+    void SwapChain::WaitForPresentLatency()
+    {
+        IterateObjects<DeviceSwapChain>([]([[maybe_unused]] auto deviceIndex, auto deviceSwapChain)
+        {
+            deviceSwapChain->WaitForPresentLatency();
+        });
+    }
+
     RHI::XRRenderingInterface* SwapChain::GetXRSystem() const
     {
         return m_xrSystem;
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Atom/RHI/TransientAttachmentPacker.h>
+#include <Atom/RHI.Reflect/Bits.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ::RHI
+{
+    namespace
+    {
+        bool LifetimesIntersect(const TransientAttachmentPacker::Allocation& lhs, const TransientAttachmentPacker::Allocation& rhs)
+        {
+            return lhs.m_lifetimeBegin <= rhs.m_lifetimeEnd && rhs.m_lifetimeBegin <= lhs.m_lifetimeEnd;
+        }
+
+        uint64_t GetLifetimeLength(const TransientAttachmentPacker::Allocation& allocation)
+        {
+            return static_cast<uint64_t>(allocation.m_lifetimeEnd - allocation.m_lifetimeBegin) + 1;
+        }
+    }
+
+    TransientAttachmentPacker::Result TransientAttachmentPacker::PlaceInOrder(
+        AZStd::span<const Allocation> allocations, AZStd::span<const uint32_t> order)
+    {
+        Result result;
+        result.m_offsets.resize(allocations.size(), 0);
+
+        struct Region
+        {
+            size_t m_begin;
+            size_t m_end;
+        };
+        AZStd::vector<uint32_t> placed;
+        placed.reserve(allocations.size());
+        AZStd::vector<Region> conflicts;
+
+        for (uint32_t allocationIndex : order)
+        {
+            const Allocation& allocation = allocations[allocationIndex];
+            const size_t alignment = AZStd::max<size_t>(allocation.m_alignmentInBytes, 1);
+
+            // Gather the memory regions of the placed allocations that are alive at the same time, sorted by offset
+            conflicts.clear();
+            for (uint32_t placedIndex : placed)
+            {
+                if (LifetimesIntersect(allocation, allocations[placedIndex]))
+                {
+                    const size_t offset = result.m_offsets[placedIndex];
+                    conflicts.push_back({ offset, offset + allocations[placedIndex].m_sizeInBytes });
+                }
+            }
+            AZStd::sort(conflicts.begin(), conflicts.end(), [](const Region& lhs, const Region& rhs) { return lhs.m_begin < rhs.m_begin; });
+
+            // Take the lowest gap the allocation fits in
+            size_t offset = 0;
+            for (const Region& conflict : conflicts)
+            {
+                if (AlignUp(offset, alignment) + allocation.m_sizeInBytes <= conflict.m_begin)
+                {
+                    break;
+                }
+                offset = AZStd::max(offset, conflict.m_end);
+            }
+            offset = AlignUp(offset, alignment);
+
+            result.m_offsets[allocationIndex] = offset;
+            result.m_peakInBytes = AZStd::max(result.m_peakInBytes, offset + allocation.m_sizeInBytes);
+            placed.push_back(allocationIndex);
+        }
+        return result;
+    }
+
+    TransientAttachmentPacker::Result TransientAttachmentPacker::PackInOrder(AZStd::span<const Allocation> allocations)
+    {
+        AZStd::vector<uint32_t> order(allocations.size());
+        for (uint32_t index = 0; index < order.size(); ++index)
+        {
+            order[index] = index;
+        }
+        AZStd::stable_sort(order.begin(), order.end(), [&allocations](uint32_t lhs, uint32_t rhs)
+            {
+                return allocations[lhs].m_lifetimeBegin < allocations[rhs].m_lifetimeBegin;
+            });
+        return PlaceInOrder(allocations, order);
+    }
+
+    TransientAttachmentPacker::Result TransientAttachmentPacker::Pack(AZStd::span<const Allocation> allocations)
+    {
+        Result bestResult = PackInOrder(allocations);
+
+        AZStd::vector<uint32_t> order(allocations.size());
+        auto tryOrder = [&](auto&& isPlacedBefore)
+        {
+            for (uint32_t index = 0; index < order.size(); ++index)
+            {
+                order[index] = index;
+            }
+            AZStd::stable_sort(order.begin(), order.end(), isPlacedBefore);
+
+            Result result = PlaceInOrder(allocations, order);
+            if (result.m_peakInBytes < bestResult.m_peakInBytes)
+            {
+                bestResult = AZStd::move(result);
+            }
+        };
+
+        // Largest first, the strategy that tends to work best for transient render targets of a few distinct sizes
+        tryOrder([&allocations](uint32_t lhs, uint32_t rhs)
+            {
+                if (allocations[lhs].m_sizeInBytes != allocations[rhs].m_sizeInBytes)
+                {
+                    return allocations[lhs].m_sizeInBytes > allocations[rhs].m_sizeInBytes;
+                }
+                return GetLifetimeLength(allocations[lhs]) > GetLifetimeLength(allocations[rhs]);
+            });
+
+        // Largest rectangle area first
+        tryOrder([&allocations](uint32_t lhs, uint32_t rhs)
+            {
+                return allocations[lhs].m_sizeInBytes * GetLifetimeLength(allocations[lhs]) >
+                    allocations[rhs].m_sizeInBytes * GetLifetimeLength(allocations[rhs]);
+            });
+
+        // Longest lifetime first, so long lived allocations sit at the bottom of the heap and short lived ones share the top
+        tryOrder([&allocations](uint32_t lhs, uint32_t rhs)
+            {
+                const uint64_t lhsLength = GetLifetimeLength(allocations[lhs]);
+                const uint64_t rhsLength = GetLifetimeLength(allocations[rhs]);
+                if (lhsLength != rhsLength)
+                {
+                    return lhsLength > rhsLength;
+                }
+                return allocations[lhs].m_sizeInBytes > allocations[rhs].m_sizeInBytes;
+            });
+
+        return bestResult;
+    }
+}
@@ -42,6 +42,21 @@ namespace UnitTest
         return m_scopeId;
     }
 
+    void FrameGraphExecuteGroupSplit::Init(
+        const RHI::ScopeId& scopeId, uint32_t submitCount, AZStd::span<const uint32_t> submitCostOffsets, uint32_t commandListCount)
+    {
+        m_commandLists.resize(commandListCount, nullptr);
+
+        InitRequest request;
+        request.m_scopeId = scopeId;
+        request.m_submitCount = submitCount;
+        request.m_submitCostOffsets = submitCostOffsets;
+        request.m_commandListCount = commandListCount;
+        request.m_commandLists = m_commandLists.data();
+        request.m_jobPolicy = RHI::JobPolicy::Parallel;
+        Base::Init(request);
+    }
+
     RHI::ResultCode FrameGraphExecuter::InitInternal(const AZ::RHI::FrameGraphExecuterDescriptor&)
     {
         return RHI::ResultCode::Success;
@@ -46,6 +46,20 @@ namespace UnitTest
         AZ::RHI::CommandList* m_commandList = nullptr;
     };
 
+    //! Splits a single scope across several command lists.
+    class FrameGraphExecuteGroupSplit
+        : public AZ::RHI::FrameGraphExecuteGroup
+    {
+        using Base = AZ::RHI::FrameGraphExecuteGroup;
+    public:
+        AZ_CLASS_ALLOCATOR(FrameGraphExecuteGroupSplit, AZ::SystemAllocator);
+
+        void Init(const AZ::RHI::ScopeId& scopeId, uint32_t submitCount, AZStd::span<const uint32_t> submitCostOffsets, uint32_t commandListCount);
+
+    private:
+        AZStd::vector<AZ::RHI::CommandList*> m_commandLists;
+    };
+
     class FrameGraphExecuter
         : public AZ::RHI::FrameGraphExecuter
     {
@@ -687,4 +687,54 @@ namespace UnitTest
     {
         TestOverlappingAttachments();
     }
+
+    TEST_F(FrameGraphTests, TestExecuteGroupSubmitRanges)
+    {
+        const auto getSubmitRanges = [](FrameGraphExecuteGroupSplit& group)
+        {
+            AZStd::vector<RHI::CommandList::SubmitRange> submitRanges;
+            for (uint32_t i = 0; i < group.GetContextCount(); ++i)
+            {
+                submitRanges.push_back(group.BeginContext(i)->GetSubmitRange());
+                group.EndContext(i);
+            }
+            return submitRanges;
+        };
+
+        // Without costs the items are split evenly by count
+        {
+            FrameGraphExecuteGroupSplit group;
+            group.Init(RHI::ScopeId{ "EvenSplit" }, 8, {}, 4);
+            const AZStd::vector<RHI::CommandList::SubmitRange> submitRanges = getSubmitRanges(group);
+            ASSERT_EQ(submitRanges.size(), 4);
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                EXPECT_EQ(submitRanges[i].m_startIndex, i * 2);
+                EXPECT_EQ(submitRanges[i].m_endIndex, (i + 1) * 2);
+            }
+        }
+
+        // With costs, the two expensive items at the front each get a command list and the cheap ones share the rest
+        {
+            const uint32_t itemCosts[] = { 6, 6, 1, 1, 1, 1, 1, 1 };
+            AZStd::vector<uint32_t> costOffsets;
+            uint32_t costTotal = 0;
+            for (uint32_t itemCost : itemCosts)
+            {
+                costTotal += itemCost;
+                costOffsets.push_back(costTotal);
+            }
+
+            FrameGraphExecuteGroupSplit group;
+            group.Init(RHI::ScopeId{ "CostSplit" }, 8, costOffsets, 3);
+            const AZStd::vector<RHI::CommandList::SubmitRange> submitRanges = getSubmitRanges(group);
+            ASSERT_EQ(submitRanges.size(), 3);
+            EXPECT_EQ(submitRanges[0].m_startIndex, 0);
+            EXPECT_EQ(submitRanges[0].m_endIndex, 1);
+            EXPECT_EQ(submitRanges[1].m_startIndex, 1);
+            EXPECT_EQ(submitRanges[1].m_endIndex, 2);
+            EXPECT_EQ(submitRanges[2].m_startIndex, 2);
+            EXPECT_EQ(submitRanges[2].m_endIndex, 8);
+        }
+    }
 }
@@ -12,6 +12,7 @@
 #include <Atom/RHI/ScopeProducer.h>
 #include <Atom/RHI/FrameScheduler.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/utility/as_const.h>
 #include <Atom/RHI/BufferPool.h>
 #include <Atom/RHI/ImagePool.h>
 
@@ -89,14 +90,15 @@ namespace UnitTest
 
             for (const ImageUsage& usage : m_imageUsages)
             {
-                frameGraph.UseShaderAttachment(usage.m_descriptor, usage.m_access, RHI::ScopeAttachmentStage::AnyGraphics);
+                frameGraph.UseShaderAttachment(usage.m_descriptor, usage.m_access, m_stage);
             }
 
             for (const BufferUsage& usage : m_bufferUsages)
             {
-                frameGraph.UseShaderAttachment(usage.m_descriptor, usage.m_access, RHI::ScopeAttachmentStage::AnyGraphics);
+                frameGraph.UseShaderAttachment(usage.m_descriptor, usage.m_access, m_stage);
             }
 
+            frameGraph.SetAsyncComputeAllowed(m_asyncComputeAllowed);
             frameGraph.SetEstimatedItemCount(0);
         }
 
@@ -141,6 +143,9 @@ namespace UnitTest
 
         AZStd::vector<ImageUsage> m_imageUsages;
         AZStd::vector<BufferUsage> m_bufferUsages;
+
+        RHI::ScopeAttachmentStage m_stage = RHI::ScopeAttachmentStage::AnyGraphics;
+        bool m_asyncComputeAllowed = false;
     };
 
     class FrameSchedulerTests
@@ -407,6 +412,80 @@ namespace UnitTest
             frameScheduler.Shutdown();
         }
 
+        // S1 runs compute work between S0 and S3, and S2 is independent graphics work it can overlap with.
+        // S4 also allows async compute, but nothing is left to overlap with after S3.
+        void TestAsyncCompute()
+        {
+            RHI::FrameScheduler frameScheduler;
+            frameScheduler.Init(RHI::MultiDevice::DefaultDevice, RHI::FrameSchedulerDescriptor());
+
+            RHI::BufferScopeAttachmentDescriptor bufferBindingDesc;
+            bufferBindingDesc.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, BufferSize);
+
+            RHI::ImageScopeAttachmentDescriptor imageBindingDesc;
+            imageBindingDesc.m_imageViewDescriptor = RHI::ImageViewDescriptor();
+
+            const ImportedBuffer& buffer0 = m_state->m_bufferAttachments[0];
+            const ImportedBuffer& buffer1 = m_state->m_bufferAttachments[1];
+
+            ScopeProducer& producer0 = *m_state->m_producers[0];
+            producer0.m_bufferImports.push_back(buffer0);
+            bufferBindingDesc.m_attachmentId = buffer0.m_id;
+            producer0.m_bufferUsages.push_back(ScopeProducer::BufferUsage{ bufferBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite });
+
+            ScopeProducer& producer1 = *m_state->m_producers[1];
+            producer1.m_stage = RHI::ScopeAttachmentStage::ComputeShader;
+            producer1.m_asyncComputeAllowed = true;
+            producer1.m_bufferUsages.push_back(ScopeProducer::BufferUsage{ bufferBindingDesc, RHI::ScopeAttachmentAccess::Read });
+            producer1.m_bufferImports.push_back(buffer1);
+            bufferBindingDesc.m_attachmentId = buffer1.m_id;
+            producer1.m_bufferUsages.push_back(ScopeProducer::BufferUsage{ bufferBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite });
+
+            ScopeProducer& producer2 = *m_state->m_producers[2];
+            producer2.m_imageImports.push_back(m_state->m_imageAttachments[0]);
+            imageBindingDesc.m_attachmentId = m_state->m_imageAttachments[0].m_id;
+            producer2.m_imageUsages.push_back(ScopeProducer::ImageUsage{ imageBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite });
+
+            ScopeProducer& producer3 = *m_state->m_producers[3];
+            producer3.m_bufferUsages.push_back(ScopeProducer::BufferUsage{ bufferBindingDesc, RHI::ScopeAttachmentAccess::Read });
+
+            ScopeProducer& producer4 = *m_state->m_producers[4];
+            producer4.m_stage = RHI::ScopeAttachmentStage::ComputeShader;
+            producer4.m_asyncComputeAllowed = true;
+            producer4.m_bufferUsages.push_back(ScopeProducer::BufferUsage{ bufferBindingDesc, RHI::ScopeAttachmentAccess::ReadWrite });
+
+            for (uint32_t frameIdx = 0; frameIdx < 2; ++frameIdx)
+            {
+                frameScheduler.BeginFrame();
+
+                for (uint32_t scopeIdx = 0; scopeIdx < 5; ++scopeIdx)
+                {
+                    frameScheduler.ImportScopeProducer(*m_state->m_producers[scopeIdx]);
+                }
+
+                RHI::FrameSchedulerCompileRequest compileRequest;
+                compileRequest.m_jobPolicy = RHI::JobPolicy::Serial;
+                frameScheduler.Compile(compileRequest);
+
+                const RHI::Scope* scope1 = AZStd::as_const(producer1).GetScope();
+                EXPECT_EQ(scope1->GetHardwareQueueClass(), RHI::HardwareQueueClass::Compute);
+                EXPECT_EQ(scope1->GetAsyncComputeOverlapCount(), 1);
+                EXPECT_EQ(AZStd::as_const(producer2).GetScope()->GetHardwareQueueClass(), RHI::HardwareQueueClass::Graphics);
+                EXPECT_EQ(AZStd::as_const(producer4).GetScope()->GetHardwareQueueClass(), RHI::HardwareQueueClass::Graphics);
+
+                const RHI::AsyncComputeStatistics& statistics = frameScheduler.GetAsyncComputeStatistics();
+                EXPECT_EQ(statistics.m_computeScopeCount, 1);
+                EXPECT_EQ(statistics.m_autoAsyncComputeScopeCount, 1);
+                EXPECT_EQ(statistics.m_overlappedGraphicsScopeCount, 1);
+
+                frameScheduler.Execute(RHI::JobPolicy::Serial);
+
+                frameScheduler.EndFrame();
+            }
+
+            frameScheduler.Shutdown();
+        }
+
     private:
         static const uint32_t FrameIterationCount = 128;
         static const uint32_t ImportedImageCount = 16;
@@ -439,4 +518,9 @@ namespace UnitTest
     {
         Test();
     }
+
+    TEST_F(FrameSchedulerTests, AsyncCompute_IndependentGraphicsScope_MovesComputeScopeToComputeQueue)
+    {
+        TestAsyncCompute();
+    }
 }
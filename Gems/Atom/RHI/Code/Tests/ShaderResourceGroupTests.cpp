@@ -697,6 +697,65 @@ namespace UnitTest
         TestGetConstantVectorsInvalidCase(srgLayout);
     }
 
+    TEST_F(ShaderResourceGroupTests, SRGDataSetConstant_DirtyInterval_CoversAssignedConstants)
+    {
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        const RHI::ConstantsLayout* constantsLayout = srgLayout->GetConstantsLayout();
+        const RHI::ShaderInputConstantIndex vector2index = srgLayout->FindShaderInputConstantIndex(Name("m_vector2"));
+        const RHI::ShaderInputConstantIndex vector4index = srgLayout->FindShaderInputConstantIndex(Name("m_vector4"));
+
+        RHI::DeviceShaderResourceGroupData srgData = PrepareSRGData(srgLayout);
+
+        // Newly created data was never uploaded.
+        EXPECT_EQ(srgData.GetConstantsData().GetDirtyInterval(), RHI::Interval(0, constantsLayout->GetDataSize()));
+
+        srgData.ResetUpdateMask();
+        const RHI::Interval emptyInterval = srgData.GetConstantsData().GetDirtyInterval();
+        EXPECT_GE(emptyInterval.m_min, emptyInterval.m_max);
+
+        EXPECT_TRUE(srgData.SetConstant(vector4index, Vector4::CreateOne()));
+        EXPECT_EQ(srgData.GetConstantsData().GetDirtyInterval(), constantsLayout->GetInterval(vector4index));
+
+        EXPECT_TRUE(srgData.SetConstant(vector2index, Vector2::CreateOne()));
+        EXPECT_EQ(
+            srgData.GetConstantsData().GetDirtyInterval(),
+            RHI::Interval(constantsLayout->GetInterval(vector2index).m_min, constantsLayout->GetInterval(vector4index).m_max));
+    }
+
+    TEST_F(ShaderResourceGroupTests, SRGCompile_ConstantDataDirtyInterval_CoversRingBufferedCompiles)
+    {
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        const RHI::ConstantsLayout* constantsLayout = srgLayout->GetConstantsLayout();
+        const RHI::ShaderInputConstantIndex vector2index = srgLayout->FindShaderInputConstantIndex(Name("m_vector2"));
+
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::DeviceShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::DeviceShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srg);
+
+        RHI::DeviceShaderResourceGroupData srgData(*srg);
+        const RHI::Interval wholeInterval(0, constantsLayout->GetDataSize());
+
+        // Every ring buffered copy of the compiled data has to be written as a whole once.
+        for (uint32_t compileIndex = 0; compileIndex < RHI::Limits::Device::FrameCountMax; ++compileIndex)
+        {
+            EXPECT_TRUE(srgData.SetConstant(vector2index, Vector2(static_cast<float>(compileIndex))));
+            srg->Compile(srgData, RHI::DeviceShaderResourceGroup::CompileMode::Sync);
+            srgData.ResetUpdateMask();
+            EXPECT_EQ(srg->GetConstantDataDirtyInterval(), wholeInterval);
+        }
+
+        // Once they were, only the assigned constants are written.
+        EXPECT_TRUE(srgData.SetConstant(vector2index, Vector2::CreateOne()));
+        srg->Compile(srgData, RHI::DeviceShaderResourceGroup::CompileMode::Sync);
+        srgData.ResetUpdateMask();
+        EXPECT_EQ(srg->GetConstantDataDirtyInterval(), constantsLayout->GetInterval(vector2index));
+    }
+
     TEST_F(ShaderResourceGroupTests, TestShaderResourceGroupLayoutHash)
     {
         const Name imageName("m_image");
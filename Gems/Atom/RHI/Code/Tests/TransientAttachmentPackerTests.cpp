@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+#include <AzCore/UnitTest/UnitTest.h>
+#include <Atom/RHI/TransientAttachmentPacker.h>
+#include <AzCore/Math/Random.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class TransientAttachmentPackerTest
+        : public RHITestFixture
+    {
+    public:
+        TransientAttachmentPackerTest()
+            : RHITestFixture()
+        {}
+
+        // Return true if no two allocations with intersecting lifetimes overlap in memory, and every offset is aligned
+        bool ValidatePlacement(
+            const AZStd::vector<RHI::TransientAttachmentPacker::Allocation>& allocations,
+            const RHI::TransientAttachmentPacker::Result& result)
+        {
+            if (result.m_offsets.size() != allocations.size())
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i < allocations.size(); ++i)
+            {
+                const size_t offsetI = result.m_offsets[i];
+                if (offsetI % allocations[i].m_alignmentInBytes != 0 || offsetI + allocations[i].m_sizeInBytes > result.m_peakInBytes)
+                {
+                    return false;
+                }
+
+                for (size_t j = i + 1; j < allocations.size(); ++j)
+                {
+                    const bool lifetimesIntersect = allocations[i].m_lifetimeBegin <= allocations[j].m_lifetimeEnd &&
+                        allocations[j].m_lifetimeBegin <= allocations[i].m_lifetimeEnd;
+                    const size_t offsetJ = result.m_offsets[j];
+                    const bool memoryOverlaps = offsetI < offsetJ + allocations[j].m_sizeInBytes && offsetJ < offsetI + allocations[i].m_sizeInBytes;
+                    if (lifetimesIntersect && memoryOverlaps)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+    };
+
+    TEST_F(TransientAttachmentPackerTest, Pack_DisjointLifetimes_ShareMemory)
+    {
+        AZStd::vector<RHI::TransientAttachmentPacker::Allocation> allocations = {
+            { 1024, 256, 0, 1 },
+            { 512, 256, 2, 3 },
+            { 1024, 256, 4, 5 },
+        };
+
+        RHI::TransientAttachmentPacker::Result result = RHI::TransientAttachmentPacker::Pack(allocations);
+        EXPECT_TRUE(ValidatePlacement(allocations, result));
+        EXPECT_EQ(result.m_peakInBytes, 1024);
+        for (size_t offset : result.m_offsets)
+        {
+            EXPECT_EQ(offset, 0);
+        }
+    }
+
+    TEST_F(TransientAttachmentPackerTest, Pack_FragmentingActivationOrder_LowerPeakThanInOrder)
+    {
+        // In activation order, the second allocation leaves a hole at offset 0 that is too small for the third one.
+        AZStd::vector<RHI::TransientAttachmentPacker::Allocation> allocations = {
+            { 256, 256, 0, 2 },
+            { 256, 256, 1, 5 },
+            { 512, 256, 3, 5 },
+        };
+
+        RHI::TransientAttachmentPacker::Result inOrderResult = RHI::TransientAttachmentPacker::PackInOrder(allocations);
+        EXPECT_TRUE(ValidatePlacement(allocations, inOrderResult));
+        EXPECT_EQ(inOrderResult.m_peakInBytes, 1024);
+
+        RHI::TransientAttachmentPacker::Result packedResult = RHI::TransientAttachmentPacker::Pack(allocations);
+        EXPECT_TRUE(ValidatePlacement(allocations, packedResult));
+        EXPECT_EQ(packedResult.m_peakInBytes, 768);
+    }
+
+    TEST_F(TransientAttachmentPackerTest, Pack_RandomAllocations_ValidAndNotWorseThanInOrder)
+    {
+        AZ::SimpleLcgRandom random(0x1234);
+        for (uint32_t iteration = 0; iteration < 20; ++iteration)
+        {
+            const uint32_t eventCount = 64;
+            AZStd::vector<RHI::TransientAttachmentPacker::Allocation> allocations(32);
+            for (RHI::TransientAttachmentPacker::Allocation& allocation : allocations)
+            {
+                allocation.m_alignmentInBytes = size_t{ 256 } << (random.GetRandom() % 3);
+                allocation.m_sizeInBytes = (random.GetRandom() % 64 + 1) * 256;
+                allocation.m_lifetimeBegin = random.GetRandom() % eventCount;
+                allocation.m_lifetimeEnd = allocation.m_lifetimeBegin + random.GetRandom() % (eventCount - allocation.m_lifetimeBegin);
+            }
+
+            RHI::TransientAttachmentPacker::Result inOrderResult = RHI::TransientAttachmentPacker::PackInOrder(allocations);
+            RHI::TransientAttachmentPacker::Result packedResult = RHI::TransientAttachmentPacker::Pack(allocations);
+            EXPECT_TRUE(ValidatePlacement(allocations, inOrderResult));
+            EXPECT_TRUE(ValidatePlacement(allocations, packedResult));
+            EXPECT_LE(packedResult.m_peakInBytes, inOrderResult.m_peakInBytes);
+        }
+    }
+}
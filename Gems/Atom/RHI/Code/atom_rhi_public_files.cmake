@@ -244,6 +244,8 @@ set(FILES
     Source/RHI/AsyncWorkQueue.cpp
     Include/Atom/RHI/AliasedHeap.h
     Source/RHI/AliasedHeap.cpp
+    Include/Atom/RHI/TransientAttachmentPacker.h
+    Source/RHI/TransientAttachmentPacker.cpp
     Include/Atom/RHI/AliasedAttachmentAllocator.h
     Include/Atom/RHI/AliasingBarrierTracker.h
     Source/RHI/AliasingBarrierTracker.cpp
@@ -23,6 +23,7 @@ set(FILES
     Tests/QueryTests.cpp
     Tests/RenderAttachmentLayoutBuilderTests.cpp
     Tests/ShaderResourceGroupTests.cpp
+    Tests/TransientAttachmentPackerTests.cpp
     Tests/UtilsTests.cpp
     Tests/Buffer.h
     Tests/Buffer.cpp
@@ -51,6 +51,18 @@ namespace AZ
                 }
             }
 
+            bool DeviceQueryLocalVideoMemory(IDXGIAdapterX* dxgiAdapter, size_t& budgetInBytes, size_t& usageInBytes)
+            {
+                DXGI_QUERY_VIDEO_MEMORY_INFO memoryInfo;
+                if (S_OK == dxgiAdapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &memoryInfo))
+                {
+                    budgetInBytes = memoryInfo.Budget;
+                    usageInBytes = memoryInfo.CurrentUsage;
+                    return true;
+                }
+                return false;
+            }
+
             D3D12_RESOURCE_STATES GetRayTracingAccelerationStructureResourceState()
             {
                 return D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE;
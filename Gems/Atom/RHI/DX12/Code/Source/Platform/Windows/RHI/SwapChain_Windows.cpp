@@ -58,6 +58,10 @@ namespace AZ
                 // It is recommended to always use the tearing flag when it is available.
                 swapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
             }
+            if (descriptor.m_isLowLatency)
+            {
+                swapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+            }
 
             IUnknown* window = reinterpret_cast<IUnknown*>(descriptor.m_window.GetIndex());
             RHI::ResultCode result = device.CreateSwapChain(reinterpret_cast<IUnknown*>(descriptor.m_window.GetIndex()), swapChainDesc, m_swapChain);
@@ -65,6 +69,14 @@ namespace AZ
             {
                 ConfigureDisplayMode(*nativeDimensions);
 
+                if (descriptor.m_isLowLatency)
+                {
+                    // Only a single frame can be queued for presentation, and the CPU waits on the
+                    // waitable object before starting the next one (see WaitForPresentLatencyInternal).
+                    device.AssertSuccess(m_swapChain->SetMaximumFrameLatency(1));
+                    m_frameLatencyWaitableObject = m_swapChain->GetFrameLatencyWaitableObject();
+                }
+
                 // According to various docs (and the D3D12Fulscreen sample), when tearing is supported
                 // a borderless full screen window is always preferred over exclusive full screen mode.
                 //
@@ -97,6 +109,23 @@ namespace AZ
             // Safe to call even if not in the exclusive full screen state.
             m_swapChain->SetFullscreenState(0, nullptr);
             m_swapChain = nullptr;
+
+            if (m_frameLatencyWaitableObject)
+            {
+                CloseHandle(m_frameLatencyWaitableObject);
+                m_frameLatencyWaitableObject = nullptr;
+            }
+        }
+
+        void SwapChain::WaitForPresentLatencyInternal()
+        {
+            if (m_frameLatencyWaitableObject)
+            {
+                // The timeout keeps the application responsive if the presentation engine stops signaling,
+                // e.g. while the window is minimized.
+                constexpr DWORD TimeoutInMilliseconds = 1000;
+                WaitForSingleObjectEx(m_frameLatencyWaitableObject, TimeoutInMilliseconds, TRUE);
+            }
         }
 
         uint32_t SwapChain::PresentInternal()
@@ -42,6 +42,7 @@ namespace AZ
             bool IsExclusiveFullScreenPreferred() const override;
             bool GetExclusiveFullScreenState() const override;
             bool SetExclusiveFullScreenState(bool fullScreenState) override;
+            void WaitForPresentLatencyInternal() override;
             //////////////////////////////////////////////////////////////////////////
 
             void ConfigureDisplayMode(const RHI::SwapChainDimensions& dimensions);
@@ -55,6 +56,7 @@ namespace AZ
             RHI::Ptr<IDXGISwapChainX> m_swapChain;
             bool m_isInFullScreenExclusiveState = false; //!< Was SetFullscreenState used to enter full screen exclusive state?
             bool m_isTearingSupported = false; //!< Is tearing support available for full screen borderless windowed mode?
+            HANDLE m_frameLatencyWaitableObject = nullptr; //!< Signaled when the swap chain can queue a new frame, only used in low latency mode.
         };
     }
 }
@@ -328,9 +328,21 @@ namespace AZ
                                                                  );
 
             // Run Shader Compiler
-            if (!RHI::ExecuteShaderCompiler(dxcRelativePath, dxcCommandOptions, shaderSourceFile, tempFolder, "DXC"))
+            // The symbol database isn't one of the cached outputs, so debug builds always run the compiler.
+            if (graphicsDevMode || shaderBuildArguments.m_generateDebugInfo)
             {
-                return false;
+                if (!RHI::ExecuteShaderCompiler(dxcRelativePath, dxcCommandOptions, shaderSourceFile, tempFolder, "DXC"))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                const AZStd::string dxcOutputFiles[] = { shaderOutputFile, objectCodeOutputFile };
+                if (!RHI::ExecuteShaderCompilerWithCache(dxcRelativePath, dxcCommandOptions, dxcInputFile, dxcOutputFiles, shaderSourceFile, tempFolder, "DXC"))
+                {
+                    return false;
+                }
             }
 
             if (useSpecializationConstants)
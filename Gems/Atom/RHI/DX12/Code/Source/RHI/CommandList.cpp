@@ -682,7 +682,51 @@ namespace AZ
             blasDesc.ScratchAccelerationStructureData = static_cast<Buffer*>(blasBuffers.m_scratchBuffer.get())->GetMemoryView().GetGpuAddress();
             blasDesc.DestAccelerationStructureData = static_cast<Buffer*>(blasBuffers.m_blasBuffer.get())->GetMemoryView().GetGpuAddress();
             ID3D12GraphicsCommandList4* commandList = static_cast<ID3D12GraphicsCommandList4*>(GetCommandList());
-            commandList->BuildRaytracingAccelerationStructure(&blasDesc, 0, nullptr);
+
+            if (!blasBuffers.m_compactedSizeBuffer)
+            {
+                commandList->BuildRaytracingAccelerationStructure(&blasDesc, 0, nullptr);
+                return;
+            }
+
+            // the build writes the compacted size of the BLAS, which is copied to the readback buffer so the BLAS can be
+            // compacted once the size is available on the CPU
+            const MemoryView& compactedSizeMemoryView = static_cast<const Buffer*>(blasBuffers.m_compactedSizeBuffer.get())->GetMemoryView();
+            const MemoryView& readbackMemoryView = static_cast<const Buffer*>(blasBuffers.m_compactedSizeReadbackBuffer.get())->GetMemoryView();
+
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC postbuildInfoDesc = {};
+            postbuildInfoDesc.InfoType = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE;
+            postbuildInfoDesc.DestBuffer = compactedSizeMemoryView.GetGpuAddress();
+            commandList->BuildRaytracingAccelerationStructure(&blasDesc, 1, &postbuildInfoDesc);
+
+            // the compacted size pool is only used for these writes, so its state is transitioned back for the next BLAS build
+            D3D12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(
+                compactedSizeMemoryView.GetMemory(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COPY_SOURCE);
+            commandList->ResourceBarrier(1, &barrier);
+            commandList->CopyBufferRegion(
+                readbackMemoryView.GetMemory(),
+                readbackMemoryView.GetOffset(),
+                compactedSizeMemoryView.GetMemory(),
+                compactedSizeMemoryView.GetOffset(),
+                sizeof(D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC));
+            barrier = CD3DX12_RESOURCE_BARRIER::Transition(
+                compactedSizeMemoryView.GetMemory(), D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+            commandList->ResourceBarrier(1, &barrier);
+#endif
+        }
+
+        void CommandList::CompactBottomLevelAccelerationStructure(
+            [[maybe_unused]] const RHI::DeviceRayTracingBlas& sourceBlas, [[maybe_unused]] const RHI::DeviceRayTracingBlas& compactedBlas)
+        {
+#ifdef AZ_DX12_DXR_SUPPORT
+            const RayTracingBlas::BlasBuffers& sourceBuffers = static_cast<const RayTracingBlas&>(sourceBlas).GetBuffers();
+            const RayTracingBlas::BlasBuffers& compactedBuffers = static_cast<const RayTracingBlas&>(compactedBlas).GetBuffers();
+
+            ID3D12GraphicsCommandList4* commandList = static_cast<ID3D12GraphicsCommandList4*>(GetCommandList());
+            commandList->CopyRaytracingAccelerationStructure(
+                static_cast<Buffer*>(compactedBuffers.m_blasBuffer.get())->GetMemoryView().GetGpuAddress(),
+                static_cast<Buffer*>(sourceBuffers.m_blasBuffer.get())->GetMemoryView().GetGpuAddress(),
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE_COMPACT);
 #endif
         }
 
@@ -719,6 +763,20 @@ namespace AZ
         void CommandList::BuildTopLevelAccelerationStructure(
             const RHI::DeviceRayTracingTlas& rayTracingTlas, const AZStd::vector<const RHI::DeviceRayTracingBlas*>& changedBlasList)
         {
+            BuildTopLevelAccelerationStructureInternal(rayTracingTlas, changedBlasList, false);
+        }
+
+        void CommandList::UpdateTopLevelAccelerationStructure(
+            const RHI::DeviceRayTracingTlas& rayTracingTlas, const AZStd::vector<const RHI::DeviceRayTracingBlas*>& changedBlasList)
+        {
+            BuildTopLevelAccelerationStructureInternal(rayTracingTlas, changedBlasList, true);
+        }
+
+        void CommandList::BuildTopLevelAccelerationStructureInternal(
+            [[maybe_unused]] const RHI::DeviceRayTracingTlas& rayTracingTlas,
+            [[maybe_unused]] const AZStd::vector<const RHI::DeviceRayTracingBlas*>& changedBlasList,
+            [[maybe_unused]] bool update)
+        {
 #ifdef AZ_DX12_DXR_SUPPORT
             ID3D12GraphicsCommandList4* commandList = static_cast<ID3D12GraphicsCommandList4*>(GetCommandList());
             if (!changedBlasList.empty())
@@ -748,6 +806,12 @@ namespace AZ
             tlasDesc.Inputs = dx12RayTracingTlas.GetInputs();
             tlasDesc.ScratchAccelerationStructureData = static_cast<Buffer*>(tlasBuffers.m_scratchBuffer.get())->GetMemoryView().GetGpuAddress();
             tlasDesc.DestAccelerationStructureData = static_cast<Buffer*>(tlasBuffers.m_tlasBuffer.get())->GetMemoryView().GetGpuAddress();
+            if (update)
+            {
+                // refit the TLAS in place with the new instance transforms
+                tlasDesc.Inputs.Flags |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PERFORM_UPDATE;
+                tlasDesc.SourceAccelerationStructureData = tlasDesc.DestAccelerationStructureData;
+            }
 
             commandList->BuildRaytracingAccelerationStructure(&tlasDesc, 0, nullptr);
 #endif
@@ -13,8 +13,11 @@
 #include <RHI/Conversions.h>
 #include <RHI/DescriptorContext.h>
 #include <RHI/Fence.h>
+#include <RHI/StreamingImagePool.h>
 #include <Atom/RHI/MemoryStatisticsBuilder.h>
 #include <Atom/RHI.Reflect/DX12/PlatformLimitsDescriptor.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -58,9 +61,17 @@ namespace AZ
             }
         }
 #endif
+        AZ_CVAR(bool, r_dx12ResidencyManagement, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Evicts mips of streaming images when the video memory usage goes over the budget given by the OS.");
+        AZ_CVAR(float, r_dx12ResidencyBudgetRatio, 0.95f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Ratio of the OS video memory budget the device tries to stay under.");
+        AZ_CVAR(uint32_t, r_dx12ResidencyUpdateInterval, 10, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Number of frames between two checks of the video memory budget.");
+
         namespace Platform
         {
             void DeviceCompileMemoryStatisticsInternal(RHI::MemoryStatisticsBuilder& builder, IDXGIAdapterX* dxgiAdapter);
+            bool DeviceQueryLocalVideoMemory(IDXGIAdapterX* dxgiAdapter, size_t& budgetInBytes, size_t& usageInBytes);
         }
 
         Device::Device()
@@ -351,6 +362,68 @@ namespace AZ
 #ifdef USE_AMD_D3D12MA
             m_D3d12maReleaseQueue.Collect();
 #endif
+
+            UpdateResidency();
+        }
+
+        void Device::AddStreamingImagePool(StreamingImagePool* pool)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_streamingImagePoolsMutex);
+            m_streamingImagePools.push_back(pool);
+        }
+
+        void Device::RemoveStreamingImagePool(StreamingImagePool* pool)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_streamingImagePoolsMutex);
+            auto it = AZStd::find(m_streamingImagePools.begin(), m_streamingImagePools.end(), pool);
+            if (it != m_streamingImagePools.end())
+            {
+                m_streamingImagePools.erase(it);
+            }
+        }
+
+        void Device::UpdateResidency()
+        {
+            AZ_PROFILE_FUNCTION(RHI);
+
+            const uint32_t updateInterval = AZStd::max<uint32_t>(r_dx12ResidencyUpdateInterval, 1u);
+            if (!r_dx12ResidencyManagement || (++m_residencyFrameIndex % updateInterval) != 0)
+            {
+                return;
+            }
+
+            size_t budgetInBytes = 0;
+            size_t usageInBytes = 0;
+            if (!Platform::DeviceQueryLocalVideoMemory(m_dxgiAdapter.get(), budgetInBytes, usageInBytes) || budgetInBytes == 0)
+            {
+                return;
+            }
+
+            const float budgetRatio = AZStd::clamp<float>(r_dx12ResidencyBudgetRatio, 0.1f, 1.0f);
+            const size_t targetUsageInBytes = static_cast<size_t>(budgetInBytes * static_cast<double>(budgetRatio));
+            if (usageInBytes <= targetUsageInBytes)
+            {
+                return;
+            }
+
+            // Evicting mips frees the memory instead of leaving it to the OS to page out, and the streaming controllers stop
+            // expanding images until their pool usage drops, so the evicted mips aren't streamed back in right away.
+            // The memory of the evicted mips is only released once the GPU is done with the frame, so the usage reported
+            // by the OS lags behind, which the update interval accounts for.
+            size_t excessInBytes = usageInBytes - targetUsageInBytes;
+            AZStd::lock_guard<AZStd::mutex> lock(m_streamingImagePoolsMutex);
+            for (StreamingImagePool* pool : m_streamingImagePools)
+            {
+                const size_t releasedInBytes = pool->ReleaseMemory(excessInBytes);
+                excessInBytes -= AZStd::min(releasedInBytes, excessInBytes);
+                if (excessInBytes == 0)
+                {
+                    break;
+                }
+            }
+
+            AZ_Warning("Device", excessInBytes == 0, "Video memory usage (%zu MB) is over the budget of the OS (%zu MB), "
+                "and the streaming image pools have no more mips to evict.", usageInBytes / (1024 * 1024), budgetInBytes / (1024 * 1024));
         }
 
         void Device::WaitForIdleInternal()
@@ -49,6 +49,7 @@ namespace AZ
         class PhysicalDevice;
         class Buffer;
         class Image;
+        class StreamingImagePool;
 
         class Device
             : public Device_Platform
@@ -159,6 +160,10 @@ namespace AZ
             // return the binding slot of the bindless srg
             uint32_t GetBindlessSrgSlot() const;
 
+            //! Streaming image pools are asked to release memory when the process goes over the video memory budget of the OS.
+            void AddStreamingImagePool(StreamingImagePool* pool);
+            void RemoveStreamingImagePool(StreamingImagePool* pool);
+
         private:
             Device();
 
@@ -193,6 +198,10 @@ namespace AZ
 #endif
             void InitFeatures();
 
+            //! Checks the video memory usage against the budget given by the OS, and evicts mips of the streaming
+            //! images when it's over the budget, before the OS starts paging the resources of the process.
+            void UpdateResidency();
+
             void ConvertBufferDescriptorToResourceDesc(
                 const RHI::BufferDescriptor& bufferDescriptor,
                 D3D12_RESOURCE_STATES initialState,
@@ -238,6 +247,10 @@ namespace AZ
 
             // Cache bindless srg bind slot
             uint32_t m_bindlesSrgBindingSlot = AZ::RHI::InvalidIndex;
+
+            AZStd::vector<StreamingImagePool*> m_streamingImagePools;
+            AZStd::mutex m_streamingImagePoolsMutex;
+            uint64_t m_residencyFrameIndex = 0;
         };
     }
 }
@@ -50,6 +50,7 @@ namespace AZ
             request.m_scopeId = scope.GetId();
             request.m_deviceIndex = scope.GetDeviceIndex();
             request.m_submitCount = scope.GetEstimatedItemCount();
+            request.m_submitCostOffsets = scope.GetEstimatedItemCostOffsets();
             request.m_commandLists = reinterpret_cast<RHI::CommandList* const*>(m_workRequest.m_commandLists.data());
             request.m_commandListCount = commandListCount;
             request.m_jobPolicy = globalJobPolicy;
@@ -141,6 +141,91 @@ namespace AZ
 
             MemoryView& blasMemoryView = static_cast<Buffer*>(buffers.m_blasBuffer.get())->GetMemoryView();
             blasMemoryView.SetName(L"BLAS");
+
+            if (RHI::CheckBitsAny(descriptor->GetBuildFlags(), RHI::RayTracingAccelerationStructureBuildFlags::ENABLE_COMPACTION))
+            {
+                // create the buffer the build writes the compacted size to
+                buffers.m_compactedSizeBuffer = RHI::Factory::Get().CreateBuffer();
+                AZ::RHI::BufferDescriptor compactedSizeBufferDescriptor;
+                compactedSizeBufferDescriptor.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::CopyRead;
+                compactedSizeBufferDescriptor.m_byteCount = sizeof(D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC);
+
+                AZ::RHI::DeviceBufferInitRequest compactedSizeBufferRequest;
+                compactedSizeBufferRequest.m_buffer = buffers.m_compactedSizeBuffer.get();
+                compactedSizeBufferRequest.m_descriptor = compactedSizeBufferDescriptor;
+                resultCode = bufferPools.GetCompactedSizeBufferPool()->InitBuffer(compactedSizeBufferRequest);
+                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to create BLAS compacted size buffer");
+
+                // create the buffer the compacted size is read back from
+                buffers.m_compactedSizeReadbackBuffer = RHI::Factory::Get().CreateBuffer();
+                AZ::RHI::BufferDescriptor readbackBufferDescriptor;
+                readbackBufferDescriptor.m_bindFlags = RHI::BufferBindFlags::CopyWrite;
+                readbackBufferDescriptor.m_byteCount = compactedSizeBufferDescriptor.m_byteCount;
+
+                AZ::RHI::DeviceBufferInitRequest readbackBufferRequest;
+                readbackBufferRequest.m_buffer = buffers.m_compactedSizeReadbackBuffer.get();
+                readbackBufferRequest.m_descriptor = readbackBufferDescriptor;
+                resultCode = bufferPools.GetCompactedSizeReadbackBufferPool()->InitBuffer(readbackBufferRequest);
+                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to create BLAS compacted size readback buffer");
+            }
+#endif
+            return RHI::ResultCode::Success;
+        }
+
+        uint64_t RayTracingBlas::GetCompactedSizeInBytes() const
+        {
+            uint64_t compactedSize = 0;
+#ifdef AZ_DX12_DXR_SUPPORT
+            const BlasBuffers& buffers = GetBuffers();
+            if (!buffers.m_compactedSizeReadbackBuffer)
+            {
+                return 0;
+            }
+
+            const MemoryView& readbackMemoryView = static_cast<const Buffer*>(buffers.m_compactedSizeReadbackBuffer.get())->GetMemoryView();
+            CpuVirtualAddress readbackData = readbackMemoryView.Map(RHI::HostMemoryAccess::Read);
+            if (readbackData)
+            {
+                compactedSize = reinterpret_cast<const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC*>(readbackData)->CompactedSizeInBytes;
+                readbackMemoryView.Unmap(RHI::HostMemoryAccess::Read);
+            }
+#endif
+            return compactedSize;
+        }
+
+        RHI::ResultCode RayTracingBlas::CreateCompactedBuffersInternal([[maybe_unused]] RHI::Device& deviceBase, [[maybe_unused]] const RHI::DeviceRayTracingBlas& sourceBlas, [[maybe_unused]] const RHI::DeviceRayTracingBufferPools& bufferPools)
+        {
+#ifdef AZ_DX12_DXR_SUPPORT
+            const RayTracingBlas& source = static_cast<const RayTracingBlas&>(sourceBlas);
+
+            // the compacted BLAS keeps the inputs of the source, it is never rebuilt from them but callers may inspect them
+            m_geometryDescs = source.m_geometryDescs;
+            m_inputs = source.m_inputs;
+            m_inputs.pGeometryDescs = m_geometryDescs.data();
+
+            BlasBuffers& buffers = m_buffers.AdvanceCurrentElement();
+
+            // the AABB buffer is referenced by the geometry descs
+            buffers.m_aabbBuffer = source.GetBuffers().m_aabbBuffer;
+
+            buffers.m_blasBuffer = RHI::Factory::Get().CreateBuffer();
+            AZ::RHI::BufferDescriptor blasBufferDescriptor;
+            blasBufferDescriptor.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::RayTracingAccelerationStructure;
+            blasBufferDescriptor.m_byteCount = RHI::AlignUp(source.GetCompactedSizeInBytes(), D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
+
+            AZ::RHI::DeviceBufferInitRequest blasBufferRequest;
+            blasBufferRequest.m_buffer = buffers.m_blasBuffer.get();
+            blasBufferRequest.m_descriptor = blasBufferDescriptor;
+            RHI::ResultCode resultCode = bufferPools.GetBlasBufferPool()->InitBuffer(blasBufferRequest);
+            if (resultCode != RHI::ResultCode::Success)
+            {
+                AZ_Error("RayTracing", false, "Failed to create compacted BLAS buffer with error code: %d", resultCode);
+                buffers.m_blasBuffer = nullptr;
+                return resultCode;
+            }
+
+            MemoryView& blasMemoryView = static_cast<Buffer*>(buffers.m_blasBuffer.get())->GetMemoryView();
+            blasMemoryView.SetName(L"BLAS Compacted");
 #endif
             return RHI::ResultCode::Success;
         }
@@ -164,6 +249,11 @@ namespace AZ
                 dxBuildFlags |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE;
             }
 
+            if (RHI::CheckBitsAny(buildFlags, RHI::RayTracingAccelerationStructureBuildFlags::ENABLE_COMPACTION))
+            {
+                dxBuildFlags |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_COMPACTION;
+            }
+
             return dxBuildFlags;
         }
 #endif
@@ -33,27 +33,36 @@ namespace AZ
                 RHI::Ptr<RHI::DeviceBuffer> m_blasBuffer;
                 RHI::Ptr<RHI::DeviceBuffer> m_scratchBuffer;
                 RHI::Ptr<RHI::DeviceBuffer> m_aabbBuffer;
+
+                // only created when the BLAS is built with ENABLE_COMPACTION, the build writes the compacted size to
+                // m_compactedSizeBuffer and copies it to m_compactedSizeReadbackBuffer
+                RHI::Ptr<RHI::DeviceBuffer> m_compactedSizeBuffer;
+                RHI::Ptr<RHI::DeviceBuffer> m_compactedSizeReadbackBuffer;
             };
 
 #ifdef AZ_DX12_DXR_SUPPORT
             const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& GetInputs() const { return m_inputs; }
+
+            //! Converts the RHI build flags to the DX12 build flags, this is shared with the TLAS
+            static D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS GetAccelerationStructureBuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags &buildFlags);
 #endif
             const BlasBuffers& GetBuffers() const { return m_buffers.GetCurrentElement(); }
 
             // RHI::DeviceRayTracingBlas overrides...
             virtual bool IsValid() const override { return GetBuffers().m_blasBuffer != nullptr; }
+            uint64_t GetCompactedSizeInBytes() const override;
 
         private:
             RayTracingBlas() = default;
 
             // RHI::DeviceRayTracingBlas overrides...
             RHI::ResultCode CreateBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingBlasDescriptor* descriptor, const RHI::DeviceRayTracingBufferPools& rayTracingBufferPools) override;
+            RHI::ResultCode CreateCompactedBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingBlas& sourceBlas, const RHI::DeviceRayTracingBufferPools& rayTracingBufferPools) override;
 
 #ifdef AZ_DX12_DXR_SUPPORT
             AZStd::vector<D3D12_RAYTRACING_GEOMETRY_DESC> m_geometryDescs;
             D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS m_inputs;
 
-            static D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS GetAccelerationStructureBuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags &buildFlags);
 #endif
 
             // buffer list to keep buffers alive for several frames
@@ -48,50 +48,7 @@ namespace AZ
             if (descriptor->GetInstancesBuffer() == nullptr)
             {
                 numInstances = aznumeric_caster(instances.size());
-                uint64_t instanceDescsSizeInBytes = RHI::AlignUp(aznumeric_cast<UINT64>(sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * instances.size()), D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
-            
-                // create instances buffer
-                buffers.m_tlasInstancesBuffer = RHI::Factory::Get().CreateBuffer();
-                AZ::RHI::BufferDescriptor tlasInstancesBufferDescriptor;
-                tlasInstancesBufferDescriptor.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite;
-                tlasInstancesBufferDescriptor.m_byteCount = instanceDescsSizeInBytes;
-                tlasInstancesBufferDescriptor.m_alignment = D3D12_RAYTRACING_INSTANCE_DESCS_BYTE_ALIGNMENT;
-            
-                AZ::RHI::DeviceBufferInitRequest tlasInstancesBufferRequest;
-                tlasInstancesBufferRequest.m_buffer = buffers.m_tlasInstancesBuffer.get();
-                tlasInstancesBufferRequest.m_descriptor = tlasInstancesBufferDescriptor;
-                [[maybe_unused]] RHI::ResultCode resultCode = bufferPools.GetTlasInstancesBufferPool()->InitBuffer(tlasInstancesBufferRequest);
-                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to create TLAS instances buffer");
-            
-                MemoryView& tlasInstancesMemoryView = static_cast<Buffer*>(buffers.m_tlasInstancesBuffer.get())->GetMemoryView();
-                tlasInstancesMemoryView.SetName(L"TLAS Instance");
-            
-                RHI::DeviceBufferMapResponse mapResponse;
-                resultCode = bufferPools.GetTlasInstancesBufferPool()->MapBuffer(RHI::DeviceBufferMapRequest(*buffers.m_tlasInstancesBuffer, 0, instanceDescsSizeInBytes), mapResponse);
-                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to map TLAS instances buffer");
-                D3D12_RAYTRACING_INSTANCE_DESC* mappedData = reinterpret_cast<D3D12_RAYTRACING_INSTANCE_DESC*>(mapResponse.m_data);
-            
-                ZeroMemory(mappedData, instanceDescsSizeInBytes);
-            
-                // create each D3D12_RAYTRACING_INSTANCE_DESC structure
-                for (uint32_t i = 0; i < instances.size(); ++i)
-                {
-                    const RHI::DeviceRayTracingTlasInstance& instance = instances[i];
-                    RayTracingBlas* blas = static_cast<RayTracingBlas*>(instance.m_blas.get());
-            
-                    mappedData[i].InstanceID = instance.m_instanceID;
-                    mappedData[i].InstanceContributionToHitGroupIndex = instance.m_hitGroupIndex;
-                    // convert transform to row-major 3x4
-                    AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromTransform(instance.m_transform);
-                    matrix3x4.MultiplyByScale(instance.m_nonUniformScale);
-                    matrix3x4.StoreToRowMajorFloat12(&mappedData[i].Transform[0][0]);
-                    mappedData[i].AccelerationStructure = static_cast<DX12::Buffer*>(blas->GetBuffers().m_blasBuffer.get())->GetMemoryView().GetGpuAddress();
-                    mappedData[i].InstanceMask = instance.m_instanceMask;
-                    mappedData[i].Flags = instance.m_transparent ? D3D12_RAYTRACING_INSTANCE_FLAG_FORCE_NON_OPAQUE : D3D12_RAYTRACING_INSTANCE_FLAG_NONE;
-                }
-            
-                bufferPools.GetTlasInstancesBufferPool()->UnmapBuffer(*buffers.m_tlasInstancesBuffer);
-                tlasInstancesGpuAddress = tlasInstancesMemoryView.GetGpuAddress();
+                tlasInstancesGpuAddress = CreateInstancesBuffer(buffers, instances, bufferPools);
             }
             else
             {
@@ -107,11 +64,13 @@ namespace AZ
             m_inputs.InstanceDescs = tlasInstancesGpuAddress;
             m_inputs.DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY;
             m_inputs.NumDescs = static_cast<UINT>(numInstances);
-            m_inputs.Flags = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE;
+            m_inputs.Flags = RayTracingBlas::GetAccelerationStructureBuildFlags(descriptor->GetBuildFlags());
             
             D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO prebuildInfo = {};
             dx12Device->GetRaytracingAccelerationStructurePrebuildInfo(&m_inputs, &prebuildInfo);
             
+            // the scratch buffer is kept for the updates of the TLAS, so it must be large enough for both
+            prebuildInfo.ScratchDataSizeInBytes = AZStd::max(prebuildInfo.ScratchDataSizeInBytes, prebuildInfo.UpdateScratchDataSizeInBytes);
             prebuildInfo.ScratchDataSizeInBytes = RHI::AlignUp(prebuildInfo.ScratchDataSizeInBytes, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
             prebuildInfo.ResultDataMaxSizeInBytes = RHI::AlignUp(prebuildInfo.ResultDataMaxSizeInBytes, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
             
@@ -147,5 +106,84 @@ namespace AZ
 #endif
             return RHI::ResultCode::Success;
         }
+
+        RHI::ResultCode RayTracingTlas::UpdateBuffersInternal([[maybe_unused]] RHI::Device& deviceBase, [[maybe_unused]] const RHI::DeviceRayTracingTlasDescriptor* descriptor, [[maybe_unused]] const RHI::DeviceRayTracingBufferPools& bufferPools)
+        {
+#ifdef AZ_DX12_DXR_SUPPORT
+            const RHI::DeviceRayTracingTlasInstanceVector& instances = descriptor->GetInstances();
+
+            // an update only changes the transforms of the instances the TLAS was built with
+            const TlasBuffers& previousBuffers = GetBuffers();
+            if (!RHI::CheckBitsAny(m_inputs.Flags, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE) ||
+                descriptor->GetInstancesBuffer() != nullptr ||
+                !previousBuffers.m_tlasBuffer ||
+                m_inputs.NumDescs != instances.size())
+            {
+                return RHI::ResultCode::InvalidOperation;
+            }
+
+            // the update is in place, so the acceleration structure and scratch buffers are carried over to the next element
+            RHI::Ptr<RHI::DeviceBuffer> tlasBuffer = previousBuffers.m_tlasBuffer;
+            RHI::Ptr<RHI::DeviceBuffer> scratchBuffer = previousBuffers.m_scratchBuffer;
+
+            TlasBuffers& buffers = m_buffers.AdvanceCurrentElement();
+            buffers.m_tlasBuffer = tlasBuffer;
+            buffers.m_scratchBuffer = scratchBuffer;
+            m_inputs.InstanceDescs = CreateInstancesBuffer(buffers, instances, bufferPools);
+#endif
+            return RHI::ResultCode::Success;
+        }
+
+#ifdef AZ_DX12_DXR_SUPPORT
+        D3D12_GPU_VIRTUAL_ADDRESS RayTracingTlas::CreateInstancesBuffer(
+            TlasBuffers& buffers, const RHI::DeviceRayTracingTlasInstanceVector& instances, const RHI::DeviceRayTracingBufferPools& bufferPools)
+        {
+            uint64_t instanceDescsSizeInBytes = RHI::AlignUp(aznumeric_cast<UINT64>(sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * instances.size()), D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
+
+            // create instances buffer
+            buffers.m_tlasInstancesBuffer = RHI::Factory::Get().CreateBuffer();
+            AZ::RHI::BufferDescriptor tlasInstancesBufferDescriptor;
+            tlasInstancesBufferDescriptor.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite;
+            tlasInstancesBufferDescriptor.m_byteCount = instanceDescsSizeInBytes;
+            tlasInstancesBufferDescriptor.m_alignment = D3D12_RAYTRACING_INSTANCE_DESCS_BYTE_ALIGNMENT;
+
+            AZ::RHI::DeviceBufferInitRequest tlasInstancesBufferRequest;
+            tlasInstancesBufferRequest.m_buffer = buffers.m_tlasInstancesBuffer.get();
+            tlasInstancesBufferRequest.m_descriptor = tlasInstancesBufferDescriptor;
+            [[maybe_unused]] RHI::ResultCode resultCode = bufferPools.GetTlasInstancesBufferPool()->InitBuffer(tlasInstancesBufferRequest);
+            AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to create TLAS instances buffer");
+
+            MemoryView& tlasInstancesMemoryView = static_cast<Buffer*>(buffers.m_tlasInstancesBuffer.get())->GetMemoryView();
+            tlasInstancesMemoryView.SetName(L"TLAS Instance");
+
+            RHI::DeviceBufferMapResponse mapResponse;
+            resultCode = bufferPools.GetTlasInstancesBufferPool()->MapBuffer(RHI::DeviceBufferMapRequest(*buffers.m_tlasInstancesBuffer, 0, instanceDescsSizeInBytes), mapResponse);
+            AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to map TLAS instances buffer");
+            D3D12_RAYTRACING_INSTANCE_DESC* mappedData = reinterpret_cast<D3D12_RAYTRACING_INSTANCE_DESC*>(mapResponse.m_data);
+
+            ZeroMemory(mappedData, instanceDescsSizeInBytes);
+
+            // create each D3D12_RAYTRACING_INSTANCE_DESC structure
+            for (uint32_t i = 0; i < instances.size(); ++i)
+            {
+                const RHI::DeviceRayTracingTlasInstance& instance = instances[i];
+                RayTracingBlas* blas = static_cast<RayTracingBlas*>(instance.m_blas.get());
+
+                mappedData[i].InstanceID = instance.m_instanceID;
+                mappedData[i].InstanceContributionToHitGroupIndex = instance.m_hitGroupIndex;
+                // convert transform to row-major 3x4
+                AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromTransform(instance.m_transform);
+                matrix3x4.MultiplyByScale(instance.m_nonUniformScale);
+                matrix3x4.StoreToRowMajorFloat12(&mappedData[i].Transform[0][0]);
+                // an instance without a BLAS is inactive, it keeps its slot so the instance indices don't change
+                mappedData[i].AccelerationStructure = blas ? static_cast<DX12::Buffer*>(blas->GetBuffers().m_blasBuffer.get())->GetMemoryView().GetGpuAddress() : 0;
+                mappedData[i].InstanceMask = instance.m_instanceMask;
+                mappedData[i].Flags = instance.m_transparent ? D3D12_RAYTRACING_INSTANCE_FLAG_FORCE_NON_OPAQUE : D3D12_RAYTRACING_INSTANCE_FLAG_NONE;
+            }
+
+            bufferPools.GetTlasInstancesBufferPool()->UnmapBuffer(*buffers.m_tlasInstancesBuffer);
+            return tlasInstancesMemoryView.GetGpuAddress();
+        }
+#endif
     }
 }
@@ -49,8 +49,13 @@ namespace AZ
 
             // RHI::DeviceRayTracingTlas overrides
             RHI::ResultCode CreateBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingTlasDescriptor* descriptor, const RHI::DeviceRayTracingBufferPools& rayTracingBufferPools) override;
+            RHI::ResultCode UpdateBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingTlasDescriptor* descriptor, const RHI::DeviceRayTracingBufferPools& rayTracingBufferPools) override;
 
 #ifdef AZ_DX12_DXR_SUPPORT
+            //! Creates and fills the instances buffer of the TLAS buffers, and returns its GPU address
+            D3D12_GPU_VIRTUAL_ADDRESS CreateInstancesBuffer(
+                TlasBuffers& buffers, const RHI::DeviceRayTracingTlasInstanceVector& instances, const RHI::DeviceRayTracingBufferPools& bufferPools);
+
             D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS m_inputs;
 #endif
 
@@ -206,7 +206,17 @@ namespace AZ
             
             if (m_constantBufferSize && groupBase.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceMask::ConstantDataMask)))
             {
-                memcpy(group.GetCompiledData().m_cpuConstantAddress, groupData.GetConstantData().data(), groupData.GetConstantData().size());
+                // Only write the constants that changed since this compiled data was last written.
+                const AZStd::span<const uint8_t> constantData = groupData.GetConstantData();
+                const RHI::Interval dirtyInterval = groupBase.GetConstantDataDirtyInterval();
+                const uint32_t dirtyEnd = AZStd::min(dirtyInterval.m_max, static_cast<uint32_t>(constantData.size()));
+                if (dirtyInterval.m_min < dirtyEnd)
+                {
+                    memcpy(
+                        group.GetCompiledData().m_cpuConstantAddress + dirtyInterval.m_min,
+                        constantData.data() + dirtyInterval.m_min,
+                        dirtyEnd - dirtyInterval.m_min);
+                }
             }
 
             if (m_viewsDescriptorTableSize)
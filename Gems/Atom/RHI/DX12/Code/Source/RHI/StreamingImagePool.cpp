@@ -186,11 +186,14 @@ namespace AZ
             }
 
             SetResolver(AZStd::make_unique<StreamingImagePoolResolver>());
+            device.AddStreamingImagePool(this);
             return RHI::ResultCode::Success;
         }
 
         void StreamingImagePool::ShutdownInternal()
         {
+            GetDevice().RemoveStreamingImagePool(this);
+
             if (m_enableTileResource)
             {
                 m_tileAllocator.DeAllocate(AZStd::vector<HeapTiles>{m_defaultTile});
@@ -666,6 +669,22 @@ namespace AZ
             return RHI::ResultCode::Success;
         }
 
+        size_t StreamingImagePool::ReleaseMemory(size_t releaseSizeInBytes)
+        {
+            if (!m_memoryReleaseCallback)
+            {
+                return 0;
+            }
+
+            RHI::HeapMemoryUsage& heapMemoryUsage = GetDeviceHeapMemoryUsage();
+            const size_t usedBefore = heapMemoryUsage.m_usedResidentInBytes;
+            const size_t targetUsage = usedBefore > releaseSizeInBytes ? usedBefore - releaseSizeInBytes : 0;
+            m_memoryReleaseCallback(targetUsage);
+
+            const size_t usedAfter = heapMemoryUsage.m_usedResidentInBytes;
+            return usedBefore > usedAfter ? usedBefore - usedAfter : 0;
+        }
+
         bool StreamingImagePool::SupportTiledImageInternal() const
         {
             return m_enableTileResource;
@@ -35,6 +35,10 @@ namespace AZ
 
             StreamingImagePoolResolver* GetResolver();
 
+            //! Asks the owner of the pool to evict mips until the pool uses the given amount of memory less.
+            //! Returns the amount of memory that was released.
+            size_t ReleaseMemory(size_t releaseSizeInBytes);
+
         private:
             StreamingImagePool() = default;
 
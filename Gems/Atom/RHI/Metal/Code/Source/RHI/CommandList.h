@@ -74,6 +74,12 @@ namespace AZ
             void BuildTopLevelAccelerationStructure(
                 const RHI::DeviceRayTracingTlas &rayTracingTlas,
                 const AZStd::vector<const RHI::DeviceRayTracingBlas *> &changedBlasList) override;
+            void UpdateTopLevelAccelerationStructure(
+                const RHI::DeviceRayTracingTlas &rayTracingTlas,
+                const AZStd::vector<const RHI::DeviceRayTracingBlas *> &changedBlasList) override;
+            void CompactBottomLevelAccelerationStructure(
+                const RHI::DeviceRayTracingBlas &sourceBlas,
+                const RHI::DeviceRayTracingBlas &compactedBlas) override;
             void SetFragmentShadingRate(
                 [[maybe_unused]] RHI::ShadingRate rate,
                 [[maybe_unused]] const RHI::ShadingRateCombinators& combinators = DefaultShadingRateCombinators) override {}
@@ -273,7 +273,8 @@ namespace AZ
             //       therefore, the debug data is probably embedded in the spirv blob.
 
             // Run Shader Compiler
-            if (!RHI::ExecuteShaderCompiler(dxcRelativePath, dxcCommandOptions, shaderSourceFile, tempFolder, "DXC"))
+            const AZStd::string dxcOutputFiles[] = { shaderOutputFile, objectCodeOutputFile };
+            if (!RHI::ExecuteShaderCompilerWithCache(dxcRelativePath, dxcCommandOptions, dxcInputFile, dxcOutputFiles, shaderSourceFile, tempFolder, "DXC"))
             {
                 return false;
             }
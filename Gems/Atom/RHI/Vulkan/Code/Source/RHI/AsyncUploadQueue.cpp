@@ -31,6 +31,9 @@ namespace AZ
 {
     namespace Vulkan
     {
+        // Refer to VkBufferImageCopy in the spec.
+        static constexpr size_t StagingBufferOffsetAlignment = 4;
+
         AsyncUploadQueue::Descriptor::Descriptor(size_t stagingSizeInBytes)
         {
             m_stagingSizeInBytes = stagingSizeInBytes;
@@ -113,30 +116,24 @@ namespace AZ
                 AZ_PROFILE_SCOPE(RHI, "Upload Buffer");
                 size_t pendingByteOffset = 0;
                 size_t pendingByteCount = byteCount;
-                FramePacket* framePacket = nullptr;
                 Queue* vulkanQueue = static_cast<Queue*>(queue);
 
-                // Insert a barrier to wait for anybody using this buffer range.
-                // We need to create a command list to insert the barrier.
+                // The barrier waiting for anybody using this buffer, the copies and the epilogue barrier are recorded in
+                // the same packet, which is only split if the upload doesn't fit in the staging ring buffer.
                 BeginFramePacket(vulkanQueue);
                 EmmitPrologueMemoryBarrier(*buffer, 0, pendingByteCount);
-                EndFramePacket(vulkanQueue);
 
                 while (pendingByteCount > 0)
                 {
                     AZ_PROFILE_SCOPE(RHI, "Upload Buffer Chunk");
 
-                    framePacket = BeginFramePacket(vulkanQueue);
                     const size_t bytesToCopy = AZStd::min(pendingByteCount, m_descriptor.m_stagingSizeInBytes);
-                    EmmitPrologueMemoryBarrier(*buffer, pendingByteOffset, bytesToCopy);
-
-                    void* mapped = framePacket->m_stagingBuffer->GetBufferMemoryView()->Map(RHI::HostMemoryAccess::Write);
-                    memcpy(mapped, sourceData + pendingByteOffset, bytesToCopy);
-                    framePacket->m_stagingBuffer->GetBufferMemoryView()->Unmap(RHI::HostMemoryAccess::Write);
+                    const size_t stagingOffset = AllocateStaging(vulkanQueue, bytesToCopy, StagingBufferOffsetAlignment);
+                    memcpy(m_stagingData + stagingOffset, sourceData + pendingByteOffset, bytesToCopy);
 
                     RHI::DeviceCopyBufferDescriptor copyDescriptor;
-                    copyDescriptor.m_sourceBuffer = framePacket->m_stagingBuffer.get();
-                    copyDescriptor.m_sourceOffset = 0;
+                    copyDescriptor.m_sourceBuffer = m_stagingBuffer.get();
+                    copyDescriptor.m_sourceOffset = static_cast<uint32_t>(stagingOffset);
                     copyDescriptor.m_destinationBuffer = buffer;
                     copyDescriptor.m_destinationOffset = static_cast<uint32_t>(pendingByteOffset);
                     copyDescriptor.m_size = static_cast<uint32_t>(bytesToCopy);
@@ -145,8 +142,6 @@ namespace AZ
 
                     pendingByteOffset += bytesToCopy;
                     pendingByteCount -= bytesToCopy;
-
-                    EndFramePacket(vulkanQueue);
                 }
 
                 AZStd::vector<Fence*> fencesToSignal;
@@ -208,12 +203,18 @@ namespace AZ
                 AZ_PROFILE_SCOPE(RHI, "Upload Image");
 
                 Queue* vulkanQueue = static_cast<Queue*>(queue);
-                FramePacket* framePacket = BeginFramePacket(vulkanQueue);
+                BeginFramePacket(vulkanQueue);
 
                 // Set pipeline barriers before copy.
                 EmmitPrologueMemoryBarrier(request, residentMip);
 
-                const static uint32_t bufferOffsetAlign = 4; // refer VkBufferImageCopy in the spec.
+                // The source offset of a copy must also be a multiple of the texel block size of the image.
+                const size_t formatSize = AZStd::max<size_t>(RHI::GetFormatSize(image->GetDescriptor().m_format), 1);
+                size_t stagingAlignment = formatSize;
+                while (stagingAlignment % StagingBufferOffsetAlignment != 0)
+                {
+                    stagingAlignment += formatSize;
+                }
 
                 // Variables for split subresource slice. 
                 // If a subresource slice pitch is large than one staging size, we may split the slice by rows.
@@ -228,7 +229,7 @@ namespace AZ
                     const uint32_t subresourceSlicePitch = subresourceLayout.m_bytesPerImage;
 
                     // Staging sizes
-                    const uint32_t stagingRowPitch = RHI::AlignUp(subresourceLayout.m_bytesPerRow, bufferOffsetAlign);
+                    const uint32_t stagingRowPitch = RHI::AlignUp(subresourceLayout.m_bytesPerRow, StagingBufferOffsetAlignment);
                     const uint32_t stagingSlicePitch = subresourceLayout.m_rowCount * stagingRowPitch;
                     const uint32_t rowsPerSplit = static_cast<uint32_t>(m_descriptor.m_stagingSizeInBytes) / stagingRowPitch;
                     const uint32_t compressedTexelBlockSizeHeight = subresourceLayout.m_blockElementHeight;
@@ -237,9 +238,6 @@ namespace AZ
                     // Images with a RowCount which is higher than the ImageHeight indicates a planar image, which is not supported for streaming images.
                     AZ_Error("StreamingImage", subresourceLayout.m_size.m_height >= subresourceLayout.m_rowCount, "AsyncUploadQueue::QueueUpload expects ImageHeight '%d' to be bigger than or equal to the image's RowCount '%d'.", subresourceLayout.m_size.m_height, subresourceLayout.m_rowCount);
 
-                    // The final staging size for each CopyTextureRegion command
-                    uint32_t stagingSize = stagingSlicePitch;
-
                     // Prepare for splitting this subresource if needed.
                     if (stagingSlicePitch > m_descriptor.m_stagingSizeInBytes)
                     {
@@ -253,42 +251,32 @@ namespace AZ
                         }
 
                         needSplitSlice = true;
-                        stagingSize = rowsPerSplit * stagingRowPitch;
-                        AZ_Assert(stagingSize <= m_descriptor.m_stagingSizeInBytes, "Final staging size can't be larger than staging buffer size.");
                     }
 
                     if (!needSplitSlice)
                     {
-                        // Try to use one frame packet for all subresources if possible.
+                        // All the subresources are staged in the same packet while they fit in the staging ring buffer.
                         for (const RHI::StreamingImageSubresourceData& subresourceData : request.m_mipSlices[sliceIndex].m_subresources)
                         {
                             for (uint32_t depth = 0; depth < subresourceLayout.m_size.m_depth; depth++)
                             {
                                 const uint8_t* subresourceDataStart = reinterpret_cast<const uint8_t*>(subresourceData.m_data) + (depth * subresourceSlicePitch);
-
-                                // If the current framePacket is not big enough, switch to next one.
-                                if (stagingSize > m_descriptor.m_stagingSizeInBytes - framePacket->m_dataOffset)
-                                {
-                                    EndFramePacket(vulkanQueue);
-                                    framePacket = BeginFramePacket(vulkanQueue);
-                                }
+                                const size_t stagingOffset = AllocateStaging(vulkanQueue, stagingSlicePitch, stagingAlignment);
 
                                 // Copy subresource data to staging memory.
                                 {
                                     AZ_PROFILE_SCOPE(RHI, "Copy CPU image");
-                                    uint8_t* stagingDataStart = reinterpret_cast<uint8_t*>(framePacket->m_stagingBuffer->GetBufferMemoryView()->Map(RHI::HostMemoryAccess::Write)) + framePacket->m_dataOffset;
+                                    uint8_t* stagingDataStart = m_stagingData + stagingOffset;
                                     for (uint32_t row = 0; row < subresourceLayout.m_rowCount; ++row)
                                     {
                                         memcpy(stagingDataStart + row * stagingRowPitch, subresourceDataStart + row * subresourceLayout.m_bytesPerRow, subresourceLayout.m_bytesPerRow);
                                     }
-
-                                    framePacket->m_stagingBuffer->GetBufferMemoryView()->Unmap(RHI::HostMemoryAccess::Write);
                                 }
 
                                 // Add copy command to copy image subresource from staging memory to image GPU resource.
                                 RHI::DeviceCopyBufferToImageDescriptor copyDescriptor;
-                                copyDescriptor.m_sourceBuffer = framePacket->m_stagingBuffer.get();
-                                copyDescriptor.m_sourceOffset = framePacket->m_dataOffset;
+                                copyDescriptor.m_sourceBuffer = m_stagingBuffer.get();
+                                copyDescriptor.m_sourceOffset = static_cast<uint32_t>(stagingOffset);
                                 copyDescriptor.m_sourceBytesPerRow = stagingRowPitch;
                                 copyDescriptor.m_sourceBytesPerImage = stagingSlicePitch;
                                 copyDescriptor.m_sourceSize = subresourceLayout.m_size;
@@ -301,8 +289,6 @@ namespace AZ
                                 copyDescriptor.m_destinationOrigin.m_front = depth;
 
                                 m_commandList->Submit(RHI::DeviceCopyItem(copyDescriptor));
-
-                                framePacket->m_dataOffset += stagingSlicePitch;
                             }
                             // Next slice in this array.
                             ++arraySlice;
@@ -319,8 +305,7 @@ namespace AZ
 
                                 // The copy destination is same for each subresource.
                                 RHI::DeviceCopyBufferToImageDescriptor copyDescriptor;
-                                copyDescriptor.m_sourceBuffer = framePacket->m_stagingBuffer.get();
-                                copyDescriptor.m_sourceOffset = framePacket->m_dataOffset;
+                                copyDescriptor.m_sourceBuffer = m_stagingBuffer.get();
                                 copyDescriptor.m_sourceBytesPerRow = stagingRowPitch;
                                 copyDescriptor.m_sourceBytesPerImage = stagingSlicePitch;
                                 copyDescriptor.m_sourceSize = subresourceLayout.m_size;
@@ -336,14 +321,8 @@ namespace AZ
                                 uint32_t destHeight = 0;
                                 while (startRow < subresourceLayout.m_rowCount)
                                 {
-                                    if (stagingSize > m_descriptor.m_stagingSizeInBytes - framePacket->m_dataOffset)
-                                    {
-                                        EndFramePacket(vulkanQueue);
-                                        framePacket = BeginFramePacket(vulkanQueue);
-                                        copyDescriptor.m_sourceBuffer = framePacket->m_stagingBuffer.get();
-                                    }
-
                                     const uint32_t endRow = AZStd::min(startRow + rowsPerSplit, subresourceLayout.m_rowCount);
+                                    const size_t stagingOffset = AllocateStaging(vulkanQueue, (endRow - startRow) * stagingRowPitch, stagingAlignment);
 
                                     // Calculate the blocksize for BC formatted images; the copy command works in texels.
                                     uint32_t heightToCopy = (endRow - startRow) * compressedTexelBlockSizeHeight;
@@ -352,13 +331,11 @@ namespace AZ
                                     {
                                         AZ_PROFILE_SCOPE(RHI, "Copy CPU image");
 
-                                        uint8_t* stagingDataStart = reinterpret_cast<uint8_t*>(framePacket->m_stagingBuffer->GetBufferMemoryView()->Map(RHI::HostMemoryAccess::Write));
-                                        stagingDataStart += framePacket->m_dataOffset;
+                                        uint8_t* stagingDataStart = m_stagingData + stagingOffset;
                                         for (uint32_t row = startRow; row < endRow; ++row)
                                         {
                                             memcpy(stagingDataStart + (row - startRow) * stagingRowPitch, subresourceDataStart + row * subresourceLayout.m_bytesPerRow, subresourceLayout.m_bytesPerRow);
                                         }
-                                        framePacket->m_stagingBuffer->GetBufferMemoryView()->Unmap(RHI::HostMemoryAccess::Write);
                                     }
 
                                     //Clamp heightToCopy to match subresourceLayout.m_size.m_height as it is possible to go over
@@ -372,11 +349,10 @@ namespace AZ
                                     // Add copy command to copy image subresource from staging memory to image GPU resource.
                                     copyDescriptor.m_destinationOrigin.m_top = destHeight;
                                     copyDescriptor.m_sourceSize.m_height = heightToCopy;
-                                    copyDescriptor.m_sourceOffset = framePacket->m_dataOffset;
+                                    copyDescriptor.m_sourceOffset = static_cast<uint32_t>(stagingOffset);
 
                                     m_commandList->Submit(RHI::DeviceCopyItem(copyDescriptor));
 
-                                    framePacket->m_dataOffset += stagingSize;
                                     startRow = endRow;
                                     destHeight += heightToCopy;
                                 }
@@ -386,9 +362,8 @@ namespace AZ
                     }
                 }
 
-                // Set pipeline barriers after the copy.
+                // Set pipeline barriers after the copy, in the same packet.
                 VkPipelineStageFlags waitStage = GetResourcePipelineStateFlags(image->GetDescriptor().m_bindFlags) & device.GetSupportedPipelineStageFlags();
-                EndFramePacket(vulkanQueue);
                 ProcessEndOfUpload(
                     vulkanQueue,
                     waitStage,
@@ -477,11 +452,21 @@ namespace AZ
             m_framePackets.resize(m_descriptor.m_frameCount);
             RHI::ResultCode result = RHI::ResultCode::Success;
 
-            const RHI::BufferDescriptor bufferDescriptor(RHI::BufferBindFlags::CopyRead, m_descriptor.m_stagingSizeInBytes);
+            // The packets share a staging ring buffer as big as one staging buffer per packet. An allocation is at most half
+            // of the ring, so it always fits once the older packets are done.
+            AZ_Assert(m_descriptor.m_frameCount >= 2, "AsyncUploadQueue needs at least 2 frame packets");
+            m_stagingBufferSize = m_descriptor.m_stagingSizeInBytes * m_descriptor.m_frameCount;
+            m_stagingBuffer = device.AcquireStagingBuffer(m_stagingBufferSize);
+            if (!m_stagingBuffer)
+            {
+                AZ_Assert(false, "Failed to acquire staging buffer");
+                return RHI::ResultCode::OutOfMemory;
+            }
+            m_ringHead = 0;
+            m_ringTail = 0;
+
             for (FramePacket& framePacket : m_framePackets)
             {
-                framePacket.m_stagingBuffer = device.AcquireStagingBuffer(m_descriptor.m_stagingSizeInBytes);
-                AZ_Assert(framePacket.m_stagingBuffer, "Failed to acquire staging buffer");
                 framePacket.m_fence = Fence::Create();
                 result = framePacket.m_fence->Init(device, RHI::FenceState::Signaled);
                 framePacket.m_fence->SetSignalEvent(AZStd::make_shared<SignalEvent>());
@@ -502,7 +487,11 @@ namespace AZ
             FramePacket& framePacket = m_framePackets[m_frameIndex];
             framePacket.m_fence->WaitOnCpu();
             framePacket.m_fence->Reset();
-            framePacket.m_dataOffset = 0;
+            // This was the oldest packet in flight, so every staging allocation up to its end can be reused.
+            m_ringTail = AZStd::max(m_ringTail, framePacket.m_ringEndPosition);
+
+            // The staging memory is mapped once per packet, and flushed when the packet is submitted.
+            m_stagingData = static_cast<uint8_t*>(m_stagingBuffer->GetBufferMemoryView()->Map(RHI::HostMemoryAccess::Write));
 
             queue->BeginDebugLabel(AZStd::string::format("AsyncUploadQueue Packet %d", static_cast<int>(m_frameIndex)).c_str());
             m_commandList = device.AcquireCommandList(RHI::HardwareQueueClass::Copy);
@@ -520,7 +509,11 @@ namespace AZ
 
             m_commandList->EndCommandBuffer();
 
+            m_stagingBuffer->GetBufferMemoryView()->Unmap(RHI::HostMemoryAccess::Write);
+            m_stagingData = nullptr;
+
             FramePacket& framePacket = m_framePackets[m_frameIndex];
+            framePacket.m_ringEndPosition = m_ringHead;
             const AZStd::vector<RHI::Ptr<CommandList>> commandBuffers{ m_commandList };
             static const AZStd::vector<Semaphore::WaitSemaphore> semaphoresWaitInfo;
             AZStd::vector<RHI::Ptr<Semaphore>> semaphoresToSignal;
@@ -535,6 +528,42 @@ namespace AZ
             m_recordingFrame = false;
         }
 
+        size_t AsyncUploadQueue::AllocateStaging(Queue* queue, size_t byteCount, size_t alignment)
+        {
+            AZ_Assert(m_recordingFrame, "Staging memory can only be allocated while recording a frame packet.");
+            AZ_Assert(byteCount <= m_descriptor.m_stagingSizeInBytes, "Staging allocation is bigger than the staging size.");
+
+            // Allocations don't wrap around the end of the ring, they move to its start instead.
+            const uint64_t ringSize = m_stagingBufferSize;
+            const uint64_t headOffset = m_ringHead % ringSize;
+            const uint64_t alignedOffset = (headOffset + alignment - 1) / alignment * alignment;
+            const uint64_t position = (alignedOffset + byteCount > ringSize) ? m_ringHead - headOffset + ringSize : m_ringHead - headOffset + alignedOffset;
+            const uint64_t endPosition = position + byteCount;
+
+            // Wait for the packets in flight, oldest first, until the allocation doesn't overlap the memory they use.
+            uint32_t waitIndex = (m_frameIndex + 1) % m_descriptor.m_frameCount;
+            while (endPosition - m_ringTail > ringSize)
+            {
+                if (waitIndex == m_frameIndex)
+                {
+                    // The rest of the ring is used by the packet being recorded, so it's submitted to reclaim it.
+                    AZ_PROFILE_SCOPE(RHI, "AsyncUploadQueue: Staging ring buffer full");
+                    EndFramePacket(queue);
+                    BeginFramePacket(queue);
+                    waitIndex = (m_frameIndex + 1) % m_descriptor.m_frameCount;
+                    continue;
+                }
+
+                FramePacket& framePacket = m_framePackets[waitIndex];
+                framePacket.m_fence->WaitOnCpu();
+                m_ringTail = AZStd::max(m_ringTail, framePacket.m_ringEndPosition);
+                waitIndex = (waitIndex + 1) % m_descriptor.m_frameCount;
+            }
+
+            m_ringHead = endPosition;
+            return static_cast<size_t>(position % ringSize);
+        }
+
         void AsyncUploadQueue::EmmitPrologueMemoryBarrier(const Buffer& buffer, size_t offset, size_t size)
         {
             const BufferMemoryView* memoryView = buffer.GetBufferMemoryView();
@@ -72,10 +72,11 @@ namespace AZ
 
             struct FramePacket
             {
-                RHI::Ptr<Buffer> m_stagingBuffer;
                 RHI::Ptr<Fence> m_fence;
 
-                uint32_t m_dataOffset = 0;
+                //! Ring position after the last staging allocation of the packet. The staging memory before it
+                //! can be reused once the fence is signaled.
+                uint64_t m_ringEndPosition = 0;
             };
 
             RHI::ResultCode BuildFramePackets();
@@ -83,6 +84,11 @@ namespace AZ
             FramePacket* BeginFramePacket(Queue* queue);
             void EndFramePacket(Queue* queue, Semaphore* semaphoreToSignal = nullptr);
 
+            //! Allocates staging memory for the packet being recorded from the staging ring buffer, and returns its offset.
+            //! It waits for older packets to reclaim their memory if needed, and submits the current packet if it holds
+            //! the memory itself.
+            size_t AllocateStaging(Queue* queue, size_t byteCount, size_t alignment);
+
 
             void EmmitPrologueMemoryBarrier(const Buffer& buffer, size_t offset, size_t size);
             void EmmitPrologueMemoryBarrier(const RHI::DeviceStreamingImageExpandRequest& request, uint32_t residentMip);
@@ -98,8 +104,8 @@ namespace AZ
                 const RHI::DeviceStreamingImageExpandRequest& request,
                 uint32_t residentMip);
 
-            // Handles the end of the upload. This includes emitting the epilogue barriers and doing any
-            // necessary cross queue synchronization and ownership transfer (if needed).
+            // Handles the end of the upload. This includes emitting the epilogue barriers in the packet being recorded, submitting it
+            // and doing any necessary cross queue synchronization and ownership transfer (if needed).
             template<typename ...Args>
             void ProcessEndOfUpload(
                 Queue* queue,
@@ -114,6 +120,14 @@ namespace AZ
             AZStd::vector<FramePacket> m_framePackets;
             uint32_t m_frameIndex = 0;
             bool m_recordingFrame = false;
+
+            // Staging ring buffer shared by all the packets. It's mapped while a packet is recorded.
+            // The head and tail are monotonic positions, the offset in the buffer is the position modulo its size.
+            RHI::Ptr<Buffer> m_stagingBuffer;
+            size_t m_stagingBufferSize = 0;
+            uint8_t* m_stagingData = nullptr;
+            uint64_t m_ringHead = 0;
+            uint64_t m_ringTail = 0;
             // Async queue used for waiting for an upload event to complete.
             RHI::AsyncWorkQueue m_asyncWaitQueue;
 
@@ -128,8 +142,6 @@ namespace AZ
             const AZStd::vector<Fence*> fencesToSignal,
             Args&& ...args)
         {
-            BeginFramePacket(queue);
-
             EmmitEpilogueMemoryBarrier(
                 *m_commandList,
                 AZStd::forward<Args>(args)...);
@@ -1161,9 +1161,62 @@ namespace AZ
 
             const auto& context = static_cast<Device&>(GetDevice()).GetContext();
 
+            const VkQueryPool compactedSizeQueryPool = blasBuffers.m_accelerationStructure->GetCompactedSizeQueryPool();
+            if (compactedSizeQueryPool != VK_NULL_HANDLE)
+            {
+                context.CmdResetQueryPool(GetNativeCommandBuffer(), compactedSizeQueryPool, 0, 1);
+            }
+
             // submit the command to build the BLAS
             const VkAccelerationStructureBuildRangeInfoKHR* rangeInfos = blasBuffers.m_rangeInfos.data();
             context.CmdBuildAccelerationStructuresKHR(GetNativeCommandBuffer(), 1, &blasBuffers.m_buildInfo, &rangeInfos);
+
+            if (compactedSizeQueryPool != VK_NULL_HANDLE)
+            {
+                // the compacted size can only be queried once the build completed
+                VkMemoryBarrier memoryBarrier = {};
+                memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                memoryBarrier.pNext = nullptr;
+                memoryBarrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR;
+                memoryBarrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
+                context.CmdPipelineBarrier(
+                    GetNativeCommandBuffer(),
+                    VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                    VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                    0,
+                    1,
+                    &memoryBarrier,
+                    0,
+                    nullptr,
+                    0,
+                    nullptr);
+
+                VkAccelerationStructureKHR accelerationStructure = blasBuffers.m_accelerationStructure->GetNativeAccelerationStructure();
+                context.CmdWriteAccelerationStructuresPropertiesKHR(
+                    GetNativeCommandBuffer(),
+                    1,
+                    &accelerationStructure,
+                    VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR,
+                    compactedSizeQueryPool,
+                    0);
+            }
+        }
+
+        void CommandList::CompactBottomLevelAccelerationStructure(
+            const RHI::DeviceRayTracingBlas& sourceBlas, const RHI::DeviceRayTracingBlas& compactedBlas)
+        {
+            const RayTracingBlas::BlasBuffers& sourceBuffers = static_cast<const RayTracingBlas&>(sourceBlas).GetBuffers();
+            const RayTracingBlas::BlasBuffers& compactedBuffers = static_cast<const RayTracingBlas&>(compactedBlas).GetBuffers();
+
+            const auto& context = static_cast<Device&>(GetDevice()).GetContext();
+
+            VkCopyAccelerationStructureInfoKHR copyInfo = {};
+            copyInfo.sType = VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR;
+            copyInfo.pNext = nullptr;
+            copyInfo.src = sourceBuffers.m_accelerationStructure->GetNativeAccelerationStructure();
+            copyInfo.dst = compactedBuffers.m_accelerationStructure->GetNativeAccelerationStructure();
+            copyInfo.mode = VK_COPY_ACCELERATION_STRUCTURE_MODE_COMPACT_KHR;
+            context.CmdCopyAccelerationStructureKHR(GetNativeCommandBuffer(), &copyInfo);
         }
 
         void CommandList::UpdateBottomLevelAccelerationStructure([[maybe_unused]] const RHI::DeviceRayTracingBlas& rayTracingBlas)
@@ -1185,6 +1238,18 @@ namespace AZ
 
         void CommandList::BuildTopLevelAccelerationStructure(
             const RHI::DeviceRayTracingTlas& rayTracingTlas, const AZStd::vector<const RHI::DeviceRayTracingBlas*>& changedBlasList)
+        {
+            BuildTopLevelAccelerationStructureInternal(rayTracingTlas, changedBlasList, false);
+        }
+
+        void CommandList::UpdateTopLevelAccelerationStructure(
+            const RHI::DeviceRayTracingTlas& rayTracingTlas, const AZStd::vector<const RHI::DeviceRayTracingBlas*>& changedBlasList)
+        {
+            BuildTopLevelAccelerationStructureInternal(rayTracingTlas, changedBlasList, true);
+        }
+
+        void CommandList::BuildTopLevelAccelerationStructureInternal(
+            const RHI::DeviceRayTracingTlas& rayTracingTlas, const AZStd::vector<const RHI::DeviceRayTracingBlas*>& changedBlasList, bool update)
         {
             const auto& context = static_cast<Device&>(GetDevice()).GetContext();
 
@@ -1217,7 +1282,14 @@ namespace AZ
             // submit the command to build the TLAS
             const VkAccelerationStructureBuildRangeInfoKHR& offsetInfo = tlasBuffers.m_offsetInfo;
             const VkAccelerationStructureBuildRangeInfoKHR* pOffsetInfo = &offsetInfo;
-            context.CmdBuildAccelerationStructuresKHR(GetNativeCommandBuffer(), 1, &tlasBuffers.m_buildInfo, &pOffsetInfo);
+            VkAccelerationStructureBuildGeometryInfoKHR buildInfo = tlasBuffers.m_buildInfo;
+            if (update)
+            {
+                // refit the TLAS in place with the new instance transforms
+                buildInfo.mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+                buildInfo.srcAccelerationStructure = buildInfo.dstAccelerationStructure;
+            }
+            context.CmdBuildAccelerationStructuresKHR(GetNativeCommandBuffer(), 1, &buildInfo, &pOffsetInfo);
 
             // we need a pipeline barrier on VK_ACCESS_ACCELERATION_STRUCTURE (both read and write) in case we are building
             // multiple TLAS objects in a command list
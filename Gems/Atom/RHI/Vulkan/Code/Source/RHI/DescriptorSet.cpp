@@ -46,6 +46,8 @@ namespace AZ
             
             WriteDescriptorData data;
             data.m_layoutIndex = layoutIndex;
+            data.m_objects.resize(bufViews.size());
+            data.m_resourceVersions.resize(bufViews.size());
 
             if (type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER ||
                 type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER)
@@ -70,6 +72,8 @@ namespace AZ
                     else
                     {
                         vkBufferView = static_cast<const BufferView&>(*bufferView.get()).GetNativeTexelBufferView();
+                        data.m_objects[i] = bufferView;
+                        data.m_resourceVersions[i] = bufferView->GetResource().GetVersion();
                     }
 
                     data.m_texelBufferViews[i] = vkBufferView;
@@ -106,6 +110,8 @@ namespace AZ
                         bufferInfo.offset =
                             bufferMemoryView->GetOffset() + bufferViewDescriptor.m_elementOffset * bufferViewDescriptor.m_elementSize;
                         bufferInfo.range = bufferViewDescriptor.m_elementCount * bufferViewDescriptor.m_elementSize;
+                        data.m_objects[i] = bufferView;
+                        data.m_resourceVersions[i] = bufferView->GetResource().GetVersion();
                     }
 
                     data.m_bufferViewsInfo[i] = bufferInfo;
@@ -118,7 +124,7 @@ namespace AZ
                 }
             }
 
-            m_updateData.push_back(AZStd::move(data));
+            QueueUpdate(AZStd::move(data));
         }
 
         void DescriptorSet::UpdateImageViews(uint32_t layoutIndex, const AZStd::span<const RHI::ConstPtr<RHI::DeviceImageView>>& imageViews, RHI::ShaderInputImageType imageType)
@@ -129,6 +135,8 @@ namespace AZ
             data.m_layoutIndex = layoutIndex;
 
             data.m_imageViewsInfo.resize(imageViews.size());
+            data.m_objects.resize(imageViews.size());
+            data.m_resourceVersions.resize(imageViews.size());
             for (size_t i = 0; i < imageViews.size(); ++i)
             {
                 VkDescriptorImageInfo imageInfo = {};
@@ -161,12 +169,14 @@ namespace AZ
                         imageInfo.imageLayout = RHI::CheckBitsAny(imageView->GetImage().GetAspectFlags(), RHI::ImageAspectFlags::DepthStencil) ?
                             VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
                     }
+                    data.m_objects[i] = imageViews[i];
+                    data.m_resourceVersions[i] = imageView->GetResource().GetVersion();
                 }
                 
                 data.m_imageViewsInfo[i]  = imageInfo;
             }
 
-            m_updateData.push_back(AZStd::move(data));
+            QueueUpdate(AZStd::move(data));
         }
 
         void DescriptorSet::UpdateSamplers(uint32_t layoutIndex, const AZStd::span<const RHI::SamplerState>& samplers)
@@ -182,22 +192,29 @@ namespace AZ
                 Sampler::Descriptor samplerDesc;
                 samplerDesc.m_device = &device;
                 samplerDesc.m_samplerState = samplerState;
-                imageInfo.sampler = device.AcquireSampler(samplerDesc)->GetNativeSampler();
+                RHI::Ptr<Sampler> sampler = device.AcquireSampler(samplerDesc);
+                imageInfo.sampler = sampler->GetNativeSampler();
                 data.m_imageViewsInfo.push_back(imageInfo);
+                data.m_objects.push_back(sampler);
+                data.m_resourceVersions.push_back(0);
             }
 
-            m_updateData.push_back(AZStd::move(data));
+            QueueUpdate(AZStd::move(data));
         }
 
-        void DescriptorSet::UpdateConstantData(AZStd::span<const uint8_t> rawData)
+        void DescriptorSet::UpdateConstantData(AZStd::span<const uint8_t> rawData, const RHI::Interval& dirtyInterval)
         {
             AZ_Assert(m_constantDataBuffer, "Null constant buffer");
             const DescriptorSetLayout& layout = *m_descriptor.m_descriptorSetLayout;
 
             BufferMemoryView* memoryView = m_constantDataBuffer->GetBufferMemoryView();
-            uint8_t* mappedData = static_cast<uint8_t*>(memoryView->Map(RHI::HostMemoryAccess::Write));
-            memcpy(mappedData, rawData.data(), rawData.size());
-            memoryView->Unmap(RHI::HostMemoryAccess::Write);
+            const uint32_t dirtyEnd = AZStd::min(dirtyInterval.m_max, static_cast<uint32_t>(rawData.size()));
+            if (dirtyInterval.m_min < dirtyEnd)
+            {
+                uint8_t* mappedData = static_cast<uint8_t*>(memoryView->Map(RHI::HostMemoryAccess::Write));
+                memcpy(mappedData + dirtyInterval.m_min, rawData.data() + dirtyInterval.m_min, dirtyEnd - dirtyInterval.m_min);
+                memoryView->Unmap(RHI::HostMemoryAccess::Write);
+            }
 
             WriteDescriptorData data;
             data.m_layoutIndex = layout.GetLayoutIndexFromGroupIndex(0, DescriptorSetLayout::ResourceType::ConstantData);
@@ -207,9 +224,40 @@ namespace AZ
             bufferInfo.offset = memoryView->GetOffset();
             bufferInfo.range = rawData.size();
             data.m_bufferViewsInfo.push_back(bufferInfo);
+            QueueUpdate(AZStd::move(data));
+        }
+
+        void DescriptorSet::QueueUpdate(WriteDescriptorData&& data)
+        {
+            auto& device = static_cast<Device&>(GetDevice());
+            if (data.m_layoutIndex < m_writtenData.size() && IsSameWriteData(m_writtenData[data.m_layoutIndex], data))
+            {
+                device.GetDescriptorSetStatistics().m_skippedWrites++;
+                return;
+            }
+
+            device.GetDescriptorSetStatistics().m_writes++;
             m_updateData.push_back(AZStd::move(data));
         }
 
+        bool DescriptorSet::IsSameWriteData(const WriteDescriptorData& lhs, const WriteDescriptorData& rhs)
+        {
+            // The infos are compared bytewise. Different padding can only cause a redundant write, never a skipped one.
+            auto isSameVector = [](const auto& lhsVector, const auto& rhsVector)
+            {
+                return lhsVector.size() == rhsVector.size() &&
+                    (lhsVector.empty() || memcmp(lhsVector.data(), rhsVector.data(), lhsVector.size() * sizeof(lhsVector[0])) == 0);
+            };
+
+            return lhs.m_layoutIndex == rhs.m_layoutIndex &&
+                lhs.m_objects == rhs.m_objects &&
+                isSameVector(lhs.m_resourceVersions, rhs.m_resourceVersions) &&
+                isSameVector(lhs.m_bufferViewsInfo, rhs.m_bufferViewsInfo) &&
+                isSameVector(lhs.m_imageViewsInfo, rhs.m_imageViewsInfo) &&
+                isSameVector(lhs.m_texelBufferViews, rhs.m_texelBufferViews) &&
+                isSameVector(lhs.m_accelerationStructures, rhs.m_accelerationStructures);
+        }
+
         RHI::Ptr<DescriptorSet> DescriptorSet::Create()
         {
             return aznew DescriptorSet();
@@ -250,6 +298,12 @@ namespace AZ
                 {
                     return result;
                 }
+
+                descriptor.m_device->GetDescriptorSetStatistics().m_allocatedSets++;
+
+                WriteDescriptorData unwrittenData;
+                unwrittenData.m_layoutIndex = InvalidLayoutIndex;
+                m_writtenData.resize(descriptor.m_descriptorSetLayout->GetNativeLayoutBindings().size(), unwrittenData);
             }
 
             // Check if we need to create a uniform buffer for the constants
@@ -298,6 +352,8 @@ namespace AZ
                     device.GetNativeDevice(), m_descriptor.m_descriptorPool->GetNativeDescriptorPool(), 1, &m_nativeDescriptorSet));
                 m_nativeDescriptorSet = VK_NULL_HANDLE;
             }
+            m_writtenData.clear();
+            m_updateData.clear();
             m_constantDataBufferView = nullptr;
             m_constantDataBuffer = nullptr;
             Base::Shutdown();
@@ -395,6 +451,13 @@ namespace AZ
                     device.GetNativeDevice(), static_cast<uint32_t>(writeDescSetDescs.size()), writeDescSetDescs.data(), 0, nullptr);
             }
 
+            if (!m_writtenData.empty())
+            {
+                for (WriteDescriptorData& updateData : m_updateData)
+                {
+                    m_writtenData[updateData.m_layoutIndex] = AZStd::move(updateData);
+                }
+            }
             m_updateData.clear();
         }
 
@@ -463,6 +526,7 @@ namespace AZ
 
                 AssertSuccess(m_descriptor.m_device->GetContext().AllocateDescriptorSets(
                     m_descriptor.m_device->GetNativeDevice(), &allocInfo, &m_nativeDescriptorSet));
+                m_descriptor.m_device->GetDescriptorSetStatistics().m_allocatedSets++;
 
                 m_currentUnboundedArrayAllocation = unboundedArraySize;
                 SetName(GetName());
@@ -63,7 +63,8 @@ namespace AZ
             void UpdateBufferViews(uint32_t index, const AZStd::span<const RHI::ConstPtr<RHI::DeviceBufferView>>& bufViews);
             void UpdateImageViews(uint32_t index, const AZStd::span<const RHI::ConstPtr<RHI::DeviceImageView>>& imageViews, RHI::ShaderInputImageType imageType);
             void UpdateSamplers(uint32_t index, const AZStd::span<const RHI::SamplerState>& samplers);
-            void UpdateConstantData(AZStd::span<const uint8_t> data);
+            //! Writes the bytes of the constant data inside the dirty interval to the constant buffer.
+            void UpdateConstantData(AZStd::span<const uint8_t> data, const RHI::Interval& dirtyInterval);
 
             RHI::Ptr<BufferView> GetConstantDataBufferView() const;
 
@@ -75,8 +76,15 @@ namespace AZ
                 AZStd::vector<VkDescriptorImageInfo> m_imageViewsInfo;
                 AZStd::vector<VkBufferView> m_texelBufferViews;
                 AZStd::vector<VkAccelerationStructureKHR> m_accelerationStructures;
+
+                //! Objects (views and samplers) the native infos were built from, with the version of their resource at that time.
+                //! Holding them keeps their native handles from being destroyed and reused while the written data is cached.
+                AZStd::vector<RHI::ConstPtr<RHI::DeviceObject>> m_objects;
+                AZStd::vector<uint32_t> m_resourceVersions;
             };
 
+            static constexpr uint32_t InvalidLayoutIndex = static_cast<uint32_t>(-1);
+
             DescriptorSet() = default;
 
             //////////////////////////////////////////////////////////////////////////
@@ -89,6 +97,10 @@ namespace AZ
             void Shutdown() override;
             //////////////////////////////////////////////////////////////////////////
 
+            //! Queues the write of a binding, unless the same data was already written to it.
+            void QueueUpdate(WriteDescriptorData&& data);
+            static bool IsSameWriteData(const WriteDescriptorData& lhs, const WriteDescriptorData& rhs);
+
             void UpdateNativeDescriptorSet();
             void AllocateDescriptorSetWithUnboundedArray();
 
@@ -103,6 +115,9 @@ namespace AZ
 
             VkDescriptorSet m_nativeDescriptorSet = VK_NULL_HANDLE;
             AZStd::vector<WriteDescriptorData> m_updateData;
+            //! Last data written to each binding, indexed by layout index. Only used when the set is never reallocated,
+            //! because a reallocated set loses all its previous writes.
+            AZStd::vector<WriteDescriptorData> m_writtenData;
             RHI::Ptr<Buffer> m_constantDataBuffer;
             RHI::Ptr<BufferView> m_constantDataBufferView;
             bool m_nullDescriptorSupported = false;
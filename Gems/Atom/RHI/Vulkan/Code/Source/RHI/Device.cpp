@@ -38,6 +38,10 @@ namespace AZ
 {
     namespace Vulkan
     {
+        static constexpr AZStd::string_view AllocatedDescriptorSetsStatName("Vulkan Allocated Descriptor Sets");
+        static constexpr AZStd::string_view DescriptorWritesStatName("Vulkan Descriptor Writes");
+        static constexpr AZStd::string_view SkippedDescriptorWritesStatName("Vulkan Skipped Descriptor Writes");
+
         Device::Device()
         {
             RHI::Ptr<PlatformLimitsDescriptor> platformLimitsDescriptor = aznew PlatformLimitsDescriptor();
@@ -226,6 +230,21 @@ namespace AZ
                 AppendVkStruct(chainInit, &subpassMergeFeedback);
             }
 
+            // Present id and present wait are used together by the low latency swapchain mode.
+            auto presentIdFeatures = physicalDevice.GetPhysicalDevicePresentIdFeatures();
+            auto presentWaitFeatures = physicalDevice.GetPhysicalDevicePresentWaitFeatures();
+            if (presentIdFeatures.presentId && presentWaitFeatures.presentWait)
+            {
+                presentIdFeatures.pNext = nullptr;
+                presentWaitFeatures.pNext = nullptr;
+                AppendVkStruct(chainInit, { &presentIdFeatures, &presentWaitFeatures });
+            }
+            else
+            {
+                physicalDevice.DisableOptionalDeviceExtension(OptionalDeviceExtension::PresentId);
+                physicalDevice.DisableOptionalDeviceExtension(OptionalDeviceExtension::PresentWait);
+            }
+
             auto fragmenDensityMapFeatures = physicalDevice.GetPhysicalDeviceFragmentDensityMapFeatures();
             auto fragmenShadingRateFeatures = physicalDevice.GetPhysicalDeviceFragmentShadingRateFeatures();
 
@@ -377,6 +396,15 @@ namespace AZ
                 m_supportedPipelineStageFlagsMask &= ~VK_PIPELINE_STAGE_FRAGMENT_DENSITY_PROCESS_BIT_EXT;
             }
 
+            if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+            {
+                auto& rhiMetrics = statsProfiler->GetProfiler(rhiMetricsId);
+                for (const AZStd::string_view statName : { AllocatedDescriptorSetsStatName, DescriptorWritesStatName, SkippedDescriptorWritesStatName })
+                {
+                    rhiMetrics.GetStatsManager().AddStatistic(AZ::Crc32(statName), statName, /*units=*/"count", /*failIfExist=*/false);
+                }
+            }
+
             RHI::ResultCode resultCode = InitVmaAllocator(physicalDeviceBase);
             RHI::RHISystemNotificationBus::Handler::BusConnect();
             return resultCode;
@@ -820,6 +848,22 @@ namespace AZ
         void Device::UpdateCpuTimingStatisticsInternal() const
         {
             m_commandQueueContext.UpdateCpuTimingStatistics();
+
+            const uint32_t allocatedSets = m_descriptorSetStatistics.m_allocatedSets.exchange(0);
+            const uint32_t writes = m_descriptorSetStatistics.m_writes.exchange(0);
+            const uint32_t skippedWrites = m_descriptorSetStatistics.m_skippedWrites.exchange(0);
+            if (auto statsProfiler = AZ::Interface<AZ::Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+            {
+                auto& rhiMetrics = statsProfiler->GetProfiler(rhiMetricsId);
+                rhiMetrics.PushSample(AZ::Crc32(AllocatedDescriptorSetsStatName), static_cast<double>(allocatedSets));
+                rhiMetrics.PushSample(AZ::Crc32(DescriptorWritesStatName), static_cast<double>(writes));
+                rhiMetrics.PushSample(AZ::Crc32(SkippedDescriptorWritesStatName), static_cast<double>(skippedWrites));
+            }
+        }
+
+        Device::DescriptorSetStatistics& Device::GetDescriptorSetStatistics()
+        {
+            return m_descriptorSetStatistics;
         }
 
         AZStd::vector<RHI::Format> Device::GetValidSwapChainImageFormats(const RHI::WindowHandle& windowHandle) const
@@ -21,6 +21,7 @@
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -128,6 +129,16 @@ namespace AZ
 
             NullDescriptorManager& GetNullDescriptorManager();
 
+            //! Descriptor set work of the current frame. Pushed to the RHI metrics and reset by UpdateCpuTimingStatistics.
+            struct DescriptorSetStatistics
+            {
+                AZStd::atomic<uint32_t> m_allocatedSets{ 0 };
+                AZStd::atomic<uint32_t> m_writes{ 0 };
+                //! Writes skipped because the binding already had the same descriptors
+                AZStd::atomic<uint32_t> m_skippedWrites{ 0 };
+            };
+            DescriptorSetStatistics& GetDescriptorSetStatistics();
+
             //! Fills a vulkan buffer create info with the provided descriptor
             BufferCreateInfo BuildBufferCreateInfo(const RHI::BufferDescriptor& descriptor) const;
             //! Fills a vulkan image create info with the provided descriptor
@@ -247,6 +258,7 @@ namespace AZ
             RHI::Ptr<NullDescriptorManager> m_nullDescriptorManager;
 
             BindlessDescriptorPool m_bindlessDescriptorPool;
+            mutable DescriptorSetStatistics m_descriptorSetStatistics;
             ShadingRateImageMode m_imageShadingRateMode = ShadingRateImageMode::None;
         };
 
@@ -191,6 +191,16 @@ namespace AZ
             return m_subpassMergeFeedbackFeatures;
         }
 
+        const VkPhysicalDevicePresentIdFeaturesKHR& PhysicalDevice::GetPhysicalDevicePresentIdFeatures() const
+        {
+            return m_presentIdFeatures;
+        }
+
+        const VkPhysicalDevicePresentWaitFeaturesKHR& PhysicalDevice::GetPhysicalDevicePresentWaitFeatures() const
+        {
+            return m_presentWaitFeatures;
+        }
+
         const VkPhysicalDeviceVulkan12Features& PhysicalDevice::GetPhysicalDeviceVulkan12Features() const
         {
             return m_vulkan12Features;
@@ -341,7 +351,9 @@ namespace AZ
                 VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME,
                 VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME,
                 VK_EXT_LOAD_STORE_OP_NONE_EXTENSION_NAME,
-                VK_EXT_SUBPASS_MERGE_FEEDBACK_EXTENSION_NAME
+                VK_EXT_SUBPASS_MERGE_FEEDBACK_EXTENSION_NAME,
+                VK_KHR_PRESENT_ID_EXTENSION_NAME,
+                VK_KHR_PRESENT_WAIT_EXTENSION_NAME
             } };
 
             [[maybe_unused]] uint32_t optionalExtensionCount = aznumeric_cast<uint32_t>(optionalExtensions.size());
@@ -398,6 +410,8 @@ namespace AZ
                 m_fragmentDensityMapFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT;
                 m_timelineSemaphoreFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
                 m_subpassMergeFeedbackFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_MERGE_FEEDBACK_FEATURES_EXT;
+                m_presentIdFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+                m_presentWaitFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
 
                 VkPhysicalDeviceFeatures2 deviceFeatures2 = {};
                 deviceFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
@@ -418,7 +432,9 @@ namespace AZ
                       &m_shadingRateFeatures,
                       &m_fragmentDensityMapFeatures,
                       &m_timelineSemaphoreFeatures,
-                      &m_subpassMergeFeedbackFeatures });
+                      &m_subpassMergeFeedbackFeatures,
+                      &m_presentIdFeatures,
+                      &m_presentWaitFeatures });
 
                 context.GetPhysicalDeviceFeatures2KHR(vkPhysicalDevice, &deviceFeatures2);
                 m_deviceFeatures = deviceFeatures2.features;
@@ -67,6 +67,8 @@ namespace AZ
             TimelineSempahore,
             LoadStoreOpNone,
             SubpassMergeFeedback,
+            PresentId,
+            PresentWait,
             Count
         };
 
@@ -111,6 +113,8 @@ namespace AZ
             const VkPhysicalDeviceFragmentShadingRatePropertiesKHR& GetPhysicalDeviceFragmentShadingRateProperties() const;
             const VkPhysicalDeviceTimelineSemaphoreFeatures& GetPhysicalDeviceTimelineSemaphoreFeatures() const;
             const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& GetPhysicalSubpassMergeFeedbackFeatures() const;
+            const VkPhysicalDevicePresentIdFeaturesKHR& GetPhysicalDevicePresentIdFeatures() const;
+            const VkPhysicalDevicePresentWaitFeaturesKHR& GetPhysicalDevicePresentWaitFeatures() const;
 
             VkFormatProperties GetFormatProperties(RHI::Format format, bool raiseAsserts = true) const;
             StringList GetDeviceLayerNames() const;
@@ -158,6 +162,8 @@ namespace AZ
             VkPhysicalDeviceFragmentShadingRatePropertiesKHR m_fragmentShadingRateProperties{};
             VkPhysicalDeviceTimelineSemaphoreFeatures m_timelineSemaphoreFeatures{};
             VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT m_subpassMergeFeedbackFeatures{};
+            VkPhysicalDevicePresentIdFeaturesKHR m_presentIdFeatures{};
+            VkPhysicalDevicePresentWaitFeaturesKHR m_presentWaitFeatures{};
             uint32_t m_vulkanVersion = 0;
         };
     }
@@ -8,6 +8,7 @@
 
 #include "Atom_RHI_Vulkan_Platform.h"
 #include <Atom/RHI.Reflect/VkAllocator.h>
+#include <Atom/RHI.Reflect/Vulkan/Conversion.h>
 #include <RHI/Device.h>
 #include <RHI/RayTracingAccelerationStructure.h>
 
@@ -32,6 +33,11 @@ namespace AZ::Vulkan
         auto& device = static_cast<Device&>(GetDevice());
         device.GetContext().DestroyAccelerationStructureKHR(device.GetNativeDevice(), m_accelerationStructure, VkSystemAllocator::Get());
         m_accelerationStructure = VK_NULL_HANDLE;
+        if (m_compactedSizeQueryPool != VK_NULL_HANDLE)
+        {
+            device.GetContext().DestroyQueryPool(device.GetNativeDevice(), m_compactedSizeQueryPool, VkSystemAllocator::Get());
+            m_compactedSizeQueryPool = VK_NULL_HANDLE;
+        }
         RHI::DeviceObject::Shutdown();
     }
 
@@ -39,4 +45,17 @@ namespace AZ::Vulkan
     {
         m_blasBuffers = buffers;
     }
+
+    RHI::ResultCode RayTracingAccelerationStructure::InitCompactedSizeQuery()
+    {
+        VkQueryPoolCreateInfo createInfo = {};
+        createInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        createInfo.queryType = VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR;
+        createInfo.queryCount = 1;
+
+        auto& device = static_cast<Device&>(GetDevice());
+        VkResult vkResult =
+            device.GetContext().CreateQueryPool(device.GetNativeDevice(), &createInfo, VkSystemAllocator::Get(), &m_compactedSizeQueryPool);
+        return ConvertResult(vkResult);
+    }
 } // namespace AZ::Vulkan
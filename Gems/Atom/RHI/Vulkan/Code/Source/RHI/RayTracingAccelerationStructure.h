@@ -39,10 +39,19 @@ namespace AZ
 
             void SetBlasBuffers(AZStd::vector<RHI::Ptr<RHI::DeviceBuffer>>&& buffers);
 
+            //! Creates the query the build of a BLAS writes its compacted size to
+            RHI::ResultCode InitCompactedSizeQuery();
+
+            VkQueryPool GetCompactedSizeQueryPool() const
+            {
+                return m_compactedSizeQueryPool;
+            }
+
         private:
             RayTracingAccelerationStructure() = default;
 
             VkAccelerationStructureKHR m_accelerationStructure = VK_NULL_HANDLE;
+            VkQueryPool m_compactedSizeQueryPool = VK_NULL_HANDLE;
 
             // need to keep a reference to the BLAS buffers to keep them alive as long as this AS is alive if this AS is a TLAS
             AZStd::vector<RHI::Ptr<RHI::DeviceBuffer>> m_blasBuffers;
@@ -231,6 +231,93 @@ namespace AZ
             // stay alive as long as it is used
             static_cast<Buffer*>(buffers.m_blasBuffer.get())->SetNativeAccelerationStructure(buffers.m_accelerationStructure);
 
+            if (RHI::CheckBitsAny(descriptor->GetBuildFlags(), RHI::RayTracingAccelerationStructureBuildFlags::ENABLE_COMPACTION))
+            {
+                // the build writes the compacted size of the BLAS to this query
+                resultCode = buffers.m_accelerationStructure->InitCompactedSizeQuery();
+                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to create BLAS compacted size query pool");
+            }
+
+            return RHI::ResultCode::Success;
+        }
+
+        uint64_t RayTracingBlas::GetCompactedSizeInBytes() const
+        {
+            const BlasBuffers& buffers = GetBuffers();
+            if (!buffers.m_accelerationStructure || buffers.m_accelerationStructure->GetCompactedSizeQueryPool() == VK_NULL_HANDLE)
+            {
+                return 0;
+            }
+
+            // don't wait for the query, the size isn't available until the build completed on the GPU
+            auto& device = static_cast<Device&>(buffers.m_accelerationStructure->GetDevice());
+            uint64_t compactedSize = 0;
+            VkResult vkResult = device.GetContext().GetQueryPoolResults(
+                device.GetNativeDevice(),
+                buffers.m_accelerationStructure->GetCompactedSizeQueryPool(),
+                0,
+                1,
+                sizeof(uint64_t),
+                &compactedSize,
+                sizeof(uint64_t),
+                VK_QUERY_RESULT_64_BIT);
+
+            return vkResult == VK_SUCCESS ? compactedSize : 0;
+        }
+
+        RHI::ResultCode RayTracingBlas::CreateCompactedBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingBlas& sourceBlas, const RHI::DeviceRayTracingBufferPools& bufferPools)
+        {
+            auto& device = static_cast<Device&>(deviceBase);
+            const RayTracingBlas& source = static_cast<const RayTracingBlas&>(sourceBlas);
+            const BlasBuffers& sourceBuffers = source.GetBuffers();
+            const VkDeviceSize compactedSize = RHI::AlignUp(source.GetCompactedSizeInBytes(), 256);
+
+            BlasBuffers& buffers = m_buffers.AdvanceCurrentElement();
+
+            // the compacted BLAS keeps the geometry of the source, the AABB buffer is referenced by the geometry descs
+            buffers.m_aabbBuffer = sourceBuffers.m_aabbBuffer;
+            buffers.m_geometryDescs = sourceBuffers.m_geometryDescs;
+            buffers.m_rangeInfos = sourceBuffers.m_rangeInfos;
+            buffers.m_buildInfo = sourceBuffers.m_buildInfo;
+            buffers.m_buildInfo.pGeometries = buffers.m_geometryDescs.data();
+            buffers.m_buildInfo.scratchData = {};
+            buffers.m_scratchBuffer = nullptr;
+
+            // create BLAS buffer
+            buffers.m_blasBuffer = RHI::Factory::Get().CreateBuffer();
+            AZ::RHI::BufferDescriptor blasBufferDescriptor;
+            blasBufferDescriptor.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::RayTracingAccelerationStructure;
+            blasBufferDescriptor.m_byteCount = compactedSize;
+
+            AZ::RHI::DeviceBufferInitRequest blasBufferRequest;
+            blasBufferRequest.m_buffer = buffers.m_blasBuffer.get();
+            blasBufferRequest.m_descriptor = blasBufferDescriptor;
+            RHI::ResultCode resultCode = bufferPools.GetBlasBufferPool()->InitBuffer(blasBufferRequest);
+            if (resultCode != RHI::ResultCode::Success)
+            {
+                AZ_Error("RayTracing", false, "Failed to create compacted BLAS buffer with error code: %d", resultCode);
+                buffers.m_blasBuffer = nullptr;
+                return resultCode;
+            }
+
+            BufferMemoryView* blasMemoryView = static_cast<Buffer*>(buffers.m_blasBuffer.get())->GetBufferMemoryView();
+            blasMemoryView->SetName("BLAS Compacted");
+
+            // create the compacted BLAS
+            VkAccelerationStructureCreateInfoKHR createInfo = {};
+            createInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR;
+            createInfo.pNext = nullptr;
+            createInfo.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
+            createInfo.size = compactedSize;
+            createInfo.offset = 0;
+            createInfo.buffer = blasMemoryView->GetNativeBuffer();
+
+            buffers.m_accelerationStructure = RayTracingAccelerationStructure::Create();
+            buffers.m_accelerationStructure->Init(device, createInfo);
+            buffers.m_buildInfo.dstAccelerationStructure = buffers.m_accelerationStructure->GetNativeAccelerationStructure();
+
+            static_cast<Buffer*>(buffers.m_blasBuffer.get())->SetNativeAccelerationStructure(buffers.m_accelerationStructure);
+
             return RHI::ResultCode::Success;
         }
 
@@ -252,6 +339,11 @@ namespace AZ
                 vkBuildFlags |= VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR;
             }
 
+            if (RHI::CheckBitsAny(buildFlags, RHI::RayTracingAccelerationStructureBuildFlags::ENABLE_COMPACTION))
+            {
+                vkBuildFlags |= VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR;
+            }
+
             return vkBuildFlags;
         }
     } // namespace Vulkan
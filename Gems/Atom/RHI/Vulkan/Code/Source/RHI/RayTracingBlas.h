@@ -43,16 +43,19 @@ namespace AZ
 
             const BlasBuffers& GetBuffers() const { return m_buffers.GetCurrentElement(); }
 
+            //! Converts the RHI build flags to the Vulkan build flags, this is shared with the TLAS
+            static VkBuildAccelerationStructureFlagsKHR GetAccelerationStructureBuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags &buildFlags);
+
             // RHI::DeviceRayTracingBlas overrides...
             virtual bool IsValid() const override { return GetBuffers().m_accelerationStructure != VK_NULL_HANDLE; }
+            uint64_t GetCompactedSizeInBytes() const override;
 
         private:
             RayTracingBlas() = default;
 
             // RHI::DeviceRayTracingBlas overrides...
             RHI::ResultCode CreateBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingBlasDescriptor* descriptor, const RHI::DeviceRayTracingBufferPools& rayTracingBufferPools) override;
-
-            static VkBuildAccelerationStructureFlagsKHR GetAccelerationStructureBuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags &buildFlags);
+            RHI::ResultCode CreateCompactedBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingBlas& sourceBlas, const RHI::DeviceRayTracingBufferPools& rayTracingBufferPools) override;
 
             // buffer list to keep buffers alive for several frames
             RHI::FrameCountMaxRingBuffer<BlasBuffers> m_buffers;
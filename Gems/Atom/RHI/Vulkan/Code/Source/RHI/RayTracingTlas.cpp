@@ -56,62 +56,7 @@ namespace AZ
             if (descriptor->GetInstancesBuffer() == nullptr)
             {
                 buffers.m_instanceCount = aznumeric_caster(instances.size());
-                uint64_t instanceDescsSizeInBytes = aznumeric_cast<uint32_t>(sizeof(VkAccelerationStructureInstanceKHR) * instances.size());
-            
-                // create instances buffer
-                buffers.m_tlasInstancesBuffer = RHI::Factory::Get().CreateBuffer();
-                AZ::RHI::BufferDescriptor tlasInstancesBufferDescriptor;
-                tlasInstancesBufferDescriptor.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::RayTracingAccelerationStructure;
-                tlasInstancesBufferDescriptor.m_byteCount = instanceDescsSizeInBytes;
-                
-                AZ::RHI::DeviceBufferInitRequest tlasInstancesBufferRequest;
-                tlasInstancesBufferRequest.m_buffer = buffers.m_tlasInstancesBuffer.get();
-                tlasInstancesBufferRequest.m_descriptor = tlasInstancesBufferDescriptor;
-                [[maybe_unused]] RHI::ResultCode resultCode = bufferPools.GetTlasInstancesBufferPool()->InitBuffer(tlasInstancesBufferRequest);
-                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to create TLAS instances buffer");
-                
-                BufferMemoryView* tlasInstancesMemoryView = static_cast<Buffer*>(buffers.m_tlasInstancesBuffer.get())->GetBufferMemoryView();
-                tlasInstancesMemoryView->SetName("TLAS Instance");
-                
-                RHI::DeviceBufferMapResponse mapResponse;
-                resultCode = bufferPools.GetTlasInstancesBufferPool()->MapBuffer(RHI::DeviceBufferMapRequest(*buffers.m_tlasInstancesBuffer, 0, instanceDescsSizeInBytes), mapResponse);
-                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to map TLAS instances buffer");
-                VkAccelerationStructureInstanceKHR* mappedData = reinterpret_cast<VkAccelerationStructureInstanceKHR*>(mapResponse.m_data);
-
-                memset(mappedData, 0, instanceDescsSizeInBytes);
-
-                // create each VkAccelerationStructureInstanceKHR structure
-                for (uint32_t i = 0; i < instances.size(); ++i)
-                {
-                    const RHI::DeviceRayTracingTlasInstance& instance = instances[i];
-            
-                    mappedData[i].instanceCustomIndex = instance.m_instanceID;
-                    mappedData[i].instanceShaderBindingTableRecordOffset = instance.m_hitGroupIndex;
-                    AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromTransform(instance.m_transform);
-                    matrix3x4.MultiplyByScale(instance.m_nonUniformScale);
-                    matrix3x4.StoreToRowMajorFloat12(&mappedData[i].transform.matrix[0][0]);
-            
-                    RayTracingBlas* blas = static_cast<RayTracingBlas*>(instance.m_blas.get());
-                    VkAccelerationStructureDeviceAddressInfoKHR addressInfo = {};
-                    addressInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR;
-                    addressInfo.pNext = nullptr;
-                    addressInfo.accelerationStructure = blas->GetBuffers().m_accelerationStructure->GetNativeAccelerationStructure();
-                    mappedData[i].accelerationStructureReference =
-                        device.GetContext().GetAccelerationStructureDeviceAddressKHR(device.GetNativeDevice(), &addressInfo);
-
-                    mappedData[i].mask = instance.m_instanceMask;
-                    mappedData[i].flags = instance.m_transparent ? VK_GEOMETRY_INSTANCE_FORCE_NO_OPAQUE_BIT_KHR : 0;
-
-                    blasBuffers.emplace_back(blas->GetBuffers().m_blasBuffer);
-                }
-            
-                bufferPools.GetTlasInstancesBufferPool()->UnmapBuffer(*buffers.m_tlasInstancesBuffer);
-            
-                VkBufferDeviceAddressInfo addressInfo = {};
-                addressInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
-                addressInfo.pNext = nullptr;
-                addressInfo.buffer = tlasInstancesMemoryView->GetNativeBuffer();
-                tlasInstancesGpuAddress = device.GetContext().GetBufferDeviceAddress(device.GetNativeDevice(), &addressInfo);
+                tlasInstancesGpuAddress = CreateInstancesBuffer(device, buffers, instances, bufferPools, blasBuffers);
             }
             else
             {
@@ -135,7 +80,7 @@ namespace AZ
             
             buffers.m_buildInfo = {};
             buffers.m_buildInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
-            buffers.m_buildInfo.flags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR;
+            buffers.m_buildInfo.flags = RayTracingBlas::GetAccelerationStructureBuildFlags(descriptor->GetBuildFlags());
             buffers.m_buildInfo.geometryCount = 1;
             buffers.m_buildInfo.pGeometries = &buffers.m_geometry;
             buffers.m_buildInfo.mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
@@ -153,6 +98,8 @@ namespace AZ
                 &buildSizesInfo);
 
             buildSizesInfo.accelerationStructureSize = RHI::AlignUp(buildSizesInfo.accelerationStructureSize, 256);
+            // the scratch buffer is kept for the updates of the TLAS, so it must be large enough for both
+            buildSizesInfo.buildScratchSize = AZStd::max(buildSizesInfo.buildScratchSize, buildSizesInfo.updateScratchSize);
             buildSizesInfo.buildScratchSize = RHI::AlignUp(buildSizesInfo.buildScratchSize, accelerationStructureProperties.minAccelerationStructureScratchOffsetAlignment);
 
             // create scratch buffer
@@ -217,5 +164,111 @@ namespace AZ
 
             return RHI::ResultCode::Success;
         }
+
+        RHI::ResultCode RayTracingTlas::UpdateBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingTlasDescriptor* descriptor, const RHI::DeviceRayTracingBufferPools& bufferPools)
+        {
+            auto& device = static_cast<Device&>(deviceBase);
+            const RHI::DeviceRayTracingTlasInstanceVector& instances = descriptor->GetInstances();
+
+            // an update only changes the transforms of the instances the TLAS was built with
+            const TlasBuffers& previousBuffers = GetBuffers();
+            if (!RHI::CheckBitsAny(previousBuffers.m_buildInfo.flags, static_cast<VkBuildAccelerationStructureFlagsKHR>(VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR)) ||
+                descriptor->GetInstancesBuffer() != nullptr ||
+                !previousBuffers.m_accelerationStructure ||
+                previousBuffers.m_instanceCount != instances.size())
+            {
+                return RHI::ResultCode::InvalidOperation;
+            }
+
+            // the update is in place, so the acceleration structure and its buffers are carried over to the next element
+            TlasBuffers previous = previousBuffers;
+            TlasBuffers& buffers = m_buffers.AdvanceCurrentElement();
+            buffers.m_tlasBuffer = previous.m_tlasBuffer;
+            buffers.m_scratchBuffer = previous.m_scratchBuffer;
+            buffers.m_accelerationStructure = previous.m_accelerationStructure;
+            buffers.m_offsetInfo = previous.m_offsetInfo;
+            buffers.m_instanceCount = previous.m_instanceCount;
+
+            // the acceleration structure already keeps the BLAS buffers of the instances alive
+            AZStd::vector<RHI::Ptr<RHI::DeviceBuffer>> blasBuffers;
+            buffers.m_geometry = previous.m_geometry;
+            buffers.m_geometry.geometry.instances.data.deviceAddress = CreateInstancesBuffer(device, buffers, instances, bufferPools, blasBuffers);
+            buffers.m_buildInfo = previous.m_buildInfo;
+            buffers.m_buildInfo.pGeometries = &buffers.m_geometry;
+
+            return RHI::ResultCode::Success;
+        }
+
+        VkDeviceAddress RayTracingTlas::CreateInstancesBuffer(
+            Device& device,
+            TlasBuffers& buffers,
+            const RHI::DeviceRayTracingTlasInstanceVector& instances,
+            const RHI::DeviceRayTracingBufferPools& bufferPools,
+            AZStd::vector<RHI::Ptr<RHI::DeviceBuffer>>& blasBuffers)
+        {
+            uint64_t instanceDescsSizeInBytes = aznumeric_cast<uint32_t>(sizeof(VkAccelerationStructureInstanceKHR) * instances.size());
+        
+            // create instances buffer
+            buffers.m_tlasInstancesBuffer = RHI::Factory::Get().CreateBuffer();
+            AZ::RHI::BufferDescriptor tlasInstancesBufferDescriptor;
+            tlasInstancesBufferDescriptor.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::RayTracingAccelerationStructure;
+            tlasInstancesBufferDescriptor.m_byteCount = instanceDescsSizeInBytes;
+            
+            AZ::RHI::DeviceBufferInitRequest tlasInstancesBufferRequest;
+            tlasInstancesBufferRequest.m_buffer = buffers.m_tlasInstancesBuffer.get();
+            tlasInstancesBufferRequest.m_descriptor = tlasInstancesBufferDescriptor;
+            [[maybe_unused]] RHI::ResultCode resultCode = bufferPools.GetTlasInstancesBufferPool()->InitBuffer(tlasInstancesBufferRequest);
+            AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to create TLAS instances buffer");
+            
+            BufferMemoryView* tlasInstancesMemoryView = static_cast<Buffer*>(buffers.m_tlasInstancesBuffer.get())->GetBufferMemoryView();
+            tlasInstancesMemoryView->SetName("TLAS Instance");
+            
+            RHI::DeviceBufferMapResponse mapResponse;
+            resultCode = bufferPools.GetTlasInstancesBufferPool()->MapBuffer(RHI::DeviceBufferMapRequest(*buffers.m_tlasInstancesBuffer, 0, instanceDescsSizeInBytes), mapResponse);
+            AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to map TLAS instances buffer");
+            VkAccelerationStructureInstanceKHR* mappedData = reinterpret_cast<VkAccelerationStructureInstanceKHR*>(mapResponse.m_data);
+
+            memset(mappedData, 0, instanceDescsSizeInBytes);
+
+            // create each VkAccelerationStructureInstanceKHR structure
+            for (uint32_t i = 0; i < instances.size(); ++i)
+            {
+                const RHI::DeviceRayTracingTlasInstance& instance = instances[i];
+        
+                mappedData[i].instanceCustomIndex = instance.m_instanceID;
+                mappedData[i].instanceShaderBindingTableRecordOffset = instance.m_hitGroupIndex;
+                AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromTransform(instance.m_transform);
+                matrix3x4.MultiplyByScale(instance.m_nonUniformScale);
+                matrix3x4.StoreToRowMajorFloat12(&mappedData[i].transform.matrix[0][0]);
+        
+                mappedData[i].mask = instance.m_instanceMask;
+                mappedData[i].flags = instance.m_transparent ? VK_GEOMETRY_INSTANCE_FORCE_NO_OPAQUE_BIT_KHR : 0;
+
+                // an instance without a BLAS is inactive, it keeps its slot so the instance indices don't change
+                RayTracingBlas* blas = static_cast<RayTracingBlas*>(instance.m_blas.get());
+                if (!blas)
+                {
+                    mappedData[i].accelerationStructureReference = 0;
+                    continue;
+                }
+
+                VkAccelerationStructureDeviceAddressInfoKHR addressInfo = {};
+                addressInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR;
+                addressInfo.pNext = nullptr;
+                addressInfo.accelerationStructure = blas->GetBuffers().m_accelerationStructure->GetNativeAccelerationStructure();
+                mappedData[i].accelerationStructureReference =
+                    device.GetContext().GetAccelerationStructureDeviceAddressKHR(device.GetNativeDevice(), &addressInfo);
+
+                blasBuffers.emplace_back(blas->GetBuffers().m_blasBuffer);
+            }
+        
+            bufferPools.GetTlasInstancesBufferPool()->UnmapBuffer(*buffers.m_tlasInstancesBuffer);
+        
+            VkBufferDeviceAddressInfo addressInfo = {};
+            addressInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+            addressInfo.pNext = nullptr;
+            addressInfo.buffer = tlasInstancesMemoryView->GetNativeBuffer();
+            return device.GetContext().GetBufferDeviceAddress(device.GetNativeDevice(), &addressInfo);
+        }
     } // namespace Vulkan
 }
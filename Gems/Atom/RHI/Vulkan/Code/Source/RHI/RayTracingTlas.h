@@ -18,6 +18,7 @@ namespace AZ
     namespace Vulkan
     {
         class Buffer;
+        class Device;
         class RayTracingAccelerationStructure;
 
         //! This class builds and contains the Vulkan RayTracing TLAS buffers.
@@ -53,6 +54,16 @@ namespace AZ
 
             // RHI::DeviceRayTracingTlas overrides
             RHI::ResultCode CreateBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingTlasDescriptor* descriptor, const RHI::DeviceRayTracingBufferPools& rayTracingBufferPools) override;
+            RHI::ResultCode UpdateBuffersInternal(RHI::Device& deviceBase, const RHI::DeviceRayTracingTlasDescriptor* descriptor, const RHI::DeviceRayTracingBufferPools& rayTracingBufferPools) override;
+
+            //! Creates and fills the instances buffer of the TLAS buffers, and returns its device address.
+            //! The BLAS buffers referenced by the instances are added to blasBuffers.
+            VkDeviceAddress CreateInstancesBuffer(
+                Device& device,
+                TlasBuffers& buffers,
+                const RHI::DeviceRayTracingTlasInstanceVector& instances,
+                const RHI::DeviceRayTracingBufferPools& bufferPools,
+                AZStd::vector<RHI::Ptr<RHI::DeviceBuffer>>& blasBuffers);
 
             // buffer list to keep buffers alive for several frames
             RHI::FrameCountMaxRingBuffer<TlasBuffers> m_buffers;
@@ -171,7 +171,8 @@ namespace AZ
             auto constantData = groupData.GetConstantData();
             if (!constantData.empty())
             {
-                descriptorSet.UpdateConstantData(constantData);
+                // Only write the constants that changed since this descriptor set was last written.
+                descriptorSet.UpdateConstantData(constantData, groupBase.GetConstantDataDirtyInterval());
             }
             descriptorSet.CommitUpdates();
 
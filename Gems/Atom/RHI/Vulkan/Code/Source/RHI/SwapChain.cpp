@@ -98,6 +98,30 @@ namespace AZ
             }
         }
 
+        void SwapChain::WaitForPresentLatencyInternal()
+        {
+            // Waits for the frame before the one that was just queued, so at most one frame is waiting to be presented.
+            if (!m_isPresentWaitEnabled || m_presentId < 2 || m_nativeSwapChain == VK_NULL_HANDLE)
+            {
+                return;
+            }
+
+            // Presents are submitted by the presentation queue thread.
+            // Flush it so the swapchain isn't accessed from both threads.
+            m_presentationQueue->FlushCommands();
+
+            // The timeout keeps the application responsive if the presentation engine stops presenting,
+            // e.g. while the window is minimized.
+            constexpr uint64_t TimeoutInNanoseconds = 1000000000ull;
+            auto& device = static_cast<Device&>(GetDevice());
+            const VkResult result = device.GetContext().WaitForPresentKHR(
+                device.GetNativeDevice(), m_nativeSwapChain, m_presentId - 1, TimeoutInNanoseconds);
+            if (result == VK_ERROR_OUT_OF_DATE_KHR)
+            {
+                m_pendingRecreation = true;
+            }
+        }
+
         void SwapChain::SetNameInternal([[maybe_unused]] const AZStd::string_view& name)
         {
             // On some GPUs, like the Adreno 740, setting the name of the swapchain causes a crash, so we don't do it.
@@ -126,6 +150,11 @@ namespace AZ
                 auto& presentationQueue = device.GetCommandQueueContext().GetOrCreatePresentationCommandQueue(*this);
                 m_presentationQueue = &presentationQueue;
 
+                const auto& physicalDevice = static_cast<const PhysicalDevice&>(device.GetPhysicalDevice());
+                m_isPresentWaitEnabled = descriptor.m_isLowLatency &&
+                    physicalDevice.IsOptionalDeviceExtensionSupported(OptionalDeviceExtension::PresentId) &&
+                    physicalDevice.IsOptionalDeviceExtensionSupported(OptionalDeviceExtension::PresentWait);
+
                 if (IsDefaultSwapChainNeeded())
                 {
                     result = CreateSwapchain();
@@ -241,8 +270,9 @@ namespace AZ
             auto& device = static_cast<Device&>(GetDevice());
 
             const uint32_t imageIndex = GetCurrentImageIndex();
+            const uint64_t presentId = m_isPresentWaitEnabled ? m_presentId + 1 : 0;
 
-            auto presentCommand = [this, imageIndex, presentSemaphore = m_currentFrameContext.m_presentableSemaphore, &device](void* queue)
+            auto presentCommand = [this, imageIndex, presentId, presentSemaphore = m_currentFrameContext.m_presentableSemaphore, &device](void* queue)
             {
                 Queue* vulkanQueue = static_cast<Queue*>(queue);
                 VkSemaphore waitSemaphore = presentSemaphore->GetNativeSemaphore();
@@ -294,6 +324,15 @@ namespace AZ
                 info.pImageIndices = &imageIndex;
                 info.pResults = nullptr;
 
+                VkPresentIdKHR presentIdInfo{};
+                if (presentId)
+                {
+                    presentIdInfo.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+                    presentIdInfo.swapchainCount = 1;
+                    presentIdInfo.pPresentIds = &presentId;
+                    info.pNext = &presentIdInfo;
+                }
+
                 const VkResult result = device.GetContext().QueuePresentKHR(vulkanQueue->GetNativeQueue(), &info);
 
                 // Vulkan's definition of the two types of errors.
@@ -343,6 +382,7 @@ namespace AZ
             }
             else
             {
+                m_presentId = presentId;
                 m_presentationQueue->QueueCommand(AZStd::move(presentCommand));
                 return acquiredImageIndex;
             }
@@ -526,6 +566,7 @@ namespace AZ
             const VkResult result =
                 device.GetContext().CreateSwapchainKHR(device.GetNativeDevice(), &createInfo, VkSystemAllocator::Get(), &m_nativeSwapChain);
             AssertSuccess(result);
+            m_presentId = 0;
 
             return ConvertResult(result);
         }
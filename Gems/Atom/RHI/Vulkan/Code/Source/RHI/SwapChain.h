@@ -68,6 +68,7 @@ namespace AZ
             RHI::ResultCode ResizeInternal(const RHI::SwapChainDimensions& dimensions, RHI::SwapChainDimensions* nativeDimensions) override;
             uint32_t PresentInternal() override;
             void SetVerticalSyncIntervalInternal(uint32_t previousVsyncInterval) override;
+            void WaitForPresentLatencyInternal() override;
             //////////////////////////////////////////////////////////////////////
 
             RHI::ResultCode BuildSurface(const RHI::SwapChainDescriptor& descriptor);
@@ -113,6 +114,11 @@ namespace AZ
             AZStd::vector<VkImage> m_swapchainNativeImages;
             RHI::SwapChainDimensions m_dimensions;
 
+            //! Low latency mode. Presents are tagged with increasing ids so the CPU can wait for the previous one.
+            bool m_isPresentWaitEnabled = false;
+            //! Id of the last queued present. Ids restart when the native swapchain is recreated.
+            uint64_t m_presentId = 0;
+
             struct SwapChainBarrier
             {
                 VkPipelineStageFlags m_srcPipelineStages = 0;
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Math/Frustum.h>
 #include <AzCore/base.h>
@@ -21,6 +24,7 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/Math/Obb.h>
 #include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/containers/vector.h>
 
@@ -48,6 +52,8 @@ namespace AZ
 
     namespace RPI
     {
+        class Model;
+        class ModelAsset;
         class Scene;
 
         struct Cullable
@@ -97,16 +103,24 @@ namespace AZ
 
             struct LodData
             {
+                static constexpr uint32_t NoStreamingLodRequest = AZStd::numeric_limits<uint32_t>::max();
+
                 struct Lod
                 {
                     float m_screenCoverageMin = 0.0f;
                     float m_screenCoverageMax = 1.0f;
                     AZStd::vector<const RHI::DrawPacket*> m_drawPackets;
                     void* m_visibleObjectUserData = nullptr;
+                    //! Set while the lod draws a less detailed lod of m_streamingModel, because the model lod isn't streamed in yet.
+                    //! The model lod culling requests from the model when it selects this lod.
+                    uint32_t m_streamingLodRequest = NoStreamingLodRequest;
                 };
 
                 AZStd::vector<Lod> m_lods;
 
+                //! The model that streams the lods in, if any. See Model::RequestLod().
+                Model* m_streamingModel = nullptr;
+
                 //! Used for determining which lod(s) to select (usually is smaller than the bounding sphere radius)
                 //! Suggest setting to: 0.5f*localAabb.GetExtents().GetMaxElement()
                 float m_lodSelectionRadius = 1.0f;
@@ -128,6 +142,10 @@ namespace AZ
             //! something that shouldn't be rendered, regardless of its actual position relative to the camera
             bool m_isHidden = false;
 
+            //! The culling frame the cullable was last registered or updated in. Used by the CullingScene to find the cullables
+            //! that need to be re-tested against views whose visibility is cached from the previous frame.
+            uint64_t m_cullingUpdateFrame = AZStd::numeric_limits<uint64_t>::max();
+
             void SetDebugName([[maybe_unused]] const AZ::Name& debugName)
             {
 #ifdef AZ_CULL_DEBUG_ENABLED
@@ -148,6 +166,28 @@ namespace AZ
 #endif
         };
 
+        //! Model space triangles of an occluder, shared by the occluders of all the meshes using the same model.
+        struct OccluderGeometry
+        {
+            //! x, y, z of each vertex
+            AZStd::vector<float> m_positions;
+            AZStd::vector<uint32_t> m_indices;
+        };
+
+        //! A mesh rasterized into the software occlusion buffer of camera views, so the cullables it hides are culled.
+        //! Rasterizing is only worth its cost for large meshes hiding many others, like buildings and terrain features.
+        struct Occluder
+        {
+            AZStd::shared_ptr<const OccluderGeometry> m_geometry;
+            //! Model to world transform of the geometry, including the scale
+            Matrix3x4 m_localToWorld = Matrix3x4::CreateIdentity();
+            //! World-space bounds of the geometry
+            Aabb m_aabb = Aabb::CreateNull();
+
+            //! Index of the occluder in the CullingScene, managed by the CullingScene
+            size_t m_occluderIndex = AZStd::numeric_limits<size_t>::max();
+        };
+
         class CullingDebugContext
         {
         public:
@@ -226,7 +266,38 @@ namespace AZ
         };
 
         //! Selects an lod (based on size-in-screen-space) and adds the appropriate DrawPackets to the view.
-        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view, AzFramework::VisibilityEntry::TypeFlags typeFlags);
+        //! Dynamic cullables add their DrawPackets to the dynamic draw lists of the view, see View::SetDynamicCullableFlags().
+        //! When sharedView is set, the lod selected for the view is added to it too, so both views draw the same lod.
+        uint32_t AddLodDataToView(
+            const Vector3& pos,
+            const Cullable::LodData& lodData,
+            RPI::View& view,
+            AzFramework::VisibilityEntry::TypeFlags typeFlags,
+            bool isDynamic = false,
+            RPI::View* sharedView = nullptr);
+
+        struct WorklistData;
+
+        // The cullables that passed the frustum tests of a view in the previous frame. When a view's frustums don't change,
+        // only the cullables that were updated since are tested again, rather than traversing the whole visibility scene.
+        struct ViewVisibilityCache
+        {
+            Matrix4x4 m_worldToClip;
+            Matrix4x4 m_worldToClipExclude;
+            Matrix4x4 m_cameraWorldToClip;
+            Matrix4x4 m_sharedWorldToClip;
+            bool m_hasExcludeFrustum = false;
+            bool m_hasCameraFrustum = false;
+            bool m_hasSharedView = false;
+            int m_shadowCascadeExtrusionAmount = 0;
+
+            //! The culling frame the cache was built or updated in, or 0 if it has never been built
+            uint64_t m_frame = 0;
+
+            //! Each chunk is processed by one task, and is only written by that task
+            AZStd::vector<AZStd::vector<Cullable*>> m_chunks;
+            AZStd::mutex m_chunksMutex;
+        };
 
         //! Centralized manager for culling-related processing for a given scene.
         //! There is one CullingScene owned by each Scene, so external systems (such as FeatureProcessors) should
@@ -259,6 +330,20 @@ namespace AZ
             //! Sets a list of occlusion planes to be used during the culling process.
             void SetOcclusionPlanes(const OcclusionPlaneVector& occlusionPlanes) { m_occlusionPlanes = occlusionPlanes; }
 
+            //! Adds an occluder rasterized into the occlusion buffer of the camera views before their cullables are tested.
+            //! Must be called again whenever the occluder moves. Can be called from multiple threads, outside of Begin/EndCulling().
+            void RegisterOrUpdateOccluder(Occluder& occluder);
+
+            //! Removes an occluder added with RegisterOrUpdateOccluder().
+            void UnregisterOccluder(Occluder& occluder);
+
+            //! Returns the triangles of the least detailed lod of a model, shared with the other occluders of the same model.
+            //! The buffer assets of the model must be in memory. Returns nullptr if the lod doesn't have 3 floats positions.
+            AZStd::shared_ptr<const OccluderGeometry> FindOrCreateOccluderGeometry(const Data::Asset<ModelAsset>& modelAsset);
+
+            //! Models with this tag are used as occluders by the meshes drawing them
+            static constexpr const char* OccluderModelTag = "occluder";
+
             //! Notifies the CullingScene that culling will begin for this frame.
             void BeginCulling(const Scene& scene, AZStd::span<const ViewPtr> views);
 
@@ -305,13 +390,42 @@ namespace AZ
             void BeginCullingTaskGraph(const Scene& scene, AZStd::span<const ViewPtr> views);
             void BeginCullingJobs(const Scene& scene, AZStd::span<const ViewPtr> views);
             void ProcessCullablesCommon(const Scene& scene, View& view, AZ::Frustum& frustum);
+            //! Renders the occlusion planes and occluders in the frustum into the occlusion buffer of the view
+            void RasterizeOccluders(View& view, const AZ::Frustum& frustum);
+
+            //! Pairs the views of the eyes of a stereo camera, so they are culled once, see r_cullingShareStereoViews
+            void PairSharedCullingViews(const Scene& scene, AZStd::span<const ViewPtr> views);
+            //! Returns the view culled along with this view this frame, or nullptr
+            View* GetSharedCullingView(const View& view) const;
+            //! Returns true if the view is culled along with another view this frame, so it is skipped
+            bool IsCulledWithSharedView(const View& view) const;
+
+            bool ProcessCachedCullables(
+                ViewVisibilityCache& cache, const AZStd::shared_ptr<WorklistData>& worklistData, AZ::TaskGraph* taskGraph);
 
             const Scene* m_parentScene = nullptr;
             AzFramework::IVisibilityScene* m_visScene = nullptr;
             CullingDebugContext m_debugCtx;
             AZStd::concurrency_checker m_cullDataConcurrencyCheck;
             OcclusionPlaneVector m_occlusionPlanes;
+            AZStd::mutex m_occludersMutex;
+            AZStd::vector<Occluder*> m_occluders;
+            // The geometries of the models, and the model assets they were created from to rebuild them when a model is reloaded
+            AZStd::unordered_map<Data::AssetId, AZStd::pair<const ModelAsset*, AZStd::weak_ptr<const OccluderGeometry>>> m_occluderGeometries;
             AZ::TaskGraphActiveInterface* m_taskGraphActive = nullptr;
+
+            // The culling frame is incremented by BeginCulling
+            uint64_t m_cullingFrame = 0;
+            // Cullables registered or updated since the last BeginCulling, and the ones registered or updated before this frame's
+            AZStd::mutex m_updatedCullablesMutex;
+            AZStd::vector<Cullable*> m_pendingUpdatedCullables;
+            AZStd::vector<Cullable*> m_updatedCullables;
+            // Removing a cullable invalidates every cache, since they may refer to it
+            AZStd::atomic_bool m_pendingCullableRemoved{ false };
+            bool m_cullableRemoved = false;
+            AZStd::unordered_map<const View*, AZStd::unique_ptr<ViewVisibilityCache>> m_viewVisibilityCaches;
+            // Pairs of (culled view, view sharing its culling) of this frame
+            AZStd::vector<AZStd::pair<View*, View*>> m_sharedCullingViews;
         };
         
 
@@ -12,6 +12,8 @@
 #include <Atom/RHI/StreamBufferView.h>
 #include <Atom/RPI.Public/Buffer/RingBuffer.h>
 
+#include <AzCore/std/parallel/atomic.h>
+
 namespace AZ
 {
     namespace RPI
@@ -41,6 +43,7 @@ namespace AZ
             //! Allocate a dynamic buffer with specified size and alignment
             //! It may return nullptr if the input size is larger than ring buffer size or there isn't enough unused memory available within
             //! the ring buffer
+            //! It's lock free, so any number of threads can allocate at the same time, but not while FrameEnd is called.
             RHI::Ptr<DynamicBuffer> Allocate(uint32_t size, uint32_t alignment);
 
             //! Get an IndexBufferView for a DynamicBuffer used as an index buffer
@@ -59,8 +62,8 @@ namespace AZ
             // Get buffer's offset;
             uint32_t GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer);
 
-            // The position where the buffer is available.
-            uint32_t m_currentPosition = 0;
+            // The position where the buffer is available. Allocations bump it with a compare exchange.
+            AZStd::atomic<uint32_t> m_currentPosition{ 0 };
 
             // The size of the buffer per frame
             uint32_t m_ringBufferSize = 0;
@@ -74,6 +74,10 @@ namespace AZ
             //! Requests the image mips be made available.
             //! A value of 0 is the most detailed mip level. The value is clamped to the last mip in the chain.
             void SetTargetMip(uint16_t targetMipLevel);
+
+            //! Returns the index of the requested mip of this image in the list passed to StreamingImagePool::ApplyMipFeedback,
+            //! or StreamingImageController::InvalidMipFeedbackSlot if the image isn't streamable.
+            uint32_t GetMipFeedbackSlot() const;
             
             const Data::Instance<StreamingImagePool>& GetPool() const;
 
@@ -54,6 +54,9 @@ namespace AZ
             //! Returns the timestamp of last access.
             size_t GetLastAccessTimestamp() const;
 
+            //! Returns the slot of the image in the requested mips passed to its controller.
+            uint32_t GetMipFeedbackSlot() const;
+
             //! Calculate some mip stats which are used for determinate their expansion or eviction orders
             //! The stats include: m_mipLevelTargetAdjusted, m_residentMip, m_evictableMips, m_missingMips, m_residentMipSize
             //! This function need to be called every time after a mip is expanded or evicted or when the global mip bias is changed
@@ -73,6 +76,13 @@ namespace AZ
 
             // Tracks the last timestamp the image was requested.
             AZStd::atomic_size_t m_lastAccessTimestamp = {0};
+
+            // The slot of the image in the requested mips, see StreamingImageController::ApplyMipFeedback.
+            uint32_t m_mipFeedbackSlot = static_cast<uint32_t>(-1);
+
+            // Whether a mip was requested for the image at least once, and the last timestamp one was.
+            bool m_hasMipFeedback = false;
+            size_t m_lastMipFeedbackTimestamp = 0;
                         
             // The target mip level which applied global mip bias
             uint16_t m_mipLevelTargetAdjusted = 0;
@@ -9,8 +9,10 @@
 #pragma once
 
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -30,6 +32,8 @@ namespace AZ
     {
         class StreamingImage;
 
+        AZ_CVAR_EXTERNED(uint32_t, r_streamingImageFeedbackUnsampledUpdates);
+
         class StreamingImageController
         {
             friend class StreamingImagePool;
@@ -43,6 +47,12 @@ namespace AZ
             StreamingImageController() = default;
             ~StreamingImageController() = default;
 
+            //! The value of a requested mip entry for an image that wasn't requested.
+            static constexpr uint32_t NoMipFeedback = static_cast<uint32_t>(-1);
+
+            //! The mip feedback slot of images which aren't attached to a controller.
+            static constexpr uint32_t InvalidMipFeedbackSlot = static_cast<uint32_t>(-1);
+
         protected:
 
             //! Attaches an instance of an image streaming asset to the controller.
@@ -81,6 +91,18 @@ namespace AZ
             //! Return whether the available memory of the streaming image pool is low
             bool IsMemoryLow() const;
 
+            //! Returns the number of entries a list of requested mips needs to cover every image attached to the controller.
+            uint32_t GetMipFeedbackSlotCount() const;
+
+            //! Drives the target mip of the attached images from a list of requested mips supplied by the caller.
+            //! Each entry is indexed by the mip feedback slot of an image (see StreamingImage::GetMipFeedbackSlot) and holds the most
+            //! detailed mip requested for the image, or NoMipFeedback if it wasn't requested. The controller doesn't produce the
+            //! list itself, no feedback is gathered unless a caller provides it.
+            //! Requested images stream to the requested mip. Images that reported feedback before but weren't sampled for
+            //! r_streamingImageFeedbackUnsampledUpdates updates are evicted down to their mip chain tail, so their memory is
+            //! available for the images in view. Images that never reported feedback keep their current target mip.
+            void ApplyMipFeedback(AZStd::span<const uint32_t> requestedMips);
+
         protected:
             using StreamingImageContextList = AZStd::intrusive_list<StreamingImageContext, AZStd::list_base_hook<StreamingImageContext>>;
 
@@ -171,6 +193,11 @@ namespace AZ
 
             // a global option to add a bias to all the streaming images' target mip level
             int16_t m_globalMipBias = 0;
+
+            // The image attached to each mip feedback slot (null for free slots), and the free slots to reuse first.
+            // Guarded by m_contextAccessMutex.
+            AZStd::vector<StreamingImage*> m_mipFeedbackSlotImages;
+            AZStd::vector<uint32_t> m_freeMipFeedbackSlots;
         };
     }
 }
@@ -77,6 +77,15 @@ namespace AZ
                         
             int16_t GetMipBias() const;
 
+            //! Returns the number of entries a list of requested mips needs to cover the streamable images of the pool.
+            uint32_t GetMipFeedbackSlotCount() const;
+
+            //! Drives the target mips of the streamable images from a list of requested mips supplied by the caller, where each
+            //! entry is the most detailed mip requested for the image with that StreamingImage::GetMipFeedbackSlot, or
+            //! StreamingImageController::NoMipFeedback if the image wasn't requested.
+            //! Images which stop being requested are evicted to their mip chain tail to free pool memory for the requested images.
+            void ApplyMipFeedback(AZStd::span<const uint32_t> requestedMips);
+
         private:
             StreamingImagePool() = default;
 
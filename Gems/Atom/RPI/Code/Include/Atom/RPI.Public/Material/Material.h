@@ -137,6 +137,19 @@ namespace AZ
 
             const Data::Asset<MaterialAsset>& GetAsset() const;
 
+            //! Returns the index of the material entry in the MaterialParameterBuffer, or MaterialParameterBuffer::InvalidEntryIndex
+            //! if the material isn't in bindless mode (see r_bindlessMaterials).
+            uint32_t GetParameterEntryIndex() const;
+
+            //! Returns whether the shaders of this material read its parameters from the MaterialParameterBuffer instead of the
+            //! material SRG.
+            bool UsesParameterBuffer() const;
+
+            //! Returns the material SRG to bind to the draws of this material. This is the SRG shared by all the materials with
+            //! the same material SRG layout when the material uses the MaterialParameterBuffer (see UsesParameterBuffer()),
+            //! so their draws only differ by their material parameter index. Otherwise it's the SRG of this material.
+            const RHI::ShaderResourceGroup* GetDrawShaderResourceGroup() const;
+
             //! Returns whether the material is ready to compile pending changes. (Materials can only be compiled once per frame because SRGs can only be compiled once per frame).
             bool CanCompile() const;
 
@@ -164,6 +177,15 @@ namespace AZ
             //! Helper function to reinitialize the material while preserving property values.
             void ReInitKeepPropertyValues();
 
+            //! Releases the entry of the material parameters in the MaterialParameterBuffer.
+            void ReleaseParameterEntry();
+
+            //! Makes the shaders read the material from its MaterialParameterBuffer entry if all of them support it.
+            void InitParameterBufferUsage();
+
+            //! Returns false if any functor of the material can't process for several materials at the same time.
+            bool CanCompileConcurrently() const;
+
             //! Helper function for setting the value of a shader constant input, allowing for specialized handling of specific types,
             //! converting to the native type before passing to the ShaderResourceGroup.
             bool SetShaderConstant(RHI::ShaderInputConstantIndex shaderInputIndex, const MaterialPropertyValue& value);
@@ -206,9 +228,21 @@ namespace AZ
             //! The RHI shader resource group owned by m_shaderResourceGroup. Held locally to avoid an indirection.
             const RHI::ShaderResourceGroup* m_rhiShaderResourceGroup = nullptr;
 
+            //! The entry of the material parameters in the MaterialParameterBuffer, in bindless mode.
+            uint32_t m_parameterEntryIndex = aznumeric_cast<uint32_t>(-1);
+            uint32_t m_parameterEntryWordCount = 0;
+
+            //! The material SRG shared with the other materials of the same SRG layout, set when the shaders read the material
+            //! from the MaterialParameterBuffer.
+            Data::Instance<RPI::ShaderResourceGroup> m_sharedShaderResourceGroup;
+
             //! These the main material properties, exposed in the Material Editor, and configured directly by users.
             MaterialPropertyCollection m_materialProperties;
 
+            //! The main material property values at the last compile. Properties that are set back to these values don't process
+            //! their connections and functors again.
+            AZStd::vector<MaterialPropertyValue> m_compiledPropertyValues;
+
             ShaderCollection m_generalShaderCollection;
 
             MaterialPipelineDataMap m_materialPipelineData;
@@ -223,6 +257,8 @@ namespace AZ
 
             bool m_isInitializing = false;
 
+            bool m_canCompileConcurrently = true;
+
             MaterialPropertyPsoHandling m_psoHandling = MaterialPropertyPsoHandling::Warning;
 
             OnMaterialShaderVariantReadyEvent m_shaderVariantReadyEvent;
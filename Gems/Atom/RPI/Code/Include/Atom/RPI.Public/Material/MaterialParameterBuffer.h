@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Base.h>
+#include <Atom/RPI.Public/Buffer/RingBuffer.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        class ShaderResourceGroupData;
+        class ShaderResourceGroupLayout;
+    }
+
+    namespace RPI
+    {
+        //! When enabled, materials also write their parameters to the global MaterialParameterBuffer, and mesh draws pass the
+        //! index of their material entry to the shaders whose draw SRG has a m_materialParameterIndex constant.
+        AZ_CVAR_EXTERNED(bool, r_bindlessMaterials);
+
+        //! Holds the parameters of the materials in bindless mode (see r_bindlessMaterials) in one global buffer of 32 bit
+        //! words, so shaders can read the parameters of any material from its entry index instead of through a material SRG.
+        //! This lets draws differ only by their material index, which cuts the material SRG binds and allows merging draws.
+        //!
+        //! An entry holds the constant data of the material SRG, followed by the bindless read index of each image of the
+        //! material SRG image group, or RHI::DeviceImageView::InvalidBindlessIndex for images that aren't set. The bindless
+        //! indices are device specific, so each device gets its own copy of the buffer.
+        //! The shaders find the buffer in the scene SRG as m_materialParameters when the scene SRG declares it.
+        //!
+        //! The constant data is copied as is, so it keeps the constant buffer packing of the material SRG, and the images follow
+        //! in the order of the image inputs of the material SRG layout. Shaders that read the buffer mirror that layout, see
+        //! BasePBR_MaterialParameters.azsli. Materials whose shaders all declare the o_materialParameterBuffer option enable it
+        //! and bind a material SRG shared with the other materials of the same layout instead of their own SRG.
+        class MaterialParameterBuffer
+        {
+        public:
+            AZ_RTTI(MaterialParameterBuffer, "{3B0F7C2E-61A4-4B7D-9C55-1D8E2F6A4C90}");
+            AZ_CLASS_ALLOCATOR(MaterialParameterBuffer, SystemAllocator);
+
+            static constexpr uint32_t InvalidEntryIndex = aznumeric_cast<uint32_t>(-1);
+
+            //! The draw SRG constant that receives the entry index of the material of a mesh draw.
+            static constexpr const char* EntryIndexSrgName = "m_materialParameterIndex";
+
+            //! The scene SRG buffer the material parameter buffer is bound to.
+            static constexpr const char* BufferSrgName = "m_materialParameters";
+
+            //! The shader option that makes the shaders read the material from the buffer instead of the material SRG.
+            static constexpr const char* ShaderOptionName = "o_materialParameterBuffer";
+
+            //! Returns the buffer registered by the MaterialSystem, or nullptr.
+            static MaterialParameterBuffer* Get();
+
+            MaterialParameterBuffer() = default;
+            virtual ~MaterialParameterBuffer() = default;
+
+            void Init();
+            void Shutdown();
+
+            //! Returns the number of 32 bit words of the entry of a material with this material SRG layout.
+            static uint32_t GetEntryWordCount(const RHI::ShaderResourceGroupLayout& layout);
+
+            //! Allocates an entry with a number of 32 bit words. The returned index is the offset of the entry in the buffer,
+            //! in 32 bit words.
+            uint32_t AcquireEntry(uint32_t wordCount);
+
+            //! Releases an entry allocated with AcquireEntry, with the same word count.
+            void ReleaseEntry(uint32_t entryIndex, uint32_t wordCount);
+
+            //! Writes the constants and bindless image indices of the compiled material SRG data to an entry.
+            void UpdateEntry(uint32_t entryIndex, uint32_t wordCount, const RHI::ShaderResourceGroupData& groupData);
+
+            //! Uploads the buffer if any entry changed since the last upload. Called once per frame by the MaterialSystem.
+            void FrameUpdate();
+
+            //! Returns the buffer that was last uploaded, which may be null if no entry was ever written.
+            const Data::Instance<Buffer>& GetBuffer() const;
+
+            //! Returns the compiled material SRG shared by the materials with this SRG layout that use the buffer. It holds no
+            //! material data, it only fills the material SRG slot of the pipeline layout and provides the static samplers.
+            Data::Instance<ShaderResourceGroup> GetSharedMaterialSrg(
+                const Data::Asset<ShaderAsset>& shaderAsset, const RHI::ShaderResourceGroupLayout& layout);
+
+        private:
+            AZStd::mutex m_mutex;
+
+            //! The entries of every device, in 32 bit words.
+            AZStd::unordered_map<int, AZStd::vector<uint32_t>> m_deviceEntries;
+
+            //! The released entries, by word count. Materials of the same type have the same word count, so entries are reused
+            //! as is.
+            AZStd::unordered_map<uint32_t, AZStd::vector<uint32_t>> m_freeEntries;
+
+            //! The shared material SRGs, by the hash of their layout.
+            AZStd::unordered_map<HashValue64, Data::Instance<ShaderResourceGroup>> m_sharedMaterialSrgs;
+
+            uint32_t m_wordCount = 0;
+            bool m_isDirty = false;
+
+            RingBuffer m_buffer{ "MaterialParameterBuffer", CommonBufferPoolType::ReadOnly, RHI::Format::R32_UINT };
+        };
+    } // namespace RPI
+} // namespace AZ
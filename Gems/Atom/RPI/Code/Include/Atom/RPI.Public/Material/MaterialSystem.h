@@ -7,23 +7,84 @@
  */
 #pragma once
 
+#include <Atom/RPI.Public/Material/MaterialParameterBuffer.h>
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/time.h>
+
 namespace AZ
 {
     class ReflectContext;
 
     namespace RPI
     {
+        class Material;
+
+        //! When enabled, QueueCompile defers the compile of materials to CompileQueuedMaterials, which compiles them in parallel jobs.
+        AZ_CVAR_EXTERNED(bool, r_materialParallelCompile);
+
         //! Manages system-wide initialization and support for material classes
         class MaterialSystem
         {
         public:
+            AZ_RTTI(MaterialSystem, "{6D2B8E47-3F1C-4A95-B07E-9C4D1F8A2E63}");
+            AZ_CLASS_ALLOCATOR(MaterialSystem, SystemAllocator);
+
             static void Reflect(AZ::ReflectContext* context);
             static void GetAssetHandlers(AssetHandlerPtrList& assetHandlers);
 
+            //! Returns the material system registered by the RPISystem, or nullptr.
+            static MaterialSystem* Get();
+
+            MaterialSystem() = default;
+            virtual ~MaterialSystem() = default;
+
             void Init();
             void Shutdown();
+
+            //! Uploads the material parameters that changed this frame, and reports the compile stats of the frame.
+            void FrameUpdate();
+
+            //! Compiles the materials that need it. Materials whose functors can all process concurrently are split across jobs,
+            //! the others are compiled on the calling thread. The caller must not modify the materials until this returns.
+            void CompileMaterials(AZStd::span<const Data::Instance<Material>> materials);
+
+            //! Queues a material to be compiled by the next CompileQueuedMaterials, together with the other queued materials.
+            //! Compiles the material right away if r_materialParallelCompile is off. Thread safe.
+            //! @return false if the material was compiled right away and the compile failed.
+            bool QueueCompile(const Data::Instance<Material>& material);
+
+            //! Compiles the queued materials. Materials that can't compile yet stay queued for the next call.
+            //! Called by the RPISystem before the scenes simulate.
+            void CompileQueuedMaterials();
+
+            //! Records a compile of a material that took @compileTime microseconds. Called by Material::Compile, thread safe.
+            void RecordCompile(AZStd::sys_time_t compileTime);
+
+            //! Stats of the materials compiled during the last frame
+            //! @{
+            uint32_t GetCompiledMaterialCount() const;
+            //! The sum of the compile times of the materials, in microseconds. Materials compiled in parallel overlap.
+            AZStd::sys_time_t GetCompileTime() const;
+            //! @}
+
+        private:
+            MaterialParameterBuffer m_parameterBuffer;
+
+            AZStd::mutex m_queueMutex;
+            AZStd::vector<Data::Instance<Material>> m_queuedMaterials;
+
+            AZStd::atomic<uint32_t> m_frameCompiledMaterialCount{ 0 };
+            AZStd::atomic<AZStd::sys_time_t> m_frameCompileTime{ 0 };
+            uint32_t m_compiledMaterialCount = 0;
+            AZStd::sys_time_t m_compileTime = 0;
         };
 
     } // namespace RPI
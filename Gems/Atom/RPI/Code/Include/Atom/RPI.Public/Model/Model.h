@@ -17,8 +17,11 @@
 
 #include <AtomCore/Instance/InstanceData.h>
 
+#include <AzCore/EBus/Event.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -30,6 +33,7 @@ namespace AZ
             : public Data::InstanceData
         {
             friend class ModelSystem;
+            friend class ModelLodStreamingController;
 
         public:
             AZ_INSTANCE_DATA(Model, "{C30F5522-B381-4B38-BBAF-6E0B1885C8B9}");
@@ -41,7 +45,13 @@ namespace AZ
             //! This is a temporary function, that will be removed once the Model/ModelAsset classes no longer need it
             static void TEMPOrphanFromDatabase(const Data::Asset<ModelAsset>& modelAsset);
 
-            ~Model() = default;
+            //! The lod index of a model nothing requested a lod of.
+            static constexpr uint32_t NoLodRequest = AZStd::numeric_limits<uint32_t>::max();
+
+            //! Signaled on the main thread when a lod of the model is streamed in or evicted.
+            using LodResidencyChangedEvent = Event<>;
+
+            ~Model();
 
             //! Blocks the CPU until the streaming upload is complete. Returns immediately if no
             //! streaming upload is currently pending.
@@ -51,8 +61,34 @@ namespace AZ
             size_t GetLodCount() const;
 
             //! Returns the full list of Lods, where index 0 is the most detailed, and N-1 is the least.
+            //! While the lods of the model stream in on demand, the lods that aren't resident are null, see IsLodResident().
             AZStd::span<const Data::Instance<ModelLod>> GetLods() const;
 
+            //! Lod streaming
+            //! While r_modelLodStreaming is set, models only create their r_modelLodStreamingResidentLodCount least detailed lods
+            //! with the model. The more detailed lods are streamed in by the ModelLodStreamingController once culling selects them,
+            //! and evicted again, least recently selected first, when the streamed lods exceed r_modelLodStreamingBudgetMB.
+            //! @{
+
+            //! Returns true if the lods of the model stream in on demand.
+            bool IsLodStreamingEnabled() const;
+
+            //! Returns true if the lod is created, false while it isn't streamed in.
+            bool IsLodResident(size_t lodIndex) const;
+
+            //! Returns the most detailed resident lod that isn't more detailed than the lod, which is drawn in its place.
+            size_t GetResidentLodIndex(size_t lodIndex) const;
+
+            //! Requests the lod to be streamed in. Called by culling for the lods it selects, thread safe.
+            void RequestLod(size_t lodIndex);
+
+            //! Creates all the lods that aren't resident, blocking until their buffer assets are loaded, and stops streaming
+            //! the lods of the model. For users that need every lod of the model.
+            void DisableLodStreaming();
+
+            void ConnectLodResidencyChangedHandler(LodResidencyChangedEvent::Handler& handler);
+            //! @}
+
             //! Returns whether a buffer upload is pending.
             bool IsUploadPending() const;
 
@@ -99,6 +135,17 @@ namespace AZ
             static Data::Instance<Model> CreateInternal(const Data::Asset<ModelAsset>& modelAsset);
             RHI::ResultCode Init(const Data::Asset<ModelAsset>& modelAsset);
 
+            void CollectUvNames(const ModelLodAsset& lodAsset);
+
+            // Creates a lod that isn't resident. Its buffer assets must be loaded.
+            bool CreateLod(size_t lodIndex);
+
+            // Releases a lod that was streamed in.
+            void EvictLod(size_t lodIndex);
+
+            // Returns the most detailed lod requested since the last call, or NoLodRequest.
+            uint32_t ConsumeLodRequest();
+
             AZStd::fixed_vector<Data::Instance<ModelLod>, ModelLodAsset::LodCountMax> m_lods;
             Data::Asset<ModelAsset> m_modelAsset;
 
@@ -106,6 +153,10 @@ namespace AZ
 
             // Tracks whether buffers have all been streamed up to the GPU.
             bool m_isUploadPending = false;
+
+            bool m_isLodStreamingEnabled = false;
+            AZStd::atomic<uint32_t> m_requestedLodIndex{ NoLodRequest };
+            LodResidencyChangedEvent m_lodResidencyChangedEvent;
         };
     } // namespace RPI
 } // namespace AZ
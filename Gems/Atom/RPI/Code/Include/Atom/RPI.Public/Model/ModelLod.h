@@ -119,6 +119,9 @@ namespace AZ
             // Releases all the buffer dependencies that were added through TrackBuffer
             void ReleaseTrackedBuffers();
 
+            //! Returns the size of the buffers used by the meshes of this lod, in bytes.
+            uint64_t GetBufferMemoryUsage() const;
+
         private:
             ModelLod() = default;
 
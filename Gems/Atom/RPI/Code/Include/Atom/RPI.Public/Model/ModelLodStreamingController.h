@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Model/Model.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR_EXTERNED(bool, r_modelLodStreaming);
+
+        //! Streams the more detailed lods of models in on demand, along the lines of the mips of streaming images.
+        //!
+        //! While r_modelLodStreaming is set, models only create their r_modelLodStreamingResidentLodCount least detailed lods.
+        //! Culling requests the lods it selects from the model (see Model::RequestLod), and draws the most detailed resident
+        //! lod in their place until they are streamed in. The controller queues the loads of the buffer assets of a requested
+        //! lod through the asset manager, which reads them with the streamer, and creates the lod once they are loaded.
+        //! When the buffers of the streamed lods exceed r_modelLodStreamingBudgetMB, the lods selected the least recently are
+        //! evicted, so distant meshes don't keep their most detailed lods in memory.
+        class ModelLodStreamingController final
+        {
+        public:
+            AZ_RTTI(ModelLodStreamingController, "{5B7E2C49-1D8A-4F36-9C05-E84A3B6F71D2}");
+            AZ_CLASS_ALLOCATOR(ModelLodStreamingController, SystemAllocator);
+
+            ModelLodStreamingController() = default;
+            ~ModelLodStreamingController();
+            AZ_DISABLE_COPY_MOVE(ModelLodStreamingController);
+
+            //! Returns the controller registered by the ModelSystem, if any.
+            static ModelLodStreamingController* Get();
+
+            //! Returns true while r_modelLodStreaming is set. Only affects the models created after it changes.
+            static bool IsEnabled();
+
+            //! Returns the number of least detailed lods models always keep resident.
+            static size_t GetResidentLodCount();
+
+            void Init();
+            void Shutdown();
+
+            //! Attaches a model whose lods stream in, called by the model.
+            void AttachModel(Model* model);
+
+            //! Detaches a model, called by the model when it's destroyed or it stops streaming its lods.
+            void DetachModel(Model* model);
+
+            //! Starts and finishes the loads of the requested lods, and evicts lods while the streamed lods exceed the budget.
+            //! Signals Model::LodResidencyChangedEvent for the models that streamed in or evicted lods.
+            void Update();
+
+            //! Stats
+            //! @{
+            uint64_t GetStreamedMemoryUsage() const;
+            uint32_t GetLoadingLodCount() const;
+            uint32_t GetStreamingModelCount() const;
+            //! @}
+
+        private:
+            struct ModelStreamingState
+            {
+                //! The number of lods of the model that stream in, starting with the most detailed one
+                size_t m_streamableLodCount = 0;
+                //! The lod whose buffer assets are loading, if any
+                uint32_t m_loadingLodIndex = Model::NoLodRequest;
+                //! Set once a lod failed to load, the model isn't streamed any more
+                bool m_hasFailed = false;
+                //! The last update culling selected each lod in, or drew it in place of a more detailed lod
+                AZStd::array<uint64_t, ModelLodAsset::LodCountMax> m_lastRequestUpdate = {};
+                //! The size of the buffers of each streamed in lod
+                AZStd::array<uint64_t, ModelLodAsset::LodCountMax> m_lodMemoryUsage = {};
+            };
+
+            // Returns true if the model streamed in or evicted a lod.
+            bool UpdateModel(Model& model, ModelStreamingState& state);
+
+            // Evicts the lods selected the least recently until the streamed lods fit the budget. Fills the models that evicted lods.
+            void EvictOverBudget(AZStd::vector<Model*>& changedModels);
+
+            // Guards the attached models and the stats. Held while the events are signaled, so the models can't be destroyed.
+            mutable AZStd::mutex m_mutex;
+            AZStd::unordered_map<Model*, ModelStreamingState> m_models;
+
+            uint64_t m_updateCount = 0;
+            uint64_t m_streamedMemoryUsage = 0;
+            uint32_t m_loadingLodCount = 0;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -62,6 +62,7 @@ namespace AZ
             void BuildInternal() override;
 
             // Scope producer functions...
+            void SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph) override;
             void CompileResources(const RHI::FrameGraphCompileContext& context) override;
             void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
 
@@ -91,6 +92,9 @@ namespace AZ
             AZ::RHI::Ptr<AZ::RHI::IndirectBufferSignature> m_indirectDispatchBufferSignature;
             AZ::RHI::IndirectBufferView m_indirectDispatchBufferView;
 
+            // Whether the frame graph compiler may move the pass to the compute queue, see ComputePassData::m_allowAsyncCompute
+            bool m_allowAsyncCompute = false;
+
             // ShaderReloadNotificationBus::Handler overrides...
             void OnShaderReinitialized(const Shader& shader) override;
             void OnShaderAssetReinitialized(const Data::Asset<ShaderAsset>& shaderAsset) override;
@@ -62,6 +62,9 @@ namespace AZ
             // Retrieve draw lists from view and dynamic draw system and generate final draw list
             void UpdateDrawList();
 
+            // Returns the draw list of the view this pass renders. Passes can override this to render another list of the view.
+            virtual RHI::DrawListView GetViewDrawList(View& view) const;
+
             // Submit draw items to the context
             virtual void SubmitDrawItems(const RHI::FrameGraphExecuteContext& context, uint32_t startIndex, uint32_t endIndex, uint32_t indexOffset) const;
 
@@ -81,6 +84,9 @@ namespace AZ
             // If there are more than one draw lists from different source: View, DynamicDrawSystem,
             // we need to creates a combined draw list which combines all the draw lists to one and cache it until they are submitted. 
             RHI::DrawList m_combinedDrawList;
+
+            // Estimated recording cost of each item in m_drawListView, used to balance the draws across command lists
+            AZStd::vector<uint32_t> m_drawItemCosts;
             
             // Forces viewport and scissor to match width/height of output image at specified index.
             // Does nothing if index is negative.
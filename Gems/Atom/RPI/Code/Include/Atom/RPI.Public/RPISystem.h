@@ -26,11 +26,15 @@
 #include <Atom/RPI.Reflect/RPISystemDescriptor.h>
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Debug/TraceMessageBus.h>
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -46,6 +50,11 @@ namespace AZ
     {
         class FeatureProcessor;
 
+        //! When enabled, the frame graph of a frame is recorded and submitted on the render thread while the main thread simulates
+        //! the next frame. The frame is prepared on the main thread as usual, so the render thread only executes a frame graph that
+        //! doesn't change anymore, and the frame is ended by the next SimulationTick or RenderTick.
+        AZ_CVAR_EXTERNED(bool, r_pipelinedRendering);
+
         class RPISystem final
             : public RPISystemInterface
             , public AZ::SystemTickBus::Handler
@@ -81,6 +90,8 @@ namespace AZ
             RHI::Ptr<RHI::ShaderResourceGroupLayout> GetViewSrgLayout() const override;
             void SimulationTick() override;
             void RenderTick() override;
+            void WaitForRenderFrame() override;
+            bool IsRenderFrameInFlight() const override;
             void SetSimulationJobPolicy(RHI::JobPolicy jobPolicy) override;
             RHI::JobPolicy GetSimulationJobPolicy() const override;
             void SetRenderPrepareJobPolicy(RHI::JobPolicy jobPolicy) override;
@@ -109,6 +120,13 @@ namespace AZ
 
             float GetCurrentTime() const;
 
+            // Ends the frame once the frame graph was executed
+            void FrameEnd();
+
+            // Starts or stops the thread that executes the frame graph in pipelined rendering
+            void StartRenderThread();
+            void StopRenderThread();
+
             // Initializes XR resources (session, device, swapchain, etc).
             void InitXRSystem();
 
@@ -149,6 +167,14 @@ namespace AZ
 
             uint64_t m_renderTick = 0;
 
+            // The render thread of r_pipelinedRendering, which executes the frame graph of a frame when m_renderFrameStart is released
+            // and releases m_renderFrameDone when it's done
+            AZStd::thread m_renderThread;
+            AZStd::binary_semaphore m_renderFrameStart;
+            AZStd::binary_semaphore m_renderFrameDone;
+            AZStd::atomic_bool m_isRenderThreadQuitting{ false };
+            bool m_isRenderFrameInFlight = false;
+
             // Application multisample state
             RHI::MultisampleState m_multisampleState;
 
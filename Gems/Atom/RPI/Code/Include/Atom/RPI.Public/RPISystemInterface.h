@@ -78,8 +78,18 @@ namespace AZ
             virtual void SimulationTick() = 0;
 
             //! Tick for rendering one frame.
+            //! With r_pipelinedRendering the frame graph is executed on the render thread, and the frame stays in flight while the
+            //! next frame is simulated, until WaitForRenderFrame is called.
             virtual void RenderTick() = 0;
 
+            //! Waits for the render thread to finish the frame in flight, then ends the frame. Anything the frame may reference,
+            //! like draw packets, views and passes, can be destroyed once this returns. Does nothing when no frame is in flight.
+            //! Must be called from the thread that calls RenderTick.
+            virtual void WaitForRenderFrame() = 0;
+
+            //! Returns true while a frame handed to the render thread hasn't been ended by WaitForRenderFrame.
+            virtual bool IsRenderFrameInFlight() const = 0;
+
             //! Job policy for FeatureProcessor simulation. 
             //! When parallel jobs are enabled, this will usually spawn one job per FeatureProcessor per Scene.
             virtual void SetSimulationJobPolicy(RHI::JobPolicy jobPolicy) = 0;
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI/PipelineStateDescriptor.h>
+#include <Atom/RHI.Reflect/InputStreamLayout.h>
+#include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
+#include <Atom/RHI.Reflect/RenderStates.h>
+#include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class ReflectContext;
+
+    namespace RPI
+    {
+        class Shader;
+        class ShaderVariant;
+
+        AZ_CVAR_EXTERNED(bool, r_psoRecordUsage);
+
+        //! Everything needed to rebuild a pipeline state descriptor that was acquired from a shader, except for the
+        //! runtime objects (pipeline layout and stage functions) which come from the shader variant when it's replayed.
+        struct PipelineStateUsageRecord
+        {
+            AZ_TYPE_INFO(PipelineStateUsageRecord, "{8A4F0C2E-6B1D-4E73-9F25-3C7D8E1A5B64}");
+            static void Reflect(ReflectContext* context);
+
+            Data::AssetId m_shaderAssetId;
+            Name m_supervariantName;
+            ShaderVariantId m_shaderVariantId;
+            uint32_t m_shaderVariantStableId = ShaderAsset::RootShaderVariantStableId.GetIndex();
+
+            //! Specialization constant values, by constant id.
+            //! @{
+            AZStd::vector<uint32_t> m_specializationIds;
+            AZStd::vector<uint32_t> m_specializationValues;
+            //! @}
+
+            //! Only used by draw pipeline states.
+            //! @{
+            RHI::RenderStates m_renderStates;
+            RHI::InputStreamLayout m_inputStreamLayout;
+            RHI::RenderAttachmentConfiguration m_renderAttachmentConfiguration;
+            //! @}
+
+            //! The hash of the descriptor the record was made from, used to merge records from different sessions.
+            uint64_t m_descriptorHash = 0;
+        };
+
+        //! The pipeline states recorded during play sessions, loaded at startup to compile them before they are first drawn.
+        struct PipelineStatePrewarmList
+        {
+            AZ_TYPE_INFO(PipelineStatePrewarmList, "{5D2B9E47-1C8A-4F36-B0E5-7A9C3F6D2E18}");
+            static void Reflect(ReflectContext* context);
+
+            AZStd::vector<PipelineStateUsageRecord> m_records;
+        };
+
+        //! Records the pipeline states acquired from shaders while r_psoRecordUsage is set, and compiles the pipeline states
+        //! of a previously saved prewarm list in parallel jobs, a few at a time each tick, so they are already in each shader's
+        //! pipeline library (and so in the pipeline library saved to disk per driver version) when they are first drawn.
+        //!
+        //! Workflow: play with r_psoRecordUsage enabled, run r_psoSaveUsage to merge the recorded pipeline states into the
+        //! prewarm list at r_psoPrewarmListPath, and ship that file. The list is prewarmed when the RPI system assets are
+        //! initialized if r_psoPrewarmOnStartup is set, or on demand with r_psoPrewarm (for instance after loading a level).
+        class PipelineStatePrewarmer final
+            : public SystemTickBus::Handler
+        {
+        public:
+            AZ_RTTI(PipelineStatePrewarmer, "{E6C13A58-2F94-4B7D-8D06-91B4A5C7E23F}");
+            AZ_CLASS_ALLOCATOR(PipelineStatePrewarmer, SystemAllocator);
+
+            PipelineStatePrewarmer() = default;
+            ~PipelineStatePrewarmer();
+            AZ_DISABLE_COPY_MOVE(PipelineStatePrewarmer);
+
+            static void Reflect(ReflectContext* context);
+
+            //! Returns the prewarmer registered by the ShaderSystem, if any.
+            static PipelineStatePrewarmer* Get();
+
+            void Init();
+            void Shutdown();
+
+            //! Returns true while r_psoRecordUsage is set.
+            static bool IsRecordingUsage();
+
+            //! Returns true if a descriptor with this hash was already recorded. Thread safe.
+            bool IsRecorded(HashValue64 descriptorHash) const;
+
+            //! Records the pipeline state descriptor acquired from the shader variant.
+            //! Called by Shader::AcquirePipelineState while usage recording is enabled, thread safe.
+            void RecordUsage(const Shader& shader, const ShaderVariant& variant, const RHI::PipelineStateDescriptor& descriptor);
+
+            //! Merges the pipeline states recorded so far into the prewarm list file. Returns false if the file couldn't be written.
+            bool SaveUsage();
+
+            //! Loads the prewarm list file and starts compiling its pipeline states over the next ticks.
+            void Prewarm();
+
+            //! Same as above if r_psoPrewarmOnStartup is set. Called once the RPI system assets are initialized.
+            void PrewarmOnStartup();
+
+            //! Starts compiling the pipeline states of the list over the next ticks.
+            void Prewarm(const PipelineStatePrewarmList& prewarmList);
+
+            //! Returns true until every pipeline state of the current prewarm has been compiled or given up on.
+            bool IsPrewarming() const;
+
+            //! Stats
+            //! @{
+            uint32_t GetRecordedCount() const;
+            uint32_t GetPendingCount() const;
+            uint32_t GetCompiledCount() const;
+            //! @}
+
+        private:
+            struct PendingRecord
+            {
+                PipelineStateUsageRecord m_record;
+                Data::Asset<ShaderAsset> m_shaderAsset;
+                uint32_t m_waitedTicks = 0;
+            };
+
+            // SystemTickBus overrides...
+            void OnSystemTick() override;
+
+            //! Builds the pipeline state descriptor of the record, or returns false if the shader or its variant isn't ready yet.
+            bool BuildDescriptor(PendingRecord& pending, Data::Instance<Shader>& shaderOut, AZStd::unique_ptr<RHI::PipelineStateDescriptor>& descriptorOut);
+
+            AZStd::string GetResolvedListPath() const;
+
+            mutable AZStd::mutex m_recordMutex;
+            AZStd::unordered_set<uint64_t> m_recordedHashes;
+            AZStd::vector<PipelineStateUsageRecord> m_recordedUsage;
+
+            AZStd::vector<PendingRecord> m_pendingRecords;
+            AZStd::vector<Data::Instance<Shader>> m_prewarmedShaders;
+            uint32_t m_compiledCount = 0;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -174,6 +174,9 @@ namespace AZ
             
             const ShaderVariant& GetVariantInternal(ShaderVariantStableId shaderVariantStableId);
 
+            //! Records the descriptor with the PipelineStatePrewarmer, along with the variant it was configured from.
+            void RecordPipelineStateUsage(const RHI::PipelineStateDescriptor& descriptor) const;
+
             // AssetBus overrides...
             void OnAssetReloaded(Data::Asset<Data::AssetData> asset) override;
 
@@ -198,7 +201,7 @@ namespace AZ
             RHI::PipelineLibraryHandle m_pipelineLibraryHandle;
 
             //! Used for thread safety for FindVariantStableId() and GetVariant().
-            AZStd::shared_mutex m_variantCacheMutex;
+            mutable AZStd::shared_mutex m_variantCacheMutex;
 
             //! The root variant always exist.
             ShaderVariant m_rootVariant;
@@ -10,8 +10,10 @@
 #include <AzCore/Interface/Interface.h>
 #include <Atom/RHI.Reflect/Base.h>
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
+#include <Atom/RPI.Public/Shader/PipelineStatePrewarmer.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderVariantAsyncLoader.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantPrefetcher.h>
 
 
 namespace AZ
@@ -49,6 +51,8 @@ namespace AZ
             AZStd::unordered_map<Name, ShaderOptionValue> m_globalShaderOptionValues;
             GlobalShaderOptionUpdatedEvent m_globalShaderOptionUpdatedEvent;
             ShaderVariantAsyncLoader m_shaderVariantAsyncLoader;
+            PipelineStatePrewarmer m_pipelineStatePrewarmer;
+            ShaderVariantPrefetcher m_shaderVariantPrefetcher;
 
             //! The ShaderSystem supervariantName is used by the ShaderAsset to search for an additional supervariant permutation.
             //! This is done by appending the supervariantName set here to the user-specified supervariant name.
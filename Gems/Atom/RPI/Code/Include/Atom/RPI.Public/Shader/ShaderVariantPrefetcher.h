@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/API/ApplicationAPI.h>
+
+namespace AZ
+{
+    class ReflectContext;
+
+    namespace RPI
+    {
+        class Material;
+
+        AZ_CVAR_EXTERNED(bool, r_shaderVariantPrefetch);
+
+        //! A shader variant that draws of a material asked for.
+        struct MaterialShaderVariantUsage
+        {
+            AZ_TYPE_INFO(MaterialShaderVariantUsage, "{3E7A1C95-4B28-4D6F-A0E3-8C5F2B19D7A4}");
+            static void Reflect(ReflectContext* context);
+
+            Data::AssetId m_materialAssetId;
+            Data::AssetId m_shaderAssetId;
+            ShaderVariantId m_shaderVariantId;
+        };
+
+        //! The shader variants learned for the materials of a level.
+        struct ShaderVariantPrefetchList
+        {
+            AZ_TYPE_INFO(ShaderVariantPrefetchList, "{B1D84F27-6C3E-4A95-9E02-5F7A3D8C1B6E}");
+            static void Reflect(ReflectContext* context);
+
+            AZStd::vector<MaterialShaderVariantUsage> m_usages;
+        };
+
+        //! Learns which shader variants the draws of each material ask for, and requests them from the variant async loader as
+        //! soon as the material is created, so they are loaded while the rest of the level loads instead of being drawn with the
+        //! root variant until the first draw asks for them.
+        //!
+        //! The learned variants are saved per level, in r_shaderVariantPrefetchFolder, when the level is unloaded or the shader
+        //! system shuts down, and loaded back when the level starts loading. With r_shaderVariantPrefetchPsoPrewarm set, the
+        //! pipeline state prewarm list is also compiled when a level starts loading, so it picks up the prefetched variants.
+        class ShaderVariantPrefetcher final
+            : public AzFramework::LevelSystemLifecycleNotificationBus::Handler
+        {
+        public:
+            AZ_RTTI(ShaderVariantPrefetcher, "{9C2F6E41-7A3B-4D08-B5E9-1F4C8A2D6B73}");
+            AZ_CLASS_ALLOCATOR(ShaderVariantPrefetcher, SystemAllocator);
+
+            ShaderVariantPrefetcher() = default;
+            ~ShaderVariantPrefetcher();
+            AZ_DISABLE_COPY_MOVE(ShaderVariantPrefetcher);
+
+            static void Reflect(ReflectContext* context);
+
+            //! Returns the prefetcher registered by the ShaderSystem, if any.
+            static ShaderVariantPrefetcher* Get();
+
+            void Init();
+            void Shutdown();
+
+            //! Returns true while r_shaderVariantPrefetch is set.
+            static bool IsEnabled();
+
+            //! Learns that a draw of the material asked for the shader variant. Called when draw packets select their variants, thread safe.
+            void RecordUsage(const Data::AssetId& materialAssetId, const Data::AssetId& shaderAssetId, const ShaderVariantId& shaderVariantId);
+
+            //! Requests the shader variants learned for the material's asset. Called when a material is initialized, thread safe.
+            void PrefetchVariants(const Material& material);
+
+            //! Replaces the learned variants with the ones of the list.
+            void SetPrefetchList(const ShaderVariantPrefetchList& prefetchList);
+
+            //! Saves the learned variants of the current level. Returns false if the file couldn't be written.
+            bool SaveLevelUsage();
+
+            //! Stats
+            //! @{
+            uint32_t GetLearnedCount() const;
+            uint32_t GetPrefetchedCount() const;
+            //! @}
+
+        private:
+            // AzFramework::LevelSystemLifecycleNotificationBus overrides...
+            void OnLoadingStart(const char* levelName) override;
+            void OnUnloadComplete(const char* levelName) override;
+
+            AZStd::string GetResolvedListPath(const AZStd::string& levelName) const;
+            void LoadLevelUsage(const AZStd::string& levelName);
+
+            mutable AZStd::mutex m_mutex;
+            //! The learned variants, by material asset
+            AZStd::unordered_map<Data::AssetId, AZStd::vector<MaterialShaderVariantUsage>> m_usagesByMaterial;
+            uint32_t m_learnedCount = 0;
+            //! Materials whose variants were already requested since the level started loading
+            AZStd::unordered_set<Data::AssetId> m_prefetchedMaterials;
+            uint32_t m_prefetchedCount = 0;
+            //! Set once something was learned that isn't in the saved list yet
+            bool m_hasUnsavedUsage = false;
+
+            AZStd::string m_levelName;
+        };
+    } // namespace RPI
+} // namespace AZ
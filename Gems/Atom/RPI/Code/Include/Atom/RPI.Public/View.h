@@ -10,6 +10,7 @@
 
 #include <Atom/RHI/ShaderResourceGroup.h>
 #include <Atom/RHI/DrawListContext.h>
+#include <Atom/RHI.Reflect/BufferScopeAttachmentDescriptor.h>
 
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/Pass/Pass.h>
@@ -18,6 +19,7 @@
 
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/Name/Name.h>
 
@@ -57,6 +59,16 @@ namespace AZ
                 UsageReflectiveCubeMap = (1u << 2),
                 UsageXR = (1u << 3)
             };
+
+            //! A buffer written on the GPU earlier in the frame that draw items submitted to this view read from,
+            //! such as GPU culled instance lists or indirect draw arguments.
+            struct DrawBufferAttachment
+            {
+                RHI::BufferScopeAttachmentDescriptor m_descriptor;
+                RHI::ScopeAttachmentUsage m_usage = RHI::ScopeAttachmentUsage::Shader;
+                RHI::ScopeAttachmentStage m_stage = RHI::ScopeAttachmentStage::VertexShader;
+            };
+
             //! Only use this function to create a new view object. And force using smart pointer to manage view's life time
             static ViewPtr CreateView(const AZ::Name& name, UsageFlags usage);
 
@@ -91,6 +103,19 @@ namespace AZ
             //! Add a draw item to this view with its associated draw list tag
             void AddDrawItem(RHI::DrawListTag drawListTag, const RHI::DrawItemProperties& drawItemProperties);
 
+            //! Sets the cullable flags that mark a cullable as dynamic for this view (see Cullable::m_flags). When any are set, the draw
+            //! packets of dynamic cullables are added to separate draw lists, returned by GetDynamicDrawList(), so passes can render
+            //! the static and the dynamic objects of the view separately. A value of 0 (the default) keeps all draws in GetDrawList().
+            void SetDynamicCullableFlags(uint32_t flags);
+            uint32_t GetDynamicCullableFlags() const;
+
+            //! Returns true if a cullable with these flags goes to the dynamic draw lists of this view.
+            bool IsDynamicCullable(uint32_t cullableFlags) const;
+
+            //! Same as AddDrawPacket(), but adds the draw items to the dynamic draw lists if this view separates them.
+            //! This function is thread safe.
+            void AddDynamicDrawPacket(const RHI::DrawPacket* drawPacket, const Vector3& worldPosition);
+
             //! Applies some flags to the view that are reset each frame. The provided flags are combined with m_andFlags
             //! using &, and are combined with m_orFlags using |.
             void ApplyFlags(uint32_t flags);
@@ -107,6 +132,13 @@ namespace AZ
             //! Returns the boolean | combination of all flags provided with ApplyFlags() since the last frame.
             uint32_t GetOrFlags() const;
 
+            //! Same as ApplyFlags() for the flags of an object in the dynamic draw lists, which are left out of GetStaticOrFlags().
+            void ApplyDynamicFlags(uint32_t flags);
+
+            //! Returns the boolean | combination of the flags provided with ApplyFlags() since the last frame, without the ones
+            //! provided with ApplyDynamicFlags(). This tells if any of the static objects of the view changed.
+            uint32_t GetStaticOrFlags() const;
+
             //! Sets the worldToView matrix and recalculates the other matrices.
             void SetWorldToViewMatrix(const AZ::Matrix4x4& worldToView);
 
@@ -154,6 +186,9 @@ namespace AZ
             RHI::DrawListView GetDrawList(RHI::DrawListTag drawListTag);
             VisibleObjectListView GetVisibleObjectList();
 
+            //! Returns the draw list of the dynamic objects, which is empty unless the view separates them, see SetDynamicCullableFlags().
+            RHI::DrawListView GetDynamicDrawList(RHI::DrawListTag drawListTag);
+
             //! Helper function to generate a sort key from a given position in world
             RHI::DrawItemSortKey GetSortKeyForPosition(const Vector3& positionInWorld) const;
 
@@ -188,11 +223,19 @@ namespace AZ
             //! Accessors for shadow pass render pipeline id.
             void SetShadowPassRenderPipelineId(const RenderPipelineId renderPipelineId);
             RenderPipelineId GetShadowPassRenderPipelineId() const;
+
+            //! Sets the GPU written buffers that this view's draw items read from. Raster passes rendering the view declare them
+            //! to the frame graph, so they are synchronized with the passes that write them. Replaces any previous attachments.
+            void SetDrawBufferAttachments(AZStd::span<const DrawBufferAttachment> attachments);
+            AZStd::span<const DrawBufferAttachment> GetDrawBufferAttachments() const;
             
         private:
             View() = delete;
             View(const AZ::Name& name, UsageFlags usage);
 
+            //! Finalizes and sorts the dynamic draw lists, if this view separates them
+            void FinalizeDynamicDrawLists();
+
             //! Sorts the finalized draw lists in this view
             void SortFinalizedDrawListsJob(AZ::Job* parentJob);
             void SortFinalizedDrawListsTG(AZ::TaskGraphEvent& finalizeDrawListsTGEvent);
@@ -231,6 +274,10 @@ namespace AZ
             RHI::DrawListContext m_drawListContext;
             RHI::DrawListMask m_drawListMask;
 
+            // The draw lists of the dynamic cullables, only initialized when m_dynamicCullableFlags is set.
+            RHI::DrawListContext m_dynamicDrawListContext;
+            uint32_t m_dynamicCullableFlags = 0;
+
             RPI::VisibleObjectContext m_visibleObjectContext;
 
             Matrix4x4 m_worldToViewMatrix;
@@ -271,9 +318,13 @@ namespace AZ
 
             AZStd::atomic_uint32_t m_andFlags{ 0xFFFFFFFF };
             AZStd::atomic_uint32_t m_orFlags { 0x00000000 };
+            AZStd::atomic_uint32_t m_staticOrFlags { 0x00000000 };
 
             // Get the render pipeline id associated with this view if used as a shadow light view.
             RenderPipelineId m_shadowPassRenderpipelineId;
+
+            // GPU written buffers read by the draw items of this view
+            AZStd::vector<DrawBufferAttachment> m_drawBufferAttachments;
         };
 
         AZ_DEFINE_ENUM_BITWISE_OPERATORS(View::UsageFlags);
@@ -416,6 +416,9 @@ namespace AZ
             void Process(MaterialFunctorAPI::PipelineRuntimeContext& context) override;
             void Process(MaterialFunctorAPI::EditorContext& context) override;
 
+            //! Every Lua functor runs in the same global script context.
+            bool CanProcessConcurrently() const override { return false; }
+
         private:
 
             // Registers functions in a BehaviorContext so they can be exposed to Lua scripts.
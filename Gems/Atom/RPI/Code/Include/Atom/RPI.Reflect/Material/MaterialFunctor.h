@@ -322,6 +322,10 @@ namespace AZ
             //! based on some internal material property values.
             virtual void Process([[maybe_unused]] MaterialFunctorAPI::PipelineRuntimeContext& context) {}
 
+            //! Returns whether Process can run for several materials at the same time. Functors that keep state across the
+            //! materials that use them must return false, so the material system compiles those materials serially.
+            virtual bool CanProcessConcurrently() const { return true; }
+
         private:
 
             //! The material properties associated with this functor.
@@ -58,6 +58,10 @@ namespace AZ
             //! Marks all properties as not dirty.
             void ClearAllPropertyDirtyFlags();
 
+            //! Marks the dirty properties whose value is the same as in @previousValues as not dirty, so nothing processes a value
+            //! again that was already processed. @previousValues must have a value for each property of the layout.
+            void ClearUnchangedPropertyDirtyFlags(const AZStd::vector<MaterialPropertyValue>& previousValues);
+
             //! Gets the material properties layout.
             RHI::ConstPtr<MaterialPropertiesLayout> GetMaterialPropertiesLayout() const;
 
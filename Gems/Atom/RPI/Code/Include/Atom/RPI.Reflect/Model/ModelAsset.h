@@ -74,6 +74,14 @@ namespace AZ
             //! When the ref count reaches 0 after the reduce, it would release all the BufferAssets from the ModelAsset
             void ReleaseRefBufferAssets();
 
+            //! Queues the loads of the BufferAssets of a lod without blocking, for the lods a Model streams in.
+            //! Returns Ready once they are all loaded, or Error if one of them failed to load.
+            Data::AssetData::AssetStatus QueueLoadLodBufferAssets(size_t lodIndex);
+
+            //! Releases the BufferAssets of a lod once a Model uploaded them, unless AddRefBufferAssets() keeps the BufferAssets
+            //! of the model in memory.
+            void ReleaseLodBufferAssets(size_t lodIndex);
+
             //! Returns true if the ModelAsset contains data which is required by LocalRayIntersectionAgainstModel() function.
             bool SupportLocalRayIntersection() const;
 
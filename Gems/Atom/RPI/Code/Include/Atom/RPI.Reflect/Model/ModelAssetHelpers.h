@@ -27,6 +27,8 @@ namespace AZ
             static constexpr AZ::RHI::Format PositionFormat = AZ::RHI::Format::R32G32B32_FLOAT;
             static constexpr AZ::RHI::Format NormalFormat = AZ::RHI::Format::R32G32B32_FLOAT;
             static constexpr AZ::RHI::Format UVFormat = AZ::RHI::Format::R32G32_FLOAT;
+            // Optional half float UVs, see /O3DE/SceneAPI/ModelBuilder/QuantizeUVs. The input assembler converts them back to float.
+            static constexpr AZ::RHI::Format QuantizedUVFormat = AZ::RHI::Format::R16G16_FLOAT;
             static constexpr AZ::RHI::Format ColorFormat = AZ::RHI::Format::R32G32B32A32_FLOAT;
             static constexpr AZ::RHI::Format BitangentFormat = AZ::RHI::Format::R32G32B32_FLOAT;
             // The 4th channel is used to indicate handedness of the bitangent, either 1 or -1.
@@ -17,6 +17,7 @@
 #include <Atom/RPI.Reflect/Buffer/BufferAsset.h>
 #include <Atom/RPI.Reflect/Material/MaterialAsset.h>
 #include <Atom/RPI.Reflect/Model/ModelMaterialSlot.h>
+#include <Atom/RPI.Reflect/Model/ModelMeshlets.h>
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Math/Aabb.h>
@@ -122,6 +123,13 @@ namespace AZ
                 template<class T>
                 AZStd::span<const T> GetSemanticBufferTyped(const AZ::Name& semantic) const;
 
+                //! Returns the buffer of MeshletCluster the model builder generated for this mesh. It has no buffer asset if
+                //! meshlet generation was disabled when the model was built.
+                const BufferAssetView& GetMeshletClusterBufferAssetView() const;
+
+                //! Returns the meshlet clusters of this mesh, or an empty span if it has none.
+                AZStd::span<const MeshletCluster> GetMeshletClusters() const;
+
             private:
                 template<class T>
                 AZStd::span<const T> GetBufferTyped(const BufferAssetView& bufferAssetView) const;
@@ -147,6 +155,9 @@ namespace AZ
                 // expected that the user calls GetStreamBufferInfo with the required semantics
                 // and pieces the layout together themselves.
                 AZStd::fixed_vector<StreamBufferInfo, RHI::Limits::Pipeline::StreamCountMax> m_streamBufferInfo;
+
+                // Optional clusters of the triangles of the index buffer, unique to the mesh
+                BufferAssetView m_meshletClusterBufferAssetView;
             };
 
             //! Returns an array view into the collection of meshes owned by this lod
@@ -175,6 +186,9 @@ namespace AZ
             // Load/release all BufferAssets used by this ModelLodAsset
             void LoadBufferAssets();
             void ReleaseBufferAssets();
+
+            // Queues the loads of all BufferAssets used by this ModelLodAsset without blocking, and returns their combined status
+            Data::AssetData::AssetStatus QueueLoadBufferAssets();
             
             AZStd::vector<Mesh> m_meshes;
             AZ::Aabb m_aabb = AZ::Aabb::CreateNull();
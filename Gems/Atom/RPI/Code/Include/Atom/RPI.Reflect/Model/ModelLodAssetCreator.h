@@ -54,6 +54,10 @@ namespace AZ
             //! Begin and BeginMesh must be called first
             void SetMeshIndexBuffer(const BufferAssetView& bufferAssetView);
 
+            //! Sets the buffer of MeshletCluster of the current SubMesh, see ModelLodAsset::Mesh::GetMeshletClusters.
+            //! Begin and BeginMesh must be called first
+            void SetMeshMeshletClusters(const BufferAssetView& bufferAssetView);
+
             //! Adds a BufferAssetView to the current SubMesh as a stream buffer that matches the given semantic name.
             //! Begin and BeginMesh must be called first
             bool AddMeshStreamBuffer(
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A cluster of triangles of a mesh (a meshlet) with the bounds used to cull it. The triangles of a cluster are a contiguous
+        //! range of the mesh's index buffer. The clusters are stored in a structured buffer of the mesh, so they can be read by shaders.
+        struct MeshletCluster
+        {
+            //! Model space center and radius of a sphere that bounds the cluster
+            float m_boundingSphere[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+            //! The normal cone of the cluster: every triangle faces away from a camera for which
+            //! dot(normalize(m_coneApex - cameraPosition), m_coneAxis) >= m_coneCutoff, see IsMeshletClusterBackfacing.
+            float m_coneApex[3] = { 0.0f, 0.0f, 0.0f };
+            float m_coneCutoff = 1.0f;
+            float m_coneAxis[3] = { 0.0f, 0.0f, 0.0f };
+
+            //! The range of the cluster in the mesh's index buffer
+            uint32_t m_firstIndex = 0;
+            uint32_t m_indexCount = 0;
+
+            uint32_t m_pad[3] = { 0, 0, 0 };
+        };
+        static_assert(sizeof(MeshletCluster) == 64, "MeshletCluster is stored as 16 byte aligned structured buffer elements");
+
+        namespace MeshletUtils
+        {
+            static constexpr uint32_t DefaultMaxVertexCount = 64;
+            static constexpr uint32_t DefaultMaxTriangleCount = 124;
+
+            //! Splits a triangle list into clusters of at most maxVertexCount unique vertices and maxTriangleCount triangles,
+            //! keeping the order of the triangles so each cluster is a contiguous range of the index buffer.
+            //! @param indices The triangle list, indexing positions.
+            //! @param positions The model space positions of the vertices, 3 floats per vertex.
+            //! @return false if the indices aren't a triangle list or index out of the positions.
+            bool BuildMeshletClusters(
+                AZStd::span<const uint32_t> indices,
+                AZStd::span<const float> positions,
+                AZStd::vector<MeshletCluster>& clusters,
+                uint32_t maxVertexCount = DefaultMaxVertexCount,
+                uint32_t maxTriangleCount = DefaultMaxTriangleCount);
+
+            //! Returns true if every triangle of the cluster faces away from the camera, with both in the same space.
+            bool IsMeshletClusterBackfacing(const MeshletCluster& cluster, const Vector3& cameraPosition);
+        } // namespace MeshletUtils
+    } // namespace RPI
+} // namespace AZ
@@ -40,6 +40,10 @@ namespace AZ
 
             // Whether the pass should use async compute and run on the compute hardware queue.
             bool m_useAsyncCompute = false;
+
+            // Whether the frame graph compiler may move the pass to the compute hardware queue when it only uses its attachments
+            // from compute shaders and can overlap with independent graphics work. Ignored when m_useAsyncCompute is set.
+            bool m_allowAsyncCompute = false;
         };
     } // namespace RPI
 } // namespace AZ
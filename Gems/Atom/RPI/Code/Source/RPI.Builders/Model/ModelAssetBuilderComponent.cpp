@@ -48,6 +48,8 @@
 #include <SceneAPI/SceneCore/Containers/Utilities/Filters.h>
 
 static constexpr AZStd::string_view MismatchedVertexLayoutsAreErrorsKey{ "/O3DE/SceneAPI/ModelBuilder/MismatchedVertexLayoutsAreErrors" };
+static constexpr AZStd::string_view GenerateMeshletsKey{ "/O3DE/SceneAPI/ModelBuilder/GenerateMeshlets" };
+static constexpr AZStd::string_view QuantizeUVsKey{ "/O3DE/SceneAPI/ModelBuilder/QuantizeUVs" };
  /**
   * DEBUG DEFINES!
   * These are useful for debugging bad behavior from the builder.
@@ -80,15 +82,71 @@ namespace AZ
             return mismatchedVertexStreamsAreErrors;
         }
 
+        static bool GenerateMeshlets()
+        {
+            bool generateMeshlets = false;
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+            {
+                settingsRegistry->Get(generateMeshlets, GenerateMeshletsKey);
+            }
+            return generateMeshlets;
+        }
+
+        //! Stores the UVs as half floats, which halves the size of the UV streams.
+        //! Half floats keep about 3 decimal digits, which is enough for UVs in the [-2, 2] range on textures up to 2048 texels.
+        static bool QuantizeUVs()
+        {
+            bool quantizeUVs = false;
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+            {
+                settingsRegistry->Get(quantizeUVs, QuantizeUVsKey);
+            }
+            return quantizeUVs;
+        }
+
+        static uint16_t ConvertFloatToHalf(const float value)
+        {
+            uint32_t result;
+
+            uint32_t uiValue = ((uint32_t*)(&value))[0];
+            uint32_t sign = (uiValue & 0x80000000U) >> 16U; // Sign shifted two bytes right for combining with return
+            uiValue = uiValue & 0x7FFFFFFFU; // Hack off the sign
+
+            if (uiValue > 0x47FFEFFFU)
+            {
+                // The number is too large to be represented as a half.  Saturate to infinity.
+                result = 0x7FFFU;
+            }
+            else
+            {
+                if (uiValue < 0x38800000U)
+                {
+                    // The number is too small to be represented as a normalized half.
+                    // Convert it to a denormalized value.
+                    uint32_t shift = 113U - (uiValue >> 23U);
+                    uiValue = (0x800000U | (uiValue & 0x7FFFFFU)) >> shift;
+                }
+                else
+                {
+                    // Rebias the exponent to represent the value as a normalized half.
+                    uiValue += 0xC8000000U;
+                }
+                result = ((uiValue + 0x0FFFU + ((uiValue >> 13U) & 1U)) >> 13U) & 0x7FFFU;
+            }
+            // Add back sign and return
+            return static_cast<uint16_t>(result | sign);
+        }
+
         void ModelAssetBuilderComponent::Reflect(ReflectContext* context)
         {
             if (auto* serialize = azrtti_cast<SerializeContext*>(context))
             {
                 serialize->Class<ModelAssetBuilderComponent, SceneAPI::SceneCore::ExportingComponent>()
-                    ->Version(39);
+                    ->Version(40);
 
                 // v38 - Pad Skinning mesh buffers to respect appropriate alignment
                 // v39 - Automatically generate missing skinning data when skinned and unskinned data is mixed
+                // v40 - Optionally generate meshlet clusters
             }
         }
 
@@ -391,6 +449,8 @@ namespace AZ
                 }
             }
 
+            const bool generateMeshlets = GenerateMeshlets();
+
             uint32_t lodIndex = 0;
             for (const SourceMeshContentList& sourceMeshContentList : sourceMeshContentListsByLod)
             {
@@ -505,6 +565,19 @@ namespace AZ
                     m_meshName = "";
                     ProductMeshViewList lodMeshViews;
 
+                    // The clusters are built from each mesh's own indices and positions, before they are merged into the lod buffers
+                    AZStd::vector<BufferAssetView> meshletClusterBuffers(lodMeshes.size());
+                    if (generateMeshlets)
+                    {
+                        for (uint32_t meshIndex = 0; meshIndex < lodMeshes.size(); ++meshIndex)
+                        {
+                            if (!CreateMeshletClusterBuffer(lodMeshes[meshIndex], meshIndex, meshletClusterBuffers[meshIndex]))
+                            {
+                                return AZ::SceneAPI::Events::ProcessingResult::Failure;
+                            }
+                        }
+                    }
+
                     ProductMeshContent mergedMesh;
                     MergeMeshesToCommonBuffers(lodMeshes, mergedMesh, lodMeshViews);
 
@@ -524,9 +597,11 @@ namespace AZ
                         return AZ::SceneAPI::Events::ProcessingResult::Failure;
                     }
 
-                    for (const ProductMeshView& meshView : lodMeshViews)
+                    for (size_t meshIndex = 0; meshIndex < lodMeshViews.size(); ++meshIndex)
                     {
-                        if (!CreateMesh(meshView, indexBuffer, streamBuffers, modelAssetCreator, lodAssetCreator, context.m_materialsByUid))
+                        if (!CreateMesh(
+                                lodMeshViews[meshIndex], indexBuffer, streamBuffers, modelAssetCreator, lodAssetCreator,
+                                context.m_materialsByUid, meshletClusterBuffers[meshIndex]))
                         {
                             return AZ::SceneAPI::Events::ProcessingResult::Failure;
                         }
@@ -548,7 +623,15 @@ namespace AZ
                             return AZ::SceneAPI::Events::ProcessingResult::Failure;
                         }
 
-                        if (!CreateMesh(meshView, indexBuffer, streamBuffers, modelAssetCreator, lodAssetCreator, context.m_materialsByUid))
+                        BufferAssetView meshletClusterBuffer;
+                        if (generateMeshlets && !CreateMeshletClusterBuffer(mesh, meshIndex - 1, meshletClusterBuffer))
+                        {
+                            return AZ::SceneAPI::Events::ProcessingResult::Failure;
+                        }
+
+                        if (!CreateMesh(
+                                meshView, indexBuffer, streamBuffers, modelAssetCreator, lodAssetCreator, context.m_materialsByUid,
+                                meshletClusterBuffer))
                         {
                             return AZ::SceneAPI::Events::ProcessingResult::Failure;
                         }
@@ -2193,9 +2276,26 @@ namespace AZ
                 }
             }
             
+            // Skinning, morph targets and cloth read the UVs of the model on the CPU or in compute shaders as floats
+            const bool quantizeUVs = QuantizeUVs() && lodBufferContent.m_skinJointIndices.empty() &&
+                lodBufferContent.m_morphTargetVertexData.empty() && clothData.empty();
             for (size_t i = 0; i < uvSets.size(); ++i)
             {
-                if (!BuildTypedStreamBuffer<float>(outStreamBuffers, uvSets[i], UVFormat, RHI::ShaderSemantic{"UV", i}, uvCustomNames[i]))
+                if (quantizeUVs)
+                {
+                    AZStd::vector<uint16_t> quantizedUVs;
+                    quantizedUVs.reserve(uvSets[i].size());
+                    for (float uv : uvSets[i])
+                    {
+                        quantizedUVs.push_back(ConvertFloatToHalf(uv));
+                    }
+
+                    if (!BuildTypedStreamBuffer<uint16_t>(outStreamBuffers, quantizedUVs, QuantizedUVFormat, RHI::ShaderSemantic{"UV", i}, uvCustomNames[i]))
+                    {
+                        return false;
+                    }
+                }
+                else if (!BuildTypedStreamBuffer<float>(outStreamBuffers, uvSets[i], UVFormat, RHI::ShaderSemantic{"UV", i}, uvCustomNames[i]))
                 {
                     return false;
                 }
@@ -2260,7 +2360,8 @@ namespace AZ
             const AZStd::vector<ModelLodAsset::Mesh::StreamBufferInfo>& lodStreamBuffers,
             ModelAssetCreator& modelAssetCreator,
             ModelLodAssetCreator& lodAssetCreator,
-            const MaterialAssetsByUid& materialAssetsByUid)
+            const MaterialAssetsByUid& materialAssetsByUid,
+            const BufferAssetView& meshletClusterBuffer)
         {
             lodAssetCreator.BeginMesh();
             
@@ -2286,6 +2387,11 @@ namespace AZ
 
             lodAssetCreator.SetMeshIndexBuffer(AZStd::move(indexBufferAssetView));
 
+            if (meshletClusterBuffer.GetBufferAsset())
+            {
+                lodAssetCreator.SetMeshMeshletClusters(meshletClusterBuffer);
+            }
+
             {
                 // Build the mesh's Aabb
                 ModelLodAsset::Mesh::StreamBufferInfo positionStreamBufferInfo;
@@ -2328,7 +2434,17 @@ namespace AZ
             // Set UV buffers
             for (size_t i = 0; i < meshView.m_uvSetViews.size(); ++i)
             {
-                if (!SetMeshStreamBufferById(RHI::ShaderSemantic{"UV", i}, meshView.m_uvCustomNames[i], meshView.m_uvSetViews[i], lodStreamBuffers, lodAssetCreator))
+                // The mesh views are made for float UVs, use the format of the UV buffer in case it was quantized.
+                // The element offset and count are in vertices so they don't change.
+                RHI::BufferViewDescriptor uvSetView = meshView.m_uvSetViews[i];
+                ModelLodAsset::Mesh::StreamBufferInfo uvStreamBufferInfo;
+                if (FindStreamBufferById(lodStreamBuffers, RHI::ShaderSemantic{"UV", i}, uvStreamBufferInfo))
+                {
+                    uvSetView.m_elementFormat = uvStreamBufferInfo.m_bufferAssetView.GetBufferViewDescriptor().m_elementFormat;
+                    uvSetView.m_elementSize = RHI::GetFormatSize(uvSetView.m_elementFormat);
+                }
+
+                if (!SetMeshStreamBufferById(RHI::ShaderSemantic{"UV", i}, meshView.m_uvCustomNames[i], uvSetView, lodStreamBuffers, lodAssetCreator))
                 {
                     return false;
                 }
@@ -2397,6 +2513,38 @@ namespace AZ
             return true;
         }
 
+        bool ModelAssetBuilderComponent::CreateMeshletClusterBuffer(
+            const ProductMeshContent& mesh, uint32_t meshIndex, BufferAssetView& outMeshletClusterBuffer)
+        {
+            AZStd::vector<MeshletCluster> clusters;
+            if (!MeshletUtils::BuildMeshletClusters(mesh.m_indices, mesh.m_positions, clusters))
+            {
+                AZ_Error(s_builderName, false, "Failed to build the meshlet clusters of mesh '%s'.", mesh.m_name.GetCStr());
+                return false;
+            }
+
+            if (clusters.empty())
+            {
+                return true;
+            }
+
+            Outcome<Data::Asset<BufferAsset>> bufferOutcome = CreateStructuredBufferAsset(
+                clusters.data(), clusters.size(), sizeof(MeshletCluster), AZStd::string::format("meshletClusters%u", meshIndex));
+            if (!bufferOutcome.IsSuccess())
+            {
+                AZ_Error(s_builderName, false, "Failed to create the meshlet cluster buffer of mesh '%s'.", mesh.m_name.GetCStr());
+                return false;
+            }
+
+            outMeshletClusterBuffer = BufferAssetView(bufferOutcome.GetValue(), bufferOutcome.GetValue()->GetBufferViewDescriptor());
+
+            if (AZ::SceneAPI::Utilities::IsDebugEnabled())
+            {
+                AZ_Info(s_builderName, "         # Meshlet clusters: %zu\n", clusters.size());
+            }
+            return true;
+        }
+
         Outcome<Data::Asset<BufferAsset>> ModelAssetBuilderComponent::CreateTypedBufferAsset(
             const void* data, const size_t elementCount, RHI::Format format, const AZStd::string& bufferName)
         {
@@ -317,7 +317,15 @@ namespace AZ
                 const AZStd::vector<ModelLodAsset::Mesh::StreamBufferInfo>& lodStreamBuffers,
                 ModelAssetCreator& modelAssetCreator,
                 ModelLodAssetCreator& lodAssetCreator,
-                const MaterialAssetsByUid& materialAssetsByUid);
+                const MaterialAssetsByUid& materialAssetsByUid,
+                const BufferAssetView& meshletClusterBuffer);
+
+            //! Splits the triangles of a mesh into meshlet clusters and creates the buffer of their MeshletCluster data.
+            //! Leaves outMeshletClusterBuffer empty if the mesh has no triangles.
+            //! 
+            //! Returns false if an error occurs
+            bool CreateMeshletClusterBuffer(
+                const ProductMeshContent& mesh, uint32_t meshIndex, BufferAssetView& outMeshletClusterBuffer);
 
             //! Takes in a pointer to data with a given element count and format and creates a BufferAsset.
             Outcome<Data::Asset<BufferAsset>> CreateTypedBufferAsset(
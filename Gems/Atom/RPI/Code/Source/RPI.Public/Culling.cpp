@@ -9,20 +9,27 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/Model.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/View.h>
+#include <Atom/RPI.Reflect/Model/ModelAsset.h>
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/smart_ptr/weak_ptr.h>
 #include <AzFramework/Visibility/OcclusionBus.h>
 
 #include <Atom_RPI_Traits_Platform.h>
@@ -57,6 +64,23 @@ namespace AZ
         // Default is set to -1 as this is optimization needs to be triggered by the content developer by setting a reasonable non-negative value applicable for their content. 
         AZ_CVAR(int, r_shadowCascadeExtrusionAmount, -1, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount of meters to extrude the Obb towards light direction when doing frustum overlap test against camera frustum");
 
+        // Views whose frustums don't change between frames, like shadow cascades of a static camera, only re-test the cullables that
+        // were updated since the previous frame instead of traversing the visibility scene.
+        AZ_CVAR(bool, r_cullingPersistentVisibility, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Cache the cullables inside each view's frustums between frames, and only re-test the ones that were updated while the frustums stay the same");
+
+        // The eyes of a stereo camera see nearly the same objects, so the first eye is culled against a frustum enclosing both,
+        // and its visible objects are added to the other eye with the same lods, instead of traversing the visibility scene twice.
+        AZ_CVAR(bool, r_cullingShareStereoViews, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Cull the two views of a stereo camera once, against a frustum enclosing both");
+
+        // Views further apart than this aren't the eyes of the same camera
+        static constexpr float MaxSharedCullingViewDistance = 0.5f;
+
+        // Occluders are rasterized into the software occlusion buffer of the camera views, closest first. Only the occluders
+        // covering a large part of the screen hide enough cullables to be worth their rasterization cost.
+        AZ_CVAR(bool, r_occluders, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Rasterize the occluder meshes into the software occlusion buffer of the camera views");
+        AZ_CVAR(float, r_occluderMinScreenSize, 0.1f, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum ratio of the bounding sphere diameter of an occluder to its distance from the camera for it to be rasterized");
+        AZ_CVAR(uint32_t, r_occluderMaxCount, 64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of occluders rasterized for each view");
+
 
 #ifdef AZ_CULL_DEBUG_ENABLED
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
@@ -133,6 +157,12 @@ namespace AZ
             // the culling system starts Enumerating, so use soft_lock_shared here
             m_cullDataConcurrencyCheck.soft_lock_shared();
             m_visScene->InsertOrUpdateEntry(cullable.m_cullData.m_visibilityEntry);
+            if (cullable.m_cullingUpdateFrame != m_cullingFrame)
+            {
+                cullable.m_cullingUpdateFrame = m_cullingFrame;
+                AZStd::lock_guard<AZStd::mutex> lock(m_updatedCullablesMutex);
+                m_pendingUpdatedCullables.push_back(&cullable);
+            }
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
@@ -145,9 +175,120 @@ namespace AZ
             // the culling system starts Enumerating, so use soft_lock_shared here
             m_cullDataConcurrencyCheck.soft_lock_shared();
             m_visScene->RemoveEntry(cullable.m_cullData.m_visibilityEntry);
+            cullable.m_cullingUpdateFrame = AZStd::numeric_limits<uint64_t>::max();
+            m_pendingCullableRemoved = true;
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
+        void CullingScene::RegisterOrUpdateOccluder(Occluder& occluder)
+        {
+            AZ_Assert(occluder.m_geometry, "Occluder needs a geometry");
+            m_cullDataConcurrencyCheck.soft_lock_shared();
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_occludersMutex);
+                if (occluder.m_occluderIndex >= m_occluders.size())
+                {
+                    occluder.m_occluderIndex = m_occluders.size();
+                    m_occluders.push_back(&occluder);
+                }
+            }
+            m_cullDataConcurrencyCheck.soft_unlock_shared();
+        }
+
+        void CullingScene::UnregisterOccluder(Occluder& occluder)
+        {
+            m_cullDataConcurrencyCheck.soft_lock_shared();
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_occludersMutex);
+                if (occluder.m_occluderIndex < m_occluders.size())
+                {
+                    AZ_Assert(m_occluders[occluder.m_occluderIndex] == &occluder, "Occluder was registered with another CullingScene");
+                    m_occluders[occluder.m_occluderIndex] = m_occluders.back();
+                    m_occluders[occluder.m_occluderIndex]->m_occluderIndex = occluder.m_occluderIndex;
+                    m_occluders.pop_back();
+                    occluder.m_occluderIndex = AZStd::numeric_limits<size_t>::max();
+                }
+            }
+            m_cullDataConcurrencyCheck.soft_unlock_shared();
+        }
+
+        AZStd::shared_ptr<const OccluderGeometry> CullingScene::FindOrCreateOccluderGeometry(const Data::Asset<ModelAsset>& modelAsset)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_occludersMutex);
+            auto& [geometryModelAsset, cachedGeometry] = m_occluderGeometries[modelAsset.GetId()];
+            if (geometryModelAsset == modelAsset.Get())
+            {
+                if (AZStd::shared_ptr<const OccluderGeometry> geometry = cachedGeometry.lock())
+                {
+                    return geometry;
+                }
+            }
+
+            if (!modelAsset.IsReady() || modelAsset->GetLodAssets().empty())
+            {
+                return nullptr;
+            }
+
+            // The least detailed lod is a good enough occluder, and cheaper to rasterize
+            static const AZ::Name PositionName{ "POSITION" };
+            const Data::Asset<ModelLodAsset>& lodAsset = modelAsset->GetLodAssets().back();
+            if (!lodAsset.IsReady())
+            {
+                return nullptr;
+            }
+
+            AZStd::shared_ptr<OccluderGeometry> geometry = AZStd::make_shared<OccluderGeometry>();
+            for (const ModelLodAsset::Mesh& mesh : lodAsset->GetMeshes())
+            {
+                const BufferAssetView* positionBufferView = mesh.GetSemanticBufferAssetView(PositionName);
+                const BufferAssetView& indexBufferView = mesh.GetIndexBufferAssetView();
+                if (!positionBufferView || !positionBufferView->GetBufferAsset().IsReady() || !indexBufferView.GetBufferAsset().IsReady())
+                {
+                    AZ_Warning("CullingScene", false, "Occluder model '%s' isn't in memory", modelAsset.GetHint().c_str());
+                    return nullptr;
+                }
+
+                const RHI::BufferViewDescriptor& positionDesc = positionBufferView->GetBufferViewDescriptor();
+                const RHI::BufferViewDescriptor& indexDesc = indexBufferView.GetBufferViewDescriptor();
+                const AZStd::span<const uint8_t> positionBuffer = positionBufferView->GetBufferAsset()->GetBuffer();
+                const AZStd::span<const uint8_t> indexBuffer = indexBufferView.GetBufferAsset()->GetBuffer();
+                if (positionDesc.m_elementSize != sizeof(float) * 3 || (indexDesc.m_elementSize != sizeof(uint32_t) && indexDesc.m_elementSize != sizeof(uint16_t)) ||
+                    positionBuffer.size() < (positionDesc.m_elementOffset + positionDesc.m_elementCount) * positionDesc.m_elementSize ||
+                    indexBuffer.size() < (indexDesc.m_elementOffset + indexDesc.m_elementCount) * indexDesc.m_elementSize)
+                {
+                    AZ_Warning("CullingScene", false, "Occluder model '%s' doesn't have 3 floats positions", modelAsset.GetHint().c_str());
+                    return nullptr;
+                }
+
+                const uint32_t firstVertex = aznumeric_cast<uint32_t>(geometry->m_positions.size() / 3);
+                const float* positions = reinterpret_cast<const float*>(positionBuffer.data() + positionDesc.m_elementOffset * positionDesc.m_elementSize);
+                geometry->m_positions.insert(geometry->m_positions.end(), positions, positions + positionDesc.m_elementCount * 3);
+
+                const uint8_t* indices = indexBuffer.data() + indexDesc.m_elementOffset * indexDesc.m_elementSize;
+                for (uint32_t index = 0; index < indexDesc.m_elementCount - indexDesc.m_elementCount % 3; ++index)
+                {
+                    const uint32_t vertexIndex = indexDesc.m_elementSize == sizeof(uint32_t)
+                        ? reinterpret_cast<const uint32_t*>(indices)[index]
+                        : reinterpret_cast<const uint16_t*>(indices)[index];
+                    if (vertexIndex >= positionDesc.m_elementCount)
+                    {
+                        AZ_Warning("CullingScene", false, "Occluder model '%s' has a bad vertex index", modelAsset.GetHint().c_str());
+                        return nullptr;
+                    }
+                    geometry->m_indices.push_back(firstVertex + vertexIndex);
+                }
+            }
+
+            if (geometry->m_indices.empty())
+            {
+                return nullptr;
+            }
+
+            geometryModelAsset = modelAsset.Get();
+            cachedGeometry = geometry;
+            return geometry;
+        }
+
         uint32_t CullingScene::GetNumCullables() const
         {
             return m_visScene->GetEntryCount();
@@ -209,6 +350,8 @@ namespace AZ
             const Scene* m_scene = nullptr;
             AzFramework::EntityContextId m_sceneEntityContextId;
             View* m_view = nullptr;
+            // View culled along with m_view, which gets the same visible objects
+            View* m_sharedView = nullptr;
             Frustum m_frustum;
             Frustum m_cameraFrustum;
             Frustum m_excludeFrustum;
@@ -216,6 +359,8 @@ namespace AZ
             AZ::TaskGraphEvent* m_taskGraphEvent = nullptr;
             bool m_hasExcludeFrustum = false;
             bool m_applyCameraFrustumIntersectionTest = false;
+            // When set, the cullables that pass the frustum tests are recorded for the next frame
+            ViewVisibilityCache* m_visibilityCache = nullptr;
 #ifdef AZ_CULL_DEBUG_ENABLED
 
             AuxGeomDrawPtr GetAuxGeomPtr()
@@ -248,6 +393,47 @@ namespace AZ
             return worklistData;
         }
 
+        // Returns the frustum of the view, with each plane moved out until the corners of the shared view's frustum are inside it,
+        // so it encloses the frustums of both views
+        static Frustum CreateSharedCullingFrustum(const View& view, const View& sharedView)
+        {
+            Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view.GetWorldToClipMatrix());
+
+            const Matrix4x4& clipToWorld = sharedView.GetClipToWorldMatrix();
+            AZStd::fixed_vector<Vector3, 8> corners;
+            for (float x : { -1.0f, 1.0f })
+            {
+                for (float y : { -1.0f, 1.0f })
+                {
+                    for (float z : { 0.0f, 1.0f })
+                    {
+                        // The far corners of an infinite projection are at infinity, the far plane can't be moved past them
+                        const Vector4 corner = clipToWorld * Vector4(x, y, z, 1.0f);
+                        if (AZStd::abs(corner.GetW()) > AZ::Constants::FloatEpsilon)
+                        {
+                            corners.push_back(corner.GetHomogenized());
+                        }
+                    }
+                }
+            }
+
+            for (int planeId = 0; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                Plane plane = frustum.GetPlane(static_cast<Frustum::PlaneId>(planeId));
+                float minDistance = 0.0f;
+                for (const Vector3& corner : corners)
+                {
+                    minDistance = AZStd::min(minDistance, plane.GetPointDist(corner));
+                }
+                if (minDistance < 0.0f)
+                {
+                    plane.SetDistance(plane.GetDistance() - minDistance);
+                    frustum.SetPlane(static_cast<Frustum::PlaneId>(planeId), plane);
+                }
+            }
+            return frustum;
+        }
+
         // Used to accumulate NodeData into lists to be handed off to jobs for processing
         struct WorkListType
         {
@@ -271,6 +457,70 @@ namespace AZ
         static bool TestOcclusionCulling(
             const AZStd::shared_ptr<WorklistData>& worklistData, const AzFramework::VisibilityEntry* visibleEntry);
 
+        static bool IsCullableInFrustums(const AZStd::shared_ptr<WorklistData>& worklistData, const Cullable* c, bool parentNodeContainedInFrustum)
+        {
+            if (!parentNodeContainedInFrustum)
+            {
+                IntersectResult res = ShapeIntersection::Classify(worklistData->m_frustum, c->m_cullData.m_boundingSphere);
+                bool entryInFrustum = (res != IntersectResult::Exterior) && (res == IntersectResult::Interior || ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb));
+                if (!entryInFrustum)
+                {
+                    return false;
+                }
+            }
+
+            if (worklistData->m_hasExcludeFrustum &&
+                ShapeIntersection::Classify(worklistData->m_excludeFrustum, c->m_cullData.m_boundingSphere) == IntersectResult::Interior)
+            {
+                // Skip item contained in exclude frustum.
+                return false;
+            }
+
+            return true;
+        }
+
+        static bool IsCullableHiddenFromView(const AZStd::shared_ptr<WorklistData>& worklistData, const Cullable* c)
+        {
+            return (c->m_cullData.m_drawListMask & worklistData->m_view->GetDrawListMask()).none() ||
+                c->m_cullData.m_hideFlags & worklistData->m_view->GetUsageFlags() ||
+                c->m_isHidden;
+        }
+
+        // Adds a cullable that is inside the view's frustums to the view, unless it is occluded.
+        // Returns true if it was added, and the number of draw packets added in outDrawPacketCount.
+        static bool AddCullableToView(
+            const AZStd::shared_ptr<WorklistData>& worklistData, Cullable* c, uint32_t& outDrawPacketCount)
+        {
+            const AzFramework::VisibilityEntry* visibleEntry = &c->m_cullData.m_visibilityEntry;
+            if (!TestOcclusionCulling(worklistData, visibleEntry))
+            {
+                return false;
+            }
+
+            // Views that render their static and dynamic objects separately get the draws and the flags of dynamic cullables apart
+            const bool isDynamic = worklistData->m_view->IsDynamicCullable(c->m_flags);
+            outDrawPacketCount = AddLodDataToView(
+                c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view, visibleEntry->m_typeFlags, isDynamic,
+                worklistData->m_sharedView);
+            c->m_isVisible = true;
+            for (View* view : { worklistData->m_view, worklistData->m_sharedView })
+            {
+                if (!view)
+                {
+                    continue;
+                }
+                if (isDynamic)
+                {
+                    view->ApplyDynamicFlags(c->m_flags);
+                }
+                else
+                {
+                    view->ApplyFlags(c->m_flags);
+                }
+            }
+            return true;
+        }
+
         static void ProcessEntrylist(
             const AZStd::shared_ptr<WorklistData>& worklistData,
             const AZStd::vector<AzFramework::VisibilityEntry*>& entries,
@@ -285,6 +535,14 @@ namespace AZ
 #endif
             endIdx = (endIdx == -1) ? s32(entries.size()) : endIdx;
 
+            // Hidden cullables are recorded too, since they can be shown again without being updated in the visibility scene
+            ViewVisibilityCache* visibilityCache = worklistData->m_visibilityCache;
+            AZStd::vector<Cullable*> cachedCullables;
+            if (visibilityCache)
+            {
+                cachedCullables.reserve(endIdx - startIdx);
+            }
+
             for (s32 i = startIdx; i < endIdx; ++i)
             {
                 AzFramework::VisibilityEntry* visibleEntry = entries[i];
@@ -294,40 +552,30 @@ namespace AZ
                 {
                     Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
 
-                    if ((c->m_cullData.m_drawListMask & worklistData->m_view->GetDrawListMask()).none() ||
-                        c->m_cullData.m_hideFlags & worklistData->m_view->GetUsageFlags() ||
-                        c->m_isHidden)
+                    if (visibilityCache)
                     {
-                        continue;
-                    }
+                        if (!IsCullableInFrustums(worklistData, c, parentNodeContainedInFrustum))
+                        {
+                            continue;
+                        }
+                        cachedCullables.push_back(c);
 
-                    if (!parentNodeContainedInFrustum)
-                    {
-                        IntersectResult res = ShapeIntersection::Classify(worklistData->m_frustum, c->m_cullData.m_boundingSphere);
-                        bool entryInFrustum = (res != IntersectResult::Exterior) && (res == IntersectResult::Interior || ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb));
-                        if (!entryInFrustum)
+                        if (IsCullableHiddenFromView(worklistData, c))
                         {
                             continue;
                         }
                     }
-
-                    if (worklistData->m_hasExcludeFrustum &&
-                        ShapeIntersection::Classify(worklistData->m_excludeFrustum, c->m_cullData.m_boundingSphere) == IntersectResult::Interior)
+                    else if (IsCullableHiddenFromView(worklistData, c) || !IsCullableInFrustums(worklistData, c, parentNodeContainedInFrustum))
                     {
-                        // Skip item contained in exclude frustum.
                         continue;
                     }
 
-                    if (TestOcclusionCulling(worklistData, visibleEntry))
+                    // There are ways to write this without [[maybe_unused]], but they are brittle.
+                    // For example, using #else could cause a bug where the function's parameter
+                    // is changed in #ifdef but not in #else.
+                    [[maybe_unused]] uint32_t drawPacketCount = 0;
+                    if (AddCullableToView(worklistData, c, drawPacketCount))
                     {
-                        // There are ways to write this without [[maybe_unused]], but they are brittle.
-                        // For example, using #else could cause a bug where the function's parameter
-                        // is changed in #ifdef but not in #else.
-                        [[maybe_unused]] const uint32_t drawPacketCount = AddLodDataToView(
-                            c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view, visibleEntry->m_typeFlags);
-                        c->m_isVisible = true;
-                        worklistData->m_view->ApplyFlags(c->m_flags);
-
 #ifdef AZ_CULL_DEBUG_ENABLED
                         ++numVisibleCullables;
                         numDrawPackets += drawPacketCount;
@@ -336,6 +584,12 @@ namespace AZ
                 }
             }
 
+            if (visibilityCache && !cachedCullables.empty())
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(visibilityCache->m_chunksMutex);
+                visibilityCache->m_chunks.emplace_back(AZStd::move(cachedCullables));
+            }
+
 #ifdef AZ_CULL_DEBUG_ENABLED
             AuxGeomDrawPtr auxGeomPtr = worklistData->GetAuxGeomPtr();
             if (auxGeomPtr)
@@ -383,6 +637,89 @@ namespace AZ
 #endif
         }
 
+        // Processes cullables cached from the previous frame that haven't been updated since, so they are still in the view's frustums.
+        // Updated cullables are removed from the chunk, they are tested again by ProcessUpdatedChunk.
+        static void ProcessCachedChunk(
+            const AZStd::shared_ptr<WorklistData>& worklistData, AZStd::vector<Cullable*>& cullables, uint64_t cacheFrame)
+        {
+            AZ_PROFILE_SCOPE(RPI, "Culling: ProcessCachedChunk");
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+            uint32_t numDrawPackets = 0;
+            uint32_t numVisibleCullables = 0;
+#endif
+            AZStd::erase_if(
+                cullables,
+                [cacheFrame](const Cullable* c)
+                {
+                    return c->m_cullingUpdateFrame >= cacheFrame;
+                });
+
+            for (Cullable* c : cullables)
+            {
+                [[maybe_unused]] uint32_t drawPacketCount = 0;
+                if (!IsCullableHiddenFromView(worklistData, c) && AddCullableToView(worklistData, c, drawPacketCount))
+                {
+#ifdef AZ_CULL_DEBUG_ENABLED
+                    ++numVisibleCullables;
+                    numDrawPackets += drawPacketCount;
+#endif
+                }
+            }
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+            if (worklistData->m_debugCtx->m_enableStats)
+            {
+                CullingDebugContext::CullStats& cullStats = worklistData->m_debugCtx->GetCullStatsForView(worklistData->m_view);
+                cullStats.m_numVisibleDrawPackets += numDrawPackets;
+                cullStats.m_numVisibleCullables += numVisibleCullables;
+                ++cullStats.m_numJobs;
+            }
+#endif
+        }
+
+        // Tests cullables that were registered or updated since the view's cache was built, and records the ones in the view's frustums
+        static void ProcessUpdatedChunk(
+            const AZStd::shared_ptr<WorklistData>& worklistData, AZStd::span<Cullable* const> updatedCullables, AZStd::vector<Cullable*>& outCullables)
+        {
+            AZ_PROFILE_SCOPE(RPI, "Culling: ProcessUpdatedChunk");
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+            uint32_t numDrawPackets = 0;
+            uint32_t numVisibleCullables = 0;
+#endif
+            outCullables.clear();
+            for (Cullable* c : updatedCullables)
+            {
+                const AzFramework::VisibilityEntry::TypeFlags typeFlags = c->m_cullData.m_visibilityEntry.m_typeFlags;
+                if (!(typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable || typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList) ||
+                    !IsCullableInFrustums(worklistData, c, false))
+                {
+                    continue;
+                }
+                outCullables.push_back(c);
+
+                [[maybe_unused]] uint32_t drawPacketCount = 0;
+                if (!IsCullableHiddenFromView(worklistData, c) && AddCullableToView(worklistData, c, drawPacketCount))
+                {
+#ifdef AZ_CULL_DEBUG_ENABLED
+                    ++numVisibleCullables;
+                    numDrawPackets += drawPacketCount;
+#endif
+                }
+            }
+
+#ifdef AZ_CULL_DEBUG_ENABLED
+            if (worklistData->m_debugCtx->m_enableStats)
+            {
+                CullingDebugContext::CullStats& cullStats = worklistData->m_debugCtx->GetCullStatsForView(worklistData->m_view);
+                cullStats.m_numVisibleDrawPackets += numDrawPackets;
+                cullStats.m_numVisibleCullables += numVisibleCullables;
+                ++cullStats.m_numJobs;
+            }
+#endif
+        }
+
         static void ProcessVisibilityNode(const AZStd::shared_ptr<WorklistData>& worklistData, const AzFramework::IVisibilityScene::NodeData& nodeData)
         {
             bool nodeIsContainedInFrustum = !worklistData->m_debugCtx->m_enableFrustumCulling || ShapeIntersection::Contains(worklistData->m_frustum, nodeData.m_bounds);
@@ -560,7 +897,7 @@ namespace AZ
                 ndcMaxY = AZStd::max(ndcMaxY, corners[index].GetY());
             }
 
-            // test against the occlusion buffer, which contains only the manually placed occlusion planes
+            // test against the occlusion buffer, which contains the manually placed occlusion planes and the occluders
             if (maskedOcclusionCulling->TestRect(ndcMinX, ndcMinY, ndcMaxX, ndcMaxY, minDepth) !=
                 MaskedOcclusionCulling::CullingResult::VISIBLE)
             {
@@ -618,10 +955,21 @@ namespace AZ
                 return;
             }
 
+            RasterizeOccluders(view, frustum);
+        }
+
+        void CullingScene::RasterizeOccluders(View& view [[maybe_unused]], const AZ::Frustum& frustum [[maybe_unused]])
+        {
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             // setup occlusion culling, if necessary
             MaskedOcclusionCulling* maskedOcclusionCulling = view.GetMaskedOcclusionCulling();
-            if (maskedOcclusionCulling && !m_occlusionPlanes.empty())
+            if (!maskedOcclusionCulling)
+            {
+                return;
+            }
+
+            bool anyVisible = false;
+            if (!m_occlusionPlanes.empty())
             {
                 // frustum cull occlusion planes
                 using VisibleOcclusionPlane = AZStd::pair<OcclusionPlane, float>;
@@ -645,7 +993,6 @@ namespace AZ
                     return LHS.second > RHS.second;
                 });
 
-                bool anyVisible = false;
                 for (const VisibleOcclusionPlane& occlusionPlane : visibleOccluders)
                 {
                     // convert to clip-space
@@ -671,12 +1018,74 @@ namespace AZ
                         anyVisible = true;
                     }
                 }
+            }
+
+            // Orthographic views, like the shadow cascades, have the same w everywhere so their occlusion buffer has no depth
+            if (r_occluders && !m_occluders.empty() && (view.GetUsageFlags() & View::UsageCamera))
+            {
+                AZ_PROFILE_SCOPE(RPI, "CullingScene: RasterizeOccluders");
+
+                // frustum cull the occluders and skip the ones too small on screen to hide much
+                const Vector3 cameraPosition = view.GetCameraTransform().GetTranslation();
+                using VisibleOccluder = AZStd::pair<const Occluder*, float>;
+                AZStd::vector<VisibleOccluder> visibleOccluders;
+                for (const Occluder* occluder : m_occluders)
+                {
+                    if (!ShapeIntersection::Overlaps(frustum, occluder->m_aabb))
+                    {
+                        continue;
+                    }
+
+                    Vector3 center;
+                    float radius;
+                    occluder->m_aabb.GetAsSphere(center, radius);
+                    const float distance = center.GetDistance(cameraPosition);
+                    if (distance > radius && 2.0f * radius < r_occluderMinScreenSize * distance)
+                    {
+                        continue;
+                    }
+                    visibleOccluders.emplace_back(occluder, distance - radius);
+                }
+
+                // sort the occluders by distance, front-to-back, since only the closest ones are rasterized
+                AZStd::sort(visibleOccluders.begin(), visibleOccluders.end(), [](const VisibleOccluder& LHS, const VisibleOccluder& RHS)
+                {
+                    return LHS.second < RHS.second;
+                });
+                if (visibleOccluders.size() > r_occluderMaxCount)
+                {
+                    visibleOccluders.resize(r_occluderMaxCount);
+                }
 
-                if (anyVisible)
+                for (const VisibleOccluder& visibleOccluder : visibleOccluders)
                 {
-                    view.SetMaskedOcclusionCullingDirty(true);
+                    const Occluder& occluder = *visibleOccluder.first;
+                    const OccluderGeometry& geometry = *occluder.m_geometry;
+                    const Matrix4x4 localToClip = view.GetWorldToClipMatrix() * Matrix4x4::CreateFromMatrix3x4(occluder.m_localToWorld);
+                    float localToClipValues[16];
+                    localToClip.StoreToColumnMajorFloat16(localToClipValues);
+
+                    // the positions are transformed by the rasterizer, and it reads their z as w before the transform.
+                    // BACKFACE_NONE, since meshes of either winding are used, and open meshes must occlude from both sides
+                    if (maskedOcclusionCulling->RenderTriangles(
+                            geometry.m_positions.data(),
+                            geometry.m_indices.data(),
+                            aznumeric_cast<int>(geometry.m_indices.size() / 3),
+                            localToClipValues,
+                            MaskedOcclusionCulling::BACKFACE_NONE,
+                            MaskedOcclusionCulling::CLIP_PLANE_ALL,
+                            MaskedOcclusionCulling::VertexLayout(sizeof(float) * 3, sizeof(float), sizeof(float) * 2)) ==
+                        MaskedOcclusionCulling::CullingResult::VISIBLE)
+                    {
+                        anyVisible = true;
+                    }
                 }
             }
+
+            if (anyVisible)
+            {
+                view.SetMaskedOcclusionCullingDirty(true);
+            }
 #endif
         }
 
@@ -686,16 +1095,25 @@ namespace AZ
 
             AZ_Assert(parentJob != nullptr || taskGraph != nullptr, "ProcessCullables must have either a valid parent job or a valid task graph");
 
+            // The view gets its visible objects from the culling of the view it's paired with
+            if (IsCulledWithSharedView(view))
+            {
+                return;
+            }
+
             const Matrix4x4& worldToClip = view.GetWorldToClipMatrix();
-            AZ::Frustum frustum = Frustum::CreateFromMatrixColumnMajor(worldToClip);
+            View* sharedView = GetSharedCullingView(view);
+            AZ::Frustum frustum = sharedView ? CreateSharedCullingFrustum(view, *sharedView) : Frustum::CreateFromMatrixColumnMajor(worldToClip);
 
             ProcessCullablesCommon(scene, view, frustum);
 
             AZStd::shared_ptr<WorkListType> worklist = AZStd::make_shared<WorkListType>();
             worklist->Init();
             AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, parentJob, taskGraphEvent);
+            worklistData->m_sharedView = sharedView;
             static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessWorklist", "Graphics" };
 
+            Matrix4x4 cameraWorldToClip = Matrix4x4::CreateIdentity();
             if (const Matrix4x4* worldToClipExclude = view.GetWorldToClipExcludeMatrix())
             {
                 worklistData->m_hasExcludeFrustum = true;
@@ -707,11 +1125,51 @@ namespace AZ
                 if (renderPipeline && renderPipeline->GetViews(renderPipeline->GetMainViewTag()).size() == 1)
                 {
                     RPI::ViewPtr cameraView = renderPipeline->GetDefaultView();
-                    const Matrix4x4& cameraWorldToClip = cameraView->GetWorldToClipMatrix();
+                    cameraWorldToClip = cameraView->GetWorldToClipMatrix();
                     worklistData->m_cameraFrustum = Frustum::CreateFromMatrixColumnMajor(cameraWorldToClip);
                     worklistData->m_applyCameraFrustumIntersectionTest = true;
                 }
             }
+
+            // Reuse the cullables found in the previous frame if none of the frustums changed, otherwise rebuild the cache from the traversal
+            auto visibilityCacheIter = m_viewVisibilityCaches.find(&view);
+            if (r_cullingPersistentVisibility && m_debugCtx.m_enableFrustumCulling && !m_debugCtx.m_freezeFrustums &&
+                visibilityCacheIter != m_viewVisibilityCaches.end())
+            {
+                ViewVisibilityCache& visibilityCache = *visibilityCacheIter->second;
+                const bool cacheValid = !m_cullableRemoved && visibilityCache.m_frame != 0 && visibilityCache.m_frame + 1 == m_cullingFrame &&
+                    visibilityCache.m_worldToClip == worldToClip &&
+                    visibilityCache.m_hasExcludeFrustum == worklistData->m_hasExcludeFrustum &&
+                    (!worklistData->m_hasExcludeFrustum || visibilityCache.m_worldToClipExclude == *view.GetWorldToClipExcludeMatrix()) &&
+                    visibilityCache.m_hasCameraFrustum == worklistData->m_applyCameraFrustumIntersectionTest &&
+                    (!worklistData->m_applyCameraFrustumIntersectionTest || visibilityCache.m_cameraWorldToClip == cameraWorldToClip) &&
+                    visibilityCache.m_hasSharedView == (sharedView != nullptr) &&
+                    (!sharedView || visibilityCache.m_sharedWorldToClip == sharedView->GetWorldToClipMatrix()) &&
+                    visibilityCache.m_shadowCascadeExtrusionAmount == r_shadowCascadeExtrusionAmount;
+
+                if (cacheValid && ProcessCachedCullables(visibilityCache, worklistData, taskGraph))
+                {
+                    return;
+                }
+
+                visibilityCache.m_worldToClip = worldToClip;
+                visibilityCache.m_hasExcludeFrustum = worklistData->m_hasExcludeFrustum;
+                if (worklistData->m_hasExcludeFrustum)
+                {
+                    visibilityCache.m_worldToClipExclude = *view.GetWorldToClipExcludeMatrix();
+                }
+                visibilityCache.m_hasCameraFrustum = worklistData->m_applyCameraFrustumIntersectionTest;
+                visibilityCache.m_cameraWorldToClip = cameraWorldToClip;
+                visibilityCache.m_hasSharedView = sharedView != nullptr;
+                if (sharedView)
+                {
+                    visibilityCache.m_sharedWorldToClip = sharedView->GetWorldToClipMatrix();
+                }
+                visibilityCache.m_shadowCascadeExtrusionAmount = r_shadowCascadeExtrusionAmount;
+                visibilityCache.m_frame = m_cullingFrame;
+                visibilityCache.m_chunks.clear();
+                worklistData->m_visibilityCache = &visibilityCache;
+            }
             
             auto nodeVisitorLambda = [worklistData, taskGraph, parentJob, &worklist](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
@@ -823,13 +1281,90 @@ namespace AZ
             }
         }
 
+        bool CullingScene::ProcessCachedCullables(
+            ViewVisibilityCache& cache, const AZStd::shared_ptr<WorklistData>& worklistData, AZ::TaskGraph* taskGraph)
+        {
+            AZ_PROFILE_SCOPE(RPI, "CullingScene::ProcessCachedCullables() - %s", worklistData->m_view->GetName().GetCStr());
+
+            // Chunks are emptied as their cullables are updated, and every frame with updates adds a chunk. Once the chunks are
+            // too fragmented to spread the work evenly the cache is rebuilt from the visibility scene instead.
+            AZStd::erase_if(
+                cache.m_chunks,
+                [](const AZStd::vector<Cullable*>& chunk)
+                {
+                    return chunk.empty();
+                });
+
+            const size_t chunkSize = AZStd::max<size_t>(r_numEntriesPerCullingJob, 1);
+            size_t cachedCount = 0;
+            for (const AZStd::vector<Cullable*>& chunk : cache.m_chunks)
+            {
+                cachedCount += chunk.size();
+            }
+            if (cache.m_chunks.size() > 2 * AZ::DivideAndRoundUp(cachedCount, chunkSize) + 16)
+            {
+                return false;
+            }
+
+            static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessCachedCullables", "Graphics" };
+            auto submit = [taskGraph, &worklistData](auto&& processCullables)
+            {
+                if (taskGraph != nullptr)
+                {
+                    taskGraph->AddTask(descriptor, AZStd::move(processCullables));
+                }
+                else
+                {
+                    AZ::Job* job = AZ::CreateJobFunction(AZStd::move(processCullables), true);
+                    worklistData->m_parentJob->SetContinuation(job);
+                    job->Start();
+                }
+            };
+
+            // The chunks vector is sized up front, so every task can write to its own chunk
+            const uint64_t cacheFrame = cache.m_frame;
+            const size_t cachedChunkCount = cache.m_chunks.size();
+            const size_t updatedChunkCount = AZ::DivideAndRoundUp(m_updatedCullables.size(), chunkSize);
+            cache.m_chunks.resize(cachedChunkCount + updatedChunkCount);
+            cache.m_frame = m_cullingFrame;
+
+            for (size_t chunkIndex = 0; chunkIndex < cachedChunkCount; ++chunkIndex)
+            {
+                AZStd::vector<Cullable*>* chunk = &cache.m_chunks[chunkIndex];
+                submit([worklistData, chunk, cacheFrame]()
+                    {
+                        ProcessCachedChunk(worklistData, *chunk, cacheFrame);
+                    });
+            }
+
+            for (size_t updatedChunkIndex = 0; updatedChunkIndex < updatedChunkCount; ++updatedChunkIndex)
+            {
+                const size_t start = updatedChunkIndex * chunkSize;
+                AZStd::span<Cullable* const> updatedCullables(
+                    m_updatedCullables.data() + start, AZStd::min(chunkSize, m_updatedCullables.size() - start));
+                AZStd::vector<Cullable*>* chunk = &cache.m_chunks[cachedChunkCount + updatedChunkIndex];
+                submit([worklistData, updatedCullables, chunk]()
+                    {
+                        ProcessUpdatedChunk(worklistData, updatedCullables, *chunk);
+                    });
+            }
+
+            return true;
+        }
+
         // Fastest of the three functions: ProcessCullablesJobsEntries, ProcessCullablesJobsNodes, ProcessCullablesTG
         void CullingScene::ProcessCullablesJobsEntries(const Scene& scene, View& view, AZ::Job* parentJob)
         {
             AZ_PROFILE_SCOPE(RPI, "CullingScene::ProcessCullablesJobsEntries() - %s", view.GetName().GetCStr());
 
-            const Matrix4x4& worldToClip = view.GetWorldToClipMatrix();
-            AZ::Frustum frustum = Frustum::CreateFromMatrixColumnMajor(worldToClip);
+            if (IsCulledWithSharedView(view))
+            {
+                return;
+            }
+
+            View* sharedView = GetSharedCullingView(view);
+            AZ::Frustum frustum = sharedView ? CreateSharedCullingFrustum(view, *sharedView)
+                                             : Frustum::CreateFromMatrixColumnMajor(view.GetWorldToClipMatrix());
 
             ProcessCullablesCommon(scene, view, frustum);
 
@@ -841,6 +1376,7 @@ namespace AZ
             AZStd::shared_ptr<EntryListType> entryList = AZStd::make_shared<EntryListType>();
             entryList->m_entries.reserve(r_numEntriesPerCullingJob);
             AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, parentJob, nullptr);
+            worklistData->m_sharedView = sharedView;
 
             if (const Matrix4x4* worldToClipExclude = view.GetWorldToClipExcludeMatrix())
             {
@@ -923,7 +1459,12 @@ namespace AZ
         }
 
         uint32_t AddLodDataToView(
-            const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view, AzFramework::VisibilityEntry::TypeFlags typeFlags)
+            const Vector3& pos,
+            const Cullable::LodData& lodData,
+            RPI::View& view,
+            AzFramework::VisibilityEntry::TypeFlags typeFlags,
+            bool isDynamic,
+            RPI::View* sharedView)
         {
 #ifdef AZ_CULL_PROFILE_DETAILED
             AZ_PROFILE_SCOPE(RPI, "AddLodDataToView");
@@ -937,20 +1478,40 @@ namespace AZ
                 AZ_PROFILE_SCOPE(RPI, "add draw packets: %zu", lod.m_drawPackets.size());
 #endif
                 numVisibleDrawPackets += static_cast<uint32_t>(lod.m_drawPackets.size());   //don't want to pay the cost of aznumeric_cast<> here so using static_cast<> instead
-                if (typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList)
+                for (RPI::View* targetView : { &view, sharedView })
                 {
-                    view.AddVisibleObject(lod.m_visibleObjectUserData, pos);
-                }
-                else if (typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
-                {
-                    for (const RHI::DrawPacket* drawPacket : lod.m_drawPackets)
+                    if (!targetView)
+                    {
+                        continue;
+                    }
+                    if (typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList)
+                    {
+                        targetView->AddVisibleObject(lod.m_visibleObjectUserData, pos);
+                    }
+                    else if (typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
+                    {
+                        for (const RHI::DrawPacket* drawPacket : lod.m_drawPackets)
+                        {
+                            if (isDynamic)
+                            {
+                                targetView->AddDynamicDrawPacket(drawPacket, pos);
+                            }
+                            else
+                            {
+                                targetView->AddDrawPacket(drawPacket, pos);
+                            }
+                        }
+                    }
+                    else
                     {
-                        view.AddDrawPacket(drawPacket, pos);
+                        AZ_Assert(false, "Invalid cullable type flags.")
                     }
                 }
-                else
+
+                // The lod draws a less detailed lod of the model until this one is streamed in
+                if (lod.m_streamingLodRequest != Cullable::LodData::NoStreamingLodRequest)
                 {
-                    AZ_Assert(false, "Invalid cullable type flags.")
+                    lodData.m_streamingModel->RequestLod(lod.m_streamingLodRequest);
                 }
             };
 
@@ -1021,6 +1582,12 @@ namespace AZ
             AZ_Assert(CountObjectsInScene() == 0, "All culling entries must be removed from the scene before shutdown.");
 #endif
             m_visScene = nullptr;
+            m_viewVisibilityCaches.clear();
+            m_sharedCullingViews.clear();
+            m_occluders.clear();
+            m_occluderGeometries.clear();
+            m_pendingUpdatedCullables.clear();
+            m_updatedCullables.clear();
         }
 
         void CullingScene::BeginCullingTaskGraph(const Scene& scene, AZStd::span<const ViewPtr> views)
@@ -1081,6 +1648,36 @@ namespace AZ
             m_debugCtx.ResetCullStats();
             m_debugCtx.m_numCullablesInScene = GetNumCullables();
 
+            // Cullables updated before this frame's culling are the ones the views' visibility caches need to test again
+            ++m_cullingFrame;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_updatedCullablesMutex);
+                m_updatedCullables.clear();
+                m_updatedCullables.swap(m_pendingUpdatedCullables);
+            }
+            m_cullableRemoved = m_pendingCullableRemoved.exchange(false);
+
+            // The caches of views that aren't culled this frame would be out of date by the next one
+            AZStd::erase_if(
+                m_viewVisibilityCaches,
+                [views](const auto& visibilityCache)
+                {
+                    return AZStd::find_if(views.begin(), views.end(), [&visibilityCache](const ViewPtr& view)
+                        {
+                            return view.get() == visibilityCache.first;
+                        }) == views.end();
+                });
+            for (const ViewPtr& view : views)
+            {
+                AZStd::unique_ptr<ViewVisibilityCache>& visibilityCache = m_viewVisibilityCaches[view.get()];
+                if (!visibilityCache)
+                {
+                    visibilityCache = AZStd::make_unique<ViewVisibilityCache>();
+                }
+            }
+
+            PairSharedCullingViews(scene, views);
+
             m_taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
 
             // Remove any debug artifacts from the previous occlusion culling session.
@@ -1139,6 +1736,67 @@ namespace AZ
 #endif
         }
 
+        void CullingScene::PairSharedCullingViews(const Scene& scene, AZStd::span<const ViewPtr> views)
+        {
+            m_sharedCullingViews.clear();
+
+            // Occlusion is tested with the buffer of each view, which the paired view's objects wouldn't be tested against
+            if (!r_cullingShareStereoViews || !m_occlusionPlanes.empty() || (r_occluders && !m_occluders.empty()) ||
+                !GetEntityContextIdForOcclusion(&scene).IsNull())
+            {
+                return;
+            }
+
+            // The views must get the same objects and draw lists from the culling, so only their matrices may differ
+            auto canShareCulling = [](const View& view, const View& otherView)
+            {
+                return view.GetUsageFlags() == otherView.GetUsageFlags() &&
+                    view.GetDrawListMask() == otherView.GetDrawListMask() &&
+                    view.GetDynamicCullableFlags() == otherView.GetDynamicCullableFlags() &&
+                    !view.GetWorldToClipExcludeMatrix() && !otherView.GetWorldToClipExcludeMatrix() &&
+                    view.GetViewToWorldMatrix().GetTranslation().GetDistance(otherView.GetViewToWorldMatrix().GetTranslation()) <=
+                    MaxSharedCullingViewDistance;
+            };
+
+            View* unpairedView = nullptr;
+            for (const ViewPtr& view : views)
+            {
+                if (!(view->GetUsageFlags() & View::UsageXR))
+                {
+                    continue;
+                }
+                if (unpairedView && canShareCulling(*unpairedView, *view))
+                {
+                    m_sharedCullingViews.emplace_back(unpairedView, view.get());
+                    unpairedView = nullptr;
+                }
+                else
+                {
+                    unpairedView = view.get();
+                }
+            }
+        }
+
+        View* CullingScene::GetSharedCullingView(const View& view) const
+        {
+            for (const auto& [culledView, sharedView] : m_sharedCullingViews)
+            {
+                if (culledView == &view)
+                {
+                    return sharedView;
+                }
+            }
+            return nullptr;
+        }
+
+        bool CullingScene::IsCulledWithSharedView(const View& view) const
+        {
+            return AZStd::any_of(m_sharedCullingViews.begin(), m_sharedCullingViews.end(), [&view](const auto& viewPair)
+                {
+                    return viewPair.second == &view;
+                });
+        }
+
         void CullingScene::EndCulling(const Scene& scene, AZStd::span<const ViewPtr> views)
         {
             m_cullDataConcurrencyCheck.soft_unlock();
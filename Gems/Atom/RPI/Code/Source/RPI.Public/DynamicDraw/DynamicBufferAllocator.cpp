@@ -50,8 +50,6 @@ namespace AZ
                 return nullptr;
             }
 
-            m_currentPosition = RHI::AlignUp(m_currentPosition, alignment);
-
             if (size > m_ringBufferSize)
             {
                 AZ_WarningOnce(
@@ -61,23 +59,29 @@ namespace AZ
                 return nullptr;
             }
 
-            // Return if the allocation of current frame has reached limit
-            if (m_currentPosition + size > m_ringBufferSize)
+            // Threads allocating at the same time retry until one of them moves the position past its allocation
+            uint32_t position = m_currentPosition.load(AZStd::memory_order_relaxed);
+            uint32_t alignedPosition = 0;
+            do
             {
-                AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: no more buffer space is available");
-                return nullptr;
-            }
+                alignedPosition = RHI::AlignUp(position, alignment);
+
+                // Return if the allocation of current frame has reached limit
+                if (alignedPosition > m_ringBufferSize || size > m_ringBufferSize - alignedPosition)
+                {
+                    AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: no more buffer space is available");
+                    return nullptr;
+                }
+            } while (!m_currentPosition.compare_exchange_weak(position, alignedPosition + size, AZStd::memory_order_relaxed));
 
             RHI::Ptr<DynamicBuffer> allocatedBuffer = aznew DynamicBuffer();
             for(auto [deviceIndex, address] : m_bufferStartAddresses.GetCurrentElement())
             {
-                allocatedBuffer->m_address[deviceIndex] = (uint8_t*)address + m_currentPosition;
+                allocatedBuffer->m_address[deviceIndex] = (uint8_t*)address + alignedPosition;
             }
             allocatedBuffer->m_size = size;
             allocatedBuffer->m_allocator = this;
 
-            m_currentPosition += size;
-
             return allocatedBuffer;
         }
 
@@ -112,7 +116,7 @@ namespace AZ
         {
             m_bufferData.AdvanceCurrentElement();
             m_bufferStartAddresses.AdvanceCurrentElement();
-            m_currentPosition = 0;
+            m_currentPosition.store(0, AZStd::memory_order_relaxed);
         }
     } // namespace RPI
 } // namespace AZ
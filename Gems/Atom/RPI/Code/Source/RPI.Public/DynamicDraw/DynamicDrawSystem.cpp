@@ -49,7 +49,7 @@ namespace AZ
 
         RHI::Ptr<DynamicBuffer> DynamicDrawSystem::GetDynamicBuffer(uint32_t size, uint32_t alignment)
         {
-            AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
+            // The allocator is lock free, draw contexts recording on different threads don't wait on each other
             return m_bufferAlloc->Allocate(size, alignment);
         }
 
@@ -133,7 +133,6 @@ namespace AZ
             // for m_bufferAlloc to be non-nullptr
             if (m_bufferAlloc != nullptr)
             {
-                AZStd::lock_guard<AZStd::mutex> lock(m_mutexBufferAlloc);
                 m_bufferAlloc->FrameEnd();
             }
 
@@ -251,6 +251,11 @@ namespace AZ
             }
         }
         
+        uint32_t StreamingImage::GetMipFeedbackSlot() const
+        {
+            return m_streamingContext ? m_streamingContext->GetMipFeedbackSlot() : StreamingImageController::InvalidMipFeedbackSlot;
+        }
+
         uint16_t StreamingImage::GetResidentMipLevel()
         {
             return static_cast<uint16_t>(m_image->GetResidentMipLevel());
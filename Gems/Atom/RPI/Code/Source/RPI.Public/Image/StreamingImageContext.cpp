@@ -28,6 +28,11 @@ namespace AZ
             return m_lastAccessTimestamp;
         }
 
+        uint32_t StreamingImageContext::GetMipFeedbackSlot() const
+        {
+            return m_mipFeedbackSlot;
+        }
+
         void StreamingImageContext::UpdateMipStats()
         {
             m_mipLevelTargetAdjusted = m_streamingImage->m_streamingController->GetImageTargetMip(m_streamingImage);
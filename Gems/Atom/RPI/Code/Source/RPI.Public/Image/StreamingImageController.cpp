@@ -27,6 +27,10 @@ namespace AZ
         #define StreamingDebugOutput(window, ...)
 #endif
 
+        AZ_CVAR(uint32_t, r_streamingImageFeedbackUnsampledUpdates, 300, nullptr, ConsoleFunctorFlags::Null,
+            "Number of streaming updates after which an image that had a mip requested through ApplyMipFeedback but none since is evicted "
+            "down to its mip chain tail. 0 disables the eviction.");
+
         AZStd::unique_ptr<StreamingImageController> StreamingImageController::Create(RHI::StreamingImagePool& pool)
         {
             AZStd::unique_ptr<StreamingImageController> controller = AZStd::make_unique<StreamingImageController>();
@@ -48,6 +52,19 @@ namespace AZ
 
                 m_contexts.push_back(*context);
                 context->m_streamingImage = image;
+
+                if (m_freeMipFeedbackSlots.empty())
+                {
+                    context->m_mipFeedbackSlot = aznumeric_cast<uint32_t>(m_mipFeedbackSlotImages.size());
+                    m_mipFeedbackSlotImages.push_back(image);
+                }
+                else
+                {
+                    context->m_mipFeedbackSlot = m_freeMipFeedbackSlots.back();
+                    m_freeMipFeedbackSlots.pop_back();
+                    m_mipFeedbackSlotImages[context->m_mipFeedbackSlot] = image;
+                }
+
                 image->m_streamingController = this;
                 image->m_streamingContext = AZStd::move(context);
             }
@@ -80,6 +97,11 @@ namespace AZ
             {
                 AZStd::lock_guard<AZStd::mutex> lock(m_contextAccessMutex);
                 m_contexts.erase(*context);
+
+                m_mipFeedbackSlotImages[context->m_mipFeedbackSlot] = nullptr;
+                m_freeMipFeedbackSlots.push_back(context->m_mipFeedbackSlot);
+                context->m_mipFeedbackSlot = InvalidMipFeedbackSlot;
+                context->m_hasMipFeedback = false;
             }
 
             context->m_queuedForMipExpand = false;
@@ -427,6 +449,51 @@ namespace AZ
             return m_lastLowMemory != 0;
         }
 
+        uint32_t StreamingImageController::GetMipFeedbackSlotCount() const
+        {
+            return aznumeric_cast<uint32_t>(m_mipFeedbackSlotImages.size());
+        }
+
+        void StreamingImageController::ApplyMipFeedback(AZStd::span<const uint32_t> requestedMips)
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            const uint32_t unsampledUpdates = r_streamingImageFeedbackUnsampledUpdates;
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_contextAccessMutex);
+            const size_t slotCount = AZStd::min(requestedMips.size(), m_mipFeedbackSlotImages.size());
+            for (size_t slot = 0; slot < slotCount; ++slot)
+            {
+                StreamingImage* image = m_mipFeedbackSlotImages[slot];
+                if (!image)
+                {
+                    continue;
+                }
+
+                StreamingImageContext* context = image->m_streamingContext.get();
+                const uint16_t lowestMip = aznumeric_cast<uint16_t>(image->m_imageAsset->GetMipLevel(image->m_imageAsset->GetMipChainCount() - 1));
+
+                uint16_t targetMip = context->GetTargetMip();
+                if (requestedMips[slot] != NoMipFeedback)
+                {
+                    context->m_hasMipFeedback = true;
+                    context->m_lastMipFeedbackTimestamp = m_timestamp;
+                    targetMip = aznumeric_cast<uint16_t>(AZStd::min<uint32_t>(requestedMips[slot], lowestMip));
+                }
+                else if (context->m_hasMipFeedback && unsampledUpdates > 0 && m_timestamp - context->m_lastMipFeedbackTimestamp >= unsampledUpdates)
+                {
+                    targetMip = lowestMip;
+                }
+
+                if (targetMip != context->GetTargetMip())
+                {
+                    StreamingDebugOutput("StreamingImageController", "Image [%s] target mip changed to %d from feedback\n",
+                        image->GetRHIImage()->GetName().GetCStr(), targetMip);
+                    image->SetTargetMip(targetMip);
+                }
+            }
+        }
+
         bool StreamingImageController::EvictUnusedMips(StreamingImage* image)
         {
             uint16_t targetMip = GetImageTargetMip(image);
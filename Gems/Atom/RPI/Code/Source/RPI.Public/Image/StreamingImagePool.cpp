@@ -146,5 +146,15 @@ namespace AZ
         {
             return m_controller->GetMipBias();
         }
+
+        uint32_t StreamingImagePool::GetMipFeedbackSlotCount() const
+        {
+            return m_controller->GetMipFeedbackSlotCount();
+        }
+
+        void StreamingImagePool::ApplyMipFeedback(AZStd::span<const uint32_t> requestedMips)
+        {
+            m_controller->ApplyMipFeedback(requestedMips);
+        }
     }
 }
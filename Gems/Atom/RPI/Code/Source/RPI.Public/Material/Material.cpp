@@ -8,6 +8,8 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialParameterBuffer.h>
+#include <Atom/RPI.Public/Material/MaterialSystem.h>
 #include <Atom/RPI.Reflect/Image/AttachmentImageAsset.h>
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
@@ -15,6 +17,7 @@
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantPrefetcher.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Material/MaterialAsset.h>
 #include <Atom/RPI.Reflect/Material/MaterialPropertiesLayout.h>
@@ -24,6 +27,8 @@
 #include <AtomCore/Instance/InstanceDatabase.h>
 #include <AtomCore/Utils/ScopedValue.h>
 
+#include <AzCore/std/time.h>
+
 namespace AZ
 {
     namespace RPI
@@ -57,10 +62,14 @@ namespace AZ
 
             ScopedValue isInitializing(&m_isInitializing, true, false);
 
+            ReleaseParameterEntry();
+
             // All of these members must be reset if the material can be reinitialized because of the shader reload notification bus
             m_shaderResourceGroup = {};
             m_rhiShaderResourceGroup = {};
+            m_sharedShaderResourceGroup = {};
             m_materialProperties = {};
+            m_compiledPropertyValues = {};
             m_generalShaderCollection = {};
             m_materialPipelineData = {};
             m_materialAsset = { &materialAsset, AZ::Data::AssetLoadBehavior::PreLoad };
@@ -89,6 +98,13 @@ namespace AZ
                 if (m_shaderResourceGroup)
                 {
                     m_rhiShaderResourceGroup = m_shaderResourceGroup->GetRHIShaderResourceGroup();
+
+                    MaterialParameterBuffer* parameterBuffer = MaterialParameterBuffer::Get();
+                    if (r_bindlessMaterials && parameterBuffer)
+                    {
+                        m_parameterEntryWordCount = MaterialParameterBuffer::GetEntryWordCount(*srgLayout);
+                        m_parameterEntryIndex = parameterBuffer->AcquireEntry(m_parameterEntryWordCount);
+                    }
                 }
                 else
                 {
@@ -99,6 +115,23 @@ namespace AZ
 
             m_generalShaderCollection = m_materialAsset->GetGeneralShaderCollection();
 
+            m_canCompileConcurrently = true;
+            auto checkFunctors = [this](const MaterialFunctorList& functors)
+            {
+                for (const Ptr<MaterialFunctor>& functor : functors)
+                {
+                    if (functor && !functor->CanProcessConcurrently())
+                    {
+                        m_canCompileConcurrently = false;
+                    }
+                }
+            };
+            checkFunctors(m_materialAsset->GetMaterialFunctors());
+            for (const auto& [materialPipelineName, materialPipeline] : m_materialAsset->GetMaterialPipelinePayloads())
+            {
+                checkFunctors(materialPipeline.m_materialFunctors);
+            }
+
             if (!m_materialProperties.Init(m_materialAsset->GetMaterialPropertiesLayout(), m_materialAsset->GetPropertyValues()))
             {
                 return RHI::ResultCode::Fail;
@@ -120,6 +153,8 @@ namespace AZ
                 pipelineData.m_materialProperties.SetAllPropertyDirtyFlags();
             }
 
+            InitParameterBufferUsage();
+
             // Register for update events related to Shader instances that own the ShaderAssets inside
             // the shader collection.
             ForAllShaderItems([this](const Name&, const ShaderCollection::Item& shaderItem)
@@ -129,6 +164,13 @@ namespace AZ
                     return true;
                 });
 
+            // Request the shader variants the draws of this material used before, while the rest of the level is loading
+            if (ShaderVariantPrefetcher* shaderVariantPrefetcher = ShaderVariantPrefetcher::Get();
+                shaderVariantPrefetcher && ShaderVariantPrefetcher::IsEnabled())
+            {
+                shaderVariantPrefetcher->PrefetchVariants(*this);
+            }
+
             // Usually SetProperties called above will increment this change ID to invalidate
             // the material, but some materials might not have any properties, and we need
             // the material to be invalidated particularly when hot-reloading.
@@ -142,6 +184,66 @@ namespace AZ
         Material::~Material()
         {
             ShaderReloadNotificationBus::MultiHandler::BusDisconnect();
+            ReleaseParameterEntry();
+        }
+
+        void Material::ReleaseParameterEntry()
+        {
+            if (m_parameterEntryIndex != MaterialParameterBuffer::InvalidEntryIndex)
+            {
+                if (MaterialParameterBuffer* parameterBuffer = MaterialParameterBuffer::Get())
+                {
+                    parameterBuffer->ReleaseEntry(m_parameterEntryIndex, m_parameterEntryWordCount);
+                }
+                m_parameterEntryIndex = MaterialParameterBuffer::InvalidEntryIndex;
+                m_parameterEntryWordCount = 0;
+            }
+        }
+
+        void Material::InitParameterBufferUsage()
+        {
+            if (m_parameterEntryIndex == MaterialParameterBuffer::InvalidEntryIndex)
+            {
+                return;
+            }
+
+            // The draws of all the shaders bind the same material SRG, so the shared SRG can only replace the material SRG if
+            // every shader reads the material from the buffer.
+            const Name shaderOptionName{ MaterialParameterBuffer::ShaderOptionName };
+            bool allShadersSupportParameterBuffer = true;
+            ForAllShaderItems([&](const Name&, const ShaderCollection::Item& shaderItem)
+                {
+                    const ShaderOptionGroupLayout* layout = shaderItem.GetShaderOptions()->GetShaderOptionLayout();
+                    allShadersSupportParameterBuffer = layout->FindShaderOptionIndex(shaderOptionName).IsValid();
+                    return allShadersSupportParameterBuffer;
+                });
+
+            if (!allShadersSupportParameterBuffer)
+            {
+                return;
+            }
+
+            const AZ::Outcome<uint32_t> appliedCount = SetSystemShaderOption(shaderOptionName, ShaderOptionValue{ true });
+            if (appliedCount.IsSuccess() && appliedCount.GetValue() > 0)
+            {
+                m_sharedShaderResourceGroup = MaterialParameterBuffer::Get()->GetSharedMaterialSrg(
+                    m_materialAsset->GetMaterialTypeAsset()->GetShaderAssetForMaterialSrg(), *m_materialAsset->GetMaterialSrgLayout());
+            }
+
+            if (!m_sharedShaderResourceGroup)
+            {
+                SetSystemShaderOption(shaderOptionName, ShaderOptionValue{ false });
+            }
+        }
+
+        bool Material::CanCompileConcurrently() const
+        {
+            return m_canCompileConcurrently;
+        }
+
+        uint32_t Material::GetParameterEntryIndex() const
+        {
+            return m_parameterEntryIndex;
         }
 
         const ShaderCollection& Material::GetGeneralShaderCollection() const
@@ -286,6 +388,16 @@ namespace AZ
             return m_rhiShaderResourceGroup;
         }
 
+        bool Material::UsesParameterBuffer() const
+        {
+            return m_sharedShaderResourceGroup != nullptr;
+        }
+
+        const RHI::ShaderResourceGroup* Material::GetDrawShaderResourceGroup() const
+        {
+            return m_sharedShaderResourceGroup ? m_sharedShaderResourceGroup->GetRHIShaderResourceGroup() : m_rhiShaderResourceGroup;
+        }
+
         const Data::Asset<MaterialAsset>& Material::GetAsset() const
         {
             return m_materialAsset;
@@ -632,12 +744,36 @@ namespace AZ
 
             if (CanCompile())
             {
+                const AZStd::sys_time_t compileStart = AZStd::GetTimeNowMicroSecond();
+
+                // Properties changed back to the value they were compiled with already have their outputs applied
+                const size_t propertyCount = m_materialProperties.GetPropertyValues().size();
+                if (m_compiledPropertyValues.size() == propertyCount)
+                {
+                    m_materialProperties.ClearUnchangedPropertyDirtyFlags(m_compiledPropertyValues);
+                }
+
                 ProcessDirectConnections();
                 ProcessMaterialFunctors();
 
                 ProcessInternalDirectConnections();
                 ProcessInternalMaterialFunctors();
 
+                if (m_compiledPropertyValues.size() != propertyCount)
+                {
+                    m_compiledPropertyValues = m_materialProperties.GetPropertyValues();
+                }
+                else
+                {
+                    for (size_t i = 0; i < propertyCount; ++i)
+                    {
+                        if (m_materialProperties.GetPropertyDirtyFlags()[i])
+                        {
+                            m_compiledPropertyValues[i] = m_materialProperties.GetPropertyValues()[i];
+                        }
+                    }
+                }
+
                 m_materialProperties.ClearAllPropertyDirtyFlags();
 
                 for (auto& materialPipelinePair : m_materialPipelineData)
@@ -648,10 +784,21 @@ namespace AZ
                 if (m_shaderResourceGroup)
                 {
                     m_shaderResourceGroup->Compile();
+
+                    if (m_parameterEntryIndex != MaterialParameterBuffer::InvalidEntryIndex)
+                    {
+                        MaterialParameterBuffer::Get()->UpdateEntry(
+                            m_parameterEntryIndex, m_parameterEntryWordCount, m_rhiShaderResourceGroup->GetData());
+                    }
                 }
 
                 m_compiledChangeId = m_currentChangeId;
 
+                if (MaterialSystem* materialSystem = MaterialSystem::Get())
+                {
+                    materialSystem->RecordCompile(AZStd::GetTimeNowMicroSecond() - compileStart);
+                }
+
                 return true;
             }
 
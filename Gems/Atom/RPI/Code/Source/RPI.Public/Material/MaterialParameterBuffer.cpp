@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Material/MaterialParameterBuffer.h>
+
+#include <Atom/RHI/DeviceImageView.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RHI/ShaderResourceGroupData.h>
+#include <Atom/RHI.Reflect/ShaderResourceGroupLayout.h>
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(bool, r_bindlessMaterials, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Write the parameters of materials to the global material parameter buffer so shaders can read them by material index. "
+            "Only applies to materials created after it is changed.");
+
+        MaterialParameterBuffer* MaterialParameterBuffer::Get()
+        {
+            return Interface<MaterialParameterBuffer>::Get();
+        }
+
+        void MaterialParameterBuffer::Init()
+        {
+            Interface<MaterialParameterBuffer>::Register(this);
+        }
+
+        void MaterialParameterBuffer::Shutdown()
+        {
+            Interface<MaterialParameterBuffer>::Unregister(this);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_deviceEntries.clear();
+            m_freeEntries.clear();
+            m_sharedMaterialSrgs.clear();
+            m_wordCount = 0;
+            m_isDirty = false;
+            m_buffer = RingBuffer{ "MaterialParameterBuffer", CommonBufferPoolType::ReadOnly, RHI::Format::R32_UINT };
+        }
+
+        uint32_t MaterialParameterBuffer::GetEntryWordCount(const RHI::ShaderResourceGroupLayout& layout)
+        {
+            return AZ::DivideAndRoundUp(layout.GetConstantDataSize(), static_cast<uint32_t>(sizeof(uint32_t))) +
+                layout.GetGroupSizeForImages();
+        }
+
+        uint32_t MaterialParameterBuffer::AcquireEntry(uint32_t wordCount)
+        {
+            if (wordCount == 0)
+            {
+                return InvalidEntryIndex;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            if (m_deviceEntries.empty())
+            {
+                const int deviceCount = RHI::RHISystemInterface::Get()->GetDeviceCount();
+                for (int deviceIndex = 0; deviceIndex < deviceCount; ++deviceIndex)
+                {
+                    m_deviceEntries[deviceIndex] = {};
+                }
+            }
+
+            auto freeEntriesIt = m_freeEntries.find(wordCount);
+            if (freeEntriesIt != m_freeEntries.end() && !freeEntriesIt->second.empty())
+            {
+                const uint32_t entryIndex = freeEntriesIt->second.back();
+                freeEntriesIt->second.pop_back();
+                return entryIndex;
+            }
+
+            const uint32_t entryIndex = m_wordCount;
+            m_wordCount += wordCount;
+            for (auto& [deviceIndex, entries] : m_deviceEntries)
+            {
+                entries.resize(m_wordCount, RHI::DeviceImageView::InvalidBindlessIndex);
+            }
+            m_isDirty = true;
+            return entryIndex;
+        }
+
+        void MaterialParameterBuffer::ReleaseEntry(uint32_t entryIndex, uint32_t wordCount)
+        {
+            if (entryIndex == InvalidEntryIndex)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AZ_Assert(entryIndex + wordCount <= m_wordCount, "Material parameter entry is out of the buffer");
+            m_freeEntries[wordCount].push_back(entryIndex);
+        }
+
+        void MaterialParameterBuffer::UpdateEntry(uint32_t entryIndex, uint32_t wordCount, const RHI::ShaderResourceGroupData& groupData)
+        {
+            if (entryIndex == InvalidEntryIndex)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AZ_Assert(entryIndex + wordCount <= m_wordCount, "Material parameter entry is out of the buffer");
+
+            for (auto& [deviceIndex, entries] : m_deviceEntries)
+            {
+                const RHI::DeviceShaderResourceGroupData& deviceGroupData = groupData.GetDeviceShaderResourceGroupData(deviceIndex);
+                uint32_t* entry = entries.data() + entryIndex;
+
+                const AZStd::span<const uint8_t> constantData = deviceGroupData.GetConstantData();
+                const uint32_t constantWordCount = AZ::DivideAndRoundUp(static_cast<uint32_t>(constantData.size()), static_cast<uint32_t>(sizeof(uint32_t)));
+                AZ_Assert(constantWordCount <= wordCount, "The material parameter entry is too small for the constant data");
+                if (constantWordCount > 0)
+                {
+                    entry[constantWordCount - 1] = 0;
+                    memcpy(entry, constantData.data(), constantData.size());
+                }
+
+                const AZStd::span<const RHI::ConstPtr<RHI::DeviceImageView>> imageGroup = deviceGroupData.GetImageGroup();
+                const uint32_t imageCount = AZStd::min(static_cast<uint32_t>(imageGroup.size()), wordCount - constantWordCount);
+                for (uint32_t imageIndex = 0; imageIndex < imageCount; ++imageIndex)
+                {
+                    const RHI::ConstPtr<RHI::DeviceImageView>& imageView = imageGroup[imageIndex];
+                    entry[constantWordCount + imageIndex] = imageView ? imageView->GetBindlessReadIndex() : RHI::DeviceImageView::InvalidBindlessIndex;
+                }
+            }
+            m_isDirty = true;
+        }
+
+        void MaterialParameterBuffer::FrameUpdate()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (!m_isDirty || m_wordCount == 0)
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "MaterialParameterBuffer: FrameUpdate");
+
+            // The other buffers of the ring may still be in use by the GPU, so the whole buffer is written to the next one.
+            AZStd::unordered_map<int, const void*> deviceData;
+            for (const auto& [deviceIndex, entries] : m_deviceEntries)
+            {
+                deviceData[deviceIndex] = entries.data();
+            }
+            m_buffer.AdvanceCurrentBufferAndUpdateData(deviceData, m_wordCount * sizeof(uint32_t));
+            m_isDirty = false;
+        }
+
+        const Data::Instance<Buffer>& MaterialParameterBuffer::GetBuffer() const
+        {
+            return m_buffer.GetCurrentBuffer();
+        }
+
+        Data::Instance<ShaderResourceGroup> MaterialParameterBuffer::GetSharedMaterialSrg(
+            const Data::Asset<ShaderAsset>& shaderAsset, const RHI::ShaderResourceGroupLayout& layout)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            Data::Instance<ShaderResourceGroup>& sharedSrg = m_sharedMaterialSrgs[layout.GetHash()];
+            if (!sharedSrg)
+            {
+                sharedSrg = ShaderResourceGroup::Create(shaderAsset, layout.GetName());
+                if (sharedSrg)
+                {
+                    sharedSrg->Compile();
+                }
+            }
+            return sharedSrg;
+        }
+    } // namespace RPI
+} // namespace AZ
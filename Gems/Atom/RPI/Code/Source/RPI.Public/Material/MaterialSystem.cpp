@@ -14,12 +14,31 @@
 #include <Atom/RPI.Reflect/Material/MaterialPropertiesLayout.h>
 #include <Atom/RPI.Reflect/Material/LuaMaterialFunctor.h>
 
+#include <Atom/RHI.Reflect/Base.h>
+
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Statistics/StatisticalProfilerProxy.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_materialParallelCompile, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Defer the compile of the materials whose properties were changed to the start of the simulation tick, "
+            "and compile them together in parallel jobs");
+        AZ_CVAR(uint32_t, r_materialParallelCompileBatchSize, 16, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of materials each material compile job compiles. Fewer materials than this are compiled on the calling thread");
+
+        static constexpr AZStd::string_view CompiledMaterialsStatName("RPI Compiled Materials");
+        static constexpr AZStd::string_view MaterialCompileTimeStatName("RPI Material Compile Time");
+
         void MaterialSystem::Reflect(AZ::ReflectContext* context)
         {
             MaterialPropertyValue::Reflect(context);
@@ -38,6 +57,11 @@ namespace AZ
             assetHandlers.emplace_back(MakeAssetHandler<MaterialAssetHandler>());
         }
 
+        MaterialSystem* MaterialSystem::Get()
+        {
+            return Interface<MaterialSystem>::Get();
+        }
+
         void MaterialSystem::Init()
         {
             AZ::Data::InstanceHandler<Material> handler;
@@ -46,11 +70,166 @@ namespace AZ
                 return Material::CreateInternal(*(azrtti_cast<MaterialAsset*>(materialAsset)));
             };
             Data::InstanceDatabase<Material>::Create(azrtti_typeid<MaterialAsset>(), handler);
+
+            m_parameterBuffer.Init();
+
+            Interface<MaterialSystem>::Register(this);
+
+            if (auto statsProfiler = Interface<Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+            {
+                auto& rhiMetrics = statsProfiler->GetProfiler(rhiMetricsId);
+                rhiMetrics.GetStatsManager().AddStatistic(
+                    AZ::Crc32(CompiledMaterialsStatName), CompiledMaterialsStatName, /*units=*/"count", /*failIfExist=*/false);
+                rhiMetrics.GetStatsManager().AddStatistic(
+                    AZ::Crc32(MaterialCompileTimeStatName), MaterialCompileTimeStatName, /*units=*/"us", /*failIfExist=*/false);
+            }
         }
 
         void MaterialSystem::Shutdown()
         {
+            if (Interface<MaterialSystem>::Get() == this)
+            {
+                Interface<MaterialSystem>::Unregister(this);
+            }
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+                m_queuedMaterials.clear();
+            }
+
             Data::InstanceDatabase<Material>::Destroy();
+
+            m_parameterBuffer.Shutdown();
+        }
+
+        void MaterialSystem::FrameUpdate()
+        {
+            m_parameterBuffer.FrameUpdate();
+
+            m_compiledMaterialCount = m_frameCompiledMaterialCount.exchange(0);
+            m_compileTime = m_frameCompileTime.exchange(0);
+            if (auto statsProfiler = Interface<Statistics::StatisticalProfilerProxy>::Get(); statsProfiler)
+            {
+                auto& rhiMetrics = statsProfiler->GetProfiler(rhiMetricsId);
+                rhiMetrics.PushSample(AZ::Crc32(CompiledMaterialsStatName), static_cast<double>(m_compiledMaterialCount));
+                rhiMetrics.PushSample(AZ::Crc32(MaterialCompileTimeStatName), static_cast<double>(m_compileTime));
+            }
+        }
+
+        void MaterialSystem::CompileMaterials(AZStd::span<const Data::Instance<Material>> materials)
+        {
+            AZ_PROFILE_SCOPE(RPI, "MaterialSystem: CompileMaterials");
+
+            AZStd::vector<Material*> concurrentMaterials;
+            concurrentMaterials.reserve(materials.size());
+            for (const Data::Instance<Material>& material : materials)
+            {
+                if (!material || !material->NeedsCompile())
+                {
+                    continue;
+                }
+
+                if (r_materialParallelCompile && material->CanCompileConcurrently())
+                {
+                    concurrentMaterials.push_back(material.get());
+                }
+                else
+                {
+                    material->Compile();
+                }
+            }
+
+            // A material listed twice must not compile in two jobs at the same time
+            AZStd::sort(concurrentMaterials.begin(), concurrentMaterials.end());
+            concurrentMaterials.erase(AZStd::unique(concurrentMaterials.begin(), concurrentMaterials.end()), concurrentMaterials.end());
+
+            const size_t batchSize = AZStd::max<size_t>(r_materialParallelCompileBatchSize, 1);
+            if (concurrentMaterials.size() < batchSize)
+            {
+                for (Material* material : concurrentMaterials)
+                {
+                    material->Compile();
+                }
+                return;
+            }
+
+            AZ::JobCompletion jobCompletion;
+            for (size_t batchStart = 0; batchStart < concurrentMaterials.size(); batchStart += batchSize)
+            {
+                const AZStd::span<Material* const> batch(
+                    concurrentMaterials.data() + batchStart, AZStd::min(batchSize, concurrentMaterials.size() - batchStart));
+                const auto compileJobLambda = [batch]()
+                {
+                    AZ_PROFILE_SCOPE(RPI, "MaterialSystem: CompileMaterials Job");
+                    for (Material* material : batch)
+                    {
+                        material->Compile();
+                    }
+                };
+                Job* compileJob = aznew JobFunction<decltype(compileJobLambda)>(compileJobLambda, true, nullptr); // Auto-deletes
+                compileJob->SetDependent(&jobCompletion);
+                compileJob->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        bool MaterialSystem::QueueCompile(const Data::Instance<Material>& material)
+        {
+            if (!r_materialParallelCompile)
+            {
+                return !material->NeedsCompile() || material->Compile();
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+            m_queuedMaterials.push_back(material);
+            return true;
+        }
+
+        void MaterialSystem::CompileQueuedMaterials()
+        {
+            AZStd::vector<Data::Instance<Material>> queuedMaterials;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+                AZStd::swap(queuedMaterials, m_queuedMaterials);
+            }
+
+            if (queuedMaterials.empty())
+            {
+                return;
+            }
+
+            // Materials can be queued several times before they compile
+            AZStd::sort(queuedMaterials.begin(), queuedMaterials.end(),
+                [](const Data::Instance<Material>& lhs, const Data::Instance<Material>& rhs) { return lhs.get() < rhs.get(); });
+            queuedMaterials.erase(AZStd::unique(queuedMaterials.begin(), queuedMaterials.end()), queuedMaterials.end());
+
+            CompileMaterials(queuedMaterials);
+
+            // Materials whose SRG was already compiled this frame, or whose asset isn't ready, get another try next frame
+            AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+            for (Data::Instance<Material>& material : queuedMaterials)
+            {
+                if (material && material->NeedsCompile())
+                {
+                    m_queuedMaterials.push_back(AZStd::move(material));
+                }
+            }
+        }
+
+        void MaterialSystem::RecordCompile(AZStd::sys_time_t compileTime)
+        {
+            m_frameCompiledMaterialCount.fetch_add(1, AZStd::memory_order_relaxed);
+            m_frameCompileTime.fetch_add(compileTime, AZStd::memory_order_relaxed);
+        }
+
+        uint32_t MaterialSystem::GetCompiledMaterialCount() const
+        {
+            return m_compiledMaterialCount;
+        }
+
+        AZStd::sys_time_t MaterialSystem::GetCompileTime() const
+        {
+            return m_compileTime;
         }
 
     } // namespace RPI
@@ -7,9 +7,11 @@
  */
 
 #include <Atom/RPI.Public/MeshDrawPacket.h>
+#include <Atom/RPI.Public/Material/MaterialParameterBuffer.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantPrefetcher.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Reflect/Material/MaterialFunctor.h>
 #include <Atom/RHI/DrawPacketBuilder.h>
@@ -262,7 +264,8 @@ namespace AZ
             drawPacketBuilder.Begin(nullptr);
             drawPacketBuilder.SetGeometryView(&mesh);
             drawPacketBuilder.AddShaderResourceGroup(m_objectSrg->GetRHIShaderResourceGroup());
-            drawPacketBuilder.AddShaderResourceGroup(m_material->GetRHIShaderResourceGroup());
+            // Materials that the shaders read from the material parameter buffer bind the material SRG shared by their material type
+            drawPacketBuilder.AddShaderResourceGroup(m_material->GetDrawShaderResourceGroup());
 
             // We build the list of used shaders in a local list rather than m_activeShaders so that
             // if DoUpdate() fails it won't modify any member data.
@@ -364,6 +367,13 @@ namespace AZ
                 const ShaderVariantId requestedVariantId = shaderOptions.GetShaderVariantId();
                 const ShaderVariant& variant = r_forceRootShaderVariantUsage ? shader->GetRootVariant() : shader->GetVariant(requestedVariantId);
 
+                // Learn the variant, so it's requested as soon as the material is created the next time the level loads
+                if (ShaderVariantPrefetcher* shaderVariantPrefetcher = ShaderVariantPrefetcher::Get();
+                    shaderVariantPrefetcher && ShaderVariantPrefetcher::IsEnabled())
+                {
+                    shaderVariantPrefetcher->RecordUsage(m_material->GetAsset().GetId(), shaderItem.GetShaderAssetId(), requestedVariantId);
+                }
+
 #ifdef DEBUG_MESH_SHADERVARIANTS
                 m_shaderVariantNames.push_back(variant.GetShaderVariantAsset().GetHint());
 #endif
@@ -404,6 +414,18 @@ namespace AZ
                         drawSrg->SetConstant(index, uvStreamTangentBitmask.GetFullTangentBitmask());
                     }
 
+                    // Pass the material parameter entry to the shader if the draw SRG has it, for shaders that read the
+                    // material from the material parameter buffer.
+                    const uint32_t materialParameterIndex = m_material->GetParameterEntryIndex();
+                    if (materialParameterIndex != MaterialParameterBuffer::InvalidEntryIndex)
+                    {
+                        auto materialIndex = drawSrg->FindShaderInputConstantIndex(AZ::Name(MaterialParameterBuffer::EntryIndexSrgName));
+                        if (materialIndex.IsValid())
+                        {
+                            drawSrg->SetConstant(materialIndex, materialParameterIndex);
+                        }
+                    }
+
                     drawSrg->Compile();
                 }
 
@@ -501,7 +523,7 @@ namespace AZ
             if (m_drawPacket)
             {
                 m_activeShaders = shaderList;
-                m_materialSrg = m_material->GetRHIShaderResourceGroup();
+                m_materialSrg = m_material->GetDrawShaderResourceGroup();
                 return true;
             }
             else
@@ -7,11 +7,13 @@
  */
 
 #include <Atom/RPI.Public/Model/Model.h>
+#include <Atom/RPI.Public/Model/ModelLodStreamingController.h>
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
 
 #include <Atom/RHI/Factory.h>
 
 #include <AtomCore/Instance/InstanceDatabase.h>
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Timer.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/IntersectSegment.h>
@@ -51,6 +53,17 @@ namespace AZ
             Data::InstanceDatabase<Model>::Instance().TEMPOrphan(Data::InstanceId::CreateFromAsset(modelAsset));
         }
 
+        Model::~Model()
+        {
+            if (m_isLodStreamingEnabled)
+            {
+                if (ModelLodStreamingController* streamingController = ModelLodStreamingController::Get())
+                {
+                    streamingController->DetachModel(this);
+                }
+            }
+        }
+
         size_t Model::GetLodCount() const
         {
             return m_lods.size();
@@ -81,6 +94,12 @@ namespace AZ
 
             m_lods.resize(modelAsset->GetLodAssets().size());
 
+            // Only the least detailed lods are created with the model while its lods stream in, see ModelLodStreamingController
+            ModelLodStreamingController* streamingController = ModelLodStreamingController::Get();
+            const size_t residentLodCount = ModelLodStreamingController::GetResidentLodCount();
+            m_isLodStreamingEnabled = streamingController && ModelLodStreamingController::IsEnabled() && m_lods.size() > residentLodCount;
+            const size_t firstResidentLodIndex = m_isLodStreamingEnabled ? m_lods.size() - residentLodCount : 0;
+
             for (size_t lodIndex = 0; lodIndex < m_lods.size(); ++lodIndex)
             {
                 const auto lodAssets = modelAsset->GetLodAssets();
@@ -92,37 +111,147 @@ namespace AZ
                     return RHI::ResultCode::Fail;
                 }
 
+                CollectUvNames(*lodAsset);
+
+                if (lodIndex < firstResidentLodIndex)
+                {
+                    continue;
+                }
+
                 Data::Instance<ModelLod> lodInstance = ModelLod::FindOrCreate(lodAsset, modelAsset);
                 if (lodInstance == nullptr)
                 {
                     return RHI::ResultCode::Fail;
                 }
 
-                for (const AZ::RPI::ModelLod::Mesh& mesh : lodInstance->GetMeshes())
+                m_lods[lodIndex] = AZStd::move(lodInstance);
+            }
+
+            m_modelAsset = modelAsset;
+            m_isUploadPending = true;
+
+            if (m_isLodStreamingEnabled)
+            {
+                streamingController->AttachModel(this);
+            }
+            return RHI::ResultCode::Success;
+        }
+
+        void Model::CollectUvNames(const ModelLodAsset& lodAsset)
+        {
+            for (const ModelLodAsset::Mesh& mesh : lodAsset.GetMeshes())
+            {
+                for (const ModelLodAsset::Mesh::StreamBufferInfo& stream : mesh.GetStreamBufferInfoList())
                 {
-                    for (const AZ::RPI::ModelLod::StreamBufferInfo& stream : mesh.m_streamInfo)
+                    if (stream.m_semantic.m_name.GetStringView().starts_with(RHI::ShaderSemantic::UvStreamSemantic))
                     {
-                        if (stream.m_semantic.m_name.GetStringView().starts_with(RHI::ShaderSemantic::UvStreamSemantic))
+                        // For unnamed UVs, use the semantic instead.
+                        if (stream.m_customName.IsEmpty())
+                        {
+                            m_uvNames.insert(AZ::Name(stream.m_semantic.ToString()));
+                        }
+                        else
                         {
-                            // For unnamed UVs, use the semantic instead.
-                            if (stream.m_customName.IsEmpty())
-                            {
-                                m_uvNames.insert(AZ::Name(stream.m_semantic.ToString()));
-                            }
-                            else
-                            {
-                                m_uvNames.insert(stream.m_customName);
-                            }
+                            m_uvNames.insert(stream.m_customName);
                         }
                     }
                 }
+            }
+        }
 
-                m_lods[lodIndex] = AZStd::move(lodInstance);
+        bool Model::IsLodStreamingEnabled() const
+        {
+            return m_isLodStreamingEnabled;
+        }
+
+        bool Model::IsLodResident(size_t lodIndex) const
+        {
+            return lodIndex < m_lods.size() && m_lods[lodIndex];
+        }
+
+        size_t Model::GetResidentLodIndex(size_t lodIndex) const
+        {
+            for (size_t residentLodIndex = lodIndex; residentLodIndex < m_lods.size(); ++residentLodIndex)
+            {
+                if (m_lods[residentLodIndex])
+                {
+                    return residentLodIndex;
+                }
             }
+            return m_lods.empty() ? 0 : m_lods.size() - 1;
+        }
 
-            m_modelAsset = modelAsset;
+        void Model::RequestLod(size_t lodIndex)
+        {
+            const uint32_t requestedLodIndex = aznumeric_cast<uint32_t>(lodIndex);
+            uint32_t currentLodIndex = m_requestedLodIndex.load(AZStd::memory_order_relaxed);
+            while (requestedLodIndex < currentLodIndex &&
+                   !m_requestedLodIndex.compare_exchange_weak(currentLodIndex, requestedLodIndex, AZStd::memory_order_relaxed))
+            {
+            }
+        }
+
+        uint32_t Model::ConsumeLodRequest()
+        {
+            return m_requestedLodIndex.exchange(NoLodRequest, AZStd::memory_order_relaxed);
+        }
+
+        void Model::DisableLodStreaming()
+        {
+            if (!m_isLodStreamingEnabled)
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "Model::DisableLodStreaming - %s", GetDatabaseName());
+            if (ModelLodStreamingController* streamingController = ModelLodStreamingController::Get())
+            {
+                streamingController->DetachModel(this);
+            }
+            m_isLodStreamingEnabled = false;
+
+            // Blocks until the buffer assets of every lod are loaded
+            m_modelAsset->AddRefBufferAssets();
+
+            bool residencyChanged = false;
+            for (size_t lodIndex = 0; lodIndex < m_lods.size(); ++lodIndex)
+            {
+                if (!m_lods[lodIndex])
+                {
+                    residencyChanged |= CreateLod(lodIndex);
+                }
+            }
+
+            m_modelAsset->ReleaseRefBufferAssets();
+
+            if (residencyChanged)
+            {
+                m_lodResidencyChangedEvent.Signal();
+            }
+        }
+
+        bool Model::CreateLod(size_t lodIndex)
+        {
+            Data::Instance<ModelLod> lodInstance = ModelLod::FindOrCreate(m_modelAsset->GetLodAssets()[lodIndex], m_modelAsset);
+            if (!lodInstance)
+            {
+                AZ_Error("Model", false, "Failed to create lod %zu of model '%s'", lodIndex, m_modelAsset.GetHint().c_str());
+                return false;
+            }
+
+            m_lods[lodIndex] = AZStd::move(lodInstance);
             m_isUploadPending = true;
-            return RHI::ResultCode::Success;
+            return true;
+        }
+
+        void Model::EvictLod(size_t lodIndex)
+        {
+            m_lods[lodIndex] = nullptr;
+        }
+
+        void Model::ConnectLodResidencyChangedHandler(LodResidencyChangedEvent::Handler& handler)
+        {
+            handler.Connect(m_lodResidencyChangedEvent);
         }
 
         void Model::WaitForUpload()
@@ -132,7 +261,10 @@ namespace AZ
                 AZ_PROFILE_SCOPE(RPI, "Model::WaitForUpload - %s", GetDatabaseName());
                 for (const Data::Instance<ModelLod>& lod : m_lods)
                 {
-                    lod->WaitForUpload();
+                    if (lod)
+                    {
+                        lod->WaitForUpload();
+                    }
                 }
                 m_isUploadPending = false;
             }
@@ -438,5 +438,15 @@ namespace AZ
             m_buffers.clear();
         }
 
+        uint64_t ModelLod::GetBufferMemoryUsage() const
+        {
+            uint64_t byteCount = 0;
+            for (const Data::Instance<Buffer>& buffer : m_buffers)
+            {
+                byteCount += buffer->GetBufferSize();
+            }
+            return byteCount;
+        }
+
     } // namespace RPI
 } // namespace AZ
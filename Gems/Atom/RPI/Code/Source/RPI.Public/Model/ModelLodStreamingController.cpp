@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Model/ModelLodStreamingController.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(bool, r_modelLodStreaming, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Stream the more detailed lods of models in once culling selects them, instead of creating every lod with the model. "
+            "Only affects the models created after it changes");
+        AZ_CVAR(uint32_t, r_modelLodStreamingResidentLodCount, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of least detailed lods models always keep resident while their lods stream in");
+        AZ_CVAR(uint32_t, r_modelLodStreamingBudgetMB, 512, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The memory budget of the buffers of the streamed in model lods, in MB. The lods selected the least recently are evicted "
+            "when it's exceeded, 0 never evicts them");
+        AZ_CVAR(uint32_t, r_modelLodStreamingMaxLoadingLods, 8, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The maximum number of model lods whose buffers load at the same time");
+
+        ModelLodStreamingController* ModelLodStreamingController::Get()
+        {
+            return Interface<ModelLodStreamingController>::Get();
+        }
+
+        bool ModelLodStreamingController::IsEnabled()
+        {
+            return r_modelLodStreaming;
+        }
+
+        size_t ModelLodStreamingController::GetResidentLodCount()
+        {
+            return AZStd::max<size_t>(r_modelLodStreamingResidentLodCount, 1);
+        }
+
+        ModelLodStreamingController::~ModelLodStreamingController()
+        {
+            Shutdown();
+        }
+
+        void ModelLodStreamingController::Init()
+        {
+            Interface<ModelLodStreamingController>::Register(this);
+        }
+
+        void ModelLodStreamingController::Shutdown()
+        {
+            if (Interface<ModelLodStreamingController>::Get() == this)
+            {
+                Interface<ModelLodStreamingController>::Unregister(this);
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_models.clear();
+            m_streamedMemoryUsage = 0;
+            m_loadingLodCount = 0;
+        }
+
+        void ModelLodStreamingController::AttachModel(Model* model)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            ModelStreamingState& state = m_models[model];
+            state.m_streamableLodCount = model->GetLodCount() - GetResidentLodCount();
+        }
+
+        void ModelLodStreamingController::DetachModel(Model* model)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto modelIt = m_models.find(model);
+            if (modelIt == m_models.end())
+            {
+                return;
+            }
+
+            const ModelStreamingState& state = modelIt->second;
+            for (uint64_t lodMemoryUsage : state.m_lodMemoryUsage)
+            {
+                m_streamedMemoryUsage -= lodMemoryUsage;
+            }
+            if (state.m_loadingLodIndex != Model::NoLodRequest)
+            {
+                --m_loadingLodCount;
+            }
+            m_models.erase(modelIt);
+        }
+
+        void ModelLodStreamingController::Update()
+        {
+            AZ_PROFILE_SCOPE(RPI, "ModelLodStreamingController: Update");
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            ++m_updateCount;
+
+            AZStd::vector<Model*> changedModels;
+            for (auto& [model, state] : m_models)
+            {
+                if (UpdateModel(*model, state))
+                {
+                    changedModels.push_back(model);
+                }
+            }
+
+            EvictOverBudget(changedModels);
+
+            // The mesh feature processors rebuild the draw packets of the meshes of these models. A model can appear twice if it
+            // streamed in a lod then evicted another one, which only costs it a redundant rebuild.
+            for (Model* model : changedModels)
+            {
+                model->m_lodResidencyChangedEvent.Signal();
+            }
+        }
+
+        bool ModelLodStreamingController::UpdateModel(Model& model, ModelStreamingState& state)
+        {
+            bool residencyChanged = false;
+
+            // Finish the lod that was loading first, so the model can start loading a new request right away
+            if (state.m_loadingLodIndex != Model::NoLodRequest)
+            {
+                const size_t lodIndex = state.m_loadingLodIndex;
+                const Data::AssetData::AssetStatus status = model.m_modelAsset->QueueLoadLodBufferAssets(lodIndex);
+                if (status == Data::AssetData::AssetStatus::Ready)
+                {
+                    if (model.CreateLod(lodIndex))
+                    {
+                        state.m_lodMemoryUsage[lodIndex] = model.m_lods[lodIndex]->GetBufferMemoryUsage();
+                        state.m_lastRequestUpdate[lodIndex] = m_updateCount;
+                        m_streamedMemoryUsage += state.m_lodMemoryUsage[lodIndex];
+                        residencyChanged = true;
+                    }
+                    else
+                    {
+                        state.m_hasFailed = true;
+                    }
+
+                    // The buffers keep their data until they are uploaded
+                    model.m_modelAsset->ReleaseLodBufferAssets(lodIndex);
+                    state.m_loadingLodIndex = Model::NoLodRequest;
+                    --m_loadingLodCount;
+                }
+                else if (status == Data::AssetData::AssetStatus::Error)
+                {
+                    AZ_Warning("ModelLodStreamingController", false, "Failed to load the buffers of lod %zu of model '%s', its lods won't be streamed in any more.",
+                        lodIndex, model.m_modelAsset.GetHint().c_str());
+                    state.m_hasFailed = true;
+                    state.m_loadingLodIndex = Model::NoLodRequest;
+                    --m_loadingLodCount;
+                }
+            }
+
+            const uint32_t requestedLodIndex = model.ConsumeLodRequest();
+            if (requestedLodIndex >= model.m_lods.size())
+            {
+                return residencyChanged;
+            }
+
+            // Culling draws the resident lod while the requested one isn't streamed in, so both are in use
+            const size_t residentLodIndex = model.GetResidentLodIndex(requestedLodIndex);
+            state.m_lastRequestUpdate[requestedLodIndex] = m_updateCount;
+            state.m_lastRequestUpdate[residentLodIndex] = m_updateCount;
+
+            if (residentLodIndex != requestedLodIndex && !state.m_hasFailed && state.m_loadingLodIndex == Model::NoLodRequest &&
+                m_loadingLodCount < r_modelLodStreamingMaxLoadingLods)
+            {
+                // Requests of models that can't start loading now are repeated by culling the next frames
+                state.m_loadingLodIndex = requestedLodIndex;
+                ++m_loadingLodCount;
+                model.m_modelAsset->QueueLoadLodBufferAssets(requestedLodIndex);
+            }
+
+            return residencyChanged;
+        }
+
+        void ModelLodStreamingController::EvictOverBudget(AZStd::vector<Model*>& changedModels)
+        {
+            const uint64_t budget = aznumeric_cast<uint64_t>(static_cast<uint32_t>(r_modelLodStreamingBudgetMB)) * 1024 * 1024;
+            if (budget == 0)
+            {
+                return;
+            }
+
+            while (m_streamedMemoryUsage > budget)
+            {
+                // Lods used by the latest update are never evicted, on ties the more detailed lods go first
+                Model* evictedModel = nullptr;
+                ModelStreamingState* evictedState = nullptr;
+                size_t evictedLodIndex = 0;
+                uint64_t oldestRequestUpdate = m_updateCount;
+                for (auto& [model, state] : m_models)
+                {
+                    for (size_t lodIndex = 0; lodIndex < state.m_streamableLodCount; ++lodIndex)
+                    {
+                        if (state.m_lodMemoryUsage[lodIndex] > 0 && state.m_lastRequestUpdate[lodIndex] < oldestRequestUpdate)
+                        {
+                            evictedModel = model;
+                            evictedState = &state;
+                            evictedLodIndex = lodIndex;
+                            oldestRequestUpdate = state.m_lastRequestUpdate[lodIndex];
+                        }
+                    }
+                }
+
+                if (!evictedModel)
+                {
+                    break;
+                }
+
+                m_streamedMemoryUsage -= evictedState->m_lodMemoryUsage[evictedLodIndex];
+                evictedState->m_lodMemoryUsage[evictedLodIndex] = 0;
+                evictedModel->EvictLod(evictedLodIndex);
+                changedModels.push_back(evictedModel);
+            }
+        }
+
+        uint64_t ModelLodStreamingController::GetStreamedMemoryUsage() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_streamedMemoryUsage;
+        }
+
+        uint32_t ModelLodStreamingController::GetLoadingLodCount() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_loadingLodCount;
+        }
+
+        uint32_t ModelLodStreamingController::GetStreamingModelCount() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return aznumeric_cast<uint32_t>(m_models.size());
+        }
+    } // namespace RPI
+} // namespace AZ
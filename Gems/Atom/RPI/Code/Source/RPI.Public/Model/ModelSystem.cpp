@@ -56,12 +56,21 @@ namespace AZ
                 return Model::CreateInternal(Data::Asset<ModelAsset>{modelAsset, AZ::Data::AssetLoadBehavior::PreLoad});
             };
             Data::InstanceDatabase<Model>::Create(azrtti_typeid<ModelAsset>(), modelInstanceHandler);
+
+            m_lodStreamingController.Init();
         }
 
         void ModelSystem::Shutdown()
         {
             Data::InstanceDatabase<Model>::Destroy();
             Data::InstanceDatabase<ModelLod>::Destroy();
+
+            m_lodStreamingController.Shutdown();
+        }
+
+        void ModelSystem::Update()
+        {
+            m_lodStreamingController.Update();
         }
     } // namespace RPI
 } // namespace AZ
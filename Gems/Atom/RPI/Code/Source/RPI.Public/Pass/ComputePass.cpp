@@ -96,6 +96,7 @@ namespace AZ
             {
                 m_hardwareQueueClass = RHI::HardwareQueueClass::Compute;
             }
+            m_allowAsyncCompute = passData->m_allowAsyncCompute && !passData->m_useAsyncCompute;
 
             // Load Shader
             Data::Asset<ShaderAsset> shaderAsset;
@@ -175,6 +176,12 @@ namespace AZ
 
         // Scope producer functions
 
+        void ComputePass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
+        {
+            RenderPass::SetupFrameGraphDependencies(frameGraph);
+            frameGraph.SetAsyncComputeAllowed(m_allowAsyncCompute);
+        }
+
         void ComputePass::CompileResources(const RHI::FrameGraphCompileContext& context)
         {
             if (m_shaderResourceGroup != nullptr)
@@ -173,7 +173,7 @@ namespace AZ
                 const ViewPtr& view = views.front();
 
                 // Draw List. May return an empty list, and that's ok.
-                viewDrawList = view->GetDrawList(m_drawListTag);
+                viewDrawList = GetViewDrawList(*view);
             }
 
             // clean up data
@@ -212,6 +212,11 @@ namespace AZ
             m_drawListView = m_combinedDrawList;
         }
 
+        RHI::DrawListView RasterPass::GetViewDrawList(View& view) const
+        {
+            return view.GetDrawList(m_drawListTag);
+        }
+
         // --- DrawList and PipelineView Tags ---
 
         RHI::DrawListTag RasterPass::GetDrawListTag() const
@@ -226,7 +231,45 @@ namespace AZ
             DeclareAttachmentsToFrameGraph(frameGraph);
             DeclarePassDependenciesToFrameGraph(frameGraph);
             AddScopeQueryToFrameGraph(frameGraph);
-            frameGraph.SetEstimatedItemCount(static_cast<uint32_t>(m_drawListView.size()));
+
+            // Buffers written on the GPU earlier in the frame that the view's draw items read from, like GPU culled instance lists
+            // and indirect draw arguments. Only the ones imported this frame are used, a producer that didn't run has nothing to wait on.
+            const AZStd::vector<ViewPtr>& views = m_pipeline->GetViews(GetPipelineViewTag());
+            if (!views.empty())
+            {
+                for (const View::DrawBufferAttachment& attachment : views.front()->GetDrawBufferAttachments())
+                {
+                    if (frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachment.m_descriptor.m_attachmentId))
+                    {
+                        frameGraph.UseAttachment(attachment.m_descriptor, RHI::ScopeAttachmentAccess::Read, attachment.m_usage, attachment.m_stage);
+                    }
+                }
+            }
+
+            // Weight each draw by the state it binds, so splitting the pass across command lists balances recording time
+            // rather than item count. Draws filtered out by the pipeline are never recorded and cost nothing.
+            int deviceIndex = RHI::ScopeProducer::GetDeviceIndex();
+            if (deviceIndex == RHI::MultiDevice::InvalidDeviceIndex)
+            {
+                deviceIndex = RHI::MultiDevice::DefaultDeviceIndex;
+            }
+            const RHI::DrawFilterMask drawFilterMask = m_pipeline->GetDrawFilterMask();
+            m_drawItemCosts.resize(m_drawListView.size());
+            for (size_t index = 0; index < m_drawListView.size(); ++index)
+            {
+                const RHI::DrawItemProperties& drawItemProperties = m_drawListView[index];
+                if (drawItemProperties.m_drawFilterMask & drawFilterMask)
+                {
+                    const RHI::DeviceDrawItem& drawItem = drawItemProperties.m_item->GetDeviceDrawItem(deviceIndex);
+                    m_drawItemCosts[index] = 1 + drawItem.m_shaderResourceGroupCount + (drawItem.m_uniqueShaderResourceGroup ? 1 : 0) +
+                        (drawItem.m_rootConstantSize > 0 ? 1 : 0);
+                }
+                else
+                {
+                    m_drawItemCosts[index] = 0;
+                }
+            }
+            frameGraph.SetEstimatedItemCosts(m_drawItemCosts);
         }
 
         void RasterPass::CompileResources(const RHI::FrameGraphCompileContext& context)
@@ -49,6 +49,9 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_pipelinedRendering, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Execute the frame graph of a frame on the render thread while the main thread simulates the next frame.");
+
         RPISystemInterface* RPISystemInterface::Get()
         {
             return Interface<RPISystemInterface>::Get();
@@ -113,6 +116,7 @@ namespace AZ
 
         void RPISystem::Shutdown()
         {
+            StopRenderThread();
             m_viewportContextManager.Shutdown();
             m_viewSrgLayout = nullptr;
             m_sceneSrgLayout = nullptr;
@@ -172,6 +176,9 @@ namespace AZ
 
         void RPISystem::UnregisterScene(ScenePtr scene)
         {
+            // The frame in flight may still reference the scene's draw packets and passes
+            WaitForRenderFrame();
+
             for (auto itr = m_scenes.begin(); itr != m_scenes.end(); itr++)
             {
                 if (*itr == scene)
@@ -262,18 +269,28 @@ namespace AZ
 
             // Image system update is using system tick but not game tick so it can stream images in background even game is pausing
             m_imageSystem.Update();
+
+            // Model lods stream the same way
+            m_modelSystem.Update();
         }
 
         void RPISystem::SimulationTick()
         {
             if (!m_systemAssetsInitialized || IsNullRenderer())
             {
+                m_materialSystem.CompileQueuedMaterials();
                 return;
             }
             AZ_PROFILE_SCOPE(RPI, "RPISystem: SimulationTick");
 
+            // The feature processors update the draw packets and buffers the frame in flight uses
+            WaitForRenderFrame();
+
             AssetInitBus::Broadcast(&AssetInitBus::Events::PostLoadInit);
 
+            // Compile the materials whose properties changed since the last tick, so the scenes pick up the changes
+            m_materialSystem.CompileQueuedMaterials();
+
             m_currentSimulationTime = GetCurrentTime();
 
             for (auto& scene : m_scenes)
@@ -326,6 +343,9 @@ namespace AZ
 
             AZ_PROFILE_SCOPE(RPI, "RPISystem: RenderTick");
 
+            // This is a no-op after SimulationTick, which already ended the frame in flight
+            WaitForRenderFrame();
+
             // Query system update is to increment the frame count
             m_querySystem.Update();
 
@@ -344,34 +364,110 @@ namespace AZ
             }
             m_rhiSystem.SetNumActiveRenderPipelines(numActiveRenderPipelines);
 
-            m_rhiSystem.FrameUpdate(
-                [this](RHI::FrameGraphBuilder& frameGraphBuilder)
-                {
-                    // Pass system's frame update, which includes the logic of adding scope producers, has to be added here since the
-                    // scope producers only can be added to the frame when frame started which cleans up previous scope producers.
-                    m_passSystem.FrameUpdate(frameGraphBuilder);
-
-                    // Update Scene and View Srgs
-                    for (auto& scenePtr : m_scenes)
-                    {
-                        scenePtr->UpdateSrgs();
-                    }
-                });
+            // Upload the parameters of the materials compiled this frame before the scene SRGs reference them.
+            m_materialSystem.FrameUpdate();
 
+            auto frameGraphCallback = [this](RHI::FrameGraphBuilder& frameGraphBuilder)
             {
-                AZ_PROFILE_SCOPE(RPI, "RPISystem: FrameEnd");
-                m_dynamicDraw.FrameEnd();
-                m_passSystem.FrameEnd();
+                // Pass system's frame update, which includes the logic of adding scope producers, has to be added here since the
+                // scope producers only can be added to the frame when frame started which cleans up previous scope producers.
+                m_passSystem.FrameUpdate(frameGraphBuilder);
 
+                // Update Scene and View Srgs
                 for (auto& scenePtr : m_scenes)
                 {
-                    scenePtr->OnFrameEnd();
+                    scenePtr->UpdateSrgs();
                 }
+            };
+
+            if (r_pipelinedRendering)
+            {
+                // Everything that reads the scene is done by FramePrepare, the render thread only records and submits the frame graph
+                StartRenderThread();
+                m_rhiSystem.FramePrepare(frameGraphCallback);
+                m_isRenderFrameInFlight = true;
+                m_renderFrameStart.release();
+            }
+            else
+            {
+                StopRenderThread();
+                m_rhiSystem.FrameUpdate(frameGraphCallback);
+                FrameEnd();
             }
 
             m_renderTick++;
         }
 
+        void RPISystem::WaitForRenderFrame()
+        {
+            if (!m_isRenderFrameInFlight)
+            {
+                return;
+            }
+
+            {
+                AZ_PROFILE_SCOPE(RPI, "RPISystem: WaitForRenderFrame");
+                m_renderFrameDone.acquire();
+            }
+            m_isRenderFrameInFlight = false;
+            FrameEnd();
+        }
+
+        bool RPISystem::IsRenderFrameInFlight() const
+        {
+            return m_isRenderFrameInFlight;
+        }
+
+        void RPISystem::FrameEnd()
+        {
+            AZ_PROFILE_SCOPE(RPI, "RPISystem: FrameEnd");
+            m_dynamicDraw.FrameEnd();
+            m_passSystem.FrameEnd();
+
+            for (auto& scenePtr : m_scenes)
+            {
+                scenePtr->OnFrameEnd();
+            }
+        }
+
+        void RPISystem::StartRenderThread()
+        {
+            if (m_renderThread.joinable())
+            {
+                return;
+            }
+
+            m_isRenderThreadQuitting = false;
+            AZStd::thread_desc threadDesc{ "RPI Render Thread" };
+            m_renderThread = AZStd::thread(threadDesc, [this]()
+            {
+                while (true)
+                {
+                    m_renderFrameStart.acquire();
+                    if (m_isRenderThreadQuitting)
+                    {
+                        break;
+                    }
+                    m_rhiSystem.FrameExecute();
+                    m_renderFrameDone.release();
+                }
+            });
+        }
+
+        void RPISystem::StopRenderThread()
+        {
+            if (!m_renderThread.joinable())
+            {
+                return;
+            }
+
+            WaitForRenderFrame();
+            m_isRenderThreadQuitting = true;
+            m_renderFrameStart.release();
+            m_renderThread.join();
+            m_renderThread = AZStd::thread();
+        }
+
         void RPISystem::SetSimulationJobPolicy(RHI::JobPolicy jobPolicy)
         {
             m_simulationJobPolicy = jobPolicy;
@@ -452,6 +548,15 @@ namespace AZ
             m_systemAssetsInitialized = true;
             AZ_TracePrintf("RPI system", "System assets initialized\n");
 
+            // Compile the pipeline states recorded in previous sessions before they are first drawn
+            if (!IsNullRenderer())
+            {
+                if (PipelineStatePrewarmer* pipelineStatePrewarmer = PipelineStatePrewarmer::Get())
+                {
+                    pipelineStatePrewarmer->PrewarmOnStartup();
+                }
+            }
+
             // Now that the asset system is up and running, we can safely initialize
             // the XR System and the XR Session.
             InitXRSystem();
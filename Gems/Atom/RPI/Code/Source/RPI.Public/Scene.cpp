@@ -10,6 +10,7 @@
 #include <Atom/RPI.Public/DynamicDraw/DynamicDrawSystem.h>
 #include <Atom/RPI.Public/FeatureProcessorFactory.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
+#include <Atom/RPI.Public/Material/MaterialParameterBuffer.h>
 #include <Atom/RPI.Public/Pass/FullscreenTrianglePass.h>
 #include <Atom/RPI.Public/Pass/RasterPass.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
@@ -560,6 +561,18 @@ namespace AZ
                 m_srg->SetConstant(m_timeInputIndex, m_simulationTime);
                 m_srg->SetConstant(m_prevTimeInputIndex, m_prevSimulationTime);
 
+                // Bind the material parameter buffer for the shaders that read materials from it.
+                MaterialParameterBuffer* parameterBuffer = MaterialParameterBuffer::Get();
+                if (parameterBuffer && parameterBuffer->GetBuffer())
+                {
+                    const RHI::ShaderInputBufferIndex bufferIndex =
+                        m_srg->FindShaderInputBufferIndex(Name(MaterialParameterBuffer::BufferSrgName));
+                    if (bufferIndex.IsValid())
+                    {
+                        m_srg->SetBufferView(bufferIndex, parameterBuffer->GetBuffer()->GetBufferView());
+                    }
+                }
+
                 // signal any handlers to update values for their partial scene srg
                 m_prepareSrgEvent.Signal(m_srg.get());
 
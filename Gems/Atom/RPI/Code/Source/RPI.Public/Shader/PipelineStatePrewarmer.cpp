@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Shader/PipelineStatePrewarmer.h>
+#include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Public/Shader/ShaderVariant.h>
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(bool, r_psoRecordUsage, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Record the pipeline states acquired from shaders, so they can be saved to the pipeline state prewarm list with r_psoSaveUsage");
+        AZ_CVAR(AZ::CVarFixedString, r_psoPrewarmListPath, "@user@/Atom/PipelineStatePrewarmList.xml", nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The pipeline state prewarm list that r_psoSaveUsage merges the recorded pipeline states into and r_psoPrewarm compiles");
+        AZ_CVAR(bool, r_psoPrewarmOnStartup, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Compile the pipeline states of the prewarm list once the RPI system assets are initialized");
+        AZ_CVAR(uint32_t, r_psoPrewarmBudgetPerTick, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The maximum number of prewarm list pipeline states compiled in parallel each tick");
+        AZ_CVAR(uint32_t, r_psoPrewarmMaxWaitTicks, 600, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of ticks to wait for the shader variant of a prewarm list pipeline state to load before giving up on it");
+
+        static void r_psoSaveUsage([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            if (PipelineStatePrewarmer* prewarmer = PipelineStatePrewarmer::Get())
+            {
+                prewarmer->SaveUsage();
+            }
+        }
+        AZ_CONSOLEFREEFUNC(r_psoSaveUsage, AZ::ConsoleFunctorFlags::Null,
+            "Merges the pipeline states recorded while r_psoRecordUsage is set into the prewarm list at r_psoPrewarmListPath");
+
+        static void r_psoPrewarm([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            if (PipelineStatePrewarmer* prewarmer = PipelineStatePrewarmer::Get())
+            {
+                prewarmer->Prewarm();
+            }
+        }
+        AZ_CONSOLEFREEFUNC(r_psoPrewarm, AZ::ConsoleFunctorFlags::Null,
+            "Compiles the pipeline states of the prewarm list at r_psoPrewarmListPath over the next ticks");
+
+        void PipelineStateUsageRecord::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateUsageRecord>()
+                    ->Version(0)
+                    ->Field("ShaderAssetId", &PipelineStateUsageRecord::m_shaderAssetId)
+                    ->Field("SupervariantName", &PipelineStateUsageRecord::m_supervariantName)
+                    ->Field("ShaderVariantId", &PipelineStateUsageRecord::m_shaderVariantId)
+                    ->Field("ShaderVariantStableId", &PipelineStateUsageRecord::m_shaderVariantStableId)
+                    ->Field("SpecializationIds", &PipelineStateUsageRecord::m_specializationIds)
+                    ->Field("SpecializationValues", &PipelineStateUsageRecord::m_specializationValues)
+                    ->Field("RenderStates", &PipelineStateUsageRecord::m_renderStates)
+                    ->Field("InputStreamLayout", &PipelineStateUsageRecord::m_inputStreamLayout)
+                    ->Field("RenderAttachmentConfiguration", &PipelineStateUsageRecord::m_renderAttachmentConfiguration)
+                    ->Field("DescriptorHash", &PipelineStateUsageRecord::m_descriptorHash)
+                    ;
+            }
+        }
+
+        void PipelineStatePrewarmList::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStatePrewarmList>()
+                    ->Version(0)
+                    ->Field("Records", &PipelineStatePrewarmList::m_records)
+                    ;
+            }
+        }
+
+        void PipelineStatePrewarmer::Reflect(ReflectContext* context)
+        {
+            PipelineStateUsageRecord::Reflect(context);
+            PipelineStatePrewarmList::Reflect(context);
+        }
+
+        PipelineStatePrewarmer* PipelineStatePrewarmer::Get()
+        {
+            return Interface<PipelineStatePrewarmer>::Get();
+        }
+
+        PipelineStatePrewarmer::~PipelineStatePrewarmer()
+        {
+            Shutdown();
+        }
+
+        void PipelineStatePrewarmer::Init()
+        {
+            Interface<PipelineStatePrewarmer>::Register(this);
+        }
+
+        void PipelineStatePrewarmer::Shutdown()
+        {
+            if (Interface<PipelineStatePrewarmer>::Get() == this)
+            {
+                Interface<PipelineStatePrewarmer>::Unregister(this);
+            }
+
+            SystemTickBus::Handler::BusDisconnect();
+            m_pendingRecords.clear();
+            m_prewarmedShaders.clear();
+        }
+
+        bool PipelineStatePrewarmer::IsRecordingUsage()
+        {
+            return r_psoRecordUsage;
+        }
+
+        bool PipelineStatePrewarmer::IsRecorded(HashValue64 descriptorHash) const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+            return m_recordedHashes.find(static_cast<uint64_t>(descriptorHash)) != m_recordedHashes.end();
+        }
+
+        void PipelineStatePrewarmer::RecordUsage(const Shader& shader, const ShaderVariant& variant, const RHI::PipelineStateDescriptor& descriptor)
+        {
+            PipelineStateUsageRecord record;
+            record.m_descriptorHash = static_cast<uint64_t>(descriptor.GetHash());
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+                if (!m_recordedHashes.insert(record.m_descriptorHash).second)
+                {
+                    return;
+                }
+            }
+
+            const Data::Asset<ShaderAsset>& shaderAsset = shader.GetAsset();
+            record.m_shaderAssetId = shaderAsset.GetId();
+            record.m_supervariantName = shaderAsset->GetSupervariantName(shader.GetSupervariantIndex());
+            record.m_shaderVariantId = variant.GetShaderVariantId();
+            record.m_shaderVariantStableId = variant.GetStableId().GetIndex();
+
+            for (const RHI::SpecializationConstant& specializationConstant : descriptor.m_specializationData)
+            {
+                record.m_specializationIds.push_back(specializationConstant.m_id);
+                record.m_specializationValues.push_back(specializationConstant.m_value.GetIndex());
+            }
+
+            if (descriptor.GetType() == RHI::PipelineStateType::Draw)
+            {
+                const auto& descriptorForDraw = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor);
+                record.m_renderStates = descriptorForDraw.m_renderStates;
+                record.m_inputStreamLayout = descriptorForDraw.m_inputStreamLayout;
+                record.m_renderAttachmentConfiguration = descriptorForDraw.m_renderAttachmentConfiguration;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+            m_recordedUsage.push_back(AZStd::move(record));
+        }
+
+        AZStd::string PipelineStatePrewarmer::GetResolvedListPath() const
+        {
+            const AZ::CVarFixedString listPath = r_psoPrewarmListPath;
+            if (auto* fileIOBase = IO::FileIOBase::GetInstance())
+            {
+                char resolvedPath[AZ_MAX_PATH_LEN];
+                if (fileIOBase->ResolvePath(listPath.c_str(), resolvedPath, AZ_MAX_PATH_LEN))
+                {
+                    return resolvedPath;
+                }
+            }
+            return listPath.c_str();
+        }
+
+        bool PipelineStatePrewarmer::SaveUsage()
+        {
+            const AZStd::string listPath = GetResolvedListPath();
+
+            // Merge with the records of previous sessions, so the list covers everything that was played
+            PipelineStatePrewarmList prewarmList;
+            if (IO::FileIOBase::GetInstance() && IO::FileIOBase::GetInstance()->Exists(listPath.c_str()))
+            {
+                AZ::Utils::LoadObjectFromFileInPlace(listPath, prewarmList);
+            }
+
+            AZStd::unordered_set<uint64_t> listedHashes;
+            for (const PipelineStateUsageRecord& record : prewarmList.m_records)
+            {
+                listedHashes.insert(record.m_descriptorHash);
+            }
+
+            size_t addedCount = 0;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+                for (const PipelineStateUsageRecord& record : m_recordedUsage)
+                {
+                    if (listedHashes.insert(record.m_descriptorHash).second)
+                    {
+                        prewarmList.m_records.push_back(record);
+                        ++addedCount;
+                    }
+                }
+            }
+
+            if (!AZ::Utils::SaveObjectToFile(listPath, DataStream::ST_XML, &prewarmList))
+            {
+                AZ_Error("PipelineStatePrewarmer", false, "Failed to save the pipeline state prewarm list to '%s'", listPath.c_str());
+                return false;
+            }
+
+            AZ_TracePrintf("PipelineStatePrewarmer", "Added %zu pipeline states to the prewarm list '%s', which now has %zu pipeline states\n",
+                addedCount, listPath.c_str(), prewarmList.m_records.size());
+            return true;
+        }
+
+        void PipelineStatePrewarmer::Prewarm()
+        {
+            const AZStd::string listPath = GetResolvedListPath();
+            if (!IO::FileIOBase::GetInstance() || !IO::FileIOBase::GetInstance()->Exists(listPath.c_str()))
+            {
+                return;
+            }
+
+            PipelineStatePrewarmList prewarmList;
+            if (!AZ::Utils::LoadObjectFromFileInPlace(listPath, prewarmList))
+            {
+                AZ_Warning("PipelineStatePrewarmer", false, "Failed to load the pipeline state prewarm list '%s'", listPath.c_str());
+                return;
+            }
+
+            Prewarm(prewarmList);
+        }
+
+        void PipelineStatePrewarmer::PrewarmOnStartup()
+        {
+            if (r_psoPrewarmOnStartup)
+            {
+                Prewarm();
+            }
+        }
+
+        void PipelineStatePrewarmer::Prewarm(const PipelineStatePrewarmList& prewarmList)
+        {
+            for (const PipelineStateUsageRecord& record : prewarmList.m_records)
+            {
+                PendingRecord& pending = m_pendingRecords.emplace_back();
+                pending.m_record = record;
+                pending.m_shaderAsset = Data::AssetManager::Instance().GetAsset<ShaderAsset>(record.m_shaderAssetId, Data::AssetLoadBehavior::PreLoad);
+            }
+
+            if (!m_pendingRecords.empty())
+            {
+                SystemTickBus::Handler::BusConnect();
+            }
+        }
+
+        bool PipelineStatePrewarmer::IsPrewarming() const
+        {
+            return !m_pendingRecords.empty();
+        }
+
+        uint32_t PipelineStatePrewarmer::GetRecordedCount() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+            return aznumeric_cast<uint32_t>(m_recordedUsage.size());
+        }
+
+        uint32_t PipelineStatePrewarmer::GetPendingCount() const
+        {
+            return aznumeric_cast<uint32_t>(m_pendingRecords.size());
+        }
+
+        uint32_t PipelineStatePrewarmer::GetCompiledCount() const
+        {
+            return m_compiledCount;
+        }
+
+        bool PipelineStatePrewarmer::BuildDescriptor(
+            PendingRecord& pending, Data::Instance<Shader>& shaderOut, AZStd::unique_ptr<RHI::PipelineStateDescriptor>& descriptorOut)
+        {
+            if (!pending.m_shaderAsset.IsReady())
+            {
+                return false;
+            }
+
+            shaderOut = Shader::FindOrCreate(pending.m_shaderAsset, pending.m_record.m_supervariantName);
+            if (!shaderOut)
+            {
+                return false;
+            }
+
+            // Shader variants load asynchronously, until the recorded one is ready this returns the root variant
+            const PipelineStateUsageRecord& record = pending.m_record;
+            const ShaderVariant& variant = shaderOut->GetVariant(record.m_shaderVariantId);
+            if (variant.GetStableId().GetIndex() != record.m_shaderVariantStableId)
+            {
+                return false;
+            }
+
+            const RHI::PipelineStateType pipelineStateType = shaderOut->GetPipelineStateType();
+            if (pipelineStateType == RHI::PipelineStateType::Draw)
+            {
+                auto descriptorForDraw = AZStd::make_unique<RHI::PipelineStateDescriptorForDraw>();
+                variant.ConfigurePipelineState(*descriptorForDraw, shaderOut->GetDefaultShaderOptions());
+                descriptorForDraw->m_renderStates = record.m_renderStates;
+                descriptorForDraw->m_inputStreamLayout = record.m_inputStreamLayout;
+                descriptorForDraw->m_renderAttachmentConfiguration = record.m_renderAttachmentConfiguration;
+                descriptorOut = AZStd::move(descriptorForDraw);
+            }
+            else if (pipelineStateType == RHI::PipelineStateType::Dispatch)
+            {
+                auto descriptorForDispatch = AZStd::make_unique<RHI::PipelineStateDescriptorForDispatch>();
+                variant.ConfigurePipelineState(*descriptorForDispatch, shaderOut->GetDefaultShaderOptions());
+                descriptorOut = AZStd::move(descriptorForDispatch);
+            }
+            else
+            {
+                // Ray tracing pipeline states aren't acquired from shaders, they are never recorded
+                return false;
+            }
+
+            // The default option values filled every specialization constant, overwrite them with the recorded values
+            for (RHI::SpecializationConstant& specializationConstant : descriptorOut->m_specializationData)
+            {
+                for (size_t index = 0; index < record.m_specializationIds.size() && index < record.m_specializationValues.size(); ++index)
+                {
+                    if (record.m_specializationIds[index] == specializationConstant.m_id)
+                    {
+                        specializationConstant.m_value = RHI::SpecializationValue(record.m_specializationValues[index]);
+                        break;
+                    }
+                }
+            }
+            return true;
+        }
+
+        void PipelineStatePrewarmer::OnSystemTick()
+        {
+            AZ_PROFILE_SCOPE(RPI, "PipelineStatePrewarmer: OnSystemTick");
+
+            struct CompileItem
+            {
+                Data::Instance<Shader> m_shader;
+                AZStd::unique_ptr<RHI::PipelineStateDescriptor> m_descriptor;
+            };
+            AZStd::vector<CompileItem> compileItems;
+
+            const uint32_t budget = AZStd::max(static_cast<uint32_t>(r_psoPrewarmBudgetPerTick), 1u);
+            const uint32_t maxWaitTicks = r_psoPrewarmMaxWaitTicks;
+            for (size_t index = 0; index < m_pendingRecords.size() && compileItems.size() < budget;)
+            {
+                PendingRecord& pending = m_pendingRecords[index];
+                CompileItem compileItem;
+                bool removeRecord = false;
+                if (BuildDescriptor(pending, compileItem.m_shader, compileItem.m_descriptor))
+                {
+                    compileItems.push_back(AZStd::move(compileItem));
+                    removeRecord = true;
+                }
+                else if (pending.m_shaderAsset.IsError() || ++pending.m_waitedTicks > maxWaitTicks)
+                {
+                    AZ_Warning("PipelineStatePrewarmer", false, "Skipping a prewarm list pipeline state of shader '%s', its shader variant did not load",
+                        pending.m_shaderAsset.GetHint().c_str());
+                    removeRecord = true;
+                }
+
+                if (removeRecord)
+                {
+                    // Order doesn't matter, swap with the last record
+                    if (index + 1 < m_pendingRecords.size())
+                    {
+                        pending = AZStd::move(m_pendingRecords.back());
+                    }
+                    m_pendingRecords.pop_back();
+                }
+                else
+                {
+                    ++index;
+                }
+            }
+
+            if (!compileItems.empty())
+            {
+                AZ_PROFILE_SCOPE(RPI, "PipelineStatePrewarmer: Compile");
+
+                // The pipeline state cache is thread safe, compile the pipeline states on the job threads and wait for them within the
+                // tick, so none is in flight when the cache is compacted at the end of the frame
+                AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+                if (jobContext && compileItems.size() > 1)
+                {
+                    AZ::JobCompletion jobCompletion(jobContext);
+                    for (CompileItem& compileItem : compileItems)
+                    {
+                        AZ::Job* compileJob = AZ::CreateJobFunction(
+                            [&compileItem]()
+                            {
+                                compileItem.m_shader->AcquirePipelineState(*compileItem.m_descriptor);
+                            },
+                            true, jobContext);
+                        compileJob->SetDependent(&jobCompletion);
+                        compileJob->Start();
+                    }
+                    jobCompletion.StartAndWaitForCompletion();
+                }
+                else
+                {
+                    for (CompileItem& compileItem : compileItems)
+                    {
+                        compileItem.m_shader->AcquirePipelineState(*compileItem.m_descriptor);
+                    }
+                }
+
+                // Keep the shaders alive so their pipeline libraries, and the prewarmed pipeline states in them, stay resident
+                for (CompileItem& compileItem : compileItems)
+                {
+                    if (AZStd::find(m_prewarmedShaders.begin(), m_prewarmedShaders.end(), compileItem.m_shader) == m_prewarmedShaders.end())
+                    {
+                        m_prewarmedShaders.push_back(AZStd::move(compileItem.m_shader));
+                    }
+                }
+                m_compiledCount += aznumeric_cast<uint32_t>(compileItems.size());
+            }
+
+            if (m_pendingRecords.empty())
+            {
+                AZ_TracePrintf("PipelineStatePrewarmer", "Prewarmed %u pipeline states\n", m_compiledCount);
+                SystemTickBus::Handler::BusDisconnect();
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -11,6 +11,7 @@
 #include <Atom/RHI/PipelineStateCache.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <AtomCore/Instance/InstanceDatabase.h>
+#include <Atom/RPI.Public/Shader/PipelineStatePrewarmer.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
@@ -471,9 +472,61 @@ namespace AZ
 
         const RHI::PipelineState* Shader::AcquirePipelineState(const RHI::PipelineStateDescriptor& descriptor) const
         {
+            if (PipelineStatePrewarmer::IsRecordingUsage())
+            {
+                RecordPipelineStateUsage(descriptor);
+            }
             return m_pipelineStateCache->AcquirePipelineState(m_pipelineLibraryHandle, descriptor, m_asset->GetName());
         }
 
+        void Shader::RecordPipelineStateUsage(const RHI::PipelineStateDescriptor& descriptor) const
+        {
+            PipelineStatePrewarmer* pipelineStatePrewarmer = PipelineStatePrewarmer::Get();
+            if (!pipelineStatePrewarmer || pipelineStatePrewarmer->IsRecorded(descriptor.GetHash()))
+            {
+                return;
+            }
+
+            // The descriptor doesn't reference the variant it was configured from, find it from its stage functions
+            auto isConfiguredFromVariant = [&descriptor](const ShaderVariant& variant)
+            {
+                if (!variant.GetShaderVariantAsset())
+                {
+                    return false;
+                }
+
+                const ShaderVariantAsset& variantAsset = *variant.GetShaderVariantAsset();
+                if (descriptor.GetType() == RHI::PipelineStateType::Draw)
+                {
+                    const auto& descriptorForDraw = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor);
+                    return descriptorForDraw.m_vertexFunction.get() == variantAsset.GetShaderStageFunction(RHI::ShaderStage::Vertex) &&
+                        descriptorForDraw.m_fragmentFunction.get() == variantAsset.GetShaderStageFunction(RHI::ShaderStage::Fragment);
+                }
+                if (descriptor.GetType() == RHI::PipelineStateType::Dispatch)
+                {
+                    const auto& descriptorForDispatch = static_cast<const RHI::PipelineStateDescriptorForDispatch&>(descriptor);
+                    return descriptorForDispatch.m_computeFunction.get() == variantAsset.GetShaderStageFunction(RHI::ShaderStage::Compute);
+                }
+                return false;
+            };
+
+            if (isConfiguredFromVariant(m_rootVariant))
+            {
+                pipelineStatePrewarmer->RecordUsage(*this, m_rootVariant, descriptor);
+                return;
+            }
+
+            AZStd::shared_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+            for (const auto& [stableId, variant] : m_shaderVariants)
+            {
+                if (isConfiguredFromVariant(variant))
+                {
+                    pipelineStatePrewarmer->RecordUsage(*this, variant, descriptor);
+                    return;
+                }
+            }
+        }
+
         const RHI::Ptr<RHI::ShaderResourceGroupLayout>& Shader::FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const
         {
             return m_asset->FindShaderResourceGroupLayout(shaderResourceGroupName, m_supervariantIndex);
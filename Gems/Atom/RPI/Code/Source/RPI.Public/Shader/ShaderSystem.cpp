@@ -7,6 +7,7 @@
  */
 
 #include <Atom/RPI.Public/Shader/ShaderSystem.h>
+#include <Atom/RPI.Public/Shader/PipelineStatePrewarmer.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroupPool.h>
@@ -41,6 +42,8 @@ namespace AZ
             ShaderVariantTreeAsset::Reflect(context);
             ReflectShaderStageType(context);
             PrecompiledShaderAssetSourceData::Reflect(context);
+            PipelineStatePrewarmer::Reflect(context);
+            ShaderVariantPrefetcher::Reflect(context);
         }
 
         ShaderSystemInterface* ShaderSystemInterface::Get()
@@ -58,6 +61,8 @@ namespace AZ
         void ShaderSystem::Init()
         {
             m_shaderVariantAsyncLoader.Init();
+            m_pipelineStatePrewarmer.Init();
+            m_shaderVariantPrefetcher.Init();
 
             Interface<ShaderSystemInterface>::Register(this);
 
@@ -94,6 +99,9 @@ namespace AZ
         void ShaderSystem::Shutdown()
         {
             ShaderReloadDebugTracker::Shutdown();
+            // Releases the prewarmed shaders before the shader instance database
+            m_pipelineStatePrewarmer.Shutdown();
+            m_shaderVariantPrefetcher.Shutdown();
             Data::InstanceDatabase<Shader>::Destroy();
             Data::InstanceDatabase<ShaderResourceGroup>::Destroy();
             Data::InstanceDatabase<ShaderResourceGroupPool>::Destroy();
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Shader/PipelineStatePrewarmer.h>
+#include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantPrefetcher.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(bool, r_shaderVariantPrefetch, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Learn the shader variants the draws of each material use, and request them as soon as the material is created");
+        AZ_CVAR(AZ::CVarFixedString, r_shaderVariantPrefetchFolder, "@user@/Atom/ShaderVariantPrefetch", nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The folder the shader variants learned for the materials of each level are saved to");
+        AZ_CVAR(bool, r_shaderVariantPrefetchPsoPrewarm, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Also compile the pipeline state prewarm list when a level starts loading, once its shader variants are prefetched");
+
+        static void r_shaderVariantPrefetchSave([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            if (ShaderVariantPrefetcher* prefetcher = ShaderVariantPrefetcher::Get())
+            {
+                prefetcher->SaveLevelUsage();
+            }
+        }
+        AZ_CONSOLEFREEFUNC(r_shaderVariantPrefetchSave, AZ::ConsoleFunctorFlags::Null,
+            "Saves the shader variants learned for the materials of the current level now, instead of when it's unloaded");
+
+        void MaterialShaderVariantUsage::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<MaterialShaderVariantUsage>()
+                    ->Version(0)
+                    ->Field("MaterialAssetId", &MaterialShaderVariantUsage::m_materialAssetId)
+                    ->Field("ShaderAssetId", &MaterialShaderVariantUsage::m_shaderAssetId)
+                    ->Field("ShaderVariantId", &MaterialShaderVariantUsage::m_shaderVariantId)
+                    ;
+            }
+        }
+
+        void ShaderVariantPrefetchList::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<ShaderVariantPrefetchList>()
+                    ->Version(0)
+                    ->Field("Usages", &ShaderVariantPrefetchList::m_usages)
+                    ;
+            }
+        }
+
+        void ShaderVariantPrefetcher::Reflect(ReflectContext* context)
+        {
+            MaterialShaderVariantUsage::Reflect(context);
+            ShaderVariantPrefetchList::Reflect(context);
+        }
+
+        ShaderVariantPrefetcher* ShaderVariantPrefetcher::Get()
+        {
+            return Interface<ShaderVariantPrefetcher>::Get();
+        }
+
+        ShaderVariantPrefetcher::~ShaderVariantPrefetcher()
+        {
+            Shutdown();
+        }
+
+        void ShaderVariantPrefetcher::Init()
+        {
+            Interface<ShaderVariantPrefetcher>::Register(this);
+            AzFramework::LevelSystemLifecycleNotificationBus::Handler::BusConnect();
+        }
+
+        void ShaderVariantPrefetcher::Shutdown()
+        {
+            AzFramework::LevelSystemLifecycleNotificationBus::Handler::BusDisconnect();
+            if (Interface<ShaderVariantPrefetcher>::Get() == this)
+            {
+                SaveLevelUsage();
+                Interface<ShaderVariantPrefetcher>::Unregister(this);
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_usagesByMaterial.clear();
+            m_prefetchedMaterials.clear();
+            m_learnedCount = 0;
+            m_hasUnsavedUsage = false;
+        }
+
+        bool ShaderVariantPrefetcher::IsEnabled()
+        {
+            return r_shaderVariantPrefetch;
+        }
+
+        void ShaderVariantPrefetcher::RecordUsage(
+            const Data::AssetId& materialAssetId, const Data::AssetId& shaderAssetId, const ShaderVariantId& shaderVariantId)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            // A material only uses a few variants of each of its shaders, a linear search is enough
+            AZStd::vector<MaterialShaderVariantUsage>& usages = m_usagesByMaterial[materialAssetId];
+            for (const MaterialShaderVariantUsage& usage : usages)
+            {
+                if (usage.m_shaderAssetId == shaderAssetId && usage.m_shaderVariantId == shaderVariantId)
+                {
+                    return;
+                }
+            }
+
+            MaterialShaderVariantUsage& usage = usages.emplace_back();
+            usage.m_materialAssetId = materialAssetId;
+            usage.m_shaderAssetId = shaderAssetId;
+            usage.m_shaderVariantId = shaderVariantId;
+            ++m_learnedCount;
+            m_hasUnsavedUsage = true;
+        }
+
+        void ShaderVariantPrefetcher::PrefetchVariants(const Material& material)
+        {
+            const Data::AssetId materialAssetId = material.GetAsset().GetId();
+
+            AZStd::vector<MaterialShaderVariantUsage> usages;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                auto usagesIt = m_usagesByMaterial.find(materialAssetId);
+                if (usagesIt == m_usagesByMaterial.end() || !m_prefetchedMaterials.insert(materialAssetId).second)
+                {
+                    return;
+                }
+                usages = usagesIt->second;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "ShaderVariantPrefetcher: PrefetchVariants");
+
+            uint32_t prefetchedCount = 0;
+            material.ForAllShaderItems(
+                [&](const Name&, const ShaderCollection::Item& shaderItem)
+                {
+                    const Data::Asset<ShaderAsset>& shaderAsset = shaderItem.GetShaderAsset();
+                    if (!shaderAsset.IsReady())
+                    {
+                        return true;
+                    }
+
+                    for (const MaterialShaderVariantUsage& usage : usages)
+                    {
+                        if (usage.m_shaderAssetId != shaderAsset.GetId())
+                        {
+                            continue;
+                        }
+
+                        // The same shader instance as the draw packets, so the variant is requested for the same supervariant.
+                        // Asking for a variant that isn't loaded yet queues it in the shader variant async loader.
+                        if (Data::Instance<Shader> shader = Shader::FindOrCreate(shaderAsset))
+                        {
+                            shader->GetVariant(usage.m_shaderVariantId);
+                            ++prefetchedCount;
+                        }
+                    }
+                    return true;
+                });
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_prefetchedCount += prefetchedCount;
+        }
+
+        void ShaderVariantPrefetcher::SetPrefetchList(const ShaderVariantPrefetchList& prefetchList)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_usagesByMaterial.clear();
+            m_prefetchedMaterials.clear();
+            m_learnedCount = 0;
+            m_hasUnsavedUsage = false;
+            for (const MaterialShaderVariantUsage& usage : prefetchList.m_usages)
+            {
+                m_usagesByMaterial[usage.m_materialAssetId].push_back(usage);
+                ++m_learnedCount;
+            }
+        }
+
+        uint32_t ShaderVariantPrefetcher::GetLearnedCount() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_learnedCount;
+        }
+
+        uint32_t ShaderVariantPrefetcher::GetPrefetchedCount() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            return m_prefetchedCount;
+        }
+
+        AZStd::string ShaderVariantPrefetcher::GetResolvedListPath(const AZStd::string& levelName) const
+        {
+            // Level names can be paths to the level asset, only keep their stem
+            const AZ::CVarFixedString listFolder = r_shaderVariantPrefetchFolder;
+            AZ::IO::FixedMaxPath listPath = listFolder.c_str();
+            listPath /= AZ::IO::PathView(levelName).Stem();
+            listPath.ReplaceExtension(".xml");
+
+            if (auto* fileIOBase = IO::FileIOBase::GetInstance())
+            {
+                char resolvedPath[AZ_MAX_PATH_LEN];
+                if (fileIOBase->ResolvePath(listPath.c_str(), resolvedPath, AZ_MAX_PATH_LEN))
+                {
+                    return resolvedPath;
+                }
+            }
+            return listPath.c_str();
+        }
+
+        void ShaderVariantPrefetcher::LoadLevelUsage(const AZStd::string& levelName)
+        {
+            ShaderVariantPrefetchList prefetchList;
+            const AZStd::string listPath = GetResolvedListPath(levelName);
+            if (IO::FileIOBase::GetInstance() && IO::FileIOBase::GetInstance()->Exists(listPath.c_str()))
+            {
+                if (!AZ::Utils::LoadObjectFromFileInPlace(listPath, prefetchList))
+                {
+                    AZ_Warning("ShaderVariantPrefetcher", false, "Failed to load the shader variant prefetch list '%s'", listPath.c_str());
+                }
+            }
+
+            SetPrefetchList(prefetchList);
+        }
+
+        bool ShaderVariantPrefetcher::SaveLevelUsage()
+        {
+            ShaderVariantPrefetchList prefetchList;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                if (m_levelName.empty() || !m_hasUnsavedUsage)
+                {
+                    return true;
+                }
+
+                for (const auto& [materialAssetId, usages] : m_usagesByMaterial)
+                {
+                    prefetchList.m_usages.insert(prefetchList.m_usages.end(), usages.begin(), usages.end());
+                }
+                m_hasUnsavedUsage = false;
+            }
+
+            const AZStd::string listPath = GetResolvedListPath(m_levelName);
+            if (!AZ::Utils::SaveObjectToFile(listPath, DataStream::ST_XML, &prefetchList))
+            {
+                AZ_Error("ShaderVariantPrefetcher", false, "Failed to save the shader variant prefetch list to '%s'", listPath.c_str());
+                return false;
+            }
+            return true;
+        }
+
+        void ShaderVariantPrefetcher::OnLoadingStart(const char* levelName)
+        {
+            // Loading a level without unloading the previous one first still saves what was learned for it
+            SaveLevelUsage();
+
+            m_levelName = levelName ? levelName : "";
+            if (!r_shaderVariantPrefetch || m_levelName.empty())
+            {
+                SetPrefetchList({});
+                return;
+            }
+
+            LoadLevelUsage(m_levelName);
+
+            if (r_shaderVariantPrefetchPsoPrewarm)
+            {
+                if (PipelineStatePrewarmer* pipelineStatePrewarmer = PipelineStatePrewarmer::Get())
+                {
+                    pipelineStatePrewarmer->Prewarm();
+                }
+            }
+        }
+
+        void ShaderVariantPrefetcher::OnUnloadComplete([[maybe_unused]] const char* levelName)
+        {
+            SaveLevelUsage();
+            m_levelName.clear();
+            SetPrefetchList({});
+        }
+    } // namespace RPI
+} // namespace AZ
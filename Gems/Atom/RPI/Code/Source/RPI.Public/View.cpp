@@ -88,6 +88,11 @@ namespace AZ
                 m_drawListMask = drawListMask;
                 m_drawListContext.Shutdown();
                 m_drawListContext.Init(m_drawListMask);
+                if (m_dynamicCullableFlags != 0)
+                {
+                    m_dynamicDrawListContext.Shutdown();
+                    m_dynamicDrawListContext.Init(m_drawListMask);
+                }
             }
         }
 
@@ -95,6 +100,7 @@ namespace AZ
         {
             m_drawListMask.reset();
             m_drawListContext.Shutdown();
+            m_dynamicDrawListContext.Shutdown();
             m_visibleObjectContext.Shutdown();
             m_passesByDrawList = nullptr;
         }
@@ -145,7 +151,52 @@ namespace AZ
             m_drawListContext.AddDrawItem(drawListTag, drawItemProperties);
         }
 
+        void View::SetDynamicCullableFlags(uint32_t flags)
+        {
+            if (m_dynamicCullableFlags == flags)
+            {
+                return;
+            }
+
+            m_dynamicCullableFlags = flags;
+            m_dynamicDrawListContext.Shutdown();
+            if (m_dynamicCullableFlags != 0)
+            {
+                m_dynamicDrawListContext.Init(m_drawListMask);
+            }
+        }
+
+        uint32_t View::GetDynamicCullableFlags() const
+        {
+            return m_dynamicCullableFlags;
+        }
+
+        bool View::IsDynamicCullable(uint32_t cullableFlags) const
+        {
+            return (cullableFlags & m_dynamicCullableFlags) != 0;
+        }
+
+        void View::AddDynamicDrawPacket(const RHI::DrawPacket* drawPacket, const Vector3& worldPosition)
+        {
+            if (m_dynamicCullableFlags == 0)
+            {
+                AddDrawPacket(drawPacket, worldPosition);
+                return;
+            }
+
+            Vector3 cameraToObject = worldPosition - m_position;
+            float depth = cameraToObject.Dot(-m_viewToWorldMatrix.GetBasisZAsVector3());
+            m_dynamicDrawListContext.AddDrawPacket(drawPacket, depth);
+        }
+
         void View::ApplyFlags(uint32_t flags)
+        {
+            AZStd::atomic_fetch_and(&m_andFlags, flags);
+            AZStd::atomic_fetch_or(&m_orFlags, flags);
+            AZStd::atomic_fetch_or(&m_staticOrFlags, flags);
+        }
+
+        void View::ApplyDynamicFlags(uint32_t flags)
         {
             AZStd::atomic_fetch_and(&m_andFlags, flags);
             AZStd::atomic_fetch_or(&m_orFlags, flags);
@@ -155,6 +206,7 @@ namespace AZ
         {
             AZStd::atomic_fetch_or(&m_andFlags, flags);
             AZStd::atomic_fetch_and(&m_orFlags, ~flags);
+            AZStd::atomic_fetch_and(&m_staticOrFlags, ~flags);
         }
 
         void View::ClearAllFlags()
@@ -172,6 +224,11 @@ namespace AZ
             return m_orFlags;
         }
 
+        uint32_t View::GetStaticOrFlags() const
+        {
+            return m_staticOrFlags;
+        }
+
         void View::UpdateViewToWorldMatrix(const AZ::Matrix4x4& viewToWorld)
         {
             m_viewToWorldMatrix = viewToWorld;
@@ -409,6 +466,15 @@ namespace AZ
             return m_drawListContext.GetList(drawListTag);
         }
 
+        RHI::DrawListView View::GetDynamicDrawList(RHI::DrawListTag drawListTag)
+        {
+            if (m_dynamicCullableFlags == 0)
+            {
+                return {};
+            }
+            return m_dynamicDrawListContext.GetList(drawListTag);
+        }
+
         VisibleObjectListView View::GetVisibleObjectList()
         {
             return m_visibleObjectContext.GetList();
@@ -423,15 +489,36 @@ namespace AZ
         {
             AZ_PROFILE_SCOPE(RPI, "View: FinalizeDrawLists");
             m_drawListContext.FinalizeLists();
+            FinalizeDynamicDrawLists();
             SortFinalizedDrawListsTG(finalizeDrawListsTGEvent);
         }
         void View::FinalizeDrawListsJob(AZ::Job* parentJob)
         {
             AZ_PROFILE_SCOPE(RPI, "View: FinalizeDrawLists");
             m_drawListContext.FinalizeLists();
+            FinalizeDynamicDrawLists();
             SortFinalizedDrawListsJob(parentJob);
         }
 
+        void View::FinalizeDynamicDrawLists()
+        {
+            if (m_dynamicCullableFlags == 0)
+            {
+                return;
+            }
+
+            // The dynamic objects are usually few, so their lists are sorted in place rather than with jobs
+            m_dynamicDrawListContext.FinalizeLists();
+            RHI::DrawListsByTag& drawListsByTag = m_dynamicDrawListContext.GetMergedDrawListsByTag();
+            for (size_t idx = 0; idx < drawListsByTag.size(); ++idx)
+            {
+                if (drawListsByTag[idx].size() > 1)
+                {
+                    SortDrawList(drawListsByTag[idx], RHI::DrawListTag(idx));
+                }
+            }
+        }
+
         void View::SortFinalizedDrawListsTG(AZ::TaskGraphEvent& finalizeDrawListsTGEvent)
         {
             AZ_PROFILE_SCOPE(RPI, "View: SortFinalizedDrawLists");
@@ -733,5 +820,15 @@ namespace AZ
             return m_shadowPassRenderpipelineId;
         }
 
+        void View::SetDrawBufferAttachments(AZStd::span<const DrawBufferAttachment> attachments)
+        {
+            m_drawBufferAttachments.assign(attachments.begin(), attachments.end());
+        }
+
+        AZStd::span<const View::DrawBufferAttachment> View::GetDrawBufferAttachments() const
+        {
+            return m_drawBufferAttachments;
+        }
+
     } // namespace RPI
 } // namespace AZ
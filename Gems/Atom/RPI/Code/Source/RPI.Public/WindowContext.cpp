@@ -22,6 +22,10 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_lowLatencyMode, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Limit the window swap chains to a single queued frame and start each CPU frame just in time for the display. "
+            "Lowers the input latency at the cost of some throughput. Takes effect when the swap chains are created");
+
         void WindowContext::Initialize(RHI::Device& device, AzFramework::NativeWindowHandle windowHandle)
         {
             m_windowHandle = windowHandle;
@@ -226,6 +230,7 @@ namespace AZ
             descriptor.m_dimensions.m_imageCount = AZStd::max(RHI::Limits::Device::MinSwapChainImages, RHI::Limits::Device::FrameCountMax);
             descriptor.m_dimensions.m_imageFormat = GetSwapChainFormat(device);
             descriptor.m_scalingMode = m_swapChainScalingMode;
+            descriptor.m_isLowLatency = r_lowLatencyMode;
 
             AZStd::string attachmentName = AZStd::string::format("WindowContextAttachment_%p", m_windowHandle);
             descriptor.m_attachmentId = RHI::AttachmentId{ attachmentName.c_str() };
@@ -110,6 +110,23 @@ namespace AZ
             m_propertyDirtyFlags.reset();
         }
 
+        void MaterialPropertyCollection::ClearUnchangedPropertyDirtyFlags(const AZStd::vector<MaterialPropertyValue>& previousValues)
+        {
+            if (previousValues.size() != m_propertyValues.size())
+            {
+                AZ_Assert(false, "ClearUnchangedPropertyDirtyFlags: There must be a previous value for each property");
+                return;
+            }
+
+            for (size_t i = 0; i < m_propertyValues.size(); ++i)
+            {
+                if (m_propertyDirtyFlags[i] && m_propertyValues[i] == previousValues[i])
+                {
+                    m_propertyDirtyFlags.reset(i);
+                }
+            }
+        }
+
         template<typename Type>
         bool MaterialPropertyCollection::SetPropertyValue(MaterialPropertyIndex index, const Type& value)
         {
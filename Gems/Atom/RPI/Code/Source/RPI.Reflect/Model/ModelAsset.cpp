@@ -134,6 +134,25 @@ namespace AZ
             }
         }
 
+        Data::AssetData::AssetStatus ModelAsset::QueueLoadLodBufferAssets(size_t lodIndex)
+        {
+            AZ_Assert(lodIndex < m_lodAssets.size(), "Lod index out of range");
+            if (!m_lodAssets[lodIndex].IsReady())
+            {
+                return Data::AssetData::AssetStatus::Error;
+            }
+            return m_lodAssets[lodIndex]->QueueLoadBufferAssets();
+        }
+
+        void ModelAsset::ReleaseLodBufferAssets(size_t lodIndex)
+        {
+            AZ_Assert(lodIndex < m_lodAssets.size(), "Lod index out of range");
+            if (m_bufferAssetsRef == 0 && m_lodAssets[lodIndex].IsReady())
+            {
+                m_lodAssets[lodIndex]->ReleaseBufferAssets();
+            }
+        }
+
         bool ModelAsset::SupportLocalRayIntersection() const
         {
             return m_bufferAssetsRef > 0;
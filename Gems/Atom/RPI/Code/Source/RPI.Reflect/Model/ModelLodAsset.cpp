@@ -35,12 +35,13 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
             {
                 serializeContext->Class<ModelLodAsset::Mesh>()
-                    ->Version(1)
+                    ->Version(2) // Added meshlet clusters
                     ->Field("Name", &ModelLodAsset::Mesh::m_name)
                     ->Field("AABB", &ModelLodAsset::Mesh::m_aabb)
                     ->Field("MaterialSlotId", &ModelLodAsset::Mesh::m_materialSlotId)
                     ->Field("IndexBufferAssetView", &ModelLodAsset::Mesh::m_indexBufferAssetView)
                     ->Field("StreamBufferInfo", &ModelLodAsset::Mesh::m_streamBufferInfo)
+                    ->Field("MeshletClusterBufferAssetView", &ModelLodAsset::Mesh::m_meshletClusterBufferAssetView)
                     ;
             }
 
@@ -98,6 +99,16 @@ namespace AZ
             return AZStd::span<const ModelLodAsset::Mesh::StreamBufferInfo>(m_streamBufferInfo);
         }
 
+        const BufferAssetView& ModelLodAsset::Mesh::GetMeshletClusterBufferAssetView() const
+        {
+            return m_meshletClusterBufferAssetView;
+        }
+
+        AZStd::span<const MeshletCluster> ModelLodAsset::Mesh::GetMeshletClusters() const
+        {
+            return GetBufferTyped<MeshletCluster>(m_meshletClusterBufferAssetView);
+        }
+
         void ModelLodAsset::AddMesh(const Mesh& mesh)
         {
             m_meshes.push_back(mesh);
@@ -145,6 +156,45 @@ namespace AZ
             }
         }
 
+        Data::AssetData::AssetStatus ModelLodAsset::QueueLoadBufferAssets()
+        {
+            bool isReady = true;
+            bool isError = false;
+            auto queueLoad = [&isReady, &isError](Data::Asset<BufferAsset>& bufferAsset)
+            {
+                if (!bufferAsset.GetId().IsValid() || bufferAsset.IsReady())
+                {
+                    return;
+                }
+
+                if (!bufferAsset.IsError())
+                {
+                    bufferAsset.QueueLoad();
+                }
+                isError |= bufferAsset.IsError();
+                isReady &= bufferAsset.IsReady();
+            };
+
+            queueLoad(m_indexBuffer);
+            for (auto& streamBuffer : m_streamBuffers)
+            {
+                queueLoad(streamBuffer);
+            }
+
+            if (isError)
+            {
+                return Data::AssetData::AssetStatus::Error;
+            }
+            if (!isReady)
+            {
+                return Data::AssetData::AssetStatus::Loading;
+            }
+
+            // Only updates the buffer asset references in meshes, the buffers are already loaded
+            LoadBufferAssets();
+            return Data::AssetData::AssetStatus::Ready;
+        }
+
         void ModelLodAsset::ReleaseBufferAssets()
         {
             m_indexBuffer.Release();
@@ -168,6 +218,11 @@ namespace AZ
             {
                 bufferInfo.m_bufferAssetView.LoadBufferAsset();
             }
+
+            if (m_meshletClusterBufferAssetView.GetBufferAsset().GetId().IsValid())
+            {
+                m_meshletClusterBufferAssetView.LoadBufferAsset();
+            }
         }
         
         void ModelLodAsset::Mesh::ReleaseBufferAssets()
@@ -178,6 +233,8 @@ namespace AZ
             {
                 bufferInfo.m_bufferAssetView.ReleaseBufferAsset();
             }
+
+            m_meshletClusterBufferAssetView.ReleaseBufferAsset();
         }
 
         const BufferAssetView* ModelLodAsset::Mesh::GetSemanticBufferAssetView(const AZ::Name& semantic) const
@@ -87,6 +87,14 @@ namespace AZ
             m_currentMesh.m_indexBufferAssetView = AZStd::move(bufferAssetView);
         }
 
+        void ModelLodAssetCreator::SetMeshMeshletClusters(const BufferAssetView& bufferAssetView)
+        {
+            if (ValidateIsMeshReady())
+            {
+                m_currentMesh.m_meshletClusterBufferAssetView = bufferAssetView;
+            }
+        }
+
         bool ModelLodAssetCreator::AddMeshStreamBuffer(
             const RHI::ShaderSemantic& streamSemantic,
             const AZ::Name& customName,
@@ -319,6 +327,9 @@ namespace AZ
                     }
                 }
 
+                // The clone has the same triangles as the source mesh, so it shares the source's read-only clusters
+                creator.SetMeshMeshletClusters(sourceMesh.GetMeshletClusterBufferAssetView());
+
                 creator.EndMesh();
             }
 
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Model/ModelMeshlets.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace MeshletUtils
+        {
+            // Clusters whose triangle normals spread this much are never backface culled, the test would almost never pass
+            static constexpr float MinConeDot = 0.1f;
+
+            static Vector3 GetPosition(AZStd::span<const float> positions, uint32_t index)
+            {
+                return Vector3(positions[index * 3], positions[index * 3 + 1], positions[index * 3 + 2]);
+            }
+
+            static MeshletCluster CreateCluster(
+                AZStd::span<const uint32_t> indices, AZStd::span<const float> positions, uint32_t firstIndex, uint32_t indexCount)
+            {
+                MeshletCluster cluster;
+                cluster.m_firstIndex = firstIndex;
+                cluster.m_indexCount = indexCount;
+
+                Aabb aabb = Aabb::CreateNull();
+                for (uint32_t i = firstIndex; i < firstIndex + indexCount; ++i)
+                {
+                    aabb.AddPoint(GetPosition(positions, indices[i]));
+                }
+                const Vector3 center = aabb.GetCenter();
+                float radiusSq = 0.0f;
+                for (uint32_t i = firstIndex; i < firstIndex + indexCount; ++i)
+                {
+                    radiusSq = AZStd::max(radiusSq, GetPosition(positions, indices[i]).GetDistanceSq(center));
+                }
+                center.StoreToFloat3(cluster.m_boundingSphere);
+                cluster.m_boundingSphere[3] = Sqrt(radiusSq);
+
+                // The cone axis is the average of the triangle normals, and the cutoff is given by the normal furthest from it
+                Vector3 normalSum = Vector3::CreateZero();
+                for (uint32_t i = firstIndex; i < firstIndex + indexCount; i += 3)
+                {
+                    const Vector3 p0 = GetPosition(positions, indices[i]);
+                    const Vector3 normal = (GetPosition(positions, indices[i + 1]) - p0).Cross(GetPosition(positions, indices[i + 2]) - p0);
+                    if (!normal.IsZero())
+                    {
+                        normalSum += normal.GetNormalized();
+                    }
+                }
+
+                if (normalSum.GetLengthSq() < Constants::FloatEpsilon)
+                {
+                    center.StoreToFloat3(cluster.m_coneApex);
+                    return cluster;
+                }
+
+                const Vector3 axis = normalSum.GetNormalized();
+                float minDot = 1.0f;
+                for (uint32_t i = firstIndex; i < firstIndex + indexCount; i += 3)
+                {
+                    const Vector3 p0 = GetPosition(positions, indices[i]);
+                    const Vector3 normal = (GetPosition(positions, indices[i + 1]) - p0).Cross(GetPosition(positions, indices[i + 2]) - p0);
+                    if (!normal.IsZero())
+                    {
+                        minDot = AZStd::min(minDot, normal.GetNormalized().Dot(axis));
+                    }
+                }
+
+                axis.StoreToFloat3(cluster.m_coneAxis);
+                if (minDot <= MinConeDot)
+                {
+                    center.StoreToFloat3(cluster.m_coneApex);
+                    return cluster;
+                }
+
+                // Move the apex back along the axis until it is behind the plane of every triangle, so the test against the apex
+                // is conservative for the whole cluster
+                float maxT = 0.0f;
+                for (uint32_t i = firstIndex; i < firstIndex + indexCount; i += 3)
+                {
+                    const Vector3 p0 = GetPosition(positions, indices[i]);
+                    const Vector3 normal = (GetPosition(positions, indices[i + 1]) - p0).Cross(GetPosition(positions, indices[i + 2]) - p0);
+                    if (!normal.IsZero())
+                    {
+                        const Vector3 unitNormal = normal.GetNormalized();
+                        maxT = AZStd::max(maxT, (center - p0).Dot(unitNormal) / axis.Dot(unitNormal));
+                    }
+                }
+
+                (center - axis * maxT).StoreToFloat3(cluster.m_coneApex);
+                cluster.m_coneCutoff = Sqrt(1.0f - minDot * minDot);
+                return cluster;
+            }
+
+            bool BuildMeshletClusters(
+                AZStd::span<const uint32_t> indices,
+                AZStd::span<const float> positions,
+                AZStd::vector<MeshletCluster>& clusters,
+                uint32_t maxVertexCount,
+                uint32_t maxTriangleCount)
+            {
+                clusters.clear();
+                if (indices.size() % 3 != 0 || positions.size() % 3 != 0 || maxVertexCount < 3 || maxTriangleCount == 0)
+                {
+                    return false;
+                }
+
+                const uint32_t vertexCount = aznumeric_cast<uint32_t>(positions.size() / 3);
+                const uint32_t indexCount = aznumeric_cast<uint32_t>(indices.size());
+
+                // The cluster each vertex was last added to, to count the unique vertices of the current cluster
+                AZStd::vector<uint32_t> vertexClusters(vertexCount, aznumeric_cast<uint32_t>(-1));
+                uint32_t clusterIndex = 0;
+                uint32_t clusterFirstIndex = 0;
+                uint32_t clusterVertexCount = 0;
+
+                auto countNewVertices = [&](const uint32_t* triangle)
+                {
+                    uint32_t newVertexCount = 0;
+                    for (uint32_t corner = 0; corner < 3; ++corner)
+                    {
+                        const uint32_t vertex = triangle[corner];
+                        const bool isDuplicate = (corner > 0 && vertex == triangle[0]) || (corner > 1 && vertex == triangle[1]);
+                        if (!isDuplicate && vertexClusters[vertex] != clusterIndex)
+                        {
+                            ++newVertexCount;
+                        }
+                    }
+                    return newVertexCount;
+                };
+
+                for (uint32_t index = 0; index < indexCount; index += 3)
+                {
+                    const uint32_t* triangle = &indices[index];
+                    if (triangle[0] >= vertexCount || triangle[1] >= vertexCount || triangle[2] >= vertexCount)
+                    {
+                        clusters.clear();
+                        return false;
+                    }
+
+                    uint32_t newVertexCount = countNewVertices(triangle);
+                    const uint32_t clusterTriangleCount = (index - clusterFirstIndex) / 3;
+                    if (clusterTriangleCount > 0 &&
+                        (clusterVertexCount + newVertexCount > maxVertexCount || clusterTriangleCount + 1 > maxTriangleCount))
+                    {
+                        clusters.push_back(CreateCluster(indices, positions, clusterFirstIndex, index - clusterFirstIndex));
+                        ++clusterIndex;
+                        clusterFirstIndex = index;
+                        clusterVertexCount = 0;
+                        newVertexCount = countNewVertices(triangle);
+                    }
+
+                    for (uint32_t corner = 0; corner < 3; ++corner)
+                    {
+                        vertexClusters[triangle[corner]] = clusterIndex;
+                    }
+                    clusterVertexCount += newVertexCount;
+                }
+
+                if (clusterFirstIndex < indexCount)
+                {
+                    clusters.push_back(CreateCluster(indices, positions, clusterFirstIndex, indexCount - clusterFirstIndex));
+                }
+                return true;
+            }
+
+            bool IsMeshletClusterBackfacing(const MeshletCluster& cluster, const Vector3& cameraPosition)
+            {
+                if (cluster.m_coneCutoff >= 1.0f)
+                {
+                    return false;
+                }
+
+                const Vector3 apexDirection = Vector3::CreateFromFloat3(cluster.m_coneApex) - cameraPosition;
+                const float apexDistance = apexDirection.GetLength();
+                if (apexDistance < Constants::FloatEpsilon)
+                {
+                    return false;
+                }
+                return apexDirection.Dot(Vector3::CreateFromFloat3(cluster.m_coneAxis)) >= cluster.m_coneCutoff * apexDistance;
+            }
+        } // namespace MeshletUtils
+    } // namespace RPI
+} // namespace AZ
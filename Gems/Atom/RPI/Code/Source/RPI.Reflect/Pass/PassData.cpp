@@ -166,7 +166,7 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
             {
                 serializeContext->Class<ComputePassData, RenderPassData>()
-                    ->Version(3)
+                    ->Version(4)
                     ->Field("ShaderAsset", &ComputePassData::m_shaderReference)
                     ->Field("ThreadCountX", &ComputePassData::m_totalNumberOfThreadsX)
                     ->Field("ThreadCountY", &ComputePassData::m_totalNumberOfThreadsY)
@@ -175,7 +175,8 @@ namespace AZ
                     ->Field("FullscreenSizeSourceSlotName", &ComputePassData::m_fullscreenSizeSourceSlotName)
                     ->Field("IndirectDispatch", &ComputePassData::m_indirectDispatch)
                     ->Field("IndirectDispatchBufferSlotName", &ComputePassData::m_indirectDispatchBufferSlotName)
-                    ->Field("UseAsyncCompute", &ComputePassData::m_useAsyncCompute);
+                    ->Field("UseAsyncCompute", &ComputePassData::m_useAsyncCompute)
+                    ->Field("AllowAsyncCompute", &ComputePassData::m_allowAsyncCompute);
             }
         }
 
@@ -663,6 +663,47 @@ namespace UnitTest
         ValidateImageResidency(imageInstance.get(), imageAsset.Get());
     }
 
+    TEST_F(StreamingImageTests, ImageMipFeedback_StreamsToRequestedMipAndEvictsUnrequestedImages)
+    {
+        using namespace AZ;
+
+        auto imageSystem = RPI::ImageSystemInterface::Get();
+
+        Data::Asset<RPI::StreamingImageAsset> imageAsset = BuildTestImage();
+        Data::Instance<RPI::StreamingImage> imageInstance = RPI::StreamingImage::FindOrCreate(imageAsset);
+        RHI::Ptr<RHI::Image> rhiImage = imageInstance->GetRHIImage();
+        const Data::Instance<RPI::StreamingImagePool>& pool = imageInstance->GetPool();
+        const size_t mipChainTailIndex = imageAsset->GetMipChainCount() - 1;
+
+        const uint32_t slot = imageInstance->GetMipFeedbackSlot();
+        ASSERT_LT(slot, pool->GetMipFeedbackSlotCount());
+
+        imageInstance->QueueExpandToMipChainLevel(0);
+        imageSystem->Update();
+        EXPECT_EQ(rhiImage->GetResidentMipLevel(), 0);
+
+        // Only the middle mip chain is requested, so the most detailed one is evicted.
+        AZStd::vector<uint32_t> requestedMips(pool->GetMipFeedbackSlotCount(), RPI::StreamingImageController::NoMipFeedback);
+        requestedMips[slot] = static_cast<uint32_t>(imageAsset->GetMipLevel(1));
+        pool->ApplyMipFeedback(requestedMips);
+        EXPECT_EQ(rhiImage->GetResidentMipLevel(), imageAsset->GetMipLevel(1));
+
+        // The image stops being requested, and is evicted to its mip chain tail once enough updates passed.
+        const uint32_t savedUnsampledUpdates = RPI::r_streamingImageFeedbackUnsampledUpdates;
+        RPI::r_streamingImageFeedbackUnsampledUpdates = 2;
+
+        requestedMips[slot] = RPI::StreamingImageController::NoMipFeedback;
+        pool->ApplyMipFeedback(requestedMips);
+        EXPECT_EQ(rhiImage->GetResidentMipLevel(), imageAsset->GetMipLevel(1));
+
+        imageSystem->Update();
+        imageSystem->Update();
+        pool->ApplyMipFeedback(requestedMips);
+        EXPECT_EQ(rhiImage->GetResidentMipLevel(), imageAsset->GetMipLevel(mipChainTailIndex));
+
+        RPI::r_streamingImageFeedbackUnsampledUpdates = savedUnsampledUpdates;
+    }
+
     TEST_F(StreamingImageTests, ImageInternalReferenceTracking)
     {
         using namespace AZ;
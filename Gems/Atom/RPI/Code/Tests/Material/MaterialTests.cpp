@@ -14,6 +14,8 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialParameterBuffer.h>
+#include <Atom/RPI.Public/Material/MaterialSystem.h>
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Material/MaterialAssetCreator.h>
@@ -317,6 +319,79 @@ namespace UnitTest
         EXPECT_NE(materialInstance3, materialInstance4);
     }
 
+    TEST_F(MaterialTests, BindlessMaterials_Create_AcquiresAndReusesParameterEntries)
+    {
+        const uint32_t wordCount = MaterialParameterBuffer::GetEntryWordCount(*m_testMaterialSrgLayout);
+        EXPECT_GT(wordCount, 0);
+
+        r_bindlessMaterials = true;
+        Data::Instance<Material> material1 = Material::Create(m_testMaterialAsset);
+        Data::Instance<Material> material2 = Material::Create(m_testMaterialAsset);
+
+        ASSERT_NE(material1->GetParameterEntryIndex(), MaterialParameterBuffer::InvalidEntryIndex);
+        ASSERT_NE(material2->GetParameterEntryIndex(), MaterialParameterBuffer::InvalidEntryIndex);
+        EXPECT_EQ(material2->GetParameterEntryIndex(), material1->GetParameterEntryIndex() + wordCount);
+
+        // The entry of a released material is reused by the next material of the same type.
+        const uint32_t releasedEntryIndex = material1->GetParameterEntryIndex();
+        material1 = nullptr;
+        Data::Instance<Material> material3 = Material::Create(m_testMaterialAsset);
+        EXPECT_EQ(material3->GetParameterEntryIndex(), releasedEntryIndex);
+
+        r_bindlessMaterials = false;
+        Data::Instance<Material> material4 = Material::Create(m_testMaterialAsset);
+        EXPECT_EQ(material4->GetParameterEntryIndex(), MaterialParameterBuffer::InvalidEntryIndex);
+
+        // The test shader can't read the material from the buffer, so the draws still bind the material SRG
+        EXPECT_FALSE(material3->UsesParameterBuffer());
+        EXPECT_EQ(material3->GetDrawShaderResourceGroup(), material3->GetRHIShaderResourceGroup());
+    }
+
+    TEST_F(MaterialTests, BindlessMaterials_ShaderReadsParameterBuffer_SharesMaterialSrg)
+    {
+        Ptr<ShaderOptionGroupLayout> optionsLayout = ShaderOptionGroupLayout::Create();
+        optionsLayout->AddShaderOption(ShaderOptionDescriptor{ Name{ MaterialParameterBuffer::ShaderOptionName }, ShaderOptionType::Boolean,
+            0, 0, CreateBoolShaderOptionValues(), Name{ "False" } });
+        optionsLayout->Finalize();
+
+        Data::Asset<ShaderAsset> shaderAsset = CreateTestShaderAsset(Uuid::CreateRandom(), m_testMaterialSrgLayout, optionsLayout);
+
+        MaterialTypeAssetCreator materialTypeCreator;
+        materialTypeCreator.Begin(Uuid::CreateRandom());
+        materialTypeCreator.AddShader(shaderAsset);
+        AddCommonTestMaterialProperties(materialTypeCreator);
+        materialTypeCreator.End(m_testMaterialTypeAsset);
+
+        MaterialAssetCreator materialAssetCreator;
+        materialAssetCreator.Begin(Uuid::CreateRandom(), m_testMaterialTypeAsset);
+        materialAssetCreator.End(m_testMaterialAsset);
+
+        r_bindlessMaterials = true;
+        Data::Instance<Material> material1 = Material::Create(m_testMaterialAsset);
+        Data::Instance<Material> material2 = Material::Create(m_testMaterialAsset);
+        r_bindlessMaterials = false;
+        Data::Instance<Material> material3 = Material::Create(m_testMaterialAsset);
+
+        // Both materials in bindless mode enable the shader option and bind the same material SRG
+        const ShaderOptionDescriptor& option = optionsLayout->GetShaderOption(ShaderOptionIndex{ 0 });
+        for (const Data::Instance<Material>& material : { material1, material2 })
+        {
+            EXPECT_TRUE(material->UsesParameterBuffer());
+            ASSERT_TRUE(material->GetDrawShaderResourceGroup());
+            EXPECT_NE(material->GetDrawShaderResourceGroup(), material->GetRHIShaderResourceGroup());
+
+            ShaderOptionGroup options{ optionsLayout, material->GetGeneralShaderCollection()[0].GetShaderVariantId() };
+            EXPECT_EQ(option.Get(options).GetIndex(), option.FindValue(Name{ "True" }).GetIndex());
+        }
+        EXPECT_EQ(material1->GetDrawShaderResourceGroup(), material2->GetDrawShaderResourceGroup());
+
+        // Materials without a parameter entry keep reading their own material SRG
+        EXPECT_FALSE(material3->UsesParameterBuffer());
+        EXPECT_EQ(material3->GetDrawShaderResourceGroup(), material3->GetRHIShaderResourceGroup());
+        ShaderOptionGroup options{ optionsLayout, material3->GetGeneralShaderCollection()[0].GetShaderVariantId() };
+        EXPECT_EQ(option.Get(options).GetIndex(), option.FindValue(Name{ "False" }).GetIndex());
+    }
+
     TEST_F(MaterialTests, TestInitialValuesFromMaterial)
     {
         Data::Instance<Material> material = Material::FindOrCreate(m_testMaterialAsset);
@@ -442,6 +517,67 @@ namespace UnitTest
         EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), 0.0f);
     }
 
+    TEST_F(MaterialTests, TestSetPropertyValueBackToCompiledValue)
+    {
+        Data::Instance<Material> material = Material::FindOrCreate(m_testMaterialAsset);
+
+        EXPECT_TRUE(material->SetPropertyValue<float>(material->FindPropertyIndex(Name{ "MyFloat" }), 2.5f));
+
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+        EXPECT_TRUE(material->Compile());
+
+        // Taint the SRG so we can check whether it was set by the SetPropertyValue() calls below.
+        const RHI::ShaderResourceGroup* srg = material->GetRHIShaderResourceGroup();
+        const RHI::ShaderResourceGroupData& srgData = srg->GetData();
+        const_cast<RHI::ShaderResourceGroupData*>(&srgData)->SetConstant(m_testMaterialSrgLayout->FindShaderInputConstantIndex(Name{"m_float"}), 0.0f);
+
+        // Change the property, then set it back to the compiled value before the next compile
+        EXPECT_TRUE(material->SetPropertyValue<float>(material->FindPropertyIndex(Name{ "MyFloat" }), 3.0f));
+        EXPECT_TRUE(material->SetPropertyValue<float>(material->FindPropertyIndex(Name{ "MyFloat" }), 2.5f));
+
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+        EXPECT_TRUE(material->Compile());
+
+        // Make sure the SRG is still tainted, because the value was already applied by the first compile
+        EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), 0.0f);
+    }
+
+    TEST_F(MaterialTests, CompileMaterials_ManyMaterials_CompilesEachMaterial)
+    {
+        MaterialSystem* materialSystem = MaterialSystem::Get();
+        ASSERT_NE(materialSystem, nullptr);
+
+        // Enough materials for several compile jobs, with one listed twice
+        AZStd::vector<Data::Instance<Material>> materials;
+        for (uint32_t i = 0; i < 40; ++i)
+        {
+            materials.push_back(Material::Create(m_testMaterialAsset));
+        }
+        materials.push_back(materials.front());
+
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+
+        // Starts a new frame of compile stats
+        materialSystem->FrameUpdate();
+
+        for (uint32_t i = 0; i < 40; ++i)
+        {
+            EXPECT_TRUE(materials[i]->SetPropertyValue<float>(materials[i]->FindPropertyIndex(Name{ "MyFloat" }), static_cast<float>(i)));
+        }
+
+        materialSystem->CompileMaterials(materials);
+
+        for (uint32_t i = 0; i < 40; ++i)
+        {
+            EXPECT_FALSE(materials[i]->NeedsCompile());
+            const RHI::ShaderResourceGroupData& srgData = materials[i]->GetRHIShaderResourceGroup()->GetData();
+            EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), static_cast<float>(i));
+        }
+
+        materialSystem->FrameUpdate();
+        EXPECT_EQ(materialSystem->GetCompiledMaterialCount(), 40u);
+    }
+
     TEST_F(MaterialTests, TestImageNotProvided)
     {
         Data::Asset<MaterialAsset> materialAssetWithEmptyImage;
@@ -12,6 +12,7 @@
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
 #include <Atom/RPI.Reflect/Model/ModelKdTree.h>
 #include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
+#include <Atom/RPI.Reflect/Model/ModelMeshlets.h>
 #include <Atom/RPI.Reflect/ResourcePoolAssetCreator.h>
 #include <Atom/RPI.Public/Model/UvStreamTangentBitmask.h>
 
@@ -351,6 +352,25 @@ namespace UnitTest
         ValidateModelAsset(serializedModelAsset.Get(), expectedModel);
     }
 
+    TEST_F(ModelTests, QueueLoadLodBufferAssets_LoadedLods_AreReady)
+    {
+        using namespace AZ;
+
+        ExpectedModel expectedModel;
+
+        const uint32_t lodCount = 3;
+        const uint32_t sharedMeshCount = 1;
+        const uint32_t separateMeshCount = 1;
+
+        Data::Asset<RPI::ModelAsset> modelAsset = BuildTestModel(lodCount, sharedMeshCount, separateMeshCount, expectedModel);
+
+        // The buffers of lods built in memory are already loaded, so the lods can be streamed in right away
+        for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
+        {
+            EXPECT_EQ(modelAsset->QueueLoadLodBufferAssets(lodIndex), Data::AssetData::AssetStatus::Ready);
+        }
+    }
+
     TEST_F(ModelTests, SerializeModelOneLodOneSharedMesh)
     {
         using namespace AZ;
@@ -1430,4 +1450,61 @@ namespace UnitTest
         EXPECT_THAT(t, testing::FloatEq(0.5f));
         EXPECT_THAT(normal, IsClose(AZ::Vector3::CreateAxisZ()));
     }
+
+    TEST(ModelMeshletTests, BuildMeshletClusters_FlatGrid_ClustersCoverIndicesAndFaceUp)
+    {
+        using namespace AZ;
+
+        // A 4x4 grid of quads in the xy plane, with its triangles facing +z
+        constexpr uint32_t GridSize = 4;
+        AZStd::vector<float> positions;
+        for (uint32_t y = 0; y <= GridSize; ++y)
+        {
+            for (uint32_t x = 0; x <= GridSize; ++x)
+            {
+                positions.insert(positions.end(), { static_cast<float>(x), static_cast<float>(y), 0.0f });
+            }
+        }
+
+        AZStd::vector<uint32_t> indices;
+        for (uint32_t y = 0; y < GridSize; ++y)
+        {
+            for (uint32_t x = 0; x < GridSize; ++x)
+            {
+                const uint32_t corner = y * (GridSize + 1) + x;
+                const uint32_t above = corner + GridSize + 1;
+                indices.insert(indices.end(), { corner, corner + 1, above + 1, corner, above + 1, above });
+            }
+        }
+
+        constexpr uint32_t MaxVertexCount = 8;
+        constexpr uint32_t MaxTriangleCount = 6;
+        AZStd::vector<RPI::MeshletCluster> clusters;
+        ASSERT_TRUE(RPI::MeshletUtils::BuildMeshletClusters(indices, positions, clusters, MaxVertexCount, MaxTriangleCount));
+        ASSERT_GT(clusters.size(), 1);
+
+        uint32_t nextIndex = 0;
+        for (const RPI::MeshletCluster& cluster : clusters)
+        {
+            EXPECT_EQ(cluster.m_firstIndex, nextIndex);
+            EXPECT_EQ(cluster.m_indexCount % 3, 0);
+            EXPECT_LE(cluster.m_indexCount, MaxTriangleCount * 3);
+            nextIndex += cluster.m_indexCount;
+
+            AZStd::vector<uint32_t> clusterVertices(indices.begin() + cluster.m_firstIndex, indices.begin() + nextIndex);
+            AZStd::sort(clusterVertices.begin(), clusterVertices.end());
+            EXPECT_LE(AZStd::unique(clusterVertices.begin(), clusterVertices.end()) - clusterVertices.begin(), MaxVertexCount);
+
+            EXPECT_THAT(Vector3::CreateFromFloat3(cluster.m_coneAxis), IsClose(Vector3::CreateAxisZ()));
+            const Vector3 center = Vector3::CreateFromFloat3(cluster.m_boundingSphere);
+            EXPECT_TRUE(RPI::MeshletUtils::IsMeshletClusterBackfacing(cluster, center - Vector3::CreateAxisZ(10.0f)));
+            EXPECT_FALSE(RPI::MeshletUtils::IsMeshletClusterBackfacing(cluster, center + Vector3::CreateAxisZ(10.0f)));
+        }
+        EXPECT_EQ(nextIndex, indices.size());
+
+        // Indices outside of the positions are rejected
+        indices.back() = (GridSize + 1) * (GridSize + 1);
+        EXPECT_FALSE(RPI::MeshletUtils::BuildMeshletClusters(indices, positions, clusters));
+        EXPECT_TRUE(clusters.empty());
+    }
 } // namespace UnitTest
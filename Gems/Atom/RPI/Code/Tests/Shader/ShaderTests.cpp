@@ -18,7 +18,9 @@
 #include <Atom/RPI.Edit/Shader/ShaderVariantAssetCreator.h>
 
 #include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RPI.Public/Shader/PipelineStatePrewarmer.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Public/Shader/ShaderVariantPrefetcher.h>
 
 #include <Common/RPITestFixture.h>
 #include <Common/ErrorMessageFinder.h>
@@ -1454,6 +1456,78 @@ namespace UnitTest
         ValidateShader(shader);
     }
 
+    TEST_F(ShaderTests, Shader_RecordUsage_RecordsEachPipelineStateOnce)
+    {
+        using namespace AZ;
+
+        Data::Instance<RPI::Shader> shader = RPI::Shader::FindOrCreate(CreateShaderAsset());
+
+        RPI::PipelineStatePrewarmer* pipelineStatePrewarmer = RPI::PipelineStatePrewarmer::Get();
+        ASSERT_NE(pipelineStatePrewarmer, nullptr);
+        const uint32_t recordedCount = pipelineStatePrewarmer->GetRecordedCount();
+
+        // Both acquire the same pipeline state from the root variant
+        RPI::r_psoRecordUsage = true;
+        ValidateShader(shader);
+        ValidateShader(shader);
+        RPI::r_psoRecordUsage = false;
+
+        EXPECT_EQ(pipelineStatePrewarmer->GetRecordedCount(), recordedCount + 1);
+
+        // Nothing is recorded once recording is disabled
+        RHI::PipelineStateDescriptorForDraw descriptorForDraw;
+        shader->GetRootVariant().ConfigurePipelineState(descriptorForDraw);
+        descriptorForDraw.m_renderStates.m_rasterState.m_cullMode = RHI::CullMode::Front;
+        descriptorForDraw.m_inputStreamLayout.SetTopology(RHI::PrimitiveTopology::TriangleList);
+        descriptorForDraw.m_inputStreamLayout.Finalize();
+        RHI::RenderAttachmentLayoutBuilder builder;
+        builder.AddSubpass()->RenderTargetAttachment(RHI::Format::R8G8B8A8_SNORM);
+        builder.End(descriptorForDraw.m_renderAttachmentConfiguration.m_renderAttachmentLayout);
+        EXPECT_NE(shader->AcquirePipelineState(descriptorForDraw), nullptr);
+        EXPECT_EQ(pipelineStatePrewarmer->GetRecordedCount(), recordedCount + 1);
+    }
+
+    TEST_F(ShaderTests, ShaderVariantPrefetcher_RecordUsage_LearnsEachVariantOncePerMaterial)
+    {
+        using namespace AZ;
+
+        RPI::ShaderVariantPrefetcher* shaderVariantPrefetcher = RPI::ShaderVariantPrefetcher::Get();
+        ASSERT_NE(shaderVariantPrefetcher, nullptr);
+        shaderVariantPrefetcher->SetPrefetchList({});
+
+        const Data::AssetId materialAssetId(Uuid::CreateRandom());
+        const Data::AssetId otherMaterialAssetId(Uuid::CreateRandom());
+        const Data::AssetId shaderAssetId(Uuid::CreateRandom());
+
+        RPI::ShaderVariantId variantId;
+        variantId.m_key = RPI::ShaderVariantKey(1);
+        variantId.m_mask = RPI::ShaderVariantKey(1);
+        RPI::ShaderVariantId otherVariantId = variantId;
+        otherVariantId.m_key = RPI::ShaderVariantKey(0);
+
+        shaderVariantPrefetcher->RecordUsage(materialAssetId, shaderAssetId, variantId);
+        shaderVariantPrefetcher->RecordUsage(materialAssetId, shaderAssetId, variantId);
+        EXPECT_EQ(shaderVariantPrefetcher->GetLearnedCount(), 1u);
+
+        shaderVariantPrefetcher->RecordUsage(materialAssetId, shaderAssetId, otherVariantId);
+        shaderVariantPrefetcher->RecordUsage(otherMaterialAssetId, shaderAssetId, variantId);
+        EXPECT_EQ(shaderVariantPrefetcher->GetLearnedCount(), 3u);
+
+        // Loading a level's list replaces what was learned
+        RPI::ShaderVariantPrefetchList prefetchList;
+        RPI::MaterialShaderVariantUsage& usage = prefetchList.m_usages.emplace_back();
+        usage.m_materialAssetId = materialAssetId;
+        usage.m_shaderAssetId = shaderAssetId;
+        usage.m_shaderVariantId = variantId;
+        shaderVariantPrefetcher->SetPrefetchList(prefetchList);
+        EXPECT_EQ(shaderVariantPrefetcher->GetLearnedCount(), 1u);
+
+        shaderVariantPrefetcher->RecordUsage(materialAssetId, shaderAssetId, variantId);
+        EXPECT_EQ(shaderVariantPrefetcher->GetLearnedCount(), 1u);
+
+        shaderVariantPrefetcher->SetPrefetchList({});
+    }
+
     TEST_F(ShaderTests, ValidateShaderVariantIdMath)
     {
         RPI::ShaderVariantId           idSmall;
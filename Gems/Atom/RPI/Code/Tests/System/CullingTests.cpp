@@ -9,6 +9,7 @@
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Scene/SceneSystemComponent.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
@@ -255,4 +256,132 @@ namespace UnitTest
             m_cullingScene->UnregisterCullable(object);
         }
     }
+
+    TEST_F(CullingTests, PersistentVisibilityRetestsUpdatedCullables)
+    {
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->RegisterOrUpdateCullable(object);
+        }
+
+        // The views don't move, so every cull after the first one reuses the previous frame's results
+        Cull(m_views);
+        Cull(m_views);
+        EXPECT_EQ(m_views[YPositive]->GetVisibleObjectList().size(), 4);
+        EXPECT_EQ(m_views[XPositive]->GetVisibleObjectList().size(), 1);
+
+        // Move one of the objects in front of the first camera in front of the last one
+        const Aabb movedAabb = Aabb::CreateCenterRadius(Vector3::CreateAxisX(12.0), 1.0);
+        m_testObjects[0].m_cullData.m_boundingObb = Obb::CreateFromAabb(movedAabb);
+        m_testObjects[0].m_cullData.m_boundingSphere = Sphere::CreateFromAabb(movedAabb);
+        m_testObjects[0].m_cullData.m_visibilityEntry.m_boundingVolume = movedAabb;
+        m_cullingScene->RegisterOrUpdateCullable(m_testObjects[0]);
+
+        Cull(m_views);
+        EXPECT_EQ(m_views[YPositive]->GetVisibleObjectList().size(), 3);
+        EXPECT_EQ(m_views[XPositive]->GetVisibleObjectList().size(), 2);
+
+        // Hiding an object doesn't update it in the visibility scene, but still has to be respected
+        m_testObjects[9].m_isHidden = true;
+        Cull(m_views);
+        EXPECT_EQ(m_views[YPositive]->GetVisibleObjectList().size(), 3);
+        EXPECT_EQ(m_views[XPositive]->GetVisibleObjectList().size(), 1);
+
+        m_testObjects[9].m_isHidden = false;
+        Cull(m_views);
+        EXPECT_EQ(m_views[XPositive]->GetVisibleObjectList().size(), 2);
+
+        // Removing an object rebuilds the caches
+        m_cullingScene->UnregisterCullable(m_testObjects[9]);
+        Cull(m_views);
+        EXPECT_EQ(m_views[XPositive]->GetVisibleObjectList().size(), 1);
+        EXPECT_EQ(m_views[XNegative]->GetVisibleObjectList().size(), 3);
+
+        for (size_t i = 0; i < 9; ++i)
+        {
+            m_cullingScene->UnregisterCullable(m_testObjects[i]);
+        }
+    }
+
+    TEST_F(CullingTests, Occluder_HidesCullablesBehindIt_OnlyInCameraViews)
+    {
+        if (!m_views[YPositive]->GetMaskedOcclusionCulling())
+        {
+            GTEST_SKIP() << "Software occlusion culling isn't supported on this platform";
+        }
+
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->RegisterOrUpdateCullable(object);
+        }
+
+        // A wall between the first camera and its objects
+        Occluder wall;
+        auto wallGeometry = AZStd::make_shared<OccluderGeometry>();
+        wallGeometry->m_positions = { -20.0f, 0.0f, -20.0f, 20.0f, 0.0f, -20.0f, 20.0f, 0.0f, 20.0f, -20.0f, 0.0f, 20.0f };
+        wallGeometry->m_indices = { 0, 1, 2, 2, 3, 0 };
+        wall.m_geometry = wallGeometry;
+        wall.m_localToWorld = Matrix3x4::CreateTranslation(Vector3::CreateAxisY(5.0f));
+        wall.m_aabb = Aabb::CreateFromMinMax(Vector3(-20.0f, 5.0f, -20.0f), Vector3(20.0f, 5.0f, 20.0f));
+        m_cullingScene->RegisterOrUpdateOccluder(wall);
+
+        Cull(m_views);
+        EXPECT_EQ(m_views[YPositive]->GetVisibleObjectList().size(), 0);
+        EXPECT_EQ(m_views[XNegative]->GetVisibleObjectList().size(), 3);
+
+        m_cullingScene->UnregisterOccluder(wall);
+        Cull(m_views);
+        EXPECT_EQ(m_views[YPositive]->GetVisibleObjectList().size(), 4);
+
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->UnregisterCullable(object);
+        }
+    }
+
+    TEST_F(CullingTests, StereoViewsShareCulling_BothViewsGetObjectsOfEitherFrustum)
+    {
+        // Two eyes looking down the y-forward axis, with a narrow field of view so some objects are only in one eye's frustum
+        RHI::DrawListMask drawListMask;
+        drawListMask.reset();
+        drawListMask.flip();
+
+        Matrix4x4 viewToClip = Matrix4x4::CreateIdentity();
+        MakePerspectiveFovMatrixRH(viewToClip, DegToRad(10.0f), 1.0f, 0.1f, 100.0f, true);
+
+        TestCameraList stereoViews;
+        for (float eyeOffset : { -0.2f, 0.2f })
+        {
+            ViewPtr view = View::CreateView(Name("TestViewXR"), RPI::View::UsageCamera | RPI::View::UsageXR);
+            view->SetDrawListMask(drawListMask);
+            view->SetCameraTransform(Matrix3x4::CreateTranslation(Vector3::CreateAxisX(eyeOffset)));
+            view->SetViewToClipMatrix(viewToClip);
+            stereoViews.push_back(view);
+        }
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            m_cullingScene->RegisterOrUpdateCullable(m_testObjects[i]);
+        }
+
+        // Only in the right eye's frustum
+        Cullable rightEyeObject;
+        InitializeCullableFromAabb(rightEyeObject, Aabb::CreateCenterRadius(Vector3(1.0f, 10.0f, 0.0f), 0.05f), 10);
+        m_cullingScene->RegisterOrUpdateCullable(rightEyeObject);
+
+        Cull(stereoViews);
+        EXPECT_EQ(stereoViews[0]->GetVisibleObjectList().size(), 5);
+        EXPECT_EQ(stereoViews[1]->GetVisibleObjectList().size(), 5);
+
+        // The culling of the pair is persistent like the culling of a single view
+        Cull(stereoViews);
+        EXPECT_EQ(stereoViews[0]->GetVisibleObjectList().size(), 5);
+        EXPECT_EQ(stereoViews[1]->GetVisibleObjectList().size(), 5);
+
+        m_cullingScene->UnregisterCullable(rightEyeObject);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            m_cullingScene->UnregisterCullable(m_testObjects[i]);
+        }
+    }
 }
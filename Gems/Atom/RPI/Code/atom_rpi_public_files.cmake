@@ -56,9 +56,11 @@ set(FILES
     Include/Atom/RPI.Public/Image/StreamingImageController.h
     Include/Atom/RPI.Public/Image/StreamingImagePool.h
     Include/Atom/RPI.Public/Material/Material.h
+    Include/Atom/RPI.Public/Material/MaterialParameterBuffer.h
     Include/Atom/RPI.Public/Material/MaterialSystem.h
     Include/Atom/RPI.Public/Model/Model.h
     Include/Atom/RPI.Public/Model/ModelLod.h
+    Include/Atom/RPI.Public/Model/ModelLodStreamingController.h
     Include/Atom/RPI.Public/Model/ModelLodUtils.h
     Include/Atom/RPI.Public/Model/ModelSystem.h
     Include/Atom/RPI.Public/Model/ModelTagSystemComponent.h
@@ -91,6 +93,7 @@ set(FILES
     Include/Atom/RPI.Public/Pass/Specific/RenderToTexturePass.h
     Include/Atom/RPI.Public/Pass/Specific/SelectorPass.h
     Include/Atom/RPI.Public/Pass/Specific/SwapChainPass.h
+    Include/Atom/RPI.Public/Shader/PipelineStatePrewarmer.h
     Include/Atom/RPI.Public/Shader/Shader.h
     Include/Atom/RPI.Public/Shader/ShaderReloadNotificationBus.h
     Include/Atom/RPI.Public/Shader/ShaderVariant.h
@@ -100,6 +103,7 @@ set(FILES
     Include/Atom/RPI.Public/Shader/ShaderSystem.h
     Include/Atom/RPI.Public/Shader/ShaderSystemInterface.h
     Include/Atom/RPI.Public/Shader/ShaderVariantAsyncLoader.h
+    Include/Atom/RPI.Public/Shader/ShaderVariantPrefetcher.h
     Include/Atom/RPI.Public/GpuQuery/GpuQuerySystem.h
     Include/Atom/RPI.Public/GpuQuery/GpuQuerySystemInterface.h
     Include/Atom/RPI.Public/GpuQuery/GpuQueryTypes.h
@@ -144,9 +148,11 @@ set(FILES
     Source/RPI.Public/Image/StreamingImageController.cpp
     Source/RPI.Public/Image/StreamingImagePool.cpp
     Source/RPI.Public/Material/Material.cpp
+    Source/RPI.Public/Material/MaterialParameterBuffer.cpp
     Source/RPI.Public/Material/MaterialSystem.cpp
     Source/RPI.Public/Model/Model.cpp
     Source/RPI.Public/Model/ModelLod.cpp
+    Source/RPI.Public/Model/ModelLodStreamingController.cpp
     Source/RPI.Public/Model/ModelLodUtils.cpp
     Source/RPI.Public/Model/ModelSystem.cpp
     Source/RPI.Public/Model/ModelTagSystemComponent.cpp
@@ -176,6 +182,7 @@ set(FILES
     Source/RPI.Public/Pass/Specific/RenderToTexturePass.cpp
     Source/RPI.Public/Pass/Specific/SelectorPass.cpp
     Source/RPI.Public/Pass/Specific/SwapChainPass.cpp
+    Source/RPI.Public/Shader/PipelineStatePrewarmer.cpp
     Source/RPI.Public/Shader/Shader.cpp
     Source/RPI.Public/Shader/ShaderVariant.cpp
     Source/RPI.Public/Shader/ShaderReloadDebugTracker.cpp
@@ -183,6 +190,7 @@ set(FILES
     Source/RPI.Public/Shader/ShaderResourceGroupPool.cpp
     Source/RPI.Public/Shader/ShaderSystem.cpp
     Source/RPI.Public/Shader/ShaderVariantAsyncLoader.cpp
+    Source/RPI.Public/Shader/ShaderVariantPrefetcher.cpp
     Source/RPI.Public/ColorManagement/GeneratedTransforms/ColorConversionConstants.inl
     Source/RPI.Public/ColorManagement/GeneratedTransforms/LinearSrgb_To_AcesCg.inl
     Source/RPI.Public/ColorManagement/GeneratedTransforms/AcesCg_To_LinearSrgb.inl
@@ -355,12 +355,16 @@ namespace AZ
             // Create the PassEntries, and returns the root entry.
             PassEntry* CreatePassEntries(RHI::Ptr<RPI::ParentPass> rootPass);
 
+            // Draws the command list recording time of each thread for the last frame.
+            void DrawCommandListRecordingWindow(bool& draw);
+
             // Holds a PathName -> PassEntry reference for the PassEntries. 
             AZStd::unordered_map<Name, PassEntry> m_passEntryDatabase;
 
             bool m_drawTimestampView = false;
             bool m_drawPipelineStatisticsView = false;
             bool m_drawGpuMemoryView = false;
+            bool m_drawCommandListRecordingView = false;
 
             ImGuiTimestampView m_timestampView;
             ImGuiPipelineStatisticsView m_pipelineStatisticsView;
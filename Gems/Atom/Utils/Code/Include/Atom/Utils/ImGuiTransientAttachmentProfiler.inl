@@ -212,6 +212,10 @@ namespace AZ
                             ImGui::Text("Type: %s", resourceType.c_str());
                             ImGui::Text("Size: %.1f MB", static_cast<double>(heapStats.m_heapSize * BytesToMB));
                             ImGui::Text("Watermark: %.1f MB", static_cast<double>(heapStats.m_watermarkSize * BytesToMB));
+                            if (heapStats.m_unpackedWatermarkSize > heapStats.m_watermarkSize)
+                            {
+                                ImGui::Text("Unpacked watermark: %.1f MB", static_cast<double>(heapStats.m_unpackedWatermarkSize * BytesToMB));
+                            }
                             ImGui::Text("Waste: %.1f%%", (1.0 - static_cast<double>(heapStats.m_watermarkSize) / heapStats.m_heapSize) * 100.0);
                             ImGui::EndTooltip();
                         }
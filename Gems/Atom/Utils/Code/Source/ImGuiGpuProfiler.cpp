@@ -8,6 +8,7 @@
 
 #include <Atom/Utils/ImGuiGpuProfiler.h>
 
+#include <Atom/RHI/FrameScheduler.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/RHIMemoryStatisticsInterface.h>
 #include <Atom/RHI.Reflect/MemoryStatistics.h>
@@ -1982,6 +1983,8 @@ namespace AZ
                 }
                 ImGui::Spacing();
                 ImGui::Checkbox("Enable GpuMemoryView", &m_drawGpuMemoryView);
+                ImGui::Spacing();
+                ImGui::Checkbox("Enable CommandListRecordingView", &m_drawCommandListRecordingView);
             });
 
             // Draw the PipelineStatistics window.
@@ -1993,6 +1996,9 @@ namespace AZ
             // Draw the GpuMemory window.
             m_gpuMemoryView.DrawGpuMemoryWindow(m_drawGpuMemoryView);
 
+            // Draw the CommandListRecording window.
+            DrawCommandListRecordingWindow(m_drawCommandListRecordingView);
+
             //closing window
             if (wasDraw && !draw)
             {
@@ -2001,6 +2007,51 @@ namespace AZ
             }
         }
 
+        void ImGuiGpuProfiler::DrawCommandListRecordingWindow(bool& draw)
+        {
+            // Only gather recording statistics while the window is open.
+            auto* rhiSystem = AZ::RHI::RHISystemInterface::Get();
+            rhiSystem->ModifyFrameSchedulerStatisticsFlags(AZ::RHI::FrameSchedulerStatisticsFlags::GatherCommandListRecordingStatistics, draw);
+
+            if (!draw)
+            {
+                return;
+            }
+
+            ImGui::SetNextWindowSize({ 400, 300 }, ImGuiCond_Once);
+            if (ImGui::Begin("Command List Recording", &draw, ImGuiWindowFlags_None))
+            {
+                const AZStd::vector<AZ::RHI::CommandListRecordingStatistics> recordingStatistics = rhiSystem->GetCommandListRecordingStatistics();
+                const double ticksPerMillisecond = aznumeric_cast<double>(AZStd::GetTimeTicksPerSecond()) / 1000.0;
+
+                double totalRecordingTimeMs = 0.0;
+                ImGui::Columns(3, "CommandListRecordingColumns");
+                ImGui::Text("Thread");
+                ImGui::NextColumn();
+                ImGui::Text("Recording Time (ms)");
+                ImGui::NextColumn();
+                ImGui::Text("Contexts");
+                ImGui::NextColumn();
+                ImGui::Separator();
+                for (const AZ::RHI::CommandListRecordingStatistics& statistics : recordingStatistics)
+                {
+                    const double recordingTimeMs = aznumeric_cast<double>(statistics.m_recordingTimeTicks) / ticksPerMillisecond;
+                    totalRecordingTimeMs += recordingTimeMs;
+
+                    ImGui::Text("%zu", AZStd::hash<AZStd::thread_id>{}(statistics.m_threadId));
+                    ImGui::NextColumn();
+                    ImGui::Text("%.3f", recordingTimeMs);
+                    ImGui::NextColumn();
+                    ImGui::Text("%u", statistics.m_contextCount);
+                    ImGui::NextColumn();
+                }
+                ImGui::Columns(1);
+                ImGui::Separator();
+                ImGui::Text("Threads: %zu Total: %.3f ms", recordingStatistics.size(), totalRecordingTimeMs);
+            }
+            ImGui::End();
+        }
+
         void ImGuiGpuProfiler::InterpolatePassEntries(AZStd::unordered_map<Name, PassEntry>& passEntryDatabase, float weight) const
         {
             for (auto& entry : passEntryDatabase)
@@ -95,6 +95,9 @@ namespace AZ
     public:
         void UnregisterFont(const char* fontName);
 
+        //! Returns the factor the height of a font texture can grow by when its glyphs don't fit in a frame
+        int GetFontTextureMaxGrowth() const { return r_fontTextureMaxGrowth; }
+
     private:
         using FontMap = AZStd::unordered_map<AzFramework::FontId, FFont*>;
         using FontMapItor = FontMap::iterator;
@@ -139,6 +142,7 @@ namespace AZ
         AzFramework::FontDrawInterface* m_defaultFontDrawInterface = nullptr;
 
         int r_persistFontFamilies = 1; //!< Persist fonts for application lifetime to prevent unnecessary work; enabled by default.
+        int r_fontTextureMaxGrowth = 4; //!< Max factor a font texture height grows by instead of evicting glyphs used in the same frame.
         AZStd::vector<FontFamilyPtr> m_persistedFontFamilies; //!< Stores persisted fonts (if "persist font families" is enabled)
     };
 }
@@ -16,6 +16,7 @@
 #include <AtomLyIntegration/AtomFont/GlyphBitmap.h>
 #include <AtomLyIntegration/AtomFont/AtomFont.h>
 #include <AtomLyIntegration/AtomFont/FFont.h>
+#include <AzCore/Time/ITime.h>
 
 
 namespace AZ
@@ -95,6 +96,12 @@ namespace AZ
         int GetWidthCellCount() { return m_widthCellCount; }
         int GetHeightCellCount() { return m_heightCellCount; }
 
+        //! Sets how many times the initial height of the texture it can grow to. When all the slots of the texture hold glyphs
+        //! used in the current frame, the texture height is doubled up to that limit, instead of evicting glyphs that would
+        //! have to be rendered again in the same frame. Growing changes the texture size, so the texture coordinates of
+        //! all the slots change with it.
+        void SetMaxHeightGrowth(int maxHeightGrowth) { m_maxHeightCellCount = m_initialHeightCellCount * AZ::GetMax(maxHeightGrowth, 1); }
+
         float GetTextureCellWidth() { return m_textureCellWidth; }
         float GetTextureCellHeight() { return m_textureCellHeight; }
 
@@ -176,6 +183,16 @@ namespace AZ
         int CreateSlotList(int listSize);
         int ReleaseSlotList();
 
+        //! Sets the texture coordinates of the slot from its index in the texture
+        void UpdateSlotTexCoords(TextureSlot* slot) const;
+
+        //! Doubles the number of rows of slots in the texture, up to the max height cell count.
+        //! The glyphs already in the texture keep their slots. Returns 0 if the texture can't grow
+        int GrowHeight();
+
+        //! Returns true if the slot holds a glyph used since the start of the current frame
+        bool IsSlotUsedThisFrame(const TextureSlot* slot) const;
+
         //! Updates the given font texture slot with the given glyph (UTF8) with the given parameters. If the glyph doesn't
         //! exist in the font texture at the given size, then the glyph will be rendered to the font texture with the given
         //! parameters.
@@ -229,6 +246,8 @@ namespace AZ
     
         int                         m_widthCellCount;
         int                         m_heightCellCount;
+        int                         m_initialHeightCellCount = 0;
+        int                         m_maxHeightCellCount = 0;
     
         int                         m_textureSlotCount;
     
@@ -242,6 +261,10 @@ namespace AZ
         FONT_TEXTURE_TYPE*          m_buffer;                           // [y*width * x] x=0..width-1, y=0..height-1
 
         uint16_t                    m_slotUsage;
+
+        // Slot usage at the start of the current frame, used to detect when the glyphs of a frame don't fit in the texture
+        uint16_t                    m_frameStartSlotUsage = 1;
+        AZ::TimeUs                  m_frameStartTime = AZ::Time::ZeroTimeUs;
     };
 }
 #endif // #if !defined(USE_NULLFONT_ALWAYS)
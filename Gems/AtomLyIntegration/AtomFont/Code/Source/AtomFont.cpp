@@ -334,6 +334,11 @@ AZ::AtomFont::AtomFont([[maybe_unused]] ISystem* system)
     // Persist fonts for application lifetime to prevent unnecessary work
     REGISTER_CVAR(r_persistFontFamilies, r_persistFontFamilies, VF_NULL, "Persist loaded font families for lifetime of application.");
 
+    // Grow font textures rather than thrash them when a frame uses more glyphs than they can hold (e.g. CJK text)
+    REGISTER_CVAR(r_fontTextureMaxGrowth, r_fontTextureMaxGrowth, VF_NULL,
+        "Maximum factor the height of a font texture can grow by when all its glyph slots are used in the same frame.\n"
+        "1 disables the growth, glyphs are then evicted from the font texture even if they were used in the same frame.");
+
 #if !defined(_RELEASE)
     REGISTER_COMMAND("r_DumfontTexture", DumfontTexture, 0,
         "Dumps the specified font's texture to a bitmap file\n"
@@ -1514,9 +1514,18 @@ void AZ::FFont::Prepare(const char* str, bool updateTexture, const AtomFont::Gly
 {
     const bool rerenderGlyphs = m_sizeBehavior == SizeBehavior::Rerender;
     const AtomFont::GlyphSize usedGlyphSize = rerenderGlyphs ? glyphSize : AtomFont::defaultGlyphSize;
+    m_fontTexture->SetMaxHeightGrowth(m_atomFont ? m_atomFont->GetFontTextureMaxGrowth() : 1);
     bool texUpdateNeeded = m_fontTexture->PreCacheString(str, nullptr, m_sizeRatio, usedGlyphSize, m_fontHintParams) == 1 || m_fontTexDirty;
     if (updateTexture && texUpdateNeeded && m_fontImage)
     {
+        // The font texture grows when the glyphs used in a frame don't fit in it, the image is then created again at the new size
+        if (m_fontTexture->GetHeight() != static_cast<int>(m_fontImage->GetDescriptor().m_size.m_height))
+        {
+            const uint32_t fontImageVersion = m_fontImageVersion;
+            InitTexture();
+            m_fontImageVersion = fontImageVersion;
+        }
+
         UpdateTexture();
         m_fontTexDirty = false;
         ++m_fontImageVersion;
@@ -102,6 +102,8 @@ int AZ::FontTexture::Create(int width, int height, AZ::FontSmoothMethod smoothMe
 
     m_widthCellCount = widthCellCount;
     m_heightCellCount = heightCellCount;
+    m_initialHeightCellCount = heightCellCount;
+    m_maxHeightCellCount = heightCellCount;
     m_textureSlotCount = m_widthCellCount * m_heightCellCount;
 
     m_smoothMethod = smoothMethod;
@@ -144,6 +146,8 @@ int AZ::FontTexture::Release()
 
     m_widthCellCount = 0;
     m_heightCellCount = 0;
+    m_initialHeightCellCount = 0;
+    m_maxHeightCellCount = 0;
     m_textureSlotCount = 0;
 
     m_width = 0;
@@ -252,6 +256,14 @@ int AZ::FontTexture::PreCacheString(const char* string, int* updated, float size
 {
      AZ::AtomFont::GlyphSize clampedGlyphSize = ClampGlyphSize(glyphSize, m_cellWidth, m_cellHeight);
 
+    const AZ::ITime* time = AZ::Interface<AZ::ITime>::Get();
+    const AZ::TimeUs frameTime = time ? time->GetLastSimulationTickTime() : AZ::Time::ZeroTimeUs;
+    if (frameTime != m_frameStartTime)
+    {
+        m_frameStartTime = frameTime;
+        m_frameStartSlotUsage = m_slotUsage;
+    }
+
     uint16_t slotUsage = m_slotUsage++;
     int updateCount = 0;
 
@@ -265,6 +277,13 @@ int AZ::FontTexture::PreCacheString(const char* string, int* updated, float size
         {
             slot = GetLRUSlot();
 
+            // Evicting a glyph used in this frame forces the text using it to be updated again,
+            // so make room for more glyphs if the texture can grow
+            if (slot && IsSlotUsedThisFrame(slot) && GrowHeight())
+            {
+                slot = GetLRUSlot();
+            }
+
             if (!slot)
             {
                 return 0;
@@ -428,19 +447,85 @@ int AZ::FontTexture::CreateSlotList(int listSize)
 
         pTextureSlot->m_textureSlot = i;
         pTextureSlot->Reset();
+        UpdateSlotTexCoords(pTextureSlot);
 
-        y = i / m_widthCellCount;
-        x = i % m_widthCellCount;
+        m_slotList.push_back(pTextureSlot);
+    }
 
-        pTextureSlot->m_texCoords[0] = (float)(x * m_textureCellWidth) + (0.5f / (float)m_width);
-        pTextureSlot->m_texCoords[1] = (float)(y * m_textureCellHeight) + (0.5f / (float)m_height);
+    return 1;
+}
 
-        m_slotList.push_back(pTextureSlot);
+//-------------------------------------------------------------------------------------------------
+void AZ::FontTexture::UpdateSlotTexCoords(TextureSlot* slot) const
+{
+    const int y = slot->m_textureSlot / m_widthCellCount;
+    const int x = slot->m_textureSlot % m_widthCellCount;
+
+    slot->m_texCoords[0] = (float)(x * m_textureCellWidth) + (0.5f / (float)m_width);
+    slot->m_texCoords[1] = (float)(y * m_textureCellHeight) + (0.5f / (float)m_height);
+}
+
+//-------------------------------------------------------------------------------------------------
+int AZ::FontTexture::GrowHeight()
+{
+    if (m_heightCellCount >= m_maxHeightCellCount)
+    {
+        return 0;
+    }
+
+    const int heightCellCount = AZ::GetMin(m_heightCellCount * 2, m_maxHeightCellCount);
+    const int height = heightCellCount * m_cellHeight;
+
+    // The buffer is stored row by row, so the existing glyphs stay at the same place in the taller buffer
+    FONT_TEXTURE_TYPE* buffer = new FONT_TEXTURE_TYPE[m_width * height];
+    if (!buffer)
+    {
+        return 0;
+    }
+
+    const int copiedHeight = AZ::GetMin(m_height, height);
+    memcpy(buffer, m_buffer, m_width * copiedHeight * sizeof(FONT_TEXTURE_TYPE));
+    memset(buffer + m_width * copiedHeight, 0, m_width * (height - copiedHeight) * sizeof(FONT_TEXTURE_TYPE));
+    delete[] m_buffer;
+    m_buffer = buffer;
+
+    m_height = height;
+    m_invHeight = 1.0f / (float)height;
+    m_heightCellCount = heightCellCount;
+    m_textureCellHeight = m_cellHeight * m_invHeight;
+
+    const int previousSlotCount = m_textureSlotCount;
+    m_textureSlotCount = m_widthCellCount * m_heightCellCount;
+    for (int i = previousSlotCount; i < m_textureSlotCount; ++i)
+    {
+        TextureSlot* textureSlot = new TextureSlot;
+        textureSlot->m_textureSlot = i;
+        textureSlot->Reset();
+        m_slotList.push_back(textureSlot);
+    }
+
+    // The texture coordinates are normalized, so they change for all the slots
+    for (TextureSlot* textureSlot : m_slotList)
+    {
+        UpdateSlotTexCoords(textureSlot);
     }
 
     return 1;
 }
 
+//-------------------------------------------------------------------------------------------------
+bool AZ::FontTexture::IsSlotUsedThisFrame(const TextureSlot* slot) const
+{
+    if (slot->m_slotUsage == 0)
+    {
+        return false;
+    }
+
+    const uint16_t slotAge = m_slotUsage - slot->m_slotUsage;
+    const uint16_t frameAge = m_slotUsage - m_frameStartSlotUsage;
+    return slotAge <= frameAge;
+}
+
 //-------------------------------------------------------------------------------------------------
 int AZ::FontTexture::ReleaseSlotList()
 {
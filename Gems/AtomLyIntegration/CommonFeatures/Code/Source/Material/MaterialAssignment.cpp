@@ -6,6 +6,7 @@
  *
  */
 
+#include <Atom/RPI.Public/Material/MaterialSystem.h>
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
 #include <AtomLyIntegration/CommonFeatures/Material/MaterialAssignment.h>
 #include <AzCore/Asset/AssetSerializer.h>
@@ -189,8 +190,19 @@ namespace AZ
                 }
             }
 
-            // Return true if there is nothing to compile, meaning no properties changed, or the compile succeeded
-            return !m_materialInstance->NeedsCompile() || m_materialInstance->Compile();
+            if (!m_materialInstance->NeedsCompile())
+            {
+                return true;
+            }
+
+            // The material system compiles the queued materials of every entity together, and retries the ones that can't compile yet
+            if (RPI::MaterialSystem* materialSystem = RPI::MaterialSystem::Get())
+            {
+                return materialSystem->QueueCompile(m_materialInstance);
+            }
+
+            // Return true if the compile succeeded
+            return m_materialInstance->Compile();
         }
 
         AZStd::string MaterialAssignment::ToString() const
@@ -165,6 +165,18 @@ namespace AZ::Render
         }
     }
 
+    void AtomActorInstance::ReadbackSkinnedPositions(
+        uint32_t lodIndex, uint32_t meshIndex, SkinnedMeshFeatureProcessorInterface::SkinnedPositionsCallback callback) const
+    {
+        if (!m_skinnedMeshFeatureProcessor || !m_skinnedMeshHandle.IsValid())
+        {
+            callback({});
+            return;
+        }
+
+        m_skinnedMeshFeatureProcessor->ReadbackSkinnedPositions(m_skinnedMeshHandle, lodIndex, meshIndex, AZStd::move(callback));
+    }
+
     AtomActor* AtomActorInstance::GetRenderActor() const
     {
         EMotionFX::Integration::ActorAsset* actorAsset = m_actorAsset.Get();
@@ -102,6 +102,11 @@ namespace AZ
 
             AtomActor* GetRenderActor() const;
 
+            //! Reads the GPU skinned vertex positions of a mesh back asynchronously, for gameplay queries on the deformed mesh.
+            //! See SkinnedMeshFeatureProcessorInterface::ReadbackSkinnedPositions.
+            void ReadbackSkinnedPositions(
+                uint32_t lodIndex, uint32_t meshIndex, SkinnedMeshFeatureProcessorInterface::SkinnedPositionsCallback callback) const;
+
             /////////////////////////////////////////////
 
 
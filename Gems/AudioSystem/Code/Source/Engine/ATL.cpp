@@ -341,13 +341,23 @@ namespace Audio
                     else if (audioObject->HasPosition())
                     {
                         auto const positionalObject = static_cast<CATLAudioObject*>(audioObject);
-                        AudioSystemImplementationRequestBus::BroadcastResult(
-                            result, &AudioSystemImplementationRequestBus::Events::SetPosition, positionalObject->GetImplDataPtr(),
-                            request.m_position);
-
-                        if (result == EAudioRequestStatus::Success)
+                        positionalObject->SetHasMultiplePositions(false);
+                        if (positionalObject->IsVirtual())
                         {
+                            // Only tracked until the object becomes audible again.
                             positionalObject->SetPosition(request.m_position);
+                            result = EAudioRequestStatus::Success;
+                        }
+                        else
+                        {
+                            AudioSystemImplementationRequestBus::BroadcastResult(
+                                result, &AudioSystemImplementationRequestBus::Events::SetPosition, positionalObject->GetImplDataPtr(),
+                                request.m_position);
+
+                            if (result == EAudioRequestStatus::Success)
+                            {
+                                positionalObject->SetPosition(request.m_position);
+                            }
                         }
                     }
                     else
@@ -474,6 +484,7 @@ namespace Audio
                     else if (audioObject->HasPosition())
                     {
                         auto const positionalObject = static_cast<CATLAudioObject*>(audioObject);
+                        positionalObject->SetHasMultiplePositions(true);
                         AudioSystemImplementationRequestBus::BroadcastResult(
                             result, &AudioSystemImplementationRequestBus::Events::SetMultiplePositions, positionalObject->GetImplDataPtr(),
                             request.m_params);
@@ -231,6 +231,8 @@ namespace Audio
         CATLAudioObjectBase::Clear();
         m_oPosition = SATLWorldPosition();
         m_raycastProcessor.Reset();
+        m_nFlags &= ~(eAOF_VIRTUAL | eAOF_MULTIPLE_POSITIONS);
+        m_fVirtualStateDurationMS = 0.0f;
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -251,6 +253,42 @@ namespace Audio
         m_oPosition = oNewPosition;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CATLAudioObject::SetHasMultiplePositions(const bool hasMultiplePositions)
+    {
+        if (hasMultiplePositions)
+        {
+            m_nFlags |= eAOF_MULTIPLE_POSITIONS;
+            m_nFlags &= ~eAOF_VIRTUAL;
+        }
+        else
+        {
+            m_nFlags &= ~eAOF_MULTIPLE_POSITIONS;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CATLAudioObject::UpdateVirtualState(const bool shouldBeVirtual, const float fUpdateIntervalMS, const float fMinStateDurationMS)
+    {
+        m_fVirtualStateDurationMS += fUpdateIntervalMS;
+
+        if (shouldBeVirtual == IsVirtual() || m_fVirtualStateDurationMS < fMinStateDurationMS)
+        {
+            return false;
+        }
+
+        if (shouldBeVirtual)
+        {
+            m_nFlags |= eAOF_VIRTUAL;
+        }
+        else
+        {
+            m_nFlags &= ~eAOF_VIRTUAL;
+        }
+        m_fVirtualStateDurationMS = 0.0f;
+        return true;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CATLAudioObject::SetVelocityTracking(const bool bTrackingOn)
     {
@@ -369,9 +369,31 @@ namespace Audio
         }
         void UpdateVelocity(const float fUpdateIntervalMS);
 
+        // A virtual object keeps track of its position, but its position and per-object updates aren't sent to the
+        // audio implementation until it becomes audible again.
+        bool IsVirtual() const
+        {
+            return (m_nFlags & eAOF_VIRTUAL) != 0;
+        }
+        // Objects positioned with multiple positions have no single position to measure their distance from.
+        bool CanVirtualize() const
+        {
+            return (m_nFlags & eAOF_MULTIPLE_POSITIONS) == 0;
+        }
+        void SetHasMultiplePositions(const bool hasMultiplePositions);
+        // Changes the virtual state once the object has been in its current state for at least fMinStateDurationMS.
+        // Returns true if the state changed.
+        bool UpdateVirtualState(const bool shouldBeVirtual, const float fUpdateIntervalMS, const float fMinStateDurationMS);
+
+        const SATLWorldPosition& GetPosition() const
+        {
+            return m_oPosition;
+        }
+
     private:
         TATLEnumFlagsType m_nFlags;
         float m_fPreviousVelocity;
+        float m_fVirtualStateDurationMS = 0.0f;
         SATLWorldPosition m_oPosition;
         SATLWorldPosition m_oPreviousPosition;
 
@@ -383,10 +405,6 @@ namespace Audio
             AzFramework::DebugDisplayRequests& debugDisplay,
             const AZ::Vector3& listenerPos,
             const CATLDebugNameStore* const debugNameStore) const;
-        const SATLWorldPosition& GetPosition() const
-        {
-            return m_oPosition;
-        }
 #endif // !AUDIO_RELEASE
     };
 
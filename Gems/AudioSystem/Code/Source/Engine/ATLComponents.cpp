@@ -294,11 +294,13 @@ namespace Audio
 
         m_raycastManager.ProcessRaycastResults(fUpdateIntervalMS);
 
+        UpdateVirtualObjects(fUpdateIntervalMS, rListenerPosition);
+
         for (auto& audioObjectPair : m_cAudioObjects)
         {
             CATLAudioObject* const pObject = audioObjectPair.second;
 
-            if (pObject->HasActiveEvents())
+            if (pObject->HasActiveEvents() && !pObject->IsVirtual())
             {
                 AZ_PROFILE_SCOPE(Audio, "Inner Per-Object CAudioObjectManager::Update");
 
@@ -330,6 +332,63 @@ namespace Audio
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioObjectManager::UpdateVirtualObjects(const float fUpdateIntervalMS, const SATLWorldPosition& rListenerPosition)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        auto restorePosition = [](CATLAudioObject* const pObject)
+        {
+            // Catches the audio implementation up with the position tracked while the object was virtual.
+            AudioSystemImplementationRequestBus::Broadcast(
+                &AudioSystemImplementationRequestBus::Events::SetPosition, pObject->GetImplDataPtr(), pObject->GetPosition());
+        };
+
+        const float virtualizationDistance = static_cast<float>(Audio::CVars::s_VirtualizationDistance);
+        const size_t maxAudibleObjects = static_cast<AZ::u32>(Audio::CVars::s_MaxAudibleAudioObjects);
+        const float minStateDurationMS = static_cast<float>(Audio::CVars::s_VirtualizationMinTimeMs);
+        const bool virtualizationEnabled = virtualizationDistance > 0.0f || maxAudibleObjects > 0;
+
+        m_virtualizationCandidates.clear();
+        const AZ::Vector3 listenerPosition = rListenerPosition.GetPositionVec();
+        for (auto& audioObjectPair : m_cAudioObjects)
+        {
+            CATLAudioObject* const pObject = audioObjectPair.second;
+            if (virtualizationEnabled && pObject->HasActiveEvents() && pObject->CanVirtualize())
+            {
+                m_virtualizationCandidates.emplace_back(pObject->GetPosition().GetPositionVec().GetDistanceSq(listenerPosition), pObject);
+            }
+            else if (pObject->IsVirtual())
+            {
+                // Objects which stopped playing are restored right away, so their next trigger starts at the right position.
+                pObject->UpdateVirtualState(false, fUpdateIntervalMS, 0.0f);
+                restorePosition(pObject);
+            }
+        }
+
+        // Only the closest objects stay audible when there are more than the maximum.
+        float maxAudibleDistanceSq = virtualizationDistance > 0.0f ? virtualizationDistance * virtualizationDistance : AZ::Constants::FloatMax;
+        if (maxAudibleObjects > 0 && m_virtualizationCandidates.size() > maxAudibleObjects)
+        {
+            auto nthCandidate = m_virtualizationCandidates.begin() + maxAudibleObjects - 1;
+            AZStd::nth_element(m_virtualizationCandidates.begin(), nthCandidate, m_virtualizationCandidates.end(),
+                [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.first < rhs.first;
+                });
+            maxAudibleDistanceSq = AZStd::min(maxAudibleDistanceSq, nthCandidate->first);
+        }
+
+        for (const auto& [distanceSq, pObject] : m_virtualizationCandidates)
+        {
+            if (pObject->UpdateVirtualState(distanceSq > maxAudibleDistanceSq, fUpdateIntervalMS, minStateDurationMS)
+                && !pObject->IsVirtual())
+            {
+                restorePosition(pObject);
+            }
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     bool CAudioObjectManager::ReserveID(TAudioObjectID& rAudioObjectID, const char* const sAudioObjectName)
     {
@@ -1728,6 +1787,7 @@ namespace Audio
 
         AZStd::string str;
         size_t activeObjects = 0;
+        size_t virtualObjects = 0;
         size_t aliveObjects = m_cAudioObjects.size();
         size_t remainingObjects = (m_cObjectPool.m_nReserveSize > aliveObjects ? m_cObjectPool.m_nReserveSize - aliveObjects : 0);
         const float fHeaderPosY = fPosY;
@@ -1756,9 +1816,9 @@ namespace Audio
                 audioObject->GetObstOccData(propData);
 
                 str = AZStd::string::format(
-                    "[%.2f  %.2f  %.2f] (ID: %llu  Obst: %.2f  Occl: %.2f): %s",
+                    "[%.2f  %.2f  %.2f] (ID: %llu  Obst: %.2f  Occl: %.2f%s): %s",
                     position.GetX(), position.GetY(), position.GetZ(), audioObject->GetID(),
-                    propData.fObstruction, propData.fOcclusion, audioObjectName.c_str());
+                    propData.fObstruction, propData.fOcclusion, audioObject->IsVirtual() ? "  Virtual" : "", audioObjectName.c_str());
                 debugDisplay.SetColor(hasActiveEvents ? itemActiveColor : itemInactiveColor);
                 debugDisplay.Draw2dTextLabel(fPosX, fPosY, textSize, str.c_str());
 
@@ -1768,12 +1828,16 @@ namespace Audio
             if (hasActiveEvents)
             {
                 ++activeObjects;
+                if (audioObject->IsVirtual())
+                {
+                    ++virtualObjects;
+                }
             }
         }
 
-        static const char* headerFormat = "Audio Objects [Active : %3zu | Alive: %3zu | Pool: %3zu | Remaining: %3zu]";
+        static const char* headerFormat = "Audio Objects [Active : %3zu | Virtual: %3zu | Alive: %3zu | Pool: %3zu | Remaining: %3zu]";
         const bool overloaded = (m_cAudioObjects.size() > m_cObjectPool.m_nReserveSize);
-        str = AZStd::string::format(headerFormat, activeObjects, aliveObjects,
+        str = AZStd::string::format(headerFormat, activeObjects, virtualObjects, aliveObjects,
             m_cObjectPool.m_nReserveSize, remainingObjects);
         debugDisplay.SetColor(overloaded ? overloadColor : headerColor);
         debugDisplay.Draw2dTextLabel(fPosX, fHeaderPosY, textSize, str.c_str());
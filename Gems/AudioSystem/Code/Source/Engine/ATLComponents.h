@@ -139,7 +139,13 @@ namespace Audio
         CATLAudioObject* GetInstance();
         bool ReleaseInstance(CATLAudioObject* const pOldObject);
 
+        // Virtualizes the playing objects which are too far from the listener, or beyond the maximum number of audible objects,
+        // and restores the position of the objects which become audible again.
+        void UpdateVirtualObjects(const float fUpdateIntervalMS, const SATLWorldPosition& rListenerPosition);
+
         TActiveObjectMap m_cAudioObjects;
+        // Playing objects which can be virtualized, with their squared distance to the listener
+        AZStd::vector<AZStd::pair<float, CATLAudioObject*>, Audio::AudioSystemStdAllocator> m_virtualizationCandidates;
         CInstanceManager<CATLAudioObject, TAudioObjectID> m_cObjectPool;
         float m_fTimeSinceLastVelocityUpdateMS;
 
@@ -38,6 +38,8 @@ namespace Audio
     {
         eAOF_NONE = 0,
         eAOF_TRACK_VELOCITY = AUDIO_BIT(0),
+        eAOF_VIRTUAL = AUDIO_BIT(1),
+        eAOF_MULTIPLE_POSITIONS = AUDIO_BIT(2),
     };
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
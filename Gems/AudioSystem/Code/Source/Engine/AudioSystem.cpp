@@ -103,6 +103,15 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioSystem::PushRequest(AudioRequestVariant&& request)
     {
+        if (g_mainThreadId == AZStd::this_thread::get_id())
+        {
+            if (BatchRequest(AZStd::move(request)))
+            {
+                SubmitBatchedRequests();
+            }
+            return;
+        }
+
         AZStd::scoped_lock lock(m_pendingRequestsMutex);
         m_pendingRequestsQueue.push_back(AZStd::move(request));
     }
@@ -110,6 +119,20 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioSystem::PushRequests(AudioRequestsQueue& requests)
     {
+        if (g_mainThreadId == AZStd::this_thread::get_id())
+        {
+            bool submitNow = false;
+            for (auto& request : requests)
+            {
+                submitNow |= BatchRequest(AZStd::move(request));
+            }
+            if (submitNow)
+            {
+                SubmitBatchedRequests();
+            }
+            return;
+        }
+
         AZStd::scoped_lock lock(m_pendingRequestsMutex);
         for (auto& request : requests)
         {
@@ -120,6 +143,11 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioSystem::PushRequestBlocking(AudioRequestVariant&& request)
     {
+        if (g_mainThreadId == AZStd::this_thread::get_id())
+        {
+            SubmitBatchedRequests();
+        }
+
         // Add this request to be processed immediately.
         // Release the m_processingEvent so that when the request is finished the audio thread doesn't
         // block through it's normal time slice and can immediately re-enter the run loop to process more.
@@ -142,12 +170,86 @@ namespace Audio
         m_pendingCallbacksQueue.push_back(AZStd::move(callback));
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CAudioSystem::BatchRequest(AudioRequestVariant&& requestVariant)
+    {
+        // Main Thread!
+        // Requests with a callback or flags are kept as they are, their callers expect one result per request.
+        if (auto setPosition = AZStd::get_if<Audio::ObjectRequest::SetPosition>(&requestVariant);
+            setPosition != nullptr && !setPosition->m_callback && setPosition->m_flags == 0)
+        {
+            auto [indexIter, inserted] = m_batchedPositionIndices.try_emplace(setPosition->m_audioObjectId, m_batchedRequestsQueue.size());
+            if (!inserted)
+            {
+                // Only the latest position of the object is needed.
+                AZStd::get<Audio::ObjectRequest::SetPosition>(m_batchedRequestsQueue[indexIter->second]).m_position =
+                    setPosition->m_position;
+                return false;
+            }
+        }
+        else if (auto setParameter = AZStd::get_if<Audio::ObjectRequest::SetParameterValue>(&requestVariant);
+            setParameter != nullptr && !setParameter->m_callback && setParameter->m_flags == 0)
+        {
+            auto [indexIter, inserted] = m_batchedParameterIndices.try_emplace(
+                AZStd::make_pair(setParameter->m_audioObjectId, setParameter->m_parameterId), m_batchedRequestsQueue.size());
+            if (!inserted)
+            {
+                // Only the latest value of the parameter is needed.
+                AZStd::get<Audio::ObjectRequest::SetParameterValue>(m_batchedRequestsQueue[indexIter->second]).m_value =
+                    setParameter->m_value;
+                return false;
+            }
+        }
+        else
+        {
+            // Any other request, e.g. executing a trigger, is submitted right away along with the updates batched before it,
+            // so the updates keep their order with it and it isn't delayed until the end of the frame.
+            m_batchedRequestsQueue.push_back(AZStd::move(requestVariant));
+            return true;
+        }
+
+        m_batchedRequestsQueue.push_back(AZStd::move(requestVariant));
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioSystem::SubmitBatchedRequests()
+    {
+        // Main Thread!
+        if (m_batchedRequestsQueue.empty())
+        {
+            return;
+        }
+
+        {
+            AZStd::scoped_lock lock(m_pendingRequestsMutex);
+            if (m_pendingRequestsQueue.empty())
+            {
+                m_pendingRequestsQueue.swap(m_batchedRequestsQueue);
+            }
+            else
+            {
+                for (auto& request : m_batchedRequestsQueue)
+                {
+                    m_pendingRequestsQueue.push_back(AZStd::move(request));
+                }
+            }
+        }
+
+        m_batchedRequestsQueue.clear();
+        m_batchedPositionIndices.clear();
+        m_batchedParameterIndices.clear();
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioSystem::ExternalUpdate()
     {
         // Main Thread!
         AZ_Assert(g_mainThreadId == AZStd::this_thread::get_id(), "AudioSystem::ExternalUpdate - called from non-Main thread!");
 
+        // Submits the position and parameter updates of the frame.
+        SubmitBatchedRequests();
+
         {
             AudioRequestsQueue callbacksToProcess{};
             {
@@ -14,6 +14,7 @@
 
 #include <AzCore/Debug/Budget.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -25,6 +26,8 @@
 
 AZ_DECLARE_BUDGET(Audio);
 
+class AudioSystemRequestBatchTest;
+
 namespace Audio
 {
     // Forward declarations.
@@ -59,6 +62,7 @@ namespace Audio
         #endif
     {
         friend class CAudioThread;
+        friend class ::AudioSystemRequestBatchTest;
 
     public:
         AZ_RTTI(CAudioSystem, "{96254647-000D-4896-93C4-92E0F258F21D}", IAudioSystem);
@@ -105,6 +109,12 @@ namespace Audio
 
         void InternalUpdate();
 
+        // Adds a request pushed from the main thread to the batch of the frame.
+        // Position and parameter updates replace the previous update of the same object and parameter in the batch.
+        // Returns true if the batch should be submitted now, so the request isn't delayed until the end of the frame.
+        bool BatchRequest(AudioRequestVariant&& request);
+        void SubmitBatchedRequests();
+
         bool m_bSystemInitialized;
 
         // Using microseconds to allow sub-millisecond sleeping. 4000us is 4ms.
@@ -121,6 +131,13 @@ namespace Audio
         AZStd::mutex m_pendingRequestsMutex;
         AZStd::mutex m_pendingCallbacksMutex;
 
+        // Requests pushed from the main thread, only accessed by the main thread.
+        // They're submitted to the pending requests queue once per frame and the batched updates are
+        // indexed by object, so the many emitters updating every frame only lock the queue once.
+        AudioRequestsQueue m_batchedRequestsQueue;
+        AZStd::unordered_map<TAudioObjectID, size_t> m_batchedPositionIndices;
+        AZStd::unordered_map<AZStd::pair<TAudioObjectID, TAudioControlID>, size_t> m_batchedParameterIndices;
+
         // Synchronization objects
         AZStd::binary_semaphore m_mainEvent;
         AZStd::binary_semaphore m_processingEvent;
@@ -157,6 +157,24 @@ namespace Audio::CVars
         "2: All AudioProxy's initialize asynchronously.\n"
         "Usage: s_AudioProxiesInitType=2\n");
 
+    AZ_CVAR(float, s_VirtualizationDistance, 0.f,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Audio objects playing farther than this distance from the listener are virtualized: their position is tracked,\n"
+        "but it isn't sent to the audio system along with the other per-object updates until they get closer. 0 to disable.\n"
+        "Usage: s_VirtualizationDistance=100.0\n");
+
+    AZ_CVAR(AZ::u32, s_MaxAudibleAudioObjects, 0,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of playing audio objects which aren't virtualized, the ones farthest from the listener are virtualized first.\n"
+        "0 for no limit.\n"
+        "Usage: s_MaxAudibleAudioObjects=64\n");
+
+    AZ_CVAR(float, s_VirtualizationMinTimeMs, 500.f,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Minimum time in milliseconds an audio object stays virtual, or audible, before it can switch again.\n"
+        "Prevents objects moving around the virtualization distance from switching every update.\n"
+        "Usage: s_VirtualizationMinTimeMs=250.0\n");
+
     auto OnChangeAudioLanguage = []([[maybe_unused]] const AZ::CVarFixedString& language) -> void
     {
         if (auto audioSystem = AZ::Interface<IAudioSystem>::Get();
@@ -20,6 +20,7 @@
 #include <ATLUtils.h>
 #include <ATL.h>
 #include <AudioProxy.h>
+#include <AudioSystem.h>
 
 #include <Mocks/ATLEntitiesMock.h>
 #include <Mocks/AudioSystemImplementationMock.h>
@@ -149,6 +150,37 @@ TEST_F(ATLAudioObjectTest, SetRaycastCalcType_SetAllTypes_AffectsCanRunRaycasts)
     EXPECT_TRUE(audioObject.CanRunRaycasts());
 }
 
+TEST_F(ATLAudioObjectTest, UpdateVirtualState_BeforeMinStateDuration_StateUnchanged)
+{
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+    EXPECT_FALSE(audioObject.IsVirtual());
+
+    EXPECT_FALSE(audioObject.UpdateVirtualState(true, 100.f, 250.f));
+    EXPECT_FALSE(audioObject.UpdateVirtualState(true, 100.f, 250.f));
+    EXPECT_FALSE(audioObject.IsVirtual());
+
+    EXPECT_TRUE(audioObject.UpdateVirtualState(true, 100.f, 250.f));
+    EXPECT_TRUE(audioObject.IsVirtual());
+
+    // The time spent in the state restarts from the change.
+    EXPECT_FALSE(audioObject.UpdateVirtualState(false, 100.f, 250.f));
+    EXPECT_TRUE(audioObject.IsVirtual());
+}
+
+TEST_F(ATLAudioObjectTest, SetHasMultiplePositions_VirtualObject_RestoredAndCantVirtualize)
+{
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+    EXPECT_TRUE(audioObject.UpdateVirtualState(true, 0.f, 0.f));
+    EXPECT_TRUE(audioObject.CanVirtualize());
+
+    audioObject.SetHasMultiplePositions(true);
+    EXPECT_FALSE(audioObject.IsVirtual());
+    EXPECT_FALSE(audioObject.CanVirtualize());
+
+    audioObject.SetHasMultiplePositions(false);
+    EXPECT_TRUE(audioObject.CanVirtualize());
+}
+
 
 TEST_F(ATLAudioObjectTest, OnAudioRaycastResults_MultiRaycastZeroDistanceHits_ZeroObstructionAndOcclusion)
 {
@@ -1161,3 +1193,206 @@ TEST_F(ATLTestFixture, AudioProxy_SimulateQueuedCommands_NumCommandsExecutedMatc
     EXPECT_CALL(m_sys, PushRequest).WillOnce(::testing::Return());
     m_proxy.Release();
 }
+
+
+
+//-------------------------------------//
+// Test CAudioSystem request batching //
+//-------------------------------------//
+
+class AudioSystemRequestBatchTest
+    : public ::testing::Test
+{
+protected:
+    static Audio::ObjectRequest::SetPosition MakeSetPosition(TAudioObjectID objectId, const AZ::Vector3& position)
+    {
+        Audio::ObjectRequest::SetPosition setPosition;
+        setPosition.m_audioObjectId = objectId;
+        setPosition.m_position = SATLWorldPosition(position);
+        return setPosition;
+    }
+
+    static Audio::ObjectRequest::SetParameterValue MakeSetParameterValue(TAudioObjectID objectId, TAudioControlID parameterId, float value)
+    {
+        Audio::ObjectRequest::SetParameterValue setParameter;
+        setParameter.m_audioObjectId = objectId;
+        setParameter.m_parameterId = parameterId;
+        setParameter.m_value = value;
+        return setParameter;
+    }
+
+    // Returns the requests submitted to the audio thread.
+    const AudioRequestsQueue& GetPendingRequests() const
+    {
+        return m_audioSystem.m_pendingRequestsQueue;
+    }
+
+    template<typename RequestType>
+    const RequestType* GetPendingRequest(size_t index) const
+    {
+        const AudioRequestsQueue& pendingRequests = GetPendingRequests();
+        return index < pendingRequests.size() ? AZStd::get_if<RequestType>(&pendingRequests[index]) : nullptr;
+    }
+
+    // The constructor makes the test thread the main thread of the audio system.
+    CAudioSystem m_audioSystem;
+};
+
+TEST_F(AudioSystemRequestBatchTest, ExternalUpdate_PositionUpdatesOfSameObject_LatestPositionSubmittedOnce)
+{
+    constexpr TAudioObjectID firstObjectId{ 100 };
+    constexpr TAudioObjectID secondObjectId{ 200 };
+
+    m_audioSystem.PushRequest(MakeSetPosition(firstObjectId, AZ::Vector3(1.0f, 0.0f, 0.0f)));
+    m_audioSystem.PushRequest(MakeSetPosition(secondObjectId, AZ::Vector3(2.0f, 0.0f, 0.0f)));
+    m_audioSystem.PushRequest(MakeSetPosition(firstObjectId, AZ::Vector3(3.0f, 0.0f, 0.0f)));
+
+    // Updates stay in the batch until the end of the frame
+    EXPECT_TRUE(GetPendingRequests().empty());
+
+    m_audioSystem.ExternalUpdate();
+    ASSERT_EQ(GetPendingRequests().size(), 2u);
+
+    // The coalesced update keeps the place of the first update of the object
+    auto firstPosition = GetPendingRequest<Audio::ObjectRequest::SetPosition>(0);
+    ASSERT_NE(firstPosition, nullptr);
+    EXPECT_EQ(firstPosition->m_audioObjectId, firstObjectId);
+    EXPECT_EQ(firstPosition->m_position.GetPositionVec(), AZ::Vector3(3.0f, 0.0f, 0.0f));
+
+    auto secondPosition = GetPendingRequest<Audio::ObjectRequest::SetPosition>(1);
+    ASSERT_NE(secondPosition, nullptr);
+    EXPECT_EQ(secondPosition->m_audioObjectId, secondObjectId);
+    EXPECT_EQ(secondPosition->m_position.GetPositionVec(), AZ::Vector3(2.0f, 0.0f, 0.0f));
+}
+
+TEST_F(AudioSystemRequestBatchTest, ExternalUpdate_ParameterUpdates_CoalescedPerObjectAndParameter)
+{
+    constexpr TAudioObjectID firstObjectId{ 100 };
+    constexpr TAudioObjectID secondObjectId{ 200 };
+    constexpr TAudioControlID firstParameterId{ 10 };
+    constexpr TAudioControlID secondParameterId{ 20 };
+
+    m_audioSystem.PushRequest(MakeSetParameterValue(firstObjectId, firstParameterId, 0.1f));
+    m_audioSystem.PushRequest(MakeSetParameterValue(firstObjectId, secondParameterId, 0.2f));
+    m_audioSystem.PushRequest(MakeSetParameterValue(secondObjectId, firstParameterId, 0.3f));
+    m_audioSystem.PushRequest(MakeSetParameterValue(firstObjectId, firstParameterId, 0.4f));
+
+    m_audioSystem.ExternalUpdate();
+    ASSERT_EQ(GetPendingRequests().size(), 3u);
+
+    const AZStd::tuple<TAudioObjectID, TAudioControlID, float> expectedValues[] = {
+        { firstObjectId, firstParameterId, 0.4f },
+        { firstObjectId, secondParameterId, 0.2f },
+        { secondObjectId, firstParameterId, 0.3f },
+    };
+    for (size_t index = 0; index < AZ_ARRAY_SIZE(expectedValues); ++index)
+    {
+        const auto& [objectId, parameterId, value] = expectedValues[index];
+        auto setParameter = GetPendingRequest<Audio::ObjectRequest::SetParameterValue>(index);
+        ASSERT_NE(setParameter, nullptr);
+        EXPECT_EQ(setParameter->m_audioObjectId, objectId);
+        EXPECT_EQ(setParameter->m_parameterId, parameterId);
+        EXPECT_FLOAT_EQ(setParameter->m_value, value);
+    }
+}
+
+TEST_F(AudioSystemRequestBatchTest, PushRequest_TriggerAfterUpdates_SubmittedRightAwayInOrder)
+{
+    constexpr TAudioObjectID objectId{ 100 };
+
+    m_audioSystem.PushRequest(MakeSetPosition(objectId, AZ::Vector3(1.0f, 0.0f, 0.0f)));
+
+    Audio::ObjectRequest::ExecuteTrigger executeTrigger;
+    executeTrigger.m_audioObjectId = objectId;
+    executeTrigger.m_triggerId = TAudioControlID{ 5 };
+    m_audioSystem.PushRequest(AZStd::move(executeTrigger));
+
+    // The trigger isn't delayed to the end of the frame, and the update pushed before it is submitted first
+    ASSERT_EQ(GetPendingRequests().size(), 2u);
+    EXPECT_NE(GetPendingRequest<Audio::ObjectRequest::SetPosition>(0), nullptr);
+    EXPECT_NE(GetPendingRequest<Audio::ObjectRequest::ExecuteTrigger>(1), nullptr);
+
+    // An update pushed after the trigger isn't merged into the update submitted before it
+    m_audioSystem.PushRequest(MakeSetPosition(objectId, AZ::Vector3(2.0f, 0.0f, 0.0f)));
+    m_audioSystem.ExternalUpdate();
+    ASSERT_EQ(GetPendingRequests().size(), 3u);
+
+    auto firstPosition = GetPendingRequest<Audio::ObjectRequest::SetPosition>(0);
+    ASSERT_NE(firstPosition, nullptr);
+    EXPECT_EQ(firstPosition->m_position.GetPositionVec(), AZ::Vector3(1.0f, 0.0f, 0.0f));
+    auto lastPosition = GetPendingRequest<Audio::ObjectRequest::SetPosition>(2);
+    ASSERT_NE(lastPosition, nullptr);
+    EXPECT_EQ(lastPosition->m_position.GetPositionVec(), AZ::Vector3(2.0f, 0.0f, 0.0f));
+}
+
+TEST_F(AudioSystemRequestBatchTest, PushRequest_UpdatesWithCallbackOrFlags_NotCoalesced)
+{
+    constexpr TAudioObjectID objectId{ 100 };
+    constexpr TAudioControlID parameterId{ 10 };
+
+    for (float value : { 1.0f, 2.0f })
+    {
+        auto setPosition = MakeSetPosition(objectId, AZ::Vector3(value, 0.0f, 0.0f));
+        setPosition.m_flags = 1;
+        m_audioSystem.PushRequest(AZStd::move(setPosition));
+
+        auto setParameter = MakeSetParameterValue(objectId, parameterId, value);
+        setParameter.m_callback = [](const Audio::ObjectRequest::SetParameterValue&)
+        {
+        };
+        m_audioSystem.PushRequest(AZStd::move(setParameter));
+    }
+
+    m_audioSystem.ExternalUpdate();
+    ASSERT_EQ(GetPendingRequests().size(), 4u);
+    for (size_t index = 0; index < 4; index += 2)
+    {
+        const float expectedValue = index == 0 ? 1.0f : 2.0f;
+
+        auto setPosition = GetPendingRequest<Audio::ObjectRequest::SetPosition>(index);
+        ASSERT_NE(setPosition, nullptr);
+        EXPECT_EQ(setPosition->m_position.GetPositionVec(), AZ::Vector3(expectedValue, 0.0f, 0.0f));
+
+        auto setParameter = GetPendingRequest<Audio::ObjectRequest::SetParameterValue>(index + 1);
+        ASSERT_NE(setParameter, nullptr);
+        EXPECT_FLOAT_EQ(setParameter->m_value, expectedValue);
+    }
+}
+
+TEST_F(AudioSystemRequestBatchTest, PushRequests_FromMainThread_CoalescedWithBatch)
+{
+    constexpr TAudioObjectID objectId{ 100 };
+
+    m_audioSystem.PushRequest(MakeSetPosition(objectId, AZ::Vector3(1.0f, 0.0f, 0.0f)));
+
+    AudioRequestsQueue requests;
+    requests.push_back(MakeSetPosition(objectId, AZ::Vector3(2.0f, 0.0f, 0.0f)));
+    requests.push_back(MakeSetPosition(objectId, AZ::Vector3(3.0f, 0.0f, 0.0f)));
+    m_audioSystem.PushRequests(requests);
+    EXPECT_TRUE(GetPendingRequests().empty());
+
+    m_audioSystem.ExternalUpdate();
+    ASSERT_EQ(GetPendingRequests().size(), 1u);
+    auto setPosition = GetPendingRequest<Audio::ObjectRequest::SetPosition>(0);
+    ASSERT_NE(setPosition, nullptr);
+    EXPECT_EQ(setPosition->m_position.GetPositionVec(), AZ::Vector3(3.0f, 0.0f, 0.0f));
+}
+
+TEST_F(AudioSystemRequestBatchTest, PushRequest_FromOtherThread_QueuedWithoutCoalescing)
+{
+    constexpr TAudioObjectID objectId{ 100 };
+
+    AZStd::thread pushThread(
+        [this]()
+        {
+            m_audioSystem.PushRequest(MakeSetPosition(objectId, AZ::Vector3(1.0f, 0.0f, 0.0f)));
+            m_audioSystem.PushRequest(MakeSetPosition(objectId, AZ::Vector3(2.0f, 0.0f, 0.0f)));
+        });
+    pushThread.join();
+
+    // Only the main thread batches its requests, other threads queue them directly
+    ASSERT_EQ(GetPendingRequests().size(), 2u);
+    auto lastPosition = GetPendingRequest<Audio::ObjectRequest::SetPosition>(1);
+    ASSERT_NE(lastPosition, nullptr);
+    EXPECT_EQ(lastPosition->m_position.GetPositionVec(), AZ::Vector3(2.0f, 0.0f, 0.0f));
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FramedCompression.h>
 #include <AzCore/RTTI/RTTIMacros.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -92,6 +93,18 @@ namespace Compression
         //! @param uncompressedBufferSize size of uncompressed data
         //! @return worst case(upper bound) size that is needed to store compressed data for a given uncompressed size
         [[nodiscard]] virtual size_t CompressBound(size_t uncompressedBufferSize) const = 0;
+
+        //! Compresses the uncompressed data into the seekable multi-frame format from AzCore/IO/FramedCompression.h
+        //! Every frame is compressed independently with CompressBlock, which allows the frames to be decompressed
+        //! in parallel and partial reads to only decompress the frames they overlap
+        //! @param compressedOutput destination vector where the framed compressed output will be stored to
+        //! @param uncompressedData source buffer containing uncompressed content
+        //! @param frameSize uncompressed size of each frame
+        //! @param compressOptions that will be provided to CompressBlock for every frame
+        //! @return true if all frames were successfully compressed
+        [[nodiscard]] bool CompressFramed(
+            AZStd::vector<AZ::u8>& compressedOutput, const AZStd::span<const AZStd::byte>& uncompressedData,
+            AZ::u32 frameSize = AZ::IO::FramedCompression::DefaultFrameSize, const CompressionOptions& compressionOptions = {}) const;
     };
 
     class CompressionRegistrarInterface
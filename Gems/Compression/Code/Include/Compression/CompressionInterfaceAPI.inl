@@ -43,4 +43,21 @@ namespace Compression
         return m_compressedBuffer.data();
     }
 
+    inline bool ICompressionInterface::CompressFramed(
+        AZStd::vector<AZ::u8>& compressedOutput, const AZStd::span<const AZStd::byte>& uncompressedData,
+        AZ::u32 frameSize, const CompressionOptions& compressionOptions) const
+    {
+        auto compressFrame = [this, &compressionOptions](const void* uncompressed, size_t uncompressedSize,
+            void* compressed, size_t compressedBufferSize) -> size_t
+        {
+            CompressionResultData result = CompressBlock(
+                AZStd::span(reinterpret_cast<AZStd::byte*>(compressed), compressedBufferSize),
+                AZStd::span(reinterpret_cast<const AZStd::byte*>(uncompressed), uncompressedSize),
+                compressionOptions);
+            return result ? aznumeric_cast<size_t>(result.GetCompressedByteCount()) : 0;
+        };
+        return AZ::IO::FramedCompression::Compress(compressedOutput, uncompressedData.data(), uncompressedData.size(),
+            frameSize, CompressBound(frameSize), compressFrame);
+    }
+
 } // namespace Compression
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FramedCompression.h>
 #include <AzCore/RTTI/RTTIMacros.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -88,6 +89,18 @@ namespace Compression
         [[nodiscard]] virtual DecompressionResultData DecompressBlock(
             AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
             const DecompressionOptions& decompressionOptions = {}) const = 0;
+
+        //! Decompresses a range of data stored in the seekable multi-frame format from AzCore/IO/FramedCompression.h
+        //! Only the frames overlapping the range are decompressed with DecompressBlock. If the task graph is active
+        //! the frames are decompressed in parallel on the global task executor, so don't call this from a task on it
+        //! @param decompressionBuffer destination buffer for the uncompressed range. Its size is the size of the range
+        //! @param compressedData source buffer containing the framed compressed data
+        //! @param uncompressedOffset offset in the uncompressed data where the range starts
+        //! @param decompressionOptions that will be provided to DecompressBlock for every frame
+        //! @return true if the range was successfully decompressed
+        [[nodiscard]] bool DecompressFramed(
+            AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
+            AZ::u64 uncompressedOffset = 0, const DecompressionOptions& decompressionOptions = {}) const;
     };
 
     class DecompressionRegistrarInterface
@@ -45,4 +45,27 @@ namespace Compression
     {
         return m_uncompressedBuffer.data();
     }
+
+    inline bool IDecompressionInterface::DecompressFramed(
+        AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
+        AZ::u64 uncompressedOffset, const DecompressionOptions& decompressionOptions) const
+    {
+        AZ::IO::FramedCompression::FrameTable frameTable;
+        if (!frameTable.Read(compressedData.data(), compressedData.size()))
+        {
+            return false;
+        }
+
+        auto decompressFrame = [this, &decompressionOptions](const void* compressed, size_t compressedSize,
+            void* uncompressed, size_t uncompressedSize)
+        {
+            DecompressionResultData result = DecompressBlock(
+                AZStd::span(reinterpret_cast<AZStd::byte*>(uncompressed), uncompressedSize),
+                AZStd::span(reinterpret_cast<const AZStd::byte*>(compressed), compressedSize),
+                decompressionOptions);
+            return result && result.GetUncompressedByteCount() == uncompressedSize;
+        };
+        return AZ::IO::FramedCompression::Decompress(frameTable, compressedData.data(), compressedData.size(),
+            uncompressedOffset, decompressionBuffer.size(), decompressionBuffer.data(), decompressFrame);
+    }
 } // namespace Compression
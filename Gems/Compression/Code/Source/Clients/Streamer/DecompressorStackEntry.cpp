@@ -9,6 +9,7 @@
 #include "DecompressorStackEntry.h"
 
 #include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/FramedCompression.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/Task/TaskGraph.h>
@@ -657,7 +658,16 @@ namespace Compression
                         AZ_SIZE_ALIGN_DOWN(data->m_compressionInfo.m_offset, aznumeric_cast<size_t>(m_alignment)));
 
                     AZ::TaskDescriptor taskDescriptor{ "Decompress file", "Compression" };
-                    if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
+                    if (data->m_compressionInfo.m_isFramed)
+                    {
+                        auto decompressTask = [this, &info]()
+                        {
+                            FramedDecompression(m_context, info);
+                        };
+                        AZ::TaskToken token = taskGraph.AddTask(taskDescriptor, AZStd::move(decompressTask));
+                        token.Precedes(finishToken);
+                    }
+                    else if (!NeedsDecompressionBuffer(*data))
                     {
                         auto decompressTask = [this, &info]()
                         {
@@ -718,7 +728,7 @@ namespace Compression
         size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
         size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
         m_memoryUsage -= bufferSize;
-        if (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize)
+        if (NeedsDecompressionBuffer(*data))
         {
             m_memoryUsage -= data->m_compressionInfo.m_uncompressedSize;
         }
@@ -783,6 +793,49 @@ namespace Compression
         context->WakeUpSchedulingThread();
     }
 
+    void DecompressorRegistrarEntry::FramedDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info)
+    {
+        info.m_jobStartTime = AZStd::chrono::steady_clock::now();
+
+        AZ::IO::FileRequest* compressedRequest = info.m_waitRequest->GetParent();
+        AZ_Assert(compressedRequest, "A wait request attached to DecompressorRegistrarEntry was completed but didn't have a parent compressed request.");
+        auto request = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        AZ_Assert(request, "Compressed request in DecompressorRegistrarEntry that's running framed decompression didn't contain compression read data.");
+        AZ::IO::CompressionInfo& compressionInfo = request->m_compressionInfo;
+        AZ_Assert(compressionInfo.m_decompressor, "Framed decompressor job started, but there's no decompressor callback assigned.");
+
+        const AZ::u8* compressedData = info.m_compressedData + info.m_alignmentOffset;
+        AZ::IO::FramedCompression::FrameTable frameTable;
+        bool success = frameTable.Read(compressedData, compressionInfo.m_compressedSize, compressionInfo.m_uncompressedSize);
+        if (success)
+        {
+            auto decompressFrame = [&compressionInfo](const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedSize)
+            {
+                return compressionInfo.m_decompressor(compressionInfo, compressed, compressedSize, uncompressed, uncompressedSize);
+            };
+            // The frames are spread over the global task executor rather than the decompressor's own executor, as this
+            // task occupies one of the threads of the latter while waiting.
+            success = AZ::IO::FramedCompression::Decompress(frameTable, compressedData, compressionInfo.m_compressedSize,
+                request->m_readOffset, request->m_readSize, request->m_output, decompressFrame);
+        }
+        else
+        {
+            AZ_Error("Compression", false, "File at offset %zu in archive '%s' is marked as framed but doesn't contain a valid frame table.",
+                compressionInfo.m_offset, compressionInfo.m_archiveFilename.GetRelativePath());
+        }
+        info.m_waitRequest->SetStatus(success ? AZ::IO::IStreamerTypes::RequestStatus::Completed : AZ::IO::IStreamerTypes::RequestStatus::Failed);
+
+        context->MarkRequestAsCompleted(info.m_waitRequest);
+        context->WakeUpSchedulingThread();
+    }
+
+    bool DecompressorRegistrarEntry::NeedsDecompressionBuffer(const AZ::IO::Requests::CompressedReadData& data)
+    {
+        // Framed files only decompress the frames that are needed, so those never need to decompress the entire file.
+        return !data.m_compressionInfo.m_isFramed &&
+            (data.m_readOffset != 0 || data.m_readSize != data.m_compressionInfo.m_uncompressedSize);
+    }
+
     void DecompressorRegistrarEntry::Report(const AZ::IO::Requests::ReportData& data) const
     {
         switch (data.m_reportType)
@@ -26,6 +26,7 @@ namespace AZ::IO
 namespace AZ::IO::Requests
 {
     struct ReadRequestData;
+    struct CompressedReadData;
     struct ReportData;
 }
 
@@ -120,6 +121,9 @@ namespace Compression
 
         static void FullDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info);
         static void PartialDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info);
+        //! Decompresses only the frames of a seekable multi-frame file that overlap the requested range.
+        static void FramedDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info);
+        static bool NeedsDecompressionBuffer(const AZ::IO::Requests::CompressedReadData& data);
 
         void Report(const AZ::IO::Requests::ReportData& data) const;
 
@@ -211,6 +211,17 @@ namespace AZ
             uint32_t GetFrameUpdateCount() const { return m_frameUpdateCount; }
             void SetFrameUpdateCount(uint32_t frameUpdateCount) { m_frameUpdateCount = frameUpdateCount; }
 
+            // number of frames the probe updates are currently spread across, set by the feature processor to fit the ray budget
+            // and never less than the frame update count
+            uint32_t GetScheduledFrameUpdateCount() const { return m_scheduledFrameUpdateCount; }
+            void SetScheduledFrameUpdateCount(uint32_t scheduledFrameUpdateCount);
+
+            // returns the number of rays traced per frame with the scheduled frame update count
+            uint64_t GetScheduledRayCount() const;
+
+            // returns true if the probes are still being relocated after a change to the grid or the scene geometry
+            bool GetRecentlyChanged() const { return m_remainingRelocationIterations > 0; }
+
             uint32_t GetFrameUpdateIndex() const { return m_frameUpdateIndex; }
 
             DiffuseProbeGridTransparencyMode GetTransparencyMode() const { return m_transparencyMode; }
@@ -370,6 +381,7 @@ namespace AZ
 
             // frame count and current frame index for alternating probe updates across frames
             uint32_t m_frameUpdateCount = 1;
+            uint32_t m_scheduledFrameUpdateCount = 1;
             uint32_t m_frameUpdateIndex = 0;
 
             // rotation transform applied to probe rays
@@ -195,7 +195,7 @@ namespace AZ
                 uint32_t probeCountY;
                 diffuseProbeGrid->GetTexture2DProbeCount(probeCountX, probeCountY);
 
-                probeCountX = AZ::DivideAndRoundUp(probeCountX, diffuseProbeGrid->GetFrameUpdateCount());
+                probeCountX = AZ::DivideAndRoundUp(probeCountX, diffuseProbeGrid->GetScheduledFrameUpdateCount());
 
                 RHI::DeviceDispatchItem dispatchItem;
                 dispatchItem.m_arguments = shader.m_dispatchArgs;
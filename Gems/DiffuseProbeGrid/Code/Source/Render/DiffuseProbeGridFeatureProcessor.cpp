@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <Atom/RPI.Edit/Common/AssetUtils.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
@@ -29,6 +30,13 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_diffuseProbeGridRayBudget, 1048576, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Maximum number of probe rays traced per frame by the visible real-time DiffuseProbeGrids, 0 is unlimited. "
+            "The lowest priority grids spread their probe updates across more frames to fit in the budget.");
+
+        AZ_CVAR(uint32_t, r_diffuseProbeGridMaxFrameUpdateCount, 16, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Maximum number of frames the ray budget spreads the probe updates of a DiffuseProbeGrid across.");
+
         void DiffuseProbeGridFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -355,6 +363,74 @@ namespace AZ
                     m_visibleDiffuseProbeGrids.push_back(diffuseProbeGrid);
                 }
             }
+
+            ScheduleProbeUpdates();
+        }
+
+        void DiffuseProbeGridFeatureProcessor::ScheduleProbeUpdates()
+        {
+            AZ_PROFILE_SCOPE(AzRender, "DiffuseProbeGridFeatureProcessor: ScheduleProbeUpdates");
+
+            // every grid starts at its own frame update count
+            uint64_t totalRayCount = 0;
+            for (auto& diffuseProbeGrid : m_visibleRealTimeDiffuseProbeGrids)
+            {
+                diffuseProbeGrid->SetScheduledFrameUpdateCount(diffuseProbeGrid->GetFrameUpdateCount());
+                totalRayCount += diffuseProbeGrid->GetScheduledRayCount();
+            }
+
+            const uint64_t rayBudget = static_cast<uint32_t>(r_diffuseProbeGridRayBudget);
+            if (rayBudget == 0 || totalRayCount <= rayBudget)
+            {
+                return;
+            }
+
+            AZ::Vector3 cameraPosition = AZ::Vector3::CreateZero();
+            if (RPI::RenderPipelinePtr renderPipeline = GetParentScene()->GetDefaultRenderPipeline())
+            {
+                if (RPI::ViewPtr view = renderPipeline->GetDefaultView())
+                {
+                    cameraPosition = view->GetViewToWorldMatrix().GetTranslation();
+                }
+            }
+
+            // sort the grids from the lowest to the highest priority: grids that are still being relocated after a grid or
+            // scene geometry change come last, then the grids closest to the camera
+            m_probeUpdateSchedule.clear();
+            for (auto& diffuseProbeGrid : m_visibleRealTimeDiffuseProbeGrids)
+            {
+                m_probeUpdateSchedule.push_back({ diffuseProbeGrid.get(), diffuseProbeGrid->GetObbWs().GetDistance(cameraPosition) });
+            }
+
+            AZStd::sort(m_probeUpdateSchedule.begin(), m_probeUpdateSchedule.end(),
+                [](const ProbeUpdateScheduleEntry& entry1, const ProbeUpdateScheduleEntry& entry2)
+                {
+                    if (entry1.m_diffuseProbeGrid->GetRecentlyChanged() != entry2.m_diffuseProbeGrid->GetRecentlyChanged())
+                    {
+                        return !entry1.m_diffuseProbeGrid->GetRecentlyChanged();
+                    }
+
+                    return entry1.m_cameraDistance > entry2.m_cameraDistance;
+                });
+
+            // spread the probe updates of the lowest priority grids across more frames until the rays fit in the budget
+            const uint32_t maxFrameUpdateCount = AZStd::max(static_cast<uint32_t>(r_diffuseProbeGridMaxFrameUpdateCount), 1u);
+            for (ProbeUpdateScheduleEntry& entry : m_probeUpdateSchedule)
+            {
+                DiffuseProbeGrid* diffuseProbeGrid = entry.m_diffuseProbeGrid;
+                while (totalRayCount > rayBudget && diffuseProbeGrid->GetScheduledFrameUpdateCount() < maxFrameUpdateCount)
+                {
+                    const uint64_t previousRayCount = diffuseProbeGrid->GetScheduledRayCount();
+                    diffuseProbeGrid->SetScheduledFrameUpdateCount(
+                        AZStd::min(diffuseProbeGrid->GetScheduledFrameUpdateCount() * 2, maxFrameUpdateCount));
+                    totalRayCount -= previousRayCount - diffuseProbeGrid->GetScheduledRayCount();
+                }
+
+                if (totalRayCount <= rayBudget)
+                {
+                    break;
+                }
+            }
         }
 
         DiffuseProbeGridHandle DiffuseProbeGridFeatureProcessor::AddProbeGrid(const AZ::Transform& transform, const AZ::Vector3& extents, const AZ::Vector3& probeSpacing)
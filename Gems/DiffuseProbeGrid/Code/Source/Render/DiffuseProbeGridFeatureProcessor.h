@@ -160,6 +160,9 @@ namespace AZ
             // loads the probe visualization model and creates the BLAS
             void OnVisualizationModelAssetReady(Data::Asset<Data::AssetData> asset);
 
+            // sets the scheduled frame update count of the visible real-time grids to fit their probe rays in the ray budget
+            void ScheduleProbeUpdates();
+
             // list of all diffuse probe grids
             const size_t InitialProbeGridAllocationSize = 64;
             DiffuseProbeGridVector m_diffuseProbeGrids;
@@ -173,6 +176,14 @@ namespace AZ
             // side list of diffuse probe grids that are in real-time mode and visible (subset of m_realTimeDiffuseProbeGrids)
             DiffuseProbeGridVector m_visibleRealTimeDiffuseProbeGrids;
 
+            // probe update priority of the visible real-time grids, rebuilt each frame by ScheduleProbeUpdates
+            struct ProbeUpdateScheduleEntry
+            {
+                DiffuseProbeGrid* m_diffuseProbeGrid = nullptr;
+                float m_cameraDistance = 0.0f;
+            };
+            AZStd::vector<ProbeUpdateScheduleEntry> m_probeUpdateSchedule;
+
             // position structure for the box vertices
             struct Position
             {
@@ -370,6 +370,63 @@ namespace EMotionFX
         }
     }
 
+    void ActorInstance::UpdateThrottledTransformations(bool updateJointTransforms)
+    {
+        // Update the LOD level in case a change was requested.
+        UpdateLODLevel();
+
+        // The entity can still move while the update is skipped
+        UpdateWorldTransform();
+
+        if (updateJointTransforms && m_updateRateInterpolating)
+        {
+            const float weight = AZStd::min(1.0f, static_cast<float>(m_updateRateFrame + 1) / static_cast<float>(m_updateRateInterval));
+            Pose* currentPose = m_transformData->GetCurrentPose();
+            currentPose->InitFromPose(m_updateRateSourcePose.get());
+            currentPose->Blend(m_updateRateTargetPose.get(), weight);
+
+            currentPose->ApplyMorphWeightsToActorInstance();
+            ApplyMorphSetup();
+            UpdateSkinningMatrices();
+        }
+
+        UpdateAttachments();
+
+        if (GetBoundsUpdateEnabled() && m_boundsUpdateType == BOUNDS_STATIC_BASED)
+        {
+            UpdateBounds(m_lodLevel, m_boundsUpdateType);
+        }
+    }
+
+    void ActorInstance::BeginUpdateRateInterpolation()
+    {
+        if (!m_updateRateSourcePose)
+        {
+            m_updateRateSourcePose = AZStd::make_unique<Pose>();
+            m_updateRateSourcePose->LinkToActorInstance(this);
+            m_updateRateTargetPose = AZStd::make_unique<Pose>();
+            m_updateRateTargetPose->LinkToActorInstance(this);
+        }
+
+        // Interpolate from the pose shown now, so the interpolation continues where the last one ended
+        m_updateRateSourcePose->InitFromPose(m_transformData->GetCurrentPose());
+    }
+
+    void ActorInstance::EndUpdateRateInterpolation(bool poseUpdated)
+    {
+        if (!poseUpdated || !m_updateRateSourcePose || m_updateRateInterval <= 1)
+        {
+            m_updateRateInterpolating = false;
+            return;
+        }
+
+        m_updateRateTargetPose->InitFromPose(m_transformData->GetCurrentPose());
+        m_updateRateInterpolating = true;
+
+        // The update frame shows the first step of the interpolation
+        UpdateThrottledTransformations(true);
+    }
+
     // update the world transformation
     void ActorInstance::UpdateWorldTransform()
     {
@@ -624,8 +681,16 @@ namespace EMotionFX
 
             // based on the world space positions of the vertices of the meshes (most accurate)
             case BOUNDS_MESH_BASED:
-                UpdateMeshDeformers(0.0f);
-                CalcMeshBasedAabb(geomLODLevel, &m_aabb, itemFrequency);
+                if (m_cpuMeshDeformersEnabled)
+                {
+                    UpdateMeshDeformers(0.0f);
+                    CalcMeshBasedAabb(geomLODLevel, &m_aabb, itemFrequency);
+                }
+                else
+                {
+                    // The deformed vertices only exist on the GPU
+                    CalcNodeBasedAabb(&m_aabb, itemFrequency);
+                }
                 break;
 
             // when we're dealing with an unspecified bounding volume update method
@@ -1655,7 +1720,17 @@ namespace EMotionFX
 #endif
     }
 
-    uint32 ActorInstance::GetThreadIndex() const
+    void ActorInstance::SetCpuMeshDeformersEnabled(bool enabled)
+    {
+        m_cpuMeshDeformersEnabled = enabled;
+    }
+
+    bool ActorInstance::GetCpuMeshDeformersEnabled() const
+    {
+        return m_cpuMeshDeformersEnabled;
+    }
+
+        uint32 ActorInstance::GetThreadIndex() const
     {
         return m_threadIndex;
     }
@@ -1705,6 +1780,52 @@ namespace EMotionFX
         return m_motionSamplingRate;
     }
 
+    void ActorInstance::SetUpdateRateInterval(uint32 numFrames)
+    {
+        if (m_updateRateInterval == numFrames)
+        {
+            return;
+        }
+
+        m_updateRateInterval = numFrames;
+        m_updateRateInterpolating = false;
+
+        // Spread the updates of the actor instances with the same interval over its frames
+        m_updateRateFrame = numFrames > 1 ? m_id % numFrames : 0;
+    }
+
+    uint32 ActorInstance::GetUpdateRateInterval() const
+    {
+        return m_updateRateInterval;
+    }
+
+    bool ActorInstance::StepUpdateRate(float timePassedInSeconds, float& outUpdateTimeInSeconds)
+    {
+        // Skin attachments copy the joint transforms of the actor instance they are attached to, they follow its update rate
+        if (m_updateRateInterval == 1 || (m_selfAttachment && m_selfAttachment->GetIsInfluencedByMultipleJoints()))
+        {
+            outUpdateTimeInSeconds = timePassedInSeconds;
+            return true;
+        }
+
+        // A frozen actor instance continues from where it stopped once it's unfrozen
+        if (m_updateRateInterval == 0)
+        {
+            return false;
+        }
+
+        m_updateRateTimer += timePassedInSeconds;
+        if (++m_updateRateFrame < m_updateRateInterval)
+        {
+            return false;
+        }
+
+        outUpdateTimeInSeconds = m_updateRateTimer;
+        m_updateRateTimer = 0.0f;
+        m_updateRateFrame = 0;
+        return true;
+    }
+
     void ActorInstance::IncreaseNumAttachmentRefs(uint8 numToIncreaseWith)
     {
         m_numAttachmentRefs += numToIncreaseWith;
@@ -279,6 +279,24 @@ namespace EMotionFX
          */
         void UpdateTransformations(float timePassedInSeconds, bool updateJointTransforms = true, bool sampleMotions = true);
 
+        /**
+         * Update the transformations of this actor instance on a frame where the scheduler skips its update because its update rate is throttled.
+         * This updates the world space transform and the attachments, and interpolates the joint transforms between the poses of the last two updates.
+         * @param updateJointTransforms When set to true the joint transformations will be interpolated.
+         */
+        void UpdateThrottledTransformations(bool updateJointTransforms = true);
+
+        /**
+         * Store the current pose as the pose to interpolate from, before a throttled update.
+         */
+        void BeginUpdateRateInterpolation();
+
+        /**
+         * Store the current pose as the pose to interpolate to, after a throttled update, and interpolate towards it.
+         * @param poseUpdated False when the update didn't output a pose, which stops the interpolation until the next update that does.
+         */
+        void EndUpdateRateInterpolation(bool poseUpdated);
+
         /**
          * Update/Process the mesh deformers.
          * This will apply skinning and morphing deformations to the meshes used by the actor instance.
@@ -777,6 +795,16 @@ namespace EMotionFX
         void SetIsOwnedByRuntime(bool isOwnedByRuntime);
         bool GetIsOwnedByRuntime() const;
 
+        /**
+         * Specify if the meshes of this actor instance get deformed on the CPU.
+         * Disable this when the renderer skins and morphs the meshes on the GPU, so that the mesh deformers don't run each frame.
+         * Mesh based bounds fall back to node based bounds in that case, as the deformed vertices are not available on the CPU.
+         * Explicit calls to UpdateMeshDeformers() still deform the meshes, e.g. for editor picking.
+         * @param enabled Set to false to not run the mesh deformers while updating the actor instance.
+         */
+        void SetCpuMeshDeformersEnabled(bool enabled);
+        bool GetCpuMeshDeformersEnabled() const;
+
         /**
          * Enable a specific node.
          * This will activate motion sampling, transformation and blending calculations for the given node.
@@ -863,6 +891,22 @@ namespace EMotionFX
         float GetMotionSamplingTimer() const;
         float GetMotionSamplingRate() const;
 
+        /**
+         * Set the number of frames between the updates of this actor instance, used when the scheduler throttles update rates.
+         * The anim graph, motion extraction and events then update once per interval, with the time passed over all its frames.
+         * @param numFrames The number of frames between updates. A value of 1 updates every frame, 0 freezes the actor instance.
+         */
+        void SetUpdateRateInterval(uint32 numFrames);
+        uint32 GetUpdateRateInterval() const;
+
+        /**
+         * Advance the throttled update rate by a frame. Used by the schedulers when throttling update rates.
+         * @param timePassedInSeconds The time passed, in seconds, since the last frame.
+         * @param[out] outUpdateTimeInSeconds The time, in seconds, to update the actor instance with when this returns true.
+         * @result True when the actor instance updates this frame, false when it only interpolates its pose.
+         */
+        bool StepUpdateRate(float timePassedInSeconds, float& outUpdateTimeInSeconds);
+
         MCORE_INLINE size_t GetNumNodes() const         { return m_actor->GetSkeleton()->GetNumNodes(); }
 
         void UpdateVisualizeScale();                    // not automatically called on creation for performance reasons (this method relatively is slow as it updates all meshes)
@@ -900,6 +944,12 @@ namespace EMotionFX
         float                   m_boundsUpdatePassedTime;/**< The time passed since the last bounds update. */
         float                   m_motionSamplingRate;    /**< The motion sampling rate in seconds, where 0.1 would mean to update 10 times per second. A value of 0 or lower means to update every frame. */
         float                   m_motionSamplingTimer;   /**< The time passed since the last time we sampled motions/anim graphs. */
+        float                   m_updateRateTimer = 0.0f; /**< The time passed since the last throttled update. */
+        uint32                  m_updateRateInterval = 1; /**< The number of frames between throttled updates, where 0 means frozen. */
+        uint32                  m_updateRateFrame = 0;   /**< The frames passed since the last throttled update. */
+        AZStd::unique_ptr<Pose> m_updateRateSourcePose;  /**< The pose shown before the last throttled update, interpolated from. */
+        AZStd::unique_ptr<Pose> m_updateRateTargetPose;  /**< The pose of the last throttled update, interpolated to. */
+        bool                    m_updateRateInterpolating = false; /**< Set while the source and target poses can be interpolated. */
         float                   m_visualizeScale;        /**< Some visualization scale factor when rendering for example normals, to be at a nice size, relative to the character. */
         size_t                  m_lodLevel;              /**< The current LOD level, where 0 is the highest detail. */
         size_t                  m_requestedLODLevel;    /**< Requested LOD level. The actual LOD level will be updated as soon as all transforms for the requested LOD level are ready. */
@@ -911,6 +961,7 @@ namespace EMotionFX
         uint8                   m_numAttachmentRefs;     /**< Specifies how many actor instances use this actor instance as attachment. */
         uint8                   m_boolFlags;             /**< Boolean flags. */
         uint32_t m_lightingChannelMask = 1;
+        bool m_cpuMeshDeformersEnabled = true; /**< Are the meshes deformed on the CPU while updating? False when only the GPU deforms them. */
 
         /**
          * Boolean masks, as replacement for having several bools as members.
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "ActorUpdateScheduler.h"
+#include "ActorInstance.h"
+
+
+namespace EMotionFX
+{
+    // update a single actor instance
+    void ActorUpdateScheduler::UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds)
+    {
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        // skip the update on the frames between the updates of a throttled actor instance
+        float updateTimeInSeconds = timePassedInSeconds;
+        const bool isThrottled = m_updateRateThrottlingEnabled && actorInstance->GetUpdateRateInterval() != 1;
+        if (isThrottled && !actorInstance->StepUpdateRate(timePassedInSeconds, updateTimeInSeconds))
+        {
+            m_numThrottled.Increment();
+            actorInstance->UpdateThrottledTransformations(isVisible && m_updateRateInterpolationEnabled);
+            return;
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + updateTimeInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        // update the transformations
+        const bool interpolatePose = isThrottled && m_updateRateInterpolationEnabled && isVisible && sampleMotions;
+        if (interpolatePose)
+        {
+            actorInstance->BeginUpdateRateInterpolation();
+        }
+
+        actorInstance->UpdateTransformations(updateTimeInSeconds, isVisible, sampleMotions);
+
+        if (isThrottled)
+        {
+            actorInstance->EndUpdateRateInterpolation(interpolatePose);
+        }
+    }
+}   // namespace EMotionFX
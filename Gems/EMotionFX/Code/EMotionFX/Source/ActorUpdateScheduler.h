@@ -84,11 +84,40 @@ namespace EMotionFX
         size_t GetNumUpdatedActorInstances() const                  { return m_numUpdated.GetValue(); }
         size_t GetNumVisibleActorInstances() const                  { return m_numVisible.GetValue(); }
         size_t GetNumSampledActorInstances() const                  { return m_numSampled.GetValue(); }
+        size_t GetNumThrottledActorInstances() const                { return m_numThrottled.GetValue(); }
+
+        /**
+         * Enable or disable the update rate throttling.
+         * When enabled, each actor instance only updates once per its update rate interval (see ActorInstance::SetUpdateRateInterval), with the time
+         * passed over all the frames of the interval. The anim graph, motion extraction and motion events are all throttled together that way.
+         * @param enabled Set to true to throttle the update rates of the actor instances.
+         */
+        void SetUpdateRateThrottlingEnabled(bool enabled)           { m_updateRateThrottlingEnabled = enabled; }
+        bool GetUpdateRateThrottlingEnabled() const                 { return m_updateRateThrottlingEnabled; }
+
+        /**
+         * Enable or disable the pose interpolation on the frames throttled actor instances don't update.
+         * Without it their pose only changes when they update, which is enough when nobody sees them, like on a server.
+         * @param enabled Set to true to interpolate the poses of throttled actor instances.
+         */
+        void SetUpdateRateInterpolationEnabled(bool enabled)        { m_updateRateInterpolationEnabled = enabled; }
+        bool GetUpdateRateInterpolationEnabled() const              { return m_updateRateInterpolationEnabled; }
 
     protected:
         MCore::AtomicSizeT m_numUpdated;
         MCore::AtomicSizeT m_numVisible;
         MCore::AtomicSizeT m_numSampled;
+        MCore::AtomicSizeT m_numThrottled;
+        bool m_updateRateThrottlingEnabled = false;
+        bool m_updateRateInterpolationEnabled = true;
+
+        /**
+         * Update a single actor instance, sampling its motions when its motion sampling rate and update rate allow it.
+         * The schedulers call this for each enabled actor instance, from any thread.
+         * @param actorInstance The actor instance to update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds);
 
         /**
          * The constructor.
@@ -47,6 +47,7 @@ namespace EMotionFX
         bool GetCanActAsState() const override                  { return true; }
         bool GetSupportsVisualization() const override          { return true; }
         bool GetHasOutputPose() const override                  { return true; }
+        bool GetSupportsParallelOutput() const override         { return true; }
 
         AnimGraphPose* GetMainOutputPose(AnimGraphInstance* animGraphInstance) const override     { return GetOutputPose(animGraphInstance, OUTPUTPORT_RESULT)->GetValue(); }
 
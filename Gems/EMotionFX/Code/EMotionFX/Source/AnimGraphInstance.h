@@ -17,6 +17,7 @@
 #include <EMotionFX/Source/EMotionFXConfig.h>
 #include <MCore/Source/Attribute.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <MCore/Source/Random.h>
 
 
@@ -297,6 +298,11 @@ namespace EMotionFX
         void ReleaseRefDatas();
         void ReleasePoses();
 
+        // Set by the blend trees while their subtrees are output by several tasks, which then lock the mutex to update shared nodes.
+        bool GetIsOutputInParallel() const { return m_isOutputInParallel; }
+        void SetIsOutputInParallel(bool isOutputInParallel) { m_isOutputInParallel = isOutputInParallel; }
+        AZStd::mutex& GetParallelOutputMutex() { return m_parallelOutputMutex; }
+
     private:
         AnimGraph*                                          m_animGraph;
         ActorInstance*                                      m_actorInstance;
@@ -319,6 +325,8 @@ namespace EMotionFX
 
         bool                                                m_autoReleaseAllPoses;
         bool                                                m_autoReleaseAllRefDatas;
+        bool                                                m_isOutputInParallel = false;
+        AZStd::mutex                                        m_parallelOutputMutex;
         
         AZStd::vector<AnimGraphInstance*>                   m_followerGraphs;
         AZStd::vector<AnimGraphInstance*>                   m_leaderGraphs;
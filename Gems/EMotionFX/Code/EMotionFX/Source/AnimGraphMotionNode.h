@@ -89,6 +89,7 @@ namespace EMotionFX
         bool InitAfterLoading(AnimGraph* animGraph) override;
 
         bool GetHasOutputPose() const override { return true; }
+        bool GetSupportsParallelOutput() const override { return true; }
         bool GetCanActAsState() const override { return true; }
         bool GetSupportsDisable() const override { return true; }
         bool GetSupportsVisualization() const override { return true; }
@@ -2000,6 +2000,13 @@ namespace EMotionFX
     // decrease the reference count
     void AnimGraphNode::DecreaseRef(AnimGraphInstance* animGraphInstance)
     {
+        // Nodes read by several subtrees get their ref count decreased by several output tasks.
+        AZStd::unique_lock<AZStd::mutex> parallelOutputLock(animGraphInstance->GetParallelOutputMutex(), AZStd::defer_lock);
+        if (animGraphInstance->GetIsOutputInParallel())
+        {
+            parallelOutputLock.lock();
+        }
+
         AnimGraphNodeData* uniqueData = FindOrCreateUniqueNodeData(animGraphInstance);
         if (uniqueData->GetPoseRefCount() == 0)
         {
@@ -165,6 +165,15 @@ namespace EMotionFX
         virtual bool GetHasVisualGraph() const { return false; }
         virtual bool GetCanHaveChildren() const { return false; }
         virtual bool GetHasOutputPose() const { return false; }
+
+        /**
+         * Check if the node can be output by a task while other nodes of the same anim graph instance are output by other tasks.
+         * This requires its Output() to only write to its own unique data and output ports, and to request poses through RequestPoses() or the pose pool.
+         * Value nodes are supported on default, nodes with a pose output have to opt in.
+         * @result True when the node can be output in parallel with other nodes.
+         */
+        virtual bool GetSupportsParallelOutput() const { return !GetHasOutputPose(); }
+
         virtual bool GetCanBeInsideStateMachineOnly() const { return false; }
         virtual bool GetCanBeInsideChildStateMachineOnly() const{ return false; }
         virtual bool GetNeedsNetTimeSync() const                { return false; }
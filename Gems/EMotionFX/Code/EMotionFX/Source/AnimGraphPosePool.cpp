@@ -72,6 +72,12 @@ namespace EMotionFX
     // request a pose
     AnimGraphPose* AnimGraphPosePool::RequestPose(const ActorInstance* actorInstance)
     {
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex, AZStd::defer_lock);
+        if (m_isThreadSafe)
+        {
+            lock.lock();
+        }
+
         // if we have no free poses left, allocate a new one
         if (m_freePoses.empty())
         {
@@ -97,6 +103,12 @@ namespace EMotionFX
     // free the pose again
     void AnimGraphPosePool::FreePose(AnimGraphPose* pose)
     {
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex, AZStd::defer_lock);
+        if (m_isThreadSafe)
+        {
+            lock.lock();
+        }
+
         m_freePoses.emplace_back(pose);
         pose->SetIsInUse(false);
     }
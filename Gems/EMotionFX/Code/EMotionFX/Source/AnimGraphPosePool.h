@@ -11,6 +11,7 @@
 // include required headers
 #include "EMotionFXConfig.h"
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 
 
 
@@ -47,9 +48,15 @@ namespace EMotionFX
         MCORE_INLINE size_t GetNumMaxUsedPoses() const          { return m_maxUsed; }
         MCORE_INLINE void ResetMaxUsedPoses()                   { m_maxUsed = 0; }
 
+        // Lock the pool when requesting and freeing poses, while several tasks output the same anim graph instance.
+        MCORE_INLINE void SetIsThreadSafe(bool isThreadSafe)    { m_isThreadSafe = isThreadSafe; }
+        MCORE_INLINE bool GetIsThreadSafe() const               { return m_isThreadSafe; }
+
     private:
         AZStd::vector<AnimGraphPose*>   m_poses;
         AZStd::vector<AnimGraphPose*>   m_freePoses;
         size_t                          m_maxUsed;
+        AZStd::mutex                    m_mutex;
+        bool                            m_isThreadSafe = false;
     };
 }   // namespace EMotionFX
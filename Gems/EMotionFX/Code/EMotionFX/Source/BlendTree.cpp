@@ -20,12 +20,35 @@
 #include "AnimGraphManager.h"
 #include "AnimGraphSyncTrack.h"
 #include <EMotionFX/Source/AnimGraphBus.h>
+#include <EMotionFX/Source/AnimGraphPosePool.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/ThreadData.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskGraph.h>
 
 
 namespace EMotionFX
 {
     AZ_CLASS_ALLOCATOR_IMPL(BlendTree, AnimGraphAllocator)
 
+    namespace
+    {
+        // Collect the node and all nodes it reads from through its connections, sources before the nodes that read from them.
+        void CollectInputNodes(AnimGraphNode* node, AZStd::unordered_set<AnimGraphNode*>& visitedNodes, AZStd::vector<AnimGraphNode*>& outNodes)
+        {
+            if (!visitedNodes.insert(node).second)
+            {
+                return;
+            }
+
+            for (const BlendTreeConnection* connection : node->GetConnections())
+            {
+                CollectInputNodes(connection->GetSourceNode(), visitedNodes, outNodes);
+            }
+            outNodes.emplace_back(node);
+        }
+    } // namespace
+
     BlendTree::BlendTree()
         : AnimGraphNode()
         , m_finalNodeId(AnimGraphNodeId::InvalidId)
@@ -47,6 +70,7 @@ namespace EMotionFX
     void BlendTree::Reinit()
     {
         m_finalNode = nullptr;
+        m_parallelOutputSubtrees.clear();
 
         if (m_finalNodeId == AnimGraphNodeId::InvalidId)
         {
@@ -73,6 +97,221 @@ namespace EMotionFX
                 }
             }
         }
+
+        BuildParallelOutputSubtrees();
+    }
+
+
+    void BlendTree::BuildParallelOutputSubtrees()
+    {
+        m_parallelOutputSubtrees.clear();
+        if (!m_finalNode)
+        {
+            return;
+        }
+
+        // The number of connections reading from each node.
+        AZStd::unordered_map<const AnimGraphNode*, size_t> numReaders;
+        for (const AnimGraphNode* childNode : m_childNodes)
+        {
+            for (const BlendTreeConnection* connection : childNode->GetConnections())
+            {
+                numReaders[connection->GetSourceNode()]++;
+            }
+        }
+
+        struct Candidate
+        {
+            ParallelOutputSubtree m_subtree;
+            AZStd::unordered_set<AnimGraphNode*> m_exclusiveNodes;
+            AZStd::unordered_set<AnimGraphNode*> m_sharedNodes;
+        };
+
+        const auto evaluateCandidate = [&numReaders](AnimGraphNode* root, Candidate& outCandidate)
+        {
+            AZStd::unordered_set<AnimGraphNode*> visitedNodes;
+            AZStd::vector<AnimGraphNode*> subtreeNodes;
+            CollectInputNodes(root, visitedNodes, subtreeNodes);
+
+            AZStd::unordered_map<const AnimGraphNode*, size_t> numSubtreeReaders;
+            for (const AnimGraphNode* node : subtreeNodes)
+            {
+                if (!node->GetSupportsParallelOutput())
+                {
+                    return false;
+                }
+
+                for (const BlendTreeConnection* connection : node->GetConnections())
+                {
+                    numSubtreeReaders[connection->GetSourceNode()]++;
+                }
+            }
+
+            // Nodes that are also read from outside of the subtree, and their inputs, are output before the tasks start.
+            // That is only done for value nodes, as they are cheap to output.
+            AZStd::vector<AnimGraphNode*>& sharedNodes = outCandidate.m_subtree.m_sharedNodes;
+            for (AnimGraphNode* node : subtreeNodes)
+            {
+                if (node != root && numReaders[node] > numSubtreeReaders[node])
+                {
+                    CollectInputNodes(node, outCandidate.m_sharedNodes, sharedNodes);
+                }
+            }
+            for (const AnimGraphNode* sharedNode : sharedNodes)
+            {
+                if (sharedNode->GetHasOutputPose())
+                {
+                    return false;
+                }
+            }
+
+            for (AnimGraphNode* node : subtreeNodes)
+            {
+                if (!outCandidate.m_sharedNodes.contains(node))
+                {
+                    outCandidate.m_exclusiveNodes.emplace(node);
+                }
+            }
+            outCandidate.m_subtree.m_root = root;
+            return true;
+        };
+
+        // Search for the subtrees from the final node. Nodes that read from a single candidate, or that aren't candidates, are searched further.
+        AZStd::vector<Candidate> acceptedCandidates;
+        AZStd::unordered_set<AnimGraphNode*> claimedNodes;
+        AZStd::unordered_set<AnimGraphNode*> claimedSharedNodes;
+        AZStd::unordered_set<AnimGraphNode*> visitedNodes;
+        AZStd::vector<AnimGraphNode*> nodesToSearch{ m_finalNode };
+        while (!nodesToSearch.empty())
+        {
+            AnimGraphNode* node = nodesToSearch.back();
+            nodesToSearch.pop_back();
+
+            AZStd::vector<Candidate> candidates;
+            for (const BlendTreeConnection* connection : node->GetConnections())
+            {
+                AnimGraphNode* sourceNode = connection->GetSourceNode();
+                if (!sourceNode->GetHasOutputPose() || !visitedNodes.insert(sourceNode).second)
+                {
+                    continue;
+                }
+
+                Candidate candidate;
+                if (evaluateCandidate(sourceNode, candidate))
+                {
+                    candidates.emplace_back(AZStd::move(candidate));
+                }
+                else
+                {
+                    nodesToSearch.emplace_back(sourceNode);
+                }
+            }
+
+            if (candidates.size() < 2)
+            {
+                for (const Candidate& candidate : candidates)
+                {
+                    nodesToSearch.emplace_back(candidate.m_subtree.m_root);
+                }
+                continue;
+            }
+
+            // Two tasks may only meet at the shared nodes, which are ready before they start.
+            for (Candidate& candidate : candidates)
+            {
+                const bool overlaps =
+                    AZStd::any_of(candidate.m_exclusiveNodes.begin(), candidate.m_exclusiveNodes.end(),
+                        [&claimedNodes, &claimedSharedNodes](AnimGraphNode* node) { return claimedNodes.contains(node) || claimedSharedNodes.contains(node); }) ||
+                    AZStd::any_of(candidate.m_sharedNodes.begin(), candidate.m_sharedNodes.end(),
+                        [&claimedNodes](AnimGraphNode* node) { return claimedNodes.contains(node); });
+                if (overlaps)
+                {
+                    nodesToSearch.emplace_back(candidate.m_subtree.m_root);
+                    continue;
+                }
+
+                claimedNodes.insert(candidate.m_exclusiveNodes.begin(), candidate.m_exclusiveNodes.end());
+                claimedSharedNodes.insert(candidate.m_sharedNodes.begin(), candidate.m_sharedNodes.end());
+                acceptedCandidates.emplace_back(AZStd::move(candidate));
+            }
+        }
+
+        if (acceptedCandidates.size() < 2)
+        {
+            return;
+        }
+
+        m_parallelOutputSubtrees.reserve(acceptedCandidates.size());
+        for (Candidate& candidate : acceptedCandidates)
+        {
+            m_parallelOutputSubtrees.emplace_back(AZStd::move(candidate.m_subtree));
+        }
+    }
+
+
+    void BlendTree::OutputSubtreesInParallel(AnimGraphInstance* animGraphInstance)
+    {
+        // Only the subtrees the update reached are output, just like the recursive output would.
+        AZStd::vector<const ParallelOutputSubtree*> activeSubtrees;
+        activeSubtrees.reserve(m_parallelOutputSubtrees.size());
+        for (const ParallelOutputSubtree& subtree : m_parallelOutputSubtrees)
+        {
+            const size_t objectIndex = subtree.m_root->GetObjectIndex();
+            if (animGraphInstance->GetIsUpdateReady(objectIndex) && !animGraphInstance->GetIsOutputReady(objectIndex))
+            {
+                activeSubtrees.emplace_back(&subtree);
+            }
+        }
+        if (activeSubtrees.size() < 2)
+        {
+            return;
+        }
+
+        auto* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (!taskGraphActiveInterface || !taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Animation, "BlendTree::OutputSubtreesInParallel");
+
+        // The tasks only read the shared nodes, so make them ready first.
+        for (const ParallelOutputSubtree* subtree : activeSubtrees)
+        {
+            for (AnimGraphNode* sharedNode : subtree->m_sharedNodes)
+            {
+                sharedNode->PerformOutput(animGraphInstance);
+            }
+        }
+
+        // The nodes of the subtrees request and free their poses from the same pool, from all tasks.
+        const uint32 threadIndex = animGraphInstance->GetActorInstance()->GetThreadIndex();
+        AnimGraphPosePool& posePool = GetEMotionFX().GetThreadData(threadIndex)->GetPosePool();
+        posePool.SetIsThreadSafe(true);
+        animGraphInstance->SetIsOutputInParallel(true);
+
+        AZ::TaskGraph taskGraph{ "BlendTree::OutputSubtreesInParallel" };
+        AZ::TaskDescriptor taskDescriptor{ "AnimGraphSubtreeOutput", "Animation" };
+        for (size_t i = 1; i < activeSubtrees.size(); ++i)
+        {
+            AnimGraphNode* root = activeSubtrees[i]->m_root;
+            taskGraph.AddTask(
+                taskDescriptor,
+                [root, animGraphInstance]()
+                {
+                    root->PerformOutput(animGraphInstance);
+                });
+        }
+
+        AZ::TaskGraphEvent finishedEvent{ "AnimGraphSubtreeOutput Wait" };
+        taskGraph.Submit(&finishedEvent);
+
+        // Output the first subtree on this thread instead of only waiting for the others.
+        activeSubtrees[0]->m_root->PerformOutput(animGraphInstance);
+        finishedEvent.Wait();
+
+        animGraphInstance->SetIsOutputInParallel(false);
+        posePool.SetIsThreadSafe(false);
     }
 
 
@@ -139,6 +378,13 @@ namespace EMotionFX
         AnimGraphNode* finalNode = GetRealFinalNode();
         if (finalNode)
         {
+            // Subtrees of nested blend trees are output by the task that outputs the nested blend tree.
+            if (!m_parallelOutputSubtrees.empty() && GetEMotionFX().GetIsAnimGraphParallelOutputEnabled() &&
+                !GetEMotionFX().GetIsInEditorMode() && !animGraphInstance->GetIsOutputInParallel() && finalNode == m_finalNode)
+            {
+                OutputSubtreesInParallel(animGraphInstance);
+            }
+
             OutputIncomingNode(animGraphInstance, finalNode);
 
             RequestPoses(animGraphInstance);
@@ -310,6 +556,9 @@ namespace EMotionFX
             m_finalNode = nullptr;
         }
 
+        // The subtrees get flattened again with the next Reinit().
+        m_parallelOutputSubtrees.clear();
+
         // call it for all children
         AnimGraphNode::OnRemoveNode(animGraph, nodeToRemove);
     }
@@ -95,9 +95,23 @@ namespace EMotionFX
         */
         bool ConnectionWillProduceCycle(AnimGraphNode* sourceNode, AnimGraphNode* targetNode) const;
 
+        /**
+        * Get the number of independent subtrees that can be output in parallel, found by the last Reinit().
+        * @result The number of subtrees, zero when the blend tree has less than two of them.
+        */
+        size_t GetNumParallelOutputSubtrees() const                     { return m_parallelOutputSubtrees.size(); }
+
         static void Reflect(AZ::ReflectContext* context);
 
     private:
+        // A subtree of pose nodes that no other subtree reads from, which can be output by its own task.
+        struct ParallelOutputSubtree
+        {
+            AnimGraphNode*                  m_root = nullptr;
+            AZStd::vector<AnimGraphNode*>   m_sharedNodes;      /**< The value nodes that are also read from outside of the subtree, sources first. */
+        };
+
+        AZStd::vector<ParallelOutputSubtree> m_parallelOutputSubtrees; /**< The subtrees flattened from the connections by Reinit(). */
         AZ::u64                 m_finalNodeId;      /**< Id of the final node that gets serialized. The final node represents the output of the blend tree. */
         BlendTreeFinalNode*     m_finalNode;        /**< The cached final node pointer based on the final node id. */
         AnimGraphNode*          m_virtualFinalNode;  /**< The virtual final node, which is the node who's output is used as final output. A value of nullptr means it will use the real m_finalNode. */
@@ -110,6 +124,19 @@ namespace EMotionFX
         */
         void RecursiveFindCycles(AnimGraphNode* nextNode, AZStd::unordered_set<AnimGraphNode*>& visitedNodes, AZStd::unordered_set<AZStd::pair<BlendTreeConnection*, AnimGraphNode*>>& cycleConnections) const;
 
+        /**
+        * Flatten the connections into the independent subtrees that can be output in parallel. Subtrees are searched for from the final node,
+        * at nodes that read from at least two of them. Only nodes that support parallel output are part of them, and the value nodes they
+        * share with the rest of the tree are output before the subtree tasks start.
+        */
+        void BuildParallelOutputSubtrees();
+
+        /**
+        * Output the subtrees the update reached in TaskGraph tasks, before the final node is output recursively and finds them ready.
+        * @param[in] animGraphInstance The anim graph instance to output.
+        */
+        void OutputSubtreesInParallel(AnimGraphInstance* animGraphInstance);
+
         void RecursiveSetUniqueDataFlag(AnimGraphNode* startNode, AnimGraphInstance* animGraphInstance, uint32 flag, bool enabled);
         void TopDownUpdate(AnimGraphInstance* animGraphInstance, float timePassedInSeconds) override;
         void PostUpdate(AnimGraphInstance* animGraphInstance, float timePassedInSeconds) override;
@@ -62,6 +62,7 @@ namespace EMotionFX
         virtual ~BlendTreeBlend2NodeBase();
 
         bool GetHasOutputPose() const override                  { return true; }
+        bool GetSupportsParallelOutput() const override         { return true; }
         bool GetSupportsDisable() const override                { return true; }
         bool GetSupportsVisualization() const override          { return true; }
         AZ::Color GetVisualColor() const override               { return AZ::Color(0.62f, 0.32f, 1.0f, 1.0f); }
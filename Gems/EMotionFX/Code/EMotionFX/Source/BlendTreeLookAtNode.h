@@ -77,6 +77,7 @@ namespace EMotionFX
         AnimGraphObjectData* CreateUniqueData(AnimGraphInstance* animGraphInstance) override { return aznew UniqueData(this, animGraphInstance); }
         bool GetSupportsVisualization() const override              { return true; }
         bool GetHasOutputPose() const override                      { return true; }
+        bool GetSupportsParallelOutput() const override             { return true; }
         bool GetSupportsDisable() const override                    { return true; }
         AZ::Color GetVisualColor() const override                   { return AZ::Color(1.0f, 0.0f, 0.0f, 1.0f); }
         AnimGraphPose* GetMainOutputPose(AnimGraphInstance* animGraphInstance) const override     { return GetOutputPose(animGraphInstance, OUTPUTPORT_POSE)->GetValue(); }
@@ -68,6 +68,7 @@ namespace EMotionFX
 
         AnimGraphObjectData* CreateUniqueData(AnimGraphInstance* animGraphInstance) override { return aznew UniqueData(this, animGraphInstance); }
         bool GetHasOutputPose() const override { return true; }
+        bool GetSupportsParallelOutput() const override { return true; }
         bool GetSupportsVisualization() const override { return true; }
         AZ::Color GetVisualColor() const override { return AZ::Color(0.2f, 0.78f, 0.2f, 1.0f); }
         AnimGraphPose* GetMainOutputPose(AnimGraphInstance* animGraphInstance) const override         { return GetOutputPose(animGraphInstance, OUTPUTPORT_RESULT)->GetValue(); }
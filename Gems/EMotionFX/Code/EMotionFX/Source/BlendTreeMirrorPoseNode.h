@@ -51,6 +51,7 @@ namespace EMotionFX
         bool GetCanActAsState() const override                  { return false; }
         bool GetSupportsVisualization() const override          { return true; }
         bool GetHasOutputPose() const override                  { return true; }
+        bool GetSupportsParallelOutput() const override         { return true; }
         bool GetSupportsDisable() const override                { return true; }
 
         AnimGraphPose* GetMainOutputPose(AnimGraphInstance* animGraphInstance) const override     { return GetOutputPose(animGraphInstance, OUTPUTPORT_RESULT)->GetValue(); }
@@ -128,6 +128,7 @@ namespace EMotionFX
 
         // EMotionFX will do optimization in server mode when this is enabled.
         m_enableServerOptimization = true;
+        m_isAnimGraphParallelOutputEnabled = false;
 
         if (MCore::GetMCore().GetIsTrackingMemory())
         {
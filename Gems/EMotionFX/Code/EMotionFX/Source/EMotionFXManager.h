@@ -346,6 +346,18 @@ namespace EMotionFX
          */
         bool GetEnableServerOptimization() const { return m_isInServerMode && m_enableServerOptimization; }
 
+        /**
+         * Get if the blend trees output their independent subtrees in parallel TaskGraph tasks.
+         * @return True if the subtrees of a single anim graph instance can be output in parallel.
+         */
+        bool GetIsAnimGraphParallelOutputEnabled() const { return m_isAnimGraphParallelOutputEnabled; }
+
+        /**
+         * Enable or disable outputting the independent subtrees of blend trees in parallel TaskGraph tasks. It is never done in editor mode.
+         * @param enabled Set to true to output the subtrees in parallel.
+         */
+        void SetIsAnimGraphParallelOutputEnabled(bool enabled) { m_isAnimGraphParallelOutputEnabled = enabled; }
+
     private:
         AZStd::string               m_versionString;         /**< The version string. */
         AZStd::string               m_compilationDate;       /**< The compilation date string. */
@@ -372,6 +384,7 @@ namespace EMotionFX
         bool                        m_isInEditorMode;       /**< True when the runtime requires to support an editor. Optimizations can be made if there is no need for editor support. */
         bool                        m_isInServerMode;       /**< True when emotionfx is running on server. */
         bool                        m_enableServerOptimization; /**< True when optimization can be made when emotionfx is running in server mode. */
+        bool                        m_isAnimGraphParallelOutputEnabled; /**< True when the blend trees output their independent subtrees in parallel. */
 
         /**
          * The constructor.
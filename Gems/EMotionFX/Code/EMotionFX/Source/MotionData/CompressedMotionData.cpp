@@ -0,0 +1,1379 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Outcome/Outcome.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/AzCoreConversions.h>
+#include <MCore/Source/CompressedQuaternion.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        // Rotations are stored with a positive w, so it can be rebuilt from the x, y and z components.
+        AZ_FORCE_INLINE float CalcRotationW(const AZ::Vector3& xyz)
+        {
+            return AZ::Sqrt(AZStd::max(0.0f, 1.0f - xyz.GetLengthSq()));
+        }
+
+        // Uses the same per component error metric as the keyframe reduction of the NonUniformMotionData.
+        float CalcSampleError(const AZ::Vector3& value, const AZ::Vector3& reference, bool isRotation)
+        {
+            float error = (value - reference).GetAbs().GetMaxElement();
+            if (isRotation)
+            {
+                error = AZStd::max(error, AZStd::abs(CalcRotationW(value) - CalcRotationW(reference)));
+            }
+            return error;
+        }
+
+        struct QuantizedTrack
+        {
+            AZ::Vector3 m_rangeMin = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_rangeExtent = AZ::Vector3::CreateZero();
+            AZ::u8 m_numBits = 16;
+            AZStd::vector<AZ::u16> m_values; // Three per sample.
+        };
+
+        AZ_FORCE_INLINE float GetMaxQuantizedValue(AZ::u8 numBits)
+        {
+            return static_cast<float>((1 << numBits) - 1);
+        }
+
+        void Quantize(const AZStd::vector<AZ::Vector3>& values, AZ::u8 numBits, QuantizedTrack& outTrack)
+        {
+            const float maxValue = GetMaxQuantizedValue(numBits);
+            outTrack.m_numBits = numBits;
+            outTrack.m_values.resize(values.size() * 3);
+            for (size_t s = 0; s < values.size(); ++s)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    const float extent = outTrack.m_rangeExtent.GetElement(c);
+                    const float normalized = (extent > 0.0f) ? (values[s].GetElement(c) - outTrack.m_rangeMin.GetElement(c)) / extent : 0.0f;
+                    outTrack.m_values[s * 3 + c] = static_cast<AZ::u16>(AZ::GetClamp(normalized, 0.0f, 1.0f) * maxValue + 0.5f);
+                }
+            }
+        }
+
+        AZ_FORCE_INLINE AZ::Vector3 Dequantize(const AZ::Vector3& rangeMin, const AZ::Vector3& rangeExtent, AZ::u8 numBits, AZ::u32 x, AZ::u32 y, AZ::u32 z)
+        {
+            const float invMaxValue = 1.0f / GetMaxQuantizedValue(numBits);
+            const AZ::Vector3 normalized(static_cast<float>(x) * invMaxValue, static_cast<float>(y) * invMaxValue, static_cast<float>(z) * invMaxValue);
+            return rangeMin + rangeExtent * normalized;
+        }
+
+        // Returns false when the track stays within the max error of its first sample, so it doesn't need any samples.
+        // Otherwise quantizes the track with the smallest bit rate that keeps every sample within the max error.
+        bool QuantizeTrack(const AZStd::vector<AZ::Vector3>& values, bool isRotation, float maxError, QuantizedTrack& outTrack)
+        {
+            const bool isConstant = AZStd::all_of(values.begin(), values.end(),
+                [&values, isRotation, maxError](const AZ::Vector3& value)
+                {
+                    return CalcSampleError(value, values[0], isRotation) <= maxError;
+                });
+            if (isConstant)
+            {
+                return false;
+            }
+
+            AZ::Vector3 rangeMax = values[0];
+            outTrack.m_rangeMin = values[0];
+            for (const AZ::Vector3& value : values)
+            {
+                outTrack.m_rangeMin = outTrack.m_rangeMin.GetMin(value);
+                rangeMax = rangeMax.GetMax(value);
+            }
+            outTrack.m_rangeExtent = rangeMax - outTrack.m_rangeMin;
+
+            Quantize(values, 8, outTrack);
+            for (size_t s = 0; s < values.size(); ++s)
+            {
+                const AZ::Vector3 decoded = Dequantize(outTrack.m_rangeMin, outTrack.m_rangeExtent, 8,
+                    outTrack.m_values[s * 3], outTrack.m_values[s * 3 + 1], outTrack.m_values[s * 3 + 2]);
+                if (CalcSampleError(decoded, values[s], isRotation) > maxError)
+                {
+                    Quantize(values, 16, outTrack);
+                    break;
+                }
+            }
+            return true;
+        }
+
+        AZStd::vector<AZ::Vector3> GetRotationComponents(const AZStd::vector<AZ::Quaternion>& rotations)
+        {
+            AZStd::vector<AZ::Vector3> result;
+            result.reserve(rotations.size());
+            for (const AZ::Quaternion& rotation : rotations)
+            {
+                const AZ::Quaternion normalized = rotation.GetNormalized();
+                result.emplace_back((normalized.GetW() < 0.0f) ? -normalized.GetImaginary() : normalized.GetImaginary());
+            }
+            return result;
+        }
+
+        float CalcMaxFloatError(const AZStd::vector<float>& values)
+        {
+            float maxError = 0.0f;
+            for (const float value : values)
+            {
+                maxError = AZStd::max(maxError, AZStd::abs(value - values[0]));
+            }
+            return maxError;
+        }
+    } // namespace
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Evenly Spaced Keyframes (smallest, fast)";
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        Clear();
+        Resize(motionData->GetNumJoints(), motionData->GetNumMorphs(), motionData->GetNumFloats());
+        CopyBaseMotionData(motionData);
+        SetSampleRate(keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate);
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), m_sampleRate, m_numSamples, sampleSpacing);
+        SetSampleRate(m_sampleRate);
+        UpdateDuration();
+
+        // Joints.
+        const size_t numJoints = motionData->GetNumJoints();
+        AZStd::vector<JointSamples> jointSamples(numJoints);
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            JointSamples& samples = jointSamples[i];
+            const bool posAnimated = motionData->IsJointPositionAnimated(i);
+            const bool rotAnimated = motionData->IsJointRotationAnimated(i);
+            if (posAnimated) { samples.m_positions.resize(m_numSamples); }
+            if (rotAnimated) { samples.m_rotations.resize(m_numSamples); }
+            EMFX_SCALECODE
+            (
+                const bool scaleAnimated = motionData->IsJointScaleAnimated(i);
+                if (scaleAnimated) { samples.m_scales.resize(m_numSamples); }
+            )
+
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const Transform transform = motionData->SampleJointTransform(s * sampleSpacing, i);
+                if (posAnimated) samples.m_positions[s] = transform.m_position;
+                if (rotAnimated) samples.m_rotations[s] = transform.m_rotation;
+                EMFX_SCALECODE
+                (
+                    if (scaleAnimated) samples.m_scales[s] = transform.m_scale;
+                )
+            }
+        }
+
+        // Until Optimize is called with the error bounds, all tracks use 16 bits and only the fully constant ones are removed.
+        OptimizeSettings losslessSettings;
+        losslessSettings.m_maxPosError = 0.0f;
+        losslessSettings.m_maxRotError = 0.0f;
+        losslessSettings.m_maxScaleError = 0.0f;
+        BuildTracks(jointSamples, losslessSettings);
+
+        // Morphs.
+        for (size_t i = 0; i < motionData->GetNumMorphs(); ++i)
+        {
+            if (motionData->IsMorphAnimated(i))
+            {
+                m_morphData[i].m_values.resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    m_morphData[i].m_values[s] = motionData->SampleMorph(s * sampleSpacing, i);
+                }
+            }
+        }
+
+        // Floats.
+        for (size_t i = 0; i < motionData->GetNumFloats(); ++i)
+        {
+            if (motionData->IsFloatAnimated(i))
+            {
+                m_floatData[i].m_values.resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    m_floatData[i].m_values[s] = motionData->SampleFloat(s * sampleSpacing, i);
+                }
+            }
+        }
+    }
+
+    void CompressedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        // Requantize from the decoded tracks, their 16 bit error is far below the error bounds.
+        AZStd::vector<JointSamples> jointSamples;
+        DecodeJointSamples(jointSamples);
+        BuildTracks(jointSamples, settings);
+
+        // Morphs and floats aren't quantized, only the ones that stay constant are removed.
+        for (size_t i = 0; i < m_morphData.size(); ++i)
+        {
+            FloatData& morphData = m_morphData[i];
+            if (!morphData.m_values.empty() &&
+                AZStd::find(settings.m_morphIgnoreList.begin(), settings.m_morphIgnoreList.end(), i) == settings.m_morphIgnoreList.end() &&
+                CalcMaxFloatError(morphData.m_values) <= settings.m_maxMorphError)
+            {
+                m_staticMorphData[i].m_staticValue = morphData.m_values[0];
+                ClearMorphSamples(i);
+            }
+        }
+
+        for (size_t i = 0; i < m_floatData.size(); ++i)
+        {
+            FloatData& floatData = m_floatData[i];
+            if (!floatData.m_values.empty() &&
+                AZStd::find(settings.m_floatIgnoreList.begin(), settings.m_floatIgnoreList.end(), i) == settings.m_floatIgnoreList.end() &&
+                CalcMaxFloatError(floatData.m_values) <= settings.m_maxFloatError)
+            {
+                m_staticFloatData[i].m_staticValue = floatData.m_values[0];
+                ClearFloatSamples(i);
+            }
+        }
+
+        if (settings.m_updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    void CompressedMotionData::BuildTracks(const AZStd::vector<JointSamples>& jointSamples, const OptimizeSettings& settings)
+    {
+        struct PendingTrack
+        {
+            QuantizedTrack m_track;
+            AZ::u32* m_trackIndex = nullptr;
+        };
+        AZStd::vector<PendingTrack> pendingTracks;
+
+        m_jointData.clear();
+        m_jointData.resize(jointSamples.size());
+        for (size_t i = 0; i < jointSamples.size(); ++i)
+        {
+            float maxPosError = settings.m_maxPosError;
+            float maxRotError = settings.m_maxRotError;
+            float maxScaleError = settings.m_maxScaleError;
+            if (AZStd::find(settings.m_jointIgnoreList.begin(), settings.m_jointIgnoreList.end(), i) != settings.m_jointIgnoreList.end())
+            {
+                maxPosError = 0.00001f;
+                maxRotError = 0.00001f;
+                maxScaleError = 0.00001f;
+            }
+
+            const JointSamples& samples = jointSamples[i];
+            JointData& jointData = m_jointData[i];
+            Transform& staticTransform = m_staticJointData[i].m_staticTransform;
+
+            QuantizedTrack track;
+            if (!samples.m_positions.empty())
+            {
+                if (QuantizeTrack(samples.m_positions, /*isRotation=*/false, maxPosError, track))
+                {
+                    pendingTracks.push_back({ AZStd::move(track), &jointData.m_positionTrack });
+                }
+                else
+                {
+                    staticTransform.m_position = samples.m_positions[0];
+                }
+            }
+
+            if (!samples.m_rotations.empty())
+            {
+                if (QuantizeTrack(GetRotationComponents(samples.m_rotations), /*isRotation=*/true, maxRotError, track))
+                {
+                    pendingTracks.push_back({ AZStd::move(track), &jointData.m_rotationTrack });
+                }
+                else
+                {
+                    staticTransform.m_rotation = samples.m_rotations[0].GetNormalized();
+                }
+            }
+
+            EMFX_SCALECODE
+            (
+                if (!samples.m_scales.empty())
+                {
+                    if (QuantizeTrack(samples.m_scales, /*isRotation=*/false, maxScaleError, track))
+                    {
+                        pendingTracks.push_back({ AZStd::move(track), &jointData.m_scaleTrack });
+                    }
+                    else
+                    {
+                        staticTransform.m_scale = samples.m_scales[0];
+                    }
+                }
+            )
+        }
+
+        // Lay out the tracks inside of the frames, each track takes three components of its bit rate.
+        m_tracks.clear();
+        m_tracks.reserve(pendingTracks.size());
+        m_frameSize = 0;
+        for (PendingTrack& pendingTrack : pendingTracks)
+        {
+            *pendingTrack.m_trackIndex = static_cast<AZ::u32>(m_tracks.size());
+            Track& track = m_tracks.emplace_back();
+            track.m_rangeMin = pendingTrack.m_track.m_rangeMin;
+            track.m_rangeExtent = pendingTrack.m_track.m_rangeExtent;
+            track.m_numBits = pendingTrack.m_track.m_numBits;
+            track.m_frameOffset = static_cast<AZ::u32>(m_frameSize);
+            m_frameSize += 3 * (track.m_numBits / 8);
+        }
+
+        // The 16 bit values are stored in little endian byte order, so the frame data doesn't depend on the platform.
+        m_frameData.clear();
+        m_frameData.resize(m_frameSize * m_numSamples);
+        for (size_t t = 0; t < pendingTracks.size(); ++t)
+        {
+            const Track& track = m_tracks[t];
+            const AZStd::vector<AZ::u16>& values = pendingTracks[t].m_track.m_values;
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                AZ::u8* data = &m_frameData[s * m_frameSize + track.m_frameOffset];
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    const AZ::u16 value = values[s * 3 + c];
+                    if (track.m_numBits == 8)
+                    {
+                        data[c] = static_cast<AZ::u8>(value);
+                    }
+                    else
+                    {
+                        data[c * 2] = static_cast<AZ::u8>(value & 0xFF);
+                        data[c * 2 + 1] = static_cast<AZ::u8>(value >> 8);
+                    }
+                }
+            }
+        }
+    }
+
+    void CompressedMotionData::DecodeJointSamples(AZStd::vector<JointSamples>& outJointSamples) const
+    {
+        outJointSamples.clear();
+        outJointSamples.resize(m_jointData.size());
+        for (size_t i = 0; i < m_jointData.size(); ++i)
+        {
+            const JointData& jointData = m_jointData[i];
+            JointSamples& samples = outJointSamples[i];
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                if (jointData.m_positionTrack != InvalidIndex32)
+                {
+                    samples.m_positions.emplace_back(DecodeVector3(m_tracks[jointData.m_positionTrack], s));
+                }
+                if (jointData.m_rotationTrack != InvalidIndex32)
+                {
+                    samples.m_rotations.emplace_back(DecodeRotation(m_tracks[jointData.m_rotationTrack], s));
+                }
+                if (jointData.m_scaleTrack != InvalidIndex32)
+                {
+                    samples.m_scales.emplace_back(DecodeVector3(m_tracks[jointData.m_scaleTrack], s));
+                }
+            }
+        }
+    }
+
+    AZ::Vector3 CompressedMotionData::DecodeVector3(const Track& track, size_t sampleIndex) const
+    {
+        const AZ::u8* data = &m_frameData[sampleIndex * m_frameSize + track.m_frameOffset];
+        if (track.m_numBits == 8)
+        {
+            return Dequantize(track.m_rangeMin, track.m_rangeExtent, 8, data[0], data[1], data[2]);
+        }
+
+        return Dequantize(track.m_rangeMin, track.m_rangeExtent, 16,
+            data[0] | (data[1] << 8),
+            data[2] | (data[3] << 8),
+            data[4] | (data[5] << 8));
+    }
+
+    AZ::Quaternion CompressedMotionData::DecodeRotation(const Track& track, size_t sampleIndex) const
+    {
+        const AZ::Vector3 xyz = DecodeVector3(track, sampleIndex);
+        return AZ::Quaternion::CreateFromVector3AndValue(xyz, CalcRotationW(xyz)).GetNormalized();
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(size_t jointDataIndex, size_t indexA, size_t indexB, float t) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+
+        Transform result;
+        result.m_position = (jointData.m_positionTrack != InvalidIndex32)
+            ? DecodeVector3(m_tracks[jointData.m_positionTrack], indexA).Lerp(DecodeVector3(m_tracks[jointData.m_positionTrack], indexB), t)
+            : staticTransform.m_position;
+        result.m_rotation = (jointData.m_rotationTrack != InvalidIndex32)
+            ? MCore::NLerp(DecodeRotation(m_tracks[jointData.m_rotationTrack], indexA), DecodeRotation(m_tracks[jointData.m_rotationTrack], indexB), t)
+            : staticTransform.m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+        result.m_scale = (jointData.m_scaleTrack != InvalidIndex32)
+            ? DecodeVector3(m_tracks[jointData.m_scaleTrack], indexA).Lerp(DecodeVector3(m_tracks[jointData.m_scaleTrack], indexB), t)
+            : staticTransform.m_scale;
+#endif
+        return result;
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const size_t jointDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && jointDataIndex == InvalidIndex)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const bool inPlace = (settings.m_inPlace && jointSkeletonIndex == actor->GetMotionExtractionNodeIndex());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (jointDataIndex != InvalidIndex && !inPlace)
+        {
+            result = SampleJointTransform(jointDataIndex, indexA, indexB, t);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).m_sourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.m_flags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // All joints are decoded from the same two frames, which are contiguous in memory.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
+
+            // Sample the interpolated data.
+            Transform result;
+            const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex && !inPlace)
+            {
+                result = SampleJointTransform(jointDataIndex, indexA, indexB, t);
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (size_t i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                const FloatData& data = m_morphData[realIndex];
+                if (!data.m_values.empty())
+                {
+                    outputPose->SetMorphWeight(i, AZ::Lerp(data.m_values[indexA], data.m_values[indexB], t));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, m_staticMorphData[realIndex].m_staticValue);
+                }
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const AZStd::vector<float>& values = m_morphData[morphDataIndex].m_values;
+        return (!values.empty()) ? AZ::Lerp(values[indexA], values[indexB], t) : m_staticMorphData[morphDataIndex].m_staticValue;
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const AZStd::vector<float>& values = m_floatData[floatDataIndex].m_values;
+        return (!values.empty()) ? AZ::Lerp(values[indexA], values[indexB], t) : m_staticFloatData[floatDataIndex].m_staticValue;
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return SampleJointTransform(jointDataIndex, indexA, indexB, t);
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 trackIndex = m_jointData[jointDataIndex].m_positionTrack;
+        if (trackIndex == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_position;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeVector3(m_tracks[trackIndex], indexA).Lerp(DecodeVector3(m_tracks[trackIndex], indexB), t);
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 trackIndex = m_jointData[jointDataIndex].m_rotationTrack;
+        if (trackIndex == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_rotation;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return MCore::NLerp(DecodeRotation(m_tracks[trackIndex], indexA), DecodeRotation(m_tracks[trackIndex], indexB), t);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 trackIndex = m_jointData[jointDataIndex].m_scaleTrack;
+        if (trackIndex == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_scale;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeVector3(m_tracks[trackIndex], indexA).Lerp(DecodeVector3(m_tracks[trackIndex], indexB), t);
+    }
+#endif
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        m_jointData.resize(numJoints);
+        m_morphData.resize(numMorphs);
+        m_floatData.resize(numFloats);
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointData.size(), "Expected the size of the jointData vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointData.emplace_back();
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphData.size(), "Expected the size of the morphData vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphData.emplace_back();
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatData.size(), "Expected the size of the floatData vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatData.emplace_back();
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        // The tracks of the joint stay inside of the frames until the next Optimize.
+        m_jointData.erase(m_jointData.begin() + jointDataIndex);
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        m_morphData.erase(m_morphData.begin() + morphDataIndex);
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        m_floatData.erase(m_floatData.begin() + floatDataIndex);
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_jointData.clear();
+        m_jointData.shrink_to_fit();
+        m_tracks.clear();
+        m_tracks.shrink_to_fit();
+        m_frameData.clear();
+        m_frameData.shrink_to_fit();
+        m_morphData.clear();
+        m_morphData.shrink_to_fit();
+        m_floatData.clear();
+        m_floatData.shrink_to_fit();
+
+        m_frameSize = 0;
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // Scaling the range of the position tracks scales all of their samples.
+        for (const JointData& jointData : m_jointData)
+        {
+            if (jointData.m_positionTrack != InvalidIndex32)
+            {
+                Track& track = m_tracks[jointData.m_positionTrack];
+                track.m_rangeMin *= scaleFactor;
+                track.m_rangeExtent *= scaleFactor;
+            }
+        }
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+    void CompressedMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > AZ::Constants::FloatEpsilon)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void CompressedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    float CompressedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    size_t CompressedMotionData::GetNumTracks() const
+    {
+        return m_tracks.size();
+    }
+
+    size_t CompressedMotionData::GetNumTrackBits(size_t trackIndex) const
+    {
+        return m_tracks[trackIndex].m_numBits;
+    }
+
+    size_t CompressedMotionData::GetFrameSizeInBytes() const
+    {
+        return m_frameSize;
+    }
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        for (JointData& data : m_jointData)
+        {
+            data = JointData();
+        }
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        for (FloatData& data : m_morphData)
+        {
+            data.m_values.clear();
+        }
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        for (FloatData& data : m_floatData)
+        {
+            data.m_values.clear();
+        }
+    }
+
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_positionTrack = InvalidIndex32;
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_rotationTrack = InvalidIndex32;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_scaleTrack = InvalidIndex32;
+    }
+#endif
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex] = JointData();
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        m_morphData[morphDataIndex].m_values.clear();
+        m_morphData[morphDataIndex].m_values.shrink_to_fit();
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        m_floatData[floatDataIndex].m_values.clear();
+        m_floatData[floatDataIndex].m_values.shrink_to_fit();
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_positionTrack != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_rotationTrack != InvalidIndex32;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_scaleTrack != InvalidIndex32;
+    }
+#endif
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+        return jointData.m_positionTrack != InvalidIndex32 || jointData.m_rotationTrack != InvalidIndex32 || jointData.m_scaleTrack != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return !m_morphData[morphDataIndex].m_values.empty();
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return !m_floatData[floatDataIndex].m_values.empty();
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        AZ::u32 m_numTracks = 0;
+        AZ::u32 m_frameSize = 0;
+        float m_sampleRate = 30.0f;
+
+        // Followed by:
+        // File_CompressedMotionData_Track[m_numTracks]
+        // AZ::u8[m_numSamples * m_frameSize] : The frames, 16 bit values are stored in little endian.
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+    };
+
+    struct File_CompressedMotionData_Track
+    {
+        FileFormat::FileVector3 m_rangeMin { 0.0f, 0.0f, 0.0f };
+        FileFormat::FileVector3 m_rangeExtent { 0.0f, 0.0f, 0.0f };
+        AZ::u32 m_frameOffset = 0;
+        AZ::u32 m_numBits = 16;
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // Rotation when not animated.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // Position when not animated.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // Scale when not animated.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+        AZ::u32                         m_positionTrack = InvalidIndex32;        // The track indices, InvalidIndex32 when not animated.
+        AZ::u32                         m_rotationTrack = InvalidIndex32;
+        AZ::u32                         m_scaleTrack = InvalidIndex32;
+
+        // Followed by:
+        // string : The name of the joint.
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float m_staticValue = 0.0f; // The static value.
+        AZ::u32 m_isAnimated = 0;
+
+        // Followed by:
+        // String: The name of the channel.
+        // float[ File_CompressedMotionData_Info.m_numSamples ] (only when m_isAnimated is set).
+    };
+    //---------------------------------------------------------------------------------------
+
+    bool SaveCompressedJoint(MCore::Stream* stream, const CompressedMotionData* motionData, size_t jointDataIndex, const MotionData::SaveSettings& saveSettings)
+    {
+        AZ::PackedVector3f posePosition = AZ::PackedVector3f(motionData->GetJointStaticPosition(jointDataIndex));
+        AZ::PackedVector3f bindPosePosition = AZ::PackedVector3f(motionData->GetJointBindPosePosition(jointDataIndex));
+        MCore::Compressed16BitQuaternion poseRotation(motionData->GetJointStaticRotation(jointDataIndex));
+        MCore::Compressed16BitQuaternion bindPoseRotation(motionData->GetJointBindPoseRotation(jointDataIndex));
+        #ifndef EMFX_SCALE_DISABLED
+            AZ::PackedVector3f poseScale = AZ::PackedVector3f(motionData->GetJointStaticScale(jointDataIndex));
+            AZ::PackedVector3f bindPoseScale = AZ::PackedVector3f(motionData->GetJointBindPoseScale(jointDataIndex));
+        #else
+            AZ::PackedVector3f bindPoseScale(1.0f, 1.0f, 1.0f);
+            AZ::PackedVector3f poseScale(1.0f, 1.0f, 1.0f);
+        #endif
+
+        File_CompressedMotionData_Joint jointChunk;
+        ExporterLib::CopyVector(jointChunk.m_staticPos, posePosition);
+        ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, poseRotation);
+        ExporterLib::CopyVector(jointChunk.m_staticScale, poseScale);
+        ExporterLib::CopyVector(jointChunk.m_bindPosePos, bindPosePosition);
+        ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, bindPoseRotation);
+        ExporterLib::CopyVector(jointChunk.m_bindPoseScale, bindPoseScale);
+
+        const CompressedMotionData::JointData& jointData = motionData->m_jointData[jointDataIndex];
+        jointChunk.m_positionTrack = jointData.m_positionTrack;
+        jointChunk.m_rotationTrack = jointData.m_rotationTrack;
+        jointChunk.m_scaleTrack = jointData.m_scaleTrack;
+
+        if (saveSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- Motion Joint: %s", motionData->GetJointName(jointDataIndex).c_str());
+            MCore::LogDetailedInfo("   + Position Track: %d", jointData.m_positionTrack);
+            MCore::LogDetailedInfo("   + Rotation Track: %d", jointData.m_rotationTrack);
+            MCore::LogDetailedInfo("   + Scale Track:    %d", jointData.m_scaleTrack);
+        }
+
+        // Convert endian.
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+        ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+        ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+        ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&jointChunk.m_positionTrack, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&jointChunk.m_rotationTrack, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&jointChunk.m_scaleTrack, targetEndianType);
+
+        if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joint name.
+        ExporterLib::SaveString(motionData->GetJointName(jointDataIndex), stream, targetEndianType);
+        return true;
+    }
+
+    bool SaveCompressedFloat(MCore::Stream* stream, const AZStd::string& channelName, float staticValue, const AZStd::vector<float>& values, const MotionData::SaveSettings& saveSettings)
+    {
+        if (channelName.empty())
+        {
+            MCore::LogError("Cannot save float channel with empty name.");
+            return false;
+        }
+
+        File_CompressedMotionData_Float floatChunk;
+        floatChunk.m_staticValue = staticValue;
+        floatChunk.m_isAnimated = values.empty() ? 0 : 1;
+
+        if (saveSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("    - Float Channel: '%s'", channelName.c_str());
+            MCore::LogDetailedInfo("       + Static Value = %f", floatChunk.m_staticValue);
+            MCore::LogDetailedInfo("       + IsAnimated   = %s", values.empty() ? "No" : "Yes");
+        }
+
+        // Convert endian.
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&floatChunk.m_isAnimated, targetEndianType);
+        if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+        {
+            return false;
+        }
+        ExporterLib::SaveString(channelName, stream, targetEndianType);
+
+        // Save the samples.
+        for (float sampleValue : values)
+        {
+            ExporterLib::ConvertFloat(&sampleValue, targetEndianType);
+            if (stream->Write(&sampleValue, sizeof(float)) == 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+        numBytes += m_tracks.size() * sizeof(File_CompressedMotionData_Track);
+        numBytes += m_frameData.size();
+
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+        }
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+            numBytes += m_morphData[i].m_values.size() * sizeof(float);
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+            numBytes += m_floatData[i].m_values.size() * sizeof(float);
+        }
+
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(m_numSamples);
+        info.m_numTracks = static_cast<AZ::u32>(m_tracks.size());
+        info.m_frameSize = static_cast<AZ::u32>(m_frameSize);
+        info.m_sampleRate = GetSampleRate();
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numTracks, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_frameSize, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the tracks.
+        for (const Track& track : m_tracks)
+        {
+            File_CompressedMotionData_Track trackChunk;
+            ExporterLib::CopyVector(trackChunk.m_rangeMin, AZ::PackedVector3f(track.m_rangeMin));
+            ExporterLib::CopyVector(trackChunk.m_rangeExtent, AZ::PackedVector3f(track.m_rangeExtent));
+            trackChunk.m_frameOffset = track.m_frameOffset;
+            trackChunk.m_numBits = track.m_numBits;
+            ExporterLib::ConvertFileVector3(&trackChunk.m_rangeMin, targetEndianType);
+            ExporterLib::ConvertFileVector3(&trackChunk.m_rangeExtent, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&trackChunk.m_frameOffset, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&trackChunk.m_numBits, targetEndianType);
+            if (stream->Write(&trackChunk, sizeof(File_CompressedMotionData_Track)) == 0)
+            {
+                return false;
+            }
+        }
+
+        // Write the frames, they are already in little endian byte order.
+        if (!m_frameData.empty() && stream->Write(m_frameData.data(), m_frameData.size()) == 0)
+        {
+            return false;
+        }
+
+        // Write the joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            if (!SaveCompressedJoint(stream, this, i, saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the morph channels.
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!SaveCompressedFloat(stream, GetMorphName(i), GetMorphStaticValue(i), m_morphData[i].m_values, saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the float channels.
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!SaveCompressedFloat(stream, GetFloatName(i), GetFloatStaticValue(i), m_floatData[i].m_values, saveSettings))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool ReadCompressedFloat(MCore::Stream* stream, size_t numSamples, const MotionData::ReadSettings& readSettings, AZStd::string& outName, float& outStaticValue, AZStd::vector<float>& outValues)
+    {
+        File_CompressedMotionData_Float floatInfo;
+        if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&floatInfo.m_isAnimated, sourceEndianType);
+        outName = MotionData::ReadStringFromStream(stream, sourceEndianType);
+        outStaticValue = floatInfo.m_staticValue;
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("  + Float: '%s'", outName.c_str());
+            MCore::LogDetailedInfo("       + IsAnimated   = %s", floatInfo.m_isAnimated ? "Yes" : "No");
+            MCore::LogDetailedInfo("       + Static value = %f", floatInfo.m_staticValue);
+        }
+
+        outValues.resize(floatInfo.m_isAnimated ? numSamples : 0);
+        if (!outValues.empty())
+        {
+            if (stream->Read(outValues.data(), outValues.size() * sizeof(float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(outValues.data(), sourceEndianType, outValues.size());
+        }
+        return true;
+    }
+
+    bool ReadCompressedMotionDataVersion1(MCore::Stream* stream, CompressedMotionData* motionData, const MotionData::ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numTracks, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_frameSize, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints  = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs  = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats  = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumTracks  = %d", info.m_numTracks);
+            MCore::LogDetailedInfo("  + FrameSize  = %d", info.m_frameSize);
+            MCore::LogDetailedInfo("  + SampleRate = %f", info.m_sampleRate);
+        }
+
+        // Initialize the motion data.
+        motionData->Clear();
+        motionData->Resize(info.m_numJoints, info.m_numMorphs, info.m_numFloats);
+        motionData->m_numSamples = info.m_numSamples;
+        motionData->m_frameSize = info.m_frameSize;
+        motionData->SetSampleRate(info.m_sampleRate);
+        motionData->UpdateDuration();
+
+        // Read the tracks.
+        motionData->m_tracks.resize(info.m_numTracks);
+        for (CompressedMotionData::Track& track : motionData->m_tracks)
+        {
+            File_CompressedMotionData_Track trackInfo;
+            if (stream->Read(&trackInfo, sizeof(File_CompressedMotionData_Track)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&trackInfo.m_rangeMin.m_x, sourceEndianType, /*numFloats=*/3);
+            MCore::Endian::ConvertFloat(&trackInfo.m_rangeExtent.m_x, sourceEndianType, /*numFloats=*/3);
+            MCore::Endian::ConvertUnsignedInt32(&trackInfo.m_frameOffset, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&trackInfo.m_numBits, sourceEndianType);
+            if ((trackInfo.m_numBits != 8 && trackInfo.m_numBits != 16) || trackInfo.m_frameOffset + 3 * (trackInfo.m_numBits / 8) > info.m_frameSize)
+            {
+                AZ_Error("EMotionFX", false, "Invalid compressed motion data track (frame offset=%d, bits=%d).", trackInfo.m_frameOffset, trackInfo.m_numBits);
+                return false;
+            }
+            track.m_rangeMin.Set(trackInfo.m_rangeMin.m_x, trackInfo.m_rangeMin.m_y, trackInfo.m_rangeMin.m_z);
+            track.m_rangeExtent.Set(trackInfo.m_rangeExtent.m_x, trackInfo.m_rangeExtent.m_y, trackInfo.m_rangeExtent.m_z);
+            track.m_frameOffset = trackInfo.m_frameOffset;
+            track.m_numBits = static_cast<AZ::u8>(trackInfo.m_numBits);
+        }
+
+        // Read the frames in a single call.
+        motionData->m_frameData.resize(static_cast<size_t>(info.m_numSamples) * info.m_frameSize);
+        if (!motionData->m_frameData.empty() && stream->Read(motionData->m_frameData.data(), motionData->m_frameData.size()) == 0)
+        {
+            return false;
+        }
+
+        // Read all joints.
+        for (size_t i = 0; i < motionData->GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.m_x, jointInfo.m_staticPos.m_y, jointInfo.m_staticPos.m_z);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.m_x, jointInfo.m_staticScale.m_y, jointInfo.m_staticScale.m_z);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.m_x, jointInfo.m_staticRot.m_y, jointInfo.m_staticRot.m_z, jointInfo.m_staticRot.m_w);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.m_x, jointInfo.m_bindPosePos.m_y, jointInfo.m_bindPosePos.m_z);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.m_x, jointInfo.m_bindPoseScale.m_y, jointInfo.m_bindPoseScale.m_z);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.m_x, jointInfo.m_bindPoseRot.m_y, jointInfo.m_bindPoseRot.m_z, jointInfo.m_bindPoseRot.m_w);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_positionTrack, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_rotationTrack, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_scaleTrack, sourceEndianType);
+
+            // Update the values.
+            motionData->SetJointStaticPosition(i, staticPos);
+            motionData->SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            motionData->SetJointBindPosePosition(i, bindPosePos);
+            motionData->SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                motionData->SetJointStaticScale(i, staticScale);
+                motionData->SetJointBindPoseScale(i, bindPoseScale);
+            )
+
+            for (const AZ::u32 trackIndex : { jointInfo.m_positionTrack, jointInfo.m_rotationTrack, jointInfo.m_scaleTrack })
+            {
+                if (trackIndex != InvalidIndex32 && trackIndex >= info.m_numTracks)
+                {
+                    AZ_Error("EMotionFX", false, "Invalid compressed motion data track index %d, there are only %d tracks.", trackIndex, info.m_numTracks);
+                    return false;
+                }
+            }
+
+            CompressedMotionData::JointData& jointData = motionData->m_jointData[i];
+            jointData.m_positionTrack = jointInfo.m_positionTrack;
+            jointData.m_rotationTrack = jointInfo.m_rotationTrack;
+#ifndef EMFX_SCALE_DISABLED
+            jointData.m_scaleTrack = jointInfo.m_scaleTrack;
+#endif
+
+            // Read the name.
+            const AZStd::string name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            motionData->SetJointName(i, name);
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+                MCore::LogDetailedInfo("    - Position Track = %d", jointData.m_positionTrack);
+                MCore::LogDetailedInfo("    - Rotation Track = %d", jointData.m_rotationTrack);
+                MCore::LogDetailedInfo("    - Scale Track    = %d", jointData.m_scaleTrack);
+            }
+        }
+
+        // Load morphs.
+        AZStd::string name;
+        float staticValue = 0.0f;
+        for (size_t i = 0; i < motionData->GetNumMorphs(); ++i)
+        {
+            if (!ReadCompressedFloat(stream, info.m_numSamples, readSettings, name, staticValue, motionData->m_morphData[i].m_values))
+            {
+                return false;
+            }
+            motionData->SetMorphName(i, name);
+            motionData->SetMorphStaticValue(i, staticValue);
+        }
+
+        // Load floats.
+        for (size_t i = 0; i < motionData->GetNumFloats(); ++i)
+        {
+            if (!ReadCompressedFloat(stream, info.m_numSamples, readSettings, name, staticValue, motionData->m_floatData[i].m_values))
+            {
+                return false;
+            }
+            motionData->SetFloatName(i, name);
+            motionData->SetFloatStaticValue(i, staticValue);
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadCompressedMotionDataVersion1(stream, this, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+} // namespace EMotionFX
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    // Uniformly sampled motion data, where every animated position, rotation and scale track is quantized to 8 or 16 bits per
+    // component within its own value range. Optimize picks the smallest bit rate that keeps each track within the error bounds,
+    // and removes the tracks that stay constant within them. Rotations only store their x, y and z components, w is rebuilt.
+    // The quantized samples of all tracks are interleaved per frame, so sampling a pose only reads two contiguous frames.
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator)
+        AZ_RTTI(CompressedMotionData, "{5C1E8A37-92D4-4B6F-A3E0-7D6B2F48C915}", MotionData)
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const override;
+        void SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        size_t GetNumSamples() const;
+        float GetSampleSpacing() const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+        // Compression stats.
+        size_t GetNumTracks() const;
+        size_t GetNumTrackBits(size_t trackIndex) const;
+        size_t GetFrameSizeInBytes() const;
+
+    private:
+        // A quantized track, its samples are stored at m_frameOffset inside of every frame.
+        struct EMFX_API Track
+        {
+            AZ::Vector3 m_rangeMin = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_rangeExtent = AZ::Vector3::CreateZero();
+            AZ::u32 m_frameOffset = 0;
+            AZ::u8 m_numBits = 16;
+        };
+
+        struct EMFX_API JointData
+        {
+            AZ::u32 m_positionTrack = InvalidIndex32;
+            AZ::u32 m_rotationTrack = InvalidIndex32;
+            AZ::u32 m_scaleTrack = InvalidIndex32;
+        };
+
+        struct EMFX_API FloatData
+        {
+            AZStd::vector<float> m_values;
+        };
+
+        // The uncompressed samples of a joint, empty for the channels that aren't animated.
+        struct EMFX_API JointSamples
+        {
+            AZStd::vector<AZ::Vector3> m_positions;
+            AZStd::vector<AZ::Quaternion> m_rotations;
+            AZStd::vector<AZ::Vector3> m_scales;
+        };
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        void UpdateSampleSpacing();
+        void BuildTracks(const AZStd::vector<JointSamples>& jointSamples, const OptimizeSettings& settings);
+        void DecodeJointSamples(AZStd::vector<JointSamples>& outJointSamples) const;
+        Transform SampleJointTransform(size_t jointDataIndex, size_t indexA, size_t indexB, float t) const;
+
+        AZ::Vector3 DecodeVector3(const Track& track, size_t sampleIndex) const;
+        AZ::Quaternion DecodeRotation(const Track& track, size_t sampleIndex) const;
+
+        friend bool ReadCompressedMotionDataVersion1(MCore::Stream* stream, CompressedMotionData* motionData, const ReadSettings& readSettings);
+        friend bool SaveCompressedJoint(MCore::Stream* stream, const CompressedMotionData* motionData, size_t jointDataIndex, const SaveSettings& saveSettings);
+
+        AZStd::vector<JointData> m_jointData;
+        AZStd::vector<Track> m_tracks;
+        AZStd::vector<AZ::u8> m_frameData; // The quantized samples of all tracks, m_frameSize bytes per sample.
+        AZStd::vector<FloatData> m_morphData;
+        AZStd::vector<FloatData> m_floatData;
+        size_t m_frameSize = 0;
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
@@ -145,6 +145,7 @@ namespace EMotionFX
         m_numUpdated.SetValue(0);
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
+        m_numThrottled.SetValue(0);
 
         for (const ScheduleStep& currentStep : m_steps)
         {
@@ -170,28 +171,8 @@ namespace EMotionFX
                     const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
                     actorInstance->SetThreadIndex(threadIndex);
 
-                    const bool isVisible = actorInstance->GetIsVisible();
-                    if (isVisible)
-                    {
-                        m_numVisible.Increment();
-                    }
-
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-                    {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
-
-                        if (isVisible)
-                        {
-                            m_numSampled.Increment();
-                        }
-                    }
-
                     // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                    UpdateActorInstance(actorInstance, timePassedInSeconds);
                 }, true, jobContext);
 
                 job->SetDependent(&jobCompletion);               
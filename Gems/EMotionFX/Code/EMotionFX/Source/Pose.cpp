@@ -15,9 +15,55 @@
 #include <EMotionFX/Source/Pose.h>
 #include <EMotionFX/Source/PoseDataFactory.h>
 #include <EMotionFX/Source/TransformData.h>
+#include <MCore/Source/AzCoreConversions.h>
 
 namespace EMotionFX
 {
+    namespace
+    {
+        // The blend kernels run straight on the local space transform arrays, the callers resolve the lazily updated local space
+        // transforms of the nodes first, so the loops only contain the inlined transform math instead of a lazy update and an
+        // out of line blend call per node.
+        AZ_FORCE_INLINE void BlendTransform(Transform& transform, const Transform& destTransform, float weight)
+        {
+            transform.m_position = transform.m_position.Lerp(destTransform.m_position, weight);
+            transform.m_rotation = MCore::NLerp(transform.m_rotation, destTransform.m_rotation, weight);
+            EMFX_SCALECODE
+            (
+                transform.m_scale = transform.m_scale.Lerp(destTransform.m_scale, weight);
+            )
+        }
+
+        AZ_FORCE_INLINE void ApplyAdditiveTransform(Transform& transform, const Transform& additiveTransform, float weight)
+        {
+            transform.m_position += additiveTransform.m_position * weight;
+            transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, weight);
+            EMFX_SCALECODE
+            (
+                transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weight);
+            )
+            transform.m_rotation.Normalize();
+        }
+
+        void BlendTransforms(Transform* transforms, const Transform* destTransforms, size_t numNodes, float weight)
+        {
+            for (size_t i = 0; i < numNodes; ++i)
+            {
+                BlendTransform(transforms[i], destTransforms[i], weight);
+            }
+        }
+
+        template<typename IndexType>
+        void BlendTransforms(Transform* transforms, const Transform* destTransforms, const IndexType* nodeIndices, size_t numNodes, float weight)
+        {
+            for (size_t i = 0; i < numNodes; ++i)
+            {
+                const IndexType nodeIndex = nodeIndices[i];
+                BlendTransform(transforms[nodeIndex], destTransforms[nodeIndex], weight);
+            }
+        }
+    } // namespace
+
     // default constructor
     Pose::Pose()
     {
@@ -440,7 +486,7 @@ namespace EMotionFX
     }
 
 
-    void Pose::UpdateAllLocalSpaceTranforms()
+    void Pose::UpdateAllLocalSpaceTranforms() const
     {
         Skeleton* skeleton = m_actor->GetSkeleton();
         const size_t numNodes = skeleton->GetNumNodes();
@@ -831,60 +877,63 @@ namespace EMotionFX
     // blend, without motion instance
     void Pose::Blend(const Pose* destPose, float weight)
     {
-        if (m_actorInstance)
+        MCORE_ASSERT(m_localSpaceTransforms.size() == destPose->m_localSpaceTransforms.size());
+        if (!m_actorInstance || m_actorInstance->GetNumEnabledNodes() == m_localSpaceTransforms.size())
         {
-            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
-            }
-
-            // blend the morph weights
-            const size_t numMorphs = m_morphWeights.size();
-            MCORE_ASSERT(m_actorInstance->GetMorphSetupInstance()->GetNumMorphTargets() == numMorphs);
-            MCORE_ASSERT(numMorphs == destPose->GetNumMorphWeights());
-            for (size_t i = 0; i < numMorphs; ++i)
-            {
-                m_morphWeights[i] = AZ::Lerp(m_morphWeights[i], destPose->m_morphWeights[i], weight);
-            }
-
-            for (const auto& poseDataItem : m_poseDatas)
-            {
-                PoseData* poseData = poseDataItem.second.get();
-                poseData->Blend(destPose, weight);
-            }
+            // All nodes are blended, in which case the order doesn't matter and the kernel runs over the arrays in order
+            UpdateAllLocalSpaceTranforms();
+            destPose->UpdateAllLocalSpaceTranforms();
+            BlendTransforms(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), m_localSpaceTransforms.size(), weight);
         }
         else
         {
-            const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
-            for (size_t i = 0; i < numNodes; ++i)
+            const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+            for (const uint16 nodeNr : enabledNodes)
             {
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
+                UpdateLocalSpaceTransform(nodeNr);
+                destPose->UpdateLocalSpaceTransform(nodeNr);
             }
+            BlendTransforms(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), enabledNodes.data(), enabledNodes.size(), weight);
+        }
 
-            // blend the morph weights
-            const size_t numMorphs = m_morphWeights.size();
-            MCORE_ASSERT(m_actor->GetMorphSetup(0)->GetNumMorphTargets() == numMorphs);
-            MCORE_ASSERT(numMorphs == destPose->GetNumMorphWeights());
-            for (size_t i = 0; i < numMorphs; ++i)
-            {
-                m_morphWeights[i] = AZ::Lerp(m_morphWeights[i], destPose->m_morphWeights[i], weight);
-            }
+        // blend the morph weights
+        const size_t numMorphs = m_morphWeights.size();
+        MCORE_ASSERT(!m_actorInstance || m_actorInstance->GetMorphSetupInstance()->GetNumMorphTargets() == numMorphs);
+        MCORE_ASSERT(numMorphs == destPose->GetNumMorphWeights());
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            m_morphWeights[i] = AZ::Lerp(m_morphWeights[i], destPose->m_morphWeights[i], weight);
+        }
 
-            for (const auto& poseDataItem : m_poseDatas)
-            {
-                PoseData* poseData = poseDataItem.second.get();
-                poseData->Blend(destPose, weight);
-            }
+        for (const auto& poseDataItem : m_poseDatas)
+        {
+            PoseData* poseData = poseDataItem.second.get();
+            poseData->Blend(destPose, weight);
         }
 
         InvalidateAllModelSpaceTransforms();
     }
 
 
+    // blend the transforms of the given nodes only
+    void Pose::BlendMasked(const Pose* destPose, float weight, const AZStd::vector<size_t>& nodeIndices)
+    {
+        MCORE_ASSERT(m_localSpaceTransforms.size() == destPose->m_localSpaceTransforms.size());
+        for (const size_t nodeIndex : nodeIndices)
+        {
+            UpdateLocalSpaceTransform(nodeIndex);
+            destPose->UpdateLocalSpaceTransform(nodeIndex);
+        }
+        BlendTransforms(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), nodeIndices.data(), nodeIndices.size(), weight);
+
+        // Only the blended nodes and their children have to update their model space transforms
+        for (const size_t nodeIndex : nodeIndices)
+        {
+            RecursiveInvalidateModelSpaceTransforms(m_actor, nodeIndex);
+        }
+    }
+
+
     Pose& Pose::MakeRelativeTo(const Pose& other)
     {
         AZ_Assert(m_localSpaceTransforms.size() == other.m_localSpaceTransforms.size(), "Poses must be of the same size");
@@ -940,38 +989,27 @@ namespace EMotionFX
         }
         else
         {
-            AZ_Assert(m_localSpaceTransforms.size() == additivePose.m_localSpaceTransforms.size(), "Poses must be of the same size");
-            if (m_actorInstance)
+            if (!m_actorInstance || m_actorInstance->GetNumEnabledNodes() == m_localSpaceTransforms.size())
             {
-                const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
+                UpdateAllLocalSpaceTranforms();
+                additivePose.UpdateAllLocalSpaceTranforms();
+                const size_t numNodes = m_localSpaceTransforms.size();
                 for (size_t i = 0; i < numNodes; ++i)
                 {
-                    uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                    Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                    const Transform& additiveTransform = additivePose.GetLocalSpaceTransform(nodeNr);
-                    transform.m_position += additiveTransform.m_position * weight;
-                    transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, weight);
-                    EMFX_SCALECODE
-                    (
-                        transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weight);
-                    )
-                    transform.m_rotation.Normalize();
+                    ApplyAdditiveTransform(m_localSpaceTransforms[i], additivePose.m_localSpaceTransforms[i], weight);
                 }
             }
             else
             {
-                const size_t numNodes = m_localSpaceTransforms.size();
-                for (size_t i = 0; i < numNodes; ++i)
+                const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+                for (const uint16 nodeNr : enabledNodes)
+                {
+                    UpdateLocalSpaceTransform(nodeNr);
+                    additivePose.UpdateLocalSpaceTransform(nodeNr);
+                }
+                for (const uint16 nodeNr : enabledNodes)
                 {
-                    Transform& transform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                    const Transform& additiveTransform = additivePose.GetLocalSpaceTransform(i);
-                    transform.m_position += additiveTransform.m_position * weight;
-                    transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, weight);
-                    EMFX_SCALECODE
-                    (
-                        transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weight);
-                    )
-                    transform.m_rotation.Normalize();
+                    ApplyAdditiveTransform(m_localSpaceTransforms[nodeNr], additivePose.m_localSpaceTransforms[nodeNr], weight);
                 }
             }
 
@@ -54,7 +54,7 @@ namespace EMotionFX
         void ApplyMorphWeightsToActorInstance();
         void ZeroMorphWeights();
 
-        void UpdateAllLocalSpaceTranforms();
+        void UpdateAllLocalSpaceTranforms() const;
         void UpdateAllModelSpaceTranforms();
         void ForceUpdateFullLocalSpacePose();
         void ForceUpdateFullModelSpacePose();
@@ -138,6 +138,15 @@ namespace EMotionFX
          */
         void BlendAdditiveUsingBindPose(const Pose* destPose, float weight);
 
+        /**
+         * Blend the transforms of the given nodes only, like a masked blend does.
+         * Only the model space transforms of the blended nodes and their child nodes are invalidated.
+         * @param destPose The destination pose to blend into.
+         * @param weight The weight value to use, which must be in range of [0..1], where 1.0 is the dest pose.
+         * @param nodeIndices The indices of the nodes to blend.
+         */
+        void BlendMasked(const Pose* destPose, float weight, const AZStd::vector<size_t>& nodeIndices);
+
         /**
          * Blend this pose into a specified destination pose.
          * @param destPose The destination pose to blend into.
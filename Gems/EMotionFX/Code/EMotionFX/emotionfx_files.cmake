@@ -15,6 +15,7 @@ set(FILES
     Source/ActorInstanceBus.h
     Source/ActorManager.cpp
     Source/ActorManager.h
+    Source/ActorUpdateScheduler.cpp
     Source/ActorUpdateScheduler.h
     Source/Algorithms.h
     Source/Allocators.cpp
@@ -343,6 +344,8 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedMotionData.cpp
+    Source/MotionData/CompressedMotionData.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
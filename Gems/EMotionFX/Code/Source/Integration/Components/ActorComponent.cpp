@@ -8,6 +8,7 @@
 
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -40,6 +41,9 @@ namespace EMotionFX
 {
     namespace Integration
     {
+        AZ_CVAR(bool, emfx_gpuOnlyDeformation, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Don't run the CPU mesh deformers of actors the renderer skins on the GPU. Mesh based bounds fall back to node based bounds");
+
         //////////////////////////////////////////////////////////////////////////
         class ActorComponentNotificationBehaviorHandler
             : public ActorComponentNotificationBus::Handler, public AZ::BehaviorEBusHandler
@@ -478,6 +482,10 @@ namespace EMotionFX
                 {
                     m_renderActorInstance->SetIsVisible(AZ::RHI::CheckBitsAny(m_configuration.m_renderFlags, ActorRenderFlags::Solid));
                     m_renderActorInstance->SetExcludeFromReflectionCubeMaps(m_configuration.m_excludeFromReflectionCubeMaps);
+
+                    // The render backend skins and morphs the meshes on the GPU
+                    const bool gpuDeformed = m_configuration.m_skinningMethod != SkinningMethod::None;
+                    m_actorInstance->SetCpuMeshDeformersEnabled(!(gpuDeformed && emfx_gpuOnlyDeformation));
                 }
             }
 
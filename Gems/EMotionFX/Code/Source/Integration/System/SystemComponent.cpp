@@ -8,6 +8,7 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
@@ -36,6 +37,7 @@
 #include <EMotionFX/Source/AnimGraphSyncTrack.h>
 #include <EMotionFX/Source/AnimGraph.h>
 #include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/ActorUpdateScheduler.h>
 #include <EMotionFX/Source/ObjectId.h>
 
 #include <EMotionFX/Source/PhysicsSetup.h>
@@ -64,6 +66,10 @@
 
 #include <Integration/MotionExtractionBus.h>
 
+#include <Atom/RPI.Public/View.h>
+#include <Atom/RPI.Public/ViewportContext.h>
+#include <Atom/RPI.Public/ViewportContextBus.h>
+
 
 #if defined(EMOTIONFXANIMATION_EDITOR) // EMFX tools / editor includes
 // Qt
@@ -100,6 +106,22 @@ namespace EMotionFX
 {
     namespace Integration
     {
+        AZ_CVAR(bool, emfx_updateRateThrottling, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Throttle the update rate of the actor instances by their size on screen. The anim graphs, motion extraction and motion events "
+            "of throttled actor instances update every few frames, their poses are interpolated in between");
+        AZ_CVAR(float, emfx_updateRateHalfScreenSize, 0.15f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Actor instances whose bounds cover less of the screen height than this update every 2nd frame");
+        AZ_CVAR(float, emfx_updateRateQuarterScreenSize, 0.05f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Actor instances whose bounds cover less of the screen height than this update every 4th frame");
+        AZ_CVAR(float, emfx_updateRateFrozenScreenSize, 0.01f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Actor instances whose bounds cover less of the screen height than this are frozen");
+        AZ_CVAR(uint32_t, emfx_updateRateServerInterval, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of frames between the updates of the actor instances when there is no viewport, like on a headless server "
+            "that only animates them for their hit volumes. 0 freezes them");
+        AZ_CVAR(bool, emfx_animGraphParallelOutput, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Output the independent subtrees of blend trees in parallel TaskGraph tasks, so a single large anim graph instance "
+            "uses several cores. Subtrees only contain the node types that support it, and it is never done in the editor");
+
         //////////////////////////////////////////////////////////////////////////
         class EMotionFXEventHandler
             : public EMotionFX::EventHandler
@@ -609,6 +631,9 @@ namespace EMotionFX
 
             if (CVars::emfx_updateEnabled)
             {
+                UpdateActorUpdateRates();
+                GetEMotionFX().SetIsAnimGraphParallelOutputEnabled(emfx_animGraphParallelOutput);
+
                 // Main EMotionFX runtime update.
                 GetEMotionFX().Update(delta);
 
@@ -707,6 +732,83 @@ namespace EMotionFX
             }
         }
 
+        void SystemComponent::UpdateActorUpdateRates()
+        {
+            const ActorManager* actorManager = GetEMotionFX().GetActorManager();
+            ActorUpdateScheduler* scheduler = actorManager->GetScheduler();
+            scheduler->SetUpdateRateThrottlingEnabled(emfx_updateRateThrottling);
+            if (!emfx_updateRateThrottling)
+            {
+                return;
+            }
+
+            AZ::RPI::ViewportContextPtr defaultViewportContext;
+            if (auto viewportContextManager = AZ::Interface<AZ::RPI::ViewportContextRequestsInterface>::Get())
+            {
+                defaultViewportContext = viewportContextManager->GetViewportContextByName(viewportContextManager->GetDefaultViewportContextName());
+            }
+
+            // Nobody sees the poses without a viewport, they only need to be right on the frames the actor instances update
+            scheduler->SetUpdateRateInterpolationEnabled(defaultViewportContext != nullptr);
+
+            AZ::Vector3 cameraPosition = AZ::Vector3::CreateZero();
+            float projectionScale = 1.0f;
+            if (defaultViewportContext)
+            {
+                cameraPosition = defaultViewportContext->GetCameraTransform().GetTranslation();
+                if (AZ::RPI::ViewPtr view = defaultViewportContext->GetDefaultView())
+                {
+                    // The cotangent of half the vertical field of view, to get the fraction of the screen height a sphere covers
+                    projectionScale = view->GetViewToClipMatrix().GetElement(1, 1);
+                }
+            }
+
+            const size_t numActorInstances = actorManager->GetNumActorInstances();
+            for (size_t i = 0; i < numActorInstances; ++i)
+            {
+                ActorInstance* actorInstance = actorManager->GetActorInstance(i);
+
+                // The actor instances of the Animation Editor always update at full rate
+                if (!actorInstance->GetIsOwnedByRuntime())
+                {
+                    actorInstance->SetUpdateRateInterval(1);
+                    continue;
+                }
+
+                if (!defaultViewportContext)
+                {
+                    actorInstance->SetUpdateRateInterval(emfx_updateRateServerInterval);
+                    continue;
+                }
+
+                const AZ::Aabb& aabb = actorInstance->GetAabb();
+                if (!aabb.IsValid())
+                {
+                    actorInstance->SetUpdateRateInterval(1);
+                    continue;
+                }
+
+                const float radius = aabb.GetExtents().GetLength() * 0.5f;
+                const float distance = aabb.GetCenter().GetDistance(cameraPosition);
+                const float screenSize = distance > radius ? radius * projectionScale / distance : 1.0f;
+
+                uint32 updateRateInterval = 1;
+                if (screenSize < emfx_updateRateFrozenScreenSize)
+                {
+                    updateRateInterval = 0;
+                }
+                else if (screenSize < emfx_updateRateQuarterScreenSize)
+                {
+                    updateRateInterval = 4;
+                }
+                else if (screenSize < emfx_updateRateHalfScreenSize)
+                {
+                    updateRateInterval = 2;
+                }
+                actorInstance->SetUpdateRateInterval(updateRateInterval);
+            }
+        }
+
         int SystemComponent::GetTickOrder()
         {
             return AZ::TICK_ANIMATION;
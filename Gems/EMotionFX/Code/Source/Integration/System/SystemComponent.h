@@ -143,6 +143,11 @@ namespace EMotionFX
             //! velocity will be applied to it to move it towards the actor instance.
             void ApplyMotionExtraction(const ActorInstance* actorInstance, float timeDelta);
 
+            //! Set the update rate interval of the runtime actor instances by their size on screen in the default viewport,
+            //! when emfx_updateRateThrottling is enabled. Without a viewport, like on a headless server, they all get the
+            //! emfx_updateRateServerInterval.
+            void UpdateActorUpdateRates();
+
             AZStd::vector<AZStd::unique_ptr<AZ::Data::AssetHandler> > m_assetHandlers;
             AZStd::unique_ptr<EMotionFXEventHandler> m_eventHandler;
             AZStd::unique_ptr<RenderBackendManager> m_renderBackendManager;
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "AnimGraphFixture.h"
+#include <EMotionFX/Source/AnimGraph.h>
+#include <EMotionFX/Source/AnimGraphMotionNode.h>
+#include <EMotionFX/Source/BlendTree.h>
+#include <EMotionFX/Source/BlendTreeBlend2Node.h>
+#include <EMotionFX/Source/BlendTreeFinalNode.h>
+#include <EMotionFX/Source/BlendTreeFloatConstantNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionSet.h>
+
+namespace EMotionFX
+{
+    class BlendTreeParallelOutputTests : public AnimGraphFixture
+    {
+    public:
+        void ConstructGraph() override
+        {
+            AnimGraphFixture::ConstructGraph();
+            m_blendTreeAnimGraph = AnimGraphFactory::Create<OneBlendTreeNodeAnimGraph>();
+            m_rootStateMachine = m_blendTreeAnimGraph->GetRootStateMachine();
+            m_blendTree = m_blendTreeAnimGraph->GetBlendTreeNode();
+
+            // Final <- Blend2(Blend2(Motion 0, Motion 1), Blend2(Motion 2, Motion 3)), where all three blend nodes read
+            // their weight from the same float constant node.
+            BlendTreeFloatConstantNode* weightNode = aznew BlendTreeFloatConstantNode();
+            weightNode->SetValue(0.5f);
+            m_blendTree->AddChildNode(weightNode);
+
+            BlendTreeBlend2Node* rootBlendNode = aznew BlendTreeBlend2Node();
+            m_blendTree->AddChildNode(rootBlendNode);
+            rootBlendNode->AddUnitializedConnection(weightNode, BlendTreeFloatConstantNode::PORTID_OUTPUT_RESULT, BlendTreeBlend2Node::PORTID_INPUT_WEIGHT);
+
+            for (uint16 i = 0; i < 2; ++i)
+            {
+                BlendTreeBlend2Node* blendNode = aznew BlendTreeBlend2Node();
+                m_blendTree->AddChildNode(blendNode);
+                rootBlendNode->AddUnitializedConnection(blendNode, BlendTreeBlend2Node::PORTID_OUTPUT_POSE, i);
+                blendNode->AddUnitializedConnection(weightNode, BlendTreeFloatConstantNode::PORTID_OUTPUT_RESULT, BlendTreeBlend2Node::PORTID_INPUT_WEIGHT);
+
+                for (uint16 j = 0; j < 2; ++j)
+                {
+                    AnimGraphMotionNode* motionNode = aznew AnimGraphMotionNode();
+                    m_blendTree->AddChildNode(motionNode);
+                    blendNode->AddUnitializedConnection(motionNode, AnimGraphMotionNode::PORTID_OUTPUT_POSE, j);
+                    m_motionNodes.emplace_back(motionNode);
+                }
+            }
+
+            BlendTreeFinalNode* finalNode = aznew BlendTreeFinalNode();
+            m_blendTree->AddChildNode(finalNode);
+            finalNode->AddUnitializedConnection(rootBlendNode, BlendTreeBlend2Node::PORTID_OUTPUT_POSE, BlendTreeFinalNode::PORTID_INPUT_POSE);
+
+            m_blendTreeAnimGraph->InitAfterLoading();
+        }
+
+        void SetUp() override
+        {
+            AnimGraphFixture::SetUp();
+            m_animGraphInstance->Destroy();
+            m_animGraphInstance = m_blendTreeAnimGraph->GetAnimGraphInstance(m_actorInstance, m_motionSet);
+
+            for (size_t i = 0; i < m_motionNodes.size(); ++i)
+            {
+                const AZStd::string motionId = AZStd::string::format("testSkeletalMotion%zu", i);
+                Motion* motion = aznew Motion(motionId.c_str());
+                motion->SetMotionData(aznew NonUniformMotionData());
+                motion->GetMotionData()->SetDuration(1.0f);
+                MotionSet::MotionEntry* motionEntry = aznew MotionSet::MotionEntry(motion->GetName(), motion->GetName(), motion);
+                m_motionSet->AddMotionEntry(motionEntry);
+
+                m_motionNodes[i]->AddMotionId(motionId.c_str());
+            }
+        }
+
+        void TearDown() override
+        {
+            GetEMotionFX().SetIsAnimGraphParallelOutputEnabled(false);
+            AnimGraphFixture::TearDown();
+        }
+
+        AZStd::vector<AnimGraphMotionNode*> m_motionNodes;
+        BlendTree* m_blendTree = nullptr;
+    };
+
+    TEST_F(BlendTreeParallelOutputTests, SplitsIndependentSubtrees)
+    {
+        // Both inner blend nodes only share the weight constant, which doesn't output a pose.
+        EXPECT_EQ(m_blendTree->GetNumParallelOutputSubtrees(), 2);
+    }
+
+    TEST_F(BlendTreeParallelOutputTests, MatchesSerialOutput)
+    {
+        Evaluate();
+        AZStd::vector<Transform> serialTransforms;
+        const size_t numJoints = m_actorInstance->GetNumNodes();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            serialTransforms.emplace_back(GetOutputTransform(static_cast<uint32>(i)));
+        }
+
+        GetEMotionFX().SetIsAnimGraphParallelOutputEnabled(true);
+        Evaluate();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            const Transform& transform = GetOutputTransform(static_cast<uint32>(i));
+            EXPECT_TRUE(transform.m_position.IsClose(serialTransforms[i].m_position));
+            EXPECT_TRUE(transform.m_rotation.IsClose(serialTransforms[i].m_rotation));
+        }
+
+        // Every pose the subtrees requested got released again.
+        EXPECT_FALSE(m_animGraphInstance->GetIsOutputInParallel());
+        for (AnimGraphMotionNode* motionNode : m_motionNodes)
+        {
+            EXPECT_EQ(motionNode->GetPoseRefCount(m_animGraphInstance), 0);
+        }
+    }
+} // namespace EMotionFX
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Quaternion.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/ActorFixture.h>
+#include <Tests/Matchers.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataTests
+        : public ActorFixture
+        , public UnitTest::TraceBusRedirector
+    {
+    public:
+        void SetUp() override
+        {
+            UnitTest::TraceBusRedirector::BusConnect();
+            ActorFixture::SetUp();
+        }
+
+        void TearDown() override
+        {
+            ActorFixture::TearDown();
+            UnitTest::TraceBusRedirector::BusDisconnect();
+        }
+
+    protected:
+        // Joint 0 moves and rotates over the whole motion, joint 1 only has constant keys.
+        void InitSourceData(NonUniformMotionData& motionData)
+        {
+            motionData.Resize(2, 1, 0);
+            motionData.SetJointName(0, "Moving");
+            motionData.SetJointName(1, "Constant");
+            motionData.SetMorphName(0, "Morph");
+
+            motionData.AllocateJointPositionSamples(0, 11);
+            motionData.AllocateJointRotationSamples(0, 11);
+            motionData.AllocateJointPositionSamples(1, 11);
+            motionData.AllocateMorphSamples(0, 11);
+            for (size_t i = 0; i < 11; ++i)
+            {
+                const float time = static_cast<float>(i) * 0.1f;
+                motionData.SetJointPositionSample(0, i, { time, AZ::Vector3(time * 2.0f, 1.0f, -time) });
+                motionData.SetJointRotationSample(0, i, { time, AZ::Quaternion::CreateRotationZ(time * AZ::Constants::Pi) });
+                motionData.SetJointPositionSample(1, i, { time, AZ::Vector3(0.0f, 3.0f, 0.0f) });
+                motionData.SetMorphSample(0, i, { time, time });
+            }
+            motionData.UpdateDuration();
+        }
+    };
+
+    TEST_F(CompressedMotionDataTests, InitFromNonUniformData)
+    {
+        NonUniformMotionData sourceData;
+        InitSourceData(sourceData);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/false, /*newSampleRate=*/30.0f);
+        EXPECT_EQ(motionData.GetNumJoints(), 2);
+        EXPECT_EQ(motionData.GetNumMorphs(), 1);
+        EXPECT_EQ(motionData.GetNumSamples(), 31);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), 1.0f);
+
+        // The constant track of the second joint doesn't need any samples.
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_FALSE(motionData.IsJointAnimated(1));
+        EXPECT_THAT(motionData.GetJointStaticPosition(1), IsClose(AZ::Vector3(0.0f, 3.0f, 0.0f)));
+        EXPECT_EQ(motionData.GetNumTracks(), 2);
+        EXPECT_EQ(motionData.GetFrameSizeInBytes(), 12);
+
+        for (float time = 0.0f; time <= 1.0f; time += 0.05f)
+        {
+            EXPECT_THAT(motionData.SampleJointPosition(time, 0), IsClose(sourceData.SampleJointPosition(time, 0)));
+            EXPECT_NEAR(motionData.SampleMorph(time, 0), sourceData.SampleMorph(time, 0), 0.001f);
+            const AZ::Quaternion rotation = motionData.SampleJointRotation(time, 0);
+            const AZ::Quaternion expectedRotation = sourceData.SampleJointRotation(time, 0);
+            EXPECT_NEAR(AZStd::abs(rotation.Dot(expectedRotation)), 1.0f, 0.001f);
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, OptimizeStaysWithinErrorBounds)
+    {
+        NonUniformMotionData sourceData;
+        InitSourceData(sourceData);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/false, /*newSampleRate=*/30.0f);
+
+        MotionData::OptimizeSettings settings;
+        settings.m_maxPosError = 0.01f;
+        settings.m_maxRotError = 0.01f;
+        settings.m_maxMorphError = 0.01f;
+        motionData.Optimize(settings);
+
+        // Each track falls back to 16 bits when 8 bits would exceed the error bounds.
+        for (size_t i = 0; i < motionData.GetNumTracks(); ++i)
+        {
+            EXPECT_TRUE(motionData.GetNumTrackBits(i) == 8 || motionData.GetNumTrackBits(i) == 16);
+        }
+        EXPECT_LE(motionData.GetFrameSizeInBytes(), 12);
+
+        for (size_t s = 0; s < motionData.GetNumSamples(); ++s)
+        {
+            const float time = s * motionData.GetSampleSpacing();
+            const AZ::Vector3 position = motionData.SampleJointPosition(time, 0);
+            const AZ::Vector3 expectedPosition = sourceData.SampleJointPosition(time, 0);
+            EXPECT_LE((position - expectedPosition).GetAbs().GetMaxElement(), settings.m_maxPosError + 0.001f);
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, SaveAndRead)
+    {
+        NonUniformMotionData sourceData;
+        InitSourceData(sourceData);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/false, /*newSampleRate=*/30.0f);
+        motionData.Optimize(MotionData::OptimizeSettings());
+
+        MotionData::SaveSettings saveSettings;
+        MCore::MemoryFile file;
+        file.Open();
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        CompressedMotionData loadedData;
+        file.Seek(0);
+        ASSERT_TRUE(loadedData.Read(&file, readSettings));
+        EXPECT_EQ(loadedData.GetNumSamples(), motionData.GetNumSamples());
+        EXPECT_EQ(loadedData.GetNumTracks(), motionData.GetNumTracks());
+        EXPECT_EQ(loadedData.GetJointName(0), "Moving");
+        EXPECT_EQ(loadedData.GetMorphName(0), "Morph");
+        EXPECT_FLOAT_EQ(loadedData.GetDuration(), motionData.GetDuration());
+
+        for (float time = 0.0f; time <= 1.0f; time += 0.1f)
+        {
+            EXPECT_THAT(loadedData.SampleJointPosition(time, 0), IsClose(motionData.SampleJointPosition(time, 0)));
+            EXPECT_THAT(loadedData.SampleJointPosition(time, 1), IsClose(motionData.SampleJointPosition(time, 1)));
+            EXPECT_FLOAT_EQ(loadedData.SampleMorph(time, 0), motionData.SampleMorph(time, 0));
+        }
+    }
+} // namespace EMotionFX
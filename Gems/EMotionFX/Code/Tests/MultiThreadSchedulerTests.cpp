@@ -44,4 +44,32 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    TEST_F(SystemComponentFixture, ThrottledActorInstanceUpdatesOncePerInterval)
+    {
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+        ActorUpdateScheduler* scheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+        scheduler->SetUpdateRateThrottlingEnabled(true);
+        actorInstance->SetUpdateRateInterval(4);
+
+        // Two full intervals update the actor instance twice, whatever frame of the interval it started on.
+        size_t numThrottled = 0;
+        for (int frame = 0; frame < 8; ++frame)
+        {
+            GetEMotionFX().Update(1.0f / 60.0f);
+            numThrottled += scheduler->GetNumThrottledActorInstances();
+        }
+        EXPECT_EQ(numThrottled, 6) << "Expected the actor instance to skip 3 of every 4 frames.";
+
+        actorInstance->SetUpdateRateInterval(0);
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumThrottledActorInstances(), 1) << "Expected a frozen actor instance to skip its updates.";
+
+        scheduler->SetUpdateRateThrottlingEnabled(false);
+        GetEMotionFX().Update(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumThrottledActorInstances(), 0) << "Expected every actor instance to update without throttling.";
+
+        actorInstance->Destroy();
+    }
 } // namespace EMotionFX
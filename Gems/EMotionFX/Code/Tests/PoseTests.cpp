@@ -830,6 +830,45 @@ namespace EMotionFX
         }
     }
 
+    TEST_P(PoseTestsBlendWeightParam, BlendMasked)
+    {
+        const float blendWeight = GetParam();
+        const Pose* sourcePose = m_actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
+
+        Pose destPose;
+        destPose.LinkToActorInstance(m_actorInstance);
+        destPose.InitFromBindPose(m_actor.get());
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const float floatI = static_cast<float>(i);
+            destPose.SetLocalSpaceTransform(i, Transform(AZ::Vector3(floatI, 0.0f, 0.0f),
+                AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 0.0f, 0.0f), floatI)));
+        }
+
+        // Only blend every other node.
+        AZStd::vector<size_t> mask;
+        for (size_t i = 0; i < numNodes; i += 2)
+        {
+            mask.emplace_back(i);
+        }
+
+        Pose blendedPose;
+        blendedPose.LinkToActorInstance(m_actorInstance);
+        blendedPose.InitFromBindPose(m_actor.get());
+        blendedPose.BlendMasked(&destPose, blendWeight, mask);
+
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            Transform expectedResult = sourcePose->GetLocalSpaceTransform(i);
+            if (i % 2 == 0)
+            {
+                expectedResult.Blend(destPose.GetLocalSpaceTransform(i), blendWeight);
+            }
+            EXPECT_THAT(blendedPose.GetLocalSpaceTransform(i), IsClose(expectedResult));
+        }
+    }
+
     TEST_P(PoseTestsBlendWeightParam, BlendAdditiveUsingBindPose)
     {
         const float blendWeight = GetParam();
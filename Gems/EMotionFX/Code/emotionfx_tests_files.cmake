@@ -69,6 +69,7 @@ set(FILES
     Tests/BlendTreeMaskNodeTests.cpp
     Tests/BlendTreeMirrorPoseNodeTests.cpp
     Tests/BlendTreeMotionFrameNodeTests.cpp
+    Tests/BlendTreeParallelOutputTests.cpp
     Tests/BlendTreeRagdollNodeTests.cpp
     Tests/BlendTreeRangeRemapperNodeTests.cpp
     Tests/BlendTreeRotationMath2NodeTests.cpp
@@ -90,6 +91,7 @@ set(FILES
     Tests/MCoreSystemFixture.cpp
     Tests/MorphTargetRuntimeTests.cpp
     Tests/MorphSkinAttachmentTests.cpp
+    Tests/CompressedMotionDataTests.cpp
     Tests/MotionEventCommandTests.cpp
     Tests/MotionEventTrackTests.cpp
     Tests/MotionExtractionTests.cpp
@@ -408,6 +408,97 @@ FN_DECIMAL FastNoise::GetNoise(FN_DECIMAL x, FN_DECIMAL y, FN_DECIMAL z) const
     }
 }
 
+void FastNoise::GetNoiseSet(const FN_DECIMAL* x, const FN_DECIMAL* y, const FN_DECIMAL* z, FN_DECIMAL* noiseSet, int count) const
+{
+    const auto fillSet = [this, x, y, z, noiseSet, count](auto noise)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            noiseSet[i] = noise(x[i] * m_frequency, y[i] * m_frequency, z[i] * m_frequency);
+        }
+    };
+
+    switch (m_noiseType)
+    {
+    case Value:
+        return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleValue(0, xf, yf, zf); });
+    case ValueFractal:
+        switch (m_fractalType)
+        {
+        case FBM:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleValueFractalFBM(xf, yf, zf); });
+        case Billow:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleValueFractalBillow(xf, yf, zf); });
+        case RigidMulti:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleValueFractalRigidMulti(xf, yf, zf); });
+        default:
+            break;
+        }
+        break;
+    case Perlin:
+        return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SinglePerlin(0, xf, yf, zf); });
+    case PerlinFractal:
+        switch (m_fractalType)
+        {
+        case FBM:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SinglePerlinFractalFBM(xf, yf, zf); });
+        case Billow:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SinglePerlinFractalBillow(xf, yf, zf); });
+        case RigidMulti:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SinglePerlinFractalRigidMulti(xf, yf, zf); });
+        default:
+            break;
+        }
+        break;
+    case Simplex:
+        return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleSimplex(0, xf, yf, zf); });
+    case SimplexFractal:
+        switch (m_fractalType)
+        {
+        case FBM:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleSimplexFractalFBM(xf, yf, zf); });
+        case Billow:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleSimplexFractalBillow(xf, yf, zf); });
+        case RigidMulti:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleSimplexFractalRigidMulti(xf, yf, zf); });
+        default:
+            break;
+        }
+        break;
+    case Cellular:
+        switch (m_cellularReturnType)
+        {
+        case CellValue:
+        case NoiseLookup:
+        case Distance:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleCellular(xf, yf, zf); });
+        default:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleCellular2Edge(xf, yf, zf); });
+        }
+    case WhiteNoise:
+        return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return GetWhiteNoise(xf, yf, zf); });
+    case Cubic:
+        return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleCubic(0, xf, yf, zf); });
+    case CubicFractal:
+        switch (m_fractalType)
+        {
+        case FBM:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleCubicFractalFBM(xf, yf, zf); });
+        case Billow:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleCubicFractalBillow(xf, yf, zf); });
+        case RigidMulti:
+            return fillSet([this](FN_DECIMAL xf, FN_DECIMAL yf, FN_DECIMAL zf) { return SingleCubicFractalRigidMulti(xf, yf, zf); });
+        default:
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+
+    std::fill(noiseSet, noiseSet + count, FN_DECIMAL(0));
+}
+
 FN_DECIMAL FastNoise::GetNoise(FN_DECIMAL x, FN_DECIMAL y) const
 {
     x *= m_frequency;
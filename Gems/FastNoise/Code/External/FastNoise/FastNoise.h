@@ -204,6 +204,10 @@ public:
 
 	FN_DECIMAL GetNoise(FN_DECIMAL x, FN_DECIMAL y, FN_DECIMAL z) const;
 
+	// Fills noiseSet with the same values as GetNoise(x[i], y[i], z[i]) for each of the count points
+	// The noise type is only resolved once for the whole set, so the per point loop can be unrolled and vectorized
+	void GetNoiseSet(const FN_DECIMAL* x, const FN_DECIMAL* y, const FN_DECIMAL* z, FN_DECIMAL* noiseSet, int count) const;
+
 	void GradientPerturb(FN_DECIMAL& x, FN_DECIMAL& y, FN_DECIMAL& z) const;
 	void GradientPerturbFractal(FN_DECIMAL& x, FN_DECIMAL& y, FN_DECIMAL& z) const;
 
@@ -347,19 +347,28 @@ namespace FastNoiseGem
             return;
         }
 
+        AZStd::vector<AZ::Vector3> uvws(positions.size());
+        AZStd::vector<bool> wasPointRejected(positions.size());
+        AZStd::vector<float> x(positions.size());
+        AZStd::vector<float> y(positions.size());
+        AZStd::vector<float> z(positions.size());
+
         AZStd::shared_lock lock(m_queryMutex);
-        AZ::Vector3 uvw;
 
+        // Transform and generate the noise for the whole list at once, so the noise type is only resolved once per list.
+        m_gradientTransform.TransformPositionsToUVW(positions, uvws, wasPointRejected);
         for (size_t index = 0; index < positions.size(); index++)
         {
-            bool wasPointRejected = false;
-
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+            x[index] = uvws[index].GetX();
+            y[index] = uvws[index].GetY();
+            z[index] = uvws[index].GetZ();
+        }
+        m_generator.GetNoiseSet(x.data(), y.data(), z.data(), outValues.data(), aznumeric_cast<int>(positions.size()));
 
+        for (size_t index = 0; index < positions.size(); index++)
+        {
             // Generator returns a range between [-1, 1], map that to [0, 1]
-            outValues[index] = wasPointRejected ?
-                0.0f :
-                AZ::GetClamp((m_generator.GetNoise(uvw.GetX(), uvw.GetY(), uvw.GetZ()) + 1.0f) / 2.0f, 0.0f, 1.0f);
+            outValues[index] = wasPointRejected[index] ? 0.0f : AZ::GetClamp((outValues[index] + 1.0f) / 2.0f, 0.0f, 1.0f);
         }
     }
 
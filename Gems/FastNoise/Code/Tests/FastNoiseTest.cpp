@@ -11,6 +11,7 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Script/ScriptContext.h>
 #include <AzFramework/Components/TransformComponent.h>
@@ -109,6 +110,31 @@ TEST_F(FastNoiseTest, FastNoise_VerifyGetValueAndGetValuesMatch)
     noiseEntity->Deactivate();
 }
 
+TEST_F(FastNoiseTest, FastNoise_VerifyGetNoiseSetMatchesGetNoiseForAllNoiseTypes)
+{
+    constexpr int pointCount = 64;
+    AZStd::array<float, pointCount> x, y, z, noiseSet;
+    for (int index = 0; index < pointCount; index++)
+    {
+        x[index] = index * 1.5f;
+        y[index] = index * -0.75f;
+        z[index] = index * 0.25f;
+    }
+
+    for (int noiseType = FastNoise::NoiseType::Value; noiseType <= FastNoise::NoiseType::CubicFractal; noiseType++)
+    {
+        FastNoise generator;
+        generator.SetFrequency(0.05f);
+        generator.SetNoiseType(static_cast<FastNoise::NoiseType>(noiseType));
+        generator.GetNoiseSet(x.data(), y.data(), z.data(), noiseSet.data(), pointCount);
+
+        for (int index = 0; index < pointCount; index++)
+        {
+            EXPECT_EQ(generator.GetNoise(x[index], y[index], z[index]), noiseSet[index]) << "Noise type " << noiseType;
+        }
+    }
+}
+
 // This uses custom test / benchmark hooks so that we can load LmbrCentral and GradientSignal Gems.
 AZ_UNIT_TEST_HOOK(new UnitTest::FastNoiseTestEnvironment, UnitTest::FastNoiseBenchmarkEnvironment);
 
@@ -200,20 +200,27 @@ namespace GradientSignal
         }
 
         // Perform any post-fetch transformations on the gradient values (invert, levels, opacity).
-        for (auto& outValue : outValues)
+        // Each one is a separate pass over the values, so that the settings are checked once per list instead of once per value.
+        if (m_invertInput)
         {
-            if (m_invertInput)
+            for (auto& outValue : outValues)
             {
                 outValue = 1.0f - outValue;
             }
+        }
+
+        // apply levels if set
+        if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
+        {
+            GetLevels(outValues, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+        }
 
-            // apply levels if set
-            if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
+        if (m_opacity != 1.0f)
+        {
+            for (auto& outValue : outValues)
             {
-                outValue = GetLevels(outValue, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+                outValue = outValue * m_opacity;
             }
-
-            outValue = outValue * m_opacity;
         }
     }
 
@@ -11,6 +11,7 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/functional.h>
 
 namespace GradientSignal
@@ -99,6 +100,27 @@ namespace GradientSignal
          */
         void TransformPositionToUVWNormalized(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, bool& wasPointRejected) const;
 
+        /**
+         * Transform a list of world space positions to gradient space UVW lookup values.
+         * This produces the same results as calling TransformPositionToUVW for each position, but selects the wrapping
+         * once per list instead of once per position.
+         * \param inPositions The input world space positions to transform.
+         * \param outUVWs [out] The UVW values for each input position.
+         * \param wasPointRejected [out] Whether or not each input position was rejected, see TransformPositionToUVW.
+         */
+        void TransformPositionsToUVW(
+            AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const;
+
+        /**
+         * Transform a list of world space positions to gradient space UVW lookup values normalized to the shape bounds.
+         * This produces the same results as calling TransformPositionToUVWNormalized for each position.
+         * \param inPositions The input world space positions to transform.
+         * \param outUVWs [out] The normalized UVW values for each input position.
+         * \param wasPointRejected [out] Whether or not each input position was rejected, see TransformPositionToUVW.
+         */
+        void TransformPositionsToUVWNormalized(
+            AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const;
+
         /**
          * Epsilon value to allow our UVW range to go to [min, max) by using the range [min, max - epsilon].
          * To keep things behaving consistently between clamped and unbounded uv ranges, we want our clamped uvs to use a
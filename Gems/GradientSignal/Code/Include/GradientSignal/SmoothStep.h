@@ -64,9 +64,45 @@ namespace GradientSignal
         const float max = m_falloffMidpoint + m_falloffRange / 2.0f;
         const float valueFalloffStrength = AZ::GetClamp(m_falloffStrength, 0.0f, 1.0f);
 
-        for (auto& inOutValue : inOutValues)
+        // GetRatio() has a special case for an empty falloff range, so only the general case is vectorized.
+        const float lowerFalloffRange = (min + valueFalloffStrength) - min;
+        const float upperFalloffRange = max - (max - valueFalloffStrength);
+        size_t vectorizedCount = 0;
+
+        if ((lowerFalloffRange != 0.0f) && (upperFalloffRange != 0.0f))
+        {
+            using AZ::Simd::Vec4;
+
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType lowerFalloffStart = Vec4::Splat(min);
+            const Vec4::FloatType lowerFalloffRanges = Vec4::Splat(lowerFalloffRange);
+            const Vec4::FloatType upperFalloffStart = Vec4::Splat(max - valueFalloffStrength);
+            const Vec4::FloatType upperFalloffRanges = Vec4::Splat(upperFalloffRange);
+
+            // Same as GetSmoothStep(), t * t * (3 - 2t).
+            auto smoothStep = [](Vec4::FloatArgType t)
+            {
+                return Vec4::Mul(Vec4::Mul(t, t), Vec4::Sub(Vec4::Splat(3.0f), Vec4::Mul(Vec4::Splat(2.0f), t)));
+            };
+
+            vectorizedCount = inOutValues.size() & ~size_t(3);
+            for (size_t index = 0; index < vectorizedCount; index += 4)
+            {
+                const Vec4::FloatType values = Vec4::Clamp(Vec4::LoadUnaligned(&inOutValues[index]), zero, one);
+
+                const Vec4::FloatType result1 =
+                    smoothStep(Vec4::Clamp(Vec4::Div(Vec4::Sub(values, lowerFalloffStart), lowerFalloffRanges), zero, one));
+                const Vec4::FloatType result2 =
+                    smoothStep(Vec4::Clamp(Vec4::Div(Vec4::Sub(values, upperFalloffStart), upperFalloffRanges), zero, one));
+
+                Vec4::StoreUnaligned(&inOutValues[index], Vec4::Mul(result1, Vec4::Sub(one, result2)));
+            }
+        }
+
+        for (size_t index = vectorizedCount; index < inOutValues.size(); index++)
         {
-            inOutValue = CalculateSmoothedValue(min, max, valueFalloffStrength, inOutValue);
+            inOutValues[index] = CalculateSmoothedValue(min, max, valueFalloffStrength, inOutValues[index]);
         }
     }
 } // namespace GradientSignal
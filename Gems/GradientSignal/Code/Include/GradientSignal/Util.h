@@ -11,6 +11,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/std/containers/span.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
@@ -81,6 +82,8 @@ namespace GradientSignal
 
     inline void GetLevels(AZStd::span<float> inOutValues, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
     {
+        using AZ::Simd::Vec4;
+
         inputMid = AZ::GetClamp(inputMid, 0.01f, 10.0f); // Clamp the midpoint to a non-zero value so that it's always safe to divide by it.
         inputMin = AZ::GetClamp(inputMin, 0.0f, 1.0f);
         inputMax = AZ::GetClamp(inputMax, 0.0f, 1.0f);
@@ -93,20 +96,53 @@ namespace GradientSignal
             {
                 inOutValue = (AZ::GetClamp(inOutValue, 0.0f, 1.0f) <= inputMin) ? outputMin : outputMax;
             }
+            return;
         }
 
         const float inputMidReciprocal = 1.0f / inputMid;
         const float inputExtentsReciprocal = 1.0f / (inputMax - inputMin);
 
-        for (auto& inOutValue : inOutValues)
+        // pow(x, 1) is x, so the midpoint correction can be skipped entirely for the default midpoint.
+        const bool correctMidpoint = (inputMidReciprocal != 1.0f);
+
+        // Remap four values at a time. There's no SIMD pow, so the midpoint correction is still applied one value at a time.
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType inputMins = Vec4::Splat(inputMin);
+        const Vec4::FloatType inputExtentsReciprocals = Vec4::Splat(inputExtentsReciprocal);
+        const Vec4::FloatType outputMins = Vec4::Splat(outputMin);
+        const Vec4::FloatType outputExtents = Vec4::Splat(outputMax - outputMin);
+
+        const size_t vectorizedCount = inOutValues.size() & ~size_t(3);
+        for (size_t index = 0; index < vectorizedCount; index += 4)
+        {
+            Vec4::FloatType values = Vec4::Clamp(Vec4::LoadUnaligned(&inOutValues[index]), zero, one);
+            values = Vec4::Min(Vec4::Mul(Vec4::Max(Vec4::Sub(values, inputMins), zero), inputExtentsReciprocals), one);
+
+            if (correctMidpoint)
+            {
+                float remapped[4];
+                Vec4::StoreUnaligned(remapped, values);
+                for (float& value : remapped)
+                {
+                    value = powf(value, inputMidReciprocal);
+                }
+                values = Vec4::LoadUnaligned(remapped);
+            }
+
+            Vec4::StoreUnaligned(&inOutValues[index], Vec4::Add(outputMins, Vec4::Mul(outputExtents, values)));
+        }
+
+        for (size_t index = vectorizedCount; index < inOutValues.size(); index++)
         {
+            float& inOutValue = inOutValues[index];
             const float inputRemapped =
                 AZ::GetMin(AZ::GetMax(AZ::GetClamp(inOutValue, 0.0f, 1.0f) - inputMin, 0.0f) * inputExtentsReciprocal, 1.0f);
 
             // Note:  Some paint programs map the midpoint using 1/mid where low values are dark and high values are light,
             // others do the reverse and use mid directly, so low values are light and high values are dark.  We've chosen to
             // align with 1/mid since it appears to be the more prevalent of the two approaches.
-            const float inputCorrected = powf(inputRemapped, inputMidReciprocal);
+            const float inputCorrected = correctMidpoint ? powf(inputRemapped, inputMidReciprocal) : inputRemapped;
 
             inOutValue = AZ::Lerp(outputMin, outputMax, inputCorrected);
         }
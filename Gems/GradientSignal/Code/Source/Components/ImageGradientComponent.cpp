@@ -891,16 +891,16 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
+        AZStd::vector<AZ::Vector3> uvws(positions.size());
+        AZStd::vector<bool> wasPointRejected(positions.size());
+
+        m_gradientTransform.TransformPositionsToUVWNormalized(positions, uvws, wasPointRejected);
 
         for (size_t index = 0; index < positions.size(); index++)
         {
-            m_gradientTransform.TransformPositionToUVWNormalized(positions[index], uvw, wasPointRejected);
-
-            if (!wasPointRejected)
+            if (!wasPointRejected[index])
             {
-                outValues[index] = GetValueFromImageData(samplingType, uvw, 0.0f);
+                outValues[index] = GetValueFromImageData(samplingType, uvws[index], 0.0f);
             }
             else
             {
@@ -195,18 +195,18 @@ namespace GradientSignal
 
         AZStd::shared_lock lock(m_queryMutex);
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
+        AZStd::vector<AZ::Vector3> uvws(positions.size());
+        AZStd::vector<bool> wasPointRejected(positions.size());
         const AZStd::size_t seed = m_configuration.m_randomSeed +
             AZStd::size_t(2); // Add 2 to avoid seeds 0 and 1, which can create strange patterns with this particular algorithm
 
+        m_gradientTransform.TransformPositionsToUVW(positions, uvws, wasPointRejected);
+
         for (size_t index = 0; index < positions.size(); index++)
         {
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
-
-            if (!wasPointRejected)
+            if (!wasPointRejected[index])
             {
-                outValues[index] = GetRandomValue(uvw, seed);
+                outValues[index] = GetRandomValue(uvws[index], seed);
             }
             else
             {
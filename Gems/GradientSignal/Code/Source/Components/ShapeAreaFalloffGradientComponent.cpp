@@ -216,16 +216,26 @@ namespace GradientSignal
             {
                 shapeConnected = true;
 
-                for (size_t index = 0; index < positions.size(); index++)
+                // Query the distances of all the positions at once, so the shape only locks and updates its cached data once.
+                // The squared distances are written to the output values, and then converted in place.
+                if (m_configuration.m_is3dFalloff)
+                {
+                    shapeRequests->DistanceSquaredFromPointBatch(positions, outValues);
+                }
+                else
                 {
-                    AZ::Vector3 queryPoint = positions[index];
-                    if (!m_configuration.m_is3dFalloff)
+                    // Calculate the shape falloff distance in the XY plane only by using the shape center as our Z location.
+                    AZStd::vector<AZ::Vector3> queryPoints(positions.begin(), positions.end());
+                    for (AZ::Vector3& queryPoint : queryPoints)
                     {
-                        // Calculate the shape falloff distance in the XY plane only by using the shape center as our Z location.
                         queryPoint.SetZ(m_cachedShapeCenter.GetZ());
                     }
+                    shapeRequests->DistanceSquaredFromPointBatch(queryPoints, outValues);
+                }
 
-                    float distance = shapeRequests->DistanceFromPoint(queryPoint);
+                for (size_t index = 0; index < positions.size(); index++)
+                {
+                    const float distance = sqrtf(outValues[index]);
 
                     // Since this is outer falloff, distance should give us values from 1.0 at the minimum distance to 0.0 at the maximum
                     // distance. The statement is written specifically to handle the 0 falloff case as well. For 0 falloff, all points
@@ -112,6 +112,73 @@ namespace GradientSignal
         TransformLocalPositionToUVWNormalized(inLocalPosition, outUVW, wasPointRejected);
     }
 
+    void GradientTransform::TransformPositionsToUVW(
+        AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const
+    {
+        AZ_Assert(
+            (inPositions.size() == outUVWs.size()) && (inPositions.size() == wasPointRejected.size()),
+            "input and output lists are different sizes (%zu vs %zu vs %zu).", inPositions.size(), outUVWs.size(),
+            wasPointRejected.size());
+
+        // Transform coordinates into "local" relative space of shape bounds, and set W to 0 if this is a 2D gradient.
+        for (size_t index = 0; index < inPositions.size(); index++)
+        {
+            outUVWs[index] = m_inverseTransform * inPositions[index];
+        }
+
+        // See TransformLocalPositionToUVW() for why the max edges are excluded here.
+        if (m_alwaysAcceptPoint)
+        {
+            AZStd::fill(wasPointRejected.begin(), wasPointRejected.end(), false);
+        }
+        else
+        {
+            for (size_t index = 0; index < outUVWs.size(); index++)
+            {
+                wasPointRejected[index] =
+                    !(outUVWs[index].IsGreaterEqualThan(m_shapeBounds.GetMin()) && outUVWs[index].IsLessThan(m_shapeBounds.GetMax()));
+            }
+        }
+
+        // Pick the wrapping once for the whole list, so that the per-position loop doesn't branch on the wrapping type.
+        auto wrapPositions = [this, outUVWs](auto&& wrapFunction)
+        {
+            for (auto& uvw : outUVWs)
+            {
+                uvw = wrapFunction(uvw, m_shapeBounds) * m_frequencyZoom;
+            }
+        };
+
+        switch (m_wrappingType)
+        {
+        default:
+        case WrappingType::None:
+            wrapPositions(GetUnboundedPointInAabb);
+            break;
+        case WrappingType::ClampToEdge:
+        case WrappingType::ClampToZero:
+            wrapPositions(GetClampedPointInAabb);
+            break;
+        case WrappingType::Mirror:
+            wrapPositions(GetMirroredPointInAabb);
+            break;
+        case WrappingType::Repeat:
+            wrapPositions(GetWrappedPointInAabb);
+            break;
+        }
+    }
+
+    void GradientTransform::TransformPositionsToUVWNormalized(
+        AZStd::span<const AZ::Vector3> inPositions, AZStd::span<AZ::Vector3> outUVWs, AZStd::span<bool> wasPointRejected) const
+    {
+        TransformPositionsToUVW(inPositions, outUVWs, wasPointRejected);
+
+        for (auto& uvw : outUVWs)
+        {
+            uvw = m_normalizeExtentsReciprocal * (uvw - m_shapeBounds.GetMin());
+        }
+    }
+
     WrappingType GradientTransform::GetWrappingType() const
     {
         return m_wrappingType;
@@ -8,6 +8,8 @@
 
 
 #include <GradientSignal/PerlinImprovedNoise.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
 
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
@@ -60,6 +62,42 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        using AZ::Simd::Vec4;
+
+        // Branchless version of Gradient() for four hashes at a time. The 16 cases of the switch above reduce to
+        // ((h & 1) ? -u : u) + ((h & 2) ? -v : v), with u and v picked from x, y and z by the upper bits of the hash.
+        AZ_FORCE_INLINE Vec4::FloatType Gradient(
+            Vec4::Int32ArgType hash, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::Int32Type h = Vec4::And(hash, Vec4::Splat(0xF));
+            const Vec4::FloatType uIsX = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(0x8)));
+            const Vec4::FloatType vIsY = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(0x4)));
+            const Vec4::FloatType vIsX = Vec4::CastToFloat(Vec4::CmpEq(Vec4::Or(h, Vec4::Splat(0x2)), Vec4::Splat(0xE)));
+
+            const Vec4::FloatType u = Vec4::Select(x, y, uIsX);
+            const Vec4::FloatType v = Vec4::Select(y, Vec4::Select(x, z, vIsX), vIsY);
+
+            // Negate by flipping the sign bits of the lanes that have the corresponding hash bit set.
+            const Vec4::Int32Type signBit = Vec4::Splat(AZStd::numeric_limits<int32_t>::min());
+            const Vec4::Int32Type negateU = Vec4::And(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(0x1)), Vec4::Splat(0x1)), signBit);
+            const Vec4::Int32Type negateV = Vec4::And(Vec4::CmpEq(Vec4::And(h, Vec4::Splat(0x2)), Vec4::Splat(0x2)), signBit);
+
+            return Vec4::Add(Vec4::Xor(u, Vec4::CastToFloat(negateU)), Vec4::Xor(v, Vec4::CastToFloat(negateV)));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Fade(Vec4::FloatArgType t)
+        {
+            // 6t^5 - 15t^4 + 10t^3, evaluated as t^3 * (t * (t * 6 - 15) + 10) like the scalar version.
+            const Vec4::FloatType polynomial =
+                Vec4::Madd(t, Vec4::Madd(t, Vec4::Splat(6.0f), Vec4::Splat(-15.0f)), Vec4::Splat(10.0f));
+            return Vec4::Mul(Vec4::Mul(Vec4::Mul(t, t), t), polynomial);
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType x)
+        {
+            return Vec4::Madd(x, Vec4::Sub(b, a), a);
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -92,6 +130,59 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(
+        AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence, float initialFrequency)
+    {
+        using AZ::Simd::Vec4;
+
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        float maxValue = 0.0f;
+        float amplitude = 1.0f;
+        for (int i = 0; i < octaves; ++i)
+        {
+            maxValue += amplitude;
+            amplitude *= persistence;
+        }
+        if (maxValue <= 0.0f)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        const Vec4::FloatType maxValues = Vec4::Splat(maxValue);
+        const size_t vectorizedCount = positions.size() & ~size_t(3);
+        for (size_t index = 0; index < vectorizedCount; index += 4)
+        {
+            const AZ::Vector3* quad = &positions[index];
+            const Vec4::FloatType x = Vec4::LoadImmediate(quad[0].GetX(), quad[1].GetX(), quad[2].GetX(), quad[3].GetX());
+            const Vec4::FloatType y = Vec4::LoadImmediate(quad[0].GetY(), quad[1].GetY(), quad[2].GetY(), quad[3].GetY());
+            const Vec4::FloatType z = Vec4::LoadImmediate(quad[0].GetZ(), quad[1].GetZ(), quad[2].GetZ(), quad[3].GetZ());
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            amplitude = 1.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType frequencies = Vec4::Splat(frequency);
+                const Vec4::FloatType noise =
+                    GenerateNoise(Vec4::Mul(x, frequencies), Vec4::Mul(y, frequencies), Vec4::Mul(z, frequencies));
+                total = Vec4::Madd(noise, Vec4::Splat(amplitude), total);
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            Vec4::StoreUnaligned(&outValues[index], Vec4::Div(total, maxValues));
+        }
+
+        for (size_t index = vectorizedCount; index < positions.size(); index++)
+        {
+            outValues[index] = GenerateOctaveNoise(
+                positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), octaves, persistence, initialFrequency);
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
@@ -138,6 +229,70 @@ namespace GradientSignal
         return (PerlinImprovedNoiseDetails::Lerp(y1, y2, w) + 1.0f) / 2.0f;
     }
 
+    AZ::Simd::Vec4::FloatType PerlinImprovedNoise::GenerateNoise(
+        AZ::Simd::Vec4::FloatArgType x, AZ::Simd::Vec4::FloatArgType y, AZ::Simd::Vec4::FloatArgType z) const
+    {
+        using AZ::Simd::Vec4;
+
+        const Vec4::FloatType fx = Vec4::Floor(x);
+        const Vec4::FloatType fy = Vec4::Floor(y);
+        const Vec4::FloatType fz = Vec4::Floor(z);
+        const Vec4::FloatType xf = Vec4::Sub(x, fx);
+        const Vec4::FloatType yf = Vec4::Sub(y, fy);
+        const Vec4::FloatType zf = Vec4::Sub(z, fz);
+
+        const Vec4::Int32Type byteMask = Vec4::Splat(255);
+        alignas(16) int32_t xi0[4];
+        alignas(16) int32_t yi0[4];
+        alignas(16) int32_t zi0[4];
+        Vec4::StoreAligned(xi0, Vec4::And(Vec4::ConvertToInt(fx), byteMask));
+        Vec4::StoreAligned(yi0, Vec4::And(Vec4::ConvertToInt(fy), byteMask));
+        Vec4::StoreAligned(zi0, Vec4::And(Vec4::ConvertToInt(fz), byteMask));
+
+        // There's no gather, so the permutation table lookups are done per lane. The corner hashes are the same as the
+        // scalar version's, sharing the partial lookups between corners, e.g. p[p[p[xi0] + yi1] + zi0] == p[p[a + 1] + zi0].
+        const AZStd::array<int, 512>& p = m_permutationTable;
+        alignas(16) int32_t aaa[4], aba[4], aab[4], abb[4], baa[4], bba[4], bab[4], bbb[4];
+        for (size_t lane = 0; lane < 4; ++lane)
+        {
+            const int a = p[xi0[lane]] + yi0[lane];
+            const int b = p[xi0[lane] + 1] + yi0[lane];
+            const int aa = p[a] + zi0[lane];
+            const int ab = p[a + 1] + zi0[lane];
+            const int ba = p[b] + zi0[lane];
+            const int bb = p[b + 1] + zi0[lane];
+            aaa[lane] = p[aa];
+            aab[lane] = p[aa + 1];
+            aba[lane] = p[ab];
+            abb[lane] = p[ab + 1];
+            baa[lane] = p[ba];
+            bab[lane] = p[ba + 1];
+            bba[lane] = p[bb];
+            bbb[lane] = p[bb + 1];
+        }
+
+        const Vec4::FloatType u = PerlinImprovedNoiseDetails::Fade(xf);
+        const Vec4::FloatType v = PerlinImprovedNoiseDetails::Fade(yf);
+        const Vec4::FloatType w = PerlinImprovedNoiseDetails::Fade(zf);
+
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+        const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+        const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+
+        using PerlinImprovedNoiseDetails::Gradient;
+        using PerlinImprovedNoiseDetails::Lerp;
+
+        Vec4::FloatType x1 = Lerp(Gradient(Vec4::LoadAligned(aaa), xf, yf, zf), Gradient(Vec4::LoadAligned(baa), xf1, yf, zf), u);
+        Vec4::FloatType x2 = Lerp(Gradient(Vec4::LoadAligned(aba), xf, yf1, zf), Gradient(Vec4::LoadAligned(bba), xf1, yf1, zf), u);
+        const Vec4::FloatType y1 = Lerp(x1, x2, v);
+        x1 = Lerp(Gradient(Vec4::LoadAligned(aab), xf, yf, zf1), Gradient(Vec4::LoadAligned(bab), xf1, yf, zf1), u);
+        x2 = Lerp(Gradient(Vec4::LoadAligned(abb), xf, yf1, zf1), Gradient(Vec4::LoadAligned(bbb), xf1, yf1, zf1), u);
+        const Vec4::FloatType y2 = Lerp(x1, x2, v);
+
+        return Vec4::Mul(Vec4::Add(Lerp(y1, y2, w), one), Vec4::Splat(0.5f));
+    }
+
     void PerlinImprovedNoise::PrepareTable(int seed)
     {
         AZStd::array<int, 256> randtable;
@@ -20,6 +20,10 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <GradientSignal/Components/ConstantGradientComponent.h>
 #include <GradientSignal/Components/GradientSurfaceDataComponent.h>
+#include <GradientSignal/GradientTransform.h>
+#include <GradientSignal/PerlinImprovedNoise.h>
+#include <GradientSignal/SmoothStep.h>
+#include <GradientSignal/Util.h>
 #include <LmbrCentral/Shape/BoxShapeComponentBus.h>
 #include <LmbrCentral/Shape/SphereShapeComponentBus.h>
 #include <SurfaceData/Components/SurfaceDataShapeComponent.h>
@@ -143,6 +147,162 @@ namespace UnitTest
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SmoothStepGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ThresholdGradient);
 
+    // --------------------------------------------------------------------------------------
+    // Gradient Math
+    // These compare the per-value and batch versions of the math shared by the gradients, independent of any EBus overhead.
+    // The first argument selects the version (0 = per value, 1 = batch), the second is the size of each side of the query grid.
+
+    static AZStd::vector<AZ::Vector3> GetBenchmarkQueryPositions(int64_t size)
+    {
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(size * size);
+        for (int64_t y = 0; y < size; y++)
+        {
+            for (int64_t x = 0; x < size; x++)
+            {
+                positions.emplace_back(x * 0.37f, y * 0.37f, 0.0f);
+            }
+        }
+        return positions;
+    }
+
+    static AZStd::vector<float> GetBenchmarkInputValues(int64_t size)
+    {
+        AZStd::vector<float> values(size * size);
+        for (size_t index = 0; index < values.size(); index++)
+        {
+            values[index] = static_cast<float>(index % 1000) / 1000.0f;
+        }
+        return values;
+    }
+
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_PerlinImprovedNoise)(benchmark::State& state)
+    {
+        const bool useBatch = (state.range(0) != 0);
+        const auto positions = GetBenchmarkQueryPositions(state.range(1));
+        AZStd::vector<float> values(positions.size());
+        GradientSignal::PerlinImprovedNoise noise(1);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (useBatch)
+            {
+                noise.GenerateOctaveNoise(positions, values, 4, 1.0f, 0.1f);
+            }
+            else
+            {
+                for (size_t index = 0; index < positions.size(); index++)
+                {
+                    values[index] = noise.GenerateOctaveNoise(
+                        positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), 4, 1.0f, 0.1f);
+                }
+            }
+            benchmark::DoNotOptimize(values.data());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_GradientTransform)(benchmark::State& state)
+    {
+        const bool useBatch = (state.range(0) != 0);
+        const auto positions = GetBenchmarkQueryPositions(state.range(1));
+        AZStd::vector<AZ::Vector3> uvws(positions.size());
+        AZStd::vector<bool> wasPointRejected(positions.size());
+        const GradientSignal::GradientTransform gradientTransform(
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(TestShapeHalfBounds)), AZ::Matrix3x4::CreateIdentity(), false,
+            1.0f, GradientSignal::WrappingType::Mirror);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            if (useBatch)
+            {
+                gradientTransform.TransformPositionsToUVW(positions, uvws, wasPointRejected);
+            }
+            else
+            {
+                for (size_t index = 0; index < positions.size(); index++)
+                {
+                    bool rejected = false;
+                    gradientTransform.TransformPositionToUVW(positions[index], uvws[index], rejected);
+                    wasPointRejected[index] = rejected;
+                }
+            }
+            benchmark::DoNotOptimize(uvws.data());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_Levels)(benchmark::State& state)
+    {
+        const bool useBatch = (state.range(0) != 0);
+        const auto inputValues = GetBenchmarkInputValues(state.range(1));
+        AZStd::vector<float> values(inputValues.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            values = inputValues;
+            if (useBatch)
+            {
+                GradientSignal::GetLevels(values, 0.5f, 0.1f, 0.9f, 0.0f, 1.0f);
+            }
+            else
+            {
+                for (auto& value : values)
+                {
+                    value = GradientSignal::GetLevels(value, 0.5f, 0.1f, 0.9f, 0.0f, 1.0f);
+                }
+            }
+            benchmark::DoNotOptimize(values.data());
+        }
+    }
+
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_SmoothStep)(benchmark::State& state)
+    {
+        const bool useBatch = (state.range(0) != 0);
+        const auto inputValues = GetBenchmarkInputValues(state.range(1));
+        AZStd::vector<float> values(inputValues.size());
+        GradientSignal::SmoothStep smoothStep;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            values = inputValues;
+            if (useBatch)
+            {
+                smoothStep.GetSmoothedValues(values);
+            }
+            else
+            {
+                for (auto& value : values)
+                {
+                    value = smoothStep.GetSmoothedValue(value);
+                }
+            }
+            benchmark::DoNotOptimize(values.data());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(GradientGetValues, BM_PerlinImprovedNoise)
+        ->Args({ 0, 1024 })
+        ->Args({ 1, 1024 })
+        ->ArgNames({ "Batch", "size" })
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(GradientGetValues, BM_GradientTransform)
+        ->Args({ 0, 1024 })
+        ->Args({ 1, 1024 })
+        ->ArgNames({ "Batch", "size" })
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(GradientGetValues, BM_Levels)
+        ->Args({ 0, 1024 })
+        ->Args({ 1, 1024 })
+        ->ArgNames({ "Batch", "size" })
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(GradientGetValues, BM_SmoothStep)
+        ->Args({ 0, 1024 })
+        ->Args({ 1, 1024 })
+        ->ArgNames({ "Batch", "size" })
+        ->Unit(::benchmark::kMillisecond);
+
     // --------------------------------------------------------------------------------------
     // Surface Gradients
 
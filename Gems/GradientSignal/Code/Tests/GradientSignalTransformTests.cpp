@@ -55,6 +55,14 @@ namespace UnitTest
             EXPECT_THAT(outUVW, IsClose(test.m_expectedOutputUVW));
             EXPECT_EQ(wasPointRejected, test.m_expectedOutputRejectionResult);
 
+            // Perform the same query through the batch version and verify that it matches the single query.
+            AZ::Vector3 outBatchUVW[1];
+            bool wasBatchPointRejected[1];
+            gradientTransform3d.TransformPositionsToUVW(
+                AZStd::span<const AZ::Vector3>(&test.m_positionToTest, 1), outBatchUVW, wasBatchPointRejected);
+            EXPECT_THAT(outBatchUVW[0], IsClose(outUVW));
+            EXPECT_EQ(wasBatchPointRejected[0], wasPointRejected);
+
             // Perform the query with a 2D gradient and verify that the results match, but always returns a W value of 0.
             GradientSignal::GradientTransform gradientTransform2d(shapeBounds, transform, false, frequencyZoom, wrappingType);
             gradientTransform2d.TransformPositionToUVW(test.m_positionToTest, outUVW, wasPointRejected);
@@ -18,10 +18,16 @@ AZ_PUSH_DISABLE_WARNING(4251 4996, "-Wunknown-warning-option")
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/Scheme.h>
+#include <aws/core/http/URI.h>
 #include <aws/core/client/ClientConfiguration.h>
 AZ_POP_DISABLE_WARNING
 
 #include <AWSNativeSDKInit/AWSNativeSDKInit.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Metrics/IEventLoggerFactory.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/string/conversions.h>
 #include "HttpRequestManager.h"
 
@@ -29,7 +35,14 @@ namespace HttpRequestor
 {
     const char* Manager::s_loggingName = "GemHttpRequestManager";
 
-    Manager::Manager()
+    namespace
+    {
+        // Round trip time of the last request made by a worker thread, so its callback gets the time of its own request
+        thread_local bool t_isWorkerThread = false;
+        thread_local AZStd::chrono::milliseconds t_lastRoundTripTime{};
+    }
+
+    Manager::Manager(AZ::u32 threadCount)
     {
         AZStd::thread_desc desc;
         desc.m_name = s_loggingName;
@@ -47,19 +60,30 @@ namespace HttpRequestor
         {
             ThreadFunction();
         };
-        m_thread = AZStd::thread(desc, function);
+        threadCount = AZStd::max(threadCount, 1u);
+        m_threads.reserve(threadCount);
+        for (AZ::u32 threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            m_threads.emplace_back(desc, function);
+        }
     }
 
     Manager::~Manager()
     {
         m_runThread = false;
         m_requestConditionVar.notify_all();
-        if (m_thread.joinable())
+        for (AZStd::thread& thread : m_threads)
         {
-            m_thread.join();
+            if (thread.joinable())
+            {
+                thread.join();
+            }
         }
 
-        // Shutdown after background thread has closed.
+        // The clients must be destroyed before the native layer is shut down.
+        m_httpClients.clear();
+
+        // Shutdown after background threads have closed.
         if (m_ownsAwsNativeInitialization)
         {
             AWSNativeSDKInit::InitializationManager::Shutdown();
@@ -72,7 +96,7 @@ namespace HttpRequestor
             AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
             m_requestsToHandle.push(AZStd::move(httpRequestParameters));
         }
-        m_requestConditionVar.notify_all();
+        m_requestConditionVar.notify_one();
     }
 
     void Manager::AddTextRequest(TextParameters&& httpTextRequestParameters)
@@ -81,24 +105,30 @@ namespace HttpRequestor
             AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
             m_textRequestsToHandle.push(AZStd::move(httpTextRequestParameters));
         }
-        m_requestConditionVar.notify_all();
+        m_requestConditionVar.notify_one();
     }
 
     AZStd::chrono::milliseconds Manager::GetLastRoundTripTime() const
     {
+        if (t_isWorkerThread)
+        {
+            return t_lastRoundTripTime;
+        }
         return m_lastRoundTripTime.load(AZStd::memory_order_relaxed);
     }
 
     void Manager::ThreadFunction()
     {
+        t_isWorkerThread = true;
+
         // Run the thread as long as directed
         while (m_runThread)
         {
-            HandleRequestBatch();
+            HandleNextRequest();
         }
     }
 
-    void Manager::HandleRequestBatch()
+    void Manager::HandleNextRequest()
     {
         // Lock mutex and wait for work to be signaled via the condition variable
         AZStd::unique_lock<AZStd::mutex> lock(m_requestMutex);
@@ -109,35 +139,98 @@ namespace HttpRequestor
                 return !m_runThread || !m_requestsToHandle.empty() || !m_textRequestsToHandle.empty();
             });
 
-        // Swap queues
-        AZStd::queue<Parameters> requestsToHandle;
-        requestsToHandle.swap(m_requestsToHandle);
+        // Take a single request, so the other worker threads make the next ones while this one waits for its response
+        if (!m_requestsToHandle.empty())
+        {
+            Parameters requestToHandle = AZStd::move(m_requestsToHandle.front());
+            m_requestsToHandle.pop();
+            lock.unlock();
+
+            HandleRequest(requestToHandle);
+        }
+        else if (!m_textRequestsToHandle.empty())
+        {
+            TextParameters textRequestToHandle = AZStd::move(m_textRequestsToHandle.front());
+            m_textRequestsToHandle.pop();
+            lock.unlock();
 
-        AZStd::queue<TextParameters> textRequestsToHandle;
-        textRequestsToHandle.swap(m_textRequestsToHandle);
+            HandleTextRequest(textRequestToHandle);
+        }
+    }
 
-        // Release lock
-        lock.unlock();
+    std::shared_ptr<Aws::Http::HttpClient> Manager::GetHttpClient(const Aws::String& URI, const Aws::Client::ClientConfiguration& config)
+    {
+        // The clients are thread safe and pool their connections, so requests to the same host with the same settings share a
+        // client, and reuse the connections kept alive by the previous requests.
+        const Aws::Http::URI uri(URI);
+        const AZStd::string clientKey = AZStd::string::format(
+            "%s://%s:%u|%s|%u|%ld|%ld|%u|%d|%s|%s|%s|%u|%s|%s|%s",
+            Aws::Http::SchemeMapper::ToString(uri.GetScheme()),
+            uri.GetAuthority().c_str(),
+            static_cast<unsigned>(uri.GetPort()),
+            config.userAgent.c_str(),
+            static_cast<unsigned>(config.maxConnections),
+            static_cast<long>(config.connectTimeoutMs),
+            static_cast<long>(config.requestTimeoutMs),
+            static_cast<unsigned>(config.lowSpeedLimit),
+            config.verifySSL ? 1 : 0,
+            config.caPath.c_str(),
+            config.caFile.c_str(),
+            config.proxyHost.c_str(),
+            static_cast<unsigned>(config.proxyPort),
+            config.proxyUserName.c_str(),
+            config.proxyPassword.c_str(),
+            Aws::Http::SchemeMapper::ToString(config.proxyScheme));
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_httpClientsMutex);
+        auto clientIt = m_httpClients.find(clientKey);
+        if (clientIt != m_httpClients.end())
+        {
+            return clientIt->second;
+        }
 
-        // Handle requests
-        while (!requestsToHandle.empty())
+        if (m_httpClients.size() >= MaxHttpClients)
         {
-            HandleRequest(requestsToHandle.front());
-            requestsToHandle.pop();
+            // Requests in flight keep their client alive until they complete.
+            m_httpClients.clear();
         }
 
-        while (!textRequestsToHandle.empty())
+        Aws::Client::ClientConfiguration clientConfig = config;
+        clientConfig.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
+        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(clientConfig);
+        m_httpClients.emplace(clientKey, httpClient);
+        return httpClient;
+    }
+
+    void Manager::RecordRoundTripTime(
+        const Aws::String& URI, AZStd::chrono::steady_clock::time_point start, Aws::Http::HttpResponseCode responseCode)
+    {
+        const auto roundTripTime = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - start);
+        t_lastRoundTripTime = roundTripTime;
+        m_lastRoundTripTime.store(roundTripTime, AZStd::memory_order_relaxed);
+
+        if (auto* eventLoggerFactory = AZ::Interface<AZ::Metrics::IEventLoggerFactory>::Get())
         {
-            HandleTextRequest(textRequestsToHandle.front());
-            textRequestsToHandle.pop();
+            if (auto* eventLogger = eventLoggerFactory->FindEventLogger(HttpRequestorMetricsId))
+            {
+                AZStd::fixed_vector<AZ::Metrics::EventField, 2> argsContainer{
+                    { "uri", AZStd::string_view(URI.c_str(), URI.size()) },
+                    { "responseCode", static_cast<AZ::s64>(responseCode) } };
+
+                AZ::Metrics::CompleteArgs completeArgs;
+                completeArgs.m_name = "Request";
+                completeArgs.m_cat = "HttpRequestor";
+                completeArgs.m_dur = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - start);
+                completeArgs.m_args = argsContainer;
+                eventLogger->RecordCompleteEvent(completeArgs);
+            }
         }
     }
 
     void Manager::HandleRequest(const Parameters& httpRequestParameters)
     {
-        Aws::Client::ClientConfiguration config = httpRequestParameters.GetClientConfiguration();
-        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(config);
+        std::shared_ptr<Aws::Http::HttpClient> httpClient =
+            GetHttpClient(httpRequestParameters.GetURI(), httpRequestParameters.GetClientConfiguration());
 
         auto httpRequest = Aws::Http::CreateHttpRequest(
             httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
@@ -157,9 +250,10 @@ namespace HttpRequestor
 
         AZStd::chrono::steady_clock::time_point start = AZStd::chrono::steady_clock::now();
         const auto httpResponse = httpClient->MakeRequest(httpRequest);
-        m_lastRoundTripTime.store(
-            AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - start),
-            AZStd::memory_order_relaxed);
+        RecordRoundTripTime(
+            httpRequestParameters.GetURI(),
+            start,
+            httpResponse ? httpResponse->GetResponseCode() : Aws::Http::HttpResponseCode::REQUEST_NOT_MADE);
 
         if (!httpResponse)
         {
@@ -186,9 +280,8 @@ namespace HttpRequestor
 
     void Manager::HandleTextRequest(const TextParameters& httpRequestParameters)
     {
-        Aws::Client::ClientConfiguration config = httpRequestParameters.GetClientConfiguration();
-        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(config);
+        std::shared_ptr<Aws::Http::HttpClient> httpClient =
+            GetHttpClient(httpRequestParameters.GetURI(), httpRequestParameters.GetClientConfiguration());
 
         auto httpRequest = Aws::Http::CreateHttpRequest(
             httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
@@ -205,9 +298,10 @@ namespace HttpRequestor
 
         AZStd::chrono::steady_clock::time_point start = AZStd::chrono::steady_clock::now();
         const auto httpResponse = httpClient->MakeRequest(httpRequest);
-        m_lastRoundTripTime.store(
-            AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - start),
-            AZStd::memory_order_relaxed);
+        RecordRoundTripTime(
+            httpRequestParameters.GetURI(),
+            start,
+            httpResponse ? httpResponse->GetResponseCode() : Aws::Http::HttpResponseCode::REQUEST_NOT_MADE);
 
         if (!httpResponse)
         {
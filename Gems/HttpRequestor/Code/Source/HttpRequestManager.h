@@ -8,7 +8,10 @@
 
 #pragma once
 
+#include <AzCore/Metrics/IEventLogger.h>
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -18,12 +21,28 @@
 #include <HttpRequestor/HttpRequestParameters.h>
 #include <HttpRequestor/HttpTextRequestParameters.h>
 
+namespace Aws::Http
+{
+    class HttpClient;
+}
+
+// Predefinition for unit test friend class
+class HttpRequestManagerTest;
+
 namespace HttpRequestor
 {
+    //! Id of the event logger the manager records a complete event to for each request, when it's registered.
+    constexpr AZ::Metrics::EventLoggerId HttpRequestorMetricsId{ static_cast<AZ::u32>(AZStd::hash<AZStd::string_view>{}("HttpRequestor")) };
+
     class Manager
     {
+        friend class ::HttpRequestManagerTest;
+
     public:
-        Manager();
+        static constexpr AZ::u32 DefaultThreadCount = 4;
+
+        // Requests are made concurrently by threadCount worker threads, which is at least one.
+        explicit Manager(AZ::u32 threadCount = DefaultThreadCount);
         virtual ~Manager();
 
         // Add these parameters to a queue of request parameters to send off as an HTTP request as soon as they reach the head of the queue
@@ -33,14 +52,22 @@ namespace HttpRequestor
         void AddTextRequest(TextParameters && httpTextRequestParameters);
 
         // The last round trip time taken to make the http request and get a response.
+        // When called from a request callback, it's the round trip time of that request.
         AZStd::chrono::milliseconds GetLastRoundTripTime() const;
 
     private:
         // RequestManager thread loop.
         void ThreadFunction();
 
-        // Called by ThreadFunction. Waits for timeout or until notified and processes any requests queued up.
-        void HandleRequestBatch();
+        // Called by ThreadFunction. Waits until notified and processes the oldest request queued up.
+        void HandleNextRequest();
+
+        // Returns the client making the requests to the host of the URI with this configuration.
+        // Clients are kept for the lifetime of the manager, so the connections they open are kept alive and reused by the next requests.
+        std::shared_ptr<Aws::Http::HttpClient> GetHttpClient(const Aws::String& URI, const Aws::Client::ClientConfiguration& config);
+
+        // Stores the round trip time of a request made by the calling thread, and records it to the metrics event logger when it's registered.
+        void RecordRoundTripTime(const Aws::String& URI, AZStd::chrono::steady_clock::time_point start, Aws::Http::HttpResponseCode responseCode);
 
         // Perform an HTTP request, block until a response is received, then give the returned JSON to the callback to parse. Returns the HTTPResponseCode to the callback to handle any errors.
         void HandleRequest(const Parameters & httpRequestParameters);
@@ -49,12 +76,17 @@ namespace HttpRequestor
         void HandleTextRequest(const TextParameters & httpTextRequestParameters);
 
     private:
+        // Above this many clients, the clients are released as they're likely to be made with configurations that won't be used again
+        static constexpr size_t MaxHttpClients = 64;
+
         AZStd::queue<Parameters>                m_requestsToHandle;                 // Queue of requests that will be made in order of time received
         AZStd::queue<TextParameters>            m_textRequestsToHandle;             // Queue of requests for TEXT blobs that will be made in order of time received
         AZStd::mutex                            m_requestMutex;                     // Member variables for synchronization
         AZStd::condition_variable               m_requestConditionVar;
-        AZStd::atomic<bool>                     m_runThread;                        // Run flag used to signal the worker thread
-        AZStd::thread                           m_thread;                           // This is the thread that will be used for all async operations
+        AZStd::atomic<bool>                     m_runThread;                        // Run flag used to signal the worker threads
+        AZStd::vector<AZStd::thread>            m_threads;                          // These are the threads that will be used for all async operations
+        AZStd::mutex                            m_httpClientsMutex;                 // Guards the clients shared by the worker threads
+        AZStd::unordered_map<AZStd::string, std::shared_ptr<Aws::Http::HttpClient>> m_httpClients; // Clients by host and configuration
         static const char*                      s_loggingName;                      // Name to use for log messages etc...
         bool                                    m_ownsAwsNativeInitialization = false; // Whether or not this module initialized the native layer
         AZStd::atomic<AZStd::chrono::milliseconds> m_lastRoundTripTime; // The last round trip time taken to make the http request and get a response.
@@ -6,13 +6,40 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Metrics/IEventLoggerFactory.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Utils/Utils.h>
 
 #include "HttpRequestorSystemComponent.h"
 
 namespace HttpRequestor
 {
+    AZ_CVAR(
+        AZ::u32,
+        http_requestorThreadCount,
+        Manager::DefaultThreadCount,
+        nullptr,
+        AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of threads making HTTP requests concurrently, applied when the HttpRequestor system component is activated");
+    AZ_CVAR(
+        bool,
+        http_enableMetrics,
+        false,
+        nullptr,
+        AZ::ConsoleFunctorFlags::DontReplicate,
+        "Whether to record the duration and response code of each HTTP request, applied when the HttpRequestor system component is activated");
+    AZ_CVAR(
+        AZ::CVarFixedString,
+        http_metricsFile,
+        "http_requestor_metrics.json",
+        nullptr,
+        AZ::ConsoleFunctorFlags::DontReplicate,
+        "File of the HTTP request metrics if enabled, placed under <ProjectFolder>/user/metrics");
+
     void HttpRequestorSystemComponent::AddRequest(const AZStd::string& URI, Aws::Http::HttpMethod method, const Callback& callback)
     {
         if(m_httpManager != nullptr)
@@ -199,8 +226,23 @@ namespace HttpRequestor
 
     void HttpRequestorSystemComponent::Activate()
     {
-        m_httpManager = AZStd::make_shared<Manager>();
-        
+        if (http_enableMetrics)
+        {
+            if (auto* eventLoggerFactory = AZ::Interface<AZ::Metrics::IEventLoggerFactory>::Get())
+            {
+                const AZ::IO::FixedMaxPath metricsFilepath =
+                    AZ::IO::FixedMaxPath(AZ::Utils::GetProjectPath()) / "user/Metrics" / static_cast<AZ::CVarFixedString>(http_metricsFile);
+                constexpr AZ::IO::OpenMode openMode = AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath;
+
+                auto stream = AZStd::make_unique<AZ::IO::SystemFileStream>(metricsFilepath.c_str(), openMode);
+                AZ::Metrics::JsonTraceEventLoggerConfig config{ "HttpRequestor" };
+                auto eventLogger = AZStd::make_unique<AZ::Metrics::JsonTraceEventLogger>(AZStd::move(stream), config);
+                m_registeredEventLogger = eventLoggerFactory->RegisterEventLogger(HttpRequestorMetricsId, AZStd::move(eventLogger)).IsSuccess();
+            }
+        }
+
+        m_httpManager = AZStd::make_shared<Manager>(http_requestorThreadCount);
+
         HttpRequestorRequestBus::Handler::BusConnect();
     }
 
@@ -209,5 +251,14 @@ namespace HttpRequestor
         HttpRequestorRequestBus::Handler::BusDisconnect();
 
         m_httpManager = nullptr;
+
+        if (m_registeredEventLogger)
+        {
+            if (auto* eventLoggerFactory = AZ::Interface<AZ::Metrics::IEventLoggerFactory>::Get())
+            {
+                eventLoggerFactory->UnregisterEventLogger(HttpRequestorMetricsId);
+            }
+            m_registeredEventLogger = false;
+        }
     }
 }
@@ -110,6 +110,7 @@ namespace HttpRequestor
 
     private:
         ManagerPtr              m_httpManager;
+        bool                    m_registeredEventLogger = false;  // Whether the metrics event logger was registered by this component
     };
 }
 
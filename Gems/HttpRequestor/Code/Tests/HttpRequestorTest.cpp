@@ -10,6 +10,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include "HttpRequestManager.h"
 
@@ -52,4 +53,180 @@ TEST_F(HttpTest, HttpRequesterTest)
     EXPECT_NE(Aws::Http::HttpResponseCode::REQUEST_NOT_MADE, resultCode);
 }
 
+class HttpRequestManagerTest
+    : public UnitTest::LeakDetectionFixture
+{
+public:
+    // Nothing listens on this port, so requests to it fail right away without needing a network connection
+    static constexpr const char* UnreachableHost = "http://127.0.0.1:1";
+
+    static size_t GetThreadCount(const HttpRequestor::Manager& manager)
+    {
+        return manager.m_threads.size();
+    }
+
+    static size_t GetHttpClientCount(HttpRequestor::Manager& manager)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(manager.m_httpClientsMutex);
+        return manager.m_httpClients.size();
+    }
+
+    static std::shared_ptr<Aws::Http::HttpClient> GetHttpClient(
+        HttpRequestor::Manager& manager, const char* uri, const Aws::Client::ClientConfiguration& config)
+    {
+        return manager.GetHttpClient(Aws::String(uri), config);
+    }
+
+    static bool IsRunning(const HttpRequestor::Manager& manager)
+    {
+        return manager.m_runThread;
+    }
+
+    static constexpr size_t MaxHttpClients = HttpRequestor::Manager::MaxHttpClients;
+};
+
+TEST_F(HttpRequestManagerTest, Manager_ThreadCount_StartsAtLeastOneWorker)
+{
+    HttpRequestor::Manager noThreadsManager(0);
+    EXPECT_EQ(GetThreadCount(noThreadsManager), 1u);
+
+    HttpRequestor::Manager manager(3);
+    EXPECT_EQ(GetThreadCount(manager), 3u);
+}
+
+TEST_F(HttpRequestManagerTest, GetHttpClient_SameHostAndConfiguration_ReusesClient)
+{
+    HttpRequestor::Manager manager(1);
+    Aws::Client::ClientConfiguration config;
+
+    const auto client = GetHttpClient(manager, "http://127.0.0.1:1/first", config);
+    ASSERT_TRUE(client);
+
+    // Only the scheme, host and port of the URI select the client
+    EXPECT_EQ(GetHttpClient(manager, "http://127.0.0.1:1/second?query=1", config), client);
+
+    EXPECT_NE(GetHttpClient(manager, "http://127.0.0.1:2/first", config), client);
+    EXPECT_NE(GetHttpClient(manager, "https://127.0.0.1:1/first", config), client);
+
+    Aws::Client::ClientConfiguration otherConfig = config;
+    otherConfig.requestTimeoutMs = config.requestTimeoutMs + 1000;
+    const auto otherConfigClient = GetHttpClient(manager, "http://127.0.0.1:1/first", otherConfig);
+    EXPECT_NE(otherConfigClient, client);
+    EXPECT_EQ(GetHttpClient(manager, "http://127.0.0.1:1/first", otherConfig), otherConfigClient);
+
+    EXPECT_EQ(GetHttpClientCount(manager), 4u);
+}
+
+TEST_F(HttpRequestManagerTest, GetHttpClient_TooManyClients_ReleasesCachedClients)
+{
+    HttpRequestor::Manager manager(1);
+    Aws::Client::ClientConfiguration config;
+
+    const auto firstClient = GetHttpClient(manager, "http://127.0.0.1:1", config);
+    for (size_t port = 2; port <= MaxHttpClients; ++port)
+    {
+        GetHttpClient(manager, AZStd::string::format("http://127.0.0.1:%zu", port).c_str(), config);
+    }
+    EXPECT_EQ(GetHttpClientCount(manager), MaxHttpClients);
+
+    // The next host releases the cached clients, a client still in use stays valid but isn't reused
+    GetHttpClient(manager, AZStd::string::format("http://127.0.0.1:%zu", MaxHttpClients + 1).c_str(), config);
+    EXPECT_EQ(GetHttpClientCount(manager), 1u);
+    EXPECT_EQ(firstClient.use_count(), 1);
+    EXPECT_NE(GetHttpClient(manager, "http://127.0.0.1:1", config), firstClient);
+}
+
+TEST_F(HttpRequestManagerTest, AddTextRequest_SameHostOnEveryWorker_SharesOneClient)
+{
+    constexpr int RequestCount = 8;
+
+    HttpRequestor::Manager manager(4);
+
+    AZStd::mutex requestMutex;
+    AZStd::condition_variable requestConditionVar;
+    int completedCount = 0;
+    int okCount = 0;
+
+    for (int requestIndex = 0; requestIndex < RequestCount; ++requestIndex)
+    {
+        manager.AddTextRequest(HttpRequestor::TextParameters(
+            AZStd::string::format("%s/request%d", UnreachableHost, requestIndex).c_str(),
+            Aws::Http::HttpMethod::HTTP_GET,
+            [&](const AZStd::string&, Aws::Http::HttpResponseCode code)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(requestMutex);
+                ++completedCount;
+                okCount += code == Aws::Http::HttpResponseCode::OK ? 1 : 0;
+                requestConditionVar.notify_all();
+            }));
+    }
+
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(requestMutex);
+        requestConditionVar.wait_for(
+            lock,
+            AZStd::chrono::seconds(30),
+            [&]
+            {
+                return completedCount == RequestCount;
+            });
+        EXPECT_EQ(completedCount, RequestCount);
+        EXPECT_EQ(okCount, 0);
+    }
+
+    EXPECT_EQ(GetHttpClientCount(manager), 1u);
+}
+
+TEST_F(HttpRequestManagerTest, Destructor_WithQueuedRequests_StopsWorkersAfterTheirCurrentRequest)
+{
+    constexpr int RequestCount = 16;
+
+    auto manager = AZStd::make_unique<HttpRequestor::Manager>(1);
+    HttpRequestor::Manager* managerPtr = manager.get();
+
+    AZStd::mutex requestMutex;
+    AZStd::condition_variable requestConditionVar;
+    AZStd::atomic<int> completedCount = 0;
+    bool firstRequestStarted = false;
+
+    for (int requestIndex = 0; requestIndex < RequestCount; ++requestIndex)
+    {
+        manager->AddTextRequest(HttpRequestor::TextParameters(
+            UnreachableHost,
+            Aws::Http::HttpMethod::HTTP_GET,
+            [&, managerPtr](const AZStd::string&, Aws::Http::HttpResponseCode)
+            {
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(requestMutex);
+                    firstRequestStarted = true;
+                }
+                requestConditionVar.notify_all();
+
+                // Keep the worker busy until the manager shuts down, so the other requests are still queued
+                const auto timeout = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(30);
+                while (IsRunning(*managerPtr) && AZStd::chrono::steady_clock::now() < timeout)
+                {
+                    AZStd::this_thread::yield();
+                }
+                ++completedCount;
+            }));
+    }
+
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(requestMutex);
+        requestConditionVar.wait_for(
+            lock,
+            AZStd::chrono::seconds(30),
+            [&]
+            {
+                return firstRequestStarted;
+            });
+        ASSERT_TRUE(firstRequestStarted);
+    }
+
+    // Joins the worker, which drops the queued requests instead of making them
+    manager.reset();
+    EXPECT_EQ(completedCount.load(), 1);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -51,6 +51,10 @@ static LyButtonImGuiNavIndexMap s_lyInputToImGuiNavIndexMap;
 
 AZ_DEFINE_BUDGET(ImGui);
 
+AZ_CVAR(uint32_t, imgui_updateRateHz, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of times per second the ImGui windows are updated. In between updates the output of the last update is rendered again, "
+    "which reduces the cost of heavy debug windows such as the profilers. 0 updates them every frame.");
+
 /**
     An anonymous namespace containing helper functions for interoperating with AzFrameworkInput.
  */
@@ -302,6 +306,7 @@ ImDrawData* ImGui::ImGuiManager::GetImguiDrawData()
             // it sends the activation bus notification
             m_imGuiBroadcastState.m_activationBroadcastStatus = ImGuiStateBroadcast::NotBroadcast;
         } 
+        m_hasRetainedDrawData = false;
         return nullptr;
     }
     else if (auto* console = AZ::Interface<AZ::IConsole>::Get(); console != nullptr)
@@ -311,12 +316,25 @@ ImDrawData* ImGui::ImGuiManager::GetImguiDrawData()
         if (consoleDeactivated != 0)
         {
             ToggleToImGuiVisibleState(DisplayState::Hidden);
+            m_hasRetainedDrawData = false;
             return nullptr;
         }
     }
 
     ImGui::ImGuiContextScope contextScope(m_imguiContext);
 
+    // Render the output of the last update again until the next one is due. The draw data stays valid until the next
+    // NewFrame(), and the inputs received in the meantime are accumulated by ImGui until then.
+    const AZ::TimeUs currentTimeUs = AZ::GetRealElapsedTimeUs();
+    if (imgui_updateRateHz > 0 && m_hasRetainedDrawData)
+    {
+        const AZ::TimeUs updatePeriodUs = AZ::TimeUs{ 1000000 / static_cast<int64_t>(static_cast<uint32_t>(imgui_updateRateHz)) };
+        if (currentTimeUs - m_lastUpdateTimeUs < updatePeriodUs)
+        {
+            return ImGui::GetDrawData();
+        }
+    }
+
     // Update Display Size
     ImGuiIO& io = ImGui::GetIO();
     io.DisplaySize = m_lastRenderResolution;
@@ -393,9 +411,14 @@ ImDrawData* ImGui::ImGuiManager::GetImguiDrawData()
     // Start New Frame
     ImGui::NewFrame();
 
-    // Advance ImGui by Elapsed Frame Time
+    // Advance ImGui by Elapsed Frame Time, or by the time since the last update when they are throttled
     const AZ::TimeUs gameTickTimeUs = AZ::GetSimulationTickDeltaTimeUs();
     io.DeltaTime = AZ::TimeUsToSeconds(gameTickTimeUs);
+    if (imgui_updateRateHz > 0 && m_hasRetainedDrawData)
+    {
+        io.DeltaTime = AZ::TimeUsToSeconds(currentTimeUs - m_lastUpdateTimeUs);
+    }
+    m_lastUpdateTimeUs = currentTimeUs;
     //// END FROM PREUPDATE
 
     AZ::u32 backBufferWidth = m_windowSize.m_width;
@@ -450,6 +473,7 @@ ImDrawData* ImGui::ImGuiManager::GetImguiDrawData()
         // Supply Scale Rects
         drawData->ScaleClipRects(scaleRects);
     }
+    m_hasRetainedDrawData = drawData != nullptr;
 
     if (m_imGuiBroadcastState.m_activationBroadcastStatus == ImGuiStateBroadcast::NotBroadcast)
     {
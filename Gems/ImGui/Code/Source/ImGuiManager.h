@@ -10,6 +10,7 @@
 
 #ifdef IMGUI_ENABLED
 
+#include <AzCore/Time/ITime.h>
 #include <AzFramework/Input/Buses/Requests/InputSystemCursorRequestBus.h>
 #include <AzFramework/Input/Events/InputChannelEventListener.h>
 #include <AzFramework/Input/Events/InputTextEventListener.h>
@@ -111,6 +112,10 @@ namespace ImGui
         bool m_useLastPrimaryTouchPosition = false;
         bool m_simulateBackspaceKeyPressed = false;
 
+        // Time of the last ImGui update, and whether its draw data can be rendered again while the updates are throttled
+        AZ::TimeUs m_lastUpdateTimeUs = AZ::Time::ZeroTimeUs;
+        bool m_hasRetainedDrawData = false;
+
         ImGuiBroadcastState m_imGuiBroadcastState;
 
         AZ::JobCompletion* m_renderJobCompletion = nullptr;
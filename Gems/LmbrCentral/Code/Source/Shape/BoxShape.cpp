@@ -178,6 +178,56 @@ namespace LmbrCentral
         return m_intersectionDataCache.m_obb.GetDistanceSq(point);
     }
 
+    void BoxShape::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, &m_mutex, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                results[index] = aabb.Contains(points[index]);
+            }
+        }
+        else
+        {
+            const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                results[index] = obb.Contains(points[index]);
+            }
+        }
+    }
+
+    void BoxShape::DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, &m_mutex, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                results[index] = aabb.GetDistanceSq(points[index]);
+            }
+        }
+        else
+        {
+            const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                results[index] = obb.GetDistanceSq(points[index]);
+            }
+        }
+    }
+
     bool BoxShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const
     {
         AZStd::shared_lock lock(m_mutex);
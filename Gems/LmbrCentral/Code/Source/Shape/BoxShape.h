@@ -48,6 +48,8 @@ namespace LmbrCentral
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) const override;
         bool IsPointInside(const AZ::Vector3& point) const override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) const override;
+        void IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const override;
+        void DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const override;
         AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution) const override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const override;
         AZ::Vector3 GetTranslationOffset() const override;
@@ -152,6 +152,45 @@ namespace LmbrCentral
         AZStd::shared_lock lock(m_mutex);
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig, &m_mutex);
 
+        return IsPointInsideLocked(point);
+    }
+
+    float CapsuleShape::DistanceSquaredFromPoint(const AZ::Vector3& point) const
+    {
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig, &m_mutex);
+
+        return DistanceSquaredFromPointLocked(point);
+    }
+
+    void CapsuleShape::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig, &m_mutex);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            results[index] = IsPointInsideLocked(points[index]);
+        }
+    }
+
+    void CapsuleShape::DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig, &m_mutex);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            results[index] = DistanceSquaredFromPointLocked(points[index]);
+        }
+    }
+
+    bool CapsuleShape::IsPointInsideLocked(const AZ::Vector3& point) const
+    {
         const float radiusSquared = m_intersectionDataCache.m_radius * m_intersectionDataCache.m_radius;
 
         // Check Bottom sphere
@@ -178,11 +217,8 @@ namespace LmbrCentral
             m_intersectionDataCache.m_internalHeight * m_intersectionDataCache.m_internalHeight, radiusSquared, point);
     }
 
-    float CapsuleShape::DistanceSquaredFromPoint(const AZ::Vector3& point) const
+    float CapsuleShape::DistanceSquaredFromPointLocked(const AZ::Vector3& point) const
     {
-        AZStd::shared_lock lock(m_mutex);
-        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig, &m_mutex);
-
         const Lineseg lineSeg(
             AZVec3ToLYVec3(m_intersectionDataCache.m_basePlaneCenterPoint),
             AZVec3ToLYVec3(m_intersectionDataCache.m_topPlaneCenterPoint));
@@ -9,6 +9,7 @@
 #include "CompoundShapeComponent.h"
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
 
 namespace LmbrCentral
 {
@@ -147,6 +148,46 @@ namespace LmbrCentral
         return smallestDistanceSquared;
     }
 
+    void CompoundShapeComponent::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        AZStd::fill(results.begin(), results.end(), false);
+
+        // Query each child shape once for all the points, a point is inside if it's inside any of the children
+        AZStd::vector<bool> childResults(points.size());
+        for (AZ::EntityId childEntity : m_configuration.GetChildEntities())
+        {
+            AZStd::fill(childResults.begin(), childResults.end(), false);
+            ShapeComponentRequestsBus::Event(
+                childEntity, &ShapeComponentRequestsBus::Events::IsPointInsideBatch, points, AZStd::span<bool>(childResults));
+            for (size_t index = 0; index < results.size(); ++index)
+            {
+                results[index] = results[index] || childResults[index];
+            }
+        }
+    }
+
+    void CompoundShapeComponent::DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        AZStd::fill(results.begin(), results.end(), FLT_MAX);
+
+        // Query each child shape once for all the points and keep the smallest distance of each point
+        AZStd::vector<float> childResults(points.size());
+        for (AZ::EntityId childEntity : m_configuration.GetChildEntities())
+        {
+            AZStd::fill(childResults.begin(), childResults.end(), FLT_MAX);
+            ShapeComponentRequestsBus::Event(
+                childEntity, &ShapeComponentRequestsBus::Events::DistanceSquaredFromPointBatch, points, AZStd::span<float>(childResults));
+            for (size_t index = 0; index < results.size(); ++index)
+            {
+                results[index] = AZ::GetMin(results[index], childResults[index]);
+            }
+        }
+    }
+
     bool CompoundShapeComponent::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const
     {
         bool intersection = false;
@@ -25,6 +25,7 @@ namespace LmbrCentral
     {
     public:
         friend class EditorCompoundShapeComponent;
+        friend class UnitTest::CompoundShapeTest;
 
         AZ_COMPONENT(CompoundShapeComponent, "{C0C817DE-843F-44C8-9FC1-989CDE66B662}");
 
@@ -46,6 +47,8 @@ namespace LmbrCentral
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) const override;
         bool IsPointInside(const AZ::Vector3& point) const override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) const override;
+        void IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const override;
+        void DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const override;
         
         // CompoundShapeComponentRequestsBus::Handler implementation
@@ -242,6 +242,45 @@ namespace LmbrCentral
         AZStd::shared_lock lock(m_mutex);
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig, &m_mutex);
 
+        return IsPointInsideLocked(point);
+    }
+
+    float CylinderShape::DistanceSquaredFromPoint(const AZ::Vector3& point) const
+    {
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig, &m_mutex);
+
+        return DistanceSquaredFromPointLocked(point);
+    }
+
+    void CylinderShape::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig, &m_mutex);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            results[index] = IsPointInsideLocked(points[index]);
+        }
+    }
+
+    void CylinderShape::DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig, &m_mutex);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            results[index] = DistanceSquaredFromPointLocked(points[index]);
+        }
+    }
+
+    bool CylinderShape::IsPointInsideLocked(const AZ::Vector3& point) const
+    {
         return AZ::Intersect::PointCylinder(
             m_intersectionDataCache.m_baseCenterPoint,
             m_intersectionDataCache.m_axisVector,
@@ -250,11 +289,8 @@ namespace LmbrCentral
             point);
     }
 
-    float CylinderShape::DistanceSquaredFromPoint(const AZ::Vector3& point) const
+    float CylinderShape::DistanceSquaredFromPointLocked(const AZ::Vector3& point) const
     {
-        AZStd::shared_lock lock(m_mutex);
-        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig, &m_mutex);
-
         if (m_cylinderShapeConfig.m_height <= 0.0f || m_cylinderShapeConfig.m_radius <= 0.0f)
         {
             AZ::Vector3 diff = m_intersectionDataCache.m_baseCenterPoint - point;
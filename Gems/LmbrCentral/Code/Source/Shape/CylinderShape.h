@@ -46,6 +46,8 @@ namespace LmbrCentral
         AZ::Crc32 GetShapeType() const override { return AZ_CRC_CE("Cylinder"); }
         bool IsPointInside(const AZ::Vector3& point) const override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) const override;
+        void IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const override;
+        void DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const override;
         AZ::Aabb GetEncompassingAabb() const override;
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) const override;
         AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution) const override;
@@ -70,6 +72,10 @@ namespace LmbrCentral
         CylinderShapeConfig& ModifyConfiguration() { return m_cylinderShapeConfig; }
 
     private:
+        //! Point queries shared by the single and batch requests, the mutex must be locked and the intersection data cache up to date
+        bool IsPointInsideLocked(const AZ::Vector3& point) const;
+        float DistanceSquaredFromPointLocked(const AZ::Vector3& point) const;
+
         /// Runtime data - cache potentially expensive operations.
         class CylinderIntersectionDataCache
             : public IntersectionTestDataCache<CylinderShapeConfig>
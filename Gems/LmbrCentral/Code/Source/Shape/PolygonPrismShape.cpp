@@ -408,6 +408,39 @@ namespace LmbrCentral
         return PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, point, m_currentTransform);
     }
 
+    void PolygonPrismShape::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        PolygonPrismSharedLockGuard lock(m_mutex, m_uniqueLockThreadId);
+        m_intersectionDataCache.UpdateIntersectionParams(
+            m_currentTransform, *m_polygonPrism, lock.GetMutexForIntersectionDataCache(), m_currentNonUniformScale);
+
+        const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+        const AZ::Transform localFromWorld = PolygonPrismUtil::GetLocalFromWorldForPointInside(m_currentTransform);
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            // initial early aabb rejection test
+            // note: will implicitly do height test too
+            results[index] = aabb.Contains(points[index]) &&
+                PolygonPrismUtil::IsPointInsideWithLocalFromWorld(*m_polygonPrism, points[index], localFromWorld);
+        }
+    }
+
+    void PolygonPrismShape::DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        PolygonPrismSharedLockGuard lock(m_mutex, m_uniqueLockThreadId);
+        m_intersectionDataCache.UpdateIntersectionParams(
+            m_currentTransform, *m_polygonPrism, lock.GetMutexForIntersectionDataCache(), m_currentNonUniformScale);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            results[index] = PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, points[index], m_currentTransform);
+        }
+    }
+
     bool PolygonPrismShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const
     {
         PolygonPrismSharedLockGuard lock(m_mutex, m_uniqueLockThreadId);
@@ -484,7 +517,22 @@ namespace LmbrCentral
             return aabb;
         }
 
+        AZ::Transform GetLocalFromWorldForPointInside(const AZ::Transform& worldFromLocal)
+        {
+            AZ::Transform worldFromLocalWithUniformScale = worldFromLocal;
+            worldFromLocalWithUniformScale.SetUniformScale(worldFromLocalWithUniformScale.GetUniformScale());
+
+            // it's fine to invert the transform including scale here, because it won't affect whether the point is inside the prism
+            return worldFromLocalWithUniformScale.GetInverse();
+        }
+
         bool IsPointInside(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& worldFromLocal)
+        {
+            return IsPointInsideWithLocalFromWorld(polygonPrism, point, GetLocalFromWorldForPointInside(worldFromLocal));
+        }
+
+        bool IsPointInsideWithLocalFromWorld(
+            const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& localFromWorld)
         {
             using namespace PolygonPrismUtil;
 
@@ -494,13 +542,8 @@ namespace LmbrCentral
             const AZStd::vector<AZ::Vector2>& vertices = polygonPrism.m_vertexContainer.GetVertices();
             const size_t vertexCount = vertices.size();
 
-            AZ::Transform worldFromLocalWithUniformScale = worldFromLocal;
-            worldFromLocalWithUniformScale.SetUniformScale(worldFromLocalWithUniformScale.GetUniformScale());
-
             // transform point to local space
-            // it's fine to invert the transform including scale here, because it won't affect whether the point is inside the prism
-            const AZ::Vector3 localPoint =
-                worldFromLocalWithUniformScale.GetInverse().TransformPoint(point) / polygonPrism.GetNonUniformScale();
+            const AZ::Vector3 localPoint = localFromWorld.TransformPoint(point) / polygonPrism.GetNonUniformScale();
 
             // ensure the point is not above or below the prism (in its local space)
             if (localPoint.GetZ() < 0.0f || localPoint.GetZ() > polygonPrism.GetHeight())
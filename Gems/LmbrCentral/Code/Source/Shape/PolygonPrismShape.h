@@ -63,6 +63,8 @@ namespace LmbrCentral
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) const override;
         bool IsPointInside(const AZ::Vector3& point) const override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) const override;
+        void IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const override;
+        void DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const override;
 
         // PolygonShapeShapeComponentRequestBus::Handler
@@ -208,6 +210,14 @@ namespace LmbrCentral
         /// Return if a point in world space is contained within a polygon prism shape
         bool IsPointInside(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& transform);
 
+        /// Return the transform used by IsPointInside to bring world space points into the local space of the polygon prism
+        AZ::Transform GetLocalFromWorldForPointInside(const AZ::Transform& transform);
+
+        /// Return if a point in world space is contained within a polygon prism shape, given the transform returned by
+        /// GetLocalFromWorldForPointInside, so testing many points only inverts the transform once
+        bool IsPointInsideWithLocalFromWorld(
+            const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& localFromWorld);
+
         /// Return distance squared from point in world space from polygon prism shape
         float DistanceSquaredFromPoint(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& transform);
 
@@ -10,6 +10,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 
 namespace LmbrCentral
 {
@@ -274,6 +275,28 @@ namespace LmbrCentral
         return result;
     }
 
+    void ReferenceShapeComponent::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const
+    {
+        AZStd::fill(results.begin(), results.end(), false);
+
+        AZStd::shared_lock lock(m_mutex);
+        if (AllowRequest())
+        {
+            LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInsideBatch, points, results);
+        }
+    }
+
+    void ReferenceShapeComponent::DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const
+    {
+        AZStd::fill(results.begin(), results.end(), FLT_MAX);
+
+        AZStd::shared_lock lock(m_mutex);
+        if (AllowRequest())
+        {
+            LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceSquaredFromPointBatch, points, results);
+        }
+    }
+
     AZ::Vector3 ReferenceShapeComponent::GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution) const
     {
         AZ::Vector3 result = AZ::Vector3::CreateZero();
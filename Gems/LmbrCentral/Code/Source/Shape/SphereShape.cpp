@@ -116,8 +116,7 @@ namespace LmbrCentral
         AZStd::shared_lock lock(m_mutex);
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig, &m_mutex);
 
-        return AZ::Intersect::PointSphere(
-            m_intersectionDataCache.m_position, m_intersectionDataCache.m_radius * m_intersectionDataCache.m_radius, point);
+        return IsPointInsideLocked(point);
     }
 
     float SphereShape::DistanceSquaredFromPoint(const AZ::Vector3& point) const
@@ -125,6 +124,43 @@ namespace LmbrCentral
         AZStd::shared_lock lock(m_mutex);
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig, &m_mutex);
 
+        return DistanceSquaredFromPointLocked(point);
+    }
+
+    void SphereShape::IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig, &m_mutex);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            results[index] = IsPointInsideLocked(points[index]);
+        }
+    }
+
+    void SphereShape::DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig, &m_mutex);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            results[index] = DistanceSquaredFromPointLocked(points[index]);
+        }
+    }
+
+    bool SphereShape::IsPointInsideLocked(const AZ::Vector3& point) const
+    {
+        return AZ::Intersect::PointSphere(
+            m_intersectionDataCache.m_position, m_intersectionDataCache.m_radius * m_intersectionDataCache.m_radius, point);
+    }
+
+    float SphereShape::DistanceSquaredFromPointLocked(const AZ::Vector3& point) const
+    {
         const AZ::Vector3 pointToSphereCenter = m_intersectionDataCache.m_position - point;
         const float distance = pointToSphereCenter.GetLength() - m_intersectionDataCache.m_radius;
         const float clampedDistance = AZStd::max(distance, 0.0f);
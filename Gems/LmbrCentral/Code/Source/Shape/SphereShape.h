@@ -44,6 +44,8 @@ namespace LmbrCentral
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) const override;
         bool IsPointInside(const AZ::Vector3& point) const  override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) const override;
+        void IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const override;
+        void DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const override;
         AZ::Vector3 GetTranslationOffset() const override;
         void SetTranslationOffset(const AZ::Vector3& translationOffset) override;
@@ -65,6 +67,10 @@ namespace LmbrCentral
         ShapeComponentConfig& ModifyShapeComponent() { return m_sphereShapeConfig; }
 
     private:
+        //! Point queries shared by the single and batch requests, the mutex must be locked and the intersection data cache up to date
+        bool IsPointInsideLocked(const AZ::Vector3& point) const;
+        float DistanceSquaredFromPointLocked(const AZ::Vector3& point) const;
+
         /// Runtime data - cache potentially expensive operations.
         class SphereIntersectionDataCache
             : public IntersectionTestDataCache<SphereShapeConfig>
@@ -354,4 +354,22 @@ namespace UnitTest
 
         EXPECT_TRUE(isTypeAxisAligned);
     }
+
+    class AxisAlignedBoxShapeBatchQueryTest
+        : public AxisAlignedBoxShapeTest
+        , public testing::WithParamInterface<ShapeBatchQueryParams>
+    {
+    };
+
+    TEST_P(AxisAlignedBoxShapeBatchQueryTest, BatchQueriesMatchSinglePointQueries)
+    {
+        const ShapeBatchQueryParams& params = GetParam();
+
+        AZ::Entity entity;
+        CreateAxisAlignedBox(params.m_transform, AZ::Vector3(1.5f, 3.5f, 5.5f), entity);
+
+        ExpectBatchQueriesMatchSinglePointQueries(entity);
+    }
+
+    INSTANTIATE_TEST_CASE_P(UniformScale, AxisAlignedBoxShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryUniformScaleParams()));
 } // namespace UnitTest
@@ -989,4 +989,24 @@ namespace UnitTest
 
         EXPECT_FALSE(isTypeAxisAligned);
     }
+
+    class BoxShapeBatchQueryTest
+        : public BoxShapeTest
+        , public testing::WithParamInterface<ShapeBatchQueryParams>
+    {
+    };
+
+    TEST_P(BoxShapeBatchQueryTest, BatchQueriesMatchSinglePointQueries)
+    {
+        const ShapeBatchQueryParams& params = GetParam();
+
+        AZ::Entity entity;
+        CreateBoxWithNonUniformScale(
+            entity, params.m_transform, params.m_nonUniformScale, AZ::Vector3(1.5f, 3.5f, 5.5f), AZ::Vector3(0.5f, -1.0f, 2.0f));
+
+        ExpectBatchQueriesMatchSinglePointQueries(entity);
+    }
+
+    INSTANTIATE_TEST_CASE_P(UniformScale, BoxShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryUniformScaleParams()));
+    INSTANTIATE_TEST_CASE_P(NonUniformScale, BoxShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryNonUniformScaleParams()));
 }
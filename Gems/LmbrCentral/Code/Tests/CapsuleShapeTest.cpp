@@ -567,4 +567,22 @@ namespace UnitTest
         EXPECT_THAT(debugDrawAabb.GetMin(), IsCloseTolerance(AZ::Vector3(0.7f, 1.5f, 0.4f), 0.1f));
         EXPECT_THAT(debugDrawAabb.GetMax(), IsCloseTolerance(AZ::Vector3(4.9f, 6.0f, 5.4f), 0.1f));
     }
+
+    class CapsuleShapeBatchQueryTest
+        : public CapsuleShapeTest
+        , public testing::WithParamInterface<ShapeBatchQueryParams>
+    {
+    };
+
+    TEST_P(CapsuleShapeBatchQueryTest, BatchQueriesMatchSinglePointQueries)
+    {
+        const ShapeBatchQueryParams& params = GetParam();
+
+        AZ::Entity entity;
+        CreateCapsule(entity, params.m_transform, 1.5f, 6.0f, AZ::Vector3(-1.0f, 0.5f, 2.0f));
+
+        ExpectBatchQueriesMatchSinglePointQueries(entity);
+    }
+
+    INSTANTIATE_TEST_CASE_P(UniformScale, CapsuleShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryUniformScaleParams()));
 }
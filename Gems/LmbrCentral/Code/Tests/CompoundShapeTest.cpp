@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/NonUniformScaleComponent.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <LmbrCentral/Shape/BoxShapeComponentBus.h>
+#include <LmbrCentral/Shape/SphereShapeComponentBus.h>
+#include <Shape/BoxShapeComponent.h>
+#include <Shape/CompoundShapeComponent.h>
+#include <Shape/SphereShapeComponent.h>
+#include <ShapeTestUtils.h>
+
+namespace UnitTest
+{
+    class CompoundShapeTest
+        : public LeakDetectionFixture
+    {
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_transformComponentDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_nonUniformScaleComponentDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_boxShapeComponentDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_sphereShapeComponentDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_compoundShapeComponentDescriptor;
+
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+
+            m_transformComponentDescriptor.reset(AzFramework::TransformComponent::CreateDescriptor());
+            m_transformComponentDescriptor->Reflect(&(*m_serializeContext));
+            m_nonUniformScaleComponentDescriptor.reset(AzFramework::NonUniformScaleComponent::CreateDescriptor());
+            m_nonUniformScaleComponentDescriptor->Reflect(&(*m_serializeContext));
+            m_boxShapeComponentDescriptor.reset(LmbrCentral::BoxShapeComponent::CreateDescriptor());
+            m_boxShapeComponentDescriptor->Reflect(&(*m_serializeContext));
+            m_sphereShapeComponentDescriptor.reset(LmbrCentral::SphereShapeComponent::CreateDescriptor());
+            m_sphereShapeComponentDescriptor->Reflect(&(*m_serializeContext));
+            m_compoundShapeComponentDescriptor.reset(LmbrCentral::CompoundShapeComponent::CreateDescriptor());
+            m_compoundShapeComponentDescriptor->Reflect(&(*m_serializeContext));
+        }
+
+        void TearDown() override
+        {
+            m_transformComponentDescriptor.reset();
+            m_nonUniformScaleComponentDescriptor.reset();
+            m_boxShapeComponentDescriptor.reset();
+            m_sphereShapeComponentDescriptor.reset();
+            m_compoundShapeComponentDescriptor.reset();
+            m_serializeContext.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        void CreateCompoundShape(const AZStd::list<AZ::EntityId>& childEntities, AZ::Entity& entity)
+        {
+            entity.CreateComponent<AzFramework::TransformComponent>();
+            auto* compoundShapeComponent = entity.CreateComponent<LmbrCentral::CompoundShapeComponent>();
+            compoundShapeComponent->m_configuration.m_childEntities = childEntities;
+
+            entity.Init();
+            entity.Activate();
+        }
+    };
+
+    class CompoundShapeBatchQueryTest
+        : public CompoundShapeTest
+        , public testing::WithParamInterface<ShapeBatchQueryParams>
+    {
+    };
+
+    TEST_P(CompoundShapeBatchQueryTest, BatchQueriesMatchSinglePointQueries)
+    {
+        const ShapeBatchQueryParams& params = GetParam();
+
+        AZ::Entity boxEntity;
+        boxEntity.CreateComponent<AzFramework::TransformComponent>();
+        boxEntity.CreateComponent<AzFramework::NonUniformScaleComponent>();
+        boxEntity.CreateComponent<LmbrCentral::BoxShapeComponent>();
+        boxEntity.Init();
+        boxEntity.Activate();
+        AZ::TransformBus::Event(boxEntity.GetId(), &AZ::TransformBus::Events::SetWorldTM, params.m_transform);
+        AZ::NonUniformScaleRequestBus::Event(boxEntity.GetId(), &AZ::NonUniformScaleRequests::SetScale, params.m_nonUniformScale);
+        LmbrCentral::BoxShapeComponentRequestsBus::Event(
+            boxEntity.GetId(), &LmbrCentral::BoxShapeComponentRequestsBus::Events::SetBoxDimensions, AZ::Vector3(1.5f, 3.5f, 5.5f));
+
+        // the sphere overlaps one end of the box, so some points are inside both children
+        AZ::Entity sphereEntity;
+        sphereEntity.CreateComponent<AzFramework::TransformComponent>();
+        sphereEntity.CreateComponent<LmbrCentral::SphereShapeComponent>();
+        sphereEntity.Init();
+        sphereEntity.Activate();
+        AZ::TransformBus::Event(
+            sphereEntity.GetId(), &AZ::TransformBus::Events::SetWorldTM,
+            params.m_transform * AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, 3.0f)));
+        LmbrCentral::SphereShapeComponentRequestsBus::Event(
+            sphereEntity.GetId(), &LmbrCentral::SphereShapeComponentRequests::SetRadius, 2.0f);
+
+        AZ::Entity entity;
+        CreateCompoundShape({ boxEntity.GetId(), sphereEntity.GetId() }, entity);
+
+        ExpectBatchQueriesMatchSinglePointQueries(entity);
+    }
+
+    INSTANTIATE_TEST_CASE_P(UniformScale, CompoundShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryUniformScaleParams()));
+    INSTANTIATE_TEST_CASE_P(NonUniformScale, CompoundShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryNonUniformScaleParams()));
+} // namespace UnitTest
@@ -14,6 +14,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <Shape/CylinderShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <ShapeTestUtils.h>
 #include <ShapeThreadsafeTest.h>
 
 namespace UnitTest
@@ -571,4 +572,22 @@ namespace UnitTest
         const int numIterations = 30000;
         ShapeThreadsafeTest::TestShapeGetSetCallsAreThreadsafe(entity, numIterations, setDimensionFn);
     }
+
+    class CylinderShapeBatchQueryTest
+        : public CylinderShapeTest
+        , public testing::WithParamInterface<ShapeBatchQueryParams>
+    {
+    };
+
+    TEST_P(CylinderShapeBatchQueryTest, BatchQueriesMatchSinglePointQueries)
+    {
+        const ShapeBatchQueryParams& params = GetParam();
+
+        AZ::Entity entity;
+        CreateCylinder(params.m_transform, 1.5f, 4.0f, entity);
+
+        ExpectBatchQueriesMatchSinglePointQueries(entity);
+    }
+
+    INSTANTIATE_TEST_CASE_P(UniformScale, CylinderShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryUniformScaleParams()));
 } // namespace UnitTest
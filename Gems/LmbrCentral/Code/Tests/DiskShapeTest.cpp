@@ -13,6 +13,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <LmbrCentral/Shape/DiskShapeComponentBus.h>
 #include <Shape/DiskShapeComponent.h>
+#include <ShapeTestUtils.h>
 #include <ShapeThreadsafeTest.h>
 
 namespace
@@ -445,4 +446,22 @@ namespace UnitTest
         const int numIterations = 30000;
         ShapeThreadsafeTest::TestShapeGetSetCallsAreThreadsafe(entity, numIterations, setDimensionFn);
     }
+
+    class DiskShapeBatchQueryTest
+        : public DiskShapeTest
+        , public testing::WithParamInterface<ShapeBatchQueryParams>
+    {
+    };
+
+    TEST_P(DiskShapeBatchQueryTest, BatchQueriesMatchSinglePointQueries)
+    {
+        const ShapeBatchQueryParams& params = GetParam();
+
+        AZ::Entity entity;
+        CreateDisk(params.m_transform, 2.5f, entity);
+
+        ExpectBatchQueriesMatchSinglePointQueries(entity);
+    }
+
+    INSTANTIATE_TEST_CASE_P(UniformScale, DiskShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryUniformScaleParams()));
 } // namespace UnitTest
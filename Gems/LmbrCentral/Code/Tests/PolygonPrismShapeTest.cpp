@@ -16,6 +16,7 @@
 #include <Shape/PolygonPrismShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
+#include <ShapeTestUtils.h>
 #include <ShapeThreadsafeTest.h>
 
 namespace UnitTest
@@ -947,4 +948,29 @@ namespace UnitTest
         polygonPrism->SetHeight(ShapeHeight + 1.0f);
         EXPECT_EQ(numCalls, 0);
     }
+
+    class PolygonPrismShapeBatchQueryTest
+        : public PolygonPrismShapeTest
+        , public testing::WithParamInterface<ShapeBatchQueryParams>
+    {
+    };
+
+    TEST_P(PolygonPrismShapeBatchQueryTest, BatchQueriesMatchSinglePointQueries)
+    {
+        const ShapeBatchQueryParams& params = GetParam();
+
+        // concave polygon, so the batch point inside test is checked against both sides of the re-entrant corner
+        AZ::Entity entity;
+        CreatePolygonPrismWithNonUniformScale(
+            params.m_transform, 3.0f,
+            AZStd::vector<AZ::Vector2>(
+                { AZ::Vector2(0.0f, 0.0f), AZ::Vector2(4.0f, 0.0f), AZ::Vector2(4.0f, 1.5f), AZ::Vector2(1.5f, 1.5f),
+                  AZ::Vector2(1.5f, 5.0f), AZ::Vector2(0.0f, 5.0f) }),
+            params.m_nonUniformScale, entity);
+
+        ExpectBatchQueriesMatchSinglePointQueries(entity);
+    }
+
+    INSTANTIATE_TEST_CASE_P(UniformScale, PolygonPrismShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryUniformScaleParams()));
+    INSTANTIATE_TEST_CASE_P(NonUniformScale, PolygonPrismShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryNonUniformScaleParams()));
 } // namespace UnitTest
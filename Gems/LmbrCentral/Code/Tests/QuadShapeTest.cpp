@@ -16,6 +16,7 @@
 #include <Shape/QuadShapeComponent.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 #include <AzFramework/UnitTest/TestDebugDisplayRequests.h>
+#include <ShapeTestUtils.h>
 #include <ShapeThreadsafeTest.h>
 
 namespace
@@ -594,4 +595,23 @@ namespace UnitTest
         const int numIterations = 30000;
         ShapeThreadsafeTest::TestShapeGetSetCallsAreThreadsafe(entity, numIterations, setDimensionFn);
     }
+
+    class QuadShapeBatchQueryTest
+        : public QuadShapeTest
+        , public testing::WithParamInterface<ShapeBatchQueryParams>
+    {
+    };
+
+    TEST_P(QuadShapeBatchQueryTest, BatchQueriesMatchSinglePointQueries)
+    {
+        const ShapeBatchQueryParams& params = GetParam();
+
+        AZ::Entity entity;
+        CreateQuadWithNonUniformScale(params.m_transform, params.m_nonUniformScale, 3.0f, 5.0f, entity);
+
+        ExpectBatchQueriesMatchSinglePointQueries(entity);
+    }
+
+    INSTANTIATE_TEST_CASE_P(UniformScale, QuadShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryUniformScaleParams()));
+    INSTANTIATE_TEST_CASE_P(NonUniformScale, QuadShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryNonUniformScaleParams()));
 } // namespace UnitTest
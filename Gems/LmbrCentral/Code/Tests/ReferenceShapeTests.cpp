@@ -16,6 +16,7 @@
 #include <Shape/BoxShapeComponent.h>
 #include <Shape/ReferenceShapeComponent.h>
 #include <Shape/SphereShapeComponent.h>
+#include <ShapeTestUtils.h>
 #include <ShapeThreadsafeTest.h>
 
 namespace UnitTest
@@ -269,4 +270,36 @@ namespace UnitTest
         const int numIterations = 30000;
         ShapeThreadsafeTest::TestShapeGetSetCallsAreThreadsafe(*entity, numIterations, setDimensionFn);
     }
+
+    class ReferenceShapeBatchQueryTest
+        : public ReferenceComponentTests
+        , public testing::WithParamInterface<ShapeBatchQueryParams>
+    {
+    };
+
+    TEST_P(ReferenceShapeBatchQueryTest, BatchQueriesMatchSinglePointQueries)
+    {
+        const ShapeBatchQueryParams& params = GetParam();
+
+        m_app.RegisterComponentDescriptor(LmbrCentral::BoxShapeComponent::CreateDescriptor());
+        m_app.RegisterComponentDescriptor(AzFramework::TransformComponent::CreateDescriptor());
+
+        AZ::Entity boxEntity;
+        boxEntity.CreateComponent<LmbrCentral::BoxShapeComponent>();
+        boxEntity.CreateComponent<AzFramework::TransformComponent>();
+        boxEntity.Init();
+        boxEntity.Activate();
+        AZ::TransformBus::Event(boxEntity.GetId(), &AZ::TransformBus::Events::SetWorldTM, params.m_transform);
+        LmbrCentral::BoxShapeComponentRequestsBus::Event(
+            boxEntity.GetId(), &LmbrCentral::BoxShapeComponentRequestsBus::Events::SetBoxDimensions, AZ::Vector3(1.5f, 3.5f, 5.5f));
+
+        // the reference shape forwards the batches to the referenced box
+        LmbrCentral::ReferenceShapeConfig config;
+        config.m_shapeEntityId = boxEntity.GetId();
+        auto entity = CreateEntity<LmbrCentral::ReferenceShapeComponent>(config, nullptr);
+
+        ExpectBatchQueriesMatchSinglePointQueries(*entity);
+    }
+
+    INSTANTIATE_TEST_CASE_P(UniformScale, ReferenceShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryUniformScaleParams()));
 } // namespace UnitTest
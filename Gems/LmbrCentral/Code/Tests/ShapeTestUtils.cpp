@@ -8,6 +8,8 @@
 
 #include <ShapeTestUtils.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Math/Random.h>
+#include <AzTest/AzTest.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 
 namespace UnitTest
@@ -19,4 +21,84 @@ namespace UnitTest
             inside, entity.GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInside, point);
         return inside;
     }
+
+    const std::vector<ShapeBatchQueryParams>& GetShapeBatchQueryUniformScaleParams()
+    {
+        static const std::vector<ShapeBatchQueryParams> params = {
+            // identity
+            { AZ::Transform::CreateIdentity(), AZ::Vector3::CreateOne() },
+            // rotated and translated
+            { AZ::Transform::CreateFromQuaternionAndTranslation(
+                  AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 2.0f, 3.0f).GetNormalized(), 0.7f),
+                  AZ::Vector3(12.0f, -7.0f, 3.5f)),
+              AZ::Vector3::CreateOne() },
+            // rotated, translated and uniformly scaled
+            { AZ::Transform(
+                  AZ::Vector3(-4.0f, 9.0f, -2.0f), AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisZ(), 2.3f), 1.7f),
+              AZ::Vector3::CreateOne() },
+        };
+        return params;
+    }
+
+    const std::vector<ShapeBatchQueryParams>& GetShapeBatchQueryNonUniformScaleParams()
+    {
+        static const std::vector<ShapeBatchQueryParams> params = {
+            // non-uniform scale only
+            { AZ::Transform::CreateIdentity(), AZ::Vector3(0.5f, 2.0f, 1.5f) },
+            // rotated, translated, uniformly and non-uniformly scaled
+            { AZ::Transform(
+                  AZ::Vector3(6.0f, 1.0f, -8.0f), AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(3.0f, -1.0f, 2.0f).GetNormalized(), 1.1f),
+                  0.8f),
+              AZ::Vector3(2.5f, 0.7f, 1.2f) },
+        };
+        return params;
+    }
+
+    void ExpectBatchQueriesMatchSinglePointQueries(const AZ::Entity& entity)
+    {
+        AZ::Aabb aabb = AZ::Aabb::CreateNull();
+        LmbrCentral::ShapeComponentRequestsBus::EventResult(
+            aabb, entity.GetId(), &LmbrCentral::ShapeComponentRequests::GetEncompassingAabb);
+        ASSERT_TRUE(aabb.IsValid());
+
+        // sample the bounds with a margin around them, so points both inside and outside the shape are queried
+        const AZ::Vector3 margin = aabb.GetExtents() * 0.25f + AZ::Vector3(0.1f);
+        const AZ::Vector3 min = aabb.GetMin() - margin;
+        const AZ::Vector3 size = aabb.GetMax() + margin - min;
+
+        constexpr size_t PointCount = 500;
+        AZStd::vector<AZ::Vector3> points;
+        points.reserve(PointCount + 1);
+        points.push_back(aabb.GetCenter());
+        AZ::SimpleLcgRandom random(1234);
+        for (size_t index = 0; index < PointCount; ++index)
+        {
+            points.push_back(min + size * AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()));
+        }
+
+        AZStd::vector<bool> inside(points.size(), false);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInsideBatch,
+            AZStd::span<const AZ::Vector3>(points), AZStd::span<bool>(inside));
+
+        AZStd::vector<float> distances(points.size(), -1.0f);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPointBatch,
+            AZStd::span<const AZ::Vector3>(points), AZStd::span<float>(distances));
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            const AZ::Vector3& point = points[index];
+
+            bool expectedInside = false;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                expectedInside, entity.GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInside, point);
+            EXPECT_EQ(inside[index], expectedInside) << "point " << index;
+
+            float expectedDistance = FLT_MAX;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                expectedDistance, entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoint, point);
+            EXPECT_NEAR(distances[index], expectedDistance, 1e-4f * AZ::GetMax(1.0f, expectedDistance)) << "point " << index;
+        }
+    }
 } // namespace UnitTest
@@ -8,13 +8,34 @@
 
 #pragma once
 
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+
+#include <vector>
+
 namespace AZ
 {
     class Entity;
-    class Vector3;
 } // namespace AZ
 
 namespace UnitTest
 {
     bool IsPointInside(const AZ::Entity& entity, const AZ::Vector3& point);
+
+    //! Placement of a shape in the tests comparing the batch shape queries with the single point queries.
+    struct ShapeBatchQueryParams
+    {
+        AZ::Transform m_transform;
+        AZ::Vector3 m_nonUniformScale;
+    };
+
+    //! Placements with a uniform scale, usable with every shape.
+    const std::vector<ShapeBatchQueryParams>& GetShapeBatchQueryUniformScaleParams();
+
+    //! Placements with a non-uniform scale, for the shapes which support the non-uniform scale component.
+    const std::vector<ShapeBatchQueryParams>& GetShapeBatchQueryNonUniformScaleParams();
+
+    //! Expects IsPointInsideBatch and DistanceSquaredFromPointBatch to return the same results as IsPointInside and
+    //! DistanceSquaredFromPoint for points in and around the shape on the entity.
+    void ExpectBatchQueriesMatchSinglePointQueries(const AZ::Entity& entity);
 } // namespace UnitTest
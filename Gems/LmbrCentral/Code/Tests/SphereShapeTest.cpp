@@ -505,4 +505,22 @@ namespace UnitTest
         EXPECT_THAT(debugDrawAabb.GetMin(), IsCloseTolerance(AZ::Vector3(-1.0f, 14.8f, 16.1f), 0.1f));
         EXPECT_THAT(debugDrawAabb.GetMax(), IsCloseTolerance(AZ::Vector3(6.0f, 21.8f, 23.1f), 0.1f));
     }
+
+    class SphereShapeBatchQueryTest
+        : public SphereShapeTest
+        , public testing::WithParamInterface<ShapeBatchQueryParams>
+    {
+    };
+
+    TEST_P(SphereShapeBatchQueryTest, BatchQueriesMatchSinglePointQueries)
+    {
+        const ShapeBatchQueryParams& params = GetParam();
+
+        AZ::Entity entity;
+        CreateSphere(entity, params.m_transform, 2.5f, AZ::Vector3(1.0f, -0.5f, 2.0f));
+
+        ExpectBatchQueriesMatchSinglePointQueries(entity);
+    }
+
+    INSTANTIATE_TEST_CASE_P(UniformScale, SphereShapeBatchQueryTest, ::testing::ValuesIn(GetShapeBatchQueryUniformScaleParams()));
 } // namespace UnitTest
@@ -14,6 +14,7 @@ set(FILES
     SphereShapeTest.cpp
     CylinderShapeTest.cpp
     CapsuleShapeTest.cpp
+    CompoundShapeTest.cpp
     PolygonPrismShapeTest.cpp
     QuadShapeTest.cpp
     TubeShapeTest.cpp
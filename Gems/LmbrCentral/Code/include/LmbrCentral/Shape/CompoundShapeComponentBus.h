@@ -15,6 +15,12 @@ namespace AZ
     class ReflectContext;
 }
 
+// Predefinition for unit test friend class
+namespace UnitTest
+{
+    class CompoundShapeTest;
+}
+
 namespace LmbrCentral
 {
     /**
@@ -25,6 +31,8 @@ namespace LmbrCentral
     /// Configuration data for CompoundShapeConfiguration
     class CompoundShapeConfiguration
     {
+        friend class UnitTest::CompoundShapeTest;
+
     public:
         AZ_CLASS_ALLOCATOR(CompoundShapeConfiguration, AZ::SystemAllocator)
         AZ_RTTI(CompoundShapeConfiguration, "{4CEB4E5C-4CBD-4A84-88BA-87B23C103F3F}")
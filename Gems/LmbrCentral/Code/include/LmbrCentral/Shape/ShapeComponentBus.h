@@ -14,6 +14,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzFramework/Viewport/ViewportColors.h>
 
@@ -159,6 +160,32 @@ namespace LmbrCentral
         /// @return float indicating square distance point is from shape
         virtual float DistanceSquaredFromPoint(const AZ::Vector3& point) const = 0;
 
+        /// @brief Checks if each of the given points is inside the shape or outside it
+        /// Shapes override this to lock and update their cached data once for all the points, rather than once per point.
+        /// @param points Vector3 span indicating the points to be tested
+        /// @param results bool span set to whether each point is inside or out, must be the same size as points
+        virtual void IsPointInsideBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const
+        {
+            AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                results[index] = IsPointInside(points[index]);
+            }
+        }
+
+        /// @brief Returns the min squared distance each of the given points is from the shape
+        /// Shapes override this to lock and update their cached data once for all the points, rather than once per point.
+        /// @param points Vector3 span indicating the points to calculate square distances from
+        /// @param results float span set to the square distance each point is from the shape, must be the same size as points
+        virtual void DistanceSquaredFromPointBatch(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const
+        {
+            AZ_Assert(points.size() == results.size(), "input and output lists are different sizes (%zu vs %zu).", points.size(), results.size());
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                results[index] = DistanceSquaredFromPoint(points[index]);
+            }
+        }
+
         /// @brief Returns a random position inside the volume.
         /// @param randomDistribution An enum representing the different random distributions to use.
         virtual AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType /*randomDistribution*/) const
@@ -48,6 +48,8 @@ namespace LyShine
         , m_blendModeState(blendModeState)
         , m_totalNumVertices(0)
         , m_totalNumIndices(0)
+        , m_boundsMin(AZStd::numeric_limits<float>::max())
+        , m_boundsMax(-AZStd::numeric_limits<float>::max())
     {
         m_textures[0].m_texture = texture;
         m_textures[0].m_isClampTextureMode = isClampTextureMode;
@@ -68,6 +70,8 @@ namespace LyShine
         , m_blendModeState(blendModeState)
         , m_totalNumVertices(0)
         , m_totalNumIndices(0)
+        , m_boundsMin(AZStd::numeric_limits<float>::max())
+        , m_boundsMax(-AZStd::numeric_limits<float>::max())
     {
         m_textures[0].m_texture = texture;
         m_textures[0].m_isClampTextureMode = isClampTextureMode;
@@ -186,6 +190,13 @@ namespace LyShine
             m_combinedIndices[index_start + i] = vertex_start + primitive->m_indices[i];
         }
 
+        for (int i = 0; i < primitive->m_numVertices; ++i)
+        {
+            const AZ::Vector2 pos(primitive->m_vertices[i].xy.x, primitive->m_vertices[i].xy.y);
+            m_boundsMin = m_boundsMin.GetMin(pos);
+            m_boundsMax = m_boundsMax.GetMax(pos);
+        }
+
         m_totalNumVertices += primitive->m_numVertices;
         m_totalNumIndices += primitive->m_numIndices;
     }
@@ -220,6 +231,12 @@ namespace LyShine
         return primitive->m_numVertices + m_totalNumVertices < std::numeric_limits<uint16>::max();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool PrimitiveListRenderNode::OverlapsRect(const AZ::Vector2& rectMin, const AZ::Vector2& rectMax) const
+    {
+        return m_boundsMin.IsLessEqualThan(rectMax) && rectMin.IsLessEqualThan(m_boundsMax);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     int PrimitiveListRenderNode::FindTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode) const
     {
@@ -736,37 +753,12 @@ namespace LyShine
             bool isShaderOutputPremultAlpha = isPreMultiplyAlpha || isTexturePremultipliedAlpha;
             AZ::RHI::TargetBlendState blendModeState = GetBlendModeState(blendMode, isShaderOutputPremultAlpha);
 
-            PrimitiveListRenderNode* renderNodeToAddTo = nullptr;
-            if (!renderNodeList->empty())
-            {
-                RenderNode* lastRenderNode = renderNodeList->back();
-
-                if (lastRenderNode && lastRenderNode->GetType() == RenderNodeType::PrimitiveList)
-                {
-                    PrimitiveListRenderNode* primListRenderNode = static_cast<PrimitiveListRenderNode*>(lastRenderNode);
-
-                    // compare render state
-                    if (primListRenderNode->GetIsTextureSRGB() == isTextureSRGB &&
-                        primListRenderNode->GetBlendModeState() == blendModeState &&
-                        primListRenderNode->GetIsPremultiplyAlpha() == isPreMultiplyAlpha &&
-                        primListRenderNode->GetAlphaMaskType() ==  AlphaMaskType::None &&
-                        primListRenderNode->HasSpaceToAddPrimitive(primitive))
-                    {
-                        // render state is the same - we can add the primitive to this list if the texture is in
-                        // the list or there is space for another texture
-                        texUnit = primListRenderNode->GetOrAddTexture(texture, isClampTextureMode);
-
-                        if (texUnit != -1)
-                        {
-                            renderNodeToAddTo = primListRenderNode;
-                        }
-                    }
-                }
-            }
+            PrimitiveListRenderNode* renderNodeToAddTo = FindPrimitiveListToAddTo(*renderNodeList, primitive,
+                texture, isClampTextureMode, isTextureSRGB, isPreMultiplyAlpha, blendModeState, texUnit);
 
             if (!renderNodeToAddTo)
             {
-                // We can't add this primitive to the existing render node, we need to create a new render node
+                // We can't add this primitive to an existing render node, we need to create a new render node
                 // this uses a pool allocator for fast allocation
                 renderNodeToAddTo = new PrimitiveListRenderNode(texture, isClampTextureMode, isTextureSRGB, isPreMultiplyAlpha, blendModeState);
 
@@ -791,6 +783,66 @@ namespace LyShine
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    PrimitiveListRenderNode* RenderGraph::FindPrimitiveListToAddTo(AZStd::vector<RenderNode*>& renderNodeList,
+        LyShine::UiPrimitive* primitive, const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode,
+        bool isTextureSRGB, bool isPreMultiplyAlpha, const AZ::RHI::TargetBlendState& blendModeState, int& texUnit)
+    {
+        if (primitive->m_numVertices == 0)
+        {
+            return nullptr;
+        }
+
+        AZ::Vector2 primMin(AZStd::numeric_limits<float>::max());
+        AZ::Vector2 primMax(-AZStd::numeric_limits<float>::max());
+        for (int i = 0; i < primitive->m_numVertices; ++i)
+        {
+            const AZ::Vector2 pos(primitive->m_vertices[i].xy.x, primitive->m_vertices[i].xy.y);
+            primMin = primMin.GetMin(pos);
+            primMax = primMax.GetMax(pos);
+        }
+
+        int numNodesSearched = 0;
+        for (auto nodeIter = renderNodeList.rbegin();
+            nodeIter != renderNodeList.rend() && numNodesSearched < MaxRenderNodesToSearchForBatching;
+            ++nodeIter, ++numNodesSearched)
+        {
+            // Masks and render targets change the render state of everything in them so we can't batch past them
+            RenderNode* renderNode = *nodeIter;
+            if (!renderNode || renderNode->GetType() != RenderNodeType::PrimitiveList)
+            {
+                break;
+            }
+
+            PrimitiveListRenderNode* primListRenderNode = static_cast<PrimitiveListRenderNode*>(renderNode);
+
+            // compare render state
+            if (primListRenderNode->GetIsTextureSRGB() == isTextureSRGB &&
+                primListRenderNode->GetBlendModeState() == blendModeState &&
+                primListRenderNode->GetIsPremultiplyAlpha() == isPreMultiplyAlpha &&
+                primListRenderNode->GetAlphaMaskType() == AlphaMaskType::None &&
+                primListRenderNode->HasSpaceToAddPrimitive(primitive))
+            {
+                // render state is the same - we can add the primitive to this list if the texture is in
+                // the list or there is space for another texture
+                texUnit = primListRenderNode->GetOrAddTexture(texture, isClampTextureMode);
+                if (texUnit != -1)
+                {
+                    return primListRenderNode;
+                }
+            }
+
+            // The primitive would be drawn before this node if added to an earlier one, so it can only
+            // be batched further back if the two don't overlap
+            if (primListRenderNode->OverlapsRect(primMin, primMax))
+            {
+                break;
+            }
+        }
+
+        return nullptr;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::AddAlphaMaskPrimitive(LyShine::UiPrimitive* primitive,
         AZ::Data::Instance<AZ::RPI::AttachmentImage> contentAttachmentImage,
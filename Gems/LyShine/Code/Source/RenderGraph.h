@@ -14,6 +14,7 @@
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/set.h>
 #include <AzCore/Math/Color.h>
+#include <AzCore/Math/Vector2.h>
 
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Reflect/Image/Image.h>
@@ -103,6 +104,9 @@ namespace LyShine
 
         bool HasSpaceToAddPrimitive(LyShine::UiPrimitive* primitive) const;
 
+        //! Test whether any primitive in this node could overlap the given screen space rect
+        bool OverlapsRect(const AZ::Vector2& rectMin, const AZ::Vector2& rectMax) const;
+
         // Search to see if this texture is already used by this texture unit, returns -1 if not used
         int FindTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode) const;
 
@@ -131,6 +135,10 @@ namespace LyShine
         int             m_totalNumVertices;
         int             m_totalNumIndices;
 
+        // Screen space bounds of all the primitives in this node, used to batch primitives out of order
+        AZ::Vector2     m_boundsMin;
+        AZ::Vector2     m_boundsMax;
+
         LyShine::UiPrimitiveList   m_primitives;
 
         // Per-frame combined vertex and index buffers
@@ -351,7 +359,19 @@ namespace LyShine
 
         void SetRttPassesEnabled(UiRenderer* uiRenderer, bool enabled);
 
-    protected:  // data
+        //! Search back through the current render node list for a primitive list with the same render state that
+        //! the primitive can be added to without changing the visual result. A primitive can be added to an earlier
+        //! node as long as it doesn't overlap any of the nodes rendered after it.
+        //! Returns nullptr if a new render node is needed. On success texUnit is set to the texture unit to use.
+        PrimitiveListRenderNode* FindPrimitiveListToAddTo(AZStd::vector<RenderNode*>& renderNodeList,
+            LyShine::UiPrimitive* primitive, const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode,
+            bool isTextureSRGB, bool isPreMultiplyAlpha, const AZ::RHI::TargetBlendState& blendModeState, int& texUnit);
+
+    protected: // data
+
+        //! The maximum number of render nodes that are searched back through when batching a primitive.
+        //! This bounds the cost of building the graph for canvases with many render state changes.
+        static constexpr int MaxRenderNodesToSearchForBatching = 8;
 
         AZStd::vector<RenderNode*>  m_renderNodes;
         AZStd::vector<DynamicQuad*> m_dynamicQuads; // used for drawing quads not cached in components
@@ -16,6 +16,28 @@
 
 namespace
 {
+    UiLayoutHelpers::DefaultLayoutCellCacheScope* s_activeDefaultLayoutCellCacheScope = nullptr;
+
+    //! Returns the cached value if there is an active cache scope, otherwise evaluates it.
+    //! Callers always pass the same default value for a given kind of value, so it can be cached along with it
+    template<typename Query>
+    float GetCachedDefaultValue(AZ::EntityId elementId,
+        AZStd::optional<float> UiLayoutHelpers::DefaultLayoutCellCacheScope::CachedValues::* cachedValueMember, Query query)
+    {
+        UiLayoutHelpers::DefaultLayoutCellCacheScope* cacheScope = s_activeDefaultLayoutCellCacheScope;
+        if (!cacheScope)
+        {
+            return query();
+        }
+
+        AZStd::optional<float>& cachedValue = cacheScope->GetCachedValues(elementId).*cachedValueMember;
+        if (!cachedValue.has_value())
+        {
+            cachedValue = query();
+        }
+        return cachedValue.value();
+    }
+
     float GetLargestFloat(const AZStd::vector<float>& values)
     {
         float largestValue = 0.0f;
@@ -33,80 +55,128 @@ namespace
 
     float GetElementDefaultMinWidth(AZ::EntityId elementId, float defaultValue)
     {
-        AZ::EBusAggregateResults<float> results;
-        UiLayoutCellDefaultBus::EventResult(results, elementId, &UiLayoutCellDefaultBus::Events::GetMinWidth);
+        return GetCachedDefaultValue(elementId, &UiLayoutHelpers::DefaultLayoutCellCacheScope::CachedValues::m_minWidth,
+            [&]()
+            {
+                AZ::EBusAggregateResults<float> results;
+                UiLayoutCellDefaultBus::EventResult(results, elementId, &UiLayoutCellDefaultBus::Events::GetMinWidth);
 
-        if (results.values.empty())
-        {
-            return defaultValue;
-        }
+                if (results.values.empty())
+                {
+                    return defaultValue;
+                }
 
-        return GetLargestFloat(results.values);
+                return GetLargestFloat(results.values);
+            });
     }
 
     float GetElementDefaultTargetWidth(AZ::EntityId elementId, float defaultValue, float maxValue)
     {
-        AZ::EBusAggregateResults<float> results;
-        UiLayoutCellDefaultBus::EventResult(results, elementId, &UiLayoutCellDefaultBus::Events::GetTargetWidth, maxValue);
-
-        if (results.values.empty())
+        if (s_activeDefaultLayoutCellCacheScope)
         {
-            return defaultValue;
+            // The target size depends on the max value, so it's only reused when queried with the same max value
+            UiLayoutHelpers::DefaultLayoutCellCacheScope::CachedValues& cachedValues =
+                s_activeDefaultLayoutCellCacheScope->GetCachedValues(elementId);
+            if (cachedValues.m_targetWidth.has_value() && cachedValues.m_targetWidthMaxValue != maxValue)
+            {
+                cachedValues.m_targetWidth.reset();
+            }
+            cachedValues.m_targetWidthMaxValue = maxValue;
         }
 
-        return GetLargestFloat(results.values);
+        return GetCachedDefaultValue(elementId, &UiLayoutHelpers::DefaultLayoutCellCacheScope::CachedValues::m_targetWidth,
+            [&]()
+            {
+                AZ::EBusAggregateResults<float> results;
+                UiLayoutCellDefaultBus::EventResult(results, elementId, &UiLayoutCellDefaultBus::Events::GetTargetWidth, maxValue);
+
+                if (results.values.empty())
+                {
+                    return defaultValue;
+                }
+
+                return GetLargestFloat(results.values);
+            });
     }
 
     float GetElementDefaultExtraWidthRatio(AZ::EntityId elementId, float defaultValue)
     {
-        AZ::EBusAggregateResults<float> results;
-        UiLayoutCellDefaultBus::EventResult(results, elementId, &UiLayoutCellDefaultBus::Events::GetExtraWidthRatio);
+        return GetCachedDefaultValue(elementId, &UiLayoutHelpers::DefaultLayoutCellCacheScope::CachedValues::m_extraWidthRatio,
+            [&]()
+            {
+                AZ::EBusAggregateResults<float> results;
+                UiLayoutCellDefaultBus::EventResult(results, elementId, &UiLayoutCellDefaultBus::Events::GetExtraWidthRatio);
 
-        if (results.values.empty())
-        {
-            return defaultValue;
-        }
+                if (results.values.empty())
+                {
+                    return defaultValue;
+                }
 
-        return GetLargestFloat(results.values);
+                return GetLargestFloat(results.values);
+            });
     }
 
     float GetElementDefaultMinHeight(AZ::EntityId elementId, float defaultValue)
     {
-        AZ::EBusAggregateResults<float> results;
-        UiLayoutCellDefaultBus::EventResult(results, elementId, &UiLayoutCellDefaultBus::Events::GetMinHeight);
+        return GetCachedDefaultValue(elementId, &UiLayoutHelpers::DefaultLayoutCellCacheScope::CachedValues::m_minHeight,
+            [&]()
+            {
+                AZ::EBusAggregateResults<float> results;
+                UiLayoutCellDefaultBus::EventResult(results, elementId, &UiLayoutCellDefaultBus::Events::GetMinHeight);
 
-        if (results.values.empty())
-        {
-            return defaultValue;
-        }
+                if (results.values.empty())
+                {
+                    return defaultValue;
+                }
 
-        return GetLargestFloat(results.values);
+                return GetLargestFloat(results.values);
+            });
     }
 
     float GetElementDefaultTargetHeight(AZ::EntityId elementId, float defaultValue, float maxValue)
     {
-        AZ::EBusAggregateResults<float> results;
-        UiLayoutCellDefaultBus::EventResult(results, elementId, &UiLayoutCellDefaultBus::Events::GetTargetHeight, maxValue);
-
-        if (results.values.empty())
+        if (s_activeDefaultLayoutCellCacheScope)
         {
-            return defaultValue;
+            // The target size depends on the max value, so it's only reused when queried with the same max value
+            UiLayoutHelpers::DefaultLayoutCellCacheScope::CachedValues& cachedValues =
+                s_activeDefaultLayoutCellCacheScope->GetCachedValues(elementId);
+            if (cachedValues.m_targetHeight.has_value() && cachedValues.m_targetHeightMaxValue != maxValue)
+            {
+                cachedValues.m_targetHeight.reset();
+            }
+            cachedValues.m_targetHeightMaxValue = maxValue;
         }
 
-        return GetLargestFloat(results.values);
+        return GetCachedDefaultValue(elementId, &UiLayoutHelpers::DefaultLayoutCellCacheScope::CachedValues::m_targetHeight,
+            [&]()
+            {
+                AZ::EBusAggregateResults<float> results;
+                UiLayoutCellDefaultBus::EventResult(results, elementId, &UiLayoutCellDefaultBus::Events::GetTargetHeight, maxValue);
+
+                if (results.values.empty())
+                {
+                    return defaultValue;
+                }
+
+                return GetLargestFloat(results.values);
+            });
     }
 
     float GetElementDefaultExtraHeightRatio(AZ::EntityId elementId, float defaultValue)
     {
-        AZ::EBusAggregateResults<float> results;
-        UiLayoutCellDefaultBus::EventResult(results, elementId, &UiLayoutCellDefaultBus::Events::GetExtraHeightRatio);
+        return GetCachedDefaultValue(elementId, &UiLayoutHelpers::DefaultLayoutCellCacheScope::CachedValues::m_extraHeightRatio,
+            [&]()
+            {
+                AZ::EBusAggregateResults<float> results;
+                UiLayoutCellDefaultBus::EventResult(results, elementId, &UiLayoutCellDefaultBus::Events::GetExtraHeightRatio);
 
-        if (results.values.empty())
-        {
-            return defaultValue;
-        }
+                if (results.values.empty())
+                {
+                    return defaultValue;
+                }
 
-        return GetLargestFloat(results.values);
+                return GetLargestFloat(results.values);
+            });
     }
 
     float GetLayoutCellTargetWidth(AZ::EntityId elementId, bool ignoreDefaultLayoutCells)
@@ -207,6 +277,20 @@ namespace UiLayoutHelpers
     {
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    DefaultLayoutCellCacheScope::DefaultLayoutCellCacheScope()
+        : m_previousScope(s_activeDefaultLayoutCellCacheScope)
+    {
+        s_activeDefaultLayoutCellCacheScope = this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    DefaultLayoutCellCacheScope::~DefaultLayoutCellCacheScope()
+    {
+        AZ_Assert(s_activeDefaultLayoutCellCacheScope == this, "Default layout cell cache scopes must be destroyed in reverse order");
+        s_activeDefaultLayoutCellCacheScope = m_previousScope;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void GetLayoutCellWidths(AZ::EntityId elementId, bool ignoreDefaultLayoutCells, LayoutCellSizes& layoutCellsOut)
     {
@@ -9,6 +9,8 @@
 
 #include <LyShine/Bus/UiLayoutBus.h>
 #include <LyShine/Bus/UiTransformBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/optional.h>
 
 namespace UiLayoutHelpers
 {
@@ -24,6 +26,39 @@ namespace UiLayoutHelpers
 
     using LayoutCellSizes = AZStd::vector<LayoutCellSize>;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    //! While an instance is alive, the default layout cell values that elements provide through the
+    //! UiLayoutCellDefaultBus are cached. Nested layouts query the default values of their descendants
+    //! once for each ancestor, so this makes each element only measure itself once.
+    //! The cached values are only valid while the sizes they depend on don't change, so the layout manager
+    //! uses one instance for the pass over the widths and another one for the pass over the heights
+    class DefaultLayoutCellCacheScope
+    {
+    public:
+        struct CachedValues
+        {
+            AZStd::optional<float> m_minWidth;
+            AZStd::optional<float> m_targetWidth;
+            float m_targetWidthMaxValue = 0.0f;
+            AZStd::optional<float> m_extraWidthRatio;
+            AZStd::optional<float> m_minHeight;
+            AZStd::optional<float> m_targetHeight;
+            float m_targetHeightMaxValue = 0.0f;
+            AZStd::optional<float> m_extraHeightRatio;
+        };
+
+        DefaultLayoutCellCacheScope();
+        ~DefaultLayoutCellCacheScope();
+
+        CachedValues& GetCachedValues(AZ::EntityId elementId) { return m_cachedValues[elementId]; }
+
+    private:
+        AZ_DISABLE_COPY_MOVE(DefaultLayoutCellCacheScope);
+
+        AZStd::unordered_map<AZ::EntityId, CachedValues> m_cachedValues;
+        DefaultLayoutCellCacheScope* m_previousScope = nullptr;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     //! Get a list of layout cell widths corresponding to the children of the layout element
     void GetLayoutCellWidths(AZ::EntityId elementId, bool ignoreDefaultLayoutCells, LayoutCellSizes& layoutCellsOut);
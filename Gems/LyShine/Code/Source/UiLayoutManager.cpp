@@ -6,6 +6,7 @@
  *
  */
 #include "UiLayoutManager.h"
+#include "UiLayoutHelpers.h"
 
 #include <LyShine/Bus/UiLayoutBus.h>
 #include <LyShine/Bus/UiElementBus.h>
@@ -100,16 +101,24 @@ void UiLayoutManager::ComputeLayoutForElementAndDescendants(AZ::EntityId entityI
     LyShine::EntityArray layoutChildren;
     UiElementBus::Event(entityId, &UiElementBus::Events::FindDescendantElements, FindLayoutChildren, layoutChildren);
 
-    UiLayoutControllerBus::Event(entityId, &UiLayoutControllerBus::Events::ApplyLayoutWidth);
-    for (auto layoutChild : layoutChildren)
+    // The default layout cell values of the descendants are measured once for each pass and reused by all
+    // their ancestor layouts. Heights can depend on the widths that were applied, so each pass has its own cache
     {
-        UiLayoutControllerBus::Event(layoutChild->GetId(), &UiLayoutControllerBus::Events::ApplyLayoutWidth);
+        UiLayoutHelpers::DefaultLayoutCellCacheScope widthCacheScope;
+        UiLayoutControllerBus::Event(entityId, &UiLayoutControllerBus::Events::ApplyLayoutWidth);
+        for (auto layoutChild : layoutChildren)
+        {
+            UiLayoutControllerBus::Event(layoutChild->GetId(), &UiLayoutControllerBus::Events::ApplyLayoutWidth);
+        }
     }
 
-    UiLayoutControllerBus::Event(entityId, &UiLayoutControllerBus::Events::ApplyLayoutHeight);
-    for (auto layoutChild : layoutChildren)
     {
-        UiLayoutControllerBus::Event(layoutChild->GetId(), &UiLayoutControllerBus::Events::ApplyLayoutHeight);
+        UiLayoutHelpers::DefaultLayoutCellCacheScope heightCacheScope;
+        UiLayoutControllerBus::Event(entityId, &UiLayoutControllerBus::Events::ApplyLayoutHeight);
+        for (auto layoutChild : layoutChildren)
+        {
+            UiLayoutControllerBus::Event(layoutChild->GetId(), &UiLayoutControllerBus::Events::ApplyLayoutHeight);
+        }
     }
 }
 
@@ -134,28 +143,12 @@ void UiLayoutManager::AddToRecomputeLayoutList(AZ::EntityId entityId)
             }
         }
 
-        // Remove element's children from the list
-        LyShine::EntityArray descendants;
-        UiElementBus::Event(
-            entityId,
-            &UiElementBus::Events::FindDescendantElements,
-            []([[maybe_unused]] const AZ::Entity* entity)
-            {
-                return true;
-            },
-            descendants);
-
+        // Remove element's descendants from the list. The list is usually much smaller than the element's
+        // subtree, so walk up from the marked elements rather than gathering all the descendants
         m_elementsToRecomputeLayout.remove_if(
-            [descendants](const AZ::EntityId& e)
+            [this, entityId](const AZ::EntityId& e)
             {
-                for (auto descendant : descendants)
-                {
-                    if (descendant->GetId() == e)
-                    {
-                        return true;
-                    }
-                }
-                return false;
+                return IsParentOfElement(entityId, e);
             }
             );
 
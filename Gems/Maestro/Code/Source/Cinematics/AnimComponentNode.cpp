@@ -643,6 +643,7 @@ void CAnimComponentNode::AddPropertyToParamInfoMap(const CAnimParamType& paramTy
 
         Maestro::SequenceComponentRequestBus::EventResult(propertyTypeId, m_pSequence->GetSequenceEntityId(), &Maestro::SequenceComponentRequestBus::Events::GetAnimatedAddressTypeId,
             GetParentAzEntityId(), propertyAddress);
+        propertyInfo.m_animatableAddress = propertyAddress;
 
         if (propertyTypeId == AZ::Vector3::TYPEINFO_Uuid())
         {
@@ -876,7 +877,7 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                 if (findIter != m_paramTypeToBehaviorPropertyInfoMap.end())
                 {
                     BehaviorPropertyInfo& propertyInfo = findIter->second;
-                    Maestro::SequenceComponentRequests::AnimatablePropertyAddress animatableAddress(m_componentId, propertyInfo.m_animNodeParamInfo.name);
+                    const Maestro::SequenceComponentRequests::AnimatablePropertyAddress& animatableAddress = propertyInfo.m_animatableAddress;
 
                     switch (pTrack->GetValueType())
                     {
@@ -885,7 +886,7 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                             if (pTrack->HasKeys())
                             {
                                 float floatValue = .0f;
-                                pTrack->GetValue(ac.time, floatValue, /*applyMultiplier= */ true);
+                                GetTrackValue(paramIndex, ac.time, floatValue);
                                 Maestro::SequenceComponentRequests::AnimatedFloatValue value(floatValue);
 
                                 Maestro::SequenceComponentRequests::AnimatedFloatValue prevValue(floatValue);
@@ -903,7 +904,7 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                         {
                             float tolerance = AZ::Constants::FloatEpsilon;
                             AZ::Vector3 vec;
-                            pTrack->GetValue(ac.time, vec, /*applyMultiplier= */ true);
+                            GetTrackValue(paramIndex, ac.time, vec);
 
                             if (pTrack->GetValueType() == AnimValueType::RGB)
                             {
@@ -938,7 +939,7 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                                 float tolerance = AZ::Constants::FloatEpsilon;
 
                                 AZ::Quaternion quaternionValue(AZ::Quaternion::CreateIdentity());
-                                pTrack->GetValue(ac.time, quaternionValue);
+                                GetTrackValue(paramIndex, ac.time, quaternionValue);
                                 Maestro::SequenceComponentRequests::AnimatedQuaternionValue value(quaternionValue);
                                 Maestro::SequenceComponentRequests::AnimatedQuaternionValue prevValue(quaternionValue);
                                 Maestro::SequenceComponentRequestBus::Event(m_pSequence->GetSequenceEntityId(), &Maestro::SequenceComponentRequestBus::Events::GetAnimatedPropertyValue, prevValue, GetParentAzEntityId(), animatableAddress);
@@ -958,7 +959,7 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
                             if (pTrack->HasKeys())
                             {
                                 bool boolValue = true;
-                                pTrack->GetValue(ac.time, boolValue);
+                                GetTrackValue(paramIndex, ac.time, boolValue);
                                 Maestro::SequenceComponentRequests::AnimatedBoolValue value(boolValue);
 
                                 Maestro::SequenceComponentRequests::AnimatedBoolValue prevValue(boolValue);
@@ -1001,6 +1002,116 @@ void CAnimComponentNode::Animate(SAnimContext& ac)
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CAnimComponentNode::SampleTracks(const SAnimContext& ac)
+{
+    const int trackCount = NumTracks();
+    m_sampledTrackValues.resize(trackCount);
+    for (int trackIndex = 0; trackIndex < trackCount; trackIndex++)
+    {
+        SampledTrackValue& sampledValue = m_sampledTrackValues[trackIndex];
+        sampledValue.m_isSampled = false;
+
+        IAnimTrack* track = m_tracks[trackIndex].get();
+        if (m_skipComponentAnimationUpdates || ac.resetting || !track->HasKeys() || (track->GetFlags() & IAnimTrack::eAnimTrackFlags_Disabled) ||
+            track->IsMasked(ac.trackMask) || track->GetParameterType().GetType() == AnimParamType::Animation)
+        {
+            continue;
+        }
+
+        // Only sample the values Animate() reads straight from the track, it applies them to the component afterwards
+        switch (track->GetValueType())
+        {
+        case AnimValueType::Float:
+        {
+            float floatValue = .0f;
+            track->GetValue(ac.time, floatValue, /*applyMultiplier= */ true);
+            sampledValue.m_value = floatValue;
+            break;
+        }
+        case AnimValueType::Vector:     // fall-through
+        case AnimValueType::RGB:
+        {
+            AZ::Vector3 vec;
+            track->GetValue(ac.time, vec, /*applyMultiplier= */ true);
+            sampledValue.m_value = vec;
+            break;
+        }
+        case AnimValueType::Quat:
+        {
+            AZ::Quaternion quaternionValue(AZ::Quaternion::CreateIdentity());
+            track->GetValue(ac.time, quaternionValue);
+            sampledValue.m_value = quaternionValue;
+            break;
+        }
+        case AnimValueType::Bool:
+        {
+            bool boolValue = true;
+            track->GetValue(ac.time, boolValue);
+            sampledValue.m_value = boolValue;
+            break;
+        }
+        default:
+            continue;
+        }
+
+        sampledValue.m_time = ac.time;
+        sampledValue.m_isSampled = true;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+template<typename ValueType>
+bool CAnimComponentNode::ConsumeSampledTrackValue(int trackIndex, float time, ValueType& value)
+{
+    if (trackIndex >= static_cast<int>(m_sampledTrackValues.size()))
+    {
+        return false;
+    }
+
+    // A sample is only used once, so the tracks edited between two frames are never animated with stale values
+    SampledTrackValue& sampledValue = m_sampledTrackValues[trackIndex];
+    const bool isSampled = sampledValue.m_isSampled && sampledValue.m_time == time && AZStd::holds_alternative<ValueType>(sampledValue.m_value);
+    sampledValue.m_isSampled = false;
+    if (isSampled)
+    {
+        value = AZStd::get<ValueType>(sampledValue.m_value);
+    }
+    return isSampled;
+}
+
+void CAnimComponentNode::GetTrackValue(int trackIndex, float time, float& value)
+{
+    if (!ConsumeSampledTrackValue(trackIndex, time, value))
+    {
+        m_tracks[trackIndex]->GetValue(time, value, /*applyMultiplier= */ true);
+    }
+}
+
+void CAnimComponentNode::GetTrackValue(int trackIndex, float time, AZ::Vector3& value)
+{
+    if (!ConsumeSampledTrackValue(trackIndex, time, value))
+    {
+        m_tracks[trackIndex]->GetValue(time, value, /*applyMultiplier= */ true);
+    }
+}
+
+void CAnimComponentNode::GetTrackValue(int trackIndex, float time, AZ::Quaternion& value)
+{
+    if (!ConsumeSampledTrackValue(trackIndex, time, value))
+    {
+        m_tracks[trackIndex]->GetValue(time, value);
+    }
+}
+
+void CAnimComponentNode::GetTrackValue(int trackIndex, float time, bool& value)
+{
+    if (!ConsumeSampledTrackValue(trackIndex, time, value))
+    {
+        m_tracks[trackIndex]->GetValue(time, value);
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CAnimComponentNode::AnimateAssetBlendSubProperties(const Maestro::AssetBlends<AZ::Data::AssetData>& assetBlendValue)
 {
@@ -15,6 +15,9 @@
 #include "AnimNode.h"
 #include "CharacterTrackAnimator.h"
 #include <Maestro/Bus/EditorSequenceAgentComponentBus.h>
+#include <Maestro/Bus/SequenceComponentBus.h>
+
+#include <AzCore/std/containers/variant.h>
 
 /**
  * CAnimComponentNode
@@ -40,6 +43,7 @@ public:
     //////////////////////////////////////////////////////////////////////////
     // Overrides from CAnimNode
     void Animate(SAnimContext& ac) override;
+    void SampleTracks(const SAnimContext& ac) override;
     
     void OnStart() override;
     void OnResume() override;
@@ -141,6 +145,15 @@ private:
     int SetKeysForChangedVector3TrackValue(IAnimTrack* track, int keyIdx, float time, bool applyTrackMultiplier = true, float isChangedTolerance = AZ::Constants::Tolerance);
     int SetKeysForChangedQuaternionTrackValue(IAnimTrack* track, int keyIdx, float time);
 
+    // Return the value sampled by SampleTracks() for the track at the given time, or sample the track if there is none.
+    // The float and vector values have the track multiplier applied.
+    void GetTrackValue(int trackIndex, float time, float& value);
+    void GetTrackValue(int trackIndex, float time, AZ::Vector3& value);
+    void GetTrackValue(int trackIndex, float time, AZ::Quaternion& value);
+    void GetTrackValue(int trackIndex, float time, bool& value);
+    template<typename ValueType>
+    bool ConsumeSampledTrackValue(int trackIndex, float time, ValueType& value);
+
     // Helper function to set individual properties on Simple Motion Component from an AssetBlend Track.
     void AnimateAssetBlendSubProperties(const Maestro::AssetBlends<AZ::Data::AssetData>& assetBlendValue);
 
@@ -157,6 +170,7 @@ private:
             m_displayName = other.m_displayName;
             m_animNodeParamInfo.paramType = other.m_displayName;
             m_animNodeParamInfo.name = m_displayName;
+            m_animatableAddress = other.m_animatableAddress;
         }
         BehaviorPropertyInfo& operator=(const AZStd::string& str)
         {
@@ -169,6 +183,16 @@ private:
 
         AZStd::string m_displayName;
         SParamInfo m_animNodeParamInfo;
+        // built once rather than every frame the property is animated
+        Maestro::SequenceComponentRequests::AnimatablePropertyAddress m_animatableAddress;
+    };
+
+    // a track value sampled by SampleTracks(), consumed by the next Animate() at the same time
+    struct SampledTrackValue
+    {
+        AZStd::variant<float, AZ::Vector3, AZ::Quaternion, bool> m_value;
+        float m_time = 0.0f;
+        bool m_isSampled = false;
     };
     
     void AddPropertyToParamInfoMap(const CAnimParamType& paramType);
@@ -179,6 +203,9 @@ private:
     // a mapping of CAnimParmTypes to SBehaviorPropertyInfo structs for each virtual property
     AZStd::unordered_map<CAnimParamType, BehaviorPropertyInfo>   m_paramTypeToBehaviorPropertyInfoMap;
 
+    // track values sampled by SampleTracks(), indexed like m_tracks
+    AZStd::vector<SampledTrackValue> m_sampledTrackValues;
+
     // helper class responsible for animating Character Tracks (aka 'Animation' tracks in the TrackView UI)
     CCharacterTrackAnimator*   m_characterTrackAnimator = nullptr;
 
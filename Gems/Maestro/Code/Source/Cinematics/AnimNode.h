@@ -106,6 +106,10 @@ public:
     void StillUpdate() override {}
     void Animate(SAnimContext& ec) override;
 
+    //! Samples the track values of the node for the time of the context ahead of Animate().
+    //! The nodes of a sequence are sampled in parallel, so this must only modify the node's own tracks and sampled values.
+    virtual void SampleTracks([[maybe_unused]] const SAnimContext& ec) {}
+
     virtual void PrecacheStatic([[maybe_unused]] float startTime) {}
     virtual void PrecacheDynamic([[maybe_unused]] float time) {}
 
@@ -28,10 +28,14 @@
 #include "ShadowsSetupNode.h"
 #include "SequenceTrack.h"
 #include "AnimNodeGroup.h"
+#include "Movie.h"
 #include <Maestro/Types/AnimNodeType.h>
 #include <Maestro/Types/SequenceType.h>
 #include <Maestro/Types/AnimParamType.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
 //////////////////////////////////////////////////////////////////////////
@@ -657,6 +661,8 @@ void CAnimSequence::Animate(const SAnimContext& ec)
         m_activeDirector->Animate(animContext);
     }
 
+    AZStd::vector<CAnimNode*> animatedNodes;
+    animatedNodes.reserve(m_nodes.size());
     for (AnimNodes::iterator it = m_nodes.begin(); it != m_nodes.end(); ++it)
     {
         // Make sure correct animation block is binded to node.
@@ -680,11 +686,44 @@ void CAnimSequence::Animate(const SAnimContext& ec)
             continue;
         }
 
+        animatedNodes.push_back(static_cast<CAnimNode*>(animNode));
+    }
+
+    // Sample the tracks of all the nodes in parallel, then apply the values to the entities in order on this thread
+    SampleTracks(animatedNodes, animContext);
+    for (CAnimNode* animNode : animatedNodes)
+    {
         // Animate node.
         animNode->Animate(animContext);
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CAnimSequence::SampleTracks(const AZStd::vector<CAnimNode*>& animNodes, const SAnimContext& ec)
+{
+    AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+    if (!CMovieSystem::m_mov_parallelTrackSampling || !jobContext || animNodes.size() < MinNodesToSampleInParallel)
+    {
+        return;
+    }
+
+    AZ::JobCompletion jobCompletion;
+    for (size_t firstNode = 0; firstNode < animNodes.size(); firstNode += NodesPerSampleJob)
+    {
+        const size_t lastNode = AZStd::min(firstNode + NodesPerSampleJob, animNodes.size());
+        AZ::Job* job = AZ::CreateJobFunction([&animNodes, &ec, firstNode, lastNode]()
+            {
+                for (size_t nodeIndex = firstNode; nodeIndex < lastNode; ++nodeIndex)
+                {
+                    animNodes[nodeIndex]->SampleTracks(ec);
+                }
+            }, true, jobContext);
+        job->SetDependent(&jobCompletion);
+        job->Start();
+    }
+    jobCompletion.StartAndWaitForCompletion();
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CAnimSequence::Render()
 {
@@ -20,6 +20,8 @@
 
 #include <list>
 
+class CAnimNode;
+
 class CAnimSequence
     : public IAnimSequence
 {
@@ -168,6 +170,11 @@ private:
 
     void SetId(uint32 newId);
 
+    // Samples the tracks of the nodes in parallel ahead of animating them, if there are enough nodes to be worth it.
+    static void SampleTracks(const AZStd::vector<CAnimNode*>& animNodes, const SAnimContext& ec);
+    static constexpr size_t MinNodesToSampleInParallel = 16;
+    static constexpr size_t NodesPerSampleJob = 8;
+
     int m_refCount;
 
     typedef AZStd::vector< AZStd::intrusive_ptr<IAnimNode> > AnimNodes;
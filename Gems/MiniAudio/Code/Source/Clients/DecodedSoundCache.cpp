@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "DecodedSoundCache.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+
+#include "MiniAudioIncludes.h"
+
+namespace MiniAudio
+{
+    AZ_CVAR(AZ::u64, ma_decodedSoundCacheSize, 32 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum size in bytes of the decoded samples kept for sounds which aren't streamed, 0 to decode every playback");
+
+    DecodedSoundCache::DecodedSoundCache(ma_engine* engine)
+        : m_engine(engine)
+    {
+        if (DecodedSoundCacheInterface::Get() == nullptr)
+        {
+            DecodedSoundCacheInterface::Register(this);
+        }
+    }
+
+    DecodedSoundCache::~DecodedSoundCache()
+    {
+        if (DecodedSoundCacheInterface::Get() == this)
+        {
+            DecodedSoundCacheInterface::Unregister(this);
+        }
+
+        AZ_Warning("MiniAudio", AZStd::all_of(m_sounds.begin(), m_sounds.end(),
+            [](const auto& sound)
+            {
+                return sound.second.m_useCount == 0;
+            }), "Decoded sounds are still in use while the cache is destroyed");
+
+        for (auto& sound : m_sounds)
+        {
+            RemoveSound(sound.second);
+        }
+    }
+
+    AZStd::string DecodedSoundCache::AcquireSound(const SoundDataAsset& soundAsset)
+    {
+        if (!m_engine || !soundAsset.IsReady() || soundAsset->m_data.empty())
+        {
+            return {};
+        }
+
+        AZStd::scoped_lock lock(m_mutex);
+
+        if (auto soundIter = m_sounds.find(soundAsset.GetId()); soundIter != m_sounds.end())
+        {
+            CachedSound& sound = soundIter->second;
+            ++sound.m_useCount;
+            m_recentlyUsed.splice(m_recentlyUsed.begin(), m_recentlyUsed, sound.m_recentlyUsed);
+            return sound.m_name;
+        }
+
+        const size_t cacheBudget = aznumeric_cast<size_t>(static_cast<AZ::u64>(ma_decodedSoundCacheSize));
+        if (cacheBudget == 0)
+        {
+            return {};
+        }
+
+        // Decodes to the native channel count and sample rate of the sound, the engine converts them during playback.
+        ma_decoder_config decoderConfig = ma_decoder_config_init(ma_format_f32, 0, 0);
+        ma_uint64 frameCount = 0;
+        void* frames = nullptr;
+        ma_result result = ma_decode_memory(soundAsset->m_data.data(), soundAsset->m_data.size(), &decoderConfig, &frameCount, &frames);
+        if (result != MA_SUCCESS)
+        {
+            AZ_Warning("MiniAudio", false, "Failed to decode sound '%s', error %d", soundAsset.GetHint().c_str(), result);
+            return {};
+        }
+
+        const size_t sizeInBytes = aznumeric_cast<size_t>(frameCount * ma_get_bytes_per_frame(decoderConfig.format, decoderConfig.channels));
+        if (!EvictUnusedSounds(sizeInBytes))
+        {
+            // Too large for the cache, the sound is decoded during playback instead.
+            ma_free(frames, nullptr);
+            return {};
+        }
+
+        CachedSound sound;
+        sound.m_name = AZStd::string::format("%s:decoded", soundAsset.GetId().ToString<AZStd::string>().c_str());
+        result = ma_resource_manager_register_decoded_data(ma_engine_get_resource_manager(m_engine), sound.m_name.c_str(),
+            frames, frameCount, decoderConfig.format, decoderConfig.channels, decoderConfig.sampleRate);
+        if (result != MA_SUCCESS)
+        {
+            AZ_Warning("MiniAudio", false, "Failed to register decoded sound '%s', error %d", soundAsset.GetHint().c_str(), result);
+            ma_free(frames, nullptr);
+            return {};
+        }
+
+        sound.m_frames = frames;
+        sound.m_sizeInBytes = sizeInBytes;
+        sound.m_useCount = 1;
+        sound.m_recentlyUsed = m_recentlyUsed.insert(m_recentlyUsed.begin(), soundAsset.GetId());
+        m_cacheSize += sizeInBytes;
+
+        return m_sounds.emplace(soundAsset.GetId(), AZStd::move(sound)).first->second.m_name;
+    }
+
+    void DecodedSoundCache::ReleaseSound(const AZ::Data::AssetId& soundAssetId)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+
+        auto soundIter = m_sounds.find(soundAssetId);
+        if (soundIter == m_sounds.end() || soundIter->second.m_useCount == 0)
+        {
+            AZ_Warning("MiniAudio", false, "Releasing decoded sound '%s' which wasn't acquired",
+                soundAssetId.ToString<AZStd::string>().c_str());
+            return;
+        }
+
+        --soundIter->second.m_useCount;
+
+        // The budget may have been lowered while the sounds were in use.
+        EvictUnusedSounds(0);
+    }
+
+    size_t DecodedSoundCache::GetCacheSize() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_cacheSize;
+    }
+
+    bool DecodedSoundCache::EvictUnusedSounds(size_t sizeToFit)
+    {
+        const size_t cacheBudget = aznumeric_cast<size_t>(static_cast<AZ::u64>(ma_decodedSoundCacheSize));
+        if (sizeToFit > cacheBudget)
+        {
+            return false;
+        }
+
+        auto recentlyUsedIter = m_recentlyUsed.end();
+        while (m_cacheSize + sizeToFit > cacheBudget && recentlyUsedIter != m_recentlyUsed.begin())
+        {
+            --recentlyUsedIter;
+            auto soundIter = m_sounds.find(*recentlyUsedIter);
+            if (soundIter->second.m_useCount == 0)
+            {
+                // Sounds still playing from the decoded samples can't be removed.
+                RemoveSound(soundIter->second);
+                recentlyUsedIter = m_recentlyUsed.erase(recentlyUsedIter);
+                m_sounds.erase(soundIter);
+            }
+        }
+
+        return m_cacheSize + sizeToFit <= cacheBudget;
+    }
+
+    void DecodedSoundCache::RemoveSound(CachedSound& sound)
+    {
+        if (m_engine)
+        {
+            ma_resource_manager_unregister_data(ma_engine_get_resource_manager(m_engine), sound.m_name.c_str());
+        }
+        ma_free(sound.m_frames, nullptr);
+        sound.m_frames = nullptr;
+        m_cacheSize -= sound.m_sizeInBytes;
+    }
+} // namespace MiniAudio
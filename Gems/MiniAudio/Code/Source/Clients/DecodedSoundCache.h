@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <MiniAudio/SoundAsset.h>
+
+// avoid including MiniAudioIncludes here to speed up compilation
+
+struct ma_engine;
+
+// Predefinition for unit test friend class
+namespace UnitTest
+{
+    class DecodedSoundCacheTests;
+}
+
+namespace MiniAudio
+{
+    //! Keeps the decoded samples of recently played sounds, so sounds played over and over, like footsteps or impacts,
+    //! are decoded once instead of being decoded by every playback.
+    //! The decoded samples are registered with the resource manager of the engine, and the least recently used sounds
+    //! are removed once their size exceeds ma_decodedSoundCacheSize.
+    class DecodedSoundCache
+    {
+        friend class UnitTest::DecodedSoundCacheTests;
+
+    public:
+        AZ_RTTI(DecodedSoundCache, "{5C8E2A64-0C4D-4E3B-9C1F-7B2D8A6E4F13}");
+        AZ_CLASS_ALLOCATOR(DecodedSoundCache, AZ::SystemAllocator, 0);
+
+        explicit DecodedSoundCache(ma_engine* engine);
+        virtual ~DecodedSoundCache();
+
+        DecodedSoundCache(const DecodedSoundCache&) = delete;
+        DecodedSoundCache& operator=(const DecodedSoundCache&) = delete;
+
+        //! Decodes the sound if it isn't in the cache yet.
+        //! Each successful call must be matched by a call to ReleaseSound.
+        //! @return the name the decoded sound is registered with in the resource manager,
+        //! or an empty string if the sound can't be decoded or doesn't fit in the cache
+        AZStd::string AcquireSound(const SoundDataAsset& soundAsset);
+
+        //! Marks a sound acquired with AcquireSound as no longer used, it stays in the cache until it's the least recently used.
+        void ReleaseSound(const AZ::Data::AssetId& soundAssetId);
+
+        //! @return the size in bytes of the decoded samples in the cache
+        size_t GetCacheSize() const;
+
+    private:
+        struct CachedSound
+        {
+            AZStd::string m_name;
+            void* m_frames = nullptr;
+            size_t m_sizeInBytes = 0;
+            AZ::u32 m_useCount = 0;
+            AZStd::list<AZ::Data::AssetId>::iterator m_recentlyUsed;
+        };
+
+        //! Removes the least recently used sounds which aren't in use, until @sizeToFit fits in the budget.
+        //! @return true if @sizeToFit fits in the budget
+        bool EvictUnusedSounds(size_t sizeToFit);
+        void RemoveSound(CachedSound& sound);
+
+        ma_engine* m_engine = nullptr;
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZ::Data::AssetId, CachedSound> m_sounds;
+        //! Ids of the cached sounds, the most recently used first
+        AZStd::list<AZ::Data::AssetId> m_recentlyUsed;
+        size_t m_cacheSize = 0;
+    };
+
+    using DecodedSoundCacheInterface = AZ::Interface<DecodedSoundCache>;
+} // namespace MiniAudio
@@ -17,12 +17,13 @@ namespace MiniAudio
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<MiniAudioPlaybackComponentConfig>()
-                ->Version(4)
+                ->Version(5)
                 ->Field("Autoplay", &MiniAudioPlaybackComponentConfig::m_autoplayOnActivate)
                 ->Field("Sound", &MiniAudioPlaybackComponentConfig::m_sound)
                 ->Field("Volume", &MiniAudioPlaybackComponentConfig::m_volume)
                 ->Field("Auto-follow", &MiniAudioPlaybackComponentConfig::m_autoFollowEntity)
                 ->Field("Loop", &MiniAudioPlaybackComponentConfig::m_loop)
+                ->Field("Stream", &MiniAudioPlaybackComponentConfig::m_stream)
                 ->Field("Spatialization", &MiniAudioPlaybackComponentConfig::m_enableSpatialization)
                 ->Field("Fixed Direction", &MiniAudioPlaybackComponentConfig::m_fixedDirection)
                 ->Field("Direction", &MiniAudioPlaybackComponentConfig::m_direction)
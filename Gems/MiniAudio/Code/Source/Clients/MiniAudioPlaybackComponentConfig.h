@@ -49,6 +49,10 @@ namespace MiniAudio
         //! If true, loops the sound.
         bool m_loop = false;
 
+        //! If true, the sound is decoded while it plays instead of being decoded once and kept in memory,
+        //! which uses much less memory for long sounds like music and ambience.
+        bool m_stream = false;
+
         bool m_enableSpatialization = false;
         AttenuationModel m_attenuationModel = AttenuationModel::Inverse;
         float m_minimumDistance = 3.f;
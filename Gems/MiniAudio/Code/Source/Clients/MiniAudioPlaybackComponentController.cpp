@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/EditContext.h>
 
 #include "AzCore/Math/MathUtils.h"
+#include "DecodedSoundCache.h"
 #include "MiniAudioIncludes.h"
 
 namespace MiniAudio
@@ -335,20 +336,35 @@ namespace MiniAudio
         {
             if (GetConfiguration().m_sound.IsReady())
             {
-                m_soundName = GetConfiguration().m_sound.GetHint();
-
                 const auto& assetBuffer = GetConfiguration().m_sound->m_data;
                 if (assetBuffer.empty())
                 {
                     return;
                 }
 
-                ma_result result = ma_resource_manager_register_encoded_data(
-                    ma_engine_get_resource_manager(engine), m_soundName.c_str(), assetBuffer.data(), assetBuffer.size());
-                if (result != MA_SUCCESS)
+                // Short sounds play from samples decoded once and shared by all the components playing them,
+                // streamed sounds or sounds that don't fit in the cache are decoded from the compressed data while they play.
+                if (DecodedSoundCache* decodedSoundCache = DecodedSoundCacheInterface::Get(); decodedSoundCache && !m_config.m_stream)
                 {
-                    // An error occurred.
-                    return;
+                    m_decodedSoundName = decodedSoundCache->AcquireSound(GetConfiguration().m_sound);
+                    if (!m_decodedSoundName.empty())
+                    {
+                        m_decodedSoundAssetId = GetConfiguration().m_sound.GetId();
+                    }
+                }
+
+                ma_result result = MA_SUCCESS;
+                if (m_decodedSoundName.empty())
+                {
+                    m_soundName = GetConfiguration().m_sound.GetHint();
+                    result = ma_resource_manager_register_encoded_data(
+                        ma_engine_get_resource_manager(engine), m_soundName.c_str(), assetBuffer.data(), assetBuffer.size());
+                    if (result != MA_SUCCESS)
+                    {
+                        // An error occurred.
+                        m_soundName.clear();
+                        return;
+                    }
                 }
 
                 if (m_sound)
@@ -359,7 +375,8 @@ namespace MiniAudio
                 m_sound = AZStd::make_unique<ma_sound>();
 
                 const ma_uint32 flags = MA_SOUND_FLAG_DECODE;
-                result = ma_sound_init_from_file(engine, m_soundName.c_str(), flags, nullptr, nullptr, m_sound.get());
+                const AZStd::string& soundName = m_decodedSoundName.empty() ? m_soundName : m_decodedSoundName;
+                result = ma_sound_init_from_file(engine, soundName.c_str(), flags, nullptr, nullptr, m_sound.get());
                 if (result != MA_SUCCESS)
                 {
                     // An error occurred.
@@ -440,5 +457,15 @@ namespace MiniAudio
                 m_soundName.clear();
             }
         }
+
+        if (m_decodedSoundName.empty() == false)
+        {
+            if (DecodedSoundCache* decodedSoundCache = DecodedSoundCacheInterface::Get())
+            {
+                decodedSoundCache->ReleaseSound(m_decodedSoundAssetId);
+            }
+            m_decodedSoundName.clear();
+            m_decodedSoundAssetId = {};
+        }
     }
 } // namespace MiniAudio
@@ -96,5 +96,9 @@ namespace MiniAudio
 
         AZStd::unique_ptr<ma_sound> m_sound;
         AZStd::string m_soundName;
+
+        //! Set when the sound plays from the decoded samples of the DecodedSoundCache
+        AZStd::string m_decodedSoundName;
+        AZ::Data::AssetId m_decodedSoundAssetId;
     };
 } // namespace MiniAudio
@@ -12,6 +12,7 @@
 #include <MiniAudio/SoundAsset.h>
 #include <MiniAudio/SoundAssetRef.h>
 
+#include "DecodedSoundCache.h"
 #include "MiniAudioIncludes.h"
 #include "SoundAssetHandler.h"
 
@@ -98,6 +99,7 @@ namespace MiniAudio
         {
             AZ_Error("MiniAudio", false, "Failed to initialize audio engine, error %d", result);
         }
+        m_decodedSoundCache = AZStd::make_unique<DecodedSoundCache>(result == MA_SUCCESS ? m_engine.get() : nullptr);
 
         MiniAudioRequestBus::Handler::BusConnect();
 
@@ -113,6 +115,7 @@ namespace MiniAudio
     void MiniAudioSystemComponent::Deactivate()
     {
         m_assetHandlers.clear();
+        m_decodedSoundCache.reset();
         ma_engine_uninit(m_engine.get());
         m_engine.reset();
         MiniAudioRequestBus::Handler::BusDisconnect();
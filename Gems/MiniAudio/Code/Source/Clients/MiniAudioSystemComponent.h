@@ -20,6 +20,8 @@ struct ma_engine;
 
 namespace MiniAudio
 {
+    class DecodedSoundCache;
+
     class MiniAudioSystemComponent
         : public AZ::Component
         , public MiniAudioRequestBus::Handler
@@ -54,6 +56,9 @@ namespace MiniAudio
     private:
         std::unique_ptr<ma_engine> m_engine;
 
+        //! Decoded samples of the sounds which aren't streamed, shared by all the playback components
+        AZStd::unique_ptr<DecodedSoundCache> m_decodedSoundCache;
+
         float m_globalVolume = 1.f;
 
         // Number of audio output channels
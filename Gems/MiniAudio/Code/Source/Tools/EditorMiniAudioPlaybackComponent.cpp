@@ -76,6 +76,12 @@ namespace MiniAudio
                         "Autoplay",
                         "Plays the sound on activation of the component.")
                     ->DataElement(AZ::Edit::UIHandlers::Default, &MiniAudioPlaybackComponentConfig::m_loop, "Loop", "Loops the sound.")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &MiniAudioPlaybackComponentConfig::m_stream,
+                        "Stream",
+                        "Decodes the sound while it plays instead of keeping all of it decoded in memory. "
+                        "Recommended for long sounds like music and ambience.")
                     ->DataElement(
                         AZ::Edit::UIHandlers::Slider,
                         &MiniAudioPlaybackComponentConfig::m_volume,
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Clients/DecodedSoundCache.h>
+#include <Clients/MiniAudioIncludes.h>
+#include <Clients/SoundAssetHandler.h>
+
+namespace UnitTest
+{
+    //! Sound asset which is ready to play without being loaded by the asset manager
+    class TestSoundAsset
+        : public MiniAudio::SoundAsset
+    {
+    public:
+        TestSoundAsset(const AZ::Data::AssetId& assetId, AZStd::vector<AZ::u8> data)
+        {
+            m_assetId = assetId;
+            m_status = AssetStatus::Ready;
+            m_data = AZStd::move(data);
+        }
+    };
+
+    class DecodedSoundCacheTests
+        : public LeakDetectionFixture
+    {
+    public:
+        //! Size of the decoded samples of the test sounds, mono sounds are decoded to one 32-bit float per frame
+        static constexpr size_t SoundFrameCount = 1000;
+        static constexpr size_t DecodedSoundSize = SoundFrameCount * sizeof(float);
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            m_console = AZStd::make_unique<AZ::Console>();
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+            AZ::Data::AssetManager::Descriptor descriptor;
+            AZ::Data::AssetManager::Create(descriptor);
+            m_soundAssetHandler = AZStd::make_unique<MiniAudio::SoundAssetHandler>();
+
+            // The engine only manages the decoded resources, it doesn't need an audio device
+            ma_engine_config engineConfig = ma_engine_config_init();
+            engineConfig.noDevice = MA_TRUE;
+            engineConfig.channels = 2;
+            engineConfig.sampleRate = 48000;
+            ASSERT_EQ(ma_engine_init(&engineConfig, &m_engine), MA_SUCCESS);
+
+            // Room for two of the test sounds
+            SetCacheBudget(DecodedSoundSize * 2 + DecodedSoundSize / 2);
+            m_cache = AZStd::make_unique<MiniAudio::DecodedSoundCache>(&m_engine);
+        }
+
+        void TearDown() override
+        {
+            m_cache.reset();
+            m_sounds.clear();
+            ma_engine_uninit(&m_engine);
+
+            m_soundAssetHandler.reset();
+            AZ::Data::AssetManager::Destroy();
+
+            m_console->PerformCommand("ma_decodedSoundCacheSize 33554432");
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console.reset();
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        void SetCacheBudget(size_t budget)
+        {
+            m_console->PerformCommand(AZStd::string::format("ma_decodedSoundCacheSize %zu", budget).c_str());
+        }
+
+        //! Creates a ready sound asset holding a mono 16-bit wav file of @frameCount frames of silence
+        MiniAudio::SoundDataAsset& CreateSound(size_t frameCount = SoundFrameCount)
+        {
+            constexpr AZ::u16 channelCount = 1;
+            constexpr AZ::u16 bitsPerSample = 16;
+            constexpr AZ::u32 sampleRate = 48000;
+            const AZ::u32 dataSize = aznumeric_cast<AZ::u32>(frameCount * channelCount * bitsPerSample / 8);
+
+            AZStd::vector<AZ::u8> wav;
+            auto write = [&wav](const void* bytes, size_t size)
+            {
+                wav.insert(wav.end(), static_cast<const AZ::u8*>(bytes), static_cast<const AZ::u8*>(bytes) + size);
+            };
+            auto writeU32 = [&write](AZ::u32 value) { write(&value, sizeof(value)); };
+            auto writeU16 = [&write](AZ::u16 value) { write(&value, sizeof(value)); };
+
+            write("RIFF", 4);
+            writeU32(36 + dataSize);
+            write("WAVE", 4);
+            write("fmt ", 4);
+            writeU32(16);
+            writeU16(1); // PCM
+            writeU16(channelCount);
+            writeU32(sampleRate);
+            writeU32(sampleRate * channelCount * bitsPerSample / 8);
+            writeU16(channelCount * bitsPerSample / 8);
+            writeU16(bitsPerSample);
+            write("data", 4);
+            writeU32(dataSize);
+            wav.resize(wav.size() + dataSize, 0);
+
+            const AZ::Data::AssetId assetId(AZ::Uuid::CreateRandom(), MiniAudio::SoundAsset::AssetSubId);
+            return m_sounds.emplace_back(aznew TestSoundAsset(assetId, AZStd::move(wav)), AZ::Data::AssetLoadBehavior::Default);
+        }
+
+        //! Acquires the sound and releases it right away, so it's cached without being in use
+        void PlaySound(const MiniAudio::SoundDataAsset& sound)
+        {
+            EXPECT_FALSE(m_cache->AcquireSound(sound).empty());
+            m_cache->ReleaseSound(sound.GetId());
+        }
+
+        bool IsSoundCached(const MiniAudio::SoundDataAsset& sound) const
+        {
+            return m_cache->m_sounds.find(sound.GetId()) != m_cache->m_sounds.end();
+        }
+
+        //! @return the ids of the cached sounds, the most recently used first
+        AZStd::vector<AZ::Data::AssetId> GetRecentlyUsedSounds() const
+        {
+            return AZStd::vector<AZ::Data::AssetId>(m_cache->m_recentlyUsed.begin(), m_cache->m_recentlyUsed.end());
+        }
+
+        AZStd::unique_ptr<AZ::Console> m_console;
+        AZStd::unique_ptr<MiniAudio::SoundAssetHandler> m_soundAssetHandler;
+        ma_engine m_engine;
+        AZStd::unique_ptr<MiniAudio::DecodedSoundCache> m_cache;
+        AZStd::list<MiniAudio::SoundDataAsset> m_sounds;
+    };
+
+    TEST_F(DecodedSoundCacheTests, AcquireSound_SameSoundTwice_DecodedOnce)
+    {
+        const MiniAudio::SoundDataAsset& sound = CreateSound();
+
+        const AZStd::string name = m_cache->AcquireSound(sound);
+        EXPECT_FALSE(name.empty());
+        EXPECT_EQ(m_cache->AcquireSound(sound), name);
+        EXPECT_EQ(m_cache->GetCacheSize(), DecodedSoundSize);
+
+        // Released sounds stay in the cache
+        m_cache->ReleaseSound(sound.GetId());
+        m_cache->ReleaseSound(sound.GetId());
+        EXPECT_TRUE(IsSoundCached(sound));
+        EXPECT_EQ(m_cache->GetCacheSize(), DecodedSoundSize);
+    }
+
+    TEST_F(DecodedSoundCacheTests, AcquireSound_OverBudget_EvictsLeastRecentlyUsedSound)
+    {
+        const MiniAudio::SoundDataAsset& first = CreateSound();
+        const MiniAudio::SoundDataAsset& second = CreateSound();
+        const MiniAudio::SoundDataAsset& third = CreateSound();
+
+        PlaySound(first);
+        PlaySound(second);
+
+        // Playing the first sound again makes the second one the least recently used
+        PlaySound(first);
+        EXPECT_EQ(GetRecentlyUsedSounds(), AZStd::vector<AZ::Data::AssetId>({ first.GetId(), second.GetId() }));
+
+        PlaySound(third);
+        EXPECT_TRUE(IsSoundCached(first));
+        EXPECT_FALSE(IsSoundCached(second));
+        EXPECT_TRUE(IsSoundCached(third));
+        EXPECT_EQ(GetRecentlyUsedSounds(), AZStd::vector<AZ::Data::AssetId>({ third.GetId(), first.GetId() }));
+        EXPECT_EQ(m_cache->GetCacheSize(), DecodedSoundSize * 2);
+    }
+
+    TEST_F(DecodedSoundCacheTests, AcquireSound_CachedSoundsInUse_NotEvicted)
+    {
+        const MiniAudio::SoundDataAsset& first = CreateSound();
+        const MiniAudio::SoundDataAsset& second = CreateSound();
+        const MiniAudio::SoundDataAsset& third = CreateSound();
+
+        EXPECT_FALSE(m_cache->AcquireSound(first).empty());
+        EXPECT_FALSE(m_cache->AcquireSound(second).empty());
+
+        // Both cached sounds are playing, so the third one is decoded during playback instead
+        EXPECT_TRUE(m_cache->AcquireSound(third).empty());
+        EXPECT_FALSE(IsSoundCached(third));
+        EXPECT_EQ(m_cache->GetCacheSize(), DecodedSoundSize * 2);
+
+        // Once a sound is released it can be evicted for the third one
+        m_cache->ReleaseSound(first.GetId());
+        EXPECT_FALSE(m_cache->AcquireSound(third).empty());
+        EXPECT_FALSE(IsSoundCached(first));
+        EXPECT_TRUE(IsSoundCached(second));
+        EXPECT_EQ(m_cache->GetCacheSize(), DecodedSoundSize * 2);
+
+        m_cache->ReleaseSound(second.GetId());
+        m_cache->ReleaseSound(third.GetId());
+    }
+
+    TEST_F(DecodedSoundCacheTests, AcquireSound_LargerThanBudget_NotCached)
+    {
+        const MiniAudio::SoundDataAsset& sound = CreateSound(SoundFrameCount * 3);
+
+        EXPECT_TRUE(m_cache->AcquireSound(sound).empty());
+        EXPECT_FALSE(IsSoundCached(sound));
+        EXPECT_EQ(m_cache->GetCacheSize(), 0u);
+    }
+
+    TEST_F(DecodedSoundCacheTests, ReleaseSound_BudgetLowered_EvictsUnusedSounds)
+    {
+        const MiniAudio::SoundDataAsset& first = CreateSound();
+        const MiniAudio::SoundDataAsset& second = CreateSound();
+
+        EXPECT_FALSE(m_cache->AcquireSound(first).empty());
+        EXPECT_FALSE(m_cache->AcquireSound(second).empty());
+
+        SetCacheBudget(DecodedSoundSize);
+
+        // The first sound is released and evicted, the second one is still in use and only fits the budget by itself
+        m_cache->ReleaseSound(first.GetId());
+        EXPECT_FALSE(IsSoundCached(first));
+        EXPECT_TRUE(IsSoundCached(second));
+        EXPECT_EQ(m_cache->GetCacheSize(), DecodedSoundSize);
+
+        m_cache->ReleaseSound(second.GetId());
+        EXPECT_TRUE(IsSoundCached(second));
+        EXPECT_EQ(m_cache->GetCacheSize(), DecodedSoundSize);
+    }
+
+    TEST_F(DecodedSoundCacheTests, AcquireSound_ZeroBudget_NotCached)
+    {
+        SetCacheBudget(0);
+        const MiniAudio::SoundDataAsset& sound = CreateSound();
+
+        EXPECT_TRUE(m_cache->AcquireSound(sound).empty());
+        EXPECT_EQ(m_cache->GetCacheSize(), 0u);
+    }
+} // namespace UnitTest
+
+AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -8,6 +8,8 @@
 
 set(FILES
     Source/MiniAudioModuleInterface.h
+    Source/Clients/DecodedSoundCache.cpp
+    Source/Clients/DecodedSoundCache.h
     Source/Clients/MiniAudioImplementation.cpp
     Source/Clients/MiniAudioIncludes.h
     Source/Clients/MiniAudioListenerComponent.cpp
@@ -20,6 +20,7 @@
 
 #include <MCore/Source/AzCoreConversions.h>
 
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
@@ -102,6 +103,14 @@ namespace EMotionFX::MotionMatching
         return 0.0f;
     }
 
+    void Feature::CalculateFrameCosts(const size_t* frameIndices, size_t numFrames, const FrameCostContext& context, float* outCosts) const
+    {
+        for (size_t i = 0; i < numFrames; ++i)
+        {
+            outCosts[i] = CalculateFrameCost(frameIndices[i], context);
+        }
+    }
+
     void Feature::SetRelativeToNodeIndex(size_t nodeIndex)
     {
         m_relativeToNodeIndex = nodeIndex;
@@ -137,6 +146,41 @@ namespace EMotionFX::MotionMatching
         return CalcResidual(euclideanDistance);
     }
 
+    void Feature::CalculateVector3FrameCosts(const size_t* frameIndices, size_t numFrames, const FrameCostContext& context, float* outCosts) const
+    {
+        using AZ::Simd::Vec4;
+
+        const FeatureMatrix& featureMatrix = context.m_featureMatrix;
+        const AZ::Vector3 queryValue = context.m_queryVector.GetVector3(m_featureColumnOffset);
+        const Vec4::FloatType queryX = Vec4::Splat(queryValue.GetX());
+        const Vec4::FloatType queryY = Vec4::Splat(queryValue.GetY());
+        const Vec4::FloatType queryZ = Vec4::Splat(queryValue.GetZ());
+        const FeatureMatrix::Index column = m_featureColumnOffset;
+
+        // The frames are rows in the feature matrix, so the components of four frames are gathered into one register each.
+        size_t i = 0;
+        for (; i + 4 <= numFrames; i += 4)
+        {
+            const size_t* rows = frameIndices + i;
+            const Vec4::FloatType deltaX = Vec4::Sub(Vec4::LoadImmediate(
+                featureMatrix(rows[0], column + 0), featureMatrix(rows[1], column + 0), featureMatrix(rows[2], column + 0), featureMatrix(rows[3], column + 0)), queryX);
+            const Vec4::FloatType deltaY = Vec4::Sub(Vec4::LoadImmediate(
+                featureMatrix(rows[0], column + 1), featureMatrix(rows[1], column + 1), featureMatrix(rows[2], column + 1), featureMatrix(rows[3], column + 1)), queryY);
+            const Vec4::FloatType deltaZ = Vec4::Sub(Vec4::LoadImmediate(
+                featureMatrix(rows[0], column + 2), featureMatrix(rows[1], column + 2), featureMatrix(rows[2], column + 2), featureMatrix(rows[3], column + 2)), queryZ);
+
+            // The squared residual of the euclidean distance is the squared length, which doesn't need the square root.
+            const Vec4::FloatType lengthSq = Vec4::Madd(deltaX, deltaX, Vec4::Madd(deltaY, deltaY, Vec4::Mul(deltaZ, deltaZ)));
+            const Vec4::FloatType cost = (m_residualType == ResidualType::Squared) ? lengthSq : Vec4::Sqrt(lengthSq);
+            Vec4::StoreUnaligned(outCosts + i, cost);
+        }
+
+        for (; i < numFrames; ++i)
+        {
+            outCosts[i] = CalcResidual(queryValue, featureMatrix.GetVector3(frameIndices[i], column));
+        }
+    }
+
     AZ::Crc32 Feature::GetCostFactorVisibility() const
     {
         return AZ::Edit::PropertyVisibility::Show;
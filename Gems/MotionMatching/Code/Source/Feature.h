@@ -106,6 +106,13 @@ namespace EMotionFX::MotionMatching
         };
         virtual float CalculateFrameCost(size_t frameIndex, const FrameCostContext& context) const;
 
+        //! Calculate the feature costs for a batch of frames, equal to calling CalculateFrameCost() for each of them.
+        //! Features override this to evaluate several frames at once, the default implementation calls CalculateFrameCost() per frame.
+        //! @param frameIndices The frame indices (rows in the feature matrix) to calculate the costs for.
+        //! @param numFrames The number of frame indices.
+        //! @param[out] outCosts Receives the cost for each of the frames, not yet multiplied with the cost factor.
+        virtual void CalculateFrameCosts(const size_t* frameIndices, size_t numFrames, const FrameCostContext& context, float* outCosts) const;
+
         //! Specifies how the feature value differences (residuals), between the input query values
         //! and the frames in the motion database that sum up the feature cost, are calculated.
         enum ResidualType
@@ -164,6 +171,9 @@ namespace EMotionFX::MotionMatching
         float CalcResidual(float value) const;
         float CalcResidual(const AZ::Vector3& a, const AZ::Vector3& b) const;
 
+        //! Batched version of CalcResidual(a, b) for three dimensional features, comparing the query vector and the frames four at a time using SIMD.
+        void CalculateVector3FrameCosts(const size_t* frameIndices, size_t numFrames, const FrameCostContext& context, float* outCosts) const;
+
         virtual AZ::Crc32 GetCostFactorVisibility() const;
 
         // Shared and reflected data.
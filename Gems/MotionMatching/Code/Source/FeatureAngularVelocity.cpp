@@ -62,6 +62,11 @@ namespace EMotionFX::MotionMatching
         return CalcResidual(queryVelocity, frameVelocity);
     }
 
+    void FeatureAngularVelocity::CalculateFrameCosts(const size_t* frameIndices, size_t numFrames, const FrameCostContext& context, float* outCosts) const
+    {
+        CalculateVector3FrameCosts(frameIndices, numFrames, context, outCosts);
+    }
+
     void FeatureAngularVelocity::DebugDraw(
         AzFramework::DebugDisplayRequests& debugDisplay,
         const Pose& pose,
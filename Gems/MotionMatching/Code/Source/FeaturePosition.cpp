@@ -51,6 +51,11 @@ namespace EMotionFX::MotionMatching
         return CalcResidual(queryPosition, framePosition);
     }
 
+    void FeaturePosition::CalculateFrameCosts(const size_t* frameIndices, size_t numFrames, const FrameCostContext& context, float* outCosts) const
+    {
+        CalculateVector3FrameCosts(frameIndices, numFrames, context, outCosts);
+    }
+
     void FeaturePosition::DebugDraw(AzFramework::DebugDisplayRequests& debugDisplay,
         const Pose& currentPose,
         const FeatureMatrix& featureMatrix,
@@ -39,6 +39,7 @@ namespace EMotionFX::MotionMatching
         void ExtractFeatureValues(const ExtractFeatureContext& context) override;
         void FillQueryVector(QueryVector& queryVector, const QueryVectorContext& context) override;
         float CalculateFrameCost(size_t frameIndex, const FrameCostContext& context) const override;
+        void CalculateFrameCosts(const size_t* frameIndices, size_t numFrames, const FrameCostContext& context, float* outCosts) const override;
 
         void DebugDraw(AzFramework::DebugDisplayRequests& debugDisplay,
             const Pose& currentPose,
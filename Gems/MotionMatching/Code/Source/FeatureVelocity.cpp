@@ -65,6 +65,11 @@ namespace EMotionFX::MotionMatching
         return CalcResidual(queryVelocity, frameVelocity);
     }
 
+    void FeatureVelocity::CalculateFrameCosts(const size_t* frameIndices, size_t numFrames, const FrameCostContext& context, float* outCosts) const
+    {
+        CalculateVector3FrameCosts(frameIndices, numFrames, context, outCosts);
+    }
+
     void FeatureVelocity::DebugDraw(AzFramework::DebugDisplayRequests& debugDisplay,
         const Pose& pose,
         const AZ::Vector3& velocity,
@@ -531,69 +531,93 @@ namespace EMotionFX::MotionMatching
         // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
         float minCost = FLT_MAX;
         size_t minCostFrameIndex = 0;
-        m_tempCosts.resize(featureSchema.GetNumFeatures());
-        m_minCosts.resize(featureSchema.GetNumFeatures());
+        const size_t numFeatures = featureSchema.GetNumFeatures();
+        m_minCosts.resize(numFeatures);
         float minTrajectoryPastCost = 0.0f;
         float minTrajectoryFutureCost = 0.0f;
 
-        // Iterate through the frames filtered by the broad-phase search.
+        // Gather the frames filtered by the broad-phase search.
         const size_t numFrames = mm_useKdTree ? m_nearestFrames.size() : frameDatabase.GetNumFrames();
+        m_candidateFrames.clear();
+        m_candidateFrames.reserve(numFrames);
         for (size_t i = 0; i < numFrames; ++i)
         {
             const size_t frameIndex = mm_useKdTree ? m_nearestFrames[i] : i;
             const Frame& frame = frameDatabase.GetFrame(frameIndex);
 
             // TODO: This shouldn't be there, we should be discarding the frames when extracting the features and not at runtime when checking the cost.
-            if (frame.GetSampleTime() >= frame.GetSourceMotion()->GetDuration() - 1.0f)
+            if (frame.GetSampleTime() < frame.GetSourceMotion()->GetDuration() - 1.0f)
             {
-                continue;
+                m_candidateFrames.emplace_back(frameIndex);
             }
+        }
 
-            float frameCost = 0.0f;
+        // Calculate the feature costs for blocks of frames at once, so the features can evaluate several frames in a single pass over the feature matrix.
+        m_tempCosts.resize(numFeatures * s_frameCostBlockSize);
+        m_blockFrameCosts.resize(s_frameCostBlockSize);
+        for (size_t blockStart = 0; blockStart < m_candidateFrames.size(); blockStart += s_frameCostBlockSize)
+        {
+            const size_t* blockFrames = m_candidateFrames.data() + blockStart;
+            const size_t blockSize = AZStd::min(s_frameCostBlockSize, m_candidateFrames.size() - blockStart);
+            AZStd::fill(m_blockFrameCosts.begin(), m_blockFrameCosts.begin() + blockSize, 0.0f);
 
-            // Calculate the frame cost by accumulating the weighted feature costs.
-            for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
+            // Accumulate the weighted feature costs.
+            for (size_t featureIndex = 0; featureIndex < numFeatures; ++featureIndex)
             {
                 Feature* feature = featureSchema.GetFeature(featureIndex);
                 if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
                 {
-                    const float featureCost = feature->CalculateFrameCost(frameIndex, frameCostContext);
-                    const float featureCostFactor = feature->GetCostFactor();
-                    const float featureFinalCost = featureCost * featureCostFactor;
+                    float* featureCosts = &m_tempCosts[featureIndex * s_frameCostBlockSize];
+                    feature->CalculateFrameCosts(blockFrames, blockSize, frameCostContext, featureCosts);
 
-                    frameCost += featureFinalCost;
-                    m_tempCosts[featureIndex] = featureFinalCost;
+                    const float featureCostFactor = feature->GetCostFactor();
+                    for (size_t i = 0; i < blockSize; ++i)
+                    {
+                        featureCosts[i] *= featureCostFactor;
+                        m_blockFrameCosts[i] += featureCosts[i];
+                    }
                 }
             }
 
-            // Manually add the trajectory cost.
-            float trajectoryPastCost = 0.0f;
-            float trajectoryFutureCost = 0.0f;
-            if (trajectoryFeature)
+            for (size_t i = 0; i < blockSize; ++i)
             {
-                trajectoryPastCost = trajectoryFeature->CalculatePastFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetPastCostFactor();
-                trajectoryFutureCost = trajectoryFeature->CalculateFutureFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetFutureCostFactor();
-                frameCost += trajectoryPastCost;
-                frameCost += trajectoryFutureCost;
-            }
+                // All costs are positive, so frames that already cost more than the best frame so far can skip the more expensive trajectory cost.
+                float frameCost = m_blockFrameCosts[i];
+                if (frameCost >= minCost)
+                {
+                    continue;
+                }
 
-            // Track the minimum feature and frame costs.
-            if (frameCost < minCost)
-            {
-                minCost = frameCost;
-                minCostFrameIndex = frameIndex;
+                // Manually add the trajectory cost.
+                const size_t frameIndex = blockFrames[i];
+                float trajectoryPastCost = 0.0f;
+                float trajectoryFutureCost = 0.0f;
+                if (trajectoryFeature)
+                {
+                    trajectoryPastCost = trajectoryFeature->CalculatePastFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetPastCostFactor();
+                    trajectoryFutureCost = trajectoryFeature->CalculateFutureFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetFutureCostFactor();
+                    frameCost += trajectoryPastCost;
+                    frameCost += trajectoryFutureCost;
+                }
 
-                for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
+                // Track the minimum feature and frame costs.
+                if (frameCost < minCost)
                 {
-                    Feature* feature = featureSchema.GetFeature(featureIndex);
-                    if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
+                    minCost = frameCost;
+                    minCostFrameIndex = frameIndex;
+
+                    for (size_t featureIndex = 0; featureIndex < numFeatures; ++featureIndex)
                     {
-                        m_minCosts[featureIndex] = m_tempCosts[featureIndex];
+                        Feature* feature = featureSchema.GetFeature(featureIndex);
+                        if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
+                        {
+                            m_minCosts[featureIndex] = m_tempCosts[featureIndex * s_frameCostBlockSize + i];
+                        }
                     }
-                }
 
-                minTrajectoryPastCost = trajectoryPastCost;
-                minTrajectoryFutureCost = trajectoryFutureCost;
+                    minTrajectoryPastCost = trajectoryPastCost;
+                    minTrajectoryFutureCost = trajectoryFutureCost;
+                }
             }
         }
 
@@ -121,7 +121,10 @@ namespace EMotionFX::MotionMatching
         float m_blendProgressTime = 0.0f; //< How long are we already blending? In seconds.
 
         /// Buffers used for FindLowestCostFrameIndex().
-        AZStd::vector<float> m_tempCosts;
+        static constexpr size_t s_frameCostBlockSize = 64; //!< The number of frames the feature costs are calculated for at once.
+        AZStd::vector<size_t> m_candidateFrames; //!< The frames to calculate the costs for, after the broad-phase search.
+        AZStd::vector<float> m_tempCosts; //!< The weighted feature costs for the current block of frames, s_frameCostBlockSize values per feature.
+        AZStd::vector<float> m_blockFrameCosts; //!< The accumulated feature costs, without the trajectory, for the current block of frames.
         AZStd::vector<float> m_minCosts;
     };
 } // namespace EMotionFX::MotionMatching
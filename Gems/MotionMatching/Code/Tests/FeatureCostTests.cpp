@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Fixture.h>
+#include <FeatureMatrix.h>
+#include <FeaturePosition.h>
+#include <QueryVector.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class FeatureCostFixture
+        : public Fixture
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            // The position feature is stored in columns 1-3, with one unrelated column in front.
+            const size_t numFrames = 7;
+            m_featureMatrix.resize(numFrames, 4);
+            for (size_t row = 0; row < numFrames; ++row)
+            {
+                m_featureMatrix(row, 0) = 100.0f;
+                m_featureMatrix.SetVector3(row, 1, AZ::Vector3(row * 0.5f, -1.0f * row, 2.0f + row * row));
+                m_frameIndices.emplace_back(numFrames - 1 - row);
+            }
+
+            m_queryVector.Resize(4);
+            m_queryVector.SetVector3(AZ::Vector3(1.0f, -2.0f, 3.0f), 1);
+
+            m_feature.SetColumnOffset(1);
+        }
+
+        FeatureMatrix m_featureMatrix;
+        QueryVector m_queryVector;
+        FeaturePosition m_feature;
+        AZStd::vector<size_t> m_frameIndices;
+    };
+
+    TEST_F(FeatureCostFixture, BatchedCostsMatchFrameCosts)
+    {
+        const Feature::FrameCostContext context(m_queryVector, m_featureMatrix);
+
+        // Seven frames cover one batch of four frames and the remaining three.
+        AZStd::vector<float> costs(m_frameIndices.size());
+        m_feature.CalculateFrameCosts(m_frameIndices.data(), m_frameIndices.size(), context, costs.data());
+        for (size_t i = 0; i < m_frameIndices.size(); ++i)
+        {
+            EXPECT_NEAR(costs[i], m_feature.CalculateFrameCost(m_frameIndices[i], context), 0.0001f);
+        }
+    }
+} // namespace EMotionFX::MotionMatching
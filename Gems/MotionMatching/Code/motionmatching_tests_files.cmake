@@ -8,6 +8,7 @@
 
 set(FILES
     Tests/Fixture.h
+    Tests/FeatureCostTests.cpp
     Tests/FeatureMatrixTests.cpp
     Tests/FeatureSchemaTests.cpp
     Tests/MinMaxScalerTests.cpp
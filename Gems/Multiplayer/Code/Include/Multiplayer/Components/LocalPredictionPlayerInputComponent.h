@@ -110,6 +110,10 @@ namespace Multiplayer
         ClientMigrationEndEvent::Handler m_migrateEndHandler;
 
         double m_moveAccumulator = 0.0;
+
+        // Input array reused for every input the client sends, so its component inputs are only allocated once
+        NetworkInputArray m_clientInputArray;
+        bool m_clientInputArrayAttached = false;
 #endif
 
 #if AZ_TRAIT_SERVER
@@ -12,6 +12,7 @@
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/DataStructures/FixedSizeBitsetView.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <Multiplayer/NetworkTime/RewindableObject.h>
 #include <Multiplayer/MultiplayerStats.h>
 #include <Multiplayer/MultiplayerTypes.h>
 #include <Multiplayer/IMultiplayer.h>
@@ -163,6 +164,65 @@ namespace Multiplayer
         }
     }
 
+    //! Serializes a plain network property value through SERIALIZE_TYPE.
+    template <typename SERIALIZE_TYPE, typename TYPE>
+    inline bool SerializeNetworkPropertyAs(AzNetworking::ISerializer& serializer, TYPE& value, const char* name)
+    {
+        SERIALIZE_TYPE serializeValue(value);
+        if (serializer.Serialize(serializeValue, name) && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+        {
+            value = static_cast<TYPE>(serializeValue);
+        }
+        return serializer.IsValid();
+    }
+
+    //! Serializes a rewindable network property value through SERIALIZE_TYPE, using the value for the current rewind time.
+    template <typename SERIALIZE_TYPE, typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline bool SerializeNetworkPropertyAs(AzNetworking::ISerializer& serializer, RewindableObject<BASE_TYPE, REWIND_SIZE>& value, const char* name)
+    {
+        // Matches the object scope the serializer adds when serializing the rewindable object itself
+        if (serializer.BeginObject(name))
+        {
+            if (value.template SerializeAs<SERIALIZE_TYPE>(serializer))
+            {
+                return serializer.EndObject(name);
+            }
+        }
+        return false;
+    }
+
+    //! Serializes a network property through SERIALIZE_TYPE rather than through its own type.
+    //! This is used by network properties that declare a SerializeAs type in their AutoComponent xml, typically to replicate a
+    //! quantized representation of the value, like AzNetworking::QuantizedValues or AzNetworking::QuantizedQuaternion.
+    template <typename SERIALIZE_TYPE, typename TYPE>
+    inline void SerializeNetworkPropertyHelperAs
+    (
+        AzNetworking::ISerializer& serializer,
+        AzNetworking::FixedSizeBitsetView& bitset,
+        int32_t bitIndex,
+        TYPE& value,
+        const char* name,
+        NetComponentId componentId,
+        PropertyIndex propertyIndex,
+        MultiplayerStats& stats
+    )
+    {
+        if (bitset.GetBit(bitIndex))
+        {
+            const bool modifyRecord = serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject;
+            const uint32_t prevUpdateSize = serializer.GetSize();
+            serializer.ClearTrackedChangesFlag();
+            SerializeNetworkPropertyAs<SERIALIZE_TYPE>(serializer, value, name);
+            if (modifyRecord && !serializer.GetTrackedChangesFlag())
+            {
+                // If the serializer didn't change any values, then lower the flag so we don't unnecessarily notify
+                bitset.SetBit(bitIndex, false);
+            }
+            const uint32_t postUpdateSize = serializer.GetSize();
+            UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats);
+        }
+    }
+
     template <typename TYPE, AZStd::size_t SIZE>
     inline void SerializeNetworkPropertyHelperArray
     (
@@ -41,6 +41,11 @@ namespace Multiplayer
         //! @return pointer to the allocated component input, caller assumes ownership
         AZStd::unique_ptr<IMultiplayerComponentInput> AllocateComponentInput(NetComponentId netComponentId);
 
+        //! Returns a default constructed component input for the provided netComponentId, used to reset reused inputs without allocating.
+        //! @param  netComponentId the NetComponentId to return the default component input of
+        //! @return pointer to the default component input, or nullptr if the component has no inputs
+        const IMultiplayerComponentInput* GetDefaultComponentInput(NetComponentId netComponentId) const;
+
         //! Returns the gem name associated with the provided NetComponentId.
         //! @param  netComponentId the NetComponentId to return the gem name of
         //! @return the name of the gem that contains the requested component
@@ -87,6 +92,7 @@ namespace Multiplayer
     private:
         NetComponentId m_nextNetComponentId = NetComponentId{ 0 };
         AZStd::unordered_map<NetComponentId, ComponentData> m_componentData;
+        AZStd::unordered_map<NetComponentId, AZStd::unique_ptr<IMultiplayerComponentInput>> m_defaultComponentInputs;
         AZ::HashValue64 m_systemVersionHash = AZ::HashValue64{ 0 };
         Multiplayer::ComponentVersionMap m_componentVersionHashes;
     };
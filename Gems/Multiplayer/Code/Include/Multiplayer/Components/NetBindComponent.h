@@ -13,8 +13,11 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/ring_buffer.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
@@ -196,8 +199,35 @@ namespace Multiplayer
         bool SerializeEntityCorrection(AzNetworking::ISerializer& serializer);
 
         bool SerializeStateDeltaMessage(ReplicationRecord& replicationRecord, AzNetworking::ISerializer& serializer);
+
+        //! Writes the replication record and the state delta for it into the buffer.
+        //! Connections that send the same record in the same host frame share a single serialization of the entity state,
+        //! so this is safe to call from multiple connection updates concurrently.
+        //! @param replicationRecord the record of the properties to serialize
+        //! @param outBuffer         the buffer to write the serialized record and state delta to
+        //! @return boolean true on success, false if serialization failed
+        bool SerializeSharedStateDeltaMessage(ReplicationRecord& replicationRecord, AzNetworking::PacketEncodingBuffer& outBuffer);
         void NotifyStateDeltaChanges(ReplicationRecord& replicationRecord);
 
+        //! Serializes the complete state replicated to the remote role into a snapshot, kept for a limited number of later snapshots.
+        //! The snapshot is shared until the entity is marked dirty, so this is safe to call from multiple connection updates concurrently.
+        //! @param remoteNetEntityRole the role of the endpoint the state is replicated to
+        //! @return the id of the snapshot, InvalidEntitySnapshotId if serialization failed
+        EntitySnapshotId CaptureStateSnapshot(NetEntityRole remoteNetEntityRole);
+
+        //! Clears the changes of every component whose state in the current snapshot is the same as in all the baseline snapshots.
+        //! The remote endpoint already holds the state of such a component, so it doesn't need to be sent again.
+        //! @param replicationRecord   the record to remove the unchanged component states from
+        //! @param currentSnapshotId   the snapshot of the state the record is about to be sent with
+        //! @param baselineSnapshotIds the snapshots of every state the remote endpoint may hold
+        //! @return boolean true if the snapshots were compared, false if any of them is no longer available and the record was left unchanged
+        bool RemoveUnchangedComponentStates
+        (
+            ReplicationRecord& replicationRecord,
+            EntitySnapshotId currentSnapshotId,
+            const AZStd::vector<EntitySnapshotId>& baselineSnapshotIds
+        );
+
         void FillReplicationRecord(ReplicationRecord& replicationRecord) const;
         void FillTotalReplicationRecord(ReplicationRecord& replicationRecord) const;
 
@@ -265,6 +295,50 @@ namespace Multiplayer
 
         AzNetworking::ConnectionId m_owningConnectionId = AzNetworking::InvalidConnectionId;
 
+        //! A state delta that was serialized for a replication record during the current host frame.
+        struct SharedStateDelta
+        {
+            ReplicationRecord m_record;
+            AZStd::vector<uint8_t> m_data;
+        };
+        AZStd::vector<SharedStateDelta> m_sharedStateDeltas;
+
+        //! A state delta of a single component that was serialized during the current host frame.
+        //! Records that differ only in the changes of other components reuse the block instead of serializing the component again.
+        struct SharedComponentBlock
+        {
+            NetEntityRole m_remoteNetEntityRole = NetEntityRole::InvalidRole;
+            ReplicationRecordStats m_consumedBits;
+            AZStd::vector<uint8_t> m_changes;
+            AZStd::vector<uint8_t> m_data;
+        };
+        bool SerializeSharedComponentBlocks(ReplicationRecord& replicationRecord, AzNetworking::PacketEncodingBuffer& outBuffer, AZStd::size_t& inOutSize);
+        AZStd::vector<AZStd::vector<SharedComponentBlock>> m_sharedComponentBlocks;
+        HostFrameId m_sharedStateDeltaFrameId = InvalidHostFrameId;
+
+        //! The serialized state of a single component in a state snapshot.
+        struct ComponentStateSnapshot
+        {
+            ReplicationRecordStats m_startBits;
+            ReplicationRecordStats m_consumedBits;
+            AZStd::vector<uint8_t> m_changes;
+            AZStd::vector<uint8_t> m_data;
+        };
+
+        //! The complete state replicated to a remote role at the time the snapshot was captured.
+        //! A snapshot is current until the entity is marked dirty again.
+        struct StateSnapshot
+        {
+            EntitySnapshotId m_snapshotId = InvalidEntitySnapshotId;
+            NetEntityRole m_remoteNetEntityRole = NetEntityRole::InvalidRole;
+            bool m_isCurrent = false;
+            AZStd::vector<ComponentStateSnapshot> m_componentStates;
+        };
+        const StateSnapshot* FindStateSnapshot(EntitySnapshotId snapshotId) const;
+        AZStd::ring_buffer<StateSnapshot> m_stateSnapshots;
+        EntitySnapshotId m_nextStateSnapshotId = EntitySnapshotId{ 0 };
+        AZStd::mutex m_sharedStateDeltaMutex;
+
         bool m_isProcessingInput    = false; // Set to true when we are processing input
         bool m_isReprocessingInput  = false; // Set to true when we are reprocessing input (during a correction)
         bool m_isMigrationDataValid = false;
@@ -10,6 +10,7 @@
 
 #include <Source/AutoGen/NetworkHitVolumesComponent.AutoComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkTime/IHitVolumeHistory.h>
 #include <Integration/ActorComponentBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
@@ -53,6 +54,7 @@ namespace Multiplayer
             const Physics::ColliderConfiguration* m_colliderConfig = nullptr;
             const Physics::ShapeConfiguration* m_shapeConfig = nullptr;
             AZ::Transform m_colliderOffSetTransform;
+            HitVolumeShape m_historyShape;
             const AZ::u32 m_jointIndex = 0;
         };
 
@@ -67,6 +69,9 @@ namespace Multiplayer
         void OnDeactivate(Multiplayer::EntityIsMigrating entityIsMigrating) override;
 
     private:
+        friend class NetworkHitVolumesTests;
+
+
         void OnPreRender(float deltaTime);
         void OnTransformUpdate(const AZ::Transform& transform);
         void OnSyncRewind();
@@ -86,6 +91,7 @@ namespace Multiplayer
         void OnCharacterDeactivated(const AZ::EntityId& entityId) override;
         //! @}
 
+        void RecordHitVolumeHistory();
         void DrawDebugHitVolumes();
 
         Physics::CharacterRequests* m_physicsCharacter = nullptr;
@@ -67,6 +67,10 @@ namespace Multiplayer
     AZ_TYPE_SAFE_INTEGRAL(HostFrameId, uint32_t);
     static constexpr HostFrameId InvalidHostFrameId = HostFrameId{ AzPhysics::SimulatedBody::UndefinedFrameId };
 
+    //! Identifies a snapshot of the replicated state of an entity, see NetBindComponent::CaptureStateSnapshot.
+    AZ_TYPE_SAFE_INTEGRAL(EntitySnapshotId, uint32_t);
+    static constexpr EntitySnapshotId InvalidEntitySnapshotId = static_cast<EntitySnapshotId>(-1);
+
     using LongNetworkString = AZ::CVarFixedString;
     using ReliabilityType = AzNetworking::ReliabilityType;
 
@@ -20,6 +20,7 @@
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/limits.h>
@@ -121,6 +122,8 @@ namespace Multiplayer
 
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
+        void SelectBudgetedProxyUpdates(AZStd::vector<EntityReplicator*>& proxyReplicators, EntityReplicatorList& toSendList);
+        void RefillBandwidthBudget();
 
         void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
@@ -195,6 +198,10 @@ namespace Multiplayer
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
 
+        // Pending latest-value-wins rpcs by entity and rpc, so a newer invocation replaces the unsent one
+        using RpcKey = AZStd::pair<NetEntityId, uint32_t>;
+        AZStd::unordered_map<RpcKey, RpcMessages::iterator> m_deferredLatestValueRpcs;
+
         AZ::Event<NetEntityId> m_autonomousEntityReplicatorCreated;
         EntityExitDomainEvent::Handler m_entityExitDomainEventHandler;
         SendMigrateEntityEvent m_sendMigrateEntityEvent;
@@ -216,9 +223,12 @@ namespace Multiplayer
         HostId m_remoteHostId = InvalidHostId;
         uint32_t m_maxRemoteEntitiesPendingCreationCount = AZStd::numeric_limits<uint32_t>::max();
         uint32_t m_maxPayloadSize = 0;
+        int64_t m_bandwidthBudgetBytes = 0;
+        AZ::TimeMs m_bandwidthBudgetTimeMs = AZ::Time::ZeroTimeMs;
         Mode m_updateMode = Mode::Invalid;
 
         friend class EntityReplicator;
+        friend class ReplicationBudgetTests;
     };
 }
 
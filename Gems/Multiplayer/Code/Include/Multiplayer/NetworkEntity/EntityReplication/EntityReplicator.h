@@ -88,6 +88,14 @@ namespace Multiplayer
         //! After sending a generated packet, record the sent packet id for tracking acknowledgements.
         void RecordSentPacketId(AzNetworking::PacketId sentId);
 
+        // Interface for ReplicationManager to manage bandwidth budgets
+        //! Returns the serialized size of the last update sent, used to estimate the cost of the next update.
+        uint32_t GetLastUpdateSize() const;
+        void SetLastUpdateSize(uint32_t updateSize);
+        //! Returns how many consecutive sends this replicator's updates were deferred by the connection's bandwidth budget.
+        uint32_t GetBudgetDeferralCount() const;
+        void SetBudgetDeferralCount(uint32_t deferralCount);
+
         // Interface for ReplicationManager to manage receiving entity changes
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges);
         bool IsPacketIdValid(AzNetworking::PacketId packetId) const;
@@ -157,6 +165,9 @@ namespace Multiplayer
         NetEntityRole m_boundLocalNetworkRole;
         NetEntityRole m_remoteNetworkRole;
 
+        uint32_t m_lastUpdateSize = 0;
+        uint32_t m_budgetDeferralCount = 0;
+
         bool m_wasMigrated = false;
         bool m_isForwardingRpc = false;
         bool m_prefabEntityIdSet = false;
@@ -50,4 +50,24 @@ namespace Multiplayer
     {
         m_wasMigrated = wasMigrated;
     }
+
+    inline uint32_t EntityReplicator::GetLastUpdateSize() const
+    {
+        return m_lastUpdateSize;
+    }
+
+    inline void EntityReplicator::SetLastUpdateSize(uint32_t updateSize)
+    {
+        m_lastUpdateSize = updateSize;
+    }
+
+    inline uint32_t EntityReplicator::GetBudgetDeferralCount() const
+    {
+        return m_budgetDeferralCount;
+    }
+
+    inline void EntityReplicator::SetBudgetDeferralCount(uint32_t deferralCount)
+    {
+        m_budgetDeferralCount = deferralCount;
+    }
 }
@@ -12,6 +12,7 @@
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace Multiplayer
 {
@@ -55,6 +56,23 @@ namespace Multiplayer
         void Subtract(const ReplicationRecord &rhs);
         bool HasChanges() const;
 
+        //! Returns true if both records are for the same remote role and have the same bits set.
+        //! Consumed bit counts and the sent packet id are not compared.
+        bool HasSameChanges(const ReplicationRecord& rhs) const;
+
+        //! Appends the remote role and the bits of each bitset in the range starting at startBits, one byte per bit.
+        //! This is used to compare the changes of a single component between records.
+        //! @param outChanges the vector to append the changes to
+        //! @param startBits  the first bit of the range in each bitset
+        //! @param bitCounts  the number of bits in the range in each bitset
+        void GetChangesInRange(AZStd::vector<uint8_t>& outChanges, const ReplicationRecordStats& startBits, const ReplicationRecordStats& bitCounts) const;
+
+        //! Clears the bits of each bitset in the range starting at startBits.
+        //! This is used to remove the changes of a single component from the record.
+        //! @param startBits the first bit of the range in each bitset
+        //! @param bitCounts the number of bits in the range in each bitset
+        void ClearChangesInRange(const ReplicationRecordStats& startBits, const ReplicationRecordStats& bitCounts);
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
         void ConsumeAuthorityToClientBits(uint32_t consumedBits);
@@ -88,6 +106,9 @@ namespace Multiplayer
         // Sequence number this ReplicationRecord was sent on
         AzNetworking::PacketId m_sentPacketId = AzNetworking::InvalidPacketId;
 
+        // Snapshot of the entity state this ReplicationRecord was sent with, the baseline for later records once it's acknowledged
+        EntitySnapshotId m_sentSnapshotId = InvalidEntitySnapshotId;
+
         NetEntityRole m_remoteNetEntityRole = NetEntityRole::InvalidRole;;
     };
 }
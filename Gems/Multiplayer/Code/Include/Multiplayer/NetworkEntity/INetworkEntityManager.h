@@ -19,6 +19,7 @@ namespace Multiplayer
 {
     class NetworkEntityTracker;
     class NetworkEntityAuthorityTracker;
+    class NetworkEntityInterestGrid;
     class NetworkEntityRpcMessage;
     class MultiplayerComponentRegistry;
     class IEntityDomain;
@@ -60,6 +61,10 @@ namespace Multiplayer
         //! @return the NetworkEntityAuthorityTracker for this INetworkEntityManager instance
         virtual NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() = 0;
 
+        //! Returns the NetworkEntityInterestGrid for this INetworkEntityManager instance.
+        //! @return the NetworkEntityInterestGrid for this INetworkEntityManager instance, nullptr if interest management isn't supported
+        virtual NetworkEntityInterestGrid* GetNetworkEntityInterestGrid() = 0;
+
         //! Returns the MultiplayerComponentRegistry for this INetworkEntityManager instance.
         //! @return the MultiplayerComponentRegistry for this INetworkEntityManager instance
         virtual MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() = 0;
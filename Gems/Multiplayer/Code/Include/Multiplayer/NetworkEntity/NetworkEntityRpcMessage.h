@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/AzContainerSerializers.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
@@ -44,6 +45,13 @@ namespace Multiplayer
         //! @return an estimated serialization footprint for this NetworkEntityRpcMessage
         uint32_t GetEstimatedSerializeSize() const;
 
+        //! Returns an estimated serialization footprint for this NetworkEntityRpcMessage inside an aggregated NetworkEntityRpcVector.
+        //! The entityId and rpc identifiers are written once per packet in a dictionary, messages only reference them by index.
+        //! @param isNewEntity true if the entityId of this message isn't in the dictionary of the packet yet
+        //! @param isNewRpc    true if the componentId and rpcIndex of this message aren't in the dictionary of the packet yet
+        //! @return an estimated serialization footprint for this NetworkEntityRpcMessage inside an aggregated packet
+        uint32_t GetEstimatedAggregatedSerializeSize(bool isNewEntity, bool isNewRpc) const;
+
         //! Gets the current value of RpcDeliveryType.
         //! @return the current value of RpcDeliveryType
         RpcDeliveryType GetRpcDeliveryType() const;
@@ -77,6 +85,12 @@ namespace Multiplayer
         //! @return boolean true for success, false for serialization failure
         bool Serialize(AzNetworking::ISerializer& serializer);
 
+        //! Serializes the delivery type and params of this rpc, without the entity and rpc identifiers.
+        //! Used by the aggregated NetworkEntityRpcVector serializer which writes the identifiers in a shared dictionary.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool SerializePayload(AzNetworking::ISerializer& serializer);
+
         //! Sets this RPC's reliable delivery flag.
         //! @param reliabilityType the reliability type for this RPC
         void SetReliability(ReliabilityType reliabilityType);
@@ -85,6 +99,15 @@ namespace Multiplayer
         //! @return the reliability type of this RPC
         ReliabilityType GetReliability() const;
 
+        //! Flags this RPC as only carrying the latest state, so a newer invocation on the same entity replaces it if neither was sent yet.
+        //! Only applies to unreliable RPCs, reliable RPCs are always all delivered.
+        //! @param latestValueWins true if a newer invocation of this rpc supersedes this one
+        void SetLatestValueWins(bool latestValueWins);
+
+        //! Returns whether or not a newer invocation of this RPC supersedes this one.
+        //! @return true if a newer invocation of this rpc supersedes this one
+        bool IsLatestValueWins() const;
+
     private:
 
         // Serialized payload data
@@ -99,8 +122,23 @@ namespace Multiplayer
 
         // Non-serialized RPC metadata
         ReliabilityType m_isReliable = ReliabilityType::Reliable;
+        bool m_latestValueWins = false;
     };
     using NetworkEntityRpcVector = AZStd::fixed_vector<NetworkEntityRpcMessage, MaxAggregateRpcMessages>;
+}
+
+namespace AzNetworking
+{
+    //! Aggregated rpc packets write each entityId and rpc identifier once, followed by the messages referencing them by index.
+    template <>
+    struct SerializeAzContainer<Multiplayer::NetworkEntityRpcVector>
+    {
+        static bool Serialize(ISerializer& serializer, Multiplayer::NetworkEntityRpcVector& container);
+    };
+}
+
+namespace Multiplayer
+{
 
     struct IRpcParamStruct
     {
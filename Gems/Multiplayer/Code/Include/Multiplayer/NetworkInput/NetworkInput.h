@@ -51,6 +51,9 @@ namespace Multiplayer
 
         void AttachNetBindComponent(NetBindComponent* netBindComponent);
 
+        //! Resets all attached component inputs to their default values, reusing the existing inputs rather than reallocating them.
+        void ResetComponentInputs();
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
         //! Fetches a vector of datums detailing which values per component input were
@@ -9,17 +9,24 @@
 #pragma once
 
 #include <Multiplayer/NetworkInput/NetworkInput.h>
-#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace Multiplayer
 {
     //! @class NetworkInputHistory
     //! @brief A list of input commands, used for bookkeeping on the client.
+    //!
+    //! Inputs are stored in a ring buffer whose slots are reused as inputs are pushed and popped. Pushed inputs are copied into
+    //! the component inputs already held by a slot, so once the history has reached its steady state size no allocations occur.
     class NetworkInputHistory final
     {
     public:
         AZStd::size_t Size() const;
 
+        //! Ensures the history can hold the requested number of inputs without growing.
+        //! @param capacity the number of inputs to reserve storage for
+        void Reserve(AZStd::size_t capacity);
+
         const NetworkInput& operator[](AZStd::size_t index) const;
         NetworkInput& operator[](AZStd::size_t index);
 
@@ -36,6 +43,8 @@ namespace Multiplayer
             NetworkInput m_networkInput;
         };
 
-        AZStd::deque<Wrapper> m_history;
+        AZStd::vector<Wrapper> m_history;
+        AZStd::size_t m_head = 0;
+        AZStd::size_t m_size = 0;
     };
 }
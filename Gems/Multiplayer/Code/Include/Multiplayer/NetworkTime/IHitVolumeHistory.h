@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+
+namespace Multiplayer
+{
+    //! The shape of a single hit volume, in the local space of the volume.
+    struct HitVolumeShape
+    {
+        enum class Type : uint8_t
+        {
+            Sphere,
+            Capsule, //!< Aligned with the local z axis, m_height includes both hemispherical caps
+            Box
+        };
+
+        Type m_type = Type::Sphere;
+        float m_radius = 0.0f;
+        float m_height = 0.0f;
+        AZ::Vector3 m_dimensions = AZ::Vector3::CreateZero();
+    };
+
+    //! A hit volume intersected by a hit volume history query.
+    struct HitVolumeQueryResult
+    {
+        NetEntityId m_netEntityId = InvalidNetEntityId;
+        uint32_t m_volumeIndex = 0;
+        float m_distance = 0.0f;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+    };
+
+    //! @class IHitVolumeHistory
+    //! @brief This is an AZ::Interface<> for lag compensated hit volume queries.
+    //! Authoritative hit volumes are recorded every host frame into a small bounding volume hierarchy per frame, kept in a ring
+    //! covering the rewind window. Hitscan traces query the hierarchy of the rewound frame directly, so lag compensation never
+    //! needs to move shapes inside the live physics scene.
+    class IHitVolumeHistory
+    {
+    public:
+        AZ_RTTI(IHitVolumeHistory, "{4C7E3B0E-93D4-4B5C-9E2A-6E0F1B8D2A51}");
+
+        IHitVolumeHistory() = default;
+        virtual ~IHitVolumeHistory() = default;
+
+        //! Records the world space state of a hit volume for the frame currently being built.
+        //! Recording the same volume more than once in a frame overwrites the earlier state.
+        //! @param netEntityId         the network entity that owns the hit volume
+        //! @param volumeIndex         the index of the hit volume on its entity
+        //! @param shape               the shape of the hit volume
+        //! @param worldTransform      the world transform of the hit volume
+        //! @param owningConnectionId  the connection that owns the entity, used to avoid rewinding the shooter
+        virtual void RecordHitVolume
+        (
+            NetEntityId netEntityId,
+            uint32_t volumeIndex,
+            const HitVolumeShape& shape,
+            const AZ::Transform& worldTransform,
+            AzNetworking::ConnectionId owningConnectionId
+        ) = 0;
+
+        //! Finalizes the recorded hit volumes as the state of the provided frame and builds its bounding volume hierarchy.
+        //! @param frameId the HostFrameId the recorded hit volumes belong to
+        virtual void CommitFrame(HostFrameId frameId) = 0;
+
+        //! Traces a ray against the hit volumes as they were at a historical frame.
+        //! @param frameId            the HostFrameId to trace against
+        //! @param blendFactor        the factor used to blend between the volumes at the previous and the provided frame
+        //! @param start              the world space start of the ray
+        //! @param direction          the normalized world space direction of the ray
+        //! @param distance           the length of the ray
+        //! @param ignoreConnectionId hit volumes owned by this connection are skipped
+        //! @return the hit volumes intersected by the ray, sorted by distance
+        virtual AZStd::vector<HitVolumeQueryResult> Raycast
+        (
+            HostFrameId frameId,
+            float blendFactor,
+            const AZ::Vector3& start,
+            const AZ::Vector3& direction,
+            float distance,
+            AzNetworking::ConnectionId ignoreConnectionId
+        ) const = 0;
+
+        //! Traces a ray against the hit volumes at the current, possibly rewound, network time.
+        //! Volumes owned by the rewinding connection are skipped, as the shooter is never rewound.
+        //! @param start     the world space start of the ray
+        //! @param direction the normalized world space direction of the ray
+        //! @param distance  the length of the ray
+        //! @return the hit volumes intersected by the ray, sorted by distance
+        virtual AZStd::vector<HitVolumeQueryResult> RaycastRewound(const AZ::Vector3& start, const AZ::Vector3& direction, float distance) const = 0;
+
+        //! Discards all recorded history.
+        virtual void Reset() = 0;
+
+        AZ_DISABLE_COPY_MOVE(IHitVolumeHistory);
+    };
+
+    // Convenience helpers
+    inline IHitVolumeHistory* GetHitVolumeHistory()
+    {
+        return AZ::Interface<IHitVolumeHistory>::Get();
+    }
+}
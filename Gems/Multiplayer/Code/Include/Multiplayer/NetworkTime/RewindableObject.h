@@ -13,11 +13,90 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/typetraits/conditional.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/Console/ILogger.h>
 
 namespace Multiplayer
 {
+    //! @class RewindableDenseHistory
+    //! @brief Rewind history storing a copy of the value for every frame, used for small values that are cheaper to copy than to reference.
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    class RewindableDenseHistory
+    {
+    public:
+        RewindableDenseHistory() = default;
+        explicit RewindableDenseHistory(const BASE_TYPE& value);
+
+        //! Returns the value stored for the frame at the given ring index.
+        const BASE_TYPE& Get(AZStd::size_t index) const;
+
+        //! Returns a mutable value for the frame at the given ring index, without affecting any other frame.
+        BASE_TYPE& Modify(AZStd::size_t index);
+
+        //! Stores a new value for the frame at the given ring index.
+        void Set(AZStd::size_t index, const BASE_TYPE& value);
+
+        //! Stores the value of the frame at sourceIndex for the frame at index, for frames where the value didn't change.
+        void Share(AZStd::size_t index, AZStd::size_t sourceIndex);
+
+        //! Stores the same value for every frame.
+        void Fill(const BASE_TYPE& value);
+
+    private:
+        AZStd::array<BASE_TYPE, REWIND_SIZE> m_history;
+    };
+
+    //! @class RewindableCompactHistory
+    //! @brief Rewind history storing each distinct value once, every frame references the value it had.
+    //! Frames where the value didn't change only cost a slot index, and values are copied on write when a frame still shares them.
+    //! Values are kept in a deque so the references returned by Get() stay valid as the pool grows.
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    class RewindableCompactHistory
+    {
+    public:
+        RewindableCompactHistory();
+        explicit RewindableCompactHistory(const BASE_TYPE& value);
+
+        //! Returns the value stored for the frame at the given ring index.
+        const BASE_TYPE& Get(AZStd::size_t index) const;
+
+        //! Returns a mutable value for the frame at the given ring index, without affecting any other frame.
+        BASE_TYPE& Modify(AZStd::size_t index);
+
+        //! Stores a new value for the frame at the given ring index.
+        void Set(AZStd::size_t index, const BASE_TYPE& value);
+
+        //! References the value of the frame at sourceIndex from the frame at index, for frames where the value didn't change.
+        void Share(AZStd::size_t index, AZStd::size_t sourceIndex);
+
+        //! Stores the same value for every frame.
+        void Fill(const BASE_TYPE& value);
+
+    private:
+        // Every frame references a distinct slot in the worst case, plus the slot of a new value before the old one is released
+        static constexpr AZStd::size_t MaxSlots = REWIND_SIZE + 1;
+        using SlotIndex = AZStd::conditional_t<(MaxSlots <= AZStd::numeric_limits<uint8_t>::max()), uint8_t, uint16_t>;
+
+        SlotIndex AllocateSlot(const BASE_TYPE& value);
+        void ReleaseSlot(SlotIndex slot);
+
+        AZStd::array<SlotIndex, REWIND_SIZE> m_frameSlots;
+        AZStd::deque<BASE_TYPE> m_values;
+        AZStd::vector<SlotIndex> m_slotRefCounts;
+        AZStd::vector<SlotIndex> m_freeSlots;
+    };
+
+    //! Values at least this large keep a compact history, smaller ones are cheaper to copy into every frame.
+    static constexpr AZStd::size_t RewindableCompactHistoryMinSize = 16;
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    using RewindableHistory = AZStd::conditional_t<(sizeof(BASE_TYPE) >= RewindableCompactHistoryMinSize),
+        RewindableCompactHistory<BASE_TYPE, REWIND_SIZE>, RewindableDenseHistory<BASE_TYPE, REWIND_SIZE>>;
+
     //! @class RewindableObject
     //! @brief A simple serializable data container that keeps a history of previous values, and can fetch those old values on request.
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
@@ -87,6 +166,13 @@ namespace Multiplayer
         //! @return boolean true for success, false for serialization failure
         bool Serialize(AzNetworking::ISerializer& serializer);
 
+        //! Serializes the value through SERIALIZE_TYPE, for instance a quantized representation of the value.
+        //! SERIALIZE_TYPE must be explicitly constructible from BASE_TYPE and convertible back to BASE_TYPE.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        template <typename SERIALIZE_TYPE>
+        bool SerializeAs(AzNetworking::ISerializer& serializer);
+
     private:
 
         //! Returns what the appropriate current time is for this rewindable property.
@@ -108,10 +194,15 @@ namespace Multiplayer
         //! @return value given the current input time
         const BASE_TYPE& GetValueForTime(HostFrameId frameTime) const;
 
+        //! Returns the history index of the value for the provided input time.
+        //! @param frameTime the frame time to return the associated history index for
+        //! @return history index of the value given the input time
+        AZStd::size_t GetIndexForTime(HostFrameId frameTime) const;
+
         //! Helper method to compute clamped array index values accounting for the offset head index.
         AZStd::size_t GetOffsetIndex(AZStd::size_t absoluteIndex) const;
 
-        AZStd::array<BASE_TYPE, REWIND_SIZE> m_history;
+        RewindableHistory<BASE_TYPE, REWIND_SIZE> m_history;
         AzNetworking::ConnectionId m_owningConnectionId = AzNetworking::InvalidConnectionId;
         HostFrameId m_headTime = HostFrameId{0};
         HostFrameId m_lastSerializedTime = HostFrameId{0};
@@ -11,26 +11,171 @@
 namespace Multiplayer
 {
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
-    inline RewindableObject<BASE_TYPE, REWIND_SIZE>::RewindableObject(const BASE_TYPE& value)
+    inline RewindableDenseHistory<BASE_TYPE, REWIND_SIZE>::RewindableDenseHistory(const BASE_TYPE& value)
     {
         m_history.fill(value);
     }
 
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
-    inline RewindableObject<BASE_TYPE, REWIND_SIZE>::RewindableObject(const BASE_TYPE& value, AzNetworking::ConnectionId owningConnectionId)
-        : m_owningConnectionId(owningConnectionId)
-        , m_history(value)
+    inline const BASE_TYPE& RewindableDenseHistory<BASE_TYPE, REWIND_SIZE>::Get(AZStd::size_t index) const
+    {
+        return m_history[index];
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline BASE_TYPE& RewindableDenseHistory<BASE_TYPE, REWIND_SIZE>::Modify(AZStd::size_t index)
+    {
+        return m_history[index];
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableDenseHistory<BASE_TYPE, REWIND_SIZE>::Set(AZStd::size_t index, const BASE_TYPE& value)
+    {
+        m_history[index] = value;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableDenseHistory<BASE_TYPE, REWIND_SIZE>::Share(AZStd::size_t index, AZStd::size_t sourceIndex)
+    {
+        m_history[index] = m_history[sourceIndex];
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableDenseHistory<BASE_TYPE, REWIND_SIZE>::Fill(const BASE_TYPE& value)
     {
         m_history.fill(value);
     }
 
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableCompactHistory<BASE_TYPE, REWIND_SIZE>::RewindableCompactHistory()
+        : RewindableCompactHistory(BASE_TYPE())
+    {
+        ;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableCompactHistory<BASE_TYPE, REWIND_SIZE>::RewindableCompactHistory(const BASE_TYPE& value)
+    {
+        m_values.push_back(value);
+        m_slotRefCounts.push_back(static_cast<SlotIndex>(REWIND_SIZE));
+        m_frameSlots.fill(0);
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline const BASE_TYPE& RewindableCompactHistory<BASE_TYPE, REWIND_SIZE>::Get(AZStd::size_t index) const
+    {
+        return m_values[m_frameSlots[index]];
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline BASE_TYPE& RewindableCompactHistory<BASE_TYPE, REWIND_SIZE>::Modify(AZStd::size_t index)
+    {
+        const SlotIndex slot = m_frameSlots[index];
+        if (m_slotRefCounts[slot] > 1)
+        {
+            // Copy on write, the other frames referencing this value keep it
+            m_frameSlots[index] = AllocateSlot(m_values[slot]);
+            ReleaseSlot(slot);
+        }
+        return m_values[m_frameSlots[index]];
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableCompactHistory<BASE_TYPE, REWIND_SIZE>::Set(AZStd::size_t index, const BASE_TYPE& value)
+    {
+        const SlotIndex slot = m_frameSlots[index];
+        if (&m_values[slot] == &value)
+        {
+            return;
+        }
+
+        if (m_slotRefCounts[slot] == 1)
+        {
+            m_values[slot] = value;
+            return;
+        }
+
+        m_frameSlots[index] = AllocateSlot(value);
+        ReleaseSlot(slot);
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableCompactHistory<BASE_TYPE, REWIND_SIZE>::Share(AZStd::size_t index, AZStd::size_t sourceIndex)
+    {
+        const SlotIndex slot = m_frameSlots[index];
+        const SlotIndex sourceSlot = m_frameSlots[sourceIndex];
+        if (slot != sourceSlot)
+        {
+            ++m_slotRefCounts[sourceSlot];
+            m_frameSlots[index] = sourceSlot;
+            ReleaseSlot(slot);
+        }
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableCompactHistory<BASE_TYPE, REWIND_SIZE>::Fill(const BASE_TYPE& value)
+    {
+        // Allocated before releasing the current slots, value may be one of them
+        const SlotIndex newSlot = AllocateSlot(value);
+        for (SlotIndex& slot : m_frameSlots)
+        {
+            ReleaseSlot(slot);
+            slot = newSlot;
+        }
+        m_slotRefCounts[newSlot] = static_cast<SlotIndex>(REWIND_SIZE);
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline auto RewindableCompactHistory<BASE_TYPE, REWIND_SIZE>::AllocateSlot(const BASE_TYPE& value) -> SlotIndex
+    {
+        if (!m_freeSlots.empty())
+        {
+            const SlotIndex slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            m_values[slot] = value;
+            m_slotRefCounts[slot] = 1;
+            return slot;
+        }
+
+        AZ_Assert(m_values.size() < MaxSlots, "Rewind history has more distinct values than frames");
+        const SlotIndex slot = static_cast<SlotIndex>(m_values.size());
+        m_values.push_back(value);
+        m_slotRefCounts.push_back(1);
+        return slot;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableCompactHistory<BASE_TYPE, REWIND_SIZE>::ReleaseSlot(SlotIndex slot)
+    {
+        if (--m_slotRefCounts[slot] == 0)
+        {
+            m_freeSlots.push_back(slot);
+        }
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableObject<BASE_TYPE, REWIND_SIZE>::RewindableObject(const BASE_TYPE& value)
+        : m_history(value)
+    {
+        ;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableObject<BASE_TYPE, REWIND_SIZE>::RewindableObject(const BASE_TYPE& value, AzNetworking::ConnectionId owningConnectionId)
+        : m_history(value)
+        , m_owningConnectionId(owningConnectionId)
+    {
+        ;
+    }
+
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
     inline RewindableObject<BASE_TYPE, REWIND_SIZE>::RewindableObject(const RewindableObject<BASE_TYPE, REWIND_SIZE>& rhs)
-        : m_owningConnectionId(rhs.m_owningConnectionId)
+        : m_history(rhs.Get())
+        , m_owningConnectionId(rhs.m_owningConnectionId)
         , m_headTime(GetCurrentTimeForProperty())
         , m_headIndex(0)
     {
-        m_history.fill(static_cast<BASE_TYPE>(rhs));
+        ;
     }
 
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
@@ -90,8 +235,7 @@ namespace Multiplayer
         {
             SetValueForTime(GetValueForTime(frameTime), frameTime);
         }
-        const BASE_TYPE& returnValue = GetValueForTime(frameTime);
-        return const_cast<BASE_TYPE&>(returnValue);
+        return m_history.Modify(GetIndexForTime(frameTime));
     }
 
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
@@ -110,12 +254,19 @@ namespace Multiplayer
 
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
     inline bool RewindableObject<BASE_TYPE, REWIND_SIZE>::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        return SerializeAs<BASE_TYPE>(serializer);
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    template <typename SERIALIZE_TYPE>
+    inline bool RewindableObject<BASE_TYPE, REWIND_SIZE>::SerializeAs(AzNetworking::ISerializer& serializer)
     {
         const HostFrameId frameTime = GetCurrentTimeForProperty();
-        BASE_TYPE value = GetValueForTime(frameTime);
+        SERIALIZE_TYPE value(GetValueForTime(frameTime));
         if (serializer.Serialize(value, "Element") && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
         {
-            SetValueForTime(value, frameTime);
+            SetValueForTime(static_cast<BASE_TYPE>(value), frameTime);
             if (m_headTime == frameTime && m_headTime > m_lastSerializedTime)
             {
                 m_lastSerializedTime = m_headTime;
@@ -155,51 +306,53 @@ namespace Multiplayer
             return;
         }
 
-        // Keeping a reference to copy to head so that delta bitset differences are only applied from the prev version
-        const BASE_TYPE& prevHead = m_history[m_headIndex];
-
-        if (static_cast<size_t>(frameTime - m_headTime) >= m_history.size())
+        if (static_cast<size_t>(frameTime - m_headTime) >= REWIND_SIZE)
         {
             // This update represents a large enough time delta that we'll just flush the whole buffer with the new value
             m_headTime = frameTime;
             m_headIndex = 0;
-            for (uint32_t i = 0; i < m_history.size(); ++i)
-            {
-                m_history[i] = value;
-            }
+            m_history.Fill(value);
             return;
         }
 
+        // The frames skipped since the head keep the previous head value, so delta bitset differences are only applied from the prev version
         while (m_headTime < frameTime)
         {
-            m_history[m_headIndex] = prevHead;
-            m_headIndex = (m_headIndex + 1) % m_history.size();
+            const uint32_t prevHeadIndex = m_headIndex;
+            m_headIndex = (m_headIndex + 1) % REWIND_SIZE;
+            m_history.Share(m_headIndex, prevHeadIndex);
             m_headTime++;
         }
 
-        m_history[m_headIndex] = value;
+        m_history.Set(m_headIndex, value);
         AZ_Assert(m_headTime == frameTime, "Invalid head value");
     }
 
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
     inline const BASE_TYPE &RewindableObject<BASE_TYPE, REWIND_SIZE>::GetValueForTime(HostFrameId frameTime) const
+    {
+        return m_history.Get(GetIndexForTime(frameTime));
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline AZStd::size_t RewindableObject<BASE_TYPE, REWIND_SIZE>::GetIndexForTime(HostFrameId frameTime) const
     {
         if (frameTime > m_headTime)
         {
-            return m_history[m_headIndex];
+            return m_headIndex;
         }
         const AZStd::size_t frameDelta = static_cast<AZStd::size_t>(m_headTime) - static_cast<AZStd::size_t>(frameTime);
-        return m_history[GetOffsetIndex(frameDelta)];
+        return GetOffsetIndex(frameDelta);
     }
 
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
     inline AZStd::size_t RewindableObject<BASE_TYPE, REWIND_SIZE>::GetOffsetIndex(AZStd::size_t absoluteIndex) const
     {
-        if (absoluteIndex >= m_history.size())
+        if (absoluteIndex >= REWIND_SIZE)
         {
             AZLOG(NET_Rewind, "Request for value which is too old");
-            absoluteIndex = m_history.size() - 1;
+            absoluteIndex = REWIND_SIZE - 1;
         }
-        return ((m_headIndex + m_history.size()) - absoluteIndex) % m_history.size();
+        return ((m_headIndex + REWIND_SIZE) - absoluteIndex) % REWIND_SIZE;
     }
 }
@@ -609,8 +609,15 @@ namespace Multiplayer
             m_moveAccumulator -= clientInputRateSec;
             ++m_clientInputId;
 
-            NetworkInputArray inputArray(GetEntityHandle());
+            if (!m_clientInputArrayAttached)
+            {
+                m_clientInputArray = NetworkInputArray(GetEntityHandle());
+                m_clientInputArrayAttached = true;
+            }
+
+            NetworkInputArray& inputArray = m_clientInputArray;
             NetworkInput& input = inputArray[0];
+            input.ResetComponentInputs();
             const float blendFactor = AZStd::min(AZStd::max(0.f, multiplayer->GetCurrentBlendFactor()), 1.0f);
             const AZ::TimeMs blendMs = AZ::TimeMs(static_cast<float>(static_cast<AZ::TimeMs>(cl_InputRateMs)) * (1.0f - blendFactor));
 
@@ -15,6 +15,11 @@ namespace Multiplayer
         NetComponentId netComponentId = m_nextNetComponentId++;
         m_componentData[netComponentId] = componentData;
 
+        if (componentData.m_allocComponentInputFunction)
+        {
+            m_defaultComponentInputs[netComponentId] = componentData.m_allocComponentInputFunction();
+        }
+
         if (componentData.m_includeInVersionCheck)
         {
             // add all the component hashes together to create an system-wide hash
@@ -35,6 +40,16 @@ namespace Multiplayer
         return nullptr;
     }
 
+    const IMultiplayerComponentInput* MultiplayerComponentRegistry::GetDefaultComponentInput(NetComponentId netComponentId) const
+    {
+        auto it = m_defaultComponentInputs.find(netComponentId);
+        if (it != m_defaultComponentInputs.end())
+        {
+            return it->second.get();
+        }
+        return nullptr;
+    }
+
     const char* MultiplayerComponentRegistry::GetComponentGemName(NetComponentId netComponentId) const
     {
         const ComponentData& componentData = GetMultiplayerComponentData(netComponentId);
@@ -103,6 +118,7 @@ namespace Multiplayer
     void MultiplayerComponentRegistry::Reset()
     {
         m_componentData.clear();
+        m_defaultComponentInputs.clear();
         m_componentVersionHashes.clear();
         m_systemVersionHash = AZ::HashValue64{ 0 };
     }
@@ -15,6 +15,7 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 #include <Multiplayer/NetworkInput/NetworkInput.h>
 #include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Interface/Interface.h>
@@ -25,6 +26,29 @@
 
 namespace Multiplayer
 {
+    AZ_CVAR(uint32_t, net_EntityStateSnapshotCount, 64, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of state snapshots kept per entity to compare entity updates against acknowledged state");
+
+    namespace
+    {
+        //! Serializer for state snapshots, which reports no size to the property serialization so snapshots aren't recorded as sent properties
+        class StateSnapshotSerializer final
+            : public AzNetworking::NetworkInputSerializer
+        {
+        public:
+            using AzNetworking::NetworkInputSerializer::NetworkInputSerializer;
+
+            uint32_t GetSize() const override
+            {
+                return 0;
+            }
+
+            uint32_t GetSnapshotSize() const
+            {
+                return AzNetworking::NetworkInputSerializer::GetSize();
+            }
+        };
+    }
+
     void NetBindComponent::Reflect(AZ::ReflectContext* context)
     {
         PrefabEntityId::Reflect(context);
@@ -686,6 +710,272 @@ namespace Multiplayer
         return success;
     }
 
+    bool NetBindComponent::SerializeSharedStateDeltaMessage(ReplicationRecord& replicationRecord, AzNetworking::PacketEncodingBuffer& outBuffer)
+    {
+        // Only a few distinct records are expected per frame, connections that are in sync with each other send the same changes
+        static constexpr size_t MaxSharedStateDeltas = 8;
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_sharedStateDeltaMutex);
+
+        const HostFrameId currentFrameId = GetNetworkTime()->GetHostFrameId();
+        if (m_sharedStateDeltaFrameId != currentFrameId)
+        {
+            m_sharedStateDeltas.clear();
+            m_sharedComponentBlocks.clear();
+            m_sharedStateDeltaFrameId = currentFrameId;
+        }
+
+        for (const SharedStateDelta& sharedStateDelta : m_sharedStateDeltas)
+        {
+            if (sharedStateDelta.m_record.HasSameChanges(replicationRecord))
+            {
+                outBuffer.CopyValues(sharedStateDelta.m_data.data(), sharedStateDelta.m_data.size());
+                return true;
+            }
+        }
+
+        // Assemble the state delta from the blocks of each component, so only the components whose changes weren't serialized yet this frame
+        // are serialized. All serializers write whole bytes, so the blocks can be written back to back.
+        auto& stats = GetMultiplayer()->GetStats();
+        stats.RecordEntitySerializeStart(AzNetworking::SerializerMode::ReadFromObject, GetEntityId(), GetEntity()->GetName().c_str());
+
+        InputSerializer headerSerializer(outBuffer.GetBuffer(), static_cast<uint32_t>(outBuffer.GetCapacity()));
+        replicationRecord.ResetConsumedBits();
+        replicationRecord.Serialize(headerSerializer);
+        headerSerializer.BeginObject(GetEntity()->GetName().c_str());
+        AZStd::size_t serializedSize = headerSerializer.GetSize();
+        bool success = headerSerializer.IsValid() && SerializeSharedComponentBlocks(replicationRecord, outBuffer, serializedSize);
+        if (success)
+        {
+            InputSerializer footerSerializer(outBuffer.GetBuffer() + serializedSize, static_cast<uint32_t>(outBuffer.GetCapacity() - serializedSize));
+            footerSerializer.EndObject(GetEntity()->GetName().c_str());
+            success = footerSerializer.IsValid();
+            serializedSize += footerSerializer.GetSize();
+        }
+
+        stats.RecordEntitySerializeStop(AzNetworking::SerializerMode::ReadFromObject, GetEntityId(), GetEntity()->GetName().c_str());
+        if (!success)
+        {
+            outBuffer.Resize(0);
+            return false;
+        }
+        outBuffer.Resize(serializedSize);
+
+        if (m_sharedStateDeltas.size() < MaxSharedStateDeltas)
+        {
+            SharedStateDelta& sharedStateDelta = m_sharedStateDeltas.emplace_back();
+            sharedStateDelta.m_record = replicationRecord;
+            sharedStateDelta.m_data.assign(outBuffer.GetBuffer(), outBuffer.GetBuffer() + outBuffer.GetSize());
+        }
+        return true;
+    }
+
+    bool NetBindComponent::SerializeSharedComponentBlocks(ReplicationRecord& replicationRecord, AzNetworking::PacketEncodingBuffer& outBuffer, AZStd::size_t& inOutSize)
+    {
+        static constexpr size_t MaxSharedComponentBlocks = 8;
+
+        auto& stats = GetMultiplayer()->GetStats();
+        m_sharedComponentBlocks.resize(m_multiplayerSerializationComponentVector.size());
+
+        AZStd::vector<uint8_t> changes;
+        for (AZStd::size_t componentIndex = 0; componentIndex < m_multiplayerSerializationComponentVector.size(); ++componentIndex)
+        {
+            MultiplayerComponent* component = m_multiplayerSerializationComponentVector[componentIndex];
+            AZStd::vector<SharedComponentBlock>& componentBlocks = m_sharedComponentBlocks[componentIndex];
+            const ReplicationRecordStats startBits = replicationRecord.GetStats();
+
+            // A component consumes the same bits for every record of the same remote role, so the changes only need to be gathered once
+            const SharedComponentBlock* sharedBlock = nullptr;
+            bool hasGatheredChanges = false;
+            for (const SharedComponentBlock& componentBlock : componentBlocks)
+            {
+                if (componentBlock.m_remoteNetEntityRole != replicationRecord.GetRemoteNetworkRole())
+                {
+                    continue;
+                }
+
+                if (!hasGatheredChanges)
+                {
+                    changes.clear();
+                    replicationRecord.GetChangesInRange(changes, startBits, componentBlock.m_consumedBits);
+                    hasGatheredChanges = true;
+                }
+
+                if (componentBlock.m_changes == changes)
+                {
+                    sharedBlock = &componentBlock;
+                    break;
+                }
+            }
+
+            if (sharedBlock != nullptr)
+            {
+                if (inOutSize + sharedBlock->m_data.size() > outBuffer.GetCapacity())
+                {
+                    return false;
+                }
+                memcpy(outBuffer.GetBuffer() + inOutSize, sharedBlock->m_data.data(), sharedBlock->m_data.size());
+                inOutSize += sharedBlock->m_data.size();
+
+                replicationRecord.ConsumeAuthorityToClientBits(sharedBlock->m_consumedBits.m_authorityToClientCount);
+                replicationRecord.ConsumeAuthorityToServerBits(sharedBlock->m_consumedBits.m_authorityToServerCount);
+                replicationRecord.ConsumeAuthorityToAutonomousBits(sharedBlock->m_consumedBits.m_authorityToAutonomousCount);
+                replicationRecord.ConsumeAutonomousToAuthorityBits(sharedBlock->m_consumedBits.m_autonomousToAuthorityCount);
+            }
+            else
+            {
+                uint8_t* blockBuffer = outBuffer.GetBuffer() + inOutSize;
+                InputSerializer blockSerializer(blockBuffer, static_cast<uint32_t>(outBuffer.GetCapacity() - inOutSize));
+                if (!component->SerializeStateDeltaMessage(replicationRecord, blockSerializer))
+                {
+                    return false;
+                }
+
+                if (componentBlocks.size() < MaxSharedComponentBlocks)
+                {
+                    SharedComponentBlock& componentBlock = componentBlocks.emplace_back();
+                    componentBlock.m_remoteNetEntityRole = replicationRecord.GetRemoteNetworkRole();
+                    componentBlock.m_consumedBits = replicationRecord.GetStats() - startBits;
+                    replicationRecord.GetChangesInRange(componentBlock.m_changes, startBits, componentBlock.m_consumedBits);
+                    componentBlock.m_data.assign(blockBuffer, blockBuffer + blockSerializer.GetSize());
+                }
+                inOutSize += blockSerializer.GetSize();
+            }
+            stats.RecordComponentSerializeEnd(AzNetworking::SerializerMode::ReadFromObject, component->GetNetComponentId());
+        }
+        return true;
+    }
+
+    EntitySnapshotId NetBindComponent::CaptureStateSnapshot(NetEntityRole remoteNetEntityRole)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_sharedStateDeltaMutex);
+
+        // Property values can't have changed since the last snapshot unless the entity was marked dirty
+        if (!m_currentRecord.HasChanges())
+        {
+            for (const StateSnapshot& stateSnapshot : m_stateSnapshots)
+            {
+                if (stateSnapshot.m_isCurrent && (stateSnapshot.m_remoteNetEntityRole == remoteNetEntityRole))
+                {
+                    return stateSnapshot.m_snapshotId;
+                }
+            }
+        }
+
+        const uint32_t snapshotCount = AZStd::max<uint32_t>(net_EntityStateSnapshotCount, 1);
+        if (m_stateSnapshots.capacity() != snapshotCount)
+        {
+            m_stateSnapshots.set_capacity(snapshotCount);
+        }
+
+        ReplicationRecord totalRecord(remoteNetEntityRole);
+        FillTotalReplicationRecord(totalRecord);
+        totalRecord.ResetConsumedBits();
+
+        StateSnapshot stateSnapshot;
+        stateSnapshot.m_snapshotId = m_nextStateSnapshotId;
+        stateSnapshot.m_remoteNetEntityRole = remoteNetEntityRole;
+        stateSnapshot.m_isCurrent = true;
+        stateSnapshot.m_componentStates.reserve(m_multiplayerSerializationComponentVector.size());
+
+        AzNetworking::PacketEncodingBuffer buffer;
+        for (MultiplayerComponent* component : m_multiplayerSerializationComponentVector)
+        {
+            const ReplicationRecordStats startBits = totalRecord.GetStats();
+            StateSnapshotSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            if (!component->SerializeStateDeltaMessage(totalRecord, serializer))
+            {
+                return InvalidEntitySnapshotId;
+            }
+
+            ComponentStateSnapshot& componentState = stateSnapshot.m_componentStates.emplace_back();
+            componentState.m_startBits = startBits;
+            componentState.m_consumedBits = totalRecord.GetStats() - startBits;
+            totalRecord.GetChangesInRange(componentState.m_changes, startBits, componentState.m_consumedBits);
+            componentState.m_data.assign(buffer.GetBuffer(), buffer.GetBuffer() + serializer.GetSnapshotSize());
+        }
+
+        // Values changed while the entity waits to be marked dirty, so the older snapshots of the role are no longer current
+        for (StateSnapshot& olderSnapshot : m_stateSnapshots)
+        {
+            if (olderSnapshot.m_remoteNetEntityRole == remoteNetEntityRole)
+            {
+                olderSnapshot.m_isCurrent = false;
+            }
+        }
+
+        m_nextStateSnapshotId = EntitySnapshotId{ aznumeric_cast<uint32_t>(m_nextStateSnapshotId) + 1 };
+        if (m_nextStateSnapshotId == InvalidEntitySnapshotId)
+        {
+            m_nextStateSnapshotId = EntitySnapshotId{ 0 };
+        }
+        m_stateSnapshots.push_back(AZStd::move(stateSnapshot));
+        return m_stateSnapshots.back().m_snapshotId;
+    }
+
+    bool NetBindComponent::RemoveUnchangedComponentStates
+    (
+        ReplicationRecord& replicationRecord,
+        EntitySnapshotId currentSnapshotId,
+        const AZStd::vector<EntitySnapshotId>& baselineSnapshotIds
+    )
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_sharedStateDeltaMutex);
+
+        const StateSnapshot* currentSnapshot = FindStateSnapshot(currentSnapshotId);
+        if (currentSnapshot == nullptr || baselineSnapshotIds.empty())
+        {
+            return false;
+        }
+
+        AZStd::vector<const StateSnapshot*> baselineSnapshots;
+        baselineSnapshots.reserve(baselineSnapshotIds.size());
+        for (EntitySnapshotId baselineSnapshotId : baselineSnapshotIds)
+        {
+            const StateSnapshot* baselineSnapshot = FindStateSnapshot(baselineSnapshotId);
+            if (baselineSnapshot == nullptr
+                || baselineSnapshot->m_remoteNetEntityRole != currentSnapshot->m_remoteNetEntityRole
+                || baselineSnapshot->m_componentStates.size() != currentSnapshot->m_componentStates.size())
+            {
+                return false;
+            }
+            baselineSnapshots.push_back(baselineSnapshot);
+        }
+
+        for (AZStd::size_t componentIndex = 0; componentIndex < currentSnapshot->m_componentStates.size(); ++componentIndex)
+        {
+            const ComponentStateSnapshot& currentState = currentSnapshot->m_componentStates[componentIndex];
+            bool isUnchanged = true;
+            for (const StateSnapshot* baselineSnapshot : baselineSnapshots)
+            {
+                const ComponentStateSnapshot& baselineState = baselineSnapshot->m_componentStates[componentIndex];
+                if (baselineState.m_changes != currentState.m_changes || baselineState.m_data != currentState.m_data)
+                {
+                    isUnchanged = false;
+                    break;
+                }
+            }
+
+            if (isUnchanged)
+            {
+                replicationRecord.ClearChangesInRange(currentState.m_startBits, currentState.m_consumedBits);
+            }
+        }
+        return true;
+    }
+
+    const NetBindComponent::StateSnapshot* NetBindComponent::FindStateSnapshot(EntitySnapshotId snapshotId) const
+    {
+        for (const StateSnapshot& stateSnapshot : m_stateSnapshots)
+        {
+            if (stateSnapshot.m_snapshotId == snapshotId)
+            {
+                return &stateSnapshot;
+            }
+        }
+        return nullptr;
+    }
+
     void NetBindComponent::NotifyStateDeltaChanges(ReplicationRecord& replicationRecord)
     {
         for (auto iter = m_multiplayerSerializationComponentVector.begin(); iter != m_multiplayerSerializationComponentVector.end(); ++iter)
@@ -867,6 +1157,15 @@ namespace Multiplayer
         }
         m_totalRecord.Append(m_currentRecord);
         m_currentRecord.Clear();
+
+        // Property values changed, so previously serialized state deltas can no longer be shared
+        AZStd::lock_guard<AZStd::mutex> lock(m_sharedStateDeltaMutex);
+        m_sharedStateDeltas.clear();
+        m_sharedComponentBlocks.clear();
+        for (StateSnapshot& stateSnapshot : m_stateSnapshots)
+        {
+            stateSnapshot.m_isCurrent = false;
+        }
     }
 
     void NetBindComponent::HandleLocalServerRpcMessage(NetworkEntityRpcMessage& message)
@@ -21,6 +21,9 @@ namespace Multiplayer
     AZ_CVAR(float, bg_DrawDebugHitVolumeLifetime, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The lifetime for hit volume draw-debug shapes");
 
     AZ_CVAR(float, bg_RewindPositionTolerance, 0.0001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Don't sync the physx entity if the square of delta position is less than this value");
+    AZ_CVAR(bool, sv_UseHitVolumeHistory, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true authoritative hit volumes are recorded into the hit volume history for lag compensated queries alongside the rewound physics shapes");
+
     AZ_CVAR(float, bg_RewindOrientationTolerance, 0.001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Don't sync the physx entity if the square of delta orientation is less than this value");
 
     NetworkHitVolumesComponent::AnimatedHitVolume::AnimatedHitVolume
@@ -40,6 +43,23 @@ namespace Multiplayer
 
         m_colliderOffSetTransform = AZ::Transform::CreateFromQuaternionAndTranslation(m_colliderConfig->m_rotation, m_colliderConfig->m_position);
 
+        if (const Physics::SphereShapeConfiguration* sphereConfig = azrtti_cast<const Physics::SphereShapeConfiguration*>(m_shapeConfig))
+        {
+            m_historyShape.m_type = HitVolumeShape::Type::Sphere;
+            m_historyShape.m_radius = sphereConfig->m_radius;
+        }
+        else if (const Physics::CapsuleShapeConfiguration* capsuleConfig = azrtti_cast<const Physics::CapsuleShapeConfiguration*>(m_shapeConfig))
+        {
+            m_historyShape.m_type = HitVolumeShape::Type::Capsule;
+            m_historyShape.m_radius = capsuleConfig->m_radius;
+            m_historyShape.m_height = capsuleConfig->m_height;
+        }
+        else if (const Physics::BoxShapeConfiguration* boxConfig = azrtti_cast<const Physics::BoxShapeConfiguration*>(m_shapeConfig))
+        {
+            m_historyShape.m_type = HitVolumeShape::Type::Box;
+            m_historyShape.m_dimensions = boxConfig->m_dimensions;
+        }
+
         if (m_colliderConfig->m_isExclusive)
         {
             Physics::SystemRequestBus::BroadcastResult(m_physicsShape, &Physics::SystemRequests::CreateShape, *m_colliderConfig, *m_shapeConfig);
@@ -170,6 +190,11 @@ namespace Multiplayer
             hitVolume.UpdateTransform(AZ::Transform::CreateFromQuaternionAndTranslation(rotation, position) * hitVolume.m_colliderOffSetTransform);
         }
 
+        if (sv_UseHitVolumeHistory && IsNetEntityRoleAuthority())
+        {
+            RecordHitVolumeHistory();
+        }
+
         if (bg_DrawArticulatedHitVolumes)
         {
             DrawDebugHitVolumes();
@@ -245,6 +270,24 @@ namespace Multiplayer
         m_actorComponent = nullptr;
     }
 
+    void NetworkHitVolumesComponent::RecordHitVolumeHistory()
+    {
+        IHitVolumeHistory* hitVolumeHistory = GetHitVolumeHistory();
+        if (hitVolumeHistory == nullptr)
+        {
+            return;
+        }
+
+        const NetEntityId netEntityId = GetNetEntityId();
+        const AzNetworking::ConnectionId owningConnectionId = GetNetBindComponent()->GetOwningConnectionId();
+        const AZ::Transform& worldTransform = GetTransformComponent()->GetWorldTM();
+        for (uint32_t i = 0; i < m_animatedHitVolumes.size(); ++i)
+        {
+            const AnimatedHitVolume& hitVolume = m_animatedHitVolumes[i];
+            hitVolumeHistory->RecordHitVolume(netEntityId, i, hitVolume.m_historyShape, worldTransform * hitVolume.m_transform.Get(), owningConnectionId);
+        }
+    }
+
     void NetworkHitVolumesComponent::DrawDebugHitVolumes()
     {
         if (m_debugDisplay == nullptr)
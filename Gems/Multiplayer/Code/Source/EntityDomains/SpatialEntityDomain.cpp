@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/EntityDomains/SpatialEntityDomain.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/Color.h>
+#include <AzFramework/Entity/EntityDebugDisplayBus.h>
+
+namespace Multiplayer 
+{
+    AZ_CVAR(float, sv_SpatialDomainHysteresis, 2.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance in meters an entity must travel beyond the boundary of a spatial entity domain before it is migrated away");
+
+    SpatialEntityDomain::SpatialEntityDomain(const AZ::Aabb& aabb)
+        : m_aabb(aabb)
+    {
+        ;
+    }
+
+    void SpatialEntityDomain::SetAabb(const AZ::Aabb& aabb)
+    {
+        m_aabb = aabb;
+    }
+
+    const AZ::Aabb& SpatialEntityDomain::GetAabb() const
+    {
+        return m_aabb;
+    }
+
+    bool SpatialEntityDomain::IsInDomain(const ConstNetworkEntityHandle& entityHandle) const
+    {
+        const AZ::Entity* entity = entityHandle.GetEntity();
+        if ((entity == nullptr) || (entity->GetTransform() == nullptr) || !m_aabb.IsValid())
+        {
+            return false;
+        }
+
+        const float hysteresis = sv_SpatialDomainHysteresis;
+        return m_aabb.GetExpanded(AZ::Vector3(hysteresis)).Contains(entity->GetTransform()->GetWorldTranslation());
+    }
+
+    void SpatialEntityDomain::HandleLossOfAuthoritativeReplicator(const ConstNetworkEntityHandle& entityHandle)
+    {
+        if (IsInDomain(entityHandle))
+        {
+            // The entity is inside our region, so we're the host best placed to take over its simulation
+            AZLOG_INFO("Timed out entity id %llu during migration, assuming authority", aznumeric_cast<AZ::u64>(entityHandle.GetNetEntityId()));
+            GetNetworkEntityManager()->ForceAssumeAuthority(entityHandle);
+            return;
+        }
+
+        // The server owning the region the entity is in assumes authority and replicates the entity back to us
+        AZLOG_WARN("Timed out entity id %llu during migration outside of our domain, marking for removal", aznumeric_cast<AZ::u64>(entityHandle.GetNetEntityId()));
+        GetNetworkEntityManager()->MarkForRemoval(entityHandle);
+    }
+
+    void SpatialEntityDomain::DebugDraw() const
+    {
+        if (!m_aabb.IsValid())
+        {
+            return;
+        }
+
+        AzFramework::DebugDisplayRequestBus::BusPtr debugDisplayBus;
+        AzFramework::DebugDisplayRequestBus::Bind(debugDisplayBus, AzFramework::g_defaultSceneEntityDebugDisplayId);
+        AzFramework::DebugDisplayRequests* debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
+        if (debugDisplay != nullptr)
+        {
+            debugDisplay->SetColor(AZ::Colors::Orange);
+            debugDisplay->SetAlpha(0.5f);
+            debugDisplay->DrawWireBox(m_aabb.GetMin(), m_aabb.GetMax());
+        }
+    }
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/EntityDomains/IEntityDomain.h>
+#include <AzCore/Math/Aabb.h>
+
+namespace Multiplayer 
+{
+    //! An entity domain that owns the entities located inside a region of the world.
+    //! Splitting the world into regions owned by different server processes lets each server simulate only part of the world.
+    //! Entities are kept until they leave the region expanded by sv_SpatialDomainHysteresis, so entities moving along a boundary
+    //! don't migrate back and forth between neighbouring servers.
+    class SpatialEntityDomain
+        : public IEntityDomain
+    {
+    public:
+        SpatialEntityDomain() = default;
+        SpatialEntityDomain(const AZ::Aabb& aabb);
+        SpatialEntityDomain(const SpatialEntityDomain& rhs) = default;
+
+        //! IEntityDomain overrides.
+        //! @{
+        void SetAabb(const AZ::Aabb& aabb) override;
+        const AZ::Aabb& GetAabb() const override;
+        bool IsInDomain(const ConstNetworkEntityHandle& entityHandle) const override;
+        void HandleLossOfAuthoritativeReplicator(const ConstNetworkEntityHandle& entityHandle) override;
+        void DebugDraw() const override;
+        //! @}
+
+    private:
+        AZ::Aabb m_aabb = AZ::Aabb::CreateNull();
+    };
+}
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/MultiplayerReplicationProfiler.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
+#include <AzCore/Metrics/IEventLogger.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    namespace
+    {
+        constexpr uint32_t MaxScopeComponents = 32;
+        constexpr uint32_t MaxScopeProperties = 64;
+
+        // Accumulates the costs of the entity currently being serialized on this thread, without locking or allocating
+        struct EntitySerializeScope
+        {
+            struct ComponentCost
+            {
+                NetComponentId m_netComponentId = InvalidNetComponentId;
+                AZ::u64 m_timeUs = 0;
+            };
+
+            struct PropertyCost
+            {
+                NetComponentId m_netComponentId = InvalidNetComponentId;
+                PropertyIndex m_propertyIndex = PropertyIndex{ 0 };
+                uint32_t m_bytes = 0;
+            };
+
+            AZ::EntityId m_entityId;
+            AZ::TimeUs m_startTimeUs = AZ::Time::ZeroTimeUs;
+            AZ::TimeUs m_componentStartTimeUs = AZ::Time::ZeroTimeUs;
+            AZ::u64 m_bytes = 0;
+            uint32_t m_componentCount = 0;
+            uint32_t m_propertyCount = 0;
+            bool m_active = false;
+            AZStd::array<ComponentCost, MaxScopeComponents> m_components;
+            AZStd::array<PropertyCost, MaxScopeProperties> m_properties;
+        };
+
+        thread_local EntitySerializeScope s_serializeScope;
+
+        AZ::u64 GetPropertyKey(NetComponentId netComponentId, PropertyIndex propertyIndex)
+        {
+            return (aznumeric_cast<AZ::u64>(netComponentId) << 32) | aznumeric_cast<AZ::u64>(propertyIndex);
+        }
+
+        // Components that aren't registered have no name
+        const char* GetComponentName(const MultiplayerComponentRegistry& componentRegistry, NetComponentId netComponentId)
+        {
+            const char* componentName = componentRegistry.GetComponentName(netComponentId);
+            return (componentName != nullptr) ? componentName : "Unknown component";
+        }
+    }
+
+    MultiplayerReplicationProfiler::MultiplayerReplicationProfiler()
+    {
+        m_eventHandlers.m_entitySerializeStart = decltype(m_eventHandlers.m_entitySerializeStart)([this](AzNetworking::SerializerMode mode, AZ::EntityId entityId, [[maybe_unused]] const char* entityName)
+            {
+                OnEntitySerializeStart(mode, entityId);
+            });
+        m_eventHandlers.m_componentSerializeEnd = decltype(m_eventHandlers.m_componentSerializeEnd)([this](AzNetworking::SerializerMode mode, NetComponentId netComponentId)
+            {
+                OnComponentSerializeEnd(mode, netComponentId);
+            });
+        m_eventHandlers.m_entitySerializeStop = decltype(m_eventHandlers.m_entitySerializeStop)([this](AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName)
+            {
+                OnEntitySerializeStop(mode, entityId, entityName);
+            });
+        m_eventHandlers.m_propertySent = decltype(m_eventHandlers.m_propertySent)([this](NetComponentId netComponentId, PropertyIndex propertyIndex, uint32_t totalBytes)
+            {
+                OnPropertySent(netComponentId, propertyIndex, totalBytes);
+            });
+    }
+
+    void MultiplayerReplicationProfiler::SetConnected(bool connect)
+    {
+        if (connect == m_connected)
+        {
+            return;
+        }
+
+        if (connect)
+        {
+            IMultiplayer* multiplayer = GetMultiplayer();
+            if (multiplayer == nullptr)
+            {
+                return;
+            }
+
+            MultiplayerStats& stats = multiplayer->GetStats();
+            m_eventHandlers.m_entitySerializeStart.Connect(stats.m_events.m_entitySerializeStart);
+            m_eventHandlers.m_componentSerializeEnd.Connect(stats.m_events.m_componentSerializeEnd);
+            m_eventHandlers.m_entitySerializeStop.Connect(stats.m_events.m_entitySerializeStop);
+            m_eventHandlers.m_propertySent.Connect(stats.m_events.m_propertySent);
+        }
+        else
+        {
+            m_eventHandlers.m_entitySerializeStart.Disconnect();
+            m_eventHandlers.m_componentSerializeEnd.Disconnect();
+            m_eventHandlers.m_entitySerializeStop.Disconnect();
+            m_eventHandlers.m_propertySent.Disconnect();
+            Reset();
+        }
+
+        m_connected = connect;
+    }
+
+    bool MultiplayerReplicationProfiler::IsConnected() const
+    {
+        return m_connected;
+    }
+
+    void MultiplayerReplicationProfiler::RecordMetrics(AZ::Metrics::IEventLogger& eventLogger, uint32_t reportCount)
+    {
+        ReplicationCostMap entityCosts;
+        ReplicationCostMap componentCosts;
+        ReplicationCostMap propertyCosts;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            entityCosts.swap(m_entityCosts);
+            componentCosts.swap(m_componentCosts);
+            propertyCosts.swap(m_propertyCosts);
+        }
+
+        // Component and property names are resolved once per report rather than once per update
+        if (const MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry())
+        {
+            for (auto& [key, cost] : componentCosts)
+            {
+                cost.m_name = GetComponentName(*componentRegistry, aznumeric_cast<NetComponentId>(key));
+            }
+            for (auto& [key, cost] : propertyCosts)
+            {
+                const NetComponentId netComponentId = aznumeric_cast<NetComponentId>(key >> 32);
+                const PropertyIndex propertyIndex = aznumeric_cast<PropertyIndex>(key & 0xFFFFFFFF);
+                cost.m_name = AZStd::string::format(
+                    "%s.%s", GetComponentName(*componentRegistry, netComponentId),
+                    componentRegistry->GetComponentPropertyName(netComponentId, propertyIndex));
+            }
+        }
+
+        RecordCategory(eventLogger, "ReplicationCostEntities", entityCosts, reportCount);
+        RecordCategory(eventLogger, "ReplicationCostComponents", componentCosts, reportCount);
+        RecordCategory(eventLogger, "ReplicationCostProperties", propertyCosts, reportCount);
+    }
+
+    void MultiplayerReplicationProfiler::Reset()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_entityCosts.clear();
+        m_componentCosts.clear();
+        m_propertyCosts.clear();
+    }
+
+    void MultiplayerReplicationProfiler::OnEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId)
+    {
+        // Only outgoing updates are profiled
+        if (mode != AzNetworking::SerializerMode::ReadFromObject)
+        {
+            return;
+        }
+
+        EntitySerializeScope& scope = s_serializeScope;
+        scope.m_entityId = entityId;
+        scope.m_startTimeUs = AZ::GetRealElapsedTimeUs();
+        scope.m_componentStartTimeUs = scope.m_startTimeUs;
+        scope.m_bytes = 0;
+        scope.m_componentCount = 0;
+        scope.m_propertyCount = 0;
+        scope.m_active = true;
+    }
+
+    void MultiplayerReplicationProfiler::OnComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId)
+    {
+        EntitySerializeScope& scope = s_serializeScope;
+        if (mode != AzNetworking::SerializerMode::ReadFromObject || !scope.m_active)
+        {
+            return;
+        }
+
+        const AZ::TimeUs currentTimeUs = AZ::GetRealElapsedTimeUs();
+        if (scope.m_componentCount < MaxScopeComponents)
+        {
+            EntitySerializeScope::ComponentCost& componentCost = scope.m_components[scope.m_componentCount++];
+            componentCost.m_netComponentId = netComponentId;
+            componentCost.m_timeUs = static_cast<AZ::u64>(currentTimeUs - scope.m_componentStartTimeUs);
+        }
+        scope.m_componentStartTimeUs = currentTimeUs;
+    }
+
+    void MultiplayerReplicationProfiler::OnPropertySent(NetComponentId netComponentId, PropertyIndex propertyIndex, uint32_t totalBytes)
+    {
+        EntitySerializeScope& scope = s_serializeScope;
+        if (!scope.m_active)
+        {
+            return;
+        }
+
+        scope.m_bytes += totalBytes;
+        if (scope.m_propertyCount < MaxScopeProperties)
+        {
+            EntitySerializeScope::PropertyCost& propertyCost = scope.m_properties[scope.m_propertyCount++];
+            propertyCost.m_netComponentId = netComponentId;
+            propertyCost.m_propertyIndex = propertyIndex;
+            propertyCost.m_bytes = totalBytes;
+        }
+    }
+
+    void MultiplayerReplicationProfiler::OnEntitySerializeStop(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName)
+    {
+        EntitySerializeScope& scope = s_serializeScope;
+        if (mode != AzNetworking::SerializerMode::ReadFromObject || !scope.m_active || scope.m_entityId != entityId)
+        {
+            return;
+        }
+        scope.m_active = false;
+
+        const AZ::u64 timeUs = static_cast<AZ::u64>(AZ::GetRealElapsedTimeUs() - scope.m_startTimeUs);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+        ReplicationCost& entityCost = m_entityCosts[static_cast<AZ::u64>(entityId)];
+        if (entityCost.m_name.empty() && entityName != nullptr)
+        {
+            entityCost.m_name = entityName;
+        }
+        entityCost.m_bytes += scope.m_bytes;
+        entityCost.m_timeUs += timeUs;
+        ++entityCost.m_updates;
+
+        for (uint32_t index = 0; index < scope.m_componentCount; ++index)
+        {
+            ReplicationCost& componentCost = m_componentCosts[aznumeric_cast<AZ::u64>(scope.m_components[index].m_netComponentId)];
+            componentCost.m_timeUs += scope.m_components[index].m_timeUs;
+            ++componentCost.m_updates;
+        }
+
+        for (uint32_t index = 0; index < scope.m_propertyCount; ++index)
+        {
+            const EntitySerializeScope::PropertyCost& propertyCost = scope.m_properties[index];
+            m_componentCosts[aznumeric_cast<AZ::u64>(propertyCost.m_netComponentId)].m_bytes += propertyCost.m_bytes;
+
+            ReplicationCost& cost = m_propertyCosts[GetPropertyKey(propertyCost.m_netComponentId, propertyCost.m_propertyIndex)];
+            cost.m_bytes += propertyCost.m_bytes;
+            ++cost.m_updates;
+        }
+    }
+
+    void MultiplayerReplicationProfiler::RecordCategory(AZ::Metrics::IEventLogger& eventLogger, const char* category, ReplicationCostMap& costs, uint32_t reportCount)
+    {
+        AZStd::vector<const ReplicationCost*> sortedCosts;
+        sortedCosts.reserve(costs.size());
+        for (const auto& [key, cost] : costs)
+        {
+            sortedCosts.push_back(&cost);
+        }
+
+        const size_t count = AZStd::min<size_t>(reportCount, sortedCosts.size());
+        AZStd::partial_sort(sortedCosts.begin(), sortedCosts.begin() + count, sortedCosts.end(),
+            [](const ReplicationCost* lhs, const ReplicationCost* rhs)
+            {
+                return (lhs->m_bytes != rhs->m_bytes) ? (lhs->m_bytes > rhs->m_bytes) : (lhs->m_timeUs > rhs->m_timeUs);
+            });
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            const ReplicationCost& cost = *sortedCosts[index];
+            AZStd::array<AZ::Metrics::EventField, 3> argsContainer =
+            {
+                AZ::Metrics::EventField{ "Bytes", cost.m_bytes },
+                AZ::Metrics::EventField{ "CpuTimeUs", cost.m_timeUs },
+                AZ::Metrics::EventField{ "Updates", cost.m_updates }
+            };
+
+            AZ::Metrics::CounterArgs counterArgs;
+            counterArgs.m_name = cost.m_name;
+            counterArgs.m_cat = category;
+            counterArgs.m_args = argsContainer;
+
+            eventLogger.RecordCounterEvent(counterArgs);
+        }
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::Metrics
+{
+    class IEventLogger;
+}
+
+namespace Multiplayer
+{
+    //! @class MultiplayerReplicationProfiler
+    //! Attributes the bytes and serialization time of outgoing entity updates to the entities, components and properties
+    //! that produced them. Costs are accumulated over a metrics collection period and the most expensive entries are
+    //! written to the networking metrics event logger by MultiplayerStatSystemComponent.
+    class MultiplayerReplicationProfiler
+    {
+    public:
+        MultiplayerReplicationProfiler();
+        ~MultiplayerReplicationProfiler() = default;
+
+        //! Starts or stops listening to serialization events from MultiplayerStats.
+        //! @param connect true to start profiling, false to stop and discard any accumulated costs
+        void SetConnected(bool connect);
+        bool IsConnected() const;
+
+        //! Writes the most expensive entities, components and properties since the last call and resets the accumulated costs.
+        //! @param eventLogger the event logger to write the costs to
+        //! @param reportCount the maximum number of entries written per category
+        void RecordMetrics(AZ::Metrics::IEventLogger& eventLogger, uint32_t reportCount);
+
+        //! Discards all accumulated costs.
+        void Reset();
+
+    private:
+        struct ReplicationCost
+        {
+            AZStd::string m_name;
+            AZ::u64 m_bytes = 0;
+            AZ::u64 m_timeUs = 0;
+            AZ::u64 m_updates = 0;
+        };
+        using ReplicationCostMap = AZStd::unordered_map<AZ::u64, ReplicationCost>;
+
+        void OnEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId);
+        void OnComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId);
+        void OnEntitySerializeStop(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
+        void OnPropertySent(NetComponentId netComponentId, PropertyIndex propertyIndex, uint32_t totalBytes);
+
+        static void RecordCategory(AZ::Metrics::IEventLogger& eventLogger, const char* category, ReplicationCostMap& costs, uint32_t reportCount);
+
+        MultiplayerStats::EventHandlers m_eventHandlers;
+        bool m_connected = false;
+
+        // Serialization of separate connections may happen on job threads, costs are gathered per thread and merged under this lock
+        AZStd::mutex m_mutex;
+        ReplicationCostMap m_entityCosts;
+        ReplicationCostMap m_componentCosts;
+        ReplicationCostMap m_propertyCosts;
+    };
+}
@@ -45,6 +45,20 @@ namespace Multiplayer
         nullptr,
         AZ::ConsoleFunctorFlags::DontReplicate,
         "File of the server metrics file if enabled, placed under <ProjectFolder>/user/metrics");
+    AZ_CVAR(
+        bool,
+        sv_enableReplicationProfiling,
+        false,
+        nullptr,
+        AZ::ConsoleFunctorFlags::DontReplicate,
+        "Whether to attribute outgoing replication bytes and serialization time to entities, components and properties in the networking metrics");
+    AZ_CVAR(
+        uint32_t,
+        sv_replicationProfilingReportCount,
+        16,
+        nullptr,
+        AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of most expensive entities, components and properties reported each metrics collection period");
 
     void ConfigureEventLoggerHelper(const AZ::CVarFixedString& filename)
     {
@@ -147,6 +161,7 @@ namespace Multiplayer
     void MultiplayerStatSystemComponent::Unregister()
     {
         m_metricsEvent.RemoveFromQueue();
+        m_replicationProfiler.SetConnected(false);
         if (bg_enableNetworkingMetrics)
         {
             UnregisterEventLoggerHelper();
@@ -228,8 +243,21 @@ namespace Multiplayer
         AZLOG_WARN("Stat with id %d has not been declared using DECLARE_PERFORMANCE_STAT", uniqueStatId);
     }
 
+    void MultiplayerStatSystemComponent::UpdateReplicationProfiler()
+    {
+        bool profileReplication = false;
+        if (sv_enableReplicationProfiling && GetMultiplayer())
+        {
+            const MultiplayerAgentType agentType = GetMultiplayer()->GetAgentType();
+            profileReplication = (agentType == MultiplayerAgentType::DedicatedServer) || (agentType == MultiplayerAgentType::ClientServer);
+        }
+        m_replicationProfiler.SetConnected(profileReplication);
+    }
+
     void MultiplayerStatSystemComponent::RecordMetrics()
     {
+        UpdateReplicationProfiler();
+
         if (const auto* eventLoggerFactory = AZ::Interface<AZ::Metrics::IEventLoggerFactory>::Get())
         {
             if (auto* eventLogger = eventLoggerFactory->FindEventLogger(NetworkingMetricsId))
@@ -270,6 +298,11 @@ namespace Multiplayer
 
                     eventLogger->RecordCounterEvent(counterArgs);
                 }
+
+                if (m_replicationProfiler.IsConnected())
+                {
+                    m_replicationProfiler.RecordMetrics(*eventLogger, sv_replicationProfilingReportCount);
+                }
             }
         }
     }
@@ -13,6 +13,7 @@
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <Multiplayer/MultiplayerStatSystemInterface.h>
+#include <Source/MultiplayerReplicationProfiler.h>
 
 namespace Multiplayer
 {
@@ -51,6 +52,8 @@ namespace Multiplayer
 
     private:
         void RecordMetrics();
+        void UpdateReplicationProfiler();
+
         AZ::ScheduledEvent m_metricsEvent{ [this]()
                                            {
                                                RecordMetrics();
@@ -108,5 +111,7 @@ namespace Multiplayer
         AZStd::unordered_map<int, int> m_statIdToGroupId;
 
         AZStd::mutex m_access;
+
+        MultiplayerReplicationProfiler m_replicationProfiler;
     };
 } // namespace Multiplayer
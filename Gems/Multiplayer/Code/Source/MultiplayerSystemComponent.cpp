@@ -15,6 +15,7 @@
 #include <ConnectionData/ServerToClientConnectionData.h>
 #include <EntityDomains/FullOwnershipEntityDomain.h>
 #include <EntityDomains/NullEntityDomain.h>
+#include <EntityDomains/SpatialEntityDomain.h>
 #include <ReplicationWindows/NullReplicationWindow.h>
 #include <ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <Source/AutoGen/AutoComponentTypes.h>
@@ -102,6 +103,10 @@ namespace Multiplayer
     AZ_CVAR(float, cl_renderTickBlendBase, 0.15f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The base used for blending between network updates, 0.1 will be quite linear, 0.2 or 0.3 will "
         "slow down quicker and may be better suited to connections with highly variable latency");
+    AZ_CVAR(AZ::Vector3, sv_spatialDomainMin, AZ::Vector3::CreateZero(), nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Minimum corner of the region of the world simulated by this server, leave min and max equal for the server to own the whole world");
+    AZ_CVAR(AZ::Vector3, sv_spatialDomainMax, AZ::Vector3::CreateZero(), nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Maximum corner of the region of the world simulated by this server, leave min and max equal for the server to own the whole world");
     AZ_CVAR(bool, bg_multiplayerDebugDraw, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Enables debug draw for the multiplayer gem");
     AZ_CVAR(bool, sv_dedicated_host_onstartup, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether dedicated servers will begin hosting on app startup.");
     AZ_CVAR(bool, cl_connect_onstartup, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "[DEPRECATED: use connect instead] Whether to call connect as soon as the Multiplayer SystemComponent is activated.");
@@ -378,6 +383,7 @@ namespace Multiplayer
         AzFramework::RootSpawnableNotificationBus::Handler::BusDisconnect();
 
         m_networkEntityManager.Reset();
+        m_hitVolumeHistory.Reset();
 
 #if (O3DE_EDITOR_CONNECTION_LISTENER_ENABLE)
         m_editorConnectionListener.reset();
@@ -568,6 +574,9 @@ namespace Multiplayer
                 return;
             }
             m_serverSendAccumulator -= serverRateSeconds;
+
+            // Hit volumes recorded while simulating this frame become its lag compensation history
+            m_hitVolumeHistory.CommitFrame(m_networkTime.GetHostFrameId());
             m_networkTime.IncrementHostFrameId();
         }
 
@@ -591,6 +600,20 @@ namespace Multiplayer
         // Metrics calculation, as update calls are threaded.
         UpdatedMetricsConnectionCount();
 
+        if (NetworkEntityInterestGrid::IsEnabled() &&
+            (GetAgentType() == MultiplayerAgentType::ClientServer || GetAgentType() == MultiplayerAgentType::DedicatedServer))
+        {
+            // Bucket the entities that moved once for all connections, before the replication windows read from the grid
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: OnTick - UpdateInterestGrid");
+            m_networkEntityManager.GetNetworkEntityInterestGrid()->Update(*m_networkEntityManager.GetNetworkEntityTracker());
+        }
+
+        if (GetAgentType() == MultiplayerAgentType::ClientServer || GetAgentType() == MultiplayerAgentType::DedicatedServer)
+        {
+            // Hand off entities that left our region before the game state update goes out
+            m_networkEntityManager.UpdateEntityDomain();
+        }
+
         // Send out the game state update to all connections
         UpdateConnections();
 
@@ -1353,8 +1376,17 @@ namespace Multiplayer
                     const uint16_t serverPort = cl_serverport;
                     const AzNetworking::ProtocolType serverProtocol = sv_protocol;
                     const AzNetworking::IpAddress hostId = AzNetworking::IpAddress(serverAddr.c_str(), serverPort, serverProtocol);
-                    // Set up a full ownership domain if we didn't construct a domain during the initialize event
-                    m_networkEntityManager.Initialize(hostId, AZStd::make_unique<FullOwnershipEntityDomain>());
+                    // Set up a spatial domain if a region was configured, or a full ownership domain if we didn't construct a domain during the initialize event
+                    const AZ::Vector3 domainMin = sv_spatialDomainMin;
+                    const AZ::Vector3 domainMax = sv_spatialDomainMax;
+                    if (domainMin.IsLessThan(domainMax))
+                    {
+                        m_networkEntityManager.Initialize(hostId, AZStd::make_unique<SpatialEntityDomain>(AZ::Aabb::CreateFromMinMax(domainMin, domainMax)));
+                    }
+                    else
+                    {
+                        m_networkEntityManager.Initialize(hostId, AZStd::make_unique<FullOwnershipEntityDomain>());
+                    }
                 }
             }
             else if (multiplayerType == MultiplayerAgentType::Client)
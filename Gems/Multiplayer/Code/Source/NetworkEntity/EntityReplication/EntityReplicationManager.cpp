@@ -23,6 +23,8 @@
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/sort.h>
 
 AZ_DECLARE_BUDGET(MULTIPLAYER);
 
@@ -35,6 +37,13 @@ namespace Multiplayer
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
     AZ_CVAR(AZ::TimeMs, sv_ReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
+    AZ_CVAR(uint32_t, sv_ReplicationBandwidthBudgetBytes, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Per connection budget in bytes per second for proxy entity updates sent to clients, 0 disables the budget. Autonomous entities are always sent.");
+    AZ_CVAR(float, sv_ReplicationBudgetStarvationBoost, 0.5f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How much a deferred proxy entity's priority grows for each send it was deferred by the bandwidth budget.");
+
+    // Used in place of the last update size for replicators that haven't sent an update yet
+    constexpr uint32_t DefaultUpdateSizeEstimate = 128;
     
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -120,6 +129,7 @@ namespace Multiplayer
     void EntityReplicationManager::SendUpdates()
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
+        RefillBandwidthBudget();
 
         {
             EntityReplicatorList toSendList = GenerateEntityUpdateList();
@@ -154,6 +164,7 @@ namespace Multiplayer
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
         SendEntityRpcs(m_deferredRpcMessagesUnreliable, false);
+        m_deferredLatestValueRpcs.clear();
 
         m_orphanedEntityRpcs.Update();
 
@@ -184,6 +195,10 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
+        // Proxy updates to clients compete for the connection's bandwidth budget, when one is set
+        const bool useBandwidthBudget = (sv_ReplicationBandwidthBudgetBytes > 0) && IsUpdateModeToServerClient();
+        AZStd::vector<EntityReplicator*> budgetedProxyReplicators;
+
         uint32_t proxySendCount = 0;
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
@@ -222,6 +237,10 @@ namespace Multiplayer
                         {
                             toSendList.push_back(replicator);
                         }
+                        else if (useBandwidthBudget)
+                        {
+                            budgetedProxyReplicators.push_back(replicator);
+                        }
                         else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
                         {
                             toSendList.push_back(replicator);
@@ -242,9 +261,84 @@ namespace Multiplayer
             }
         }
 
+        if (!budgetedProxyReplicators.empty())
+        {
+            SelectBudgetedProxyUpdates(budgetedProxyReplicators, toSendList);
+        }
+
         return toSendList;
     }
 
+    void EntityReplicationManager::SelectBudgetedProxyUpdates(AZStd::vector<EntityReplicator*>& proxyReplicators, EntityReplicatorList& toSendList)
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SelectBudgetedProxyUpdates");
+
+        // Score each replicator by its replication window priority, boosted by how long it has been starved of bandwidth
+        using ScoredReplicator = AZStd::pair<float, EntityReplicator*>;
+        AZStd::vector<ScoredReplicator> scoredReplicators;
+        scoredReplicators.reserve(proxyReplicators.size());
+
+        const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
+        const float starvationBoost = sv_ReplicationBudgetStarvationBoost;
+        for (EntityReplicator* replicator : proxyReplicators)
+        {
+            auto replicationIter = replicationSet.find(replicator->GetEntityHandle());
+            // Entities with no priority still gain a little every send so they can't be starved indefinitely
+            const float priority = (replicationIter != replicationSet.end()) ? AZStd::max(replicationIter->second.m_priority, 0.001f) : 0.001f;
+            const float score = priority * (1.0f + starvationBoost * aznumeric_cast<float>(replicator->GetBudgetDeferralCount()));
+            scoredReplicators.emplace_back(score, replicator);
+        }
+
+        AZStd::sort(scoredReplicators.begin(), scoredReplicators.end(), [](const ScoredReplicator& lhs, const ScoredReplicator& rhs)
+        {
+            return lhs.first > rhs.first;
+        });
+
+        // Admit updates in priority order while both the send count and budget allow, the budget may go into debt by at most one update
+        const uint32_t maxProxySendCount = m_replicationWindow->GetMaxProxyEntityReplicatorSendCount();
+        int64_t remainingBudgetBytes = m_bandwidthBudgetBytes;
+        uint32_t proxySendCount = 0;
+        for (const ScoredReplicator& scoredReplicator : scoredReplicators)
+        {
+            EntityReplicator* replicator = scoredReplicator.second;
+            if ((proxySendCount < maxProxySendCount) && (remainingBudgetBytes > 0))
+            {
+                const uint32_t lastUpdateSize = replicator->GetLastUpdateSize();
+                remainingBudgetBytes -= (lastUpdateSize > 0) ? lastUpdateSize : DefaultUpdateSizeEstimate;
+                replicator->SetBudgetDeferralCount(0);
+                toSendList.push_back(replicator);
+                ++proxySendCount;
+            }
+            else
+            {
+                // Deferred replicators remain pending send, so their changes go out once they win enough budget
+                replicator->SetBudgetDeferralCount(replicator->GetBudgetDeferralCount() + 1);
+            }
+        }
+    }
+
+    void EntityReplicationManager::RefillBandwidthBudget()
+    {
+        const int64_t budgetBytesPerSecond = aznumeric_cast<int64_t>(static_cast<uint32_t>(sv_ReplicationBandwidthBudgetBytes));
+        if (budgetBytesPerSecond <= 0)
+        {
+            m_bandwidthBudgetTimeMs = AZ::Time::ZeroTimeMs;
+            return;
+        }
+
+        if (m_bandwidthBudgetTimeMs == AZ::Time::ZeroTimeMs)
+        {
+            m_bandwidthBudgetBytes = budgetBytesPerSecond;
+        }
+        else
+        {
+            // Refill proportionally to elapsed time, never banking more than one second of budget
+            const int64_t elapsedMs = static_cast<int64_t>(m_frameTimeMs - m_bandwidthBudgetTimeMs);
+            m_bandwidthBudgetBytes = AZStd::min(m_bandwidthBudgetBytes + (budgetBytesPerSecond * elapsedMs) / 1000, budgetBytesPerSecond);
+        }
+        m_bandwidthBudgetTimeMs = m_frameTimeMs;
+    }
+
     void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
     {
         uint32_t pendingPacketSize = 0;
@@ -268,6 +362,8 @@ namespace Multiplayer
             }
 
             pendingPacketSize += nextMessageSize;
+            m_bandwidthBudgetBytes -= nextMessageSize;
+            replicator->SetLastUpdateSize(nextMessageSize);
             entityUpdates.push_back(updateMessage);
             replicatorUpdatedList.push_back(replicator);
             replicatorList.pop_front();
@@ -303,16 +399,26 @@ namespace Multiplayer
 
     void EntityReplicationManager::SendEntityRpcs(RpcMessages& rpcMessages, bool reliable)
     {
+        // Identifiers already in the dictionaries of the pending packet
+        AZStd::unordered_set<NetEntityId> packetEntities;
+        AZStd::unordered_set<uint32_t> packetRpcs;
+
         while (!rpcMessages.empty())
         {
             NetworkEntityRpcVector entityRpcs;
-            uint32_t pendingPacketSize = 0;
+            // The entity, rpc and message counts of the aggregated packet
+            uint32_t pendingPacketSize = 3 * sizeof(uint16_t);
+            packetEntities.clear();
+            packetRpcs.clear();
 
             while (!rpcMessages.empty())
             {
                 NetworkEntityRpcMessage& message = rpcMessages.front();
 
-                const uint32_t nextRpcSize = message.GetEstimatedSerializeSize();
+                const uint32_t rpcKey = (static_cast<uint32_t>(message.GetComponentId()) << 16) | static_cast<uint32_t>(message.GetRpcIndex());
+                const bool isNewEntity = !packetEntities.contains(message.GetEntityId());
+                const bool isNewRpc = !packetRpcs.contains(rpcKey);
+                const uint32_t nextRpcSize = message.GetEstimatedAggregatedSerializeSize(isNewEntity, isNewRpc);
 
                 if ((pendingPacketSize + nextRpcSize) > m_maxPayloadSize)
                 {
@@ -333,7 +439,9 @@ namespace Multiplayer
                     AZLOG(NET_Replicator, "We've hit our RPC message limit (RPC count %u, packet size %u)", aznumeric_cast<uint32_t>(entityRpcs.size()), pendingPacketSize);
                     break;
                 }
-                entityRpcs.push_back(message);
+                packetEntities.insert(message.GetEntityId());
+                packetRpcs.insert(rpcKey);
+                entityRpcs.push_back(AZStd::move(message));
                 rpcMessages.pop_front();
             }
 
@@ -507,7 +615,23 @@ namespace Multiplayer
         }
         else
         {
-            m_deferredRpcMessagesUnreliable.emplace_back(message);
+            if (message.IsLatestValueWins())
+            {
+                // Only the newest state of a latest-value-wins rpc is worth sending, replace the one that's still waiting for this tick
+                const uint32_t rpcKey = (static_cast<uint32_t>(message.GetComponentId()) << 16) | static_cast<uint32_t>(message.GetRpcIndex());
+                auto pendingIt = m_deferredLatestValueRpcs.find(RpcKey(message.GetEntityId(), rpcKey));
+                if (pendingIt != m_deferredLatestValueRpcs.end())
+                {
+                    *pendingIt->second = message;
+                    return;
+                }
+                m_deferredRpcMessagesUnreliable.emplace_back(message);
+                m_deferredLatestValueRpcs.emplace(RpcKey(message.GetEntityId(), rpcKey), AZStd::prev(m_deferredRpcMessagesUnreliable.end()));
+            }
+            else
+            {
+                m_deferredRpcMessagesUnreliable.emplace_back(message);
+            }
         }
     }
 
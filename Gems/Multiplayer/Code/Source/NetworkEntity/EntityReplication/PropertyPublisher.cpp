@@ -15,6 +15,8 @@
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
+    AZ_CVAR(bool, net_EntityReplicatorShareSerialization, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Reuse the serialized entity update across connections that send the same changes in a frame");
+    AZ_CVAR(bool, net_EntityReplicatorBaselineDelta, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Skip the components of entity updates whose state is unchanged since the state acknowledged by the connection");
 
     PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, AzNetworking::IConnection& connection)
         : m_ownsLifetime(ownsLifetime)
@@ -98,6 +100,10 @@ namespace Multiplayer
             {
                 mostRecentAckedIter = iter;
                 m_remoteReplicatorEstablished = true;
+                if (m_sentCompleteState)
+                {
+                    m_baselineSnapshotId = iter->m_sentSnapshotId;
+                }
                 break;
             }
         }
@@ -125,6 +131,10 @@ namespace Multiplayer
         m_sentRecords.clear();
         netBindComponent->FillTotalReplicationRecord(m_pendingRecord);
         m_sentRecords.push_front(m_pendingRecord);
+
+        // The remote endpoint no longer depends on previously sent state once this record is received
+        m_baselineSnapshotId = InvalidEntitySnapshotId;
+        m_sentCompleteState = true;
     }
 
     void PropertyPublisher::PrepareRebaseEntityRecord(NetBindComponent* netBindComponent)
@@ -140,6 +150,10 @@ namespace Multiplayer
             m_pendingRecord.Subtract(netBindComponent->GetPredictableRecord());
         }
         m_sentRecords.push_front(m_pendingRecord);
+
+        // Rebase records omit the predictable properties, so they never provide a complete baseline
+        m_baselineSnapshotId = InvalidEntitySnapshotId;
+        m_sentCompleteState = false;
     }
 
     void PropertyPublisher::PrepareUpdateEntityRecord(NetBindComponent* netBindComponent)
@@ -203,6 +217,45 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    void PropertyPublisher::RemoveStateUnchangedSinceBaseline(NetBindComponent* netBindComponent)
+    {
+        // Predictable properties are removed from the records sent to the Autonomous role, so the snapshots wouldn't match its state
+        const NetEntityRole remoteNetEntityRole = m_pendingRecord.GetRemoteNetworkRole();
+        if (!net_EntityReplicatorBaselineDelta || !m_sentCompleteState || (remoteNetEntityRole == NetEntityRole::Autonomous))
+        {
+            return;
+        }
+
+        if (m_sentRecords.empty() || (m_sentRecords.front().m_sentPacketId != AzNetworking::InvalidPacketId))
+        {
+            return;
+        }
+
+        // The snapshot becomes the baseline once the record is acknowledged
+        ReplicationRecord& sendingRecord = m_sentRecords.front();
+        sendingRecord.m_sentSnapshotId = netBindComponent->CaptureStateSnapshot(remoteNetEntityRole);
+        if ((sendingRecord.m_sentSnapshotId == InvalidEntitySnapshotId) || (m_baselineSnapshotId == InvalidEntitySnapshotId))
+        {
+            return;
+        }
+
+        // Any unacknowledged record may have been received, so a component is only skipped if its state matches all of them
+        m_comparedSnapshotIds.clear();
+        m_comparedSnapshotIds.push_back(m_baselineSnapshotId);
+        auto iter = m_sentRecords.begin();
+        ++iter; // Consider everything sent after the acknowledged record
+        for (; iter != m_sentRecords.end(); ++iter)
+        {
+            if (iter->m_sentSnapshotId == InvalidEntitySnapshotId)
+            {
+                return;
+            }
+            m_comparedSnapshotIds.push_back(iter->m_sentSnapshotId);
+        }
+
+        netBindComponent->RemoveUnchangedComponentStates(m_pendingRecord, sendingRecord.m_sentSnapshotId, m_comparedSnapshotIds);
+    }
+
     void PropertyPublisher::FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId)
     {
         // Fill in the packet id for the last sent update
@@ -372,6 +425,22 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
+        if (!isDeleted)
+        {
+            RemoveStateUnchangedSinceBaseline(netBindComponent);
+        }
+
+        if (net_EntityReplicatorShareSerialization && !isDeleted)
+        {
+            // Deletes are cached on the publisher and may be sent in a later frame, so they're always serialized on their own
+            if (!netBindComponent->SerializeSharedStateDeltaMessage(m_pendingRecord, updateMessage.ModifyData()))
+            {
+                AZLOG_ERROR("EntityReplicator: Serialization failed");
+                AZ_Assert(false, "EntityReplicator: Serialization failed");
+            }
+            return updateMessage;
+        }
+
         InputSerializer inputSerializer(
             updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
         SerializeEntityRecord(inputSerializer, netBindComponent);
@@ -117,6 +117,10 @@ namespace Multiplayer
         //! Add/update/delete all use the same serialization path.
         bool SerializeEntityRecord(AzNetworking::ISerializer& serializer, NetBindComponent* netBindComponent);
 
+        //! Captures the state snapshot of the record about to be sent, and removes the changes of the components whose state
+        //! is the same as the acknowledged baseline and every state sent since, which the remote endpoint already holds.
+        void RemoveStateUnchangedSinceBaseline(NetBindComponent* netBindComponent);
+
         //! Phase 3, finalize with the packet id
         void FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId);
         void FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId);
@@ -141,6 +145,14 @@ namespace Multiplayer
         //! True if the remote replicator has acknowledged at least one packet, which means that it exists and created the entity.
         bool m_remoteReplicatorEstablished = false;
 
+        //! Snapshot of the entity state sent with the most recently acknowledged record.
+        //! The remote endpoint holds this state, or the state of a record sent after it.
+        EntitySnapshotId m_baselineSnapshotId = InvalidEntitySnapshotId;
+        //! True once this publisher has sent the complete entity state, acknowledged state is only a valid baseline after that.
+        bool m_sentCompleteState = false;
+        //! Scratch list of the snapshots the remote endpoint may hold, kept to avoid reallocating it for every update.
+        AZStd::vector<EntitySnapshotId> m_comparedSnapshotIds;
+
         // In the case of deletes, we need to produce our update message at the point of deletion
         // and then keep it around until it's requested. By the time the message is requested, the entity
         // is likely already deleted, so the data to serialize from it would no longer be available.
@@ -137,6 +137,49 @@ namespace Multiplayer
         return hasChanges;
     }
 
+    bool ReplicationRecord::HasSameChanges(const ReplicationRecord& rhs) const
+    {
+        return (m_remoteNetEntityRole == rhs.m_remoteNetEntityRole)
+            && (m_authorityToClient == rhs.m_authorityToClient)
+            && (m_authorityToServer == rhs.m_authorityToServer)
+            && (m_authorityToAutonomous == rhs.m_authorityToAutonomous)
+            && (m_autonomousToAuthority == rhs.m_autonomousToAuthority);
+    }
+
+    static void AppendBitsInRange(AZStd::vector<uint8_t>& outChanges, const ReplicationRecord::RecordBitset& bitset, uint32_t startBit, uint32_t bitCount)
+    {
+        for (uint32_t bitIndex = startBit; bitIndex < startBit + bitCount; ++bitIndex)
+        {
+            outChanges.push_back(((bitIndex < bitset.GetValidBitCount()) && bitset.GetBit(bitIndex)) ? 1 : 0);
+        }
+    }
+
+    void ReplicationRecord::GetChangesInRange(AZStd::vector<uint8_t>& outChanges, const ReplicationRecordStats& startBits, const ReplicationRecordStats& bitCounts) const
+    {
+        outChanges.push_back(static_cast<uint8_t>(m_remoteNetEntityRole));
+        AppendBitsInRange(outChanges, m_authorityToClient, startBits.m_authorityToClientCount, bitCounts.m_authorityToClientCount);
+        AppendBitsInRange(outChanges, m_authorityToServer, startBits.m_authorityToServerCount, bitCounts.m_authorityToServerCount);
+        AppendBitsInRange(outChanges, m_authorityToAutonomous, startBits.m_authorityToAutonomousCount, bitCounts.m_authorityToAutonomousCount);
+        AppendBitsInRange(outChanges, m_autonomousToAuthority, startBits.m_autonomousToAuthorityCount, bitCounts.m_autonomousToAuthorityCount);
+    }
+
+    static void ClearBitsInRange(ReplicationRecord::RecordBitset& bitset, uint32_t startBit, uint32_t bitCount)
+    {
+        const uint32_t endBit = AZStd::min(startBit + bitCount, bitset.GetValidBitCount());
+        for (uint32_t bitIndex = startBit; bitIndex < endBit; ++bitIndex)
+        {
+            bitset.SetBit(bitIndex, false);
+        }
+    }
+
+    void ReplicationRecord::ClearChangesInRange(const ReplicationRecordStats& startBits, const ReplicationRecordStats& bitCounts)
+    {
+        ClearBitsInRange(m_authorityToClient, startBits.m_authorityToClientCount, bitCounts.m_authorityToClientCount);
+        ClearBitsInRange(m_authorityToServer, startBits.m_authorityToServerCount, bitCounts.m_authorityToServerCount);
+        ClearBitsInRange(m_authorityToAutonomous, startBits.m_authorityToAutonomousCount, bitCounts.m_authorityToAutonomousCount);
+        ClearBitsInRange(m_autonomousToAuthority, startBits.m_autonomousToAuthorityCount, bitCounts.m_autonomousToAuthorityCount);
+    }
+
     bool ReplicationRecord::Serialize(AzNetworking::ISerializer& serializer)
     {
         if (ContainsAuthorityToClientBits())
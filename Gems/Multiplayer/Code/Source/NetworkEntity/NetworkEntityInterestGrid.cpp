@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/NetworkEntityInterestGrid.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(bool, sv_UseInterestGrid, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Use the interest grid to gather the entities to replicate to client connections instead of querying the visibility system");
+    AZ_CVAR(float, sv_InterestGridCellSize, 64.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The size of the interest grid cells in meters, only applied when the grid is created");
+    AZ_CVAR(uint32_t, sv_InterestGridHysteresisCells, 1, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of cells beyond the awareness radius a subscribed cell is kept before it is unsubscribed");
+
+    // Limits the number of cells a single subscription can span, regardless of the radius
+    static constexpr int32_t MaxSubscriptionRange = 64;
+
+    bool NetworkEntityInterestGrid::IsEnabled()
+    {
+        return sv_UseInterestGrid;
+    }
+
+    NetworkEntityInterestGrid::NetworkEntityInterestGrid()
+        : m_cellSize(AZStd::max(static_cast<float>(sv_InterestGridCellSize), 1.0f))
+    {
+        ;
+    }
+
+    void NetworkEntityInterestGrid::Update(NetworkEntityTracker& networkEntityTracker)
+    {
+        if (m_subscriptions.empty())
+        {
+            // Nothing is interested in the entities, so don't track them until something subscribes
+            m_trackedEntities.clear();
+            m_cells.clear();
+            return;
+        }
+
+        ++m_updateStamp;
+        for (auto& [netEntityId, entity] : networkEntityTracker)
+        {
+            if ((entity == nullptr) || (entity->GetState() != AZ::Entity::State::Active))
+            {
+                continue;
+            }
+
+            AZ::TransformInterface* transformInterface = entity->GetTransform();
+            if (transformInterface == nullptr)
+            {
+                continue;
+            }
+
+            const CellKey cellKey = GetCellKey(GetCellCoord(transformInterface->GetWorldTranslation()));
+            auto trackedIter = m_trackedEntities.find(netEntityId);
+            if (trackedIter == m_trackedEntities.end())
+            {
+                TrackedEntity& trackedEntity = m_trackedEntities[netEntityId];
+                trackedEntity.m_entityHandle = ConstNetworkEntityHandle(entity, &networkEntityTracker);
+                trackedEntity.m_cellKey = cellKey;
+                trackedEntity.m_updateStamp = m_updateStamp;
+                AddEntityToCell(trackedEntity.m_entityHandle, cellKey);
+            }
+            else
+            {
+                TrackedEntity& trackedEntity = trackedIter->second;
+                trackedEntity.m_updateStamp = m_updateStamp;
+                if (trackedEntity.m_cellKey != cellKey)
+                {
+                    MoveEntity(trackedEntity.m_entityHandle, trackedEntity.m_cellKey, cellKey);
+                    trackedEntity.m_cellKey = cellKey;
+                }
+            }
+        }
+
+        // Anything that wasn't visited was removed or deactivated
+        for (auto trackedIter = m_trackedEntities.begin(); trackedIter != m_trackedEntities.end();)
+        {
+            if (trackedIter->second.m_updateStamp != m_updateStamp)
+            {
+                RemoveEntityFromCell(trackedIter->second.m_entityHandle, trackedIter->second.m_cellKey);
+                trackedIter = m_trackedEntities.erase(trackedIter);
+            }
+            else
+            {
+                ++trackedIter;
+            }
+        }
+    }
+
+    void NetworkEntityInterestGrid::UpdateSubscription(ISubscriber& subscriber, const AZ::Vector3& position, float radius)
+    {
+        const CellCoord center = GetCellCoord(position);
+        const int32_t range = AZStd::min(static_cast<int32_t>(AZStd::ceil(AZStd::max(radius, 0.0f) / m_cellSize)), MaxSubscriptionRange);
+
+        Subscription& subscription = m_subscriptions[&subscriber];
+        if ((subscription.m_range == range) && (subscription.m_center.m_x == center.m_x) && (subscription.m_center.m_y == center.m_y))
+        {
+            // Still in the same cell, nothing to change
+            return;
+        }
+        subscription.m_center = center;
+        subscription.m_range = range;
+
+        // Drop the cells that are too far away, including hysteresis
+        const int32_t keepRange = range + static_cast<int32_t>(static_cast<uint32_t>(sv_InterestGridHysteresisCells));
+        for (auto cellIter = subscription.m_cells.begin(); cellIter != subscription.m_cells.end();)
+        {
+            const CellCoord coord = GetCellCoordFromKey(*cellIter);
+            if ((AZStd::abs(coord.m_x - center.m_x) > keepRange) || (AZStd::abs(coord.m_y - center.m_y) > keepRange))
+            {
+                UnsubscribeCell(subscriber, *cellIter, true);
+                cellIter = subscription.m_cells.erase(cellIter);
+            }
+            else
+            {
+                ++cellIter;
+            }
+        }
+
+        // Add the cells that came into range
+        for (int32_t y = center.m_y - range; y <= center.m_y + range; ++y)
+        {
+            for (int32_t x = center.m_x - range; x <= center.m_x + range; ++x)
+            {
+                const CellKey cellKey = GetCellKey(CellCoord{ x, y });
+                if (subscription.m_cells.insert(cellKey).second)
+                {
+                    SubscribeCell(subscriber, cellKey);
+                }
+            }
+        }
+    }
+
+    void NetworkEntityInterestGrid::Unsubscribe(ISubscriber& subscriber)
+    {
+        auto subscriptionIter = m_subscriptions.find(&subscriber);
+        if (subscriptionIter == m_subscriptions.end())
+        {
+            return;
+        }
+
+        for (CellKey cellKey : subscriptionIter->second.m_cells)
+        {
+            UnsubscribeCell(subscriber, cellKey, false);
+        }
+        m_subscriptions.erase(subscriptionIter);
+    }
+
+    void NetworkEntityInterestGrid::Clear()
+    {
+        m_cells.clear();
+        m_trackedEntities.clear();
+        m_subscriptions.clear();
+    }
+
+    AZStd::size_t NetworkEntityInterestGrid::GetEntityCount() const
+    {
+        return m_trackedEntities.size();
+    }
+
+    NetworkEntityInterestGrid::CellCoord NetworkEntityInterestGrid::GetCellCoord(const AZ::Vector3& position) const
+    {
+        return CellCoord
+        {
+            static_cast<int32_t>(AZStd::floor(position.GetX() / m_cellSize)),
+            static_cast<int32_t>(AZStd::floor(position.GetY() / m_cellSize))
+        };
+    }
+
+    NetworkEntityInterestGrid::CellKey NetworkEntityInterestGrid::GetCellKey(const CellCoord& coord)
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(coord.m_x)) << 32) | static_cast<CellKey>(static_cast<uint32_t>(coord.m_y));
+    }
+
+    NetworkEntityInterestGrid::CellCoord NetworkEntityInterestGrid::GetCellCoordFromKey(CellKey cellKey)
+    {
+        return CellCoord
+        {
+            static_cast<int32_t>(static_cast<uint32_t>(cellKey >> 32)),
+            static_cast<int32_t>(static_cast<uint32_t>(cellKey & 0xFFFFFFFF))
+        };
+    }
+
+    void NetworkEntityInterestGrid::SubscribeCell(ISubscriber& subscriber, CellKey cellKey)
+    {
+        Cell& cell = m_cells[cellKey];
+        cell.m_subscribers.push_back(&subscriber);
+        for (const ConstNetworkEntityHandle& entityHandle : cell.m_entities)
+        {
+            subscriber.OnEntityEnteredInterest(entityHandle);
+        }
+    }
+
+    void NetworkEntityInterestGrid::UnsubscribeCell(ISubscriber& subscriber, CellKey cellKey, bool notify)
+    {
+        auto cellIter = m_cells.find(cellKey);
+        if (cellIter == m_cells.end())
+        {
+            return;
+        }
+
+        Cell& cell = cellIter->second;
+        auto subscriberIter = AZStd::find(cell.m_subscribers.begin(), cell.m_subscribers.end(), &subscriber);
+        if (subscriberIter != cell.m_subscribers.end())
+        {
+            *subscriberIter = cell.m_subscribers.back();
+            cell.m_subscribers.pop_back();
+        }
+
+        if (notify)
+        {
+            for (const ConstNetworkEntityHandle& entityHandle : cell.m_entities)
+            {
+                subscriber.OnEntityLeftInterest(entityHandle);
+            }
+        }
+
+        if (cell.m_entities.empty() && cell.m_subscribers.empty())
+        {
+            m_cells.erase(cellIter);
+        }
+    }
+
+    void NetworkEntityInterestGrid::AddEntityToCell(const ConstNetworkEntityHandle& entityHandle, CellKey cellKey)
+    {
+        Cell& cell = m_cells[cellKey];
+        cell.m_entities.push_back(entityHandle);
+        for (ISubscriber* subscriber : cell.m_subscribers)
+        {
+            subscriber->OnEntityEnteredInterest(entityHandle);
+        }
+    }
+
+    void NetworkEntityInterestGrid::RemoveEntityFromCell(const ConstNetworkEntityHandle& entityHandle, CellKey cellKey)
+    {
+        auto cellIter = m_cells.find(cellKey);
+        if (cellIter == m_cells.end())
+        {
+            return;
+        }
+
+        Cell& cell = cellIter->second;
+        auto entityIter = AZStd::find(cell.m_entities.begin(), cell.m_entities.end(), entityHandle);
+        if (entityIter != cell.m_entities.end())
+        {
+            *entityIter = cell.m_entities.back();
+            cell.m_entities.pop_back();
+        }
+
+        for (ISubscriber* subscriber : cell.m_subscribers)
+        {
+            subscriber->OnEntityLeftInterest(entityHandle);
+        }
+
+        if (cell.m_entities.empty() && cell.m_subscribers.empty())
+        {
+            m_cells.erase(cellIter);
+        }
+    }
+
+    void NetworkEntityInterestGrid::MoveEntity(const ConstNetworkEntityHandle& entityHandle, CellKey fromCellKey, CellKey toCellKey)
+    {
+        Cell& toCell = m_cells[toCellKey];
+        toCell.m_entities.push_back(entityHandle);
+
+        auto fromCellIter = m_cells.find(fromCellKey);
+        if (fromCellIter == m_cells.end())
+        {
+            for (ISubscriber* subscriber : toCell.m_subscribers)
+            {
+                subscriber->OnEntityEnteredInterest(entityHandle);
+            }
+            return;
+        }
+
+        Cell& fromCell = fromCellIter->second;
+        auto entityIter = AZStd::find(fromCell.m_entities.begin(), fromCell.m_entities.end(), entityHandle);
+        if (entityIter != fromCell.m_entities.end())
+        {
+            *entityIter = fromCell.m_entities.back();
+            fromCell.m_entities.pop_back();
+        }
+
+        // Subscribers of both cells keep seeing the entity, so only notify the ones that are in one of the two cells
+        for (ISubscriber* subscriber : fromCell.m_subscribers)
+        {
+            if (AZStd::find(toCell.m_subscribers.begin(), toCell.m_subscribers.end(), subscriber) == toCell.m_subscribers.end())
+            {
+                subscriber->OnEntityLeftInterest(entityHandle);
+            }
+        }
+        for (ISubscriber* subscriber : toCell.m_subscribers)
+        {
+            if (AZStd::find(fromCell.m_subscribers.begin(), fromCell.m_subscribers.end(), subscriber) == fromCell.m_subscribers.end())
+            {
+                subscriber->OnEntityEnteredInterest(entityHandle);
+            }
+        }
+
+        if (fromCell.m_entities.empty() && fromCell.m_subscribers.empty())
+        {
+            m_cells.erase(fromCellIter);
+        }
+    }
+}
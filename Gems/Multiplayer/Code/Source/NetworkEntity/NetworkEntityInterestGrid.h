@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+
+namespace Multiplayer
+{
+    class NetworkEntityTracker;
+
+    //! @class NetworkEntityInterestGrid
+    //! @brief Spatial hash of the networked entities used for interest management.
+    //!
+    //! Entities are bucketed into square cells on the XY plane. Subscribers, such as the replication windows of client
+    //! connections, register interest in the cells around a position and are notified when entities enter or leave those
+    //! cells. The cells of all entities are updated once per tick for every subscriber, so a subscriber only has to
+    //! process the entities that changed cells rather than gather every entity around it on each update.
+    //!
+    //! The grid must only be used from the main thread.
+    class NetworkEntityInterestGrid
+    {
+    public:
+        class ISubscriber
+        {
+        public:
+            virtual ~ISubscriber() = default;
+
+            //! Called when an entity enters one of the subscribed cells, or when a cell containing the entity is subscribed.
+            //! @param entityHandle the entity that entered the subscribed area
+            virtual void OnEntityEnteredInterest(const ConstNetworkEntityHandle& entityHandle) = 0;
+
+            //! Called when an entity leaves the subscribed cells, or when a cell containing the entity is unsubscribed.
+            //! @param entityHandle the entity that left the subscribed area
+            virtual void OnEntityLeftInterest(const ConstNetworkEntityHandle& entityHandle) = 0;
+        };
+
+        //! Returns whether replication windows should use the interest grid instead of querying the visibility system.
+        //! @return boolean true if the interest grid is enabled
+        static bool IsEnabled();
+
+        NetworkEntityInterestGrid();
+        ~NetworkEntityInterestGrid() = default;
+
+        //! Moves the entities that changed cells since the last update and notifies the subscribers of the affected cells.
+        //! Entities that are no longer tracked or active are removed from the grid.
+        //! @param networkEntityTracker the tracker of the networked entities to bucket
+        void Update(NetworkEntityTracker& networkEntityTracker);
+
+        //! Subscribes to the cells within the radius of the position.
+        //! Cells that are already subscribed stay subscribed until they are more than sv_InterestGridHysteresisCells further away,
+        //! so moving back and forth across a cell border doesn't repeatedly add and remove the same entities.
+        //! @param subscriber the subscriber to update the subscription of
+        //! @param position   the center of the area of interest
+        //! @param radius     the radius of the area of interest
+        void UpdateSubscription(ISubscriber& subscriber, const AZ::Vector3& position, float radius);
+
+        //! Removes all the subscriptions of the subscriber, no notifications are sent.
+        //! @param subscriber the subscriber to remove
+        void Unsubscribe(ISubscriber& subscriber);
+
+        //! Removes all entities and subscriptions.
+        void Clear();
+
+        //! Returns the number of entities in the grid.
+        //! @return the number of entities in the grid
+        AZStd::size_t GetEntityCount() const;
+
+    private:
+        using CellKey = uint64_t;
+
+        struct CellCoord
+        {
+            int32_t m_x = 0;
+            int32_t m_y = 0;
+        };
+
+        struct Cell
+        {
+            AZStd::vector<ConstNetworkEntityHandle> m_entities;
+            AZStd::vector<ISubscriber*> m_subscribers;
+        };
+
+        struct TrackedEntity
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            CellKey m_cellKey = 0;
+            uint32_t m_updateStamp = 0;
+        };
+
+        struct Subscription
+        {
+            CellCoord m_center;
+            int32_t m_range = -1;
+            AZStd::unordered_set<CellKey> m_cells;
+        };
+
+        CellCoord GetCellCoord(const AZ::Vector3& position) const;
+        static CellKey GetCellKey(const CellCoord& coord);
+        static CellCoord GetCellCoordFromKey(CellKey cellKey);
+
+        void SubscribeCell(ISubscriber& subscriber, CellKey cellKey);
+        void UnsubscribeCell(ISubscriber& subscriber, CellKey cellKey, bool notify);
+        void AddEntityToCell(const ConstNetworkEntityHandle& entityHandle, CellKey cellKey);
+        void RemoveEntityFromCell(const ConstNetworkEntityHandle& entityHandle, CellKey cellKey);
+        void MoveEntity(const ConstNetworkEntityHandle& entityHandle, CellKey fromCellKey, CellKey toCellKey);
+
+        AZStd::unordered_map<CellKey, Cell> m_cells;
+        AZStd::unordered_map<NetEntityId, TrackedEntity> m_trackedEntities;
+        AZStd::unordered_map<ISubscriber*, Subscription> m_subscriptions;
+        float m_cellSize = 0.0f;
+        uint32_t m_updateStamp = 0;
+    };
+}
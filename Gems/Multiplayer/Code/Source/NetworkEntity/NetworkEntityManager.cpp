@@ -86,6 +86,11 @@ namespace Multiplayer
         return &m_networkEntityAuthorityTracker;
     }
 
+    NetworkEntityInterestGrid* NetworkEntityManager::GetNetworkEntityInterestGrid()
+    {
+        return &m_networkEntityInterestGrid;
+    }
+
     MultiplayerComponentRegistry* NetworkEntityManager::GetMultiplayerComponentRegistry()
     {
         return &m_multiplayerComponentRegistry;
@@ -252,7 +257,7 @@ namespace Multiplayer
             {
                 for (auto remoteEntityId : m_removeList)
                 {
-                    if (remoteEntityId == remoteEntityId)
+                    if (remoteEntityId == exitingId)
                     {
                         safeToExit = false;
                     }
@@ -354,6 +359,39 @@ namespace Multiplayer
         }
     }
 
+    void NetworkEntityManager::UpdateEntityDomain()
+    {
+        // Only spatial domains change which entities they contain as entities move around
+        if ((m_entityDomain == nullptr) || !m_entityDomain->GetAabb().IsValid())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "NetworkEntityManager: UpdateEntityDomain");
+        NetEntityIdSet entitiesNotInDomain;
+        for (NetworkEntityTracker::const_iterator it = m_networkEntityTracker.begin(); it != m_networkEntityTracker.end(); ++it)
+        {
+            AZ::Entity* entity = it->second;
+            NetBindComponent* netBindComponent = m_networkEntityTracker.GetNetBindComponent(entity);
+            if ((netBindComponent == nullptr)
+             || !netBindComponent->IsNetEntityRoleAuthority()
+             || (netBindComponent->GetAllowEntityMigration() == EntityMigration::Disabled))
+            {
+                continue;
+            }
+
+            if (!m_entityDomain->IsInDomain(ConstNetworkEntityHandle(entity, &m_networkEntityTracker)))
+            {
+                entitiesNotInDomain.insert(it->first);
+            }
+        }
+
+        if (!entitiesNotInDomain.empty())
+        {
+            HandleEntitiesExitDomain(entitiesNotInDomain);
+        }
+    }
+
     void NetworkEntityManager::DispatchLocalDeferredRpcMessages()
     {
         // Local messages may get queued up while we process other local messages,
@@ -13,6 +13,7 @@
 #include <AzFramework/Spawnable/RootSpawnableInterface.h>
 #include <AzFramework/Spawnable/SpawnableAssetBus.h>
 #include <Source/NetworkEntity/NetworkEntityAuthorityTracker.h>
+#include <Source/NetworkEntity/NetworkEntityInterestGrid.h>
 #include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Source/NetworkEntity/NetworkSpawnableLibrary.h>
 #include <Multiplayer/Components/MultiplayerComponentRegistry.h>
@@ -42,6 +43,7 @@ namespace Multiplayer
         IEntityDomain* GetEntityDomain() const override;
         NetworkEntityTracker* GetNetworkEntityTracker() override;
         NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() override;
+        NetworkEntityInterestGrid* GetNetworkEntityInterestGrid() override;
         MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() override;
         const HostId& GetHostId() const override;
         ConstNetworkEntityHandle GetEntity(NetEntityId netEntityId) const override;
@@ -102,6 +104,9 @@ namespace Multiplayer
 
         void DispatchLocalDeferredRpcMessages();
 
+        //! Migrates authoritative entities that have left a spatial entity domain to the hosts whose domains they entered.
+        void UpdateEntityDomain();
+
         //! RootSpawnableNotificationBus
         //! @{
         void OnRootSpawnableAssigned(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, uint32_t generation) override;
@@ -126,6 +131,7 @@ namespace Multiplayer
 
         NetworkEntityTracker m_networkEntityTracker;
         NetworkEntityAuthorityTracker m_networkEntityAuthorityTracker;
+        NetworkEntityInterestGrid m_networkEntityInterestGrid;
         MultiplayerComponentRegistry m_multiplayerComponentRegistry;
 
         AZStd::unordered_set<ConstNetworkEntityHandle> m_alwaysRelevantToClients;
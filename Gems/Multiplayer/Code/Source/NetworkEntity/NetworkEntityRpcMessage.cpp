@@ -9,6 +9,7 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
 #include <Multiplayer/IMultiplayer.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/containers/fixed_unordered_map.h>
 
 namespace Multiplayer
 {
@@ -19,6 +20,7 @@ namespace Multiplayer
         , m_rpcIndex(rhs.m_rpcIndex)
         , m_data(AZStd::move(rhs.m_data))
         , m_isReliable(rhs.m_isReliable)
+        , m_latestValueWins(rhs.m_latestValueWins)
     {
         ;
     }
@@ -29,6 +31,7 @@ namespace Multiplayer
         , m_componentId(rhs.m_componentId)
         , m_rpcIndex(rhs.m_rpcIndex)
         , m_isReliable(rhs.m_isReliable)
+        , m_latestValueWins(rhs.m_latestValueWins)
     {
         if (rhs.m_data != nullptr)
         {
@@ -54,6 +57,7 @@ namespace Multiplayer
         m_componentId = rhs.m_componentId;
         m_rpcIndex = rhs.m_rpcIndex;
         m_isReliable = rhs.m_isReliable;
+        m_latestValueWins = rhs.m_latestValueWins;
         m_data = AZStd::move(rhs.m_data);
         return *this;
     }
@@ -65,6 +69,7 @@ namespace Multiplayer
         m_componentId = rhs.m_componentId;
         m_rpcIndex = rhs.m_rpcIndex;
         m_isReliable = rhs.m_isReliable;
+        m_latestValueWins = rhs.m_latestValueWins;
         if (rhs.m_data != nullptr)
         {
             m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
@@ -102,6 +107,20 @@ namespace Multiplayer
         return sizeOfFields + sizeOfBlob;
     }
 
+    uint32_t NetworkEntityRpcMessage::GetEstimatedAggregatedSerializeSize(bool isNewEntity, bool isNewRpc) const
+    {
+        // Dictionary indices replace the identifiers in the message
+        static constexpr uint32_t sizeOfFields = sizeof(RpcDeliveryType)
+            + sizeof(uint16_t)
+            + sizeof(uint16_t);
+
+        const uint32_t sizeOfDictionaryEntries = (isNewEntity ? sizeof(NetEntityId) : 0)
+            + (isNewRpc ? sizeof(NetComponentId) + sizeof(RpcIndex) : 0);
+
+        const uint32_t sizeOfBlob = static_cast<uint32_t>((m_data != nullptr) ? sizeof(uint16_t) + m_data->GetSize() : 0);
+        return sizeOfFields + sizeOfDictionaryEntries + sizeOfBlob;
+    }
+
     RpcDeliveryType NetworkEntityRpcMessage::GetRpcDeliveryType() const
     {
         return m_rpcDeliveryType;
@@ -163,6 +182,12 @@ namespace Multiplayer
         serializer.Serialize(m_entityId, "EntityId");
         serializer.Serialize(m_componentId, "ComponentId");
         serializer.Serialize(m_rpcIndex, "RpcIndex");
+        return SerializePayload(serializer);
+    }
+
+    bool NetworkEntityRpcMessage::SerializePayload(AzNetworking::ISerializer& serializer)
+    {
+        serializer.Serialize(m_rpcDeliveryType, "RpcDeliveryType");
 
         // m_data should never be nullptr, it contains serialized data for our Rpc params struct
         if (m_data == nullptr)
@@ -184,4 +209,119 @@ namespace Multiplayer
     {
         return m_isReliable;
     }
+
+    void NetworkEntityRpcMessage::SetLatestValueWins(bool latestValueWins)
+    {
+        m_latestValueWins = latestValueWins;
+    }
+
+    bool NetworkEntityRpcMessage::IsLatestValueWins() const
+    {
+        return m_latestValueWins;
+    }
+}
+
+namespace AzNetworking
+{
+    bool SerializeAzContainer<Multiplayer::NetworkEntityRpcVector>::Serialize(ISerializer& serializer, Multiplayer::NetworkEntityRpcVector& container)
+    {
+        using namespace Multiplayer;
+        constexpr uint32_t max = MaxAggregateRpcMessages;
+
+        AZStd::fixed_vector<NetEntityId, MaxAggregateRpcMessages> entityIds;
+        AZStd::fixed_vector<AZStd::pair<NetComponentId, RpcIndex>, MaxAggregateRpcMessages> rpcKeys;
+        AZStd::fixed_vector<AZStd::pair<uint16_t, uint16_t>, MaxAggregateRpcMessages> messageIndices;
+
+        if (serializer.GetSerializerMode() == SerializerMode::ReadFromObject)
+        {
+            // Build the dictionaries of the packet, most rpcs of a tick target a few entities and invoke a few rpcs
+            AZStd::fixed_unordered_map<NetEntityId, uint16_t, 131, MaxAggregateRpcMessages> entityIndices;
+            AZStd::fixed_unordered_map<uint32_t, uint16_t, 131, MaxAggregateRpcMessages> rpcKeyIndices;
+            for (const NetworkEntityRpcMessage& message : container)
+            {
+                auto entityIt = entityIndices.insert(AZStd::make_pair(message.GetEntityId(), aznumeric_cast<uint16_t>(entityIds.size())));
+                if (entityIt.second)
+                {
+                    entityIds.push_back(message.GetEntityId());
+                }
+
+                const uint32_t rpcKey = (static_cast<uint32_t>(message.GetComponentId()) << 16) | static_cast<uint32_t>(message.GetRpcIndex());
+                auto rpcKeyIt = rpcKeyIndices.insert(AZStd::make_pair(rpcKey, aznumeric_cast<uint16_t>(rpcKeys.size())));
+                if (rpcKeyIt.second)
+                {
+                    rpcKeys.push_back(AZStd::make_pair(message.GetComponentId(), message.GetRpcIndex()));
+                }
+
+                messageIndices.push_back(AZStd::make_pair(entityIt.first->second, rpcKeyIt.first->second));
+            }
+        }
+
+        uint16_t entityCount = aznumeric_cast<uint16_t>(entityIds.size());
+        serializer.Serialize(entityCount, "EntityCount");
+        if (entityCount > max)
+        {
+            serializer.Invalidate();
+            return false;
+        }
+        entityIds.resize(entityCount);
+        for (uint16_t i = 0; i < entityCount; ++i)
+        {
+            serializer.Serialize(entityIds[i], GenerateIndexLabel<max>(i).c_str());
+        }
+
+        uint16_t rpcKeyCount = aznumeric_cast<uint16_t>(rpcKeys.size());
+        serializer.Serialize(rpcKeyCount, "RpcCount");
+        if (rpcKeyCount > max)
+        {
+            serializer.Invalidate();
+            return false;
+        }
+        rpcKeys.resize(rpcKeyCount);
+        for (uint16_t i = 0; i < rpcKeyCount; ++i)
+        {
+            serializer.Serialize(rpcKeys[i].first, "ComponentId");
+            serializer.Serialize(rpcKeys[i].second, "RpcIndex");
+        }
+
+        uint16_t messageCount = aznumeric_cast<uint16_t>(container.size());
+        serializer.Serialize(messageCount, "Size");
+        if (messageCount > max || !serializer.IsValid())
+        {
+            serializer.Invalidate();
+            return false;
+        }
+
+        if (serializer.GetSerializerMode() == SerializerMode::WriteToObject)
+        {
+            container.clear();
+            for (uint16_t i = 0; i < messageCount; ++i)
+            {
+                uint16_t entityIndex = 0;
+                uint16_t rpcKeyIndex = 0;
+                serializer.Serialize(entityIndex, "EntityIndex");
+                serializer.Serialize(rpcKeyIndex, "RpcKeyIndex");
+                if (entityIndex >= entityCount || rpcKeyIndex >= rpcKeyCount)
+                {
+                    serializer.Invalidate();
+                    return false;
+                }
+
+                // Reliability is a property of the packet, not of the message, so it's left at the default
+                NetworkEntityRpcMessage& message = container.emplace_back(RpcDeliveryType::None, entityIds[entityIndex],
+                    rpcKeys[rpcKeyIndex].first, rpcKeys[rpcKeyIndex].second, ReliabilityType::Reliable);
+                message.SerializePayload(serializer);
+            }
+        }
+        else
+        {
+            for (uint16_t i = 0; i < messageCount; ++i)
+            {
+                serializer.Serialize(messageIndices[i].first, "EntityIndex");
+                serializer.Serialize(messageIndices[i].second, "RpcKeyIndex");
+                container[i].SerializePayload(serializer);
+            }
+        }
+
+        return serializer.IsValid();
+    }
 }
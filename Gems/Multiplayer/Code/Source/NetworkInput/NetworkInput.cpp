@@ -122,6 +122,23 @@ namespace Multiplayer
         }
     }
 
+    void NetworkInput::ResetComponentInputs()
+    {
+        for (AZStd::unique_ptr<IMultiplayerComponentInput>& componentInput : m_componentInputs)
+        {
+            if (componentInput == nullptr)
+            {
+                continue;
+            }
+
+            const IMultiplayerComponentInput* defaultInput = GetMultiplayerComponentRegistry()->GetDefaultComponentInput(componentInput->GetNetComponentId());
+            if (defaultInput != nullptr)
+            {
+                *componentInput = *defaultInput;
+            }
+        }
+    }
+
     bool NetworkInput::Serialize(AzNetworking::ISerializer& serializer)
     {
         if (!serializer.Serialize(m_inputId, "InputId")
@@ -12,31 +12,61 @@ namespace Multiplayer
 {
     AZStd::size_t NetworkInputHistory::Size() const
     {
-        return m_history.size();
+        return m_size;
+    }
+
+    void NetworkInputHistory::Reserve(AZStd::size_t capacity)
+    {
+        if (capacity <= m_history.size())
+        {
+            return;
+        }
+
+        // Unwrap the ring so the oldest input sits at the front, then extend with empty slots
+        AZStd::vector<Wrapper> history;
+        history.reserve(capacity);
+        for (AZStd::size_t i = 0; i < m_history.size(); ++i)
+        {
+            history.emplace_back(m_history[(m_head + i) % m_history.size()].m_networkInput);
+        }
+        history.resize(capacity);
+        m_history.swap(history);
+        m_head = 0;
     }
 
     const NetworkInput& NetworkInputHistory::operator[](AZStd::size_t index) const
     {
-        return m_history[index].m_networkInput;
+        AZ_Assert(index < m_size, "Index %zu out of bounds for input history of size %zu", index, m_size);
+        return m_history[(m_head + index) % m_history.size()].m_networkInput;
     }
 
     NetworkInput& NetworkInputHistory::operator[](AZStd::size_t index)
     {
-        return m_history[index].m_networkInput;
+        AZ_Assert(index < m_size, "Index %zu out of bounds for input history of size %zu", index, m_size);
+        return m_history[(m_head + index) % m_history.size()].m_networkInput;
     }
 
     void NetworkInputHistory::PushBack(NetworkInput& networkInput)
     {
-        m_history.push_back(Wrapper(networkInput));
+        if (m_size == m_history.size())
+        {
+            Reserve(AZStd::max<AZStd::size_t>(m_history.size() * 2, 16));
+        }
+
+        // Assignment reuses the component inputs of the slot when the component types match
+        m_history[(m_head + m_size) % m_history.size()].m_networkInput = networkInput;
+        ++m_size;
     }
 
     void NetworkInputHistory::PopFront()
     {
-        m_history.pop_front();
+        AZ_Assert(m_size > 0, "Attempting to pop from an empty input history");
+        m_head = (m_head + 1) % m_history.size();
+        --m_size;
     }
 
     const NetworkInput& NetworkInputHistory::Front() const
     {
-        return m_history.front().m_networkInput;
+        return (*this)[0];
     }
 }
@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkTime/HitVolumeHistory.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    HitVolumeHistory::HitVolumeHistory()
+    {
+        AZ::Interface<IHitVolumeHistory>::Register(this);
+    }
+
+    HitVolumeHistory::~HitVolumeHistory()
+    {
+        AZ::Interface<IHitVolumeHistory>::Unregister(this);
+    }
+
+    void HitVolumeHistory::RecordHitVolume
+    (
+        NetEntityId netEntityId,
+        uint32_t volumeIndex,
+        const HitVolumeShape& shape,
+        const AZ::Transform& worldTransform,
+        AzNetworking::ConnectionId owningConnectionId
+    )
+    {
+        // Hit volume shapes are not scaled, matching the physics shapes they mirror
+        AZ::Transform transform = worldTransform;
+        transform.SetUniformScale(1.0f);
+
+        const uint64_t key = MakeKey(netEntityId, volumeIndex);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingMutex);
+        auto iter = m_pendingIndices.find(key);
+        if (iter == m_pendingIndices.end())
+        {
+            iter = m_pendingIndices.emplace(key, aznumeric_cast<uint32_t>(m_pendingVolumes.size())).first;
+            m_pendingVolumes.emplace_back();
+        }
+
+        HitVolume& volume = m_pendingVolumes[iter->second];
+        volume.m_key = key;
+        volume.m_netEntityId = netEntityId;
+        volume.m_volumeIndex = volumeIndex;
+        volume.m_owningConnectionId = owningConnectionId;
+        volume.m_shape = shape;
+        volume.m_transform = transform;
+    }
+
+    void HitVolumeHistory::CommitFrame(HostFrameId frameId)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingMutex);
+
+        // Previous transforms can only be carried forward from the frame directly preceding this one
+        const bool hasPreviousFrame = (m_lastFrame != nullptr) && (m_lastFrame->m_frameId + HostFrameId{ 1 } == frameId);
+
+        Frame& frame = m_frames[static_cast<uint32_t>(frameId) % RewindHistorySize];
+        if (hasPreviousFrame)
+        {
+            for (HitVolume& volume : m_pendingVolumes)
+            {
+                auto iter = m_lastFrameIndices.find(volume.m_key);
+                volume.m_previousTransform = (iter != m_lastFrameIndices.end())
+                    ? m_lastFrame->m_volumes[iter->second].m_transform
+                    : volume.m_transform;
+            }
+        }
+        else
+        {
+            for (HitVolume& volume : m_pendingVolumes)
+            {
+                volume.m_previousTransform = volume.m_transform;
+            }
+        }
+
+        for (HitVolume& volume : m_pendingVolumes)
+        {
+            volume.m_bounds = GetWorldBounds(volume.m_shape, volume.m_transform);
+            volume.m_bounds.AddAabb(GetWorldBounds(volume.m_shape, volume.m_previousTransform));
+        }
+
+        // Swap rather than copy so the storage of the frame being replaced is reused for the next pending frame
+        frame.m_frameId = frameId;
+        frame.m_volumes.swap(m_pendingVolumes);
+        m_pendingVolumes.clear();
+        m_pendingIndices.clear();
+
+        frame.m_nodes.clear();
+        if (!frame.m_volumes.empty())
+        {
+            frame.m_nodes.reserve(2 * frame.m_volumes.size() / MaxVolumesPerLeaf + 1);
+            BuildNode(frame, 0, aznumeric_cast<uint32_t>(frame.m_volumes.size()));
+        }
+
+        // Building the hierarchy reorders the volumes, so index them afterwards
+        m_lastFrameIndices.clear();
+        for (uint32_t i = 0; i < frame.m_volumes.size(); ++i)
+        {
+            m_lastFrameIndices.emplace(frame.m_volumes[i].m_key, i);
+        }
+        m_lastFrame = &frame;
+    }
+
+    AZStd::vector<HitVolumeQueryResult> HitVolumeHistory::Raycast
+    (
+        HostFrameId frameId,
+        float blendFactor,
+        const AZ::Vector3& start,
+        const AZ::Vector3& direction,
+        float distance,
+        AzNetworking::ConnectionId ignoreConnectionId
+    ) const
+    {
+        AZStd::vector<HitVolumeQueryResult> results;
+
+        const Frame* frame = FindFrame(frameId);
+        if ((frame == nullptr) || frame->m_nodes.empty() || (distance <= 0.0f))
+        {
+            return results;
+        }
+
+        const AZ::Vector3 segment = direction * distance;
+        const AZ::Vector3 segmentRcp = segment.GetReciprocal();
+
+        // The hierarchy is balanced, so its depth never exceeds the bits of the volume count
+        AZStd::array<uint32_t, 64> nodeStack;
+        uint32_t stackSize = 0;
+        nodeStack[stackSize++] = 0;
+        while (stackSize > 0)
+        {
+            const uint32_t nodeIndex = nodeStack[--stackSize];
+            const BvhNode& node = frame->m_nodes[nodeIndex];
+
+            float tStart = 0.0f;
+            float tEnd = 0.0f;
+            if ((AZ::Intersect::IntersectRayAABB2(start, segmentRcp, node.m_bounds, tStart, tEnd) != AZ::Intersect::ISECT_RAY_AABB_ISECT)
+             || (tEnd < 0.0f) || (tStart > 1.0f))
+            {
+                continue;
+            }
+
+            if (node.m_count == 0)
+            {
+                nodeStack[stackSize++] = nodeIndex + 1;
+                nodeStack[stackSize++] = node.m_first;
+                continue;
+            }
+
+            for (uint32_t i = node.m_first; i < node.m_first + node.m_count; ++i)
+            {
+                const HitVolume& volume = frame->m_volumes[i];
+                if ((ignoreConnectionId != AzNetworking::InvalidConnectionId) && (volume.m_owningConnectionId == ignoreConnectionId))
+                {
+                    continue;
+                }
+
+                float hitDistance = 0.0f;
+                if (IntersectVolume(volume, blendFactor, start, direction, distance, hitDistance))
+                {
+                    results.push_back(HitVolumeQueryResult{ volume.m_netEntityId, volume.m_volumeIndex, hitDistance, start + direction * hitDistance });
+                }
+            }
+        }
+
+        AZStd::sort(results.begin(), results.end(), [](const HitVolumeQueryResult& lhs, const HitVolumeQueryResult& rhs)
+        {
+            return lhs.m_distance < rhs.m_distance;
+        });
+        return results;
+    }
+
+    AZStd::vector<HitVolumeQueryResult> HitVolumeHistory::RaycastRewound(const AZ::Vector3& start, const AZ::Vector3& direction, float distance) const
+    {
+        const INetworkTime* networkTime = GetNetworkTime();
+        return Raycast
+        (
+            networkTime->GetHostFrameId(),
+            networkTime->GetHostBlendFactor(),
+            start,
+            direction,
+            distance,
+            networkTime->GetRewindingConnectionId()
+        );
+    }
+
+    void HitVolumeHistory::Reset()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingMutex);
+        m_pendingVolumes.clear();
+        m_pendingIndices.clear();
+        m_lastFrameIndices.clear();
+        m_lastFrame = nullptr;
+        for (Frame& frame : m_frames)
+        {
+            frame.m_frameId = InvalidHostFrameId;
+            frame.m_volumes.clear();
+            frame.m_nodes.clear();
+        }
+    }
+
+    uint64_t HitVolumeHistory::MakeKey(NetEntityId netEntityId, uint32_t volumeIndex)
+    {
+        // NetEntityIds are handed out sequentially, so the upper bits are free to hold the volume index
+        AZ_Assert(volumeIndex <= 0xFFFF, "Hit volume index %u exceeds the supported number of volumes per entity", volumeIndex);
+        return (static_cast<uint64_t>(volumeIndex) << 48) ^ static_cast<uint64_t>(netEntityId);
+    }
+
+    AZ::Aabb HitVolumeHistory::GetWorldBounds(const HitVolumeShape& shape, const AZ::Transform& transform)
+    {
+        switch (shape.m_type)
+        {
+        case HitVolumeShape::Type::Sphere:
+            return AZ::Aabb::CreateCenterRadius(transform.GetTranslation(), shape.m_radius);
+        case HitVolumeShape::Type::Capsule:
+            {
+                const float halfHeight = AZStd::max(shape.m_height * 0.5f, shape.m_radius);
+                const AZ::Vector3 halfExtents(shape.m_radius, shape.m_radius, halfHeight);
+                return AZ::Aabb::CreateFromMinMax(-halfExtents, halfExtents).GetTransformedAabb(transform);
+            }
+        case HitVolumeShape::Type::Box:
+            {
+                const AZ::Vector3 halfExtents = shape.m_dimensions * 0.5f;
+                return AZ::Aabb::CreateFromMinMax(-halfExtents, halfExtents).GetTransformedAabb(transform);
+            }
+        }
+        return AZ::Aabb::CreateNull();
+    }
+
+    bool HitVolumeHistory::IntersectVolume
+    (
+        const HitVolume& volume,
+        float blendFactor,
+        const AZ::Vector3& start,
+        const AZ::Vector3& direction,
+        float distance,
+        float& outDistance
+    )
+    {
+        AZ::Transform transform = volume.m_transform;
+        if (blendFactor < 1.0f)
+        {
+            // Blend between the previous and current frame in the same way as rewound hit volumes
+            const AZ::Transform& previousTransform = volume.m_previousTransform;
+            transform.SetRotation(previousTransform.GetRotation().Slerp(volume.m_transform.GetRotation(), blendFactor));
+            transform.SetTranslation(previousTransform.GetTranslation().Lerp(volume.m_transform.GetTranslation(), blendFactor));
+        }
+
+        // Trace in the local space of the volume, transforms are unscaled so distances are preserved
+        const AZ::Transform inverse = transform.GetInverse();
+        const AZ::Vector3 localStart = inverse.TransformPoint(start);
+        const AZ::Vector3 localDirection = inverse.TransformVector(direction);
+
+        const HitVolumeShape& shape = volume.m_shape;
+        const float capsuleHalfSegment = shape.m_height * 0.5f - shape.m_radius;
+        if ((shape.m_type == HitVolumeShape::Type::Sphere)
+         || ((shape.m_type == HitVolumeShape::Type::Capsule) && (capsuleHalfSegment <= 0.0f)))
+        {
+            float t = 0.0f;
+            switch (AZ::Intersect::IntersectRaySphereOrigin(localStart, localDirection, shape.m_radius, t))
+            {
+            case AZ::Intersect::ISECT_RAY_SPHERE_SA_INSIDE:
+                outDistance = 0.0f;
+                return true;
+            case AZ::Intersect::ISECT_RAY_SPHERE_ISECT:
+                outDistance = t;
+                return t <= distance;
+            default:
+                return false;
+            }
+        }
+
+        const AZ::Vector3 localSegment = localDirection * distance;
+        if (shape.m_type == HitVolumeShape::Type::Capsule)
+        {
+            const AZ::Vector3 p(0.0f, 0.0f, capsuleHalfSegment);
+            float t = 0.0f;
+            switch (AZ::Intersect::IntersectSegmentCapsule(localStart, localSegment, p, -p, shape.m_radius, t))
+            {
+            case AZ::Intersect::ISECT_RAY_CAPSULE_NONE:
+                return false;
+            case AZ::Intersect::ISECT_RAY_CAPSULE_SA_INSIDE:
+                outDistance = 0.0f;
+                return true;
+            default:
+                outDistance = t * distance;
+                return (t >= 0.0f) && (t <= 1.0f);
+            }
+        }
+
+        const AZ::Vector3 halfExtents = shape.m_dimensions * 0.5f;
+        float tStart = 0.0f;
+        float tEnd = 0.0f;
+        if ((AZ::Intersect::IntersectRayAABB2(localStart, localSegment.GetReciprocal(), AZ::Aabb::CreateFromMinMax(-halfExtents, halfExtents), tStart, tEnd) != AZ::Intersect::ISECT_RAY_AABB_ISECT)
+         || (tEnd < 0.0f) || (tStart > 1.0f))
+        {
+            return false;
+        }
+        outDistance = AZStd::max(tStart, 0.0f) * distance;
+        return true;
+    }
+
+    uint32_t HitVolumeHistory::BuildNode(Frame& frame, uint32_t first, uint32_t count)
+    {
+        const uint32_t nodeIndex = aznumeric_cast<uint32_t>(frame.m_nodes.size());
+        frame.m_nodes.emplace_back();
+
+        AZ::Aabb bounds = AZ::Aabb::CreateNull();
+        AZ::Aabb centroidBounds = AZ::Aabb::CreateNull();
+        for (uint32_t i = first; i < first + count; ++i)
+        {
+            bounds.AddAabb(frame.m_volumes[i].m_bounds);
+            centroidBounds.AddPoint(frame.m_volumes[i].m_bounds.GetCenter());
+        }
+
+        if (count <= MaxVolumesPerLeaf)
+        {
+            frame.m_nodes[nodeIndex] = BvhNode{ bounds, first, count };
+            return nodeIndex;
+        }
+
+        // Median split along the axis with the widest spread of volume centres
+        const AZ::Vector3 extents = centroidBounds.GetExtents();
+        const int32_t axis = (extents.GetX() >= extents.GetY())
+            ? ((extents.GetX() >= extents.GetZ()) ? 0 : 2)
+            : ((extents.GetY() >= extents.GetZ()) ? 1 : 2);
+        const uint32_t middle = first + count / 2;
+        AZStd::nth_element(frame.m_volumes.begin() + first, frame.m_volumes.begin() + middle, frame.m_volumes.begin() + first + count,
+            [axis](const HitVolume& lhs, const HitVolume& rhs)
+        {
+            return lhs.m_bounds.GetCenter().GetElement(axis) < rhs.m_bounds.GetCenter().GetElement(axis);
+        });
+
+        // The first child immediately follows its parent, only the second child's index needs storing
+        BuildNode(frame, first, middle - first);
+        const uint32_t secondChild = BuildNode(frame, middle, first + count - middle);
+        frame.m_nodes[nodeIndex] = BvhNode{ bounds, secondChild, 0 };
+        return nodeIndex;
+    }
+
+    const HitVolumeHistory::Frame* HitVolumeHistory::FindFrame(HostFrameId frameId) const
+    {
+        // Frames that haven't been committed yet are still being simulated, the latest committed frame is the live state
+        if ((m_lastFrame != nullptr) && (frameId > m_lastFrame->m_frameId))
+        {
+            return m_lastFrame;
+        }
+
+        const Frame& frame = m_frames[static_cast<uint32_t>(frameId) % RewindHistorySize];
+        return (frame.m_frameId == frameId) ? &frame : nullptr;
+    }
+}
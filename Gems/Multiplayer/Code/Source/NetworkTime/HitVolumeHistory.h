@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/NetworkTime/IHitVolumeHistory.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace Multiplayer
+{
+    //! Implementation of the IHitVolumeHistory interface.
+    class HitVolumeHistory final
+        : public IHitVolumeHistory
+    {
+    public:
+        HitVolumeHistory();
+        ~HitVolumeHistory() override;
+
+        //! IHitVolumeHistory overrides.
+        //! @{
+        void RecordHitVolume
+        (
+            NetEntityId netEntityId,
+            uint32_t volumeIndex,
+            const HitVolumeShape& shape,
+            const AZ::Transform& worldTransform,
+            AzNetworking::ConnectionId owningConnectionId
+        ) override;
+        void CommitFrame(HostFrameId frameId) override;
+        AZStd::vector<HitVolumeQueryResult> Raycast
+        (
+            HostFrameId frameId,
+            float blendFactor,
+            const AZ::Vector3& start,
+            const AZ::Vector3& direction,
+            float distance,
+            AzNetworking::ConnectionId ignoreConnectionId
+        ) const override;
+        AZStd::vector<HitVolumeQueryResult> RaycastRewound(const AZ::Vector3& start, const AZ::Vector3& direction, float distance) const override;
+        void Reset() override;
+        //! @}
+
+    private:
+        static constexpr uint32_t MaxVolumesPerLeaf = 4;
+
+        struct HitVolume
+        {
+            uint64_t m_key = 0;
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            uint32_t m_volumeIndex = 0;
+            AzNetworking::ConnectionId m_owningConnectionId = AzNetworking::InvalidConnectionId;
+            HitVolumeShape m_shape;
+            AZ::Transform m_transform = AZ::Transform::CreateIdentity();
+            AZ::Transform m_previousTransform = AZ::Transform::CreateIdentity();
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull(); // Encloses both the current and previous transform, so blended queries stay inside
+        };
+
+        struct BvhNode
+        {
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+            uint32_t m_first = 0; // First volume of a leaf, or the index of the second child of an interior node
+            uint32_t m_count = 0; // Number of volumes in a leaf, zero for interior nodes
+        };
+
+        struct Frame
+        {
+            HostFrameId m_frameId = InvalidHostFrameId;
+            AZStd::vector<HitVolume> m_volumes;
+            AZStd::vector<BvhNode> m_nodes;
+        };
+
+        static uint64_t MakeKey(NetEntityId netEntityId, uint32_t volumeIndex);
+        static AZ::Aabb GetWorldBounds(const HitVolumeShape& shape, const AZ::Transform& transform);
+        static bool IntersectVolume(const HitVolume& volume, float blendFactor, const AZ::Vector3& start, const AZ::Vector3& direction, float distance, float& outDistance);
+
+        uint32_t BuildNode(Frame& frame, uint32_t first, uint32_t count);
+        const Frame* FindFrame(HostFrameId frameId) const;
+
+        // Volumes recorded for the frame currently being built, several threads may record during parallel pre-render
+        AZStd::mutex m_pendingMutex;
+        AZStd::vector<HitVolume> m_pendingVolumes;
+        AZStd::unordered_map<uint64_t, uint32_t> m_pendingIndices;
+
+        // Lookup of the most recently committed frame, used to carry previous transforms forward
+        AZStd::unordered_map<uint64_t, uint32_t> m_lastFrameIndices;
+        const Frame* m_lastFrame = nullptr;
+
+        AZStd::array<Frame, RewindHistorySize> m_frames;
+    };
+}
@@ -8,6 +8,7 @@
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
@@ -63,12 +64,18 @@ namespace Multiplayer
         AZ_Assert(m_controlledEntityTransform, "Controlled player entity must have a transform");
     }
 
+    ServerToClientReplicationWindow::~ServerToClientReplicationWindow()
+    {
+        LeaveInterestGrid();
+    }
+
     bool ServerToClientReplicationWindow::ReplicationSetUpdateReady()
     {
         // if we don't have a controlled entity anymore, don't send updates (validate this)
         if (!m_controlledEntity.Exists())
         {
             m_replicationSet.clear();
+            LeaveInterestGrid();
         }
         return true;
     }
@@ -92,18 +99,13 @@ namespace Multiplayer
 
     void ServerToClientReplicationWindow::UpdateWindow()
     {
-        // Clear the candidate queue, we're going to rebuild it
-        ReplicationCandidateQueue::container_type clearQueueContainer;
-        clearQueueContainer.reserve(sv_MaxEntitiesToTrackReplication);
-        // Move the clearQueueContainer into the ReplicationCandidateQueue to maintain the reserved memory
-        ReplicationCandidateQueue clearQueue(ReplicationCandidateQueue::value_compare{}, AZStd::move(clearQueueContainer));
-        m_candidateQueue.swap(clearQueue);
-        m_replicationSet.clear();
-
         NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
         if (!netBindComponent || !netBindComponent->HasController())
         {
             // If we don't have a controlled entity, or we no longer have control of the entity, don't run the update
+            ResetCandidateQueue();
+            m_replicationSet.clear();
+            LeaveInterestGrid();
             return;
         }
 
@@ -112,6 +114,27 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
+        INetworkEntityManager* networkEntityManager = GetNetworkEntityManager();
+        NetworkEntityInterestGrid* interestGrid = (NetworkEntityInterestGrid::IsEnabled() && networkEntityManager)
+            ? networkEntityManager->GetNetworkEntityInterestGrid()
+            : nullptr;
+        if (interestGrid != nullptr)
+        {
+            UpdateWindowFromInterestGrid(*interestGrid, controlledEntityPosition);
+        }
+        else
+        {
+            LeaveInterestGrid();
+            UpdateWindowFromVisibility(controlledEntityPosition);
+        }
+    }
+
+    void ServerToClientReplicationWindow::UpdateWindowFromVisibility(const AZ::Vector3& controlledEntityPosition)
+    {
+        // Clear the candidate queue, we're going to rebuild it
+        ResetCandidateQueue();
+        m_replicationSet.clear();
+
         AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
         AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
         AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
@@ -182,6 +205,219 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::UpdateWindowFromInterestGrid(NetworkEntityInterestGrid& interestGrid, const AZ::Vector3& controlledEntityPosition)
+    {
+        if (!m_isSubscribedToInterestGrid)
+        {
+            // Start from an empty set, the entities of the newly subscribed cells are reported back while subscribing
+            ResetCandidateQueue();
+            m_replicationSet.clear();
+            m_isSubscribedToInterestGrid = true;
+        }
+
+        interestGrid.UpdateSubscription(*this, controlledEntityPosition, sv_ClientAwarenessRadius);
+
+        // Only the entities that entered or left the subscribed cells need to be processed
+        for (const InterestChange& interestChange : m_pendingInterestChanges)
+        {
+            const ConstNetworkEntityHandle& entityHandle = interestChange.m_entityHandle;
+            const bool isForced = m_forcedReplicationSet.find(entityHandle) != m_forcedReplicationSet.end();
+            if (interestChange.m_entered)
+            {
+                const bool isAccepted = IsAcceptedForReplication(entityHandle);
+                auto [interestIter, inserted] = m_interestEntities.emplace(entityHandle, isAccepted);
+                if (!inserted)
+                {
+                    m_acceptedInterestCount -= interestIter->second ? 1 : 0;
+                    interestIter->second = isAccepted;
+                }
+
+                if (isAccepted)
+                {
+                    ++m_acceptedInterestCount;
+                    if (!m_isReplicationSetPrioritized && !isForced)
+                    {
+                        m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f };
+                    }
+                }
+            }
+            else
+            {
+                auto interestIter = m_interestEntities.find(entityHandle);
+                if (interestIter != m_interestEntities.end())
+                {
+                    m_acceptedInterestCount -= interestIter->second ? 1 : 0;
+                    m_interestEntities.erase(interestIter);
+                }
+
+                if (!m_isReplicationSetPrioritized && !isForced)
+                {
+                    m_replicationSet.erase(entityHandle);
+                }
+            }
+        }
+        m_pendingInterestChanges.clear();
+
+        if (m_acceptedInterestCount > sv_MaxEntitiesToTrackReplication)
+        {
+            // More entities than can be tracked, keep the closest ones the same way the visibility gather does
+            RebuildPrioritizedReplicationSet(controlledEntityPosition);
+        }
+        else if (m_isReplicationSetPrioritized)
+        {
+            // Back under the limit, every accepted entity of interest can be replicated again
+            ResetCandidateQueue();
+            m_replicationSet.clear();
+            m_forcedReplicationSet.clear();
+            for (const auto& [entityHandle, isAccepted] : m_interestEntities)
+            {
+                if (isAccepted)
+                {
+                    m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f };
+                }
+            }
+            m_isReplicationSetPrioritized = false;
+        }
+
+        UpdateForcedReplicationSet();
+    }
+
+    void ServerToClientReplicationWindow::RebuildPrioritizedReplicationSet(const AZ::Vector3& controlledEntityPosition)
+    {
+        ResetCandidateQueue();
+        m_replicationSet.clear();
+        m_forcedReplicationSet.clear();
+
+        for (const auto& [interestHandle, isAccepted] : m_interestEntities)
+        {
+            const AZ::Entity* entity = interestHandle.GetEntity();
+            if (!isAccepted || (entity == nullptr) || (entity->GetTransform() == nullptr))
+            {
+                continue;
+            }
+
+            const float distanceSquared = controlledEntityPosition.GetDistanceSq(entity->GetTransform()->GetWorldTranslation());
+            const float priority = (distanceSquared > 0.0f) ? 1.0f / distanceSquared : 0.0f;
+            ConstNetworkEntityHandle entityHandle = interestHandle;
+            AddEntityToReplicationSet(entityHandle, priority, distanceSquared);
+        }
+        m_isReplicationSetPrioritized = true;
+    }
+
+    void ServerToClientReplicationWindow::UpdateForcedReplicationSet()
+    {
+        ReplicationSet forcedReplicationSet;
+
+        // Add in all entities that have forced relevancy
+        const Multiplayer::NetEntityHandleSet& alwaysRelevantToClients = GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet();
+        for (const ConstNetworkEntityHandle& entityHandle : alwaysRelevantToClients)
+        {
+            if (entityHandle.Exists())
+            {
+                AZ_Assert(entityHandle.GetNetBindComponent()->IsNetEntityRoleAuthority(), "Encountered forced relevant entity that is not in an authority role");
+                forcedReplicationSet[entityHandle] = { NetEntityRole::Client, 1.0f }; // Always replicate entities with forced relevancy
+            }
+        }
+
+        // Add in Autonomous Entities
+        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
+        forcedReplicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f }; // Always replicate autonomous entities
+
+        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
+        if (hierarchyComponent != nullptr)
+        {
+            UpdateHierarchyReplicationSet(forcedReplicationSet, *hierarchyComponent);
+        }
+
+        // Entities that are no longer forced fall back to their interest state
+        for (const auto& [entityHandle, replicationData] : m_forcedReplicationSet)
+        {
+            if (forcedReplicationSet.find(entityHandle) == forcedReplicationSet.end())
+            {
+                auto interestIter = m_interestEntities.find(entityHandle);
+                if ((interestIter != m_interestEntities.end()) && interestIter->second)
+                {
+                    m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f };
+                }
+                else
+                {
+                    m_replicationSet.erase(entityHandle);
+                }
+            }
+        }
+
+        for (const auto& [entityHandle, replicationData] : forcedReplicationSet)
+        {
+            m_replicationSet[entityHandle] = replicationData;
+        }
+        m_forcedReplicationSet = AZStd::move(forcedReplicationSet);
+    }
+
+    bool ServerToClientReplicationWindow::IsAcceptedForReplication(const ConstNetworkEntityHandle& entityHandle) const
+    {
+        const NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+        if (netBindComponent == nullptr)
+        {
+            // Entity does not have netbinding, skip this entity
+            return false;
+        }
+
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        if (filterEntityManager != nullptr)
+        {
+            AZ::Entity* entity = GetNetworkEntityTracker()->GetRaw(entityHandle.GetNetEntityId());
+            if (filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
+            {
+                return false;
+            }
+        }
+
+        // Proxy replication disabled
+        return sv_ReplicateServerProxies || (netBindComponent->GetNetEntityRole() != NetEntityRole::Server);
+    }
+
+    void ServerToClientReplicationWindow::ResetCandidateQueue()
+    {
+        ReplicationCandidateQueue::container_type clearQueueContainer;
+        clearQueueContainer.reserve(sv_MaxEntitiesToTrackReplication);
+        // Move the clearQueueContainer into the ReplicationCandidateQueue to maintain the reserved memory
+        ReplicationCandidateQueue clearQueue(ReplicationCandidateQueue::value_compare{}, AZStd::move(clearQueueContainer));
+        m_candidateQueue.swap(clearQueue);
+    }
+
+    void ServerToClientReplicationWindow::LeaveInterestGrid()
+    {
+        if (!m_isSubscribedToInterestGrid)
+        {
+            return;
+        }
+
+        if (INetworkEntityManager* networkEntityManager = GetNetworkEntityManager())
+        {
+            if (NetworkEntityInterestGrid* interestGrid = networkEntityManager->GetNetworkEntityInterestGrid())
+            {
+                interestGrid->Unsubscribe(*this);
+            }
+        }
+
+        m_pendingInterestChanges.clear();
+        m_interestEntities.clear();
+        m_forcedReplicationSet.clear();
+        m_acceptedInterestCount = 0;
+        m_isSubscribedToInterestGrid = false;
+        m_isReplicationSetPrioritized = false;
+    }
+
+    void ServerToClientReplicationWindow::OnEntityEnteredInterest(const ConstNetworkEntityHandle& entityHandle)
+    {
+        m_pendingInterestChanges.push_back(InterestChange{ entityHandle, true });
+    }
+
+    void ServerToClientReplicationWindow::OnEntityLeftInterest(const ConstNetworkEntityHandle& entityHandle)
+    {
+        m_pendingInterestChanges.push_back(InterestChange{ entityHandle, false });
+    }
+
     AzNetworking::PacketId ServerToClientReplicationWindow::SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector)
     {
         MultiplayerPackets::EntityUpdates entityUpdatePacket;
@@ -282,6 +518,14 @@ namespace Multiplayer
         if (entityHandle.GetNetBindComponent() != nullptr)
         {
             m_replicationSet.erase(entityHandle);
+            m_forcedReplicationSet.erase(entityHandle);
+
+            auto interestIter = m_interestEntities.find(entityHandle);
+            if (interestIter != m_interestEntities.end())
+            {
+                m_acceptedInterestCount -= interestIter->second ? 1 : 0;
+                m_interestEntities.erase(interestIter);
+            }
         }
     }
 
@@ -11,10 +11,12 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/NetworkEntity/NetworkEntityInterestGrid.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace Multiplayer
@@ -24,6 +26,7 @@ namespace Multiplayer
 
     class ServerToClientReplicationWindow
         : public IReplicationWindow
+        , public NetworkEntityInterestGrid::ISubscriber
     {
     public:
 
@@ -40,6 +43,7 @@ namespace Multiplayer
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
         ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
+        ~ServerToClientReplicationWindow() override;
 
         //! IReplicationWindow interface
         //! @{
@@ -56,6 +60,12 @@ namespace Multiplayer
         void DebugDraw() const override;
         //! @}
 
+        //! NetworkEntityInterestGrid::ISubscriber interface
+        //! @{
+        void OnEntityEnteredInterest(const ConstNetworkEntityHandle& entityHandle) override;
+        void OnEntityLeftInterest(const ConstNetworkEntityHandle& entityHandle) override;
+        //! @}
+
     private:
 
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
@@ -63,12 +73,41 @@ namespace Multiplayer
         void EvaluateConnection();
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
 
+        //! Gathers the entities around the controlled entity from the visibility system and rebuilds the replication set.
+        void UpdateWindowFromVisibility(const AZ::Vector3& controlledEntityPosition);
+
+        //! Applies the entities that entered or left the subscribed interest grid cells since the last update.
+        void UpdateWindowFromInterestGrid(NetworkEntityInterestGrid& interestGrid, const AZ::Vector3& controlledEntityPosition);
+
+        //! Rebuilds the replication set from the closest entities of interest, used when there are more than can be tracked.
+        void RebuildPrioritizedReplicationSet(const AZ::Vector3& controlledEntityPosition);
+
+        //! Adds the entities that are always replicated, and restores the entities that are no longer forced to their interest state.
+        void UpdateForcedReplicationSet();
+
+        bool IsAcceptedForReplication(const ConstNetworkEntityHandle& entityHandle) const;
+        void ResetCandidateQueue();
+        void LeaveInterestGrid();
+
         ServerToClientReplicationWindow& operator=(const ServerToClientReplicationWindow&) = delete;
 
         // sorted in reverse, lowest priority is the top()
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
 
+        // Interest grid state, the entities in the subscribed cells and whether they passed filtering
+        struct InterestChange
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            bool m_entered = false;
+        };
+        AZStd::vector<InterestChange> m_pendingInterestChanges;
+        AZStd::unordered_map<ConstNetworkEntityHandle, bool> m_interestEntities;
+        ReplicationSet m_forcedReplicationSet;
+        uint32_t m_acceptedInterestCount = 0;
+        bool m_isSubscribedToInterestGrid = false;
+        bool m_isReplicationSetPrioritized = false;
+
         NetworkEntityHandle m_controlledEntity;
         AZ::TransformInterface* m_controlledEntityTransform = nullptr;
 
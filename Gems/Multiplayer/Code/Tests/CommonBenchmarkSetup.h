@@ -205,6 +205,7 @@ namespace Multiplayer
 
         NetworkEntityTracker* GetNetworkEntityTracker() override { return &m_tracker; }
         NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() override { return &m_authorityTracker; }
+        NetworkEntityInterestGrid* GetNetworkEntityInterestGrid() override { return nullptr; }
         MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() override { return &m_multiplayerComponentRegistry; }
         const HostId& GetHostId() const override { return m_hostId; }
 
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/IMultiplayer.h>
+#include <Source/NetworkTime/HitVolumeHistory.h>
+#include <Source/NetworkTime/NetworkTime.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class HitVolumeHistoryTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static HitVolumeShape MakeSphere(float radius)
+        {
+            HitVolumeShape shape;
+            shape.m_type = HitVolumeShape::Type::Sphere;
+            shape.m_radius = radius;
+            return shape;
+        }
+
+        static HitVolumeShape MakeBox(const AZ::Vector3& dimensions)
+        {
+            HitVolumeShape shape;
+            shape.m_type = HitVolumeShape::Type::Box;
+            shape.m_dimensions = dimensions;
+            return shape;
+        }
+
+        static HitVolumeShape MakeCapsule(float radius, float height)
+        {
+            HitVolumeShape shape;
+            shape.m_type = HitVolumeShape::Type::Capsule;
+            shape.m_radius = radius;
+            shape.m_height = height;
+            return shape;
+        }
+
+        // Traces along the x axis from the origin
+        AZStd::vector<HitVolumeQueryResult> TraceX(HostFrameId frameId, float blendFactor = 1.0f, AzNetworking::ConnectionId ignoreConnectionId = AzNetworking::InvalidConnectionId) const
+        {
+            return m_hitVolumeHistory.Raycast(frameId, blendFactor, AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f, ignoreConnectionId);
+        }
+
+        AZ::LoggerSystemComponent m_loggerComponent;
+        AZ::TimeSystem m_timeSystem;
+        NetworkTime m_networkTime;
+        HitVolumeHistory m_hitVolumeHistory;
+    };
+
+    TEST_F(HitVolumeHistoryTests, RaycastHitsShapesInDistanceOrder)
+    {
+        m_hitVolumeHistory.RecordHitVolume(NetEntityId{ 1 }, 0, MakeBox(AZ::Vector3(2.0f)), AZ::Transform::CreateTranslation(AZ::Vector3(30.0f, 0.0f, 0.0f)), AzNetworking::ConnectionId{ 1 });
+        m_hitVolumeHistory.RecordHitVolume(NetEntityId{ 2 }, 0, MakeSphere(1.0f), AZ::Transform::CreateTranslation(AZ::Vector3(10.0f, 0.0f, 0.0f)), AzNetworking::ConnectionId{ 2 });
+        m_hitVolumeHistory.RecordHitVolume(NetEntityId{ 2 }, 1, MakeCapsule(0.5f, 4.0f), AZ::Transform::CreateTranslation(AZ::Vector3(20.0f, 0.0f, 1.5f)), AzNetworking::ConnectionId{ 2 });
+        m_hitVolumeHistory.RecordHitVolume(NetEntityId{ 3 }, 0, MakeSphere(1.0f), AZ::Transform::CreateTranslation(AZ::Vector3(20.0f, 5.0f, 0.0f)), AzNetworking::ConnectionId{ 3 });
+        m_hitVolumeHistory.CommitFrame(HostFrameId{ 1 });
+
+        const AZStd::vector<HitVolumeQueryResult> results = TraceX(HostFrameId{ 1 });
+        ASSERT_EQ(results.size(), 3);
+        EXPECT_EQ(results[0].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_EQ(results[0].m_volumeIndex, 0);
+        EXPECT_NEAR(results[0].m_distance, 9.0f, 0.001f);
+        EXPECT_EQ(results[1].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_EQ(results[1].m_volumeIndex, 1);
+        EXPECT_NEAR(results[1].m_distance, 19.5f, 0.001f);
+        EXPECT_EQ(results[2].m_netEntityId, NetEntityId{ 1 });
+        EXPECT_NEAR(results[2].m_distance, 29.0f, 0.001f);
+        EXPECT_TRUE(results[2].m_position.IsClose(AZ::Vector3(29.0f, 0.0f, 0.0f)));
+
+        // Volumes owned by the shooter's connection are skipped
+        EXPECT_EQ(TraceX(HostFrameId{ 1 }, 1.0f, AzNetworking::ConnectionId{ 2 }).size(), 1);
+    }
+
+    TEST_F(HitVolumeHistoryTests, RaycastUsesHistoricalFrames)
+    {
+        // One volume moving away from the ray, one frame at a time
+        for (uint32_t frame = 0; frame < 8; ++frame)
+        {
+            const AZ::Vector3 position(10.0f, static_cast<float>(frame) * 2.0f, 0.0f);
+            m_hitVolumeHistory.RecordHitVolume(NetEntityId{ 1 }, 0, MakeSphere(1.0f), AZ::Transform::CreateTranslation(position), AzNetworking::InvalidConnectionId);
+            m_hitVolumeHistory.CommitFrame(HostFrameId{ frame });
+        }
+
+        EXPECT_EQ(TraceX(HostFrameId{ 0 }).size(), 1);
+        EXPECT_TRUE(TraceX(HostFrameId{ 1 }).empty());
+        EXPECT_TRUE(TraceX(HostFrameId{ 7 }).empty());
+
+        // A quarter of the way from frame 0 to 1 the sphere still crosses the ray, a quarter of the way from frame 1 to 2 it doesn't
+        EXPECT_EQ(TraceX(HostFrameId{ 1 }, 0.25f).size(), 1);
+        EXPECT_TRUE(TraceX(HostFrameId{ 2 }, 0.25f).empty());
+
+        // Frames that haven't been committed yet resolve to the latest committed frame
+        EXPECT_TRUE(TraceX(HostFrameId{ 9 }).empty());
+    }
+
+    TEST_F(HitVolumeHistoryTests, ExpiredFramesAreNotQueried)
+    {
+        for (uint32_t frame = 0; frame <= RewindHistorySize; ++frame)
+        {
+            m_hitVolumeHistory.RecordHitVolume(NetEntityId{ 1 }, 0, MakeSphere(1.0f), AZ::Transform::CreateTranslation(AZ::Vector3(10.0f, 0.0f, 0.0f)), AzNetworking::InvalidConnectionId);
+            m_hitVolumeHistory.CommitFrame(HostFrameId{ frame });
+        }
+
+        EXPECT_TRUE(TraceX(HostFrameId{ 0 }).empty());
+        EXPECT_EQ(TraceX(HostFrameId{ 1 }).size(), 1);
+        EXPECT_EQ(TraceX(HostFrameId{ RewindHistorySize }).size(), 1);
+
+        m_hitVolumeHistory.Reset();
+        EXPECT_TRUE(TraceX(HostFrameId{ RewindHistorySize }).empty());
+    }
+
+    TEST_F(HitVolumeHistoryTests, RaycastManyVolumes)
+    {
+        // Enough volumes to build a hierarchy several levels deep
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            const AZ::Vector3 position(static_cast<float>(i % 16) * 4.0f, static_cast<float>(i / 16) * 4.0f, 0.0f);
+            m_hitVolumeHistory.RecordHitVolume(NetEntityId{ i }, 0, MakeSphere(1.0f), AZ::Transform::CreateTranslation(position), AzNetworking::InvalidConnectionId);
+        }
+        m_hitVolumeHistory.CommitFrame(HostFrameId{ 1 });
+
+        // A ray along the second row hits every sphere in it, nearest first
+        const AZStd::vector<HitVolumeQueryResult> results = m_hitVolumeHistory.Raycast(
+            HostFrameId{ 1 }, 1.0f, AZ::Vector3(-10.0f, 4.0f, 0.0f), AZ::Vector3::CreateAxisX(), 100.0f, AzNetworking::InvalidConnectionId);
+        ASSERT_EQ(results.size(), 16);
+        for (uint32_t i = 0; i < results.size(); ++i)
+        {
+            EXPECT_EQ(results[i].m_netEntityId, NetEntityId{ 16 + i });
+        }
+    }
+
+    TEST_F(HitVolumeHistoryTests, RaycastRewoundUsesNetworkTime)
+    {
+        for (uint32_t frame = 0; frame < 4; ++frame)
+        {
+            const AZ::Vector3 position(10.0f, static_cast<float>(frame) * 2.0f, 0.0f);
+            m_hitVolumeHistory.RecordHitVolume(NetEntityId{ 1 }, 0, MakeSphere(1.0f), AZ::Transform::CreateTranslation(position), AzNetworking::ConnectionId{ 1 });
+            m_hitVolumeHistory.CommitFrame(HostFrameId{ frame });
+            m_networkTime.IncrementHostFrameId();
+        }
+
+        EXPECT_TRUE(m_hitVolumeHistory.RaycastRewound(AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f).empty());
+
+        {
+            ScopedAlterTime scopedTime(HostFrameId{ 0 }, AZ::Time::ZeroTimeMs, 1.0f, AzNetworking::ConnectionId{ 2 });
+            EXPECT_EQ(m_hitVolumeHistory.RaycastRewound(AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f).size(), 1);
+        }
+
+        {
+            // The shooter's own volumes are never rewound
+            ScopedAlterTime scopedTime(HostFrameId{ 0 }, AZ::Time::ZeroTimeMs, 1.0f, AzNetworking::ConnectionId{ 1 });
+            EXPECT_TRUE(m_hitVolumeHistory.RaycastRewound(AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f).empty());
+        }
+    }
+}
@@ -59,6 +59,7 @@ namespace UnitTest
         MOCK_CONST_METHOD0(GetEntityDomain, Multiplayer::IEntityDomain*());
         MOCK_METHOD0(GetNetworkEntityTracker, Multiplayer::NetworkEntityTracker* ());
         MOCK_METHOD0(GetNetworkEntityAuthorityTracker, Multiplayer::NetworkEntityAuthorityTracker* ());
+        MOCK_METHOD0(GetNetworkEntityInterestGrid, Multiplayer::NetworkEntityInterestGrid* ());
         MOCK_METHOD0(GetMultiplayerComponentRegistry, Multiplayer::MultiplayerComponentRegistry* ());
         MOCK_CONST_METHOD0(GetHostId, const Multiplayer::HostId&());
         MOCK_CONST_METHOD1(GetEntity, Multiplayer::ConstNetworkEntityHandle(Multiplayer::NetEntityId));
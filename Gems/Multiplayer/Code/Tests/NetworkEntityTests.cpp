@@ -8,10 +8,12 @@
 #include <CommonNetworkEntitySetup.h>
 #include <MockInterfaces.h>
 #include <TestMultiplayerComponent.h>
+#include <Source/NetworkEntity/NetworkEntityInterestGrid.h>
 #include <Source/NetworkEntity/NetworkEntityManager.h>
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <Source/EntityDomains/FullOwnershipEntityDomain.h>
 #include <Source/EntityDomains/NullEntityDomain.h>
+#include <Source/EntityDomains/SpatialEntityDomain.h>
 #include <Source/ReplicationWindows/NullReplicationWindow.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Console/Console.h>
@@ -19,6 +21,8 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Serialization/StringifySerializer.h>
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
 #include <AzTest/AzTest.h>
@@ -162,6 +166,35 @@ namespace Multiplayer
         domain->DebugDraw();
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, TestSpatialDomain)
+    {
+        ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        const HostId localhost = HostId("127.0.0.1", 6777, ProtocolType::Udp);
+        const AZ::Aabb domainAabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-10.0f), AZ::Vector3(10.0f));
+
+        m_networkEntityManager->Initialize(localhost, AZStd::make_unique<SpatialEntityDomain>(domainAabb));
+        EXPECT_TRUE(m_networkEntityManager->IsInitialized());
+        IEntityDomain* domain = m_networkEntityManager->GetEntityDomain();
+        EXPECT_NE(domain, nullptr);
+        EXPECT_EQ(domain->GetAabb(), domainAabb);
+        EXPECT_TRUE(domain->IsInDomain(handle));
+
+        // Entities just past the boundary stay in the domain, until they leave the hysteresis margin
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3(11.0f, 0.0f, 0.0f));
+        EXPECT_TRUE(domain->IsInDomain(handle));
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3(13.0f, 0.0f, 0.0f));
+        EXPECT_FALSE(domain->IsInDomain(handle));
+
+        domain->SetAabb(AZ::Aabb::CreateFromMinMax(AZ::Vector3(10.0f, -10.0f, -10.0f), AZ::Vector3(30.0f, 10.0f, 10.0f)));
+        EXPECT_TRUE(domain->IsInDomain(handle));
+        domain->SetAabb(domainAabb);
+
+        // Entities lost outside of the domain are left to the host owning their region
+        domain->HandleLossOfAuthoritativeReplicator(handle);
+        EXPECT_TRUE(m_networkEntityManager->IsMarkedForRemoval(handle));
+        domain->DebugDraw();
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityTracker)
     {
         const NetworkEntityTracker* constNetEntityTracker = m_networkEntityManager->GetNetworkEntityTracker();
@@ -194,6 +227,55 @@ namespace Multiplayer
         EXPECT_FALSE(netEntityTracker->Exists(netId));
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityInterestGrid)
+    {
+        struct TestSubscriber
+            : public NetworkEntityInterestGrid::ISubscriber
+        {
+            void OnEntityEnteredInterest(const ConstNetworkEntityHandle&) override { ++m_enteredCount; }
+            void OnEntityLeftInterest(const ConstNetworkEntityHandle&) override { ++m_leftCount; }
+            uint32_t m_enteredCount = 0;
+            uint32_t m_leftCount = 0;
+        };
+
+        NetworkEntityInterestGrid interestGrid;
+        NetworkEntityTracker* netEntityTracker = m_networkEntityManager->GetNetworkEntityTracker();
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3::CreateZero());
+
+        // Nothing is tracked without subscribers
+        interestGrid.Update(*netEntityTracker);
+        EXPECT_EQ(interestGrid.GetEntityCount(), 0);
+
+        TestSubscriber subscriber;
+        interestGrid.UpdateSubscription(subscriber, AZ::Vector3::CreateZero(), 1.0f);
+        interestGrid.Update(*netEntityTracker);
+        EXPECT_EQ(interestGrid.GetEntityCount(), netEntityTracker->size());
+        EXPECT_EQ(subscriber.m_enteredCount, 1);
+        EXPECT_EQ(subscriber.m_leftCount, 0);
+
+        // Moving within the subscribed cells doesn't notify
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3(1.0f, 1.0f, 0.0f));
+        interestGrid.Update(*netEntityTracker);
+        EXPECT_EQ(subscriber.m_enteredCount, 1);
+        EXPECT_EQ(subscriber.m_leftCount, 0);
+
+        // Moving far away leaves the subscribed cells, coming back enters them again
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3(10000.0f, 10000.0f, 0.0f));
+        interestGrid.Update(*netEntityTracker);
+        EXPECT_EQ(subscriber.m_leftCount, 1);
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3::CreateZero());
+        interestGrid.Update(*netEntityTracker);
+        EXPECT_EQ(subscriber.m_enteredCount, 2);
+
+        // Moving the subscription away removes the entity from interest
+        interestGrid.UpdateSubscription(subscriber, AZ::Vector3(10000.0f, 10000.0f, 0.0f), 1.0f);
+        EXPECT_EQ(subscriber.m_leftCount, 2);
+
+        interestGrid.Unsubscribe(subscriber);
+        interestGrid.Update(*netEntityTracker);
+        EXPECT_EQ(interestGrid.GetEntityCount(), 0);
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, TestReplicatorPendingDeletion)
     {
         m_root->m_replicator->SetPendingRemoval(AZ::TimeMs(100));
@@ -301,6 +383,56 @@ namespace Multiplayer
         m_entityReplicationManager->HandleEntityRpcMessages(m_mockConnection.get(), rpcVector);
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityRpcVectorAggregation)
+    {
+        ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        const NetComponentId componentId = handle.FindComponent<NetworkTransformComponent>()->GetNetComponentId();
+
+        NetworkEntityRpcVector rpcVector;
+        for (uint16_t i = 0; i < 4; ++i)
+        {
+            TestRpcStruct params(AZ::Vector3(static_cast<float>(i)), AZ::Vector3::CreateZero());
+            NetworkEntityRpcMessage& message = rpcVector.emplace_back(
+                RpcDeliveryType::AuthorityToClient, NetEntityId{ i % 2u }, componentId, RpcIndex(i / 2), ReliabilityType::Unreliable);
+            message.SetRpcParams(params);
+        }
+
+        // Two entities and two rpcs are written once, each message only references them
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(inputSerializer.Serialize(rpcVector, "EntityRpcs"));
+        uint32_t individualSize = 0;
+        for (const NetworkEntityRpcMessage& message : rpcVector)
+        {
+            individualSize += message.GetEstimatedSerializeSize();
+        }
+        EXPECT_LT(inputSerializer.GetSize(), individualSize);
+
+        NetworkEntityRpcVector readRpcVector;
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        EXPECT_TRUE(outputSerializer.Serialize(readRpcVector, "EntityRpcs"));
+        ASSERT_EQ(readRpcVector.size(), rpcVector.size());
+        for (uint16_t i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(readRpcVector[i], rpcVector[i]);
+            TestRpcStruct params;
+            EXPECT_TRUE(readRpcVector[i].GetRpcParams(params));
+            EXPECT_EQ(params.m_impulse, AZ::Vector3(static_cast<float>(i)));
+        }
+
+        // Latest-value-wins rpcs replace the pending invocation on the same entity
+        m_entityReplicationManager->SetReplicationWindow(AZStd::make_unique<NullReplicationWindow>(m_mockConnection.get()));
+        for (NetworkEntityRpcMessage& message : rpcVector)
+        {
+            message.SetLatestValueWins(true);
+            m_entityReplicationManager->AddDeferredRpcMessage(message);
+            m_entityReplicationManager->AddDeferredRpcMessage(message);
+        }
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_entityReplicationManager->SendUpdates();
+        AZ_TEST_STOP_TRACE_SUPPRESSION(0);
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityUpdateMessage)
     {
         ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
@@ -481,6 +613,86 @@ namespace Multiplayer
         EXPECT_FALSE(m_root->m_replicator->HasChangesToPublish());
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, EntityReplicatorSkipsComponentsUnchangedSinceAcknowledgedState)
+    {
+        // Properties that are marked dirty but hold the acknowledged value again shouldn't be resent.
+        ON_CALL(*m_mockConnection, WasPacketAcked).WillByDefault(::testing::Return(true));
+
+        auto sendUpdate = [this](AzNetworking::PacketId packetId)
+        {
+            EXPECT_TRUE(m_root->m_replicator->HasChangesToPublish());
+            EXPECT_TRUE(m_root->m_replicator->PrepareToGenerateUpdatePacket());
+            const NetworkEntityUpdateMessage updateMessage = m_root->m_replicator->GenerateUpdatePacket();
+            m_root->m_replicator->RecordSentPacketId(packetId);
+            return updateMessage.GetData()->GetSize();
+        };
+
+        // Move the entity and move it back before the update is sent, which dirties the translation without changing it.
+        auto moveAndReturn = [this]()
+        {
+            AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(1.0f, 2.0f, 3.0f));
+            AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3::CreateZero());
+            m_networkEntityManager->NotifyEntitiesDirtied();
+        };
+
+        // The acknowledged create message is the baseline of the updates.
+        sendUpdate(AzNetworking::PacketId{ 1 });
+        EXPECT_FALSE(m_root->m_replicator->HasChangesToPublish());
+
+        moveAndReturn();
+        const AZStd::size_t baselineDeltaSize = sendUpdate(AzNetworking::PacketId{ 2 });
+        EXPECT_FALSE(m_root->m_replicator->HasChangesToPublish());
+
+        m_console->PerformCommand("net_EntityReplicatorBaselineDelta false");
+        moveAndReturn();
+        const AZStd::size_t fullDeltaSize = sendUpdate(AzNetworking::PacketId{ 3 });
+        m_console->PerformCommand("net_EntityReplicatorBaselineDelta true");
+
+        EXPECT_LT(baselineDeltaSize, fullDeltaSize);
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, EntityReplicatorResendsStateUntilAcknowledged)
+    {
+        // A property that returns to the acknowledged value still has to be sent while a different value may have been received.
+        ON_CALL(*m_mockConnection, WasPacketAcked).WillByDefault(::testing::Return(true));
+
+        auto sendUpdate = [this](AzNetworking::PacketId packetId)
+        {
+            EXPECT_TRUE(m_root->m_replicator->HasChangesToPublish());
+            EXPECT_TRUE(m_root->m_replicator->PrepareToGenerateUpdatePacket());
+            const NetworkEntityUpdateMessage updateMessage = m_root->m_replicator->GenerateUpdatePacket();
+            m_root->m_replicator->RecordSentPacketId(packetId);
+            return updateMessage.GetData()->GetSize();
+        };
+
+        auto setTranslation = [this](const AZ::Vector3& translation)
+        {
+            AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, translation);
+            m_networkEntityManager->NotifyEntitiesDirtied();
+        };
+
+        sendUpdate(AzNetworking::PacketId{ 1 });
+        EXPECT_FALSE(m_root->m_replicator->HasChangesToPublish());
+
+        // The moved translation is sent but not acknowledged.
+        ON_CALL(*m_mockConnection, WasPacketAcked).WillByDefault(::testing::Return(false));
+        setTranslation(AZ::Vector3(1.0f, 2.0f, 3.0f));
+        const AZStd::size_t movedSize = sendUpdate(AzNetworking::PacketId{ 2 });
+
+        // Moving back matches the acknowledged state but not the unacknowledged one, so the translation is sent again.
+        setTranslation(AZ::Vector3::CreateZero());
+        const AZStd::size_t returnedSize = sendUpdate(AzNetworking::PacketId{ 3 });
+        EXPECT_EQ(returnedSize, movedSize);
+
+        // Once the latest update is acknowledged it becomes the baseline, and the same translation is no longer sent.
+        ON_CALL(*m_mockConnection, WasPacketAcked).WillByDefault(::testing::Return(true));
+        EXPECT_FALSE(m_root->m_replicator->HasChangesToPublish());
+        setTranslation(AZ::Vector3(1.0f, 2.0f, 3.0f));
+        setTranslation(AZ::Vector3::CreateZero());
+        const AZStd::size_t unchangedSize = sendUpdate(AzNetworking::PacketId{ 4 });
+        EXPECT_LT(unchangedSize, returnedSize);
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityManagerRelevancy)
     {
         ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonHierarchySetup.h>
+#include <MockInterfaces.h>
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Physics/Character.h>
+#include <AzFramework/Physics/CharacterBus.h>
+#include <AzFramework/Physics/Material/PhysicsMaterialSystemComponent.h>
+#include <AzFramework/Physics/Shape.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+#include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
+#include <AzTest/AzTest.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/Components/NetworkHitVolumesComponent.h>
+#include <Source/SystemComponent.h>
+#include <Source/System/PhysXCookingParams.h>
+#include <Source/System/PhysXSystem.h>
+#include <PhysXCharacters/Components/CharacterControllerComponent.h>
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    /*
+     * (Networked) Character with hit volumes
+     */
+    class NetworkHitVolumesTests : public HierarchyTests
+    {
+    public:
+        void SetUp() override
+        {
+            HierarchyTests::SetUp();
+
+            // create the asset database
+            {
+                AZ::Data::AssetManager::Descriptor desc;
+                AZ::Data::AssetManager::Create(desc);
+            }
+
+            m_systemEntity = new AZ::Entity();
+            m_physXSystem = AZStd::make_unique<PhysX::PhysXSystem>(AZStd::make_unique<PhysX::PhysXSettingsRegistryManager>(), PhysX::PxCooking::GetRealTimeCookingParams());
+
+            m_physMaterialSystemDescriptor.reset(Physics::MaterialSystemComponent::CreateDescriptor());
+            m_physMaterialSystemDescriptor->Reflect(m_serializeContext.get());
+
+            m_physXSystemDescriptor.reset(PhysX::SystemComponent::CreateDescriptor());
+            m_physXSystemDescriptor->Reflect(m_serializeContext.get());
+
+            m_systemEntity->CreateComponent<Physics::MaterialSystemComponent>();
+            m_systemEntity->CreateComponent<PhysX::SystemComponent>();
+            m_systemEntity->Init();
+            m_systemEntity->Activate();
+
+            m_visisbilitySystem = AZStd::make_unique<AzFramework::EntityVisibilityBoundsUnionSystem>();
+            m_visisbilitySystem->Connect();
+
+            AZ::EntityBus::Broadcast(&AZ::EntityBus::Events::OnEntityActivated, m_systemEntity->GetId());
+            AzFramework::GameEntityContextEventBus::Broadcast(&AzFramework::GameEntityContextEventBus::Events::OnPreGameEntitiesStarted);
+
+            m_charControllerDescriptor.reset(PhysX::CharacterControllerComponent::CreateDescriptor());
+            m_charControllerDescriptor->Reflect(m_serializeContext.get());
+
+            m_hitVolumesDescriptor.reset(NetworkHitVolumesComponent::CreateDescriptor());
+            m_hitVolumesDescriptor->Reflect(m_serializeContext.get());
+
+            // Hit volumes are recorded and rewound on the frames set below
+            ON_CALL(*m_mockNetworkTime, GetHostFrameId()).WillByDefault(Invoke([this]() { return m_hostFrameId; }));
+            ON_CALL(*m_mockNetworkTime, GetUnalteredHostFrameId()).WillByDefault(Invoke([this]() { return m_unalteredHostFrameId; }));
+            ON_CALL(*m_mockNetworkTime, IsTimeRewound()).WillByDefault(Invoke([this]() { return m_hostFrameId != m_unalteredHostFrameId; }));
+            ON_CALL(*m_mockNetworkTime, GetHostBlendFactor()).WillByDefault(Return(1.0f));
+            ON_CALL(*m_mockNetworkTime, GetRewindingConnectionId()).WillByDefault(Return(ConnectionId{ 1 }));
+
+            m_root = AZStd::make_unique<EntityInfo>(1, "root", NetEntityId{ 1 }, EntityInfo::Role::Root);
+            m_root->m_entity->CreateComponent<AzFramework::TransformComponent>();
+            m_root->m_entity->CreateComponent<NetBindComponent>();
+            m_root->m_entity->CreateComponent<NetworkTransformComponent>();
+            m_root->m_entity->CreateComponent<PhysX::CharacterControllerComponent>(
+                AZStd::make_unique<Physics::CharacterConfiguration>(),
+                AZStd::make_shared<Physics::BoxShapeConfiguration>());
+            m_root->m_entity->CreateComponent<NetworkHitVolumesComponent>();
+            SetupEntity(m_root->m_entity, m_root->m_netId, NetEntityRole::Authority);
+            m_root->m_entity->Activate();
+
+            AZ::EntityBus::Broadcast(&AZ::EntityBus::Events::OnEntityActivated, m_root->m_entity->GetId());
+        }
+
+        void TearDown() override
+        {
+            m_root.reset();
+
+            m_visisbilitySystem->Disconnect();
+            m_visisbilitySystem.reset();
+            m_systemEntity->Deactivate();
+            delete m_systemEntity;
+            m_physXSystem.reset();
+
+            m_hitVolumesDescriptor.reset();
+            m_charControllerDescriptor.reset();
+            m_physXSystemDescriptor.reset();
+            m_physMaterialSystemDescriptor.reset();
+
+            AZ::Data::AssetManager::Destroy();
+
+            HierarchyTests::TearDown();
+        }
+
+        NetworkHitVolumesComponent::AnimatedHitVolume& AddHitVolume()
+        {
+            NetworkHitVolumesComponent* hitVolumes = m_root->m_entity->FindComponent<NetworkHitVolumesComponent>();
+            Physics::CharacterRequests* character = Physics::CharacterRequestBus::FindFirstHandler(m_root->m_entity->GetId());
+            EXPECT_NE(character, nullptr);
+
+            hitVolumes->m_animatedHitVolumes.emplace_back(InvalidConnectionId, character, "head", &m_colliderConfig, &m_shapeConfig, 0);
+            return hitVolumes->m_animatedHitVolumes.back();
+        }
+
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_physMaterialSystemDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_physXSystemDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_charControllerDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_hitVolumesDescriptor;
+
+        AZStd::unique_ptr<PhysX::PhysXSystem> m_physXSystem;
+        AZStd::unique_ptr<AzFramework::EntityVisibilityBoundsUnionSystem> m_visisbilitySystem;
+
+        Physics::ColliderConfiguration m_colliderConfig;
+        Physics::SphereShapeConfiguration m_shapeConfig{ 0.5f };
+
+        HostFrameId m_hostFrameId = HostFrameId{ 0 };
+        HostFrameId m_unalteredHostFrameId = HostFrameId{ 0 };
+
+        AZ::Entity* m_systemEntity;
+        AZStd::unique_ptr<EntityInfo> m_root;
+    };
+
+    TEST_F(NetworkHitVolumesTests, TestSyncRewindMovesShapesWithHitVolumeHistory)
+    {
+        m_console->PerformCommand("sv_UseHitVolumeHistory true");
+
+        NetworkHitVolumesComponent::AnimatedHitVolume& hitVolume = AddHitVolume();
+        ASSERT_NE(hitVolume.m_physicsShape, nullptr);
+
+        const AZ::Vector3 previousPosition(1.0f, 0.0f, 0.0f);
+        const AZ::Vector3 currentPosition(5.0f, 0.0f, 0.0f);
+
+        m_hostFrameId = m_unalteredHostFrameId = HostFrameId{ 1 };
+        hitVolume.UpdateTransform(AZ::Transform::CreateTranslation(previousPosition));
+        m_hostFrameId = m_unalteredHostFrameId = HostFrameId{ 2 };
+        hitVolume.UpdateTransform(AZ::Transform::CreateTranslation(currentPosition));
+        EXPECT_TRUE(hitVolume.m_physicsShape->GetLocalPose().first.IsClose(currentPosition));
+
+        // Rewinding the authority must still move the physics shapes so physics scene queries stay lag compensated
+        m_hostFrameId = HostFrameId{ 1 };
+        m_root->m_entity->FindComponent<NetBindComponent>()->NotifySyncRewindState();
+        EXPECT_TRUE(hitVolume.m_physicsShape->GetLocalPose().first.IsClose(previousPosition));
+
+        m_hostFrameId = HostFrameId{ 2 };
+        m_root->m_entity->FindComponent<NetBindComponent>()->NotifySyncRewindState();
+        EXPECT_TRUE(hitVolume.m_physicsShape->GetLocalPose().first.IsClose(currentPosition));
+    }
+}
@@ -167,6 +167,52 @@ namespace Multiplayer
         EXPECT_EQ(inHistory.Size(), 0);
     }
 
+    TEST_F(NetworkInputTests, NetworkInputHistoryWrapsAround)
+    {
+        const NetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityTracker.get());
+        NetworkInputArray inArray = NetworkInputArray(handle);
+        NetworkInputHistory inHistory = NetworkInputHistory();
+        inHistory.Reserve(NetworkInputArray::MaxElements);
+
+        // Keep a bounded window of inputs, as the client does for its rewind history, so the ring wraps several times
+        constexpr uint32_t InputCount = NetworkInputArray::MaxElements * 5;
+        for (uint32_t i = 0; i < InputCount; ++i)
+        {
+            inArray[0].SetClientInputId(ClientInputId(i));
+            inArray[0].SetHostFrameId(HostFrameId(i));
+            inHistory.PushBack(inArray[0]);
+            while (inHistory.Size() > NetworkInputArray::MaxElements - 1)
+            {
+                inHistory.PopFront();
+            }
+        }
+
+        EXPECT_EQ(inHistory.Size(), NetworkInputArray::MaxElements - 1);
+        for (uint32_t i = 0; i < inHistory.Size(); ++i)
+        {
+            const uint32_t expectedId = InputCount - (NetworkInputArray::MaxElements - 1) + i;
+            EXPECT_EQ(inHistory[i].GetClientInputId(), ClientInputId(expectedId));
+            EXPECT_EQ(inHistory[i].GetHostFrameId(), HostFrameId(expectedId));
+        }
+
+        // Growing past the reserved capacity preserves the order of the inputs already in the history
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            inArray[0].SetClientInputId(ClientInputId(InputCount + i));
+            inHistory.PushBack(inArray[0]);
+        }
+
+        EXPECT_EQ(inHistory.Size(), NetworkInputArray::MaxElements * 2 - 1);
+        for (uint32_t i = 0; i < inHistory.Size(); ++i)
+        {
+            EXPECT_EQ(inHistory[i].GetClientInputId(), ClientInputId(InputCount - (NetworkInputArray::MaxElements - 1) + i));
+        }
+
+        NetworkInputHistory copiedHistory = inHistory;
+        EXPECT_EQ(copiedHistory.Size(), inHistory.Size());
+        EXPECT_EQ(copiedHistory.Front().GetClientInputId(), inHistory.Front().GetClientInputId());
+    }
+
     TEST_F(NetworkInputTests, ConstNetworkInputHistory)
     {
         const NetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityTracker.get());
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonNetworkEntitySetup.h>
+#include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    //! Replication window with a fixed replication set, so the tests control the priority of every entity
+    class TestReplicationWindow final
+        : public IReplicationWindow
+    {
+    public:
+        bool ReplicationSetUpdateReady() override { return false; }
+        const ReplicationSet& GetReplicationSet() const override { return m_replicationSet; }
+        uint32_t GetMaxProxyEntityReplicatorSendCount() const override { return m_maxProxySendCount; }
+        bool IsInWindow(const ConstNetworkEntityHandle&, NetEntityRole&) const override { return true; }
+        bool AddEntity(AZ::Entity*) override { return false; }
+        void RemoveEntity(AZ::Entity*) override {}
+        void UpdateWindow() override {}
+        AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector&) override { return AzNetworking::InvalidPacketId; }
+        void SendEntityRpcs(NetworkEntityRpcVector&, bool) override {}
+        void SendEntityResets(const NetEntityIdSet&) override {}
+        void DebugDraw() const override {}
+
+        ReplicationSet m_replicationSet;
+        uint32_t m_maxProxySendCount = 10;
+    };
+
+    class ReplicationBudgetTests : public NetworkEntityTests
+    {
+    public:
+        void SetUp() override
+        {
+            NetworkEntityTests::SetUp();
+
+            auto replicationWindow = AZStd::make_unique<TestReplicationWindow>();
+            m_replicationWindow = replicationWindow.get();
+            m_entityReplicationManager->SetReplicationWindow(AZStd::move(replicationWindow));
+        }
+
+        void TearDown() override
+        {
+            m_console->PerformCommand("sv_ReplicationBandwidthBudgetBytes 0");
+
+            // The replicators reference the entities, so release them first
+            m_entityReplicationManager->m_entityReplicatorMap.clear();
+            m_replicators.clear();
+            m_entityInfos.clear();
+
+            NetworkEntityTests::TearDown();
+        }
+
+        //! Adds a proxy entity with the given replication priority and last update size to the connection
+        EntityReplicator* AddProxyEntity(float priority, uint32_t lastUpdateSize)
+        {
+            const AZ::u64 index = m_entityInfos.size() + 1;
+            m_entityInfos.emplace_back(AZStd::make_unique<EntityInfo>(index, "proxy", NetEntityId{ index }, EntityInfo::Role::None));
+            EntityInfo& entityInfo = *m_entityInfos.back();
+
+            entityInfo.m_entity->CreateComponent<AzFramework::TransformComponent>();
+            entityInfo.m_entity->CreateComponent<NetBindComponent>();
+            entityInfo.m_entity->CreateComponent<NetworkTransformComponent>();
+            SetupEntity(entityInfo.m_entity, entityInfo.m_netId, NetEntityRole::Authority);
+
+            const ConstNetworkEntityHandle handle(entityInfo.m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+            EntityReplicationData& replicationData = m_replicationWindow->m_replicationSet[handle];
+            replicationData.m_netEntityRole = NetEntityRole::Client;
+            replicationData.m_priority = priority;
+
+            EntityReplicator* replicator = m_entityReplicationManager->AddEntityReplicator(handle, NetEntityRole::Client);
+            replicator->ActivateNetworkEntity();
+            replicator->SetLastUpdateSize(lastUpdateSize);
+            m_replicators.push_back(replicator);
+            return replicator;
+        }
+
+        EntityReplicatorList SelectBudgetedProxyUpdates(int64_t budgetBytes)
+        {
+            m_entityReplicationManager->m_bandwidthBudgetBytes = budgetBytes;
+            EntityReplicatorList toSendList;
+            m_entityReplicationManager->SelectBudgetedProxyUpdates(m_replicators, toSendList);
+            return toSendList;
+        }
+
+        EntityReplicatorList GenerateEntityUpdateList(int64_t budgetBytes)
+        {
+            m_entityReplicationManager->m_bandwidthBudgetBytes = budgetBytes;
+            return m_entityReplicationManager->GenerateEntityUpdateList();
+        }
+
+        bool IsBandwidthBudgetActive()
+        {
+            m_entityReplicationManager->RefillBandwidthBudget();
+            return m_entityReplicationManager->m_bandwidthBudgetTimeMs != AZ::Time::ZeroTimeMs;
+        }
+
+        bool IsPendingSend(const EntityReplicator* replicator) const
+        {
+            const NetEntityIdSet& pendingSend = m_entityReplicationManager->m_replicatorsPendingSend;
+            return pendingSend.find(replicator->GetEntityHandle().GetNetEntityId()) != pendingSend.end();
+        }
+
+        TestReplicationWindow* m_replicationWindow = nullptr;
+        AZStd::vector<AZStd::unique_ptr<EntityInfo>> m_entityInfos;
+        AZStd::vector<EntityReplicator*> m_replicators;
+    };
+
+    TEST_F(ReplicationBudgetTests, BudgetAdmitsUpdatesInPriorityOrder)
+    {
+        EntityReplicator* lowest = AddProxyEntity(1.0f, 100);
+        EntityReplicator* highest = AddProxyEntity(4.0f, 100);
+        EntityReplicator* low = AddProxyEntity(2.0f, 100);
+        EntityReplicator* high = AddProxyEntity(3.0f, 100);
+
+        // The budget may go into debt by one update, so 150 bytes admit two updates of 100 bytes
+        const EntityReplicatorList toSendList = SelectBudgetedProxyUpdates(150);
+        ASSERT_EQ(toSendList.size(), 2u);
+        EXPECT_EQ(toSendList[0], highest);
+        EXPECT_EQ(toSendList[1], high);
+
+        EXPECT_EQ(highest->GetBudgetDeferralCount(), 0u);
+        EXPECT_EQ(high->GetBudgetDeferralCount(), 0u);
+        EXPECT_EQ(low->GetBudgetDeferralCount(), 1u);
+        EXPECT_EQ(lowest->GetBudgetDeferralCount(), 1u);
+    }
+
+    TEST_F(ReplicationBudgetTests, BudgetRespectsMaxProxySendCount)
+    {
+        m_replicationWindow->m_maxProxySendCount = 1;
+        AddProxyEntity(1.0f, 10);
+        EntityReplicator* high = AddProxyEntity(2.0f, 10);
+
+        const EntityReplicatorList toSendList = SelectBudgetedProxyUpdates(1000);
+        ASSERT_EQ(toSendList.size(), 1u);
+        EXPECT_EQ(toSendList[0], high);
+    }
+
+    TEST_F(ReplicationBudgetTests, StarvedUpdatesAreCarriedOverToNextSend)
+    {
+        m_console->PerformCommand("sv_ReplicationBandwidthBudgetBytes 50");
+        m_console->PerformCommand("sv_ReplicationBudgetStarvationBoost 0.5");
+
+        EntityReplicator* low = AddProxyEntity(1.0f, 100);
+        EntityReplicator* high = AddProxyEntity(1.2f, 100);
+
+        // Only one update fits the budget, the deferred update stays pending send
+        EntityReplicatorList toSendList = GenerateEntityUpdateList(50);
+        ASSERT_EQ(toSendList.size(), 1u);
+        EXPECT_EQ(toSendList[0], high);
+        EXPECT_TRUE(IsPendingSend(low));
+        EXPECT_EQ(low->GetBudgetDeferralCount(), 1u);
+
+        // The deferral boosts the starved update above the higher priority one on the next send
+        toSendList = GenerateEntityUpdateList(50);
+        ASSERT_EQ(toSendList.size(), 1u);
+        EXPECT_EQ(toSendList[0], low);
+        EXPECT_EQ(low->GetBudgetDeferralCount(), 0u);
+        EXPECT_EQ(high->GetBudgetDeferralCount(), 1u);
+    }
+
+    TEST_F(ReplicationBudgetTests, ZeroBudgetDoesNotLimitProxyUpdates)
+    {
+        m_console->PerformCommand("sv_ReplicationBandwidthBudgetBytes 0");
+
+        for (uint32_t index = 0; index < 4; ++index)
+        {
+            AddProxyEntity(1.0f, 10000);
+        }
+
+        // Without a budget, even a connection in bandwidth debt sends every proxy update the replication window allows
+        const EntityReplicatorList toSendList = GenerateEntityUpdateList(-100000);
+        EXPECT_EQ(toSendList.size(), m_replicators.size());
+        for (const EntityReplicator* replicator : m_replicators)
+        {
+            EXPECT_EQ(replicator->GetBudgetDeferralCount(), 0u);
+        }
+
+        EXPECT_FALSE(IsBandwidthBudgetActive());
+    }
+}
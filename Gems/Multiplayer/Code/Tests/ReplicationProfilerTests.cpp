@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CommonNetworkEntitySetup.h>
+#include <AzCore/Metrics/IEventLogger.h>
+#include <Source/MultiplayerReplicationProfiler.h>
+
+namespace Multiplayer
+{
+    using namespace testing;
+    using namespace ::UnitTest;
+
+    //! Event logger that keeps the counter events written by the replication profiler
+    class TestReplicationCostLogger final
+        : public AZ::Metrics::IEventLogger
+    {
+    public:
+        struct Counter
+        {
+            AZStd::string m_category;
+            AZStd::string m_name;
+            AZ::u64 m_bytes = 0;
+            AZ::u64 m_updates = 0;
+        };
+
+        void Flush() override {}
+        ResultOutcome RecordDurationEventBegin(const AZ::Metrics::DurationArgs&) override { return AZ::Success(); }
+        ResultOutcome RecordDurationEventEnd(const AZ::Metrics::DurationArgs&) override { return AZ::Success(); }
+        ResultOutcome RecordCompleteEvent(const AZ::Metrics::CompleteArgs&) override { return AZ::Success(); }
+        ResultOutcome RecordInstantEvent(const AZ::Metrics::InstantArgs&) override { return AZ::Success(); }
+        ResultOutcome RecordAsyncEventStart(const AZ::Metrics::AsyncArgs&) override { return AZ::Success(); }
+        ResultOutcome RecordAsyncEventInstant(const AZ::Metrics::AsyncArgs&) override { return AZ::Success(); }
+        ResultOutcome RecordAsyncEventEnd(const AZ::Metrics::AsyncArgs&) override { return AZ::Success(); }
+
+        ResultOutcome RecordCounterEvent(const AZ::Metrics::CounterArgs& counterArgs) override
+        {
+            Counter& counter = m_counters.emplace_back();
+            counter.m_category = counterArgs.m_cat;
+            counter.m_name = counterArgs.m_name;
+            for (const AZ::Metrics::EventField& field : counterArgs.m_args)
+            {
+                if (field.m_name == "Bytes")
+                {
+                    counter.m_bytes = AZStd::get<AZ::u64>(field.m_value.m_value);
+                }
+                else if (field.m_name == "Updates")
+                {
+                    counter.m_updates = AZStd::get<AZ::u64>(field.m_value.m_value);
+                }
+            }
+            return AZ::Success();
+        }
+
+        AZStd::vector<Counter> GetCounters(AZStd::string_view category) const
+        {
+            AZStd::vector<Counter> counters;
+            for (const Counter& counter : m_counters)
+            {
+                if (counter.m_category == category)
+                {
+                    counters.push_back(counter);
+                }
+            }
+            return counters;
+        }
+
+        AZStd::vector<Counter> m_counters;
+    };
+
+    class ReplicationProfilerTests : public NetworkEntityTests
+    {
+    public:
+        void SetUp() override
+        {
+            NetworkEntityTests::SetUp();
+            m_profiler = AZStd::make_unique<MultiplayerReplicationProfiler>();
+            m_profiler->SetConnected(true);
+        }
+
+        void TearDown() override
+        {
+            m_profiler.reset();
+            NetworkEntityTests::TearDown();
+        }
+
+        //! Signals the serialization events MultiplayerStats sends for one entity update
+        void SerializeEntity(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName,
+            const AZStd::vector<AZStd::pair<PropertyIndex, uint32_t>>& properties)
+        {
+            MultiplayerStats::Events& events = GetMultiplayer()->GetStats().m_events;
+            events.m_entitySerializeStart.Signal(mode, entityId, entityName);
+            for (const auto& [propertyIndex, bytes] : properties)
+            {
+                events.m_propertySent.Signal(NetComponentId{ 1 }, propertyIndex, bytes);
+            }
+            events.m_componentSerializeEnd.Signal(mode, NetComponentId{ 1 });
+            events.m_entitySerializeStop.Signal(mode, entityId, entityName);
+        }
+
+        AZStd::unique_ptr<MultiplayerReplicationProfiler> m_profiler;
+    };
+
+    TEST_F(ReplicationProfilerTests, AttributesBytesToEntitiesComponentsAndProperties)
+    {
+        const auto readFromObject = AzNetworking::SerializerMode::ReadFromObject;
+        SerializeEntity(readFromObject, AZ::EntityId(1), "expensive", { { PropertyIndex{ 0 }, 40 }, { PropertyIndex{ 1 }, 10 } });
+        SerializeEntity(readFromObject, AZ::EntityId(1), "expensive", { { PropertyIndex{ 0 }, 40 } });
+        SerializeEntity(readFromObject, AZ::EntityId(2), "cheap", { { PropertyIndex{ 1 }, 5 } });
+
+        TestReplicationCostLogger logger;
+        m_profiler->RecordMetrics(logger, 10);
+
+        const AZStd::vector<TestReplicationCostLogger::Counter> entities = logger.GetCounters("ReplicationCostEntities");
+        ASSERT_EQ(entities.size(), 2u);
+        EXPECT_EQ(entities[0].m_name, "expensive");
+        EXPECT_EQ(entities[0].m_bytes, 90u);
+        EXPECT_EQ(entities[0].m_updates, 2u);
+        EXPECT_EQ(entities[1].m_name, "cheap");
+        EXPECT_EQ(entities[1].m_bytes, 5u);
+
+        const AZStd::vector<TestReplicationCostLogger::Counter> components = logger.GetCounters("ReplicationCostComponents");
+        ASSERT_EQ(components.size(), 1u);
+        EXPECT_EQ(components[0].m_bytes, 95u);
+        EXPECT_EQ(components[0].m_updates, 3u);
+
+        const AZStd::vector<TestReplicationCostLogger::Counter> properties = logger.GetCounters("ReplicationCostProperties");
+        ASSERT_EQ(properties.size(), 2u);
+        EXPECT_EQ(properties[0].m_bytes, 80u);
+        EXPECT_EQ(properties[1].m_bytes, 15u);
+    }
+
+    TEST_F(ReplicationProfilerTests, ReportsOnlyTheMostExpensiveEntriesAndResets)
+    {
+        const auto readFromObject = AzNetworking::SerializerMode::ReadFromObject;
+        SerializeEntity(readFromObject, AZ::EntityId(1), "small", { { PropertyIndex{ 0 }, 10 } });
+        SerializeEntity(readFromObject, AZ::EntityId(2), "large", { { PropertyIndex{ 0 }, 30 } });
+        SerializeEntity(readFromObject, AZ::EntityId(3), "medium", { { PropertyIndex{ 0 }, 20 } });
+
+        TestReplicationCostLogger logger;
+        m_profiler->RecordMetrics(logger, 2);
+
+        const AZStd::vector<TestReplicationCostLogger::Counter> entities = logger.GetCounters("ReplicationCostEntities");
+        ASSERT_EQ(entities.size(), 2u);
+        EXPECT_EQ(entities[0].m_name, "large");
+        EXPECT_EQ(entities[1].m_name, "medium");
+
+        // Costs are reset by every report
+        TestReplicationCostLogger nextLogger;
+        m_profiler->RecordMetrics(nextLogger, 2);
+        EXPECT_TRUE(nextLogger.m_counters.empty());
+    }
+
+    TEST_F(ReplicationProfilerTests, IgnoresIncomingUpdatesAndDisconnectedProfiler)
+    {
+        // Only outgoing updates are attributed
+        SerializeEntity(AzNetworking::SerializerMode::WriteToObject, AZ::EntityId(1), "incoming", { { PropertyIndex{ 0 }, 10 } });
+
+        TestReplicationCostLogger logger;
+        m_profiler->RecordMetrics(logger, 10);
+        EXPECT_TRUE(logger.GetCounters("ReplicationCostEntities").empty());
+
+        m_profiler->SetConnected(false);
+        EXPECT_FALSE(m_profiler->IsConnected());
+        SerializeEntity(AzNetworking::SerializerMode::ReadFromObject, AZ::EntityId(1), "outgoing", { { PropertyIndex{ 0 }, 10 } });
+        m_profiler->RecordMetrics(logger, 10);
+        EXPECT_TRUE(logger.m_counters.empty());
+    }
+}
@@ -130,6 +130,35 @@ namespace UnitTest
         }
     }
 
+    struct LargeObject
+    {
+        AZStd::array<uint32_t, 8> values;
+    };
+
+    TEST_F(RewindableObjectTests, CompactHistoryModifySharedValue)
+    {
+        static_assert(AZStd::is_same_v<Multiplayer::RewindableHistory<LargeObject, RewindableBufferFrames>,
+            Multiplayer::RewindableCompactHistory<LargeObject, RewindableBufferFrames>>, "Expected a compact history for large objects");
+        Multiplayer::RewindableObject<LargeObject, RewindableBufferFrames> test(LargeObject{ { 0 } });
+
+        // Only every fourth frame changes the value, the frames in between reference the previous one
+        for (uint32_t i = 0; i < RewindableBufferFrames * 2; ++i)
+        {
+            if (i % 4 == 0)
+            {
+                test.Modify().values[0] = i;
+            }
+            EXPECT_EQ(test.Get().values[0], i - i % 4);
+            AZ::Interface<Multiplayer::INetworkTime>::Get()->IncrementHostFrameId();
+        }
+
+        for (uint32_t i = RewindableBufferFrames; i < RewindableBufferFrames * 2; ++i)
+        {
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(i), AZ::Time::ZeroTimeMs, 1.f, AzNetworking::InvalidConnectionId);
+            EXPECT_EQ(test.Get().values[0], i - i % 4);
+        }
+    }
+
     TEST_F(RewindableObjectTests, TestBackfillOnLargeTimestep)
     {
         Multiplayer::RewindableObject<uint32_t, RewindableBufferFrames> test(0);
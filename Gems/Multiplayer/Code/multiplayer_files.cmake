@@ -48,6 +48,7 @@ set(FILES
     Include/Multiplayer/NetworkEntity/INetworkEntityManager.h
     Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h
     Include/Multiplayer/NetworkInput/IMultiplayerComponentInput.h
+    Include/Multiplayer/NetworkTime/IHitVolumeHistory.h
     Include/Multiplayer/NetworkTime/INetworkTime.h
     Include/Multiplayer/NetworkTime/RewindableArray.h
     Include/Multiplayer/NetworkTime/RewindableArray.inl
@@ -73,8 +74,12 @@ set(FILES
     Source/EntityDomains/FullOwnershipEntityDomain.h
     Source/EntityDomains/NullEntityDomain.cpp
     Source/EntityDomains/NullEntityDomain.h
+    Source/EntityDomains/SpatialEntityDomain.cpp
+    Source/EntityDomains/SpatialEntityDomain.h
     Source/MultiplayerStatSystemComponent.cpp
     Source/MultiplayerStatSystemComponent.h
+    Source/MultiplayerReplicationProfiler.cpp
+    Source/MultiplayerReplicationProfiler.h
     Source/MultiplayerStats.cpp
     Source/NetworkEntity/NetworkEntityHandle.cpp
     Source/NetworkEntity/NetworkEntityRpcMessage.cpp
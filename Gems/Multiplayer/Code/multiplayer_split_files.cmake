@@ -52,6 +52,8 @@ set(FILES
     Source/MultiplayerSystemComponent.h
     Source/NetworkEntity/NetworkEntityAuthorityTracker.cpp
     Source/NetworkEntity/NetworkEntityAuthorityTracker.h
+    Source/NetworkEntity/NetworkEntityInterestGrid.cpp
+    Source/NetworkEntity/NetworkEntityInterestGrid.h
     Source/NetworkEntity/NetworkEntityManager.cpp
     Source/NetworkEntity/NetworkEntityManager.h
     Source/NetworkEntity/NetworkSpawnableLibrary.cpp
@@ -62,6 +64,8 @@ set(FILES
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
+    Source/NetworkTime/HitVolumeHistory.cpp
+    Source/NetworkTime/HitVolumeHistory.h
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
@@ -20,16 +20,20 @@ set(FILES
     Tests/CommonBenchmarkSetup.h
     Tests/IMultiplayerConnectionMock.h
     Tests/IMultiplayerSpawnerMock.h
+    Tests/HitVolumeHistoryTests.cpp
     Tests/Main.cpp
     Tests/MockInterfaces.h
     Tests/LocalPredictionPlayerInputTests.cpp
     Tests/MultiplayerComponentTests.cpp
     Tests/MultiplayerSystemTests.cpp
     Tests/NetworkCharacterTests.cpp
+    Tests/NetworkHitVolumesTests.cpp
     Tests/NetworkEntityTests.cpp
     Tests/NetworkInputTests.cpp
     Tests/NetworkRigidBodyTests.cpp
     Tests/NetworkTransformTests.cpp
+    Tests/ReplicationBudgetTests.cpp
+    Tests/ReplicationProfilerTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
     Tests/ServerHierarchyTests.cpp
@@ -8,11 +8,16 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "ZstdCompressor.h"
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdDictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Path of the dictionary used by the Zstd packet compressor, must match on both ends of a connection. Set before creating the network interfaces");
+    AZ_CVAR(int32_t, net_ZstdCompressionLevel, ZstdCompressor::DefaultCompressionLevel, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Compression level used by the Zstd packet compressor");
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
         return AZStd::make_unique<LZ4Compressor>();
@@ -22,4 +27,32 @@ namespace MultiplayerCompression
     {
         return s_compressorName;
     }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerZstdCompressionFactory::Create()
+    {
+        const AZ::CVarFixedString dictionaryPath = net_ZstdDictionaryPath;
+        const int32_t compressionLevel = net_ZstdCompressionLevel;
+        if ((m_dictionaryPath != dictionaryPath.c_str()) || (m_dictionaryCompressionLevel != compressionLevel))
+        {
+            // Compressors are created once per network interface or connection, so the dictionary is only reloaded when the cvars change
+            m_dictionaryPath = dictionaryPath.c_str();
+            m_dictionaryCompressionLevel = compressionLevel;
+            m_dictionary = m_dictionaryPath.empty() ? nullptr : ZstdDictionary::LoadFromFile(m_dictionaryPath, compressionLevel);
+        }
+
+        AZ_Warning("Multiplayer Compressor", m_dictionaryPath.empty() || m_dictionary,
+            "Zstd compression dictionary %s could not be loaded, compressing without a dictionary", m_dictionaryPath.c_str());
+        AZStd::unique_ptr<ZstdCompressor> compressor = AZStd::make_unique<ZstdCompressor>(m_dictionary, compressionLevel);
+        if (!compressor->Init())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create the Zstd compression contexts");
+            return nullptr;
+        }
+        return compressor;
+    }
+
+    const AZStd::string_view MultiplayerZstdCompressionFactory::GetFactoryName() const
+    {
+        return s_compressorName;
+    }
 }
@@ -9,9 +9,13 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
 #include <AzNetworking/Framework/ICompressor.h>
 
+#include "ZstdDictionary.h"
+
 namespace MultiplayerCompression
 {
     class MultiplayerCompressionFactory
@@ -29,4 +33,26 @@ namespace MultiplayerCompression
     private:
         static constexpr AZStd::string_view s_compressorName = "MultiplayerCompressor";
     };
+
+    //! Factory for the Zstandard compressor, selected by setting net_UdpCompressor or net_TcpCompressor to MultiplayerZstdCompressor.
+    //! The dictionary set by net_ZstdDictionaryPath is loaded once and shared by all the compressors the factory creates.
+    class MultiplayerZstdCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the string name of this compressor factory
+        //! @return the string name of this compressor factory
+        const AZStd::string_view GetFactoryName() const override;
+
+    private:
+        static constexpr AZStd::string_view s_compressorName = "MultiplayerZstdCompressor";
+
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+        AZStd::string m_dictionaryPath;
+        int32_t m_dictionaryCompressionLevel = 0;
+    };
 }
@@ -14,6 +14,7 @@
 
 #include "MultiplayerCompressionSystemComponent.h"
 #include "LZ4Compressor.h"
+#include "ZstdCompressor.h"
 #include "MultiplayerCompressionFactory.h"
 
 namespace MultiplayerCompression
@@ -50,10 +51,14 @@ namespace MultiplayerCompression
     {
         m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+        m_multiplayerZstdCompressionFactory = new MultiplayerZstdCompressionFactory();
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerZstdCompressionFactory);
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerZstdCompressionFactory->GetFactoryName());
+        delete m_multiplayerZstdCompressionFactory;
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
         delete m_multiplayerCompressionFactory;
     }
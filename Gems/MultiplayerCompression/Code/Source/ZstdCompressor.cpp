@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdCompressor.h"
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Crc.h>
+
+// Required for the magicless frame format, which saves four bytes per packet
+#define ZSTD_STATIC_LINKING_ONLY
+#include <zstd.h>
+#include <zstd_errors.h>
+
+namespace MultiplayerCompression
+{
+    ZstdCompressor::ZstdCompressor(AZStd::shared_ptr<const ZstdDictionary> dictionary, int32_t compressionLevel)
+        : m_dictionary(AZStd::move(dictionary))
+    {
+        m_compressionContext = ZSTD_createCCtx();
+        m_decompressionContext = ZSTD_createDCtx();
+
+        if (m_compressionContext != nullptr)
+        {
+            if (m_dictionary)
+            {
+                // The compression level of a dictionary is fixed when the dictionary is digested
+                ZSTD_CCtx_refCDict(m_compressionContext, m_dictionary->GetCompressionDictionary());
+            }
+            else
+            {
+                ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_compressionLevel, compressionLevel);
+            }
+            ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_checksumFlag, 0);
+            ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_dictIDFlag, 0);
+#if defined(ZSTD_c_format)
+            ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_c_format, ZSTD_f_zstd1_magicless);
+#endif
+        }
+
+        if (m_decompressionContext != nullptr)
+        {
+            if (m_dictionary)
+            {
+                ZSTD_DCtx_refDDict(m_decompressionContext, m_dictionary->GetDecompressionDictionary());
+            }
+#if defined(ZSTD_d_format)
+            ZSTD_DCtx_setParameter(m_decompressionContext, ZSTD_d_format, ZSTD_f_zstd1_magicless);
+#endif
+        }
+
+        // Endpoints must use the same dictionary to understand each other, so the dictionary version is part of the type
+        AZ::Crc32 compressorType(ZstdCompressorName);
+        if (m_dictionary)
+        {
+            const uint32_t dictionaryVersion = m_dictionary->GetVersion();
+            compressorType.Add(&dictionaryVersion, sizeof(dictionaryVersion));
+        }
+        m_compressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(compressorType));
+    }
+
+    ZstdCompressor::~ZstdCompressor()
+    {
+        ZSTD_freeCCtx(m_compressionContext);
+        ZSTD_freeDCtx(m_decompressionContext);
+    }
+
+    bool ZstdCompressor::Init()
+    {
+        return (m_compressionContext != nullptr) && (m_decompressionContext != nullptr);
+    }
+
+    size_t ZstdCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZstdCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr || m_compressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer or compression context is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        ZstdDictionary::CaptureSample(uncompData, uncompSize);
+
+        const size_t result = ZSTD_compress2(m_compressionContext, compData, compDataSize, uncompData, uncompSize);
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B): %s", uncompSize, compDataSize, ZSTD_getErrorName(result));
+            return (ZSTD_getErrorCode(result) == ZSTD_error_dstSize_tooSmall)
+                ? AzNetworking::CompressorError::InsufficientBuffer
+                : AzNetworking::CompressorError::CorruptData;
+        }
+
+        compSize = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (uncompData == nullptr || m_decompressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer or decompression context is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        // Decompress through the streaming interface, which honours the dictionary and frame format set on the context
+        ZSTD_DCtx_reset(m_decompressionContext, ZSTD_reset_session_only);
+        ZSTD_inBuffer input = { compData, compDataSize, 0 };
+        ZSTD_outBuffer output = { uncompData, uncompDataSize, 0 };
+        const size_t result = ZSTD_decompressStream(m_decompressionContext, &output, &input);
+        consumedSizeOut = input.pos;
+
+        if (ZSTD_isError(result) || (result != 0))
+        {
+            // A non-zero result means the frame is incomplete, either truncated or larger than the output buffer
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B): %s",
+                compDataSize, uncompDataSize, ZSTD_isError(result) ? ZSTD_getErrorName(result) : "incomplete frame");
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        uncompSizeOut = output.pos;
+        return AzNetworking::CompressorError::Ok;
+    }
+}
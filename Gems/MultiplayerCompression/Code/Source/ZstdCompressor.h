@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+#include "ZstdDictionary.h"
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+
+namespace MultiplayerCompression
+{
+    static const char* ZstdCompressorName = "Zstd";
+
+    /**
+    * Implements a Zstandard Compressor against Multiplayer's Compressor interface for use with AzNetworking.
+    * Game packets are too small for a general purpose compressor to find much redundancy within a single packet, so the
+    * compressor can be given a dictionary trained from captured packets of the game, which both endpoints must share.
+    * Frames are written without the magic number and dictionary id, since both are implied by the negotiated compressor type.
+    */
+    class ZstdCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdCompressor, AZ::SystemAllocator);
+
+        static constexpr int32_t DefaultCompressionLevel = 3;
+
+        //! Constructor.
+        //! @param dictionary       optional dictionary to compress with, must be shared by both endpoints of a connection
+        //! @param compressionLevel the Zstandard compression level to use when there's no dictionary
+        explicit ZstdCompressor(AZStd::shared_ptr<const ZstdDictionary> dictionary = nullptr, int32_t compressionLevel = DefaultCompressionLevel);
+        ~ZstdCompressor() override;
+
+        const char* GetName() const { return ZstdCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return m_compressorType; }
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        ZstdCompressor(const ZstdCompressor&) = delete;
+        ZstdCompressor& operator=(const ZstdCompressor&) = delete;
+
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+        ZSTD_CCtx_s* m_compressionContext = nullptr;
+        ZSTD_DCtx_s* m_decompressionContext = nullptr;
+        AzNetworking::CompressorType m_compressorType;
+    };
+}
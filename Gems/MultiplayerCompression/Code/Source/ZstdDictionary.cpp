@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdDictionary.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/string/fixed_string.h>
+
+#include <zstd.h>
+#include <zdict.h>
+
+namespace MultiplayerCompression
+{
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdCaptureFolder, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If set, the Zstd compressor writes the uncompressed packet payloads it compresses to this folder, as samples for net_ZstdTrainDictionary");
+    AZ_CVAR(uint32_t, net_ZstdCaptureCount, 10000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The maximum number of packet samples written to net_ZstdCaptureFolder");
+
+    // Packet dictionaries are most effective when small, so they stay in cache while compressing
+    static constexpr size_t DefaultDictionarySize = 16 * 1024;
+
+    static AZStd::atomic_uint32_t s_capturedSampleCount{ 0 };
+
+    static AZ::IO::FixedMaxPath ResolveDictionaryPath(AZStd::string_view path)
+    {
+        AZ::IO::FixedMaxPath resolvedPath(path);
+        if (AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance())
+        {
+            fileIO->ResolvePath(resolvedPath, AZ::IO::PathView(path));
+        }
+        return resolvedPath;
+    }
+
+    ZstdDictionary::ZstdDictionary(AZStd::vector<uint8_t>&& dictionaryData, int32_t compressionLevel)
+        : m_data(AZStd::move(dictionaryData))
+    {
+        if (m_data.empty())
+        {
+            return;
+        }
+
+        m_compressionDictionary = ZSTD_createCDict(m_data.data(), m_data.size(), compressionLevel);
+        m_decompressionDictionary = ZSTD_createDDict(m_data.data(), m_data.size());
+
+        // Raw content dictionaries don't have an id, so they are versioned by their contents instead
+        m_version = ZSTD_getDictID_fromDict(m_data.data(), m_data.size());
+        if (m_version == 0)
+        {
+            m_version = static_cast<uint32_t>(AZ::Crc32(m_data.data(), m_data.size()));
+        }
+    }
+
+    ZstdDictionary::~ZstdDictionary()
+    {
+        ZSTD_freeCDict(m_compressionDictionary);
+        ZSTD_freeDDict(m_decompressionDictionary);
+    }
+
+    AZStd::shared_ptr<ZstdDictionary> ZstdDictionary::LoadFromFile(AZStd::string_view filePath, int32_t compressionLevel)
+    {
+        const AZ::IO::FixedMaxPath resolvedPath = ResolveDictionaryPath(filePath);
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(resolvedPath.Native());
+        if (!readResult.IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to read compression dictionary %s: %s", resolvedPath.c_str(), readResult.GetError().c_str());
+            return nullptr;
+        }
+
+        AZStd::shared_ptr<ZstdDictionary> dictionary = AZStd::make_shared<ZstdDictionary>(readResult.TakeValue(), compressionLevel);
+        if (!dictionary->IsValid())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression dictionary %s is not a valid Zstandard dictionary", resolvedPath.c_str());
+            return nullptr;
+        }
+        return dictionary;
+    }
+
+    bool ZstdDictionary::Train(const AZStd::vector<AZStd::vector<uint8_t>>& samples, size_t maxDictionarySize, AZStd::vector<uint8_t>& outDictionary)
+    {
+        AZStd::vector<uint8_t> sampleData;
+        AZStd::vector<size_t> sampleSizes;
+        sampleSizes.reserve(samples.size());
+        for (const AZStd::vector<uint8_t>& sample : samples)
+        {
+            sampleData.insert(sampleData.end(), sample.begin(), sample.end());
+            sampleSizes.push_back(sample.size());
+        }
+
+        outDictionary.resize_no_construct(maxDictionarySize);
+        const size_t dictionarySize = ZDICT_trainFromBuffer(outDictionary.data(), outDictionary.size(), sampleData.data(), sampleSizes.data(), static_cast<unsigned>(sampleSizes.size()));
+        if (ZDICT_isError(dictionarySize))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to train compression dictionary from %zu samples: %s", samples.size(), ZDICT_getErrorName(dictionarySize));
+            outDictionary.clear();
+            return false;
+        }
+
+        outDictionary.resize(dictionarySize);
+        return true;
+    }
+
+    void ZstdDictionary::CaptureSample(const void* data, size_t size)
+    {
+        const AZ::CVarFixedString captureFolder = net_ZstdCaptureFolder;
+        if (captureFolder.empty() || (s_capturedSampleCount >= net_ZstdCaptureCount))
+        {
+            return;
+        }
+
+        // Compressors run on multiple threads, so the sample index is claimed atomically
+        const uint32_t sampleIndex = s_capturedSampleCount++;
+        if (sampleIndex >= net_ZstdCaptureCount)
+        {
+            return;
+        }
+
+        const AZ::IO::FixedMaxPath samplePath = ResolveDictionaryPath(captureFolder) / AZStd::fixed_string<32>::format("%08u.bin", sampleIndex);
+        auto writeResult = AZ::Utils::WriteFile(AZStd::span<const AZStd::byte>(reinterpret_cast<const AZStd::byte*>(data), size), samplePath.Native());
+        AZ_Warning("Multiplayer Compressor", writeResult.IsSuccess(), "Failed to write packet sample %s: %s", samplePath.c_str(),
+            writeResult.IsSuccess() ? "" : writeResult.GetError().c_str());
+    }
+
+    bool ZstdDictionary::IsValid() const
+    {
+        return (m_compressionDictionary != nullptr) && (m_decompressionDictionary != nullptr);
+    }
+
+    uint32_t ZstdDictionary::GetVersion() const
+    {
+        return m_version;
+    }
+
+    const ZSTD_CDict_s* ZstdDictionary::GetCompressionDictionary() const
+    {
+        return m_compressionDictionary;
+    }
+
+    const ZSTD_DDict_s* ZstdDictionary::GetDecompressionDictionary() const
+    {
+        return m_decompressionDictionary;
+    }
+
+    static void net_ZstdTrainDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_WARN("Usage: net_ZstdTrainDictionary <sample folder> <output file> [max dictionary size]");
+            return;
+        }
+
+        size_t maxDictionarySize = DefaultDictionarySize;
+        if (arguments.size() > 2)
+        {
+            AZStd::string sizeString(arguments[2]);
+            maxDictionarySize = AZStd::max<size_t>(AZ::StringFunc::ToInt(sizeString.c_str()), 256);
+        }
+
+        // Every file in the sample folder holds a single uncompressed packet payload
+        const AZ::IO::FixedMaxPath sampleFolder = ResolveDictionaryPath(arguments[0]);
+        AZStd::vector<AZStd::vector<uint8_t>> samples;
+        AZ::IO::SystemFile::FindFiles((sampleFolder / "*").c_str(), [&sampleFolder, &samples](const char* fileName, bool isFile)
+        {
+            if (isFile)
+            {
+                auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>((sampleFolder / fileName).Native());
+                if (readResult.IsSuccess() && !readResult.GetValue().empty())
+                {
+                    samples.emplace_back(readResult.TakeValue());
+                }
+            }
+            return true;
+        });
+
+        AZStd::vector<uint8_t> dictionary;
+        if (!ZstdDictionary::Train(samples, maxDictionarySize, dictionary))
+        {
+            return;
+        }
+
+        const AZ::IO::FixedMaxPath outputPath = ResolveDictionaryPath(arguments[1]);
+        auto writeResult = AZ::Utils::WriteFile(AZStd::span<const AZStd::byte>(reinterpret_cast<const AZStd::byte*>(dictionary.data()), dictionary.size()), outputPath.Native());
+        if (!writeResult.IsSuccess())
+        {
+            AZLOG_WARN("Failed to write compression dictionary %s: %s", outputPath.c_str(), writeResult.GetError().c_str());
+            return;
+        }
+
+        AZLOG_INFO("Trained a %zu byte compression dictionary with id %u from %zu samples into %s",
+            dictionary.size(), ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size()), samples.size(), outputPath.c_str());
+    }
+    AZ_CONSOLEFREEFUNC(net_ZstdTrainDictionary, AZ::ConsoleFunctorFlags::DontReplicate, "Trains a Zstd packet compression dictionary from a folder of packet payload samples, usage: <sample folder> <output file> [max dictionary size]");
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string_view.h>
+
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace MultiplayerCompression
+{
+    /**
+    * A Zstandard dictionary shared by all the Zstd compressors of a process.
+    * Dictionaries are trained offline from captured packet payloads, see net_ZstdTrainDictionary, and must be identical on
+    * both ends of a connection. The dictionary version is part of the compressor type, so endpoints using different
+    * dictionaries are rejected when they connect rather than failing to decompress each other's packets.
+    */
+    class ZstdDictionary
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdDictionary, AZ::SystemAllocator);
+
+        //! Creates a dictionary from the contents of a trained or raw content dictionary.
+        //! @param dictionaryData   the dictionary contents
+        //! @param compressionLevel the Zstandard compression level to digest the dictionary for
+        ZstdDictionary(AZStd::vector<uint8_t>&& dictionaryData, int32_t compressionLevel);
+        ~ZstdDictionary();
+
+        //! Loads a dictionary from a file.
+        //! @param filePath         path of the dictionary file, may contain file aliases
+        //! @param compressionLevel the Zstandard compression level to digest the dictionary for
+        //! @return the loaded dictionary, or nullptr if the file couldn't be read or isn't a valid dictionary
+        static AZStd::shared_ptr<ZstdDictionary> LoadFromFile(AZStd::string_view filePath, int32_t compressionLevel);
+
+        //! Trains a dictionary from sample packet payloads.
+        //! @param samples           the uncompressed payloads to train from, ideally thousands of representative packets
+        //! @param maxDictionarySize the maximum size of the dictionary in bytes
+        //! @param outDictionary     receives the trained dictionary contents
+        //! @return boolean true on success
+        static bool Train(const AZStd::vector<AZStd::vector<uint8_t>>& samples, size_t maxDictionarySize, AZStd::vector<uint8_t>& outDictionary);
+
+        //! Writes an uncompressed packet payload to net_ZstdCaptureFolder as a training sample, if sample capture is enabled.
+        //! @param data the uncompressed payload
+        //! @param size the size of the payload in bytes
+        static void CaptureSample(const void* data, size_t size);
+
+        //! Returns whether the dictionary was digested successfully.
+        //! @return boolean true if the dictionary can be used
+        bool IsValid() const;
+
+        //! Returns the version of the dictionary, the dictionary id of trained dictionaries or a checksum of raw content dictionaries.
+        //! @return the version of the dictionary
+        uint32_t GetVersion() const;
+
+        const ZSTD_CDict_s* GetCompressionDictionary() const;
+        const ZSTD_DDict_s* GetDecompressionDictionary() const;
+
+    private:
+        ZstdDictionary(const ZstdDictionary&) = delete;
+        ZstdDictionary& operator=(const ZstdDictionary&) = delete;
+
+        AZStd::vector<uint8_t> m_data;
+        ZSTD_CDict_s* m_compressionDictionary = nullptr;
+        ZSTD_DDict_s* m_decompressionDictionary = nullptr;
+        uint32_t m_version = 0;
+    };
+}
@@ -10,9 +10,13 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <ZstdCompressor.h>
+#include <ZstdDictionary.h>
 
 #include <AzCore/Compression/Compression.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzTest/AzTest.h>
@@ -115,4 +119,89 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZstdCompressTest)
+{
+    // A small packet like payload, repeating the kind of values a game sends every tick
+    AZStd::vector<uint8_t> packet;
+    for (uint8_t i = 0; i < 96; ++i)
+    {
+        packet.push_back(static_cast<uint8_t>(i % 12));
+    }
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor;
+    ASSERT_TRUE(zstdCompressor.Init());
+
+    AZStd::vector<uint8_t> compressed(zstdCompressor.GetMaxCompressedBufferSize(packet.size()));
+    size_t compressedSize = 0;
+    AzNetworking::CompressorError compressStatus = zstdCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize);
+    ASSERT_TRUE(compressStatus == AzNetworking::CompressorError::Ok);
+    EXPECT_LT(compressedSize, packet.size());
+
+    AZStd::vector<uint8_t> decompressed(packet.size());
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize);
+    ASSERT_TRUE(decompressStatus == AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(consumedSize, compressedSize);
+    EXPECT_EQ(uncompressedSize, packet.size());
+    EXPECT_TRUE(memcmp(decompressed.data(), packet.data(), packet.size()) == 0);
+
+    // Truncated frames must be rejected
+    decompressStatus = zstdCompressor.Decompress(compressed.data(), compressedSize - 1, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize);
+    EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::CorruptData);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZstdDictionaryTest)
+{
+    // Packets that share their content with the dictionary but have little redundancy of their own
+    AZStd::vector<uint8_t> dictionaryData;
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        dictionaryData.push_back(static_cast<uint8_t>((i * 37) ^ (i >> 3)));
+    }
+    AZStd::vector<uint8_t> packet(dictionaryData.begin() + 64, dictionaryData.begin() + 128);
+
+    auto dictionary = AZStd::make_shared<MultiplayerCompression::ZstdDictionary>(AZStd::vector<uint8_t>(dictionaryData), MultiplayerCompression::ZstdCompressor::DefaultCompressionLevel);
+    ASSERT_TRUE(dictionary->IsValid());
+
+    MultiplayerCompression::ZstdCompressor plainCompressor;
+    MultiplayerCompression::ZstdCompressor dictionaryCompressor(dictionary);
+    ASSERT_TRUE(plainCompressor.Init());
+    ASSERT_TRUE(dictionaryCompressor.Init());
+
+    // Endpoints with different dictionaries can't understand each other, so they must not negotiate the same compressor type
+    EXPECT_NE(plainCompressor.GetType(), dictionaryCompressor.GetType());
+    MultiplayerCompression::ZstdCompressor otherDictionaryCompressor(dictionary);
+    EXPECT_EQ(dictionaryCompressor.GetType(), otherDictionaryCompressor.GetType());
+
+    AZStd::vector<uint8_t> compressed(dictionaryCompressor.GetMaxCompressedBufferSize(packet.size()));
+    size_t plainSize = 0;
+    size_t dictionarySize = 0;
+    ASSERT_TRUE(plainCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), plainSize) == AzNetworking::CompressorError::Ok);
+    ASSERT_TRUE(dictionaryCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), dictionarySize) == AzNetworking::CompressorError::Ok);
+    EXPECT_LT(dictionarySize, plainSize);
+
+    AZStd::vector<uint8_t> decompressed(packet.size());
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+    ASSERT_TRUE(otherDictionaryCompressor.Decompress(compressed.data(), dictionarySize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize) == AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(uncompressedSize, packet.size());
+    EXPECT_TRUE(memcmp(decompressed.data(), packet.data(), packet.size()) == 0);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZstdNullTest)
+{
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor;
+
+    AzNetworking::CompressorError compressStatus = zstdCompressor.Compress(nullptr, 4, nullptr, 4, compressedSize);
+    EXPECT_TRUE(compressStatus == AzNetworking::CompressorError::Uninitialized);
+
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(nullptr, 4, nullptr, 4, consumedSize, uncompressedSize);
+    EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -55,6 +55,17 @@ namespace NvCloth
         //! Returns whether the solver StartSimulation and FinishSimulation functions will be called by the user or the cloth system.
         virtual bool IsUserSimulated() const = 0;
 
+        //! Sets how often the solver runs simulation, to lower the cost of cloths that don't need to
+        //! be simulated every frame. StartSimulation calls in between are skipped and their delta time is
+        //! added to the next simulation, so the cloths still move at the same speed but in larger steps.
+        //! @param frames Number of StartSimulation calls per simulation. Default value is 1 (every call).
+        //! @param frameOffset Number of StartSimulation calls skipped before the next simulation,
+        //!        used to spread the simulation of solvers with the same interval across frames.
+        virtual void SetSimulationInterval(AZ::u32 frames, AZ::u32 frameOffset = 0) = 0;
+
+        //! Returns the number of StartSimulation calls per simulation.
+        virtual AZ::u32 GetSimulationInterval() const = 0;
+
         //! Start simulation of all the cloths that are part of this solver. This will setup and start cloth simulation jobs.
         //! If the solver is in user-simulated mode the user is responsible for calling this function.
         //! Note: This is a non-blocking call.
@@ -79,6 +79,20 @@ namespace NvCloth
     //! Name of the default solver that cloth system always creates.
     static const char* const DefaultSolverName = "DefaultClothSolver";
 
+    //! Number of simulation levels of detail.
+    //! Past the first level, which is the default solver, cloth system creates a solver for each level
+    //! that simulates its cloths every 2^level frames.
+    static const AZ::u32 SimulationLodCount = 4;
+
+    //! Names of the solvers of each simulation level of detail.
+    static const char* const SimulationLodSolverNames[SimulationLodCount] =
+    {
+        DefaultSolverName,
+        "DefaultClothSolverLod1",
+        "DefaultClothSolverLod2",
+        "DefaultClothSolverLod3"
+    };
+
     //! Structure with all the data of a fabric.
     //!
     //! The fabric is a template from which cloths are created from, it contains all the necessary
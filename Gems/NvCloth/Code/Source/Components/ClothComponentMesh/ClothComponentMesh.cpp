@@ -18,6 +18,7 @@
 #include <NvCloth/IClothSystem.h>
 #include <NvCloth/IFabricCooker.h>
 #include <NvCloth/IClothConfigurator.h>
+#include <NvCloth/ISolver.h>
 #include <NvCloth/ITangentSpaceHelper.h>
 
 #include <Components/ClothComponentMesh/ActorClothColliders.h>
@@ -26,6 +27,7 @@
 #include <Components/ClothComponentMesh/ClothDebugDisplay.h>
 #include <Components/ClothComponentMesh/ClothComponentMesh.h>
 
+#include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/WindBus.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
@@ -41,6 +43,10 @@ namespace NvCloth
     AZ_CVAR(float, cloth_SecondsToDelaySimulationOnActorSpawned, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The amount of time in seconds the cloth simulation will be delayed to avoid sudden impulses when actors are spawned.");
 
+    AZ_CVAR(float, cloth_SimulationLodDistance, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The distance in meters from the active camera past which cloth is simulated every other frame. "
+        "Each time the distance doubles again the frames between simulations double too. 0 disables the simulation level of detail.");
+
     // Helper class to map an RPI buffer from a buffer asset view.
     template<typename T>
     class MappedBuffer
@@ -308,6 +314,8 @@ namespace NvCloth
 
     void ClothComponentMesh::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        UpdateSimulationLod();
+
         CopyRenderDataToModel();
     }
 
@@ -337,6 +345,38 @@ namespace NvCloth
         return m_renderDataBuffer[m_renderDataBufferIndex];
     }
 
+    void ClothComponentMesh::UpdateSimulationLod()
+    {
+        AZ::u32 lodLevel = 0;
+
+        // The levels of detail are simulated by solvers of the cloth system,
+        // which would take the cloth away from the user when the default solver is user-simulated.
+        const ISolver* defaultSolver = AZ::Interface<IClothSystem>::Get()->GetSolver(DefaultSolverName);
+        const bool useSimulationLod = cloth_SimulationLodDistance > 0.0f &&
+            defaultSolver && !defaultSolver->IsUserSimulated() &&
+            Camera::ActiveCameraRequestBus::HasHandlers();
+
+        if (useSimulationLod)
+        {
+            AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+            Camera::ActiveCameraRequestBus::BroadcastResult(cameraTransform, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+
+            const float cameraDistance = m_worldPosition.GetDistance(cameraTransform.GetTranslation());
+            for (float lodDistance = cloth_SimulationLodDistance;
+                lodLevel + 1 < SimulationLodCount && cameraDistance >= lodDistance;
+                lodDistance *= 2.0f)
+            {
+                ++lodLevel;
+            }
+        }
+
+        if (lodLevel != m_simulationLodLevel &&
+            AZ::Interface<IClothSystem>::Get()->AddCloth(m_cloth, SimulationLodSolverNames[lodLevel]))
+        {
+            m_simulationLodLevel = lodLevel;
+        }
+    }
+
     void ClothComponentMesh::UpdateSimulationCollisions()
     {
         if (m_actorClothColliders)
@@ -680,6 +720,7 @@ namespace NvCloth
 
         // Add cloth to default solver to be simulated
         AZ::Interface<IClothSystem>::Get()->AddCloth(m_cloth);
+        m_simulationLodLevel = 0;
 
         return true;
     }
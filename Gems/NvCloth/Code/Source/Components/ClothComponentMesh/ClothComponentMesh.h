@@ -80,6 +80,7 @@ namespace NvCloth
         void OnWindChanged(const AZ::Aabb& aabb) override;
 
     private:
+        void UpdateSimulationLod();
         void UpdateSimulationCollisions();
         void UpdateSimulationSkinning(float deltaTime);
         void UpdateSimulationConstraints();
@@ -107,6 +108,9 @@ namespace NvCloth
         // Instance of cloth simulation
         ICloth* m_cloth = nullptr;
 
+        // Simulation level of detail, which is the index of the solver the cloth is added to in SimulationLodSolverNames.
+        AZ::u32 m_simulationLodLevel = 0;
+
         // Cloth event handlers
         ICloth::PreSimulationEvent::Handler m_preSimulationEventHandler;
         ICloth::PostSimulationEvent::Handler m_postSimulationEventHandler;
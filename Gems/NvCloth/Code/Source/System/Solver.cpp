@@ -9,6 +9,7 @@
 #include <System/Solver.h>
 #include <System/Cloth.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobFunction.h>
 
 // NvCloth library includes
@@ -17,6 +18,10 @@
 
 namespace NvCloth
 {
+    AZ_CVAR(AZ::u32, cloth_ClothsPerSimulationJob, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The number of cloths whose pre and post simulation work runs in the same job. "
+        "Higher values lower the cost of scheduling jobs when there are many small cloths.");
+
     Solver::Solver(const AZStd::string& name, NvSolverUniquePtr nvSolver)
         : m_name(name)
         , m_nvSolver(AZStd::move(nvSolver))
@@ -101,6 +106,17 @@ namespace NvCloth
         return m_userSimulated;
     }
 
+    void Solver::SetSimulationInterval(AZ::u32 frames, AZ::u32 frameOffset)
+    {
+        m_simulationInterval = AZStd::max(frames, 1u);
+        m_framesUntilSimulation = frameOffset % m_simulationInterval;
+    }
+
+    AZ::u32 Solver::GetSimulationInterval() const
+    {
+        return m_simulationInterval;
+    }
+
     void Solver::StartSimulation(float deltaTime)
     {
         if (!IsEnabled() || m_cloths.empty())
@@ -110,20 +126,30 @@ namespace NvCloth
 
         AZ_Assert(!m_isSimulating, "Please make sure the ongoing simulation is finished before attempting to start a new one");
 
+        if (m_framesUntilSimulation > 0)
+        {
+            --m_framesUntilSimulation;
+            m_skippedDeltaTime += deltaTime;
+            return;
+        }
+        m_framesUntilSimulation = m_simulationInterval - 1;
+
         AZ_PROFILE_FUNCTION(Cloth);
 
-        m_deltaTime = deltaTime;
+        m_deltaTime = deltaTime + m_skippedDeltaTime;
+        m_skippedDeltaTime = 0.0f;
         m_simulationCompletion.Reset(true /*isClearDependent*/);
 
-        m_preSimulationEvent.Signal(m_name, deltaTime);
+        m_preSimulationEvent.Signal(m_name, m_deltaTime);
 
         // Set isSimulating flag after the pre-simulation event is sent in case if there are handlers adding/removing cloth from the solver.
         m_isSimulating = true;
 
         // Setup the chain of jobs for the simulation pass
+        const size_t clothsPerJob = AZStd::max<size_t>(static_cast<AZ::u32>(cloth_ClothsPerSimulationJob), 1);
 
         // Post simulation jobs will unlock the entire simulation pass completion.
-        ClothsPostSimulationJob* clothsPostSimulationJob = aznew ClothsPostSimulationJob(&m_cloths, m_deltaTime, &m_simulationCompletion);
+        ClothsPostSimulationJob* clothsPostSimulationJob = aznew ClothsPostSimulationJob(&m_cloths, clothsPerJob, m_deltaTime, &m_simulationCompletion);
         clothsPostSimulationJob->SetDependent(&m_simulationCompletion);
 
         // Simulation jobs will unlock the post simulation job.
@@ -131,7 +157,7 @@ namespace NvCloth
         clothsSimulationJob->SetDependent(clothsPostSimulationJob);
 
         // Pre-simulation jobs will unlock the simulation job.
-        ClothsPreSimulationJob* clothsPreSimulationJob = aznew ClothsPreSimulationJob(&m_cloths, m_deltaTime, clothsSimulationJob);
+        ClothsPreSimulationJob* clothsPreSimulationJob = aznew ClothsPreSimulationJob(&m_cloths, clothsPerJob, m_deltaTime, clothsSimulationJob);
         clothsPreSimulationJob->SetDependent(clothsSimulationJob);
 
         // Start the jobs.
@@ -227,9 +253,10 @@ namespace NvCloth
         // This is expected behavior.
     }
 
-    Solver::ClothsPostSimulationJob::ClothsPostSimulationJob(const Cloths* cloths, float deltaTime,
+    Solver::ClothsPostSimulationJob::ClothsPostSimulationJob(const Cloths* cloths, size_t clothsPerJob, float deltaTime,
         AZ::Job* continuationJob, AZ::JobContext* context) : Job(true /*isAutoDelete*/, context)
         , m_cloths(cloths)
+        , m_clothsPerJob(clothsPerJob)
         , m_continuationJob(continuationJob)
         , m_deltaTime(deltaTime)
     {
@@ -237,17 +264,23 @@ namespace NvCloth
 
     void Solver::ClothsPostSimulationJob::Process()
     {
-        for (Cloth* cloth : *m_cloths)
+        for (size_t firstCloth = 0; firstCloth < m_cloths->size(); firstCloth += m_clothsPerJob)
         {
-            AZ::Job* eventSignalJob = AZ::CreateJobFunction([cloth, deltaTime = m_deltaTime]
+            const size_t lastCloth = AZStd::min(firstCloth + m_clothsPerJob, m_cloths->size());
+            AZ::Job* eventSignalJob = AZ::CreateJobFunction([cloths = m_cloths, firstCloth, lastCloth, deltaTime = m_deltaTime]
             {
                 AZ_PROFILE_SCOPE(Cloth, "NvCloth::PostSimulationJob");
 
-                // Update the cloth data after the simulation
-                cloth->Update();
+                for (size_t clothIndex = firstCloth; clothIndex < lastCloth; ++clothIndex)
+                {
+                    Cloth* cloth = (*cloths)[clothIndex];
 
-                // Issue post-simulation events
-                cloth->m_postSimulationEvent.Signal(cloth->GetId(), deltaTime, cloth->GetParticles());
+                    // Update the cloth data after the simulation
+                    cloth->Update();
+
+                    // Issue post-simulation events
+                    cloth->m_postSimulationEvent.Signal(cloth->GetId(), deltaTime, cloth->GetParticles());
+                }
             }, true /*isAutoDelete*/);
 
             eventSignalJob->SetDependentStarted(m_continuationJob);
@@ -256,9 +289,10 @@ namespace NvCloth
     }
 
 
-    Solver::ClothsPreSimulationJob::ClothsPreSimulationJob(const Cloths* cloths, float deltaTime,
+    Solver::ClothsPreSimulationJob::ClothsPreSimulationJob(const Cloths* cloths, size_t clothsPerJob, float deltaTime,
         AZ::Job* continuationJob, AZ::JobContext* context) : Job(true /*isAutoDelete*/, context)
         , m_cloths(cloths)
+        , m_clothsPerJob(clothsPerJob)
         , m_continuationJob(continuationJob)
         , m_deltaTime(deltaTime)
     {
@@ -266,14 +300,20 @@ namespace NvCloth
 
     void Solver::ClothsPreSimulationJob::Process()
     {
-        for (Cloth* cloth : *m_cloths)
+        for (size_t firstCloth = 0; firstCloth < m_cloths->size(); firstCloth += m_clothsPerJob)
         {
-            AZ::Job* eventSignalJob = AZ::CreateJobFunction([cloth, deltaTime = m_deltaTime]
+            const size_t lastCloth = AZStd::min(firstCloth + m_clothsPerJob, m_cloths->size());
+            AZ::Job* eventSignalJob = AZ::CreateJobFunction([cloths = m_cloths, firstCloth, lastCloth, deltaTime = m_deltaTime]
             {
                 AZ_PROFILE_SCOPE(Cloth, "NvCloth::PreSimulationJob");
 
-                // Issue pre-simulation events
-                cloth->m_preSimulationEvent.Signal(cloth->GetId(), deltaTime);
+                for (size_t clothIndex = firstCloth; clothIndex < lastCloth; ++clothIndex)
+                {
+                    Cloth* cloth = (*cloths)[clothIndex];
+
+                    // Issue pre-simulation events
+                    cloth->m_preSimulationEvent.Signal(cloth->GetId(), deltaTime);
+                }
             }, true /*isAutoDelete*/);
 
             eventSignalJob->SetDependentStarted(m_continuationJob);
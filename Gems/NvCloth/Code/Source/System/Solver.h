@@ -44,6 +44,8 @@ namespace NvCloth
         bool IsEnabled() const override;
         void SetUserSimulated(bool value) override;
         bool IsUserSimulated() const override;
+        void SetSimulationInterval(AZ::u32 frames, AZ::u32 frameOffset = 0) override;
+        AZ::u32 GetSimulationInterval() const override;
         void StartSimulation(float deltaTime) override;
         void FinishSimulation() override;
         void SetInterCollisionDistance(float distance) override;
@@ -59,7 +61,7 @@ namespace NvCloth
         public:
             AZ_CLASS_ALLOCATOR(ClothsPreSimulationJob, AZ::ThreadPoolAllocator);
 
-            ClothsPreSimulationJob(const Cloths* cloths, float deltaTime,
+            ClothsPreSimulationJob(const Cloths* cloths, size_t clothsPerJob, float deltaTime,
                 AZ::Job* continuationJob, AZ::JobContext* context = nullptr);
 
             void Process() override;
@@ -68,6 +70,9 @@ namespace NvCloth
             // List of cloths to do the pre-simulation work for.
             const Cloths* m_cloths = nullptr;
 
+            // Number of cloths whose pre-simulation work is done by the same job.
+            size_t m_clothsPerJob = 1;
+
             // The job to run after all pre-simulation jobs are completed.
             AZ::Job* m_continuationJob = nullptr;
 
@@ -103,7 +108,7 @@ namespace NvCloth
         public:
             AZ_CLASS_ALLOCATOR(ClothsPostSimulationJob, AZ::ThreadPoolAllocator);
 
-            ClothsPostSimulationJob(const Cloths* cloths, float deltaTime,
+            ClothsPostSimulationJob(const Cloths* cloths, size_t clothsPerJob, float deltaTime,
                 AZ::Job* continuationJob, AZ::JobContext* context = nullptr);
 
             void Process() override;
@@ -112,6 +117,9 @@ namespace NvCloth
             // List of cloths to do the post-simulation work for.
             const Cloths* m_cloths = nullptr;
 
+            // Number of cloths whose post-simulation work is done by the same job.
+            size_t m_clothsPerJob = 1;
+
             // The job to run after all post-simulation jobs are completed.
             AZ::Job* m_continuationJob = nullptr;
 
@@ -136,6 +144,15 @@ namespace NvCloth
         // List of Cloth instances added to this solver.
         Cloths m_cloths;
 
+        // Number of StartSimulation calls per simulation.
+        AZ::u32 m_simulationInterval = 1;
+
+        // Number of StartSimulation calls to skip before the next simulation.
+        AZ::u32 m_framesUntilSimulation = 0;
+
+        // Delta time of the StartSimulation calls skipped since the last simulation.
+        float m_skippedDeltaTime = 0.0f;
+
         // Stored delta time during the simulation.
         float m_deltaTime = 0.0f;
 
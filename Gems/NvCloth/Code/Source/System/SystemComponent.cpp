@@ -400,11 +400,19 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(Cloth);
 
+        // Start all solvers before waiting for any of them, so their simulations run in parallel.
         for (auto& solverIt : m_solvers)
         {
             if (!solverIt->IsUserSimulated())
             {
                 solverIt->StartSimulation(deltaTime);
+            }
+        }
+
+        for (auto& solverIt : m_solvers)
+        {
+            if (!solverIt->IsUserSimulated())
+            {
                 solverIt->FinishSimulation();
             }
         }
@@ -425,6 +433,16 @@ namespace NvCloth
         [[maybe_unused]] ISolver* solver = FindOrCreateSolver(DefaultSolverName);
         AZ_Assert(solver, "Error: Default solver failed to be created");
 
+        // Create the solvers of the simulation levels of detail.
+        for (AZ::u32 lodLevel = 1; lodLevel < SimulationLodCount; ++lodLevel)
+        {
+            if (ISolver* lodSolver = FindOrCreateSolver(SimulationLodSolverNames[lodLevel]))
+            {
+                // Offsets the levels so their simulations don't happen on the same frames.
+                lodSolver->SetSimulationInterval(1u << lodLevel, (1u << (lodLevel - 1)) - 1);
+            }
+        }
+
         AZ::Interface<IClothSystem>::Register(this);
         AZ::TickBus::Handler::BusConnect();
     }
@@ -274,6 +274,36 @@ namespace UnitTest
         m_solver->FinishSimulation();
     }
 
+    TEST_F(NvClothSystemSolver, Solver_SimulationInterval_SkippedFramesAddedToNextSimulation)
+    {
+        const float deltaTimeSim = 1.0f / 60.0f;
+        const AZ::u32 simulationInterval = 3;
+
+        AZStd::vector<float> simulationDeltaTimes;
+        NvCloth::ISolver::PreSimulationEvent::Handler solverPreSimulationEventHandler(
+            [&simulationDeltaTimes](const AZStd::string&, float deltaTime)
+            {
+                simulationDeltaTimes.push_back(deltaTime);
+            });
+
+        m_solver->ConnectPreSimulationEventHandler(solverPreSimulationEventHandler);
+        m_solver->SetSimulationInterval(simulationInterval, 1);
+        EXPECT_EQ(simulationInterval, m_solver->GetSimulationInterval());
+
+        m_solver->AddCloth(m_cloth.get()); // It needs at least one cloth to simulate
+
+        for (AZ::u32 frame = 0; frame < 1 + 2 * simulationInterval; ++frame)
+        {
+            m_solver->StartSimulation(deltaTimeSim);
+            m_solver->FinishSimulation();
+        }
+
+        // The offset skips the first frame, then the solver simulates every third frame.
+        ASSERT_EQ(2, simulationDeltaTimes.size());
+        EXPECT_NEAR(deltaTimeSim * 2.0f, simulationDeltaTimes[0], Tolerance);
+        EXPECT_NEAR(deltaTimeSim * simulationInterval, simulationDeltaTimes[1], Tolerance);
+    }
+
     TEST_F(NvClothSystemSolver, Solver_StartAndFinishSimulation_SignalsClothSimulationEvents)
     {
         const float deltaTimeSim = 1.0f / 60.0f;
@@ -30,7 +30,12 @@ namespace PhysX
     AZ_CVAR(size_t, physx_heightfieldColliderUpdateRegionSize, 512 * 512, nullptr,
         AZ::ConsoleFunctorFlags::Null,
         "Max size of a heightfield collider update region in heightfield points, used for partitioning updates for faster cancellation. "
-        "Each update will be the largest number of heightfield rows that stays below this total point count threshold.");
+        "Each update will be the largest number of neighboring dirty tiles that stays below this total point count threshold.");
+
+    AZ_CVAR(size_t, physx_heightfieldColliderDirtyTileSize, 64, nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Size in heightfield points of the square tiles that heightfield collider changes are tracked in. "
+        "A change only updates the tiles it overlaps. Applied when a heightfield collider gets recreated.");
 
     // The HeightfieldUpdateJobContext is an extremely simplified way to manage the background update jobs.
     // On any heightfield change, the collider code will cancel any update job that's currently running, wait for it
@@ -79,20 +84,23 @@ namespace PhysX
     }
 
 
-    HeightfieldCollider::DirtyHeightfieldRegion::DirtyHeightfieldRegion()
+    void HeightfieldCollider::DirtyHeightfieldTiles::Reset(size_t numColumnVertices, size_t numRowVertices, size_t tileSize)
     {
-        SetNull();
+        m_tileSize = AZStd::max(tileSize, static_cast<size_t>(1));
+        m_numColumnVertices = numColumnVertices;
+        m_numRowVertices = numRowVertices;
+        m_numTileColumns = (numColumnVertices + m_tileSize - 1) / m_tileSize;
+        m_numTileRows = (numRowVertices + m_tileSize - 1) / m_tileSize;
+        m_dirtyTiles.assign(m_numTileColumns * m_numTileRows, false);
+        m_numDirtyTiles = 0;
     }
 
-    void HeightfieldCollider::DirtyHeightfieldRegion::SetNull()
+    bool HeightfieldCollider::DirtyHeightfieldTiles::MatchesSize(size_t numColumnVertices, size_t numRowVertices) const
     {
-        m_minRowVertex = AZStd::numeric_limits<size_t>::max();
-        m_minColumnVertex = AZStd::numeric_limits<size_t>::max();
-        m_maxRowVertex = AZStd::numeric_limits<size_t>::lowest();
-        m_maxColumnVertex = AZStd::numeric_limits<size_t>::lowest();
+        return (m_numColumnVertices == numColumnVertices) && (m_numRowVertices == numRowVertices);
     }
 
-    void HeightfieldCollider::DirtyHeightfieldRegion::AddAabb(const AZ::Aabb& dirtyRegion, AZ::EntityId entityId)
+    void HeightfieldCollider::DirtyHeightfieldTiles::AddAabb(const AZ::Aabb& dirtyRegion, AZ::EntityId entityId)
     {
         size_t startRowVertex = 0;
         size_t startColumnVertex = 0;
@@ -108,14 +116,103 @@ namespace PhysX
             numColumnVertices,
             numRowVertices);
 
-        m_minRowVertex = AZStd::min(m_minRowVertex, startRowVertex);
-        m_minColumnVertex = AZStd::min(m_minColumnVertex, startColumnVertex);
-        // Note that if the heightfield size has decreased, these numbers can end up larger than the total current heightfield size.
-        m_maxRowVertex = AZStd::max(m_maxRowVertex, startRowVertex + numRowVertices);
-        m_maxColumnVertex = AZStd::max(m_maxColumnVertex, startColumnVertex + numColumnVertices);
+        // The region can reach past the heightfield if its size has changed without the tiles being reset yet.
+        const size_t endColumnVertex = AZStd::min(startColumnVertex + numColumnVertices, m_numColumnVertices);
+        const size_t endRowVertex = AZStd::min(startRowVertex + numRowVertices, m_numRowVertices);
+        if ((startColumnVertex >= endColumnVertex) || (startRowVertex >= endRowVertex))
+        {
+            return;
+        }
+
+        for (size_t tileRow = startRowVertex / m_tileSize; tileRow <= (endRowVertex - 1) / m_tileSize; tileRow++)
+        {
+            for (size_t tileColumn = startColumnVertex / m_tileSize; tileColumn <= (endColumnVertex - 1) / m_tileSize; tileColumn++)
+            {
+                SetTileDirty(tileColumn, tileRow, true);
+            }
+        }
     }
 
+    void HeightfieldCollider::DirtyHeightfieldTiles::AddAll()
+    {
+        m_dirtyTiles.assign(m_dirtyTiles.size(), true);
+        m_numDirtyTiles = m_dirtyTiles.size();
+    }
+
+    void HeightfieldCollider::DirtyHeightfieldTiles::ClearRegion(size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
+    {
+        if ((numColumns == 0) || (numRows == 0))
+        {
+            return;
+        }
+
+        // Only the tiles completely inside the region are clean now.
+        const size_t endTileColumn = AZStd::min((startColumn + numColumns) / m_tileSize +
+            (startColumn + numColumns >= m_numColumnVertices ? 1 : 0), m_numTileColumns);
+        const size_t endTileRow = AZStd::min((startRow + numRows) / m_tileSize +
+            (startRow + numRows >= m_numRowVertices ? 1 : 0), m_numTileRows);
+        for (size_t tileRow = (startRow + m_tileSize - 1) / m_tileSize; tileRow < endTileRow; tileRow++)
+        {
+            for (size_t tileColumn = (startColumn + m_tileSize - 1) / m_tileSize; tileColumn < endTileColumn; tileColumn++)
+            {
+                SetTileDirty(tileColumn, tileRow, false);
+            }
+        }
+    }
+
+    void HeightfieldCollider::DirtyHeightfieldTiles::ClearAll()
+    {
+        m_dirtyTiles.assign(m_dirtyTiles.size(), false);
+        m_numDirtyTiles = 0;
+    }
+
+    void HeightfieldCollider::DirtyHeightfieldTiles::GetDirtyRegions(AZStd::vector<Region>& regions, size_t maxVerticesPerRegion) const
+    {
+        regions.clear();
+        if (IsEmpty())
+        {
+            return;
+        }
+
+        const size_t maxTilesPerRegion = AZStd::max(maxVerticesPerRegion / (m_tileSize * m_tileSize), static_cast<size_t>(1));
 
+        // Neighboring dirty tiles of a tile row are merged into one region, so the updates stay large enough to be efficient
+        for (size_t tileRow = 0; tileRow < m_numTileRows; tileRow++)
+        {
+            size_t tileColumn = 0;
+            while (tileColumn < m_numTileColumns)
+            {
+                if (!m_dirtyTiles[tileRow * m_numTileColumns + tileColumn])
+                {
+                    tileColumn++;
+                    continue;
+                }
+
+                const size_t startTileColumn = tileColumn;
+                while ((tileColumn < m_numTileColumns) && m_dirtyTiles[tileRow * m_numTileColumns + tileColumn] &&
+                    (tileColumn - startTileColumn < maxTilesPerRegion))
+                {
+                    tileColumn++;
+                }
+
+                Region& region = regions.emplace_back();
+                region.m_startColumn = startTileColumn * m_tileSize;
+                region.m_startRow = tileRow * m_tileSize;
+                region.m_numColumns = AZStd::min(tileColumn * m_tileSize, m_numColumnVertices) - region.m_startColumn;
+                region.m_numRows = AZStd::min((tileRow + 1) * m_tileSize, m_numRowVertices) - region.m_startRow;
+            }
+        }
+    }
+
+    void HeightfieldCollider::DirtyHeightfieldTiles::SetTileDirty(size_t tileColumn, size_t tileRow, bool dirty)
+    {
+        const size_t tileIndex = tileRow * m_numTileColumns + tileColumn;
+        if (m_dirtyTiles[tileIndex] != dirty)
+        {
+            m_dirtyTiles[tileIndex] = dirty;
+            m_numDirtyTiles = dirty ? m_numDirtyTiles + 1 : m_numDirtyTiles - 1;
+        }
+    }
 
     HeightfieldCollider::HeightfieldCollider(
         AZ::EntityId entityId,
@@ -239,7 +336,7 @@ namespace PhysX
         InitStaticRigidBody(baseTransform);
     }
     
-    void HeightfieldCollider::UpdateShapeConfigRows(
+    void HeightfieldCollider::UpdateShapeConfigRegion(
         AZ::Job* updateCompleteJob, size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
     {
         // This method is called by an update job to update a portion of the heightfield shape configuration to contain the latest
@@ -280,7 +377,7 @@ namespace PhysX
         }
     }
 
-    void HeightfieldCollider::UpdatePhysXHeightfieldRows(
+    void HeightfieldCollider::UpdatePhysXHeightfieldRegion(
         AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape,
         size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
     {
@@ -294,13 +391,11 @@ namespace PhysX
             // heightfield has no thread safety protections and modifies min/max height data global to the heightfield on every refresh.
             Utils::RefreshHeightfieldShape(scene, &(*shape), *m_shapeConfig, startColumn, startRow, numColumns, numRows);
 
-            // Reduce our dirty region by the number of rows that we're processing in this piece of the update job chain.
-            // We've updated both the shape configuration and the PhysX heightfield at this point, so those rows have completed
-            // their update. Even if we cancel the job at this point, we'll only need to reprocess these rows if data in those rows
-            // have changed.
-            // This dirty region logic assumes that we're updating all dirty columns for a row on every call. If this assumption
-            // ever changes, we'll need more complicated dirty region logic to track which columns in each row are dirty.
-            m_dirtyRegion.m_minRowVertex = startRow + numRows;
+            // Mark the tiles of the region that we're processing in this piece of the update job chain as clean.
+            // We've updated both the shape configuration and the PhysX heightfield at this point, so those tiles have completed
+            // their update. Even if we cancel the job at this point, we'll only need to reprocess these tiles if their data
+            // has changed.
+            m_dirtyTiles.ClearRegion(startColumn, startRow, numColumns, numRows);
         }
     }
 
@@ -311,7 +406,7 @@ namespace PhysX
         // If the job hasn't been canceled, notify any listeners that the collider has changed.
         if (!m_jobContext->IsCanceled())
         {
-            m_dirtyRegion.SetNull();
+            m_dirtyTiles.ClearAll();
             Physics::ColliderComponentEventBus::Event(m_entityId, &Physics::ColliderComponentEvents::OnColliderChanged);
         }
 
@@ -375,9 +470,9 @@ namespace PhysX
         // Resize: we need to cancel any running jobs, wait for them to finish, resize the area, and kick them off again.
         //   PhysX heightfields need to have a static number of points, so a resize requires a complete rebuild of the heightfield.
         // Update: technically, we could get more clever with updates, and potentially keep the same job chain running with a running list
-        //   of update regions. But for now, we're keeping it simple. Our update job will update in multiples of heightfield rows so
-        //   that we can incrementally shrink the update region as we finish updating pieces of it and cancel at a more granular level.
-        //   On a new update, we can then cancel the job, grow our update region as needed, and start the job chain back up again.
+        //   of update regions. But for now, we're keeping it simple. Our update job will update the dirty tiles in pieces so
+        //   that we can incrementally clear the dirty tiles as we finish updating pieces of them and cancel at a more granular level.
+        //   On a new update, we can then cancel the job, mark the newly dirty tiles, and start the job chain back up again.
 
         // If we don't have a shape configuration yet, or if the configuration itself changed, we need to recreate the entire heightfield.
         bool shouldRecreateHeightfield = (m_shapeConfig == nullptr) ||
@@ -428,26 +523,23 @@ namespace PhysX
             InitStaticRigidBody();
         }
 
-        // Add the new request region to our dirty heightfield region
-        m_dirtyRegion.AddAabb(requestRegion, m_entityId);
-
-        AZ_Assert(m_dirtyRegion.m_maxRowVertex >= m_dirtyRegion.m_minRowVertex,
-            "Invalid dirty region (min=%zu max=%zu)", m_dirtyRegion.m_minRowVertex, m_dirtyRegion.m_maxRowVertex);
-
-        AZ_Assert(m_dirtyRegion.m_maxColumnVertex >= m_dirtyRegion.m_minColumnVertex,
-            "Invalid dirty region (min=%zu max=%zu)", m_dirtyRegion.m_maxColumnVertex, m_dirtyRegion.m_minColumnVertex);
-
-        // If our heightfield size has just shrunk and we had a pre-existing dirty region, the max vertex values could be higher than
-        // our current size, so clamp them to the current size.
-        m_dirtyRegion.m_maxRowVertex = AZStd::min(m_dirtyRegion.m_maxRowVertex, m_shapeConfig->GetNumRowVertices());
-        m_dirtyRegion.m_maxColumnVertex = AZStd::min(m_dirtyRegion.m_maxColumnVertex, m_shapeConfig->GetNumColumnVertices());
-
-        size_t startColumn = m_dirtyRegion.m_minColumnVertex;
-        size_t numColumns = m_dirtyRegion.m_maxColumnVertex - m_dirtyRegion.m_minColumnVertex;
-        size_t numRows = m_dirtyRegion.m_maxRowVertex - m_dirtyRegion.m_minRowVertex;
+        // A recreated heightfield has no data yet, so all of it needs to get updated.
+        // The tiles also get reset if the size changed while the heightfield was kept, like for a cached heightfield.
+        const size_t numColumnVertices = m_shapeConfig->GetNumColumnVertices();
+        const size_t numRowVertices = m_shapeConfig->GetNumRowVertices();
+        if (shouldRecreateHeightfield || !m_dirtyTiles.MatchesSize(numColumnVertices, numRowVertices))
+        {
+            m_dirtyTiles.Reset(numColumnVertices, numRowVertices, physx_heightfieldColliderDirtyTileSize);
+            m_dirtyTiles.AddAll();
+        }
+        else
+        {
+            // Add the new request region to our dirty heightfield tiles
+            m_dirtyTiles.AddAabb(requestRegion, m_entityId);
+        }
 
         // If our dirty region is too small to affect any vertices, early-out.
-        if ((numRows == 0) || (numColumns == 0))
+        if (m_dirtyTiles.IsEmpty())
         {
             return;
         }
@@ -457,10 +549,11 @@ namespace PhysX
 
         auto shape = GetHeightfieldShape();
 
-        // Get the number of rows to update in each job. We subdivide the region into multiple jobs when processing
-        // so that cancellation requests can be detected and processed more quickly. If we just processed a single full dirty region,
+        // Get the regions to update in each job. We subdivide the dirty tiles into multiple jobs when processing
+        // so that cancellation requests can be detected and processed more quickly. If we just processed all the dirty tiles at once,
         // regardless of size, there would be a lot more work that needs to complete before we could cancel a job.
-        const size_t rowsPerUpdate = AZStd::max(physx_heightfieldColliderUpdateRegionSize / numColumns, static_cast<size_t>(1));
+        AZStd::vector<DirtyHeightfieldTiles::Region> dirtyRegions;
+        m_dirtyTiles.GetDirtyRegions(dirtyRegions, physx_heightfieldColliderUpdateRegionSize);
 
         AZStd::vector<AZ::Job*> updateShapeConfigJobs;
         AZStd::vector<AZ::MultipleDependentJob*> updateShapeConfigCompleteJobs;
@@ -471,7 +564,7 @@ namespace PhysX
         // The work for refreshing a heightfield is broken up into a series of jobs designed to maximize parallelization, avoid jobs
         // blocking on other jobs, and to respond to cancellation requests reasonably quickly.
         // 
-        // For each block of rows being processed we do the following:
+        // For each region of dirty tiles being processed we do the following:
         // UpdateShapeConfigJob -> (UpdateHeightsAndMaterialsAsync) -> UpdateShapeConfigCompleteJob -> UpdatePhysXHeightfieldJob
         // i.e. we update the shape configuration, then we update the PhysX Heightfield
         // The final UpdatePhysXHeightfieldJob triggers the RefreshCompleteJob to signify that all the work is completed.
@@ -491,23 +584,20 @@ namespace PhysX
         // to avoid threading update problems, and the UpdatePhysXHeightfield step can't run until the UpdateShapeConfig step it depends
         // on is complete.
 
-        for (size_t row = 0; row < numRows; row += rowsPerUpdate)
+        for (const DirtyHeightfieldTiles::Region& region : dirtyRegions)
         {
-            size_t startRow = m_dirtyRegion.m_minRowVertex + row;
-            size_t subregionRows = AZStd::min(m_dirtyRegion.m_maxRowVertex - startRow, rowsPerUpdate);
-
-            // Create the jobs for this set of rows
+            // Create the jobs for this region
 
             auto* updateShapeConfigCompleteJob = aznew AZ::MultipleDependentJob(autoDelete, m_jobContext.get());
 
             auto* updateShapeConfigJob = AZ::CreateJobFunction(
-                AZStd::bind(&HeightfieldCollider::UpdateShapeConfigRows,
-                    this, updateShapeConfigCompleteJob, startColumn, startRow, numColumns, subregionRows),
+                AZStd::bind(&HeightfieldCollider::UpdateShapeConfigRegion,
+                    this, updateShapeConfigCompleteJob, region.m_startColumn, region.m_startRow, region.m_numColumns, region.m_numRows),
                     autoDelete, m_jobContext.get());
 
             auto* updatePhysXHeightfieldJob = AZ::CreateJobFunction(
-                AZStd::bind(&HeightfieldCollider::UpdatePhysXHeightfieldRows,
-                    this, scene, shape, startColumn, startRow, numColumns, subregionRows),
+                AZStd::bind(&HeightfieldCollider::UpdatePhysXHeightfieldRegion,
+                    this, scene, shape, region.m_startColumn, region.m_startRow, region.m_numColumns, region.m_numRows),
                     autoDelete, m_jobContext.get());
 
             // Set up the dependencies:
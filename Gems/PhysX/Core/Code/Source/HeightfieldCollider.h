@@ -104,14 +104,13 @@ namespace PhysX
         void UpdateHeightfieldMaterialSlots(const Physics::MaterialSlots& updatedMaterialSlots);
 
     private:
-        //! Updates a subset of rows in the heightfield shape configuration.
-        void UpdateShapeConfigRows(
+        //! Updates a region of the heightfield shape configuration.
+        void UpdateShapeConfigRegion(
             AZ::Job* updateCompleteJob, size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
 
-        //! Updates a subset of rows in the PhysX heightfield based on the data in the heightfield shape configuration.
-        //! Note that while this takes in column ranges, the expectation is that it is processing all the dirty columns for each
-        //! row being updated. If this assumption changes, the dirty region tracking logic will also need to change.
-        void UpdatePhysXHeightfieldRows(
+        //! Updates a region of the PhysX heightfield based on the data in the heightfield shape configuration.
+        //! The region is expected to cover whole dirty tiles, which are marked as clean once it has been updated.
+        void UpdatePhysXHeightfieldRegion(
             AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape,
             size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
 
@@ -178,20 +177,46 @@ namespace PhysX
         //! Cached entity name for the entity this collider is attached to.
         AZStd::string m_entityName;
 
-        //! Track the current dirty region for async heightfield refreshes.
-        struct DirtyHeightfieldRegion
+        //! Track the dirty parts of the heightfield for async heightfield refreshes.
+        //! The heightfield is split in square tiles of vertices, so separate changes only update the tiles they touch
+        //! instead of the whole area around them.
+        struct DirtyHeightfieldTiles
         {
-            DirtyHeightfieldRegion();
-            void SetNull();
+            //! A rectangle of vertices covering one or more neighboring dirty tiles of a tile row.
+            struct Region
+            {
+                size_t m_startColumn = 0;
+                size_t m_startRow = 0;
+                size_t m_numColumns = 0;
+                size_t m_numRows = 0;
+            };
+
+            //! Sets up the tiles for a heightfield of the given size, with all the tiles clean.
+            void Reset(size_t numColumnVertices, size_t numRowVertices, size_t tileSize);
+            //! Returns true if the tiles were set up for a heightfield of the given size.
+            bool MatchesSize(size_t numColumnVertices, size_t numRowVertices) const;
             void AddAabb(const AZ::Aabb& dirtyRegion, AZ::EntityId entityId);
+            void AddAll();
+            //! Marks the tiles inside the vertex region as clean.
+            void ClearRegion(size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
+            void ClearAll();
+            bool IsEmpty() const { return m_numDirtyTiles == 0; }
+            //! Gets the regions to update, made of at most maxVerticesPerRegion vertices unless a single tile is larger.
+            void GetDirtyRegions(AZStd::vector<Region>& regions, size_t maxVerticesPerRegion) const;
 
-            size_t m_minRowVertex;      //! the first dirty row vertex
-            size_t m_minColumnVertex;   //! the first dirty column vertex
-            size_t m_maxRowVertex;      //! one past the last dirty row vertex (i.e. max - min = num dirty)
-            size_t m_maxColumnVertex;   //! one past the last dirty column vertex
+        private:
+            void SetTileDirty(size_t tileColumn, size_t tileRow, bool dirty);
+
+            size_t m_tileSize = 1;
+            size_t m_numColumnVertices = 0;
+            size_t m_numRowVertices = 0;
+            size_t m_numTileColumns = 0;
+            size_t m_numTileRows = 0;
+            size_t m_numDirtyTiles = 0;
+            AZStd::vector<bool> m_dirtyTiles; //! Row-major dirty state of each tile
         };
 
-        DirtyHeightfieldRegion m_dirtyRegion;
+        DirtyHeightfieldTiles m_dirtyTiles;
         
         //! Specifies the way of creating Heightfield Collider.
         DataSource m_dataSourceType = DataSource::GenerateNewHeightfield;
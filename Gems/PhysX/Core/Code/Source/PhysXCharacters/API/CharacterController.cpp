@@ -635,29 +635,42 @@ namespace PhysX
     {
         if (m_pxController)
         {
-            const AZ::Vector3 oldPosition = GetBasePosition();
-            {
-                PHYSX_SCENE_WRITE_LOCK(m_pxController->getScene());
-                m_pxController->move(PxMathConvert(requestedMovement), m_minimumMovementDistance, deltaTime, m_pxControllerFilters);
-                if (m_shadowBody)
-                {
-                    m_shadowBody->SetKinematicTarget(GetTransform());
-                }
-            }
-            const AZ::Vector3 newPosition = GetBasePosition();
-            m_observedVelocity = deltaTime > 0.0f ? (newPosition - oldPosition) / deltaTime : AZ::Vector3::CreateZero();
+            PHYSX_SCENE_WRITE_LOCK(m_pxController->getScene());
+            MoveWithSceneLocked(requestedMovement, deltaTime);
         }
     }
 
-    void CharacterController::ApplyRequestedVelocity(float deltaTime)
+    physx::PxControllerCollisionFlags CharacterController::MoveWithSceneLocked(const AZ::Vector3& requestedMovement, float deltaTime)
+    {
+        if (!m_pxController)
+        {
+            return {};
+        }
+
+        const AZ::Vector3 oldPosition = GetBasePosition();
+        const physx::PxControllerCollisionFlags collisionFlags =
+            m_pxController->move(PxMathConvert(requestedMovement), m_minimumMovementDistance, deltaTime, m_pxControllerFilters);
+        if (m_shadowBody)
+        {
+            m_shadowBody->SetKinematicTarget(GetTransform());
+        }
+        const AZ::Vector3 newPosition = GetBasePosition();
+        m_observedVelocity = deltaTime > 0.0f ? (newPosition - oldPosition) / deltaTime : AZ::Vector3::CreateZero();
+        return collisionFlags;
+    }
+
+    AZ::Vector3 CharacterController::GetRequestedMovement(float deltaTime) const
     {
         const AZ::Vector3 totalRequestedVelocity = m_requestedVelocityForTick + m_requestedVelocityForPhysicsTimestep;
         const AZ::Vector3 clampedVelocity = totalRequestedVelocity.GetLength() > m_maximumSpeed
             ? m_maximumSpeed * totalRequestedVelocity.GetNormalized()
             : totalRequestedVelocity;
-        const AZ::Vector3 deltaPosition = clampedVelocity * deltaTime;
+        return clampedVelocity * deltaTime;
+    }
 
-        Move(deltaPosition, deltaTime);
+    void CharacterController::ApplyRequestedVelocity(float deltaTime)
+    {
+        Move(GetRequestedMovement(deltaTime), deltaTime);
     }
 
     void CharacterController::SetRotation(const AZ::Quaternion& rotation)
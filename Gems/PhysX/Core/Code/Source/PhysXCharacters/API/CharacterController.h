@@ -232,6 +232,13 @@ namespace PhysX
         float GetHalfForwardExtent() const;
         void SetHalfForwardExtent(float halfForwardExtent);
 
+        //! Returns the movement for the time step from the velocity requested for the tick and the physics timestep,
+        //! clamped to the maximum speed. This is the movement ApplyRequestedVelocity applies.
+        AZ::Vector3 GetRequestedMovement(float deltaTime) const;
+        //! Same as Move, for callers which move many controllers and locked the scene for write once for all of them.
+        //! @return The collision flags reported by PhysX for the move.
+        physx::PxControllerCollisionFlags MoveWithSceneLocked(const AZ::Vector3& requestedMovement, float deltaTime);
+
     private:
         void SetFilterDataAndShape(const Physics::CharacterConfiguration& characterConfig);
         void SetUserData(const Physics::CharacterConfiguration& characterConfig);
@@ -6,12 +6,16 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/SystemBus.h>
+#include <AzFramework/Components/CameraBus.h>
 #include <PhysXCharacters/API/Ragdoll.h>
 #include <PhysXCharacters/API/CharacterUtils.h>
 #include <PhysX/NativeTypeIdentifiers.h>
@@ -21,6 +25,15 @@
 
 namespace PhysX
 {
+    AZ_CVAR(float, physx_ragdollSleepThreshold, 0.05f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Minimum mass-normalized kinetic energy below which simulated ragdoll nodes may go to sleep.");
+    AZ_CVAR(float, physx_ragdollFreezeDelay, 2.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Seconds all nodes of a ragdoll need to be asleep before it is frozen in its pose. 0 disables freezing.");
+    AZ_CVAR(float, physx_ragdollLodDistance, 30.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance from the active camera beyond which ragdolls are simulated with reduced solver iterations. 0 disables the LOD.");
+    AZ_CVAR(uint32_t, physx_ragdollLodSolverIterations, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Position solver iterations of ragdolls beyond physx_ragdollLodDistance.");
+
     namespace Internal
     {
         physx::PxScene* GetPxScene(AzPhysics::SceneHandle sceneHandle)
@@ -100,9 +113,11 @@ namespace PhysX
             [[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
             [[maybe_unused]] float fixedDeltaTime)
             {
+                AZ_PROFILE_SCOPE(Physics, "Ragdoll::OnSceneSimulationStart (%zu nodes)", m_nodes.size());
                 this->ApplyQueuedEnableSimulation();
                 this->ApplyQueuedSetState();
                 this->ApplyQueuedDisableSimulation();
+                this->UpdateSimulationLod(fixedDeltaTime);
             })
     {
         m_sceneOwner = sceneHandle;
@@ -150,6 +165,115 @@ namespace PhysX
         m_queuedDisableSimulation = false;
     }
 
+    void Ragdoll::UpdateSimulationLod(float deltaTime)
+    {
+        if (!m_simulating || m_nodes.empty())
+        {
+            return;
+        }
+
+        const float lodDistance = physx_ragdollLodDistance;
+        if (lodDistance > 0.0f && m_rootIndex && m_rootIndex.GetValue() < m_nodes.size())
+        {
+            const AZ::Transform* cameraTransform = nullptr;
+            Camera::ActiveCameraRequestBus::BroadcastResult(cameraTransform, &Camera::ActiveCameraRequests::GetActiveCameraTransform);
+            if (cameraTransform)
+            {
+                const AZ::Vector3 rootPosition = PxMathConvert(GetRootPxTransform().p);
+                const bool isDistant = rootPosition.GetDistanceSq(cameraTransform->GetTranslation()) > lodDistance * lodDistance;
+                if (isDistant != m_reducedSolverIterations)
+                {
+                    SetReducedSolverIterations(isDistant);
+                }
+            }
+        }
+        else if (m_reducedSolverIterations)
+        {
+            SetReducedSolverIterations(false);
+        }
+
+        const float freezeDelay = physx_ragdollFreezeDelay;
+        if (m_frozen || !m_canFreeze || freezeDelay <= 0.0f)
+        {
+            m_settledTime = 0.0f;
+            return;
+        }
+
+        bool allNodesAsleep = true;
+        {
+            PHYSX_SCENE_READ_LOCK(Internal::GetPxScene(m_sceneOwner));
+            for (size_t nodeIndex = 0; nodeIndex < m_nodes.size() && allNodesAsleep; nodeIndex++)
+            {
+                const physx::PxRigidDynamic* pxActor = GetPxRigidDynamic(nodeIndex);
+                allNodesAsleep = pxActor && pxActor->isSleeping();
+            }
+        }
+
+        m_settledTime = allNodesAsleep ? m_settledTime + deltaTime : 0.0f;
+        if (m_settledTime >= freezeDelay)
+        {
+            Freeze();
+        }
+    }
+
+    void Ragdoll::Freeze()
+    {
+        PHYSX_SCENE_WRITE_LOCK(Internal::GetPxScene(m_sceneOwner));
+        for (size_t nodeIndex = 0; nodeIndex < m_nodes.size(); nodeIndex++)
+        {
+            if (physx::PxRigidDynamic* pxActor = GetPxRigidDynamic(nodeIndex))
+            {
+                pxActor->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
+            }
+        }
+        m_frozen = true;
+        m_settledTime = 0.0f;
+    }
+
+    void Ragdoll::Unfreeze()
+    {
+        PHYSX_SCENE_WRITE_LOCK(Internal::GetPxScene(m_sceneOwner));
+        for (size_t nodeIndex = 0; nodeIndex < m_nodes.size(); nodeIndex++)
+        {
+            if (physx::PxRigidDynamic* pxActor = GetPxRigidDynamic(nodeIndex))
+            {
+                pxActor->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, false);
+                if (pxActor->getScene())
+                {
+                    pxActor->wakeUp();
+                }
+            }
+        }
+        m_frozen = false;
+    }
+
+    void Ragdoll::SetReducedSolverIterations(bool reduced)
+    {
+        if (m_solverIterationCounts.size() != m_nodes.size())
+        {
+            return;
+        }
+
+        const physx::PxU32 reducedPositionIterations = AZStd::max(static_cast<physx::PxU32>(physx_ragdollLodSolverIterations), 1u);
+        PHYSX_SCENE_WRITE_LOCK(Internal::GetPxScene(m_sceneOwner));
+        for (size_t nodeIndex = 0; nodeIndex < m_nodes.size(); nodeIndex++)
+        {
+            if (physx::PxRigidDynamic* pxActor = GetPxRigidDynamic(nodeIndex))
+            {
+                const auto& [positionIterations, velocityIterations] = m_solverIterationCounts[nodeIndex];
+                if (reduced)
+                {
+                    pxActor->setSolverIterationCounts(AZStd::min(positionIterations, reducedPositionIterations), AZStd::min(velocityIterations, 1u));
+                }
+                else
+                {
+                    pxActor->setSolverIterationCounts(positionIterations, velocityIterations);
+                }
+            }
+        }
+        m_reducedSolverIterations = reduced;
+    }
+
     // Physics::Ragdoll
     void Ragdoll::EnableSimulation(const Physics::RagdollState& initialState)
     {
@@ -183,11 +307,17 @@ namespace PhysX
 
         PHYSX_SCENE_WRITE_LOCK(pxScene);
 
+        m_solverIterationCounts.resize(numNodes);
+        const float sleepThreshold = physx_ragdollSleepThreshold;
         for (size_t nodeIndex = 0; nodeIndex < numNodes; nodeIndex++)
         {
             physx::PxRigidDynamic* pxActor = GetPxRigidDynamic(nodeIndex);
             if (pxActor)
             {
+                pxActor->getSolverIterationCounts(m_solverIterationCounts[nodeIndex].first, m_solverIterationCounts[nodeIndex].second);
+                // Ragdolls settle slowly with many jointed bodies, let them sleep earlier than the configured threshold
+                pxActor->setSleepThreshold(AZStd::max(pxActor->getSleepThreshold(), sleepThreshold));
+
                 const Physics::RagdollNodeState& nodeState = initialState[nodeIndex];
                 physx::PxTransform pxTm(PxMathConvert(nodeState.m_position), PxMathConvert(nodeState.m_orientation));
                 pxActor->setGlobalPose(pxTm);
@@ -241,6 +371,17 @@ namespace PhysX
         physx::PxScene* pxScene = Internal::GetPxScene(m_sceneOwner);
         const size_t numNodes = m_nodes.size();
 
+        if (m_frozen)
+        {
+            Unfreeze();
+        }
+        if (m_reducedSolverIterations)
+        {
+            SetReducedSolverIterations(false);
+        }
+        m_settledTime = 0.0f;
+        m_canFreeze = false;
+
         PHYSX_SCENE_WRITE_LOCK(pxScene);
 
         for (size_t nodeIndex = 0; nodeIndex < numNodes; nodeIndex++)
@@ -291,6 +432,21 @@ namespace PhysX
             return;
         }
 
+        // Only ragdolls without animated or powered nodes come to rest, the others follow the animation
+        m_canFreeze = AZStd::all_of(ragdollState.begin(), ragdollState.end(), [](const Physics::RagdollNodeState& nodeState)
+            {
+                return nodeState.m_simulationType == Physics::SimulationType::Simulated && nodeState.m_strength <= 0.0f;
+            });
+        if (m_frozen)
+        {
+            if (m_canFreeze)
+            {
+                // Nothing to apply to the settled pose
+                return;
+            }
+            Unfreeze();
+        }
+
         const size_t numNodes = m_nodes.size();
         for (size_t nodeIndex = 0; nodeIndex < numNodes; nodeIndex++)
         {
@@ -362,11 +518,24 @@ namespace PhysX
                     float forceLimit = std::numeric_limits<float>::max();
                     physx::PxD6JointDrive jointDrive = Utils::Characters::CreateD6JointDrive(nodeState.m_strength,
                         nodeState.m_dampingRatio, forceLimit);
-                    pxJoint->setDrive(physx::PxD6Drive::eSWING, jointDrive);
-                    pxJoint->setDrive(physx::PxD6Drive::eTWIST, jointDrive);
+                    const physx::PxD6JointDrive currentDrive = pxJoint->getDrive(physx::PxD6Drive::eSWING);
+                    const bool driveChanged = currentDrive.stiffness != jointDrive.stiffness || currentDrive.damping != jointDrive.damping;
+                    if (driveChanged)
+                    {
+                        pxJoint->setDrive(physx::PxD6Drive::eSWING, jointDrive);
+                        pxJoint->setDrive(physx::PxD6Drive::eTWIST, jointDrive);
+                    }
+
+                    // Setting the drive position wakes the bodies, so unchanged targets are skipped to let settled ragdolls sleep
                     physx::PxQuat targetRotation = pxJoint->getLocalPose(physx::PxJointActorIndex::eACTOR0).q.getConjugate() *
                         PxMathConvert(nodeState.m_orientation) * pxJoint->getLocalPose(physx::PxJointActorIndex::eACTOR1).q;
-                    pxJoint->setDrivePosition(physx::PxTransform(targetRotation));
+                    const physx::PxQuat currentTargetRotation = pxJoint->getDrivePosition().q;
+                    constexpr float targetRotationTolerance = 1e-6f;
+                    const bool targetChanged = (1.0f - physx::PxAbs(currentTargetRotation.dot(targetRotation))) > targetRotationTolerance;
+                    if (driveChanged || (jointDrive.stiffness > 0.0f && targetChanged))
+                    {
+                        pxJoint->setDrivePosition(physx::PxTransform(targetRotation));
+                    }
                 }
             }
         }
@@ -69,6 +69,14 @@ namespace PhysX
         void ApplyQueuedSetState();
         void ApplyQueuedDisableSimulation();
 
+        /// Updates the distance LOD and the frozen state of a simulated ragdoll, prior to the world update.
+        void UpdateSimulationLod(float deltaTime);
+        /// Switches the settled nodes to kinematic so they keep their pose and collision without being simulated.
+        void Freeze();
+        void Unfreeze();
+        /// Sets reduced solver iterations on all nodes when the ragdoll is far from the camera, or restores the configured ones.
+        void SetReducedSolverIterations(bool reduced);
+
         AZStd::vector<AZStd::unique_ptr<RagdollNode>> m_nodes;
         Physics::ParentIndices m_parentIndices;
         AZ::Outcome<size_t> m_rootIndex = AZ::Failure();
@@ -80,6 +88,17 @@ namespace PhysX
         /// Used to track whether a call to DisableSimulation has been queued.
         bool m_queuedDisableSimulation = false;
 
+        /// Configured position and velocity solver iterations of each node, restored when the ragdoll leaves the reduced LOD.
+        AZStd::vector<AZStd::pair<physx::PxU32, physx::PxU32>> m_solverIterationCounts;
+        /// Time all the nodes have been asleep for.
+        float m_settledTime = 0.0f;
+        /// True if the last state set on the ragdoll lets it freeze once settled, which is only the case if no node follows the animation.
+        bool m_canFreeze = false;
+        /// True if the settled nodes were switched to kinematic.
+        bool m_frozen = false;
+        /// True if the nodes run the reduced solver iterations of distant ragdolls.
+        bool m_reducedSolverIterations = false;
+
         AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneStartSimHandler;
     };
 } // namespace PhysX
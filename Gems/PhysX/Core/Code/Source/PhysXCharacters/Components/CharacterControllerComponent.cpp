@@ -480,7 +480,15 @@ namespace PhysX
     {
         if (auto* controller = GetController())
         {
-            controller->ApplyRequestedVelocity(physicsTimestep);
+            // The scene moves all the queued characters together once every simulation start handler ran
+            if (auto* scene = azdynamic_cast<PhysXScene*>(controller->GetScene()))
+            {
+                scene->QueueCharacterMove({ m_controllerBodyHandle, controller->GetRequestedMovement(physicsTimestep), physicsTimestep });
+            }
+            else
+            {
+                controller->ApplyRequestedVelocity(physicsTimestep);
+            }
             controller->ResetRequestedVelocityForPhysicsTimestep();
         }
     }
@@ -28,7 +28,9 @@
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Physics/Character.h>
@@ -42,12 +44,32 @@
 namespace PhysX
 {
     AZ_CVAR_EXTERNED(bool, physx_batchTransformSync);
+    AZ_CVAR_EXTERNED(bool, physx_deterministicSimulation);
 
     AZ_CVAR(bool, physx_parallelTransformSync, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Multithreaded transform update for rigid bodies. "
         "Only relevant if batched transform update is enabled.");
     AZ_CVAR(size_t, physx_parallelTransformSyncBatchSize, 250, nullptr, AZ::ConsoleFunctorFlags::Null,
         "How many rigid bodies should be processed per task");
 
+    AZ_CVAR(AZ::u32, physx_sceneShardCount, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of PhysX scenes the rigid bodies of a physics scene are split across, in slabs along the world X axis. "
+        "The shards are stepped in parallel and the bodies move between them when they cross a boundary. Bodies in different "
+        "shards don't collide, so this is meant for large worlds with mostly separate bodies. Rigid bodies with joints, characters, "
+        "ragdolls and articulations stay in the first shard, static bodies collide in all shards. Read when a scene is created.");
+    AZ_CVAR(float, physx_sceneShardSize, 512.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Width in meters of each scene shard along the world X axis, the shards are centered around the origin");
+    AZ_CVAR(float, physx_sceneShardHysteresis, 2.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance in meters a rigid body needs to be past a shard boundary before it moves to the next shard");
+
+    AZ_CVAR(bool, physx_parallelBatchQueries, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Run the requests of batched scene queries in parallel tasks, grouped by the location of the queries");
+    AZ_CVAR(size_t, physx_batchQueryTaskSize, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How many requests of a batched scene query each task runs. Batches with fewer requests run on the calling thread");
+
+    AZ_CVAR(AZ::u32, physx_stateSnapshotCount, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of rigid body state snapshots each physics scene keeps for rolling back the simulation. "
+        "A change applies to the next snapshot, which discards the snapshots saved before.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXScene, AZ::SystemAllocator);
 
     AZ_CVAR(bool, physx_profileSimulationDatapoints, true, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -58,6 +80,7 @@ namespace PhysX
     /*static*/ thread_local AZStd::vector<physx::PxRaycastHit> PhysXScene::s_rayCastBuffer;
     /*static*/ thread_local AZStd::vector<physx::PxSweepHit> PhysXScene::s_sweepBuffer;
     /*static*/ thread_local AZStd::vector<physx::PxOverlapHit> PhysXScene::s_overlapBuffer;
+    /*static*/ thread_local AZStd::vector<AZStd::pair<AZ::u32, AZ::u32>> PhysXScene::s_batchQueryOrder;
 
     namespace Internal
     {
@@ -127,6 +150,11 @@ namespace PhysX
                 sceneDesc.flags |= physx::PxSceneFlag::eREQUIRE_RW_LOCK;
             #endif
 
+            if (physx_deterministicSimulation)
+            {
+                sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ENHANCED_DETERMINISM;
+            }
+
             if (auto* physXSystem = GetPhysXSystem())
             {
                 sceneDesc.cpuDispatcher = physXSystem->GetPxCpuDispathcher();
@@ -268,6 +296,173 @@ namespace PhysX
             return newBody;
         }
 
+        //! Creates a static actor with copies of the shapes of the given actor, which collides like it but isn't hit by queries.
+        physx::PxRigidStatic* CreateStaticMirror(physx::PxRigidActor& pxActor)
+        {
+            physx::PxPhysics& physics = PxGetPhysics();
+            physx::PxRigidStatic* mirror = physics.createRigidStatic(pxActor.getGlobalPose());
+            if (!mirror)
+            {
+                return nullptr;
+            }
+
+            AZStd::vector<physx::PxShape*> shapes(pxActor.getNbShapes());
+            pxActor.getShapes(shapes.data(), static_cast<physx::PxU32>(shapes.size()));
+            for (physx::PxShape* shape : shapes)
+            {
+                AZStd::vector<physx::PxMaterial*> materials(shape->getNbMaterials());
+                shape->getMaterials(materials.data(), static_cast<physx::PxU32>(materials.size()));
+
+                physx::PxShapeFlags shapeFlags = shape->getFlags();
+                shapeFlags.clear(physx::PxShapeFlag::eSCENE_QUERY_SHAPE);
+#if (PX_PHYSICS_VERSION_MAJOR == 5)
+                physx::PxShape* mirrorShape = physics.createShape(
+                    shape->getGeometry(), materials.data(), static_cast<physx::PxU16>(materials.size()), true, shapeFlags);
+#else
+                physx::PxShape* mirrorShape = physics.createShape(
+                    shape->getGeometry().any(), materials.data(), static_cast<physx::PxU16>(materials.size()), true, shapeFlags);
+#endif
+                if (mirrorShape)
+                {
+                    mirrorShape->setLocalPose(shape->getLocalPose());
+                    mirrorShape->setSimulationFilterData(shape->getSimulationFilterData());
+                    mirrorShape->setContactOffset(shape->getContactOffset());
+                    mirrorShape->setRestOffset(shape->getRestOffset());
+                    mirrorShape->userData = shape->userData;
+                    mirror->attachShape(*mirrorShape);
+                    mirrorShape->release();
+                }
+            }
+
+            // Sharing the actor data reports the collisions with the mirror as collisions with the original body
+            mirror->userData = pxActor.userData;
+            return mirror;
+        }
+
+        //! Combines the hits of a query run on all the scene shards into the hits a single scene would report.
+        void MergeShardQueryHits(const AzPhysics::SceneQueryRequest* request, size_t firstHitIndex, AZ::u32 maxResults,
+            AzPhysics::SceneQueryHits& result)
+        {
+            auto firstHit = result.m_hits.begin() + firstHitIndex;
+            auto compareDistance = [](const AzPhysics::SceneQueryHit& lhs, const AzPhysics::SceneQueryHit& rhs)
+            {
+                return lhs.m_distance < rhs.m_distance;
+            };
+
+            bool reportMultipleHits = true;
+            if (request->m_requestType == AzPhysics::SceneQueryRequest::RequestType::Raycast)
+            {
+                const auto* raycastRequest = static_cast<const AzPhysics::RayCastRequest*>(request);
+                reportMultipleHits = raycastRequest->m_reportMultipleHits;
+                maxResults = AZStd::min(raycastRequest->m_maxResults, maxResults);
+            }
+            else if (request->m_requestType == AzPhysics::SceneQueryRequest::RequestType::Shapecast)
+            {
+                const auto* shapecastRequest = static_cast<const AzPhysics::ShapeCastRequest*>(request);
+                reportMultipleHits = shapecastRequest->m_reportMultipleHits;
+                maxResults = AZStd::min(shapecastRequest->m_maxResults, maxResults);
+            }
+            else if (request->m_requestType == AzPhysics::SceneQueryRequest::RequestType::Overlap)
+            {
+                maxResults = AZStd::min(static_cast<const AzPhysics::OverlapRequest*>(request)->m_maxResults, maxResults);
+            }
+
+            if (!reportMultipleHits)
+            {
+                // Each shard reported its closest blocking hit
+                if (result.m_hits.end() - firstHit > 1)
+                {
+                    const AzPhysics::SceneQueryHit closestHit = *AZStd::min_element(firstHit, result.m_hits.end(), compareDistance);
+                    result.m_hits.erase(firstHit, result.m_hits.end());
+                    result.m_hits.emplace_back(closestHit);
+                }
+                return;
+            }
+
+            if (static_cast<size_t>(result.m_hits.end() - firstHit) > maxResults)
+            {
+                if (request->m_requestType != AzPhysics::SceneQueryRequest::RequestType::Overlap)
+                {
+                    AZStd::sort(firstHit, result.m_hits.end(), compareDistance);
+                }
+                result.m_hits.resize(firstHitIndex + maxResults);
+            }
+        }
+
+        //! Locks all the given scenes for read, for tasks reading from bodies in any of the scene shards.
+        void LockSceneShardsRead([[maybe_unused]] const AZStd::vector<physx::PxScene*>& pxScenes)
+        {
+#ifdef PHYSX_ENABLE_MULTI_THREADING
+            for (physx::PxScene* pxScene : pxScenes)
+            {
+                pxScene->lockRead(__FILE__, __LINE__);
+            }
+#endif
+        }
+
+        void UnlockSceneShardsRead([[maybe_unused]] const AZStd::vector<physx::PxScene*>& pxScenes)
+        {
+#ifdef PHYSX_ENABLE_MULTI_THREADING
+            for (physx::PxScene* pxScene : pxScenes)
+            {
+                pxScene->unlockRead();
+            }
+#endif
+        }
+
+        void LockSceneShardsWrite([[maybe_unused]] const AZStd::vector<physx::PxScene*>& pxScenes)
+        {
+#ifdef PHYSX_ENABLE_MULTI_THREADING
+            for (physx::PxScene* pxScene : pxScenes)
+            {
+                pxScene->lockWrite(__FILE__, __LINE__);
+            }
+#endif
+        }
+
+        void UnlockSceneShardsWrite([[maybe_unused]] const AZStd::vector<physx::PxScene*>& pxScenes)
+        {
+#ifdef PHYSX_ENABLE_MULTI_THREADING
+            for (physx::PxScene* pxScene : pxScenes)
+            {
+                pxScene->unlockWrite();
+            }
+#endif
+        }
+
+        //! Returns the location a scene query starts from.
+        AZ::Vector3 GetQueryOrigin(const AzPhysics::SceneQueryRequest& request)
+        {
+            switch (request.m_requestType)
+            {
+            case AzPhysics::SceneQueryRequest::RequestType::Raycast:
+                return static_cast<const AzPhysics::RayCastRequest&>(request).m_start;
+            case AzPhysics::SceneQueryRequest::RequestType::Shapecast:
+                return static_cast<const AzPhysics::ShapeCastRequest&>(request).m_start.GetTranslation();
+            case AzPhysics::SceneQueryRequest::RequestType::Overlap:
+                return static_cast<const AzPhysics::OverlapRequest&>(request).m_pose.GetTranslation();
+            default:
+                return AZ::Vector3::CreateZero();
+            }
+        }
+
+        //! Returns the Morton code of the cell the position is in, so that sorting by it groups close positions together.
+        //! The cell coordinates wrap every 1024 cells, which only affects the grouping.
+        AZ::u32 GetMortonCode(const AZ::Vector3& position)
+        {
+            constexpr float CellSize = 8.0f;
+            auto spreadBits = [](float coordinate)
+            {
+                AZ::u32 bits = static_cast<AZ::u32>(static_cast<AZ::s32>(AZStd::floor(coordinate / CellSize))) & 0x3ff;
+                bits = (bits | (bits << 16)) & 0x030000ff;
+                bits = (bits | (bits << 8)) & 0x0300f00f;
+                bits = (bits | (bits << 4)) & 0x030c30c3;
+                bits = (bits | (bits << 2)) & 0x09249249;
+                return bits;
+            };
+            return spreadBits(position.GetX()) | (spreadBits(position.GetY()) << 1) | (spreadBits(position.GetZ()) << 2);
+        }
+
         //helper to perform a ray cast
         bool RayCast(const AzPhysics::RayCastRequest* raycastRequest,
             AZStd::vector<physx::PxRaycastHit>& raycastBuffer,
@@ -508,6 +703,22 @@ namespace PhysX
         AZ_Assert(m_pxScene != nullptr, "PhysX::Scene creation failed.");
 
         m_pxScene->userData = this;
+        m_pxScenes.push_back(m_pxScene);
+
+        // The other shards share the callbacks, as only one shard is fetched at a time
+        const AZ::u32 shardCount = AZStd::max(static_cast<AZ::u32>(physx_sceneShardCount), 1u);
+        m_shardSize = AZStd::max(static_cast<float>(physx_sceneShardSize), 1.0f);
+        for (AZ::u32 shardIndex = 1; shardIndex < shardCount; ++shardIndex)
+        {
+            physx::PxScene* pxShard = Internal::CreatePxScene(m_config, &m_collisionFilterCallback, &m_simulationEventCallback);
+            if (!pxShard)
+            {
+                AZ_Error("PhysXScene", false, "Failed to create scene shard %u, using %u shards.", shardIndex, shardIndex);
+                break;
+            }
+            pxShard->userData = this;
+            m_pxScenes.push_back(pxShard);
+        }
 
         m_gravity = m_config.m_gravity;
     }
@@ -543,6 +754,12 @@ namespace PhysX
             m_controllerManager = nullptr;
         }
 
+        for (size_t shardIndex = 1; shardIndex < m_pxScenes.size(); ++shardIndex)
+        {
+            m_pxScenes[shardIndex]->release();
+        }
+        m_pxScenes.clear();
+
         if (m_pxScene)
         {
             m_pxScene->release();
@@ -564,10 +781,18 @@ namespace PhysX
             m_sceneSimulationStartEvent.Signal(m_sceneHandle, deltatime);
         }
 
+        // The character controllers queue their moves from the simulation start event
+        MoveCharacters(m_queuedCharacterMoves, m_characterMoveResults);
+        m_queuedCharacterMoves.clear();
+
         m_currentDeltaTime = deltatime;
 
-        PHYSX_SCENE_WRITE_LOCK(m_pxScene);
-        m_pxScene->simulate(deltatime);
+        // Simulate only starts the simulation tasks on the cpu dispatcher, so the shards step in parallel
+        for (physx::PxScene* pxScene : m_pxScenes)
+        {
+            PHYSX_SCENE_WRITE_LOCK(pxScene);
+            pxScene->simulate(deltatime);
+        }
     }
 
     void PhysXScene::FinishSimulation()
@@ -587,40 +812,56 @@ namespace PhysX
             // This is because contact modification callbacks can be issued from the job threads and cause deadlock
             // due to the callback code locking the scene.
             // https://devtalk.nvidia.com/default/topic/1024408/pxcontactmodifycallback-and-pxscene-locking/
-            m_pxScene->checkResults(true);
+            for (physx::PxScene* pxScene : m_pxScenes)
+            {
+                pxScene->checkResults(true);
+            }
         }
 
         bool activeActorsEnabled = false;
         {
             AZ_PROFILE_SCOPE(Physics, "PhysXScene::FetchResults");
-            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            for (physx::PxScene* pxScene : m_pxScenes)
+            {
+                PHYSX_SCENE_WRITE_LOCK(pxScene);
 
-            activeActorsEnabled = m_pxScene->getFlags() & physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
+                activeActorsEnabled = pxScene->getFlags() & physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
 
-            // Swap the buffers, invoke callbacks, build the list of active actors.
-            m_pxScene->fetchResults(true);
+                // Swap the buffers, invoke callbacks, build the list of active actors.
+                pxScene->fetchResults(true);
+            }
         }
 
+        ++m_simulationTick;
+
         if (activeActorsEnabled)
         {
             AZ_PROFILE_SCOPE(Physics, "PhysXScene::ActiveActors");
 
             AzPhysics::SimulatedBodyHandleList activeBodyHandles;
 
+            for (size_t shardIndex = 0; shardIndex < m_pxScenes.size(); ++shardIndex)
             {
-                PHYSX_SCENE_READ_LOCK(m_pxScene);
+                physx::PxScene* pxScene = m_pxScenes[shardIndex];
+                PHYSX_SCENE_READ_LOCK(pxScene);
                 physx::PxU32 numActiveActors = 0;
-                physx::PxActor** activeActors = m_pxScene->getActiveActors(numActiveActors);
-                activeBodyHandles.reserve(numActiveActors);
+                physx::PxActor** activeActors = pxScene->getActiveActors(numActiveActors);
+                activeBodyHandles.reserve(activeBodyHandles.size() + numActiveActors);
                 for (physx::PxU32 i = 0; i < numActiveActors; ++i)
                 {
                     if (ActorData* actorData = Utils::GetUserData(activeActors[i]))
                     {
                         activeBodyHandles.emplace_back(actorData->GetBodyHandle());
+                        if (IsSharded())
+                        {
+                            QueueShardMigration(*activeActors[i], shardIndex);
+                        }
                     }
                 }
             }
 
+            MigrateQueuedBodiesBetweenShards();
+
             // Keep the event signal outside of the scene lock since there may be handlers that want to lock the scene for write
             m_sceneActiveSimulatedBodies.Signal(m_sceneHandle, activeBodyHandles, m_currentDeltaTime);
 
@@ -811,6 +1052,7 @@ namespace PhysX
                 // Disable simulation on body (not signaling OnSimulationBodySimulationDisabled event)
                 DisableSimulationOfBodyInternal(*m_simulatedBodies[index].second);
             }
+            m_pinnedBodies.erase(m_simulatedBodies[index].second);
 
             m_simulatedBodyRemovedEvent.Signal(m_sceneHandle, bodyHandle);
 
@@ -881,6 +1123,10 @@ namespace PhysX
     AzPhysics::JointHandle PhysXScene::AddJoint(const AzPhysics::JointConfiguration* jointConfig,
         AzPhysics::SimulatedBodyHandle parentBody, AzPhysics::SimulatedBodyHandle childBody)
     {
+        // Both bodies of a joint need to be in the same PhysX scene
+        PinBodyToPrimaryShard(parentBody);
+        PinBodyToPrimaryShard(childBody);
+
         AzPhysics::Joint* newJoint = nullptr;
         AZ::Crc32 newJointCrc;
         if (azrtti_istypeof<PhysX::D6JointLimitConfiguration>(jointConfig))
@@ -982,6 +1228,28 @@ namespace PhysX
             return false; // return 0 hits
         }
 
+        if (!IsSharded())
+        {
+            return QueryPxScene(request, m_pxScene, result);
+        }
+
+        // Run the query on all the shards, the static bodies are only hit in the first one
+        const size_t firstHitIndex = result.m_hits.size();
+        bool status = false;
+        for (physx::PxScene* pxScene : m_pxScenes)
+        {
+            status = QueryPxScene(request, pxScene, result) || status;
+        }
+
+        const AZ::u32 maxResults = request->m_requestType == AzPhysics::SceneQueryRequest::RequestType::Raycast ? m_raycastBufferSize
+            : request->m_requestType == AzPhysics::SceneQueryRequest::RequestType::Shapecast                     ? m_shapecastBufferSize
+                                                                                                                  : m_overlapBufferSize;
+        Internal::MergeShardQueryHits(request, firstHitIndex, maxResults, result);
+        return status;
+    }
+
+    bool PhysXScene::QueryPxScene(const AzPhysics::SceneQueryRequest* request, physx::PxScene* pxScene, AzPhysics::SceneQueryHits& result)
+    {
         // Query flags.
         const physx::PxQueryFlags queryFlags = SceneQueryHelpers::GetPxQueryFlags(request->m_queryType);
         const physx::PxQueryFilterData queryData(queryFlags);
@@ -991,17 +1259,17 @@ namespace PhysX
         case AzPhysics::SceneQueryRequest::RequestType::Raycast:
             {
                 return Internal::RayCast(static_cast<const AzPhysics::RayCastRequest*>(request),
-                    s_rayCastBuffer, m_pxScene, queryData, m_raycastBufferSize, result);
+                    s_rayCastBuffer, pxScene, queryData, m_raycastBufferSize, result);
             }
         case AzPhysics::SceneQueryRequest::RequestType::Shapecast:
             {
                 return Internal::ShapeCast(static_cast<const AzPhysics::ShapeCastRequest*>(request),
-                    s_sweepBuffer, m_pxScene, queryData, m_shapecastBufferSize, result);
+                    s_sweepBuffer, pxScene, queryData, m_shapecastBufferSize, result);
             }
         case AzPhysics::SceneQueryRequest::RequestType::Overlap:
             {
                 return Internal::OverlapQuery(static_cast<const AzPhysics::OverlapRequest*>(request),
-                    s_overlapBuffer, m_pxScene, queryData, m_overlapBufferSize, result);
+                    s_overlapBuffer, pxScene, queryData, m_overlapBufferSize, result);
             }
         default:
             {
@@ -1015,12 +1283,74 @@ namespace PhysX
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
         AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        QuerySceneBatch(requests, results);
+        return results;
+    }
+
+    bool PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
+        results.resize(requests.size());
+        for (AzPhysics::SceneQueryHits& hits : results)
         {
-            results.emplace_back(QueryScene(request.get()));
+            hits.m_hits.clear();
         }
-        return results;
+
+        const size_t taskSize = AZStd::max(static_cast<size_t>(physx_batchQueryTaskSize), size_t{ 1 });
+        if (!physx_parallelBatchQueries || requests.size() <= taskSize)
+        {
+            bool hasHits = false;
+            for (size_t i = 0; i < requests.size(); ++i)
+            {
+                hasHits = QueryScene(requests[i].get(), results[i]) || hasHits;
+            }
+            return hasHits;
+        }
+
+        // Each task runs the requests of a group of nearby cells, which walk the same parts of the scene's AABB trees
+        AZStd::vector<AZStd::pair<AZ::u32, AZ::u32>>& order = s_batchQueryOrder;
+        order.clear();
+        order.reserve(requests.size());
+        for (size_t i = 0; i < requests.size(); ++i)
+        {
+            const AZ::u32 mortonCode = requests[i] ? Internal::GetMortonCode(Internal::GetQueryOrigin(*requests[i])) : 0;
+            order.emplace_back(mortonCode, static_cast<AZ::u32>(i));
+        }
+        AZStd::sort(order.begin(), order.end());
+
+        AZ::TaskGraph taskGraph("Batch Scene Query");
+        AZ::TaskGraphEvent finishEvent("Batch scene query event");
+        AZStd::atomic_bool hasHits = false;
+        for (size_t i = 0; i < order.size(); i += taskSize)
+        {
+            AZ::TaskDescriptor taskDescriptor{ "BatchSceneQueryTask", "Physics" };
+            taskGraph.AddTask(
+                taskDescriptor,
+                [start = i, end = AZStd::min(i + taskSize, order.size()), &order, &requests, &results, &hasHits, this]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "Batch Scene Query Task");
+
+                    // Keep the scene locked for read for the whole task, instead of locking it for each query
+                    Internal::LockSceneShardsRead(m_pxScenes);
+                    bool taskHasHits = false;
+                    for (size_t orderIndex = start; orderIndex < end; ++orderIndex)
+                    {
+                        const AZ::u32 requestIndex = order[orderIndex].second;
+                        taskHasHits = QueryScene(requests[requestIndex].get(), results[requestIndex]) || taskHasHits;
+                    }
+                    Internal::UnlockSceneShardsRead(m_pxScenes);
+
+                    if (taskHasHits)
+                    {
+                        hasHits = true;
+                    }
+                });
+        }
+
+        taskGraph.Submit(&finishEvent);
+        finishEvent.Wait();
+        return hasHits;
     }
 
     [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
@@ -1066,9 +1396,10 @@ namespace PhysX
         if (m_pxScene && !m_gravity.IsClose(gravity))
         {
             m_gravity = gravity;
+            for (physx::PxScene* pxScene : m_pxScenes)
             {
-                PHYSX_SCENE_WRITE_LOCK(m_pxScene);
-                m_pxScene->setGravity(PxMathConvert(m_gravity));
+                PHYSX_SCENE_WRITE_LOCK(pxScene);
+                pxScene->setGravity(PxMathConvert(m_gravity));
             }
             m_sceneGravityChangedEvent.Signal(m_sceneHandle, m_gravity);
         }
@@ -1089,9 +1420,20 @@ namespace PhysX
             auto pxActor = static_cast<physx::PxActor*>(body.GetNativePointer());
             AZ_Assert(pxActor, "Simulated Body doesn't have a valid physx actor");
 
+            physx::PxScene* pxScene = m_pxScene;
+            if (IsShardedBody(body))
+            {
+                pxScene = m_pxScenes[GetShardIndex(static_cast<physx::PxRigidActor*>(pxActor)->getGlobalPose().p.x)];
+            }
+
+            {
+                PHYSX_SCENE_WRITE_LOCK(pxScene);
+                pxScene->addActor(*pxActor);
+            }
+
+            if (IsSharded() && azrtti_istypeof<PhysX::StaticRigidBody>(body))
             {
-                PHYSX_SCENE_WRITE_LOCK(m_pxScene);
-                m_pxScene->addActor(*pxActor);
+                CreateStaticMirrors(body);
             }
 
             if (azrtti_istypeof<PhysX::RigidBody>(body))
@@ -1117,10 +1459,14 @@ namespace PhysX
             auto pxActor = static_cast<physx::PxActor*>(body.GetNativePointer());
             AZ_Assert(pxActor, "Simulated Body doesn't have a valid physx actor");
 
+            // The actor may be in any of the shards
+            if (physx::PxScene* pxScene = pxActor->getScene())
             {
-                PHYSX_SCENE_WRITE_LOCK(m_pxScene);
-                m_pxScene->removeActor(*pxActor);
+                PHYSX_SCENE_WRITE_LOCK(pxScene);
+                pxScene->removeActor(*pxActor);
             }
+
+            ReleaseStaticMirrors(body);
         }
         body.m_simulating = false;
     }
@@ -1149,6 +1495,45 @@ namespace PhysX
         return m_controllerManager;
     }
 
+    void PhysXScene::QueueCharacterMove(const CharacterMoveRequest& request)
+    {
+        m_queuedCharacterMoves.push_back(request);
+    }
+
+    void PhysXScene::MoveCharacters(AZStd::span<const CharacterMoveRequest> requests, AZStd::vector<CharacterMoveResult>& results)
+    {
+        results.clear();
+        if (requests.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::MoveCharacters");
+
+        // The moves stay on this thread, PxController::move isn't thread safe for controllers of the same controller manager.
+        // Batching still saves locking the scene and looking the controllers up through their components for each move.
+        results.reserve(requests.size());
+        PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+        for (const CharacterMoveRequest& request : requests)
+        {
+            CharacterMoveResult& result = results.emplace_back();
+            result.m_characterHandle = request.m_characterHandle;
+
+            auto* controller = azdynamic_cast<CharacterController*>(GetSimulatedBodyFromHandle(request.m_characterHandle));
+            if (!controller)
+            {
+                continue;
+            }
+
+            const physx::PxControllerCollisionFlags collisionFlags =
+                controller->MoveWithSceneLocked(request.m_displacement, request.m_deltaTime);
+            result.m_basePosition = controller->GetBasePosition();
+            result.m_observedVelocity = controller->GetVelocity();
+            result.m_isValid = true;
+            result.m_isOnGround = collisionFlags.isSet(physx::PxControllerCollisionFlag::eCOLLISION_DOWN);
+        }
+    }
+
     void* PhysXScene::GetNativePointer() const
     {
         return m_pxScene;
@@ -1344,7 +1729,7 @@ namespace PhysX
 
         if (physx_parallelTransformSync)
         {
-            m_queuedActiveBodyIndices.ApplyParallel(transformSync, m_pxScene);
+            m_queuedActiveBodyIndices.ApplyParallel(transformSync, m_pxScenes);
         }
         else
         {
@@ -1355,6 +1740,309 @@ namespace PhysX
         m_accumulatedDeltaTime = 0.0f;
     }
 
+    size_t PhysXScene::GetShardIndex(float positionX) const
+    {
+        const float shardCoordinate = positionX / m_shardSize + 0.5f * static_cast<float>(m_pxScenes.size());
+        return AZStd::min(static_cast<size_t>(AZStd::max(shardCoordinate, 0.0f)), m_pxScenes.size() - 1);
+    }
+
+    bool PhysXScene::IsShardedBody(const AzPhysics::SimulatedBody& body) const
+    {
+        if (!IsSharded() || !azrtti_istypeof<PhysX::RigidBody>(body) || m_pinnedBodies.contains(&body))
+        {
+            return false;
+        }
+
+        // Ragdoll nodes take over the actor data of their rigid bodies, they stay in the first shard with their joints
+        const ActorData* actorData = Utils::GetUserData(static_cast<const physx::PxActor*>(body.GetNativePointer()));
+        return actorData && actorData->GetRagdollNode() == nullptr;
+    }
+
+    void PhysXScene::QueueShardMigration(physx::PxActor& pxActor, size_t shardIndex)
+    {
+        const physx::PxRigidActor* pxRigidActor = pxActor.is<physx::PxRigidActor>();
+        const ActorData* actorData = Utils::GetUserData(&pxActor);
+        if (!pxRigidActor || !actorData)
+        {
+            return;
+        }
+
+        // Only move the body once it is well inside the other shard, so it doesn't move back and forth at the boundary
+        const float positionX = pxRigidActor->getGlobalPose().p.x;
+        const float hysteresis = physx_sceneShardHysteresis;
+        const size_t targetShardIndex = GetShardIndex(positionX - hysteresis);
+        if (targetShardIndex == shardIndex || targetShardIndex != GetShardIndex(positionX + hysteresis))
+        {
+            return;
+        }
+
+        const AzPhysics::SimulatedBody* body = GetSimulatedBodyFromHandle(actorData->GetBodyHandle());
+        if (body && IsShardedBody(*body))
+        {
+            m_queuedShardMigrations.emplace_back(&pxActor, targetShardIndex);
+        }
+    }
+
+    void PhysXScene::MigrateQueuedBodiesBetweenShards()
+    {
+        if (m_queuedShardMigrations.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::MigrateQueuedBodiesBetweenShards");
+        for (const auto& [pxActor, shardIndex] : m_queuedShardMigrations)
+        {
+            MoveActorToShard(*pxActor, m_pxScenes[shardIndex]);
+        }
+        m_queuedShardMigrations.clear();
+    }
+
+    void PhysXScene::MoveActorToShard(physx::PxActor& pxActor, physx::PxScene* pxScene)
+    {
+        physx::PxScene* currentPxScene = pxActor.getScene();
+        if (currentPxScene == pxScene)
+        {
+            return;
+        }
+
+        if (currentPxScene)
+        {
+            PHYSX_SCENE_WRITE_LOCK(currentPxScene);
+            currentPxScene->removeActor(pxActor, false);
+        }
+
+        PHYSX_SCENE_WRITE_LOCK(pxScene);
+        pxScene->addActor(pxActor);
+
+        // Removing the actor from its scene lost its contacts, keep it moving in the new shard
+        if (physx::PxRigidDynamic* pxRigidDynamic = pxActor.is<physx::PxRigidDynamic>();
+            pxRigidDynamic && !pxRigidDynamic->getRigidBodyFlags().isSet(physx::PxRigidBodyFlag::eKINEMATIC))
+        {
+            pxRigidDynamic->wakeUp();
+        }
+    }
+
+    void PhysXScene::PinBodyToPrimaryShard(AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        if (!IsSharded())
+        {
+            return;
+        }
+
+        AzPhysics::SimulatedBody* body = GetSimulatedBodyFromHandle(bodyHandle);
+        if (!body || !IsShardedBody(*body))
+        {
+            return;
+        }
+
+        m_pinnedBodies.insert(body);
+        if (body->m_simulating)
+        {
+            if (auto* pxActor = static_cast<physx::PxActor*>(body->GetNativePointer()))
+            {
+                MoveActorToShard(*pxActor, m_pxScene);
+            }
+        }
+    }
+
+    void PhysXScene::CreateStaticMirrors(AzPhysics::SimulatedBody& body)
+    {
+        auto* pxActor = static_cast<physx::PxRigidActor*>(body.GetNativePointer());
+        AZStd::vector<physx::PxRigidStatic*>& mirrors = m_staticMirrors[&body];
+        for (size_t shardIndex = 1; shardIndex < m_pxScenes.size(); ++shardIndex)
+        {
+            if (physx::PxRigidStatic* mirror = Internal::CreateStaticMirror(*pxActor))
+            {
+                PHYSX_SCENE_WRITE_LOCK(m_pxScenes[shardIndex]);
+                m_pxScenes[shardIndex]->addActor(*mirror);
+                mirrors.push_back(mirror);
+            }
+        }
+    }
+
+    void PhysXScene::ReleaseStaticMirrors(AzPhysics::SimulatedBody& body)
+    {
+        auto mirrorsIt = m_staticMirrors.find(&body);
+        if (mirrorsIt == m_staticMirrors.end())
+        {
+            return;
+        }
+
+        for (physx::PxRigidStatic* mirror : mirrorsIt->second)
+        {
+            {
+                PHYSX_SCENE_WRITE_LOCK(mirror->getScene());
+                mirror->getScene()->removeActor(*mirror);
+            }
+            mirror->release();
+        }
+        m_staticMirrors.erase(mirrorsIt);
+    }
+
+    void PhysXScene::SaveStateSnapshot()
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::SaveStateSnapshot");
+
+        SceneStateSnapshot& snapshot = BeginStateSnapshot();
+
+        Internal::LockSceneShardsRead(m_pxScenes);
+        for (auto& simulatedBody : m_simulatedBodies)
+        {
+            if (simulatedBody.second != nullptr)
+            {
+                CaptureRigidBodyState(snapshot, *simulatedBody.second);
+            }
+        }
+        Internal::UnlockSceneShardsRead(m_pxScenes);
+    }
+
+    void PhysXScene::SaveStateSnapshot(const AzPhysics::SimulatedBodyHandleList& bodyHandles)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::SaveStateSnapshot");
+
+        SceneStateSnapshot& snapshot = BeginStateSnapshot();
+        snapshot.m_isPartial = true;
+
+        Internal::LockSceneShardsRead(m_pxScenes);
+        for (const AzPhysics::SimulatedBodyHandle& bodyHandle : bodyHandles)
+        {
+            if (AzPhysics::SimulatedBody* body = GetSimulatedBodyFromHandle(bodyHandle))
+            {
+                CaptureRigidBodyState(snapshot, *body);
+            }
+        }
+        Internal::UnlockSceneShardsRead(m_pxScenes);
+    }
+
+    bool PhysXScene::RestoreStateSnapshot(AZ::u64 tick)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::RestoreStateSnapshot");
+
+        const SceneStateSnapshot* snapshot = m_stateSnapshots.FindSnapshot(tick);
+        if (snapshot == nullptr)
+        {
+            AZ_Warning("PhysXScene", false, "RestoreStateSnapshot: There's no snapshot of tick %llu, the oldest snapshot is of tick %llu.",
+                static_cast<unsigned long long>(tick), static_cast<unsigned long long>(m_stateSnapshots.GetOldestTick()));
+            return false;
+        }
+
+        // Bodies removed since are skipped, bodies added since are left as they are
+        AzPhysics::SimulatedBodyHandleList restoredBodyHandles;
+        restoredBodyHandles.reserve(snapshot->m_bodies.size());
+
+        Internal::LockSceneShardsWrite(m_pxScenes);
+        for (const RigidBodyState& state : snapshot->m_bodies)
+        {
+            AzPhysics::SimulatedBody* body = GetSimulatedBodyFromHandle(state.m_bodyHandle);
+            if (body != nullptr && body->m_simulating)
+            {
+                state.Restore(*static_cast<physx::PxRigidDynamic*>(body->GetNativePointer()));
+                restoredBodyHandles.emplace_back(state.m_bodyHandle);
+            }
+        }
+        Internal::UnlockSceneShardsWrite(m_pxScenes);
+
+        m_simulationTick = tick;
+        m_stateSnapshots.DiscardSnapshotsAfter(tick);
+
+        // The entities of the restored bodies sync their transforms like the bodies moved by a simulation step
+        if (physx_batchTransformSync)
+        {
+            m_queuedActiveBodyIndices.IncreaseCapacity(restoredBodyHandles.size());
+            for (const AzPhysics::SimulatedBodyHandle& bodyHandle : restoredBodyHandles)
+            {
+                m_queuedActiveBodyIndices.Insert(AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle));
+            }
+        }
+        else
+        {
+            SyncActiveBodyTransform(restoredBodyHandles);
+        }
+        return true;
+    }
+
+    bool PhysXScene::Resimulate(AZ::u64 fromTick, AZ::u32 numTicks, float fixedTimestep,
+        const AZStd::function<void(AZ::u64 tick)>& preStepCallback)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::Resimulate");
+
+        const SceneStateSnapshot* snapshot = m_stateSnapshots.FindSnapshot(fromTick);
+        if (snapshot == nullptr)
+        {
+            AZ_Warning("PhysXScene", false, "Resimulate: There's no snapshot of tick %llu to resimulate from.",
+                static_cast<unsigned long long>(fromTick));
+            return false;
+        }
+
+        // The snapshots saved while resimulating replace the ones of the rolled back ticks, so they hold the same bodies.
+        // The handles are copied as saving a snapshot may reuse the slot of the restored one.
+        const bool isPartial = snapshot->m_isPartial;
+        AzPhysics::SimulatedBodyHandleList partialBodyHandles;
+        if (isPartial)
+        {
+            partialBodyHandles.reserve(snapshot->m_bodies.size());
+            for (const RigidBodyState& state : snapshot->m_bodies)
+            {
+                partialBodyHandles.emplace_back(state.m_bodyHandle);
+            }
+        }
+
+        RestoreStateSnapshot(fromTick);
+
+        for (AZ::u32 step = 0; step < numTicks; ++step)
+        {
+            if (preStepCallback)
+            {
+                preStepCallback(m_simulationTick);
+            }
+
+            StartSimulation(fixedTimestep);
+            FinishSimulation();
+
+            if (isPartial)
+            {
+                SaveStateSnapshot(partialBodyHandles);
+            }
+            else
+            {
+                SaveStateSnapshot();
+            }
+        }
+
+        if (physx_batchTransformSync)
+        {
+            FlushTransformSync();
+        }
+        return true;
+    }
+
+    SceneStateSnapshot& PhysXScene::BeginStateSnapshot()
+    {
+        const size_t snapshotCount = AZStd::max(static_cast<size_t>(static_cast<AZ::u32>(physx_stateSnapshotCount)), size_t{ 1 });
+        if (m_stateSnapshots.GetCapacity() != snapshotCount)
+        {
+            m_stateSnapshots.Reserve(snapshotCount, m_simulatedBodies.size());
+        }
+        return m_stateSnapshots.BeginSnapshot(m_simulationTick);
+    }
+
+    void PhysXScene::CaptureRigidBodyState(SceneStateSnapshot& snapshot, AzPhysics::SimulatedBody& body)
+    {
+        // Static bodies don't change, characters and articulations aren't rolled back
+        if (!body.m_simulating || !azrtti_istypeof<PhysX::RigidBody>(&body))
+        {
+            return;
+        }
+
+        if (const auto* pxRigidDynamic = static_cast<const physx::PxRigidDynamic*>(body.GetNativePointer()))
+        {
+            RigidBodyState& state = snapshot.m_bodies.emplace_back();
+            state.m_bodyHandle = body.m_bodyHandle;
+            state.Capture(*pxRigidDynamic);
+        }
+    }
+
     void PhysXScene::QueuedActiveBodyIndices::Insert(AzPhysics::SimulatedBodyIndex bodyIndex)
     {
         if (m_uniqueIndices.insert(bodyIndex).second)
@@ -1379,7 +2067,8 @@ namespace PhysX
         AZStd::for_each(m_packedIndices.begin(), m_packedIndices.end(), applyFunction);
     }
 
-    void PhysXScene::QueuedActiveBodyIndices::ApplyParallel(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction, physx::PxScene* pxScene)
+    void PhysXScene::QueuedActiveBodyIndices::ApplyParallel(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction,
+        const AZStd::vector<physx::PxScene*>& pxScenes)
     {
         AZ::TaskGraph taskGraph("Parallel Sync");
         AZ::TaskGraphEvent finishEvent("Parallel sync event");
@@ -1394,19 +2083,22 @@ namespace PhysX
                 AZ::TaskDescriptor taskDescriptor{"SyncTask", "Physics"};
                 taskGraph.AddTask(
                     taskDescriptor,
-                    [start = i, end = AZStd::min(i + batchSize, fullSize), &applyFunction, pxScene, this]()
+                    [start = i, end = AZStd::min(i + batchSize, fullSize), &applyFunction, &pxScenes, this]()
                     {
                         AZ_PROFILE_SCOPE(Physics, "Sync Task");
 
                         // Note: It is important to keep the scene locked for read for the entire task execution.
                         // Otherwise the functions reading data from the rigid body will have to lock it locally.
                         // This causes a huge amount of context switches making the execution of each task ~20x slower. 
-                        PHYSX_SCENE_READ_LOCK(pxScene);
+                        // The bodies can be in any of the scene shards, so all of them are locked.
+                        Internal::LockSceneShardsRead(pxScenes);
 
                         for (size_t batchIndex = start; batchIndex < end; ++batchIndex)
                         {
                             applyFunction(m_packedIndices[batchIndex]);
                         }
+
+                        Internal::UnlockSceneShardsRead(pxScenes);
                     });
             }
 
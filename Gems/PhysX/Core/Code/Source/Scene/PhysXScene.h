@@ -13,20 +13,45 @@
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
 
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
+#include <Scene/PhysXSceneStateSnapshots.h>
 
 namespace physx
 {
+    class PxActor;
     class PxControllerManager;
     struct PxOverlapHit;
     struct PxRaycastHit;
+    class PxRigidStatic;
     class PxScene;
     struct PxSweepHit;
 }
 
 namespace PhysX
 {
+    //! Move of a character controller, executed by PhysXScene::MoveCharacters.
+    struct CharacterMoveRequest
+    {
+        AzPhysics::SimulatedBodyHandle m_characterHandle = AzPhysics::InvalidSimulatedBodyHandle;
+        AZ::Vector3 m_displacement = AZ::Vector3::CreateZero();
+        float m_deltaTime = 0.0f;
+    };
+
+    //! State of a character controller after its move.
+    struct CharacterMoveResult
+    {
+        AzPhysics::SimulatedBodyHandle m_characterHandle = AzPhysics::InvalidSimulatedBodyHandle;
+        AZ::Vector3 m_basePosition = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_observedVelocity = AZ::Vector3::CreateZero();
+        bool m_isValid = false; //!< False when the handle isn't a character controller of the scene, the move was skipped.
+        bool m_isOnGround = false; //!< True when the character touched something below it during the move.
+    };
+
     //! PhysX implementation of the AzPhysics::Scene.
     class PhysXScene final
         : public AzPhysics::Scene
@@ -61,6 +86,7 @@ namespace PhysX
         bool QueryScene(const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits& result) override;
 
         AzPhysics::SceneQueryHitsList QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests) override;
+        bool QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results) override;
         [[nodiscard]] bool QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
             const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback) override;
         [[nodiscard]] bool QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
@@ -81,10 +107,42 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Queues a move of a character controller for the next simulation step. The queued moves are executed together
+        //! once the scene simulation start event has been signaled, instead of locking the scene for each of them.
+        void QueueCharacterMove(const CharacterMoveRequest& request);
+        //! Moves the character controllers with one write lock of the scene, in the order of the requests.
+        //! @param results Filled with one result per request, in the same order.
+        void MoveCharacters(AZStd::span<const CharacterMoveRequest> requests, AZStd::vector<CharacterMoveResult>& results);
+        //! Returns the results of the moves queued for the current simulation step, in the order they were queued.
+        const AZStd::vector<CharacterMoveResult>& GetQueuedCharacterMoveResults() const { return m_characterMoveResults; }
+
         //! Apply batched transform sync events for the current simulation pass. 
         //! This will clear the batched data for the next simulation pass.
         void FlushTransformSync();
-        
+
+        //! Returns the number of PhysX scenes the rigid bodies of this scene are split across. See physx_sceneShardCount.
+        size_t GetNumShards() const { return m_pxScenes.size(); }
+
+        //! Returns the number of simulation steps the scene has finished, which is the tick state snapshots are saved for.
+        AZ::u64 GetSimulationTick() const { return m_simulationTick; }
+
+        //! Saves the state of all the rigid bodies of the scene for the current simulation tick.
+        //! The snapshots are kept in a ring buffer of physx_stateSnapshotCount snapshots, which overwrites the oldest snapshot.
+        void SaveStateSnapshot();
+        //! Saves the state of only the given rigid bodies for the current simulation tick, like the bodies of one island.
+        //! Restoring this snapshot leaves the other rigid bodies of the scene as they are.
+        void SaveStateSnapshot(const AzPhysics::SimulatedBodyHandleList& bodyHandles);
+        //! Restores the rigid bodies to their state at the tick and rewinds the simulation tick to it.
+        //! The snapshots of later ticks are discarded.
+        //! @return False when there's no snapshot of the tick, or it has been overwritten.
+        bool RestoreStateSnapshot(AZ::u64 tick);
+        //! Restores the snapshot of fromTick and simulates numTicks fixed steps from there.
+        //! After each step a snapshot of the same rigid bodies as the restored snapshot is saved.
+        //! @param preStepCallback Called before each step with the tick the step starts from, to apply the inputs of that tick again.
+        //! @return False when there's no snapshot of fromTick.
+        bool Resimulate(AZ::u64 fromTick, AZ::u32 numTicks, float fixedTimestep,
+            const AZStd::function<void(AZ::u64 tick)>& preStepCallback = {});
+
     private:
 
         //! Data structure for efficient unique vector functionality.
@@ -96,7 +154,8 @@ namespace PhysX
             void IncreaseCapacity(size_t extraSize);
             void Clear();
             void Apply(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction);
-            void ApplyParallel(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction, physx::PxScene* pxScene);
+            void ApplyParallel(const AZStd::function<void(AzPhysics::SimulatedBodyIndex)>& applyFunction,
+                const AZStd::vector<physx::PxScene*>& pxScenes);
 
         private:
             AZStd::unordered_set<AzPhysics::SimulatedBodyIndex> m_uniqueIndices;
@@ -115,6 +174,23 @@ namespace PhysX
 
         void SyncActiveBodyTransform(const AzPhysics::SimulatedBodyHandleList& activeBodyHandles);
 
+        bool QueryPxScene(const AzPhysics::SceneQueryRequest* request, physx::PxScene* pxScene, AzPhysics::SceneQueryHits& result);
+
+        // Scene sharding
+        bool IsSharded() const { return m_pxScenes.size() > 1; }
+        size_t GetShardIndex(float positionX) const;
+        bool IsShardedBody(const AzPhysics::SimulatedBody& body) const;
+        void QueueShardMigration(physx::PxActor& pxActor, size_t shardIndex);
+        void MigrateQueuedBodiesBetweenShards();
+        void MoveActorToShard(physx::PxActor& pxActor, physx::PxScene* pxScene);
+        void PinBodyToPrimaryShard(AzPhysics::SimulatedBodyHandle bodyHandle);
+        void CreateStaticMirrors(AzPhysics::SimulatedBody& body);
+        void ReleaseStaticMirrors(AzPhysics::SimulatedBody& body);
+
+        // State snapshots
+        SceneStateSnapshot& BeginStateSnapshot();
+        void CaptureRigidBodyState(SceneStateSnapshot& snapshot, AzPhysics::SimulatedBody& body);
+
         bool m_isEnabled = true;
 
         // Batch transform sync data. Here we store the indices of actors that have moved since the last simulation pass.
@@ -146,6 +222,7 @@ namespace PhysX
         static thread_local AZStd::vector<physx::PxRaycastHit> s_rayCastBuffer; //!< thread local structure to hold hits for a single raycast or shapecast.
         static thread_local AZStd::vector<physx::PxSweepHit> s_sweepBuffer; //!< thread local structure to hold hits for a single shapecast.
         static thread_local AZStd::vector<physx::PxOverlapHit> s_overlapBuffer; //!< thread local structure to hold hits for a single overlap query.
+        static thread_local AZStd::vector<AZStd::pair<AZ::u32, AZ::u32>> s_batchQueryOrder; //!< thread local structure to hold the spatially sorted request indices of a batch query.
         AZ::u32 m_raycastBufferSize = 32; //!< Maximum number of hits that will be returned from a raycast.
         AZ::u32 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u32 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
@@ -153,7 +230,20 @@ namespace PhysX
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
+        //! All the physx scenes the rigid bodies are split across, where the first one is m_pxScene.
+        //! Only free rigid bodies move to the other shards, everything else stays in m_pxScene.
+        AZStd::vector<physx::PxScene*> m_pxScenes;
+        float m_shardSize = 0.0f; //!< The width along the world X axis of each shard.
+        AZStd::unordered_set<const AzPhysics::SimulatedBody*> m_pinnedBodies; //!< Rigid bodies kept in m_pxScene as they have joints.
+        //! Copies of the static bodies in all the shards but m_pxScene, which only collide and aren't hit by queries.
+        AZStd::unordered_map<const AzPhysics::SimulatedBody*, AZStd::vector<physx::PxRigidStatic*>> m_staticMirrors;
+        AZStd::vector<AZStd::pair<physx::PxActor*, size_t>> m_queuedShardMigrations; //!< Active actors which crossed into another shard.
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
+        AZStd::vector<CharacterMoveRequest> m_queuedCharacterMoves; //!< Character moves executed at the start of the next simulation step.
+        AZStd::vector<CharacterMoveResult> m_characterMoveResults; //!< Results of the queued character moves of the current step.
+
+        AZ::u64 m_simulationTick = 0; //!< Number of finished simulation steps.
+        SceneStateSnapshots m_stateSnapshots; //!< Ring buffer of the rigid body states of the last ticks, allocated by the first snapshot.
 
         AZ::Vector3 m_gravity; // cache the gravity of the scene to avoid a lock in GetGravity().
     };
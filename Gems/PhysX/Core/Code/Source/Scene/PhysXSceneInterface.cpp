@@ -206,6 +206,17 @@ namespace PhysX
         return {}; //return an empty list
     }
 
+    bool PhysXSceneInterface::QuerySceneBatch(
+        AzPhysics::SceneHandle sceneHandle, const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results)
+    {
+        if (AzPhysics::Scene* scene = m_physxSystem->GetScene(sceneHandle))
+        {
+            return scene->QuerySceneBatch(requests, results);
+        }
+        results.clear();
+        return false;
+    }
+
     bool PhysXSceneInterface::QuerySceneAsync(
         AzPhysics::SceneHandle sceneHandle, AzPhysics::SceneQuery::AsyncRequestId requestId,
         const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
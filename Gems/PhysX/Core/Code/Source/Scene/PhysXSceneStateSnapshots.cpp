@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Scene/PhysXSceneStateSnapshots.h>
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/algorithm.h>
+
+#include <PxRigidDynamic.h>
+
+namespace PhysX
+{
+    void RigidBodyState::Capture(const physx::PxRigidDynamic& pxRigidDynamic)
+    {
+        m_pose = pxRigidDynamic.getGlobalPose();
+        m_isKinematic = pxRigidDynamic.getRigidBodyFlags().isSet(physx::PxRigidBodyFlag::eKINEMATIC);
+        m_hasKinematicTarget = m_isKinematic && pxRigidDynamic.getKinematicTarget(m_kinematicTarget);
+        m_linearVelocity = pxRigidDynamic.getLinearVelocity();
+        m_angularVelocity = pxRigidDynamic.getAngularVelocity();
+        m_wakeCounter = pxRigidDynamic.getWakeCounter();
+        m_isSleeping = pxRigidDynamic.isSleeping();
+    }
+
+    void RigidBodyState::Restore(physx::PxRigidDynamic& pxRigidDynamic) const
+    {
+        pxRigidDynamic.setGlobalPose(m_pose, false);
+
+        // The kinematic flag isn't part of the simulation state, a body which changed it since keeps its current mode
+        if (pxRigidDynamic.getRigidBodyFlags().isSet(physx::PxRigidBodyFlag::eKINEMATIC))
+        {
+            if (m_hasKinematicTarget)
+            {
+                pxRigidDynamic.setKinematicTarget(m_kinematicTarget);
+            }
+            return;
+        }
+
+        pxRigidDynamic.setLinearVelocity(m_linearVelocity, false);
+        pxRigidDynamic.setAngularVelocity(m_angularVelocity, false);
+        // Forces and accelerations share one accumulator, as do impulses and velocity changes
+        pxRigidDynamic.clearForce(physx::PxForceMode::eFORCE);
+        pxRigidDynamic.clearForce(physx::PxForceMode::eIMPULSE);
+        pxRigidDynamic.clearTorque(physx::PxForceMode::eFORCE);
+        pxRigidDynamic.clearTorque(physx::PxForceMode::eIMPULSE);
+
+        if (m_isSleeping)
+        {
+            pxRigidDynamic.putToSleep();
+        }
+        else
+        {
+            pxRigidDynamic.setWakeCounter(m_wakeCounter);
+        }
+    }
+
+    void SceneStateSnapshots::Reserve(size_t capacity, size_t bodyCapacity)
+    {
+        m_snapshots.clear();
+        m_snapshots.resize(capacity);
+        for (SceneStateSnapshot& snapshot : m_snapshots)
+        {
+            snapshot.m_bodies.reserve(bodyCapacity);
+        }
+        m_newest = 0;
+        m_count = 0;
+    }
+
+    SceneStateSnapshot& SceneStateSnapshots::BeginSnapshot(AZ::u64 tick)
+    {
+        AZ_Assert(!m_snapshots.empty(), "SceneStateSnapshots::BeginSnapshot: No snapshots have been reserved.");
+
+        if (tick > 0)
+        {
+            DiscardSnapshotsAfter(tick - 1);
+        }
+        else
+        {
+            m_count = 0;
+        }
+
+        if (m_count > 0)
+        {
+            m_newest = (m_newest + 1) % m_snapshots.size();
+        }
+        m_count = AZStd::min(m_count + 1, m_snapshots.size());
+
+        SceneStateSnapshot& snapshot = m_snapshots[m_newest];
+        snapshot.m_tick = tick;
+        snapshot.m_isPartial = false;
+        snapshot.m_bodies.clear();
+        return snapshot;
+    }
+
+    const SceneStateSnapshot* SceneStateSnapshots::FindSnapshot(AZ::u64 tick) const
+    {
+        for (size_t age = 0; age < m_count; ++age)
+        {
+            const SceneStateSnapshot& snapshot = m_snapshots[GetSlot(age)];
+            if (snapshot.m_tick == tick)
+            {
+                return &snapshot;
+            }
+            if (snapshot.m_tick < tick)
+            {
+                break;
+            }
+        }
+        return nullptr;
+    }
+
+    void SceneStateSnapshots::DiscardSnapshotsAfter(AZ::u64 tick)
+    {
+        while (m_count > 0 && m_snapshots[m_newest].m_tick > tick)
+        {
+            m_snapshots[m_newest].m_tick = SceneStateSnapshot::InvalidTick;
+            m_newest = GetSlot(1);
+            --m_count;
+        }
+    }
+
+    AZ::u64 SceneStateSnapshots::GetOldestTick() const
+    {
+        return m_count > 0 ? m_snapshots[GetSlot(m_count - 1)].m_tick : SceneStateSnapshot::InvalidTick;
+    }
+
+    size_t SceneStateSnapshots::GetSlot(size_t age) const
+    {
+        return (m_newest + m_snapshots.size() - age) % m_snapshots.size();
+    }
+} // namespace PhysX
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+
+#include <foundation/PxTransform.h>
+#include <foundation/PxVec3.h>
+
+namespace physx
+{
+    class PxRigidDynamic;
+}
+
+namespace PhysX
+{
+    //! State of a rigid body needed to continue simulating it from the point it was captured at.
+    struct RigidBodyState
+    {
+        AzPhysics::SimulatedBodyHandle m_bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+        physx::PxTransform m_pose = physx::PxTransform(physx::PxIdentity);
+        physx::PxTransform m_kinematicTarget = physx::PxTransform(physx::PxIdentity);
+        physx::PxVec3 m_linearVelocity = physx::PxVec3(0.0f);
+        physx::PxVec3 m_angularVelocity = physx::PxVec3(0.0f);
+        float m_wakeCounter = 0.0f;
+        bool m_isSleeping = false;
+        bool m_isKinematic = false;
+        bool m_hasKinematicTarget = false;
+
+        //! Captures the state of the actor. The scene of the actor must be locked for read.
+        void Capture(const physx::PxRigidDynamic& pxRigidDynamic);
+        //! Applies the captured state to the actor and clears its accumulated forces. The scene of the actor must be locked for write.
+        void Restore(physx::PxRigidDynamic& pxRigidDynamic) const;
+    };
+
+    //! State of the rigid bodies of a scene at the end of a simulation tick.
+    struct SceneStateSnapshot
+    {
+        static constexpr AZ::u64 InvalidTick = ~static_cast<AZ::u64>(0);
+
+        AZ::u64 m_tick = InvalidTick;
+        //! True when the snapshot only holds some of the rigid bodies of the scene, the others are left as they are when restoring.
+        bool m_isPartial = false;
+        AZStd::vector<RigidBodyState> m_bodies;
+    };
+
+    //! Ring buffer of scene state snapshots, ordered by tick.
+    //! The snapshots are allocated once and reused, so taking a snapshot every tick doesn't allocate once the body
+    //! vectors grew to the number of rigid bodies in the scene.
+    class SceneStateSnapshots
+    {
+    public:
+        //! Allocates capacity snapshots with room for bodyCapacity rigid bodies each, discarding the current snapshots.
+        void Reserve(size_t capacity, size_t bodyCapacity);
+        size_t GetCapacity() const { return m_snapshots.size(); }
+        bool IsEmpty() const { return m_count == 0; }
+
+        //! Returns the snapshot to fill for the tick, reusing the oldest one when the buffer is full.
+        //! Snapshots of the same or later ticks are discarded first, as they belong to a timeline that has been rolled back.
+        SceneStateSnapshot& BeginSnapshot(AZ::u64 tick);
+        //! Returns the snapshot of the tick, or nullptr when it was never captured or has been overwritten.
+        const SceneStateSnapshot* FindSnapshot(AZ::u64 tick) const;
+        //! Discards the snapshots of the ticks after the given tick.
+        void DiscardSnapshotsAfter(AZ::u64 tick);
+        //! Returns the tick of the oldest snapshot still stored, or InvalidTick when there are none.
+        AZ::u64 GetOldestTick() const;
+
+    private:
+        size_t GetSlot(size_t age) const; //!< Returns the slot of the snapshot taken age snapshots before the newest one.
+
+        AZStd::vector<SceneStateSnapshot> m_snapshots;
+        size_t m_newest = 0; //!< Slot of the newest snapshot.
+        size_t m_count = 0; //!< Number of valid snapshots, going back from m_newest.
+    };
+} // namespace PhysX
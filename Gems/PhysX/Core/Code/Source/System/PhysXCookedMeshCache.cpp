@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <System/PhysXCookedMeshCache.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+#include <PxPhysicsAPI.h>
+
+#include <Source/Utils.h>
+
+namespace PhysX
+{
+    AZ_CVAR(bool, physx_cookedMeshDiskCache, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Save the meshes cooked at run-time to disk and load them from there, instead of cooking them again in the next sessions");
+    AZ_CVAR(AZ::CVarFixedString, physx_cookedMeshCacheFolder, "@user@/PhysX/CookedMeshCache", nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The folder the meshes cooked at run-time are saved to");
+    AZ_CVAR(AZ::u32, physx_cookedMeshCacheMemoryBudgetMB, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Size in megabytes of the cooked meshes kept in memory, the memory cache is emptied when it grows past it");
+
+    namespace CookedMeshCacheInternal
+    {
+        //! Header of the cooked mesh files, the rest of the file is the cooked data.
+        struct FileHeader
+        {
+            static constexpr AZ::u32 Magic = 0x4D435850; // "PXCM"
+
+            AZ::u32 m_magic = Magic;
+            AZ::u32 m_dataSize = 0;
+        };
+
+        template<typename T>
+        void AppendBytes(AZStd::vector<AZStd::byte>& bytes, const T& value)
+        {
+            const AZStd::byte* valueBytes = reinterpret_cast<const AZStd::byte*>(&value);
+            bytes.insert(bytes.end(), valueBytes, valueBytes + sizeof(T));
+        }
+
+        // Appends the cooking parameters affecting the cooked data. The fields are appended one by one so padding
+        // bytes don't end up in the key.
+        void AppendCookingParams(AZStd::vector<AZStd::byte>& bytes, const physx::PxCookingParams& params)
+        {
+            AppendBytes(bytes, params.areaTestEpsilon);
+            AppendBytes(bytes, params.planeTolerance);
+            AppendBytes(bytes, static_cast<AZ::u32>(params.convexMeshCookingType));
+            AppendBytes(bytes, params.suppressTriangleMeshRemapTable);
+            AppendBytes(bytes, params.buildTriangleAdjacencies);
+            AppendBytes(bytes, params.buildGPUData);
+            AppendBytes(bytes, params.scale.length);
+            AppendBytes(bytes, params.scale.speed);
+            AppendBytes(bytes, static_cast<physx::PxU32>(params.meshPreprocessParams));
+            AppendBytes(bytes, params.meshWeldTolerance);
+            AppendBytes(bytes, params.gaussMapLimit);
+
+            const physx::PxMeshMidPhase::Enum midPhaseType = params.midphaseDesc.getType();
+            AppendBytes(bytes, static_cast<AZ::u32>(midPhaseType));
+            if (midPhaseType == physx::PxMeshMidPhase::eBVH34)
+            {
+                AppendBytes(bytes, params.midphaseDesc.mBVH34Desc.numPrimsPerLeaf);
+            }
+            else
+            {
+                AppendBytes(bytes, params.midphaseDesc.mBVH33Desc.meshCookingHint);
+                AppendBytes(bytes, params.midphaseDesc.mBVH33Desc.meshSizePerformanceTradeOff);
+            }
+        }
+    } // namespace CookedMeshCacheInternal
+
+    CookedMeshCache::CookedMeshCache(physx::PxCooking* cooking)
+        : m_cooking(cooking)
+    {
+        AZ_Assert(m_cooking, "CookedMeshCache: The cooking interface is null.");
+    }
+
+    CookedMeshCache::~CookedMeshCache()
+    {
+        // The async cook jobs use this object
+        BlockOnPendingCooks();
+    }
+
+    CookedMeshCache::CookedMeshData CookedMeshCache::CookConvexMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount)
+    {
+        return GetOrCook(MeshType::Convex, vertices, vertexCount, nullptr, 0);
+    }
+
+    CookedMeshCache::CookedMeshData CookedMeshCache::CookTriangleMesh(
+        const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount)
+    {
+        return GetOrCook(MeshType::TriangleMesh, vertices, vertexCount, indices, indexCount);
+    }
+
+    void CookedMeshCache::CookConvexMeshAsync(AZStd::vector<AZ::Vector3> vertices, CookedMeshCallback callback)
+    {
+        CookAsync(MeshType::Convex, AZStd::move(vertices), {}, AZStd::move(callback));
+    }
+
+    void CookedMeshCache::CookTriangleMeshAsync(
+        AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices, CookedMeshCallback callback)
+    {
+        CookAsync(MeshType::TriangleMesh, AZStd::move(vertices), AZStd::move(indices), AZStd::move(callback));
+    }
+
+    void CookedMeshCache::BlockOnPendingCooks()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+        m_pendingCooksCondition.wait(lock, [this]() { return m_pendingCookJobCount == 0; });
+    }
+
+    void CookedMeshCache::ClearMemoryCache()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_cookedMeshes.clear();
+        m_cookedMeshesSize = 0;
+    }
+
+    AZ::Uuid CookedMeshCache::GetKey(
+        MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount) const
+    {
+        using namespace CookedMeshCacheInternal;
+
+        AZStd::vector<AZStd::byte> bytes;
+        bytes.reserve(64 + vertexCount * 3 * sizeof(float) + indexCount * sizeof(AZ::u32));
+
+        AppendBytes(bytes, static_cast<AZ::u32>(PX_PHYSICS_VERSION));
+        AppendBytes(bytes, meshType);
+        AppendCookingParams(bytes, m_cooking->getParams());
+
+        // Only the used components, the padding of the vectors is undefined
+        for (AZ::u32 i = 0; i < vertexCount; ++i)
+        {
+            AppendBytes(bytes, vertices[i].GetX());
+            AppendBytes(bytes, vertices[i].GetY());
+            AppendBytes(bytes, vertices[i].GetZ());
+        }
+        if (indexCount > 0)
+        {
+            const AZStd::byte* indexBytes = reinterpret_cast<const AZStd::byte*>(indices);
+            bytes.insert(bytes.end(), indexBytes, indexBytes + indexCount * sizeof(AZ::u32));
+        }
+
+        return AZ::Uuid::CreateData(bytes.data(), bytes.size());
+    }
+
+    CookedMeshCache::CookedMeshData CookedMeshCache::Find(const AZ::Uuid& key)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (auto it = m_cookedMeshes.find(key); it != m_cookedMeshes.end())
+            {
+                return it->second;
+            }
+        }
+
+        if (!physx_cookedMeshDiskCache)
+        {
+            return nullptr;
+        }
+
+        CookedMeshData cookedMesh = ReadFromDisk(key);
+        if (cookedMesh)
+        {
+            Store(key, cookedMesh);
+        }
+        return cookedMesh;
+    }
+
+    void CookedMeshCache::Store(const AZ::Uuid& key, const CookedMeshData& cookedMesh)
+    {
+        const size_t memoryBudget = static_cast<size_t>(static_cast<AZ::u32>(physx_cookedMeshCacheMemoryBudgetMB)) * 1024 * 1024;
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        auto [it, inserted] = m_cookedMeshes.emplace(key, cookedMesh);
+        if (!inserted)
+        {
+            return;
+        }
+
+        m_cookedMeshesSize += cookedMesh->size();
+        if (m_cookedMeshesSize > memoryBudget)
+        {
+            // The users of the evicted meshes keep them alive, so emptying the whole cache is enough here
+            m_cookedMeshes.clear();
+            m_cookedMeshes.emplace(key, cookedMesh);
+            m_cookedMeshesSize = cookedMesh->size();
+        }
+    }
+
+    CookedMeshCache::CookedMeshData CookedMeshCache::Cook(
+        MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount)
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        physx::PxDefaultMemoryOutputStream memoryStream;
+        const bool cookingResult = meshType == MeshType::Convex
+            ? Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream, m_cooking)
+            : Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream, m_cooking);
+        if (!cookingResult)
+        {
+            return nullptr;
+        }
+
+        return AZStd::make_shared<AZStd::vector<AZ::u8>>(memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+    }
+
+    CookedMeshCache::CookedMeshData CookedMeshCache::GetOrCook(
+        MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount)
+    {
+        const AZ::Uuid key = GetKey(meshType, vertices, vertexCount, indices, indexCount);
+        if (CookedMeshData cookedMesh = Find(key))
+        {
+            return cookedMesh;
+        }
+
+        CookedMeshData cookedMesh = Cook(meshType, vertices, vertexCount, indices, indexCount);
+        if (cookedMesh)
+        {
+            Store(key, cookedMesh);
+            if (physx_cookedMeshDiskCache)
+            {
+                WriteToDisk(key, *cookedMesh);
+            }
+        }
+        return cookedMesh;
+    }
+
+    void CookedMeshCache::CookAsync(
+        MeshType meshType, AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices, CookedMeshCallback callback)
+    {
+        const AZ::Uuid key = GetKey(meshType, vertices.data(), aznumeric_cast<AZ::u32>(vertices.size()), indices.data(),
+            aznumeric_cast<AZ::u32>(indices.size()));
+
+        CookedMeshData cookedMesh;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (auto it = m_cookedMeshes.find(key); it != m_cookedMeshes.end())
+            {
+                cookedMesh = it->second;
+            }
+            else if (auto pendingIt = m_pendingCooks.find(key); pendingIt != m_pendingCooks.end())
+            {
+                pendingIt->second.push_back(AZStd::move(callback));
+                return;
+            }
+            else
+            {
+                m_pendingCooks[key].push_back(AZStd::move(callback));
+                ++m_pendingCookJobCount;
+            }
+        }
+
+        if (cookedMesh)
+        {
+            if (callback)
+            {
+                callback(AZStd::move(cookedMesh));
+            }
+            return;
+        }
+
+        const bool autoDelete = true;
+        AZ::Job* cookJob = AZ::CreateJobFunction(
+            [this, key, meshType, vertices = AZStd::move(vertices), indices = AZStd::move(indices)]()
+            {
+                const AZ::u32 vertexCount = aznumeric_cast<AZ::u32>(vertices.size());
+                const AZ::u32 indexCount = aznumeric_cast<AZ::u32>(indices.size());
+
+                CookedMeshData cookedMesh = Find(key);
+                if (!cookedMesh)
+                {
+                    cookedMesh = Cook(meshType, vertices.data(), vertexCount, indices.data(), indexCount);
+                    if (cookedMesh)
+                    {
+                        Store(key, cookedMesh);
+                        if (physx_cookedMeshDiskCache)
+                        {
+                            WriteToDisk(key, *cookedMesh);
+                        }
+                    }
+                }
+
+                AZStd::vector<CookedMeshCallback> callbacks;
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    if (auto pendingIt = m_pendingCooks.find(key); pendingIt != m_pendingCooks.end())
+                    {
+                        callbacks = AZStd::move(pendingIt->second);
+                        m_pendingCooks.erase(pendingIt);
+                    }
+                }
+                for (CookedMeshCallback& pendingCallback : callbacks)
+                {
+                    if (pendingCallback)
+                    {
+                        pendingCallback(cookedMesh);
+                    }
+                }
+
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    --m_pendingCookJobCount;
+                }
+                m_pendingCooksCondition.notify_all();
+            },
+            autoDelete);
+        cookJob->Start();
+    }
+
+    AZStd::string CookedMeshCache::GetCacheFilePath(const AZ::Uuid& key) const
+    {
+        const AZ::CVarFixedString cacheFolder = physx_cookedMeshCacheFolder;
+        AZ::IO::FixedMaxPath filePath = cacheFolder.c_str();
+        filePath /= key.ToFixedString(false, false).c_str();
+        filePath.ReplaceExtension(".pxcooked");
+
+        if (auto* fileIOBase = AZ::IO::FileIOBase::GetInstance())
+        {
+            char resolvedPath[AZ_MAX_PATH_LEN];
+            if (fileIOBase->ResolvePath(filePath.c_str(), resolvedPath, AZ_MAX_PATH_LEN))
+            {
+                return resolvedPath;
+            }
+        }
+        return filePath.c_str();
+    }
+
+    CookedMeshCache::CookedMeshData CookedMeshCache::ReadFromDisk(const AZ::Uuid& key) const
+    {
+        using namespace CookedMeshCacheInternal;
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        const AZStd::string filePath = GetCacheFilePath(key);
+        if (!fileIO || !fileIO->Exists(filePath.c_str()))
+        {
+            return nullptr;
+        }
+
+        AZStd::vector<AZ::u8> fileData;
+        if (!Utils::ReadFile(filePath, fileData))
+        {
+            return nullptr;
+        }
+
+        FileHeader header;
+        if (fileData.size() < sizeof(FileHeader))
+        {
+            header.m_magic = 0;
+        }
+        else
+        {
+            memcpy(&header, fileData.data(), sizeof(FileHeader));
+        }
+        if (header.m_magic != FileHeader::Magic || header.m_dataSize != fileData.size() - sizeof(FileHeader))
+        {
+            // Most likely a file left incomplete by a crash, it is overwritten by the next cook
+            AZ_Warning("PhysX", false, "CookedMeshCache: Ignoring the invalid cooked mesh file '%s'.", filePath.c_str());
+            return nullptr;
+        }
+
+        return AZStd::make_shared<AZStd::vector<AZ::u8>>(fileData.begin() + sizeof(FileHeader), fileData.end());
+    }
+
+    void CookedMeshCache::WriteToDisk(const AZ::Uuid& key, const AZStd::vector<AZ::u8>& cookedMesh) const
+    {
+        using namespace CookedMeshCacheInternal;
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (!fileIO)
+        {
+            return;
+        }
+
+        const AZStd::string filePath = GetCacheFilePath(key);
+        const AZ::IO::FixedMaxPath cacheFolder = AZ::IO::PathView(filePath).ParentPath();
+        fileIO->CreatePath(cacheFolder.c_str());
+
+        AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+        if (!fileIO->Open(filePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, fileHandle))
+        {
+            AZ_Warning("PhysX", false, "CookedMeshCache: Failed to open '%s' for writing.", filePath.c_str());
+            return;
+        }
+
+        FileHeader header;
+        header.m_dataSize = aznumeric_cast<AZ::u32>(cookedMesh.size());
+        const bool written = fileIO->Write(fileHandle, &header, sizeof(FileHeader)) &&
+            fileIO->Write(fileHandle, cookedMesh.data(), cookedMesh.size());
+        fileIO->Close(fileHandle);
+
+        AZ_Warning("PhysX", written, "CookedMeshCache: Failed to write the cooked mesh file '%s'.", filePath.c_str());
+    }
+} // namespace PhysX
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace physx
+{
+    class PxCooking;
+}
+
+namespace PhysX
+{
+    //! Cache of cooked convex and triangle meshes, keyed by a hash of the geometry and the cooking parameters.
+    //! Cooked meshes are kept in memory for the session and written to a folder on disk, so the same geometry is
+    //! only cooked once across runs. Meshes can also be cooked on background jobs ahead of the colliders using them,
+    //! for example while a level streams in, so creating the colliders later only hits the cache.
+    class CookedMeshCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CookedMeshCache, AZ::SystemAllocator);
+
+        using CookedMeshData = AZStd::shared_ptr<const AZStd::vector<AZ::u8>>;
+        //! Called with the cooked data, or nullptr when cooking failed.
+        //! Async cooks call it on a job thread, or on the calling thread when the mesh is already held in memory.
+        using CookedMeshCallback = AZStd::function<void(CookedMeshData)>;
+
+        explicit CookedMeshCache(physx::PxCooking* cooking);
+        ~CookedMeshCache();
+
+        //! Returns the cooked convex hull of the vertices, from the cache or cooked on the calling thread.
+        CookedMeshData CookConvexMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount);
+        //! Returns the cooked triangle mesh, from the cache or cooked on the calling thread.
+        CookedMeshData CookTriangleMesh(const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount);
+
+        //! Cooks the convex hull of the vertices on a background job. Concurrent requests for the same geometry share one cook.
+        void CookConvexMeshAsync(AZStd::vector<AZ::Vector3> vertices, CookedMeshCallback callback = {});
+        //! Cooks the triangle mesh on a background job. Concurrent requests for the same geometry share one cook.
+        void CookTriangleMeshAsync(AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices, CookedMeshCallback callback = {});
+
+        //! Waits for all the async cooks to finish.
+        void BlockOnPendingCooks();
+        //! Releases the cooked meshes held in memory. The disk cache is left as it is.
+        void ClearMemoryCache();
+
+    private:
+        enum class MeshType : AZ::u8
+        {
+            Convex,
+            TriangleMesh
+        };
+
+        AZ::Uuid GetKey(MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount) const;
+        //! Returns the cooked mesh from memory or the disk cache, or nullptr when it isn't cached.
+        CookedMeshData Find(const AZ::Uuid& key);
+        void Store(const AZ::Uuid& key, const CookedMeshData& cookedMesh);
+        CookedMeshData Cook(MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount);
+        CookedMeshData GetOrCook(MeshType meshType, const AZ::Vector3* vertices, AZ::u32 vertexCount, const AZ::u32* indices, AZ::u32 indexCount);
+        void CookAsync(MeshType meshType, AZStd::vector<AZ::Vector3> vertices, AZStd::vector<AZ::u32> indices, CookedMeshCallback callback);
+
+        AZStd::string GetCacheFilePath(const AZ::Uuid& key) const;
+        CookedMeshData ReadFromDisk(const AZ::Uuid& key) const;
+        void WriteToDisk(const AZ::Uuid& key, const AZStd::vector<AZ::u8>& cookedMesh) const;
+
+        physx::PxCooking* m_cooking = nullptr;
+
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZ::Uuid, CookedMeshData> m_cookedMeshes;
+        size_t m_cookedMeshesSize = 0; //!< Total size in bytes of the cooked meshes held in memory.
+        //! Callbacks of the async cooks waiting for an in-flight cook of the same geometry.
+        AZStd::unordered_map<AZ::Uuid, AZStd::vector<CookedMeshCallback>> m_pendingCooks;
+        AZStd::condition_variable m_pendingCooksCondition;
+        size_t m_pendingCookJobCount = 0;
+    };
+} // namespace PhysX
@@ -36,6 +36,11 @@ namespace PhysX
         "True: Sync entity transform once per Simulate call. "
         "False: Sync entity transform for every simulation sub-step.");
 
+    AZ_CVAR(bool, physx_deterministicSimulation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Simulate the scenes deterministically, for rolling back and resimulating them with the scene state snapshots. "
+        "The scenes always step by the fixed timestep, using the default one when the configuration has none, and the scenes "
+        "created afterwards use the PhysX enhanced determinism, so the results of an island don't depend on the rest of the scene.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystem, AZ::SystemAllocator);
 
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
@@ -222,17 +227,23 @@ namespace PhysX
 
         AZ_Assert(m_systemConfig.m_fixedTimestep >= 0.0f, "PhysXSystem - fixed timestep is negitive.");
         float tickTime = deltaTime;
-        if (m_systemConfig.m_fixedTimestep > 0.0f) //use the fixed timestep
+        float fixedTimestep = m_systemConfig.m_fixedTimestep;
+        if (physx_deterministicSimulation && fixedTimestep <= 0.0f)
+        {
+            // Variable steps can't be replayed with the same results, so deterministic scenes always use fixed steps
+            fixedTimestep = AzPhysics::SystemConfiguration::DefaultFixedTimestep;
+        }
+        if (fixedTimestep > 0.0f) //use the fixed timestep
         {
             m_accumulatedTime += tickTime;
             //divide accumulated time by the fixed step and floor it to get the number of steps that would occur. Then multiply by fixedTimeStep to get the total executed time.
-            tickTime = AZStd::floorf(m_accumulatedTime / m_systemConfig.m_fixedTimestep) * m_systemConfig.m_fixedTimestep;
+            tickTime = AZStd::floorf(m_accumulatedTime / fixedTimestep) * fixedTimestep;
             m_preSimulateEvent.Signal(tickTime);
 
-            while (m_accumulatedTime >= m_systemConfig.m_fixedTimestep)
+            while (m_accumulatedTime >= fixedTimestep)
             {
-                simulateScenes(m_systemConfig.m_fixedTimestep);
-                m_accumulatedTime -= m_systemConfig.m_fixedTimestep;
+                simulateScenes(fixedTimestep);
+                m_accumulatedTime -= fixedTimestep;
             }
         }
         else
@@ -454,6 +465,7 @@ namespace PhysX
 
         // set up cooking for height fields, meshes etc.
         m_physXSdk.m_cooking = PxCreateCooking(PX_PHYSICS_VERSION, *m_physXSdk.m_foundation, cookingParams);
+        m_cookedMeshCache = AZStd::make_unique<CookedMeshCache>(m_physXSdk.m_cooking);
 
         // Set up CPU dispatcher
         m_cpuDispatcher = PhysXCpuDispatcherCreate();
@@ -466,6 +478,8 @@ namespace PhysX
         delete m_cpuDispatcher;
         m_cpuDispatcher = nullptr;
 
+        // Waits for the async cooks using the cooking interface
+        m_cookedMeshCache.reset();
         m_physXSdk.m_cooking->release();
         m_physXSdk.m_cooking = nullptr;
 
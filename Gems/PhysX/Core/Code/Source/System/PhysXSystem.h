@@ -17,6 +17,7 @@
 #include <Debug/PhysXDebug.h>
 #include <Scene/PhysXSceneInterface.h>
 #include <System/PhysXAllocator.h>
+#include <System/PhysXCookedMeshCache.h>
 #include <System/PhysXSdkCallbacks.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
@@ -76,6 +77,8 @@ namespace PhysX
         //TEMP -- until these are fully moved over here
         physx::PxPhysics* GetPxPhysics() { return m_physXSdk.m_physics; }
         physx::PxCooking* GetPxCooking() { return m_physXSdk.m_cooking; }
+        //! Accessor to the cache of the meshes cooked at run-time.
+        CookedMeshCache* GetCookedMeshCache() { return m_cookedMeshCache.get(); }
         physx::PxCpuDispatcher* GetPxCpuDispathcher()
         {
             AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
@@ -110,6 +113,7 @@ namespace PhysX
             physx::PxCooking* m_cooking = nullptr;
         };
         PhysXSdk m_physXSdk;
+        AZStd::unique_ptr<CookedMeshCache> m_cookedMeshCache;
         PxAzAllocatorCallback m_physXAllocatorCallback;
         PxAzErrorCallback m_physXErrorCallback;
         PxAzProfilerCallback m_pxAzProfilerCallback;
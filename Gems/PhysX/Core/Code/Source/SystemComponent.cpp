@@ -294,30 +294,29 @@ namespace PhysX
 
     bool SystemComponent::CookConvexMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
+        // The cache skips cooking geometry that was already cooked in this session or a previous one
+        CookedMeshCache::CookedMeshData cookedMesh = m_physXSystem->GetCookedMeshCache()->CookConvexMesh(vertices, vertexCount);
         
-        bool cookingResult = Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream);
-        
-        if(cookingResult)
+        if (cookedMesh)
         {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            result.insert(result.end(), cookedMesh->begin(), cookedMesh->end());
         }
         
-        return cookingResult;
+        return cookedMesh != nullptr;
     }
 
     bool SystemComponent::CookTriangleMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount,
         const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        bool cookingResult = Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream);
+        CookedMeshCache::CookedMeshData cookedMesh =
+            m_physXSystem->GetCookedMeshCache()->CookTriangleMesh(vertices, vertexCount, indices, indexCount);
 
-        if (cookingResult)
+        if (cookedMesh)
         {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            result.insert(result.end(), cookedMesh->begin(), cookedMesh->end());
         }
 
-        return cookingResult;
+        return cookedMesh != nullptr;
     }
 
     physx::PxConvexMesh* SystemComponent::CreateConvexMeshFromCooked(const void* cookedMeshData, AZ::u32 bufferSize)
@@ -766,10 +766,13 @@ namespace PhysX
             return AZ::Utils::SaveObjectToFile(filePath, AZ::DataStream::ST_BINARY, &assetData, serializeContext);
         }
 
-        bool CookConvexToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount, physx::PxOutputStream& stream)
+        bool CookConvexToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount, physx::PxOutputStream& stream,
+            physx::PxCooking* cooking)
         {
-            physx::PxCooking* cooking = nullptr;
-            SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
+            if (!cooking)
+            {
+                SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
+            }
 
             physx::PxConvexMeshDesc convexDesc;
             convexDesc.points.count = vertexCount;
@@ -789,10 +792,12 @@ namespace PhysX
         }
 
         bool CookTriangleMeshToToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount,
-            const AZ::u32* indices, AZ::u32 indexCount, physx::PxOutputStream& stream)
+            const AZ::u32* indices, AZ::u32 indexCount, physx::PxOutputStream& stream, physx::PxCooking* cooking)
         {
-            physx::PxCooking* cooking = nullptr;
-            SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
+            if (!cooking)
+            {
+                SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
+            }
 
             // Validate indices size
             AZ_Error("PhysX", indexCount % 3 == 0, "Number of indices must be a multiple of 3.");
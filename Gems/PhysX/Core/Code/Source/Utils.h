@@ -104,10 +104,12 @@ namespace PhysX
         bool WriteCookedMeshToFile(const AZStd::string& filePath, const AZStd::vector<AZ::u8>& physxData, 
             Physics::CookedMeshShapeConfiguration::MeshType meshType);
 
-        bool CookConvexToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount, physx::PxOutputStream& stream);
+        //! The cooking functions use the cooking interface of the PhysX system when cooking is nullptr.
+        bool CookConvexToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount, physx::PxOutputStream& stream,
+            physx::PxCooking* cooking = nullptr);
 
         bool CookTriangleMeshToToPxOutputStream(const AZ::Vector3* vertices, AZ::u32 vertexCount,
-            const AZ::u32* indices, AZ::u32 indexCount, physx::PxOutputStream& stream);
+            const AZ::u32* indices, AZ::u32 indexCount, physx::PxOutputStream& stream, physx::PxCooking* cooking = nullptr);
 
         bool MeshDataToPxGeometry(physx::PxBase* meshData, physx::PxGeometryHolder &pxGeometry, const AZ::Vector3& scale);
 
@@ -19,6 +19,7 @@
 #include <PhysX/SystemComponentBus.h>
 #include <Source/SphereColliderComponent.h>
 #include <Source/CapsuleColliderComponent.h>
+#include <Scene/PhysXScene.h>
 #include <System/PhysXSystem.h>
 #include <Tests/PhysXTestFixtures.h>
 #include <Tests/PhysXTestUtil.h>
@@ -176,6 +177,30 @@ namespace PhysX
         }
     }
 
+    TEST_F(PhysXDefaultWorldTest, CharacterController_MoveCharacters_ReturnsOneResultPerRequest)
+    {
+        ControllerTestBasis basis(m_testSceneHandle);
+        basis.Update(AZ::Vector3::CreateZero());
+        auto* scene = azdynamic_cast<PhysXScene*>(basis.m_testScene);
+        ASSERT_NE(scene, nullptr);
+
+        const AZ::Vector3 startPosition = basis.m_controller->GetBasePosition();
+        const AZ::Vector3 displacement = AZ::Vector3::CreateAxisX(0.1f);
+        const CharacterMoveRequest requests[] = {
+            { basis.m_controller->m_bodyHandle, displacement, basis.m_timeStep },
+            { AzPhysics::InvalidSimulatedBodyHandle, displacement, basis.m_timeStep }
+        };
+        AZStd::vector<CharacterMoveResult> results;
+        scene->MoveCharacters(requests, results);
+
+        ASSERT_EQ(results.size(), 2);
+        EXPECT_TRUE(results[0].m_isValid);
+        EXPECT_TRUE(results[0].m_basePosition.IsClose(startPosition + displacement));
+        EXPECT_TRUE(results[0].m_basePosition.IsClose(basis.m_controller->GetBasePosition()));
+        EXPECT_TRUE(results[0].m_observedVelocity.IsClose(displacement / basis.m_timeStep));
+        EXPECT_FALSE(results[1].m_isValid);
+    }
+
     TEST_F(PhysXDefaultWorldTest, CharacterController_MovingDirectlyTowardsStaticBox_StoppedByBox)
     {
         ControllerTestBasis basis(m_testSceneHandle);
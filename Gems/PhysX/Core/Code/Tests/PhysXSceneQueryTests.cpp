@@ -938,6 +938,43 @@ namespace PhysX
         }
     }
 
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_ManyRequests_ReturnsHitsInRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup a row of bodies far enough apart to be in different query cells
+        constexpr size_t numBodies = 10;
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (size_t i = 0; i < numBodies; ++i)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(20.0f * i, 0.0f, 0.0f), 1.0f));
+        }
+
+        //create more requests than a single batch query task runs, alternating between the bodies
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < 200; ++i)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3(20.0f * (i % numBodies), 0.0f, 10.0f);
+            request->m_direction = AZ::Vector3(0.0f, 0.0f, -1.0f);
+            request->m_distance = 20.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run the query twice into the same results
+        AzPhysics::SceneQueryHitsList results;
+        for (int run = 0; run < 2; ++run)
+        {
+            EXPECT_TRUE(sceneInterface->QuerySceneBatch(m_testSceneHandle, requests, results));
+            ASSERT_EQ(results.size(), requests.size());
+            for (size_t i = 0; i < results.size(); i++)
+            {
+                ASSERT_EQ(results[i].m_hits.size(), 1);
+                EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i % numBodies]);
+            }
+        }
+    }
+
     TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_MultipleHits_ReturnsExpectedHits)
     {
         auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
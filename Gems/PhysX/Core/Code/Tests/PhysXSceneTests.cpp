@@ -7,10 +7,15 @@
  */
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
+#include <Scene/PhysXScene.h>
 
+#include <AZTestShared/Math/MathTestHelpers.h>
+#include <AZTestShared/Utils/Utils.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 
 namespace PhysX
 {
@@ -588,4 +593,126 @@ namespace PhysX
 
         EXPECT_TRUE(handlerTriggered);
     }
+
+    //setup a test scene split in two shards, one for negative and one for positive X positions
+    class PhysXShardedSceneFixture
+        : public PhysXSceneFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("physx_sceneShardCount 2");
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("physx_sceneShardSize 20");
+            PhysXSceneFixture::SetUp();
+        }
+        void TearDown() override
+        {
+            PhysXSceneFixture::TearDown();
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("physx_sceneShardCount 1");
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("physx_sceneShardSize 512");
+        }
+
+        physx::PxScene* GetPxScene(const AzPhysics::SimulatedBody* body) const
+        {
+            return static_cast<physx::PxActor*>(body->GetNativePointer())->getScene();
+        }
+    };
+
+    TEST_F(PhysXShardedSceneFixture, RigidBodies_CollideWithStaticsInAllShards)
+    {
+        auto* scene = azdynamic_cast<PhysXScene*>(AZ::Interface<AzPhysics::SystemInterface>::Get()->GetScene(m_testSceneHandle));
+        ASSERT_NE(scene, nullptr);
+        EXPECT_EQ(scene->GetNumShards(), 2);
+
+        TestUtils::AddStaticFloorToScene(m_testSceneHandle);
+        AzPhysics::RigidBody* negativeBox = TestUtils::AddUnitBoxToScene(m_testSceneHandle, AZ::Vector3(-5.0f, 0.0f, 2.0f));
+        AzPhysics::RigidBody* positiveBox = TestUtils::AddUnitBoxToScene(m_testSceneHandle, AZ::Vector3(5.0f, 0.0f, 2.0f));
+        EXPECT_EQ(GetPxScene(negativeBox), scene->GetNativePointer());
+        EXPECT_NE(GetPxScene(positiveBox), scene->GetNativePointer());
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 60);
+
+        // Both boxes landed on the floor, which is only in the first shard
+        EXPECT_NEAR(negativeBox->GetPosition().GetZ(), 1.0f, 0.05f);
+        EXPECT_NEAR(positiveBox->GetPosition().GetZ(), 1.0f, 0.05f);
+    }
+
+    TEST_F(PhysXShardedSceneFixture, RigidBodies_MoveBetweenShards)
+    {
+        auto* scene = azdynamic_cast<PhysXScene*>(AZ::Interface<AzPhysics::SystemInterface>::Get()->GetScene(m_testSceneHandle));
+        ASSERT_NE(scene, nullptr);
+
+        AzPhysics::RigidBody* box = TestUtils::AddUnitBoxToScene(m_testSceneHandle, AZ::Vector3(-3.0f, 0.0f, 0.0f));
+        box->SetGravityEnabled(false);
+        box->SetLinearVelocity(AZ::Vector3(10.0f, 0.0f, 0.0f));
+        EXPECT_EQ(GetPxScene(box), scene->GetNativePointer());
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 60);
+
+        EXPECT_GT(box->GetPosition().GetX(), 5.0f);
+        EXPECT_NE(GetPxScene(box), scene->GetNativePointer());
+        EXPECT_GT(box->GetLinearVelocity().GetX(), 9.0f);
+    }
+
+    TEST_F(PhysXShardedSceneFixture, SceneQueries_HitBodiesInAllShards)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        TestUtils::AddUnitBoxToScene(m_testSceneHandle, AZ::Vector3(-5.0f, 0.0f, 0.0f));
+        AzPhysics::RigidBody* positiveBox = TestUtils::AddUnitBoxToScene(m_testSceneHandle, AZ::Vector3(5.0f, 0.0f, 0.0f));
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3(20.0f, 0.0f, 0.0f);
+        request.m_direction = AZ::Vector3(-1.0f, 0.0f, 0.0f);
+        request.m_distance = 50.0f;
+        request.m_reportMultipleHits = true;
+        AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(m_testSceneHandle, &request);
+        EXPECT_EQ(hits.m_hits.size(), 2);
+
+        // Only the closest hit of all the shards is reported
+        request.m_reportMultipleHits = false;
+        hits = sceneInterface->QueryScene(m_testSceneHandle, &request);
+        ASSERT_EQ(hits.m_hits.size(), 1);
+        EXPECT_EQ(hits.m_hits[0].m_bodyHandle, positiveBox->m_bodyHandle);
+    }
 }
+
+    TEST_F(PhysXSceneFixture, Resimulate_FromStateSnapshot_ReachesSameState)
+    {
+        auto* scene = azdynamic_cast<PhysXScene*>(AZ::Interface<AzPhysics::SystemInterface>::Get()->GetScene(m_testSceneHandle));
+        ASSERT_NE(scene, nullptr);
+
+        TestUtils::AddStaticFloorToScene(m_testSceneHandle);
+        AzPhysics::RigidBody* box = TestUtils::AddUnitBoxToScene(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 5.0f));
+        box->SetLinearVelocity(AZ::Vector3(2.0f, 0.0f, 0.0f));
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 10);
+        const AZ::u64 savedTick = scene->GetSimulationTick();
+        EXPECT_EQ(savedTick, 10);
+        scene->SaveStateSnapshot();
+        const AZ::Vector3 savedPosition = box->GetPosition();
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 30);
+        const AZ::Vector3 expectedPosition = box->GetPosition();
+        const AZ::Vector3 expectedVelocity = box->GetLinearVelocity();
+
+        ASSERT_TRUE(scene->RestoreStateSnapshot(savedTick));
+        EXPECT_EQ(scene->GetSimulationTick(), savedTick);
+        EXPECT_THAT(box->GetPosition(), UnitTest::IsClose(savedPosition));
+
+        AZ::u32 numPreStepCalls = 0;
+        EXPECT_TRUE(scene->Resimulate(savedTick, 30, AzPhysics::SystemConfiguration::DefaultFixedTimestep,
+            [&numPreStepCalls, savedTick](AZ::u64 tick)
+            {
+                EXPECT_EQ(tick, savedTick + numPreStepCalls);
+                ++numPreStepCalls;
+            }));
+        EXPECT_EQ(numPreStepCalls, 30);
+        EXPECT_EQ(scene->GetSimulationTick(), savedTick + 30);
+        EXPECT_THAT(box->GetPosition(), UnitTest::IsCloseTolerance(expectedPosition, 1e-2f));
+        EXPECT_THAT(box->GetLinearVelocity(), UnitTest::IsCloseTolerance(expectedVelocity, 1e-2f));
+
+        // Each resimulated tick saved a snapshot, the rolled back timeline after the last one is gone
+        EXPECT_TRUE(scene->RestoreStateSnapshot(savedTick + 15));
+        UnitTest::ErrorHandler errorHandler("There's no snapshot of tick");
+        EXPECT_FALSE(scene->RestoreStateSnapshot(savedTick + 16));
+    }
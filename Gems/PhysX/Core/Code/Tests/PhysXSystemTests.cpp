@@ -8,11 +8,14 @@
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
+#include <System/PhysXCookedMeshCache.h>
+#include <System/PhysXSystem.h>
 
 namespace PhysX
 {
@@ -328,4 +331,39 @@ namespace PhysX
         physicsSystem->RemoveScenes(sceneHandles);
         EXPECT_EQ(removedCount, m_sceneConfigs.size());
     }
+
+    TEST_F(PhysXSystemFixture, CookedMeshCache_SameGeometry_CooksOnce)
+    {
+        AZ::Interface<AZ::IConsole>::Get()->PerformCommand("physx_cookedMeshDiskCache false");
+
+        const AZStd::vector<AZ::Vector3> vertices = {
+            AZ::Vector3(0.0f, 0.0f, 0.0f), AZ::Vector3(1.0f, 0.0f, 0.0f), AZ::Vector3(0.0f, 1.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 1.0f), AZ::Vector3(1.0f, 1.0f, 1.0f)
+        };
+        AZStd::vector<AZ::Vector3> scaledVertices = vertices;
+        scaledVertices[4] *= 2.0f;
+
+        CookedMeshCache* cache = GetPhysXSystem()->GetCookedMeshCache();
+        ASSERT_NE(cache, nullptr);
+
+        CookedMeshCache::CookedMeshData cookedMesh;
+        cache->CookConvexMeshAsync(vertices,
+            [&cookedMesh](CookedMeshCache::CookedMeshData data)
+            {
+                cookedMesh = AZStd::move(data);
+            });
+        cache->BlockOnPendingCooks();
+        ASSERT_NE(cookedMesh, nullptr);
+        EXPECT_FALSE(cookedMesh->empty());
+
+        // The same geometry returns the data cooked in the background, other geometry is cooked again
+        EXPECT_EQ(cache->CookConvexMesh(vertices.data(), aznumeric_cast<AZ::u32>(vertices.size())), cookedMesh);
+        CookedMeshCache::CookedMeshData otherCookedMesh =
+            cache->CookConvexMesh(scaledVertices.data(), aznumeric_cast<AZ::u32>(scaledVertices.size()));
+        ASSERT_NE(otherCookedMesh, nullptr);
+        EXPECT_NE(otherCookedMesh, cookedMesh);
+
+        cache->ClearMemoryCache();
+        AZ::Interface<AZ::IConsole>::Get()->PerformCommand("physx_cookedMeshDiskCache true");
+    }
 }
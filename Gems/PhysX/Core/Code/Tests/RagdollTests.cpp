@@ -318,6 +318,42 @@ namespace PhysX
         EXPECT_NEAR(minZ, 0.0f, 0.05f);
     }
 
+    TEST_F(PhysXDefaultWorldTest, Ragdoll_SettledOnStaticFloor_FreezesAndStaysSimulated)
+    {
+        AZ::Transform floorTransform = AZ::Transform::CreateTranslation(AZ::Vector3::CreateAxisZ(-0.5f));
+        PhysX::TestUtils::AddStaticFloorToScene(m_testSceneHandle, floorTransform);
+        auto ragdoll = CreateRagdoll(m_testSceneHandle);
+        ragdoll->EnableSimulation(GetTPose());
+        // Unpowered simulated nodes let the ragdoll freeze once it settles
+        ragdoll->SetState(GetTPose());
+
+        TestUtils::UpdateScene(m_defaultScene, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 600);
+
+        EXPECT_TRUE(ragdoll->IsSimulated());
+        const float settledMinZ = ragdoll->GetAabb().GetMin().GetZ();
+        EXPECT_NEAR(settledMinZ, 0.0f, 0.05f);
+        for (size_t nodeIndex = 0; nodeIndex < ragdoll->GetNumNodes(); nodeIndex++)
+        {
+            physx::PxRigidDynamic* pxActor = ragdoll->GetPxRigidDynamic(nodeIndex);
+            PHYSX_SCENE_READ_LOCK(pxActor->getScene());
+            EXPECT_TRUE(pxActor->getRigidBodyFlags().isSet(physx::PxRigidBodyFlag::eKINEMATIC));
+        }
+
+        // Powered nodes follow the animation again
+        Physics::RagdollState poweredPose = GetTPose();
+        for (Physics::RagdollNodeState& nodeState : poweredPose)
+        {
+            nodeState.m_strength = 1.0f;
+        }
+        ragdoll->SetState(poweredPose);
+        for (size_t nodeIndex = 0; nodeIndex < ragdoll->GetNumNodes(); nodeIndex++)
+        {
+            physx::PxRigidDynamic* pxActor = ragdoll->GetPxRigidDynamic(nodeIndex);
+            PHYSX_SCENE_READ_LOCK(pxActor->getScene());
+            EXPECT_FALSE(pxActor->getRigidBodyFlags().isSet(physx::PxRigidBodyFlag::eKINEMATIC));
+        }
+    }
+
     TEST(ComputeHierarchyDepthsTest, DepthValuesCorrect)
     {
         AZStd::vector<size_t> parentIndices =
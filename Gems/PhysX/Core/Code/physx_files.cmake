@@ -142,8 +142,12 @@ set(FILES
     Source/Scene/PhysXSceneSimulationEventCallback.cpp
     Source/Scene/PhysXSceneSimulationFilterCallback.h
     Source/Scene/PhysXSceneSimulationFilterCallback.cpp
+    Source/Scene/PhysXSceneStateSnapshots.h
+    Source/Scene/PhysXSceneStateSnapshots.cpp
     Source/System/PhysXAllocator.h
     Source/System/PhysXAllocator.cpp
+    Source/System/PhysXCookedMeshCache.h
+    Source/System/PhysXCookedMeshCache.cpp
     Source/System/PhysXCookingParams.h
     Source/System/PhysXCookingParams.cpp
     Source/System/PhysXCpuDispatcher.cpp
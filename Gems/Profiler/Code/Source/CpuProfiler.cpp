@@ -241,6 +241,14 @@ namespace Profiler
 
         // Update our saved time regions to the last frame's collected data
         m_timeRegionMap = AZStd::move(newMap);
+
+        lock.unlock();
+        m_frameCollectedEvent.Signal(m_timeRegionMap);
+    }
+
+    void CpuProfiler::ConnectFrameCollectedHandler(FrameCollectedEvent::Handler& handler)
+    {
+        handler.Connect(m_frameCollectedEvent);
     }
 
     void CpuProfiler::RegisterThreadStorage()
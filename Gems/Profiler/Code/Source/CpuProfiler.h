@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/EBus/Event.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/RTTI/RTTI.h>
@@ -133,6 +134,9 @@ namespace Profiler
         AZ_RTTI(CpuProfiler, "{10E9D394-FC83-4B45-B2B8-807C6BF07BF0}", AZ::Debug::Profiler);
         AZ_CLASS_ALLOCATOR(CpuProfiler, AZ::SystemAllocator);
 
+        //! Signaled on the main thread each time the regions of all the registered threads have been collected.
+        using FrameCollectedEvent = AZ::Event<const TimeRegionMap&>;
+
         CpuProfiler() = default;
         ~CpuProfiler() = default;
 
@@ -159,6 +163,9 @@ namespace Profiler
         void SetProfilerEnabled(bool enabled);
         bool IsProfilerEnabled() const;
 
+        //! Connects a handler that receives the regions of each frame as they are collected, while the profiler is enabled.
+        void ConnectFrameCollectedHandler(FrameCollectedEvent::Handler& handler);
+
         //! AZ::SystemTickBus::Handler overrides
         //! When fired, the profiler collects all profiling data from registered threads and updates
         //! m_timeRegionMap so that the next frame has up-to-date profiling data.
@@ -197,6 +204,8 @@ namespace Profiler
         // Stores multiple frames of profiling data, size is controlled by MaxFramesToSave. Flushed when EndContinuousCapture is called.
         // Ring buffer so that we can have fast append of new data + removal of old profiling data with good cache locality.
         AZStd::ring_buffer<TimeRegionMap> m_continuousCaptureData;
+
+        FrameCollectedEvent m_frameCollectedEvent;
     };
 
     // Intermediate class to serialize Cpu TimedRegion data.
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CpuProfilerStreamer.h>
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/time.h>
+
+namespace Profiler
+{
+    namespace
+    {
+        // Region names are formatted from the arguments of the profiler markers, so they may need escaping.
+        void AppendJsonString(AZStd::string& buffer, AZStd::string_view text)
+        {
+            buffer.push_back('"');
+            for (const char character : text)
+            {
+                if (character == '"' || character == '\\')
+                {
+                    buffer.push_back('\\');
+                    buffer.push_back(character);
+                }
+                else if (static_cast<unsigned char>(character) < 0x20)
+                {
+                    buffer += AZStd::string::format("\\u%04x", static_cast<unsigned>(character));
+                }
+                else
+                {
+                    buffer.push_back(character);
+                }
+            }
+            buffer.push_back('"');
+        }
+    } // namespace
+
+    // --- TraceEventFile ---
+
+    bool TraceEventFile::Open(const AZStd::string& filePath)
+    {
+        AZ::IO::FixedMaxPath resolvedPath(filePath);
+        if (auto* fileIo = AZ::IO::FileIOBase::GetInstance(); fileIo)
+        {
+            fileIo->ResolvePath(resolvedPath, AZ::IO::PathView(filePath));
+        }
+
+        if (!m_file.Open(resolvedPath.c_str(),
+                AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Profiler", false, "Failed to create the trace file '%s'", resolvedPath.c_str());
+            return false;
+        }
+
+        m_microsecondsPerTick = 1000000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+        m_threadIds.clear();
+        m_file.Write("[\n", 2);
+        return true;
+    }
+
+    void TraceEventFile::WriteFrame(const TimeRegionMap& frame)
+    {
+        m_buffer.clear();
+        for (const auto& [threadId, regionMap] : frame)
+        {
+            const uint32_t traceThreadId = GetTraceThreadId(threadId);
+            for (const auto& [regionName, regionVec] : regionMap)
+            {
+                for (const CachedTimeRegion& region : regionVec)
+                {
+                    const double start = static_cast<double>(region.m_startTick) * m_microsecondsPerTick;
+                    const double duration = static_cast<double>(region.m_endTick - region.m_startTick) * m_microsecondsPerTick;
+
+                    m_buffer += "{\"name\":";
+                    AppendJsonString(m_buffer, region.m_groupRegionName.m_regionName.GetStringView());
+                    m_buffer += ",\"cat\":";
+                    AppendJsonString(m_buffer, region.m_groupRegionName.m_groupName ? region.m_groupRegionName.m_groupName : "");
+                    m_buffer += AZStd::string::format(
+                        ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%u},\n", start, duration, traceThreadId);
+                }
+            }
+        }
+
+        if (!m_buffer.empty())
+        {
+            m_file.Write(m_buffer.data(), m_buffer.size());
+        }
+    }
+
+    void TraceEventFile::Close()
+    {
+        if (!m_file.IsOpen())
+        {
+            return;
+        }
+
+        // Ends the array with an event that has no trailing comma, which also names the process in the viewers.
+        constexpr AZStd::string_view closing = "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"O3DE\"}}\n]\n";
+        m_file.Write(closing.data(), closing.size());
+        m_file.Close();
+    }
+
+    uint32_t TraceEventFile::GetTraceThreadId(AZStd::thread_id threadId)
+    {
+        return m_threadIds.try_emplace(threadId, aznumeric_cast<uint32_t>(m_threadIds.size())).first->second;
+    }
+
+    // --- CpuProfilerStreamer ---
+
+    CpuProfilerStreamer::~CpuProfilerStreamer()
+    {
+        Stop();
+    }
+
+    bool CpuProfilerStreamer::Start(const AZStd::string& outputFilePath)
+    {
+        if (m_streaming)
+        {
+            AZ_Warning("Profiler", false, "Attempting to start streaming profiling data while a stream is already in progress");
+            return false;
+        }
+
+        if (!m_file.Open(outputFilePath))
+        {
+            return false;
+        }
+
+        m_stopRequested = false;
+        m_droppedFrameCount = 0;
+        m_streaming = true;
+        m_writeThread = AZStd::thread(
+            AZStd::thread_desc{ "Profiler stream" },
+            [this]()
+            {
+                WriteThread();
+            });
+
+        AZ_TracePrintf("Profiler", "Streaming profiling data to '%s'\n", outputFilePath.c_str());
+        return true;
+    }
+
+    void CpuProfilerStreamer::Stop()
+    {
+        if (!m_streaming)
+        {
+            return;
+        }
+
+        {
+            AZStd::scoped_lock lock(m_queueMutex);
+            m_stopRequested = true;
+        }
+        m_queueSignal.notify_one();
+        m_writeThread.join();
+
+        m_file.Close();
+        m_streaming = false;
+
+        AZ_Warning("Profiler", m_droppedFrameCount == 0,
+            "%zu frames of profiling data were dropped because the stream couldn't keep up", m_droppedFrameCount);
+        AZ_TracePrintf("Profiler", "Stopped streaming profiling data\n");
+    }
+
+    bool CpuProfilerStreamer::IsStreaming() const
+    {
+        return m_streaming;
+    }
+
+    void CpuProfilerStreamer::PushFrame(const TimeRegionMap& frame)
+    {
+        if (!m_streaming || frame.empty())
+        {
+            return;
+        }
+
+        // Copy outside of the lock, so the writing thread only waits on the queue itself.
+        TimeRegionMap frameCopy = frame;
+        {
+            AZStd::scoped_lock lock(m_queueMutex);
+            if (m_queuedFrames.size() >= MaxQueuedFrames)
+            {
+                ++m_droppedFrameCount;
+                return;
+            }
+            m_queuedFrames.push_back(AZStd::move(frameCopy));
+        }
+        m_queueSignal.notify_one();
+    }
+
+    void CpuProfilerStreamer::WriteThread()
+    {
+        AZStd::deque<TimeRegionMap> frames;
+        while (true)
+        {
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_queueMutex);
+                m_queueSignal.wait(
+                    lock,
+                    [this]()
+                    {
+                        return m_stopRequested || !m_queuedFrames.empty();
+                    });
+
+                if (m_queuedFrames.empty())
+                {
+                    // Stop was requested and everything has been written.
+                    return;
+                }
+                frames.swap(m_queuedFrames);
+            }
+
+            for (const TimeRegionMap& frame : frames)
+            {
+                m_file.WriteFrame(frame);
+            }
+            frames.clear();
+        }
+    }
+
+    bool CpuProfilerStreamer::WriteFrames(const AZStd::string& outputFilePath, const AZStd::ring_buffer<TimeRegionMap>& frames)
+    {
+        TraceEventFile file;
+        if (!file.Open(outputFilePath))
+        {
+            return false;
+        }
+
+        for (const TimeRegionMap& frame : frames)
+        {
+            file.WriteFrame(frame);
+        }
+        file.Close();
+        return true;
+    }
+} // namespace Profiler
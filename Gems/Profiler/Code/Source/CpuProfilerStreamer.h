@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <CpuProfiler.h>
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace Profiler
+{
+    //! A file of Chrome trace events, written as a JSON array with one complete ("X") event per region.
+    class TraceEventFile
+    {
+    public:
+        //! Creates the file, resolving any alias in the path.
+        bool Open(const AZStd::string& filePath);
+        //! Appends the events of all the regions of a frame.
+        void WriteFrame(const TimeRegionMap& frame);
+        //! Ends the array and closes the file.
+        void Close();
+
+    private:
+        uint32_t GetTraceThreadId(AZStd::thread_id threadId);
+
+        AZ::IO::SystemFile m_file;
+        // Event timestamps are the profiler ticks converted to microseconds, so captures of one run line up.
+        double m_microsecondsPerTick = 0.0;
+        // Thread ids are remapped to small integers, so they read well in the viewers.
+        AZStd::unordered_map<AZStd::thread_id, uint32_t> m_threadIds;
+        AZStd::string m_buffer;
+    };
+
+    //! Writes the frames collected by the CpuProfiler to a file in the Chrome trace event format, which Perfetto
+    //! (ui.perfetto.dev) and chrome://tracing open directly.
+    //! Frames are written by a background thread as soon as they are collected, so a stream can run for a whole
+    //! session with bounded memory. Every frame is written to the file once formatted, and the format doesn't need
+    //! its closing bracket, so the file of a process that crashed or hitched while streaming still loads.
+    class CpuProfilerStreamer
+    {
+    public:
+        CpuProfilerStreamer() = default;
+        ~CpuProfilerStreamer();
+
+        //! Creates the file and starts the thread writing to it.
+        bool Start(const AZStd::string& outputFilePath);
+        //! Writes the frames still queued, closes the file and joins the writing thread.
+        void Stop();
+        bool IsStreaming() const;
+
+        //! Queues the regions of a frame for the writing thread, the caller doesn't wait on any IO.
+        //! When the writing thread falls more than MaxQueuedFrames behind, new frames are dropped rather than queued.
+        void PushFrame(const TimeRegionMap& frame);
+
+        //! Writes a set of frames to a new file on the calling thread.
+        static bool WriteFrames(const AZStd::string& outputFilePath, const AZStd::ring_buffer<TimeRegionMap>& frames);
+
+    private:
+        static constexpr size_t MaxQueuedFrames = 240;
+
+        void WriteThread();
+
+        TraceEventFile m_file;
+        AZStd::thread m_writeThread;
+        AZStd::mutex m_queueMutex;
+        AZStd::condition_variable m_queueSignal;
+        AZStd::deque<TimeRegionMap> m_queuedFrames;
+        size_t m_droppedFrameCount = 0;
+        bool m_stopRequested = false;
+        AZStd::atomic_bool m_streaming = false;
+    };
+} // namespace Profiler
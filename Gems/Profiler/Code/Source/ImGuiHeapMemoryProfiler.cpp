@@ -9,6 +9,11 @@
 #if defined(IMGUI_ENABLED)
 
 #include <ImGuiHeapMemoryProfiler.h>
+#include <Profiler/ImGuiTreemap.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Memory/HphaAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/sort.h>
 
 namespace Profiler
@@ -21,6 +26,40 @@ namespace Profiler
         HeapProfilerColumnID_CapacityMem
     };
 
+    enum SampledSiteColumnID
+    {
+        SampledSiteColumnID_Site = 0,
+        SampledSiteColumnID_Allocator,
+        SampledSiteColumnID_LiveMem,
+        SampledSiteColumnID_TotalMem,
+        SampledSiteColumnID_Samples
+    };
+
+    // Label of an allocation site: the innermost frame that is not part of the allocators themselves
+    static const char* GetSiteLabel(const AZ::Debug::AllocationSampler::SiteReport& site)
+    {
+        for (const AZStd::string& frame : site.m_stack)
+        {
+            if (frame.find("Allocator") == AZStd::string::npos && frame.find("allocator") == AZStd::string::npos &&
+                frame.find("operator new") == AZStd::string::npos)
+            {
+                return frame.c_str();
+            }
+        }
+        return site.m_stack.empty() ? "<unknown>" : site.m_stack.front().c_str();
+    }
+
+    ImGuiHeapMemoryProfiler::~ImGuiHeapMemoryProfiler()
+    {
+        if (m_samplesTreemap)
+        {
+            if (auto treemapFactory = ImGuiTreemapFactory::Interface::Get())
+            {
+                treemapFactory->Destroy(m_samplesTreemap);
+            }
+        }
+    }
+
     void ImGuiHeapMemoryProfiler::Draw(bool& draw)
     {
         using namespace AZ;
@@ -98,8 +137,257 @@ namespace Profiler
 
                 ImGui::EndTable();
             }
+
+            DrawThreadCacheStats();
+            DrawAllocationSamples();
         }
         ImGui::End();       
     }
+
+    void ImGuiHeapMemoryProfiler::DrawThreadCacheStats()
+    {
+        static constexpr size_t KB = 1u << 10;
+
+        if (!ImGui::CollapsingHeader("SystemAllocator Thread Caches"))
+        {
+            return;
+        }
+
+        AZ::HphaThreadCacheStats cacheStats;
+        static_cast<AZ::SystemAllocator&>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get()).GetThreadCacheStats(cacheStats);
+        ImGui::Text(
+            "Hit rate: %.1f%%  Cached: %.1f kB  Batches returned: %zu", cacheStats.GetHitRate() * 100.0f,
+            static_cast<float>(cacheStats.m_cachedBytes) / KB, cacheStats.m_flushes);
+
+        ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg;
+        constexpr int NumColumns = 4;
+        if (ImGui::BeginTable("threadCacheTable", NumColumns, flags))
+        {
+            ImGui::TableSetupColumn("Thread");
+            ImGui::TableSetupColumn("Cached (kB)");
+            ImGui::TableSetupColumn("Hit Rate (%)");
+            ImGui::TableSetupColumn("Allocations");
+            ImGui::TableHeadersRow();
+
+            for (const AZ::HphaThreadCacheStats::ThreadStats& thread : cacheStats.m_threads)
+            {
+                const size_t allocations = thread.m_hits + thread.m_misses;
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%zx", AZStd::hash<AZStd::thread_id>{}(thread.m_threadId));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", static_cast<float>(thread.m_cachedBytes) / KB);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", allocations ? static_cast<float>(thread.m_hits) * 100.0f / allocations : 0.0f);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", allocations);
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
+    void ImGuiHeapMemoryProfiler::DrawAllocationSamples()
+    {
+        static constexpr size_t KB = 1u << 10;
+        static constexpr float MB = static_cast<float>(1u << 20);
+
+        if (!ImGui::CollapsingHeader("Allocation Samples"))
+        {
+            return;
+        }
+
+        AZ::Debug::AllocationSampler& sampler = AZ::AllocatorManager::Instance().GetAllocationSampler();
+        if (sampler.IsSampling())
+        {
+            ImGui::Text("Sampling one allocation per %zu kB", sampler.GetSamplingInterval() / KB);
+            ImGui::SameLine();
+            if (ImGui::Button("Stop Sampling"))
+            {
+                sampler.SetSamplingInterval(0);
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Capture Samples"))
+            {
+                sampler.GetSiteReports(m_sampledSites);
+                m_sampledSitesInterval = sampler.GetSamplingInterval();
+                UpdateSamplesTreemap();
+            }
+        }
+        else
+        {
+            ImGui::SetNextItemWidth(120.0f);
+            ImGui::InputInt("Sampling Interval (kB)", &m_samplingIntervalKB);
+            m_samplingIntervalKB = AZStd::max(m_samplingIntervalKB, 1);
+            ImGui::SameLine();
+            if (ImGui::Button("Start Sampling"))
+            {
+                sampler.SetSamplingInterval(m_samplingIntervalKB * KB);
+            }
+        }
+
+        ImGui::InputText("Sample File", m_samplesFilePath, AZ_ARRAY_SIZE(m_samplesFilePath));
+        ImGui::SameLine();
+        if (ImGui::Button("Load"))
+        {
+            AZ::IO::SystemFileStream stream(m_samplesFilePath, AZ::IO::OpenMode::ModeRead);
+            if (!stream.IsOpen() || !AZ::Debug::AllocationSampler::ReadSiteReports(stream, m_sampledSitesInterval, m_sampledSites))
+            {
+                AZ_Warning("Profiler", false, "Unable to load allocation samples from %s", m_samplesFilePath);
+                m_sampledSites.clear();
+            }
+            UpdateSamplesTreemap();
+        }
+
+        if (m_sampledSites.empty())
+        {
+            return;
+        }
+
+        size_t liveBytes = 0;
+        size_t totalBytes = 0;
+        for (const auto& site : m_sampledSites)
+        {
+            liveBytes += site.m_liveBytes;
+            totalBytes += site.m_totalBytes;
+        }
+        ImGui::Text(
+            "%zu sites, estimated %.1f MB live, %.1f MB allocated (interval %zu kB)", m_sampledSites.size(), liveBytes / MB,
+            totalBytes / MB, m_sampledSitesInterval / KB);
+        if (m_samplesTreemap)
+        {
+            ImGui::SameLine();
+            ImGui::Checkbox("Show Live Memory Treemap", &m_showSamplesTreemap);
+            if (m_showSamplesTreemap)
+            {
+                m_samplesTreemap->Render(60, 100, 800, 600);
+            }
+        }
+
+        ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY;
+        constexpr int NumColumns = 5;
+        if (ImGui::BeginTable("sampledSitesTable", NumColumns, flags, ImVec2(0.0f, 400.0f)))
+        {
+            ImGui::TableSetupColumn("Site", 0, 0.f, SampledSiteColumnID_Site);
+            ImGui::TableSetupColumn("Allocator Name", 0, 0.f, SampledSiteColumnID_Allocator);
+            ImGui::TableSetupColumn(
+                "Live Memory (kB)", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending, 0.f,
+                SampledSiteColumnID_LiveMem);
+            ImGui::TableSetupColumn("Allocated Memory (kB)", ImGuiTableColumnFlags_PreferSortDescending, 0.f, SampledSiteColumnID_TotalMem);
+            ImGui::TableSetupColumn("Samples", ImGuiTableColumnFlags_PreferSortDescending, 0.f, SampledSiteColumnID_Samples);
+            ImGui::TableHeadersRow();
+
+            if (ImGuiTableSortSpecs* sortSpecs = ImGui::TableGetSortSpecs())
+            {
+                AZStd::sort(
+                    m_sampledSites.begin(),
+                    m_sampledSites.end(),
+                    [sortSpecs](const AZ::Debug::AllocationSampler::SiteReport& lhs, const AZ::Debug::AllocationSampler::SiteReport& rhs)
+                    {
+                        const AZ::Debug::AllocationSampler::SiteReport* left = &lhs;
+                        const AZ::Debug::AllocationSampler::SiteReport* right = &rhs;
+                        if (sortSpecs->Specs->SortDirection == ImGuiSortDirection_Descending)
+                        {
+                            AZStd::swap(left, right);
+                        }
+
+                        switch (sortSpecs->Specs->ColumnUserID)
+                        {
+                        case SampledSiteColumnID_Site:
+                            return strcmp(GetSiteLabel(*left), GetSiteLabel(*right)) < 0;
+                        case SampledSiteColumnID_Allocator:
+                            return left->m_allocatorName < right->m_allocatorName;
+                        case SampledSiteColumnID_LiveMem:
+                            return left->m_liveBytes < right->m_liveBytes;
+                        case SampledSiteColumnID_TotalMem:
+                            return left->m_totalBytes < right->m_totalBytes;
+                        case SampledSiteColumnID_Samples:
+                            return left->m_sampleCount < right->m_sampleCount;
+                        default:
+                            return false;
+                        }
+                    });
+                sortSpecs->SpecsDirty = false;
+            }
+
+            for (const auto& site : m_sampledSites)
+            {
+                if (!m_filter.PassFilter(site.m_allocatorName.c_str()))
+                {
+                    continue;
+                }
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(GetSiteLabel(site));
+                if (ImGui::IsItemHovered())
+                {
+                    ImGui::BeginTooltip();
+                    for (const AZStd::string& frame : site.m_stack)
+                    {
+                        ImGui::TextUnformatted(frame.c_str());
+                    }
+                    ImGui::EndTooltip();
+                }
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(site.m_allocatorName.c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", static_cast<float>(site.m_liveBytes) / KB);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", static_cast<float>(site.m_totalBytes) / KB);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", site.m_sampleCount);
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
+    void ImGuiHeapMemoryProfiler::UpdateSamplesTreemap()
+    {
+        static constexpr float MB = static_cast<float>(1u << 20);
+
+        if (!m_samplesTreemap)
+        {
+            if (auto treemapFactory = ImGuiTreemapFactory::Interface::Get())
+            {
+                m_samplesTreemap = &treemapFactory->Create(AZ::Name{ "Sampled Live Memory Treemap" }, "MiB");
+            }
+        }
+
+        if (m_samplesTreemap)
+        {
+            // One root per allocator, with the sites that still hold memory as leaves
+            AZStd::vector<TreemapNode> allocatorNodes;
+            for (const auto& site : m_sampledSites)
+            {
+                if (site.m_liveBytes == 0)
+                {
+                    continue;
+                }
+
+                const AZ::Name allocatorName{ site.m_allocatorName };
+                auto allocatorNode = AZStd::find_if(
+                    allocatorNodes.begin(), allocatorNodes.end(),
+                    [&allocatorName](const TreemapNode& node)
+                    {
+                        return node.m_name == allocatorName;
+                    });
+                TreemapNode& parentNode = allocatorNode != allocatorNodes.end() ? *allocatorNode : allocatorNodes.emplace_back();
+                parentNode.m_name = allocatorName;
+
+                TreemapNode& siteNode = parentNode.m_children.emplace_back();
+                siteNode.m_name = AZ::Name{ GetSiteLabel(site) };
+                siteNode.m_group = allocatorName;
+                siteNode.m_weight = static_cast<float>(site.m_liveBytes) / MB;
+                for (const AZStd::string& frame : site.m_stack)
+                {
+                    siteNode.m_tooltip += frame;
+                    siteNode.m_tooltip += '\n';
+                }
+            }
+            m_samplesTreemap->SetRoots(AZStd::move(allocatorNodes));
+        }
+    }
 }
-#endif
+#endif
\ No newline at end of file
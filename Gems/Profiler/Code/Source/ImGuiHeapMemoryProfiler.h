@@ -10,21 +10,39 @@
 
 #if defined(IMGUI_ENABLED)
 #include <imgui/imgui.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/Memory/AllocatorManager.h>
 
 namespace Profiler
 {
+    class ImGuiTreemap;
+
     //! Profiler for displaying information about Memory Heaps
     class ImGuiHeapMemoryProfiler
     {
     public:
         ImGuiHeapMemoryProfiler() = default;
-        ~ImGuiHeapMemoryProfiler() = default;
+        ~ImGuiHeapMemoryProfiler();
 
         void Draw(bool& draw);
 
     private:
+        //! Draws the hit rate and bytes held by the per-thread caches of the SystemAllocator
+        void DrawThreadCacheStats();
+
+        //! Draws the allocation sites recorded by the AllocatorManager's sampler, or loaded from a sample file
+        void DrawAllocationSamples();
+        void UpdateSamplesTreemap();
+
         ImGuiTextFilter m_filter;
+
+        AZ::Debug::AllocationSampler::SiteReports m_sampledSites;
+        size_t m_sampledSitesInterval = 0;
+        int m_samplingIntervalKB = 512;
+        char m_samplesFilePath[AZ::IO::MaxPathLength] = {};
+        ImGuiTreemap* m_samplesTreemap = nullptr;
+        bool m_showSamplesTreemap = false;
     };
 }
 #endif
@@ -8,17 +8,27 @@
 
 #include <ProfilerSystemComponent.h>
 
+#include <AzCore/Console/ConsoleTypeHelpers.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/Json/JsonSerializationSettings.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/time.h>
 
 namespace Profiler
 {
     static constexpr AZ::Crc32 profilerServiceCrc = AZ_CRC_CE("ProfilerService");
 
+    AZ_CVAR(float, profiler_hitchThresholdMs, 50.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Frame time in milliseconds above which ProfilerStartHitchCapture saves the recent frames, when no threshold is passed to it");
+    AZ_CVAR(AZ::u32, profiler_hitchCaptureFrames, 120, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Number of frames of profiling data saved by a hitch capture, up to and including the slow frame");
+
+    // The regions of a frame are collected on the ticks that follow it.
+    static constexpr int HitchTrailingFrames = 2;
+
     struct DelayedFunction
     {
         using func_type = AZStd::function<void()>;
@@ -126,6 +136,11 @@ namespace Profiler
     }
 
     ProfilerSystemComponent::ProfilerSystemComponent()
+        : m_frameCollectedHandler(
+              [this](const TimeRegionMap& frame)
+              {
+                  OnFrameCollected(frame);
+              })
     {
         if (AZ::Debug::ProfilerSystemInterface::Get() == nullptr)
         {
@@ -144,12 +159,25 @@ namespace Profiler
     void ProfilerSystemComponent::Activate()
     {
         m_cpuProfiler.Init();
+        m_cpuProfiler.ConnectFrameCollectedHandler(m_frameCollectedHandler);
     }
 
     void ProfilerSystemComponent::Deactivate()
     {
+        m_frameCollectedHandler.Disconnect();
+        m_streamer.Stop();
+        m_hitchThresholdMs = 0.0f;
+        m_hitchHistory.clear();
+        m_monitorCount = 0;
+        m_profilerEnabledForMonitoring = false;
+
         m_cpuProfiler.Shutdown();
 
+        if (m_hitchCaptureThread.joinable())
+        {
+            m_hitchCaptureThread.join();
+        }
+
         // Block deactivation until the IO thread has finished serializing the CPU data
         if (m_cpuDataSerializationThread.joinable())
         {
@@ -249,4 +277,152 @@ namespace Profiler
     {
         return m_cpuProfiler.IsContinuousCaptureInProgress();
     }
+
+    void ProfilerSystemComponent::OnFrameCollected(const TimeRegionMap& frame)
+    {
+        m_streamer.PushFrame(frame);
+
+        if (m_hitchThresholdMs <= 0.0f)
+        {
+            return;
+        }
+
+        const AZStd::sys_time_t now = AZStd::GetTimeNowTicks();
+        const float frameTimeMs = m_lastFrameTick != 0
+            ? static_cast<float>(now - m_lastFrameTick) * 1000.0f / static_cast<float>(AZStd::GetTimeTicksPerSecond())
+            : 0.0f;
+        m_lastFrameTick = now;
+
+        const size_t historySize = AZStd::max<size_t>(profiler_hitchCaptureFrames, HitchTrailingFrames + 1);
+        if (m_hitchHistory.capacity() != historySize)
+        {
+            m_hitchHistory.set_capacity(historySize);
+        }
+        m_hitchHistory.push_back(frame);
+
+        if (m_hitchCooldownFrames > 0)
+        {
+            --m_hitchCooldownFrames;
+        }
+
+        if (m_hitchFramesUntilSave > 0)
+        {
+            if (--m_hitchFramesUntilSave == 0)
+            {
+                SaveHitchCapture();
+            }
+        }
+        else if (frameTimeMs > m_hitchThresholdMs && m_hitchCooldownFrames == 0)
+        {
+            AZ_TracePrintf("ProfilerSystemComponent", "Frame took %.2f ms, saving a hitch capture\n", frameTimeMs);
+            m_hitchFramesUntilSave = HitchTrailingFrames;
+        }
+    }
+
+    void ProfilerSystemComponent::SaveHitchCapture()
+    {
+        bool expected = false;
+        if (!m_hitchCaptureInProgress.compare_exchange_strong(expected, true))
+        {
+            AZ_TracePrintf("ProfilerSystemComponent", "Skipping a hitch capture - the previous one is still being saved\n");
+            return;
+        }
+
+        // The IO thread has already completed execution since m_hitchCaptureInProgress was false, so this doesn't block.
+        if (m_hitchCaptureThread.joinable())
+        {
+            m_hitchCaptureThread.join();
+        }
+
+        const AZStd::string outputFilePath = AZStd::string::format(
+            "%s/capture_hitch_%lld.json", AZ::Debug::GetProfilerCaptureLocation().c_str(), AZStd::GetTimeNowSecond());
+
+        AZStd::ring_buffer<TimeRegionMap> frames;
+        frames.swap(m_hitchHistory);
+        m_hitchCooldownFrames = frames.capacity();
+
+        m_hitchCaptureThread = AZStd::thread(
+            [frames = AZStd::move(frames), outputFilePath, &flag = m_hitchCaptureInProgress]()
+            {
+                const bool saved = CpuProfilerStreamer::WriteFrames(outputFilePath, frames);
+                AZ_Printf("ProfilerSystemComponent", "Hitch capture was saved to file [%s]\n", outputFilePath.c_str());
+
+                AZ::Debug::ProfilerNotificationBus::Broadcast(
+                    &AZ::Debug::ProfilerNotificationBus::Events::OnCaptureFinished, saved, outputFilePath);
+                flag.store(false);
+            });
+    }
+
+    void ProfilerSystemComponent::AcquireProfilerForMonitoring()
+    {
+        if (m_monitorCount++ == 0 && !m_cpuProfiler.IsProfilerEnabled())
+        {
+            m_cpuProfiler.SetProfilerEnabled(true);
+            m_profilerEnabledForMonitoring = true;
+        }
+    }
+
+    void ProfilerSystemComponent::ReleaseProfilerForMonitoring()
+    {
+        if (--m_monitorCount == 0 && m_profilerEnabledForMonitoring)
+        {
+            m_cpuProfiler.SetProfilerEnabled(false);
+            m_profilerEnabledForMonitoring = false;
+        }
+    }
+
+    void ProfilerSystemComponent::ProfilerStartStreaming(const AZ::ConsoleCommandContainer& arguments)
+    {
+        const AZStd::string outputFilePath = !arguments.empty()
+            ? AZStd::string(arguments.front())
+            : AZStd::string::format("%s/stream_%lld.json", AZ::Debug::GetProfilerCaptureLocation().c_str(), AZStd::GetTimeNowSecond());
+
+        if (m_streamer.Start(outputFilePath))
+        {
+            AcquireProfilerForMonitoring();
+        }
+    }
+
+    void ProfilerSystemComponent::ProfilerStopStreaming([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (m_streamer.IsStreaming())
+        {
+            m_streamer.Stop();
+            ReleaseProfilerForMonitoring();
+        }
+    }
+
+    void ProfilerSystemComponent::ProfilerStartHitchCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        float thresholdMs = profiler_hitchThresholdMs;
+        if (!arguments.empty() && !AZ::ConsoleTypeHelpers::StringToValue(thresholdMs, arguments.front()))
+        {
+            AZ_Warning("ProfilerSystemComponent", false, "Invalid hitch threshold '%.*s'", AZ_STRING_ARG(arguments.front()));
+            return;
+        }
+        if (thresholdMs <= 0.0f)
+        {
+            AZ_Warning("ProfilerSystemComponent", false, "The hitch threshold must be greater than zero");
+            return;
+        }
+
+        if (m_hitchThresholdMs <= 0.0f)
+        {
+            AcquireProfilerForMonitoring();
+            m_lastFrameTick = 0;
+        }
+        m_hitchThresholdMs = thresholdMs;
+        AZ_TracePrintf("ProfilerSystemComponent", "Saving a hitch capture for frames longer than %.2f ms\n", thresholdMs);
+    }
+
+    void ProfilerSystemComponent::ProfilerStopHitchCapture([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (m_hitchThresholdMs > 0.0f)
+        {
+            m_hitchThresholdMs = 0.0f;
+            m_hitchFramesUntilSave = 0;
+            m_hitchHistory.clear();
+            ReleaseProfilerForMonitoring();
+        }
+    }
 } // namespace Profiler
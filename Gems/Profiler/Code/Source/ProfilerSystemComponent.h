@@ -9,8 +9,10 @@
 #pragma once
 
 #include <CpuProfiler.h>
+#include <CpuProfilerStreamer.h>
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/std/parallel/thread.h>
 
@@ -46,6 +48,28 @@ namespace Profiler
         bool EndCapture() override;
         bool IsCaptureInProgress() const override;
 
+        //! Streams the regions of every frame to a trace file, and watches the frame time for hitches.
+        void OnFrameCollected(const TimeRegionMap& frame);
+        void SaveHitchCapture();
+
+        //! The streaming and the hitch captures need the profiler enabled, these keep it enabled while either runs
+        //! and restore its previous state after.
+        void AcquireProfilerForMonitoring();
+        void ReleaseProfilerForMonitoring();
+
+        AZ_CONSOLEFUNC(ProfilerSystemComponent, ProfilerStartStreaming, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Stream the profiling data of every frame to a trace file until ProfilerStopStreaming, optionally takes the file path");
+        void ProfilerStartStreaming(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(ProfilerSystemComponent, ProfilerStopStreaming, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Stop streaming profiling data and close the trace file");
+        void ProfilerStopStreaming(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(ProfilerSystemComponent, ProfilerStartHitchCapture, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Keep the profiling data of the last profiler_hitchCaptureFrames frames, and save them to a trace file whenever a frame "
+            "takes longer than the threshold. Optionally takes the threshold in milliseconds, profiler_hitchThresholdMs otherwise");
+        void ProfilerStartHitchCapture(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(ProfilerSystemComponent, ProfilerStopHitchCapture, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Stop watching for hitches");
+        void ProfilerStopHitchCapture(const AZ::ConsoleCommandContainer& arguments);
 
         AZStd::thread m_cpuDataSerializationThread;
         AZStd::atomic_bool m_cpuDataSerializationInProgress{ false };
@@ -54,6 +78,24 @@ namespace Profiler
 
         CpuProfiler m_cpuProfiler;
         AZStd::string m_captureFile;
+
+        CpuProfiler::FrameCollectedEvent::Handler m_frameCollectedHandler;
+        CpuProfilerStreamer m_streamer;
+
+        // Number of running monitors (streaming, hitch captures) and whether the first one had to enable the profiler.
+        int m_monitorCount = 0;
+        bool m_profilerEnabledForMonitoring = false;
+
+        // Frames that took longer than this trigger a hitch capture, zero when not watching for hitches.
+        float m_hitchThresholdMs = 0.0f;
+        AZStd::sys_time_t m_lastFrameTick = 0;
+        AZStd::ring_buffer<TimeRegionMap> m_hitchHistory;
+        // Frames to collect after a hitch before saving, so the history includes the regions of the slow frame.
+        int m_hitchFramesUntilSave = 0;
+        // Frames to wait before the next hitch can trigger a capture, so back to back hitches don't each save a file.
+        size_t m_hitchCooldownFrames = 0;
+        AZStd::thread m_hitchCaptureThread;
+        AZStd::atomic_bool m_hitchCaptureInProgress{ false };
     };
 
 } // namespace Profiler
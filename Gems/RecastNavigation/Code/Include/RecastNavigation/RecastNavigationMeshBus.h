@@ -10,6 +10,7 @@
 
 #include <DetourNavMesh.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Aabb.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <RecastNavigation/NavMeshQuery.h>
 #include <RecastNavigation/RecastSmartPointer.h>
@@ -29,6 +30,12 @@ namespace RecastNavigation
         //! @returns false if another update operation is already in progress
         virtual bool UpdateNavigationMeshAsync() = 0;
 
+        //! Re-calculates only the tiles of the navigation mesh that overlap a world area, such as the bounds of colliders that changed.
+        //! Notifies when completed using @RecastNavigationMeshNotificationBus.
+        //! @param area the world area to update
+        //! @returns false if another update operation is already in progress
+        virtual bool UpdateNavigationMeshWithinAreaAsync(const AZ::Aabb& area) = 0;
+
         //! @returns the underlying navigation objects with the associated synchronization object.
         virtual AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() = 0;
     };
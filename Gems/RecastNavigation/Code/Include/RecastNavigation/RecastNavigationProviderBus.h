@@ -34,6 +34,16 @@ namespace RecastNavigation
         virtual bool CollectGeometryAsync(float tileSize, float borderSize,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
 
+        //! Same as @CollectGeometryAsync but only for the tiles whose geometry, including their border, overlaps a given area.
+        //! Useful to update the navigation mesh after a local change, such as colliders that were added or destroyed.
+        //! @param tileSize A navigation mesh is made up of tiles. Each tile is a square of the same size.
+        //! @param borderSize An additional extent in each dimension around each tile.
+        //! @param area only the tiles overlapping this world area are collected, along the x and y axes.
+        //! @param tileCallback will be called once for each tile with geometry data and one last time to indicate the end of the operation with an empty shared_ptr
+        //! @returns true if an async operation was scheduled, false otherwise
+        virtual bool CollectGeometryWithinAreaAsync(float tileSize, float borderSize, const AZ::Aabb& area,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
+
         //! A navigation mesh is made up of tiles. Each tile is a square of the same size.
         //! @param tileSize size of square tiles that make up a navigation mesh.
         //! @returns number of tiles that would be necessary to the cover the required area provided by @GetWorldBounds.
@@ -47,6 +47,8 @@ namespace RecastNavigation
 
                     ->DataElement(AZ::Edit::UIHandlers::Default, &RecastNavigationPhysXProviderConfig::m_collisionGroupId, "Collision Group",
                         "If set, only colliders from the specified collision group will be considered.")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &RecastNavigationPhysXProviderConfig::m_updateOnPhysicsChanges, "Update On Physics Changes",
+                        "If set, the tiles of the navigation mesh around static colliders are updated when the colliders are added or removed.")
                     ;
             }
         }
@@ -29,6 +29,9 @@ AZ_CVAR(
 AZ_CVAR(
     AZ::u32, bg_navmesh_threads, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
     "Number of threads to use to process tiles for each RecastNavigationMeshComponentController");
+AZ_CVAR(
+    AZ::u32, bg_navmesh_tilesPerFrame, 16, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of tiles each RecastNavigationMeshComponentController starts to process per frame during async updates, 0 for no limit");
 
 namespace RecastNavigation
 {
@@ -115,20 +118,46 @@ namespace RecastNavigation
     }
 
     bool RecastNavigationMeshComponentController::UpdateNavigationMeshAsync()
+    {
+        return UpdateNavigationMeshAsyncImpl(AZ::Aabb::CreateNull());
+    }
+
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshWithinAreaAsync(const AZ::Aabb& area)
+    {
+        if (!area.IsValid())
+        {
+            return false;
+        }
+
+        return UpdateNavigationMeshAsyncImpl(area);
+    }
+
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshAsyncImpl(const AZ::Aabb& area)
     {
         bool notInProgress = false;
         if (m_updateInProgress.compare_exchange_strong(notInProgress, true))
         {
             AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync");
 
+            auto tileCallback = [this](AZStd::shared_ptr<TileGeometry> tile)
+            {
+                OnTileProcessedEvent(tile);
+            };
+
+            const float borderSize = aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize;
             bool operationScheduled = false;
-            RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
-                &RecastNavigationProviderRequests::CollectGeometryAsync,
-                m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize,
-                [this](AZStd::shared_ptr<TileGeometry> tile)
-                {
-                    OnTileProcessedEvent(tile);
-                });
+            if (area.IsValid())
+            {
+                RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
+                    &RecastNavigationProviderRequests::CollectGeometryWithinAreaAsync,
+                    m_configuration.m_tileSize, borderSize, area, tileCallback);
+            }
+            else
+            {
+                RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
+                    &RecastNavigationProviderRequests::CollectGeometryAsync,
+                    m_configuration.m_tileSize, borderSize, tileCallback);
+            }
 
             if (!operationScheduled)
             {
@@ -167,6 +196,7 @@ namespace RecastNavigation
     void RecastNavigationMeshComponentController::Deactivate()
     {
         m_tickEvent.RemoveFromQueue();
+        m_receivedAllNewTilesEvent.RemoveFromQueue();
 
         if (m_updateInProgress)
         {
@@ -182,6 +212,11 @@ namespace RecastNavigation
         m_navObject.reset();
         m_taskGraphEvent.reset();
         m_updateInProgress = false;
+        m_processingReceivedTiles = false;
+        {
+            AZStd::lock_guard lock(m_tileProcessingMutex);
+            m_tilesToBeProcessed.clear();
+        }
 
         RecastNavigationMeshRequestBus::Handler::BusDisconnect();
     }
@@ -393,6 +428,13 @@ namespace RecastNavigation
 
     void RecastNavigationMeshComponentController::ReceivedAllNewTilesImpl(const RecastNavigationMeshConfig& config, AZ::ScheduledEvent& sendNotificationEvent)
     {
+        if (m_shouldProcessTiles && m_processingReceivedTiles && m_taskGraphEvent && !m_taskGraphEvent->IsSignaled())
+        {
+            // The previous tiles of this update are still being processed, try again on the next frame.
+            m_receivedAllNewTilesEvent.Enqueue(AZ::TimeMs{ 0 });
+            return;
+        }
+
         if (m_shouldProcessTiles && (!m_taskGraphEvent || m_taskGraphEvent->IsSignaled()))
         {
             AZ_PROFILE_SCOPE(Navigation, "Navigation: OnReceivedAllNewTiles");
@@ -403,9 +445,20 @@ namespace RecastNavigation
             AZStd::vector<AZ::TaskToken> tileTaskTokens;
 
             AZStd::vector<AZStd::shared_ptr<TileGeometry>> tilesToBeProcessed;
+            bool hasRemainingTiles = false;
             {
                 AZStd::lock_guard lock(m_tileProcessingMutex);
-                m_tilesToBeProcessed.swap(tilesToBeProcessed);
+                const size_t tilesPerFrame = static_cast<AZ::u32>(bg_navmesh_tilesPerFrame);
+                if (tilesPerFrame == 0 || m_tilesToBeProcessed.size() <= tilesPerFrame)
+                {
+                    m_tilesToBeProcessed.swap(tilesToBeProcessed);
+                }
+                else
+                {
+                    tilesToBeProcessed.assign(m_tilesToBeProcessed.begin(), m_tilesToBeProcessed.begin() + tilesPerFrame);
+                    m_tilesToBeProcessed.erase(m_tilesToBeProcessed.begin(), m_tilesToBeProcessed.begin() + tilesPerFrame);
+                    hasRemainingTiles = true;
+                }
             }
 
             // Create tasks for each tile and a finish task.
@@ -447,9 +500,18 @@ namespace RecastNavigation
             }
 
             AZ::TaskToken finishToken = m_taskGraph.AddTask(
-                m_taskDescriptor, [&sendNotificationEvent]()
+                m_taskDescriptor, [this, &sendNotificationEvent, hasRemainingTiles]()
                 {
-                    sendNotificationEvent.Enqueue(AZ::TimeMs{ 0 });
+                    if (hasRemainingTiles)
+                    {
+                        // Processes the next tiles on the next frame.
+                        m_receivedAllNewTilesEvent.Enqueue(AZ::TimeMs{ 0 });
+                    }
+                    else
+                    {
+                        m_processingReceivedTiles = false;
+                        sendNotificationEvent.Enqueue(AZ::TimeMs{ 0 });
+                    }
                 });
 
             for (AZ::TaskToken& task : tileTaskTokens)
@@ -457,10 +519,14 @@ namespace RecastNavigation
                 task.Precedes(finishToken);
             }
 
+            const bool firstTilesOfUpdate = !m_processingReceivedTiles.exchange(true);
             m_taskGraph.SubmitOnExecutor(m_taskExecutor, m_taskGraphEvent.get());
 
-            RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
-                &RecastNavigationMeshNotificationBus::Events::OnNavigationMeshBeganRecalculating, m_entityComponentIdPair.GetEntityId());
+            if (firstTilesOfUpdate)
+            {
+                RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
+                    &RecastNavigationMeshNotificationBus::Events::OnNavigationMeshBeganRecalculating, m_entityComponentIdPair.GetEntityId());
+            }
         }
     }
 } // namespace RecastNavigation
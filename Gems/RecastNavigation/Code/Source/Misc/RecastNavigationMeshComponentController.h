@@ -64,6 +64,8 @@ namespace RecastNavigation
         NavigationTileData CreateNavigationTile(TileGeometry* geom, const RecastNavigationMeshConfig& meshConfig, rcContext* context);
 
         //! Creates a task graph with tasks to process received tile data.
+        //! At most bg_navmesh_tilesPerFrame tiles are processed at a time, the next ones are processed on the following frames
+        //! to spread the cost of large updates.
         //! @param config navigation mesh configuration to apply to the tile data
         //! @param sendNotificationEvent once all the tiles are processed and added to the navigation update notify on the main thread
         void ReceivedAllNewTilesImpl(const RecastNavigationMeshConfig& config, AZ::ScheduledEvent& sendNotificationEvent);
@@ -72,6 +74,7 @@ namespace RecastNavigation
         //! @{
         bool UpdateNavigationMeshBlockUntilCompleted() override;
         bool UpdateNavigationMeshAsync() override;
+        bool UpdateNavigationMeshWithinAreaAsync(const AZ::Aabb& area) override;
         AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() override;
         //! @}
 
@@ -126,5 +129,12 @@ namespace RecastNavigation
 
         //! If true, an update operation is in progress.
         AZStd::atomic<bool> m_updateInProgress{ false };
+
+        //! If true, the received tiles of the current update are being processed, some of them may still be waiting for the next frames.
+        AZStd::atomic<bool> m_processingReceivedTiles{ false };
+
+    private:
+        //! Collects the geometry of the tiles overlapping @area from the provider, or of all the tiles if @area is null.
+        bool UpdateNavigationMeshAsyncImpl(const AZ::Aabb& area);
     };
 } // namespace RecastNavigation
@@ -11,9 +11,11 @@
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Shape.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
+#include <AzFramework/Physics/SimulatedBodies/StaticRigidBody.h>
 #include <DebugDraw/DebugDrawBus.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <Misc/RecastNavigationPhysXProviderComponentController.h>
+#include <RecastNavigation/RecastNavigationMeshBus.h>
 
 AZ_CVAR(
     bool, cl_navmesh_showInputData, false, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -24,6 +26,9 @@ AZ_CVAR(
 AZ_CVAR(
     AZ::u32, bg_navmesh_tileThreads, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
     "Number of threads to use to process tiles for each RecastNavigationPhysXProvider");
+AZ_CVAR(
+    int, bg_navmesh_physicsChangesDelayMs, 100, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Delay in milliseconds to gather physics changes before updating the navigation mesh tiles around them");
 
 AZ_DECLARE_BUDGET(Navigation);
 
@@ -62,14 +67,22 @@ namespace RecastNavigation
 
     RecastNavigationPhysXProviderComponentController::RecastNavigationPhysXProviderComponentController()
         : m_taskExecutor(bg_navmesh_tileThreads)
+        , m_simulatedBodyAddedHandler([this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+            {
+                OnSimulatedBodyChanged(sceneHandle, bodyHandle);
+            })
+        , m_simulatedBodyRemovedHandler([this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+            {
+                OnSimulatedBodyChanged(sceneHandle, bodyHandle);
+            })
     {
     }
 
     RecastNavigationPhysXProviderComponentController::RecastNavigationPhysXProviderComponentController(
         const RecastNavigationPhysXProviderConfig& config)
-        : m_config(config)
-        , m_taskExecutor(bg_navmesh_tileThreads)
+        : RecastNavigationPhysXProviderComponentController()
     {
+        m_config = config;
     }
 
     void RecastNavigationPhysXProviderComponentController::Activate(const AZ::EntityComponentIdPair& entityComponentIdPair)
@@ -79,6 +92,16 @@ namespace RecastNavigation
         m_updateInProgress = false;
         OnConfigurationChanged();
         RecastNavigationProviderRequestBus::Handler::BusConnect(m_entityComponentIdPair.GetEntityId());
+
+        if (m_config.m_updateOnPhysicsChanges)
+        {
+            if (auto sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+            {
+                AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(GetSceneName());
+                sceneInterface->RegisterSimulationBodyAddedHandler(sceneHandle, m_simulatedBodyAddedHandler);
+                sceneInterface->RegisterSimulationBodyRemovedHandler(sceneHandle, m_simulatedBodyRemovedHandler);
+            }
+        }
     }
 
     void RecastNavigationPhysXProviderComponentController::SetConfiguration(const RecastNavigationPhysXProviderConfig& config)
@@ -93,6 +116,11 @@ namespace RecastNavigation
 
     void RecastNavigationPhysXProviderComponentController::Deactivate()
     {
+        m_simulatedBodyAddedHandler.Disconnect();
+        m_simulatedBodyRemovedHandler.Disconnect();
+        m_updateChangedAreaEvent.RemoveFromQueue();
+        m_changedArea = AZ::Aabb::CreateNull();
+
         if (m_updateInProgress)
         {
             m_shouldProcessTiles = false;
@@ -124,6 +152,20 @@ namespace RecastNavigation
         return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback));
     }
 
+    bool RecastNavigationPhysXProviderComponentController::CollectGeometryWithinAreaAsync(
+        float tileSize,
+        float borderSize,
+        const AZ::Aabb& area,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        if (!area.IsValid())
+        {
+            return false;
+        }
+
+        return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback), area);
+    }
+
     AZ::Aabb RecastNavigationPhysXProviderComponentController::GetWorldBounds() const
     {
         AZ::Aabb worldBounds = AZ::Aabb::CreateNull();
@@ -153,6 +195,48 @@ namespace RecastNavigation
         m_collisionGroup = GetCollisionGroupById(m_config.m_collisionGroupId);
     }
 
+    void RecastNavigationPhysXProviderComponentController::OnSimulatedBodyChanged(
+        AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        auto sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        const AzPhysics::SimulatedBody* body = sceneInterface ? sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, bodyHandle) : nullptr;
+
+        // Only static colliders are part of the navigation mesh.
+        if (!body || !azrtti_istypeof<AzPhysics::StaticRigidBody>(body))
+        {
+            return;
+        }
+
+        const AZ::Aabb bodyBounds = body->GetAabb();
+        if (!bodyBounds.IsValid() || !bodyBounds.Overlaps(GetWorldBounds()))
+        {
+            return;
+        }
+
+        m_changedArea.AddAabb(bodyBounds);
+        if (!m_updateChangedAreaEvent.IsScheduled())
+        {
+            m_updateChangedAreaEvent.Enqueue(AZ::TimeMs{ aznumeric_cast<int>(bg_navmesh_physicsChangesDelayMs) });
+        }
+    }
+
+    void RecastNavigationPhysXProviderComponentController::OnUpdateChangedArea()
+    {
+        bool updateScheduled = false;
+        RecastNavigationMeshRequestBus::EventResult(updateScheduled, m_entityComponentIdPair.GetEntityId(),
+            &RecastNavigationMeshRequests::UpdateNavigationMeshWithinAreaAsync, m_changedArea);
+
+        if (updateScheduled)
+        {
+            m_changedArea = AZ::Aabb::CreateNull();
+        }
+        else
+        {
+            // Another update is in progress, try again after it.
+            m_updateChangedAreaEvent.Enqueue(AZ::TimeMs{ aznumeric_cast<int>(bg_navmesh_physicsChangesDelayMs) });
+        }
+    }
+
     void RecastNavigationPhysXProviderComponentController::CollectCollidersWithinVolume(const AZ::Aabb& volume, QueryHits& overlapHits)
     {
         AZ_PROFILE_SCOPE(Navigation, "Navigation: CollectGeometryWithinVolume");
@@ -358,7 +442,8 @@ namespace RecastNavigation
         float tileSize,
         float borderSize,
         const AZ::Aabb& worldVolume,
-        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback,
+        const AZ::Aabb& areaToCollect)
     {
         bool notInProgress = false;
         if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
@@ -408,6 +493,17 @@ namespace RecastNavigation
 
                     AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
                     AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
+
+                    // The tiles span the whole height of the world volume, so only their horizontal extents are compared.
+                    if (areaToCollect.IsValid() &&
+                        (scanVolume.GetMin().GetX() > areaToCollect.GetMax().GetX() ||
+                         scanVolume.GetMax().GetX() < areaToCollect.GetMin().GetX() ||
+                         scanVolume.GetMin().GetY() > areaToCollect.GetMax().GetY() ||
+                         scanVolume.GetMax().GetY() < areaToCollect.GetMin().GetY()))
+                    {
+                        continue;
+                    }
+
                     AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_unique<TileGeometry>();
                     geometryData->m_tileCallback = tileCallback;
                     geometryData->m_worldBounds = tileVolume;
@@ -9,8 +9,10 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 #include <RecastNavigation/RecastHelpers.h>
 #include <Misc/RecastNavigationPhysXProviderConfig.h>
@@ -47,6 +49,8 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometry(float tileSize, float borderSize) override;
         bool CollectGeometryAsync(float tileSize, float borderSize, AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
+        bool CollectGeometryWithinAreaAsync(float tileSize, float borderSize, const AZ::Aabb& area,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
         AZ::Aabb GetWorldBounds() const override;
         int GetNumberOfTiles(float tileSize) const override;
         //! @}
@@ -78,12 +82,14 @@ namespace RecastNavigation
         //! @param borderSize an additional extend in all direction around the tile volume, this additional geometry will allow Recast to connect tiles together
         //! @param worldVolume worldVolume the overall volume to collect static PhysX geometry
         //! @param tileCallback an empty tile indicates the end of the operation, otherwise a valid shared_ptr is returned with tile geometry
+        //! @param areaToCollect if valid, only the tiles whose scan volume overlaps this area along the x and y axes are collected
         //! @returns true if an async operation was scheduled, false otherwise
         bool CollectGeometryAsyncImpl(
             float tileSize,
             float borderSize,
             const AZ::Aabb& worldVolume,
-            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback);
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback,
+            const AZ::Aabb& areaToCollect = AZ::Aabb::CreateNull());
 
         //! Finds all the static PhysX colliders within a given volume.
         //! @param volume the world to look for static colliders
@@ -101,6 +107,12 @@ namespace RecastNavigation
     protected:
         void OnConfigurationChanged();
 
+        //! Marks the area of a static simulated body as needing a navigation mesh update.
+        void OnSimulatedBodyChanged(AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle);
+
+        //! Requests the navigation mesh to update the tiles of the area changed since the last update.
+        void OnUpdateChangedArea();
+
         AZ::EntityComponentIdPair m_entityComponentIdPair;
         RecastNavigationPhysXProviderConfig m_config;
 
@@ -117,5 +129,15 @@ namespace RecastNavigation
         AZ::TaskExecutor m_taskExecutor;
         AZStd::unique_ptr<AZ::TaskGraphEvent> m_taskGraphEvent;
         AZ::TaskDescriptor m_taskDescriptor{ "Collect Geometry", "Recast Navigation" };
+
+        //! Handlers for static colliders being added to or removed from the PhysX scene, when @m_updateOnPhysicsChanges is enabled.
+        AzPhysics::SceneEvents::OnSimulationBodyAdded::Handler m_simulatedBodyAddedHandler;
+        AzPhysics::SceneEvents::OnSimulationBodyRemoved::Handler m_simulatedBodyRemovedHandler;
+
+        //! World area covering the static colliders changed since the last navigation mesh update.
+        AZ::Aabb m_changedArea = AZ::Aabb::CreateNull();
+
+        //! Gathers the physics changes over a short delay, so they are updated together.
+        AZ::ScheduledEvent m_updateChangedAreaEvent{ [this]() { OnUpdateChangedArea(); }, AZ::Name("RecastNavigationUpdateChangedArea") };
     };
 } // namespace RecastNavigation
@@ -15,9 +15,10 @@ namespace RecastNavigation
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<RecastNavigationPhysXProviderConfig>()
-                ->Version(2)
+                ->Version(3)
                 ->Field("Use Editor Scene", &RecastNavigationPhysXProviderConfig::m_useEditorScene)
                 ->Field("Collision Group", &RecastNavigationPhysXProviderConfig::m_collisionGroupId)
+                ->Field("Update On Physics Changes", &RecastNavigationPhysXProviderConfig::m_updateOnPhysicsChanges)
                 ;
         }
     }
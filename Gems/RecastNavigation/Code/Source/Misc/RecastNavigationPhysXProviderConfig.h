@@ -30,5 +30,8 @@ namespace RecastNavigation
 
         //! Only colliders from the specified collision group will be considered.
         AzPhysics::CollisionGroups::Id m_collisionGroupId;
+
+        //! If enabled, the tiles of the navigation mesh are updated when static colliders are added to or removed from the PhysX scene.
+        bool m_updateOnPhysicsChanges = false;
     };
 } // namespace RecastNavigation
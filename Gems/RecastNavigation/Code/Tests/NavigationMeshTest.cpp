@@ -874,6 +874,25 @@ namespace RecastNavigationTests
         EXPECT_EQ(tiles.size(), 0);
     }
 
+    TEST_F(NavigationTest, UpdateWithinInvalidAreaIsNotScheduled)
+    {
+        Entity e;
+        PopulateEntity(e);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        bool providerScheduled = true;
+        RecastNavigation::RecastNavigationProviderRequestBus::EventResult(providerScheduled, e.GetId(),
+            &RecastNavigation::RecastNavigationProviderRequests::CollectGeometryWithinAreaAsync,
+            5.f, 0.f, AZ::Aabb::CreateNull(), [](AZStd::shared_ptr<RecastNavigation::TileGeometry>) {});
+        EXPECT_FALSE(providerScheduled);
+
+        bool meshScheduled = true;
+        RecastNavigationMeshRequestBus::EventResult(meshScheduled, e.GetId(),
+            &RecastNavigationMeshRequests::UpdateNavigationMeshWithinAreaAsync, AZ::Aabb::CreateNull());
+        EXPECT_FALSE(meshScheduled);
+    }
+
     TEST_F(NavigationTest, DetourSetNavMeshEntity)
     {
         Entity e;
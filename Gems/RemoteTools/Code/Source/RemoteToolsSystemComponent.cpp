@@ -26,9 +26,34 @@ namespace RemoteTools
     // id for the local application
     static constexpr AZ::u32 SelfNetworkId = 0xFFFFFFFF;
 
+    // Size of the prefix of each message in a batch
+    static constexpr uint32_t MessageSizePrefixSize = sizeof(uint32_t);
+
     AZ_CVAR(uint16_t, remote_outbox_interval, 50, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The interval to process outbound messages.");
     AZ_CVAR(uint16_t, remote_join_interval, 1000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The interval to attempt automatic connecitons.");
-    
+    AZ_CVAR(uint32_t, remote_outbox_send_budget, 256 * 1024, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The maximum number of bytes sent to an endpoint each time outbound messages are processed, the rest waits for the next interval.");
+    AZ_CVAR(uint32_t, remote_outbox_max_queued_bytes, 16 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The maximum number of bytes of large messages waiting to be sent to an endpoint, messages beyond it are dropped.");
+
+    static void WriteMessageSize(RemoteToolsMessageData& batch, uint32_t messageSize)
+    {
+        // Little endian, regardless of the platforms of the endpoints
+        for (uint32_t byteIndex = 0; byteIndex < MessageSizePrefixSize; ++byteIndex)
+        {
+            batch.push_back(static_cast<char>((messageSize >> (byteIndex * 8)) & 0xFF));
+        }
+    }
+
+    static uint32_t ReadMessageSize(const AZStd::byte* buffer)
+    {
+        uint32_t messageSize = 0;
+        for (uint32_t byteIndex = 0; byteIndex < MessageSizePrefixSize; ++byteIndex)
+        {
+            messageSize |= static_cast<uint32_t>(buffer[byteIndex]) << (byteIndex * 8);
+        }
+        return messageSize;
+    }
 
     void RemoteToolsSystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -110,6 +135,9 @@ namespace RemoteTools
             }
         }
         m_entryRegistry.clear();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_outboxMutex);
+        m_outboxes.clear();
     }
 
     void RemoteToolsSystemComponent::OnSystemTick()
@@ -128,6 +156,135 @@ namespace RemoteTools
         {
             m_joinThread->Join();
         }
+
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        if (currentTimeMs - m_lastOutboxUpdateTimeMs >= AZ::TimeMs{ static_cast<uint16_t>(remote_outbox_interval) })
+        {
+            m_lastOutboxUpdateTimeMs = currentTimeMs;
+            UpdateOutboxes();
+        }
+    }
+
+    void RemoteToolsSystemComponent::UpdateOutboxes()
+    {
+        AzNetworking::INetworking* networking = AZ::Interface<AzNetworking::INetworking>::Get();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_outboxMutex);
+        for (auto outboxIt = m_outboxes.begin(); outboxIt != m_outboxes.end();)
+        {
+            RemoteToolsOutbox& outbox = outboxIt->second;
+            AzNetworking::INetworkInterface* networkInterface =
+                networking ? networking->RetrieveNetworkInterface(outbox.m_interfaceName) : nullptr;
+            if (networkInterface == nullptr)
+            {
+                outboxIt = m_outboxes.erase(outboxIt);
+                continue;
+            }
+
+            if (UpdateOutbox(*networkInterface, outboxIt->first, outbox))
+            {
+                outboxIt = m_outboxes.erase(outboxIt);
+            }
+            else
+            {
+                ++outboxIt;
+            }
+        }
+    }
+
+    bool RemoteToolsSystemComponent::UpdateOutbox(
+        AzNetworking::INetworkInterface& networkInterface,
+        const AZStd::pair<AZ::u32, AZ::u32>& endpointIds,
+        RemoteToolsOutbox& outbox)
+    {
+        // The interactive lane is sent first and the bulk lane gets what's left of the budget
+        const auto& [persistentId, networkId] = endpointIds;
+        size_t sendBudget = remote_outbox_send_budget;
+        bool isEmpty = true;
+        for (uint8_t lane = 0; lane < RemoteToolsLaneCount; ++lane)
+        {
+            RemoteToolsOutboxLane& outboxLane = outbox.m_lanes[lane];
+            if (!SendOutboxLane(
+                    networkInterface, AzNetworking::ConnectionId{ networkId }, persistentId, static_cast<RemoteToolsLane>(lane),
+                    outboxLane, sendBudget))
+            {
+                return false;
+            }
+            isEmpty = isEmpty && outboxLane.m_messages.empty() && outboxLane.m_batchSentBytes == outboxLane.m_batch.size();
+        }
+
+        return isEmpty;
+    }
+
+    bool RemoteToolsSystemComponent::SendOutboxLane(
+        AzNetworking::INetworkInterface& networkInterface,
+        AzNetworking::ConnectionId connectionId,
+        AZ::u32 persistentId,
+        RemoteToolsLane lane,
+        RemoteToolsOutboxLane& outboxLane,
+        size_t& sendBudget)
+    {
+        while (sendBudget > 0)
+        {
+            if (outboxLane.m_batchSentBytes == outboxLane.m_batch.size())
+            {
+                if (outboxLane.m_messages.empty())
+                {
+                    return true;
+                }
+
+                // Batch as many messages as fit in a packet, or a single message spanning several packets
+                outboxLane.m_batch.clear();
+                outboxLane.m_batchMessageTypes.clear();
+                outboxLane.m_batchSentBytes = 0;
+                do
+                {
+                    const RemoteToolsOutboxMessage& message = outboxLane.m_messages.front();
+                    WriteMessageSize(outboxLane.m_batch, aznumeric_cast<uint32_t>(message.m_data.size()));
+                    outboxLane.m_batch.insert(outboxLane.m_batch.end(), message.m_data.begin(), message.m_data.end());
+                    outboxLane.m_batchMessageTypes.push_back(message.m_typeId);
+                    outboxLane.m_queuedBytes -= message.m_data.size();
+                    outboxLane.m_messages.pop_front();
+                } while (!outboxLane.m_messages.empty() &&
+                         outboxLane.m_batch.size() + MessageSizePrefixSize + outboxLane.m_messages.front().m_data.size() <=
+                             RemoteToolsBufferSize);
+            }
+
+            const size_t batchSize = outboxLane.m_batch.size();
+            const size_t packetSize = AZStd::min(batchSize - outboxLane.m_batchSentBytes, aznumeric_cast<size_t>(RemoteToolsBufferSize));
+            RemoteToolsPackets::RemoteToolsMessage tmPacket;
+            tmPacket.SetPersistentId(persistentId);
+            tmPacket.SetSize(aznumeric_cast<uint32_t>(batchSize));
+            tmPacket.SetLane(static_cast<uint8_t>(lane));
+            RemoteToolsMessageBuffer encodingBuffer;
+            encodingBuffer.CopyValues(reinterpret_cast<const uint8_t*>(outboxLane.m_batch.data()) + outboxLane.m_batchSentBytes, packetSize);
+            tmPacket.SetMessageBuffer(encodingBuffer);
+
+            if (!networkInterface.SendReliablePacket(connectionId, tmPacket))
+            {
+                AZ_Warning("RemoteToolsSystemComponent", false, "SendReliablePacket failed with remaining bytes %zu of %zu, retrying later.\n",
+                    batchSize - outboxLane.m_batchSentBytes, batchSize);
+                return false;
+            }
+
+            outboxLane.m_batchSentBytes += packetSize;
+            sendBudget -= AZStd::min(sendBudget, packetSize);
+
+            if (outboxLane.m_batchSentBytes == batchSize)
+            {
+                for (const AZ::TypeId& typeId : outboxLane.m_batchMessageTypes)
+                {
+                    auto pendingTypeIt = outboxLane.m_pendingMessageTypes.find(typeId);
+                    if (--pendingTypeIt->second == 0)
+                    {
+                        outboxLane.m_pendingMessageTypes.erase(pendingTypeIt);
+                    }
+                }
+                outboxLane.m_batchMessageTypes.clear();
+            }
+        }
+
+        return true;
     }
 
     void RemoteToolsSystemComponent::RegisterToolingServiceClient(AZ::Crc32 key, AZ::Name name, uint16_t port)
@@ -261,8 +418,11 @@ namespace RemoteTools
                 AzFramework::RemoteToolsEndpointInfo ti = GetEndpointInfo(key, desiredTargetID);
                 AZ::u32 oldTargetID = entry.m_lastTarget.GetPersistentId();
                 entry.m_lastTarget = ti;
-                entry.m_tmpInboundBuffer.clear();
-                entry.m_tmpInboundBufferPos = 0;
+                for (uint8_t lane = 0; lane < RemoteToolsLaneCount; ++lane)
+                {
+                    entry.m_tmpInboundBuffer[lane].clear();
+                    entry.m_tmpInboundBufferPos[lane] = 0;
+                }
 
                 m_entryRegistry[key].m_endpointChangedEvent.Signal(desiredTargetID, oldTargetID);
 
@@ -349,10 +509,8 @@ namespace RemoteTools
         const size_t totalSize = msgBuffer.size();
         if (target.IsSelf())
         {
-            AZStd::vector<AZStd::byte> buffer;
-            buffer.reserve(static_cast<uint32_t>(totalSize));
-            memcpy(buffer.begin(), msgBuffer.data(), totalSize);
-            AzFramework::RemoteToolsMessage* result = DeserializeMessage(target.GetPersistentId(), buffer, static_cast<uint32_t>(totalSize));
+            AzFramework::RemoteToolsMessage* result = DeserializeMessage(
+                target.GetPersistentId(), reinterpret_cast<const AZStd::byte*>(msgBuffer.data()), static_cast<uint32_t>(totalSize));
 
             m_inboxMutex.lock();
             if (!m_inbox[target.GetPersistentId()].full())
@@ -370,33 +528,30 @@ namespace RemoteTools
             return;
         }
 
-        AzNetworking::INetworkInterface* networkInterface =
-            AZ::Interface<AzNetworking::INetworking>::Get()->RetrieveNetworkInterface(
-                AZ::Name(m_entryRegistry[target.GetPersistentId()].m_name));
-
-        auto connectionId = static_cast<AzNetworking::ConnectionId>(target.GetNetworkId());
-        const uint8_t* outBuffer = reinterpret_cast<const uint8_t*>(msgBuffer.data());
-        size_t outSize = totalSize;
-        while (outSize > 0 && networkInterface != nullptr)
-        {
-            // Fragment the message into RemoteToolsMessageBuffer packet sized chunks and send
-            size_t bufferSize = AZStd::min(outSize, aznumeric_cast<size_t>(RemoteToolsBufferSize));
-            RemoteToolsPackets::RemoteToolsMessage tmPacket;
-            tmPacket.SetPersistentId(target.GetPersistentId());
-            tmPacket.SetSize(aznumeric_cast<uint32_t>(totalSize));
-            RemoteToolsMessageBuffer encodingBuffer;
-            encodingBuffer.CopyValues(outBuffer + (totalSize - outSize), bufferSize);
-            tmPacket.SetMessageBuffer(encodingBuffer);
+        // Queue the message, it's sent with the next batch of its lane when the outbox is processed
+        AZStd::lock_guard<AZStd::mutex> lock(m_outboxMutex);
+        RemoteToolsOutbox& outbox = m_outboxes[AZStd::make_pair(target.GetPersistentId(), target.GetNetworkId())];
+        outbox.m_interfaceName = m_entryRegistry[target.GetPersistentId()].m_name;
 
-            if (!networkInterface->SendReliablePacket(connectionId, tmPacket))
-            {
-                AZ_Error("RemoteToolsSystemComponent", false, "SendReliablePacket failed with remaining bytes %zu of %zu.\n", outSize, totalSize);
-                break;
-            }
+        // Small messages follow the earlier messages of their type still on the bulk lane, so they aren't received ahead of them
+        const AZ::TypeId typeId = msg.RTTI_GetType();
+        const RemoteToolsOutboxLane& bulkLane = outbox.m_lanes[static_cast<uint8_t>(RemoteToolsLane::Bulk)];
+        const bool fitsInPacket = totalSize + MessageSizePrefixSize <= RemoteToolsBufferSize;
+        const RemoteToolsLane lane = (fitsInPacket && !bulkLane.m_pendingMessageTypes.contains(typeId))
+            ? RemoteToolsLane::Interactive
+            : RemoteToolsLane::Bulk;
 
-            outSize -= bufferSize;
+        RemoteToolsOutboxLane& outboxLane = outbox.m_lanes[static_cast<uint8_t>(lane)];
+        if (lane == RemoteToolsLane::Bulk && outboxLane.m_queuedBytes > 0 && outboxLane.m_queuedBytes + totalSize > remote_outbox_max_queued_bytes)
+        {
+            // The endpoint isn't keeping up, drop the message rather than growing the outbox indefinitely
+            AZ_Warning("RemoteToolsSystemComponent", false, "Outbox is full, a %zu byte message got dropped on %u channel",
+                totalSize, target.GetPersistentId());
+            return;
         }
-
+        outboxLane.m_queuedBytes += totalSize;
+        ++outboxLane.m_pendingMessageTypes[typeId];
+        outboxLane.m_messages.push_back({ typeId, AZStd::move(msgBuffer) });
     }
 
     void RemoteToolsSystemComponent::OnMessageParsed(
@@ -466,33 +621,33 @@ namespace RemoteTools
             }
         }
 
+        const uint8_t lane = packet.GetLane();
+        if (lane >= RemoteToolsLaneCount)
+        {
+            AZ_Error("RemoteToolsSystemComponent", false, "Received a message on unknown lane %u", lane);
+            return false;
+        }
+
+        RemoteToolsRegistryEntry& entry = m_entryRegistry[key];
+        AZStd::vector<AZStd::byte>& inboundBuffer = entry.m_tmpInboundBuffer[lane];
+        uint32_t& inboundBufferPos = entry.m_tmpInboundBufferPos[lane];
         const uint32_t totalBufferSize = packet.GetSize();
 
-        // Messages can be larger than the size of a packet so reserve a buffer for the total message size
-        if (m_entryRegistry[key].m_tmpInboundBufferPos == 0)
+        // Batches can be larger than the size of a packet so reserve a buffer for the total batch size
+        if (inboundBufferPos == 0)
         {
-            m_entryRegistry[key].m_tmpInboundBuffer.reserve(totalBufferSize);
+            inboundBuffer.resize_no_construct(totalBufferSize);
         }
 
         // Read as much data as the packet can include and append it to the buffer
-        const uint32_t readSize = AZStd::min(totalBufferSize - m_entryRegistry[key].m_tmpInboundBufferPos, RemoteToolsBufferSize);
-        memcpy(
-            m_entryRegistry[key].m_tmpInboundBuffer.begin() + m_entryRegistry[key].m_tmpInboundBufferPos,
-            packet.GetMessageBuffer().GetBuffer(), readSize);
-        m_entryRegistry[key].m_tmpInboundBufferPos += readSize;
-        if (m_entryRegistry[key].m_tmpInboundBufferPos == totalBufferSize)
+        const uint32_t readSize = AZStd::min(totalBufferSize - inboundBufferPos, RemoteToolsBufferSize);
+        memcpy(inboundBuffer.data() + inboundBufferPos, packet.GetMessageBuffer().GetBuffer(), readSize);
+        inboundBufferPos += readSize;
+        if (inboundBufferPos == totalBufferSize)
         {
-            AzFramework::RemoteToolsMessage* msg = DeserializeMessage(key, m_entryRegistry[key].m_tmpInboundBuffer, totalBufferSize);
-            m_entryRegistry[key].m_tmpInboundBuffer.clear();
-            m_entryRegistry[key].m_tmpInboundBufferPos = 0;
-
-            // Append to the inbox for handling
-            if (msg)
-            {
-                m_inboxMutex.lock();
-                m_inbox[msg->GetSenderTargetId()].push_back(msg);
-                m_inboxMutex.unlock();
-            }
+            DeserializeBatch(key, inboundBuffer.data(), totalBufferSize);
+            inboundBuffer.clear();
+            inboundBufferPos = 0;
         }
 
         return true;
@@ -550,6 +705,15 @@ namespace RemoteTools
             }
         }
 
+        // Messages still waiting to be sent to the endpoint can't be resumed on another connection
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_outboxMutex);
+            AZStd::erase_if(m_outboxes, [connection](const auto& outbox)
+            {
+                return outbox.first.second == static_cast<AZ::u32>(connection->GetConnectionId());
+            });
+        }
+
         if (m_joinThread && !m_joinThread->IsRunning())
         {
             m_joinThread->Join();
@@ -557,14 +721,49 @@ namespace RemoteTools
         }
     }
 
+    void RemoteToolsSystemComponent::DeserializeBatch(const AZ::Crc32& key, const AZStd::byte* buffer, uint32_t bufferSize)
+    {
+        uint32_t bufferPos = 0;
+        while (bufferPos + MessageSizePrefixSize <= bufferSize)
+        {
+            const uint32_t messageSize = ReadMessageSize(buffer + bufferPos);
+            bufferPos += MessageSizePrefixSize;
+            if (messageSize > bufferSize - bufferPos)
+            {
+                AZ_Error("RemoteToolsSystemComponent", false, "Received a truncated message of %u bytes on %u channel", messageSize, static_cast<AZ::u32>(key));
+                return;
+            }
+
+            AzFramework::RemoteToolsMessage* msg = DeserializeMessage(key, buffer + bufferPos, messageSize);
+            bufferPos += messageSize;
+
+            // Append to the inbox for handling
+            if (msg)
+            {
+                m_inboxMutex.lock();
+                AzFramework::ReceivedRemoteToolsMessages& inbox = m_inbox[msg->GetSenderTargetId()];
+                if (!inbox.full())
+                {
+                    inbox.push_back(msg);
+                }
+                else
+                {
+                    AZ_Error("RemoteTool", false, "Inbox is full, a message got skipped on %d channel", msg->GetSenderTargetId());
+                    delete msg;
+                }
+                m_inboxMutex.unlock();
+            }
+        }
+    }
+
     AzFramework::RemoteToolsMessage* RemoteToolsSystemComponent::DeserializeMessage(
-        const AZ::Crc32& key, AZStd::vector<AZStd::byte>& buffer, const uint32_t& totalBufferSize)
+        const AZ::Crc32& key, const AZStd::byte* buffer, uint32_t bufferSize)
     {
         AZ::SerializeContext* serializeContext;
         AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
 
         // Deserialize the complete buffer
-        AZ::IO::MemoryStream msgBuffer(buffer.data(), totalBufferSize, totalBufferSize);
+        AZ::IO::MemoryStream msgBuffer(buffer, bufferSize);
         AzFramework::RemoteToolsMessage* msg = nullptr; 
         AZ::ObjectStream::ClassReadyCB readyCB(AZStd::bind(
             &RemoteToolsSystemComponent::OnMessageParsed, this, &msg, AZStd::placeholders::_1, AZStd::placeholders::_2,
@@ -10,6 +10,9 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Time/ITime.h>
 #include <AzFramework/Network/IRemoteTools.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
@@ -17,18 +20,68 @@
 
 #include "Utilities/RemoteToolsJoinThread.h"
 
+namespace AzNetworking
+{
+    class INetworkInterface;
+} // namespace AzNetworking
+
 namespace RemoteToolsPackets
 {
     class RemoteToolsConnect;
     class RemoteToolsMessage;
 } // namespace RemoteToolsPackets
 
+namespace UnitTest
+{
+    class RemoteToolsOutboxTests;
+} // namespace UnitTest
+
 namespace RemoteTools
 {
     // Slightly below AzNetworking's TCP max packet size for maximum message space with room for packet headers
     static constexpr uint32_t RemoteToolsBufferSize = AzNetworking::MaxPacketSize - 384;
     using RemoteToolsMessageBuffer = AzNetworking::ByteBuffer<RemoteToolsBufferSize>;
 
+    //! Outbound messages are sent in batches through one of these lanes.
+    //! Messages fitting in a single packet use the interactive lane, which is sent ahead of the bulk lane, so large messages
+    //! such as profiler captures streaming from a device don't delay the debugger traffic.
+    //! Messages of the same type are received in the order they're sent: while a type has messages on the bulk lane, its smaller
+    //! messages are queued behind them on the bulk lane. Messages of different types can be received out of order.
+    enum class RemoteToolsLane : uint8_t
+    {
+        Interactive,
+        Bulk
+    };
+    static constexpr uint8_t RemoteToolsLaneCount = 2;
+
+    using RemoteToolsMessageData = AZStd::vector<char, AZ::OSStdAllocator>;
+
+    struct RemoteToolsOutboxMessage
+    {
+        AZ::TypeId m_typeId;
+        RemoteToolsMessageData m_data;
+    };
+
+    struct RemoteToolsOutboxLane
+    {
+        AZStd::deque<RemoteToolsOutboxMessage> m_messages;
+        size_t m_queuedBytes = 0;
+
+        // Number of messages of each type queued or being sent on the lane
+        AZStd::unordered_map<AZ::TypeId, uint32_t> m_pendingMessageTypes;
+
+        // Size prefixed messages being sent, a batch can take several packets and outbox updates to send
+        RemoteToolsMessageData m_batch;
+        AZStd::vector<AZ::TypeId> m_batchMessageTypes;
+        size_t m_batchSentBytes = 0;
+    };
+
+    struct RemoteToolsOutbox
+    {
+        AZ::Name m_interfaceName;
+        RemoteToolsOutboxLane m_lanes[RemoteToolsLaneCount];
+    };
+
     struct RemoteToolsRegistryEntry
     {
         bool m_isHost;
@@ -37,8 +90,8 @@ namespace RemoteTools
 
         AzFramework::RemoteToolsEndpointContainer m_availableTargets;
         AzFramework::RemoteToolsEndpointInfo m_lastTarget;
-        AZStd::vector<AZStd::byte> m_tmpInboundBuffer;
-        uint32_t m_tmpInboundBufferPos;
+        AZStd::vector<AZStd::byte> m_tmpInboundBuffer[RemoteToolsLaneCount];
+        uint32_t m_tmpInboundBufferPos[RemoteToolsLaneCount] = {};
 
         AzFramework::RemoteToolsEndpointStatusEvent m_endpointJoinedEvent;
         AzFramework::RemoteToolsEndpointStatusEvent m_endpointLeftEvent;
@@ -53,6 +106,7 @@ namespace RemoteTools
         , public AzNetworking::IConnectionListener
     {
         friend class RemoteToolsJoinThread;
+        friend class UnitTest::RemoteToolsOutboxTests;
 
     public:
         AZ_COMPONENT(RemoteToolsSystemComponent, "{ca110b7c-795e-4fa5-baa9-a115d7e3d86e}");
@@ -156,7 +210,32 @@ namespace RemoteTools
 
         AZStd::set<AZ::Crc32> m_messageTypesToClearForNextTick;
 
+        // Messages waiting to be sent, by endpoint persistent id and network id
+        AZStd::unordered_map<AZStd::pair<AZ::u32, AZ::u32>, RemoteToolsOutbox> m_outboxes;
+        AZStd::mutex m_outboxMutex;
+        AZ::TimeMs m_lastOutboxUpdateTimeMs = AZ::Time::ZeroTimeMs;
+
     private:
-        AzFramework::RemoteToolsMessage* DeserializeMessage(const AZ::Crc32& key, AZStd::vector<AZStd::byte>& buffer, const uint32_t& totalBufferSize);
+        void UpdateOutboxes();
+
+        //! Sends the lanes of an outbox, the interactive lane first.
+        //! @return true if everything queued in the outbox was sent
+        bool UpdateOutbox(
+            AzNetworking::INetworkInterface& networkInterface,
+            const AZStd::pair<AZ::u32, AZ::u32>& endpointIds,
+            RemoteToolsOutbox& outbox);
+
+        //! Sends the batches of an outbox lane until it's empty or the send budget is spent.
+        //! @return false if the connection couldn't take more packets, the rest is sent on the next outbox update
+        bool SendOutboxLane(
+            AzNetworking::INetworkInterface& networkInterface,
+            AzNetworking::ConnectionId connectionId,
+            AZ::u32 persistentId,
+            RemoteToolsLane lane,
+            RemoteToolsOutboxLane& outboxLane,
+            size_t& sendBudget);
+
+        void DeserializeBatch(const AZ::Crc32& key, const AZStd::byte* buffer, uint32_t bufferSize);
+        AzFramework::RemoteToolsMessage* DeserializeMessage(const AZ::Crc32& key, const AZStd::byte* buffer, uint32_t bufferSize);
     };
 } // namespace RemoteTools
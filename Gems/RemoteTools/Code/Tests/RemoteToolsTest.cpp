@@ -8,6 +8,7 @@
 
 #include <AzTest/AzTest.h>
 
+#include <AzCore/Console/Console.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Name/NameDictionary.h>
@@ -18,9 +19,13 @@
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AzFramework/Network/IRemoteTools.h>
 #include <AzFramework/Script/ScriptDebugMsgReflection.h>
+#include <AzNetworking/Framework/INetworkInterface.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/TcpTransport/TcpConnectionSet.h>
+#include <AzNetworking/TcpTransport/TcpPacketHeader.h>
 
 #include <RemoteToolsSystemComponent.h>
+#include <Source/AutoGen/RemoteTools.AutoPackets.h>
 
 namespace UnitTest
 {
@@ -127,6 +132,326 @@ namespace UnitTest
         m_remoteTools->ClearReceivedMessages(TestToolsKey);
     }
 
+    static constexpr AZ::u32 TestNetworkId = 1;
+
+    //! Network interface keeping the packets sent through it, sends fail once the remaining send count runs out
+    class TestNetworkInterface final
+        : public AzNetworking::INetworkInterface
+    {
+    public:
+        explicit TestNetworkInterface(AzNetworking::IConnectionListener& connectionListener)
+            : m_connectionListener(connectionListener)
+        {
+        }
+
+        AZ::Name GetName() const override { return AZ::Name(); }
+        AzNetworking::ProtocolType GetType() const override { return AzNetworking::ProtocolType::Tcp; }
+        AzNetworking::TrustZone GetTrustZone() const override { return AzNetworking::TrustZone::ExternalClientToServer; }
+        uint16_t GetPort() const override { return 0; }
+        AzNetworking::IConnectionSet& GetConnectionSet() override { return m_connectionSet; }
+        AzNetworking::IConnectionListener& GetConnectionListener() override { return m_connectionListener; }
+        bool Listen(uint16_t) override { return false; }
+        AzNetworking::ConnectionId Connect(const AzNetworking::IpAddress&, uint16_t) override { return AzNetworking::InvalidConnectionId; }
+        void Update() override {}
+        AzNetworking::PacketId SendUnreliablePacket(AzNetworking::ConnectionId, const AzNetworking::IPacket&) override
+        {
+            return AzNetworking::InvalidPacketId;
+        }
+        bool WasPacketAcked(AzNetworking::ConnectionId, AzNetworking::PacketId) override { return false; }
+        bool StopListening() override { return false; }
+        bool Disconnect(AzNetworking::ConnectionId, AzNetworking::DisconnectReason) override { return false; }
+        void SetTimeoutMs(AZ::TimeMs) override {}
+        AZ::TimeMs GetTimeoutMs() const override { return AZ::Time::ZeroTimeMs; }
+        bool IsEncrypted() const override { return false; }
+        bool IsOpen() const override { return true; }
+
+        bool SendReliablePacket(AzNetworking::ConnectionId connectionId, const AzNetworking::IPacket& packet) override
+        {
+            if (m_remainingSendCount == 0)
+            {
+                return false;
+            }
+            --m_remainingSendCount;
+
+            EXPECT_EQ(connectionId, AzNetworking::ConnectionId{ TestNetworkId });
+            EXPECT_EQ(packet.GetPacketType(), RemoteToolsPackets::RemoteToolsMessage::Type);
+            m_sentPackets.push_back(static_cast<const RemoteToolsPackets::RemoteToolsMessage&>(packet));
+            return true;
+        }
+
+        AZStd::vector<RemoteToolsPackets::RemoteToolsMessage> m_sentPackets;
+        uint32_t m_remainingSendCount = AZStd::numeric_limits<uint32_t>::max();
+
+    private:
+        AzNetworking::IConnectionListener& m_connectionListener;
+        AzNetworking::TcpConnectionSet m_connectionSet;
+    };
+
+    //! Connection to the host the sent packets are received from
+    class TestConnection final
+        : public AzNetworking::IConnection
+    {
+    public:
+        TestConnection()
+            : IConnection(
+                  AzNetworking::ConnectionId{ TestNetworkId }, AzNetworking::IpAddress("127.0.0.1", 6999, AzNetworking::ProtocolType::Tcp))
+        {
+        }
+
+        bool SendReliablePacket(const AzNetworking::IPacket&) override { return false; }
+        AzNetworking::PacketId SendUnreliablePacket(const AzNetworking::IPacket&) override { return AzNetworking::InvalidPacketId; }
+        bool WasPacketAcked(AzNetworking::PacketId) const override { return false; }
+        AzNetworking::ConnectionState GetConnectionState() const override { return AzNetworking::ConnectionState::Connected; }
+        AzNetworking::ConnectionRole GetConnectionRole() const override { return AzNetworking::ConnectionRole::Connector; }
+        bool Disconnect(AzNetworking::DisconnectReason, AzNetworking::TerminationEndpoint) override { return false; }
+        void SetConnectionMtu(uint32_t) override {}
+        uint32_t GetConnectionMtu() const override { return 0; }
+    };
+
+    class RemoteToolsOutboxTests : public RemoteToolsTests
+    {
+    public:
+        void SetUp() override
+        {
+            RemoteToolsTests::SetUp();
+
+            m_console = AZStd::make_unique<AZ::Console>();
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+            m_networkInterface = AZStd::make_unique<TestNetworkInterface>(*m_remoteToolsSystemComponent);
+            m_target.SetInfo("Target", TestToolsKey, TestNetworkId);
+        }
+
+        void TearDown() override
+        {
+            m_remoteTools->ClearReceivedMessages(TestToolsKey);
+            m_networkInterface.reset();
+
+            m_console->PerformCommand("remote_outbox_send_budget 262144");
+            m_console->PerformCommand("remote_outbox_max_queued_bytes 16777216");
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console.reset();
+
+            RemoteToolsTests::TearDown();
+        }
+
+        //! Processes the outbox of the target like UpdateOutboxes does, through the test network interface
+        bool UpdateOutbox()
+        {
+            auto& outboxes = m_remoteToolsSystemComponent->m_outboxes;
+            auto outboxIt = outboxes.find(AZStd::make_pair(m_target.GetPersistentId(), m_target.GetNetworkId()));
+            if (outboxIt == outboxes.end())
+            {
+                return true;
+            }
+
+            if (m_remoteToolsSystemComponent->UpdateOutbox(*m_networkInterface, outboxIt->first, outboxIt->second))
+            {
+                outboxes.erase(outboxIt);
+                return true;
+            }
+            return false;
+        }
+
+        //! Receives the packets sent so far, in the order they were sent
+        void ReceiveSentPackets()
+        {
+            TestConnection connection;
+            for (const RemoteToolsPackets::RemoteToolsMessage& packet : m_networkInterface->m_sentPackets)
+            {
+                const AzNetworking::TcpPacketHeader packetHeader(packet.GetPacketType(), 0);
+                EXPECT_TRUE(m_remoteToolsSystemComponent->HandleRequest(&connection, packetHeader, packet));
+            }
+            m_networkInterface->m_sentPackets.clear();
+        }
+
+        size_t GetSentPacketCount(RemoteToolsLane lane) const
+        {
+            return AZStd::count_if(
+                m_networkInterface->m_sentPackets.begin(), m_networkInterface->m_sentPackets.end(),
+                [lane](const RemoteToolsPackets::RemoteToolsMessage& packet)
+                {
+                    return packet.GetLane() == static_cast<uint8_t>(lane);
+                });
+        }
+
+        template<typename MessageType>
+        const MessageType* GetReceivedMessage(size_t index) const
+        {
+            const AzFramework::ReceivedRemoteToolsMessages* receivedMessages = m_remoteTools->GetReceivedMessages(TestToolsKey);
+            if (receivedMessages == nullptr || index >= receivedMessages->size())
+            {
+                return nullptr;
+            }
+            return azrtti_cast<const MessageType*>(receivedMessages->at(index).get());
+        }
+
+        size_t GetReceivedMessageCount() const
+        {
+            const AzFramework::ReceivedRemoteToolsMessages* receivedMessages = m_remoteTools->GetReceivedMessages(TestToolsKey);
+            return receivedMessages ? receivedMessages->size() : 0;
+        }
+
+        //! Message needing several packets, so it's sent on the bulk lane
+        static AzFramework::ScriptDebugBreakpointRequest MakeLargeMessage(AZ::u32 line)
+        {
+            const AZStd::string context(3 * RemoteToolsBufferSize, 'x');
+            return AzFramework::ScriptDebugBreakpointRequest(1, context.c_str(), line);
+        }
+
+        AZStd::unique_ptr<AZ::Console> m_console;
+        AZStd::unique_ptr<TestNetworkInterface> m_networkInterface;
+        AzFramework::RemoteToolsEndpointInfo m_target;
+    };
+
+    TEST_F(RemoteToolsOutboxTests, TEST_RemoteToolsSmallMessagesRoundTripInOneBatch)
+    {
+        for (AZ::u32 line = 1; line <= 3; ++line)
+        {
+            m_remoteTools->SendRemoteToolsMessage(m_target, AzFramework::ScriptDebugBreakpointRequest(1, "test", line));
+        }
+        m_remoteTools->SendRemoteToolsMessage(m_target, AzFramework::ScriptDebugAck(2, 3));
+
+        // Nothing is sent until the outbox is processed, then the messages are packed in a single packet
+        EXPECT_TRUE(m_networkInterface->m_sentPackets.empty());
+        EXPECT_TRUE(UpdateOutbox());
+        ASSERT_EQ(m_networkInterface->m_sentPackets.size(), 1);
+        EXPECT_EQ(GetSentPacketCount(RemoteToolsLane::Interactive), 1);
+
+        ReceiveSentPackets();
+        ASSERT_EQ(GetReceivedMessageCount(), 4);
+        for (AZ::u32 line = 1; line <= 3; ++line)
+        {
+            const auto* msg = GetReceivedMessage<AzFramework::ScriptDebugBreakpointRequest>(line - 1);
+            ASSERT_NE(msg, nullptr);
+            EXPECT_EQ(msg->m_request, 1);
+            EXPECT_STREQ(msg->m_context.c_str(), "test");
+            EXPECT_EQ(msg->m_line, line);
+        }
+
+        const auto* ack = GetReceivedMessage<AzFramework::ScriptDebugAck>(3);
+        ASSERT_NE(ack, nullptr);
+        EXPECT_EQ(ack->m_request, 2);
+        EXPECT_EQ(ack->m_ackCode, 3);
+    }
+
+    TEST_F(RemoteToolsOutboxTests, TEST_RemoteToolsInterleavedLanesReassembled)
+    {
+        // Limit each outbox update to about one packet, so the large message takes several updates
+        m_console->PerformCommand(AZStd::string::format("remote_outbox_send_budget %u", RemoteToolsBufferSize).c_str());
+
+        const AzFramework::ScriptDebugBreakpointRequest largeMessage = MakeLargeMessage(7);
+        m_remoteTools->SendRemoteToolsMessage(m_target, largeMessage);
+
+        AZ::u32 ackCount = 0;
+        bool isEmpty = false;
+        while (!isEmpty && ackCount < 10)
+        {
+            m_remoteTools->SendRemoteToolsMessage(m_target, AzFramework::ScriptDebugAck(ackCount++));
+            isEmpty = UpdateOutbox();
+        }
+        ASSERT_TRUE(isEmpty);
+
+        // An ack went out on the interactive lane between each of the packets of the large message
+        const AZStd::vector<RemoteToolsPackets::RemoteToolsMessage>& sentPackets = m_networkInterface->m_sentPackets;
+        ASSERT_GT(GetSentPacketCount(RemoteToolsLane::Bulk), 1);
+        EXPECT_EQ(GetSentPacketCount(RemoteToolsLane::Interactive), ackCount);
+        for (size_t packetIndex = 0; packetIndex < sentPackets.size(); ++packetIndex)
+        {
+            const RemoteToolsLane expectedLane = (packetIndex % 2 == 0) ? RemoteToolsLane::Interactive : RemoteToolsLane::Bulk;
+            EXPECT_EQ(sentPackets[packetIndex].GetLane(), static_cast<uint8_t>(expectedLane));
+        }
+
+        // The acks are received as their packets arrive, the large message once its last packet arrives
+        ReceiveSentPackets();
+        ASSERT_EQ(GetReceivedMessageCount(), ackCount + 1);
+        for (AZ::u32 ackIndex = 0; ackIndex < ackCount; ++ackIndex)
+        {
+            const auto* ack = GetReceivedMessage<AzFramework::ScriptDebugAck>(ackIndex);
+            ASSERT_NE(ack, nullptr);
+            EXPECT_EQ(ack->m_request, ackIndex);
+        }
+
+        const auto* msg = GetReceivedMessage<AzFramework::ScriptDebugBreakpointRequest>(ackCount);
+        ASSERT_NE(msg, nullptr);
+        EXPECT_EQ(msg->m_context, largeMessage.m_context);
+        EXPECT_EQ(msg->m_line, 7);
+    }
+
+    TEST_F(RemoteToolsOutboxTests, TEST_RemoteToolsPartialBatchResumedAfterFailedSend)
+    {
+        const AzFramework::ScriptDebugBreakpointRequest largeMessage = MakeLargeMessage(7);
+        m_remoteTools->SendRemoteToolsMessage(m_target, largeMessage);
+
+        // The connection takes a single packet, the rest of the batch waits for the next update
+        m_networkInterface->m_remainingSendCount = 1;
+        EXPECT_FALSE(UpdateOutbox());
+        ASSERT_EQ(m_networkInterface->m_sentPackets.size(), 1);
+        const uint32_t batchSize = m_networkInterface->m_sentPackets.front().GetSize();
+
+        m_networkInterface->m_remainingSendCount = AZStd::numeric_limits<uint32_t>::max();
+        EXPECT_TRUE(UpdateOutbox());
+
+        // Every part of the batch is sent exactly once
+        const size_t expectedPacketCount = (batchSize + RemoteToolsBufferSize - 1) / RemoteToolsBufferSize;
+        EXPECT_EQ(m_networkInterface->m_sentPackets.size(), expectedPacketCount);
+
+        ReceiveSentPackets();
+        ASSERT_EQ(GetReceivedMessageCount(), 1);
+        const auto* msg = GetReceivedMessage<AzFramework::ScriptDebugBreakpointRequest>(0);
+        ASSERT_NE(msg, nullptr);
+        EXPECT_EQ(msg->m_context, largeMessage.m_context);
+        EXPECT_EQ(msg->m_line, 7);
+    }
+
+    TEST_F(RemoteToolsOutboxTests, TEST_RemoteToolsBulkMessagesBeyondMaxQueuedBytesDropped)
+    {
+        m_console->PerformCommand(AZStd::string::format("remote_outbox_max_queued_bytes %u", 4 * RemoteToolsBufferSize).c_str());
+
+        // The second large message doesn't fit in the bulk lane limit, the interactive lane isn't limited
+        m_remoteTools->SendRemoteToolsMessage(m_target, MakeLargeMessage(1));
+        m_remoteTools->SendRemoteToolsMessage(m_target, MakeLargeMessage(2));
+        m_remoteTools->SendRemoteToolsMessage(m_target, AzFramework::ScriptDebugAck(3));
+        EXPECT_TRUE(UpdateOutbox());
+
+        ReceiveSentPackets();
+        ASSERT_EQ(GetReceivedMessageCount(), 2);
+        const auto* ack = GetReceivedMessage<AzFramework::ScriptDebugAck>(0);
+        ASSERT_NE(ack, nullptr);
+        EXPECT_EQ(ack->m_request, 3);
+        const auto* msg = GetReceivedMessage<AzFramework::ScriptDebugBreakpointRequest>(1);
+        ASSERT_NE(msg, nullptr);
+        EXPECT_EQ(msg->m_line, 1);
+    }
+
+    TEST_F(RemoteToolsOutboxTests, TEST_RemoteToolsMessagesOfSameTypeReceivedInOrder)
+    {
+        m_remoteTools->SendRemoteToolsMessage(m_target, MakeLargeMessage(1));
+        m_remoteTools->SendRemoteToolsMessage(m_target, AzFramework::ScriptDebugBreakpointRequest(1, "test", 2));
+        m_remoteTools->SendRemoteToolsMessage(m_target, AzFramework::ScriptDebugAck(3));
+        EXPECT_TRUE(UpdateOutbox());
+
+        // The small breakpoint request waits behind the large one, the ack of another type goes ahead of both
+        ReceiveSentPackets();
+        ASSERT_EQ(GetReceivedMessageCount(), 3);
+        const auto* ack = GetReceivedMessage<AzFramework::ScriptDebugAck>(0);
+        ASSERT_NE(ack, nullptr);
+        EXPECT_EQ(ack->m_request, 3);
+        const auto* largeMsg = GetReceivedMessage<AzFramework::ScriptDebugBreakpointRequest>(1);
+        ASSERT_NE(largeMsg, nullptr);
+        EXPECT_EQ(largeMsg->m_line, 1);
+        const auto* smallMsg = GetReceivedMessage<AzFramework::ScriptDebugBreakpointRequest>(2);
+        ASSERT_NE(smallMsg, nullptr);
+        EXPECT_EQ(smallMsg->m_line, 2);
+
+        // Once the bulk lane is done with the type, its small messages use the interactive lane again
+        m_remoteTools->SendRemoteToolsMessage(m_target, AzFramework::ScriptDebugBreakpointRequest(1, "test", 4));
+        EXPECT_TRUE(UpdateOutbox());
+        EXPECT_EQ(GetSentPacketCount(RemoteToolsLane::Interactive), 1);
+        EXPECT_EQ(GetSentPacketCount(RemoteToolsLane::Bulk), 0);
+    }
+
 }
 
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
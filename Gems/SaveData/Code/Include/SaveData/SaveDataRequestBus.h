@@ -17,9 +17,11 @@
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/typetraits/is_constructible.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 namespace SaveData
@@ -41,6 +43,7 @@ namespace SaveData
         ///@{
         using OnDataBufferSaved = AZStd::function<void(const SaveDataNotifications::DataBufferSavedParams&)>;
         using OnDataBufferLoaded = AZStd::function<void(const SaveDataNotifications::DataBufferLoadedParams&)>;
+        using DataBufferWriter = AZStd::function<bool(AZStd::vector<AZ::u8>& dataBuffer)>;
         ///@}
 
         ////////////////////////////////////////////////////////////////////////////////////////////
@@ -96,6 +99,21 @@ namespace SaveData
             ////////////////////////////////////////////////////////////////////////////////////////
             //! Callback function to invoke on the main thread once the object has saved or loaded.
             OnObjectSavedOrLoaded callback = nullptr;
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! Should the object be serialized on the save thread instead of the calling thread? If
+            //! so, a copy of the object is taken when the save is requested and that snapshot is the
+            //! one that gets serialized (and destroyed) on the save thread, so the original can keep
+            //! being modified. Requires SerializableType to be copy constructible. Ignored when loading.
+            bool serializeOnSaveThread = false;
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! See SaveDataBufferParams::compress. Ignored when loading.
+            bool compress = false;
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! See SaveDataBufferParams::incremental. Ignored when loading.
+            bool incremental = false;
         };
 
         ////////////////////////////////////////////////////////////////////////////////////////////
@@ -138,6 +156,28 @@ namespace SaveData
             ////////////////////////////////////////////////////////////////////////////////////////
             //! Callback function to invoke on the main thread once the data buffer has been saved.
             OnDataBufferSaved callback = nullptr;
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! Optional function invoked on the save thread to write the data to be saved, in which
+            //! case dataBuffer and dataBufferSize are ignored. This lets expensive serialization run
+            //! off the main thread, so it must only access data that is safe to read from the save
+            //! thread (ie. a snapshot taken when the save was requested). The vector it's given may
+            //! be reused from a previous save, and the save fails with ErrorCorrupt if it returns false.
+            DataBufferWriter dataBufferWriter = nullptr;
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! Should the data buffer be compressed (using zstd) on the save thread before it's saved?
+            //! Compressed data buffers are decompressed transparently on the load thread when loaded.
+            bool compress = false;
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! Should the data buffer be compressed incrementally? The data buffer is compressed in
+            //! fixed size chunks, and chunks that are identical to those of the previous incremental
+            //! save of the same data buffer are reused instead of being compressed again. This costs
+            //! keeping a copy of the last saved data in memory, and is most effective for data laid
+            //! out at stable offsets, where changes don't shift the rest of the buffer. Only used if
+            //! compress is also true.
+            bool incremental = false;
         };
 
         ////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,6 +231,46 @@ namespace SaveData
     template<class SerializableType>
     inline void SaveDataRequests::SaveObject(const SaveOrLoadObjectParams<SerializableType>& saveObjectParams)
     {
+        SaveDataBufferParams saveDataBufferParams;
+        saveDataBufferParams.dataBufferName = saveObjectParams.dataBufferName;
+        saveDataBufferParams.localUserId = saveObjectParams.localUserId;
+        saveDataBufferParams.compress = saveObjectParams.compress;
+        saveDataBufferParams.incremental = saveObjectParams.incremental;
+        saveDataBufferParams.callback = [saveObjectParams](const SaveDataNotifications::DataBufferSavedParams& dataBufferSavedParams)
+        {
+            if (saveObjectParams.callback)
+            {
+                saveObjectParams.callback(saveObjectParams, dataBufferSavedParams.result);
+            }
+        };
+
+        if (saveObjectParams.serializeOnSaveThread)
+        {
+            if constexpr (AZStd::is_copy_constructible_v<SerializableType>)
+            {
+                // Snapshot the serializable object and serialize the snapshot on the save thread.
+                AZStd::shared_ptr<SerializableType> snapshot = AZStd::make_shared<SerializableType>(*saveObjectParams.serializableObject);
+                saveDataBufferParams.dataBufferWriter = [snapshot, serializeContext = saveObjectParams.serializeContext](AZStd::vector<AZ::u8>& dataBuffer)
+                {
+                    AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> dataStream(&dataBuffer);
+                    const bool saved = AZ::Utils::SaveObjectToStream(dataStream,
+                                                                     AZ::ObjectStream::ST_BINARY,
+                                                                     snapshot.get(),
+                                                                     serializeContext);
+                    AZ_Error("SaveDataRequests::SaveObject", saved,
+                             "Failed to save serializable object to data stream.");
+                    return saved;
+                };
+                SaveDataRequestBus::Broadcast(&SaveDataRequests::SaveDataBuffer, saveDataBufferParams);
+                return;
+            }
+            else
+            {
+                AZ_Warning("SaveDataRequests::SaveObject", false,
+                           "Serializable object is not copy constructible, serializing it on the calling thread instead.");
+            }
+        }
+
         // Save the serializable object to a data buffer.
         AZStd::vector<AZ::u8> dataBuffer;
         AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> dataStream(&dataBuffer);
@@ -211,22 +291,12 @@ namespace SaveData
 
         // Save the data buffer to persistent storage.
         const AZ::u64 dataBufferSize = dataBuffer.size();
-        SaveDataBufferParams saveDataBufferParams;
         if (dataBufferSize)
         {
             saveDataBufferParams.dataBuffer = DataBuffer(azmalloc(dataBufferSize), DataBufferDeleterAzFree);
             memcpy(saveDataBufferParams.dataBuffer.get(), dataBuffer.data(), dataBufferSize);
         }
         saveDataBufferParams.dataBufferSize = dataBufferSize;
-        saveDataBufferParams.dataBufferName = saveObjectParams.dataBufferName;
-        saveDataBufferParams.localUserId = saveObjectParams.localUserId;
-        saveDataBufferParams.callback = [saveObjectParams](const SaveDataNotifications::DataBufferSavedParams& dataBufferSavedParams)
-        {
-            if (saveObjectParams.callback)
-            {
-                saveObjectParams.callback(saveObjectParams, dataBufferSavedParams.result);
-            }
-        };
         SaveDataRequestBus::Broadcast(&SaveDataRequests::SaveDataBuffer, saveDataBufferParams);
     }
 
@@ -13,6 +13,8 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 
+#include <AzCore/Compression/zstd_compression.h>
+#include <AzCore/IO/FramedCompression.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
@@ -25,6 +27,156 @@ namespace SaveData
     const char* SaveDataFileExtension = ".savedata";
     const char* TempSaveDataFileExtension = ".tmpsavedata";
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Small chunks are compressed slightly worse, but let incremental saves reuse more of the data.
+    constexpr AZ::u32 CompressedChunkSize = 64 * 1024;
+    constexpr int CompressionLevel = 3;
+    constexpr size_t MaxPooledBuffers = 4;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Compress a data buffer into chunks, reusing the compressed chunks of the previous save where
+    //! the data is identical if the data of the previous save is provided.
+    static bool CompressDataBuffer(AZStd::vector<AZ::u8>& compressedData,
+                                   const void* dataBuffer,
+                                   AZ::u64 dataBufferSize,
+                                   const AZStd::vector<AZ::u8>* previousUncompressedData = nullptr,
+                                   const AZStd::vector<AZ::u8>* previousCompressedData = nullptr)
+    {
+        AZ::IO::FramedCompression::FrameTable previousChunks;
+        const bool canReuseChunks = previousUncompressedData && previousCompressedData &&
+                                    !previousUncompressedData->empty() &&
+                                    previousChunks.Read(previousCompressedData->data(),
+                                                        previousCompressedData->size(),
+                                                        previousUncompressedData->size()) &&
+                                    previousChunks.GetFrameSize() == CompressedChunkSize;
+
+        // FramedCompression::Compress compresses the chunks in order.
+        AZ::u32 chunkIndex = 0;
+        auto compressChunk = [&](const void* uncompressed, size_t uncompressedSize, void* compressed, size_t compressedBufferSize) -> size_t
+        {
+            const AZ::u32 chunk = chunkIndex++;
+            if (canReuseChunks &&
+                chunk < previousChunks.GetFrameCount() &&
+                previousChunks.GetUncompressedSize(chunk) == uncompressedSize &&
+                previousChunks.GetCompressedSize(chunk) <= compressedBufferSize &&
+                memcmp(previousUncompressedData->data() + previousChunks.GetUncompressedOffset(chunk),
+                       uncompressed, uncompressedSize) == 0)
+            {
+                const size_t previousCompressedSize = aznumeric_cast<size_t>(previousChunks.GetCompressedSize(chunk));
+                memcpy(compressed,
+                       previousCompressedData->data() + previousChunks.GetCompressedOffset(chunk),
+                       previousCompressedSize);
+                return previousCompressedSize;
+            }
+
+            const size_t result = ZSTD_compress(compressed, compressedBufferSize, uncompressed, uncompressedSize, CompressionLevel);
+            return ZSTD_isError(result) ? 0 : result;
+        };
+        return AZ::IO::FramedCompression::Compress(compressedData,
+                                                   dataBuffer,
+                                                   aznumeric_cast<size_t>(dataBufferSize),
+                                                   CompressedChunkSize,
+                                                   ZSTD_compressBound(CompressedChunkSize),
+                                                   compressChunk);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Decompress a loaded data buffer in place if it was compressed when saved.
+    static SaveDataNotifications::Result DecompressDataBuffer(SaveDataNotifications::DataBuffer& dataBuffer,
+                                                              AZ::u64& dataBufferSize)
+    {
+        AZ::IO::FramedCompression::FrameTable chunks;
+        if (!AZ::IO::FramedCompression::IsFramed(dataBuffer.get(), dataBufferSize) ||
+            !chunks.Read(dataBuffer.get(), dataBufferSize))
+        {
+            // Saved uncompressed.
+            return SaveDataNotifications::Result::Success;
+        }
+
+        const AZ::u64 uncompressedSize = chunks.GetUncompressedSize();
+        SaveDataNotifications::DataBuffer uncompressedDataBuffer(azmalloc(uncompressedSize),
+                                                                 [](void* p) { azfree(p); });
+        if (!uncompressedDataBuffer)
+        {
+            AZ_Error("LoadDataBufferFromFileSystem", false, "Failed to allocate %llu bytes", uncompressedSize);
+            return SaveDataNotifications::Result::ErrorOutOfMemory;
+        }
+
+        auto decompressChunk = [](const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedSize)
+        {
+            const size_t result = ZSTD_decompress(uncompressed, uncompressedSize, compressed, compressedSize);
+            return !ZSTD_isError(result) && result == uncompressedSize;
+        };
+        // The load runs on its own thread, so it's safe to wait for the chunks to be decompressed in parallel.
+        if (!AZ::IO::FramedCompression::Decompress(chunks, dataBuffer.get(), dataBufferSize, 0, uncompressedSize,
+                                                   uncompressedDataBuffer.get(), decompressChunk))
+        {
+            return SaveDataNotifications::Result::ErrorCorrupt;
+        }
+
+        dataBuffer = AZStd::move(uncompressedDataBuffer);
+        dataBufferSize = uncompressedSize;
+        return SaveDataNotifications::Result::Success;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Write a data buffer to a file, optionally through a temporary file that gets renamed.
+    static SaveDataNotifications::Result WriteDataBufferToFile(const void* dataBuffer,
+                                                               AZ::u64 dataBufferSize,
+                                                               const AZStd::string& absoluteFilePath,
+                                                               bool useTemporaryFile)
+    {
+        SaveDataNotifications::Result result = SaveDataNotifications::Result::ErrorUnspecified;
+
+        // If useTemporaryFile == true we save first to a '.tmp' file so we
+        // do not overwrite existing save data until we are sure of success.
+        const AZStd::string tempSaveDataFilePath = absoluteFilePath + TempSaveDataFileExtension;
+        const AZStd::string finalSaveDataFilePath = absoluteFilePath + SaveDataFileExtension;
+
+        // Open the temp save data file for writing, creating it (and
+        // any intermediate directories) if it doesn't already exist.
+        AZ::IO::SystemFile systemFile;
+        const bool openFileResult = systemFile.Open(useTemporaryFile ? tempSaveDataFilePath.c_str() : finalSaveDataFilePath.c_str(),
+                                                    AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY |
+                                                    AZ::IO::SystemFile::SF_OPEN_CREATE |
+                                                    AZ::IO::SystemFile::SF_OPEN_CREATE_PATH);
+        if (!openFileResult)
+        {
+            result = SaveDataNotifications::Result::ErrorIOFailure;
+        }
+        else
+        {
+            // Write the data buffer to the temp file and then close it.
+            const AZ::IO::SystemFile::SizeType bytesWritten = systemFile.Write(dataBuffer,
+                                                                               dataBufferSize);
+            systemFile.Close();
+
+            // Verify that we wrote the correct number of bytes.
+            if (bytesWritten != dataBufferSize)
+            {
+                result = SaveDataNotifications::Result::ErrorIOFailure;
+            }
+            else if (useTemporaryFile)
+            {
+                // Rename the temp save data file we successfully wrote to.
+                const bool renameFileResult = AZ::IO::SystemFile::Rename(tempSaveDataFilePath.c_str(),
+                                                                         finalSaveDataFilePath.c_str(),
+                                                                         true);
+                result = renameFileResult ? SaveDataNotifications::Result::Success :
+                                            SaveDataNotifications::Result::ErrorIOFailure;
+
+                // Delete the temp save data file.
+                AZ::IO::SystemFile::Delete(tempSaveDataFilePath.c_str());
+            }
+            else
+            {
+                result = SaveDataNotifications::Result::Success;
+            }
+        }
+
+        return result;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     void SaveDataSystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -143,11 +295,12 @@ namespace SaveData
                                                                              bool useTemporaryFile)
     {
         // Perform parameter error checking but handle gracefully
-        AZ_Assert(saveDataBufferParams.dataBuffer, "Invalid param: dataBuffer");
-        AZ_Assert(saveDataBufferParams.dataBufferSize, "Invalid param: dataBufferSize");
+        const bool hasDataBuffer = saveDataBufferParams.dataBufferWriter ||
+                                   (saveDataBufferParams.dataBuffer && saveDataBufferParams.dataBufferSize);
+        AZ_Assert(saveDataBufferParams.dataBufferWriter || saveDataBufferParams.dataBuffer, "Invalid param: dataBuffer");
+        AZ_Assert(saveDataBufferParams.dataBufferWriter || saveDataBufferParams.dataBufferSize, "Invalid param: dataBufferSize");
         AZ_Assert(!saveDataBufferParams.dataBufferName.empty(), "Invalid param: dataBufferName");
-        if (!saveDataBufferParams.dataBuffer ||
-            !saveDataBufferParams.dataBufferSize ||
+        if (!hasDataBuffer ||
             saveDataBufferParams.dataBufferName.empty())
         {
             OnSaveDataBufferComplete(saveDataBufferParams.dataBufferName,
@@ -171,63 +324,88 @@ namespace SaveData
 
         // This is safe access outside the lock guard because we only remove elements from the list
         // after the thread completion flag has been set to true (see also JoinAllCompletedThreads).
+        // Capturing this is safe because all active threads are joined when we are destroyed.
         threadCompletionPair->m_thread = AZStd::make_unique<AZStd::thread>(saveThreadDesc,
-                                                                           [&threadCompleteFlag = threadCompletionPair->m_threadComplete,
+                                                                           [this,
+                                                                           &threadCompleteFlag = threadCompletionPair->m_threadComplete,
                                                                            dataBuffer = AZStd::move(saveDataBufferParams.dataBuffer),
                                                                            dataBufferSize = saveDataBufferParams.dataBufferSize,
+                                                                           dataBufferWriter = saveDataBufferParams.dataBufferWriter,
+                                                                           compress = saveDataBufferParams.compress,
+                                                                           incremental = saveDataBufferParams.compress && saveDataBufferParams.incremental,
                                                                            dataBufferName = saveDataBufferParams.dataBufferName,
                                                                            onSavedCallback = saveDataBufferParams.callback,
                                                                            localUserId = saveDataBufferParams.localUserId,
                                                                            absoluteFilePath,
                                                                            useTemporaryFile]()
         {
-            SaveDataNotifications::Result result = SaveDataNotifications::Result::ErrorUnspecified;
-
-            // If useTemporaryFile == true we save first to a '.tmp' file so we
-            // do not overwrite existing save data until we are sure of success.
-            const AZStd::string tempSaveDataFilePath = absoluteFilePath + TempSaveDataFileExtension;
-            const AZStd::string finalSaveDataFilePath = absoluteFilePath + SaveDataFileExtension;
+            SaveDataNotifications::Result result = SaveDataNotifications::Result::Success;
+            const void* saveData = dataBuffer.get();
+            AZ::u64 saveDataSize = dataBufferSize;
 
-            // Open the temp save data file for writing, creating it (and
-            // any intermediate directories) if it doesn't already exist.
-            AZ::IO::SystemFile systemFile;
-            const bool openFileResult = systemFile.Open(useTemporaryFile ? tempSaveDataFilePath.c_str() : finalSaveDataFilePath.c_str(),
-                                                        AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY |
-                                                        AZ::IO::SystemFile::SF_OPEN_CREATE |
-                                                        AZ::IO::SystemFile::SF_OPEN_CREATE_PATH);
-            if (!openFileResult)
+            // Write the data buffer now if the caller deferred it to this thread.
+            AZStd::vector<AZ::u8> writtenData = AcquirePooledBuffer();
+            if (dataBufferWriter)
             {
-                result = SaveDataNotifications::Result::ErrorIOFailure;
+                if (dataBufferWriter(writtenData) && !writtenData.empty())
+                {
+                    saveData = writtenData.data();
+                    saveDataSize = writtenData.size();
+                }
+                else
+                {
+                    result = SaveDataNotifications::Result::ErrorCorrupt;
+                }
             }
-            else
-            {
-                // Write the data buffer to the temp file and then close it.
-                const AZ::IO::SystemFile::SizeType bytesWritten = systemFile.Write(dataBuffer.get(),
-                                                                                   dataBufferSize);
-                systemFile.Close();
 
-                // Verify that we wrote the correct number of bytes.
-                if (bytesWritten != dataBufferSize)
+            // Compress the data buffer, reusing the unchanged chunks of the last incremental save.
+            AZStd::vector<AZ::u8> compressedData = AcquirePooledBuffer();
+            if (result == SaveDataNotifications::Result::Success && compress)
+            {
+                IncrementalSaveState previousSave;
+                if (incremental)
                 {
-                    result = SaveDataNotifications::Result::ErrorIOFailure;
+                    previousSave = TakeIncrementalSaveState(absoluteFilePath);
                 }
-                else if (useTemporaryFile)
+
+                if (CompressDataBuffer(compressedData, saveData, saveDataSize,
+                                       &previousSave.m_uncompressedData, &previousSave.m_compressedData))
                 {
-                    // Rename the temp save data file we successfully wrote to.
-                    const bool renameFileResult = AZ::IO::SystemFile::Rename(tempSaveDataFilePath.c_str(),
-                                                                             finalSaveDataFilePath.c_str(),
-                                                                             true);
-                    result = renameFileResult ? SaveDataNotifications::Result::Success :
-                                                SaveDataNotifications::Result::ErrorIOFailure;
-
-                    // Delete the temp save data file.
-                    AZ::IO::SystemFile::Delete(tempSaveDataFilePath.c_str());
+                    result = WriteDataBufferToFile(compressedData.data(), compressedData.size(), absoluteFilePath, useTemporaryFile);
+                    if (incremental)
+                    {
+                        // Keep the data we just saved for the next incremental save, and swap the previous
+                        // buffers back into the pool instead of freeing them.
+                        if (dataBufferWriter)
+                        {
+                            previousSave.m_uncompressedData.swap(writtenData);
+                        }
+                        else
+                        {
+                            const AZ::u8* saveDataBytes = reinterpret_cast<const AZ::u8*>(saveData);
+                            previousSave.m_uncompressedData.assign(saveDataBytes, saveDataBytes + saveDataSize);
+                        }
+                        previousSave.m_compressedData.swap(compressedData);
+                    }
                 }
                 else
                 {
-                    result = SaveDataNotifications::Result::Success;
+                    AZ_Error("SaveDataBufferToFileSystem", false, "Failed to compress data buffer %s", dataBufferName.c_str());
+                    result = SaveDataNotifications::Result::ErrorUnspecified;
+                }
+
+                if (incremental)
+                {
+                    StoreIncrementalSaveState(absoluteFilePath, AZStd::move(previousSave));
                 }
             }
+            else if (result == SaveDataNotifications::Result::Success)
+            {
+                result = WriteDataBufferToFile(saveData, saveDataSize, absoluteFilePath, useTemporaryFile);
+            }
+
+            ReleasePooledBuffer(AZStd::move(writtenData));
+            ReleasePooledBuffer(AZStd::move(compressedData));
 
             // Invoke the callback and broadcast the OnDataBufferSaved notification from the main thread.
             OnSaveDataBufferComplete(dataBufferName, localUserId, onSavedCallback, result);
@@ -340,6 +518,12 @@ namespace SaveData
                     // Verify that we read the correct number of bytes.
                     result = (dataBufferSize == fileLength) ? SaveDataNotifications::Result::Success :
                                                               SaveDataNotifications::Result::ErrorIOFailure;
+
+                    // Decompress the data buffer if it was compressed when saved.
+                    if (result == SaveDataNotifications::Result::Success)
+                    {
+                        result = DecompressDataBuffer(dataBuffer, dataBufferSize);
+                    }
                 }
             }
 
@@ -364,6 +548,59 @@ namespace SaveData
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    AZStd::vector<AZ::u8> SaveDataSystemComponent::Implementation::AcquirePooledBuffer()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_pooledBuffersMutex);
+        if (m_pooledBuffers.empty())
+        {
+            return {};
+        }
+
+        AZStd::vector<AZ::u8> buffer = AZStd::move(m_pooledBuffers.back());
+        m_pooledBuffers.pop_back();
+        return buffer;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void SaveDataSystemComponent::Implementation::ReleasePooledBuffer(AZStd::vector<AZ::u8>&& buffer)
+    {
+        if (buffer.capacity() == 0)
+        {
+            return;
+        }
+
+        buffer.clear();
+        AZStd::lock_guard<AZStd::mutex> lock(m_pooledBuffersMutex);
+        if (m_pooledBuffers.size() < MaxPooledBuffers)
+        {
+            m_pooledBuffers.emplace_back(AZStd::move(buffer));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    SaveDataSystemComponent::Implementation::IncrementalSaveState SaveDataSystemComponent::Implementation::TakeIncrementalSaveState(const AZStd::string& absoluteFilePath)
+    {
+        // If another save to the same file is in flight, its state has already been taken and
+        // this save simply compresses all of its chunks.
+        AZStd::lock_guard<AZStd::mutex> lock(m_incrementalSavesMutex);
+        IncrementalSaveState state;
+        if (auto it = m_incrementalSaves.find(absoluteFilePath); it != m_incrementalSaves.end())
+        {
+            state = AZStd::move(it->second);
+            m_incrementalSaves.erase(it);
+        }
+        return state;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void SaveDataSystemComponent::Implementation::StoreIncrementalSaveState(const AZStd::string& absoluteFilePath,
+                                                                            IncrementalSaveState&& state)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_incrementalSavesMutex);
+        m_incrementalSaves[absoluteFilePath] = AZStd::move(state);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     void SaveDataSystemComponent::Implementation::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint scriptTimePoint)
     {
@@ -13,6 +13,8 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -171,6 +173,32 @@ namespace SaveData
                 AZStd::atomic_bool m_threadComplete{ false };
             };
 
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! The last incremental save of a data buffer, so its unchanged chunks can be reused
+            struct IncrementalSaveState
+            {
+                AZStd::vector<AZ::u8> m_uncompressedData; //!< The data that was last saved
+                AZStd::vector<AZ::u8> m_compressedData; //!< The data that was last saved, compressed
+            };
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! Take a buffer from the pool of buffers reused across saves, or an empty one if none.
+            //! Can be called from any thread.
+            AZStd::vector<AZ::u8> AcquirePooledBuffer();
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! Return a buffer to the pool of buffers reused across saves. Can be called from any thread.
+            void ReleasePooledBuffer(AZStd::vector<AZ::u8>&& buffer);
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! Take the state of the last incremental save to a file, or an empty one if none.
+            //! Can be called from any thread.
+            IncrementalSaveState TakeIncrementalSaveState(const AZStd::string& absoluteFilePath);
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! Store the state of the last incremental save to a file. Can be called from any thread.
+            void StoreIncrementalSaveState(const AZStd::string& absoluteFilePath, IncrementalSaveState&& state);
+
             ////////////////////////////////////////////////////////////////////////////////////////
             //! \ref AZ::TickEvents::OnTick
             void OnTick(float deltaTime, AZ::ScriptTimePoint scriptTimePoint) override;
@@ -187,6 +215,10 @@ namespace SaveData
             // Variables
             AZStd::mutex m_activeThreadsMutex; //! Mutex to restrict access to the active threads
             AZStd::list<ThreadCompletionPair> m_activeThreads; //!< A container of active threads
+            AZStd::mutex m_pooledBuffersMutex; //!< Mutex to restrict access to the pooled buffers
+            AZStd::vector<AZStd::vector<AZ::u8>> m_pooledBuffers; //!< Buffers reused across saves
+            AZStd::mutex m_incrementalSavesMutex; //!< Mutex to restrict access to the incremental saves
+            AZStd::unordered_map<AZStd::string, IncrementalSaveState> m_incrementalSaves; //!< By file path
             SaveDataSystemComponent& m_saveDataSystemComponent; //!< Reference to the parent
         };
 
@@ -584,6 +584,135 @@ TEST_F(SaveDataTest, LoadObjectForUserFromCustomDirectoryAbsolute)
     LoadTestObject(userId);
 }
 
+SaveData::SaveDataNotifications::Result SaveDataBufferAndWait(SaveData::SaveDataRequests::SaveDataBufferParams& params)
+{
+    bool saved = false;
+    SaveData::SaveDataNotifications::Result result = SaveData::SaveDataNotifications::Result::ErrorUnspecified;
+    params.callback = [&saved, &result](const SaveData::SaveDataNotifications::DataBufferSavedParams& onSavedParams)
+    {
+        result = onSavedParams.result;
+        saved = true;
+    };
+    SaveData::SaveDataRequestBus::Broadcast(&SaveData::SaveDataRequests::SaveDataBuffer, params);
+    while (!saved)
+    {
+        AZ::TickBus::ExecuteQueuedEvents();
+    }
+    return result;
+}
+
+SaveData::SaveDataNotifications::DataBufferLoadedParams LoadDataBufferAndWait(const char* dataBufferName,
+                                                                              const AzFramework::LocalUserId& localUserId)
+{
+    bool loaded = false;
+    SaveData::SaveDataNotifications::DataBufferLoadedParams loadedParams;
+    SaveData::SaveDataRequests::LoadDataBufferParams params;
+    params.dataBufferName = dataBufferName;
+    params.localUserId = localUserId;
+    params.callback = [&loaded, &loadedParams](const SaveData::SaveDataNotifications::DataBufferLoadedParams& onLoadedParams)
+    {
+        loadedParams = onLoadedParams;
+        loaded = true;
+    };
+    SaveData::SaveDataRequestBus::Broadcast(&SaveData::SaveDataRequests::LoadDataBuffer, params);
+    while (!loaded)
+    {
+        AZ::TickBus::ExecuteQueuedEvents();
+    }
+    return loadedParams;
+}
+
+TEST_F(SaveDataTest, SaveDataBufferCompressedIncremental_ChangedData_LoadsLatestData)
+{
+    const AzFramework::LocalUserId userId = SaveDataTest::GetDefaultTestUserId();
+    const char* dataBufferName = "TestSaveDataCompressed";
+
+    // Several chunks worth of compressible data, with the last chunk only partially filled.
+    AZStd::vector<AZ::u8> testData(300 * 1024);
+    for (size_t i = 0; i < testData.size(); ++i)
+    {
+        testData[i] = static_cast<AZ::u8>((i / 7) % 251);
+    }
+
+    for (int saveIndex = 0; saveIndex < 3; ++saveIndex)
+    {
+        // Change a single chunk between saves, so the other chunks are reused.
+        testData[100 * 1024 + saveIndex] ^= 0xff;
+
+        SaveData::SaveDataRequests::SaveDataBufferParams params;
+        params.dataBufferWriter = [testData](AZStd::vector<AZ::u8>& dataBuffer)
+        {
+            dataBuffer.assign(testData.begin(), testData.end());
+            return true;
+        };
+        params.dataBufferName = dataBufferName;
+        params.localUserId = userId;
+        params.compress = true;
+        params.incremental = true;
+        EXPECT_EQ(SaveData::SaveDataNotifications::Result::Success, SaveDataBufferAndWait(params));
+
+        const SaveData::SaveDataNotifications::DataBufferLoadedParams loadedParams = LoadDataBufferAndWait(dataBufferName, userId);
+        ASSERT_EQ(SaveData::SaveDataNotifications::Result::Success, loadedParams.result);
+        ASSERT_EQ(testData.size(), loadedParams.dataBufferSize);
+        EXPECT_EQ(0, memcmp(testData.data(), loadedParams.dataBuffer.get(), testData.size()));
+    }
+}
+
+TEST_F(SaveDataTest, SaveObjectOnSaveThread_ObjectModifiedAfterRequest_SavesSnapshot)
+{
+    const AzFramework::LocalUserId userId = SaveDataTest::GetDefaultTestUserId();
+
+    AZ::SerializeContext serializeContext;
+    TestObject::Reflect(serializeContext);
+
+    TestObject nonDefaultTestObject;
+    nonDefaultTestObject.SetNonDefaultValues();
+    AZStd::shared_ptr<TestObject> testObject = AZStd::make_shared<TestObject>(nonDefaultTestObject);
+
+    bool saved = false;
+    SaveData::SaveDataRequests::SaveOrLoadObjectParams<TestObject> saveParams;
+    saveParams.serializableObject = testObject;
+    saveParams.serializeContext = &serializeContext;
+    saveParams.dataBufferName = TestObject::DataBufferName;
+    saveParams.localUserId = userId;
+    saveParams.serializeOnSaveThread = true;
+    saveParams.compress = true;
+    saveParams.callback = [&saved](const SaveData::SaveDataRequests::SaveOrLoadObjectParams<TestObject>&,
+                                   SaveData::SaveDataNotifications::Result callbackResult)
+    {
+        EXPECT_EQ(SaveData::SaveDataNotifications::Result::Success, callbackResult);
+        saved = true;
+    };
+    SaveData::SaveDataRequests::SaveObject(saveParams);
+
+    // Modifying the object after requesting the save doesn't change what is saved.
+    *testObject = TestObject();
+    while (!saved)
+    {
+        AZ::TickBus::ExecuteQueuedEvents();
+    }
+
+    bool loaded = false;
+    AZStd::shared_ptr<TestObject> loadedObject = AZStd::make_shared<TestObject>();
+    SaveData::SaveDataRequests::SaveOrLoadObjectParams<TestObject> loadParams;
+    loadParams.serializableObject = loadedObject;
+    loadParams.serializeContext = &serializeContext;
+    loadParams.dataBufferName = TestObject::DataBufferName;
+    loadParams.localUserId = userId;
+    loadParams.callback = [&loaded](const SaveData::SaveDataRequests::SaveOrLoadObjectParams<TestObject>&,
+                                    SaveData::SaveDataNotifications::Result callbackResult)
+    {
+        EXPECT_EQ(SaveData::SaveDataNotifications::Result::Success, callbackResult);
+        loaded = true;
+    };
+    SaveData::SaveDataRequests::LoadObject(loadParams);
+    while (!loaded)
+    {
+        AZ::TickBus::ExecuteQueuedEvents();
+    }
+    EXPECT_TRUE(*loadedObject == nonDefaultTestObject);
+}
+
 #endif // !AZ_TRAIT_DISABLE_ALL_SAVE_DATA_TESTS
 
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -27,6 +27,9 @@
 #include <SceneAPI/SceneData/GraphData/MeshVertexBitangentData.h>
 #include <SceneAPI/SceneData/GraphData/MeshVertexTangentData.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Vector4.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -132,10 +135,41 @@ namespace AZ::SceneGenerationComponents
         }
 
         // Iterate over them. We had to build the array before as this method can insert new nodes, so using the iterator directly would fail.
-        for (auto& [mesh, nodeIndex] : meshes)
+        // Only the tangent and bitangent layers are added to the graph here, the MikkT generation itself is deferred to the jobs below.
+        AZStd::vector<MeshTangentWork> meshWork(meshes.size());
+        for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
         {
             // Generate tangents for the mesh (if this is desired or needed).
-            if (!GenerateTangentsForMesh(context.GetScene(), nodeIndex, mesh, generationMethod))
+            if (!GenerateTangentsForMesh(context.GetScene(), meshes[meshIndex].second, meshes[meshIndex].first, generationMethod, meshWork[meshIndex]))
+            {
+                return AZ::SceneAPI::Events::ProcessingResult::Failure;
+            }
+        }
+
+        // Each job only writes to the layers and blend shapes of its own mesh, so the meshes can be generated in parallel.
+        AZ::JobCompletion jobCompletion;
+        for (MeshTangentWork& work : meshWork)
+        {
+            if (work.m_uvSets.empty())
+            {
+                continue;
+            }
+
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([&work]()
+            {
+                AZ_PROFILE_SCOPE(Animation, "TangentGenerateComponent::GenerateTangentData::MeshJob");
+                GenerateMikkTTangents(work);
+            }, true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+
+        for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
+        {
+            if (!meshWork[meshIndex].m_success)
             {
                 return AZ::SceneAPI::Events::ProcessingResult::Failure;
             }
@@ -144,12 +178,11 @@ namespace AZ::SceneGenerationComponents
             // But only do this if we are getting tangents from the source scene, because MikkT will provide us with a correct tangent.w already
             if (generationMethod == SceneAPI::DataTypes::TangentGenerationMethod::FromSourceScene)
             {
-                if (!UpdateFbxTangentWValues(graph, nodeIndex, mesh, debugBitangentFlip))
+                if (!UpdateFbxTangentWValues(graph, meshes[meshIndex].second, meshes[meshIndex].first, debugBitangentFlip))
                 {
                     return AZ::SceneAPI::Events::ProcessingResult::Failure;
                 }
             }
-            
         }
 
         return AZ::SceneAPI::Events::ProcessingResult::Success;
@@ -254,7 +287,8 @@ namespace AZ::SceneGenerationComponents
         AZ::SceneAPI::Containers::Scene& scene,
         const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
         AZ::SceneAPI::DataTypes::IMeshData* meshData,
-        AZ::SceneAPI::DataTypes::TangentGenerationMethod ruleGenerationMethod)
+        AZ::SceneAPI::DataTypes::TangentGenerationMethod ruleGenerationMethod,
+        MeshTangentWork& outWork)
     {
         AZ::SceneAPI::Containers::SceneGraph& graph = scene.GetGraph();
 
@@ -269,8 +303,9 @@ namespace AZ::SceneGenerationComponents
         const AZ::SceneAPI::SceneData::TangentsRule* tangentsRule = GetTangentRule(scene);
 
         // Find all blend shape data under the mesh. We need to generate the tangent and bitangent for blend shape as well.
-        AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> blendShapes;
-        FindBlendShapes(graph, nodeIndex, blendShapes);
+        outWork.m_meshData = meshData;
+        outWork.m_tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
+        FindBlendShapes(graph, nodeIndex, outWork.m_blendShapes);
 
         // Generate tangents/bitangents for all uv sets.
         bool allSuccess = true;
@@ -335,17 +370,10 @@ namespace AZ::SceneGenerationComponents
 
             switch (generationMethod)
             {
-            // Generate using MikkT space.
+            // Generate using MikkT space, once all the layers of the scene have been created.
             case AZ::SceneAPI::DataTypes::TangentGenerationMethod::MikkT:
             {
-                const AZ::SceneAPI::DataTypes::MikkTSpaceMethod tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
-
-                allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(meshData, uvData, tangentData, bitangentData, tSpaceMethod);
-
-                for (AZ::SceneData::GraphData::BlendShapeData* blendShape : blendShapes)
-                {
-                    allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSetIndex, tSpaceMethod);
-                }
+                outWork.m_uvSets.push_back({ uvData, tangentData, bitangentData, uvSetIndex });
             }
             break;
 
@@ -360,6 +388,20 @@ namespace AZ::SceneGenerationComponents
         return allSuccess;
     }
 
+    void TangentGenerateComponent::GenerateMikkTTangents(MeshTangentWork& work)
+    {
+        for (const UvSetTangentWork& uvSet : work.m_uvSets)
+        {
+            work.m_success &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(
+                work.m_meshData, uvSet.m_uvData, uvSet.m_tangentData, uvSet.m_bitangentData, work.m_tSpaceMethod);
+
+            for (AZ::SceneData::GraphData::BlendShapeData* blendShape : work.m_blendShapes)
+            {
+                work.m_success &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSet.m_uvSetIndex, work.m_tSpaceMethod);
+            }
+        }
+    }
+
     size_t TangentGenerateComponent::CalcUvSetCount(AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex) const
     {
         const auto nameContentView = AZ::SceneAPI::Containers::Views::MakePairView(graph.GetNameStorage(), graph.GetContentStorage());
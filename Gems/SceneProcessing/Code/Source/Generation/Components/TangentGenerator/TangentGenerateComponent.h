@@ -12,6 +12,7 @@
 #include <SceneAPI/SceneCore/Containers/Scene.h>
 #include <SceneAPI/SceneData/Rules/TangentsRule.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ::SceneAPI::DataTypes { class IMeshData; }
 namespace AZ::SceneAPI::DataTypes { class IMeshVertexUVData; }
@@ -55,6 +56,28 @@ namespace AZ::SceneGenerationComponents
         AZ::SceneAPI::Events::ProcessingResult GenerateTangentData(TangentGenerateContext& context);
 
     private:
+        //! MikkT generation of one UV set of a mesh, prepared while the scene graph is still being modified.
+        struct UvSetTangentWork
+        {
+            AZ::SceneAPI::DataTypes::IMeshVertexUVData* m_uvData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexTangentData* m_tangentData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexBitangentData* m_bitangentData = nullptr;
+            size_t m_uvSetIndex = 0;
+        };
+
+        //! All the MikkT generation of a mesh and its blend shapes. The work of different meshes touches separate data,
+        //! so the meshes are generated on parallel jobs once every tangent and bitangent layer has been added to the graph.
+        struct MeshTangentWork
+        {
+            AZ::SceneAPI::DataTypes::IMeshData* m_meshData = nullptr;
+            AZStd::vector<UvSetTangentWork> m_uvSets;
+            AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> m_blendShapes;
+            AZ::SceneAPI::DataTypes::MikkTSpaceMethod m_tSpaceMethod = AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
+            bool m_success = true;
+        };
+
+        static void GenerateMikkTTangents(MeshTangentWork& work);
+
         void FindBlendShapes(
             AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
             AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*>& outBlendShapes) const;
@@ -62,7 +85,8 @@ namespace AZ::SceneGenerationComponents
             AZ::SceneAPI::Containers::Scene& scene,
             const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
             AZ::SceneAPI::DataTypes::IMeshData* meshData,
-            AZ::SceneAPI::DataTypes::TangentGenerationMethod defaultGenerationMethod);
+            AZ::SceneAPI::DataTypes::TangentGenerationMethod defaultGenerationMethod,
+            MeshTangentWork& outWork);
         bool UpdateFbxTangentWValues(
             AZ::SceneAPI::Containers::SceneGraph& graph,
             const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
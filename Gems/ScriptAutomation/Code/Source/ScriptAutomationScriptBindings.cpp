@@ -350,6 +350,21 @@ namespace AZ::ScriptAutomation
             ScriptAutomationInterface::Get()->QueueScriptOperation(AZStd::move(operation));
         }
 
+        void CaptureGpuProfilingTrace(const AZStd::string& outputFilePath, uint32_t frameCount)
+        {
+            auto operation = [outputFilePath, frameCount]()
+            {
+                auto scriptAutomationInterface = ScriptAutomationInterface::Get();
+
+                scriptAutomationInterface->StartProfilingCapture();
+                scriptAutomationInterface->PauseAutomation();
+
+                AZ::Render::ProfilingCaptureRequestBus::Broadcast(&AZ::Render::ProfilingCaptureRequestBus::Events::CaptureGpuProfilingTrace, outputFilePath, frameCount);
+            };
+
+            ScriptAutomationInterface::Get()->QueueScriptOperation(AZStd::move(operation));
+        }
+
         AZStd::vector<AZStd::string> SplitStringImmediate(const AZStd::string& source, const AZStd::string& delimiter)
         {
             AZStd::vector<AZStd::string> splitStringList;
@@ -884,5 +899,6 @@ namespace AZ::ScriptAutomation
         behaviorContext->Method("CapturePassPipelineStatistics", &Bindings::CapturePassPipelineStatistics);
         behaviorContext->Method("CaptureCpuProfilingStatistics", &Bindings::CaptureCpuProfilingStatistics);
         behaviorContext->Method("CaptureBenchmarkMetadata", &Bindings::CaptureBenchmarkMetadata);
+        behaviorContext->Method("CaptureGpuProfilingTrace", &Bindings::CaptureGpuProfilingTrace);
     }
 } // namespace AZ::ScriptAutomation
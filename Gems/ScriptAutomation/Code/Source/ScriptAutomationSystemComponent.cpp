@@ -393,6 +393,12 @@ namespace AZ::ScriptAutomation
         ResumeAutomation();
     }
 
+    void ScriptAutomationSystemComponent::OnCaptureGpuProfilingTraceFinished([[maybe_unused]] bool result, [[maybe_unused]] const AZStd::string& info)
+    {
+        AZ::Render::ProfilingCaptureNotificationBus::Handler::BusDisconnect();
+        ResumeAutomation();
+    }
+
     void ScriptAutomationSystemComponent::OnFrameCaptureFinished(AZ::Render::FrameCaptureResult result, const AZStd::string &info)
     {
         m_scriptFrameCaptureId = AZ::Render::InvalidFrameCaptureId;
@@ -93,6 +93,7 @@ namespace AZ::ScriptAutomation
         void OnCaptureCpuFrameTimeFinished(bool result, const AZStd::string& info) override;
         void OnCaptureQueryPipelineStatisticsFinished(bool result, const AZStd::string& info) override;
         void OnCaptureBenchmarkMetadataFinished(bool result, const AZStd::string& info) override;
+        void OnCaptureGpuProfilingTraceFinished(bool result, const AZStd::string& info) override;
 
         // LevelSystemLifecycleNotificationBus implementation
         void OnLevelNotFound(const char* levelName) override;
@@ -18,6 +18,7 @@
 #include <ScriptCanvas/Core/Graph.h>
 #include <ScriptCanvas/Core/ScriptCanvasBus.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
 #include <ScriptCanvas/Execution/RuntimeComponent.h>
 
 namespace ScriptCanvas
@@ -91,6 +92,12 @@ namespace ScriptCanvas
             RuntimeAsset* runtimeAsset = asset.GetAs<RuntimeAsset>();
             AZ_Assert(runtimeAsset, "RuntimeAssetHandler::InitAsset This should be a Script Canvas runtime asset, as this is the only type this handler processes!");
             Execution::Context::InitializeStaticActivationData(runtimeAsset->m_runtimeData);
+
+            // graphs compiled ahead of time to C++ replace the interpreted execution states of their asset
+            if (Execution::CreateNativeFunction createNative = Execution::FindNative(asset.GetId()))
+            {
+                runtimeAsset->m_runtimeData.m_createExecution = createNative;
+            }
         }
 
         AssetHandler::InitAsset(asset, loadStageSucceeded, isReload);
@@ -8,6 +8,7 @@
 
 #include <AzCore/Serialization/SerializeContext.h>
 #include <ScriptCanvas/Core/Nodeable.h>
+#include <ScriptCanvas/Execution/ExecutionNodeProfiler.h>
 
 namespace NodeableOutCpp
 {
@@ -30,11 +31,13 @@ namespace ScriptCanvas
 #if defined(SC_RUNTIME_CHECKS_ENABLED) 
     void Nodeable::CallOut(size_t index, AZ::BehaviorArgument* resultBVP, AZ::BehaviorArgument* argsBVPs, int numArguments) const
     {
+        NodeProfileScope profileScope(*this, m_executionState, index);
         GetExecutionOutChecked(index)(resultBVP, argsBVPs, numArguments);
     }
 #else
     void Nodeable::CallOut(size_t index, AZ::BehaviorArgument* resultBVP, AZ::BehaviorArgument* argsBVPs, int numArguments) const
     {
+        NodeProfileScope profileScope(*this, m_executionState, index);
         GetExecutionOut(index)(resultBVP, argsBVPs, numArguments);
     }
 #endif // defined(SC_RUNTIME_CHECKS_ENABLED) 
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/sort.h>
+#include <ScriptCanvas/Core/Nodeable.h>
+#include <ScriptCanvas/Execution/ExecutionNodeProfiler.h>
+
+AZ_DECLARE_BUDGET(ScriptCanvas);
+
+namespace ExecutionNodeProfilerCpp
+{
+    using namespace ScriptCanvas::Execution;
+
+    struct NodeProfileKey
+    {
+        AZ::Data::AssetId m_assetId;
+        AZ::TypeId m_nodeableType;
+        size_t m_outIndex;
+
+        bool operator==(const NodeProfileKey& rhs) const
+        {
+            return m_outIndex == rhs.m_outIndex && m_nodeableType == rhs.m_nodeableType && m_assetId == rhs.m_assetId;
+        }
+    };
+
+    struct NodeProfileKeyHash
+    {
+        size_t operator()(const NodeProfileKey& key) const
+        {
+            size_t hash = AZStd::hash<AZ::Data::AssetId>()(key.m_assetId);
+            AZStd::hash_combine(hash, key.m_nodeableType, key.m_outIndex);
+            return hash;
+        }
+    };
+
+    struct NodeProfiles
+    {
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<NodeProfileKey, NodeProfileEntry, NodeProfileKeyHash> m_entries;
+    };
+
+    NodeProfiles& GetNodeProfiles()
+    {
+        static NodeProfiles profiles;
+        return profiles;
+    }
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        AZ_CVAR(AZ::u32, sc_nodeProfilerSampleInterval, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Time one call out of a ScriptCanvas node or EBus handler in this many, 0 disables the node profiler.");
+
+        NodeProfileScope::NodeProfileScope(const Nodeable& nodeable, const ExecutionState* executionState, size_t outIndex)
+        {
+            const AZ::u32 sampleInterval = sc_nodeProfilerSampleInterval;
+            if (sampleInterval == 0)
+            {
+                return;
+            }
+
+            thread_local AZ::u32 callsSinceLastSample = 0;
+            if (++callsSinceLastSample >= sampleInterval)
+            {
+                callsSinceLastSample = 0;
+                Begin(nodeable, executionState, outIndex, sampleInterval);
+            }
+        }
+
+        NodeProfileScope::~NodeProfileScope()
+        {
+            if (m_nodeable)
+            {
+                End();
+            }
+        }
+
+        void NodeProfileScope::Begin(const Nodeable& nodeable, const ExecutionState* executionState, size_t outIndex, AZ::u32 sampleInterval)
+        {
+            m_nodeable = &nodeable;
+            m_executionState = executionState;
+            m_outIndex = outIndex;
+            m_sampleInterval = sampleInterval;
+            AZ_PROFILE_BEGIN(ScriptCanvas, "%s out %zu", nodeable.RTTI_GetTypeName(), outIndex);
+            m_startTime = AZStd::chrono::steady_clock::now();
+        }
+
+        void NodeProfileScope::End()
+        {
+            const AZStd::sys_time_t sampledTime =
+                AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - m_startTime).count();
+            AZ_PROFILE_END(ScriptCanvas);
+
+            ExecutionNodeProfilerCpp::NodeProfileKey key;
+            key.m_assetId = m_executionState ? m_executionState->GetAssetId() : AZ::Data::AssetId();
+            key.m_nodeableType = m_nodeable->RTTI_GetType();
+            key.m_outIndex = m_outIndex;
+
+            auto& profiles = ExecutionNodeProfilerCpp::GetNodeProfiles();
+            AZStd::scoped_lock lock(profiles.m_mutex);
+            NodeProfileEntry& entry = profiles.m_entries[key];
+            if (entry.m_sampleCount == 0)
+            {
+                entry.m_assetId = key.m_assetId;
+                entry.m_nodeableType = key.m_nodeableType;
+                entry.m_nodeableName = m_nodeable->RTTI_GetTypeName();
+                entry.m_outIndex = m_outIndex;
+            }
+            ++entry.m_sampleCount;
+            entry.m_sampledTime += sampledTime;
+            entry.m_sampleInterval = m_sampleInterval;
+        }
+
+        AZStd::vector<NodeProfileEntry> GetNodeProfileReport()
+        {
+            AZStd::vector<NodeProfileEntry> report;
+            {
+                auto& profiles = ExecutionNodeProfilerCpp::GetNodeProfiles();
+                AZStd::scoped_lock lock(profiles.m_mutex);
+                report.reserve(profiles.m_entries.size());
+                for (const auto& keyEntry : profiles.m_entries)
+                {
+                    report.push_back(keyEntry.second);
+                }
+            }
+
+            AZStd::sort(report.begin(), report.end(), [](const NodeProfileEntry& lhs, const NodeProfileEntry& rhs)
+            {
+                return lhs.m_sampledTime > rhs.m_sampledTime;
+            });
+            return report;
+        }
+
+        void ClearNodeProfileReport()
+        {
+            auto& profiles = ExecutionNodeProfilerCpp::GetNodeProfiles();
+            AZStd::scoped_lock lock(profiles.m_mutex);
+            profiles.m_entries.clear();
+        }
+
+        static void sc_nodeProfilerReport([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            for (const NodeProfileEntry& entry : GetNodeProfileReport())
+            {
+                AZ_TracePrintf("ScriptCanvas", "%s out %zu in %s: %llu samples, %.3f ms sampled, %.3f ms estimated\n"
+                    , entry.m_nodeableName
+                    , entry.m_outIndex
+                    , entry.m_assetId.ToString<AZStd::string>().c_str()
+                    , static_cast<unsigned long long>(entry.m_sampleCount)
+                    , entry.m_sampledTime / 1000.0
+                    , entry.m_sampledTime * static_cast<double>(entry.m_sampleInterval) / 1000.0);
+            }
+        }
+        AZ_CONSOLEFREEFUNC(sc_nodeProfilerReport, AZ::ConsoleFunctorFlags::Null, "Prints the time sampled by the ScriptCanvas node profiler.");
+
+        static void sc_nodeProfilerClear([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            ClearNodeProfileReport();
+        }
+        AZ_CONSOLEFREEFUNC(sc_nodeProfilerClear, AZ::ConsoleFunctorFlags::Null, "Clears the time sampled by the ScriptCanvas node profiler.");
+    }
+}
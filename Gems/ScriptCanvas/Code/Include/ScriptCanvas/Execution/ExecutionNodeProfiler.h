@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace ScriptCanvas
+{
+    class ExecutionState;
+    class Nodeable;
+
+    namespace Execution
+    {
+        //! Time between samples of the node profiler, in calls: one call out of a nodeable in this many is timed, 0 disables it.
+        AZ_CVAR_EXTERNED(AZ::u32, sc_nodeProfilerSampleInterval);
+
+        struct NodeProfileEntry
+        {
+            AZ::Data::AssetId m_assetId;
+            AZ::TypeId m_nodeableType;
+            const char* m_nodeableName = nullptr;
+            size_t m_outIndex = 0;
+            AZ::u64 m_sampleCount = 0;
+            //! Time spent in the sampled calls, including the graph execution they triggered, in microseconds.
+            AZStd::sys_time_t m_sampledTime = 0;
+            //! The interval the entry was sampled at, the sampled time times the interval estimates the total time.
+            AZ::u32 m_sampleInterval = 0;
+        };
+
+        //! Samples the calls out of nodeables, which are how nodes and EBus handlers hand execution back to the graph, and
+        //! attributes their time to the graph asset, nodeable type and out. Calls that are not sampled only cost a counter
+        //! increment, so the profiler can stay enabled in profile builds. Sampled calls are also emitted as CPU profiler regions.
+        class NodeProfileScope
+        {
+        public:
+            NodeProfileScope(const Nodeable& nodeable, const ExecutionState* executionState, size_t outIndex);
+            ~NodeProfileScope();
+
+        private:
+            void Begin(const Nodeable& nodeable, const ExecutionState* executionState, size_t outIndex, AZ::u32 sampleInterval);
+            void End();
+
+            //! Only set when the call is sampled.
+            const Nodeable* m_nodeable = nullptr;
+            const ExecutionState* m_executionState = nullptr;
+            size_t m_outIndex = 0;
+            AZ::u32 m_sampleInterval = 0;
+            AZStd::chrono::steady_clock::time_point m_startTime;
+        };
+
+        //! Returns the entries sampled since the last clear, sorted by decreasing sampled time.
+        AZStd::vector<NodeProfileEntry> GetNodeProfileReport();
+
+        void ClearNodeProfileReport();
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
+
+namespace ScriptCanvas
+{
+    namespace ExecutionStateNativeCpp
+    {
+        struct NativeRegistry
+        {
+            AZStd::shared_mutex m_mutex;
+            AZStd::unordered_map<AZ::Data::AssetId, Execution::CreateNativeFunction> m_createFunctions;
+        };
+
+        NativeRegistry& GetNativeRegistry()
+        {
+            static NativeRegistry registry;
+            return registry;
+        }
+    }
+
+    ExecutionStateNative::ExecutionStateNative(ExecutionStateConfig& config)
+        : ExecutionState(config)
+    {}
+
+    ExecutionMode ExecutionStateNative::GetExecutionMode() const
+    {
+        return ExecutionMode::Native;
+    }
+
+    namespace Execution
+    {
+        void RegisterNative(const AZ::Data::AssetId& runtimeAssetId, CreateNativeFunction createFunction)
+        {
+            AZ_Assert(createFunction, "RegisterNative called without a create function for asset %s"
+                , runtimeAssetId.ToString<AZStd::string>().c_str());
+
+            auto& registry = ExecutionStateNativeCpp::GetNativeRegistry();
+            AZStd::unique_lock lock(registry.m_mutex);
+            auto inserted = registry.m_createFunctions.insert_or_assign(runtimeAssetId, createFunction);
+            AZ_Warning("ScriptCanvas", inserted.second, "Native implementation of asset %s registered more than once, the last one is used"
+                , runtimeAssetId.ToString<AZStd::string>().c_str());
+        }
+
+        void UnregisterNative(const AZ::Data::AssetId& runtimeAssetId)
+        {
+            auto& registry = ExecutionStateNativeCpp::GetNativeRegistry();
+            AZStd::unique_lock lock(registry.m_mutex);
+            registry.m_createFunctions.erase(runtimeAssetId);
+        }
+
+        CreateNativeFunction FindNative(const AZ::Data::AssetId& runtimeAssetId)
+        {
+            auto& registry = ExecutionStateNativeCpp::GetNativeRegistry();
+            AZStd::shared_lock lock(registry.m_mutex);
+            auto iter = registry.m_createFunctions.find(runtimeAssetId);
+            return iter != registry.m_createFunctions.end() ? iter->second : nullptr;
+        }
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <ScriptCanvas/Execution/ExecutionState.h>
+#include <ScriptCanvas/Execution/ExecutionStateStorage.h>
+
+namespace ScriptCanvas
+{
+    /// <summary>
+    /// \class ExecutionStateNative - the base class for ExecutionStates compiled ahead of time to C++ from a graph. The subclasses
+    /// implement Initialize, Execute and StopExecution directly, without going through the Lua virtual machine, and they are registered
+    /// against the id of the runtime asset they replace, so the ExecutionStateHandler picks them instead of the interpreted states.
+    /// </summary>
+    class ExecutionStateNative
+        : public ExecutionState
+    {
+    public:
+        AZ_RTTI(ExecutionStateNative, "{6C0A4A4B-6E8B-4B0C-8D3C-7E5A9E3F1B27}", ExecutionState);
+        AZ_CLASS_ALLOCATOR(ExecutionStateNative, AZ::SystemAllocator);
+
+        ExecutionStateNative(ExecutionStateConfig& config);
+
+        ExecutionMode GetExecutionMode() const override;
+    };
+
+    namespace Execution
+    {
+        using CreateNativeFunction = ExecutionState*(*)(StateStorage& storage, ExecutionStateConfig& config);
+
+        /// Creates a native ExecutionState in the static size storage, native states must fit in it like the interpreted ones.
+        template<typename NativeStateType>
+        ExecutionState* CreateNative(StateStorage& storage, ExecutionStateConfig& config)
+        {
+            static_assert(AZStd::is_base_of_v<ExecutionStateNative, NativeStateType>, "Native states must derive from ExecutionStateNative");
+            static_assert(sizeof(NativeStateType) <= s_StorageSize, "Native state does not fit in the ExecutionState storage");
+            new (&storage.data) NativeStateType(config);
+            return reinterpret_cast<ExecutionState*>(&storage.data);
+        }
+
+        /// Registers the native implementation of a runtime asset, the native implementation is used by all the graphs that load the
+        /// asset after this call. Native graph libraries register on module initialization and unregister on module shutdown.
+        void RegisterNative(const AZ::Data::AssetId& runtimeAssetId, CreateNativeFunction createFunction);
+
+        void UnregisterNative(const AZ::Data::AssetId& runtimeAssetId);
+
+        /// Returns nullptr when no native implementation is registered for the runtime asset.
+        CreateNativeFunction FindNative(const AZ::Data::AssetId& runtimeAssetId);
+    }
+}
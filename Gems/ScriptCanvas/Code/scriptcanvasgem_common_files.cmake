@@ -63,6 +63,7 @@ set(FILES
     Include/ScriptCanvas/Deprecated/VariableHelpers.cpp
     Include/ScriptCanvas/Execution/Executor.cpp
     Include/ScriptCanvas/Execution/ExecutionContext.cpp
+    Include/ScriptCanvas/Execution/ExecutionNodeProfiler.cpp
     Include/ScriptCanvas/Execution/ExecutionObjectCloning.cpp
     Include/ScriptCanvas/Execution/ExecutionPerformanceTimer.cpp
     Include/ScriptCanvas/Execution/ExecutionState.cpp
@@ -81,6 +82,7 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.cpp
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.cpp
     Include/ScriptCanvas/Grammar/AbstractCodeModel.cpp
     Include/ScriptCanvas/Grammar/ASTModifications.cpp
     Include/ScriptCanvas/Grammar/DebugMap.cpp
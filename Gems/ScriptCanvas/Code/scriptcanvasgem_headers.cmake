@@ -86,6 +86,7 @@ set(FILES
     Include/ScriptCanvas/Execution/Executor.h
     Include/ScriptCanvas/Execution/ExecutionBus.h
     Include/ScriptCanvas/Execution/ExecutionContext.h
+    Include/ScriptCanvas/Execution/ExecutionNodeProfiler.h
     Include/ScriptCanvas/Execution/ExecutionObjectCloning.h
     Include/ScriptCanvas/Execution/ExecutionPerformanceTimer.h
     Include/ScriptCanvas/Execution/ExecutionState.h
@@ -106,6 +107,7 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.h
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.h
     Include/ScriptCanvas/Grammar/AbstractCodeModel.h
     Include/ScriptCanvas/Grammar/ASTModifications.h
     Include/ScriptCanvas/Grammar/DebugMap.h
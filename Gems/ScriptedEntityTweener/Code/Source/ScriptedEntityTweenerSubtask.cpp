@@ -55,6 +55,13 @@ namespace ScriptedEntityTweener
         }
     }
 
+    ScriptedEntityTweenerSubtask::VirtualPropertyCache* ScriptedEntityTweenerSubtask::s_virtualPropertyCache = nullptr;
+
+    void ScriptedEntityTweenerSubtask::SetVirtualPropertyCache(VirtualPropertyCache* virtualPropertyCache)
+    {
+        s_virtualPropertyCache = virtualPropertyCache;
+    }
+
     bool ScriptedEntityTweenerSubtask::Initialize(const AnimationParameterAddressData& animParamData, const AZStd::any& targetValue, const AnimationProperties& properties)
     {
         Reset();
@@ -99,7 +106,7 @@ namespace ScriptedEntityTweener
         }
 
         EntityAnimatedValue currentValue;
-        if (m_virtualPropertyTypeId == AZ::AzTypeInfo<float>::Uuid())
+        if (m_virtualPropertyType == VirtualPropertyType::Float)
         {
             float initialValue;
             m_valueInitial.GetValue(initialValue);
@@ -111,7 +118,7 @@ namespace ScriptedEntityTweener
 
             SetVirtualValue(currentValue);
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Vector3>::Uuid() || m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Color>::Uuid())
+        else if (m_virtualPropertyType == VirtualPropertyType::Vector3 || m_virtualPropertyType == VirtualPropertyType::Color)
         {
             AZ::Vector3 initialValue;
             m_valueInitial.GetValue(initialValue);
@@ -123,7 +130,7 @@ namespace ScriptedEntityTweener
 
             SetVirtualValue(currentValue);
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Quaternion>::Uuid())
+        else if (m_virtualPropertyType == VirtualPropertyType::Quaternion)
         {
             AZ::Quaternion initialValue;
             m_valueInitial.GetValue(initialValue);
@@ -205,20 +212,83 @@ namespace ScriptedEntityTweener
         m_animParamData = animParamData;
         m_virtualProperty = nullptr;
         m_virtualPropertyTypeId = AZ::Uuid::CreateNull();
+        m_virtualPropertyType = VirtualPropertyType::Unsupported;
+
+        // Tweens are usually started on many entities for the same few properties, so the lookups are shared between the subtasks
+        CachedVirtualProperty cachedVirtualProperty;
+        if (!s_virtualPropertyCache)
+        {
+            cachedVirtualProperty = FindVirtualProperty(animParamData);
+        }
+        else if (auto cacheIter = s_virtualPropertyCache->find(animParamData); cacheIter != s_virtualPropertyCache->end())
+        {
+            cachedVirtualProperty = cacheIter->second;
+        }
+        else
+        {
+            cachedVirtualProperty = FindVirtualProperty(animParamData);
+            if (cachedVirtualProperty.m_virtualProperty)
+            {
+                s_virtualPropertyCache->emplace(animParamData, cachedVirtualProperty);
+            }
+        }
+
+        AZ::BehaviorEBus::VirtualProperty* virtualProperty = cachedVirtualProperty.m_virtualProperty;
+        const AZ::Uuid virtualPropertyTypeId = cachedVirtualProperty.m_virtualPropertyTypeId;
+
+        // Virtual properties with event setters/getters require a valid entityId
+        if (virtualProperty)
+        {
+            if (((virtualProperty->m_setter && virtualProperty->m_setter->m_event)
+                || (virtualProperty->m_getter && virtualProperty->m_getter->m_event))
+                && !m_entityId.IsValid())
+            {
+                AZ_Warning("ScriptedEntityTweenerSubtask", false, "ScriptedEntityTweenerSubtask::CacheVirtualProperty - invalid entityId for virtual property's event setter/getter [%s, %s]", m_animParamData.m_componentName.c_str(), m_animParamData.m_virtualPropertyName.c_str());
+                virtualProperty = nullptr;
+            }
+        }
+
+        if (virtualProperty)
+        {
+            m_virtualProperty = virtualProperty;
+            m_virtualPropertyTypeId = virtualPropertyTypeId;
+            if (virtualPropertyTypeId == AZ::AzTypeInfo<float>::Uuid())
+            {
+                m_virtualPropertyType = VirtualPropertyType::Float;
+            }
+            else if (virtualPropertyTypeId == AZ::Vector3::TYPEINFO_Uuid())
+            {
+                m_virtualPropertyType = VirtualPropertyType::Vector3;
+            }
+            else if (virtualPropertyTypeId == AZ::Color::TYPEINFO_Uuid())
+            {
+                m_virtualPropertyType = VirtualPropertyType::Color;
+            }
+            else if (virtualPropertyTypeId == AZ::Quaternion::TYPEINFO_Uuid())
+            {
+                m_virtualPropertyType = VirtualPropertyType::Quaternion;
+            }
+            return true;
+        }
+
+        return false;
+    }
 
+    ScriptedEntityTweenerSubtask::CachedVirtualProperty ScriptedEntityTweenerSubtask::FindVirtualProperty(const AnimationParameterAddressData& animParamData)
+    {
         AZ::BehaviorContext* behaviorContext = nullptr;
         AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationBus::Events::GetBehaviorContext);
         if (!behaviorContext)
         {
             AZ_Error("ScriptedEntityTweenerSubtask", false, "ScriptedEntityTweenerSubtask::CacheVirtualProperty - failed to get behavior context for caching [%s]", animParamData.m_virtualPropertyName.c_str());
-            return false;
+            return {};
         }
 
         auto findClassIter = behaviorContext->m_classes.find(animParamData.m_componentName);
         if (findClassIter == behaviorContext->m_classes.end())
         {
             AZ_Warning("ScriptedEntityTweenerSubtask", false, "ScriptedEntityTweenerSubtask::CacheVirtualProperty - failed to find behavior component class by component name [%s]", animParamData.m_componentName.c_str());
-            return false;
+            return {};
         }
 
         AZ::BehaviorEBus::VirtualProperty* virtualProperty = nullptr;
@@ -242,18 +312,6 @@ namespace ScriptedEntityTweener
         }
         AZ_Warning("ScriptedEntityTweenerSubtask", virtualProperty, "ScriptedEntityTweenerSubtask::CacheVirtualProperty - failed to find virtual property by name [%s]", animParamData.m_virtualPropertyName.c_str());
 
-        // Virtual properties with event setters/getters require a valid entityId
-        if (virtualProperty)
-        {
-            if (((virtualProperty->m_setter && virtualProperty->m_setter->m_event)
-                || (virtualProperty->m_getter && virtualProperty->m_getter->m_event))
-                && !m_entityId.IsValid())
-            {
-                AZ_Warning("ScriptedEntityTweenerSubtask", false, "ScriptedEntityTweenerSubtask::CacheVirtualProperty - invalid entityId for virtual property's event setter/getter [%s, %s]", m_animParamData.m_componentName.c_str(), m_animParamData.m_virtualPropertyName.c_str());
-                virtualProperty = nullptr;
-            }
-        }
-
         // Get the virtual property type
         if (virtualProperty)
         {
@@ -270,12 +328,10 @@ namespace ScriptedEntityTweener
 
         if (virtualProperty && !virtualPropertyTypeId.IsNull())
         {
-            m_virtualProperty = virtualProperty;
-            m_virtualPropertyTypeId = virtualPropertyTypeId;
-            return true;
+            return { virtualProperty, virtualPropertyTypeId };
         }
 
-        return false;
+        return {};
     }
 
     bool ScriptedEntityTweenerSubtask::IsVirtualPropertyCached()
@@ -290,7 +346,7 @@ namespace ScriptedEntityTweener
             return false;
         }
 
-        if (m_virtualPropertyTypeId == AZ::AzTypeInfo<float>::Uuid())
+        if (m_virtualPropertyType == VirtualPropertyType::Float)
         {
             float floatVal;
             if (any_numeric_cast(&anyValue, floatVal))
@@ -303,16 +359,16 @@ namespace ScriptedEntityTweener
                 return false;
             }
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Vector3>::Uuid() && anyValue.is<AZ::Vector3>())
+        else if (m_virtualPropertyType == VirtualPropertyType::Vector3 && anyValue.is<AZ::Vector3>())
         {
             value.SetValue(AZStd::any_cast<AZ::Vector3>(anyValue));
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Color>::Uuid() && anyValue.is<AZ::Color>())
+        else if (m_virtualPropertyType == VirtualPropertyType::Color && anyValue.is<AZ::Color>())
         {
             AZ::Color color = AZStd::any_cast<AZ::Color>(anyValue);
             value.SetValue(color.GetAsVector3());
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Quaternion>::Uuid() && anyValue.is<AZ::Quaternion>())
+        else if (m_virtualPropertyType == VirtualPropertyType::Quaternion && anyValue.is<AZ::Quaternion>())
         {
             value.SetValue(AZStd::any_cast<AZ::Quaternion>(anyValue));
         }
@@ -331,25 +387,25 @@ namespace ScriptedEntityTweener
             return false;
         }
 
-        if (m_virtualPropertyTypeId == AZ::AzTypeInfo<float>::Uuid())
+        if (m_virtualPropertyType == VirtualPropertyType::Float)
         {
             float floatVal;
             value.GetValue(floatVal);
             anyValue = floatVal;
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Vector3>::Uuid())
+        else if (m_virtualPropertyType == VirtualPropertyType::Vector3)
         {
             AZ::Vector3 vectorValue;
             value.GetValue(vectorValue);
             anyValue = vectorValue;
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Color>::Uuid())
+        else if (m_virtualPropertyType == VirtualPropertyType::Color)
         {
             AZ::Vector3 vectorValue;
             value.GetValue(vectorValue);
             anyValue = AZ::Color::CreateFromVector3(vectorValue);
         }
-        else if (m_virtualPropertyTypeId == AZ::AzTypeInfo<AZ::Quaternion>::Uuid())
+        else if (m_virtualPropertyType == VirtualPropertyType::Quaternion)
         {
             AZ::Quaternion quatValue;
             value.GetValue(quatValue);
@@ -370,26 +426,26 @@ namespace ScriptedEntityTweener
             return false;
         }
 
-        if (m_virtualPropertyTypeId == AZ::AzTypeInfo<float>::Uuid())
+        if (m_virtualPropertyType == VirtualPropertyType::Float)
         {
             float floatValue = 0.0f;
             SubtaskHelper::DoSafeGet(m_virtualProperty, m_entityId, floatValue);
             animatedValue.SetValue(floatValue);
         }
-        else if (m_virtualPropertyTypeId == AZ::Vector3::TYPEINFO_Uuid())
+        else if (m_virtualPropertyType == VirtualPropertyType::Vector3)
         {
             AZ::Vector3 vector3Value(AZ::Vector3::CreateZero());
             SubtaskHelper::DoSafeGet(m_virtualProperty, m_entityId, vector3Value);
             animatedValue.SetValue(vector3Value);
         }
-        else if (m_virtualPropertyTypeId == AZ::Color::TYPEINFO_Uuid())
+        else if (m_virtualPropertyType == VirtualPropertyType::Color)
         {
             AZ::Color colorValue(AZ::Color::CreateZero());
             SubtaskHelper::DoSafeGet(m_virtualProperty, m_entityId, colorValue);
             AZ::Vector3 vector3Value = colorValue.GetAsVector3();
             animatedValue.SetValue(vector3Value);
         }
-        else if (m_virtualPropertyTypeId == AZ::Quaternion::TYPEINFO_Uuid())
+        else if (m_virtualPropertyType == VirtualPropertyType::Quaternion)
         {
             AZ::Quaternion quaternionValue(AZ::Quaternion::CreateIdentity());
             SubtaskHelper::DoSafeGet(m_virtualProperty, m_entityId, quaternionValue);
@@ -411,26 +467,26 @@ namespace ScriptedEntityTweener
             return false;
         }
 
-        if (m_virtualPropertyTypeId == AZ::AzTypeInfo<float>::Uuid())
+        if (m_virtualPropertyType == VirtualPropertyType::Float)
         {
             float floatValue;
             value.GetValue(floatValue);
             SubtaskHelper::DoSafeSet(m_virtualProperty, m_entityId, floatValue);
         }
-        else if (m_virtualPropertyTypeId == AZ::Vector3::TYPEINFO_Uuid())
+        else if (m_virtualPropertyType == VirtualPropertyType::Vector3)
         {
             AZ::Vector3 vector3Value;
             value.GetValue(vector3Value);
             SubtaskHelper::DoSafeSet(m_virtualProperty, m_entityId, vector3Value);
         }
-        else if (m_virtualPropertyTypeId == AZ::Color::TYPEINFO_Uuid())
+        else if (m_virtualPropertyType == VirtualPropertyType::Color)
         {
             AZ::Vector3 vector3Value;
             value.GetValue(vector3Value);
             AZ::Color colorValue(AZ::Color::CreateFromVector3(vector3Value));
             SubtaskHelper::DoSafeSet(m_virtualProperty, m_entityId, colorValue);
         }
-        else if (m_virtualPropertyTypeId == AZ::Quaternion::TYPEINFO_Uuid())
+        else if (m_virtualPropertyType == VirtualPropertyType::Quaternion)
         {
             AZ::Quaternion quaternionValue;
             value.GetValue(quaternionValue);
@@ -12,6 +12,7 @@
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <ScriptedEntityTweener/ScriptedEntityTweenerEnums.h>
 
@@ -22,6 +23,17 @@ namespace ScriptedEntityTweener
     class ScriptedEntityTweenerSubtask
     {
     public:
+        //! Virtual properties found in the behavior context, shared by all the subtasks animating the same address
+        struct CachedVirtualProperty
+        {
+            AZ::BehaviorEBus::VirtualProperty* m_virtualProperty = nullptr;
+            AZ::Uuid m_virtualPropertyTypeId = AZ::Uuid::CreateNull();
+        };
+        using VirtualPropertyCache = AZStd::unordered_map<AnimationParameterAddressData, CachedVirtualProperty>;
+
+        //! Sets the cache used to look up the virtual properties, owned by the system component while it is active
+        static void SetVirtualPropertyCache(VirtualPropertyCache* virtualPropertyCache);
+
         ScriptedEntityTweenerSubtask(const AZ::EntityId& entityId)
             : m_entityId(entityId)
         {
@@ -130,8 +142,19 @@ namespace ScriptedEntityTweener
         // Cached virtual property
         AZ::BehaviorEBus::VirtualProperty* m_virtualProperty;
 
+        //! Supported virtual property types, resolved once when the virtual property is cached
+        enum class VirtualPropertyType : AZ::u8
+        {
+            Unsupported,
+            Float,
+            Vector3,
+            Color,
+            Quaternion
+        };
+
         // Type of the virtual property
         AZ::Uuid m_virtualPropertyTypeId;
+        VirtualPropertyType m_virtualPropertyType;
 
         bool m_isActive;
         bool m_isPaused;
@@ -155,12 +178,18 @@ namespace ScriptedEntityTweener
             m_animationProperties.Reset();
             m_animParamData = AnimationParameterAddressData();
             m_virtualPropertyTypeId = AZ::Uuid::CreateNull();
+            m_virtualPropertyType = VirtualPropertyType::Unsupported;
             m_virtualProperty = nullptr;
         }
 
         //! Cache the virtual property to be animated
         bool CacheVirtualProperty(const AnimationParameterAddressData& animParamData);
 
+        //! Find the virtual property and its type in the behavior context
+        static CachedVirtualProperty FindVirtualProperty(const AnimationParameterAddressData& animParamData);
+
+        static VirtualPropertyCache* s_virtualPropertyCache;
+
         //! Return whether the virtual property has been cached
         bool IsVirtualPropertyCached();
 
@@ -124,6 +124,8 @@ namespace ScriptedEntityTweener
 
     void ScriptedEntityTweenerSystemComponent::Activate()
     {
+        ScriptedEntityTweenerSubtask::SetVirtualPropertyCache(&m_virtualPropertyCache);
+
         ScriptedEntityTweenerBus::Handler::BusConnect();
 
         AZ::TickBus::Handler::BusConnect();
@@ -134,6 +136,9 @@ namespace ScriptedEntityTweener
         ScriptedEntityTweenerBus::Handler::BusDisconnect();
 
         AZ::TickBus::Handler::BusDisconnect();
+
+        ScriptedEntityTweenerSubtask::SetVirtualPropertyCache(nullptr);
+        m_virtualPropertyCache.clear();
     }
 
     void ScriptedEntityTweenerSystemComponent::AnimateEntity(const AZ::EntityId& entityId, const AnimationParameters& params)
@@ -266,6 +271,7 @@ namespace ScriptedEntityTweener
     void ScriptedEntityTweenerSystemComponent::Reset()
     {
         m_animationTasks.clear();
+        m_virtualPropertyCache.clear();
     }
 
     void ScriptedEntityTweenerSystemComponent::OnTick(float deltaTime, AZ::ScriptTimePoint /*time*/)
@@ -86,6 +86,9 @@ namespace ScriptedEntityTweener
     private:
         AZStd::set<ScriptedEntityTweenerTask> m_animationTasks;
 
+        //! Virtual properties already found in the behavior context, shared by the subtasks
+        ScriptedEntityTweenerSubtask::VirtualPropertyCache m_virtualPropertyCache;
+
         //! Used by AnimateEntityScript, setup by SetOptionalParams
         AnimationParameters m_tempParams;
     };
@@ -28,6 +28,8 @@ namespace SurfaceData
     //! SurfaceTagWeights stores a collection of surface tags and weights.
     //! A surface tag can only appear once in the collection. Attempting to add it multiple times will always preserve the
     //! highest weight value.
+    //! Alongside the weights, a 64-bit mask with one bit set per stored tag (selected by the low bits of the tag CRC) is kept
+    //! so that tag queries can reject most non-matching collections without searching the weights.
     class SurfaceTagWeights
     {
     public:
@@ -65,6 +67,7 @@ namespace SurfaceData
                     {
                         // We didn't find the surface type, so add the new entry in sorted order.
                         m_weights.insert(weightItr, { tag, weight });
+                        m_tagMask |= GetTagMaskBit(tag);
                     }
                     else
                     {
@@ -84,6 +87,7 @@ namespace SurfaceData
             if (m_weights.size() != AzFramework::SurfaceData::Constants::MaxSurfaceWeights)
             {
                 m_weights.emplace_back(tag, weight);
+                m_tagMask |= GetTagMaskBit(tag);
             }
             else
             {
@@ -178,13 +182,34 @@ namespace SurfaceData
         //! @return True if any of the tags is found, false if none are found.
         bool HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags, float weightMin, float weightMax) const;
 
+        //! Check to see if the collection contains any of the given tags, using a tag mask precomputed with GetTagMask().
+        //! This is meant for filtering many collections against the same set of tags.
+        //! @param sampleTags - The tags to look for.
+        //! @param sampleTagMask - The tag mask of sampleTags.
+        //! @return True if any of the tags is found, false if none are found.
+        bool HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags, AZ::u64 sampleTagMask) const;
+
+        //! Get the tag mask for a set of tags, for use with HasAnyMatchingTags().
+        //! @param tags - The tags to build the mask from.
+        //! @return The mask with the bit of every tag set.
+        static AZ::u64 GetTagMask(AZStd::span<const SurfaceTag> tags);
+
     private:
+        //! Get the bit of the tag mask that the given tag maps to.
+        static AZ::u64 GetTagMaskBit(AZ::Crc32 tag)
+        {
+            return AZ::u64(1) << (static_cast<AZ::u32>(tag) & 63);
+        }
+
         //! Search for the given tag entry.
         //! @param tag - The tag to search for.
         //! @return The pointer to the tag that's found, or end() if it wasn't found.
         const AzFramework::SurfaceData::SurfaceTagWeight* FindTag(AZ::Crc32 tag) const;
 
         AZStd::fixed_vector<AzFramework::SurfaceData::SurfaceTagWeight, AzFramework::SurfaceData::Constants::MaxSurfaceWeights> m_weights;
+
+        //! Bits of all the tags in m_weights. Distinct tags can share a bit, so a set bit only means the tag might be present.
+        AZ::u64 m_tagMask = 0;
     };
 
 
@@ -13,6 +13,7 @@ namespace SurfaceData
     void SurfaceTagWeights::AssignSurfaceTagWeights(const AzFramework::SurfaceData::SurfaceTagWeightList& weights)
     {
         m_weights.clear();
+        m_tagMask = 0;
         for (auto& weight : weights)
         {
             AddSurfaceTagWeight(weight.m_surfaceType, weight.m_weight);
@@ -22,6 +23,7 @@ namespace SurfaceData
     void SurfaceTagWeights::AssignSurfaceTagWeights(const SurfaceTagVector& tags, float weight)
     {
         m_weights.clear();
+        m_tagMask = 0;
         for (auto& tag : tags)
         {
             AddSurfaceTagWeight(tag.operator AZ::Crc32(), weight);
@@ -31,6 +33,7 @@ namespace SurfaceData
     void SurfaceTagWeights::Clear()
     {
         m_weights.clear();
+        m_tagMask = 0;
     }
 
     size_t SurfaceTagWeights::GetSize() const
@@ -114,11 +117,27 @@ namespace SurfaceData
 
     bool SurfaceTagWeights::HasMatchingTag(AZ::Crc32 sampleTag) const
     {
+        if ((m_tagMask & GetTagMaskBit(sampleTag)) == 0)
+        {
+            return false;
+        }
+
         return FindTag(sampleTag) != m_weights.end();
     }
 
     bool SurfaceTagWeights::HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags) const
     {
+        return HasAnyMatchingTags(sampleTags, GetTagMask(sampleTags));
+    }
+
+    bool SurfaceTagWeights::HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags, AZ::u64 sampleTagMask) const
+    {
+        // If none of the sample tag bits are set, none of the sample tags can be in this collection.
+        if ((m_tagMask & sampleTagMask) == 0)
+        {
+            return false;
+        }
+
         for (const auto& sampleTag : sampleTags)
         {
             if (HasMatchingTag(sampleTag))
@@ -132,12 +151,22 @@ namespace SurfaceData
 
     bool SurfaceTagWeights::HasMatchingTag(AZ::Crc32 sampleTag, float weightMin, float weightMax) const
     {
+        if ((m_tagMask & GetTagMaskBit(sampleTag)) == 0)
+        {
+            return false;
+        }
+
         auto weightEntry = FindTag(sampleTag);
         return weightEntry != m_weights.end() && weightMin <= weightEntry->m_weight && weightMax >= weightEntry->m_weight;
     }
 
     bool SurfaceTagWeights::HasAnyMatchingTags(AZStd::span<const SurfaceTag> sampleTags, float weightMin, float weightMax) const
     {
+        if ((m_tagMask & GetTagMask(sampleTags)) == 0)
+        {
+            return false;
+        }
+
         for (const auto& sampleTag : sampleTags)
         {
             if (HasMatchingTag(sampleTag, weightMin, weightMax))
@@ -149,6 +178,16 @@ namespace SurfaceData
         return false;
     }
 
+    AZ::u64 SurfaceTagWeights::GetTagMask(AZStd::span<const SurfaceTag> tags)
+    {
+        AZ::u64 mask = 0;
+        for (const auto& tag : tags)
+        {
+            mask |= GetTagMaskBit(tag);
+        }
+        return mask;
+    }
+
     const AzFramework::SurfaceData::SurfaceTagWeight* SurfaceTagWeights::FindTag(AZ::Crc32 tag) const
     {
         for (auto weightItr = m_weights.begin(); weightItr != m_weights.end(); ++weightItr)
@@ -207,6 +207,7 @@ namespace SurfaceData
         // The algorithm below is basically an "erase_if" that's operating across multiple storage vectors and using one level of
         // indirection to keep our sorted indices valid.
         // At some point we might want to consider modifying this to compact the final storage to the minimum needed.
+        const AZ::u64 desiredTagMask = SurfaceTagWeights::GetTagMask(desiredTags);
         for (size_t inputIndex = 0; (inputIndex < m_inputPositionSize); inputIndex++)
         {
             size_t surfacePointStartIndex = GetSurfacePointStartIndexFromInPositionIndex(inputIndex);
@@ -214,7 +215,7 @@ namespace SurfaceData
             size_t index = surfacePointStartIndex;
             for (; index < listSize; index++)
             {
-                if (!m_surfaceWeightsList[m_sortedSurfacePointIndices[index]].HasAnyMatchingTags(desiredTags))
+                if (!m_surfaceWeightsList[m_sortedSurfacePointIndices[index]].HasAnyMatchingTags(desiredTags, desiredTagMask))
                 {
                     break;
                 }
@@ -225,7 +226,7 @@ namespace SurfaceData
                 size_t next = index + 1;
                 for (; next < listSize; ++next)
                 {
-                    if (m_surfaceWeightsList[m_sortedSurfacePointIndices[next]].HasAnyMatchingTags(desiredTags))
+                    if (m_surfaceWeightsList[m_sortedSurfacePointIndices[next]].HasAnyMatchingTags(desiredTags, desiredTagMask))
                     {
                         m_sortedSurfacePointIndices[index] = AZStd::move(m_sortedSurfacePointIndices[next]);
                         m_surfaceCreatorIdList[m_sortedSurfacePointIndices[index]] =
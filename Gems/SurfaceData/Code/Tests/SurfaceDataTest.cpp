@@ -377,6 +377,34 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestRegisteredTags)
         }));
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TagWeightsMatchTagsThatShareMaskBits)
+{
+    // Tags are looked up through a mask indexed by the low bits of their CRC, so make sure that tags sharing a mask bit
+    // are still told apart.
+    const AZ::Crc32 storedTag(0x00000040);
+    const AZ::Crc32 sharedBitTag(0x00000080);
+    const AZ::Crc32 otherBitTag(0x00000041);
+
+    SurfaceData::SurfaceTagWeights weights;
+    weights.AddSurfaceTagWeight(storedTag, 0.5f);
+
+    EXPECT_TRUE(weights.HasMatchingTag(storedTag));
+    EXPECT_FALSE(weights.HasMatchingTag(sharedBitTag));
+    EXPECT_FALSE(weights.HasMatchingTag(otherBitTag));
+    EXPECT_TRUE(weights.HasMatchingTag(storedTag, 0.0f, 1.0f));
+    EXPECT_FALSE(weights.HasMatchingTag(storedTag, 0.6f, 1.0f));
+
+    const SurfaceData::SurfaceTag noMatchTags[] = { SurfaceData::SurfaceTag(sharedBitTag), SurfaceData::SurfaceTag(otherBitTag) };
+    const SurfaceData::SurfaceTag matchTags[] = { SurfaceData::SurfaceTag(otherBitTag), SurfaceData::SurfaceTag(storedTag) };
+    EXPECT_FALSE(weights.HasAnyMatchingTags(noMatchTags));
+    EXPECT_TRUE(weights.HasAnyMatchingTags(matchTags));
+    EXPECT_TRUE(weights.HasAnyMatchingTags(matchTags, SurfaceData::SurfaceTagWeights::GetTagMask(matchTags)));
+
+    // Clearing the weights also clears the mask.
+    weights.Clear();
+    EXPECT_FALSE(weights.HasAnyMatchingTags(matchTags));
+}
+
 #if AZ_TRAIT_DISABLE_FAILED_SURFACE_DATA_TESTS
 TEST_F(SurfaceDataTestApp, DISABLED_SurfaceData_TestGetQuadListRayIntersection)
 #else
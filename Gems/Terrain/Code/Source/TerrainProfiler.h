@@ -21,3 +21,6 @@ AZ_DECLARE_BUDGET(Terrain);
 #define TERRAIN_PROFILE_SCOPE_VERBOSE(...)
 #define TERRAIN_PROFILE_FUNCTION_VERBOSE
 #endif
+
+// Report a per-frame terrain statistic, such as the amount of data updated, to the profiler.
+#define TERRAIN_PROFILE_DATAPOINT(value, counterName) AZ_PROFILE_DATAPOINT(Terrain, value, counterName);
@@ -118,6 +118,9 @@ namespace Terrain
         //! The biggest possible number of regions can return when calling UpdateCenter();
         static constexpr uint32_t MaxUpdateRegions = 6;
 
+        //! The biggest possible number of regions can return when calling TransformRegion();
+        static constexpr uint32_t MaxTransformedRegions = 4;
+
         //! Takes in a single world space aabb and transforms it into 0-4 regions in the clipmap clamped
         //! to the bounds of the clipmap.
         ClipmapBoundsRegionList TransformRegion(AZ::Aabb worldSpaceRegion);
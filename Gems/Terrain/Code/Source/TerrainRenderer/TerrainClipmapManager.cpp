@@ -14,6 +14,7 @@
 #include <Atom/RPI.Public/ViewportContext.h>
 #include <Atom/RPI.Public/ViewportContextBus.h>
 #include <AzCore/Console/Console.h>
+#include <TerrainProfiler.h>
 
 namespace Terrain
 {
@@ -69,6 +70,15 @@ namespace Terrain
         AZ::ConsoleFunctorFlags::Null,
         "A multiplier to the final output of the clipmap texture's debug display.");
 
+    AZ_CVAR(
+        uint32_t,
+        r_terrainClipmapUpdateBudget,
+        1024 * 1024,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The max number of texels regenerated per frame in each of the macro and detail clipmap stacks, 0 for no limit.\n"
+        "Levels that don't fit are updated on the next frames, from the coarsest to the finest.");
+
     namespace
     {
         [[maybe_unused]] static const char* TerrainClipmapManagerName = "TerrainClipmapManager";
@@ -350,7 +360,7 @@ namespace Terrain
         m_macroClipmapUpdateRegionsBuffer = AZ::Render::GpuBufferHandler(desc);
 
         // Reserve the max possible size.
-        m_macroClipmapUpdateRegions.reserve(ClipmapBounds::MaxUpdateRegions * m_macroClipmapStackSize);
+        m_macroClipmapUpdateRegions.reserve((ClipmapBounds::MaxUpdateRegions + ClipmapBounds::MaxTransformedRegions) * m_macroClipmapStackSize);
     }
 
     void TerrainClipmapManager::InitializeDetailClipmapGpuBuffer()
@@ -363,7 +373,7 @@ namespace Terrain
         m_detailClipmapUpdateRegionsBuffer = AZ::Render::GpuBufferHandler(desc);
 
         // Reserve the max possible size.
-        m_detailClipmapUpdateRegions.reserve(ClipmapBounds::MaxUpdateRegions * m_detailClipmapStackSize);
+        m_detailClipmapUpdateRegions.reserve((ClipmapBounds::MaxUpdateRegions + ClipmapBounds::MaxTransformedRegions) * m_detailClipmapStackSize);
     }
 
     void TerrainClipmapManager::ClearMacroClipmapGpuBuffer()
@@ -379,6 +389,7 @@ namespace Terrain
     void TerrainClipmapManager::InitializeMacroClipmapBounds(const AZ::Vector2& center)
     {
         m_macroClipmapBounds.resize(m_macroClipmapStackSize);
+        m_macroClipmapDirtyRegions.assign(m_macroClipmapStackSize, AZ::Aabb::CreateNull());
         float clipmapToWorldScale = m_config.m_macroClipmapMaxRenderRadius * 2.0f / m_config.m_clipmapSize;
         for (int32_t clipmapIndex = m_macroClipmapStackSize - 1; clipmapIndex >= 0; --clipmapIndex)
         {
@@ -397,6 +408,7 @@ namespace Terrain
     void TerrainClipmapManager::InitializeDetailClipmapBounds(const AZ::Vector2& center)
     {
         m_detailClipmapBounds.resize(m_detailClipmapStackSize);
+        m_detailClipmapDirtyRegions.assign(m_detailClipmapStackSize, AZ::Aabb::CreateNull());
         float clipmapToWorldScale = m_config.m_detailClipmapMaxRenderRadius * 2.0f / m_config.m_clipmapSize;
         for (int32_t clipmapIndex = m_detailClipmapStackSize - 1; clipmapIndex >= 0; --clipmapIndex)
         {
@@ -644,11 +656,15 @@ namespace Terrain
         }
 
         // macro clipmap data:
+        uint32_t deferredLevelCount = 0;
+        const uint64_t macroTexelCount = GatherClipmapUpdateRegions(
+            currentViewPosition, m_macroClipmapBounds, m_macroClipmapDirtyRegions, m_macroClipmapUpdateRegions, deferredLevelCount);
+        TERRAIN_PROFILE_DATAPOINT(macroTexelCount, L"Terrain/Clipmap/MacroTexelsUpdated");
+        TERRAIN_PROFILE_DATAPOINT(deferredLevelCount, L"Terrain/Clipmap/MacroLevelsDeferred");
+
         for (uint32_t clipmapIndex = 0; clipmapIndex < m_macroClipmapStackSize; ++clipmapIndex)
         {
-            ClipmapBounds& clipmapBounds = m_macroClipmapBounds[clipmapIndex];
-
-            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition);
+            const ClipmapBounds& clipmapBounds = m_macroClipmapBounds[clipmapIndex];
 
             // write updated center
             Vector2i center = clipmapBounds.GetModCenter();
@@ -658,15 +674,6 @@ namespace Terrain
             AZ::Vector2 centerWorld = clipmapBounds.GetCenterInWorldSpace();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_macro[0] = centerWorld.GetX();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_macro[1] = centerWorld.GetY();
-
-            for (uint32_t i = 0; i < updateRegionList.size(); ++i)
-            {
-                AZStd::array<uint32_t, 4> aabb = { aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_y),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_y) };
-                m_macroClipmapUpdateRegions.push_back(ClipmapUpdateRegion(clipmapIndex, aabb));
-            }
         }
 
         uint32_t updateRegionCount = aznumeric_cast<uint32_t>(m_macroClipmapUpdateRegions.size());
@@ -690,11 +697,14 @@ namespace Terrain
         }
 
         // detail clipmap data:
+        const uint64_t detailTexelCount = GatherClipmapUpdateRegions(
+            currentViewPosition, m_detailClipmapBounds, m_detailClipmapDirtyRegions, m_detailClipmapUpdateRegions, deferredLevelCount);
+        TERRAIN_PROFILE_DATAPOINT(detailTexelCount, L"Terrain/Clipmap/DetailTexelsUpdated");
+        TERRAIN_PROFILE_DATAPOINT(deferredLevelCount, L"Terrain/Clipmap/DetailLevelsDeferred");
+
         for (uint32_t clipmapIndex = 0; clipmapIndex < m_detailClipmapStackSize; ++clipmapIndex)
         {
-            ClipmapBounds& clipmapBounds = m_detailClipmapBounds[clipmapIndex];
-
-            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition);
+            const ClipmapBounds& clipmapBounds = m_detailClipmapBounds[clipmapIndex];
 
             // write updated center
             Vector2i center = clipmapBounds.GetModCenter();
@@ -704,15 +714,6 @@ namespace Terrain
             AZ::Vector2 centerWorld = clipmapBounds.GetCenterInWorldSpace();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_detail[0] = centerWorld.GetX();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_detail[1] = centerWorld.GetY();
-
-            for (uint32_t i = 0; i < updateRegionList.size(); ++i)
-            {
-                AZStd::array<uint32_t, 4> aabb = { aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_y),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_y) };
-                m_detailClipmapUpdateRegions.push_back(ClipmapUpdateRegion(clipmapIndex, aabb));
-            }
         }
 
         updateRegionCount = aznumeric_cast<uint32_t>(m_detailClipmapUpdateRegions.size());
@@ -736,6 +737,96 @@ namespace Terrain
         }
     }
 
+    uint64_t TerrainClipmapManager::GatherClipmapUpdateRegions(
+        const AZ::Vector2& viewPosition,
+        AZStd::vector<ClipmapBounds>& clipmapBounds,
+        AZStd::vector<AZ::Aabb>& dirtyRegions,
+        AZStd::vector<ClipmapUpdateRegion>& updateRegions,
+        uint32_t& deferredLevelCount)
+    {
+        const uint64_t updateBudget = uint32_t(r_terrainClipmapUpdateBudget);
+        uint64_t updatedTexelCount = 0;
+        deferredLevelCount = 0;
+
+        // Coarser levels go first, so when the budget runs out it's always the finest levels that lag behind the view.
+        // Those keep valid data around their previous center, and the shader uses the coarser levels outside of it.
+        for (int32_t clipmapIndex = aznumeric_cast<int32_t>(clipmapBounds.size()) - 1; clipmapIndex >= 0; --clipmapIndex)
+        {
+            // Work on a copy, so the level is left as it is if it doesn't fit in the budget.
+            ClipmapBounds bounds = clipmapBounds[clipmapIndex];
+            AZ::Aabb untouchedRegion = AZ::Aabb::CreateNull();
+            ClipmapBoundsRegionList levelRegions = bounds.UpdateCenter(viewPosition, &untouchedRegion);
+
+            // The parts of the dirty region exposed by the center moving are already covered by the strips above.
+            const AZ::Aabb& dirtyRegion = dirtyRegions[clipmapIndex];
+            if (dirtyRegion.IsValid() && untouchedRegion.IsValid())
+            {
+                const AZ::Aabb untouchedDirtyRegion = dirtyRegion.GetClamped(untouchedRegion);
+                if (untouchedDirtyRegion.IsValid())
+                {
+                    ClipmapBoundsRegionList dirtyRegionList = bounds.TransformRegion(untouchedDirtyRegion);
+                    levelRegions.insert(levelRegions.end(), dirtyRegionList.begin(), dirtyRegionList.end());
+                }
+            }
+
+            uint64_t levelTexelCount = 0;
+            for (const ClipmapBoundsRegion& region : levelRegions)
+            {
+                levelTexelCount += aznumeric_cast<uint64_t>(region.m_localAabb.m_max.m_x - region.m_localAabb.m_min.m_x) *
+                    aznumeric_cast<uint64_t>(region.m_localAabb.m_max.m_y - region.m_localAabb.m_min.m_y);
+            }
+
+            // Always update at least one level per frame, so the clipmaps keep catching up however small the budget is.
+            if (updateBudget != 0 && updatedTexelCount != 0 && updatedTexelCount + levelTexelCount > updateBudget)
+            {
+                deferredLevelCount = aznumeric_cast<uint32_t>(clipmapIndex + 1);
+                break;
+            }
+
+            clipmapBounds[clipmapIndex] = bounds;
+            dirtyRegions[clipmapIndex] = AZ::Aabb::CreateNull();
+            updatedTexelCount += levelTexelCount;
+
+            for (const ClipmapBoundsRegion& region : levelRegions)
+            {
+                AZStd::array<uint32_t, 4> aabb = { aznumeric_cast<uint32_t>(region.m_localAabb.m_min.m_x),
+                                                   aznumeric_cast<uint32_t>(region.m_localAabb.m_min.m_y),
+                                                   aznumeric_cast<uint32_t>(region.m_localAabb.m_max.m_x),
+                                                   aznumeric_cast<uint32_t>(region.m_localAabb.m_max.m_y) };
+                updateRegions.push_back(ClipmapUpdateRegion(clipmapIndex, aabb));
+            }
+        }
+
+        return updatedTexelCount;
+    }
+
+    void TerrainClipmapManager::AddDirtyRegion(const AZ::Aabb& dirtyRegion)
+    {
+        if (!dirtyRegion.IsValid())
+        {
+            return;
+        }
+
+        // The clipmaps are 2D, so flatten the region to match the update regions that it gets clamped to.
+        const AZ::Aabb flatDirtyRegion = AZ::Aabb::CreateFromMinMaxValues(
+            dirtyRegion.GetMin().GetX(), dirtyRegion.GetMin().GetY(), 0.0f, dirtyRegion.GetMax().GetX(), dirtyRegion.GetMax().GetY(), 0.0f);
+
+        for (AZ::Aabb& levelDirtyRegion : m_macroClipmapDirtyRegions)
+        {
+            levelDirtyRegion.AddAabb(flatDirtyRegion);
+        }
+        for (AZ::Aabb& levelDirtyRegion : m_detailClipmapDirtyRegions)
+        {
+            levelDirtyRegion.AddAabb(flatDirtyRegion);
+        }
+    }
+
+    void TerrainClipmapManager::AddDirtyRegionEverywhere()
+    {
+        // The dirty regions get clamped to the bounds of each level when they're gathered.
+        AddDirtyRegion(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-AZ::Constants::FloatMax), AZ::Vector3(AZ::Constants::FloatMax)));
+    }
+
     AZ::Data::Instance<AZ::RPI::AttachmentImage> TerrainClipmapManager::GetClipmapImage(ClipmapName clipmapName) const
     {
         AZ_Assert(clipmapName < ClipmapName::Count, "Must be a valid ClipmapName enum.");
@@ -773,52 +864,60 @@ namespace Terrain
     }
 
     // AzFramework::Terrain::TerrainDataNotificationBus overrides...
-    void TerrainClipmapManager::OnTerrainDataChanged(
-        [[maybe_unused]] const AZ::Aabb& dirtyRegion, [[maybe_unused]] TerrainDataChangedMask dataChangedMask)
+    void TerrainClipmapManager::OnTerrainDataChanged(const AZ::Aabb& dirtyRegion, TerrainDataChangedMask dataChangedMask)
     {
-        TriggerFullRefresh();
+        // Settings changes can affect the whole world, otherwise only the changed region gets regenerated.
+        if ((dataChangedMask & TerrainDataChangedMask::Settings) == TerrainDataChangedMask::Settings || !dirtyRegion.IsValid())
+        {
+            AddDirtyRegionEverywhere();
+        }
+        else
+        {
+            AddDirtyRegion(dirtyRegion);
+        }
     }
 
     // TerrainMacroMaterialNotificationBus overrides...
     void TerrainClipmapManager::OnTerrainMacroMaterialCreated(
-        [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] const MacroMaterialData& material)
+        [[maybe_unused]] AZ::EntityId entityId, const MacroMaterialData& material)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(material.m_bounds);
     }
 
     void TerrainClipmapManager::OnTerrainMacroMaterialChanged(
-        [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] const MacroMaterialData& material)
+        [[maybe_unused]] AZ::EntityId entityId, const MacroMaterialData& material)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(material.m_bounds);
     }
 
     void TerrainClipmapManager::OnTerrainMacroMaterialRegionChanged(
-        [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] const AZ::Aabb& oldRegion, [[maybe_unused]] const AZ::Aabb& newRegion)
+        [[maybe_unused]] AZ::EntityId entityId, const AZ::Aabb& oldRegion, const AZ::Aabb& newRegion)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(oldRegion);
+        AddDirtyRegion(newRegion);
     }
 
     void TerrainClipmapManager::OnTerrainMacroMaterialDestroyed([[maybe_unused]] AZ::EntityId entityId)
     {
-        TriggerFullRefresh();
+        AddDirtyRegionEverywhere();
     }
 
     // TerrainAreaMaterialNotificationBus overrides...
     void TerrainClipmapManager::OnTerrainDefaultSurfaceMaterialCreated(
         [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] AZ::Data::Instance<AZ::RPI::Material> material)
     {
-        TriggerFullRefresh();
+        AddDirtyRegionEverywhere();
     }
 
     void TerrainClipmapManager::OnTerrainDefaultSurfaceMaterialDestroyed([[maybe_unused]] AZ::EntityId entityId)
     {
-        TriggerFullRefresh();
+        AddDirtyRegionEverywhere();
     }
 
     void TerrainClipmapManager::OnTerrainDefaultSurfaceMaterialChanged(
         [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] AZ::Data::Instance<AZ::RPI::Material> newMaterial)
     {
-        TriggerFullRefresh();
+        AddDirtyRegionEverywhere();
     }
 
     void TerrainClipmapManager::OnTerrainSurfaceMaterialMappingCreated(
@@ -826,13 +925,13 @@ namespace Terrain
         [[maybe_unused]] SurfaceData::SurfaceTag surfaceTag,
         [[maybe_unused]] AZ::Data::Instance<AZ::RPI::Material> material)
     {
-        TriggerFullRefresh();
+        AddDirtyRegionEverywhere();
     }
 
     void TerrainClipmapManager::OnTerrainSurfaceMaterialMappingDestroyed(
         [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] SurfaceData::SurfaceTag surfaceTag)
     {
-        TriggerFullRefresh();
+        AddDirtyRegionEverywhere();
     }
 
     void TerrainClipmapManager::OnTerrainSurfaceMaterialMappingMaterialChanged(
@@ -840,7 +939,7 @@ namespace Terrain
         [[maybe_unused]] SurfaceData::SurfaceTag surfaceTag,
         [[maybe_unused]] AZ::Data::Instance<AZ::RPI::Material> material)
     {
-        TriggerFullRefresh();
+        AddDirtyRegionEverywhere();
     }
 
     void TerrainClipmapManager::OnTerrainSurfaceMaterialMappingTagChanged(
@@ -848,24 +947,25 @@ namespace Terrain
         [[maybe_unused]] SurfaceData::SurfaceTag oldSurfaceTag,
         [[maybe_unused]] SurfaceData::SurfaceTag newSurfaceTag)
     {
-        TriggerFullRefresh();
+        AddDirtyRegionEverywhere();
     }
 
     void TerrainClipmapManager::OnTerrainSurfaceMaterialMappingRegionCreated(
-        [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] const AZ::Aabb& region)
+        [[maybe_unused]] AZ::EntityId entityId, const AZ::Aabb& region)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(region);
     }
 
     void TerrainClipmapManager::OnTerrainSurfaceMaterialMappingRegionDestroyed(
-        [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] const AZ::Aabb& oldRegion)
+        [[maybe_unused]] AZ::EntityId entityId, const AZ::Aabb& oldRegion)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(oldRegion);
     }
 
     void TerrainClipmapManager::OnTerrainSurfaceMaterialMappingRegionChanged(
-        [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] const AZ::Aabb& oldRegion, [[maybe_unused]] const AZ::Aabb& newRegion)
+        [[maybe_unused]] AZ::EntityId entityId, const AZ::Aabb& oldRegion, const AZ::Aabb& newRegion)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(oldRegion);
+        AddDirtyRegion(newRegion);
     }
 }
@@ -175,6 +175,24 @@ namespace Terrain
             const AZ::RPI::Scene* scene,
             AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& terrainSrg);
 
+        struct ClipmapUpdateRegion;
+
+        //! Gather the regions of a clipmap stack to update this frame: the strips exposed by moving toward the view position
+        //! and the dirty regions. Levels are processed from the coarsest to the finest until the per-frame texel budget
+        //! is used up, the remaining levels keep their current center and dirty regions until the next frames.
+        //! Returns the number of texels to update.
+        static uint64_t GatherClipmapUpdateRegions(
+            const AZ::Vector2& viewPosition,
+            AZStd::vector<ClipmapBounds>& clipmapBounds,
+            AZStd::vector<AZ::Aabb>& dirtyRegions,
+            AZStd::vector<ClipmapUpdateRegion>& updateRegions,
+            uint32_t& deferredLevelCount);
+
+        //! Mark a world space region as needing to be regenerated in all the clipmap levels.
+        void AddDirtyRegion(const AZ::Aabb& dirtyRegion);
+        //! Mark all the clipmap levels as needing to be regenerated, over a number of frames when the update budget is limited.
+        void AddDirtyRegionEverywhere();
+
         //! Initialzation functions.
         void QueryMacroClipmapStackSize();
         void QueryDetailClipmapStackSize();
@@ -317,6 +335,10 @@ namespace Terrain
         AZStd::vector<ClipmapBounds> m_macroClipmapBounds;
         AZStd::vector<ClipmapBounds> m_detailClipmapBounds;
 
+        //! World space regions of each clipmap level that need to be regenerated, null when the level is up to date.
+        AZStd::vector<AZ::Aabb> m_macroClipmapDirtyRegions;
+        AZStd::vector<AZ::Aabb> m_detailClipmapDirtyRegions;
+
         //! GPU buffer containing the region aabbs to be updated during this frame.
         AZ::Render::GpuBufferHandler m_macroClipmapUpdateRegionsBuffer;
         AZ::Render::GpuBufferHandler m_detailClipmapUpdateRegionsBuffer;
@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainQueryCache.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+
+#include <TerrainProfiler.h>
+
+namespace Terrain
+{
+    AZ_CVAR(
+        uint32_t,
+        terrain_queryCacheMaxTiles,
+        1024,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of tiles held by each layer of the terrain query cache, the least recently used tiles are evicted past it.\n"
+        "A height tile takes 8 KiB and a surface data tile about 37 KiB.");
+
+    namespace
+    {
+        // Evicting a fraction of the tiles at once amortizes the cost of finding the least recently used ones.
+        constexpr size_t EvictionFractionDivisor = 4;
+
+        // Enough for a query spanning a few tiles, queries touching more tiles queue the rest on a later call.
+        using MissingTileList = AZStd::fixed_vector<AZ::u64, 8>;
+
+        void AddMissingTile(MissingTileList& missingTiles, AZ::u64 key)
+        {
+            if ((missingTiles.size() < missingTiles.capacity()) &&
+                (AZStd::find(missingTiles.begin(), missingTiles.end(), key) == missingTiles.end()))
+            {
+                missingTiles.push_back(key);
+            }
+        }
+    } // namespace
+
+    TerrainQueryCache::TerrainQueryCache(HeightsFillFunction heightsFillFunction, SurfaceWeightsFillFunction surfaceWeightsFillFunction)
+        : m_heightsFillFunction(AZStd::move(heightsFillFunction))
+        , m_surfaceWeightsFillFunction(AZStd::move(surfaceWeightsFillFunction))
+    {
+    }
+
+    TerrainQueryCache::~TerrainQueryCache()
+    {
+        WaitForPendingFills();
+    }
+
+    void TerrainQueryCache::Reset(
+        float heightQueryResolution, float surfaceDataQueryResolution, const AzFramework::Terrain::FloatRange& heightRange)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        ++m_generation;
+        m_heightLayer.m_tiles.clear();
+        m_heightLayer.m_queryResolution = heightQueryResolution;
+        m_surfaceLayer.m_tiles.clear();
+        m_surfaceLayer.m_queryResolution = surfaceDataQueryResolution;
+        m_heightRange = heightRange;
+    }
+
+    void TerrainQueryCache::Invalidate(const AZ::Aabb& region, bool heights, bool surfaceData)
+    {
+        if (!region.IsValid() || !(heights || surfaceData))
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+        // Fills in flight may have read the data from before the change, so they are all discarded.
+        ++m_generation;
+        if (heights)
+        {
+            InvalidateLayer(m_heightLayer, region);
+        }
+        if (surfaceData)
+        {
+            InvalidateLayer(m_surfaceLayer, region);
+        }
+    }
+
+    void TerrainQueryCache::WaitForPendingFills()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_pendingFillMutex);
+        m_pendingFillCondition.wait(lock, [this]() { return m_pendingFillJobCount == 0; });
+    }
+
+    bool TerrainQueryCache::GetHeights(AZStd::span<const GridPoint> points, AZStd::span<float> heights, AZStd::span<bool> terrainExists)
+    {
+        AZ_Assert(
+            (points.size() == heights.size()) && (points.size() == terrainExists.size()),
+            "The sizes of the points, heights and terrain exists lists should match.");
+
+        MissingTileList missingTiles;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+            // Quantization needs a non-empty height range.
+            if (!(m_heightRange.m_max > m_heightRange.m_min))
+            {
+                return false;
+            }
+
+            const float minHeight = m_heightRange.m_min;
+            const float heightStep = (m_heightRange.m_max - m_heightRange.m_min) / MaxQuantizedHeight;
+            const AZ::u32 useTick = ++m_useTick;
+
+            // Queries are usually spatially coherent, so remember the last tile to skip most of the lookups.
+            const HeightTile* tile = nullptr;
+            TileKey tileKey = 0;
+            bool hasTile = false;
+
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                const TileKey key = GetTileKey(points[index].m_x >> TileSizeLog2, points[index].m_y >> TileSizeLog2);
+                if (!hasTile || (key != tileKey))
+                {
+                    auto tileIt = m_heightLayer.m_tiles.find(key);
+                    tile = (tileIt != m_heightLayer.m_tiles.end()) ? tileIt->second.get() : nullptr;
+                    tileKey = key;
+                    hasTile = true;
+
+                    if (tile)
+                    {
+                        tile->m_lastUseTick.store(useTick, AZStd::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        AddMissingTile(missingTiles, key);
+                    }
+                }
+
+                if (tile)
+                {
+                    const AZ::u16 quantizedHeight = tile->m_heights[GetPointIndex(points[index])];
+                    terrainExists[index] = (quantizedHeight != NoTerrainHeight);
+                    heights[index] = terrainExists[index] ? minHeight + (quantizedHeight * heightStep) : minHeight;
+                }
+            }
+        }
+
+        if (!missingTiles.empty())
+        {
+            QueueFills(m_heightLayer, missingTiles, &TerrainQueryCache::FillHeightTile);
+            return false;
+        }
+
+        return true;
+    }
+
+    bool TerrainQueryCache::GetSurfaceWeights(
+        AZStd::span<const GridPoint> points, AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights)
+    {
+        AZ_Assert(points.size() == surfaceWeights.size(), "The sizes of the points and surface weights lists should match.");
+
+        constexpr float WeightScale = 1.0f / 255.0f;
+
+        MissingTileList missingTiles;
+        bool allPointsCached = true;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+            const AZ::u32 useTick = ++m_useTick;
+            const SurfaceTile* tile = nullptr;
+            TileKey tileKey = 0;
+            bool hasTile = false;
+
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                const TileKey key = GetTileKey(points[index].m_x >> TileSizeLog2, points[index].m_y >> TileSizeLog2);
+                if (!hasTile || (key != tileKey))
+                {
+                    auto tileIt = m_surfaceLayer.m_tiles.find(key);
+                    tile = (tileIt != m_surfaceLayer.m_tiles.end()) ? tileIt->second.get() : nullptr;
+                    tileKey = key;
+                    hasTile = true;
+
+                    if (tile)
+                    {
+                        tile->m_lastUseTick.store(useTick, AZStd::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        AddMissingTile(missingTiles, key);
+                    }
+                }
+
+                if (!tile)
+                {
+                    continue;
+                }
+
+                const size_t pointIndex = GetPointIndex(points[index]);
+                const AZ::u8 surfaceCount = tile->m_counts[pointIndex];
+                if (surfaceCount == UncachedSurfaceCount)
+                {
+                    allPointsCached = false;
+                    break;
+                }
+
+                AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights = surfaceWeights[index];
+                outSurfaceWeights.clear();
+                for (size_t surface = 0; surface < surfaceCount; ++surface)
+                {
+                    const SurfaceTile::Entry& entry = tile->m_entries[pointIndex][surface];
+                    outSurfaceWeights.emplace_back(tile->m_palette[entry.m_paletteIndex], entry.m_weight * WeightScale);
+                }
+            }
+        }
+
+        if (!missingTiles.empty())
+        {
+            QueueFills(m_surfaceLayer, missingTiles, &TerrainQueryCache::FillSurfaceTile);
+            return false;
+        }
+
+        return allPointsCached;
+    }
+
+    TerrainQueryCache::TileKey TerrainQueryCache::GetTileKey(int32_t tileX, int32_t tileY)
+    {
+        return (static_cast<TileKey>(static_cast<AZ::u32>(tileX)) << 32) | static_cast<AZ::u32>(tileY);
+    }
+
+    void TerrainQueryCache::GetTileCoordinates(TileKey key, int32_t& tileX, int32_t& tileY)
+    {
+        tileX = static_cast<int32_t>(static_cast<AZ::u32>(key >> 32));
+        tileY = static_cast<int32_t>(static_cast<AZ::u32>(key));
+    }
+
+    size_t TerrainQueryCache::GetPointIndex(const GridPoint& point)
+    {
+        // Masking rather than a modulo keeps negative coordinates in the [0, TileSize) range.
+        constexpr int32_t mask = TileSize - 1;
+        return (static_cast<size_t>(point.m_y & mask) << TileSizeLog2) | static_cast<size_t>(point.m_x & mask);
+    }
+
+    bool TerrainQueryCache::TileOverlapsRegion(TileKey key, float queryResolution, const AZ::Aabb& region)
+    {
+        int32_t tileX = 0;
+        int32_t tileY = 0;
+        GetTileCoordinates(key, tileX, tileY);
+
+        // The extents of the tile are its first and last grid points, a region touching either of them changes the tile.
+        const float tileExtent = (TileSize - 1) * queryResolution;
+        const float minX = tileX * TileSize * queryResolution;
+        const float minY = tileY * TileSize * queryResolution;
+
+        return (minX <= region.GetMax().GetX()) && ((minX + tileExtent) >= region.GetMin().GetX()) &&
+            (minY <= region.GetMax().GetY()) && ((minY + tileExtent) >= region.GetMin().GetY());
+    }
+
+    template<typename TileType>
+    void TerrainQueryCache::InvalidateLayer(TileLayer<TileType>& layer, const AZ::Aabb& region)
+    {
+        AZStd::erase_if(
+            layer.m_tiles,
+            [&layer, &region](const auto& tile)
+            {
+                return TileOverlapsRegion(tile.first, layer.m_queryResolution, region);
+            });
+    }
+
+    template<typename TileType>
+    void TerrainQueryCache::AddTile(TileLayer<TileType>& layer, TileKey key, AZStd::unique_ptr<TileType> tile)
+    {
+        const size_t maxTiles = AZStd::max<size_t>(terrain_queryCacheMaxTiles, 1);
+        if (layer.m_tiles.size() >= maxTiles)
+        {
+            // Queries follow the viewer, so the least recently used tiles are the ones it has moved away from.
+            AZStd::vector<AZStd::pair<AZ::u32, TileKey>> tileUses;
+            tileUses.reserve(layer.m_tiles.size());
+            for (const auto& [tileKey, cachedTile] : layer.m_tiles)
+            {
+                // Ticks wrap around, so compare how long ago each tile was used rather than the raw ticks.
+                tileUses.emplace_back(m_useTick - cachedTile->m_lastUseTick.load(AZStd::memory_order_relaxed), tileKey);
+            }
+
+            const size_t evictionCount = AZStd::min(tileUses.size(), (tileUses.size() - maxTiles) + 1 + (maxTiles / EvictionFractionDivisor));
+            AZStd::nth_element(
+                tileUses.begin(), tileUses.begin() + (evictionCount - 1), tileUses.end(),
+                [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.first > rhs.first;
+                });
+            for (size_t index = 0; index < evictionCount; ++index)
+            {
+                layer.m_tiles.erase(tileUses[index].second);
+            }
+            TERRAIN_PROFILE_DATAPOINT(evictionCount, L"Terrain/QueryCache/TilesEvicted");
+        }
+
+        // Count new tiles as just used, so they aren't the first to be evicted before any query reads them.
+        tile->m_lastUseTick.store(m_useTick, AZStd::memory_order_relaxed);
+        layer.m_tiles[key] = AZStd::move(tile);
+    }
+
+    template<typename TileType>
+    void TerrainQueryCache::QueueFills(
+        TileLayer<TileType>& layer, AZStd::span<const TileKey> missingTiles, void (TerrainQueryCache::*fillTile)(TileKey, AZ::u32))
+    {
+        MissingTileList tilesToFill;
+        AZ::u32 generation = 0;
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+
+            generation = m_generation;
+            for (const TileKey key : missingTiles)
+            {
+                // Another query may have filled the tile or queued its fill since it was found missing.
+                if (!layer.m_tiles.contains(key) && layer.m_pendingFills.insert(key).second)
+                {
+                    tilesToFill.push_back(key);
+                }
+            }
+        }
+
+        if (tilesToFill.empty())
+        {
+            return;
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingFillMutex);
+            m_pendingFillJobCount += tilesToFill.size();
+        }
+
+        const bool autoDelete = true;
+        for (const TileKey key : tilesToFill)
+        {
+            AZ::Job* fillJob = AZ::CreateJobFunction(
+                [this, key, generation, fillTile]()
+                {
+                    (this->*fillTile)(key, generation);
+                    OnFillCompleted();
+                },
+                autoDelete);
+            fillJob->Start();
+        }
+    }
+
+    void TerrainQueryCache::FillHeightTile(TileKey key, AZ::u32 generation)
+    {
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        float queryResolution = 1.0f;
+        AzFramework::Terrain::FloatRange heightRange;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+            queryResolution = m_heightLayer.m_queryResolution;
+            heightRange = m_heightRange;
+        }
+
+        AZStd::unique_ptr<HeightTile> tile;
+        if ((generation == m_generation) && (heightRange.m_max > heightRange.m_min))
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            GenerateTilePositions(key, queryResolution, positions);
+
+            AZStd::vector<float> heights(positions.size());
+            AZStd::vector<bool> terrainExists(positions.size());
+            m_heightsFillFunction(positions, heights, terrainExists);
+
+            const float heightScale = MaxQuantizedHeight / (heightRange.m_max - heightRange.m_min);
+            tile = AZStd::make_unique<HeightTile>();
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                if (terrainExists[index])
+                {
+                    const float quantizedHeight = ((heights[index] - heightRange.m_min) * heightScale) + 0.5f;
+                    tile->m_heights[index] =
+                        static_cast<AZ::u16>(AZStd::clamp(quantizedHeight, 0.0f, static_cast<float>(MaxQuantizedHeight)));
+                }
+                else
+                {
+                    tile->m_heights[index] = NoTerrainHeight;
+                }
+            }
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        m_heightLayer.m_pendingFills.erase(key);
+        if (tile && (generation == m_generation))
+        {
+            AddTile(m_heightLayer, key, AZStd::move(tile));
+        }
+    }
+
+    void TerrainQueryCache::FillSurfaceTile(TileKey key, AZ::u32 generation)
+    {
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        float queryResolution = 1.0f;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+            queryResolution = m_surfaceLayer.m_queryResolution;
+        }
+
+        AZStd::unique_ptr<SurfaceTile> tile;
+        if (generation == m_generation)
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            GenerateTilePositions(key, queryResolution, positions);
+
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights(positions.size());
+            m_surfaceWeightsFillFunction(positions, surfaceWeights);
+
+            tile = AZStd::make_unique<SurfaceTile>();
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                const AzFramework::SurfaceData::SurfaceTagWeightList& pointSurfaceWeights = surfaceWeights[index];
+                tile->m_counts[index] = UncachedSurfaceCount;
+                if (pointSurfaceWeights.size() > MaxCachedSurfacesPerPoint)
+                {
+                    continue;
+                }
+
+                bool isCacheable = true;
+                for (size_t surface = 0; surface < pointSurfaceWeights.size(); ++surface)
+                {
+                    const AZ::Crc32 surfaceType = pointSurfaceWeights[surface].m_surfaceType;
+                    auto paletteIt = AZStd::find(tile->m_palette.begin(), tile->m_palette.end(), surfaceType);
+                    if (paletteIt == tile->m_palette.end())
+                    {
+                        if (tile->m_palette.size() == tile->m_palette.capacity())
+                        {
+                            isCacheable = false;
+                            break;
+                        }
+                        tile->m_palette.push_back(surfaceType);
+                        paletteIt = tile->m_palette.end() - 1;
+                    }
+
+                    SurfaceTile::Entry& entry = tile->m_entries[index][surface];
+                    entry.m_paletteIndex = static_cast<AZ::u8>(paletteIt - tile->m_palette.begin());
+                    entry.m_weight = static_cast<AZ::u8>((AZStd::clamp(pointSurfaceWeights[surface].m_weight, 0.0f, 1.0f) * 255.0f) + 0.5f);
+                }
+
+                if (isCacheable)
+                {
+                    tile->m_counts[index] = static_cast<AZ::u8>(pointSurfaceWeights.size());
+                }
+            }
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        m_surfaceLayer.m_pendingFills.erase(key);
+        if (tile && (generation == m_generation))
+        {
+            AddTile(m_surfaceLayer, key, AZStd::move(tile));
+        }
+    }
+
+    void TerrainQueryCache::GenerateTilePositions(TileKey key, float queryResolution, AZStd::vector<AZ::Vector3>& positions) const
+    {
+        int32_t tileX = 0;
+        int32_t tileY = 0;
+        GetTileCoordinates(key, tileX, tileY);
+
+        positions.clear();
+        positions.reserve(TilePointCount);
+        for (int32_t y = 0; y < TileSize; ++y)
+        {
+            const float positionY = ((tileY * TileSize) + y) * queryResolution;
+            for (int32_t x = 0; x < TileSize; ++x)
+            {
+                const float positionX = ((tileX * TileSize) + x) * queryResolution;
+                positions.emplace_back(positionX, positionY, 0.0f);
+            }
+        }
+    }
+
+    void TerrainQueryCache::OnFillCompleted()
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingFillMutex);
+            --m_pendingFillJobCount;
+        }
+        m_pendingFillCondition.notify_all();
+    }
+} // namespace Terrain
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <AzFramework/SurfaceData/SurfaceData.h>
+#include <AzFramework/Terrain/TerrainDataRequestBus.h>
+
+namespace Terrain
+{
+    //! Cache of the terrain heights and surface weights at the points of the terrain query grids.
+    //! The grids are split into square tiles, which are filled on background jobs the first time a query touches them and
+    //! dropped again when a dirty region overlaps them or, once a layer is full, when they are the least recently used ones. Heights are quantized to 16 bits over the terrain height range and
+    //! surface weights to 8 bits, so cached results can differ slightly from the ones computed directly from the terrain areas.
+    class TerrainQueryCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TerrainQueryCache, AZ::SystemAllocator);
+
+        //! Integer coordinates of a point on a query grid, the world position of the point is the coordinates times the resolution.
+        //! Left uninitialized so that batches of grid points can be kept on the stack without being cleared first.
+        struct GridPoint
+        {
+            int32_t m_x;
+            int32_t m_y;
+        };
+
+        //! Computes the exact heights at the positions, used to fill the height tiles.
+        using HeightsFillFunction =
+            AZStd::function<void(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> heights, AZStd::span<bool> terrainExists)>;
+        //! Computes the exact, ordered surface weights at the positions, used to fill the surface tiles.
+        using SurfaceWeightsFillFunction = AZStd::function<void(
+            AZStd::span<const AZ::Vector3> positions, AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights)>;
+
+        TerrainQueryCache(HeightsFillFunction heightsFillFunction, SurfaceWeightsFillFunction surfaceWeightsFillFunction);
+        ~TerrainQueryCache();
+
+        //! Drops all the cached data and sets the grids and height range used for new tiles.
+        void Reset(float heightQueryResolution, float surfaceDataQueryResolution, const AzFramework::Terrain::FloatRange& heightRange);
+        //! Drops the cached data of the tiles overlapping the region.
+        void Invalidate(const AZ::Aabb& region, bool heights, bool surfaceData);
+        //! Waits for the tiles currently being filled on background jobs.
+        void WaitForPendingFills();
+
+        //! Gets the cached heights at the points of the height query grid.
+        //! Returns false when any of the points isn't cached yet, in which case the missing tiles are queued to be filled.
+        bool GetHeights(AZStd::span<const GridPoint> points, AZStd::span<float> heights, AZStd::span<bool> terrainExists);
+        //! Gets the cached surface weights at the points of the surface data query grid, ordered by decreasing weight.
+        //! Returns false when any of the points isn't cached yet or has too many surfaces to be cached.
+        bool GetSurfaceWeights(
+            AZStd::span<const GridPoint> points, AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights);
+
+        static constexpr int32_t TileSizeLog2 = 6;
+        static constexpr int32_t TileSize = 1 << TileSizeLog2;
+        static constexpr int32_t TilePointCount = TileSize * TileSize;
+        //! Maximum number of surfaces cached per point, points with more surfaces always go through the terrain areas.
+        static constexpr size_t MaxCachedSurfacesPerPoint = 4;
+
+    private:
+        using TileKey = AZ::u64;
+
+        static constexpr AZ::u16 NoTerrainHeight = 0xFFFF;
+        static constexpr AZ::u16 MaxQuantizedHeight = 0xFFFE;
+        static constexpr AZ::u8 UncachedSurfaceCount = 0xFF;
+        static constexpr size_t MaxPaletteSize = 0xFF;
+
+        struct TileBase
+        {
+            //! Use tick of the last query that read the tile, the least recently used tiles are evicted when a layer is full.
+            mutable AZStd::atomic<AZ::u32> m_lastUseTick{ 0 };
+        };
+
+        struct HeightTile
+            : public TileBase
+        {
+            AZStd::array<AZ::u16, TilePointCount> m_heights;
+        };
+
+        struct SurfaceTile
+            : public TileBase
+        {
+            struct Entry
+            {
+                AZ::u8 m_paletteIndex;
+                AZ::u8 m_weight;
+            };
+
+            //! Surface types used in the tile, the entries refer to them by index.
+            AZStd::fixed_vector<AZ::Crc32, MaxPaletteSize> m_palette;
+            AZStd::array<AZ::u8, TilePointCount> m_counts;
+            AZStd::array<AZStd::array<Entry, MaxCachedSurfacesPerPoint>, TilePointCount> m_entries;
+        };
+
+        template<typename TileType>
+        struct TileLayer
+        {
+            AZStd::unordered_map<TileKey, AZStd::unique_ptr<TileType>> m_tiles;
+            AZStd::unordered_set<TileKey> m_pendingFills;
+            float m_queryResolution = 1.0f;
+        };
+
+        static TileKey GetTileKey(int32_t tileX, int32_t tileY);
+        static void GetTileCoordinates(TileKey key, int32_t& tileX, int32_t& tileY);
+        static size_t GetPointIndex(const GridPoint& point);
+        static bool TileOverlapsRegion(TileKey key, float queryResolution, const AZ::Aabb& region);
+
+        template<typename TileType>
+        void InvalidateLayer(TileLayer<TileType>& layer, const AZ::Aabb& region);
+        template<typename TileType>
+        void AddTile(TileLayer<TileType>& layer, TileKey key, AZStd::unique_ptr<TileType> tile);
+        template<typename TileType>
+        void QueueFills(
+            TileLayer<TileType>& layer, AZStd::span<const TileKey> missingTiles, void (TerrainQueryCache::*fillTile)(TileKey, AZ::u32));
+
+        void FillHeightTile(TileKey key, AZ::u32 generation);
+        void FillSurfaceTile(TileKey key, AZ::u32 generation);
+        void GenerateTilePositions(TileKey key, float queryResolution, AZStd::vector<AZ::Vector3>& positions) const;
+        void OnFillCompleted();
+
+        HeightsFillFunction m_heightsFillFunction;
+        SurfaceWeightsFillFunction m_surfaceWeightsFillFunction;
+
+        AZStd::shared_mutex m_tileMutex;
+        TileLayer<HeightTile> m_heightLayer;
+        TileLayer<SurfaceTile> m_surfaceLayer;
+        AzFramework::Terrain::FloatRange m_heightRange = AzFramework::Terrain::FloatRange::CreateNull();
+
+        //! Incremented on every invalidation, so fills that were computed from data changed since are discarded.
+        AZStd::atomic<AZ::u32> m_generation{ 0 };
+        //! Incremented on every query, to order the tiles by their last use.
+        AZStd::atomic<AZ::u32> m_useTick{ 0 };
+
+        AZStd::mutex m_pendingFillMutex;
+        AZStd::condition_variable m_pendingFillCondition;
+        size_t m_pendingFillJobCount = 0;
+    };
+} // namespace Terrain
@@ -7,6 +7,8 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -25,6 +27,15 @@ using namespace Terrain;
 
 AZ_DEFINE_BUDGET(Terrain);
 
+AZ_CVAR(
+    bool,
+    terrain_queryCache,
+    false,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Serve CLAMP and BILINEAR height and surface data queries from a quantized cache of the terrain query grids.\n"
+    "The cache is filled in the background as queries touch new tiles, queries fall back to the terrain areas until then.");
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/key lookup.
@@ -69,6 +80,18 @@ TerrainSystem::TerrainSystem()
     // Use the global JobManager for terrain jobs (we could create our own dedicated terrain JobManager if needed).
     AZ::JobManagerBus::BroadcastResult(m_terrainJobManager, &AZ::JobManagerEvents::GetManager);
     AZ_Assert(m_terrainJobManager, "No global JobManager found.");
+
+    // The query cache tiles are filled with the exact values at the grid points, which the CLAMP and BILINEAR samplers build on.
+    m_queryCache = AZStd::make_unique<TerrainQueryCache>(
+        [this](AZStd::span<const AZ::Vector3> positions, AZStd::span<float> heights, AZStd::span<bool> terrainExists)
+        {
+            GetHeightsSynchronous(positions, Sampler::EXACT, heights, terrainExists);
+        },
+        [this](AZStd::span<const AZ::Vector3> positions, AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights)
+        {
+            AZStd::vector<bool> terrainExistsEmpty;
+            GetOrderedSurfaceWeightsFromList(positions, Sampler::EXACT, surfaceWeights, terrainExistsEmpty);
+        });
 }
 
 TerrainSystem::~TerrainSystem()
@@ -123,6 +146,9 @@ void TerrainSystem::Deactivate()
         m_activeTerrainJobContextMutexConditionVariable.wait(lock, [this]{ return m_activeTerrainJobContexts.empty(); });
     }
 
+    // The query cache fills query the terrain areas, so let them finish before the areas go away.
+    m_queryCache->WaitForPendingFills();
+
     // Stop listening to the bus even before we signal DestroyBegin so that way any calls to the terrain system as a *result* of
     // calling DestroyBegin will fail to reach the terrain system.
     AzFramework::Terrain::TerrainDataRequestBus::Handler::BusDisconnect();
@@ -135,6 +161,9 @@ void TerrainSystem::Deactivate()
         m_registeredAreas.clear();
     }
 
+    m_queryCache->Reset(
+        m_currentSettings.m_heightQueryResolution, m_currentSettings.m_surfaceDataQueryResolution, m_currentSettings.m_heightRange);
+
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = false;
@@ -433,6 +462,11 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
 
+    if (GetHeightsFromQueryCache(inPositions, sampler, heights, terrainExists))
+    {
+        return;
+    }
+
     AZStd::vector<AZ::Vector3> outPositions;
     AZStd::vector<bool> outTerrainExists;
 
@@ -520,6 +554,133 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
     }
 }
 
+bool TerrainSystem::GetHeightsFromQueryCache(const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler,
+    AZStd::span<float> heights, AZStd::span<bool> terrainExists) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    if (!terrain_queryCache || ((sampler != Sampler::CLAMP) && (sampler != Sampler::BILINEAR)))
+    {
+        return false;
+    }
+
+    using GridPoint = TerrainQueryCache::GridPoint;
+    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+
+    // The positions are processed in batches so that the grid points and the cached heights can stay on the stack.
+    // For the bilinear sampler, the 4 corners are stored in separate planes of the batch so that they can be loaded 4 positions at a time.
+    constexpr size_t BatchSize = 64;
+    constexpr size_t CornerCount = 4;
+    GridPoint gridPoints[BatchSize * CornerCount];
+    float cornerHeights[BatchSize * CornerCount];
+    bool cornerExists[BatchSize * CornerCount];
+    float lerpX[BatchSize];
+    float lerpY[BatchSize];
+
+    for (size_t batchStart = 0; batchStart < inPositions.size(); batchStart += BatchSize)
+    {
+        const size_t batchCount = AZStd::min(BatchSize, inPositions.size() - batchStart);
+
+        if (sampler == Sampler::CLAMP)
+        {
+            for (size_t i = 0; i < batchCount; i++)
+            {
+                // Round to the nearest grid point the same way RoundPosition does.
+                const AZ::Vector2 normalizedPosition = AZ::Vector2(inPositions[batchStart + i]) / queryResolution;
+                const AZ::Vector2 gridPosition = (normalizedPosition + AZ::Vector2(0.5f)).GetFloor();
+                gridPoints[i] = { aznumeric_cast<int32_t>(gridPosition.GetX()), aznumeric_cast<int32_t>(gridPosition.GetY()) };
+            }
+
+            if (!m_queryCache->GetHeights(
+                    AZStd::span<const GridPoint>(gridPoints, batchCount),
+                    heights.subspan(batchStart, batchCount),
+                    terrainExists.subspan(batchStart, batchCount)))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        for (size_t i = 0; i < batchCount; i++)
+        {
+            // Find the lower corner of the grid square and the fractional position within it the same way ClampPosition does.
+            const AZ::Vector2 normalizedPosition = AZ::Vector2(inPositions[batchStart + i]) / queryResolution;
+            const AZ::Vector2 gridPosition = normalizedPosition.GetFloor();
+            lerpX[i] = normalizedPosition.GetX() - gridPosition.GetX();
+            lerpY[i] = normalizedPosition.GetY() - gridPosition.GetY();
+
+            const int32_t x0 = aznumeric_cast<int32_t>(gridPosition.GetX());
+            const int32_t y0 = aznumeric_cast<int32_t>(gridPosition.GetY());
+            gridPoints[i] = { x0, y0 };
+            gridPoints[batchCount + i] = { x0 + 1, y0 };
+            gridPoints[(batchCount * 2) + i] = { x0, y0 + 1 };
+            gridPoints[(batchCount * 3) + i] = { x0 + 1, y0 + 1 };
+        }
+
+        const size_t cornerPointCount = batchCount * CornerCount;
+        if (!m_queryCache->GetHeights(
+                AZStd::span<const GridPoint>(gridPoints, cornerPointCount),
+                AZStd::span<float>(cornerHeights, cornerPointCount),
+                AZStd::span<bool>(cornerExists, cornerPointCount)))
+        {
+            return false;
+        }
+
+        const float* heightsX0Y0 = cornerHeights;
+        const float* heightsX1Y0 = cornerHeights + batchCount;
+        const float* heightsX0Y1 = cornerHeights + (batchCount * 2);
+        const float* heightsX1Y1 = cornerHeights + (batchCount * 3);
+
+        for (size_t i = 0; i < batchCount; i += 4)
+        {
+            // Groups of 4 positions whose corners all exist are interpolated together, the others go through InterpolateHeights
+            // to get the same handling of missing corners as the uncached queries.
+            bool allCornersExist = (i + 4) <= batchCount;
+            for (size_t corner = 0; allCornersExist && (corner < CornerCount); corner++)
+            {
+                const bool* exists = cornerExists + (batchCount * corner) + i;
+                allCornersExist = exists[0] && exists[1] && exists[2] && exists[3];
+            }
+
+            if (allCornersExist)
+            {
+                using AZ::Simd::Vec4;
+                const Vec4::FloatType x0y0 = Vec4::LoadUnaligned(heightsX0Y0 + i);
+                const Vec4::FloatType x1y0 = Vec4::LoadUnaligned(heightsX1Y0 + i);
+                const Vec4::FloatType x0y1 = Vec4::LoadUnaligned(heightsX0Y1 + i);
+                const Vec4::FloatType x1y1 = Vec4::LoadUnaligned(heightsX1Y1 + i);
+                const Vec4::FloatType deltaX = Vec4::LoadUnaligned(lerpX + i);
+                const Vec4::FloatType deltaY = Vec4::LoadUnaligned(lerpY + i);
+
+                const Vec4::FloatType heightXY0 = Vec4::Madd(Vec4::Sub(x1y0, x0y0), deltaX, x0y0);
+                const Vec4::FloatType heightXY1 = Vec4::Madd(Vec4::Sub(x1y1, x0y1), deltaX, x0y1);
+                Vec4::StoreUnaligned(heights.data() + batchStart + i, Vec4::Madd(Vec4::Sub(heightXY1, heightXY0), deltaY, heightXY0));
+
+                for (size_t lane = 0; lane < 4; lane++)
+                {
+                    terrainExists[batchStart + i + lane] = true;
+                }
+                continue;
+            }
+
+            for (size_t lane = i; lane < AZStd::min(i + 4, batchCount); lane++)
+            {
+                const AZStd::array<float, 4> queriedHeights = {
+                    heightsX0Y0[lane], heightsX1Y0[lane], heightsX0Y1[lane], heightsX1Y1[lane] };
+                const AZStd::array<bool, 4> queriedExistsFlags = { cornerExists[lane],
+                    cornerExists[batchCount + lane],
+                    cornerExists[(batchCount * 2) + lane],
+                    cornerExists[(batchCount * 3) + lane] };
+
+                InterpolateHeights(queriedHeights, queriedExistsFlags, lerpX[lane], lerpY[lane],
+                    heights[batchStart + lane], terrainExists[batchStart + lane]);
+            }
+        }
+    }
+
+    return true;
+}
+
 float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const
 {
     bool terrainExists = false;
@@ -529,6 +690,17 @@ float TerrainSystem::GetHeightSynchronous(float x, float y, Sampler sampler, boo
     float height = m_currentSettings.m_heightRange.m_min;
     const float queryResolution = m_currentSettings.m_heightQueryResolution;
 
+    const AZ::Vector3 position(x, y, 0.0f);
+    if (GetHeightsFromQueryCache(
+            AZStd::span<const AZ::Vector3>(&position, 1), sampler, AZStd::span<float>(&height, 1), AZStd::span<bool>(&terrainExists, 1)))
+    {
+        if (terrainExistsPtr)
+        {
+            *terrainExistsPtr = terrainExists;
+        }
+        return height;
+    }
+
     switch (sampler)
     {
     // Get the value at the requested location, using the terrain grid to bilinear filter between sample grid points.
@@ -1275,6 +1447,11 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
         GetHeightsSynchronous(inPositions, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, heights, terrainExists);
     }
 
+    if (GetSurfaceWeightsFromQueryCache(inPositions, sampler, outSurfaceWeightsList))
+    {
+        return;
+    }
+
     // queryPositions contains the modified positions based on our sampler type. For surface queries, we don't currently perform bilinear
     // interpolation of any results, so our query position size will always match our input size.
     AZStd::vector<AZ::Vector3> queryPositions;
@@ -1308,6 +1485,46 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
     MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
 }
 
+bool TerrainSystem::GetSurfaceWeightsFromQueryCache(
+    const AZStd::span<const AZ::Vector3>& inPositions,
+    Sampler sampler,
+    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    // Surface data isn't interpolated, both the CLAMP and BILINEAR samplers use the nearest point of the surface data query grid.
+    if (!terrain_queryCache || (sampler == Sampler::EXACT))
+    {
+        return false;
+    }
+
+    using GridPoint = TerrainQueryCache::GridPoint;
+    const float queryResolution = m_currentSettings.m_surfaceDataQueryResolution;
+
+    constexpr size_t BatchSize = 256;
+    GridPoint gridPoints[BatchSize];
+
+    for (size_t batchStart = 0; batchStart < inPositions.size(); batchStart += BatchSize)
+    {
+        const size_t batchCount = AZStd::min(BatchSize, inPositions.size() - batchStart);
+        for (size_t i = 0; i < batchCount; i++)
+        {
+            // Round to the nearest grid point the same way RoundPosition does.
+            const AZ::Vector2 normalizedPosition = AZ::Vector2(inPositions[batchStart + i]) / queryResolution;
+            const AZ::Vector2 gridPosition = (normalizedPosition + AZ::Vector2(0.5f)).GetFloor();
+            gridPoints[i] = { aznumeric_cast<int32_t>(gridPosition.GetX()), aznumeric_cast<int32_t>(gridPosition.GetY()) };
+        }
+
+        if (!m_queryCache->GetSurfaceWeights(
+                AZStd::span<const GridPoint>(gridPoints, batchCount), outSurfaceWeightsList.subspan(batchStart, batchCount)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void TerrainSystem::GetOrderedSurfaceWeights(
     const float x,
     const float y,
@@ -1322,6 +1539,14 @@ void TerrainSystem::GetOrderedSurfaceWeights(
         GetHeightFromFloats(x, y, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, terrainExistsPtr);
     }
 
+    const AZ::Vector3 position(x, y, 0.0f);
+    if (GetSurfaceWeightsFromQueryCache(
+            AZStd::span<const AZ::Vector3>(&position, 1), sampler,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList>(&outSurfaceWeights, 1)))
+    {
+        return;
+    }
+
     outSurfaceWeights.clear();
 
     const float queryResolution = m_currentSettings.m_surfaceDataQueryResolution;
@@ -1686,6 +1911,7 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
 
     m_registeredAreas[areaId] = { aabb, useGroundPlane };
     m_dirtyRegion.AddAabb(aabb);
+    m_queryCache->Invalidate(aabb, true, true);
     m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
     m_cachedAreaBounds.AddAabb(aabb);
@@ -1706,6 +1932,7 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             if (areaId == entityId)
             {
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
+                m_queryCache->Invalidate(areaData.m_areaBounds, true, true);
                 m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
                     AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
 
@@ -1763,6 +1990,12 @@ void TerrainSystem::RefreshRegion(
 
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
     m_terrainDirtyMask |= changeMask;
+
+    using TerrainDataChangedMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask;
+    m_queryCache->Invalidate(
+        dirtyRegion,
+        (changeMask & TerrainDataChangedMask::HeightData) != TerrainDataChangedMask::None,
+        (changeMask & TerrainDataChangedMask::SurfaceData) != TerrainDataChangedMask::None);
 }
 
 void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
@@ -1804,6 +2037,8 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+        m_queryCache->Reset(
+            m_currentSettings.m_heightQueryResolution, m_currentSettings.m_surfaceDataQueryResolution, m_currentSettings.m_heightRange);
     }
 
     if (terrainSettingsChanged || (m_terrainDirtyMask != AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::None))
@@ -25,6 +25,7 @@
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
+#include <TerrainSystem/TerrainQueryCache.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 AZ_DECLARE_BUDGET(Terrain);
@@ -266,6 +267,18 @@ namespace Terrain
             const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler,
             AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList,
             AZStd::span<bool> terrainExists) const;
+
+        //! Gets the heights from the query cache for the CLAMP and BILINEAR samplers.
+        //! Returns false when the cache is disabled or can't serve all the positions, the outputs are then left in an undefined state.
+        bool GetHeightsFromQueryCache(
+            const AZStd::span<const AZ::Vector3>& inPositions,
+            Sampler sampler, AZStd::span<float> heights,
+            AZStd::span<bool> terrainExists) const;
+        //! Gets the ordered surface weights from the query cache for the CLAMP and BILINEAR samplers.
+        //! Returns false when the cache is disabled or can't serve all the positions, the outputs are then left in an undefined state.
+        bool GetSurfaceWeightsFromQueryCache(
+            const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const;
         void MakeBulkQueries(
             const AZStd::span<const AZ::Vector3> inPositions,
             AZStd::span<AZ::Vector3> outPositions,
@@ -318,6 +331,9 @@ namespace Terrain
         mutable AZStd::mutex m_activeTerrainJobContextMutex;
         mutable AZStd::condition_variable m_activeTerrainJobContextMutexConditionVariable;
         mutable AZStd::deque<AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext>> m_activeTerrainJobContexts;
+
+        // Declared last so that it's destroyed first, its background fills query the terrain system.
+        AZStd::unique_ptr<TerrainQueryCache> m_queryCache;
     };
 
     template<typename VectorType>
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/parallel/atomic.h>
+
+#include <AzTest/AzTest.h>
+
+#include <TerrainSystem/TerrainQueryCache.h>
+#include <TerrainTestFixtures.h>
+
+namespace UnitTest::TerrainTest
+{
+    class TerrainQueryCacheTest
+        : public TerrainTestFixture
+    {
+    protected:
+        static constexpr float QueryResolution = 0.5f;
+        static constexpr float MinHeight = -100.0f;
+        static constexpr float MaxHeight = 100.0f;
+
+        // The height of the test terrain is X + Y, with no terrain at negative X.
+        static float GetExpectedHeight(float x, float y)
+        {
+            return x + y;
+        }
+
+        static bool GetExpectedExists(float x)
+        {
+            return x >= 0.0f;
+        }
+
+        AZStd::unique_ptr<Terrain::TerrainQueryCache> CreateCache()
+        {
+            auto cache = AZStd::make_unique<Terrain::TerrainQueryCache>(
+                [this](AZStd::span<const AZ::Vector3> positions, AZStd::span<float> heights, AZStd::span<bool> terrainExists)
+                {
+                    ++m_heightFillCount;
+                    for (size_t i = 0; i < positions.size(); i++)
+                    {
+                        heights[i] = GetExpectedHeight(positions[i].GetX(), positions[i].GetY());
+                        terrainExists[i] = GetExpectedExists(positions[i].GetX());
+                    }
+                },
+                [this](
+                    AZStd::span<const AZ::Vector3> positions, AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights)
+                {
+                    ++m_surfaceFillCount;
+                    for (size_t i = 0; i < positions.size(); i++)
+                    {
+                        // Points at positive Y have more surfaces than the cache holds.
+                        const size_t surfaceCount =
+                            (positions[i].GetY() > 0.0f) ? Terrain::TerrainQueryCache::MaxCachedSurfacesPerPoint + 1 : 2;
+                        for (size_t surface = 0; surface < surfaceCount; surface++)
+                        {
+                            surfaceWeights[i].emplace_back(
+                                AZ::Crc32(static_cast<AZ::u32>(surface + 1)), 1.0f - (static_cast<float>(surface) * 0.1f));
+                        }
+                    }
+                });
+            cache->Reset(QueryResolution, QueryResolution, { MinHeight, MaxHeight });
+            return cache;
+        }
+
+        AZStd::atomic_int m_heightFillCount{ 0 };
+        AZStd::atomic_int m_surfaceFillCount{ 0 };
+    };
+
+    TEST_F(TerrainQueryCacheTest, HeightsAreCachedAfterTheFillCompletes)
+    {
+        auto cache = CreateCache();
+
+        const Terrain::TerrainQueryCache::GridPoint points[] = { { 0, 0 }, { 3, 5 }, { 63, 63 }, { 64, 10 }, { -1, 7 } };
+        constexpr size_t pointCount = AZStd::size(points);
+        float heights[pointCount];
+        bool terrainExists[pointCount];
+
+        // The first query misses and queues the fills of the tiles it touched.
+        EXPECT_FALSE(cache->GetHeights(points, heights, terrainExists));
+        cache->WaitForPendingFills();
+        EXPECT_EQ(m_heightFillCount, 3);
+
+        EXPECT_TRUE(cache->GetHeights(points, heights, terrainExists));
+        const float quantizationTolerance = (MaxHeight - MinHeight) / 65534.0f;
+        for (size_t i = 0; i < pointCount; i++)
+        {
+            const float x = points[i].m_x * QueryResolution;
+            const float y = points[i].m_y * QueryResolution;
+            EXPECT_EQ(terrainExists[i], GetExpectedExists(x));
+            if (terrainExists[i])
+            {
+                EXPECT_NEAR(heights[i], GetExpectedHeight(x, y), quantizationTolerance);
+            }
+        }
+
+        // Cached queries don't fill again.
+        EXPECT_TRUE(cache->GetHeights(points, heights, terrainExists));
+        EXPECT_EQ(m_heightFillCount, 3);
+    }
+
+    TEST_F(TerrainQueryCacheTest, InvalidatedTilesAreFilledAgain)
+    {
+        auto cache = CreateCache();
+
+        const Terrain::TerrainQueryCache::GridPoint points[] = { { 1, 1 }, { 65, 1 } };
+        float heights[2];
+        bool terrainExists[2];
+
+        EXPECT_FALSE(cache->GetHeights(points, heights, terrainExists));
+        cache->WaitForPendingFills();
+        EXPECT_TRUE(cache->GetHeights(points, heights, terrainExists));
+
+        // Only the tile overlapping the dirty region is dropped.
+        cache->Invalidate(AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f), true, false);
+        EXPECT_TRUE(cache->GetHeights(
+            AZStd::span<const Terrain::TerrainQueryCache::GridPoint>(points + 1, 1),
+            AZStd::span<float>(heights + 1, 1),
+            AZStd::span<bool>(terrainExists + 1, 1)));
+        EXPECT_FALSE(cache->GetHeights(points, heights, terrainExists));
+        cache->WaitForPendingFills();
+        EXPECT_TRUE(cache->GetHeights(points, heights, terrainExists));
+        EXPECT_EQ(m_heightFillCount, 3);
+    }
+
+    TEST_F(TerrainQueryCacheTest, SurfaceWeightsAreCachedInOrderUnlessTheyDoNotFit)
+    {
+        auto cache = CreateCache();
+
+        const Terrain::TerrainQueryCache::GridPoint cacheablePoints[] = { { 0, 0 }, { 10, -10 } };
+        AzFramework::SurfaceData::SurfaceTagWeightList surfaceWeights[2];
+
+        EXPECT_FALSE(cache->GetSurfaceWeights(cacheablePoints, surfaceWeights));
+        cache->WaitForPendingFills();
+        EXPECT_TRUE(cache->GetSurfaceWeights(cacheablePoints, surfaceWeights));
+        for (const auto& pointSurfaceWeights : surfaceWeights)
+        {
+            ASSERT_EQ(pointSurfaceWeights.size(), 2);
+            EXPECT_EQ(pointSurfaceWeights[0].m_surfaceType, AZ::Crc32(static_cast<AZ::u32>(1)));
+            EXPECT_NEAR(pointSurfaceWeights[0].m_weight, 1.0f, 1.0f / 255.0f);
+            EXPECT_EQ(pointSurfaceWeights[1].m_surfaceType, AZ::Crc32(static_cast<AZ::u32>(2)));
+            EXPECT_NEAR(pointSurfaceWeights[1].m_weight, 0.9f, 1.0f / 255.0f);
+        }
+
+        // A point with more surfaces than the cache holds is never served from the cache.
+        const Terrain::TerrainQueryCache::GridPoint uncacheablePoints[] = { { 0, 0 }, { 0, 1 } };
+        EXPECT_FALSE(cache->GetSurfaceWeights(uncacheablePoints, surfaceWeights));
+        cache->WaitForPendingFills();
+        EXPECT_FALSE(cache->GetSurfaceWeights(uncacheablePoints, surfaceWeights));
+    }
+} // namespace UnitTest::TerrainTest
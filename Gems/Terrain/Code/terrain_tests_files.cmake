@@ -15,6 +15,7 @@ set(FILES
     Tests/TerrainMacroMaterialTests.cpp
     Tests/SurfaceMaterialsListTest.cpp
     Tests/TerrainPhysicsColliderTests.cpp
+    Tests/TerrainQueryCacheTests.cpp
     Tests/TerrainSurfaceGradientListTests.cpp
     Tests/TerrainSystemBenchmarks.cpp
     Tests/TerrainSystemTest.cpp
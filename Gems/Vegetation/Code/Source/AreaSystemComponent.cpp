@@ -27,6 +27,10 @@
 #include <AzCore/std/sort.h>
 #include <AzCore/std/utils.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 
 
 #include <AzFramework/Components/CameraBus.h>
@@ -37,6 +41,14 @@
 #include <ISystem.h>
 #include <cinttypes>
 
+AZ_CVAR(
+    AZ::u32,
+    veg_sectorBatchSize,
+    0,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of vegetation sectors that gather their surface points in parallel. 0 uses the number of job worker threads.");
+
 namespace Vegetation
 {
     namespace AreaSystemUtil
@@ -1082,8 +1094,16 @@ namespace Vegetation
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
         UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
 
+        return AddSector(AZStd::move(sectorInfo));
+    }
+
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::AddSector(SectorInfo&& sectorInfo)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
-        SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
+        const SectorId sectorId = sectorInfo.m_id;
+        SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorId] = AZStd::move(sectorInfo);
         UpdateSectorCallbacks(sectorInfoRef);
         return &sectorInfoRef;
     }
@@ -1779,52 +1799,134 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
-            auto& updateEntry = m_updateWorkList.back();
-            SectorId sectorId = updateEntry.first;
-            UpdateMode mode = updateEntry.second;
+            // Sectors that need new surface points are updated in batches, so that their surface points get gathered in parallel.
+            if (m_updateWorkList.back().second != UpdateMode::Fill)
+            {
+                UpdateSectorBatch(threadData, vegTasks);
+                return true;
+            }
+
+            SectorId sectorId = m_updateWorkList.back().first;
             m_updateWorkList.pop_back();
 
             {
                 AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
-                auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
-                auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
-                auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+                auto sectorInfo = vegTasks->GetSector(sectorId);
+                AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
+                vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+            }
 
-                switch (mode)
-                {
-                    case UpdateMode::RebuildSurfaceCacheAndFill:
-                    {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+            return true;
+        }
 
-                    case UpdateMode::Fill:
-                    {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+        // No sectors left to process, so tell our main loop to stop processing.
+        return false;
+    }
 
-                    case UpdateMode::Create:
-                    {
-                        AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
+    void AreaSystemComponent::UpdateContext::UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const int sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+        const int sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+        const SnapMode sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+
+        // The batch never exceeds the number of job worker threads. This thread blocks on the batch's jobs, so with a single
+        // worker thread there would be no other thread left to run them.
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const size_t workerThreadCount = jobContext ? AZStd::max<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), 1) : 1;
+        const size_t maxBatchSize =
+            (veg_sectorBatchSize > 0) ? AZStd::min<size_t>(veg_sectorBatchSize, workerThreadCount) : workerThreadCount;
+
+        size_t activeSectorCount = 0;
+        {
+            AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+            activeSectorCount = vegTasks->m_sectorRollingWindow.size();
+        }
+
+        // Pull the sectors that need new surface points off the end of the work list, stopping at the first one that only needs
+        // a fill so that sectors still get processed in work list order. After the first sector, new sectors are only added to
+        // the batch while the view rectangle is missing sectors, so that a batch doesn't outpace the load balancing of deletes.
+        m_sectorBatch.clear();
+        while (!m_updateWorkList.empty() && (m_sectorBatch.size() < maxBatchSize))
+        {
+            const SectorId sectorId = m_updateWorkList.back().first;
+            const UpdateMode mode = m_updateWorkList.back().second;
+
+            if (mode == UpdateMode::Fill)
+            {
+                break;
+            }
+
+            if (mode == UpdateMode::Create)
+            {
+                if (!m_sectorBatch.empty() && (activeSectorCount >= m_viewRectSectorCount))
+                {
                     break;
                 }
+                ++activeSectorCount;
             }
 
-            return true;
+            SectorBatchEntry& entry = m_sectorBatch.emplace_back();
+            entry.m_sectorInfo.m_id = sectorId;
+            entry.m_sectorInfo.m_bounds = VegetationThreadTasks::GetSectorBounds(sectorId, sectorSizeInMeters);
+            entry.m_mode = mode;
+            m_updateWorkList.pop_back();
         }
 
-        // No sectors left to process, so tell our main loop to stop processing.
-        return false;
-    }
+        // Gathering the surface points is the expensive part of a sector update, and it only reads surface data, so each sector's
+        // points are gathered on its own job into a separate SectorInfo. This thread gathers the first sector's points itself.
+        {
+            AZ_PROFILE_SCOPE(Entity, "Vegetation::AreaSystemComponent::UpdateContext::UpdateSectorBatch-SurfacePoints");
+
+            if (m_sectorBatch.size() == 1)
+            {
+                vegTasks->UpdateSectorPoints(m_sectorBatch[0].m_sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+            }
+            else
+            {
+                AZ::JobCompletion jobCompletion(jobContext);
+                for (size_t index = 1; index < m_sectorBatch.size(); index++)
+                {
+                    SectorInfo* sectorInfo = &m_sectorBatch[index].m_sectorInfo;
+                    AZ::Job* job = AZ::CreateJobFunction(
+                        [vegTasks, sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+                        {
+                            vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        },
+                        true, jobContext);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
 
+                vegTasks->UpdateSectorPoints(m_sectorBatch[0].m_sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                jobCompletion.StartAndWaitForCompletion();
+            }
+        }
+
+        // Merge the batch back in and fill the sectors one at a time, in work list order. Areas track their claims in state shared
+        // between sectors, and blockers and distance filters look at the instances of neighboring sectors, so each fill needs to
+        // see the results of the previous ones.
+        AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+        for (auto& entry : m_sectorBatch)
+        {
+            SectorInfo* sectorInfo = nullptr;
+            if (entry.m_mode == UpdateMode::Create)
+            {
+                AZ_Assert(!vegTasks->GetSector(entry.m_sectorInfo.m_id), "Sector update mode is 'Create' but sector already exists");
+                sectorInfo = vegTasks->AddSector(AZStd::move(entry.m_sectorInfo));
+            }
+            else
+            {
+                sectorInfo = vegTasks->GetSector(entry.m_sectorInfo.m_id);
+                AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
+                sectorInfo->m_baseContext.m_availablePoints = AZStd::move(entry.m_sectorInfo.m_baseContext.m_availablePoints);
+                sectorInfo->m_baseContext.m_masks = AZStd::move(entry.m_sectorInfo.m_baseContext.m_masks);
+            }
+
+            vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+        }
+        m_sectorBatch.clear();
+    }
 }
@@ -292,6 +292,8 @@ namespace Vegetation
             SectorInfo* GetSector(const SectorId& sectorId);
 
             SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Adds a sector whose surface points have already been gathered to the rolling window.
+            SectorInfo* AddSector(SectorInfo&& sectorInfo);
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
             void DeleteSector(const SectorId& sectorId);
@@ -430,6 +432,7 @@ namespace Vegetation
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
             bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            void UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
 
             enum class UpdateMode
             {
@@ -438,6 +441,16 @@ namespace Vegetation
                 Fill
             };
 
+            // A sector pulled off the update work list to have its surface points gathered on a job thread.
+            struct SectorBatchEntry
+            {
+                SectorInfo m_sectorInfo;
+                UpdateMode m_mode = UpdateMode::Create;
+            };
+
+            // The sectors currently being updated by UpdateSectorBatch(), kept as a member to avoid reallocating it every batch.
+            AZStd::vector<SectorBatchEntry> m_sectorBatch;
+
             // The sorted work list of sectors to delete.  The list is recreated every time UpdateSectorWorkLists() is run.
             AZStd::vector<SectorId> m_deleteWorkList;
 
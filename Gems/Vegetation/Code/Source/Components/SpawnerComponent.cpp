@@ -351,7 +351,31 @@ namespace Vegetation
         return true;
     }
 
-    bool SpawnerComponent::ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData)
+    void SpawnerComponent::TestPointsInsideShapes(
+        const EntityIdStack& processedIds, const ClaimContext& context, AZStd::vector<bool>& insideShapes) const
+    {
+        AZ_PROFILE_FUNCTION(Vegetation);
+
+        // Test the whole batch of points against one shape at a time, so each shape handler is only looked up once per claim
+        // instead of once per point.
+        insideShapes.assign(context.m_availablePoints.size(), true);
+        for (const auto& id : processedIds)
+        {
+            LmbrCentral::ShapeComponentRequestsBus::EnumerateHandlersId(id, [&context, &insideShapes](LmbrCentral::ShapeComponentRequests* shape)
+            {
+                for (size_t pointIndex = 0; pointIndex < insideShapes.size(); ++pointIndex)
+                {
+                    if (insideShapes[pointIndex] && !shape->IsPointInside(context.m_availablePoints[pointIndex].m_position))
+                    {
+                        insideShapes[pointIndex] = false;
+                    }
+                }
+                return true;
+            });
+        }
+    }
+
+    bool SpawnerComponent::ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, bool insideShapes, InstanceData& instanceData)
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
@@ -375,16 +399,11 @@ namespace Vegetation
         }
 #endif
 
-        // test shape bus as first pass to claim the point
-        for (const auto& id : processedIds)
+        // the shape test is the first pass to claim the point, it has already been run for the whole batch of points
+        if (!insideShapes)
         {
-            bool accepted = true;
-            LmbrCentral::ShapeComponentRequestsBus::EventResult(accepted, id, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
-            if (!accepted)
-            {
-                VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FilterInstance, instanceData.m_id, AZStd::string_view("ShapeFilter")));
-                return false;
-            }
+            VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FilterInstance, instanceData.m_id, AZStd::string_view("ShapeFilter")));
+            return false;
         }
 
         //generate uvw sample coordinates
@@ -433,13 +452,16 @@ namespace Vegetation
         instanceData.m_id = GetEntityId();
         instanceData.m_changeIndex = GetChangeIndex();
 
+        AZStd::vector<bool> insideShapes;
+        TestPointsInsideShapes(processedIds, context, insideShapes);
+
         size_t numAvailablePoints = context.m_availablePoints.size();
         for (size_t pointIndex = 0; pointIndex < numAvailablePoints; )
         {
             ClaimPoint& point = context.m_availablePoints[pointIndex];
 
             bool accepted = false;
-            if (ClaimPosition(processedIds, point, instanceData))
+            if (ClaimPosition(processedIds, point, insideShapes[pointIndex], instanceData))
             {
                 // Check if an identical instance already exists for reuse
                 if (context.m_existedCallback(point, instanceData))
@@ -464,8 +486,9 @@ namespace Vegetation
 
             if (accepted)
             {
-                //Swap an available point from the end of the list
+                //Swap an available point from the end of the list, along with its shape test result
                 AZStd::swap(point, context.m_availablePoints.at(numAvailablePoints - 1));
+                insideShapes[pointIndex] = insideShapes[numAvailablePoints - 1];
                 --numAvailablePoints;
 
 #if VEG_SPAWNER_ENABLE_CACHING
@@ -554,11 +577,13 @@ namespace Vegetation
             AZStd::swap(claimInstanceMapping, m_claimInstanceMapping);
         }
 
+        AZStd::vector<InstanceId> instanceIds;
+        instanceIds.reserve(claimInstanceMapping.size());
         for (const auto& claim : claimInstanceMapping)
         {
-            const auto instanceId = claim.second;
-            InstanceSystemRequestBus::Broadcast(&InstanceSystemRequestBus::Events::DestroyInstance, instanceId);
+            instanceIds.push_back(claim.second);
         }
+        InstanceSystemRequestBus::Broadcast(&InstanceSystemRequestBus::Events::DestroyInstances, instanceIds);
 
 #if VEG_SPAWNER_ENABLE_CACHING
         //wipe the cache
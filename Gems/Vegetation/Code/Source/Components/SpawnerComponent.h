@@ -120,7 +120,8 @@ namespace Vegetation
         bool CreateInstance(const ClaimPoint &point, InstanceData& instanceData);
         bool EvaluateFilters(EntityIdStack& processedIds, InstanceData& instanceData, const FilterStage intendedStage) const;
         bool ProcessInstance(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr);
-        bool ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData);
+        bool ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, bool insideShapes, InstanceData& instanceData);
+        void TestPointsInsideShapes(const EntityIdStack& processedIds, const ClaimContext& context, AZStd::vector<bool>& insideShapes) const;
         void DestroyAllInstances();
         void CalcInstanceDebugColor(const EntityIdStack& processedIds);
 
@@ -285,10 +285,7 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::CreateInstance, instanceData.m_instanceId, instanceData.m_position, instanceData.m_id));
 
         //queue render node related tasks to process on the main thread
-        AddTask([this, instanceData]() {
-            CreateInstanceNode(instanceData);
-            m_createTaskCount--;
-        });
+        AddCreateTask(instanceData);
 
         m_createTaskCount++;
     }
@@ -306,19 +303,42 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteInstance, instanceId));
 
         //queue render node related tasks to process on the main thread
-        AddTask([this, instanceId]() {
-            ReleaseInstanceNode(instanceId);
-
-            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-            m_instanceDeletionSet.erase(instanceId);
-            m_destroyTaskCount--;
-        });
+        AddDestroyTasks(AZStd::span<const InstanceId>(&instanceId, 1));
 
         AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
         m_instanceDeletionSet.insert(instanceId);
         m_destroyTaskCount++;
     }
 
+    void InstanceSystemComponent::DestroyInstances(AZStd::span<const InstanceId> instanceIds)
+    {
+        AZ_PROFILE_FUNCTION(Vegetation);
+
+        AZStd::vector<InstanceId> validInstanceIds;
+        validInstanceIds.reserve(instanceIds.size());
+        for (InstanceId instanceId : instanceIds)
+        {
+            if (instanceId != InvalidInstanceId)
+            {
+                // do this here so we retain a correct ordering of events based on the vegetation thread.
+                VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteInstance, instanceId));
+                validInstanceIds.push_back(instanceId);
+            }
+        }
+
+        if (validInstanceIds.empty())
+        {
+            return;
+        }
+
+        //queue render node related tasks to process on the main thread, taking the task lock once for the whole batch
+        AddDestroyTasks(validInstanceIds);
+
+        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+        m_instanceDeletionSet.insert(validInstanceIds.begin(), validInstanceIds.end());
+        m_destroyTaskCount += static_cast<int>(validInstanceIds.size());
+    }
+
     void InstanceSystemComponent::DestroyAllInstances()
     {
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteAllInstances));
@@ -483,30 +503,55 @@ namespace Vegetation
         }
     }
 
-    void InstanceSystemComponent::ReleaseInstanceNode(InstanceId instanceId)
+    void InstanceSystemComponent::CreateInstanceNodes(AZStd::span<const InstanceData> instances)
     {
         AZ_PROFILE_FUNCTION(Vegetation);
 
-        DescriptorPtr descriptor = nullptr;
-        InstancePtr opaqueInstanceData = nullptr;
+        for (const InstanceData& instanceData : instances)
+        {
+            CreateInstanceNode(instanceData);
+        }
+    }
+
+    void InstanceSystemComponent::ReleaseInstanceNodes(AZStd::span<const InstanceId> instanceIds)
+    {
+        AZ_PROFILE_FUNCTION(Vegetation);
 
+        //remove the whole batch from the instance map under a single lock, then destroy the instances outside of it
+        AZStd::vector<AZStd::pair<DescriptorPtr, InstancePtr>> releasedInstances(instanceIds.size());
         {
             AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            auto instanceItr = m_instanceMap.find(instanceId);
-            if (instanceItr != m_instanceMap.end())
+            for (size_t i = 0; i < instanceIds.size(); ++i)
             {
-                descriptor = instanceItr->second.first;
-                opaqueInstanceData = instanceItr->second.second;
-                m_instanceMap.erase(instanceItr);
+                auto instanceItr = m_instanceMap.find(instanceIds[i]);
+                if (instanceItr != m_instanceMap.end())
+                {
+                    releasedInstances[i] = instanceItr->second;
+                    m_instanceMap.erase(instanceItr);
+                }
             }
             m_instanceCount = static_cast<int>(m_instanceMap.size());
         }
 
-        if (opaqueInstanceData)
+        for (size_t i = 0; i < instanceIds.size(); ++i)
         {
-            descriptor->DestroyInstance(instanceId, opaqueInstanceData);
+            if (releasedInstances[i].second)
+            {
+                releasedInstances[i].first->DestroyInstance(instanceIds[i], releasedInstances[i].second);
+            }
         }
-        ReleaseInstanceId(instanceId);
+
+        {
+            AZStd::lock_guard<decltype(m_instanceIdMutex)> scopedLock(m_instanceIdMutex);
+            m_instanceIdPool.insert(instanceIds.begin(), instanceIds.end());
+        }
+
+        AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+        for (InstanceId instanceId : instanceIds)
+        {
+            m_instanceDeletionSet.erase(instanceId);
+        }
+        m_destroyTaskCount -= static_cast<int>(instanceIds.size());
     }
 
     bool InstanceSystemComponent::HasTasks() const
@@ -520,6 +565,7 @@ namespace Vegetation
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
+        CloseInstanceBatches();
         if (m_mainThreadTaskQueue.empty() || m_mainThreadTaskQueue.back().size() >= m_configuration.m_maxInstanceTaskBatchSize)
         {
             m_mainThreadTaskQueue.emplace_back().reserve(m_configuration.m_maxInstanceTaskBatchSize);
@@ -527,6 +573,51 @@ namespace Vegetation
         m_mainThreadTaskQueue.back().emplace_back(task);
     }
 
+    void InstanceSystemComponent::AddCreateTask(const InstanceData& instanceData)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
+        m_openDestroyBatch.reset();
+        if (!m_openCreateBatch || m_openCreateBatch->size() >= m_configuration.m_maxInstanceTaskBatchSize)
+        {
+            m_openCreateBatch = AZStd::make_shared<InstanceDataBatch>();
+            m_openCreateBatch->reserve(m_configuration.m_maxInstanceTaskBatchSize);
+            m_mainThreadTaskQueue.emplace_back().emplace_back([this, batch = m_openCreateBatch]() {
+                CreateInstanceNodes(*batch);
+                m_createTaskCount -= static_cast<int>(batch->size());
+            });
+        }
+        m_openCreateBatch->push_back(instanceData);
+    }
+
+    void InstanceSystemComponent::AddDestroyTasks(AZStd::span<const InstanceId> instanceIds)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
+        m_openCreateBatch.reset();
+        for (InstanceId instanceId : instanceIds)
+        {
+            if (!m_openDestroyBatch || m_openDestroyBatch->size() >= m_configuration.m_maxInstanceTaskBatchSize)
+            {
+                m_openDestroyBatch = AZStd::make_shared<InstanceIdBatch>();
+                m_openDestroyBatch->reserve(m_configuration.m_maxInstanceTaskBatchSize);
+                m_mainThreadTaskQueue.emplace_back().emplace_back([this, batch = m_openDestroyBatch]() {
+                    ReleaseInstanceNodes(*batch);
+                });
+            }
+            m_openDestroyBatch->push_back(instanceId);
+        }
+    }
+
+    void InstanceSystemComponent::CloseInstanceBatches()
+    {
+        //batches already queued stop taking instances, so the main thread can execute them while others are being queued
+        m_openCreateBatch.reset();
+        m_openDestroyBatch.reset();
+    }
+
     void InstanceSystemComponent::ClearTasks()
     {
         AZ_PROFILE_FUNCTION(Vegetation);
@@ -534,6 +625,7 @@ namespace Vegetation
         AZStd::lock_guard<decltype(m_mainThreadTaskInProgressMutex)> mainThreadTaskInProgressLock(m_mainThreadTaskInProgressMutex);
         AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
         m_mainThreadTaskQueue.clear();
+        CloseInstanceBatches();
 
         m_createTaskCount = 0;
         m_destroyTaskCount = 0;
@@ -546,6 +638,11 @@ namespace Vegetation
         AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
         if (!m_mainThreadTaskQueue.empty())
         {
+            //the open batches are always at the back of the queue, they can't take more instances once they're being executed
+            if (m_mainThreadTaskQueue.size() == 1)
+            {
+                CloseInstanceBatches();
+            }
             removedTasks.splice(removedTasks.end(), m_mainThreadTaskQueue, m_mainThreadTaskQueue.begin());
             return true;
         }
@@ -577,7 +674,7 @@ namespace Vegetation
         }
 
         //offloading garbage collection to job to save time deallocating tasks on main thread
-        auto garbageCollectionJob = AZ::CreateJobFunction([]() mutable {}, true);
+        auto garbageCollectionJob = AZ::CreateJobFunction([removedTasksPtr = AZStd::move(removedTasksPtr)]() mutable { removedTasksPtr.reset(); }, true);
         garbageCollectionJob->Start();
     }
 
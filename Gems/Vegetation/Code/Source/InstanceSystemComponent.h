@@ -17,8 +17,10 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 #include <Vegetation/Descriptor.h>
 #include <Vegetation/InstanceData.h>
@@ -96,6 +98,7 @@ namespace Vegetation
 
         void CreateInstance(InstanceData& instanceData) override;
         void DestroyInstance(InstanceId instanceId) override;
+        void DestroyInstances(AZStd::span<const InstanceId> instanceIds) override;
         void DestroyAllInstances() override;
         void Cleanup() override;
 
@@ -126,8 +129,9 @@ namespace Vegetation
         // vegetation instance management
         bool IsInstanceSkippable(const InstanceData& instanceData) const;
         void CreateInstanceNode(const InstanceData& instanceData);
+        void CreateInstanceNodes(AZStd::span<const InstanceData> instances);
 
-        void ReleaseInstanceNode(InstanceId instanceId);
+        void ReleaseInstanceNodes(AZStd::span<const InstanceId> instanceIds);
 
         mutable AZStd::recursive_mutex m_instanceMapMutex;
         AZStd::unordered_map<InstanceId, AZStd::pair<DescriptorPtr, InstancePtr>> m_instanceMap;
@@ -144,8 +148,19 @@ namespace Vegetation
         mutable AZStd::recursive_mutex m_mainThreadTaskMutex;
         mutable AZStd::recursive_mutex m_mainThreadTaskInProgressMutex;
 
+        // creations and destructions are coalesced into batch tasks, each alone in its task batch so the main thread time budget
+        // is still checked between them. The batch at the back of the queue keeps taking instances until it's full, a task of
+        // another kind is queued or the main thread takes it.
+        using InstanceDataBatch = AZStd::vector<InstanceData>;
+        using InstanceIdBatch = AZStd::vector<InstanceId>;
+        AZStd::shared_ptr<InstanceDataBatch> m_openCreateBatch;
+        AZStd::shared_ptr<InstanceIdBatch> m_openDestroyBatch;
+
         bool HasTasks() const;
         void AddTask(const Task& task);
+        void AddCreateTask(const InstanceData& instanceData);
+        void AddDestroyTasks(AZStd::span<const InstanceId> instanceIds);
+        void CloseInstanceBatches();
         void ClearTasks();
         bool GetTasks(TaskList& removedTasks);
         void ExecuteTasks();
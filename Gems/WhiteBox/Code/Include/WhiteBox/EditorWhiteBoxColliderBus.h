@@ -21,6 +21,9 @@ namespace WhiteBox
         virtual void CreatePhysics(const WhiteBoxMesh& mesh) = 0;
         //! Destroys the physics mesh.
         virtual void DestroyPhysics() = 0;
+        //! Finishes cooking the physics mesh if a cook is still in flight, so the collider matches the mesh
+        //! when it is serialized.
+        virtual void CompletePhysics() = 0;
 
     protected:
         ~EditorWhiteBoxColliderRequests() = default;
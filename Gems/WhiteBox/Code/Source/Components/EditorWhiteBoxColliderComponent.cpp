@@ -10,7 +10,10 @@
 #include "EditorWhiteBoxComponent.h"
 #include "WhiteBoxColliderComponent.h"
 
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Physics/PhysicsScene.h>
@@ -95,6 +98,8 @@ namespace WhiteBox
             m_editorSceneHandle = m_sceneInterface->GetSceneHandle(AzPhysics::EditorPhysicsSceneName);
         }
 
+        m_cookCallbackToken = AZStd::make_shared<bool>(true);
+
         // can't use buses here as EditorWhiteBoxComponentBus is addressed using component id. How do get component id?
         if (auto whiteBoxComponent = GetEntity()->FindComponent<WhiteBox::EditorWhiteBoxComponent>())
         {
@@ -111,6 +116,10 @@ namespace WhiteBox
         EditorWhiteBoxColliderRequestBus::Handler::BusDisconnect();
         AzToolsFramework::Components::EditorComponentBase::Deactivate();
 
+        // keep the serialized mesh data up to date with the last edit before dropping any queued cook callbacks
+        CompletePhysics();
+        m_cookCallbackToken.reset();
+
         DestroyPhysics();
 
         m_sceneInterface = nullptr;
@@ -119,6 +128,8 @@ namespace WhiteBox
 
     void EditorWhiteBoxColliderComponent::BuildGameEntity(AZ::Entity* gameEntity)
     {
+        CompletePhysics();
+
         gameEntity->CreateComponent<WhiteBoxColliderComponent>(
             m_meshShapeConfiguration, m_physicsColliderConfiguration, m_whiteBoxColliderConfiguration);
     }
@@ -143,6 +154,12 @@ namespace WhiteBox
         }
 
         ConvertToPhysicsMesh(whiteBox);
+    }
+
+    void EditorWhiteBoxColliderComponent::ApplyCookedMesh(const AZStd::vector<AZ::u8>& cookedData)
+    {
+        m_meshShapeConfiguration.SetCookedMeshData(
+            cookedData.data(), cookedData.size(), Physics::CookedMeshShapeConfiguration::MeshType::TriangleMesh);
 
         AzPhysics::StaticRigidBodyConfiguration bodyConfiguration;
         bodyConfiguration.m_debugName = GetEntity()->GetName().c_str();
@@ -169,6 +186,24 @@ namespace WhiteBox
         }
     }
 
+    void EditorWhiteBoxColliderComponent::CompletePhysics()
+    {
+        if (!m_pendingCookRequest)
+        {
+            return;
+        }
+
+        // the job still in flight for this request will find it is no longer pending and drop its result
+        const AZStd::shared_ptr<CookRequest> cookRequest = AZStd::move(m_pendingCookRequest);
+        m_pendingCookRequest.reset();
+
+        AZStd::vector<AZ::u8> cookedData;
+        if (CookTriangleMesh(*cookRequest, cookedData))
+        {
+            ApplyCookedMesh(cookedData);
+        }
+    }
+
     static bool ConvertToTriangles(
         const WhiteBoxMesh& whiteBox, AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices)
     {
@@ -204,35 +239,70 @@ namespace WhiteBox
         return true;
     }
 
+    bool EditorWhiteBoxColliderComponent::CookTriangleMesh(const CookRequest& cookRequest, AZStd::vector<AZ::u8>& cookedData)
+    {
+        auto* physicsSystem = AZ::Interface<Physics::System>::Get();
+        if (!physicsSystem)
+        {
+            AZ_Warning(
+                "EditorWhiteBoxColliderComponent", false, "No physics backend enabled - please ensure one is provided");
+            return false;
+        }
+
+        const bool result = physicsSystem->CookTriangleMeshToMemory(
+            cookRequest.m_vertices.data(), (AZ::u32)cookRequest.m_vertices.size(), cookRequest.m_indices.data(),
+            (AZ::u32)cookRequest.m_indices.size(), cookedData);
+
+        AZ_Warning("EditorWhiteBoxColliderComponent", result, "Failed to cook mesh data");
+
+        return result;
+    }
+
     void EditorWhiteBoxColliderComponent::ConvertToPhysicsMesh(const WhiteBoxMesh& whiteBox)
     {
-        AZStd::vector<AZ::Vector3> vertices;
-        AZStd::vector<AZ::u32> indices;
+        auto cookRequest = AZStd::make_shared<CookRequest>();
         // convert white box mesh to vertices
-        if (!ConvertToTriangles(whiteBox, vertices, indices))
+        if (!ConvertToTriangles(whiteBox, cookRequest->m_vertices, cookRequest->m_indices))
         {
             // if there are no valid triangles then do not attempt to create a physics mesh
             return;
         }
 
-        if (auto* physicsSystem = AZ::Interface<Physics::System>::Get())
-        {
-            AZStd::vector<AZ::u8> bytes;
-            const bool result = physicsSystem->CookTriangleMeshToMemory(
-                vertices.data(), (AZ::u32)vertices.size(), indices.data(), (AZ::u32)indices.size(), bytes);
-
-            AZ_Warning("EditorWhiteBoxColliderComponent", result, "Failed to cook mesh data");
+        // any cook still in flight is superseded by this one
+        m_pendingCookRequest = cookRequest;
 
-            if (result)
-            {
-                m_meshShapeConfiguration.SetCookedMeshData(
-                    bytes.data(), bytes.size(), Physics::CookedMeshShapeConfiguration::MeshType::TriangleMesh);
-            }
-        }
-        else
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (!jobContext || !m_cookCallbackToken)
         {
-            AZ_Warning(
-                "EditorWhiteBoxColliderComponent", false, "No physics backend enabled - please ensure one is provided");
+            CompletePhysics();
+            return;
         }
+
+        // cooking is the expensive part of rebuilding the collider, so it is moved off the main thread
+        // while the mesh is being edited and the result is applied on the next tick
+        AZ::Job* job = AZ::CreateJobFunction(
+            [this, cookRequest, callbackToken = AZStd::weak_ptr<bool>(m_cookCallbackToken)]()
+            {
+                AZStd::vector<AZ::u8> cookedData;
+                const bool result = CookTriangleMesh(*cookRequest, cookedData);
+
+                AZ::TickBus::QueueFunction(
+                    [this, cookRequest, callbackToken, result, cookedData = AZStd::move(cookedData)]()
+                    {
+                        // the component was deactivated or a newer request was made since this cook started
+                        if (!callbackToken.lock() || m_pendingCookRequest != cookRequest)
+                        {
+                            return;
+                        }
+
+                        m_pendingCookRequest.reset();
+                        if (result)
+                        {
+                            ApplyCookedMesh(cookedData);
+                        }
+                    });
+            },
+            true, jobContext);
+        job->Start();
     }
 } // namespace WhiteBox
@@ -11,6 +11,8 @@
 #include "WhiteBoxColliderConfiguration.h"
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Physics/Shape.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
 #include <AzToolsFramework/ToolsComponents/EditorComponentBase.h>
@@ -57,8 +59,23 @@ namespace WhiteBox
         // EditorWhiteBoxColliderRequestBus ...
         void CreatePhysics(const WhiteBoxMesh& whiteBox) override;
         void DestroyPhysics() override;
+        void CompletePhysics() override;
 
+        //! Triangles of the white box mesh to cook.
+        //! Not modified once created, so the cook job and the main thread can share it.
+        struct CookRequest
+        {
+            AZStd::vector<AZ::Vector3> m_vertices;
+            AZStd::vector<AZ::u32> m_indices;
+        };
+
+        //! Extracts the triangles of the mesh and starts cooking them on a job.
+        //! Editing the mesh calls this on every manipulator update, so a newer request supersedes any cook in flight.
         void ConvertToPhysicsMesh(const WhiteBoxMesh& whiteBox);
+        //! Stores the cooked data and recreates the editor rigid body (main thread only).
+        void ApplyCookedMesh(const AZStd::vector<AZ::u8>& cookedData);
+
+        static bool CookTriangleMesh(const CookRequest& cookRequest, AZStd::vector<AZ::u8>& cookedData);
 
         AzPhysics::SceneInterface* m_sceneInterface = nullptr;
         AzPhysics::SceneHandle m_editorSceneHandle = AzPhysics::InvalidSceneHandle;
@@ -69,5 +86,7 @@ namespace WhiteBox
         AzPhysics::SimulatedBodyHandle m_rigidBodyHandle = AzPhysics::InvalidSimulatedBodyHandle; //!< Handle to a static rigid body to represent the White Box Mesh at edit time.
         WhiteBoxColliderConfiguration
             m_whiteBoxColliderConfiguration; //!< White Box specific collider configuration information.
+        AZStd::shared_ptr<CookRequest> m_pendingCookRequest; //!< The latest request that has not been applied yet.
+        AZStd::shared_ptr<bool> m_cookCallbackToken; //!< Queued cook callbacks are dropped once this is reset.
     };
 } // namespace WhiteBox
@@ -478,6 +478,8 @@ namespace WhiteBox
         {
             Api::WriteMesh(*m_whiteBox, m_whiteBoxData);
         }
+
+        EditorWhiteBoxColliderRequestBus::Event(GetEntityId(), &EditorWhiteBoxColliderRequests::CompletePhysics);
     }
 
     void EditorWhiteBoxComponent::SetDefaultShape(const DefaultShapeType defaultShape)